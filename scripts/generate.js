@@ -637,6 +637,46 @@ ${libIgnore}
     }
   }
 
+  // Tests natifs (hôte, sans carte) : un env par modèle qui déclare "native".
+  // Seules les sources listées sont compilées, avec les stubs de test/host
+  // (Arduino, FreeRTOS, panel capturé) ; les suites sont dans test/<modèle>/.
+  let nativeEnvs = '';
+  for (const [id, m] of Object.entries(models)) {
+    if (!m.native) continue;
+    const displayName = m.display_name;
+    const sources = (m.native.sources || []).map(s => `	+<${s}>`).join('\n');
+    nativeEnvs += `
+; ============================================
+; Tests natifs ${displayName} : pio test -e native_${id}
+; ============================================
+
+[env:native_${id}]
+platform = native
+framework = 
+platform_packages = 
+test_framework = unity
+test_filter = ${id}/*
+test_build_src = yes
+build_src_filter = 
+${sources}
+
+build_flags = 
+	-I $PROJECT_DIR/src
+	-I $PROJECT_DIR
+	-std=gnu++17
+	-O2
+	-Wno-format
+	-D${m.macro}
+	-DKIDOO_MODEL_ID=\\"${id}\\"
+	-lz
+	-lpthread
+
+lib_deps = 
+	symlink://test/host
+
+`;
+  }
+
   const header = `; PlatformIO Project Configuration File
 ;
 ;   Build options: build flags, source filter
@@ -701,7 +741,7 @@ monitor_rts = 0
 upload_speed = 921600
 `;
 
-  return header + envs;
+  return header + envs + nativeEnvs;
 }
 
 // Point d'entrée
@@ -72,6 +72,11 @@
   #define CORE_AUDIO        0
   #define CORE_MAIN         0
   #define CORE_OTA          0   // Même cœur, priorité plus basse que LED pour laisser l’arc-en-ciel fluide
+  #define CORE_DISPLAY      0
+  #define CORE_RENDER       0
+  #define CORE_RASTER       0   // = CORE_RENDER : rasterisation bi-cœur indisponible
+  #define CORE_AUDIO_CACHE  0
+  #define CORE_LOG          0
 #else
   // ESP32/S3 Dual-core (architecture optimale) :
   //
@@ -87,6 +92,12 @@
   #define CORE_AUDIO        1   // AudioManager/I2S sur Core 1 (isolé WiFi)
   #define CORE_LED          1   // LEDManager sur Core 1 (isolé WiFi - pas de flashs!)
   #define CORE_MAIN         1   // loop() Arduino (automatique sur Core 1)
+
+  #define CORE_DISPLAY      0   // Transfert écran (Gotchi) : en parallèle du rendu sur Core 1
+  #define CORE_RENDER       1   // Rendu visage/LVGL (Gotchi) : cadence fixe, hors loop()
+  #define CORE_RASTER       0   // Bande basse du visage (Gotchi), en parallèle de CORE_RENDER
+  #define CORE_AUDIO_CACHE  0   // Préchargement SD -> PSRAM, hors du cœur qui décode l'audio
+  #define CORE_LOG          0   // Écriture des logs (Serial, SD), hors du cœur audio/LED
 #endif
 
 // ============================================
@@ -101,6 +112,11 @@
   #define PRIORITY_MQTT     2   // Réseau
   #define PRIORITY_BLE_COMMAND 2  // Traitement commandes BLE (même priorité que MQTT)
   #define PRIORITY_WIFI_RETRY 1   // Background
+  #define PRIORITY_DISPLAY    2   // Transfert écran
+  #define PRIORITY_RENDER     2   // Rendu écran (au-dessus de loop())
+  #define PRIORITY_RASTER     2   // Rasterisation bande basse (non utilisée en single-core)
+  #define PRIORITY_AUDIO_CACHE 1  // Préchargement audio en tâche de fond
+  #define PRIORITY_LOG        1   // Écriture des logs en tâche de fond
 #else
   // Dual-core : Plus de marge car les tâches sont réparties
   // Audio a la priorité maximale pour éviter les claquements
@@ -110,6 +126,11 @@
   #define PRIORITY_MQTT     2   // Basse - réseau non critique
   #define PRIORITY_BLE_COMMAND 2  // Traitement commandes BLE (même priorité que MQTT)
   #define PRIORITY_WIFI_RETRY 1   // Très basse - retry en background
+  #define PRIORITY_DISPLAY    3   // Transfert écran - sous le WiFi, au-dessus du réseau applicatif
+  #define PRIORITY_RENDER     2   // Rendu écran - au-dessus de loop(), sous LED/Audio
+  #define PRIORITY_RASTER     2   // Bande basse du visage - même niveau que le rendu qui l'attend
+  #define PRIORITY_AUDIO_CACHE 1  // Très basse - préchargement SD en background
+  #define PRIORITY_LOG        1   // Très basse - écriture des logs en background
 #endif
 
 // ============================================
@@ -130,9 +151,15 @@
 
 #define STACK_SIZE_LED          4096    // LEDManager
 #define STACK_SIZE_AUDIO        16384   // AudioManager (décodage MP3/streaming) - augmenté pour buffer
+#define STACK_SIZE_AUDIO_MIXER  4096    // Mixeur audio Gotchi (voix PCM/tone, I2S)
+#define STACK_SIZE_AUDIO_CACHE  4096    // Préchargement SD -> PSRAM (AudioCache)
 #define STACK_SIZE_MQTT       8192    // MQTTManager (HTTP + JSON)
 #define STACK_SIZE_WIFI_RETRY   4096    // WiFi retry
 #define STACK_SIZE_WIFI_CONNECT 16384   // Tâche connexion WiFi async (config BLE)
+#define STACK_SIZE_DISPLAY      4096    // Transfert écran (Gotchi face renderer)
+#define STACK_SIZE_RENDER       8192    // Rendu Gotchi (face engine + LVGL + touch)
+#define STACK_SIZE_RASTER       4096    // Rasterisation bande basse du visage (Gotchi)
+#define STACK_SIZE_LOG          4096    // Écriture des logs (formatage différé, Serial, SD)
 #define STACK_SIZE_BLE_COMMAND  16384   // Tâche BLE (config WiFi, HTTP, JSON) - 16 Ko pour éviter overflow lors du changement de WiFi
 
 // ============================================
@@ -19,7 +19,7 @@
 #define MIN_SLEEP_TIMEOUT_MS 5000        // Minimum: 5 secondes
 #define SLEEP_FADE_DURATION_MS 1000      // Durée de l'animation de fade-out (1 seconde)
 
-// Logs verbeux (processCommand, effet sauvegardé, etc.) - 0 = désactivé, 1 = activé
+// Logs verbeux (applyMailbox, effet sauvegardé, etc.) - 0 = désactivé, 1 = activé
 #define ENABLE_VERBOSE_LOGS 0
 
 // URL de base de l'API serveur - définie dans include/app_config.h (racine du projet)
@@ -0,0 +1,452 @@
+#include "audio_cache.h"
+#include "models/model_config.h"
+#include "common/config/core_config.h"
+#include "common/managers/log/log_manager.h"
+#include <SD.h>
+#include <FSImpl.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <memory>
+#include <cstring>
+
+#ifdef HAS_AUDIO
+
+namespace {
+
+constexpr uint8_t PRELOAD_QUEUE_LEN = 8;
+constexpr size_t LOAD_CHUNK = 4096;
+
+struct Entry {
+  char path[AudioCache::PATH_MAX_LEN];
+  uint8_t* data;       // PSRAM, nullptr = slot libre
+  uint32_t cached;     // Octets en PSRAM (début du fichier)
+  uint32_t fileSize;
+  uint32_t lastUse;    // millis()
+  uint16_t refs;       // Fichiers ouverts sur cette entrée
+};
+
+Entry s_entries[AudioCache::MAX_ENTRIES];
+uint32_t s_usedBytes = 0;
+AudioCache::Stats s_stats = {};
+
+char s_playlist[AudioCache::PLAYLIST_MAX][AudioCache::PATH_MAX_LEN];
+uint8_t s_playlistCount = 0;
+
+SemaphoreHandle_t s_lock = nullptr;   // Entrées, stats et playlist
+QueueHandle_t s_preloadQueue = nullptr;
+TaskHandle_t s_task = nullptr;
+
+struct Lock {
+  Lock() { if (s_lock) xSemaphoreTake(s_lock, portMAX_DELAY); }
+  ~Lock() { if (s_lock) xSemaphoreGive(s_lock); }
+};
+
+// Sous s_lock
+Entry* findEntry(const char* path) {
+  for (Entry& e : s_entries) {
+    if (e.data && strcmp(e.path, path) == 0) return &e;
+  }
+  return nullptr;
+}
+
+// Sous s_lock
+void freeEntry(Entry& e) {
+  heap_caps_free(e.data);
+  s_usedBytes -= e.cached;
+  e.data = nullptr;
+  e.cached = 0;
+  e.path[0] = '\0';
+}
+
+// Libère l'entrée la moins récemment utilisée non ouverte (sous s_lock)
+bool evictOne() {
+  Entry* victim = nullptr;
+  for (Entry& e : s_entries) {
+    if (!e.data || e.refs) continue;
+    if (!victim || (int32_t)(e.lastUse - victim->lastUse) < 0) victim = &e;
+  }
+  if (!victim) return false;
+  LogManager::debug("[AUDIO-CACHE] Eviction: %s", victim->path);
+  freeEntry(*victim);
+  s_stats.evictions++;
+  return true;
+}
+
+// Insère un buffer chargé, en évinçant si besoin (sous s_lock)
+bool insertEntry(const char* path, uint8_t* data, uint32_t cached, uint32_t fileSize) {
+  while (s_usedBytes + cached > AudioCache::CACHE_BUDGET_BYTES) {
+    if (!evictOne()) return false;
+  }
+  Entry* slot = nullptr;
+  for (Entry& e : s_entries) {
+    if (!e.data) { slot = &e; break; }
+  }
+  if (!slot) {
+    if (!evictOne()) return false;
+    for (Entry& e : s_entries) {
+      if (!e.data) { slot = &e; break; }
+    }
+  }
+  strncpy(slot->path, path, sizeof(slot->path) - 1);
+  slot->path[sizeof(slot->path) - 1] = '\0';
+  slot->data = data;
+  slot->cached = cached;
+  slot->fileSize = fileSize;
+  slot->lastUse = millis();
+  slot->refs = 0;
+  s_usedBytes += cached;
+  return true;
+}
+
+// Charge path (entier ou son début) en PSRAM. Tâche de préchargement uniquement.
+void loadEntry(const char* path) {
+  {
+    Lock lock;
+    Entry* e = findEntry(path);
+    if (e) {
+      e->lastUse = millis();
+      return;
+    }
+  }
+
+  const uint32_t t0 = millis();
+  File f = SD.open(path, FILE_READ);
+  if (!f || f.isDirectory()) {
+    LogManager::warning("[AUDIO-CACHE] Prechargement impossible: %s", path);
+    return;
+  }
+  const uint32_t fileSize = f.size();
+  const uint32_t want = fileSize <= AudioCache::RESIDENT_MAX_BYTES ? fileSize : AudioCache::HEAD_BYTES;
+  uint8_t* data = want ? (uint8_t*)heap_caps_malloc(want, MALLOC_CAP_SPIRAM) : nullptr;
+  if (!data) {
+    f.close();
+    return;
+  }
+
+  uint32_t got = 0;
+  while (got < want) {
+    const size_t chunk = want - got < LOAD_CHUNK ? want - got : LOAD_CHUNK;
+    const int r = f.read(data + got, chunk);
+    if (r <= 0) break;
+    got += (uint32_t)r;
+  }
+  f.close();
+
+  Lock lock;
+  if (got != want || !insertEntry(path, data, got, fileSize)) {
+    heap_caps_free(data);
+    return;
+  }
+  s_stats.loads++;
+  s_stats.lastLoadMs = millis() - t0;
+  LogManager::debug("[AUDIO-CACHE] %s: %lu/%lu octets en %lu ms", path,
+    (unsigned long)got, (unsigned long)fileSize, (unsigned long)s_stats.lastLoadMs);
+}
+
+void preloadTask(void*) {
+  char path[AudioCache::PATH_MAX_LEN];
+  for (;;) {
+    if (xQueueReceive(s_preloadQueue, path, portMAX_DELAY) == pdTRUE) {
+      loadEntry(path);
+    }
+  }
+}
+
+// Fichier lu depuis une entrée du cache, puis depuis la SD au-delà de la
+// partie en PSRAM (entry == nullptr : SD directe).
+// Les méthodes qui varient selon la version du core Arduino (setBufferSize,
+// getNextFileName, seekDir) sont déclarées sans override.
+class CachedFileImpl : public fs::FileImpl {
+public:
+  CachedFileImpl(const char* path, Entry* entry) : _entry(entry) {
+    strncpy(_path, path, sizeof(_path) - 1);
+    _path[sizeof(_path) - 1] = '\0';
+    const char* slash = strrchr(_path, '/');
+    _name = slash ? slash + 1 : _path;
+    if (_entry) {
+      _data = _entry->data;
+      _cached = _entry->cached;
+      _size = _entry->fileSize;
+    }
+  }
+
+  ~CachedFileImpl() override { close(); }
+
+  bool openSd() {
+    _sd = SD.open(_path, FILE_READ);
+    if (!_sd) return false;
+    if (!_entry) _size = _sd.size();
+    if (_pos) _sd.seek(_pos);
+    return true;
+  }
+
+  size_t read(uint8_t* buf, size_t size) override {
+    if (!_open) return 0;
+    size_t n = 0;
+    if (_pos < _cached) {
+      n = _cached - _pos < size ? _cached - _pos : size;
+      memcpy(buf, _data + _pos, n);
+      _pos += n;
+    }
+    if (n < size && _pos < _size) {
+      if (!_sd) {
+        if (!openSd()) return n;
+      } else if (_sd.position() != _pos) {
+        _sd.seek(_pos);  // Seek différé, ou sortie de la partie en PSRAM
+      }
+      const size_t r = _sd.read(buf + n, size - n);
+      _pos += r;
+      n += r;
+    }
+    return n;
+  }
+
+  bool seek(uint32_t pos, SeekMode mode) override {
+    int64_t target = pos;
+    if (mode == SeekCur) target = (int64_t)_pos + pos;
+    else if (mode == SeekEnd) target = (int64_t)_size - pos;
+    if (target < 0 || target > (int64_t)_size) return false;
+    _pos = (uint32_t)target;  // Repositionnement SD à la prochaine lecture
+    return true;
+  }
+
+  void close() override {
+    if (!_open) return;
+    _open = false;
+    if (_sd) _sd.close();
+    if (_entry) {
+      Lock lock;
+      _entry->refs--;
+      _entry->lastUse = millis();
+    }
+  }
+
+  size_t write(const uint8_t*, size_t) override { return 0; }
+  void flush() override {}
+  size_t position() const override { return _pos; }
+  size_t size() const override { return _size; }
+  bool setBufferSize(size_t) { return false; }
+  time_t getLastWrite() override { return 0; }
+  const char* path() const override { return _path; }
+  const char* name() const override { return _name; }
+  boolean isDirectory(void) override { return false; }
+  fs::FileImplPtr openNextFile(const char*) override { return fs::FileImplPtr(); }
+  String getNextFileName(void) { return String(); }
+  String getNextFileName(bool* isDir) { if (isDir) *isDir = false; return String(); }
+  boolean seekDir(long) { return false; }
+  void rewindDirectory(void) override {}
+  operator bool() override { return _open; }
+
+private:
+  char _path[AudioCache::PATH_MAX_LEN];
+  const char* _name;
+  Entry* _entry;
+  const uint8_t* _data = nullptr;
+  uint32_t _cached = 0;
+  uint32_t _size = 0;
+  uint32_t _pos = 0;
+  File _sd;
+  bool _open = true;
+};
+
+// FS en lecture seule devant la SD
+class CachedFSImpl : public fs::FSImpl {
+public:
+  fs::FileImplPtr open(const char* path, const char* mode, const bool create) override {
+    (void)create;
+    if (!path || (mode && mode[0] != 'r')) return fs::FileImplPtr();
+
+    Entry* entry = nullptr;
+    {
+      Lock lock;
+      entry = findEntry(path);
+      if (entry) {
+        entry->refs++;
+        entry->lastUse = millis();
+        if (entry->cached == entry->fileSize) s_stats.hits++;
+        else s_stats.headHits++;
+      } else {
+        s_stats.misses++;
+      }
+    }
+
+    auto file = std::make_shared<CachedFileImpl>(path, entry);
+    if (!entry && !file->openSd()) return fs::FileImplPtr();
+    return file;
+  }
+
+  bool exists(const char* path) override { return AudioCache::exists(path); }
+  bool rename(const char*, const char*) override { return false; }
+  bool remove(const char*) override { return false; }
+  bool mkdir(const char*) override { return false; }
+  bool rmdir(const char*) override { return false; }
+};
+
+fs::FS s_fs(fs::FSImplPtr(new CachedFSImpl()));
+
+} // namespace
+
+bool AudioCache::init() {
+  if (s_task) return true;
+  if (!s_lock) s_lock = xSemaphoreCreateMutex();
+  if (!s_preloadQueue) s_preloadQueue = xQueueCreate(PRELOAD_QUEUE_LEN, PATH_MAX_LEN);
+  if (!s_lock || !s_preloadQueue) {
+    LogManager::error("[AUDIO-CACHE] Creation mutex/file echouee");
+    return false;
+  }
+  if (!psramFound()) {
+    LogManager::warning("[AUDIO-CACHE] Pas de PSRAM: lecture SD directe");
+    return false;
+  }
+
+  BaseType_t result = xTaskCreatePinnedToCore(
+      preloadTask,
+      "AudioCache",
+      STACK_SIZE_AUDIO_CACHE,
+      nullptr,
+      PRIORITY_AUDIO_CACHE,
+      &s_task,
+      CORE_AUDIO_CACHE);
+  if (result != pdPASS) {
+    LogManager::error("[AUDIO-CACHE] Impossible de creer la tache de prechargement");
+    s_task = nullptr;
+    return false;
+  }
+
+  LogManager::info("[AUDIO-CACHE] Cache PSRAM %lu KB (clips <= %lu KB entiers, debut de %lu KB sinon)",
+    (unsigned long)(CACHE_BUDGET_BYTES / 1024), (unsigned long)(RESIDENT_MAX_BYTES / 1024),
+    (unsigned long)(HEAD_BYTES / 1024));
+  return true;
+}
+
+fs::FS& AudioCache::fs() {
+  return s_fs;
+}
+
+bool AudioCache::exists(const char* path) {
+  if (!path) return false;
+  {
+    Lock lock;
+    if (findEntry(path)) return true;
+  }
+  return SD.exists(path);
+}
+
+bool AudioCache::preload(const char* path) {
+  if (!s_task || !path || strlen(path) >= PATH_MAX_LEN) return false;
+  char buf[PATH_MAX_LEN] = {};
+  strncpy(buf, path, PATH_MAX_LEN - 1);
+  return xQueueSend(s_preloadQueue, buf, 0) == pdTRUE;
+}
+
+void AudioCache::setPlaylist(const char* const* paths, uint8_t count) {
+  if (count > PLAYLIST_MAX) count = PLAYLIST_MAX;
+  {
+    Lock lock;
+    s_playlistCount = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      if (!paths[i] || strlen(paths[i]) >= PATH_MAX_LEN) continue;
+      strcpy(s_playlist[s_playlistCount++], paths[i]);
+    }
+  }
+  // Première piste et les suivantes prêtes avant le premier play
+  char first[PATH_MAX_LEN];
+  if (playlistNext(nullptr, first, sizeof(first))) onPlay(first);
+}
+
+namespace {
+// Sous s_lock
+int findTrack(const char* path) {
+  if (!path) return -1;
+  for (uint8_t i = 0; i < s_playlistCount; i++) {
+    if (strcmp(s_playlist[i], path) == 0) return i;
+  }
+  return -1;
+}
+} // namespace
+
+int AudioCache::playlistIndex(const char* path) {
+  Lock lock;
+  return findTrack(path);
+}
+
+bool AudioCache::playlistNext(const char* path, char* out, size_t outLen) {
+  Lock lock;
+  if (!s_playlistCount || !out || !outLen) return false;
+  const int idx = findTrack(path);
+  const uint8_t next = idx < 0 ? 0 : (idx + 1) % s_playlistCount;
+  strncpy(out, s_playlist[next], outLen - 1);
+  out[outLen - 1] = '\0';
+  return true;
+}
+
+uint8_t AudioCache::playlistSize() {
+  return s_playlistCount;
+}
+
+void AudioCache::onPlay(const char* path) {
+  if (!s_task || !path) return;
+
+  // Clip court joué depuis la SD : le garder pour la prochaine fois
+  bool cached;
+  {
+    Lock lock;
+    cached = findEntry(path) != nullptr;
+  }
+  if (!cached) preload(path);
+
+  char next[PREFETCH_AHEAD][PATH_MAX_LEN];
+  uint8_t n = 0;
+  {
+    Lock lock;
+    const int idx = findTrack(path);
+    if (idx < 0) return;
+    for (uint8_t k = 1; k <= PREFETCH_AHEAD && k < s_playlistCount; k++) {
+      strcpy(next[n++], s_playlist[(idx + k) % s_playlistCount]);
+    }
+  }
+  for (uint8_t i = 0; i < n; i++) preload(next[i]);
+}
+
+void AudioCache::clear() {
+  Lock lock;
+  for (Entry& e : s_entries) {
+    if (e.data && !e.refs) freeEntry(e);
+  }
+}
+
+AudioCache::Stats AudioCache::getStats() {
+  Lock lock;
+  Stats st = s_stats;
+  st.usedBytes = s_usedBytes;
+  st.entries = 0;
+  for (const Entry& e : s_entries) {
+    if (e.data) st.entries++;
+  }
+  return st;
+}
+
+void AudioCache::printStatus() {
+  const Stats st = getStats();
+  LogManager::info("[AUDIO-CACHE] %s, %u entrees, %lu/%lu KB", s_task ? "Actif" : "Inactif",
+    st.entries, (unsigned long)(st.usedBytes / 1024), (unsigned long)(CACHE_BUDGET_BYTES / 1024));
+  LogManager::info("[AUDIO-CACHE] Ouvertures: %lu en PSRAM, %lu debut en PSRAM, %lu SD directe",
+    (unsigned long)st.hits, (unsigned long)st.headHits, (unsigned long)st.misses);
+  LogManager::info("[AUDIO-CACHE] Prechargements: %lu (dernier %lu ms), evictions: %lu",
+    (unsigned long)st.loads, (unsigned long)st.lastLoadMs, (unsigned long)st.evictions);
+
+  Lock lock;
+  for (const Entry& e : s_entries) {
+    if (!e.data) continue;
+    LogManager::info("[AUDIO-CACHE]   %s %lu/%lu octets%s", e.path,
+      (unsigned long)e.cached, (unsigned long)e.fileSize, e.refs ? " (en lecture)" : "");
+  }
+  if (s_playlistCount) {
+    LogManager::info("[AUDIO-CACHE] Playlist: %u pistes", s_playlistCount);
+  }
+}
+
+#endif // HAS_AUDIO
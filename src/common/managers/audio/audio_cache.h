@@ -0,0 +1,104 @@
+#ifndef AUDIO_CACHE_H
+#define AUDIO_CACHE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+/**
+ * Cache de lecture audio en PSRAM pour AudioManager
+ *
+ * AudioManager passe AudioCache::fs() à connecttoFS() au lieu de SD : les
+ * lectures du décodeur sont servies depuis la PSRAM quand le fichier (ou son
+ * début) y est déjà, et basculent sur la SD de façon transparente au-delà.
+ *
+ * - Clips courts (<= RESIDENT_MAX_BYTES) : gardés entiers en PSRAM après
+ *   lecture ou préchargement, rejoués sans aucun accès SD
+ * - Fichiers longs : seuls les HEAD_BYTES premiers octets sont préchargés,
+ *   le démarrage est instantané et l'ouverture SD se fait pendant que le
+ *   décodeur consomme ce début
+ * - Playlist : quand une piste de la playlist démarre, les PREFETCH_AHEAD
+ *   suivantes sont préchargées par une tâche de fond basse priorité
+ *
+ * Éviction LRU dans un budget de CACHE_BUDGET_BYTES ; une entrée en cours de
+ * lecture n'est jamais libérée (compteur de références).
+ */
+
+class AudioCache {
+public:
+  static constexpr uint32_t CACHE_BUDGET_BYTES = 2 * 1024 * 1024;
+  static constexpr uint32_t RESIDENT_MAX_BYTES = 256 * 1024;
+  static constexpr uint32_t HEAD_BYTES = 64 * 1024;
+  static constexpr uint8_t MAX_ENTRIES = 16;
+  static constexpr uint8_t PLAYLIST_MAX = 16;
+  static constexpr uint8_t PREFETCH_AHEAD = 2;
+  static constexpr uint8_t PATH_MAX_LEN = 96;
+
+  struct Stats {
+    uint32_t hits;          // Fichier entier en PSRAM
+    uint32_t headHits;      // Début en PSRAM, suite sur SD
+    uint32_t misses;        // Lecture SD directe
+    uint32_t loads;         // Préchargements terminés
+    uint32_t evictions;
+    uint32_t lastLoadMs;    // Durée du dernier préchargement (FAT + lecture SD)
+    uint32_t usedBytes;
+    uint8_t entries;
+  };
+
+  /**
+   * Créer la tâche de préchargement
+   * @return false si la PSRAM ou la tâche sont indisponibles (le FS reste
+   *         utilisable, en lecture SD directe)
+   */
+  static bool init();
+
+  /**
+   * FS à passer à audio.connecttoFS()
+   */
+  static fs::FS& fs();
+
+  /**
+   * Le fichier existe-t-il (cache d'abord, SD sinon)
+   */
+  static bool exists(const char* path);
+
+  /**
+   * Précharger un fichier en tâche de fond (non bloquant)
+   * @return false si la file de préchargement est pleine
+   */
+  static bool preload(const char* path);
+
+  /**
+   * Définir la playlist (copie des chemins) et précharger son début
+   */
+  static void setPlaylist(const char* const* paths, uint8_t count);
+
+  /**
+   * Index de path dans la playlist, -1 si absent
+   */
+  static int playlistIndex(const char* path);
+
+  /**
+   * Copier dans out le chemin de la piste suivant path dans la playlist
+   * (boucle), ou de la première si path n'en fait pas partie
+   * @return false si la playlist est vide
+   */
+  static bool playlistNext(const char* path, char* out, size_t outLen);
+
+  static uint8_t playlistSize();
+
+  /**
+   * À appeler au démarrage d'une piste : précharge les pistes suivantes de
+   * la playlist et garde la piste en cache si c'est un clip court
+   */
+  static void onPlay(const char* path);
+
+  /**
+   * Vider le cache (les entrées en cours de lecture sont conservées)
+   */
+  static void clear();
+
+  static Stats getStats();
+  static void printStatus();
+};
+
+#endif // AUDIO_CACHE_H
@@ -10,6 +10,8 @@
 #include "common/config/core_config.h"
 #include "common/managers/sd/sd_manager.h"
 #include "common/managers/log/log_manager.h"
+#include "audio_cache.h"
+#include "common/managers/led/led_manager.h"
 #include <SD.h>
 
 #ifdef HAS_AUDIO
@@ -35,16 +37,52 @@ volatile bool AudioManager::volumeChanged = false;  // Flag changement volume
 volatile bool AudioManager::stopRequested = false;  // Flag stop demandé
 volatile bool AudioManager::pauseRequested = false; // Flag pause demandé
 volatile bool AudioManager::resumeRequested = false;// Flag resume demandé
+volatile bool AudioManager::statsResetRequested = false;  // Flag resetStats() demandé
 String AudioManager::currentFile = "";
 
 TaskHandle_t AudioManager::audioTaskHandle = nullptr;
 SemaphoreHandle_t AudioManager::audioMutex = nullptr;
 
+AudioManager::Stats AudioManager::stats = {};
+volatile uint32_t AudioManager::playRequestUs = 0;
+volatile bool AudioManager::awaitingFirstLoop = false;
+uint32_t AudioManager::lastLoopEndUs = 0;
+bool AudioManager::inputStarved = false;
+
 // Réglages sync
 static constexpr TickType_t MUTEX_TIMEOUT_SHORT = pdMS_TO_TICKS(5);  // court, évite les trous
 static constexpr TickType_t MUTEX_TIMEOUT_READ  = pdMS_TO_TICKS(1);  // ultra court
 
 #ifdef HAS_AUDIO
+// =========================
+// Instrumentation
+// =========================
+// Appelée par la task audio, mutex pris, juste après audio.loop()
+void AudioManager::recordLoop(uint32_t startUs, uint32_t endUs) {
+  if (!audio.isRunning()) {
+    lastLoopEndUs = 0;
+    inputStarved = false;
+    return;
+  }
+
+  if (awaitingFirstLoop) {
+    stats.startUs.add(endUs - playRequestUs);
+    awaitingFirstLoop = false;
+  }
+  stats.loopUs.add(endUs - startUs);
+  if (lastLoopEndUs) stats.loopGapUs.add(startUs - lastLoopEndUs);
+  lastLoopEndUs = endUs;
+
+  const uint32_t filled = audio.inBufferFilled();
+  const uint32_t total = filled + audio.inBufferFree();
+  if (total) stats.fill[(uint64_t)filled * (Stats::FILL_BUCKETS - 1) / total]++;
+
+  // Buffer vide avant la fin du fichier : la SD n'a pas suivi le décodeur
+  const bool empty = filled == 0 && audio.getFilePos() < audio.getFileSize();
+  if (empty && !inputStarved) stats.starved++;
+  inputStarved = empty;
+}
+
 // =========================
 // Task audio dédiée
 // =========================
@@ -57,6 +95,13 @@ void AudioManager::audioTask(void* parameter) {
   threadRunning = true;
 
   while (true) {
+    // Stats écrites par cette task seulement : remise à zéro ici
+    if (statsResetRequested) {
+      stats = {};
+      lastLoopEndUs = 0;
+      statsResetRequested = false;
+    }
+
     // Traiter les commandes lock-free (pas d'attente mutex)
     if (audioMutex && xSemaphoreTake(audioMutex, 0) == pdTRUE) {
       // Stop a la priorité la plus haute
@@ -65,6 +110,7 @@ void AudioManager::audioTask(void* parameter) {
         currentFile = "";
         paused = false;
         stopRequested = false;
+        lastLoopEndUs = 0;
         LogManager::info("[AUDIO] Lecture arretee");
       }
       // Puis Pause
@@ -72,6 +118,7 @@ void AudioManager::audioTask(void* parameter) {
         audio.pauseResume();
         paused = true;
         pauseRequested = false;
+        lastLoopEndUs = 0;  // La pause n'est pas un trou de lecture
         LogManager::info("[AUDIO] Lecture en pause");
       }
       // Puis Resume
@@ -98,10 +145,14 @@ void AudioManager::audioTask(void* parameter) {
     if (available && !paused) {
       // Lire l'audio (non-bloquant)
       if (audioMutex && xSemaphoreTake(audioMutex, 0) == pdTRUE) {
+        const uint32_t loopStart = micros();
         audio.loop();
+        recordLoop(loopStart, micros());
         xSemaphoreGive(audioMutex);
+      } else if (lastLoopEndUs) {
+        // Si mutex occupé, on saute ce tour
+        stats.skippedLoops++;
       }
-      // Si mutex occupé, on saute ce tour
     }
 
     // Courte pause pour équilibrer CPU entre audio et autres tâches (WiFi/BLE/MQTT)
@@ -162,6 +213,9 @@ bool AudioManager::init() {
     return false;
   }
 
+  // Cache PSRAM devant la SD (optionnel : sans lui, lecture SD directe)
+  AudioCache::init();
+
   // Marquer dispo avant de lancer la task
   available = true;
 
@@ -201,6 +255,7 @@ void AudioManager::loop() {
 
 bool AudioManager::play(const char* path) {
 #ifdef HAS_AUDIO
+  playRequestUs = micros();
   if (!available) {
     LogManager::error("[AUDIO] Audio non initialise");
     return false;
@@ -209,7 +264,7 @@ bool AudioManager::play(const char* path) {
     LogManager::error("[AUDIO] Chemin de fichier invalide");
     return false;
   }
-  if (!SD.exists(path)) {
+  if (!AudioCache::exists(path)) {
     Serial.printf("[AUDIO] ERREUR: Fichier non trouve: %s\n", path);
     return false;
   }
@@ -219,11 +274,14 @@ bool AudioManager::play(const char* path) {
     audio.stopSong();
     LogManager::info("[AUDIO] Lecture: %s", path);
 
-    bool success = audio.connecttoFS(SD, path);
+    // Lecture via le cache : début servi depuis la PSRAM s'il y est
+    bool success = audio.connecttoFS(AudioCache::fs(), path);
 
     if (success) {
       currentFile = path;
       paused = false;
+      awaitingFirstLoop = true;
+      lastLoopEndUs = 0;
       LogManager::info("[AUDIO] Lecture demarree");
     } else {
       currentFile = "";
@@ -231,6 +289,9 @@ bool AudioManager::play(const char* path) {
     }
 
     xSemaphoreGive(audioMutex);
+
+    // Hors mutex : précharger les pistes suivantes pendant la lecture
+    if (success) AudioCache::onPlay(path);
     return success;
   } else {
     LogManager::error("[AUDIO] Mutex occupe (play), reessaye");
@@ -241,6 +302,31 @@ bool AudioManager::play(const char* path) {
 #endif
 }
 
+void AudioManager::setPlaylist(const char* const* paths, uint8_t count) {
+#ifdef HAS_AUDIO
+  AudioCache::setPlaylist(paths, count);
+  LogManager::info("[AUDIO] Playlist: %u pistes", AudioCache::playlistSize());
+#else
+  (void)paths;
+  (void)count;
+#endif
+}
+
+bool AudioManager::playNext() {
+#ifdef HAS_AUDIO
+  // Piste suivante, ou première si le fichier en cours n'est pas dans la playlist
+  String current = currentFile;
+  char next[AudioCache::PATH_MAX_LEN];
+  if (!AudioCache::playlistNext(current.c_str(), next, sizeof(next))) {
+    LogManager::error("[AUDIO] Playlist vide");
+    return false;
+  }
+  return play(next);
+#else
+  return false;
+#endif
+}
+
 void AudioManager::pause() {
 #ifdef HAS_AUDIO
   if (!available) return;
@@ -367,6 +453,51 @@ uint32_t AudioManager::getPosition() {
 #endif
 }
 
+const AudioManager::Stats& AudioManager::getStats() {
+  return stats;
+}
+
+void AudioManager::resetStats() {
+  if (threadRunning) {
+    statsResetRequested = true;
+  } else {
+    stats = {};
+  }
+#ifdef HAS_LED
+  LEDManager::resetShowStats();
+#endif
+}
+
+void AudioManager::printStats() {
+  char hist[96];
+  LogManager::info("[AUDIO] Stats flux audio (us)");
+  stats.startUs.format(hist, sizeof(hist));
+  LogManager::info("  play -> premier loop: %s", hist);
+  stats.loopUs.format(hist, sizeof(hist));
+  LogManager::info("  duree audio.loop():   %s", hist);
+  stats.loopGapUs.format(hist, sizeof(hist));
+  LogManager::info("  ecart entre loops:    %s", hist);
+  LogManager::info("  Buffer vide avant fin: %lu, tours sautes (mutex): %lu",
+                (unsigned long)stats.starved, (unsigned long)stats.skippedLoops);
+
+  char fill[96];
+  int pos = 0;
+  for (int i = 0; i < Stats::FILL_BUCKETS && pos < (int)sizeof(fill); i++) {
+    pos += snprintf(fill + pos, sizeof(fill) - pos, " %d%%:%lu", i * 10, (unsigned long)stats.fill[i]);
+  }
+  LogManager::info("  Remplissage buffer:%s", fill);
+
+#ifdef HAS_LED
+  // strip->show() coupe les interruptions : à corréler avec les écarts entre loops
+  LEDManager::getShowStats().format(hist, sizeof(hist));
+  LogManager::info("  LED strip->show():    %s (intervalle min %lu ms)", hist,
+                (unsigned long)LEDManager::SHOW_INTERVAL_MS);
+  const LEDOutput::Stats& led = LEDOutput::getStats();
+  LogManager::info("  LED trames envoyees: %lu, identiques sautees: %lu (sortie %s)",
+                (unsigned long)led.sent, (unsigned long)led.suppressed, LEDOutput::getName());
+#endif
+}
+
 void AudioManager::printStatus() {
   LogManager::info("");
   LogManager::info("========================================");
@@ -2,6 +2,7 @@
 #define AUDIO_MANAGER_H
 
 #include <Arduino.h>
+#include "common/utils/histogram.h"
 
 /**
  * Gestionnaire Audio I2S avec thread FreeRTOS dédié
@@ -42,6 +43,19 @@ public:
    * @return true si la lecture a démarré
    */
   static bool play(const char* path);
+
+  /**
+   * Définir une playlist : ses pistes sont préchargées en PSRAM
+   * (AudioCache) avant d'être jouées
+   * @param paths Chemins des fichiers (copiés)
+   */
+  static void setPlaylist(const char* const* paths, uint8_t count);
+
+  /**
+   * Jouer la piste suivante de la playlist (la première si le fichier en
+   * cours n'en fait pas partie)
+   */
+  static bool playNext();
   
   /**
    * Mettre en pause la lecture
@@ -119,6 +133,36 @@ public:
    */
   static void printStatus();
 
+  // ============================================
+  // Instrumentation (tâche audio)
+  // ============================================
+
+  /**
+   * Santé du flux audio, mesurée autour de audio.loop()
+   *
+   * ESP32-audioI2S n'expose pas sa file DMA : un underrun se voit comme un
+   * buffer d'entrée vide (décodeur affamé par la SD) ou comme un écart trop
+   * long entre deux audio.loop() (tâche audio privée de CPU).
+   */
+  struct Stats {
+    Log2Histogram startUs;    // play() -> fin du premier audio.loop() de la piste
+    Log2Histogram loopUs;     // Durée d'un audio.loop() (décodage + écriture I2S)
+    Log2Histogram loopGapUs;  // Écart entre deux audio.loop() pendant la lecture
+    static constexpr int FILL_BUCKETS = 11;  // 0 %, 10 %, ... 100 %
+    uint32_t fill[FILL_BUCKETS];  // Remplissage du buffer d'entrée par dizaine de %, à chaque loop
+    uint32_t starved;         // Buffer d'entrée vidé avant la fin du fichier
+    uint32_t skippedLoops;    // Tours sans audio.loop() (mutex occupé) pendant la lecture
+  };
+
+  static const Stats& getStats();
+  // Remise à zéro faite par la task audio (seule à écrire les stats) au tour suivant
+  static void resetStats();
+
+  /**
+   * Afficher les stats sur Serial (avec le temps de strip->show() des LEDs)
+   */
+  static void printStats();
+
 private:
   // Thread FreeRTOS
   static void audioTask(void* parameter);
@@ -140,9 +184,18 @@ private:
   static volatile bool stopRequested;     // Flag stop demandé
   static volatile bool pauseRequested;    // Flag pause demandé
   static volatile bool resumeRequested;   // Flag resume demandé
+  static volatile bool statsResetRequested;  // Flag resetStats() demandé
 
   // Mutex pour la synchronisation thread-safe
   static SemaphoreHandle_t audioMutex;
+
+  // Instrumentation (écrite par la tâche audio uniquement, sauf playRequestUs)
+  static Stats stats;
+  static volatile uint32_t playRequestUs;  // micros() du dernier play()
+  static volatile bool awaitingFirstLoop;  // Premier loop de la piste pas encore mesuré
+  static uint32_t lastLoopEndUs;           // 0 = pas de lecture au tour précédent
+  static bool inputStarved;
+  static void recordLoop(uint32_t startUs, uint32_t endUs);
 };
 
 #endif // AUDIO_MANAGER_H
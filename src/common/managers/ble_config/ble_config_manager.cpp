@@ -306,6 +306,7 @@ void BLEConfigManager::handleButtonPress() {
         unsigned long pressDuration = currentTime - pressStartTime;
         if (pressDuration >= REBOOT_LONG_PRESS_MS) {
           LogManager::info("[BLE-CONFIG] Appui 10s detecte -> REBOOT");
+          LogManager::flush();
           ESP.restart();
         }
         // Vérifier si on a atteint le seuil d'appui long (3s) -> BLE
@@ -327,6 +328,7 @@ void BLEConfigManager::handleButtonPress() {
         unsigned long pressDuration = currentTime - pressStartTime;
         if (pressDuration >= REBOOT_LONG_PRESS_MS) {
           LogManager::info("[BLE-CONFIG] Appui 10s detecte -> REBOOT");
+          LogManager::flush();
           ESP.restart();
         }
       }
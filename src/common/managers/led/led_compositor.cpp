@@ -0,0 +1,149 @@
+#include "led_compositor.h"
+#include "led_math.h"
+
+namespace {
+
+// Trame intermédiaire 16 bits par canal (R, G, B)
+uint16_t mix[(NUM_LEDS > 0 ? NUM_LEDS : 1) * 3];
+
+#if LED_TEMPORAL_DITHER
+// Reste de chaque canal (en 1/256 de pas 8 bits), reporté à la trame suivante
+uint8_t ditherError[(NUM_LEDS > 0 ? NUM_LEDS : 1) * 3];
+#endif
+
+const uint32_t OVERLAY_PULSE_CYCLE_MS = 800;
+
+} // namespace
+
+LEDCompositor::Overlay LEDCompositor::overlays[LED_OVERLAY_COUNT] = {};
+uint32_t LEDCompositor::estimatedCurrentMa = 0;
+uint32_t LEDCompositor::requestedCurrentMa = 0;
+
+void LEDCompositor::setOverlay(LEDOverlayLayer layer, uint32_t color, uint8_t level,
+                               uint16_t durationMs, LEDOverlayShape shape, uint32_t now) {
+  if (layer >= LED_OVERLAY_COUNT) return;
+  Overlay& overlay = overlays[layer];
+  overlay.color = color;
+  overlay.level = level;
+  overlay.durationMs = durationMs;
+  overlay.shape = shape;
+  overlay.startMs = now;
+}
+
+bool LEDCompositor::hasOverlay(uint32_t now) {
+  for (uint8_t i = 0; i < LED_OVERLAY_COUNT; i++) {
+    if (overlays[i].durationMs > 0 && now - overlays[i].startMs < overlays[i].durationMs) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t LEDCompositor::getEstimatedCurrentMa() {
+  return estimatedCurrentMa;
+}
+
+uint32_t LEDCompositor::getRequestedCurrentMa() {
+  return requestedCurrentMa;
+}
+
+bool LEDCompositor::compose(const uint32_t* base, uint16_t count, uint16_t level,
+                            uint32_t now, Adafruit_NeoPixel* strip) {
+  if (strip == nullptr) return false;
+  if (count > NUM_LEDS) count = NUM_LEDS;
+
+  // 1-2. Base x niveau maître linéarisé : c x 257 étend 0-255 sur 0-65535
+  const uint32_t baseScale = (uint32_t)LEDMath::gamma16(level) + 1;
+  for (uint16_t i = 0; i < count; i++) {
+    const uint32_t c = base[i];
+    mix[i * 3 + 0] = (uint16_t)((((c >> 16) & 0xFF) * 257 * baseScale) >> 16);
+    mix[i * 3 + 1] = (uint16_t)((((c >> 8) & 0xFF) * 257 * baseScale) >> 16);
+    mix[i * 3 + 2] = (uint16_t)(((c & 0xFF) * 257 * baseScale) >> 16);
+  }
+
+  // 3. Calques transitoires : couleur uniforme, opacité selon le fondu d'entrée/sortie
+  for (uint8_t l = 0; l < LED_OVERLAY_COUNT; l++) {
+    Overlay& overlay = overlays[l];
+    if (overlay.durationMs == 0) continue;
+    const uint32_t elapsed = now - overlay.startMs;
+    if (elapsed >= overlay.durationMs) {
+      overlay.durationMs = 0;  // Terminé : la base réapparaît
+      continue;
+    }
+
+    // Opacité sur 256 : rampe au début et à la fin
+    const uint32_t remaining = overlay.durationMs - elapsed;
+    const uint32_t edge = elapsed < remaining ? elapsed : remaining;
+    const uint32_t alpha = edge >= OVERLAY_FADE_MS ? 256 : (edge * 256) / OVERLAY_FADE_MS;
+
+    uint8_t overlayLevel = overlay.level;
+    if (overlay.shape == LED_OVERLAY_PULSE) {
+      // Pulsation de ~12% à 100% du niveau du calque
+      const uint8_t wave = LEDMath::sin8(LEDMath::phase16(elapsed, OVERLAY_PULSE_CYCLE_MS) - 16384);
+      overlayLevel = LEDMath::scale8(overlayLevel, 30 + LEDMath::scale8(wave, 225));
+    }
+
+    // Couleur du calque sur 16 bits, calculée une fois pour toute la bande
+    const uint32_t overlayScale = (uint32_t)LEDMath::gamma16(overlayLevel * 257) + 1;
+    int32_t target[3];
+    for (uint8_t ch = 0; ch < 3; ch++) {
+      const uint32_t c = (overlay.color >> (16 - ch * 8)) & 0xFF;
+      target[ch] = (int32_t)((c * 257 * overlayScale) >> 16);
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+      for (uint8_t ch = 0; ch < 3; ch++) {
+        const int32_t current = mix[i * 3 + ch];
+        mix[i * 3 + ch] = (uint16_t)(current + (((target[ch] - current) * (int32_t)alpha) >> 8));
+      }
+    }
+  }
+
+  // 4. Limite de courant : chaque canal consomme CHANNEL_MA x v / 65535
+  uint32_t sum = 0;
+  for (uint16_t i = 0; i < count * 3; i++) {
+    sum += mix[i];
+  }
+  const uint32_t idleMa = (uint32_t)count * IDLE_MA;
+  const uint32_t channelMa = (sum * CHANNEL_MA + 32767) / 65535;
+  requestedCurrentMa = idleMa + channelMa;
+  estimatedCurrentMa = requestedCurrentMa;
+#if LED_MAX_CURRENT_MA > 0
+  if (requestedCurrentMa > LED_MAX_CURRENT_MA && channelMa > 0) {
+    // Même facteur pour tous les canaux : les teintes sont conservées
+    const uint32_t budgetMa = LED_MAX_CURRENT_MA > idleMa ? LED_MAX_CURRENT_MA - idleMa : 0;
+    const uint32_t scale = (budgetMa << 16) / channelMa;
+    for (uint16_t i = 0; i < count * 3; i++) {
+      mix[i] = (uint16_t)((mix[i] * scale) >> 16);
+    }
+    estimatedCurrentMa = idleMa + budgetMa;
+  }
+#endif
+
+  // 5. Vers 8 bits : v / 257 (inverse de l'extension c x 257) en virgule fixe 8.8
+  bool ditherPending = false;
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t rgb[3];
+    for (uint8_t ch = 0; ch < 3; ch++) {
+      const uint32_t v = mix[i * 3 + ch];
+      const uint32_t t = v - (v >> 8);
+#if LED_TEMPORAL_DITHER
+      // Sous un pas 8 bits, arrondi simple : pas de scintillement éteint/allumé
+      uint8_t& error = ditherError[i * 3 + ch];
+      if (t >= 256) {
+        const uint32_t acc = t + error;
+        rgb[ch] = (uint8_t)(acc >> 8);
+        error = (uint8_t)acc;
+        ditherPending = ditherPending || (t & 0xFF) != 0;
+      } else {
+        rgb[ch] = (uint8_t)((t + 128) >> 8);
+        error = 0;
+      }
+#else
+      rgb[ch] = (uint8_t)((t + 128) >> 8);
+#endif
+    }
+    strip->setPixelColor(i, rgb[0], rgb[1], rgb[2]);
+  }
+  return ditherPending;
+}
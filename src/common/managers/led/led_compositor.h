@@ -0,0 +1,111 @@
+#ifndef LED_COMPOSITOR_H
+#define LED_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "models/model_config.h"
+#include "led_output.h"
+
+// Tramage temporel 16 -> 8 bits (config.h du modèle). Il redessine la bande
+// à chaque envoi tant qu'un reste est à répartir : activé par défaut
+// seulement avec la sortie RMT (envoi non bloquant)
+#ifndef LED_TEMPORAL_DITHER
+#define LED_TEMPORAL_DITHER LED_OUTPUT_RMT
+#endif
+
+// Budget de courant estimé de la bande en mA (config.h du modèle, 0 = sans limite)
+#ifndef LED_MAX_CURRENT_MA
+#define LED_MAX_CURRENT_MA 0
+#endif
+
+/**
+ * Compositeur des calques LED (appelé par la tâche LED avant chaque envoi)
+ *
+ * Une trame est assemblée à partir de :
+ * 1. Calque de base : l'effet courant ou la couleur unie (0xRRGGBB)
+ * 2. Niveau maître : luminosité configurée x fondus (veille, réveil,
+ *    extinction progressive), appliqué au calque de base
+ * 3. Calques transitoires (alerte, feedback tactile) : couleur et niveau
+ *    propres, mélangés par-dessus avec un fondu d'entrée/sortie
+ *
+ * Le mélange se fait sur 16 bits par canal. Les niveaux (maître et calques)
+ * sont perceptuels : ils passent par la table gamma (LEDMath::gamma16) avant
+ * d'être appliqués, une fois par trame. La trame linéaire est ensuite
+ * ramenée sous LED_MAX_CURRENT_MA (courant estimé d'après la somme des
+ * canaux), puis convertie vers les 8 bits de la bande, avec un tramage
+ * temporel (le reste de chaque canal est reporté à la trame suivante) qui
+ * lisse les fondus à bas niveau. La luminosité d'Adafruit_NeoPixel reste à
+ * 255 : setBrightness() redimensionne le buffer en place et perd de la
+ * précision à chaque appel.
+ *
+ * Un calque transitoire masque la base sans la modifier : à sa fin, la
+ * base (routine coucher, réveil...) réapparaît telle quelle, sans rien
+ * restaurer.
+ */
+
+// Calques transitoires, dessinés dans cet ordre (le dernier au-dessus)
+enum LEDOverlayLayer {
+  LED_OVERLAY_ALERT,   // Feedback d'alerte (vert/rouge pulsé)
+  LED_OVERLAY_TOUCH,   // Feedback tactile bref
+  LED_OVERLAY_COUNT
+};
+
+enum LEDOverlayShape {
+  LED_OVERLAY_SOLID,   // Couleur fixe
+  LED_OVERLAY_PULSE    // Pulsation rapide (~0,8 s)
+};
+
+class LEDCompositor {
+public:
+  // Niveau maître maximal (luminosité 255, pas de fondu)
+  static constexpr uint16_t LEVEL_MAX = 65535;
+
+  // Fondu d'entrée et de sortie des calques transitoires
+  static constexpr uint16_t OVERLAY_FADE_MS = 250;
+  
+  // Estimation du courant WS2812B : par canal à 100 %, et par LED au repos
+  static constexpr uint32_t CHANNEL_MA = 20;
+  static constexpr uint32_t IDLE_MA = 1;
+
+  /**
+   * Activer un calque transitoire pendant durationMs (0 = le retirer)
+   * @param color 0xRRGGBB
+   * @param level Luminosité propre du calque (0-255)
+   */
+  static void setOverlay(LEDOverlayLayer layer, uint32_t color, uint8_t level,
+                         uint16_t durationMs, LEDOverlayShape shape, uint32_t now);
+
+  /**
+   * true si au moins un calque transitoire est encore visible (la trame
+   * doit alors être redessinée à chaque envoi)
+   */
+  static bool hasOverlay(uint32_t now);
+
+  /**
+   * Assembler la trame et l'écrire dans le buffer de la bande
+   * @param base Calque de base (count pixels 0xRRGGBB)
+   * @param level Niveau maître perçu appliqué à la base (0-LEVEL_MAX)
+   * @return true si le tramage a un reste à répartir (redessiner au prochain envoi)
+   */
+  static bool compose(const uint32_t* base, uint16_t count, uint16_t level,
+                      uint32_t now, Adafruit_NeoPixel* strip);
+  
+  // Courant estimé de la dernière trame (après limitation) et courant demandé
+  static uint32_t getEstimatedCurrentMa();
+  static uint32_t getRequestedCurrentMa();
+
+private:
+  struct Overlay {
+    uint32_t color;
+    uint32_t startMs;
+    uint16_t durationMs;
+    uint8_t level;
+    LEDOverlayShape shape;
+  };
+
+  static Overlay overlays[LED_OVERLAY_COUNT];
+  static uint32_t estimatedCurrentMa;
+  static uint32_t requestedCurrentMa;
+};
+
+#endif // LED_COMPOSITOR_H
@@ -0,0 +1,429 @@
+#include "led_effects.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "models/model_config.h"
+#include "led_math.h"
+
+namespace {
+
+// Fonction utilitaire pour convertir HSV en RGB (format NeoPixel)
+uint32_t hsvToRgb(uint8_t h, uint8_t s, uint8_t v) {
+  uint8_t r, g, b;
+
+  if (s == 0) {
+    r = g = b = v;
+  } else {
+    uint8_t region = h / 43;
+    uint8_t remainder = (h - (region * 43)) * 6;
+
+    uint8_t p = (v * (255 - s)) >> 8;
+    uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+      case 0: r = v; g = t; b = p; break;
+      case 1: r = q; g = v; b = p; break;
+      case 2: r = p; g = v; b = t; break;
+      case 3: r = p; g = q; b = v; break;
+      case 4: r = t; g = p; b = v; break;
+      default: r = v; g = p; b = q; break;
+    }
+  }
+
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+// Dégradé arc-en-ciel sur toute la bande (même écart de teinte entre voisines)
+void fillRainbow(LEDFrame& frame, uint16_t hue, uint8_t s, uint8_t v) {
+  // Écart de teinte entre deux LEDs voisines pour répartir un tour complet (phase 16 bits)
+  const uint16_t hueStep = (uint16_t)(65536 / (frame.count > 0 ? frame.count : 1));
+  for (uint16_t i = 0; i < frame.count; i++) {
+    frame.pixels[i] = hsvToRgb(hue >> 8, s, v);
+    hue += hueStep;
+  }
+}
+
+// Pulsation (respiration) sur une phase 16 bits : montée puis descente quadratiques
+// de PULSE_MIN (~12% de luminosité) à 255
+uint8_t pulseLevel(uint16_t phase) {
+  const uint8_t PULSE_MIN = 30;
+  const uint8_t PULSE_RANGE = 255 - PULSE_MIN;  // 225
+  // Phase 0-511 : montée (inspiration), Phase 512-1023 : descente (expiration)
+  const uint16_t phase10 = phase >> 6;
+  const uint32_t ramp = (phase10 < 512) ? phase10 : 511 - (phase10 - 512);
+  const uint32_t smoothPhase = (ramp * ramp) >> 9;
+  return PULSE_MIN + ((smoothPhase * PULSE_RANGE) >> 9);
+}
+
+// ----------------------------------------------------------------------------
+
+class RainbowEffect : public LEDEffectRenderer {
+public:
+  // cycleMs : durée d'un tour de la roue chromatique ; s, v : saturation et luminosité
+  RainbowEffect(uint32_t cycleMs, uint8_t s, uint8_t v) : cycleMs(cycleMs), s(s), v(v) {}
+
+  void render(LEDFrame& frame, uint32_t t) override {
+    fillRainbow(frame, LEDMath::phase16(t, cycleMs), s, v);
+  }
+
+private:
+  const uint32_t cycleMs;
+  const uint8_t s;
+  const uint8_t v;
+};
+
+class PulseEffect : public LEDEffectRenderer {
+public:
+  explicit PulseEffect(uint32_t cycleMs) : cycleMs(cycleMs) {}
+
+  void render(LEDFrame& frame, uint32_t t) override {
+    // Courbe quadratique douce montée/descente (pulseLevel), calculée une fois par trame
+    frame.fill(LEDMath::scaleColor(frame.color, pulseLevel(LEDMath::phase16(t, cycleMs))));
+  }
+
+private:
+  const uint32_t cycleMs;
+};
+
+class RotateEffect : public LEDEffectRenderer {
+public:
+  RotateEffect() {
+    for (uint32_t x = 0; x <= 256; x++) {
+      // Courbe en 3 zones pour fade-out progressif mais queue qui s'éteint assez vite
+      // - Queue lointaine (x < 80) : s'éteint rapidement (presque invisible)
+      // - Queue moyenne (80 < x < 180) : fade-out progressif (visible mais faible)
+      // - Queue proche vers tête (x > 180) : montée rapide vers maximum
+      uint32_t fadeValue;
+      if (x < 80) {
+        fadeValue = (x * x) / 80;  // 0-80, extinction rapide
+      } else if (x < 180) {
+        fadeValue = 80 + ((x - 80) * (x - 80)) / 40;  // 80-330
+      } else {
+        fadeValue = 330 + ((x - 180) * (x - 180) * (x - 180)) / 300;  // 330-406
+      }
+      if (fadeValue > 256) fadeValue = 256;
+      // Queue lointaine : 15, queue moyenne : 15-150, queue proche : 150-255
+      intensity[x] = 15 + ((fadeValue * 240) / 256);
+    }
+  }
+
+  void render(LEDFrame& frame, uint32_t t) override {
+    // Cycle de rotation : ~5 secondes pour un tour complet (ralenti pour plus de fluidité)
+    const uint32_t ROTATE_CYCLE_MS = 5000;
+    const int32_t leds = frame.count;
+    const uint32_t elapsed = t % ROTATE_CYCLE_MS;
+
+    // Position de la tête du serpent en 1/256 de LED pour un mouvement fluide
+    const int32_t headPositionPrecise = (elapsed * leds * 256) / ROTATE_CYCLE_MS;
+
+    // Longueur du serpent : 30% de la bande, queue visible mais pas trop longue
+    const int32_t snakeLength = (leds * 30) / 100;
+    if (snakeLength == 0) {
+      frame.fill(0);
+      return;
+    }
+    const int32_t maxSnakeDistance = snakeLength * 256;
+    const int32_t stripLength = leds * 256;
+
+    // Distance depuis la tête jusqu'au centre de la LED (+128), décrémentée d'une LED à l'autre
+    int32_t distanceFromHead = headPositionPrecise - 128;
+    for (int32_t i = 0; i < leds; i++) {
+      // Gérer le wrap-around (distance la plus courte)
+      int32_t distanceToHead = distanceFromHead;
+      if (distanceToHead > stripLength / 2) {
+        distanceToHead -= stripLength;
+      } else if (distanceToHead < -stripLength / 2) {
+        distanceToHead += stripLength;
+      }
+      distanceFromHead -= 256;
+
+      // Si la LED est en dehors du serpent, elle est éteinte
+      const int32_t absDistance = (distanceToHead < 0) ? -distanceToHead : distanceToHead;
+      if (absDistance > maxSnakeDistance) {
+        frame.pixels[i] = 0;
+        continue;
+      }
+
+      // Proximité de la tête sur 0-256 (256 = tête, luminosité maximale), puis courbe de queue
+      frame.pixels[i] = LEDMath::scaleColor(frame.color,
+        intensity[(maxSnakeDistance - absDistance) / snakeLength]);
+    }
+  }
+
+private:
+  // Intensité de la queue selon la proximité de la tête (0-256), calculée une fois
+  uint8_t intensity[257];
+};
+
+class GlossyEffect : public LEDEffectRenderer {
+public:
+  void render(LEDFrame& frame, uint32_t t) override {
+    // Effet glossy multicolore : la teinte avance d'un cran par trame de 16 ms
+    const uint32_t GLOSSY_CYCLE_MS = 4096;
+    fillRainbow(frame, LEDMath::phase16(t, GLOSSY_CYCLE_MS), 200, 255);
+  }
+};
+
+class NightlightEffect : public LEDEffectRenderer {
+public:
+  void render(LEDFrame& frame, uint32_t t) override {
+    // Vagues bleu/blanc qui se déplacent de gauche à droite
+    // Cycle de déplacement : ~6 secondes pour traverser toute la bande
+    const uint32_t NIGHTLIGHT_CYCLE_MS = 6000;
+    const uint32_t elapsed = t % NIGHTLIGHT_CYCLE_MS;
+    const int32_t leds = (frame.count > 0) ? frame.count : 1;
+
+    // Offset de déplacement (0 à 2 longueurs de bande), en 1/256 de LED
+    const int32_t scrollOffset = (int32_t)((elapsed * (uint32_t)(leds * 2 * 256)) / NIGHTLIGHT_CYCLE_MS);
+
+    // Couleurs de base : bleu et blanc
+    const uint8_t BLUE_R = 30;
+    const uint8_t BLUE_G = 100;
+    const uint8_t BLUE_B = 255;
+
+    const uint8_t WHITE_R = 200;
+    const uint8_t WHITE_G = 220;
+    const uint8_t WHITE_B = 255;
+
+    // 3 vagues sinusoïdales avec différentes fréquences et phases, en phase 16 bits :
+    // angle = (position / NUM_LEDS) x périodes sur la bande, + déphasage
+    // La phase de départ recule avec scrollOffset puis avance d'un pas constant par LED
+    // Vague 1 : longue période (bleu dominant, 1,5 période) - mouvement lent
+    uint32_t angle1 = (uint32_t)(-(scrollOffset * 384) / leds);
+    const uint32_t step1 = (uint32_t)(3 * 32768 / leds);
+    // Vague 2 : période moyenne (blanc subtil, 2,5 périodes, +π/3) - mouvement moyen
+    uint32_t angle2 = (uint32_t)(-(scrollOffset * 640) / leds + 10923);
+    const uint32_t step2 = (uint32_t)(5 * 32768 / leds);
+    // Vague 3 : courte période (accent bleu, 4 périodes, +π/2) - mouvement rapide
+    uint32_t angle3 = (uint32_t)(-(scrollOffset * 1024) / leds + 16384);
+    const uint32_t step3 = (uint32_t)(4 * 65536 / leds);
+
+    for (uint16_t i = 0; i < frame.count; i++) {
+      // Vagues sur 0-255 (sin x 0,5 + 0,5)
+      const uint32_t wave1 = LEDMath::sin8((uint16_t)angle1);
+      const uint32_t wave2 = LEDMath::sin8((uint16_t)angle2);
+      const uint32_t wave3 = LEDMath::sin8((uint16_t)angle3);
+      angle1 += step1;
+      angle2 += step2;
+      angle3 += step3;
+
+      // Combiner les vagues (bleu dominant), facteurs sur 256 = 1.0
+      // bleu = vague1 x 0,6 + vague3 (x 0,6) x 0,4 ; blanc = vague2 x 0,2
+      uint32_t blueFactor = (wave1 * 154 + wave3 * 61) >> 8;
+      uint32_t whiteFactor = (wave2 * 51) >> 8;
+
+      // Fond bleu minimal (30%) pour éviter les zones complètement éteintes
+      blueFactor = ((blueFactor * 179) >> 8) + 77;
+
+      // Normaliser pour éviter la saturation, mais garder un minimum
+      const uint32_t total = blueFactor + whiteFactor;
+      if (total > 256) {
+        blueFactor = (blueFactor << 8) / total;
+        whiteFactor = (whiteFactor << 8) / total;
+      }
+
+      const uint8_t r = (uint8_t)((BLUE_R * blueFactor + WHITE_R * whiteFactor) >> 8);
+      const uint8_t g = (uint8_t)((BLUE_G * blueFactor + WHITE_G * whiteFactor) >> 8);
+      const uint8_t b = (uint8_t)((BLUE_B * blueFactor + WHITE_B * whiteFactor) >> 8);
+
+      // Appliquer la luminosité globale
+      frame.pixels[i] = LEDMath::scaleColor(((uint32_t)r << 16) | ((uint32_t)g << 8) | b, frame.brightness);
+    }
+  }
+};
+
+class BreatheEffect : public LEDEffectRenderer {
+public:
+  void reset() override {
+    colorIndex = 0;
+    colorChangeStart = 0;
+    previousColor = PALETTE[0];
+  }
+
+  void render(LEDFrame& frame, uint32_t t) override {
+    // Respiration avec changement de couleur toutes les 30 secondes
+    const uint32_t COLOR_CHANGE_INTERVAL_MS = 30000;
+    const uint32_t COLOR_TRANSITION_DURATION_MS = 2000;  // 2 secondes pour la transition
+    const uint32_t BREATHE_CYCLE_MS = 3000;  // Inspiration + expiration
+
+    const uint32_t newColorIndex = t / COLOR_CHANGE_INTERVAL_MS;
+    if (newColorIndex != colorIndex) {
+      // La couleur affichée jusqu'ici devient le point de départ de la transition
+      previousColor = PALETTE[colorIndex % PALETTE_SIZE];
+      colorIndex = newColorIndex;
+      colorChangeStart = t;
+    }
+
+    // Couleur cible (cycle infini), mélangée progressivement depuis la précédente
+    uint32_t color = PALETTE[colorIndex % PALETTE_SIZE];
+    const uint32_t transitionElapsed = t - colorChangeStart;
+    if (transitionElapsed < COLOR_TRANSITION_DURATION_MS) {
+      // Courbe d'ease-in-out (facteur sur 256 = 1.0) pour une transition plus douce
+      const int32_t eased = LEDMath::smoothstep8((transitionElapsed * 256) / COLOR_TRANSITION_DURATION_MS);
+      uint32_t mixed = 0;
+      for (uint8_t shift = 0; shift <= 16; shift += 8) {
+        const int32_t from = (previousColor >> shift) & 0xFF;
+        const int32_t to = (color >> shift) & 0xFF;
+        mixed |= (uint32_t)(uint8_t)(from + ((to - from) * eased) / 256) << shift;
+      }
+      color = mixed;
+    }
+
+    // 0,65 + 0,35 x sin, sur 255 = 1.0 : breatheFactor va de 76 (0.3) à 255 (1.0)
+    const int32_t sine = (int32_t)LEDMath::sin8(LEDMath::phase16(t, BREATHE_CYCLE_MS)) - 128;
+    const uint8_t breatheFactor = (uint8_t)(166 + (sine * 180) / 256);
+
+    // Respiration puis luminosité globale
+    frame.fill(LEDMath::scaleColor(LEDMath::scaleColor(color, breatheFactor), frame.brightness));
+  }
+
+private:
+  // Palette de couleurs douces et apaisantes
+  static const uint32_t PALETTE[];
+  static const uint8_t PALETTE_SIZE;
+
+  uint32_t colorIndex = 0;
+  uint32_t colorChangeStart = 0;
+  uint32_t previousColor = 0x1E64FF;
+};
+
+const uint32_t BreatheEffect::PALETTE[] = {
+  0x1E64FF,  // Bleu doux
+  0x6496FF,  // Bleu ciel
+  0x9664FF,  // Violet doux
+  0xFF6496,  // Rose doux
+  0xFF9664,  // Orange doux
+  0x96FF96,  // Vert doux
+  0xFFC864   // Jaune doux
+};
+const uint8_t BreatheEffect::PALETTE_SIZE = sizeof(BreatheEffect::PALETTE) / sizeof(BreatheEffect::PALETTE[0]);
+
+// ----------------------------------------------------------------------------
+
+SemaphoreHandle_t timelineMutex = nullptr;
+LEDTimeline pendingTimeline = {};  // Dernière timeline reçue, protégée par timelineMutex
+
+class TimelineEffect : public LEDEffectRenderer {
+public:
+  void reset() override {
+    // Adopter la dernière timeline reçue ; le rendu travaille ensuite sur sa copie sans verrou
+    if (timelineMutex != nullptr && xSemaphoreTake(timelineMutex, portMAX_DELAY) == pdTRUE) {
+      timeline = pendingTimeline;
+      xSemaphoreGive(timelineMutex);
+    }
+  }
+
+  void render(LEDFrame& frame, uint32_t t) override {
+    if (timeline.count == 0) {
+      frame.fill(0);
+      return;
+    }
+
+    const uint32_t duration = timeline.keys[timeline.count - 1].atMs;
+    if (timeline.loop && duration > 0) {
+      t %= duration;
+    }
+
+    // Segment [a, b] qui contient t (avant la première keyframe : la première, après la dernière : la dernière)
+    uint8_t i = 0;
+    while (i + 1 < timeline.count && timeline.keys[i + 1].atMs <= t) {
+      i++;
+    }
+    const LEDKeyframe& a = timeline.keys[i];
+    if (i + 1 >= timeline.count || t <= a.atMs) {
+      frame.fill(LEDMath::scaleColor(a.color, a.level));
+      return;
+    }
+    const LEDKeyframe& b = timeline.keys[i + 1];
+
+    // Interpolation linéaire, fraction sur 256 (segments jusqu'à plusieurs heures)
+    const int32_t f = (int32_t)(((uint64_t)(t - a.atMs) << 8) / (b.atMs - a.atMs));
+    uint32_t color = 0;
+    for (uint8_t shift = 0; shift <= 16; shift += 8) {
+      const int32_t from = (a.color >> shift) & 0xFF;
+      const int32_t to = (b.color >> shift) & 0xFF;
+      color |= (uint32_t)(uint8_t)(from + ((to - from) * f) / 256) << shift;
+    }
+    const uint8_t level = (uint8_t)(a.level + (((int32_t)b.level - a.level) * f) / 256);
+    frame.fill(LEDMath::scaleColor(color, level));
+  }
+
+private:
+  LEDTimeline timeline = {};
+};
+
+RainbowEffect rainbow(3000, 255, 255);  // Tour complet en 3 s
+// Veilleuse : tour en 30 s, saturation 78% et luminosité 70% pour un effet apaisant
+RainbowEffect rainbowSoft(30000, 200, 180);
+PulseEffect pulse(2500);
+PulseEffect pulseFast(800);  // Feedback "pas de routine"
+GlossyEffect glossy;
+RotateEffect rotate;
+NightlightEffect nightlight;
+BreatheEffect breathe;
+TimelineEffect timeline;
+
+const LEDEffectInfo EFFECTS[] = {
+  { LED_EFFECT_NONE,         "none",         nullptr },
+  { LED_EFFECT_RAINBOW,      "rainbow",      &rainbow },
+  { LED_EFFECT_PULSE,        "pulse",        &pulse },
+  { LED_EFFECT_PULSE_FAST,   "pulse_fast",   &pulseFast },
+  { LED_EFFECT_GLOSSY,       "glossy",       &glossy },
+  { LED_EFFECT_ROTATE,       "rotate",       &rotate },
+  { LED_EFFECT_NIGHTLIGHT,   "nightlight",   &nightlight },
+  { LED_EFFECT_BREATHE,      "breathe",      &breathe },
+  { LED_EFFECT_RAINBOW_SOFT, "rainbow_soft", &rainbowSoft },
+  { LED_EFFECT_TIMELINE,     "timeline",     &timeline },
+};
+const uint8_t EFFECT_COUNT = sizeof(EFFECTS) / sizeof(EFFECTS[0]);
+
+} // namespace
+
+void LEDEffects::init() {
+  if (timelineMutex == nullptr) {
+    timelineMutex = xSemaphoreCreateMutex();
+  }
+}
+
+const LEDEffectInfo* LEDEffects::get(LEDEffect effect) {
+  // Table dans l'ordre de l'enum
+  if ((unsigned)effect < EFFECT_COUNT && EFFECTS[effect].id == effect) {
+    return &EFFECTS[effect];
+  }
+  return nullptr;
+}
+
+const LEDEffectInfo* LEDEffects::find(const char* name) {
+  if (name == nullptr) return nullptr;
+  for (uint8_t i = 0; i < EFFECT_COUNT; i++) {
+    if (strcmp(EFFECTS[i].name, name) == 0) {
+      return &EFFECTS[i];
+    }
+  }
+  return nullptr;
+}
+
+uint8_t LEDEffects::count() {
+  return EFFECT_COUNT;
+}
+
+const LEDEffectInfo& LEDEffects::at(uint8_t index) {
+  return EFFECTS[index < EFFECT_COUNT ? index : 0];
+}
+
+bool LEDEffects::setTimeline(const LEDTimeline& newTimeline) {
+  if (newTimeline.count == 0 || newTimeline.count > LEDTimeline::MAX_KEYFRAMES) {
+    return false;
+  }
+  for (uint8_t i = 1; i < newTimeline.count; i++) {
+    if (newTimeline.keys[i].atMs < newTimeline.keys[i - 1].atMs) {
+      return false;
+    }
+  }
+  if (timelineMutex == nullptr || xSemaphoreTake(timelineMutex, portMAX_DELAY) != pdTRUE) {
+    return false;
+  }
+  pendingTimeline = newTimeline;
+  xSemaphoreGive(timelineMutex);
+  return true;
+}
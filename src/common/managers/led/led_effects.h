@@ -0,0 +1,107 @@
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <Arduino.h>
+#include <cstdint>
+
+/**
+ * Registre des effets LED
+ *
+ * Chaque effet est un objet LEDEffectRenderer qui porte son propre état et
+ * dessine une trame à partir du temps écoulé depuis son démarrage :
+ * - reset()  : appelé par la tâche LED quand l'effet (re)démarre
+ * - render() : remplit frame.pixels (0xRRGGBB) pour l'instant t (ms depuis reset)
+ *
+ * La tâche LED ne connaît plus les effets un par un : elle cherche l'entrée
+ * du registre (LEDEffects::get) et appelle render(). Ajouter un effet =
+ * ajouter une valeur à LEDEffect, une classe dans led_effects.cpp et une
+ * ligne dans la table EFFECTS.
+ *
+ * L'effet TIMELINE joue une suite de keyframes (couleur + niveau) poussée à
+ * l'exécution (MQTT), interpolée linéairement par la tâche LED.
+ */
+
+// Types d'effets disponibles
+enum LEDEffect {
+  LED_EFFECT_NONE,          // Pas d'effet (couleur unie)
+  LED_EFFECT_RAINBOW,       // Arc-en-ciel
+  LED_EFFECT_PULSE,         // Pulsation
+  LED_EFFECT_PULSE_FAST,    // Pulsation rapide (feedback "pas de routine")
+  LED_EFFECT_GLOSSY,        // Effet glossy
+  LED_EFFECT_ROTATE,        // Effet de rotation (utilise la couleur définie)
+  LED_EFFECT_NIGHTLIGHT,    // Effet de veilleuse (vagues bleu/blanc)
+  LED_EFFECT_BREATHE,       // Effet de respiration avec changement de couleur
+  LED_EFFECT_RAINBOW_SOFT,  // Arc-en-ciel doux (animation lente pour veilleuse)
+  LED_EFFECT_TIMELINE       // Suite de keyframes (LEDEffects::setTimeline)
+};
+
+// Trame à dessiner par un effet
+struct LEDFrame {
+  uint32_t* pixels;     // count pixels au format 0xRRGGBB
+  uint16_t count;
+  uint32_t color;       // Couleur courante (setColor), utilisée par PULSE, ROTATE...
+  uint8_t brightness;   // Luminosité configurée (appliquée par NIGHTLIGHT et BREATHE)
+
+  void fill(uint32_t c) {
+    for (uint16_t i = 0; i < count; i++) {
+      pixels[i] = c;
+    }
+  }
+};
+
+class LEDEffectRenderer {
+public:
+  virtual ~LEDEffectRenderer() {}
+
+  // Repartir de t = 0 (effet activé, réveil, nouvelle timeline)
+  virtual void reset() {}
+
+  // Dessiner la trame à t ms depuis le dernier reset()
+  virtual void render(LEDFrame& frame, uint32_t t) = 0;
+};
+
+struct LEDEffectInfo {
+  LEDEffect id;
+  const char* name;              // Nom utilisé par MQTT, la config SD et les logs
+  LEDEffectRenderer* renderer;   // nullptr : couleur unie, rien à animer
+};
+
+// Keyframe de timeline : à atMs, la bande affiche color au niveau level (0-255)
+struct LEDKeyframe {
+  uint32_t atMs;
+  uint32_t color;  // 0xRRGGBB
+  uint8_t level;
+};
+
+struct LEDTimeline {
+  static const uint8_t MAX_KEYFRAMES = 16;
+
+  LEDKeyframe keys[MAX_KEYFRAMES];
+  uint8_t count;
+  bool loop;       // Reprendre au début après la dernière keyframe (sinon la garder)
+};
+
+class LEDEffects {
+public:
+  // Préparer les tables et le verrou de la timeline (appelé par LEDManager::init)
+  static void init();
+
+  // Entrée du registre pour un effet (nullptr si inconnu)
+  static const LEDEffectInfo* get(LEDEffect effect);
+
+  // Entrée du registre par nom (nullptr si inconnu)
+  static const LEDEffectInfo* find(const char* name);
+
+  static uint8_t count();
+  static const LEDEffectInfo& at(uint8_t index);
+
+  /**
+   * Remplacer la timeline jouée par LED_EFFECT_TIMELINE
+   * Copiée sous verrou ; la tâche LED l'adopte au prochain reset de l'effet
+   * (LEDManager::playTimeline)
+   * @return false si vide, trop longue ou keyframes non triées par atMs
+   */
+  static bool setTimeline(const LEDTimeline& timeline);
+};
+
+#endif // LED_EFFECTS_H
@@ -4,56 +4,21 @@
 #include "common/managers/log/log_manager.h"
 #include "models/model_config.h"
 #include "common/config/core_config.h"
-#include <math.h>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-#ifdef HAS_WIFI
-#include "common/managers/wifi/wifi_manager.h"
-#endif
 
 #ifdef HAS_BLE
 #include "common/managers/ble_config/ble_config_manager.h"
 #endif
 
-// Fonction utilitaire pour convertir HSV en RGB (format NeoPixel)
-static uint32_t hsvToRgb(uint8_t h, uint8_t s, uint8_t v) {
-  uint8_t r, g, b;
-  
-  if (s == 0) {
-    r = g = b = v;
-  } else {
-    uint8_t region = h / 43;
-    uint8_t remainder = (h - (region * 43)) * 6;
-    
-    uint8_t p = (v * (255 - s)) >> 8;
-    uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
-    
-    switch (region) {
-      case 0: r = v; g = t; b = p; break;
-      case 1: r = q; g = v; b = p; break;
-      case 2: r = p; g = v; b = t; break;
-      case 3: r = p; g = q; b = v; break;
-      case 4: r = t; g = p; b = v; break;
-      default: r = v; g = p; b = q; break;
-    }
-  }
-  
-  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-}
+// Calque de base dessiné par l'effet courant (0xRRGGBB), assemblé par LEDCompositor
+static uint32_t framePixels[NUM_LEDS > 0 ? NUM_LEDS : 1];
 
 // Variables statiques
 bool LEDManager::initialized = false;
 TaskHandle_t LEDManager::taskHandle = nullptr;
-QueueHandle_t LEDManager::commandQueue = nullptr;
 Adafruit_NeoPixel* LEDManager::strip = nullptr;
 uint8_t LEDManager::currentBrightness = DEFAULT_LED_BRIGHTNESS;
 LEDEffect LEDManager::currentEffect = LED_EFFECT_NONE;
 uint32_t LEDManager::currentColor = 0;  // Noir par défaut
-unsigned long LEDManager::lastUpdateTime = 0;
 unsigned long LEDManager::lastActivityTime = 0;
 bool LEDManager::isSleeping = false;
 bool LEDManager::isFadingToSleep = false;
@@ -63,18 +28,27 @@ LEDEffect LEDManager::savedEffect = LED_EFFECT_NONE;
 unsigned long LEDManager::rotateActivationTime = 0;  // Temps d'activation de l'effet ROTATE pour désactivation automatique
 uint32_t LEDManager::sleepTimeoutMs = 0;
 bool LEDManager::sleepPrevented = false;
-bool LEDManager::pulseNeedsReset = false;
-bool LEDManager::rainbowNeedsReset = false;
-bool LEDManager::rainbowSoftNeedsReset = false;
-bool LEDManager::rotateNeedsReset = false;
-bool LEDManager::nightlightNeedsReset = false;
-bool LEDManager::breatheNeedsReset = false;
+bool LEDManager::effectNeedsReset = true;
+unsigned long LEDManager::effectStartTime = 0;
 bool LEDManager::hardwareInitialized = false;
+Log2Histogram LEDManager::showStats = {};
 bool LEDManager::testSequentialActive = false;
 int LEDManager::testSequentialIndex = 0;
 unsigned long LEDManager::testSequentialLastUpdate = 0;
 bool LEDManager::feedbackFadeOutActive = false;
 unsigned long LEDManager::feedbackFadeOutStartTime = 0;
+bool LEDManager::feedbackFadeOutReleasesSleep = false;
+std::atomic<uint32_t> LEDManager::mailboxColor(0);
+std::atomic<uint32_t> LEDManager::mailboxBrightness(0);
+std::atomic<uint32_t> LEDManager::mailboxEffect(LED_EFFECT_NONE);
+std::atomic<uint32_t> LEDManager::mailboxActivityTime(0);
+std::atomic<bool> LEDManager::mailboxSleepPrevented(false);
+std::atomic<uint32_t> LEDManager::mailboxOverlayColor[LED_OVERLAY_COUNT] = {};
+std::atomic<uint32_t> LEDManager::mailboxOverlayParams[LED_OVERLAY_COUNT] = {};
+std::atomic<uint32_t> LEDManager::mailboxFlags(0);
+std::atomic<uint32_t> LEDManager::mailboxGeneration(0);
+uint32_t LEDManager::mailboxSeenGeneration = 0;
+std::atomic<bool> LEDManager::publishedSleepState(false);
 
 uint8_t LEDManager::brightnessPercentTo255(uint8_t percent) {
   return (percent * 255 + 50) / 100;
@@ -97,6 +71,9 @@ bool LEDManager::init() {
   isSleeping = false;
   LogManager::info("[LED] Brightness=%d, SleepTimeout=%lu\n", currentBrightness, sleepTimeoutMs);
   
+  // Verrou de la timeline (effet TIMELINE)
+  LEDEffects::init();
+  
   // Créer l'objet NeoPixel (l'initialisation matérielle sera faite dans la task)
   // NEO_GRB pour WS2812B (ordre des couleurs GRB)
   LogManager::info("[LED] Creation objet NeoPixel...");
@@ -112,16 +89,9 @@ bool LEDManager::init() {
   // L'init matérielle NeoPixel est faite dans ledTask() au premier run.
   LogManager::info("[LED] Init NeoPixel differe (dans task)...");
   
-  // Créer la queue de commandes
-  LogManager::info("[LED] Creation queue...");
-  commandQueue = xQueueCreate(QUEUE_SIZE, sizeof(LEDCommand));
-  if (commandQueue == nullptr) {
-    LogManager::info("[LED] ERREUR: Creation queue echouee!");
-    delete strip;
-    strip = nullptr;
-    return false;
-  }
-  LogManager::info("[LED] Queue OK");
+  // Boîte aux lettres vide : rien à appliquer au premier tour de la tâche
+  mailboxFlags.store(0);
+  mailboxSeenGeneration = mailboxGeneration.load();
   
   // Créer le thread de gestion des LEDs sur Core 1 (temps-réel)
   LogManager::info("[LED] Creation task...");
@@ -138,8 +108,6 @@ bool LEDManager::init() {
   
   if (result != pdPASS) {
     LogManager::error("[LED] Creation task echouee! Code=%d", result);
-    vQueueDelete(commandQueue);
-    commandQueue = nullptr;
     delete strip;
     strip = nullptr;
     return false;
@@ -169,11 +137,6 @@ void LEDManager::stop() {
     taskHandle = nullptr;
   }
   
-  if (commandQueue != nullptr) {
-    vQueueDelete(commandQueue);
-    commandQueue = nullptr;
-  }
-  
   if (strip != nullptr) {
     delete strip;
     strip = nullptr;
@@ -184,14 +147,14 @@ void LEDManager::stop() {
   LogManager::info("[LED] Gestionnaire arrete");
 }
 
-bool LEDManager::sendCommand(const LEDCommand& cmd) {
-  if (!initialized || commandQueue == nullptr) {
-    return false;
-  }
-  
-  // Envoyer la commande à la queue (non-bloquant)
-  BaseType_t result = xQueueSend(commandQueue, &cmd, 0);
-  return (result == pdTRUE);
+void LEDManager::postMailbox(uint32_t flags) {
+  // Emplacements écrits avant : la tâche LED qui voit le bit voit la valeur
+  mailboxFlags.fetch_or(flags, std::memory_order_release);
+  mailboxGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void LEDManager::storeActivityTime() {
+  mailboxActivityTime.store((uint32_t)millis(), std::memory_order_relaxed);
 }
 
 bool LEDManager::setColor(uint8_t r, uint8_t g, uint8_t b) {
@@ -202,42 +165,40 @@ bool LEDManager::setColor(uint8_t r, uint8_t g, uint8_t b) {
   // Ne pas faire clear() ici car cela effacerait la couleur avant qu'elle soit appliquée
   // Le clear() sera fait dans setEffect() si nécessaire lors d'un changement d'effet
 
-  LEDCommand cmd;
-  cmd.type = LED_CMD_SET_COLOR;
-  cmd.data.color.r = r;
-  cmd.data.color.g = g;
-  cmd.data.color.b = b;
-  bool result = sendCommand(cmd);
+  bool result = initialized;
+  if (result) {
+    mailboxColor.store(((uint32_t)r << 16) | ((uint32_t)g << 8) | b, std::memory_order_relaxed);
+    // Réveiller automatiquement les LEDs pour tous les changements de couleur (sauf éteindre)
+    // Cela permet de sortir du mode sommeil à chaque changement
+    uint32_t flags = MAILBOX_COLOR;
+    if (!isTurningOff) {
+      storeActivityTime();
+      flags |= MAILBOX_WAKE;
+    }
+    postMailbox(flags);
+  }
 
-  // Réveiller automatiquement les LEDs pour tous les changements de couleur (sauf éteindre)
-  // Cela permet de sortir du mode sommeil à chaque changement
-  if (result && !isTurningOff) {
-    wakeUp();
-  } else if (isTurningOff) {
+  if (isTurningOff) {
     LogManager::info("[LED] setColor: Couleur noire detectee, pas de reveil");
   }
   return result;
 }
 
 bool LEDManager::setBrightness(uint8_t brightness) {
-  LEDCommand cmd;
-  cmd.type = LED_CMD_SET_BRIGHTNESS;
-  cmd.data.brightness = brightness;
-  bool result = sendCommand(cmd);
-  // Réveiller automatiquement les LEDs pour tous les changements de brightness
-  // Cela permet de sortir du mode sommeil à chaque changement
+  bool result = initialized;
   if (result) {
-    wakeUp();
+    mailboxBrightness.store(brightness, std::memory_order_relaxed);
+    // Réveiller automatiquement les LEDs pour tous les changements de brightness
+    // Cela permet de sortir du mode sommeil à chaque changement
+    storeActivityTime();
+    postMailbox(MAILBOX_BRIGHTNESS | MAILBOX_WAKE);
   }
   return result;
 }
 
 const char* LEDManager::getEffectName(LEDEffect effect) {
-  static const char* effectNames[] = {"NONE", "RAINBOW", "PULSE", "PULSE_FAST", "GLOSSY", "ROTATE", "NIGHTLIGHT", "BREATHE", "RAINBOW_SOFT"};
-  if (effect >= 0 && effect < sizeof(effectNames) / sizeof(effectNames[0])) {
-    return effectNames[effect];
-  }
-  return "UNKNOWN";
+  const LEDEffectInfo* info = LEDEffects::get(effect);
+  return info != nullptr ? info->name : "unknown";
 }
 
 bool LEDManager::setEffect(LEDEffect effect) {
@@ -245,38 +206,92 @@ bool LEDManager::setEffect(LEDEffect effect) {
   
   bool isTurningOff = (effect == LED_EFFECT_NONE);
   
-  // Ne pas faire clear() ici car processCommand() gère déjà les transitions d'effet proprement
-  // Il éteint automatiquement les LEDs avant de changer d'effet (voir processCommand SET_EFFECT)
+  // Ne pas faire clear() ici : la trame est recomposée entièrement à chaque envoi
+  // (voir composeFrame), le changement d'effet ne laisse pas de pixels résiduels
   
-  LEDCommand cmd;
-  cmd.type = LED_CMD_SET_EFFECT;
-  cmd.data.effect = effect;
-  bool result = sendCommand(cmd);
+  bool result = initialized;
+  if (result) {
+    mailboxEffect.store(effect, std::memory_order_relaxed);
+    // Réveiller automatiquement les LEDs pour tous les changements d'effet (sauf éteindre)
+    // Hors sleep mode, le réveil se limite à l'activité (déjà notée par l'effet) :
+    // pas de flash inutile
+    uint32_t flags = MAILBOX_EFFECT;
+    if (!isTurningOff) {
+      storeActivityTime();
+      flags |= MAILBOX_WAKE;
+    }
+    postMailbox(flags);
+  }
   
-  // Réveiller automatiquement les LEDs pour tous les changements d'effet (sauf éteindre)
-  // MAIS seulement si on est vraiment en sleep mode pour éviter les flashes inutiles
-  if (result && !isTurningOff) {
-    // Ne réveiller que si on est vraiment en sleep mode
-    // Sinon, on laisse le thread LED gérer directement le changement d'effet
-    if (getSleepState()) {
-      wakeUp();
-    }
-  } else if (isTurningOff) {
+  if (isTurningOff) {
     LogManager::info("[LED] setEffect: Effet NONE detecte, pas de reveil");
   }
   return result;
 }
 
 bool LEDManager::clear() {
-  LEDCommand cmd;
-  cmd.type = LED_CMD_CLEAR;
-  return sendCommand(cmd);
+  if (!initialized) {
+    return false;
+  }
+  // Noir + effet NONE dans les emplacements : un setColor()/setEffect() qui
+  // suit l'emporte, un setColor()/setEffect() précédent est écrasé.
+  // Un test séquentiel demandé avant ne démarre pas
+  mailboxColor.store(0, std::memory_order_relaxed);
+  mailboxEffect.store(LED_EFFECT_NONE, std::memory_order_relaxed);
+  mailboxFlags.fetch_and(~(uint32_t)MAILBOX_TEST_SEQUENTIAL, std::memory_order_relaxed);
+  postMailbox(MAILBOX_COLOR | MAILBOX_EFFECT | MAILBOX_CLEAR);
+  return true;
+}
+
+bool LEDManager::playTimeline(const LEDTimeline& timeline) {
+  if (!LEDEffects::setTimeline(timeline)) {
+    LogManager::warning("[LED] playTimeline: timeline invalide (%d keyframes)", timeline.count);
+    return false;
+  }
+  // SET_EFFECT TIMELINE redémarre la timeline même si elle est déjà active
+  return setEffect(LED_EFFECT_TIMELINE);
+}
+
+bool LEDManager::showOverlay(LEDOverlayLayer layer, uint8_t r, uint8_t g, uint8_t b, uint8_t level,
+                             uint16_t durationMs, LEDOverlayShape shape) {
+  bool result = initialized && layer < LED_OVERLAY_COUNT;
+  if (result) {
+    mailboxOverlayColor[layer].store(((uint32_t)r << 24) | ((uint32_t)g << 16) | ((uint32_t)b << 8) | level,
+                                     std::memory_order_relaxed);
+    mailboxOverlayParams[layer].store(((uint32_t)shape << 16) | durationMs, std::memory_order_relaxed);
+    // Un calque visible compte comme une activité (repousse le sleep mode)
+    uint32_t flags = MAILBOX_OVERLAY << layer;
+    if (durationMs > 0) {
+      storeActivityTime();
+      flags |= MAILBOX_ACTIVITY;
+    }
+    postMailbox(flags);
+  }
+  return result;
+}
+
+bool LEDManager::clearOverlay(LEDOverlayLayer layer) {
+  return showOverlay(layer, 0, 0, 0, 0, 0);
 }
 
 bool LEDManager::isInitialized() {
   return initialized;
 }
 
+const Log2Histogram& LEDManager::getShowStats() {
+  return showStats;
+}
+
+void LEDManager::resetShowStats() {
+  if (!initialized) {
+    // Pas de tâche LED : personne d'autre n'écrit les stats
+    showStats.reset();
+    LEDOutput::resetStats();
+    return;
+  }
+  postMailbox(MAILBOX_RESET_STATS);
+}
+
 uint8_t LEDManager::getCurrentBrightness() {
   return currentBrightness;
 }
@@ -295,10 +310,9 @@ bool LEDManager::testLEDsSequential() {
   
   LogManager::info("[LED-TEST] Demarrage du test sequentiel des LEDs");
   
-  // Envoyer une commande spéciale pour le test séquentiel
-  LEDCommand cmd;
-  cmd.type = LED_CMD_TEST_SEQUENTIAL;
-  return sendCommand(cmd);
+  // Démarré par la tâche LED au prochain tour
+  postMailbox(MAILBOX_TEST_SEQUENTIAL);
+  return true;
 }
 
 void LEDManager::ledTask(void* parameter) {
@@ -306,31 +320,30 @@ void LEDManager::ledTask(void* parameter) {
   if (!hardwareInitialized) {
     if (strip != nullptr) {
       strip->begin();
-      strip->setBrightness(currentBrightness);
+      LEDOutput::begin(strip);
+      LogManager::info("[LED] Sortie: %s", LEDOutput::getName());
+      // Luminosité appliquée par le compositeur : celle d'Adafruit reste à 255
       strip->clear();
-      strip->show();
+      LEDOutput::show(strip);
       hardwareInitialized = true;
     }
   }
 
   // Ce thread tourne en continu et ne s'arrête jamais
-  // IMPORTANT: On limite les appels à strip->show() pour ne pas interférer avec l'audio I2S
+  // IMPORTANT: En sortie NeoPixel, on limite les appels à show() pour ne pas interférer avec l'audio I2S
   // strip->show() peut désactiver brièvement les interruptions, ce qui peut causer des grésillements
+  // En sortie RMT, l'envoi est fait par le périphérique et la limite passe à 16ms (~60 FPS)
   
   static unsigned long lastShowTime = 0;
-  static bool needsUpdate = true;  // Flag pour savoir si on doit appeler strip->show()
-  
-  // Intervalle minimum entre deux strip->show() (en ms)
-  // 33ms = ~30 FPS, suffisant pour les animations et évite les conflits avec I2S
-  const unsigned long SHOW_INTERVAL_MS = 33;
+  static bool needsUpdate = true;  // Flag pour savoir si on doit envoyer la trame
   
   while (true) {
-    // Traiter les commandes en attente
-    LEDCommand cmd;
-    while (xQueueReceive(commandQueue, &cmd, 0) == pdTRUE) {
-      processCommand(cmd);
-      // IMPORTANT: Ne pas appeler wakeUp() automatiquement ici
-      // wakeUp() est appelé uniquement par les méthodes publiques (setColor, setEffect, etc.)
+    // Appliquer le dernier état demandé (un seul instantané par tour)
+    MailboxSnapshot snapshot;
+    if (readMailbox(snapshot)) {
+      applyMailbox(snapshot);
+      // IMPORTANT: Ne pas réveiller automatiquement ici
+      // Le réveil n'a lieu que sur MAILBOX_WAKE (wakeUp(), setColor, setEffect, etc.)
       // Cela évite que les commandes système automatiques (WiFi retry, etc.) réveillent les LEDs
       // Si on est en sleep, les commandes sont traitées mais ne réveillent pas les LEDs
       needsUpdate = true;
@@ -346,30 +359,14 @@ void LEDManager::ledTask(void* parameter) {
     // Désactiver automatiquement l'effet ROTATE de validation après 8 secondes
     // Cela permet au sleep mode de se déclencher normalement après le démarrage
     if (currentEffect == LED_EFFECT_ROTATE && rotateActivationTime > 0) {
-      unsigned long currentTime = millis();
       const unsigned long ROTATE_VALIDATION_TIMEOUT_MS = 8000;  // 8 secondes
-      
-      // Gérer le wrap-around de millis()
-      unsigned long elapsed;
-      if (currentTime >= rotateActivationTime) {
-        elapsed = currentTime - rotateActivationTime;
-      } else {
-        elapsed = ULONG_MAX - rotateActivationTime + currentTime;
-      }
-      
-      if (elapsed >= ROTATE_VALIDATION_TIMEOUT_MS) {
+      if (millis() - rotateActivationTime >= ROTATE_VALIDATION_TIMEOUT_MS) {
         #if ENABLE_VERBOSE_LOGS
         LogManager::info("[LED] Desactivation automatique de l'effet ROTATE de validation");
         #endif
-        currentEffect = LED_EFFECT_NONE;
         rotateActivationTime = 0;
-        // Éteindre les LEDs pour permettre le sleep mode
-        if (strip != nullptr) {
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip->setPixelColor(i, 0);
-          }
-        }
-        needsUpdate = true;
+        // Fondu vers noir puis extinction (sans toucher à l'autorisation du sleep)
+        startFadeOut(false);
       }
     }
     
@@ -377,11 +374,8 @@ void LEDManager::ledTask(void* parameter) {
     // Cela permet de s'assurer que lastActivityTime est à jour avant la vérification
     checkSleepMode();
     
-    // Gérer le test séquentiel si actif
+    // Gérer le test séquentiel si actif (écrit directement dans la bande, sans compositeur)
     if (testSequentialActive && strip != nullptr && hardwareInitialized) {
-      // S'assurer que la luminosité est à 100% pendant le test
-      strip->setBrightness(255);
-      
       unsigned long currentTime = millis();
       if (currentTime - testSequentialLastUpdate >= 100) {  // 100ms entre chaque LED
         if (testSequentialIndex < NUM_LEDS) {
@@ -392,69 +386,36 @@ void LEDManager::ledTask(void* parameter) {
           }
           // Allumer la LED actuelle en blanc
           strip->setPixelColor(testSequentialIndex, strip->Color(255, 255, 255));
-          strip->show();
+          LEDOutput::show(strip);
           LogManager::info("[LED-TEST] LED %d/%d allumee\n", testSequentialIndex + 1, NUM_LEDS);
           testSequentialIndex++;
           testSequentialLastUpdate = currentTime;
-          needsUpdate = true;
         } else if (testSequentialIndex == NUM_LEDS) {
           // Phase 2: Attendre 200ms avant d'allumer toutes en rouge
           if (currentTime - testSequentialLastUpdate >= 200) {
             // Éteindre la dernière LED
             strip->setPixelColor(NUM_LEDS - 1, 0);
-            strip->show();
+            LEDOutput::show(strip);
             testSequentialIndex++;
             testSequentialLastUpdate = currentTime;
-            needsUpdate = true;
           }
         } else if (testSequentialIndex == NUM_LEDS + 1) {
           // Phase 3: Allumer toutes les LEDs en rouge
           for (int i = 0; i < NUM_LEDS; i++) {
             strip->setPixelColor(i, strip->Color(255, 0, 0)); // Rouge pur
           }
-          strip->show();
+          LEDOutput::show(strip);
           LogManager::info("[LED-TEST] Test termine - Toutes les LEDs sont en rouge");
           LogManager::info("[LED-TEST] Utilisez 'led clear' ou 'brightness 0' pour eteindre");
           testSequentialActive = false;  // Terminer le test
           currentColor = strip->Color(255, 0, 0);  // Sauvegarder la couleur rouge
-          // Restaurer la luminosité configurée
-          strip->setBrightness(currentBrightness);
+          // Le rouge reste affiché via le compositeur, à la luminosité configurée
           needsUpdate = true;
         }
       }
     }
     
-    // Mettre à jour les effets animés si nécessaire
-    // IMPORTANT: Les effets doivent continuer pendant le fade-out pour créer un fondu progressif
-    // Seulement si le test séquentiel n'est pas actif
-    if (!isSleeping && !testSequentialActive) {
-      unsigned long currentTime = millis();
-      if (currentTime - lastUpdateTime >= UPDATE_INTERVAL_MS) {
-        // Pendant le fade-in, on permet les effets pour qu'ils s'appliquent progressivement
-        // Mais on s'assure que les LEDs sont bien éteintes au début
-        if (isFadingFromSleep && (currentTime - sleepFadeStartTime) < 50) {
-          // Au tout début du fade-in, éteindre les LEDs pour éviter le flash
-          if (strip != nullptr) {
-            for (int i = 0; i < NUM_LEDS; i++) {
-              strip->setPixelColor(i, 0);
-            }
-          }
-        } else {
-          // Appliquer les effets normalement (y compris pendant fade-out pour fondu progressif)
-          updateEffects();
-        }
-        lastUpdateTime = currentTime;
-        needsUpdate = true;
-      }
-      // S'assurer que la luminosité maximale configurée est toujours respectée
-      // (sauf pendant le fade-in/fade-out où on utilise la luminosité fade)
-      if (!isFadingFromSleep && !isFadingToSleep && !feedbackFadeOutActive && strip != nullptr) {
-        strip->setBrightness(currentBrightness);
-      }
-    }
-    
-    // Gérer l'animation de fade vers sleep APRÈS la mise à jour des effets
-    // Cela permet aux effets de continuer pendant le fade-out avec luminosité réduite
+    // Gérer l'animation de fade vers sleep (le niveau maître baisse, l'effet continue dessous)
     if (isFadingToSleep) {
       updateSleepFade();
       needsUpdate = true;
@@ -466,222 +427,209 @@ void LEDManager::ledTask(void* parameter) {
       needsUpdate = true;
     }
     
-    // Appliquer les changements aux LEDs SEULEMENT si nécessaire et pas trop souvent
-    // Cela évite de bloquer les interruptions I2S trop fréquemment
     unsigned long currentTime = millis();
-    if (needsUpdate && (currentTime - lastShowTime >= SHOW_INTERVAL_MS)) {
-      // IMPORTANT: S'assurer que si on a clear() ou si l'effet est NONE avec couleur noire,
-      // on éteint vraiment toutes les LEDs
-      if (currentEffect == LED_EFFECT_NONE && currentColor == 0 && strip != nullptr) {
-        // S'assurer que toutes les LEDs sont bien éteintes
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-        // IMPORTANT: Mettre la luminosité à 0 pour éteindre complètement
-        // Cela garantit que même si updateEffects() tourne, les LEDs restent éteintes
-        strip->setBrightness(0);
-      }
-      if (strip != nullptr) {
-        strip->show();
+    
+    // Effet animé ou calque transitoire : redessiner à chaque envoi
+    // (en sleep, le calque de base est noir : seuls les calques transitoires comptent)
+    const LEDEffectInfo* effect = LEDEffects::get(currentEffect);
+    if ((!isSleeping && effect != nullptr && effect->renderer != nullptr) ||
+        LEDCompositor::hasOverlay(currentTime)) {
+      needsUpdate = true;
+    }
+    
+    // Assembler et envoyer la trame SEULEMENT si nécessaire et pas trop souvent
+    // Cela évite de bloquer les interruptions I2S trop fréquemment ; la trame n'est
+    // dessinée qu'au moment de l'envoi (pas de rendu perdu entre deux envois)
+    if (needsUpdate && !testSequentialActive && strip != nullptr &&
+        (currentTime - lastShowTime >= SHOW_INTERVAL_MS)) {
+      // Tramage en cours : la trame suivante répartit le reste (fondu lisse à bas niveau)
+      const bool ditherPending = composeFrame(currentTime);
+      // Trame identique à la précédente : rien n'est envoyé, pas de mesure
+      const uint32_t showStart = micros();
+      if (LEDOutput::show(strip)) {
+        showStats.add(micros() - showStart);
       }
       lastShowTime = currentTime;
-      needsUpdate = false;
+      needsUpdate = ditherPending;
     }
     
+    // État du sleep mode lisible par les autres tâches (getSleepState)
+    publishedSleepState.store(isSleeping || isFadingToSleep, std::memory_order_relaxed);
+    
     // Pause plus longue pour laisser de la bande passante à l'audio
-    vTaskDelay(pdMS_TO_TICKS(5));
+    vTaskDelay(pdMS_TO_TICKS(LOOP_DELAY_MS));
   }
   
   // Ne devrait jamais arriver ici
   vTaskDelete(nullptr);
 }
 
-void LEDManager::processCommand(const LEDCommand& cmd) {
-  switch (cmd.type) {
-    case LED_CMD_SET_COLOR:
-      LogManager::debug("[LED] processCommand SET_COLOR: RGB(%d, %d, %d), currentEffect=%d\n", 
-                    cmd.data.color.r, cmd.data.color.g, cmd.data.color.b, currentEffect);
-      
-      // Réinitialiser le timer d'activité lors d'un changement de couleur
-      lastActivityTime = millis();
-      
-      // Si on change de couleur et qu'on a un effet actif, éteindre d'abord
-      // Cela évite le flash de la couleur précédente
-      if (currentEffect != LED_EFFECT_NONE && strip != nullptr) {
-        // Éteindre toutes les LEDs avant de changer de couleur
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-      }
-      currentColor = ((uint32_t)cmd.data.color.r << 16) | ((uint32_t)cmd.data.color.g << 8) | cmd.data.color.b;
-      
-      // Si on définit la couleur SUCCESS (vert: RGB(0, 255, 0)) avec l'effet ROTATE,
-      // démarrer le décompte pour désactivation automatique
-      // Cela permet que le décompte ne commence qu'après la disparition de l'orange
-      if (currentEffect == LED_EFFECT_ROTATE && 
-          cmd.data.color.r == 0 && cmd.data.color.g == 255 && cmd.data.color.b == 0) {
-        rotateActivationTime = millis();
-        #if ENABLE_VERBOSE_LOGS
-        LogManager::info("[LED] processCommand SET_COLOR - Couleur SUCCESS (vert) detectee avec ROTATE, demarrage du decompte: %lu ms\n", rotateActivationTime);
-        #endif
-      }
-      
-      // Si on change de couleur et qu'on n'a pas d'effet actif, appliquer immédiatement
-      // Si on a un effet, la couleur sera appliquée par l'effet
-      if (currentEffect == LED_EFFECT_NONE && strip != nullptr) {
-        // Restaurer la luminosité (CLEAR met le strip à 0 ; sans ça la LED reste invisible après un tick)
-        strip->setBrightness(currentBrightness);
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, currentColor);
-        }
-      }
-      // Ne pas réinitialiser l'effet ici, il sera géré par SET_EFFECT
-      // L'effet reste actif, seule la couleur change
+bool LEDManager::readMailbox(MailboxSnapshot& snapshot) {
+  uint32_t generation = mailboxGeneration.load(std::memory_order_acquire);
+  if (generation == mailboxSeenGeneration) {
+    return false;  // Rien de publié depuis le dernier tour
+  }
+  
+  // Les bits lus sont cumulés : une relecture ne perd pas ceux déjà consommés.
+  // Si une écriture se termine pendant la lecture, relire pour ne pas mélanger
+  // deux demandes. Relectures épuisées : la génération retenue est celle lue
+  // avant le dernier passage, le tour suivant relit donc les bits publiés
+  // pendant ce passage (sinon ils resteraient en attente jusqu'à la demande
+  // suivante)
+  snapshot.flags = 0;
+  uint32_t settled = mailboxSeenGeneration;
+  for (int attempt = 0; attempt < MAILBOX_READ_ATTEMPTS; attempt++) {
+    snapshot.flags |= mailboxFlags.exchange(0, std::memory_order_acquire);
+    snapshot.color = mailboxColor.load(std::memory_order_relaxed);
+    snapshot.brightness = (uint8_t)mailboxBrightness.load(std::memory_order_relaxed);
+    snapshot.effect = (LEDEffect)mailboxEffect.load(std::memory_order_relaxed);
+    snapshot.activityTime = mailboxActivityTime.load(std::memory_order_relaxed);
+    snapshot.sleepPrevented = mailboxSleepPrevented.load(std::memory_order_relaxed);
+    for (uint8_t l = 0; l < LED_OVERLAY_COUNT; l++) {
+      snapshot.overlayColor[l] = mailboxOverlayColor[l].load(std::memory_order_relaxed);
+      snapshot.overlayParams[l] = mailboxOverlayParams[l].load(std::memory_order_relaxed);
+    }
+    const uint32_t check = mailboxGeneration.load(std::memory_order_acquire);
+    settled = generation;  // Génération vue avant ce passage
+    if (check == generation) {
       break;
-      
-    case LED_CMD_SET_BRIGHTNESS:
-      // Réinitialiser le timer d'activité lors d'un changement de luminosité
+    }
+    generation = check;
+  }
+  mailboxSeenGeneration = settled;
+  return snapshot.flags != 0;
+}
+
+void LEDManager::applyMailbox(const MailboxSnapshot& snapshot) {
+  // Les demandes ne font que changer l'état : la trame est entièrement
+  // recomposée avant chaque envoi (composeFrame), pas besoin d'éteindre puis
+  // de redessiner la bande à chaque transition
+  const uint32_t flags = snapshot.flags;
+  
+  if (flags & MAILBOX_CLEAR) {
+    // Éteindre le calque de base (couleur noire et effet NONE arrivent par leurs
+    // emplacements) ; les calques transitoires (alerte) se terminent d'eux-mêmes
+    testSequentialActive = false;  // Arrêter le test si en cours
+    feedbackFadeOutActive = false;  // Annuler le fade-out "pas de routine" pour permettre un nouveau feedback (ex: alerte)
+  }
+  
+  // Réveil avant la politique de sleep : preventSleep() + wakeUp() lus dans
+  // le même instantané réveillent en fondu, quel que soit l'ordre des appels
+  if (flags & MAILBOX_WAKE) {
+    applyWakeUp(snapshot.activityTime);
+  } else if (flags & MAILBOX_ACTIVITY) {
+    noteActivity(snapshot.activityTime);
+  }
+  
+  if (flags & MAILBOX_SLEEP_POLICY) {
+    applySleepPolicy(snapshot.sleepPrevented);
+  }
+  
+  if (flags & MAILBOX_FADE_OUT) {
+    // sleepPrevented reste true pendant le fade, réautorisé à la fin dans updateFeedbackFadeOut
+    startFadeOut(true);
+  }
+  
+  if (flags & MAILBOX_RESET_STATS) {
+    showStats.reset();
+    LEDOutput::resetStats();
+  }
+  
+  if (flags & MAILBOX_TEST_SEQUENTIAL) {
+    LogManager::info("[LED] applyMailbox TEST_SEQUENTIAL");
+    LogManager::info("[LED-TEST] Nombre total de LEDs: %d\n", NUM_LEDS);
+    // Réveiller les LEDs si elles sont en sleep
+    if (isSleeping) {
+      applyWakeUp(millis());
+    }
+    // Désactiver les effets temporairement
+    currentEffect = LED_EFFECT_NONE;
+    // Initialiser le test séquentiel
+    testSequentialActive = true;
+    testSequentialIndex = 0;
+    testSequentialLastUpdate = millis();
+    // Éteindre toutes les LEDs au début (le test écrit directement dans la bande)
+    if (strip != nullptr) {
+      strip->clear();
+      LEDOutput::show(strip);
+    }
+    LogManager::info("[LED-TEST] Test sequentiel demarre");
+  }
+  
+  if (flags & MAILBOX_BRIGHTNESS) {
+    // Réinitialiser le timer d'activité lors d'un changement de luminosité
+    lastActivityTime = millis();
+    currentBrightness = snapshot.brightness;
+  }
+  
+  if (flags & MAILBOX_EFFECT) {
+    LogManager::debug("[LED] applyMailbox EFFECT: %s (ancien: %s)\n", 
+                  getEffectName(snapshot.effect), getEffectName(currentEffect));
+    
+    feedbackFadeOutActive = false;  // Annuler le fade-out "pas de routine" pour permettre un nouveau feedback (ex: alerte)
+    
+    // IMPORTANT: Réinitialiser le timer d'activité IMMÉDIATEMENT au début du traitement
+    // Cela évite que checkSleepMode() (appelé dans la boucle principale) entre en sleep mode
+    // pendant le traitement de la demande
+    if (snapshot.effect != LED_EFFECT_NONE) {
       lastActivityTime = millis();
-      
-      currentBrightness = cmd.data.brightness;
-      if (strip != nullptr) {
-        strip->setBrightness(currentBrightness);
-        // Réappliquer la couleur sur toutes les LEDs si pas d'effet actif
-        if (currentEffect == LED_EFFECT_NONE) {
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip->setPixelColor(i, currentColor);
-          }
-        }
-      }
-      break;
-      
-    case LED_CMD_SET_EFFECT: {
-      LogManager::debug("[LED] processCommand SET_EFFECT: %s (ancien: %s)\n", 
-                    getEffectName(cmd.data.effect), getEffectName(currentEffect));
-      
-      feedbackFadeOutActive = false;  // Annuler le fade-out "pas de routine" pour permettre un nouveau feedback (ex: alerte)
-      
-      // IMPORTANT: Réinitialiser le timer d'activité IMMÉDIATEMENT au début du traitement
-      // Cela évite que checkSleepMode() (appelé dans la boucle principale) entre en sleep mode
-      // pendant le traitement de la commande
-      if (cmd.data.effect != LED_EFFECT_NONE) {
-        lastActivityTime = millis();
-      }
-      
-      // Si on change d'effet, éteindre d'abord pour transition propre
-      // Cela évite le flash de la couleur/effet précédent
-      if (currentEffect != cmd.data.effect && strip != nullptr) {
-        // Éteindre toutes les LEDs avant de changer d'effet
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-      }
-      LEDEffect previousEffect = currentEffect;
-      currentEffect = cmd.data.effect;
+    }
+    
+    LEDEffect previousEffect = currentEffect;
+    currentEffect = snapshot.effect;
 
-      // Réinitialiser les drapeaux des effets pour forcer une réinitialisation des variables statiques
-      // Cela évite les flashes quand on bascule entre les effets
-      if (previousEffect != currentEffect) {
-        rainbowNeedsReset = true;
-        rainbowSoftNeedsReset = true;
-        rotateNeedsReset = true;
-        nightlightNeedsReset = true;
-        breatheNeedsReset = true;
-        pulseNeedsReset = true;  // Réinitialiser PULSE aussi
-      }
+    // Redémarrer le nouvel effet depuis t = 0 (évite les flashes entre effets)
+    // Une timeline renvoyée redémarre aussi : ses keyframes ont pu changer
+    if (previousEffect != currentEffect || currentEffect == LED_EFFECT_TIMELINE) {
+      resetEffect();
+    }
 
-      // Note: rotateActivationTime sera défini explicitement lors du passage au vert (SUCCESS)
-      // pour que le décompte ne commence qu'après la disparition de l'orange
-      if (currentEffect != LED_EFFECT_ROTATE) {
-        rotateActivationTime = 0;  // Réinitialiser si on change d'effet
-      }
-      // Si on change vers NONE, vérifier si on veut éteindre ou afficher une couleur fixe
-      if (currentEffect == LED_EFFECT_NONE && strip != nullptr) {
-        if (previousEffect != LED_EFFECT_NONE) {
-          // Changement depuis un effet animé : éteindre visuellement pour transition propre
-          // MAIS ne pas réinitialiser currentColor à 0, car setColor() peut être appelé après
-          // pour afficher une couleur fixe avec LED_EFFECT_NONE
-          // Note: On ne modifie PAS currentColor ni brightness ici
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip->setPixelColor(i, 0);
-          }
-          strip->show();
-        }
-        // Si on est déjà en mode NONE, ne pas réinitialiser la couleur
-        // Cela permet d'afficher une couleur fixe avec LED_EFFECT_NONE
-        // La couleur sera préservée et affichée si elle est définie
-      }
-      // Si on change vers PULSE ou PULSE_FAST, réinitialiser l'effet pour éviter le flash
-      if (currentEffect == LED_EFFECT_PULSE || currentEffect == LED_EFFECT_PULSE_FAST) {
-        resetPulseEffect();
-        // IMPORTANT: S'assurer que currentColor est bien défini avant d'activer PULSE
-        // Si currentColor est 0 (noir) ou contient une couleur résiduelle indésirable,
-        // attendre que la couleur soit définie par setColor() avant d'activer PULSE
-        // Note: Le code appelant devrait faire clear() + setColor() + delay() + setEffect()
-        // pour s'assurer que la couleur est bien définie avant d'activer PULSE
-        if (currentColor == 0 && strip != nullptr) {
-          // Couleur non définie, s'assurer que les LEDs sont éteintes
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip->setPixelColor(i, 0);
-          }
-          strip->setBrightness(0);
-          LogManager::debug("[LED] processCommand SET_EFFECT PULSE - Couleur non definie, LEDs eteintes");
-        } else {
-          // Couleur définie, PULSE utilisera cette couleur
-          LogManager::debug("[LED] processCommand SET_EFFECT PULSE - Couleur: RGB(%d, %d, %d)\n",
-                       (currentColor >> 16) & 0xFF, (currentColor >> 8) & 0xFF, currentColor & 0xFF);
-        }
-      }
-      // Les effets seront gérés par updateEffects()
-      break;
+    // Note: rotateActivationTime sera défini explicitement lors du passage au vert (SUCCESS)
+    // pour que le décompte ne commence qu'après la disparition de l'orange
+    if (currentEffect != LED_EFFECT_ROTATE) {
+      rotateActivationTime = 0;  // Réinitialiser si on change d'effet
     }
-      
-    case LED_CMD_CLEAR:
-      currentColor = 0;  // Noir
-      currentEffect = LED_EFFECT_NONE;
-      testSequentialActive = false;  // Arrêter le test si en cours
-      feedbackFadeOutActive = false;  // Annuler le fade-out "pas de routine" pour permettre un nouveau feedback (ex: alerte)
-      // IMPORTANT: Éteindre complètement toutes les LEDs
-      if (strip != nullptr) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-        // IMPORTANT: Mettre la luminosité à 0 pour éteindre complètement
-        // Cela garantit que même si updateEffects() tourne, les LEDs restent éteintes
-        strip->setBrightness(0);
-      }
-      // Réinitialiser l'effet PULSE si nécessaire pour éviter qu'il reprenne
-      pulseNeedsReset = false;
-      // La mise à jour sera faite par strip->show() dans la boucle principale
-      // avec needsUpdate = true qui a été défini lors de la réception de la commande
-      break;
-      
-    case LED_CMD_TEST_SEQUENTIAL:
-      LogManager::info("[LED] processCommand TEST_SEQUENTIAL");
-      LogManager::info("[LED-TEST] Nombre total de LEDs: %d\n", NUM_LEDS);
-      // Réveiller les LEDs si elles sont en sleep
-      if (isSleeping) {
-        wakeUp();
-      }
-      // Désactiver les effets temporairement
-      currentEffect = LED_EFFECT_NONE;
-      // Initialiser le test séquentiel
-      testSequentialActive = true;
-      testSequentialIndex = 0;
-      testSequentialLastUpdate = millis();
-      // Éteindre toutes les LEDs au début
-      if (strip != nullptr) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-        strip->show();
-      }
-      LogManager::info("[LED-TEST] Test sequentiel demarre");
-      break;
+    // Passage à NONE : la couleur courante est conservée (setColor() peut suivre
+    // pour afficher une couleur fixe avec LED_EFFECT_NONE)
+  }
+  
+  // Après l'effet : setEffect(ROTATE) puis setColor(vert) lus dans le même
+  // instantané démarrent bien le décompte
+  if (flags & MAILBOX_COLOR) {
+    LogManager::debug("[LED] applyMailbox COLOR: 0x%06X, currentEffect=%d\n", snapshot.color, currentEffect);
+    
+    // Réinitialiser le timer d'activité lors d'un changement de couleur
+    // (sauf extinction par clear(), qui n'est pas une activité)
+    if (!(flags & MAILBOX_CLEAR) || snapshot.color != 0) {
+      lastActivityTime = millis();
+    }
+    
+    currentColor = snapshot.color;
+    
+    // Si on définit la couleur SUCCESS (vert: RGB(0, 255, 0)) avec l'effet ROTATE,
+    // démarrer le décompte pour désactivation automatique
+    // Cela permet que le décompte ne commence qu'après la disparition de l'orange
+    if (currentEffect == LED_EFFECT_ROTATE && currentColor == 0x00FF00) {
+      rotateActivationTime = millis();
+      #if ENABLE_VERBOSE_LOGS
+      LogManager::info("[LED] applyMailbox COLOR - Couleur SUCCESS (vert) detectee avec ROTATE, demarrage du decompte: %lu ms\n", rotateActivationTime);
+      #endif
+    }
+    // L'effet reste actif, seule la couleur change
   }
   
-  // IMPORTANT: Ne PAS mettre à jour lastActivityTime ici
-  // lastActivityTime est mis à jour uniquement dans wakeUp() et dans les méthodes publiques
+  for (uint8_t l = 0; l < LED_OVERLAY_COUNT; l++) {
+    if (flags & (MAILBOX_OVERLAY << l)) {
+      const uint32_t packed = snapshot.overlayColor[l];
+      const uint32_t params = snapshot.overlayParams[l];
+      LEDCompositor::setOverlay((LEDOverlayLayer)l, packed >> 8, packed & 0xFF,
+                                (uint16_t)(params & 0xFFFF), (LEDOverlayShape)((params >> 16) & 0xFF),
+                                millis());
+    }
+  }
+  
+  // IMPORTANT: Ne PAS mettre à jour lastActivityTime pour les autres demandes
+  // lastActivityTime n'avance que sur réveil / activité / changement d'état visible
   // Cela évite que les commandes système (WiFi retry, etc.) empêchent le sleep mode
 }
 
@@ -692,9 +640,6 @@ void LEDManager::checkSleepMode() {
       // Réveiller si on était en sleep ou en fade
       isSleeping = false;
       isFadingToSleep = false;
-      if (strip != nullptr) {
-        strip->setBrightness(currentBrightness);
-      }
     }
     return;
   }
@@ -705,9 +650,6 @@ void LEDManager::checkSleepMode() {
     if (isSleeping || isFadingToSleep) {
       isSleeping = false;
       isFadingToSleep = false;
-      if (strip != nullptr) {
-        strip->setBrightness(currentBrightness);
-      }
       // Restaurer l'effet si nécessaire
       if (savedEffect != LED_EFFECT_NONE) {
         currentEffect = savedEffect;
@@ -727,9 +669,6 @@ void LEDManager::checkSleepMode() {
     if (isSleeping || isFadingToSleep) {
       isSleeping = false;
       isFadingToSleep = false;
-      if (strip != nullptr) {
-        strip->setBrightness(currentBrightness);
-      }
       // Restaurer l'effet si nécessaire
       if (savedEffect != LED_EFFECT_NONE) {
         currentEffect = savedEffect;
@@ -766,56 +705,46 @@ void LEDManager::checkSleepMode() {
 }
 
 void LEDManager::updateSleepFade() {
-  unsigned long currentTime = millis();
-  unsigned long elapsed = currentTime - sleepFadeStartTime;
-  
-  if (elapsed >= SLEEP_FADE_DURATION_MS) {
-    // Animation terminée, éteindre complètement
+  // Le niveau maître (masterLevel) descend pendant le fondu ; les effets
+  // continuent dessous pour un fondu progressif naturel
+  if (millis() - sleepFadeStartTime >= SLEEP_FADE_DURATION_MS) {
+    // Animation terminée : sleep (calque de base noir)
     isFadingToSleep = false;
     isSleeping = true;
-    if (strip != nullptr) {
-      strip->setBrightness(0);
-      // IMPORTANT: Clear les LEDs quand on atteint 0 luminosité (mode sleep)
-      // Cela évite le flash de la couleur précédente quand on réactive
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip->setPixelColor(i, 0);
-      }
-    }
-  } else {
-    // Calculer le facteur de fade (1.0 -> 0.0)
-    float fadeFactor = 1.0f - ((float)elapsed / (float)SLEEP_FADE_DURATION_MS);
-    
-    // Appliquer le fondu progressif en baissant la luminosité globale
-    // Les effets continuent de s'afficher (gérés dans la boucle principale) mais avec luminosité réduite
-    uint8_t fadedBrightness = (uint8_t)(currentBrightness * fadeFactor);
-    if (strip != nullptr) {
-      strip->setBrightness(fadedBrightness);
-      // Ne pas clear les LEDs ici, laisser l'effet continuer avec luminosité réduite
-      // Cela crée un fondu progressif naturel
-    }
   }
 }
 
 void LEDManager::wakeUp() {
+  // Appliqué par la tâche LED au tour suivant (applyWakeUp)
+  storeActivityTime();
+  postMailbox(MAILBOX_WAKE);
+}
+
+void LEDManager::noteActivity(unsigned long activityTime) {
+  // Instant noté par le producteur : ne pas reculer si la tâche LED a noté
+  // une activité plus récente entre-temps (fin de réveil, changement d'effet)
+  if ((long)(activityTime - lastActivityTime) > 0) {
+    lastActivityTime = activityTime;
+  }
+}
+
+void LEDManager::applyWakeUp(unsigned long activityTime) {
   bool wasSleeping = (isSleeping || isFadingToSleep);
   
   if (isSleeping || isFadingToSleep) {
     LogManager::info("[LED] wakeUp() - Reveil depuis sleep (wasSleeping=%d, savedEffect=%d, currentColor=0x%06X)\n", 
                   wasSleeping ? 1 : 0, savedEffect, currentColor);
+    // Démarrer un fade-in progressif pour le réveil, depuis le niveau atteint
+    // si le fondu vers le sleep était en cours (pas de saut à noir)
+    unsigned long now = millis();
+    unsigned long fadeInStart = now;
+    if (isFadingToSleep && now - sleepFadeStartTime < SLEEP_FADE_DURATION_MS) {
+      fadeInStart = now - (SLEEP_FADE_DURATION_MS - (now - sleepFadeStartTime));
+    }
     isSleeping = false;
     isFadingToSleep = false;
-    
-    // IMPORTANT: Éteindre d'abord les LEDs pour éviter le flash de l'animation précédente
-    // Les LEDs peuvent encore contenir l'ancienne couleur/effet
-    if (strip != nullptr) {
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip->setPixelColor(i, 0);
-      }
-    }
-    
-    // Démarrer un fade-in progressif pour le réveil
     isFadingFromSleep = true;
-    sleepFadeStartTime = millis();
+    sleepFadeStartTime = fadeInStart;
     
     // Restaurer l'effet s'il y en avait un
     if (savedEffect != LED_EFFECT_NONE) {
@@ -823,7 +752,7 @@ void LEDManager::wakeUp() {
       currentEffect = savedEffect;
       // Si on restaure PULSE ou PULSE_FAST, réinitialiser l'effet
       if (currentEffect == LED_EFFECT_PULSE || currentEffect == LED_EFFECT_PULSE_FAST) {
-        resetPulseEffect();
+        resetEffect();
       }
     } else {
       // Pas d'effet sauvegardé -> ne rien restaurer, garder l'état actuel
@@ -836,7 +765,7 @@ void LEDManager::wakeUp() {
   // TOUJOURS réinitialiser le timer d'activité quand wakeUp() est appelé
   // Cela permet de tester les effets via Serial sans que le sleep mode se réactive immédiatement
   // et garantit que le système reste actif après un réveil explicite
-  lastActivityTime = millis();
+  noteActivity(activityTime);
   
   // NOTE: Ne pas démarrer automatiquement le WiFi retry depuis wakeUp()
   // car cela peut créer un cycle : WiFi retry -> commande LED -> wakeUp() -> WiFi retry
@@ -844,39 +773,40 @@ void LEDManager::wakeUp() {
 }
 
 void LEDManager::preventSleep() {
-  sleepPrevented = true;
-  // Réveiller immédiatement si on était en sleep
-  if (isSleeping || isFadingToSleep) {
-    isSleeping = false;
-    isFadingToSleep = false;
-    if (strip != nullptr) {
-      strip->setBrightness(currentBrightness);
-    }
-    // Restaurer l'effet si nécessaire
-    if (savedEffect != LED_EFFECT_NONE) {
-      currentEffect = savedEffect;
-      savedEffect = LED_EFFECT_NONE;
-    }
-    lastActivityTime = millis();
-  }
+  mailboxSleepPrevented.store(true, std::memory_order_relaxed);
+  postMailbox(MAILBOX_SLEEP_POLICY);
   #if ENABLE_VERBOSE_LOGS
   LogManager::info("[LED] Sleep mode empeche (bedtime actif)");
   #endif
 }
 
 void LEDManager::allowSleep() {
-  sleepPrevented = false;
+  mailboxSleepPrevented.store(false, std::memory_order_relaxed);
+  postMailbox(MAILBOX_SLEEP_POLICY);
   #if ENABLE_VERBOSE_LOGS
   LogManager::info("[LED] Sleep mode reautorise");
   #endif
 }
 
+void LEDManager::applySleepPolicy(bool prevented) {
+  sleepPrevented = prevented;
+  // Sleep empêché : réveiller immédiatement si on était en sleep
+  if (prevented && (isSleeping || isFadingToSleep)) {
+    isSleeping = false;
+    isFadingToSleep = false;
+    // Restaurer l'effet si nécessaire
+    if (savedEffect != LED_EFFECT_NONE) {
+      currentEffect = savedEffect;
+      savedEffect = LED_EFFECT_NONE;
+    }
+    lastActivityTime = millis();
+  }
+}
+
 void LEDManager::updateWakeFade() {
-  unsigned long currentTime = millis();
-  unsigned long elapsed = currentTime - sleepFadeStartTime;
-  
-  if (elapsed >= SLEEP_FADE_DURATION_MS) {
-    // Animation terminée, restaurer complètement
+  // Le niveau maître (masterLevel) remonte pendant le fondu, l'effet restauré
+  // par wakeUp() tourne déjà dessous : pas de redémarrage à la fin du fondu
+  if (millis() - sleepFadeStartTime >= SLEEP_FADE_DURATION_MS) {
     LogManager::info("[LED] updateWakeFade() - Animation reveil terminee, effet=%s, couleur=0x%06X\n",
                   getEffectName(currentEffect), currentColor);
     isFadingFromSleep = false;
@@ -884,647 +814,97 @@ void LEDManager::updateWakeFade() {
     // IMPORTANT: Réinitialiser le timer d'activité quand l'animation de réveil se termine
     // Cela évite que le sleep mode se réactive immédiatement après le réveil
     lastActivityTime = millis();
-    
-    // IMPORTANT: S'assurer que les LEDs sont bien éteintes avant de restaurer l'effet
-    // Cela évite le flash de l'animation précédente
-    if (strip != nullptr) {
-      for (int i = 0; i < NUM_LEDS; i++) {
-        strip->setPixelColor(i, 0);
-      }
-      
-      // Si l'effet est PULSE, réinitialiser pour une transition fluide
-      if (currentEffect == LED_EFFECT_PULSE) {
-        resetPulseEffect();
-        // Réinitialiser lastUpdateTime pour que l'effet reprenne immédiatement
-        lastUpdateTime = millis();
-      }
-      
-      // Restaurer la luminosité complète
-      strip->setBrightness(currentBrightness);
-      
-      // S'assurer que toutes les LEDs ont la couleur si pas d'effet
-      if (currentEffect == LED_EFFECT_NONE) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, currentColor);
-        }
-      }
-    }
-  } else {
-    // Calculer le facteur de fade (0.0 -> 1.0)
-    float fadeFactor = (float)elapsed / (float)SLEEP_FADE_DURATION_MS;
-    
-    // Simple: on remonte juste la luminosité globale
-    uint8_t fadedBrightness = (uint8_t)(currentBrightness * fadeFactor);
-    if (strip != nullptr) {
-      strip->setBrightness(fadedBrightness);
-      
-      // IMPORTANT: Pendant le fade-in, s'assurer que les LEDs sont bien éteintes au début
-      // et appliquer la nouvelle couleur/effet progressivement
-      if (fadedBrightness == 0 || elapsed < 50) {
-        // Au tout début du fade-in, s'assurer que les LEDs sont bien éteintes
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-      } else {
-        // Pendant le fade-in, appliquer la couleur/effet
-        // Si on a un effet, il sera géré par updateEffects() dans la boucle principale
-        // Mais on doit s'assurer que la couleur de base est correcte
-        if (currentEffect == LED_EFFECT_NONE) {
-          for (int i = 0; i < NUM_LEDS; i++) {
-            strip->setPixelColor(i, currentColor);
-          }
-        }
-        // Si on a un effet, updateEffects() s'en chargera dans la boucle principale
-        // Mais on doit permettre à updateEffects() de s'exécuter même pendant le fade-in
-      }
-    }
   }
 }
 
 bool LEDManager::getSleepState() {
-  // Retourner true si on est en sleep OU en fade vers sleep
-  // Cela évite de réveiller les LEDs si elles sont en train de s'éteindre
-  return isSleeping || isFadingToSleep;
+  // true si on est en sleep OU en fade vers sleep (publié par la tâche LED à
+  // chaque tour) : évite de réveiller les LEDs si elles sont en train de s'éteindre
+  return publishedSleepState.load(std::memory_order_relaxed);
 }
 
-void LEDManager::resetPulseEffect() {
-  // Marquer que l'effet PULSE doit être réinitialisé
-  pulseNeedsReset = true;
+void LEDManager::resetEffect() {
+  // Le reset est fait par la tâche LED à la prochaine trame (updateEffects)
+  effectNeedsReset = true;
 }
 
 void LEDManager::startFadeOutAndClear() {
+  // Démarré par la tâche LED au tour suivant (startFadeOut)
+  postMailbox(MAILBOX_FADE_OUT);
+}
+
+void LEDManager::startFadeOut(bool releaseSleep) {
   if (feedbackFadeOutActive) return;  // Déjà en fade, éviter les appels répétés
   if (currentEffect == LED_EFFECT_NONE && currentColor == 0) return;  // Déjà éteint, rien à faire
   feedbackFadeOutActive = true;
+  feedbackFadeOutReleasesSleep = releaseSleep;
   feedbackFadeOutStartTime = millis();
-  // sleepPrevented reste true pendant le fade, réautorisé à la fin dans updateFeedbackFadeOut
 }
 
 void LEDManager::updateFeedbackFadeOut() {
-  if (!feedbackFadeOutActive || strip == nullptr) return;
-  unsigned long currentTime = millis();
-  unsigned long elapsed = currentTime - feedbackFadeOutStartTime;
-  if (elapsed >= SLEEP_FADE_DURATION_MS) {
+  // Le niveau maître descend (masterLevel) ; à la fin, extinction de la base
+  if (!feedbackFadeOutActive) return;
+  if (millis() - feedbackFadeOutStartTime >= SLEEP_FADE_DURATION_MS) {
     feedbackFadeOutActive = false;
-    sleepPrevented = false;  // Réautoriser le sleep maintenant que le fade est terminé
+    if (feedbackFadeOutReleasesSleep) {
+      sleepPrevented = false;  // Réautoriser le sleep maintenant que le fade est terminé
+    }
     currentEffect = LED_EFFECT_NONE;
     currentColor = 0;
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip->setPixelColor(i, 0);
-    }
-    strip->setBrightness(0);
-  } else {
-    float fadeFactor = 1.0f - ((float)elapsed / (float)SLEEP_FADE_DURATION_MS);
-    uint8_t fadedBrightness = (uint8_t)(currentBrightness * fadeFactor);
-    strip->setBrightness(fadedBrightness);
   }
 }
 
 void LEDManager::updateEffects() {
-  static unsigned long effectTime = 0;
+  const LEDEffectInfo* effect = LEDEffects::get(currentEffect);
+  if (effect == nullptr || effect->renderer == nullptr) {
+    // Pas d'effet : couleur unie
+    for (int i = 0; i < NUM_LEDS; i++) {
+      framePixels[i] = currentColor;
+    }
+    return;
+  }
+  
   unsigned long currentTime = millis();
+  if (effectNeedsReset) {
+    effect->renderer->reset();
+    effectStartTime = currentTime;
+    effectNeedsReset = false;
+  }
   
-  switch (currentEffect) {
-    case LED_EFFECT_NONE:
-      // Pas d'effet, couleur unie déjà appliquée
-      break;
-      
-    case LED_EFFECT_RAINBOW: {
-      // Effet arc-en-ciel qui défile - basé sur le temps pour éviter les problèmes de timing
-      static unsigned long rainbowStartTime = 0;
-
-      // Réinitialiser si l'effet vient d'être activé
-      if (rainbowNeedsReset || rainbowStartTime == 0) {
-        rainbowStartTime = currentTime;
-        rainbowNeedsReset = false;
-      }
-
-      // Cycle complet de l'arc-en-ciel : ~3 secondes pour un tour complet
-      const uint32_t RAINBOW_CYCLE_MS = 3000;  // 3 secondes (plus rapide que SOFT qui est 30s)
-
-      // Gérer le wrap-around de millis()
-      uint32_t elapsed;
-      if (currentTime >= rainbowStartTime) {
-        elapsed = (currentTime - rainbowStartTime) % RAINBOW_CYCLE_MS;
-      } else {
-        elapsed = (ULONG_MAX - rainbowStartTime + currentTime) % RAINBOW_CYCLE_MS;
-      }
-
-      // Calculer la teinte de base avec précision (0 à 255)
-      uint16_t baseHue = (elapsed * 256) / RAINBOW_CYCLE_MS;
+  LEDFrame frame = { framePixels, NUM_LEDS, currentColor, currentBrightness };
+  effect->renderer->render(frame, currentTime - effectStartTime);
+}
 
-      if (strip != nullptr) {
-        // Répartir l'arc-en-ciel sur toute la bande LED
-        for (int i = 0; i < NUM_LEDS; i++) {
-          // Calculer la teinte pour cette LED (dégradé sur toute la bande)
-          uint16_t ledHue = (baseHue + (i * 256) / NUM_LEDS) % 256;
-          uint32_t color = hsvToRgb((uint8_t)ledHue, 255, 255);
-          strip->setPixelColor(i, color);
-        }
-      }
-      break;
-    }
-    
-    case LED_EFFECT_RAINBOW_SOFT: {
-      // Effet arc-en-ciel doux et lent pour veilleuse
-      // Animation beaucoup plus lente que RAINBOW standard
-      static unsigned long rainbowSoftStartTime = 0;
-      
-      // Initialiser le temps de départ si nécessaire
-      if (rainbowSoftStartTime == 0) {
-        rainbowSoftStartTime = currentTime;
-      }
-      
-      // Cycle complet de l'arc-en-ciel : ~30 secondes pour un tour complet (beaucoup plus lent)
-      const uint32_t RAINBOW_SOFT_CYCLE_MS = 30000;  // 30 secondes
-      
-      // Gérer le wrap-around de millis()
-      uint32_t elapsed;
-      if (currentTime >= rainbowSoftStartTime) {
-        elapsed = (currentTime - rainbowSoftStartTime) % RAINBOW_SOFT_CYCLE_MS;
-      } else {
-        elapsed = (ULONG_MAX - rainbowSoftStartTime + currentTime) % RAINBOW_SOFT_CYCLE_MS;
-      }
-      
-      // Calculer la teinte de base avec précision (0 à 255)
-      // Utiliser une précision élevée pour fluidité maximale
-      uint16_t baseHue = (elapsed * 256) / RAINBOW_SOFT_CYCLE_MS;
-      
-      if (strip != nullptr) {
-        // Répartir l'arc-en-ciel sur toute la bande LED
-        // Chaque LED a une teinte légèrement différente pour créer un dégradé
-        for (int i = 0; i < NUM_LEDS; i++) {
-          // Calculer la teinte pour cette LED (dégradé sur toute la bande)
-          // Utiliser une répartition douce pour un effet apaisant
-          uint16_t hue = (baseHue + (i * 256 / NUM_LEDS)) % 256;
-          
-          // Saturation et luminosité réduites pour un effet plus doux et apaisant
-          // Saturation: 200/255 (78%) pour des couleurs moins vives
-          // Luminosité: 180/255 (70%) pour un effet plus doux
-          uint32_t color = hsvToRgb((uint8_t)hue, 200, 180);
-          strip->setPixelColor(i, color);
-        }
-      }
-      break;
-    }
-    
-    case LED_EFFECT_PULSE: {
-      // Effet de pulsation (respiration) rapide et fluide
-      // Utiliser le temps réel pour une vitesse constante et fluide
-      static unsigned long pulseStartTime = 0;
-      
-      // Réinitialiser si nécessaire (après réveil depuis sleep)
-      if (pulseNeedsReset) {
-        pulseStartTime = currentTime;
-        pulseNeedsReset = false;
-      }
-      
-      // Cycle de respiration : ~2.5 secondes pour un cycle complet (inspiration + expiration)
-      const uint32_t PULSE_CYCLE_MS = 2500;  // 2.5 secondes
-      uint32_t elapsed = (currentTime - pulseStartTime) % PULSE_CYCLE_MS;
-      
-      // Calculer la phase normalisée (0 à 1023 pour précision)
-      uint16_t phase = (elapsed * 1024) / PULSE_CYCLE_MS;
-      
-      // Calculer la valeur de pulsation avec une courbe sinusoïdale douce
-      // Utiliser une approximation de sin pour fluidité maximale
-      // Phase 0-511 : montée (inspiration), Phase 512-1023 : descente (expiration)
-      // Minimum réduit de 50 à 30 pour un effet plus sombre en bas (~12% de luminosité)
-      const uint8_t PULSE_MIN = 30;  // Minimum de luminosité (réduit de 50 à 30)
-      const uint8_t PULSE_MAX = 255;  // Maximum de luminosité
-      const uint8_t PULSE_RANGE = PULSE_MAX - PULSE_MIN;  // 225
-      
-      uint8_t pulseValue;
-      if (phase < 512) {
-        // Montée (inspiration) : de PULSE_MIN à PULSE_MAX
-        // Courbe douce : utiliser phase² pour accélération progressive
-        uint16_t normalizedPhase = phase;  // 0-511
-        // Appliquer une courbe douce (quadratique) pour fluidité
-        uint16_t smoothPhase = (normalizedPhase * normalizedPhase) / 512;
-        pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
-      } else {
-        // Descente (expiration) : de PULSE_MAX à PULSE_MIN
-        uint16_t phaseDown = phase - 512;  // 0-511
-        // Courbe douce inverse
-        uint16_t smoothPhase = 511 - phaseDown;
-        smoothPhase = (smoothPhase * smoothPhase) / 512;
-        pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
-      }
-      
-      // Appliquer la pulsation à la couleur
-      if (strip != nullptr) {
-        // Extraire les composantes RGB de currentColor
-        uint8_t r = (currentColor >> 16) & 0xFF;
-        uint8_t g = (currentColor >> 8) & 0xFF;
-        uint8_t b = currentColor & 0xFF;
-        
-        // Appliquer la pulsation (fade)
-        r = (r * pulseValue) / 255;
-        g = (g * pulseValue) / 255;
-        b = (b * pulseValue) / 255;
-        
-        uint32_t pulseColor = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, pulseColor);
-        }
-      }
-      break;
-    }
-    
-    case LED_EFFECT_PULSE_FAST: {
-      // Même logique que PULSE mais cycle plus court (~0.8 s) pour feedback "pas de routine"
-      static unsigned long pulseFastStartTime = 0;
-      if (pulseNeedsReset) {
-        pulseFastStartTime = currentTime;
-        pulseNeedsReset = false;
-      }
-      const uint32_t PULSE_FAST_CYCLE_MS = 800;
-      uint32_t elapsed = (currentTime - pulseFastStartTime) % PULSE_FAST_CYCLE_MS;
-      uint16_t phase = (elapsed * 1024) / PULSE_FAST_CYCLE_MS;
-      const uint8_t PULSE_MIN = 30;
-      const uint8_t PULSE_MAX = 255;
-      const uint8_t PULSE_RANGE = PULSE_MAX - PULSE_MIN;
-      uint8_t pulseValue;
-      if (phase < 512) {
-        uint16_t smoothPhase = (phase * phase) / 512;
-        pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
-      } else {
-        uint16_t phaseDown = phase - 512;
-        uint16_t smoothPhase = 511 - phaseDown;
-        smoothPhase = (smoothPhase * smoothPhase) / 512;
-        pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
-      }
-      if (strip != nullptr) {
-        uint8_t r = (currentColor >> 16) & 0xFF;
-        uint8_t g = (currentColor >> 8) & 0xFF;
-        uint8_t b = currentColor & 0xFF;
-        r = (r * pulseValue) / 255;
-        g = (g * pulseValue) / 255;
-        b = (b * pulseValue) / 255;
-        uint32_t pulseColor = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, pulseColor);
-        }
-      }
-      break;
-    }
-    
-    case LED_EFFECT_GLOSSY: {
-      // Effet glossy multicolore
-      static uint8_t offset = 0;
-      if (strip != nullptr) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-          uint8_t hue = ((i * 256 / NUM_LEDS) + offset) % 256;
-          uint32_t color = hsvToRgb(hue, 200, 255);
-          strip->setPixelColor(i, color);
-        }
-      }
-      offset = (offset + 1) % 256;
-      break;
-    }
-    
-    case LED_EFFECT_ROTATE: {
-      // Effet de rotation type "serpent" avec début (tête) et fin (queue) progressifs
-      // Utiliser le temps réel pour une rotation constante et fluide
-      static unsigned long rotateStartTime = 0;
-      
-      // Initialiser le temps de départ si nécessaire
-      if (rotateStartTime == 0) {
-        rotateStartTime = currentTime;
-      }
-      
-      // Cycle de rotation : ~5 secondes pour un tour complet (ralenti pour plus de fluidité)
-      // Plus lent = chaque LED reste allumée plus longtemps = animation plus fluide
-      const uint32_t ROTATE_CYCLE_MS = 5000;  // 5 secondes (au lieu de 4)
-      uint32_t elapsed = (currentTime - rotateStartTime) % ROTATE_CYCLE_MS;
-      
-      // Calculer la position de la tête du serpent avec précision fractionnaire
-      // Utiliser une précision élevée (256x) pour fluidité maximale
-      uint32_t headPositionPrecise = (elapsed * NUM_LEDS * 256) / ROTATE_CYCLE_MS;
-      uint16_t headPosition = (headPositionPrecise >> 8) % NUM_LEDS;  // Position de la tête (LED principale)
-      uint8_t headSubPosition = headPositionPrecise & 0xFF;  // Position fractionnaire (0-255)
-      
-      // Longueur du serpent (nombre de LEDs) - queue optimale avec fade-out très progressif
-      // 30% de la bande pour queue visible mais pas trop longue
-      // Le fade-out progressif fait que les dernières LEDs restent allumées longtemps
-      const uint8_t snakeLength = (NUM_LEDS * 30) / 100;  // 30% de la bande (optimal)
-      
-      // Éteindre toutes les LEDs
-      if (strip != nullptr) {
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, 0);
-        }
-      }
-      
-      // Dessiner le serpent progressif avec position fractionnaire pour mouvement ultra-fluide
-      // Le serpent s'étend de (headPosition - snakeLength) à headPosition
-      // Utiliser la position fractionnaire pour créer un dégradé qui se déplace progressivement
-      
-      // Parcourir toutes les LEDs pour créer un dégradé fluide
-      for (int ledIndex = 0; ledIndex < NUM_LEDS; ledIndex++) {
-        // Calculer la position précise de cette LED (en unités fractionnaires)
-        // Utiliser le centre de la LED pour plus de précision et fluidité
-        // +128 pour centrer, cela donne une transition plus douce entre LEDs
-        int32_t ledPositionPrecise = ((int32_t)ledIndex * 256) + 128;  // Centre de la LED
-        
-        // Calculer la distance depuis la tête (en tenant compte du wrap-around)
-        int32_t distanceToHead = headPositionPrecise - ledPositionPrecise;
-        
-        // Gérer le wrap-around (distance la plus courte)
-        if (distanceToHead > (NUM_LEDS * 256) / 2) {
-          distanceToHead -= (NUM_LEDS * 256);
-        } else if (distanceToHead < -(NUM_LEDS * 256) / 2) {
-          distanceToHead += (NUM_LEDS * 256);
-        }
-        
-        // Convertir en valeur absolue et vérifier si cette LED fait partie du serpent
-        int32_t absDistance = (distanceToHead < 0) ? -distanceToHead : distanceToHead;
-        int32_t maxSnakeDistance = snakeLength * 256;
-        
-        // Si la LED est en dehors du serpent, elle est éteinte
-        if (absDistance > maxSnakeDistance) {
-          if (strip != nullptr) {
-            strip->setPixelColor(ledIndex, 0);
-          }
-          continue;
-        }
-        
-        // Calculer l'intensité avec dégradé très progressif de la queue vers la tête
-        // Queue très longue qui reste allumée longtemps avec luminosité qui diminue très doucement
-        uint8_t intensity;
-        if (absDistance == 0) {
-          // Tête : luminosité maximale (255)
-          intensity = 255;
-        } else {
-          // Queue vers tête : dégradé très progressif avec courbe exponentielle douce
-          // Utiliser la distance inverse : proche de la tête = plus élevé
-          uint32_t fadeFactor = maxSnakeDistance - absDistance;
-          
-          // Normaliser sur 0-256 pour calcul de courbe
-          uint32_t normalizedFade = (fadeFactor * 256) / maxSnakeDistance;  // 0-256
-          
-          // Courbe optimisée : queue qui s'éteint rapidement mais dernières LEDs restent visibles
-          // avec fade-out progressif pour fluidité maximale
-          uint32_t x = normalizedFade;  // 0-256
-          
-          // Courbe en 3 zones pour fade-out progressif mais queue qui s'éteint assez vite
-          // - Queue lointaine (x < 80) : s'éteint rapidement (presque invisible)
-          // - Queue moyenne (80 < x < 180) : fade-out progressif (visible mais faible)
-          // - Queue proche vers tête (x > 180) : montée rapide vers maximum
-          
-          uint32_t fadeValue;
-          
-          if (x < 80) {
-            // Queue très lointaine (x = 0-80) : s'éteint rapidement
-            // Courbe quadratique pour extinction rapide mais douce
-            uint32_t xNormalized = x;  // 0-80
-            fadeValue = (xNormalized * xNormalized) / 80;  // 0-80, extinction rapide
-          } else if (x < 180) {
-            // Queue moyenne (x = 80-180) : fade-out progressif
-            // Les dernières LEDs restent visibles avec luminosité qui diminue doucement
-            uint32_t xNormalized = x - 80;  // 0-100
-            uint32_t baseValue = 80;  // Valeur de base depuis la queue lointaine
-            // Courbe quadratique douce pour fade-out progressif
-            uint32_t increment = (xNormalized * xNormalized) / 40;  // 0-250
-            fadeValue = baseValue + increment;  // 80-330
-          } else {
-            // Queue proche et tête (x = 180-256) : montée rapide vers maximum
-            uint32_t xNormalized = x - 180;  // 0-76
-            uint32_t baseValue = 330;  // Valeur de base depuis la queue moyenne
-            // Courbe cubique pour montée rapide mais fluide vers la tête
-            uint32_t increment = (xNormalized * xNormalized * xNormalized) / 300;  // 0-76
-            fadeValue = baseValue + increment;  // 330-406
-          }
-          
-          // Limiter à 256 maximum
-          if (fadeValue > 256) fadeValue = 256;
-          
-          // Intensité optimisée : queue s'éteint assez vite mais dernières LEDs restent visibles
-          // Queue lointaine : 15 (très faible, presque éteinte)
-          // Queue moyenne : 15-150 (fade-out progressif, reste visible)
-          // Queue proche : 150-255 (montée rapide vers tête)
-          // Cela donne une queue qui s'éteint assez vite mais les dernières LEDs restent visibles
-          intensity = 15 + ((fadeValue * 240) / 256);
-          
-          // S'assurer que l'intensité minimale est respectée
-          if (intensity < 15) intensity = 15;
-        }
-        
-        // Appliquer la couleur avec l'intensité calculée
-        if (strip != nullptr) {
-          // Extraire les composantes RGB de currentColor
-          uint8_t r = (currentColor >> 16) & 0xFF;
-          uint8_t g = (currentColor >> 8) & 0xFF;
-          uint8_t b = currentColor & 0xFF;
-          
-          // Appliquer l'intensité (fade)
-          r = (r * intensity) / 255;
-          g = (g * intensity) / 255;
-          b = (b * intensity) / 255;
-          
-          uint32_t snakeColor = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-          strip->setPixelColor(ledIndex, snakeColor);
-        }
-      }
-      break;
-    }
-    
-    case LED_EFFECT_NIGHTLIGHT: {
-      // Effet de veilleuse avec vagues bleu/blanc qui se déplacent de gauche à droite
-      // Utiliser le temps réel pour une animation constante et fluide
-      static unsigned long nightlightStartTime = 0;
-      
-      // Initialiser le temps de départ si nécessaire
-      if (nightlightStartTime == 0) {
-        nightlightStartTime = currentTime;
-      }
-      
-      // Cycle de déplacement : ~6 secondes pour traverser toute la bande
-      const uint32_t NIGHTLIGHT_CYCLE_MS = 6000;  // 6 secondes
-      
-      // Gérer le wrap-around de millis()
-      uint32_t elapsed;
-      if (currentTime >= nightlightStartTime) {
-        elapsed = (currentTime - nightlightStartTime) % NIGHTLIGHT_CYCLE_MS;
-      } else {
-        // Wrap-around détecté
-        elapsed = (ULONG_MAX - nightlightStartTime + currentTime) % NIGHTLIGHT_CYCLE_MS;
-      }
-      
-      // Calculer l'offset de déplacement (0 à NUM_LEDS * 2 pour permettre plusieurs cycles visuels)
-      float scrollOffset = ((float)elapsed / (float)NIGHTLIGHT_CYCLE_MS) * (float)(NUM_LEDS * 2);
-      
-      if (strip != nullptr) {
-        // Couleurs de base : bleu et blanc
-        const uint8_t BLUE_R = 30;
-        const uint8_t BLUE_G = 100;
-        const uint8_t BLUE_B = 255;
-        
-        const uint8_t WHITE_R = 200;
-        const uint8_t WHITE_G = 220;
-        const uint8_t WHITE_B = 255;
-        
-        // Créer plusieurs vagues qui se déplacent de gauche à droite
-        for (int i = 0; i < NUM_LEDS; i++) {
-          // Position avec décalage pour créer le mouvement de gauche à droite
-          float position = (float)i - scrollOffset;
-          
-          // Créer 3 vagues sinusoïdales avec différentes fréquences et phases
-          // Vague 1 : longue période (bleu dominant) - mouvement lent
-          float wave1 = sin((position / (float)NUM_LEDS) * 2.0 * M_PI * 1.5) * 0.5 + 0.5;
-          
-          // Vague 2 : période moyenne (blanc subtil) - mouvement moyen
-          float wave2 = sin((position / (float)NUM_LEDS) * 2.0 * M_PI * 2.5 + (M_PI / 3.0)) * 0.5 + 0.5;
-          
-          // Vague 3 : courte période (accent bleu) - mouvement rapide
-          float wave3 = sin((position / (float)NUM_LEDS) * 2.0 * M_PI * 4.0 + (M_PI / 2.0)) * 0.3 + 0.3;
-          
-          // Combiner les vagues (mélange bleu/blanc - bleu dominant)
-          // Assurer un minimum de luminosité pour éviter les zones complètement sombres
-          float blueFactor = wave1 * 0.6 + wave3 * 0.4;
-          float whiteFactor = wave2 * 0.2;
-          
-          // Ajouter un fond bleu minimal pour éviter les zones complètement éteintes
-          float baseBlue = 0.3; // Fond bleu minimal (30%)
-          blueFactor = blueFactor * 0.7 + baseBlue; // 70% de la vague + 30% de fond
-          
-          // Normaliser pour éviter la saturation, mais garder un minimum
-          float total = blueFactor + whiteFactor;
-          if (total > 1.0) {
-            blueFactor /= total;
-            whiteFactor /= total;
-          }
-          
-          // Calculer les composantes RGB finales
-          uint8_t r = (uint8_t)(BLUE_R * blueFactor + WHITE_R * whiteFactor);
-          uint8_t g = (uint8_t)(BLUE_G * blueFactor + WHITE_G * whiteFactor);
-          uint8_t b = (uint8_t)(BLUE_B * blueFactor + WHITE_B * whiteFactor);
-          
-          // Appliquer la luminosité globale
-          r = (r * currentBrightness) / 255;
-          g = (g * currentBrightness) / 255;
-          b = (b * currentBrightness) / 255;
-          
-          uint32_t color = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-          strip->setPixelColor(i, color);
-        }
-      }
-      break;
+uint16_t LEDManager::masterLevel(unsigned long now) {
+  if (isSleeping) return 0;
+  
+  // Luminosité configurée sur 0-65535, puis fondus en cours (ils se cumulent).
+  // Niveau perçu : la correction gamma est appliquée par LEDCompositor
+  uint32_t level = (uint32_t)currentBrightness * 257;
+  if (isFadingToSleep || feedbackFadeOutActive) {
+    const unsigned long start = isFadingToSleep ? sleepFadeStartTime : feedbackFadeOutStartTime;
+    const unsigned long elapsed = now - start;
+    const uint32_t remaining = elapsed >= SLEEP_FADE_DURATION_MS ? 0 : SLEEP_FADE_DURATION_MS - elapsed;
+    level = (uint32_t)(((uint64_t)level * remaining) / SLEEP_FADE_DURATION_MS);
+  }
+  if (isFadingFromSleep) {
+    const unsigned long elapsed = now - sleepFadeStartTime;
+    if (elapsed < SLEEP_FADE_DURATION_MS) {
+      level = (uint32_t)(((uint64_t)level * elapsed) / SLEEP_FADE_DURATION_MS);
     }
-    
-    case LED_EFFECT_BREATHE: {
-      // Effet de respiration avec changement de couleur toutes les 30 secondes
-      static unsigned long breatheStartTime = 0;
-      static int currentColorIndex = 0;
-      static unsigned long colorChangeStartTime = 0;
-      static uint8_t previousR = 30, previousG = 100, previousB = 255;  // Couleur précédente pour transition
-      
-      // Palette de couleurs pour la respiration (définie en premier pour être accessible partout)
-      // Couleurs douces et apaisantes
-      const uint8_t colors[][3] = {
-        {30, 100, 255},   // Bleu doux
-        {100, 150, 255},  // Bleu ciel
-        {150, 100, 255},  // Violet doux
-        {255, 100, 150},  // Rose doux
-        {255, 150, 100},  // Orange doux
-        {150, 255, 150},  // Vert doux
-        {255, 200, 100}   // Jaune doux
-      };
-      const int numColors = sizeof(colors) / sizeof(colors[0]);
-      
-      // Initialiser le temps de départ si nécessaire
-      if (breatheStartTime == 0) {
-        breatheStartTime = currentTime;
-        colorChangeStartTime = currentTime;
-        // Initialiser avec la première couleur
-        previousR = colors[0][0];
-        previousG = colors[0][1];
-        previousB = colors[0][2];
-      }
-      
-      // Cycle de changement de couleur : 30 secondes
-      const uint32_t COLOR_CHANGE_INTERVAL_MS = 30000;  // 30 secondes
-      const uint32_t COLOR_TRANSITION_DURATION_MS = 2000;  // 2 secondes pour la transition
-      
-      // Gérer le wrap-around de millis()
-      uint32_t elapsed;
-      if (currentTime >= breatheStartTime) {
-        elapsed = currentTime - breatheStartTime;
-      } else {
-        // Wrap-around détecté
-        elapsed = ULONG_MAX - breatheStartTime + currentTime;
-      }
-      
-      // Changer de couleur toutes les 30 secondes
-      int newColorIndex = elapsed / COLOR_CHANGE_INTERVAL_MS;
-      if (newColorIndex != currentColorIndex) {
-        // Sauvegarder la couleur actuelle comme couleur précédente
-        previousR = colors[currentColorIndex % numColors][0];
-        previousG = colors[currentColorIndex % numColors][1];
-        previousB = colors[currentColorIndex % numColors][2];
-        currentColorIndex = newColorIndex;
-        colorChangeStartTime = currentTime;
-      }
-      
-      // Sélectionner la couleur cible (cycle infini)
-      uint8_t targetR = colors[currentColorIndex % numColors][0];
-      uint8_t targetG = colors[currentColorIndex % numColors][1];
-      uint8_t targetB = colors[currentColorIndex % numColors][2];
-      
-      // Calculer la transition progressive entre l'ancienne et la nouvelle couleur
-      uint32_t transitionElapsed;
-      if (currentTime >= colorChangeStartTime) {
-        transitionElapsed = currentTime - colorChangeStartTime;
-      } else {
-        transitionElapsed = ULONG_MAX - colorChangeStartTime + currentTime;
-      }
-      
-      uint8_t currentR, currentG, currentB;
-      if (transitionElapsed < COLOR_TRANSITION_DURATION_MS) {
-        // Transition en cours : mélanger progressivement les couleurs
-        float transitionFactor = (float)transitionElapsed / (float)COLOR_TRANSITION_DURATION_MS;
-        // Utiliser une courbe d'ease-in-out pour une transition plus douce
-        float easedFactor = transitionFactor * transitionFactor * (3.0 - 2.0 * transitionFactor);
-        
-        currentR = (uint8_t)(previousR + (targetR - previousR) * easedFactor);
-        currentG = (uint8_t)(previousG + (targetG - previousG) * easedFactor);
-        currentB = (uint8_t)(previousB + (targetB - previousB) * easedFactor);
-      } else {
-        // Transition terminée : utiliser la couleur cible
-        currentR = targetR;
-        currentG = targetG;
-        currentB = targetB;
-      }
-      
-      // Cycle de respiration : ~3 secondes pour un cycle complet (inspiration + expiration)
-      const uint32_t BREATHE_CYCLE_MS = 3000;  // 3 secondes
-      uint32_t breatheElapsed = elapsed % BREATHE_CYCLE_MS;
-      
-      // Créer l'effet de respiration avec une fonction sinusoïdale
-      // sin va de -1 à 1, on le transforme en 0.3 à 1.0 pour avoir un minimum de luminosité
-      float breatheFactor = sin((float)breatheElapsed / (float)BREATHE_CYCLE_MS * 2.0 * M_PI) * 0.35 + 0.65;
-      // breatheFactor va maintenant de 0.3 à 1.0
-      
-      if (strip != nullptr) {
-        // Calculer les composantes RGB avec l'effet de respiration
-        // Utiliser currentR/G/B qui contient la couleur avec transition progressive
-        uint8_t r = (uint8_t)(currentR * breatheFactor);
-        uint8_t g = (uint8_t)(currentG * breatheFactor);
-        uint8_t b = (uint8_t)(currentB * breatheFactor);
-        
-        // Appliquer la luminosité globale
-        r = (r * currentBrightness) / 255;
-        g = (g * currentBrightness) / 255;
-        b = (b * currentBrightness) / 255;
-        
-        uint32_t color = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
-        
-        // Appliquer la couleur à toutes les LEDs
-        for (int i = 0; i < NUM_LEDS; i++) {
-          strip->setPixelColor(i, color);
-        }
-      }
-      break;
+  }
+  return (uint16_t)level;
+}
+
+bool LEDManager::composeFrame(unsigned long now) {
+  const uint16_t level = masterLevel(now);
+  if (level > 0) {
+    updateEffects();
+  } else {
+    // Base invisible (sleep, fin de fondu) : pas de rendu de l'effet
+    for (int i = 0; i < NUM_LEDS; i++) {
+      framePixels[i] = 0;
     }
   }
+  return LEDCompositor::compose(framePixels, NUM_LEDS, level, now, strip);
 }
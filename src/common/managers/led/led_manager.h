@@ -3,12 +3,16 @@
 
 #include <Arduino.h>
 #include <cstdint>
+#include <atomic>
 #include <Adafruit_NeoPixel.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <freertos/queue.h>
 #include "models/model_config.h"
 #include "common/config/core_config.h"
+#include "common/utils/histogram.h"
+#include "led_output.h"
+#include "led_effects.h"
+#include "led_compositor.h"
 
 /**
  * Gestionnaire de LEDs dans un thread séparé (Core 1)
@@ -22,41 +26,27 @@
  * - Priorité élevée (PRIORITY_LED) pour des animations fluides
  */
 
-// Types de commandes pour le thread LED
-enum LEDCommandType {
-  LED_CMD_SET_COLOR,        // Définir une couleur RGB
-  LED_CMD_SET_BRIGHTNESS,   // Changer la luminosité
-  LED_CMD_SET_EFFECT,       // Activer un effet
-  LED_CMD_CLEAR,            // Éteindre toutes les LEDs
-  LED_CMD_TEST_SEQUENTIAL   // Test séquentiel des LEDs
-};
-
-// Types d'effets disponibles
-enum LEDEffect {
-  LED_EFFECT_NONE,          // Pas d'effet (couleur unie)
-  LED_EFFECT_RAINBOW,       // Arc-en-ciel
-  LED_EFFECT_PULSE,         // Pulsation
-  LED_EFFECT_PULSE_FAST,    // Pulsation rapide (feedback "pas de routine")
-  LED_EFFECT_GLOSSY,        // Effet glossy
-  LED_EFFECT_ROTATE,        // Effet de rotation (utilise la couleur définie)
-  LED_EFFECT_NIGHTLIGHT,    // Effet de veilleuse (vagues bleu/blanc)
-  LED_EFFECT_BREATHE,       // Effet de respiration avec changement de couleur
-  LED_EFFECT_RAINBOW_SOFT   // Arc-en-ciel doux (animation lente pour veilleuse)
-};
-
-// Structure de commande pour le thread LED
-struct LEDCommand {
-  LEDCommandType type;
-  union {
-    struct {
-      uint8_t r;
-      uint8_t g;
-      uint8_t b;
-    } color;
-    uint8_t brightness;
-    LEDEffect effect;
-  } data;
-};
+/**
+ * Boîte aux lettres des commandes (producteurs : MQTT, tactile, coucher...)
+ *
+ * Les setters ne mettent plus de commande en file : ils écrivent la dernière
+ * valeur demandée dans un emplacement atomique (couleur, luminosité, effet,
+ * calques), marquent le champ comme modifié et incrémentent un compteur de
+ * génération. Un producteur ne bloque jamais et une rafale (fondu de
+ * BedtimeManager, routes MQTT) ne perd rien : seule la dernière valeur de
+ * chaque champ compte.
+ *
+ * La tâche LED compare la génération à chaque tour, puis relit tous les
+ * emplacements d'un coup (relecture si une écriture s'est terminée pendant
+ * la lecture) et applique l'instantané dans un ordre fixe :
+ * clear, réveil/activité, sleep empêché/autorisé, fondu de sortie, test
+ * séquentiel, luminosité, effet, couleur, calques.
+ *
+ * Le réveil, l'activité (repousse le sleep mode), preventSleep/allowSleep et
+ * le fondu de sortie passent aussi par la boîte aux lettres : l'état du sleep
+ * mode et de l'effet (isSleeping, fondus, currentEffect...) n'est écrit que
+ * par la tâche LED.
+ */
 
 class LEDManager {
 public:
@@ -66,21 +56,35 @@ public:
   // Arrêter le gestionnaire (ne devrait jamais être appelé)
   static void stop();
   
-  // Envoyer une commande au thread LED
-  static bool sendCommand(const LEDCommand& cmd);
-  
   /** Convertir luminosité 0-100 vers 0-255 (arrondi correct) */
   static uint8_t brightnessPercentTo255(uint8_t percent);
 
-  // Méthodes pratiques pour envoyer des commandes
+  // Demandes au thread LED (non bloquantes, la dernière valeur l'emporte)
   static bool setColor(uint8_t r, uint8_t g, uint8_t b);
   static bool setBrightness(uint8_t brightness);
   static bool setEffect(LEDEffect effect);
   static bool clear();
   
-  // Gestion du sleep mode
+  /**
+   * Jouer une timeline de keyframes (effet TIMELINE), depuis le début même si
+   * une timeline est déjà en cours
+   * @return false si la timeline est invalide (voir LEDEffects::setTimeline)
+   */
+  static bool playTimeline(const LEDTimeline& timeline);
+  
+  /**
+   * Afficher un calque transitoire par-dessus l'effet courant pendant durationMs
+   * L'effet et la couleur de base continuent dessous et réapparaissent en fondu
+   * à la fin : rien à restaurer. Visible même en sleep mode.
+   * @param level Luminosité du calque (0-255), indépendante de setBrightness()
+   */
+  static bool showOverlay(LEDOverlayLayer layer, uint8_t r, uint8_t g, uint8_t b, uint8_t level,
+                          uint16_t durationMs, LEDOverlayShape shape = LED_OVERLAY_SOLID);
+  static bool clearOverlay(LEDOverlayLayer layer);
+  
+  // Gestion du sleep mode (demandes appliquées par la tâche LED au tour suivant)
   static void wakeUp();  // Réveiller les LEDs (reset du timer d'inactivité)
-  static bool getSleepState();  // Vérifier si les LEDs sont en mode sleep
+  static bool getSleepState();  // Vérifier si les LEDs sont en mode sleep (état du dernier tour)
   static void preventSleep();  // Empêcher le sleep mode (pour bedtime, etc.)
   static void allowSleep();  // Réautoriser le sleep mode
   
@@ -96,22 +100,85 @@ public:
   // Test des LEDs une par une
   static bool testLEDsSequential();  // Test séquentiel : allume chaque LED une par une puis toutes en rouge
 
+  // Intervalle minimum entre deux envois de trame (en ms)
+  // NeoPixel : 33ms = ~30 FPS, show() bloquant, évite les conflits avec I2S
+  // RMT : 16ms = ~60 FPS, l'envoi ne bloque ni la tâche ni les interruptions
+#if LED_OUTPUT_RMT
+  static constexpr unsigned long SHOW_INTERVAL_MS = 16;
+#else
+  static constexpr unsigned long SHOW_INTERVAL_MS = 33;
+#endif
+
+  // Durée des LEDOutput::show() en µs (NeoPixel : trame entière, interruptions
+  // coupées ; RMT : encodage de la trame seulement), trames envoyées seulement.
+  // resetShowStats() remet aussi à zéro LEDOutput::getStats() ; faite par la
+  // tâche LED (seule à écrire ces stats) au tour suivant
+  static const Log2Histogram& getShowStats();
+  static void resetShowStats();
+
 private:
   // Thread principal de gestion des LEDs
   static void ledTask(void* parameter);
   
-  // Traiter une commande reçue
-  static void processCommand(const LEDCommand& cmd);
+  // Champs modifiés dans la boîte aux lettres (bits de mailboxFlags)
+  enum MailboxFlag : uint32_t {
+    MAILBOX_COLOR           = 1u << 0,
+    MAILBOX_BRIGHTNESS      = 1u << 1,
+    MAILBOX_EFFECT          = 1u << 2,
+    MAILBOX_CLEAR           = 1u << 3,
+    MAILBOX_TEST_SEQUENTIAL = 1u << 4,
+    MAILBOX_WAKE            = 1u << 5,  // wakeUp() ; activité à activityTime
+    MAILBOX_ACTIVITY        = 1u << 6,  // Activité seule (calque visible)
+    MAILBOX_SLEEP_POLICY    = 1u << 7,  // preventSleep() / allowSleep()
+    MAILBOX_FADE_OUT        = 1u << 8,  // startFadeOutAndClear()
+    MAILBOX_RESET_STATS     = 1u << 9,  // resetShowStats()
+    MAILBOX_OVERLAY         = 1u << 10  // + layer (un bit par calque)
+  };
+  
+  // Instantané de la boîte aux lettres lu par la tâche LED
+  struct MailboxSnapshot {
+    uint32_t flags;
+    uint32_t color;
+    uint8_t brightness;
+    LEDEffect effect;
+    uint32_t activityTime;      // millis() de la dernière demande de réveil / activité
+    bool sleepPrevented;
+    uint32_t overlayColor[LED_OVERLAY_COUNT];   // 0xRRGGBBLL (LL = niveau)
+    uint32_t overlayParams[LED_OVERLAY_COUNT];  // durée (bits 0-15), forme (bits 16-23)
+  };
+  
+  // Publier les champs modifiés (après écriture des emplacements)
+  static void postMailbox(uint32_t flags);
   
-  // Appliquer les effets animés
+  // Noter l'instant de la demande (réveil, activité) avant postMailbox()
+  static void storeActivityTime();
+  
+  // Lire les champs modifiés depuis le dernier passage (false : rien de nouveau)
+  static bool readMailbox(MailboxSnapshot& snapshot);
+  
+  // Appliquer un instantané à l'état de la tâche LED
+  static void applyMailbox(const MailboxSnapshot& snapshot);
+  
+  // Dessiner le calque de base (effet courant ou couleur unie) dans la trame
   static void updateEffects();
   
+  // Assembler la trame (base, niveau maître, calques transitoires) dans la bande
+  // true si le tramage temporel demande un nouvel envoi
+  static bool composeFrame(unsigned long now);
+  
+  // Luminosité x fondu en cours (veille, réveil, extinction), niveau perçu sur 0-65535
+  static uint16_t masterLevel(unsigned long now);
+  
   // Gestion du sleep mode
   static void checkSleepMode();
   static void updateSleepFade();  // Animation de fade vers sleep
   static void updateWakeFade();  // Animation de fade depuis sleep
   static void updateFeedbackFadeOut();  // Fade-out progressif pour feedback (pas de routine)
-  static void resetPulseEffect();  // Réinitialiser l'effet PULSE pour transition fluide
+  static void startFadeOut(bool releaseSleep);  // Fondu vers noir puis clear
+  static void applyWakeUp(unsigned long activityTime);  // Réveil demandé par wakeUp()
+  static void noteActivity(unsigned long activityTime);  // Avancer lastActivityTime (jamais en arrière)
+  static void applySleepPolicy(bool prevented);  // preventSleep() / allowSleep()
+  static void resetEffect();  // Reprendre l'effet courant depuis t = 0 (transition fluide)
   
   // Utilitaire pour obtenir le nom d'un effet
   static const char* getEffectName(LEDEffect effect);
@@ -119,12 +186,10 @@ private:
   // Variables statiques
   static bool initialized;
   static TaskHandle_t taskHandle;
-  static QueueHandle_t commandQueue;
   static Adafruit_NeoPixel* strip;
   static uint8_t currentBrightness;
   static LEDEffect currentEffect;
   static uint32_t currentColor;  // Couleur au format RGB (0xRRGGBB)
-  static unsigned long lastUpdateTime;
   static unsigned long lastActivityTime;  // Dernière activité (pour sleep mode)
   static unsigned long rotateActivationTime;  // Temps d'activation de ROTATE pour désactivation auto
   static bool isSleeping;  // État du sleep mode
@@ -134,17 +199,28 @@ private:
   static LEDEffect savedEffect;  // Effet sauvegardé avant le sleep
   static uint32_t sleepTimeoutMs;  // Timeout configuré pour le sleep mode
   static bool sleepPrevented;  // Flag pour empêcher le sleep mode (bedtime, etc.)
-  static bool pulseNeedsReset;  // Flag pour réinitialiser l'effet PULSE
-  static bool rainbowNeedsReset;  // Flag pour réinitialiser l'effet RAINBOW
-  static bool rainbowSoftNeedsReset;  // Flag pour réinitialiser l'effet RAINBOW_SOFT
-  static bool rotateNeedsReset;  // Flag pour réinitialiser l'effet ROTATE
-  static bool nightlightNeedsReset;  // Flag pour réinitialiser l'effet NIGHTLIGHT
-  static bool breatheNeedsReset;  // Flag pour réinitialiser l'effet BREATHE
+  static bool effectNeedsReset;  // Appeler reset() de l'effet courant à la prochaine trame
+  static unsigned long effectStartTime;  // Dernier reset de l'effet courant (t = 0 de render)
   static bool hardwareInitialized;  // Init NeoPixel faite dans la tâche LED
+  static Log2Histogram showStats;
+  
+  // Boîte aux lettres (écrite par toutes les tâches, lue par la tâche LED)
+  static std::atomic<uint32_t> mailboxColor;
+  static std::atomic<uint32_t> mailboxBrightness;
+  static std::atomic<uint32_t> mailboxEffect;
+  static std::atomic<uint32_t> mailboxActivityTime;
+  static std::atomic<bool> mailboxSleepPrevented;
+  static std::atomic<uint32_t> mailboxOverlayColor[LED_OVERLAY_COUNT];
+  static std::atomic<uint32_t> mailboxOverlayParams[LED_OVERLAY_COUNT];
+  static std::atomic<uint32_t> mailboxFlags;
+  static std::atomic<uint32_t> mailboxGeneration;
+  static uint32_t mailboxSeenGeneration;  // Dernière génération lue (tâche LED)
+  static std::atomic<bool> publishedSleepState;  // isSleeping || isFadingToSleep, pour getSleepState()
   
   // Fade-out pour feedback (pas de routine)
   static bool feedbackFadeOutActive;
   static unsigned long feedbackFadeOutStartTime;
+  static bool feedbackFadeOutReleasesSleep;  // Réautoriser le sleep à la fin du fondu
   
   // Variables pour le test séquentiel
   static bool testSequentialActive;  // Test séquentiel en cours
@@ -152,11 +228,15 @@ private:
   static unsigned long testSequentialLastUpdate;  // Dernière mise à jour du test
 
   // Paramètres du thread (centralisés dans core_config.h)
-  static const int QUEUE_SIZE = 10;
+  static const int MAILBOX_READ_ATTEMPTS = 3;  // Relectures si une écriture se termine pendant la lecture
   static const int TASK_STACK_SIZE = STACK_SIZE_LED;
   static const int TASK_PRIORITY = PRIORITY_LED;
   static const int TASK_CORE = CORE_LED;  // Core 1 pour temps-réel
-  static const int UPDATE_INTERVAL_MS = 16;  // ~60 FPS pour les animations
+#if LED_OUTPUT_RMT
+  static const int LOOP_DELAY_MS = 4;  // Pas de boucle < 16ms : une trame toutes les 16ms
+#else
+  static const int LOOP_DELAY_MS = 5;
+#endif
 };
 
 #endif // LED_MANAGER_H
@@ -0,0 +1,123 @@
+#ifndef LED_MATH_H
+#define LED_MATH_H
+
+#include <stdint.h>
+
+/**
+ * Arithmétique entière pour les effets LED
+ *
+ * L'ESP32-C3 (Dream) n'a pas de FPU : un sin() en double y coûte plusieurs
+ * milliers de cycles en émulation logicielle. Les effets travaillent donc en
+ * virgule fixe :
+ * - phase sur 16 bits : 65536 = un tour (2π), calculée une fois par trame
+ *   depuis le temps puis incrémentée LED par LED
+ * - valeurs sur 8 bits : 255 = 1.0
+ */
+namespace LEDMath {
+
+// 128 + 127,5 * sin(2π i / 256), arrondi : 0 = -1, 255 = +1
+static const uint8_t SIN8_LUT[256] = {
+  128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+  176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+  218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+  245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+  255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+  245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+  218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+  176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+  128, 124, 121, 118, 115, 112, 109, 106, 103, 100,  97,  93,  90,  88,  85,  82,
+   79,  76,  73,  70,  67,  65,  62,  59,  57,  54,  52,  49,  47,  44,  42,  40,
+   37,  35,  33,  31,  29,  27,  25,  23,  21,  20,  18,  17,  15,  14,  12,  11,
+   10,   9,   7,   6,   5,   5,   4,   3,   2,   2,   1,   1,   1,   0,   0,   0,
+    0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   5,   5,   6,   7,   9,
+   10,  11,  12,  14,  15,  17,  18,  20,  21,  23,  25,  27,  29,  31,  33,  35,
+   37,  40,  42,  44,  47,  49,  52,  54,  57,  59,  62,  65,  67,  70,  73,  76,
+   79,  82,  85,  88,  90,  93,  97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+};
+
+/**
+ * Sinus décalé (0-255, 128 = 0) d'une phase 16 bits, interpolé entre deux
+ * entrées de la table pour garder des dégradés lisses au ralenti
+ */
+inline uint8_t sin8(uint16_t phase) {
+  const uint8_t i = phase >> 8;
+  const int a = SIN8_LUT[i];
+  const int b = SIN8_LUT[(uint8_t)(i + 1)];
+  return (uint8_t)(a + (((b - a) * (int)(phase & 0xFF)) >> 8));
+}
+
+/**
+ * v * s / 255 sans division (exact pour s = 0 et s = 255)
+ */
+inline uint8_t scale8(uint8_t v, uint8_t s) {
+  return (uint8_t)(((uint16_t)v * ((uint16_t)s + 1)) >> 8);
+}
+
+/**
+ * Phase 16 bits de elapsedMs dans un cycle de cycleMs (cycleMs < 65536)
+ */
+inline uint16_t phase16(uint32_t elapsedMs, uint32_t cycleMs) {
+  return (uint16_t)(((elapsedMs % cycleMs) << 16) / cycleMs);
+}
+
+/**
+ * Courbe ease-in-out t²(3 - 2t) sur t = 0-256 (256 = 1.0), résultat 0-256
+ */
+inline uint16_t smoothstep8(uint16_t t) {
+  return (uint16_t)(((uint32_t)t * t * (768 - 2 * t)) >> 16);
+}
+
+/**
+ * Couleur 0xRRGGBB avec chaque composante multipliée par s/255
+ */
+inline uint32_t scaleColor(uint32_t color, uint8_t s) {
+  return ((uint32_t)scale8((color >> 16) & 0xFF, s) << 16) |
+         ((uint32_t)scale8((color >> 8) & 0xFF, s) << 8) |
+         scale8(color & 0xFF, s);
+}
+
+// Niveau perçu -> niveau PWM : 257 + (65535 - 257) x (i / 256)^2,2 arrondi,
+// i = 0-256. Tout niveau non nul vaut au moins un pas 8 bits (257) : une
+// luminosité configurée faible reste visible au lieu d'être arrondie à noir
+static const uint16_t GAMMA16_LUT[257] = {
+      0,   257,   259,   261,   264,   268,   274,   281,   289,   298,   309,   321,
+    335,   350,   366,   384,   403,   424,   447,   471,   496,   523,   552,   582,
+    614,   648,   683,   720,   759,   799,   841,   885,   930,   977,  1026,  1077,
+   1129,  1183,  1239,  1297,  1356,  1418,  1481,  1546,  1613,  1682,  1752,  1825,
+   1899,  1975,  2053,  2133,  2215,  2299,  2385,  2472,  2562,  2653,  2747,  2842,
+   2940,  3039,  3140,  3244,  3349,  3456,  3566,  3677,  3790,  3905,  4023,  4142,
+   4264,  4387,  4512,  4640,  4770,  4901,  5035,  5171,  5309,  5449,  5591,  5735,
+   5881,  6029,  6180,  6332,  6487,  6644,  6803,  6964,  7127,  7293,  7460,  7630,
+   7802,  7976,  8152,  8330,  8511,  8693,  8878,  9065,  9254,  9446,  9639,  9835,
+  10033, 10233, 10436, 10641, 10848, 11057, 11268, 11482, 11698, 11916, 12136, 12359,
+  12583, 12811, 13040, 13272, 13505, 13742, 13980, 14221, 14464, 14709, 14957, 15207,
+  15459, 15714, 15970, 16230, 16491, 16755, 17021, 17289, 17560, 17833, 18108, 18386,
+  18666, 18949, 19233, 19521, 19810, 20102, 20396, 20693, 20992, 21293, 21597, 21903,
+  22211, 22522, 22835, 23151, 23468, 23789, 24112, 24437, 24764, 25094, 25427, 25761,
+  26099, 26438, 26780, 27125, 27472, 27821, 28173, 28527, 28883, 29242, 29604, 29968,
+  30334, 30703, 31074, 31448, 31824, 32203, 32584, 32968, 33354, 33742, 34133, 34527,
+  34923, 35321, 35722, 36126, 36532, 36940, 37351, 37764, 38180, 38599, 39020, 39443,
+  39869, 40297, 40728, 41162, 41598, 42036, 42477, 42921, 43367, 43816, 44267, 44720,
+  45177, 45636, 46097, 46561, 47027, 47496, 47968, 48442, 48918, 49398, 49879, 50364,
+  50851, 51340, 51832, 52327, 52824, 53324, 53826, 54331, 54838, 55349, 55861, 56377,
+  56894, 57415, 57938, 58464, 58992, 59523, 60056, 60592, 61131, 61672, 62216, 62763,
+  63312, 63864, 64418, 64975, 65535,
+};
+
+/**
+ * Correction gamma d'un niveau perçu 16 bits (0-65535) vers le niveau
+ * linéaire envoyé à la bande, interpolée entre deux entrées de la table
+ * (une division : à appeler une fois par trame, pas par pixel)
+ */
+inline uint16_t gamma16(uint16_t level) {
+  const uint32_t pos = ((uint32_t)level << 16) / 65535;  // 0-65536, 256 = une entrée
+  const uint32_t i = pos >> 8;
+  if (i >= 256) return GAMMA16_LUT[256];
+  const uint32_t a = GAMMA16_LUT[i];
+  const uint32_t b = GAMMA16_LUT[i + 1];
+  return (uint16_t)(a + (((b - a) * (pos & 0xFF)) >> 8));
+}
+
+} // namespace LEDMath
+
+#endif // LED_MATH_H
@@ -0,0 +1,202 @@
+#include "led_output.h"
+#include "common/managers/log/log_manager.h"
+
+#if LED_OUTPUT_RMT
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+#include <driver/rmt_tx.h>
+#else
+#include <driver/rmt.h>
+#endif
+
+namespace {
+
+// WS2812 : un bit = 1,25 µs ; horloge RMT 40 MHz (25 ns par tick)
+constexpr uint32_t RMT_RESOLUTION_HZ = 40000000;
+constexpr uint16_t T0H_TICKS = 16;  // 0,40 µs
+constexpr uint16_t T0L_TICKS = 34;  // 0,85 µs
+constexpr uint16_t T1H_TICKS = 32;  // 0,80 µs
+constexpr uint16_t T1L_TICKS = 18;  // 0,45 µs
+
+constexpr uint32_t FRAME_BYTES = NUM_LEDS * 3;
+constexpr uint32_t FRAME_US = NUM_LEDS * 30;  // 24 bits x 1,25 µs par LED
+constexpr uint32_t LATCH_US = 300;            // Niveau bas de fin de trame (> 280 µs sur WS2812B récentes)
+constexpr uint32_t TX_TIMEOUT_MS = 10;
+
+bool rmtReady = false;
+bool txPending = false;
+uint32_t lastTxStartUs = 0;
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+rmt_channel_handle_t channel = nullptr;
+rmt_encoder_handle_t encoder = nullptr;
+// Le bytes encoder lit le payload depuis l'ISR pendant l'envoi : on envoie
+// une copie pour que les effets puissent redessiner la trame suivante
+uint8_t txBuffer[FRAME_BYTES];
+#else
+constexpr rmt_channel_t CHANNEL = RMT_CHANNEL_0;
+// Symboles (niveau haut puis bas) au format rmt_item32_t
+constexpr uint32_t ITEM_BIT0 = T0H_TICKS | (1u << 15) | ((uint32_t)T0L_TICKS << 16);
+constexpr uint32_t ITEM_BIT1 = T1H_TICKS | (1u << 15) | ((uint32_t)T1L_TICKS << 16);
+// Trame pré-encodée (8 symboles par octet), lue par l'ISR RMT pendant l'envoi
+rmt_item32_t items[FRAME_BYTES * 8];
+#endif
+
+// Attendre la fin de la trame précédente et le temps de latch
+bool waitTxDone() {
+  if (!txPending) return true;
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+  if (rmt_tx_wait_all_done(channel, TX_TIMEOUT_MS) != ESP_OK) return false;
+#else
+  if (rmt_wait_tx_done(CHANNEL, pdMS_TO_TICKS(TX_TIMEOUT_MS)) != ESP_OK) return false;
+#endif
+  txPending = false;
+
+  // N'attend que si deux show() se suivent à moins d'une trame (test séquentiel)
+  const uint32_t elapsed = micros() - lastTxStartUs;
+  if (elapsed < FRAME_US + LATCH_US) {
+    delayMicroseconds(FRAME_US + LATCH_US - elapsed);
+  }
+  return true;
+}
+
+} // namespace
+#endif // LED_OUTPUT_RMT
+
+uint8_t* LEDOutput::lastFrame = nullptr;
+uint16_t LEDOutput::frameBytes = 0;
+bool LEDOutput::lastFrameValid = false;
+uint32_t LEDOutput::lastSendMs = 0;
+LEDOutput::Stats LEDOutput::stats = {};
+
+bool LEDOutput::begin(Adafruit_NeoPixel* strip) {
+  // Copie de comparaison (pas de suppression des trames identiques si l'allocation échoue)
+  if (strip != nullptr && lastFrame == nullptr && strip->numPixels() > 0) {
+    frameBytes = strip->numPixels() * 3;
+    lastFrame = (uint8_t*)malloc(frameBytes);
+    lastFrameValid = false;
+  }
+
+#if LED_OUTPUT_RMT
+  if (rmtReady) return true;
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+  rmt_tx_channel_config_t chCfg = {};
+  chCfg.gpio_num = (gpio_num_t)LED_DATA_PIN;
+  chCfg.clk_src = RMT_CLK_SRC_DEFAULT;
+  chCfg.resolution_hz = RMT_RESOLUTION_HZ;
+  chCfg.mem_block_symbols = 96;  // 2 blocs de 48 : moins d'interruptions de recharge
+  chCfg.trans_queue_depth = 1;
+
+  rmt_bytes_encoder_config_t encCfg = {};
+  encCfg.bit0.level0 = 1;
+  encCfg.bit0.duration0 = T0H_TICKS;
+  encCfg.bit0.level1 = 0;
+  encCfg.bit0.duration1 = T0L_TICKS;
+  encCfg.bit1.level0 = 1;
+  encCfg.bit1.duration0 = T1H_TICKS;
+  encCfg.bit1.level1 = 0;
+  encCfg.bit1.duration1 = T1L_TICKS;
+  encCfg.flags.msb_first = 1;
+
+  if (rmt_new_tx_channel(&chCfg, &channel) != ESP_OK ||
+      rmt_new_bytes_encoder(&encCfg, &encoder) != ESP_OK ||
+      rmt_enable(channel) != ESP_OK) {
+    LogManager::error("[LED] RMT indisponible, repli sur NeoPixel show()");
+    return false;
+  }
+#else
+  rmt_config_t cfg = RMT_DEFAULT_CONFIG_TX((gpio_num_t)LED_DATA_PIN, CHANNEL);
+  cfg.clk_div = 80000000 / RMT_RESOLUTION_HZ;
+  cfg.mem_block_num = 2;  // 2 blocs : moins d'interruptions de recharge
+
+  if (rmt_config(&cfg) != ESP_OK || rmt_driver_install(CHANNEL, 0, 0) != ESP_OK) {
+    LogManager::error("[LED] RMT indisponible, repli sur NeoPixel show()");
+    return false;
+  }
+#endif
+
+  rmtReady = true;
+  LogManager::info("[LED] Sortie RMT active (%d LEDs, trame %lu us)", NUM_LEDS, (unsigned long)FRAME_US);
+#endif
+  return true;
+}
+
+bool LEDOutput::show(Adafruit_NeoPixel* strip) {
+  if (strip == nullptr) return false;
+
+  const uint32_t now = millis();
+  const uint8_t* pixels = strip->getPixels();
+  if (lastFrame != nullptr && lastFrameValid && now - lastSendMs < REFRESH_MS &&
+      memcmp(pixels, lastFrame, frameBytes) == 0) {
+    stats.suppressed++;
+    return false;
+  }
+
+  if (!transmit(strip)) return false;
+
+  if (lastFrame != nullptr) {
+    memcpy(lastFrame, pixels, frameBytes);
+    lastFrameValid = true;
+  }
+  lastSendMs = now;
+  stats.sent++;
+  return true;
+}
+
+bool LEDOutput::transmit(Adafruit_NeoPixel* strip) {
+#if LED_OUTPUT_RMT
+  if (rmtReady) {
+    if (!waitTxDone()) {
+      // RMT bloqué : abandonner cette trame, la suivante réessaiera
+      LogManager::warning("[LED] RMT: trame precedente non terminee");
+      return false;
+    }
+
+    // Buffer Adafruit : déjà dans l'ordre du fil (GRB) et luminosité appliquée
+    const uint8_t* pixels = strip->getPixels();
+
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    memcpy(txBuffer, pixels, FRAME_BYTES);
+    rmt_transmit_config_t txCfg = {};
+    if (rmt_transmit(channel, encoder, txBuffer, FRAME_BYTES, &txCfg) != ESP_OK) return false;
+#else
+    rmt_item32_t* item = items;
+    for (uint32_t i = 0; i < FRAME_BYTES; i++) {
+      const uint8_t value = pixels[i];
+      for (uint8_t mask = 0x80; mask; mask >>= 1) {
+        (item++)->val = (value & mask) ? ITEM_BIT1 : ITEM_BIT0;
+      }
+    }
+    if (rmt_write_items(CHANNEL, items, FRAME_BYTES * 8, false) != ESP_OK) return false;
+#endif
+
+    txPending = true;
+    lastTxStartUs = micros();
+    return true;
+  }
+#endif
+
+  strip->show();
+  return true;
+}
+
+bool LEDOutput::isAsync() {
+#if LED_OUTPUT_RMT
+  return rmtReady;
+#else
+  return false;
+#endif
+}
+
+const char* LEDOutput::getName() {
+  return isAsync() ? "RMT" : "NeoPixel";
+}
+
+const LEDOutput::Stats& LEDOutput::getStats() {
+  return stats;
+}
+
+void LEDOutput::resetStats() {
+  stats = {};
+}
@@ -0,0 +1,80 @@
+#ifndef LED_OUTPUT_H
+#define LED_OUTPUT_H
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "models/model_config.h"
+
+/**
+ * Sortie matérielle de la bande WS2812 pour LEDManager
+ *
+ * Le buffer de pixels reste celui d'Adafruit_NeoPixel (setPixelColor,
+ * setBrightness) ; seul l'envoi sur le fil change selon LED_OUTPUT_RMT
+ * (config.h du modèle) :
+ *
+ * - false : strip->show() d'Adafruit, bloquant pendant toute la trame
+ *   (~30 µs par LED) avec les interruptions perturbées -> plafonné à ~30 FPS
+ *   pour ne pas faire grésiller l'I2S
+ * - true  : la trame est encodée en symboles RMT puis envoyée par le
+ *   périphérique RMT ; show() rend la main tout de suite, les interruptions
+ *   restent actives et les effets peuvent tourner à 60 FPS
+ *
+ * Le pilote RMT est installé depuis la tâche LED (begin) pour que son
+ * interruption tourne sur CORE_LED.
+ *
+ * Une trame identique à la dernière envoyée n'est pas retransmise (couleur
+ * unie, plateau de respiration, RAINBOW_SOFT qui avance d'une teinte toutes
+ * les ~100 ms) ; un renvoi est forcé toutes les REFRESH_MS pour corriger une
+ * LED perturbée par un parasite.
+ */
+
+#ifndef LED_OUTPUT_RMT
+#define LED_OUTPUT_RMT false
+#endif
+
+class LEDOutput {
+public:
+  static constexpr uint32_t REFRESH_MS = 1000;
+
+  struct Stats {
+    uint32_t sent;        // Trames transmises à la bande
+    uint32_t suppressed;  // Trames identiques à la précédente, non transmises
+  };
+
+  /**
+   * Initialiser la sortie (à appeler depuis la tâche LED, après strip->begin())
+   * @return false si le canal RMT n'a pas pu être installé (repli sur
+   *         strip->show())
+   */
+  static bool begin(Adafruit_NeoPixel* strip);
+
+  /**
+   * Envoyer le contenu du buffer de la bande
+   * En RMT : attend au plus la fin de la trame précédente (< 1 ms pour
+   * 30 LEDs) puis rend la main pendant l'envoi
+   * @return false si rien n'a été transmis (trame inchangée ou RMT occupé)
+   */
+  static bool show(Adafruit_NeoPixel* strip);
+
+  /**
+   * true si show() ne bloque pas pendant l'envoi (sortie RMT active)
+   */
+  static bool isAsync();
+
+  static const char* getName();
+
+  static const Stats& getStats();
+  // Depuis la tâche qui appelle show() (LEDManager::resetShowStats() la lui confie)
+  static void resetStats();
+
+private:
+  static bool transmit(Adafruit_NeoPixel* strip);
+
+  static uint8_t* lastFrame;  // Copie de la dernière trame envoyée (ordre du fil)
+  static uint16_t frameBytes;
+  static bool lastFrameValid;
+  static uint32_t lastSendMs;
+  static Stats stats;
+};
+
+#endif // LED_OUTPUT_H
@@ -1,15 +1,307 @@
 #include "log_manager.h"
 #include "../sd/sd_manager.h"
+#include "common/config/core_config.h"
 #include <SD.h>
+#include <atomic>
 #include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 
+namespace {
+
+// Enregistrement de la file : format + arguments bruts, formaté par LogTask
+const size_t RECORD_PAYLOAD_SIZE = 112;
+const uint32_t QUEUE_SLOTS = 64;  // Puissance de 2 (64 x 128 octets)
+
+struct LogRecord {
+  const char* format;   // Chaîne littérale de l'appelant
+  uint32_t timestampMs;
+  uint8_t level;
+  uint8_t size;         // Octets utilisés dans payload
+  uint8_t payload[RECORD_PAYLOAD_SIZE];
+};
+
+// File bornée multi-producteurs / un consommateur (algorithme de Vyukov) :
+// un producteur réserve une case par compare-exchange sur enqueuePos, la
+// remplit puis la publie via sequence ; LogTask lit les cases dans l'ordre
+struct LogSlot {
+  std::atomic<uint32_t> sequence;
+  LogRecord record;
+};
+
+LogSlot slots[QUEUE_SLOTS];
+std::atomic<uint32_t> enqueuePos(0);
+std::atomic<uint32_t> dequeuePos(0);  // Écrit par LogTask uniquement
+std::atomic<uint32_t> outputPos(0);   // Enregistrements écrits (Serial/SD) par LogTask
+std::atomic<uint32_t> droppedCount(0);
+std::atomic<uint32_t> pendingDropped(0);
+
+// Taille des arguments entiers selon le modificateur de longueur
+enum ArgLength { ARG_INT, ARG_LONG, ARG_LLONG, ARG_SIZE, ARG_INTMAX, ARG_PTRDIFF };
+
+enum ArgKind { ARG_KIND_INT, ARG_KIND_DOUBLE, ARG_KIND_POINTER, ARG_KIND_STRING, ARG_KIND_PERCENT };
+
+// Une conversion printf ("%-08.3lx") découpée une seule fois, à l'écriture
+// comme à la lecture, pour que les deux côtés consomment les mêmes octets
+struct FormatSpec {
+  const char* start;
+  uint8_t length;
+  ArgKind kind;
+  ArgLength argLength;
+};
+
+const uint8_t MAX_SPEC_LENGTH = 15;
+
+// p pointe sur '%' ; false si la conversion n'est pas gérée en différé
+bool parseSpec(const char* p, FormatSpec& spec) {
+  spec.start = p++;
+  while (*p && strchr("-+ #0", *p)) p++;
+  while (*p >= '0' && *p <= '9') p++;
+  if (*p == '.') {
+    p++;
+    while (*p >= '0' && *p <= '9') p++;
+  }
+  spec.argLength = ARG_INT;
+  if (*p == 'h') {
+    p++;
+    if (*p == 'h') p++;
+  } else if (*p == 'l') {
+    p++;
+    spec.argLength = ARG_LONG;
+    if (*p == 'l') {
+      p++;
+      spec.argLength = ARG_LLONG;
+    }
+  } else if (*p == 'z') {
+    p++;
+    spec.argLength = ARG_SIZE;
+  } else if (*p == 'j') {
+    p++;
+    spec.argLength = ARG_INTMAX;
+  } else if (*p == 't') {
+    p++;
+    spec.argLength = ARG_PTRDIFF;
+  }
+  const char conversion = *p;
+  if (conversion == '\0') return false;
+  spec.length = (uint8_t)(p + 1 - spec.start);
+  if (spec.length > MAX_SPEC_LENGTH) return false;
+  
+  switch (conversion) {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+      spec.kind = ARG_KIND_INT;
+      return true;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      spec.kind = ARG_KIND_DOUBLE;
+      return spec.argLength == ARG_INT || spec.argLength == ARG_LONG;
+    case 'p':
+      spec.kind = ARG_KIND_POINTER;
+      return true;
+    case 's':
+      spec.kind = ARG_KIND_STRING;
+      return spec.argLength == ARG_INT;
+    case '%':
+      spec.kind = ARG_KIND_PERCENT;
+      return true;
+    default:
+      return false;  // %*d, %n, %Lf, %ls...
+  }
+}
+
+size_t intArgSize(ArgLength length) {
+  switch (length) {
+    case ARG_LONG: return sizeof(long);
+    case ARG_LLONG: return sizeof(long long);
+    case ARG_SIZE: return sizeof(size_t);
+    case ARG_INTMAX: return sizeof(intmax_t);
+    case ARG_PTRDIFF: return sizeof(ptrdiff_t);
+    default: return sizeof(int);
+  }
+}
+
+// Copier les arguments bruts dans record.payload ; false si ça ne tient pas
+bool encodeRecord(LogRecord& record, const char* format, va_list args) {
+  size_t used = 0;
+  for (const char* p = format; *p; p++) {
+    if (*p != '%') continue;
+    FormatSpec spec;
+    if (!parseSpec(p, spec)) return false;
+    p += spec.length - 1;
+    
+    union {
+      int i;
+      long l;
+      long long ll;
+      size_t z;
+      intmax_t j;
+      ptrdiff_t t;
+      double d;
+      const void* ptr;
+    } value;
+    size_t size = 0;
+    switch (spec.kind) {
+      case ARG_KIND_PERCENT:
+        continue;
+      case ARG_KIND_STRING: {
+        const char* str = va_arg(args, const char*);
+        if (str == nullptr) str = "(null)";
+        const size_t len = strlen(str) + 1;
+        if (used + len > RECORD_PAYLOAD_SIZE) return false;
+        memcpy(record.payload + used, str, len);
+        used += len;
+        continue;
+      }
+      case ARG_KIND_DOUBLE:
+        value.d = va_arg(args, double);
+        size = sizeof(double);
+        break;
+      case ARG_KIND_POINTER:
+        value.ptr = va_arg(args, const void*);
+        size = sizeof(const void*);
+        break;
+      case ARG_KIND_INT:
+        switch (spec.argLength) {
+          case ARG_LONG: value.l = va_arg(args, long); break;
+          case ARG_LLONG: value.ll = va_arg(args, long long); break;
+          case ARG_SIZE: value.z = va_arg(args, size_t); break;
+          case ARG_INTMAX: value.j = va_arg(args, intmax_t); break;
+          case ARG_PTRDIFF: value.t = va_arg(args, ptrdiff_t); break;
+          default: value.i = va_arg(args, int); break;
+        }
+        size = intArgSize(spec.argLength);
+        break;
+    }
+    if (used + size > RECORD_PAYLOAD_SIZE) return false;
+    memcpy(record.payload + used, &value, size);
+    used += size;
+  }
+  record.size = (uint8_t)used;
+  return true;
+}
+
+// Reformater un enregistrement (LogTask) : une conversion à la fois
+void decodeRecord(const LogRecord& record, char* out, size_t outSize) {
+  size_t pos = 0;
+  size_t used = 0;
+  for (const char* p = record.format; *p && pos + 1 < outSize; p++) {
+    if (*p != '%') {
+      out[pos++] = *p;
+      continue;
+    }
+    FormatSpec spec;
+    parseSpec(p, spec);  // Déjà validé par encodeRecord
+    p += spec.length - 1;
+    
+    char fmt[MAX_SPEC_LENGTH + 1];
+    memcpy(fmt, spec.start, spec.length);
+    fmt[spec.length] = '\0';
+    
+    const uint8_t* arg = record.payload + used;
+    const size_t room = outSize - pos;
+    int written = 0;
+    switch (spec.kind) {
+      case ARG_KIND_PERCENT:
+        written = snprintf(out + pos, room, "%%");
+        break;
+      case ARG_KIND_STRING: {
+        const char* str = (const char*)arg;
+        written = snprintf(out + pos, room, fmt, str);
+        used += strlen(str) + 1;
+        break;
+      }
+      case ARG_KIND_DOUBLE: {
+        double d;
+        memcpy(&d, arg, sizeof(d));
+        written = snprintf(out + pos, room, fmt, d);
+        used += sizeof(d);
+        break;
+      }
+      case ARG_KIND_POINTER: {
+        const void* ptr;
+        memcpy(&ptr, arg, sizeof(ptr));
+        written = snprintf(out + pos, room, fmt, ptr);
+        used += sizeof(ptr);
+        break;
+      }
+      case ARG_KIND_INT:
+        switch (spec.argLength) {
+          case ARG_LONG: { long v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+          case ARG_LLONG: { long long v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+          case ARG_SIZE: { size_t v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+          case ARG_INTMAX: { intmax_t v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+          case ARG_PTRDIFF: { ptrdiff_t v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+          default: { int v; memcpy(&v, arg, sizeof(v)); written = snprintf(out + pos, room, fmt, v); break; }
+        }
+        used += intArgSize(spec.argLength);
+        break;
+    }
+    if (written > 0) {
+      pos += (size_t)written < room ? (size_t)written : room - 1;
+    }
+  }
+  out[pos] = '\0';
+}
+
+// Réserver une case, y copier l'enregistrement et la publier ; false si pleine
+bool pushRecord(const LogRecord& record) {
+  uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+  LogSlot* slot;
+  while (true) {
+    slot = &slots[pos & (QUEUE_SLOTS - 1)];
+    const uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    const int32_t diff = (int32_t)(sequence - pos);
+    if (diff == 0) {
+      if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // Case pas encore libérée par LogTask : file pleine
+    } else {
+      pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+  // En-tête + octets utilisés seulement
+  memcpy(&slot->record, &record, offsetof(LogRecord, payload) + record.size);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+// LogTask : prochain enregistrement publié ; false si la file est vide
+bool popRecord(LogRecord& record) {
+  const uint32_t pos = dequeuePos.load(std::memory_order_relaxed);
+  LogSlot& slot = slots[pos & (QUEUE_SLOTS - 1)];
+  if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+    return false;
+  }
+  memcpy(&record, &slot.record, offsetof(LogRecord, payload) + slot.record.size);
+  slot.sequence.store(pos + QUEUE_SLOTS, std::memory_order_release);
+  dequeuePos.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+const char* levelPrefix(LogLevel level) {
+  switch (level) {
+    case LOG_LEVEL_DEBUG: return "[DEBUG]";
+    case LOG_LEVEL_WARNING: return "[WARNING]";
+    case LOG_LEVEL_ERROR: return "[ERROR]";
+    default: return "[INFO]";
+  }
+}
+
+} // namespace
+
 // Variables statiques
 bool LogManager::initialized = false;
 LogLevel LogManager::currentLogLevel = LOG_LEVEL_INFO;
 bool LogManager::sdLoggingEnabled = true;
 const char* LogManager::ERROR_LOG_FILE = "/error_log.txt";
 const size_t LogManager::MAX_LOG_LINE_SIZE = 512;
+TaskHandle_t LogManager::taskHandle = nullptr;
+const int LogManager::TASK_STACK_SIZE = STACK_SIZE_LOG;
+const int LogManager::TASK_PRIORITY = PRIORITY_LOG;
+const int LogManager::TASK_CORE = CORE_LOG;
 
 void LogManager::init() {
   if (initialized) {
@@ -27,6 +319,31 @@ void LogManager::init() {
       Serial.println("[LOG] SD non disponible, logging sur SD desactive");
     }
   }
+  
+  // File vide : chaque case attend la position qui lui correspond
+  for (uint32_t i = 0; i < QUEUE_SLOTS; i++) {
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  enqueuePos.store(0, std::memory_order_relaxed);
+  dequeuePos.store(0, std::memory_order_relaxed);
+  outputPos.store(0, std::memory_order_relaxed);
+  
+  // Sans tâche, les messages restent écrits directement par l'appelant
+  BaseType_t result = xTaskCreatePinnedToCore(
+    logTask,
+    "LogTask",
+    TASK_STACK_SIZE,
+    nullptr,
+    TASK_PRIORITY,
+    &taskHandle,
+    TASK_CORE
+  );
+  if (result != pdPASS) {
+    taskHandle = nullptr;
+    if (Serial) {
+      Serial.println("[LOG] Creation task echouee, ecriture directe");
+    }
+  }
 }
 
 void LogManager::setLogLevel(LogLevel level) {
@@ -44,7 +361,7 @@ void LogManager::debug(const char* format, ...) {
   
   va_list args;
   va_start(args, format);
-  log(LOG_LEVEL_DEBUG, "[DEBUG]", format, args);
+  write(LOG_LEVEL_DEBUG, format, args);
   va_end(args);
 }
 
@@ -55,7 +372,7 @@ void LogManager::info(const char* format, ...) {
   
   va_list args;
   va_start(args, format);
-  log(LOG_LEVEL_INFO, "[INFO]", format, args);
+  write(LOG_LEVEL_INFO, format, args);
   va_end(args);
 }
 
@@ -66,7 +383,7 @@ void LogManager::warning(const char* format, ...) {
   
   va_list args;
   va_start(args, format);
-  log(LOG_LEVEL_WARNING, "[WARNING]", format, args);
+  write(LOG_LEVEL_WARNING, format, args);
   va_end(args);
 }
 
@@ -77,44 +394,111 @@ void LogManager::error(const char* format, ...) {
   
   va_list args;
   va_start(args, format);
-  char message[MAX_LOG_LINE_SIZE];
-  vsnprintf(message, MAX_LOG_LINE_SIZE, format, args);
+  write(LOG_LEVEL_ERROR, format, args);
   va_end(args);
+}
+
+void LogManager::write(LogLevel level, const char* format, va_list args) {
+  const uint32_t timestampMs = millis();
   
-  // Afficher sur Serial
-  va_list args2;
-  va_start(args2, format);
-  log(LOG_LEVEL_ERROR, "[ERROR]", format, args2);
-  va_end(args2);
+  if (taskHandle != nullptr) {
+    LogRecord record;
+    record.format = format;
+    record.timestampMs = timestampMs;
+    record.level = (uint8_t)level;
+    
+    va_list copy;
+    va_copy(copy, args);
+    const bool encoded = encodeRecord(record, format, copy);
+    va_end(copy);
+    
+    if (encoded) {
+      if (pushRecord(record)) {
+        return;
+      }
+      // File pleine : ne jamais attendre LogTask. Une erreur (SD) n'est pas
+      // abandonnée : elle est écrite directement
+      if (level != LOG_LEVEL_ERROR) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        pendingDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
   
-  // Écrire sur SD si activé
-  if (sdLoggingEnabled) {
-    writeErrorToSD(message);
+  // Écriture directe (avant LogTask, message trop long, conversion non gérée,
+  // erreur avec file pleine)
+  if (!Serial && !(level == LOG_LEVEL_ERROR && sdLoggingEnabled)) {
+    return;
   }
+  char buffer[MAX_LOG_LINE_SIZE];
+  vsnprintf(buffer, MAX_LOG_LINE_SIZE, format, args);
+  output(level, timestampMs, buffer);
 }
 
-void LogManager::log(LogLevel level, const char* prefix, const char* format, va_list args) {
-  if (!Serial) {
-    return;
-  }
-  
+void LogManager::output(LogLevel level, uint32_t timestampMs, const char* message) {
   // Formater le timestamp
   char timestamp[32];
-  formatTimestamp(timestamp, sizeof(timestamp));
+  formatTimestamp(timestampMs, timestamp, sizeof(timestamp));
   
-  // Afficher le timestamp et le préfixe
-  Serial.print(timestamp);
-  Serial.print(" ");
-  Serial.print(prefix);
-  Serial.print(" ");
+  if (Serial) {
+    // Afficher le timestamp, le préfixe et le message
+    Serial.print(timestamp);
+    Serial.print(" ");
+    Serial.print(levelPrefix(level));
+    Serial.print(" ");
+    Serial.println(message);
+  }
   
-  // Formater et afficher le message
-  char buffer[MAX_LOG_LINE_SIZE];
-  vsnprintf(buffer, MAX_LOG_LINE_SIZE, format, args);
-  Serial.println(buffer);
+  // Écrire sur SD si activé
+  if (level == LOG_LEVEL_ERROR && sdLoggingEnabled) {
+    writeErrorToSD(timestamp, message);
+  }
+}
+
+void LogManager::logTask(void* parameter) {
+  (void)parameter;
+
+  char line[MAX_LOG_LINE_SIZE];
+  LogRecord record;
+  
+  while (true) {
+    // Messages perdus depuis le dernier passage : le signaler à leur place
+    const uint32_t dropped = pendingDropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+      snprintf(line, sizeof(line), "[LOG] %lu message(s) perdu(s) (file pleine)", (unsigned long)dropped);
+      output(LOG_LEVEL_WARNING, millis(), line);
+    }
+    
+    while (popRecord(record)) {
+      decodeRecord(record, line, sizeof(line));
+      output((LogLevel)record.level, record.timestampMs, line);
+      outputPos.store(outputPos.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    
+    vTaskDelay(pdMS_TO_TICKS(LOOP_DELAY_MS));
+  }
+}
+
+void LogManager::flush(uint32_t timeoutMs) {
+  if (taskHandle == nullptr || xTaskGetCurrentTaskHandle() == taskHandle) {
+    return;
+  }
+  const unsigned long start = millis();
+  // Vide quand LogTask a écrit toutes les cases réservées (pas seulement lues)
+  while (enqueuePos.load(std::memory_order_relaxed) != outputPos.load(std::memory_order_acquire)) {
+    if (millis() - start >= timeoutMs) {
+      return;
+    }
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
 }
 
-void LogManager::writeErrorToSD(const char* message) {
+uint32_t LogManager::getDroppedCount() {
+  return droppedCount.load(std::memory_order_relaxed);
+}
+
+void LogManager::writeErrorToSD(const char* timestamp, const char* message) {
   if (!SDManager::isAvailable()) {
     return;
   }
@@ -129,10 +513,6 @@ void LogManager::writeErrorToSD(const char* message) {
     }
   }
   
-  // Formater le timestamp
-  char timestamp[32];
-  formatTimestamp(timestamp, sizeof(timestamp));
-  
   // Écrire la ligne de log
   logFile.print(timestamp);
   logFile.print(" [ERROR] ");
@@ -141,8 +521,8 @@ void LogManager::writeErrorToSD(const char* message) {
   logFile.close();
 }
 
-void LogManager::formatTimestamp(char* buffer, size_t bufferSize) {
-  unsigned long ms = millis();
+void LogManager::formatTimestamp(uint32_t timestampMs, char* buffer, size_t bufferSize) {
+  unsigned long ms = timestampMs;
   unsigned long seconds = ms / 1000;
   unsigned long minutes = seconds / 60;
   unsigned long hours = minutes / 60;
@@ -2,6 +2,9 @@
 #define LOG_MANAGER_H
 
 #include <Arduino.h>
+#include <cstdarg>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 /**
  * Gestionnaire de logs avec écriture sur Serial et SD
@@ -10,6 +13,18 @@
  * - INFO : Affiché sur Serial uniquement
  * - DEBUG : Affiché sur Serial uniquement (si activé)
  * - ERROR : Affiché sur Serial ET écrit dans un fichier sur la SD
+ *
+ * Écriture différée : l'appelant ne formate rien et n'attend pas l'UART.
+ * debug/info/warning/error copient le pointeur de format, l'heure et les
+ * arguments bruts (chaînes %s recopiées) dans un enregistrement d'un buffer
+ * circulaire multi-producteurs sans verrou. La tâche LogTask (basse
+ * priorité) formate puis écrit sur Serial et la SD.
+ * - File pleine : le message est abandonné (jamais d'attente), le nombre
+ *   de messages perdus est signalé au message suivant ; une erreur est
+ *   écrite directement
+ * - Message trop long pour un enregistrement, conversion non gérée (%*d,
+ *   %Lf...) ou tâche pas encore démarrée : écriture directe comme avant
+ * - Le format doit être une chaîne littérale (lue plus tard par la tâche)
  */
 
 // Niveaux de log
@@ -67,6 +82,18 @@ public:
    */
   static void error(const char* format, ...);
   
+  /**
+   * Attendre que la tâche LogTask ait écrit les messages en attente
+   * (avant un redémarrage par exemple)
+   * @param timeoutMs Attente maximale
+   */
+  static void flush(uint32_t timeoutMs = 500);
+  
+  /**
+   * Nombre de messages abandonnés (file pleine) depuis le démarrage
+   */
+  static uint32_t getDroppedCount();
+  
   /**
    * Vider le fichier de logs d'erreur sur la SD
    * @return true si réussi, false sinon
@@ -81,32 +108,53 @@ public:
 
 private:
   /**
-   * Logger un message avec un niveau spécifique
+   * Écrire un message : mise en file, sinon écriture directe
    * @param level Niveau du log
-   * @param prefix Préfixe du log (ex: "[ERROR]")
    * @param format Format du message
    * @param args Arguments variables
    */
-  static void log(LogLevel level, const char* prefix, const char* format, va_list args);
+  static void write(LogLevel level, const char* format, va_list args);
+  
+  /**
+   * Afficher un message formaté (et l'écrire sur la SD si c'est une erreur)
+   * @param level Niveau du log
+   * @param timestampMs millis() au moment de l'appel
+   * @param message Message formaté
+   */
+  static void output(LogLevel level, uint32_t timestampMs, const char* message);
+  
+  /**
+   * Tâche d'écriture : vide la file puis attend
+   */
+  static void logTask(void* parameter);
   
   /**
    * Écrire un message d'erreur dans le fichier sur la SD
+   * @param timestamp Timestamp formaté
    * @param message Message à écrire
    */
-  static void writeErrorToSD(const char* message);
+  static void writeErrorToSD(const char* timestamp, const char* message);
   
   /**
    * Formater un timestamp pour les logs
+   * @param timestampMs millis() à formater
    * @param buffer Buffer pour stocker le timestamp
    * @param bufferSize Taille du buffer
    */
-  static void formatTimestamp(char* buffer, size_t bufferSize);
+  static void formatTimestamp(uint32_t timestampMs, char* buffer, size_t bufferSize);
   
   static bool initialized;
   static LogLevel currentLogLevel;
   static bool sdLoggingEnabled;
   static const char* ERROR_LOG_FILE;
   static const size_t MAX_LOG_LINE_SIZE;
+  static TaskHandle_t taskHandle;
+  
+  // Paramètres de la tâche (centralisés dans core_config.h)
+  static const int TASK_STACK_SIZE;
+  static const int TASK_PRIORITY;
+  static const int TASK_CORE;
+  static const int LOOP_DELAY_MS = 10;
 };
 
 #endif // LOG_MANAGER_H
@@ -212,6 +212,7 @@ static void storeOtaErrorAndRestart(const char* version, const char* error) {
     prefs.end();
     LogManager::info("[OTA] Erreur stockee en NVS, reboot...");
   }
+  LogManager::flush();
   ESP.restart();
 }
 
@@ -562,6 +563,7 @@ bool OTAManager::performUpdate(const char* version) {
   }
 #endif
   LogManager::info("[OTA] Reboot...");
+  LogManager::flush();
   vTaskDelay(pdMS_TO_TICKS(200));
   ESP.restart();
   return true;
@@ -25,6 +25,7 @@
 #include "common/managers/ota/ota_manager.h"
 #ifdef HAS_AUDIO
 #include "common/managers/audio/audio_manager.h"
+#include "common/managers/audio/audio_cache.h"
 #endif
 #ifdef HAS_LCD
 #include "common/managers/lcd/lcd_manager.h"
@@ -288,6 +289,8 @@ void SerialCommands::processCommand(const String& command) {
   #ifdef HAS_LED
   } else if (cmd == "led-test" || cmd == "test-led" || cmd == "testleds") {
     cmdLEDTest();
+  } else if (cmd == "led-stats") {
+    cmdLEDStats(args);
   #endif
   #ifdef HAS_LCD
   } else if (cmd == "lcd-test" || cmd == "test-lcd" || cmd == "testlcd") {
@@ -314,6 +317,16 @@ void SerialCommands::processCommand(const String& command) {
     cmdAudioList(args);
   } else if (cmd == "audio" || cmd == "audio-status") {
     cmdAudio();
+  } else if (cmd == "audio-stats") {
+    cmdAudioStats(args);
+  } else if (cmd == "audio-cache" || cmd == "cache") {
+    cmdAudioCache(args);
+  } else if (cmd == "preload" || cmd == "audio-preload") {
+    cmdAudioPreload(args);
+  } else if (cmd == "playlist" || cmd == "audio-playlist") {
+    cmdAudioPlaylist(args);
+  } else if (cmd == "next" || cmd == "audio-next") {
+    cmdAudioNext();
   #endif
   } else {
     // Essayer les commandes spécifiques au modèle
@@ -343,6 +356,7 @@ void SerialCommands::printHelp() {
     Serial.println("  brightness [%]   - Afficher ou definir la luminosite (0-100%)");
     Serial.println("  sleep [timeout]  - Afficher ou definir le timeout sleep mode (ms, min: 5000, 0=desactive)");
     Serial.println("  led-test         - Tester les LEDs une par une puis toutes en rouge");
+    Serial.println("  led-stats [reset] - Trames LED envoyees / identiques sautees, duree des envois");
   }
   #endif
   #ifdef HAS_LCD
@@ -446,6 +460,11 @@ void SerialCommands::printHelp() {
     Serial.println("  resume             - Reprendre la lecture");
     Serial.println("  vol [0-100]        - Afficher ou definir le volume (%)");
     Serial.println("  ls [dossier]       - Lister les fichiers audio (ex: ls /music)");
+    Serial.println("  audio-stats [reset] - Latence, buffer et ecarts de la tache audio (+ LEDs)");
+    Serial.println("  cache [clear]      - Statut du cache audio PSRAM (ou le vider)");
+    Serial.println("  preload <fichier>  - Precharger un fichier en PSRAM");
+    Serial.println("  playlist <f1> <f2> ... - Definir la playlist (prechargee en avance)");
+    Serial.println("  next               - Lire la piste suivante de la playlist");
   }
   #endif
   
@@ -2015,6 +2034,94 @@ void SerialCommands::cmdAudioList(const String& args) {
 #endif
 }
 
+void SerialCommands::cmdAudioStats(const String& args) {
+#ifdef HAS_AUDIO
+  if (args == "reset") {
+    AudioManager::resetStats();
+    Serial.println("[AUDIO] Stats remises a zero");
+    return;
+  }
+  AudioManager::printStats();
+#else
+  (void)args;
+  Serial.println("[AUDIO] Audio non disponible sur ce modele");
+#endif
+}
+
+void SerialCommands::cmdAudioCache(const String& args) {
+#ifdef HAS_AUDIO
+  if (args == "clear") {
+    AudioCache::clear();
+    Serial.println("[AUDIO-CACHE] Cache vide");
+    return;
+  }
+  AudioCache::printStatus();
+#else
+  (void)args;
+  Serial.println("[AUDIO] Audio non disponible sur ce modele");
+#endif
+}
+
+void SerialCommands::cmdAudioPreload(const String& args) {
+#ifdef HAS_AUDIO
+  if (args.length() == 0) {
+    Serial.println("[AUDIO-CACHE] Usage: preload <fichier>");
+    return;
+  }
+  String path = args;
+  if (!path.startsWith("/")) {
+    path = "/" + path;
+  }
+  if (AudioCache::preload(path.c_str())) {
+    Serial.printf("[AUDIO-CACHE] Prechargement de: %s\n", path.c_str());
+  } else {
+    Serial.println("[AUDIO-CACHE] Prechargement refuse (cache inactif ou file pleine)");
+  }
+#else
+  (void)args;
+  Serial.println("[AUDIO] Audio non disponible sur ce modele");
+#endif
+}
+
+void SerialCommands::cmdAudioPlaylist(const String& args) {
+#ifdef HAS_AUDIO
+  if (args.length() == 0) {
+    Serial.println("[AUDIO] Usage: playlist <fichier1> <fichier2> ...");
+    return;
+  }
+  String tracks[AudioCache::PLAYLIST_MAX];
+  const char* paths[AudioCache::PLAYLIST_MAX];
+  uint8_t count = 0;
+  int start = 0;
+  while (start < (int)args.length() && count < AudioCache::PLAYLIST_MAX) {
+    int end = args.indexOf(' ', start);
+    if (end < 0) end = args.length();
+    String track = args.substring(start, end);
+    track.trim();
+    if (track.length() > 0) {
+      if (!track.startsWith("/")) track = "/" + track;
+      tracks[count] = track;
+      paths[count] = tracks[count].c_str();
+      count++;
+    }
+    start = end + 1;
+  }
+  AudioManager::setPlaylist(paths, count);
+  Serial.println("[AUDIO] 'next' pour lire la piste suivante");
+#else
+  (void)args;
+  Serial.println("[AUDIO] Audio non disponible sur ce modele");
+#endif
+}
+
+void SerialCommands::cmdAudioNext() {
+#ifdef HAS_AUDIO
+  AudioManager::playNext();
+#else
+  Serial.println("[AUDIO] Audio non disponible sur ce modele");
+#endif
+}
+
 void SerialCommands::cmdLEDTest() {
 #ifdef HAS_LED
   if (!LEDManager::isInitialized()) {
@@ -2031,6 +2138,33 @@ void SerialCommands::cmdLEDTest() {
 #endif
 }
 
+void SerialCommands::cmdLEDStats(const String& args) {
+#ifdef HAS_LED
+  if (args == "reset") {
+    LEDManager::resetShowStats();
+    Serial.println("[LED] Stats remises a zero");
+    return;
+  }
+  const LEDOutput::Stats& stats = LEDOutput::getStats();
+  const uint32_t total = stats.sent + stats.suppressed;
+  char hist[96];
+  LEDManager::getShowStats().format(hist, sizeof(hist));
+  Serial.printf("[LED] Sortie: %s, intervalle min %lu ms\n", LEDOutput::getName(),
+                (unsigned long)LEDManager::SHOW_INTERVAL_MS);
+  Serial.printf("[LED] Trames envoyees: %lu, identiques sautees: %lu (%lu%%)\n",
+                (unsigned long)stats.sent, (unsigned long)stats.suppressed,
+                total ? (unsigned long)(stats.suppressed * 100ULL / total) : 0UL);
+  Serial.printf("[LED] Duree des envois (us): %s\n", hist);
+  Serial.printf("[LED] Courant estime: %lu mA (demande %lu mA, limite %lu mA)\n",
+                (unsigned long)LEDCompositor::getEstimatedCurrentMa(),
+                (unsigned long)LEDCompositor::getRequestedCurrentMa(),
+                (unsigned long)LED_MAX_CURRENT_MA);
+#else
+  (void)args;
+  Serial.println("[LED] LEDs non disponibles sur ce modele");
+#endif
+}
+
 void SerialCommands::cmdLCDTest() {
 #ifdef HAS_LCD
   LCDManager::testLCD();
@@ -71,6 +71,7 @@ private:
   static void cmdConfigSet(const String& args);
   static void cmdConfigList();
   static void cmdLEDTest();
+  static void cmdLEDStats(const String& args);
   static void cmdLCDTest();
   static void cmdLCDReset();
   static void cmdLCDFps();
@@ -94,6 +95,11 @@ private:
   static void cmdAudioResume();
   static void cmdAudioVolume(const String& args);
   static void cmdAudioList(const String& args);
+  static void cmdAudioStats(const String& args);
+  static void cmdAudioCache(const String& args);
+  static void cmdAudioPreload(const String& args);
+  static void cmdAudioPlaylist(const String& args);
+  static void cmdAudioNext();
   
   static bool initialized;
   static String inputBuffer;
@@ -30,6 +30,8 @@ void SerialManager::reboot(uint32_t delayMs) {
     delay(delayMs);
   }
   
+  // Messages LogManager encore en file avant celui-ci
+  LogManager::flush();
   Serial.println("[SERIAL] Redemarrage de l'ESP32...");
   Serial.flush();
   
@@ -0,0 +1,81 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Histogramme à seaux puissances de 2 pour les mesures de temps (µs, ms)
+ *
+ * Seau 0 : valeur 0 ; seau i : [2^(i-1), 2^i - 1] ; le dernier seau reçoit
+ * tout ce qui dépasse. Les percentiles sont donc des bornes hautes (à un
+ * facteur 2 près), suffisant pour repérer une queue de distribution.
+ *
+ * Pas de verrou : une seule tâche écrit (add), les lectures depuis une autre
+ * tâche (serial, MQTT) peuvent voir un état légèrement incohérent.
+ */
+struct Log2Histogram {
+  static constexpr uint8_t BUCKETS = 24;  // Jusqu'à ~8 s en µs
+
+  uint32_t buckets[BUCKETS];
+  uint32_t count;
+  uint32_t max;
+  uint64_t sum;
+
+  void reset() {
+    memset(this, 0, sizeof(*this));
+  }
+
+  void add(uint32_t v) {
+    uint8_t i = v ? (uint8_t)(32 - __builtin_clz(v)) : 0;
+    if (i >= BUCKETS) i = BUCKETS - 1;
+    buckets[i]++;
+    count++;
+    sum += v;
+    if (v > max) max = v;
+  }
+
+  uint32_t mean() const {
+    return count ? (uint32_t)(sum / count) : 0;
+  }
+
+  /**
+   * Borne haute du seau contenant le percentile p (0-100)
+   */
+  uint32_t percentile(uint8_t p) const {
+    if (!count) return 0;
+    const uint64_t rank = ((uint64_t)count * p + 99) / 100;
+    uint64_t seen = 0;
+    for (uint8_t i = 0; i < BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= rank && seen) {
+        if (i == 0) return 0;
+        if (i == BUCKETS - 1) return max;
+        const uint32_t upper = (1u << i) - 1;
+        return upper < max ? upper : max;
+      }
+    }
+    return max;
+  }
+
+  /**
+   * Résumé sur une ligne : "n=.. moy=.. p50<=.. p99<=.. max=.."
+   */
+  int format(char* out, size_t len) const {
+    return snprintf(out, len, "n=%lu moy=%lu p50<=%lu p99<=%lu max=%lu",
+      (unsigned long)count, (unsigned long)mean(), (unsigned long)percentile(50),
+      (unsigned long)percentile(99), (unsigned long)max);
+  }
+
+  /**
+   * Résumé JSON (stats publiées en MQTT) : {"n":..,"mean":..,"p50":..,"p99":..,"max":..}
+   */
+  int formatJson(char* out, size_t len) const {
+    return snprintf(out, len, "{\"n\":%lu,\"mean\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu}",
+      (unsigned long)count, (unsigned long)mean(), (unsigned long)percentile(50),
+      (unsigned long)percentile(99), (unsigned long)max);
+  }
+};
+
+#endif // HISTOGRAM_H
@@ -204,6 +204,7 @@ void loop() {
   // - AudioManager : CORE_AUDIO, PRIORITY_AUDIO, lecture I2S temps-réel
   // - MqttManager: CORE_mqtt, PRIORITY_mqtt, HTTP polling
   // - WiFi retry   : CORE_WIFI_RETRY, PRIORITY_WIFI_RETRY, reconnexion
+  // - GotchiRender : CORE_RENDER, PRIORITY_RENDER, rendu écran à cadence fixe
   // (voir core_config.h pour les valeurs selon le chip)
   // ====================================================================
   
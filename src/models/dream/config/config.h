@@ -38,6 +38,13 @@
 #define NUM_LEDS 28
 #define LED_TYPE NEOPIXEL
 #define COLOR_ORDER GRB
+// Envoi des trames par le périphérique RMT (non bloquant, ~60 FPS)
+// false = strip->show() Adafruit (bloquant, ~30 FPS)
+#define LED_OUTPUT_RMT true
+// Tramage temporel 16 -> 8 bits (fondus lisses à faible luminosité)
+#define LED_TEMPORAL_DITHER true
+// Budget de courant estimé de la bande (mA), la trame est atténuée au-delà
+#define LED_MAX_CURRENT_MA 1000
 
 // ============================================
 // Entrées utilisateur
@@ -3,7 +3,6 @@
 #include "../dream_timing_constants.h"
 #include "../dream_rtc_macros.h"
 #include "../../../../common/utils/time_utils.h"
-#include "../touch/dream_touch_handler.h"
 #include "../../mqtt/model_mqtt_routes.h"
 #include "../../utils/schedule_parser.h"
 #include "../../utils/led_effect_parser.h"
@@ -316,13 +315,6 @@ void BedtimeManager::update() {
     }
   }
   
-  // Ne pas écraser le feedback alerte (vert/rouge pulsé)
-#ifdef HAS_TOUCH
-  if (DreamTouchHandler::s_alertFeedbackUntil > 0 && currentTime < DreamTouchHandler::s_alertFeedbackUntil) {
-    return;
-  }
-#endif
-
   // Mettre à jour les animations de fade si actives
   if (s_state.fadeInActive) {
     updateFadeIn();
@@ -34,9 +34,21 @@ static LEDEffect parseDefaultEffect(const char* effectStr) {
 }
 
 static const unsigned long HOLD_ALERT_MS = 2000; // Appui 2s+ = envoi alerte (sans relâcher)
-static const unsigned long ALERT_FEEDBACK_MS = 3000; // Durée du feedback alerte avant reprise du mode
+static const uint16_t ALERT_FEEDBACK_MS = 3000; // Durée du feedback alerte avant reprise du mode
+static const uint16_t TOUCH_FEEDBACK_MS = 250;  // Flash blanc à l'appui (accusé de réception)
 
-unsigned long DreamTouchHandler::s_alertFeedbackUntil = 0;
+/**
+ * Feedback alerte : vert (envoyée) ou rouge (échec) pulsé par-dessus l'affichage courant
+ * Calque transitoire : la routine coucher/réveil ou la couleur par défaut continue
+ * dessous et réapparaît en fondu à la fin, sans rien restaurer
+ */
+static void showAlertOverlay(bool success) {
+  if (success) {
+    LEDManager::showOverlay(LED_OVERLAY_ALERT, COLOR_GREEN, getBrightnessFromConfig(), ALERT_FEEDBACK_MS, LED_OVERLAY_PULSE);
+  } else {
+    LEDManager::showOverlay(LED_OVERLAY_ALERT, COLOR_RED, getBrightnessFromConfig(), ALERT_FEEDBACK_MS, LED_OVERLAY_PULSE);
+  }
+}
 
 // Variable statique exposée au reste du système
 static bool s_defaultColorDisplayed = false;  // Track if default color is currently on
@@ -56,37 +68,12 @@ void DreamTouchHandler::update() {
     noRoutineFeedbackUntil = 0;
     LEDManager::startFadeOutAndClear();
   }
-  if (s_alertFeedbackUntil > 0 && now >= s_alertFeedbackUntil) {
-    s_alertFeedbackUntil = 0;
-    if (BedtimeManager::isBedtimeActive()) {
-      BedtimeManager::restoreDisplayFromConfig();
-    } else if (WakeupManager::isWakeupActive()) {
-      WakeupConfig wc = WakeupManager::getConfig();
-      uint8_t brightnessValue = LEDManager::brightnessPercentTo255(wc.brightness);
-      LEDManager::preventSleep();
-      LEDManager::wakeUp();
-      LEDManager::setEffect(LED_EFFECT_NONE);
-      LEDManager::setColor(wc.colorR, wc.colorG, wc.colorB);
-      LEDManager::setBrightness(brightnessValue);
-    } else if (s_defaultColorDisplayed) {
-      // Reprendre la couleur par défaut après l'alerte
-      DreamConfig dreamConfig = DreamConfigManager::getConfig();
-      LEDManager::preventSleep();
-      LEDManager::wakeUp();
-      // Nettoyer d'abord pour éviter les animations résiduelles du pulse
-      LEDManager::clear();
-      LEDManager::setColor(dreamConfig.default_color_r, dreamConfig.default_color_g, dreamConfig.default_color_b);
-      LEDManager::setBrightness(LEDManager::brightnessPercentTo255(dreamConfig.default_brightness));
-      LEDEffect defaultEffect = LEDEffectParser::parse(dreamConfig.default_effect);
-      LEDManager::setEffect(defaultEffect);
-    } else {
-      LEDManager::startFadeOutAndClear();
-    }
-  }
-
   if (touched && !dreamTouchLast) {
     dreamTouchStartMs = now;
     alertHoldFired = false;
+    // Calque bref au-dessus de tout : l'appui est vu tout de suite, avant
+    // l'action du relâchement ; la base réapparaît en fondu
+    LEDManager::showOverlay(LED_OVERLAY_TOUCH, COLOR_WHITE, getBrightnessFromConfig(), TOUCH_FEEDBACK_MS);
   }
 
   unsigned long duration = touched ? (now - dreamTouchStartMs) : 0;
@@ -97,18 +84,8 @@ void DreamTouchHandler::update() {
     DreamConfig dreamConfig = DreamConfigManager::getConfig();
     if (dreamConfig.nighttime_alert_enabled) {
 #ifdef HAS_WIFI
-      LEDManager::preventSleep();
-      LEDManager::wakeUp();
-      LEDManager::setBrightness(getBrightnessFromConfig());
-      s_alertFeedbackUntil = now + ALERT_FEEDBACK_MS;
       bool ok = DreamApiRoutes::postNighttimeAlert();
-      // Effet avant couleur pour pulse direct (évite flash noir)
-      LEDManager::setEffect(LED_EFFECT_PULSE_FAST);
-      if (ok) {
-        LEDManager::setColor(COLOR_GREEN);  // Vert
-      } else {
-        LEDManager::setColor(COLOR_RED);  // Rouge
-      }
+      showAlertOverlay(ok);
       if (Serial) Serial.printf("[DREAM] Appui 2s: alerte %s\n", ok ? "envoyee" : "echec");
 #else
       if (Serial) Serial.println("[DREAM] Appui 2s: alerte (WiFi non dispo)");
@@ -164,19 +141,7 @@ void DreamTouchHandler::update() {
 }
 
 void DreamTouchHandler::triggerAlertFeedback(bool success) {
-  LEDManager::preventSleep();
-  LEDManager::wakeUp();
-  LEDManager::setBrightness(getBrightnessFromConfig());
-  // Nettoyer d'abord pour éviter les couleurs résiduelles
-  LEDManager::clear();
-  // Vert si success, rouge sinon
-  if (success) {
-    LEDManager::setColor(COLOR_GREEN);  // Vert
-  } else {
-    LEDManager::setColor(COLOR_RED);  // Rouge
-  }
-  LEDManager::setEffect(LED_EFFECT_PULSE_FAST);
-  s_alertFeedbackUntil = millis() + ALERT_FEEDBACK_MS;
+  showAlertOverlay(success);
 }
 
 bool DreamTouchHandler::isDefaultColorDisplayed() {
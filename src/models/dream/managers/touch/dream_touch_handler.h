@@ -11,14 +11,14 @@
  * - Appui maintenu 2s+ (sans relâcher) : envoi alerte veilleuse (notification aux parents)
  *
  * Feedback lumineux :
- * - Vert/rouge pulsé 3s après envoi alerte, puis reprise du mode actuel (bedtime/wakeup)
+ * - Flash blanc 250ms à chaque appui, en calque (accusé de réception)
+ * - Vert/rouge pulsé 3s après envoi alerte, en calque par-dessus le mode actuel
+ *   (bedtime/wakeup continue dessous et réapparaît en fondu)
  * - Rouge pulsé 3s = pas de routine configurée pour aujourd'hui
  */
 
 class DreamTouchHandler {
 public:
-  /** Timer pour le feedback alerte (utilisé par update() et triggerAlertFeedback) */
-  static unsigned long s_alertFeedbackUntil;
   /**
    * Mettre à jour le handler (à appeler dans loop() quand HAS_TOUCH et KIDOO_MODEL_DREAM)
    */
@@ -3,7 +3,6 @@
 #include "../dream_timing_constants.h"
 #include "../dream_rtc_macros.h"
 #include "../../../../common/utils/time_utils.h"
-#include "../touch/dream_touch_handler.h"
 #include "../../mqtt/model_mqtt_routes.h"
 #include "../../utils/schedule_parser.h"
 #include "../schedule_utils.h"
@@ -264,13 +263,6 @@ void WakeupManager::update() {
     checkWakeupTrigger();
   }
   
-  // Ne pas écraser le feedback alerte (vert/rouge pulsé)
-#ifdef HAS_TOUCH
-  if (DreamTouchHandler::s_alertFeedbackUntil > 0 && currentTime < DreamTouchHandler::s_alertFeedbackUntil) {
-    return;
-  }
-#endif
-
   // Mettre à jour les animations de fade si actives (avec throttling pour éviter les appels trop fréquents)
   if (s_state.fadeInActive) {
     unsigned long timeSinceLastFadeUpdate = TimeUtils::calculateElapsed(currentTime, s_state.lastFadeUpdateTime);
@@ -67,6 +67,9 @@ bool ModelDreamMqttRoutes::processMessage(const JsonObject& json) {
   else if (strcmp(action, "led") == 0) {
     return handleLed(json);
   }
+  else if (strcmp(action, "led-timeline") == 0) {
+    return handleLedTimeline(json);
+  }
   else if (strcmp(action, "start-test-bedtime") == 0) {
     return handleStartTestBedtime(json);
   }
@@ -468,6 +471,50 @@ bool ModelDreamMqttRoutes::handleLed(const JsonObject& json) {
   return handled;
 }
 
+bool ModelDreamMqttRoutes::handleLedTimeline(const JsonObject& json) {
+  // Format: { "action": "led-timeline", "params": { "loop": false, "keys": [[0, "#000000", 0], [600000, "#FF6B00", 180]] } }
+  // keys: [temps ms depuis le début, couleur #RRGGBB, niveau 0-255], triées par temps
+  // Interpolation linéaire entre deux keyframes ; sans loop, la dernière reste affichée
+  if (!json["params"].is<JsonObject>()) {
+    Serial.println("[MQTT-ROUTE] led-timeline: parametre 'params' manquant");
+    return false;
+  }
+  JsonObject params = json["params"].as<JsonObject>();
+  if (!params["keys"].is<JsonArray>()) {
+    Serial.println("[MQTT-ROUTE] led-timeline: parametre 'keys' manquant");
+    return false;
+  }
+  JsonArray keys = params["keys"].as<JsonArray>();
+  if (keys.size() == 0 || keys.size() > LEDTimeline::MAX_KEYFRAMES) {
+    Serial.printf("[MQTT-ROUTE] led-timeline: 1 a %d keyframes attendues\n", (int)LEDTimeline::MAX_KEYFRAMES);
+    return false;
+  }
+
+  LEDTimeline timeline = {};
+  timeline.loop = params["loop"] | false;
+  for (JsonVariant item : keys) {
+    JsonArray key = item.as<JsonArray>();
+    const char* colorStr = key[1].as<const char*>();
+    if (key.size() != 3 || !key[0].is<uint32_t>() || !key[2].is<int>() || colorStr == nullptr ||
+        colorStr[0] != '#' || strlen(colorStr) != 7) {
+      Serial.println("[MQTT-ROUTE] led-timeline: keyframe invalide (attendu [ms, \"#RRGGBB\", 0-255])");
+      return false;
+    }
+    LEDKeyframe& frame = timeline.keys[timeline.count++];
+    frame.atMs = key[0].as<uint32_t>();
+    frame.color = (uint32_t)strtol(colorStr + 1, nullptr, 16);
+    frame.level = (uint8_t)constrain(key[2].as<int>(), 0, 255);
+  }
+
+  if (!LEDManager::playTimeline(timeline)) {
+    Serial.println("[MQTT-ROUTE] led-timeline: timeline refusee par LEDManager");
+    return false;
+  }
+  Serial.printf("[MQTT-ROUTE] Timeline: %d keyframes sur %lu ms%s\n", timeline.count,
+                (unsigned long)timeline.keys[timeline.count - 1].atMs, timeline.loop ? " (boucle)" : "");
+  return true;
+}
+
 // Variables statiques pour gérer l'état du test de bedtime (testBedtimeActive déclaré en haut)
 static unsigned long testBedtimeStartTime = 0;
 static bool bedtimeWasActiveBeforeTest = false;  // Pour restaurer le mode bedtime à la sortie du test
@@ -1784,6 +1831,7 @@ void ModelDreamMqttRoutes::printRoutes() {
   Serial.println("{ \"action\": \"reboot\", \"params\": { \"delay\": ms } }");
   Serial.println("{ \"action\": \"led\", \"color\": \"#RRGGBB\" }");
   Serial.println("{ \"action\": \"led\", \"effect\": \"none|pulse|rotate|rainbow|glossy|off\" }");
+  Serial.println("{ \"action\": \"led-timeline\", \"params\": { \"loop\": false, \"keys\": [[0, \"#000000\", 0], [600000, \"#FF6B00\", 180]] } }");
   Serial.println("{ \"action\": \"start-test-bedtime\", \"params\": { \"colorR\": 0-255, \"colorG\": 0-255, \"colorB\": 0-255, \"brightness\": 0-100 } }");
   Serial.println("{ \"action\": \"stop-test-bedtime\" }");
   Serial.println("{ \"action\": \"start-bedtime\" }");
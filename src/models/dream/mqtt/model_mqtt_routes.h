@@ -14,6 +14,7 @@
  * - sleep-timeout: Gérer le délai de mise en veille
  * - reboot: Redémarrer l'appareil
  * - led: Contrôler les LEDs (couleur, effet)
+ * - led-timeline: Jouer une suite de keyframes couleur/niveau interpolées (ex: lever de soleil)
  * - start-test-bedtime: Démarrer le test de l'heure de coucher
  * - stop-test-bedtime: Arrêter le test de l'heure de coucher
  * - start-bedtime: Démarrer manuellement la routine de coucher (empêche le déclenchement automatique)
@@ -36,6 +37,7 @@
  * { "action": "sleep-timeout", "params": { "value": 30000 } }
  * { "action": "reboot", "params": { "delay": 1000 } }
  * { "action": "led", "color": "#FF0000", "effect": "solid" }
+ * { "action": "led-timeline", "params": { "loop": false, "keys": [[0, "#000000", 0], [600000, "#FF6B00", 180]] } }
  * { "action": "start-test-bedtime", "params": { "colorR": 255, "colorG": 107, "colorB": 107, "brightness": 50 } }
  * { "action": "stop-test-bedtime" }
  * { "action": "start-bedtime" }
@@ -132,6 +134,7 @@ private:
   static bool handleSleepTimeout(const JsonObject& json);
   static bool handleReboot(const JsonObject& json);
   static bool handleLed(const JsonObject& json);
+  static bool handleLedTimeline(const JsonObject& json);
   static bool handleStartTestBedtime(const JsonObject& json);
   static bool handleStopTestBedtime(const JsonObject& json);
   static bool handleStartBedtime(const JsonObject& json);
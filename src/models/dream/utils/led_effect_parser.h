@@ -26,6 +26,7 @@ public:
    * - "breathe" → LED_EFFECT_BREATHE
    * - "nightlight" → LED_EFFECT_NIGHTLIGHT
    * - "glossy" → LED_EFFECT_GLOSSY (si disponible)
+   * - "timeline" → LED_EFFECT_NONE (uniquement via l'action MQTT "led-timeline")
    * - String vide → LED_EFFECT_NONE
    * - Inconnu → LED_EFFECT_NONE
    *
@@ -37,42 +38,22 @@ public:
       return LED_EFFECT_NONE;  // Empty string = solid color
     }
 
-    // Handle common aliases for "none"
-    if (strcmp(effectStr, "none") == 0 || strcmp(effectStr, "solid") == 0) {
+    // Aliases (le registre ne connaît que le nom canonique)
+    if (strcmp(effectStr, "solid") == 0 || strcmp(effectStr, "off") == 0) {
+      // "off" can mean either disable effect or use NONE
       return LED_EFFECT_NONE;
     }
-
-    // Check all effect types
-    if (strcmp(effectStr, "pulse_fast") == 0) {
-      return LED_EFFECT_PULSE_FAST;
-    }
-    if (strcmp(effectStr, "pulse") == 0) {
-      return LED_EFFECT_PULSE;
-    }
-    if (strcmp(effectStr, "rainbow") == 0) {
-      return LED_EFFECT_RAINBOW;
-    }
-    if (strcmp(effectStr, "rainbow_soft") == 0 || strcmp(effectStr, "rainbow-soft") == 0) {
+    if (strcmp(effectStr, "rainbow-soft") == 0) {
       return LED_EFFECT_RAINBOW_SOFT;
     }
-    if (strcmp(effectStr, "rotate") == 0) {
-      return LED_EFFECT_ROTATE;
-    }
-    if (strcmp(effectStr, "breathe") == 0) {
-      return LED_EFFECT_BREATHE;
-    }
-    if (strcmp(effectStr, "nightlight") == 0) {
-      return LED_EFFECT_NIGHTLIGHT;
-    }
-    if (strcmp(effectStr, "glossy") == 0) {
-      return LED_EFFECT_GLOSSY;
-    }
-    if (strcmp(effectStr, "off") == 0) {
-      // "off" can mean either disable effect or use NONE
-      return LED_EFFECT_NONE;
-    }
 
-    return LED_EFFECT_NONE;  // Unknown effect = solid color
+    // Noms du registre des effets (LEDEffects)
+    const LEDEffectInfo* info = LEDEffects::find(effectStr);
+    if (info == nullptr || info->id == LED_EFFECT_TIMELINE) {
+      // La timeline n'a de sens qu'avec ses keyframes (action MQTT "led-timeline")
+      return LED_EFFECT_NONE;  // Unknown effect = solid color
+    }
+    return info->id;
   }
 };
 
@@ -0,0 +1,572 @@
+/**
+ * Moteur audio Gotchi : tâche persistante + mixeur N voix.
+ * Séquence matérielle identique à l'exemple Waveshare 08_ES8311 (PA, I2S avec
+ * MCLK, puis codec), faite une seule fois par la tâche. I2S via le driver IDF
+ * (driver/i2s_std.h) pour régler la profondeur DMA (latence).
+ */
+#include "gotchi_audio.h"
+#include "ima_adpcm.h"
+#include "gotchi_synth.h"
+#include "../config/config.h"
+#include "common/config/core_config.h"
+#include "common/managers/sd/sd_manager.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <atomic>
+#include "driver/i2s_std.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// Wrapper pour forcer heap_caps_calloc en RAM interne pendant l'init I2S
+// (le driver GDMA refuse les descripteurs/callbacks en PSRAM)
+static volatile bool s_forceInternal = false;
+
+extern "C" void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+extern "C" void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  if (s_forceInternal && caps == MALLOC_CAP_DEFAULT) {
+    return __real_heap_caps_calloc(n, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  return __real_heap_caps_calloc(n, size, caps);
+}
+
+// Driver ES8311 Waveshare (utilise i2cWrite/i2cWriteReadNonStop)
+extern "C" {
+  #include "es8311.h"
+}
+
+namespace {
+
+using GotchiAudio::MAX_VOICES;
+using GotchiAudio::MIX_FRAMES;
+using GotchiAudio::SAMPLE_RATE;
+using GotchiAudio::VoiceId;
+
+constexpr int QUEUE_LEN = 8;
+constexpr uint32_t PA_IDLE_MS = 1000;    // Ampli coupé après 1 s de silence
+constexpr es8311_mic_gain_t MIC_GAIN = (es8311_mic_gain_t)3;
+
+enum class Op : uint8_t { Play, PlayAdpcm, Tone, Sequence, StopAll, SetVolume, ResetStats };
+
+struct Command {
+  Op op;
+  VoiceId id;
+  const uint8_t* pcm;
+  uint32_t len;        // Play* : octets ; Tone : durée en ms
+  uint16_t freqHz;
+  uint8_t level;       // Play* : gain 0-255 ; Tone / Sequence / SetVolume : 0-100
+  const GotchiSynth::Sequence* seq;
+  uint32_t queuedUs;   // micros() à l'envoi (latence de démarrage)
+};
+
+enum class VoiceKind : uint8_t { Free, Pcm, Adpcm, Synth };
+
+struct Voice {
+  VoiceKind kind;
+  VoiceId id;
+  uint32_t remaining;  // Frames restantes
+  // PCM / ADPCM
+  const uint8_t* pcm;
+  ImaAdpcm::State adpcm;
+  uint16_t gain;       // 0-256
+  // Tone / séquence
+  GotchiSynth::Voice synth;
+  uint32_t queuedUs;
+  bool started;        // Premier bloc déjà écrit
+};
+
+QueueHandle_t s_queue = nullptr;
+SemaphoreHandle_t s_sendLock = nullptr;  // Ids attribués dans l'ordre de la file
+TaskHandle_t s_task = nullptr;
+i2s_chan_handle_t s_tx = nullptr;
+es8311_handle_t s_codec = nullptr;
+bool s_paOn = false;
+volatile bool s_ready = false;
+volatile bool s_failed = false;
+
+Voice s_voices[MAX_VOICES];
+// Ids des voix en cours (lus par isPlaying depuis d'autres tâches)
+std::atomic<VoiceId> s_slotId[MAX_VOICES];
+std::atomic<VoiceId> s_nextId{0};
+std::atomic<VoiceId> s_lastDequeued{0};  // La file est FIFO : tout id <= est sorti
+
+int32_t s_mix[MIX_FRAMES];
+int16_t s_dec[ImaAdpcm::BLOCK_FRAMES];  // Bloc ADPCM décodé
+int16_t s_out[MIX_FRAMES];  // Mono : l'I2S duplique sur L et R
+
+GotchiAudio::Stats s_stats = {};
+
+// File DMA, suivie depuis l'ISR I2S : descripteurs libres (rendus par
+// on_sent, repris par l'écriture). s_streaming : un son est en cours,
+// une file vide est alors un underrun et pas le silence du repos. L'ISR
+// compte dans s_underruns, la tâche reporte dans s_stats (seul écrivain).
+constexpr size_t DESC_BYTES = MIX_FRAMES * sizeof(int16_t);
+constexpr uint32_t BLOCK_US = MIX_FRAMES * 1000000ULL / SAMPLE_RATE;
+std::atomic<int> s_freeDesc{GotchiAudio::DMA_DESC};
+std::atomic<bool> s_streaming{false};
+std::atomic<uint32_t> s_underruns{0};
+size_t s_descOffset = 0;  // Octets déjà écrits dans le descripteur courant
+
+// ============================================
+// Matériel
+// ============================================
+
+void enablePA() {
+  pinMode(GOTCHI_PA_PIN, OUTPUT);
+  digitalWrite(GOTCHI_PA_PIN, HIGH);
+  delay(10);
+  s_paOn = true;
+}
+
+void disablePA() {
+  digitalWrite(GOTCHI_PA_PIN, LOW);
+  s_paOn = false;
+}
+
+bool IRAM_ATTR onDmaSent(i2s_chan_handle_t, i2s_event_data_t*, void*) {
+  int f = s_freeDesc.load();
+  while (f < GotchiAudio::DMA_DESC && !s_freeDesc.compare_exchange_weak(f, f + 1)) {}
+  return false;
+}
+
+// Descripteur renvoyé sans avoir été rempli : la tâche n'a pas suivi
+bool IRAM_ATTR onDmaOverflow(i2s_chan_handle_t, i2s_event_data_t*, void*) {
+  if (s_streaming.load()) s_underruns.fetch_add(1);
+  return false;
+}
+
+bool initI2S() {
+  s_forceInternal = true;
+
+  i2s_chan_config_t chanCfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+  chanCfg.dma_desc_num = GotchiAudio::DMA_DESC;
+  chanCfg.dma_frame_num = MIX_FRAMES;
+  chanCfg.auto_clear = true;  // File DMA vide = silence (pas de buffer rejoué)
+
+  esp_err_t err = i2s_new_channel(&chanCfg, &s_tx, nullptr);
+  if (err == ESP_OK) {
+    i2s_std_config_t stdCfg = {
+      .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(SAMPLE_RATE),  // MCLK = 256 x fs
+      // Slot mono, masque BOTH : le contrôleur envoie chaque sample sur L et R
+      .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+      .gpio_cfg = {
+        .mclk = (gpio_num_t)GOTCHI_I2S_MCK_IO,
+        .bclk = (gpio_num_t)GOTCHI_I2S_BCK_IO,
+        .ws = (gpio_num_t)GOTCHI_I2S_WS_IO,
+        .dout = (gpio_num_t)GOTCHI_I2S_DO_IO,
+        .din = I2S_GPIO_UNUSED,
+        .invert_flags = { .mclk_inv = false, .bclk_inv = false, .ws_inv = false },
+      },
+    };
+    err = i2s_channel_init_std_mode(s_tx, &stdCfg);
+    if (err == ESP_OK) {
+      // Avant enable : l'IDF refuse l'enregistrement sur un canal actif
+      i2s_event_callbacks_t cbs = {};
+      cbs.on_sent = onDmaSent;
+      cbs.on_send_q_ovf = onDmaOverflow;
+      err = i2s_channel_register_event_callback(s_tx, &cbs, nullptr);
+    }
+    if (err == ESP_OK) err = i2s_channel_enable(s_tx);
+  }
+
+  s_forceInternal = false;
+
+  if (err != ESP_OK) {
+    Serial.printf("[AUDIO] I2S: %s\n", esp_err_to_name(err));
+    if (s_tx) i2s_del_channel(s_tx);
+    s_tx = nullptr;
+    return false;
+  }
+  Serial.printf("[AUDIO] I2S OK (BCK=%d WS=%d DOUT=%d MCLK=%d, DMA %dx%d frames)\n",
+    GOTCHI_I2S_BCK_IO, GOTCHI_I2S_WS_IO, GOTCHI_I2S_DO_IO, GOTCHI_I2S_MCK_IO,
+    GotchiAudio::DMA_DESC, MIX_FRAMES);
+  return true;
+}
+
+esp_err_t codecInit() {
+  s_codec = es8311_create(0, ES8311_ADDRRES_0);
+  if (!s_codec) {
+    Serial.println("[AUDIO] es8311_create failed");
+    return ESP_FAIL;
+  }
+
+  const es8311_clock_config_t clk = {
+    .mclk_inverted = false,
+    .sclk_inverted = false,
+    .mclk_from_mclk_pin = true,
+    .mclk_frequency = SAMPLE_RATE * 256,
+    .sample_frequency = SAMPLE_RATE
+  };
+
+  esp_err_t err = es8311_init(s_codec, &clk, ES8311_RESOLUTION_16, ES8311_RESOLUTION_16);
+  if (err != ESP_OK) { Serial.printf("[AUDIO] es8311_init: %s\n", esp_err_to_name(err)); return err; }
+
+  err = es8311_sample_frequency_config(s_codec, clk.mclk_frequency, clk.sample_frequency);
+  if (err != ESP_OK) { Serial.printf("[AUDIO] freq_config: %s\n", esp_err_to_name(err)); return err; }
+
+  es8311_microphone_config(s_codec, false);
+
+  // Volume depuis config.json (0-100), lu une fois ; ensuite setVolume()
+  SDConfig cfg = SDManager::getConfig();
+  es8311_voice_volume_set(s_codec, cfg.speaker_volume, NULL);
+  es8311_microphone_gain_set(s_codec, MIC_GAIN);
+
+  Serial.printf("[AUDIO] ES8311 OK, volume %d%%\n", cfg.speaker_volume);
+  return ESP_OK;
+}
+
+bool bringUp() {
+  enablePA();
+  if (!initI2S()) { disablePA(); return false; }
+  Wire.begin(IIC_SDA, IIC_SCL);
+  if (codecInit() != ESP_OK) { disablePA(); return false; }
+  return true;
+}
+
+// ============================================
+// Voix
+// ============================================
+
+void freeVoice(int slot) {
+  s_voices[slot].kind = VoiceKind::Free;
+  s_slotId[slot].store(0);
+}
+
+// Slot libre, sinon on vole la voix la plus ancienne (id le plus petit)
+int allocVoice() {
+  int oldest = 0;
+  for (int i = 0; i < MAX_VOICES; i++) {
+    if (s_voices[i].kind == VoiceKind::Free) return i;
+    if (s_voices[i].id < s_voices[oldest].id) oldest = i;
+  }
+  return oldest;
+}
+
+bool anyVoice() {
+  for (const Voice& v : s_voices)
+    if (v.kind != VoiceKind::Free) return true;
+  return false;
+}
+
+void apply(const Command& c) {
+  switch (c.op) {
+    case Op::Play:
+    case Op::PlayAdpcm:
+    case Op::Tone:
+    case Op::Sequence: {
+      if (!s_ready) break;  // Matériel en échec : la voix se termine aussitôt
+      int slot = allocVoice();
+      Voice& v = s_voices[slot];
+      v.id = c.id;
+      v.queuedUs = c.queuedUs;
+      v.started = false;
+      if (c.op == Op::Play) {
+        v.kind = VoiceKind::Pcm;
+        v.pcm = c.pcm;
+        v.remaining = c.len / 2;
+        v.gain = c.level == 255 ? 256 : c.level;
+      } else if (c.op == Op::PlayAdpcm) {
+        v.kind = VoiceKind::Adpcm;
+        ImaAdpcm::begin(v.adpcm, c.pcm, c.len);  // Validé par playAdpcm()
+        v.remaining = ImaAdpcm::sampleCount(c.len);
+        v.gain = c.level == 255 ? 256 : c.level;
+      } else {
+        v.kind = VoiceKind::Synth;
+        if (c.op == Op::Tone) GotchiSynth::startTone(v.synth, c.freqHz, (uint16_t)c.len, c.level);
+        else GotchiSynth::start(v.synth, *c.seq, c.level);
+        v.remaining = GotchiSynth::totalFrames(v.synth, SAMPLE_RATE);
+      }
+      s_slotId[slot].store(c.id);
+      break;
+    }
+    case Op::StopAll:
+      for (int i = 0; i < MAX_VOICES; i++) freeVoice(i);
+      break;
+    case Op::SetVolume:
+      if (s_codec) es8311_voice_volume_set(s_codec, c.level, NULL);
+      break;
+    case Op::ResetStats:
+      s_stats = {};
+      s_underruns = 0;
+      break;
+  }
+  s_lastDequeued.store(c.id);
+}
+
+// Mixe un bloc de MIX_FRAMES frames dans s_out (mono)
+void mixBlock() {
+  memset(s_mix, 0, sizeof(s_mix));
+  for (int slot = 0; slot < MAX_VOICES; slot++) {
+    Voice& v = s_voices[slot];
+    if (v.kind == VoiceKind::Free) continue;
+    const int n = v.remaining < (uint32_t)MIX_FRAMES ? (int)v.remaining : MIX_FRAMES;
+    if (v.kind == VoiceKind::Pcm) {
+      // PCM LE en flash, pas forcément aligné sur 2 octets
+      const uint8_t* p = v.pcm;
+      for (int i = 0; i < n; i++, p += 2) {
+        const int32_t s = (int16_t)(p[0] | (p[1] << 8));
+        s_mix[i] += (s * v.gain) >> 8;
+      }
+      v.pcm = p;
+    } else if (v.kind == VoiceKind::Adpcm) {
+      for (int i = 0; i < n; i += ImaAdpcm::BLOCK_FRAMES) {
+        const int m = n - i < ImaAdpcm::BLOCK_FRAMES ? n - i : ImaAdpcm::BLOCK_FRAMES;
+        ImaAdpcm::decode(v.adpcm, s_dec, m);
+        for (int k = 0; k < m; k++) s_mix[i + k] += ((int32_t)s_dec[k] * v.gain) >> 8;
+      }
+    } else {
+      GotchiSynth::render(v.synth, s_mix, n);
+    }
+    v.remaining -= n;
+    if (v.remaining == 0) freeVoice(slot);
+  }
+  for (int i = 0; i < MIX_FRAMES; i++) {
+    int32_t s = s_mix[i];
+    if (s > 32767) s = 32767;
+    if (s < -32768) s = -32768;
+    s_out[i] = (int16_t)s;
+  }
+}
+
+// Voix seule au gain unitaire : pas de mixage ni de saturation.
+// PCM : on renvoie directement le pointeur flash (l'I2S copie dans ses
+// buffers DMA) ; ADPCM : décodage directement dans s_out.
+int soloVoice() {
+  int solo = -1;
+  for (int i = 0; i < MAX_VOICES; i++) {
+    if (s_voices[i].kind == VoiceKind::Free) continue;
+    if (solo >= 0) return -1;
+    solo = i;
+  }
+  if (solo < 0) return -1;
+  const Voice& v = s_voices[solo];
+  if (v.kind == VoiceKind::Synth || v.gain != 256) return -1;
+  return solo;
+}
+
+// Prépare le prochain bloc à écrire (bytes = taille, <= un bloc)
+const void* renderBlock(size_t& bytes) {
+  const int slot = soloVoice();
+  if (slot < 0) {
+    mixBlock();
+    bytes = sizeof(s_out);
+    return s_out;
+  }
+  Voice& v = s_voices[slot];
+  const int n = v.remaining < (uint32_t)MIX_FRAMES ? (int)v.remaining : MIX_FRAMES;
+  const void* out;
+  if (v.kind == VoiceKind::Pcm) {
+    out = v.pcm;
+    v.pcm += n * 2;
+  } else {
+    for (int i = 0; i < n; i += ImaAdpcm::BLOCK_FRAMES) {
+      const int m = n - i < ImaAdpcm::BLOCK_FRAMES ? n - i : ImaAdpcm::BLOCK_FRAMES;
+      ImaAdpcm::decode(v.adpcm, s_out + i, m);
+    }
+    out = s_out;
+  }
+  v.remaining -= n;
+  if (v.remaining == 0) freeVoice(slot);
+  bytes = (size_t)n * sizeof(int16_t);
+  s_stats.directFrames += n;
+  return out;
+}
+
+void audioTask(void*) {
+  if (bringUp()) {
+    s_ready = true;
+  } else {
+    s_failed = true;
+    Serial.println("[AUDIO] ERREUR: init materiel, sons ignores");
+  }
+  TickType_t idleSince = xTaskGetTickCount();
+
+  for (;;) {
+    // Au repos : bloqué sur la file (jusqu'au délai de coupure de l'ampli)
+    TickType_t wait = 0;
+    if (!anyVoice()) {
+      s_streaming = false;  // La file DMA se vide : silence, pas underrun
+      wait = s_paOn ? pdMS_TO_TICKS(PA_IDLE_MS) : portMAX_DELAY;
+    }
+    s_stats.underruns += s_underruns.exchange(0);
+
+    Command c;
+    while (xQueueReceive(s_queue, &c, wait) == pdTRUE) {
+      apply(c);
+      wait = 0;
+    }
+
+    if (!anyVoice()) {
+      if (s_paOn && xTaskGetTickCount() - idleSince >= pdMS_TO_TICKS(PA_IDLE_MS)) disablePA();
+      continue;
+    }
+    if (!s_paOn) enablePA();
+
+    // Voix dont ce bloc est le premier (elles peuvent finir dans le bloc)
+    uint32_t startQueuedUs[MAX_VOICES];
+    int starting = 0;
+    for (Voice& v : s_voices) {
+      if (v.kind == VoiceKind::Free || v.started) continue;
+      v.started = true;
+      startQueuedUs[starting++] = v.queuedUs;
+    }
+
+    const uint32_t t0 = micros();
+    size_t bytes = 0;
+    const void* block = renderBlock(bytes);
+    s_stats.renderUs += micros() - t0;
+    s_stats.frames += bytes / sizeof(int16_t);
+    s_stats.blocks++;
+
+    // Blocs pleins devant celui-ci (le descripteur partiel en cours compte)
+    const int queued = GotchiAudio::DMA_DESC - s_freeDesc.load();
+    s_stats.fill[queued < 0 ? 0 : queued]++;
+    const size_t end = s_descOffset + bytes;
+    const int newDescs = (int)((end + DESC_BYTES - 1) / DESC_BYTES) - (s_descOffset ? 1 : 0);
+    s_freeDesc.fetch_sub(newDescs);
+    s_descOffset = end % DESC_BYTES;
+
+    size_t written = 0;
+    // Bloque tant que la file DMA est pleine : c'est l'horloge du mixeur
+    i2s_channel_write(s_tx, block, bytes, &written, portMAX_DELAY);
+    s_streaming = true;
+    idleSince = xTaskGetTickCount();
+
+    if (starting) {
+      // Le bloc passe après ceux déjà en file (un seul peut être en cours d'envoi)
+      const int ahead = queued < GotchiAudio::DMA_DESC ? queued : GotchiAudio::DMA_DESC - 1;
+      const uint32_t now = micros() + ahead * BLOCK_US;
+      for (int i = 0; i < starting; i++) s_stats.startUs.add(now - startQueuedUs[i]);
+    }
+  }
+}
+
+VoiceId send(Command& c) {
+  if (!s_task && !GotchiAudio::init()) return 0;
+  xSemaphoreTake(s_sendLock, portMAX_DELAY);
+  c.id = s_nextId.fetch_add(1) + 1;
+  c.queuedUs = micros();
+  const bool sent = xQueueSend(s_queue, &c, 0) == pdTRUE;
+  xSemaphoreGive(s_sendLock);
+  if (!sent) {
+    Serial.println("[AUDIO] File pleine, commande ignoree");
+    return 0;
+  }
+  return c.id;
+}
+
+} // namespace
+
+namespace GotchiAudio {
+
+bool init() {
+  if (s_task) return true;
+  if (!s_queue) {
+    s_queue = xQueueCreate(QUEUE_LEN, sizeof(Command));
+    s_sendLock = xSemaphoreCreateMutex();
+    if (!s_queue || !s_sendLock) {
+      Serial.println("[AUDIO] ERREUR: creation file echouee");
+      return false;
+    }
+  }
+  for (int i = 0; i < MAX_VOICES; i++) freeVoice(i);
+  BaseType_t result = xTaskCreatePinnedToCore(
+    audioTask, "GotchiAudio", STACK_SIZE_AUDIO_MIXER, nullptr,
+    PRIORITY_AUDIO, &s_task, CORE_AUDIO);
+  if (result != pdPASS) {
+    Serial.println("[AUDIO] ERREUR: creation tache audio echouee");
+    s_task = nullptr;
+    return false;
+  }
+  return true;
+}
+
+VoiceId play(const uint8_t* pcm, uint32_t len, uint8_t gain) {
+  if (!pcm || len < 2) return 0;
+  Command c = {};
+  c.op = Op::Play;
+  c.pcm = pcm;
+  c.len = len;
+  c.level = gain;
+  return send(c);
+}
+
+VoiceId playAdpcm(const uint8_t* asset, uint32_t len, uint8_t gain) {
+  ImaAdpcm::State probe;
+  if (!ImaAdpcm::begin(probe, asset, len)) return 0;
+  Command c = {};
+  c.op = Op::PlayAdpcm;
+  c.pcm = asset;
+  c.len = len;
+  c.level = gain;
+  return send(c);
+}
+
+VoiceId tone(uint16_t freqHz, uint16_t durationMs, uint8_t volumePercent) {
+  Command c = {};
+  c.op = Op::Tone;
+  c.len = durationMs;
+  c.freqHz = freqHz;
+  c.level = volumePercent > 100 ? 100 : volumePercent;
+  return send(c);
+}
+
+VoiceId playSequence(const GotchiSynth::Sequence& seq, uint8_t volumePercent) {
+  if (!seq.notes || !seq.count) return 0;
+  Command c = {};
+  c.op = Op::Sequence;
+  c.seq = &seq;
+  c.level = volumePercent > 100 ? 100 : volumePercent;
+  return send(c);
+}
+
+void stopAll() {
+  Command c = {};
+  c.op = Op::StopAll;
+  send(c);
+}
+
+void setVolume(uint8_t volumePercent) {
+  Command c = {};
+  c.op = Op::SetVolume;
+  c.level = volumePercent > 100 ? 100 : volumePercent;
+  send(c);
+}
+
+bool isPlaying(VoiceId id) {
+  if (!id || s_failed) return false;
+  if (id > s_lastDequeued.load()) return true;  // Encore dans la file
+  for (int i = 0; i < MAX_VOICES; i++)
+    if (s_slotId[i].load() == id) return true;
+  return false;
+}
+
+bool wait(VoiceId id, uint32_t timeoutMs) {
+  const uint32_t t0 = millis();
+  while (isPlaying(id)) {
+    if (timeoutMs && millis() - t0 >= timeoutMs) return false;
+    vTaskDelay(pdMS_TO_TICKS(5));
+  }
+  return true;
+}
+
+bool isReady() { return s_ready; }
+
+const Stats& getStats() { return s_stats; }
+
+// Seule la tâche écrit s_stats : la remise à zéro passe par la file
+void resetStats() {
+  if (!s_task) {
+    s_stats = {};
+    s_underruns = 0;
+    return;
+  }
+  Command c = {};
+  c.op = Op::ResetStats;
+  send(c);
+}
+
+} // namespace GotchiAudio
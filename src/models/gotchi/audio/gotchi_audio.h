@@ -0,0 +1,81 @@
+#ifndef GOTCHI_AUDIO_H
+#define GOTCHI_AUDIO_H
+
+#include <cstdint>
+#include "common/utils/histogram.h"
+
+namespace GotchiSynth { struct Sequence; }
+
+/**
+ * Moteur audio Gotchi — tâche persistante "GotchiAudio" (CORE_AUDIO).
+ *
+ * La tâche possède l'I2S et l'ES8311 : ils sont initialisés une seule fois,
+ * au premier son, puis restent actifs (seul l'ampli est coupé après un temps
+ * de silence). Les appelants ne touchent jamais au matériel : ils déposent
+ * une commande dans une file, sans attendre (utilisable depuis le rendu, les
+ * behaviors, le serial).
+ *
+ * Mixeur : MAX_VOICES voix (PCM ou IMA-ADPCM en flash, ou synthé) additionnées par blocs de
+ * MIX_FRAMES frames avec saturation. Deux effets qui se chevauchent (manger +
+ * éternuer) se mélangent au lieu d'attendre l'un l'autre. La file DMA est
+ * courte (DMA_DESC x MIX_FRAMES) : au repos, un son démarre dans le bloc DMA
+ * suivant.
+ *
+ * Sortie I2S en slot mono (le contrôleur duplique sur L et R) : les blocs
+ * sont des samples mono, sans expansion stéréo. Une voix PCM seule au gain
+ * unitaire est écrite directement depuis la flash, sans passer par le mixeur.
+ */
+namespace GotchiAudio {
+
+constexpr uint32_t SAMPLE_RATE = 16000;
+constexpr int MAX_VOICES = 4;
+constexpr int MIX_FRAMES = 128;   // 8 ms à 16 kHz : un bloc mixé = un buffer DMA
+constexpr int DMA_DESC = 4;       // Profondeur de la file DMA (32 ms)
+
+// Identifiant de voix renvoyé par play*/tone (0 = refusé, file pleine)
+using VoiceId = uint32_t;
+
+/// Crée la file et la tâche (le matériel est initialisé par la tâche). Idempotent.
+bool init();
+
+/// PCM 16-bit signé LE mono 16 kHz (sounds/*.h). gain : 0-255 (255 = tel quel).
+VoiceId play(const uint8_t* pcm, uint32_t len, uint8_t gain = 255);
+/// Asset IMA-ADPCM mono 16 kHz (format ima_adpcm.h), décodé au fil du mixage.
+VoiceId playAdpcm(const uint8_t* asset, uint32_t len, uint8_t gain = 255);
+/// Sinus freqHz pendant durationMs, amplitude volumePercent (0-100) (GotchiSynth).
+VoiceId tone(uint16_t freqHz, uint16_t durationMs, uint8_t volumePercent);
+/// Séquence de notes GotchiSynth (doit rester valide pendant la lecture).
+VoiceId playSequence(const GotchiSynth::Sequence& seq, uint8_t volumePercent);
+/// Coupe toutes les voix.
+void stopAll();
+/// Volume du codec (0-100), appliqué par la tâche.
+void setVolume(uint8_t volumePercent);
+
+/// true tant que la voix est en file ou en cours de lecture.
+bool isPlaying(VoiceId id);
+/// Attend la fin de la voix (timeoutMs = 0 : sans limite). false si timeout.
+bool wait(VoiceId id, uint32_t timeoutMs = 0);
+
+bool isReady();  // Matériel initialisé
+
+// Coût CPU de la production des blocs (tâche GotchiAudio, hors attente DMA)
+// et santé de la file DMA
+struct Stats {
+  uint64_t frames;        // Frames envoyées à l'I2S
+  uint64_t directFrames;  // Dont voix seule sans mixage (PCM zéro copie, ADPCM décodé en place)
+  uint32_t blocks;
+  uint64_t renderUs;      // Temps de mixage / décodage cumulé
+  // Demande (play/tone) -> premier sample en sortie, en µs : attente file +
+  // écriture I2S + blocs DMA déjà en file devant (estimés à 8 ms chacun)
+  Log2Histogram startUs;
+  uint32_t underruns;     // File DMA vide pendant une lecture (buffer rejoué en silence)
+  // Blocs DMA pleins en file au moment d'écrire un bloc (0 = au bord de l'underrun)
+  uint32_t fill[DMA_DESC + 1];
+};
+const Stats& getStats();
+/// Remise à zéro faite par la tâche, dans l'ordre de la file (ne bloque pas).
+void resetStats();
+
+} // namespace GotchiAudio
+
+#endif
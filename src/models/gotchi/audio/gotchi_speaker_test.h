@@ -7,8 +7,11 @@ namespace GotchiSpeakerTest {
   bool playTone(uint16_t freqHz = 440, uint16_t durationMs = 500, uint8_t volume = 70);
   bool playMelody();
   bool playSound(const uint8_t* pcmData, uint32_t pcmLen);
-  // Non-bloquant: lance le son dans une FreeRTOS task
+  // Non-bloquant: poste une voix au mixeur GotchiAudio (se mélange aux sons en cours)
   void playSoundAsync(const uint8_t* pcmData, uint32_t pcmLen);
+  // Variantes IMA-ADPCM (sounds/*.h générés en ADPCM, voir ima_adpcm.h)
+  bool playAdpcm(const uint8_t* data, uint32_t len);
+  void playAdpcmAsync(const uint8_t* data, uint32_t len);
   void playEatingSound();
   bool scanES8311();
   bool dumpRegisters();
@@ -0,0 +1,230 @@
+#include "gotchi_synth.h"
+#include "gotchi_audio.h"
+
+namespace {
+
+using namespace GotchiSynth;
+
+constexpr uint32_t RATE = GotchiAudio::SAMPLE_RATE;
+constexpr int32_t LEVEL_MAX = 1 << 24;
+
+enum Stage : uint8_t { ATTACK, DECAY, SUSTAIN, RELEASE, OFF };
+
+// round(32767 * sin(2 * pi * i / 256))
+const int16_t SINE_TABLE[256] = {
+  0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739,
+  9512, 10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+  18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811,
+  25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+  30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521,
+  32609, 32678, 32728, 32757, 32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+  32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571, 30273, 29956, 29621, 29268,
+  28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+  23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151,
+  15446, 14732, 14010, 13279, 12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+  6393, 5602, 4808, 4011, 3212, 2410, 1608, 804, 0, -804, -1608, -2410,
+  -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+  -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+  -20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+  -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+  -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+  -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+  -31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+  -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+  -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+  -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011,
+  -3212, -2410, -1608, -804,
+};
+
+uint32_t phaseIncFor(uint16_t hz) {
+  return (uint32_t)(((uint64_t)hz << 32) / RATE);
+}
+
+uint32_t msToFrames(uint16_t ms) {
+  return (uint32_t)ms * RATE / 1000;
+}
+
+const Note& currentNote(const Voice& v) {
+  return v.seq ? v.seq->notes[v.noteIdx] : v.single;
+}
+
+uint8_t noteCount(const Voice& v) {
+  return v.seq ? v.seq->count : 1;
+}
+
+// Sample de l'oscillateur (-32767..32767) pour la phase donnée
+int32_t oscillator(Wave wave, uint32_t phase) {
+  switch (wave) {
+    case Wave::Sine: {
+      // Interpolation linéaire entre deux entrées (8 bits de fraction)
+      const uint32_t idx = phase >> 24;
+      const int32_t frac = (phase >> 16) & 0xFF;
+      const int32_t a = SINE_TABLE[idx];
+      const int32_t b = SINE_TABLE[(idx + 1) & 0xFF];
+      return a + (((b - a) * frac) >> 8);
+    }
+    case Wave::Square:
+      return (phase & 0x80000000u) ? -32767 : 32767;
+    case Wave::Triangle: {
+      const int32_t p = (int32_t)(phase >> 16);  // 0-65535
+      return (p < 32768 ? p * 2 : (65535 - p) * 2) - 32767;
+    }
+    case Wave::Saw:
+      return (int32_t)(phase >> 16) - 32768;
+  }
+  return 0;
+}
+
+void enterDecay(Voice& v) {
+  const uint32_t d = msToFrames(v.env.decayMs);
+  if (d == 0 || v.sustainLevel >= LEVEL_MAX) {
+    v.level = v.sustainLevel;
+    v.stage = SUSTAIN;
+    return;
+  }
+  v.levelStep = (LEVEL_MAX - v.sustainLevel) / (int32_t)d;
+  v.stage = DECAY;
+}
+
+void enterRelease(Voice& v) {
+  const uint32_t r = v.noteFrames - v.releaseFrame;
+  if (r == 0 || v.level <= 0) {
+    v.level = 0;
+    v.stage = OFF;
+    return;
+  }
+  v.levelStep = v.level / (int32_t)r + 1;
+  v.stage = RELEASE;
+}
+
+void beginNote(Voice& v) {
+  const Note& n = currentNote(v);
+  v.noteFrame = 0;
+  v.noteFrames = msToFrames(n.durationMs);
+  const uint32_t rel = msToFrames(v.env.releaseMs);
+  v.releaseFrame = rel < v.noteFrames ? v.noteFrames - rel : 0;
+
+  v.phaseInc = phaseIncFor(n.freqHz);
+  v.phaseIncStep = 0;
+  if (n.freqHz && n.slideToHz && v.noteFrames) {
+    v.phaseIncStep = (int32_t)(((int64_t)phaseIncFor(n.slideToHz) - (int64_t)v.phaseInc) / (int64_t)v.noteFrames);
+  }
+
+  v.level = 0;
+  if (n.freqHz == 0) {
+    v.stage = OFF;
+    return;
+  }
+  const uint32_t a = msToFrames(v.env.attackMs);
+  if (a == 0) {
+    v.level = LEVEL_MAX;
+    enterDecay(v);
+  } else {
+    v.levelStep = LEVEL_MAX / (int32_t)a;
+    v.stage = ATTACK;
+  }
+}
+
+void init(Voice& v, const Envelope& env, Wave wave, uint8_t volumePercent) {
+  if (volumePercent > 100) volumePercent = 100;
+  v.env = env;
+  v.wave = wave;
+  v.gain = (uint16_t)(volumePercent * 256 / 100);
+  v.sustainLevel = env.sustain == 255 ? LEVEL_MAX : (int32_t)env.sustain << 16;
+  v.noteIdx = 0;
+  v.phase = 0;
+  beginNote(v);
+}
+
+// Notes prêtes à l'emploi
+const Note CHIRP_UP_NOTES[] = {{1200, 90, 2600}};
+const Note CHIRP_DOWN_NOTES[] = {{2400, 120, 900}};
+const Note MELODY_TEST_NOTES[] = {
+  {262, 400, 0}, {0, 80, 0},  // Do
+  {294, 400, 0}, {0, 80, 0},  // Ré
+  {330, 400, 0}, {0, 80, 0},  // Mi
+  {349, 400, 0}, {0, 80, 0},  // Fa
+  {392, 400, 0},              // Sol
+};
+
+} // namespace
+
+namespace GotchiSynth {
+
+const Sequence CHIRP_UP = {CHIRP_UP_NOTES, 1, Wave::Sine, {3, 20, 160, 40}};
+const Sequence CHIRP_DOWN = {CHIRP_DOWN_NOTES, 1, Wave::Triangle, {3, 30, 140, 50}};
+const Sequence MELODY_TEST = {
+  MELODY_TEST_NOTES, sizeof(MELODY_TEST_NOTES) / sizeof(MELODY_TEST_NOTES[0]),
+  Wave::Sine, {10, 60, 200, 60}
+};
+
+void start(Voice& v, const Sequence& seq, uint8_t volumePercent) {
+  v.seq = &seq;
+  init(v, seq.env, seq.wave, volumePercent);
+}
+
+void startTone(Voice& v, uint16_t freqHz, uint16_t durationMs, uint8_t volumePercent) {
+  v.seq = nullptr;
+  v.single = {freqHz, durationMs, 0};
+  init(v, TONE_ENVELOPE, Wave::Sine, volumePercent);
+}
+
+uint32_t totalFrames(const Voice& v, uint32_t sampleRate) {
+  uint32_t total = 0;
+  const uint8_t count = noteCount(v);
+  for (uint8_t i = 0; i < count; i++) {
+    const Note& n = v.seq ? v.seq->notes[i] : v.single;
+    total += (uint32_t)n.durationMs * sampleRate / 1000;
+  }
+  return total;
+}
+
+void render(Voice& v, int32_t* mix, int frames) {
+  const uint8_t count = noteCount(v);
+  for (int i = 0; i < frames; i++) {
+    // Note suivante (boucle : notes de durée nulle)
+    while (v.noteFrame >= v.noteFrames) {
+      if (v.noteIdx + 1 >= count) return;
+      v.noteIdx++;
+      beginNote(v);
+    }
+    if (v.noteFrame == v.releaseFrame && v.stage != OFF) enterRelease(v);
+
+    switch (v.stage) {
+      case ATTACK:
+        v.level += v.levelStep;
+        if (v.level >= LEVEL_MAX) {
+          v.level = LEVEL_MAX;
+          enterDecay(v);
+        }
+        break;
+      case DECAY:
+        v.level -= v.levelStep;
+        if (v.level <= v.sustainLevel) {
+          v.level = v.sustainLevel;
+          v.stage = SUSTAIN;
+        }
+        break;
+      case RELEASE:
+        v.level -= v.levelStep;
+        if (v.level <= 0) {
+          v.level = 0;
+          v.stage = OFF;
+        }
+        break;
+      default:
+        break;
+    }
+
+    if (v.level > 0) {
+      // Enveloppe ramenée en Q15, puis volume 0-256
+      const int32_t s = (oscillator(v.wave, v.phase) * (v.level >> 9)) >> 15;
+      mix[i] += (s * v.gain) >> 8;
+    }
+    v.phase += v.phaseInc;
+    v.phaseInc += (uint32_t)v.phaseIncStep;
+    v.noteFrame++;
+  }
+}
+
+} // namespace GotchiSynth
@@ -0,0 +1,83 @@
+#ifndef GOTCHI_SYNTH_H
+#define GOTCHI_SYNTH_H
+
+#include <cstdint>
+
+/**
+ * GotchiSynth — synthé entier pour les tones, chirps et mélodies.
+ *
+ * Oscillateur à accumulateur de phase 32 bits (table sinus de 256 entrées
+ * interpolée, ou carré / triangle / dent de scie calculés depuis la phase),
+ * enveloppe ADSR et séquences de notes. Tout est en entiers : pas de sinf ni
+ * de float sur la tâche audio.
+ *
+ * Une séquence est un tableau de notes joué bout à bout ; chaque note
+ * redéclenche l'enveloppe, et son release est pris dans sa durée (le tempo
+ * reste exact). freqHz = 0 : silence. slideToHz : glissando linéaire sur la
+ * note (chirps).
+ *
+ * Les séquences passées à GotchiAudio::playSequence() doivent rester valides
+ * pendant la lecture (static const).
+ */
+namespace GotchiSynth {
+
+enum class Wave : uint8_t { Sine, Square, Triangle, Saw };
+
+struct Envelope {
+  uint16_t attackMs;
+  uint16_t decayMs;
+  uint8_t sustain;     // Niveau de sustain (0-255)
+  uint16_t releaseMs;
+};
+
+struct Note {
+  uint16_t freqHz;     // 0 = silence
+  uint16_t durationMs;
+  uint16_t slideToHz;  // 0 = fréquence fixe
+};
+
+struct Sequence {
+  const Note* notes;
+  uint8_t count;
+  Wave wave;
+  Envelope env;
+};
+
+// Enveloppe des tone() : attaque et release courts, juste de quoi éviter les clics
+constexpr Envelope TONE_ENVELOPE = {5, 0, 255, 10};
+
+// Séquences prêtes à l'emploi (behaviors, serial)
+extern const Sequence CHIRP_UP;
+extern const Sequence CHIRP_DOWN;
+extern const Sequence MELODY_TEST;  // Do-Ré-Mi-Fa-Sol
+
+// État d'une voix (appartient au mixeur GotchiAudio)
+struct Voice {
+  const Sequence* seq;
+  Note single;          // Note de startTone() (seq == nullptr)
+  Envelope env;
+  Wave wave;
+  uint16_t gain;        // 0-256
+  uint8_t noteIdx;
+  uint32_t noteFrame, noteFrames, releaseFrame;
+  uint32_t phase;
+  uint32_t phaseInc;
+  int32_t phaseIncStep; // Glissando : variation de phaseInc par frame
+  int32_t level;        // Enveloppe, Q24 (1 << 24 = pleine échelle)
+  int32_t levelStep;
+  int32_t sustainLevel; // Q24
+  uint8_t stage;        // Attack, Decay, Sustain, Release, Off
+};
+
+/// Lance une séquence. volumePercent : 0-100.
+void start(Voice& v, const Sequence& seq, uint8_t volumePercent);
+/// Lance une note unique avec TONE_ENVELOPE.
+void startTone(Voice& v, uint16_t freqHz, uint16_t durationMs, uint8_t volumePercent);
+/// Durée totale en frames à sampleRate (somme des notes).
+uint32_t totalFrames(const Voice& v, uint32_t sampleRate);
+/// Ajoute frames samples à mix (int32, saturé par le mixeur).
+void render(Voice& v, int32_t* mix, int frames);
+
+} // namespace GotchiSynth
+
+#endif
@@ -0,0 +1,73 @@
+#include "ima_adpcm.h"
+
+namespace {
+
+// Tables IMA standard (identiques dans tools/wav_to_header.py)
+const int16_t STEP_TABLE[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+  253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+  3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+  11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+  32767
+};
+
+const int8_t INDEX_TABLE[16] = {
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+constexpr uint8_t MAX_INDEX = 88;
+
+} // namespace
+
+namespace ImaAdpcm {
+
+bool begin(State& st, const uint8_t* asset, uint32_t len) {
+  if (!asset || len <= (uint32_t)HEADER_BYTES || asset[2] > MAX_INDEX) return false;
+  st.predictor = (int16_t)(asset[0] | (asset[1] << 8));
+  st.index = asset[2];
+  st.data = asset + HEADER_BYTES;
+  st.highNibble = false;
+  return true;
+}
+
+void decode(State& st, int16_t* out, int frames) {
+  int32_t pred = st.predictor;
+  int index = st.index;
+  const uint8_t* p = st.data;
+  bool high = st.highNibble;
+
+  for (int i = 0; i < frames; i++) {
+    uint8_t code;
+    if (high) {
+      code = *p++ >> 4;
+    } else {
+      code = *p & 0x0F;
+    }
+    high = !high;
+
+    const int32_t step = STEP_TABLE[index];
+    int32_t diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+    pred += (code & 8) ? -diff : diff;
+    if (pred > 32767) pred = 32767;
+    if (pred < -32768) pred = -32768;
+
+    index += INDEX_TABLE[code];
+    if (index < 0) index = 0;
+    if (index > MAX_INDEX) index = MAX_INDEX;
+
+    out[i] = (int16_t)pred;
+  }
+
+  st.predictor = (int16_t)pred;
+  st.index = (uint8_t)index;
+  st.data = p;
+  st.highNibble = high;
+}
+
+} // namespace ImaAdpcm
@@ -0,0 +1,46 @@
+#ifndef IMA_ADPCM_H
+#define IMA_ADPCM_H
+
+#include <cstdint>
+
+/**
+ * ImaAdpcm — décodeur IMA-ADPCM 4 bits en flux, pour les sons embarqués
+ * (headers de sounds/ générés par tools/wav_to_header.py, format par défaut).
+ *
+ * Format d'un asset :
+ *   octets 0-1 : prédicteur initial (int16 LE)
+ *   octet  2   : index de pas initial (0-88)
+ *   octet  3   : réservé (0)
+ *   puis 1 nibble par sample, nibble bas en premier (convention WAV IMA)
+ * Soit 4:1 par rapport au PCM 16 bits, sans en-tête par bloc : l'encodeur
+ * suit l'état du décodeur, l'erreur ne dérive pas.
+ *
+ * Le décodage se fait par blocs de BLOCK_FRAMES samples dans un petit buffer
+ * du mixeur : quelques additions et décalages par sample, pas de division.
+ */
+namespace ImaAdpcm {
+
+constexpr int HEADER_BYTES = 4;
+constexpr int BLOCK_FRAMES = 64;
+
+struct State {
+  const uint8_t* data;  // Prochain octet de nibbles
+  bool highNibble;      // false : nibble bas de *data
+  int16_t predictor;
+  uint8_t index;
+};
+
+/// Nombre de samples d'un asset de len octets (en-tête compris).
+inline uint32_t sampleCount(uint32_t len) {
+  return len > (uint32_t)HEADER_BYTES ? (len - HEADER_BYTES) * 2 : 0;
+}
+
+/// Initialise l'état depuis l'en-tête. false si l'asset est invalide.
+bool begin(State& st, const uint8_t* asset, uint32_t len);
+
+/// Décode frames samples (<= BLOCK_FRAMES conseillé) dans out.
+void decode(State& st, int16_t* out, int frames);
+
+} // namespace ImaAdpcm
+
+#endif
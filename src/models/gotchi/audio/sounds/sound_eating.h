@@ -1,508 +1,138 @@
-// Auto-generated by wav_to_header.py  do not edit
-// Source: eating, 16000Hz mono 16-bit, 3952 samples, 247ms
+// Auto-generated by wav_to_header.py — do not edit
+// Source: eating, 16000Hz mono IMA-ADPCM 4-bit, 3952 samples, 247ms
 #pragma once
 #include <cstdint>
 
 static const uint32_t EATING_SAMPLE_RATE = 16000;
 static const uint32_t EATING_SAMPLES = 3952;
 static const uint32_t EATING_DURATION_MS = 247;
-static const uint32_t EATING_PCM_LEN = 7904;
+static const uint32_t EATING_ADPCM_LEN = 1980;
 
-// PCM data: 16-bit signed LE, mono, 16000Hz
-// Pour jouer en I2S stereo, dupliquer chaque sample sur L+R
-static const uint8_t EATING_PCM[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFD, 0xFF,
-  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x04, 0x00,
-  0xFF, 0xFF, 0xFE, 0xFF, 0x06, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0x05, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFD, 0xFF, 0xFC, 0xFF, 0x03, 0x00, 0x04, 0x00, 0x0B, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x06, 0x00,
-  0x00, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF, 0x08, 0x00, 0xFB, 0xFF, 0xF9, 0xFF,
-  0xFE, 0xFF, 0x08, 0x00, 0xFD, 0xFF, 0xFC, 0xFF, 0x0F, 0x00, 0x05, 0x00, 0x14, 0x00, 0x0A, 0x00,
-  0x11, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x08, 0x00, 0x0C, 0x00, 0xF9, 0xFF, 0x00, 0x00, 0x07, 0x00,
-  0xFB, 0xFF, 0x01, 0x00, 0xF3, 0xFF, 0x02, 0x00, 0x17, 0x00, 0x02, 0x00, 0x04, 0x00, 0x1C, 0x00,
-  0x14, 0x00, 0x07, 0x00, 0xFE, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0xCD, 0xFF, 0x44, 0x00, 0xA5, 0xFF,
-  0xE9, 0xFF, 0x10, 0x00, 0xDE, 0xFF, 0xE6, 0xFF, 0xFD, 0xFF, 0xED, 0xFF, 0xE8, 0xFF, 0xE4, 0xFF,
-  0x0D, 0x00, 0xFB, 0xFF, 0xFA, 0xFF, 0x0E, 0x00, 0xDD, 0xFF, 0xD1, 0xFF, 0xDF, 0xFF, 0xE3, 0xFF,
-  0xE1, 0xFF, 0xB1, 0xFF, 0xEB, 0xFF, 0xE6, 0xFF, 0xA6, 0xFF, 0xF9, 0xFF, 0xDF, 0xFF, 0xC9, 0xFF,
-  0xBC, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x9A, 0xFF, 0xE8, 0xFF, 0xE4, 0xFF, 0xFA, 0xFF, 0xD6, 0xFF,
-  0xBA, 0xFF, 0xD7, 0xFF, 0xC4, 0xFF, 0xE3, 0xFF, 0x11, 0x00, 0xAB, 0xFF, 0x00, 0x00, 0x9A, 0xFF,
-  0xFD, 0xFF, 0xE4, 0xFF, 0xB9, 0xFF, 0x9C, 0xFF, 0x7E, 0xFF, 0xAF, 0xFF, 0x0D, 0x00, 0xA9, 0xFF,
-  0xE7, 0xFF, 0xAA, 0xFF, 0x2B, 0x00, 0x35, 0x00, 0xB9, 0xFF, 0x93, 0xFF, 0x22, 0x00, 0x30, 0x00,
-  0xFB, 0xFF, 0xBB, 0xFF, 0x61, 0xFF, 0x76, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0x67, 0xFF, 0xB0, 0xFF,
-  0xA1, 0xFF, 0xC8, 0xFF, 0xFD, 0xFF, 0xF5, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0xB9, 0xFF, 0xA6, 0xFF,
-  0x6D, 0xFF, 0x8F, 0xFE, 0x2E, 0x00, 0x78, 0xFE, 0xF0, 0x00, 0x56, 0xFF, 0xC9, 0xFF, 0xC7, 0x00,
-  0x46, 0x00, 0x37, 0x00, 0xF3, 0xFF, 0x9C, 0x00, 0x58, 0x00, 0xFA, 0xFE, 0x14, 0x00, 0x29, 0x00,
-  0xAF, 0xFF, 0x2A, 0x00, 0x2E, 0xFF, 0xF6, 0xFF, 0xA6, 0x00, 0x14, 0x00, 0xE8, 0x00, 0x54, 0xFF,
-  0x24, 0x00, 0x5B, 0x01, 0x08, 0x00, 0x01, 0x00, 0x5E, 0x00, 0xEF, 0x00, 0xB2, 0x01, 0xC6, 0xFF,
-  0x6A, 0x00, 0x2C, 0x00, 0x01, 0x00, 0xE9, 0x00, 0x28, 0x00, 0xCE, 0xFF, 0x15, 0x00, 0x6B, 0x00,
-  0x0D, 0x01, 0x5F, 0x00, 0x52, 0x01, 0xE9, 0x01, 0xC9, 0x01, 0xFF, 0x00, 0xD4, 0x00, 0x87, 0x00,
-  0x89, 0x00, 0xF2, 0x00, 0x49, 0xFF, 0x12, 0x00, 0x8D, 0x00, 0x5D, 0x02, 0x5D, 0x00, 0xBA, 0xFF,
-  0x14, 0x00, 0x8C, 0x00, 0xE6, 0x00, 0x94, 0x00, 0x62, 0x00, 0x80, 0x01, 0xD8, 0xFF, 0x9F, 0x00,
-  0x64, 0x00, 0x83, 0xFF, 0x14, 0x00, 0x52, 0x00, 0xC8, 0xFF, 0x29, 0x01, 0x91, 0xFF, 0x46, 0x00,
-  0x0A, 0x00, 0x24, 0x00, 0xB0, 0x00, 0x90, 0xFF, 0x42, 0x00, 0xF2, 0x00, 0x53, 0x00, 0xF5, 0x00,
-  0xC8, 0xFE, 0x54, 0x00, 0x28, 0x00, 0x39, 0x00, 0x63, 0x00, 0x24, 0x00, 0x4B, 0x01, 0xFA, 0x00,
-  0x47, 0x01, 0xDE, 0x01, 0xBE, 0x00, 0x94, 0x01, 0x82, 0xFE, 0x34, 0x01, 0x44, 0xFC, 0xE9, 0xFD,
-  0x0A, 0x01, 0xBB, 0xFE, 0x1C, 0xFF, 0xE7, 0x00, 0x2F, 0x00, 0xCF, 0x02, 0x12, 0x00, 0x30, 0x03,
-  0xA2, 0x01, 0x8B, 0xFE, 0x8F, 0x01, 0x37, 0xFE, 0x54, 0xFF, 0xD9, 0x00, 0xFE, 0xFE, 0x29, 0x00,
-  0xAA, 0x00, 0xA7, 0xFF, 0x5F, 0x01, 0x86, 0xFE, 0x72, 0x02, 0xAF, 0x01, 0x07, 0x00, 0x74, 0x02,
-  0x23, 0x01, 0xFB, 0x00, 0x17, 0x00, 0xCB, 0xFF, 0xFA, 0x00, 0xD3, 0xFD, 0xA5, 0xFE, 0x0F, 0x01,
-  0x04, 0xFF, 0x50, 0xFF, 0x1B, 0x00, 0x8D, 0x00, 0x1B, 0x02, 0x55, 0x00, 0x0F, 0x01, 0xC9, 0x00,
-  0x3E, 0x00, 0xF0, 0x00, 0xE5, 0xFE, 0x12, 0x00, 0x74, 0x00, 0xF8, 0xFE, 0xD4, 0xFE, 0x89, 0xFE,
-  0x28, 0xFF, 0xB8, 0xFF, 0x8D, 0xFF, 0x9E, 0x00, 0x18, 0x01, 0x4A, 0x00, 0xB6, 0x00, 0x7A, 0x00,
-  0xD7, 0xFE, 0x97, 0xFF, 0x9A, 0xFF, 0x84, 0xFF, 0x60, 0xFF, 0x0A, 0xFE, 0xCF, 0x00, 0x39, 0xFF,
-  0x7D, 0xFD, 0x66, 0x00, 0x2A, 0x01, 0x9B, 0x01, 0xE9, 0xFF, 0xAD, 0x00, 0x78, 0x01, 0x2E, 0x00,
-  0xA1, 0xFF, 0x06, 0x00, 0x75, 0x00, 0xC7, 0xFE, 0x95, 0x00, 0x79, 0xFF, 0xDA, 0xFE, 0x11, 0x00,
-  0x3E, 0xFE, 0x8E, 0x00, 0x67, 0x00, 0x6F, 0x01, 0x83, 0xFF, 0x17, 0x02, 0x92, 0x00, 0xC6, 0x01,
-  0x4B, 0xFD, 0x5B, 0x00, 0x62, 0xFF, 0x41, 0xFC, 0x5B, 0x00, 0xEC, 0x00, 0x5F, 0x01, 0x40, 0x01,
-  0x9F, 0xFE, 0x9A, 0x01, 0x18, 0xFF, 0xBF, 0xFF, 0x0B, 0x01, 0x65, 0x00, 0x20, 0x01, 0xB7, 0x02,
-  0x7E, 0xFF, 0x26, 0x00, 0x70, 0xFE, 0xB8, 0x00, 0xC2, 0x02, 0x8B, 0xFD, 0x17, 0xFF, 0x08, 0x02,
-  0xDD, 0xFF, 0x4E, 0xFF, 0x1B, 0xFD, 0xC4, 0x00, 0xDB, 0x01, 0xDF, 0xFF, 0x56, 0x01, 0x2A, 0xFF,
-  0x33, 0x00, 0xCA, 0x00, 0xF8, 0xFE, 0x7B, 0xFD, 0xC9, 0xFE, 0x76, 0xFE, 0xCB, 0xFE, 0xC3, 0xFB,
-  0x81, 0xFE, 0x39, 0xFF, 0x18, 0xFF, 0x0F, 0x00, 0x37, 0xFE, 0xE5, 0xFE, 0x64, 0xFE, 0x2B, 0xFF,
-  0xBC, 0xFE, 0xEF, 0xFE, 0xC9, 0xFE, 0xF9, 0xFE, 0x5F, 0xFD, 0x9A, 0xFE, 0x64, 0xFD, 0x67, 0xFE,
-  0x45, 0xFF, 0x01, 0xFF, 0x48, 0x01, 0x6E, 0x00, 0x25, 0x00, 0x5D, 0xFD, 0x14, 0xFE, 0xC5, 0xFF,
-  0xF8, 0xFE, 0xE5, 0xFD, 0xF7, 0xFD, 0x99, 0xFE, 0x92, 0xFF, 0xD9, 0xFE, 0x19, 0xFE, 0x98, 0xFF,
-  0x48, 0xFE, 0x86, 0xFF, 0x45, 0x00, 0x3A, 0x00, 0x7E, 0xFE, 0x68, 0x00, 0xC2, 0xFF, 0x51, 0xFC,
-  0x5B, 0xFD, 0xBF, 0xFC, 0x59, 0xFD, 0xAE, 0xFF, 0xB6, 0xFF, 0xC5, 0xFF, 0x50, 0xFD, 0xD7, 0xFD,
-  0xB3, 0x00, 0x56, 0xFE, 0xEC, 0xFB, 0xD1, 0xFE, 0x43, 0xFF, 0x1D, 0xFF, 0x35, 0xFD, 0xCF, 0xFC,
-  0x95, 0xFD, 0x4D, 0xFE, 0x4E, 0xFF, 0xB3, 0xFE, 0x41, 0xFD, 0xD9, 0xFE, 0xDC, 0xFE, 0xCD, 0xFE,
-  0x9D, 0xFE, 0x13, 0xFF, 0x6B, 0x02, 0x1A, 0x01, 0x8F, 0xFF, 0xCD, 0xFF, 0x7E, 0x00, 0xB6, 0x00,
-  0xB2, 0xFE, 0x34, 0xFE, 0x8A, 0x00, 0xE0, 0xFE, 0x9D, 0xFF, 0xA2, 0xFE, 0xE1, 0xFE, 0xF3, 0xFF,
-  0xA0, 0xFF, 0x45, 0x00, 0x82, 0xFF, 0x4A, 0x00, 0x61, 0x01, 0x16, 0x01, 0x8F, 0xFE, 0xF1, 0xFF,
-  0x1C, 0x00, 0x64, 0x01, 0x22, 0xFF, 0x7E, 0xFE, 0x0D, 0xFF, 0x2B, 0x01, 0xED, 0xFF, 0x3F, 0x00,
-  0x7A, 0x00, 0x75, 0x02, 0xF3, 0xFF, 0x13, 0x01, 0x0A, 0xFE, 0x78, 0x00, 0xF1, 0xFF, 0x11, 0x00,
-  0x6F, 0xFF, 0x19, 0xFE, 0x15, 0x02, 0xB4, 0xFF, 0xE7, 0xFD, 0xAE, 0x01, 0x9D, 0xFE, 0x13, 0x02,
-  0x91, 0xFE, 0x7F, 0xFF, 0x8C, 0xFF, 0x21, 0x01, 0xD6, 0x01, 0x80, 0xFE, 0x10, 0x00, 0xBA, 0x01,
-  0xBB, 0xFF, 0xC8, 0x01, 0xFA, 0xFD, 0xCA, 0x00, 0xAB, 0x00, 0x92, 0x00, 0x7B, 0xFE, 0x34, 0xFE,
-  0x59, 0x00, 0xEE, 0x00, 0xD7, 0x00, 0xD1, 0xFF, 0x30, 0x00, 0xD4, 0x00, 0xEE, 0x01, 0x9F, 0x01,
-  0x4B, 0xFF, 0xC4, 0xFE, 0xC2, 0x00, 0x2B, 0x02, 0xB5, 0xFF, 0x35, 0xFF, 0x13, 0xFF, 0x68, 0xFF,
-  0x9A, 0x01, 0x89, 0xFE, 0x2B, 0x00, 0x0F, 0x00, 0x63, 0x01, 0x84, 0x02, 0xFA, 0x01, 0x67, 0x01,
-  0x13, 0x04, 0xA5, 0x01, 0xDB, 0x01, 0xA8, 0xFE, 0xA1, 0xFC, 0xA2, 0x02, 0xC0, 0x00, 0x1A, 0x03,
-  0x5C, 0xFF, 0x90, 0x02, 0x71, 0x04, 0x2F, 0x04, 0x0C, 0x04, 0xDE, 0x02, 0x91, 0x02, 0x99, 0x04,
-  0x42, 0x02, 0x27, 0x01, 0x63, 0x00, 0x29, 0x02, 0xAF, 0x02, 0xAA, 0x00, 0xF7, 0xFE, 0x8F, 0x01,
-  0x17, 0x01, 0xF0, 0x01, 0x12, 0x02, 0x32, 0x02, 0xDA, 0x03, 0xC1, 0x04, 0xCF, 0x03, 0x7B, 0x02,
-  0x08, 0x01, 0x84, 0x01, 0x73, 0x01, 0xBD, 0x00, 0xD5, 0xFF, 0x4E, 0xFF, 0x9C, 0x00, 0x08, 0x02,
-  0xBC, 0x00, 0x4F, 0x01, 0x73, 0x01, 0x74, 0x03, 0x06, 0x04, 0x2F, 0x02, 0xD2, 0x01, 0xA4, 0x02,
-  0x72, 0x02, 0xBE, 0x02, 0xE1, 0x00, 0xBC, 0x03, 0xF1, 0x02, 0x64, 0x00, 0x1E, 0x01, 0xE2, 0x00,
-  0x77, 0x00, 0xB0, 0x01, 0x6F, 0x01, 0x40, 0x02, 0xCE, 0x01, 0x10, 0x03, 0xD0, 0x02, 0xEE, 0x02,
-  0xB0, 0x02, 0x97, 0x00, 0x81, 0x02, 0x74, 0x02, 0x56, 0x01, 0xF1, 0xFF, 0x03, 0x00, 0x4A, 0xFF,
-  0x5B, 0x00, 0xAE, 0xFE, 0x37, 0x00, 0xA9, 0x02, 0x3D, 0x01, 0x3D, 0x03, 0x33, 0x03, 0x10, 0x00,
-  0x5B, 0x01, 0x24, 0x01, 0x18, 0xFF, 0x22, 0x00, 0x45, 0xFF, 0x21, 0x01, 0x2F, 0xFF, 0xC1, 0xFE,
-  0x6F, 0xFE, 0xD9, 0xFF, 0xB9, 0x00, 0xC7, 0x01, 0xC3, 0x00, 0x90, 0xFF, 0x3E, 0x00, 0xA8, 0x00,
-  0xD0, 0x00, 0x14, 0xFF, 0xC3, 0xFF, 0xBF, 0xFE, 0xE9, 0xFE, 0x6A, 0xFF, 0xAE, 0xFF, 0xBF, 0xFF,
-  0xFC, 0xFE, 0x86, 0xFF, 0x90, 0x01, 0x5F, 0x01, 0x35, 0x00, 0x40, 0x00, 0x67, 0xFF, 0xA7, 0x04,
-  0x15, 0xFF, 0xB6, 0xFD, 0x6F, 0xFE, 0x61, 0x00, 0x79, 0xFF, 0x78, 0x01, 0x38, 0xFE, 0x32, 0x01,
-  0x8D, 0xFE, 0x63, 0xFF, 0xE6, 0xFE, 0x5C, 0x00, 0xE0, 0xFF, 0x24, 0x01, 0x4C, 0xFF, 0x58, 0x02,
-  0x4D, 0x00, 0x60, 0x02, 0x40, 0x00, 0x56, 0xFF, 0x62, 0xFE, 0xE7, 0x00, 0x85, 0x00, 0xAA, 0x00,
-  0x17, 0xFF, 0x92, 0x00, 0x40, 0x01, 0xA4, 0x00, 0x07, 0x02, 0x55, 0x02, 0x4C, 0x01, 0xAC, 0x01,
-  0x94, 0x01, 0xE7, 0x02, 0x41, 0x01, 0x24, 0x03, 0x83, 0xFC, 0xF2, 0xFD, 0x79, 0xFD, 0x4F, 0xFF,
-  0xA4, 0x04, 0xB9, 0xF8, 0xF3, 0x02, 0x8B, 0x01, 0xC5, 0xFD, 0x58, 0x03, 0x29, 0xFD, 0x73, 0x05,
-  0xB2, 0x03, 0xFD, 0xFA, 0x42, 0xFD, 0xCA, 0x01, 0x4F, 0x04, 0x16, 0xFE, 0xDE, 0x00, 0xEF, 0x02,
-  0xA0, 0x00, 0xEF, 0xFD, 0x83, 0xFE, 0x2A, 0x07, 0xA2, 0xFF, 0xFE, 0x00, 0x31, 0xFF, 0x3A, 0x06,
-  0x14, 0x07, 0xA1, 0xFE, 0xE0, 0x00, 0x3D, 0x00, 0x32, 0xFF, 0xFF, 0x05, 0x0F, 0xFD, 0x2A, 0xF9,
-  0x47, 0xFA, 0x0B, 0x0A, 0xE2, 0xFC, 0x77, 0xF4, 0x8D, 0x09, 0x1C, 0xF1, 0xD8, 0xEE, 0x6A, 0xF7,
-  0x8F, 0x04, 0x82, 0xFE, 0xBC, 0xEF, 0x6D, 0x00, 0x53, 0xF8, 0x22, 0xF7, 0x4B, 0xF7, 0xF0, 0xFA,
-  0x23, 0xFD, 0xB5, 0xFD, 0xE2, 0xFB, 0xF4, 0xFB, 0xA0, 0xFA, 0xFE, 0xFF, 0xCD, 0xF1, 0x3B, 0xF7,
-  0xF4, 0xF8, 0xB0, 0x03, 0xA8, 0xFC, 0x90, 0xFA, 0x77, 0xF9, 0xE1, 0x04, 0xCF, 0x03, 0x93, 0xF1,
-  0xE5, 0xFF, 0x34, 0xFE, 0x39, 0xFE, 0x36, 0xF9, 0x4A, 0xF7, 0xD9, 0x08, 0x9B, 0xEA, 0xA2, 0xFB,
-  0x79, 0x04, 0x02, 0xF7, 0x98, 0xFC, 0x77, 0xF6, 0x74, 0xF7, 0x1B, 0xFA, 0x4F, 0x04, 0xEA, 0xFB,
-  0xEF, 0xF8, 0x6F, 0xFE, 0x4A, 0x01, 0x99, 0x00, 0xEA, 0xFB, 0xF4, 0xFC, 0x5F, 0xFC, 0x03, 0x00,
-  0x5D, 0xFF, 0x84, 0xFE, 0x0B, 0x01, 0x0A, 0x05, 0x36, 0xFE, 0x9B, 0x01, 0x51, 0x01, 0x7B, 0x05,
-  0xE6, 0x02, 0x58, 0x03, 0x2F, 0x06, 0x1A, 0x03, 0xE6, 0xFF, 0xDC, 0x00, 0xBB, 0x00, 0x11, 0x04,
-  0x02, 0xFE, 0xFE, 0x05, 0x83, 0x05, 0xEE, 0x03, 0x71, 0x06, 0x7D, 0x02, 0xED, 0x05, 0x6B, 0x03,
-  0xD5, 0x06, 0x6F, 0x04, 0xC6, 0x04, 0x73, 0x02, 0xE7, 0x02, 0x57, 0x04, 0x5D, 0x00, 0x14, 0x01,
-  0xCB, 0xFF, 0x6D, 0xFD, 0x64, 0x04, 0x77, 0xFE, 0x60, 0x00, 0x0E, 0x00, 0x24, 0x03, 0xC7, 0x02,
-  0x4C, 0x02, 0x7E, 0x01, 0xBB, 0x04, 0xE8, 0x00, 0x1A, 0xFE, 0xE4, 0x00, 0x66, 0xFE, 0x2C, 0xFF,
-  0x11, 0xFE, 0x1B, 0x00, 0x22, 0x00, 0x48, 0xFF, 0xC9, 0x04, 0xE0, 0x01, 0x9F, 0x02, 0x20, 0x01,
-  0x2A, 0xFE, 0x79, 0x03, 0xAF, 0xFA, 0xE0, 0x00, 0x48, 0x00, 0x19, 0x03, 0x65, 0x0A, 0x0F, 0xFF,
-  0x9F, 0xF9, 0x18, 0xFF, 0xE3, 0xFB, 0xC4, 0xFD, 0xD3, 0x04, 0xC6, 0xFE, 0xC0, 0x00, 0xA9, 0x00,
-  0x1C, 0x04, 0x5A, 0x00, 0xA5, 0xFE, 0xB4, 0xFF, 0xAD, 0x00, 0x02, 0x01, 0xD8, 0x00, 0xDE, 0xFF,
-  0x4F, 0x02, 0xBE, 0xFD, 0x45, 0xFE, 0x9D, 0xFF, 0x18, 0x00, 0x3D, 0xFF, 0x7B, 0xFF, 0x1F, 0x02,
-  0x7E, 0xFF, 0x51, 0x00, 0x2D, 0xFE, 0x82, 0x01, 0x57, 0x00, 0x25, 0x01, 0xCA, 0x00, 0x24, 0x00,
-  0x05, 0x00, 0x3B, 0xFF, 0x00, 0xFF, 0x35, 0xFE, 0x78, 0xFD, 0x5D, 0x03, 0xEB, 0xFC, 0x9C, 0x00,
-  0x5A, 0xFD, 0xEC, 0xFC, 0x2E, 0x04, 0xDB, 0xFC, 0xD0, 0xFC, 0xA4, 0xFD, 0xAA, 0xFF, 0x5B, 0x04,
-  0x55, 0xFE, 0x96, 0xFF, 0x07, 0x01, 0x93, 0x03, 0xCF, 0x00, 0xEF, 0x01, 0x9E, 0xFF, 0x92, 0x01,
-  0xCD, 0x02, 0x86, 0x02, 0x63, 0x03, 0xA0, 0xFE, 0xA6, 0xFE, 0x07, 0xFE, 0xB5, 0x02, 0x2D, 0xFE,
-  0x04, 0xFF, 0x32, 0x03, 0xA4, 0x03, 0x73, 0x05, 0x57, 0x05, 0x19, 0x03, 0x4B, 0x04, 0xC9, 0x05,
-  0xB0, 0x06, 0xBB, 0x04, 0x29, 0x04, 0x37, 0x06, 0xD3, 0x01, 0xBC, 0x05, 0x49, 0x04, 0xF9, 0xFF,
-  0x10, 0xFF, 0x7A, 0x04, 0x2A, 0x01, 0x1C, 0x05, 0x63, 0x02, 0x4F, 0x06, 0xE7, 0x05, 0xC6, 0x06,
-  0xEF, 0x05, 0xC4, 0x06, 0x03, 0x0A, 0x7C, 0x00, 0x31, 0xFB, 0xC8, 0x04, 0xA6, 0x0B, 0x07, 0xE8,
-  0x53, 0x18, 0x21, 0x06, 0xB8, 0xE8, 0xB9, 0xFF, 0x1D, 0xFE, 0x11, 0xFD, 0x08, 0xF9, 0xFD, 0x03,
-  0xE6, 0xFB, 0x62, 0xE7, 0x0F, 0x0F, 0x8A, 0xFE, 0x47, 0x1C, 0xEC, 0xF5, 0x4B, 0xE3, 0x5E, 0xF6,
-  0x7A, 0xF3, 0x49, 0xF8, 0x07, 0xFE, 0xBE, 0xF1, 0xF6, 0xE5, 0xCB, 0xE9, 0x66, 0xE9, 0x5D, 0xF4,
-  0x84, 0x02, 0x51, 0xF0, 0x28, 0xFA, 0xB9, 0xFB, 0xDB, 0xF2, 0x2B, 0x02, 0xEE, 0x00, 0xED, 0xFE,
-  0xDD, 0xFD, 0x5B, 0x00, 0x97, 0xFF, 0x6C, 0x01, 0x39, 0xFB, 0xF5, 0x02, 0x3A, 0xF5, 0x4D, 0xFB,
-  0x88, 0xFF, 0xFD, 0x03, 0xE6, 0x05, 0x62, 0x05, 0x3A, 0x06, 0x2C, 0xFE, 0x93, 0x05, 0xDC, 0x0A,
-  0x6B, 0x05, 0x76, 0x0B, 0x71, 0x09, 0xCF, 0x04, 0xBE, 0x09, 0xC2, 0x09, 0xE4, 0x05, 0xC8, 0x05,
-  0x33, 0x04, 0xA1, 0x05, 0x1B, 0x06, 0xD2, 0x08, 0x64, 0x08, 0x02, 0x09, 0x32, 0x06, 0xD6, 0x08,
-  0x9C, 0x0A, 0x78, 0x05, 0xBD, 0x06, 0x25, 0x07, 0x50, 0x06, 0x7B, 0x04, 0xE5, 0x04, 0x00, 0x03,
-  0xE1, 0xFF, 0x39, 0xFF, 0x32, 0x01, 0x27, 0x00, 0x33, 0xFE, 0x49, 0xFD, 0x96, 0xFD, 0x12, 0xFF,
-  0xEA, 0xFD, 0x49, 0xFD, 0xFF, 0xFD, 0x9C, 0xFC, 0x62, 0xFB, 0x5D, 0xFC, 0x7F, 0xFC, 0xB2, 0xFA,
-  0xB5, 0xF9, 0xA7, 0xF8, 0x6A, 0xF9, 0x4D, 0xF7, 0xE4, 0xF8, 0xA7, 0xF8, 0xBA, 0xF7, 0x94, 0xF9,
-  0xF9, 0xF5, 0xE8, 0xF6, 0x5B, 0xFB, 0xBA, 0xF7, 0x8F, 0xF7, 0x33, 0xF9, 0xC3, 0xFE, 0x01, 0xFD,
-  0xFE, 0xF9, 0x94, 0xFD, 0xAB, 0xF8, 0x13, 0xF8, 0x99, 0xFA, 0xFD, 0xFC, 0x27, 0xFA, 0x15, 0xFE,
-  0xDA, 0xFE, 0xD6, 0xFC, 0x3F, 0x04, 0xF0, 0xEB, 0x93, 0xF3, 0xFE, 0x09, 0x4F, 0x02, 0x9F, 0xF4,
-  0x8B, 0xEE, 0xE8, 0xFF, 0x3D, 0xF8, 0x37, 0xF6, 0x5D, 0x12, 0xC7, 0xFE, 0x4E, 0xE6, 0xAE, 0xF2,
-  0x81, 0x0A, 0xF6, 0xFC, 0x7D, 0x05, 0x4A, 0x02, 0x72, 0x04, 0xDE, 0x0A, 0x2F, 0x0C, 0x54, 0x05,
-  0x65, 0xF9, 0x22, 0xFF, 0xAC, 0xFC, 0x61, 0xFE, 0x37, 0xF2, 0x2B, 0xF8, 0x18, 0xF9, 0xBE, 0xF7,
-  0xD6, 0xF3, 0x26, 0xF9, 0x10, 0xFF, 0x70, 0xFB, 0x18, 0x09, 0x99, 0x05, 0xEE, 0xFD, 0x4F, 0x05,
-  0x35, 0x0A, 0xD1, 0x07, 0xCC, 0x01, 0xFC, 0x01, 0xFD, 0x08, 0x83, 0x01, 0x19, 0x12, 0x1C, 0x08,
-  0x24, 0xFC, 0x35, 0x00, 0x69, 0x0E, 0x00, 0x13, 0xE2, 0x11, 0x4B, 0x00, 0x58, 0x14, 0xBD, 0x15,
-  0xFA, 0x0C, 0x69, 0x00, 0xB2, 0x0A, 0x09, 0x09, 0xAC, 0x09, 0x9B, 0x14, 0xE4, 0x0D, 0x63, 0xFC,
-  0xF0, 0x0B, 0xD1, 0x0A, 0xA3, 0x07, 0x23, 0x0C, 0x5C, 0x0A, 0x8C, 0x0E, 0x32, 0x0A, 0x3A, 0x0A,
-  0x6D, 0x0A, 0x69, 0x07, 0x6D, 0x05, 0xD1, 0x05, 0xDC, 0x07, 0x1F, 0x04, 0xDC, 0x01, 0x0C, 0x06,
-  0x61, 0x03, 0x0A, 0x03, 0x29, 0x00, 0x33, 0x03, 0xED, 0x02, 0x10, 0x02, 0x9D, 0xFB, 0xFF, 0xFF,
-  0xAD, 0xFA, 0xDF, 0xFB, 0x38, 0xFF, 0x88, 0xFC, 0x51, 0xFA, 0xD9, 0xF9, 0xC1, 0xFA, 0x34, 0xFA,
-  0x01, 0xFC, 0xF1, 0xFA, 0x75, 0xFB, 0xF6, 0xFA, 0xE2, 0xF9, 0x2F, 0xFB, 0xBB, 0xFC, 0x81, 0xFC,
-  0x6E, 0xFD, 0xEE, 0xF7, 0x0E, 0xFC, 0x91, 0xFA, 0x44, 0x00, 0xC1, 0xFB, 0xC0, 0xFC, 0x49, 0xFB,
-  0x76, 0xF7, 0x8A, 0x02, 0x80, 0xFB, 0x9E, 0xFA, 0xEE, 0xFD, 0x96, 0xF9, 0x86, 0xFA, 0x0A, 0x00,
-  0xAB, 0xF4, 0xD2, 0xFC, 0xA1, 0xFB, 0x03, 0xFF, 0xBA, 0xF7, 0x8A, 0xF9, 0xCA, 0xFC, 0xAA, 0x01,
-  0xEF, 0xF1, 0x34, 0xEF, 0x05, 0xF5, 0xAF, 0x04, 0xE6, 0xF2, 0x45, 0x02, 0xA3, 0xFA, 0xF4, 0xFC,
-  0x78, 0xE3, 0xF2, 0xF8, 0x5F, 0xFE, 0x46, 0xFB, 0x2E, 0xE3, 0xBF, 0x0B, 0x60, 0xED, 0xC2, 0xE9,
-  0x21, 0xF7, 0x98, 0xF2, 0x15, 0xFF, 0xAA, 0xFD, 0xF7, 0xFE, 0x43, 0xF3, 0xF3, 0xF5, 0x0F, 0x04,
-  0xE1, 0x06, 0x21, 0x06, 0x1F, 0x06, 0x20, 0x05, 0x39, 0x0E, 0x11, 0x10, 0xA3, 0x12, 0x4B, 0x13,
-  0x47, 0x0E, 0xD1, 0x0D, 0xB2, 0x0C, 0x03, 0x14, 0x4C, 0x11, 0x80, 0x10, 0xE8, 0x16, 0x29, 0x17,
-  0x55, 0x11, 0x82, 0x10, 0x05, 0x0E, 0xB0, 0x13, 0xD3, 0x0F, 0xFA, 0x0A, 0xFF, 0x0E, 0x6E, 0x0A,
-  0x5D, 0x04, 0xE6, 0x05, 0x1E, 0x08, 0x91, 0x04, 0xFE, 0x04, 0x21, 0x04, 0x32, 0x01, 0xA0, 0x01,
-  0x66, 0x03, 0x15, 0x04, 0x02, 0x02, 0x3E, 0x03, 0xA2, 0xFE, 0x6D, 0xFF, 0x12, 0x02, 0xE8, 0xFF,
-  0x5A, 0xFF, 0x91, 0xFE, 0x34, 0xFF, 0xA2, 0xFF, 0x56, 0xFF, 0x5E, 0xFE, 0x35, 0xFE, 0x36, 0xFF,
-  0x6D, 0xFC, 0x7A, 0xFF, 0x91, 0x00, 0x8F, 0xFC, 0xD0, 0xFC, 0xEB, 0xFC, 0x06, 0xFD, 0xC2, 0xFD,
-  0x4C, 0xFE, 0x19, 0xFD, 0xB8, 0xFD, 0x73, 0xFD, 0x60, 0xFB, 0xDE, 0xFF, 0x73, 0xF2, 0x24, 0xFC,
-  0xD1, 0x00, 0x54, 0xFB, 0x1A, 0xEF, 0x59, 0xF3, 0x82, 0xFB, 0xE6, 0xF8, 0xC0, 0xFD, 0xDE, 0xFA,
-  0x87, 0xFA, 0x95, 0xFA, 0x9A, 0xFE, 0xF3, 0x03, 0x2E, 0x00, 0xD1, 0xFF, 0x21, 0xFB, 0xBC, 0xFE,
-  0x57, 0x05, 0xD3, 0xFB, 0xD0, 0x02, 0x8B, 0xF9, 0x49, 0x00, 0xBF, 0x01, 0x00, 0x03, 0x33, 0xFA,
-  0x11, 0xF8, 0xC2, 0xFD, 0xED, 0xFD, 0xFE, 0xFB, 0xE6, 0xFE, 0x82, 0x02, 0xAA, 0xF1, 0x1F, 0xFC,
-  0xB5, 0xFD, 0x10, 0xFE, 0x17, 0xFA, 0x6A, 0xFA, 0xFB, 0xFE, 0xEE, 0xFF, 0xDB, 0xFD, 0x9F, 0x03,
-  0x96, 0x03, 0xB8, 0x03, 0x86, 0x00, 0xAE, 0x04, 0xF2, 0x01, 0xA7, 0x01, 0x1A, 0x04, 0x8E, 0x05,
-  0xFA, 0x04, 0xF1, 0x04, 0x01, 0x05, 0x11, 0x00, 0x10, 0x05, 0x91, 0x07, 0x92, 0x06, 0x95, 0x02,
-  0xC7, 0x0A, 0x80, 0xFD, 0xD8, 0x07, 0x03, 0x02, 0xBD, 0x01, 0xDB, 0xFF, 0x1D, 0x02, 0x80, 0x02,
-  0x09, 0x05, 0x6E, 0xFD, 0xFF, 0x03, 0x7A, 0xFD, 0xE4, 0x04, 0x47, 0x06, 0x77, 0xFB, 0x1E, 0x06,
-  0x7A, 0xFA, 0xF8, 0x02, 0x30, 0x01, 0x20, 0xF8, 0xE4, 0xF7, 0x7F, 0x01, 0xAA, 0xF2, 0x7D, 0x05,
-  0x56, 0xFC, 0x54, 0xF4, 0x0F, 0xFF, 0x7E, 0xEF, 0xF8, 0xF0, 0x3D, 0xFF, 0x32, 0xF9, 0xD2, 0xF6,
-  0x89, 0xF6, 0x97, 0xE9, 0x74, 0x00, 0x41, 0xFA, 0xD9, 0xFC, 0x34, 0xF8, 0x8B, 0xF4, 0xCC, 0xF3,
-  0x6A, 0xF4, 0xFA, 0xFB, 0xA5, 0xFE, 0xF7, 0x00, 0xE4, 0xF7, 0xAE, 0xFE, 0x08, 0xE8, 0xB1, 0xA9,
-  0x45, 0xF9, 0x1C, 0xC0, 0x6C, 0xEE, 0xA1, 0xD9, 0x6C, 0xBE, 0x8A, 0xE4, 0x9D, 0x09, 0xEA, 0xF8,
-  0xE6, 0x25, 0xC7, 0xF9, 0x82, 0x01, 0x3C, 0xF8, 0xE5, 0x18, 0xE3, 0x21, 0x91, 0x07, 0x1E, 0x14,
-  0x21, 0x07, 0x5A, 0x07, 0xF3, 0x02, 0x6F, 0xF3, 0x11, 0xF1, 0xA2, 0x0E, 0x33, 0x03, 0xD4, 0x17,
-  0xAC, 0x0D, 0x57, 0x21, 0xA5, 0x1E, 0x5F, 0x23, 0xC0, 0x0B, 0x8C, 0x25, 0x50, 0x25, 0x3B, 0x15,
-  0x4F, 0x17, 0x88, 0x11, 0x53, 0xFE, 0x6C, 0x0D, 0xA1, 0x01, 0x2B, 0x15, 0xB1, 0x07, 0xC1, 0x03,
-  0xCC, 0x09, 0xE9, 0x0B, 0xBC, 0x09, 0x30, 0x03, 0x0F, 0x01, 0x88, 0x14, 0x2C, 0x0E, 0xDE, 0x0A,
-  0xA8, 0x00, 0x8F, 0x08, 0x5B, 0x0D, 0xA6, 0x08, 0xB5, 0x04, 0x04, 0xFD, 0x4B, 0x02, 0xE0, 0xFF,
-  0x62, 0x04, 0xAE, 0xFC, 0x3B, 0x00, 0xF8, 0xF9, 0x24, 0xFE, 0x3F, 0x08, 0x55, 0x04, 0x6D, 0xFD,
-  0xA3, 0xFA, 0x03, 0x01, 0x5B, 0xFF, 0x52, 0xFD, 0xDF, 0xF6, 0x24, 0xF3, 0xEF, 0xF4, 0xDE, 0xF3,
-  0x83, 0xF4, 0xFC, 0xF4, 0xA8, 0xF4, 0x3E, 0xF6, 0xF3, 0xF3, 0xAB, 0xF3, 0x03, 0xF3, 0xAF, 0xF6,
-  0xDA, 0xFA, 0xA8, 0xF7, 0x17, 0xFB, 0xDA, 0xF8, 0x06, 0xF8, 0x3D, 0xF6, 0x32, 0xF3, 0x35, 0xF5,
-  0xA2, 0xF5, 0x74, 0xF6, 0xBE, 0xF9, 0x69, 0xF6, 0xBC, 0xF9, 0xED, 0xEE, 0x78, 0xF5, 0x89, 0xF7,
-  0x82, 0xF6, 0xBD, 0xF9, 0xD7, 0xF3, 0x52, 0xFB, 0x6D, 0xFA, 0x6E, 0xFD, 0xCC, 0xFE, 0xEE, 0xFE,
-  0x57, 0xFB, 0x9E, 0xFE, 0x81, 0x05, 0x78, 0x04, 0xDC, 0x09, 0xA9, 0x04, 0xAF, 0x06, 0x37, 0x06,
-  0xD5, 0x07, 0x9F, 0x01, 0x8E, 0x04, 0x6B, 0x02, 0xB7, 0x01, 0x18, 0x02, 0x86, 0x07, 0x45, 0x07,
-  0xDB, 0x05, 0x2C, 0x03, 0x82, 0x04, 0x2F, 0x07, 0xC6, 0x05, 0xC2, 0x02, 0x4B, 0x08, 0x8A, 0xEF,
-  0x5F, 0xFF, 0xBF, 0x01, 0xB3, 0xFE, 0xE4, 0xF8, 0x2D, 0x00, 0xC6, 0x01, 0x1F, 0x00, 0x72, 0x11,
-  0x6B, 0x04, 0xBA, 0xFE, 0xFA, 0xF8, 0x09, 0x05, 0x6A, 0xF5, 0xA7, 0xFF, 0xA0, 0xF2, 0x6D, 0xF2,
-  0x40, 0xF0, 0x27, 0xEF, 0x0D, 0xFC, 0x94, 0xF9, 0x55, 0xF0, 0x27, 0xFD, 0x7A, 0xF6, 0x0A, 0x00,
-  0x44, 0x03, 0x2C, 0xF3, 0xE4, 0xEC, 0xE5, 0xF1, 0xBD, 0xF1, 0x0B, 0xFD, 0xBA, 0xE7, 0x22, 0xF3,
-  0x1B, 0xF6, 0x7F, 0xF8, 0xA3, 0xF3, 0xD2, 0xEE, 0x5A, 0xED, 0x3C, 0xEB, 0x05, 0x01, 0x97, 0xEF,
-  0xD6, 0xF5, 0x1D, 0x02, 0xC0, 0xFF, 0x83, 0x00, 0x37, 0x0A, 0x69, 0xFC, 0x6F, 0x02, 0x3F, 0x07,
-  0xB9, 0x0D, 0x67, 0x08, 0xD9, 0xFB, 0xFC, 0x09, 0xD4, 0x01, 0xF2, 0xFB, 0x9F, 0xFB, 0x1D, 0xFB,
-  0xB7, 0xFF, 0x85, 0x00, 0xFD, 0x14, 0x3E, 0x06, 0x0C, 0x1C, 0x54, 0x13, 0x8A, 0x02, 0x34, 0x18,
-  0x9A, 0x20, 0xA4, 0x12, 0xFA, 0x1A, 0x64, 0x0C, 0xCE, 0x06, 0x6C, 0x13, 0x7C, 0x0B, 0x5B, 0x08,
-  0xAF, 0x0E, 0x19, 0x0D, 0xF0, 0x13, 0xDD, 0x1B, 0x81, 0x16, 0xFD, 0x19, 0xAF, 0x13, 0x6E, 0x12,
-  0x2A, 0x16, 0xEC, 0x17, 0xFD, 0x18, 0x91, 0x10, 0xDE, 0x13, 0xD3, 0x0E, 0x68, 0x05, 0x86, 0xFF,
-  0x29, 0x03, 0xA6, 0xFE, 0x18, 0x06, 0xC4, 0xFD, 0x92, 0xFD, 0x9C, 0x01, 0xED, 0xFF, 0x4F, 0xFF,
-  0xD5, 0x01, 0x08, 0x05, 0x03, 0x01, 0xE5, 0x03, 0x01, 0x00, 0x2D, 0xF9, 0x4B, 0xFB, 0xA2, 0xFA,
-  0x99, 0xFB, 0x33, 0xFC, 0xBC, 0xFB, 0xF4, 0xF9, 0xDC, 0xF5, 0xA0, 0xF6, 0x9B, 0xF7, 0xD3, 0xF8,
-  0x14, 0xF7, 0x40, 0xF9, 0x08, 0xFA, 0xF7, 0xF7, 0xD4, 0xFD, 0x29, 0xFD, 0x50, 0xFB, 0x86, 0xF5,
-  0xD0, 0xFA, 0xFA, 0xF8, 0x32, 0xF8, 0xD3, 0xF7, 0x99, 0xF8, 0xEE, 0xF8, 0x00, 0xF5, 0x53, 0xFB,
-  0xC1, 0xF9, 0x5C, 0xF7, 0x6A, 0xF9, 0x15, 0xF9, 0x70, 0xFD, 0x84, 0xFF, 0x5A, 0xFF, 0x6A, 0x00,
-  0x9A, 0xFF, 0x74, 0x00, 0x73, 0xFE, 0x4E, 0xFF, 0xBD, 0xFF, 0xB4, 0xFD, 0xC8, 0x01, 0x30, 0xF8,
-  0x2E, 0x01, 0xE9, 0xFE, 0x8F, 0xFC, 0x21, 0xFC, 0x69, 0xFB, 0x97, 0x03, 0x99, 0x00, 0x96, 0x03,
-  0x43, 0x02, 0x18, 0x02, 0x4E, 0x02, 0xAD, 0x01, 0xD8, 0x03, 0xA0, 0x00, 0xED, 0x00, 0xDF, 0xFF,
-  0xF8, 0x00, 0x8E, 0xFD, 0xAB, 0xFF, 0x58, 0xFE, 0xF2, 0xFE, 0x3D, 0xFF, 0x3C, 0xFF, 0x88, 0xFF,
-  0x44, 0x01, 0x20, 0x01, 0x01, 0x02, 0x12, 0x01, 0xAC, 0x01, 0x68, 0x00, 0x70, 0x00, 0xA5, 0xFF,
-  0x13, 0xFD, 0x1E, 0xFE, 0x3A, 0xFF, 0x66, 0xFC, 0xFB, 0xFB, 0x8C, 0xFC, 0x4B, 0xFE, 0xB4, 0xFD,
-  0x5B, 0xF4, 0xDB, 0xFD, 0x3A, 0xFE, 0x9B, 0x0C, 0xE0, 0xF8, 0x33, 0xE8, 0xED, 0xF7, 0xC7, 0xE6,
-  0x8B, 0xED, 0xC4, 0xF6, 0x91, 0xF8, 0x08, 0xEF, 0x6E, 0xEF, 0xD6, 0xEA, 0x4D, 0xEA, 0x84, 0xFC,
-  0x84, 0xF4, 0x8D, 0xF4, 0x7D, 0xED, 0xE3, 0xFD, 0xC6, 0xF9, 0xAA, 0x03, 0x15, 0xF1, 0x9C, 0x00,
-  0x44, 0xF6, 0x65, 0x03, 0xF3, 0xF8, 0x7E, 0x03, 0xEE, 0xFE, 0x82, 0xED, 0xFE, 0xFA, 0x2A, 0xF7,
-  0x4C, 0xF5, 0xA5, 0xFD, 0x79, 0x0B, 0x1D, 0x14, 0xEF, 0xF0, 0x58, 0xFB, 0xAF, 0xF6, 0x51, 0x2C,
-  0xCE, 0xE1, 0x84, 0x1F, 0x58, 0xF1, 0x6B, 0xFC, 0xC4, 0xF7, 0x50, 0x0A, 0x9F, 0x0A, 0x1F, 0x00,
-  0x23, 0x1B, 0x2C, 0x0A, 0xCB, 0x13, 0x6D, 0x0C, 0xDF, 0x12, 0x58, 0x0F, 0xBD, 0x18, 0xBD, 0x03,
-  0x99, 0x0A, 0xFD, 0x09, 0x2C, 0x0E, 0xF0, 0x12, 0xFD, 0x11, 0xEE, 0x07, 0x0B, 0x10, 0x94, 0x1C,
-  0x0B, 0x08, 0x30, 0x11, 0x2F, 0x15, 0x97, 0x19, 0x1A, 0x13, 0xE4, 0x0E, 0x85, 0x18, 0x27, 0x0F,
-  0x42, 0x06, 0x58, 0x06, 0x0E, 0xFC, 0x5C, 0x03, 0x4F, 0x10, 0xEC, 0x02, 0xA8, 0xFD, 0x5B, 0x04,
-  0x6F, 0x05, 0xFF, 0x0B, 0x90, 0x03, 0x97, 0x07, 0x10, 0x09, 0x55, 0x04, 0xE6, 0x06, 0x8C, 0x0B,
-  0xB0, 0x02, 0x92, 0x01, 0x79, 0x04, 0x44, 0xF9, 0xEC, 0x02, 0x41, 0xFB, 0x61, 0xFB, 0xD1, 0xFC,
-  0xC2, 0xFC, 0x38, 0xFE, 0x96, 0xF7, 0xEE, 0xFD, 0x1A, 0xFC, 0xA2, 0xFC, 0x30, 0xFA, 0xFB, 0xF7,
-  0x33, 0xFA, 0xC9, 0xF8, 0x40, 0xFB, 0xC3, 0xFB, 0xAC, 0xF5, 0x10, 0xF4, 0x61, 0xF6, 0xF2, 0xF3,
-  0x59, 0xF1, 0xA0, 0xF7, 0xA1, 0xF9, 0x68, 0xFC, 0x05, 0xF9, 0x5E, 0xF9, 0xAA, 0xF8, 0xFA, 0xFD,
-  0x6B, 0xFA, 0xE5, 0xFE, 0xB7, 0x00, 0xAF, 0xFF, 0x56, 0x00, 0xC9, 0xFB, 0x9E, 0xFA, 0x32, 0x06,
-  0xFF, 0xFA, 0xCA, 0xFA, 0xCB, 0xFE, 0x49, 0xFF, 0x45, 0xFA, 0x21, 0xFD, 0x0D, 0x03, 0x86, 0x01,
-  0xCE, 0x02, 0x15, 0x03, 0x4F, 0x04, 0xD2, 0x06, 0xB4, 0x06, 0x41, 0x06, 0x97, 0x04, 0x91, 0x05,
-  0x87, 0x02, 0x92, 0x00, 0x90, 0x00, 0x99, 0xF9, 0x90, 0x03, 0x6E, 0xFD, 0x21, 0xFF, 0x45, 0x05,
-  0x11, 0xF7, 0x8C, 0xF5, 0x28, 0x07, 0x9B, 0xFE, 0x9B, 0x03, 0xFD, 0xF3, 0x2A, 0x04, 0x7A, 0xFE,
-  0xBB, 0x05, 0xA4, 0xFE, 0xF4, 0xFC, 0x56, 0xF9, 0xA0, 0x02, 0xBF, 0xFB, 0x01, 0x00, 0x56, 0xFF,
-  0x97, 0x03, 0xA5, 0x00, 0xFC, 0x00, 0x26, 0xFE, 0xD1, 0x00, 0x86, 0x01, 0x30, 0x05, 0xCE, 0xFD,
-  0xF5, 0xFB, 0x53, 0xFF, 0x0F, 0xFE, 0x56, 0xFB, 0x0B, 0x00, 0xE5, 0xFB, 0x46, 0xFB, 0x50, 0xFA,
-  0xC9, 0xF6, 0x47, 0xFA, 0xB3, 0xFD, 0x5D, 0xFC, 0xB9, 0xF9, 0x5A, 0xFA, 0x3F, 0xFD, 0x2D, 0xFC,
-  0x79, 0xFD, 0xEA, 0xFC, 0x0E, 0xFA, 0xBD, 0xFD, 0xBE, 0x00, 0xFC, 0xFD, 0xD5, 0xFE, 0xBB, 0xFF,
-  0x6B, 0xFE, 0x6B, 0x02, 0xC3, 0x01, 0x0B, 0x05, 0xF4, 0x04, 0x11, 0x07, 0x06, 0x0B, 0x69, 0x06,
-  0x13, 0x06, 0x26, 0x00, 0x8E, 0x06, 0x3D, 0xF9, 0xFA, 0xF1, 0x21, 0x04, 0xC6, 0xF0, 0x35, 0x0A,
-  0xB3, 0xFB, 0x4E, 0x02, 0xE5, 0xFE, 0x9C, 0x04, 0x02, 0x0A, 0xAF, 0xFD, 0x92, 0x08, 0x62, 0xF6,
-  0x19, 0xFC, 0x37, 0xFF, 0xDB, 0xFE, 0xD7, 0xF8, 0x30, 0xFB, 0xEA, 0x01, 0xDC, 0xFD, 0xCB, 0xFF,
-  0x34, 0xFF, 0xD1, 0xFE, 0xF7, 0x02, 0x91, 0x01, 0x34, 0x06, 0xA9, 0xF9, 0xB6, 0x01, 0xEC, 0x05,
-  0x3F, 0x05, 0x3B, 0x00, 0xAF, 0xED, 0x89, 0x09, 0x92, 0xF4, 0xD9, 0x00, 0xF4, 0xF1, 0xF8, 0xF5,
-  0x64, 0xFD, 0xE8, 0xFB, 0x5E, 0x01, 0x1A, 0xFB, 0xC8, 0xF8, 0x18, 0x08, 0x92, 0x08, 0x8F, 0xFD,
-  0x92, 0x06, 0x6B, 0x0A, 0xF5, 0xFD, 0xFF, 0xFB, 0x51, 0xFE, 0x99, 0xFF, 0xEB, 0xF5, 0xBB, 0x00,
-  0x2B, 0xF6, 0xF2, 0xFB, 0x75, 0xFE, 0x1B, 0xFF, 0xD1, 0x00, 0x44, 0x0C, 0xAC, 0x0B, 0x7F, 0x09,
-  0x3B, 0x0A, 0x3B, 0x10, 0x14, 0x14, 0x1B, 0x0C, 0xDF, 0x07, 0x02, 0x07, 0x57, 0x04, 0x3F, 0xFF,
-  0x6A, 0xF7, 0x0C, 0xF8, 0xB9, 0x06, 0xBA, 0xFE, 0xE6, 0xFA, 0x15, 0xFB, 0x65, 0xFA, 0x2E, 0x01,
-  0x1B, 0x06, 0xC9, 0x02, 0x41, 0x07, 0x0C, 0x07, 0xEC, 0x06, 0x02, 0x04, 0xD3, 0x00, 0x2E, 0x02,
-  0xC7, 0xF9, 0xB0, 0xFA, 0x45, 0xF0, 0xE4, 0xFE, 0x34, 0xF5, 0xA1, 0xF6, 0xEA, 0xF6, 0x8A, 0xF5,
-  0xF5, 0xFE, 0xC8, 0x03, 0xBE, 0xFA, 0xFA, 0xFD, 0xDB, 0xFA, 0x08, 0x04, 0x10, 0xF9, 0x49, 0xFE,
-  0x35, 0xF9, 0xF2, 0xF7, 0xAD, 0xFC, 0xF2, 0xFD, 0xD7, 0xF0, 0x8C, 0xF2, 0x1D, 0xF3, 0x17, 0xFD,
-  0x5F, 0xF7, 0xBB, 0xEF, 0x41, 0xF6, 0x1F, 0xF1, 0x17, 0xF4, 0xC2, 0xF8, 0x25, 0xFD, 0x3B, 0xF9,
-  0xAD, 0x05, 0x4C, 0xF5, 0xF8, 0xF7, 0x34, 0xF1, 0x7E, 0xF7, 0x9D, 0xE8, 0x33, 0xF6, 0x8F, 0xE0,
-  0x77, 0xF6, 0x76, 0xFA, 0x50, 0x02, 0xB3, 0xFF, 0x68, 0xF4, 0x93, 0xFE, 0xC7, 0x0D, 0x51, 0x01,
-  0xAA, 0x13, 0x5D, 0xFE, 0xA8, 0x05, 0x18, 0xFE, 0xF4, 0x08, 0xFB, 0xF8, 0x85, 0xFC, 0x76, 0x02,
-  0x72, 0xFF, 0xA5, 0xFF, 0xD9, 0xFD, 0xC9, 0x04, 0xCD, 0x06, 0x65, 0x10, 0x75, 0x0E, 0x3D, 0x08,
-  0x41, 0x0F, 0xDB, 0x04, 0x0E, 0x27, 0xE6, 0x13, 0xB4, 0x08, 0x5B, 0x07, 0x45, 0x19, 0x68, 0x05,
-  0x78, 0x13, 0x0A, 0x0E, 0x9B, 0x03, 0xF5, 0xFA, 0x8F, 0x04, 0x35, 0x13, 0x8E, 0x11, 0x36, 0x0D,
-  0x87, 0x0F, 0x8D, 0x0E, 0x90, 0x0F, 0xCF, 0x12, 0x5E, 0x10, 0x0E, 0x13, 0x69, 0x07, 0x17, 0x12,
-  0x21, 0x01, 0xB0, 0xFF, 0x9E, 0xFF, 0x99, 0x0C, 0x36, 0xFC, 0xA1, 0xF3, 0x14, 0xFF, 0x78, 0xFF,
-  0xD9, 0x06, 0x64, 0xFF, 0x6E, 0x00, 0xB7, 0xFE, 0x02, 0x01, 0x77, 0x0B, 0xDC, 0x06, 0x01, 0x05,
-  0xEE, 0x01, 0xA2, 0xFF, 0xFF, 0x03, 0xA1, 0xFE, 0xF0, 0xFE, 0x31, 0xFA, 0xA2, 0xFA, 0x95, 0xF5,
-  0x0B, 0xFC, 0xDC, 0xF9, 0xD6, 0x01, 0xF2, 0xFA, 0xFD, 0xFD, 0x01, 0xFA, 0xF2, 0xFF, 0x03, 0x00,
-  0x7C, 0x00, 0x98, 0xFC, 0xD8, 0xFD, 0x16, 0xF6, 0x98, 0xF7, 0x20, 0x00, 0xBA, 0xFF, 0xAE, 0xF0,
-  0x5B, 0xF8, 0xE8, 0xF9, 0xB1, 0xF7, 0x51, 0xFD, 0x22, 0xFE, 0x8A, 0xFC, 0x1E, 0xFB, 0xD0, 0x01,
-  0xC9, 0x01, 0xB8, 0xFC, 0x97, 0x02, 0xCF, 0xF9, 0xC1, 0xFE, 0x84, 0xF7, 0x81, 0x02, 0x5B, 0x04,
-  0x20, 0x05, 0x40, 0xFA, 0x7E, 0xFA, 0x46, 0xFE, 0x04, 0xFD, 0xA7, 0xFB, 0x9A, 0xFF, 0x33, 0x01,
-  0xCE, 0xFC, 0x12, 0xFB, 0x93, 0xFE, 0x97, 0x00, 0xF7, 0xFB, 0x17, 0x04, 0x84, 0x01, 0x06, 0x02,
-  0xBA, 0x05, 0x0B, 0x01, 0x2C, 0x03, 0x83, 0x03, 0x3E, 0x01, 0xC3, 0x09, 0xF1, 0x09, 0x97, 0x03,
-  0x88, 0xFE, 0x79, 0x08, 0xB9, 0xFB, 0x95, 0xFC, 0x28, 0xFF, 0x92, 0x03, 0x24, 0xFA, 0x35, 0xF9,
-  0x28, 0x01, 0x08, 0x03, 0x21, 0xFE, 0x8B, 0x08, 0x49, 0xFD, 0xA8, 0xF5, 0x35, 0xF9, 0x0E, 0xFA,
-  0x5C, 0x06, 0x6C, 0x01, 0x98, 0x00, 0x5E, 0x02, 0x5E, 0xFB, 0x23, 0x03, 0x3D, 0xF2, 0xBC, 0x05,
-  0x54, 0xFA, 0x2A, 0xF5, 0x27, 0xF3, 0xB5, 0xF8, 0xF3, 0xF6, 0x8D, 0xFC, 0xC2, 0xFA, 0xF3, 0xFE,
-  0x00, 0xFD, 0x98, 0xFC, 0xD3, 0xFF, 0xF9, 0xFA, 0x0B, 0xFD, 0x80, 0xFC, 0x04, 0x04, 0x54, 0x01,
-  0x3E, 0x03, 0x0D, 0x00, 0xDC, 0xF7, 0xF1, 0xFD, 0x9D, 0xFF, 0x32, 0xF7, 0x23, 0xFB, 0x0D, 0x05,
-  0xAC, 0xFC, 0xCA, 0xF8, 0x82, 0x03, 0x63, 0x05, 0x18, 0x01, 0x1F, 0x03, 0xED, 0x04, 0xE8, 0x02,
-  0xAD, 0x08, 0x9D, 0x0D, 0x02, 0x0A, 0x7D, 0x0A, 0x05, 0x0E, 0x24, 0x0E, 0xA8, 0x0D, 0x3E, 0x0C,
-  0xEA, 0x0D, 0x02, 0x07, 0x4A, 0x0A, 0x39, 0x04, 0x9B, 0x04, 0xD6, 0x07, 0x01, 0x0A, 0x04, 0x0A,
-  0x03, 0x03, 0xE2, 0x06, 0xE8, 0x02, 0x6D, 0x03, 0x9D, 0x01, 0x3F, 0x07, 0xFC, 0x02, 0x45, 0x08,
-  0xC9, 0x05, 0x1F, 0x06, 0x61, 0x02, 0x59, 0x04, 0x1D, 0x03, 0x77, 0x02, 0xE2, 0x02, 0x06, 0x03,
-  0x54, 0x01, 0x59, 0x00, 0xFB, 0xFF, 0xB0, 0xFF, 0x4C, 0x01, 0xED, 0x00, 0xBF, 0x00, 0xFE, 0xFF,
-  0x64, 0x01, 0x2E, 0x02, 0xB5, 0x02, 0xAD, 0xFF, 0x51, 0x00, 0x7D, 0xFE, 0xC5, 0xFC, 0x39, 0x00,
-  0xFA, 0xFD, 0x5C, 0xFF, 0x76, 0xFD, 0x22, 0xFD, 0xC1, 0xFD, 0x9C, 0xFB, 0x92, 0xFB, 0x1D, 0xFD,
-  0x56, 0xFE, 0xB5, 0xFD, 0xDA, 0xFC, 0x73, 0xFC, 0x70, 0xFD, 0x60, 0xFE, 0x27, 0xFD, 0x91, 0xFD,
-  0x4C, 0xFC, 0x4B, 0xFB, 0x64, 0xFC, 0xA4, 0xFA, 0xEF, 0xFB, 0x43, 0xFA, 0x43, 0xFA, 0xF7, 0xF9,
-  0x82, 0xFA, 0x78, 0xFA, 0x0E, 0xF9, 0x28, 0xFB, 0x46, 0xFA, 0x6A, 0xFB, 0xBF, 0xFB, 0x8A, 0xFA,
-  0xEC, 0xFA, 0x77, 0xFB, 0x70, 0xFC, 0xAE, 0xFA, 0xA8, 0xFB, 0x10, 0xFC, 0x73, 0xFA, 0xD3, 0xFA,
-  0xE0, 0xF9, 0xAC, 0xF8, 0xBE, 0xF9, 0x9F, 0xFB, 0xE3, 0xFB, 0x68, 0xFD, 0x96, 0xFC, 0x27, 0xFB,
-  0xED, 0xFB, 0x4E, 0xFF, 0x1F, 0x00, 0xD6, 0xFD, 0x6B, 0x00, 0x75, 0x00, 0xB3, 0xFF, 0x1F, 0x00,
-  0x5F, 0x02, 0x7F, 0x01, 0xE6, 0xFB, 0x90, 0x01, 0x86, 0xFF, 0xE1, 0xFF, 0xBB, 0x02, 0x9C, 0x00,
-  0x85, 0xFE, 0xBA, 0xFB, 0x21, 0x03, 0xC7, 0xFD, 0x5A, 0x02, 0xC1, 0xFE, 0x46, 0x00, 0x96, 0xFD,
-  0x33, 0xFF, 0x38, 0xFE, 0x2B, 0xFE, 0xFF, 0x01, 0xFC, 0xFD, 0xC9, 0x00, 0xA6, 0xFF, 0xAE, 0x00,
-  0xDE, 0x01, 0x6D, 0xFE, 0xA2, 0xFC, 0x6B, 0xFD, 0x22, 0xFD, 0x50, 0xFB, 0x29, 0xFD, 0x98, 0xFE,
-  0xE8, 0xF9, 0x4D, 0xFE, 0x29, 0xFC, 0xFC, 0xFA, 0x8C, 0xFE, 0x6C, 0x00, 0x99, 0xFF, 0x0E, 0x05,
-  0x5F, 0x05, 0x44, 0x07, 0x1C, 0x08, 0xE9, 0x04, 0x3A, 0x04, 0x16, 0x08, 0xA9, 0x07, 0x40, 0xFA,
-  0x29, 0x00, 0x9B, 0x00, 0x5F, 0xFA, 0x2E, 0xFF, 0x5A, 0xFB, 0x23, 0x02, 0xF9, 0x07, 0xC0, 0x06,
-  0xA6, 0x06, 0x05, 0x04, 0x81, 0x0B, 0x92, 0x0E, 0x3A, 0x0F, 0xBE, 0x09, 0x15, 0x06, 0xFE, 0x08,
-  0x8F, 0x04, 0x42, 0x09, 0x82, 0x04, 0x96, 0x03, 0xFB, 0x04, 0x25, 0x03, 0x66, 0x02, 0x38, 0x03,
-  0xC8, 0x05, 0x5A, 0x06, 0x7B, 0x0A, 0xE4, 0x0A, 0xDF, 0x08, 0xA4, 0x06, 0x39, 0x0C, 0x03, 0x08,
-  0x64, 0x0A, 0xE7, 0x0B, 0xB4, 0x02, 0x7D, 0x02, 0xDF, 0x02, 0xBF, 0x05, 0x64, 0x01, 0x32, 0x05,
-  0xB7, 0x02, 0xB7, 0xFF, 0x1A, 0x04, 0x52, 0x05, 0xE5, 0xFE, 0x51, 0x0B, 0xF6, 0x07, 0xB4, 0x02,
-  0xC1, 0x0D, 0x2F, 0x07, 0x19, 0x04, 0x94, 0x07, 0x74, 0x08, 0x66, 0xFF, 0x8D, 0xFA, 0xDC, 0x00,
-  0x99, 0xFB, 0xB2, 0xFA, 0xC5, 0xF9, 0xCD, 0xFD, 0x24, 0xF7, 0xB0, 0xF6, 0xC9, 0xFC, 0xBF, 0xF8,
-  0x41, 0xFD, 0x75, 0xFD, 0x2B, 0xFF, 0x08, 0xFC, 0xC6, 0xFB, 0x81, 0xFD, 0x32, 0xFC, 0x13, 0xFB,
-  0x33, 0xF8, 0xAB, 0xFA, 0xB8, 0xF6, 0x55, 0xFA, 0xB6, 0xF9, 0x28, 0xF5, 0x26, 0xF8, 0x21, 0xF7,
-  0xEE, 0xFA, 0x65, 0xFD, 0xE1, 0xFA, 0x6D, 0xFE, 0x9E, 0xFC, 0xD1, 0xFD, 0xB5, 0xFF, 0xBA, 0xFE,
-  0x3E, 0xFF, 0xD4, 0xF9, 0xF6, 0xFD, 0x1D, 0xFC, 0xEC, 0xFC, 0xA0, 0xFE, 0x13, 0xFE, 0xCF, 0xFB,
-  0x52, 0xFA, 0x71, 0xFA, 0xA3, 0xFB, 0x77, 0xFB, 0xBF, 0xF9, 0x6E, 0xFB, 0x96, 0xF9, 0x09, 0xFD,
-  0x8B, 0xFD, 0x1A, 0xFD, 0x3E, 0x00, 0xE0, 0xFF, 0x97, 0x02, 0x81, 0xFC, 0x0D, 0x03, 0xF0, 0xFA,
-  0x1B, 0xEB, 0x34, 0xFC, 0xFE, 0xF3, 0x4E, 0xEC, 0x5E, 0xF6, 0x31, 0xED, 0xAA, 0xEF, 0x31, 0xFC,
-  0x5E, 0xF8, 0xFD, 0xEF, 0x0E, 0xF2, 0x55, 0xFB, 0x3A, 0xFF, 0x36, 0xFF, 0xA5, 0xFE, 0xDA, 0xFF,
-  0xD0, 0xFF, 0x0B, 0xFE, 0xB0, 0xFF, 0x31, 0xF7, 0x33, 0xF9, 0x55, 0xFC, 0xD5, 0xF5, 0x07, 0xF9,
-  0x7A, 0xF8, 0x2E, 0xFB, 0x40, 0xFA, 0xFA, 0xF9, 0x33, 0xFB, 0x3A, 0xFE, 0xEE, 0x00, 0x98, 0x08,
-  0x27, 0x08, 0x06, 0x0A, 0x70, 0x0B, 0x28, 0x0A, 0x9B, 0x0E, 0xCA, 0x0C, 0x31, 0x08, 0xD4, 0x0C,
-  0x67, 0x08, 0x07, 0xFC, 0xC9, 0x00, 0x7D, 0x0A, 0xF4, 0xFD, 0xB3, 0xF7, 0x38, 0x03, 0x60, 0xF9,
-  0x34, 0xF7, 0x85, 0x0C, 0x77, 0x00, 0x0C, 0x06, 0xBD, 0x08, 0x38, 0x0A, 0x0D, 0x0F, 0x94, 0x03,
-  0x3A, 0x0C, 0x61, 0x15, 0x14, 0x11, 0x12, 0x05, 0xA5, 0x05, 0x1E, 0x08, 0x1B, 0x09, 0x64, 0x0B,
-  0xE5, 0x04, 0xB6, 0x02, 0x99, 0x03, 0x0E, 0x04, 0x36, 0x06, 0xB7, 0x06, 0xD1, 0x05, 0x66, 0x04,
-  0xBB, 0x08, 0xE1, 0x09, 0xCA, 0x0A, 0x06, 0x04, 0xBD, 0x06, 0xB2, 0x03, 0x61, 0x02, 0xBB, 0x00,
-  0x88, 0xFE, 0xD5, 0xFF, 0xF0, 0xFB, 0x1D, 0xFC, 0xE2, 0xF8, 0x05, 0xFA, 0x09, 0xFB, 0x92, 0xFD,
-  0xBD, 0xFC, 0xDB, 0xFB, 0x38, 0xFC, 0xD2, 0xFD, 0x63, 0x00, 0x8B, 0xFE, 0x47, 0xFE, 0x68, 0xFE,
-  0x84, 0xFD, 0x53, 0xFD, 0xB3, 0xFC, 0x2A, 0xFA, 0x97, 0xF9, 0xA0, 0xF7, 0x00, 0xF7, 0xB1, 0xF6,
-  0x1F, 0xF4, 0xEE, 0xF3, 0xF6, 0xF5, 0x8A, 0xF7, 0x70, 0xF7, 0xEF, 0xF9, 0x51, 0xFA, 0xB0, 0xF6,
-  0x43, 0xF4, 0xB4, 0xF9, 0xE7, 0xF3, 0x51, 0xF3, 0x1C, 0xFA, 0xF7, 0xF9, 0x9A, 0xFA, 0xB6, 0xFA,
-  0x4D, 0xFC, 0xB1, 0xF6, 0x9C, 0xF4, 0x4D, 0xFB, 0x8A, 0xFC, 0x7C, 0xF8, 0xAC, 0xFA, 0x20, 0xFC,
-  0xCA, 0xFB, 0xAA, 0xFB, 0xA8, 0x00, 0x9B, 0xFB, 0x37, 0x00, 0x13, 0xFF, 0x90, 0xFC, 0x1D, 0x02,
-  0x75, 0xFC, 0x92, 0xFE, 0x7D, 0x00, 0x6B, 0x00, 0x02, 0xFF, 0x36, 0x02, 0x79, 0x04, 0x8E, 0x03,
-  0xB8, 0x03, 0x38, 0x05, 0x97, 0xFF, 0x38, 0x04, 0x26, 0x08, 0xE3, 0x03, 0x5A, 0x04, 0xB4, 0x05,
-  0xE8, 0x00, 0x52, 0x04, 0x64, 0x06, 0xCE, 0x03, 0x83, 0x03, 0x34, 0x07, 0x4B, 0x02, 0xC8, 0x08,
-  0xA5, 0x04, 0xEB, 0x03, 0x77, 0x05, 0x9D, 0x02, 0x49, 0x04, 0xC6, 0x03, 0x96, 0x05, 0x56, 0x04,
-  0x29, 0x04, 0x60, 0xFF, 0xAB, 0xFE, 0x87, 0xFF, 0xCC, 0xFC, 0x37, 0xFE, 0xD0, 0xFC, 0xD9, 0xFA,
-  0x6E, 0xFC, 0xEB, 0xFE, 0x5B, 0xFF, 0x93, 0x02, 0x90, 0x01, 0xCD, 0x01, 0xFB, 0x00, 0xF8, 0xFF,
-  0x50, 0x04, 0xA9, 0x06, 0x3E, 0x09, 0x01, 0x05, 0x32, 0x0C, 0x18, 0x0C, 0xBD, 0x04, 0xD0, 0x06,
-  0xAF, 0x0B, 0x01, 0x06, 0x4A, 0xFC, 0xE1, 0x07, 0x84, 0x04, 0xD9, 0xF9, 0xC8, 0xFF, 0xB7, 0x05,
-  0xC3, 0xFA, 0x57, 0xF9, 0x6D, 0x08, 0x02, 0x01, 0xA3, 0xFF, 0x21, 0x07, 0x34, 0xFF, 0x0A, 0xFE,
-  0x27, 0x06, 0xFE, 0x06, 0xDF, 0x01, 0x6E, 0x07, 0x0E, 0x04, 0x9E, 0x02, 0xA8, 0x02, 0x63, 0x03,
-  0xEC, 0x02, 0x34, 0x02, 0x39, 0x00, 0xAA, 0xFF, 0x9B, 0x06, 0x3F, 0x07, 0xC0, 0x05, 0x2D, 0x05,
-  0x91, 0x06, 0xEB, 0x03, 0xA3, 0x06, 0x7F, 0x09, 0x61, 0x09, 0xEB, 0x09, 0xEE, 0x08, 0xC9, 0x01,
-  0x47, 0x04, 0xE5, 0x02, 0xC6, 0x00, 0xBB, 0x00, 0x4F, 0x00, 0x92, 0xFD, 0x71, 0xFD, 0x7F, 0xFD,
-  0x94, 0xFE, 0xF5, 0xFC, 0xF7, 0xFD, 0x3A, 0xFF, 0x4B, 0xFF, 0x58, 0x00, 0x58, 0x02, 0x66, 0x01,
-  0x3A, 0xFC, 0xA2, 0xFF, 0x4F, 0x02, 0x8A, 0xFB, 0x8A, 0xFD, 0x41, 0xFD, 0x46, 0xF8, 0x59, 0xFA,
-  0x86, 0xFB, 0xE5, 0xF8, 0x1B, 0xF8, 0x17, 0xF8, 0xC6, 0xF9, 0x7C, 0xF8, 0x80, 0xFA, 0x3F, 0xFA,
-  0x88, 0xFA, 0x3E, 0xFD, 0x6A, 0xFE, 0x5C, 0xFA, 0x5E, 0xFB, 0x20, 0xFC, 0xE9, 0xF7, 0xF8, 0xF7,
-  0x0B, 0xFB, 0xA8, 0xF7, 0xFF, 0xF7, 0x0F, 0xFD, 0x55, 0xF9, 0x9B, 0xF8, 0x83, 0xF8, 0x69, 0xFA,
-  0xB5, 0xFE, 0x1C, 0xFC, 0x81, 0xFC, 0x57, 0xFF, 0x6B, 0x00, 0x9D, 0xFC, 0xC4, 0xFF, 0xB5, 0x00,
-  0xA5, 0xFD, 0x35, 0xFE, 0x05, 0x01, 0x1A, 0xFF, 0xF3, 0xFB, 0xB8, 0xFE, 0xDA, 0xFD, 0x27, 0xFC,
-  0xDF, 0xFB, 0x2F, 0x00, 0x3E, 0xFF, 0xAA, 0xF9, 0xFD, 0xFD, 0xC3, 0xF9, 0x2E, 0xFA, 0x2A, 0xFB,
-  0x8B, 0xFE, 0x18, 0xFE, 0xC9, 0xFF, 0x68, 0x01, 0xA4, 0xFB, 0xF0, 0x01, 0xE1, 0x02, 0x04, 0xFF,
-  0x4B, 0xFF, 0x3E, 0x01, 0x96, 0x00, 0xDB, 0x05, 0x36, 0x04, 0xC1, 0x00, 0x86, 0xFF, 0x2F, 0x04,
-  0xF7, 0x09, 0x22, 0x02, 0xA9, 0x04, 0x60, 0x04, 0x4A, 0x03, 0x7A, 0x07, 0x97, 0x05, 0xDA, 0x03,
-  0xAE, 0x05, 0xCA, 0x0A, 0xDE, 0x06, 0xC2, 0x04, 0xC4, 0x00, 0x36, 0x08, 0x4F, 0x06, 0x5B, 0x01,
-  0x31, 0x01, 0xA8, 0x02, 0x69, 0x01, 0x1A, 0x07, 0x72, 0x01, 0xEE, 0xFB, 0xC9, 0x02, 0x57, 0x04,
-  0xED, 0xFF, 0x64, 0x03, 0xF3, 0x04, 0x56, 0x07, 0x93, 0x08, 0x10, 0x07, 0x1F, 0x07, 0xB7, 0x08,
-  0x7B, 0x08, 0x9E, 0x06, 0x8E, 0x08, 0xD5, 0x06, 0xDE, 0x00, 0xC3, 0x03, 0xAC, 0x02, 0x5B, 0xFB,
-  0xCD, 0xFE, 0x5D, 0x00, 0x4B, 0xFF, 0x68, 0xFE, 0x0E, 0xFE, 0x40, 0xFE, 0x40, 0xFD, 0xE0, 0xFE,
-  0x1B, 0x01, 0x0A, 0x00, 0x5E, 0x00, 0xFA, 0x01, 0x62, 0x01, 0x27, 0x00, 0x82, 0xFE, 0x7B, 0xFE,
-  0xC5, 0xFE, 0xCA, 0x00, 0xA1, 0xFD, 0x31, 0xFD, 0x64, 0xFD, 0x00, 0xFD, 0x3D, 0xFB, 0xAD, 0xFE,
-  0xF0, 0xFB, 0x4B, 0xFC, 0xA8, 0xFE, 0xD7, 0xFE, 0x57, 0xFF, 0x04, 0xFD, 0xBD, 0xFD, 0xAA, 0xFE,
-  0x43, 0xFC, 0x24, 0xFF, 0xF9, 0xFF, 0x29, 0xFE, 0xA8, 0xFE, 0xA5, 0xFF, 0xC6, 0xFF, 0xB9, 0xFD,
-  0x4B, 0xFD, 0xE3, 0xFE, 0xDB, 0x00, 0xCE, 0xFE, 0x74, 0xFC, 0x78, 0x00, 0x49, 0x01, 0x76, 0xFD,
-  0xF6, 0xFD, 0x92, 0xFE, 0xE0, 0x00, 0x8C, 0xFF, 0xA2, 0xFF, 0x75, 0xFF, 0x83, 0xFF, 0xD6, 0xFE,
-  0xD0, 0xFF, 0x76, 0x00, 0xCB, 0xFE, 0xFE, 0xFF, 0x5C, 0x03, 0xC6, 0xFC, 0x0D, 0xFC, 0x55, 0x03,
-  0x2E, 0xFD, 0x03, 0xFC, 0x59, 0xFF, 0x04, 0xFF, 0x17, 0xFC, 0x0D, 0xFF, 0xD6, 0x00, 0x4C, 0xFE,
-  0xA8, 0xFE, 0x79, 0x01, 0x40, 0x01, 0x4B, 0xFF, 0x6E, 0xFF, 0x62, 0xFE, 0xF3, 0x00, 0x48, 0x00,
-  0x02, 0xFE, 0x81, 0xFE, 0x8D, 0x00, 0x90, 0x01, 0xBF, 0xFE, 0xCB, 0xFF, 0xE9, 0x00, 0x30, 0xFF,
-  0xC8, 0x00, 0x62, 0xFF, 0x24, 0xFE, 0x38, 0xFE, 0xB2, 0x00, 0xA9, 0xFF, 0xEA, 0xFF, 0x53, 0xFD,
-  0x82, 0xFE, 0x4B, 0x00, 0x5C, 0xFF, 0xA0, 0xFD, 0xCB, 0xFE, 0xFD, 0x00, 0x3F, 0x01, 0xBE, 0xFF,
-  0xAF, 0x02, 0x21, 0x02, 0xD0, 0xFF, 0xF7, 0x03, 0x42, 0x04, 0xAA, 0x03, 0xEF, 0x02, 0xD0, 0xFE,
-  0x60, 0x02, 0x14, 0x01, 0x03, 0xFC, 0x97, 0x00, 0x9D, 0x02, 0x35, 0xFC, 0x47, 0x02, 0x78, 0x00,
-  0xDB, 0xFE, 0x5E, 0xFD, 0xA3, 0x01, 0x96, 0xFF, 0x3F, 0xFF, 0x31, 0x01, 0x42, 0x00, 0x91, 0x00,
-  0x12, 0x00, 0x00, 0x03, 0x52, 0x00, 0x94, 0x00, 0xF6, 0xFF, 0x36, 0x00, 0x15, 0xFF, 0x65, 0xFD,
-  0xC7, 0xFE, 0x78, 0x00, 0x81, 0xFF, 0x34, 0xFD, 0xFA, 0xFC, 0x22, 0xFE, 0xF6, 0xFE, 0x6F, 0x00,
-  0x66, 0x01, 0xBD, 0xFF, 0xF4, 0xFE, 0x2E, 0x02, 0xB2, 0xFF, 0x29, 0xFD, 0x32, 0x02, 0x0F, 0x00,
-  0x67, 0xFE, 0xFD, 0xFF, 0x39, 0x01, 0xE9, 0xFF, 0x31, 0x00, 0x7C, 0x00, 0x68, 0xFE, 0x81, 0xFF,
-  0xCC, 0xFF, 0x6B, 0xFF, 0x2B, 0x00, 0x1D, 0x01, 0x86, 0x01, 0xA6, 0x00, 0x73, 0x01, 0x46, 0x01,
-  0x96, 0xFF, 0x5B, 0xFF, 0x12, 0x01, 0x6A, 0xFE, 0x22, 0xFE, 0x74, 0x00, 0x6F, 0xFF, 0xDB, 0xFE,
-  0x8E, 0xFE, 0x8B, 0xFE, 0x0F, 0xFD, 0xB8, 0xFD, 0x13, 0xFE, 0xE9, 0xFD, 0xAA, 0xFE, 0xC5, 0x00,
-  0x75, 0x00, 0x29, 0xFF, 0x26, 0x01, 0xD4, 0x00, 0x6E, 0xFE, 0x19, 0x00, 0x04, 0xFF, 0xF4, 0xFF,
-  0xB2, 0xFF, 0x30, 0x00, 0x99, 0x01, 0xFB, 0xFF, 0x32, 0x01, 0x4B, 0x00, 0x8B, 0x00, 0x58, 0x01,
-  0xDF, 0x00, 0xB0, 0x01, 0x0B, 0x01, 0x28, 0x01, 0x53, 0x01, 0xA3, 0x00, 0xC7, 0x00, 0xF8, 0x00,
-  0x80, 0x00, 0xE8, 0xFF, 0x81, 0xFF, 0xB3, 0xFE, 0x49, 0xFF, 0x5D, 0xFE, 0xA7, 0xFE, 0x79, 0xFE,
-  0x0F, 0xFF, 0x8B, 0xFF, 0xFE, 0xFD, 0x52, 0xFE, 0x38, 0x01, 0xC3, 0x00, 0xA8, 0xFF, 0xE1, 0x00,
-  0x32, 0x02, 0x03, 0x01, 0x19, 0x02, 0xE3, 0x02, 0x2D, 0x03, 0x03, 0x03, 0xB1, 0x01, 0x67, 0x01,
-  0x9D, 0x01, 0x9D, 0x00, 0x38, 0x00, 0x5F, 0x00, 0x89, 0x00, 0x03, 0x00, 0x48, 0xFE, 0x8E, 0xFE,
-  0x6F, 0xFE, 0xA6, 0xFD, 0x20, 0xFF, 0x39, 0xFF, 0x20, 0xFE, 0xA0, 0xFD, 0x7B, 0x00, 0x57, 0xFF,
-  0xB0, 0xFD, 0xED, 0xFE, 0x4A, 0xFF, 0xC2, 0x00, 0xA3, 0x00, 0x8C, 0xFF, 0xCE, 0xFF, 0x5F, 0x00,
-  0x27, 0x00, 0xFC, 0xFF, 0xF6, 0x00, 0xF7, 0x00, 0xF0, 0x00, 0x83, 0x00, 0xFE, 0xFF, 0x68, 0x00,
-  0xD7, 0xFF, 0x57, 0x00, 0xE2, 0x00, 0x17, 0x00, 0x76, 0xFF, 0x58, 0xFF, 0x09, 0x00, 0x79, 0xFF,
-  0x13, 0xFF, 0x94, 0xFF, 0x50, 0xFF, 0x36, 0xFF, 0x3A, 0xFF, 0x10, 0xFF, 0x0B, 0xFF, 0x38, 0xFF,
-  0x6C, 0xFF, 0x94, 0xFF, 0x24, 0xFF, 0x4E, 0xFF, 0xA7, 0xFF, 0x5A, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF,
-  0x39, 0xFF, 0x70, 0xFF, 0x81, 0xFF, 0x99, 0xFF, 0x39, 0xFF, 0x00, 0x00, 0xA3, 0xFF, 0x95, 0xFF,
-  0x96, 0xFF, 0xD9, 0xFF, 0xFC, 0xFF, 0xDF, 0xFF, 0xD2, 0xFF, 0x5B, 0x00, 0x3D, 0x00, 0xEA, 0xFF,
-  0x00, 0x00, 0x99, 0xFF, 0xF7, 0xFF, 0xC3, 0xFF, 0xE3, 0xFF, 0x4E, 0x00, 0xC0, 0xFF, 0x14, 0x00,
-  0x3A, 0x00, 0x24, 0x00, 0x37, 0x00, 0x22, 0x00, 0x8B, 0x00, 0x5A, 0x00, 0x5F, 0x00, 0xA4, 0x00,
-  0x62, 0x00, 0xFA, 0x00, 0xD7, 0x00, 0x98, 0x00, 0xC8, 0x00, 0x5B, 0x00, 0x73, 0x00, 0x60, 0x00,
-  0x78, 0x00, 0x47, 0x00, 0x1D, 0x00, 0xDD, 0xFF, 0x8B, 0xFF, 0xDC, 0xFF, 0xB6, 0xFF, 0x6F, 0xFF,
-  0x93, 0xFF, 0x92, 0xFF, 0x97, 0xFF, 0xE1, 0xFF, 0xBD, 0xFF, 0x65, 0xFF, 0xA4, 0xFF, 0xA9, 0xFF,
-  0xA1, 0xFF, 0xA8, 0xFF, 0x83, 0xFF, 0x55, 0x00, 0xCF, 0xFF, 0xB5, 0xFF, 0x03, 0x00, 0xB9, 0xFF,
-  0xF9, 0xFF, 0x22, 0x00, 0xC7, 0xFF, 0x03, 0x00, 0x47, 0x00, 0xB8, 0xFF, 0xB2, 0xFF, 0xFE, 0xFF,
-  0xF8, 0xFF, 0xD0, 0xFF, 0x47, 0x00, 0x11, 0x00, 0x7C, 0xFF, 0xD1, 0xFF, 0xBD, 0xFF, 0xF6, 0xFF,
-  0x2B, 0x00, 0xA0, 0xFF, 0xEE, 0xFF, 0xB0, 0xFF, 0x90, 0xFF, 0xDD, 0xFF, 0x48, 0xFF, 0xD8, 0xFF,
-  0x6F, 0xFF, 0xB7, 0xFE, 0x15, 0xFF, 0x30, 0xFF, 0xFA, 0xFE, 0xE7, 0xFE, 0x5F, 0xFF, 0xBB, 0xFF,
-  0x6B, 0xFF, 0x88, 0xFF, 0x3E, 0xFF, 0x31, 0xFF, 0x6B, 0xFF, 0x48, 0xFF, 0x81, 0xFF, 0xB6, 0xFF,
-  0x0B, 0x00, 0xA0, 0xFF, 0x5C, 0xFF, 0xB9, 0xFF, 0x19, 0xFF, 0x62, 0xFF, 0xCB, 0xFF, 0xE7, 0xFF,
-  0x5D, 0xFF, 0x08, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xDD, 0xFF, 0x29, 0x00, 0x95, 0xFF, 0x54, 0x00,
-  0x0E, 0x00, 0xFE, 0xFF, 0x5C, 0x00, 0x01, 0x00, 0x69, 0x00, 0x3C, 0x00, 0x5D, 0x00, 0x26, 0x00,
-  0x09, 0x00, 0x71, 0x00, 0x4D, 0x00, 0x4B, 0x00, 0x42, 0x00, 0x36, 0x00, 0x75, 0x00, 0x8B, 0x00,
-  0x79, 0x00, 0x88, 0x00, 0x95, 0x00, 0xBA, 0x00, 0x83, 0x00, 0x9A, 0x00, 0xCE, 0x00, 0x89, 0x00,
-  0xA7, 0x00, 0xC0, 0x00, 0xA3, 0x00, 0xBB, 0x00, 0x9D, 0x00, 0x8C, 0x00, 0x66, 0x00, 0x5F, 0x00,
-  0x63, 0x00, 0x6D, 0x00, 0x76, 0x00, 0x88, 0x00, 0x61, 0x00, 0x56, 0x00, 0x9A, 0x00, 0x29, 0x00,
-  0x59, 0x00, 0x50, 0x00, 0x80, 0x00, 0x7F, 0x00, 0x43, 0x00, 0x52, 0x00, 0x65, 0x00, 0x93, 0x00,
-  0x4A, 0x00, 0x6E, 0x00, 0x84, 0x00, 0x5F, 0x00, 0x02, 0x00, 0x8F, 0x00, 0x38, 0x00, 0x3A, 0x00,
-  0x65, 0x00, 0x5C, 0x00, 0x89, 0x00, 0x6E, 0x00, 0x50, 0x00, 0x88, 0x00, 0xA4, 0x00, 0x6A, 0x00,
-  0x6A, 0x00, 0x99, 0x00, 0x82, 0x00, 0x68, 0x00, 0x4D, 0x00, 0x5B, 0x00, 0x75, 0x00, 0x6F, 0x00,
-  0x87, 0x00, 0x4C, 0x00, 0x01, 0x00, 0x5E, 0x00, 0x2B, 0x00, 0x69, 0x00, 0x63, 0x00, 0x33, 0x00,
-  0xAA, 0x00, 0x6B, 0x00, 0x17, 0x00, 0x71, 0x00, 0xE3, 0xFF, 0xA8, 0x00, 0x36, 0x00, 0xFF, 0xFF,
-  0x16, 0x00, 0x0C, 0x00, 0x32, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0xDE, 0xFF, 0xF2, 0xFF, 0xF1, 0xFF,
-  0xF4, 0xFF, 0xBE, 0xFF, 0xDB, 0xFF, 0xD8, 0xFF, 0x05, 0x00, 0xAA, 0xFF, 0xB1, 0xFF, 0xBF, 0xFF,
-  0xA3, 0xFF, 0xC3, 0xFF, 0xAB, 0xFF, 0xAA, 0xFF, 0xC1, 0xFF, 0xE4, 0xFF, 0xD5, 0xFF, 0xC7, 0xFF,
-  0xC3, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xBC, 0xFF, 0xE3, 0xFF, 0xBD, 0xFF, 0xAE, 0xFF,
-  0xF9, 0xFF, 0xEF, 0xFF, 0xAD, 0xFF, 0x36, 0x00, 0xEF, 0xFF, 0xEA, 0xFF, 0x18, 0x00, 0x09, 0x00,
-  0x4B, 0x00, 0x20, 0x00, 0x10, 0x00, 0x43, 0x00, 0x3D, 0x00, 0x07, 0x00, 0x3F, 0x00, 0x38, 0x00,
-  0x44, 0x00, 0x66, 0x00, 0x55, 0x00, 0x3C, 0x00, 0x35, 0x00, 0x31, 0x00, 0x36, 0x00, 0x20, 0x00,
-  0xF9, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0C, 0x00, 0xD7, 0xFF, 0x14, 0x00, 0x3B, 0x00,
-  0x06, 0x00, 0x16, 0x00, 0x29, 0x00, 0xEC, 0xFF, 0xDA, 0xFF, 0x63, 0x00, 0xCB, 0xFF, 0xE2, 0xFF,
-  0x27, 0x00, 0xD0, 0xFF, 0xEC, 0xFF, 0x32, 0x00, 0xC4, 0xFF, 0xEE, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF,
-  0xC8, 0xFF, 0xE0, 0xFF, 0xD2, 0xFF, 0xD9, 0xFF, 0xE8, 0xFF, 0xD9, 0xFF, 0xB8, 0xFF, 0xCF, 0xFF,
-  0x09, 0x00, 0xC5, 0xFF, 0xE1, 0xFF, 0xCE, 0xFF, 0xF3, 0xFF, 0xD5, 0xFF, 0xD7, 0xFF, 0xF4, 0xFF,
-  0xD7, 0xFF, 0xCC, 0xFF, 0xD7, 0xFF, 0xEA, 0xFF, 0xC0, 0xFF, 0xBC, 0xFF, 0xC9, 0xFF, 0xC3, 0xFF,
-  0xE0, 0xFF, 0xF0, 0xFF, 0xBC, 0xFF, 0xD9, 0xFF, 0x13, 0x00, 0xF0, 0xFF, 0xE4, 0xFF, 0x0D, 0x00,
-  0x09, 0x00, 0x13, 0x00, 0xE6, 0xFF, 0x07, 0x00, 0xE9, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF5, 0xFF,
-  0xFE, 0xFF, 0xEA, 0xFF, 0xEA, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0xDA, 0xFF,
-  0x0A, 0x00, 0xCD, 0xFF, 0x13, 0x00, 0xF9, 0xFF, 0xCA, 0xFF, 0xD7, 0xFF, 0xF4, 0xFF, 0xE2, 0xFF,
-  0xBD, 0xFF, 0xCB, 0xFF, 0xE6, 0xFF, 0xD6, 0xFF, 0xFB, 0xFF, 0xCA, 0xFF, 0xCD, 0xFF, 0xDC, 0xFF,
-  0xC2, 0xFF, 0xC0, 0xFF, 0xD5, 0xFF, 0xC0, 0xFF, 0xDF, 0xFF, 0xD1, 0xFF, 0xE2, 0xFF, 0xD0, 0xFF,
-  0xDB, 0xFF, 0xEE, 0xFF, 0xE4, 0xFF, 0xF3, 0xFF, 0xE3, 0xFF, 0xEF, 0xFF, 0xFA, 0xFF, 0xF7, 0xFF,
-  0xEC, 0xFF, 0x08, 0x00, 0xF8, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0x06, 0x00, 0xE3, 0xFF, 0xE7, 0xFF,
-  0x06, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x08, 0x00, 0x06, 0x00, 0x02, 0x00, 0x04, 0x00, 0x2A, 0x00,
-  0x06, 0x00, 0x0D, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0xF5, 0xFF, 0x08, 0x00,
-  0xFC, 0xFF, 0x00, 0x00, 0xF1, 0xFF, 0xEA, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0xF2, 0xFF, 0xE7, 0xFF,
-  0xDF, 0xFF, 0xE4, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xE4, 0xFF, 0xFC, 0xFF, 0xFB, 0xFF, 0xEE, 0xFF,
-  0xF9, 0xFF, 0xFA, 0xFF, 0xEE, 0xFF, 0xFC, 0xFF, 0xF7, 0xFF, 0xF2, 0xFF, 0xF2, 0xFF, 0xFE, 0xFF,
-  0xF3, 0xFF, 0xFC, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0x01, 0x00, 0xFB, 0xFF, 0x08, 0x00, 0x06, 0x00,
-  0x0A, 0x00, 0x07, 0x00, 0x07, 0x00, 0x19, 0x00, 0x09, 0x00, 0xF8, 0xFF, 0x12, 0x00, 0x05, 0x00,
-  0xF0, 0xFF, 0x13, 0x00, 0x35, 0x00, 0xF6, 0xFF, 0x35, 0x00, 0x11, 0x00, 0x0F, 0x00, 0x1A, 0x00,
-  0x24, 0x00, 0x1C, 0x00, 0x29, 0x00, 0x18, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x05, 0x00,
-  0xFF, 0xFF, 0x2B, 0x00, 0x18, 0x00, 0x14, 0x00, 0x18, 0x00, 0x12, 0x00, 0x18, 0x00, 0x13, 0x00,
-  0x13, 0x00, 0x19, 0x00, 0x1E, 0x00, 0x19, 0x00, 0x11, 0x00, 0x0D, 0x00, 0x10, 0x00, 0x08, 0x00,
-  0x12, 0x00, 0x17, 0x00, 0x13, 0x00, 0x05, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x07, 0x00,
-  0x01, 0x00, 0x11, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x09, 0x00, 0x02, 0x00, 0x08, 0x00,
-  0x0B, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF9, 0xFF,
-  0xF6, 0xFF, 0x07, 0x00, 0xFB, 0xFF, 0xF0, 0xFF, 0xFE, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0x08, 0x00,
-  0x0F, 0x00, 0xFE, 0xFF, 0x14, 0x00, 0x0D, 0x00, 0x05, 0x00, 0x0C, 0x00, 0x05, 0x00, 0x01, 0x00,
-  0x0D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xF7, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0xF5, 0xFF,
-  0xFC, 0xFF, 0xFC, 0xFF, 0xF4, 0xFF, 0xFA, 0xFF, 0x00, 0x00, 0xF0, 0xFF, 0x02, 0x00, 0xFD, 0xFF,
-  0xF2, 0xFF, 0xF9, 0xFF, 0x04, 0x00, 0xF9, 0xFF, 0xFD, 0xFF, 0x02, 0x00, 0xFF, 0xFF, 0xFE, 0xFF,
-  0x03, 0x00, 0xFC, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0x00, 0x00,
-  0xFD, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x00,
-  0xF6, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xF7, 0xFF, 0xFD, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFB, 0xFF, 0x01, 0x00, 0xFC, 0xFF,
-  0xFA, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0xF5, 0xFF, 0xF6, 0xFF,
-  0xF7, 0xFF, 0xF8, 0xFF, 0xF1, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF2, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF,
-  0xF1, 0xFF, 0xEA, 0xFF, 0xFB, 0xFF, 0xEB, 0xFF, 0xEA, 0xFF, 0xFA, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF,
-  0xF8, 0xFF, 0xF0, 0xFF, 0xF3, 0xFF, 0xF4, 0xFF, 0xF2, 0xFF, 0xF1, 0xFF, 0xEE, 0xFF, 0xF4, 0xFF,
-  0xF2, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0xF2, 0xFF, 0xF6, 0xFF, 0xF4, 0xFF, 0xF2, 0xFF, 0xF8, 0xFF,
-  0xF5, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xFE, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF,
-  0x00, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x05, 0x00, 0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x07, 0x00,
-  0x0A, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x07, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x06, 0x00, 0x05, 0x00, 0x05, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00,
-  0x03, 0x00, 0x04, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF,
-  0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF,
-  0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+// IMA-ADPCM (ima_adpcm.h) : en-tête 4 octets, puis 1 nibble par sample
+// Jouer avec GotchiAudio::playAdpcm(EATING_ADPCM, EATING_ADPCM_LEN)
+static const uint8_t EATING_ADPCM[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x99, 0x01, 0x91, 0x21, 0xA1, 0x9B, 0x31, 0x39, 0x99, 0xA4,
+  0x9A, 0x94, 0x4D, 0x0A, 0x88, 0x02, 0xF3, 0x10, 0x99, 0x00, 0x7C, 0x8A, 0x21, 0x9A, 0x96, 0xA2,
+  0x81, 0x2B, 0xF1, 0x11, 0x0A, 0x3A, 0xB7, 0x40, 0x99, 0x09, 0xF9, 0xE7, 0x02, 0x09, 0x80, 0x08,
+  0x92, 0x18, 0x9B, 0x01, 0xF8, 0x84, 0x4C, 0x89, 0x38, 0xBA, 0x85, 0xA1, 0x19, 0x28, 0xF4, 0xB2,
+  0x94, 0x99, 0x29, 0xB6, 0xA2, 0x05, 0x9C, 0x04, 0x99, 0x0B, 0x04, 0x1C, 0x00, 0x82, 0x91, 0x9B,
+  0xFB, 0xE7, 0xA6, 0x20, 0x09, 0x29, 0xB9, 0x03, 0x2A, 0x2D, 0x92, 0xF3, 0x31, 0x8B, 0x11, 0xF3,
+  0x80, 0x28, 0x99, 0x10, 0xB3, 0x24, 0xB8, 0x99, 0x38, 0x8F, 0x72, 0xAB, 0x11, 0x91, 0x48, 0x1E,
+  0x98, 0x01, 0x49, 0x1C, 0x08, 0xC1, 0x22, 0x2A, 0x2F, 0x88, 0x80, 0x94, 0x11, 0x2B, 0x2F, 0x0F,
+  0xB3, 0x30, 0x49, 0x4B, 0xD9, 0xC3, 0x11, 0x1A, 0x91, 0xD2, 0x85, 0x3A, 0x89, 0x89, 0xE2, 0x30,
+  0x0A, 0x00, 0xB3, 0x81, 0x19, 0x2E, 0xB0, 0x88, 0x21, 0x38, 0xB2, 0x91, 0x1F, 0x88, 0xD8, 0x97,
+  0x5B, 0x00, 0x09, 0xA1, 0x08, 0xC0, 0xA4, 0x28, 0x4C, 0x28, 0x4C, 0x2A, 0x2F, 0xA9, 0x04, 0x80,
+  0x3A, 0x0B, 0x92, 0x31, 0x0F, 0x29, 0xF3, 0x20, 0x99, 0x5A, 0x90, 0xA1, 0x01, 0xBA, 0x82, 0xF1,
+  0x12, 0x18, 0x0A, 0x18, 0x08, 0x08, 0x2E, 0x2A, 0x82, 0x97, 0xD8, 0x11, 0xA8, 0x10, 0xA2, 0x49,
+  0x3B, 0x82, 0x4E, 0xE9, 0x91, 0x21, 0x00, 0x1D, 0xB3, 0x4C, 0x80, 0x8A, 0x01, 0x92, 0x4B, 0x08,
+  0x18, 0x87, 0x0A, 0x01, 0x8D, 0xA4, 0x90, 0x20, 0x18, 0x2A, 0x94, 0x1F, 0x20, 0x9C, 0x41, 0x0A,
+  0x40, 0x1C, 0x3C, 0x09, 0xA9, 0x97, 0x5A, 0x2A, 0x1B, 0x28, 0xE1, 0x21, 0x2A, 0x2D, 0x08, 0x8A,
+  0x03, 0x98, 0x10, 0x93, 0x8F, 0x23, 0x8D, 0x08, 0xC4, 0x01, 0x21, 0x99, 0xB6, 0xC0, 0x7A, 0x18,
+  0x3B, 0x81, 0x98, 0x20, 0xAB, 0x49, 0xC0, 0x4A, 0x18, 0x80, 0x14, 0xB9, 0x1B, 0xA8, 0x9B, 0x45,
+  0x1B, 0x60, 0xC1, 0x18, 0x18, 0x5D, 0xA9, 0x80, 0x28, 0x18, 0x39, 0x08, 0xF8, 0x83, 0xBA, 0x98,
+  0xE3, 0x53, 0x3A, 0xE0, 0x81, 0x1A, 0x39, 0x8C, 0x28, 0x31, 0xBB, 0x12, 0xF0, 0xA1, 0x10, 0x00,
+  0x1A, 0x07, 0x8A, 0x79, 0x9C, 0x21, 0x39, 0x3E, 0x1B, 0x18, 0x28, 0x6B, 0x2A, 0x9B, 0x59, 0x08,
+  0x3B, 0x91, 0x03, 0x1B, 0x58, 0x4C, 0x9F, 0x28, 0xF6, 0x82, 0x18, 0x4A, 0xC8, 0x20, 0xA0, 0x11,
+  0xA9, 0x70, 0x1B, 0x49, 0xC0, 0x80, 0x30, 0x9D, 0x70, 0x9B, 0xC5, 0x18, 0x92, 0x3A, 0x0A, 0x18,
+  0x00, 0x88, 0x38, 0x0F, 0x40, 0x8A, 0x58, 0xE8, 0x02, 0x98, 0x58, 0x2E, 0x90, 0x80, 0x18, 0x91,
+  0x29, 0x80, 0x09, 0x28, 0x88, 0x21, 0x2D, 0x28, 0x09, 0xB2, 0x1B, 0x58, 0x4E, 0x88, 0xA1, 0xA2,
+  0xA3, 0xA0, 0x10, 0x0D, 0xA9, 0xB7, 0x01, 0x82, 0x88, 0xD3, 0x2A, 0x1A, 0x29, 0x90, 0x97, 0xA1,
+  0x7B, 0x2D, 0x18, 0xD4, 0x19, 0x19, 0xB3, 0x81, 0xA2, 0x09, 0x01, 0x98, 0xF3, 0x10, 0x88, 0x30,
+  0x0B, 0x6B, 0x19, 0x98, 0x90, 0xA8, 0x79, 0x4B, 0x8B, 0xB7, 0x08, 0x32, 0x0D, 0x11, 0x1A, 0x2A,
+  0x81, 0xF1, 0x88, 0xB4, 0x40, 0x10, 0xA8, 0x21, 0xA0, 0x49, 0x3E, 0xC9, 0x59, 0x3A, 0x3A, 0x18,
+  0x19, 0xF4, 0x4C, 0xF2, 0xA5, 0x3B, 0x88, 0x28, 0xDA, 0x97, 0xC3, 0x19, 0x08, 0xA1, 0x09, 0x10,
+  0xC3, 0x02, 0x3A, 0x90, 0x00, 0x18, 0x4B, 0x1E, 0x11, 0x80, 0xB0, 0x33, 0x3B, 0xB9, 0x04, 0x8B,
+  0x19, 0x40, 0x08, 0x3C, 0xF2, 0x00, 0x98, 0xA0, 0x8B, 0x92, 0x9B, 0x30, 0x9B, 0xC2, 0x2B, 0xE0,
+  0x9A, 0xD1, 0x82, 0x49, 0x0F, 0xA5, 0x18, 0x95, 0x3A, 0x8C, 0x12, 0x4A, 0xA0, 0xF7, 0x68, 0x99,
+  0x39, 0x89, 0xA6, 0x1C, 0x93, 0x81, 0x10, 0x98, 0x1B, 0x08, 0x1D, 0x80, 0x29, 0x92, 0x87, 0x2A,
+  0x81, 0x8A, 0xC3, 0x97, 0x1B, 0x04, 0xD0, 0x03, 0xB9, 0x82, 0x40, 0xEA, 0x83, 0x08, 0x00, 0x09,
+  0x98, 0x08, 0xA0, 0x39, 0x8A, 0x4B, 0x88, 0x2F, 0x1C, 0x91, 0x89, 0x80, 0x81, 0x80, 0x2A, 0x93,
+  0xF2, 0x91, 0xA7, 0x90, 0x7A, 0x89, 0xA1, 0x30, 0x2F, 0x18, 0x0B, 0x32, 0xAF, 0x61, 0x3C, 0x09,
+  0x2E, 0x81, 0x6C, 0x8A, 0x91, 0x82, 0xA0, 0x30, 0x80, 0x08, 0x02, 0x01, 0x8A, 0x48, 0x89, 0x04,
+  0x9B, 0x49, 0xBA, 0xC3, 0x1C, 0xA1, 0x88, 0x0A, 0x11, 0x2B, 0x0F, 0xA2, 0x98, 0x01, 0x98, 0x18,
+  0x4D, 0xD1, 0x80, 0x00, 0x90, 0x81, 0x7C, 0x2F, 0xA1, 0x1E, 0x82, 0x91, 0x08, 0x22, 0x89, 0x2C,
+  0xD5, 0xB2, 0x03, 0xD0, 0x28, 0x88, 0x21, 0x1F, 0x00, 0x0A, 0x02, 0x39, 0x80, 0x4A, 0x8A, 0x12,
+  0x08, 0xF8, 0x23, 0xB9, 0xE7, 0xA3, 0x80, 0x00, 0xB0, 0xC3, 0x04, 0x3D, 0x2C, 0xB8, 0x40, 0x4D,
+  0xA9, 0xC3, 0x30, 0x8A, 0xD0, 0x96, 0x80, 0x88, 0x10, 0x10, 0x2B, 0xFF, 0xC4, 0x93, 0x3A, 0xA3,
+  0xB5, 0x80, 0x03, 0x1A, 0x0A, 0xA9, 0x68, 0x39, 0x29, 0x00, 0x4D, 0xA8, 0x80, 0x2C, 0x39, 0x9A,
+  0x01, 0x98, 0x79, 0x98, 0x19, 0x91, 0xA9, 0x81, 0xB1, 0xB1, 0x72, 0xB8, 0x39, 0x98, 0x9C, 0x80,
+  0x00, 0x18, 0x8A, 0x58, 0xB3, 0xA4, 0xA8, 0x2B, 0x10, 0xB6, 0xF3, 0x01, 0x28, 0x5C, 0x18, 0x00,
+  0x2A, 0x85, 0xB3, 0x81, 0xE1, 0x81, 0x09, 0x85, 0xA8, 0x21, 0xB9, 0xF6, 0x10, 0xA9, 0x03, 0x78,
+  0x9A, 0x4A, 0x2C, 0x8B, 0x88, 0x85, 0x3A, 0x4A, 0xD0, 0x19, 0x48, 0x1E, 0x00, 0x98, 0x90, 0xA7,
+  0x20, 0x08, 0xB1, 0x12, 0x91, 0x4D, 0x9A, 0x80, 0x01, 0xA7, 0x94, 0x4B, 0xA1, 0xA1, 0x39, 0x9A,
+  0x82, 0x42, 0x1A, 0x9A, 0x12, 0xE0, 0xA1, 0x9D, 0x90, 0xC3, 0x10, 0x88, 0x21, 0x2B, 0xFB, 0x00,
+  0x00, 0x98, 0x0B, 0x10, 0x29, 0xB1, 0x07, 0xD9, 0x93, 0x88, 0x00, 0x6C, 0xA8, 0x01, 0x23, 0x18,
+  0x19, 0x1B, 0xB0, 0xF7, 0x93, 0x09, 0x68, 0x19, 0x88, 0x80, 0xA1, 0x88, 0xB0, 0xA2, 0x01, 0x00,
+  0x84, 0x91, 0xC1, 0xA0, 0x1F, 0xC1, 0x08, 0x93, 0x3F, 0x70, 0xDE, 0xB3, 0x21, 0xB0, 0xA0, 0x70,
+  0x09, 0x5A, 0x18, 0x3C, 0x3A, 0x3B, 0xE9, 0x82, 0x28, 0x14, 0x0F, 0x78, 0x3D, 0x0A, 0x18, 0x90,
+  0x92, 0x91, 0x80, 0xC2, 0x81, 0x10, 0xA8, 0x32, 0x1E, 0x10, 0x99, 0xB3, 0x0B, 0x2D, 0xB4, 0x19,
+  0x20, 0x2B, 0xB0, 0x32, 0x8F, 0xD1, 0xB3, 0x00, 0x00, 0x3B, 0x09, 0xA9, 0x92, 0x12, 0x9F, 0xA1,
+  0x59, 0x11, 0x0A, 0x58, 0x3A, 0x81, 0xD0, 0x78, 0x8B, 0x02, 0x1B, 0x84, 0x00, 0x20, 0x08, 0x1A,
+  0xAC, 0xF0, 0xA5, 0x30, 0x9F, 0x95, 0xC1, 0x93, 0xA2, 0x98, 0xA3, 0x01, 0x91, 0xA0, 0x02, 0xF3,
+  0x18, 0xA8, 0xB3, 0x88, 0x3B, 0x94, 0x0A, 0x94, 0x81, 0x4C, 0xB3, 0x01, 0x69, 0x38, 0x38, 0xC5,
+  0xD8, 0xE4, 0x5A, 0x5B, 0x1A, 0x08, 0xA1, 0xD2, 0x01, 0x98, 0x20, 0x09, 0x80, 0x92, 0xF3, 0x21,
+  0xA8, 0x5F, 0x2B, 0x0A, 0x81, 0x91, 0x58, 0xA8, 0x12, 0x8C, 0x00, 0x4B, 0x1B, 0x01, 0x70, 0x88,
+  0x10, 0xC2, 0x89, 0xA8, 0x0C, 0xA7, 0x08, 0x28, 0x91, 0x01, 0x98, 0x09, 0x0E, 0x5D, 0x0A, 0x88,
+  0x23, 0x1C, 0x39, 0x1C, 0x89, 0x02, 0x0F, 0x38, 0xB9, 0xA2, 0x22, 0xA2, 0xC7, 0xA0, 0xE2, 0xD3,
+  0x03, 0x82, 0x2B, 0xA5, 0xC3, 0xA1, 0xC3, 0x10, 0x88, 0x28, 0x31, 0xB8, 0xD4, 0x97, 0x89, 0xB4,
+  0x92, 0x9A, 0x42, 0x98, 0x00, 0x18, 0x18, 0x3E, 0x8E, 0x20, 0xAB, 0x83, 0xB3, 0x80, 0x51, 0x99,
+  0x98, 0xB2, 0xB8, 0xC0, 0x94, 0xA6, 0x90, 0x83, 0xA0, 0xE0, 0x40, 0xF0, 0x01, 0x18, 0x80, 0x28,
+  0xB0, 0xD3, 0xB2, 0x05, 0xC0, 0x18, 0x88, 0x02, 0x9A, 0x13, 0x6C, 0x09, 0xB2, 0x01, 0x79, 0xA8,
+  0x5A, 0x0C, 0x10, 0x8B, 0x13, 0x7B, 0xAB, 0x81, 0x95, 0x00, 0x3B, 0x4F, 0x8A, 0x19, 0x10, 0x18,
+  0x09, 0xB1, 0x81, 0x95, 0x91, 0x2D, 0xC0, 0x42, 0x9B, 0x14, 0x1A, 0x80, 0x33, 0x0B, 0x03, 0x98,
+  0xF1, 0xD1, 0x10, 0x01, 0x1D, 0x89, 0x38, 0x5B, 0x09, 0x1B, 0x98, 0x00, 0x9A, 0x88, 0x93, 0xA0,
+  0x14, 0xF1, 0xB0, 0x6A, 0x1A, 0x8A, 0xB1, 0x38, 0x92, 0x9A, 0x33, 0x1C, 0xAD, 0xD3, 0xB2, 0x88,
+  0x01, 0x5D, 0x19, 0xB1, 0x11, 0xD2, 0x02, 0x1C, 0xBA, 0x53, 0x40, 0xAA, 0x71, 0xA1, 0x03, 0x09,
+  0x95, 0x3F, 0x09, 0xA2, 0xBA, 0xA7, 0xA3, 0xB1, 0x92, 0x50, 0x2C, 0x08, 0xC1, 0x09, 0xA8, 0x22,
+  0x3F, 0x8A, 0x23, 0x78, 0x10, 0xA0, 0x59, 0xF8, 0x00, 0x2B, 0x4A, 0x83, 0x98, 0x15, 0xB0, 0x2A,
+  0x3C, 0x9B, 0x91, 0x08, 0x13, 0x06, 0xAA, 0xA7, 0x11, 0x8F, 0x10, 0x2A, 0xA9, 0x03, 0x7D, 0xA8,
+  0xA4, 0x18, 0xC0, 0x29, 0x8A, 0x28, 0x8B, 0xA4, 0x02, 0xA1, 0x18, 0x99, 0x3B, 0x3E, 0xD8, 0x92,
+  0x14, 0x3A, 0x19, 0x92, 0xF0, 0x92, 0x20, 0xA9, 0x0A, 0x82, 0x3B, 0x7C, 0x80, 0x83, 0xF3, 0xD4,
+  0x4E, 0xA9, 0xA2, 0x31, 0xA9, 0x40, 0x81, 0x08, 0x90, 0xE1, 0x01, 0x1A, 0x18, 0x08, 0x30, 0x72,
+  0x10, 0x90, 0x94, 0x3B, 0xFB, 0x40, 0x9D, 0xB3, 0x78, 0x09, 0x00, 0xB1, 0x33, 0xDA, 0x00, 0x10,
+  0x8B, 0x80, 0x01, 0x98, 0x04, 0xE1, 0xA1, 0x98, 0x19, 0x8B, 0x1B, 0x31, 0x99, 0x40, 0xA4, 0x88,
+  0x89, 0xE9, 0xA9, 0x89, 0x8E, 0x23, 0x48, 0xD0, 0x7B, 0x8B, 0x85, 0x00, 0xC0, 0x48, 0xA0, 0x01,
+  0x80, 0xB4, 0x83, 0x6B, 0x1B, 0x81, 0x38, 0x92, 0x10, 0x2F, 0xB3, 0x10, 0x2E, 0xA1, 0x30, 0x5D,
+  0x8A, 0xA1, 0x81, 0x91, 0xE0, 0x08, 0x1A, 0xA9, 0x32, 0x50, 0x09, 0xA8, 0x27, 0xB1, 0x87, 0x1B,
+  0xB2, 0x4F, 0xB9, 0x22, 0x8D, 0x95, 0x18, 0x0A, 0x02, 0x2A, 0x89, 0x08, 0x88, 0x89, 0x07, 0x88,
+  0x90, 0x31, 0x08, 0xF9, 0x80, 0x0A, 0xA8, 0x08, 0xB1, 0x22, 0x28, 0x95, 0x1F, 0xE2, 0x81, 0x1B,
+  0xA0, 0x88, 0x92, 0x02, 0x50, 0xE1, 0x10, 0x8C, 0xB3, 0x60, 0x9A, 0x10, 0xA4, 0x30, 0xD1, 0x12,
+  0x0B, 0xA3, 0x3C, 0xA9, 0x78, 0xD8, 0xA2, 0x00, 0x83, 0x21, 0x3F, 0xB1, 0x10, 0x58, 0xB8, 0x59,
+  0xD3, 0x81, 0x28, 0x99, 0x52, 0x9B, 0x7B, 0xA8, 0x08, 0x48, 0xBB, 0x14, 0x2B, 0x21, 0x90, 0x10,
+  0xA8, 0xB3, 0x0F, 0xF9, 0x11, 0x89, 0x08, 0x18, 0x92, 0x20, 0xA8, 0x8B, 0x60, 0x8D, 0x80, 0x5A,
+  0x0B, 0x03, 0xB0, 0x20, 0x4D, 0xA0, 0x11, 0xC0, 0x28, 0xB4, 0x6C, 0xB0, 0x00, 0x92, 0x80, 0x90,
+  0x11, 0x3C, 0xF7, 0x48, 0x8B, 0x82, 0x19, 0x91, 0x38, 0xB0, 0x90, 0x94, 0x0B, 0x14, 0x1C, 0xA1,
+  0xA2, 0x0B, 0x97, 0xC0, 0x21, 0xA9, 0x51, 0xA0, 0x85, 0x6B, 0x80, 0xC9, 0x93, 0x3D, 0xE1, 0x93,
+  0x98, 0x93, 0x28, 0x09, 0x48, 0x0B, 0x09, 0xB9, 0x42, 0xD9, 0x28, 0x21, 0xC2, 0x79, 0xBA, 0x96,
+  0x19, 0x91, 0x00, 0x1B, 0x91, 0x21, 0xA1, 0x92, 0x8D, 0xE4, 0x38, 0x89, 0x88, 0x1B, 0x81, 0x72,
+  0xA8, 0x84, 0x2C, 0x2A, 0x08, 0xC3, 0x92, 0x20, 0x29, 0x0A, 0xC1, 0x10, 0xBA, 0xEA, 0xC2, 0x81,
+  0x22, 0x0F, 0x87, 0x19, 0xA2, 0x22, 0x80, 0x8C, 0xB0, 0x08, 0xA0, 0x0F, 0xA8, 0x04, 0x9B, 0x87,
+  0x2B, 0x21, 0xB0, 0x20, 0x98, 0x04, 0x98, 0x1A, 0x3B, 0xC4, 0x8B, 0xB4, 0x29, 0x89, 0x98, 0x10,
+  0x12, 0x1D, 0xB3, 0x32, 0x1F, 0x00, 0x7B, 0x89, 0x10, 0x80, 0x58, 0x99, 0xB0, 0xA3, 0x51, 0x2C,
+  0x80, 0x80, 0x94, 0x38, 0x7B, 0x98, 0xB1, 0x80, 0xA0, 0xBA, 0x3D, 0xC9, 0x01, 0x40, 0xCA, 0x02,
+  0x08, 0x7A, 0x98, 0xB3, 0x23, 0x2D, 0xE2, 0x28, 0x98, 0x95, 0x1C, 0x28, 0xD1, 0xA2, 0x28, 0x3D,
+  0xEA, 0x01, 0x88, 0x32, 0x0A, 0x8A, 0x92, 0x32, 0xC5, 0x3A, 0x1F, 0x02, 0x5B, 0x08, 0x29, 0x4C,
+  0x89, 0xA2, 0x93, 0xA1, 0x59, 0x09, 0x88, 0x12, 0x19, 0x30, 0x1C, 0xC4, 0x11, 0x2A, 0x9A, 0x8C,
+  0x10, 0x20, 0x8D, 0xE6, 0x81, 0x82, 0x0A, 0x21, 0x1D, 0x91, 0x4E, 0x0A, 0x81, 0x92, 0x29, 0xC2,
+  0x20, 0xA9, 0x19, 0x92, 0xF3, 0x4C, 0x3A, 0xA8, 0xA6, 0x3A, 0x5E, 0x8A, 0x80, 0x90, 0x90, 0x81,
+  0xA0, 0x81, 0xE2, 0x00, 0x19, 0x09, 0x31, 0x99, 0x18, 0xD5, 0x38, 0x9B, 0x87, 0x7B, 0x89, 0x81,
+  0x92, 0x29, 0xA8, 0x83, 0x20, 0x99, 0x89, 0xA0, 0x7E, 0x8B, 0xA1, 0x23, 0x1C, 0xC1, 0x79, 0x0B,
+  0xB2, 0x31, 0x1E, 0x08, 0x09, 0x08, 0x80, 0x1A, 0xC5, 0x81, 0x91, 0x10, 0x8A, 0x11, 0x8D, 0x81,
+  0x23, 0x1F, 0xA4, 0x38, 0x08, 0x3C, 0x1B, 0x91, 0xB1, 0x80, 0x21, 0xDA, 0xC7, 0x94, 0x0A, 0x92,
+  0x1B, 0xA3, 0xC5, 0x00, 0x89, 0xA2, 0x93, 0xB2, 0x42, 0x3A, 0x2B, 0x82, 0x7B, 0x99, 0x30, 0x0F,
+  0x93, 0x10, 0x98, 0x70, 0x1B, 0xB1, 0x81, 0x3B, 0x1A, 0x9C, 0xB1, 0xB3, 0x2B, 0x17, 0x3D, 0xA0,
+  0x02, 0x4B, 0x99, 0x30, 0x3B, 0x00, 0xC2, 0x86, 0x91, 0x60, 0xCB, 0x95, 0x5B, 0xE3, 0xA3, 0x00,
+  0x91, 0x91, 0xB0, 0xA1, 0x79, 0x88, 0x90, 0x91, 0x10, 0x91, 0x9A, 0xB1, 0x23, 0xF9, 0x18, 0xA1,
+  0x6A, 0x0A, 0x91, 0x2A, 0x81, 0x1B, 0x0C, 0xD4, 0x59, 0xAA, 0x82, 0x40, 0xC1, 0x95, 0x19, 0x99,
+  0xB3, 0x80, 0x3C, 0xB9, 0x02, 0x2D, 0xF2, 0x83, 0x1A, 0xA4, 0x20, 0x89, 0xB2, 0x29, 0x91, 0x20,
+  0xBA, 0xA2, 0x12, 0xA5, 0x4B, 0x89, 0x10, 0x2E, 0x00, 0x88, 0x98, 0xB3, 0x19, 0x0A, 0x91, 0x1B,
+  0x11, 0x1C, 0xA0, 0x11, 0xCA, 0xB7, 0x48, 0x8A, 0xA2, 0x01, 0x89, 0x29, 0x09, 0xA2, 0x93, 0x4A,
+  0x09, 0xB3, 0x40, 0x09, 0x93, 0x39, 0x19, 0xA1, 0x84, 0x98, 0x02, 0x19, 0x92, 0x00, 0x00, 0x90,
+  0x90, 0x99, 0x10, 0x99, 0x19, 0x09, 0xA1, 0x39, 0x99, 0x90, 0x99, 0x09, 0x19, 0x99, 0x01, 0x90,
+  0x01, 0x10, 0x10, 0x99, 0x10, 0x19, 0x91, 0x01, 0x19, 0x10, 0x91, 0x11, 0x00, 0x00, 0x00, 0x10,
+  0x09, 0x10, 0x09, 0x01, 0x1A, 0x90, 0x11, 0x10, 0x3A, 0x0B, 0x10, 0x99, 0x19, 0x99, 0x91, 0x01,
+  0x19, 0x91, 0x10, 0x19, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x90,
+  0x10, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
@@ -1,873 +1,229 @@
-// Auto-generated by wav_to_header.py  do not edit
-// Source: sneeze, 16000Hz mono 16-bit, 6865 samples, 429ms
+// Auto-generated by wav_to_header.py — do not edit
+// Source: sneeze, 16000Hz mono IMA-ADPCM 4-bit, 6865 samples, 429ms
 #pragma once
 #include <cstdint>
 
 static const uint32_t SNEEZE_SAMPLE_RATE = 16000;
 static const uint32_t SNEEZE_SAMPLES = 6865;
 static const uint32_t SNEEZE_DURATION_MS = 429;
-static const uint32_t SNEEZE_PCM_LEN = 13730;
+static const uint32_t SNEEZE_ADPCM_LEN = 3437;
 
-// PCM data: 16-bit signed LE, mono, 16000Hz
-// Pour jouer en I2S stereo, dupliquer chaque sample sur L+R
-static const uint8_t SNEEZE_PCM[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
-  0xFE, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFE, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x04, 0x00, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x01, 0x00,
-  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0xFF, 0xF9, 0xFF,
-  0xF8, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0xFC, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xFE, 0xFF, 0x02, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0xF4, 0xFF, 0xF2, 0xFF,
-  0xF9, 0xFF, 0x04, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00,
-  0x02, 0x00, 0xFE, 0xFF, 0xF5, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x0C, 0x00,
-  0x0B, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xEE, 0xFF, 0xEE, 0xFF,
-  0xF8, 0xFF, 0x03, 0x00, 0x05, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x0F, 0x00,
-  0x0E, 0x00, 0x05, 0x00, 0xF9, 0xFF, 0xEF, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0x01, 0x00,
-  0x02, 0x00, 0xFD, 0xFF, 0xFC, 0xFF, 0x05, 0x00, 0x12, 0x00, 0x12, 0x00, 0x06, 0x00, 0xF9, 0xFF,
-  0xF5, 0xFF, 0xF2, 0xFF, 0xEE, 0xFF, 0xF7, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x09, 0x00,
-  0x14, 0x00, 0x14, 0x00, 0x05, 0x00, 0xFA, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xFA, 0xFF, 0xF4, 0xFF,
-  0xF3, 0xFF, 0xFB, 0xFF, 0x08, 0x00, 0x0A, 0x00, 0x10, 0x00, 0x1C, 0x00, 0x1A, 0x00, 0x06, 0x00,
-  0xEC, 0xFF, 0xE7, 0xFF, 0xE9, 0xFF, 0xEA, 0xFF, 0xEF, 0xFF, 0x04, 0x00, 0x13, 0x00, 0x13, 0x00,
-  0x0D, 0x00, 0x17, 0x00, 0x18, 0x00, 0x11, 0x00, 0xF7, 0xFF, 0xDA, 0xFF, 0xCF, 0xFF, 0xE4, 0xFF,
-  0xF9, 0xFF, 0x11, 0x00, 0x16, 0x00, 0x15, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x11, 0x00,
-  0xF8, 0xFF, 0xE2, 0xFF, 0xDA, 0xFF, 0xE5, 0xFF, 0xF3, 0xFF, 0x04, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x02, 0x00, 0x10, 0x00, 0x21, 0x00, 0x29, 0x00, 0x0E, 0x00, 0xE0, 0xFF, 0xC5, 0xFF, 0xD3, 0xFF,
-  0xE9, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0x04, 0x00, 0x08, 0x00, 0x17, 0x00, 0x24, 0x00, 0x23, 0x00,
-  0x0E, 0x00, 0xF4, 0xFF, 0xE0, 0xFF, 0xDB, 0xFF, 0xCC, 0xFF, 0xD8, 0xFF, 0xF5, 0xFF, 0x15, 0x00,
-  0x29, 0x00, 0x2C, 0x00, 0x14, 0x00, 0xF5, 0xFF, 0xEA, 0xFF, 0xF4, 0xFF, 0x14, 0x00, 0x38, 0x00,
-  0x0A, 0x00, 0xBA, 0xFF, 0xA4, 0xFF, 0xDD, 0xFF, 0x49, 0x00, 0x65, 0x00, 0x3B, 0x00, 0x16, 0x00,
-  0xE1, 0xFF, 0xBD, 0xFF, 0xCB, 0xFF, 0x0B, 0x00, 0x4F, 0x00, 0x39, 0x00, 0xED, 0xFF, 0xBD, 0xFF,
-  0xBF, 0xFF, 0x00, 0x00, 0x53, 0x00, 0x58, 0x00, 0x15, 0x00, 0xD6, 0xFF, 0xC9, 0xFF, 0xFB, 0xFF,
-  0x39, 0x00, 0x3B, 0x00, 0xF2, 0xFF, 0x95, 0xFF, 0x8E, 0xFF, 0xE9, 0xFF, 0x53, 0x00, 0x79, 0x00,
-  0x4F, 0x00, 0x0C, 0x00, 0xE2, 0xFF, 0xE8, 0xFF, 0x06, 0x00, 0xFE, 0xFF, 0xD3, 0xFF, 0xAD, 0xFF,
-  0xBC, 0xFF, 0xF4, 0xFF, 0x31, 0x00, 0x59, 0x00, 0x72, 0x00, 0x3C, 0x00, 0xFB, 0xFF, 0xCE, 0xFF,
-  0xC6, 0xFF, 0xC8, 0xFF, 0xDD, 0xFF, 0xDB, 0xFF, 0xE4, 0xFF, 0xF1, 0xFF, 0x0A, 0x00, 0x09, 0x00,
-  0x0D, 0x00, 0x0B, 0x00, 0x1B, 0x00, 0x16, 0x00, 0x09, 0x00, 0xE6, 0xFF, 0xC9, 0xFF, 0xB0, 0xFF,
-  0xBF, 0xFF, 0xDB, 0xFF, 0xFB, 0xFF, 0xF2, 0xFF, 0xED, 0xFF, 0xF7, 0xFF, 0x0C, 0x00, 0x20, 0x00,
-  0x25, 0x00, 0x1F, 0x00, 0x1D, 0x00, 0xED, 0xFF, 0xAB, 0xFF, 0x91, 0xFF, 0xC0, 0xFF, 0xF2, 0xFF,
-  0xF9, 0xFF, 0xF0, 0xFF, 0x23, 0x00, 0x6E, 0x00, 0xEE, 0x00, 0xE7, 0x00, 0x0D, 0x00, 0x17, 0xFF,
-  0x1E, 0xFF, 0xBC, 0xFF, 0x19, 0x00, 0xFC, 0xFF, 0x3B, 0x00, 0x6C, 0x00, 0x2C, 0x00, 0xCC, 0xFF,
-  0xF1, 0xFF, 0x5A, 0x00, 0x5B, 0x00, 0xE1, 0xFF, 0x97, 0xFF, 0xB8, 0xFF, 0x0C, 0x00, 0x0F, 0x00,
-  0x05, 0x00, 0x52, 0x00, 0x95, 0x00, 0x28, 0x00, 0xB9, 0xFF, 0xF7, 0xFF, 0x8C, 0x00, 0x76, 0x00,
-  0xBD, 0xFF, 0xA6, 0xFF, 0x5F, 0x00, 0x98, 0x00, 0x68, 0x00, 0x60, 0x00, 0x8A, 0x00, 0x64, 0x00,
-  0xDD, 0xFF, 0xB8, 0xFF, 0x01, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xA7, 0xFF, 0xDB, 0xFF, 0xBD, 0x00,
-  0x23, 0x01, 0x8F, 0x00, 0xD9, 0xFF, 0xAE, 0xFF, 0xF3, 0xFF, 0xDD, 0xFF, 0x45, 0xFF, 0xCE, 0xFE,
-  0xB9, 0xFE, 0xC8, 0xFE, 0x37, 0xFF, 0xD9, 0xFF, 0x3D, 0x00, 0x17, 0x00, 0xB8, 0xFF, 0xA8, 0xFF,
-  0xD0, 0xFF, 0xD0, 0xFF, 0x9A, 0xFF, 0x44, 0xFF, 0xFB, 0xFE, 0x00, 0xFF, 0x4B, 0xFF, 0xCF, 0xFF,
-  0x39, 0x00, 0x6C, 0x00, 0x2E, 0x00, 0xBC, 0xFF, 0x66, 0xFF, 0xAE, 0xFF, 0x0A, 0x00, 0x4E, 0x00,
-  0x62, 0x00, 0x5F, 0x00, 0x04, 0x00, 0xAF, 0xFF, 0xFA, 0xFF, 0xC5, 0x00, 0x3C, 0x01, 0xB5, 0x00,
-  0x67, 0x00, 0x49, 0x00, 0x69, 0x00, 0x13, 0x00, 0xDB, 0xFF, 0xED, 0xFF, 0x05, 0x00, 0x87, 0xFF,
-  0xBC, 0xFF, 0x15, 0x01, 0xC0, 0x01, 0x74, 0x01, 0x30, 0x00, 0x02, 0xFF, 0x08, 0xFF, 0x82, 0xFF,
-  0x26, 0x00, 0xBB, 0x00, 0x86, 0x00, 0xF4, 0xFF, 0x75, 0xFF, 0x16, 0x00, 0x9D, 0x01, 0x4C, 0x02,
-  0x25, 0x01, 0x34, 0x00, 0x86, 0x00, 0xDC, 0x01, 0x9F, 0x02, 0x9B, 0x02, 0xAF, 0x01, 0xD6, 0x00,
-  0xA9, 0xFF, 0xB8, 0xFD, 0xDC, 0xFC, 0x4A, 0xFD, 0x06, 0xFD, 0x90, 0xFD, 0xCB, 0xFF, 0x81, 0x01,
-  0xE2, 0x01, 0x83, 0x01, 0x19, 0x01, 0xC4, 0x00, 0x89, 0x00, 0x26, 0x00, 0x43, 0xFF, 0x25, 0xFE,
-  0xD9, 0xFD, 0xF5, 0xFD, 0xA2, 0xFE, 0xFE, 0xFF, 0x45, 0x01, 0xC9, 0x01, 0xED, 0x01, 0xE1, 0x01,
-  0x67, 0x01, 0x9F, 0xFE, 0xDD, 0xFA, 0x2C, 0xFA, 0x03, 0xFC, 0x70, 0xFD, 0x42, 0xFE, 0x39, 0xFF,
-  0x99, 0x00, 0x99, 0x01, 0x0A, 0x02, 0x88, 0x02, 0x3C, 0x02, 0x6D, 0x00, 0x29, 0xFE, 0x13, 0xFD,
-  0x7C, 0xFD, 0x8F, 0xFE, 0x55, 0xFF, 0xB4, 0xFF, 0xF6, 0xFF, 0x9C, 0x00, 0x70, 0x01, 0xC1, 0x01,
-  0x81, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x33, 0xFF, 0x92, 0xFF, 0x81, 0x00, 0xBB, 0x00, 0x24, 0x00,
-  0x61, 0x00, 0x9E, 0x01, 0x81, 0x02, 0xD3, 0x01, 0x51, 0x00, 0x41, 0xFF, 0xD2, 0xFF, 0xE7, 0x00,
-  0x8F, 0x01, 0xF6, 0xFF, 0x47, 0xFE, 0xC5, 0xFD, 0x36, 0xFF, 0x05, 0x01, 0x3C, 0x02, 0x08, 0x01,
-  0x9E, 0xFF, 0xB5, 0xFE, 0x27, 0x00, 0x70, 0x01, 0x28, 0x01, 0x8B, 0xFF, 0xBF, 0xFE, 0x0D, 0xFF,
-  0xCB, 0x00, 0x7B, 0x02, 0x30, 0x03, 0x19, 0x03, 0x96, 0x02, 0x5A, 0x03, 0x03, 0x05, 0x6D, 0x05,
-  0x84, 0x03, 0xEE, 0xFF, 0x99, 0xFA, 0xE5, 0xF6, 0xF2, 0xF6, 0xE5, 0xFA, 0x86, 0xFF, 0xF7, 0x01,
-  0xEA, 0x01, 0x88, 0x01, 0x13, 0x02, 0xA8, 0x03, 0x8B, 0x04, 0x2E, 0x03, 0xEA, 0xFF, 0x08, 0xFC,
-  0xE9, 0xF9, 0xC1, 0xFA, 0x9F, 0xFD, 0x36, 0x00, 0xAB, 0x01, 0x0F, 0x02, 0x94, 0x02, 0x39, 0x03,
-  0x1A, 0x01, 0x42, 0xFD, 0x40, 0xFB, 0x2A, 0xFA, 0x37, 0xF9, 0x04, 0xFA, 0x6B, 0xFC, 0x52, 0xFF,
-  0x27, 0x01, 0x0B, 0x02, 0x41, 0x03, 0xD5, 0x03, 0xBF, 0x02, 0xB7, 0x00, 0xC2, 0xFE, 0x41, 0xFD,
-  0x7B, 0xFC, 0x65, 0xFC, 0x98, 0xFD, 0x52, 0xFF, 0xDF, 0x00, 0x9A, 0x01, 0x2D, 0x02, 0xD0, 0x02,
-  0x07, 0x03, 0x1F, 0x02, 0x3C, 0x00, 0x39, 0xFF, 0xC9, 0xFF, 0x8E, 0x00, 0x54, 0x00, 0xAF, 0xFF,
-  0x5F, 0x00, 0x6B, 0x01, 0x7E, 0x02, 0xE6, 0x02, 0x9A, 0x02, 0x4D, 0x00, 0xF2, 0xFF, 0x75, 0xFE,
-  0x66, 0xFF, 0x8B, 0xFF, 0x38, 0xFF, 0x08, 0xFD, 0x2F, 0xFE, 0xD4, 0xFF, 0x2A, 0x02, 0x85, 0x01,
-  0xDA, 0x00, 0xEA, 0xFF, 0x97, 0x00, 0x8E, 0x00, 0xB9, 0x00, 0x74, 0xFF, 0x71, 0xFE, 0xEB, 0xFE,
-  0x6D, 0x00, 0xF3, 0x01, 0x09, 0x03, 0x74, 0x04, 0x3E, 0x05, 0x7D, 0x05, 0x0F, 0x06, 0x13, 0x08,
-  0xE0, 0x09, 0x9C, 0x06, 0x5C, 0xF7, 0x0C, 0xE9, 0x42, 0xED, 0xB7, 0xFB, 0x8D, 0x01, 0xD8, 0x00,
-  0xDF, 0x01, 0x62, 0x03, 0xA4, 0x03, 0x51, 0x06, 0xCF, 0x09, 0x26, 0x08, 0x74, 0x01, 0x41, 0xF9,
-  0x94, 0xF3, 0x62, 0xF5, 0x45, 0xFD, 0x9E, 0x02, 0x81, 0x02, 0xE3, 0x00, 0x94, 0xFE, 0xF8, 0xFD,
-  0x22, 0xFF, 0xBF, 0xFF, 0xDF, 0xFE, 0xAD, 0xFB, 0x71, 0xF7, 0x00, 0xF8, 0xFC, 0xFC, 0xCB, 0x01,
-  0x0C, 0x03, 0x52, 0x02, 0x78, 0x02, 0xFB, 0x02, 0x24, 0x02, 0xC5, 0x00, 0x53, 0xFF, 0xF5, 0xFC,
-  0x93, 0xFA, 0x9D, 0xFA, 0xE8, 0xFD, 0xF1, 0x01, 0x67, 0x03, 0x2F, 0x03, 0x0C, 0x03, 0xDC, 0x03,
-  0x72, 0x03, 0xDB, 0x01, 0xEC, 0x00, 0x84, 0x01, 0x53, 0x00, 0x4F, 0xFE, 0xAC, 0xFE, 0x2A, 0x02,
-  0x40, 0x03, 0xAD, 0x00, 0xD4, 0xFF, 0xBF, 0x00, 0x57, 0x01, 0x71, 0x00, 0x6B, 0xFF, 0x2D, 0xFF,
-  0xB9, 0xFE, 0x41, 0xFD, 0x93, 0xFD, 0x3E, 0xFF, 0x54, 0x01, 0xC6, 0x01, 0x89, 0x00, 0x50, 0xFF,
-  0x8E, 0x00, 0x8C, 0x01, 0xE9, 0x00, 0xA4, 0xFF, 0x48, 0xFF, 0xDE, 0xFF, 0x9F, 0xFF, 0x96, 0x00,
-  0x84, 0x03, 0xB9, 0x06, 0xA1, 0x07, 0x8E, 0x07, 0x3C, 0x08, 0x09, 0x0B, 0xD7, 0x0C, 0x48, 0x02,
-  0x3E, 0xEC, 0x9A, 0xE2, 0x28, 0xF0, 0xA2, 0xFE, 0xFC, 0x00, 0x28, 0x01, 0x52, 0x04, 0xB4, 0x04,
-  0x2E, 0x05, 0xAF, 0x09, 0x6C, 0x0C, 0x9D, 0x07, 0x4C, 0xFE, 0xA3, 0xF4, 0xDE, 0xEF, 0x3D, 0xF5,
-  0x30, 0xFF, 0xD9, 0x03, 0xAC, 0x02, 0x9E, 0xFE, 0x0B, 0xFC, 0xFB, 0xFD, 0x02, 0x00, 0x86, 0x00,
-  0xA8, 0xFE, 0xE9, 0xF8, 0x1A, 0xF5, 0xB5, 0xF8, 0xC3, 0xFF, 0x84, 0x04, 0x85, 0x04, 0x76, 0x02,
-  0x89, 0x01, 0x9A, 0x01, 0x45, 0x02, 0xFF, 0x01, 0xC5, 0xFE, 0x62, 0xF9, 0xA0, 0xF7, 0xF8, 0xFB,
-  0x0B, 0x03, 0x35, 0x06, 0xEA, 0x03, 0x1E, 0x01, 0xC2, 0x02, 0x4E, 0x05, 0x47, 0x05, 0x97, 0x03,
-  0xE5, 0x00, 0x3D, 0xFF, 0x39, 0xFF, 0x7C, 0x00, 0x50, 0x02, 0xBF, 0xFF, 0x47, 0xFC, 0x16, 0xFD,
-  0xF4, 0xFE, 0x47, 0x01, 0xFE, 0x02, 0xF4, 0x01, 0x5C, 0xFE, 0x83, 0xFD, 0x2A, 0xFD, 0xF8, 0xFF,
-  0xC0, 0x00, 0xA5, 0x00, 0xC9, 0xFE, 0xCC, 0xFD, 0xB0, 0xFE, 0x1A, 0x02, 0x9A, 0x03, 0x23, 0x02,
-  0xEC, 0xFF, 0x76, 0x00, 0x04, 0x04, 0x6B, 0x06, 0xB5, 0x07, 0x9B, 0x08, 0x4F, 0x0B, 0x1E, 0x0E,
-  0x54, 0x0F, 0xF4, 0x03, 0x3D, 0xEC, 0xE1, 0xDF, 0x03, 0xEA, 0x99, 0xF8, 0x50, 0xFF, 0xC6, 0x03,
-  0x97, 0x05, 0x1D, 0x04, 0xC8, 0x04, 0x8B, 0x0B, 0xEB, 0x0E, 0x83, 0x0A, 0x9E, 0x00, 0x95, 0xF4,
-  0x99, 0xEC, 0xB2, 0xF0, 0xD6, 0xFB, 0x96, 0x02, 0x69, 0x03, 0xF3, 0x02, 0xE9, 0x04, 0x1E, 0x07,
-  0xA6, 0x04, 0x23, 0xFD, 0x4B, 0xF7, 0x60, 0xF3, 0xED, 0xF1, 0xE3, 0xF3, 0x80, 0xF9, 0xBA, 0xFF,
-  0x51, 0x04, 0x37, 0x06, 0x68, 0x07, 0x12, 0x08, 0x92, 0x06, 0xF6, 0x01, 0x85, 0xFB, 0xF3, 0xF7,
-  0x17, 0xF8, 0xB5, 0xFA, 0xF9, 0xFC, 0xE8, 0xFF, 0x4C, 0x03, 0x42, 0x06, 0xCE, 0x06, 0xFC, 0x06,
-  0x6B, 0x05, 0x21, 0x03, 0x09, 0x00, 0x54, 0xFD, 0x15, 0xFF, 0xAD, 0x02, 0x06, 0x03, 0xEA, 0xFF,
-  0x6D, 0x00, 0xF5, 0xFE, 0xC4, 0xFE, 0xF7, 0xFF, 0x31, 0x01, 0x29, 0x00, 0x28, 0xFC, 0x91, 0xFB,
-  0x19, 0xFF, 0xBA, 0x01, 0x74, 0x01, 0x30, 0x02, 0x06, 0x02, 0x47, 0x00, 0xA2, 0xFE, 0xB3, 0xFE,
-  0x0D, 0x00, 0x11, 0xFF, 0xF4, 0xFD, 0xA3, 0xFE, 0x14, 0x01, 0xFF, 0x03, 0x31, 0x07, 0x9D, 0x08,
-  0x25, 0x0A, 0x78, 0x0E, 0xA9, 0x14, 0x36, 0x15, 0xCF, 0x01, 0x3E, 0xE2, 0x06, 0xD9, 0x2F, 0xEC,
-  0x20, 0xFB, 0xFD, 0xFC, 0xAC, 0x01, 0xE0, 0x06, 0x83, 0x04, 0x3B, 0x05, 0xD9, 0x0F, 0xF6, 0x13,
-  0x81, 0x0A, 0xF7, 0xFC, 0xBF, 0xF0, 0x4A, 0xE9, 0x89, 0xEF, 0x51, 0xFD, 0x38, 0x03, 0x97, 0x01,
-  0x1A, 0x02, 0x2D, 0x07, 0xFF, 0x0C, 0xA6, 0x0F, 0xEE, 0x0A, 0x97, 0xFE, 0xCA, 0xEC, 0xA8, 0xDF,
-  0xD2, 0xE4, 0xFA, 0xF4, 0xC1, 0xFF, 0xCB, 0x01, 0xB2, 0x03, 0xA3, 0x08, 0xC9, 0x0E, 0x9B, 0x0F,
-  0xC3, 0x0A, 0x89, 0x00, 0xA6, 0xF5, 0x31, 0xF0, 0xE2, 0xF2, 0x89, 0xF9, 0x27, 0xFF, 0x0A, 0x02,
-  0x34, 0x04, 0x26, 0x08, 0xC8, 0x0B, 0x78, 0x0B, 0xB2, 0x07, 0xC7, 0x00, 0x0E, 0xFC, 0x48, 0xF9,
-  0x6C, 0xFA, 0x6E, 0xFE, 0x79, 0x01, 0xC4, 0xFE, 0x0C, 0xFC, 0x03, 0x01, 0xE1, 0x06, 0x5A, 0x08,
-  0x29, 0x04, 0xB5, 0xFB, 0x44, 0xF7, 0xC8, 0xF7, 0x3D, 0xFC, 0x81, 0xFF, 0x87, 0x01, 0x5F, 0x00,
-  0xC2, 0x01, 0xFD, 0x01, 0x6E, 0x05, 0xE7, 0x08, 0xD9, 0x07, 0x42, 0x04, 0x83, 0x03, 0x60, 0x06,
-  0xA0, 0x0C, 0x0A, 0x15, 0xF5, 0x1A, 0x74, 0x0F, 0xAD, 0xEC, 0x50, 0xCE, 0x38, 0xD8, 0xB6, 0xF9,
-  0x63, 0x09, 0xF4, 0x02, 0xF4, 0xFF, 0x2F, 0x02, 0x4A, 0x03, 0x89, 0x09, 0x43, 0x15, 0xE2, 0x13,
-  0x1B, 0x03, 0x8B, 0xF1, 0xD6, 0xE6, 0x23, 0xE8, 0xD4, 0xF7, 0x4F, 0x07, 0xFD, 0x05, 0xAB, 0xFD,
-  0x58, 0xFE, 0xE3, 0x07, 0x70, 0x10, 0xBE, 0x11, 0xD3, 0x0A, 0xFA, 0xFF, 0xF7, 0xF5, 0xC9, 0xEF,
-  0x5E, 0xF2, 0xC2, 0xF8, 0xFA, 0xF6, 0xE4, 0xEA, 0xB5, 0xEB, 0x01, 0xFE, 0xD8, 0x0F, 0xD0, 0x12,
-  0x0B, 0x0A, 0xD2, 0x00, 0xFF, 0xFC, 0x47, 0xFE, 0x8E, 0xFF, 0xBC, 0x00, 0xC3, 0xFB, 0xBC, 0xF8,
-  0xBA, 0xF9, 0xD8, 0xFF, 0x8D, 0x04, 0x77, 0x06, 0x5C, 0x04, 0x03, 0x00, 0xB5, 0xFD, 0xF2, 0x00,
-  0xFA, 0x04, 0x82, 0x02, 0x84, 0xFE, 0xCA, 0xFD, 0x85, 0x02, 0x42, 0x04, 0x1F, 0x03, 0x20, 0x02,
-  0x10, 0x00, 0xC8, 0xFC, 0x19, 0xFC, 0x28, 0xFE, 0x60, 0xFF, 0x74, 0xFD, 0x62, 0xFB, 0xB6, 0xFD,
-  0x03, 0x02, 0x69, 0x04, 0x35, 0x04, 0x32, 0x04, 0x64, 0x05, 0xB3, 0x06, 0xC0, 0x05, 0xFD, 0x05,
-  0x4E, 0x0C, 0xE9, 0x13, 0x83, 0x15, 0xAE, 0x0A, 0x26, 0xF8, 0xA7, 0xE7, 0x1C, 0xE0, 0x27, 0xE7,
-  0x4E, 0xF8, 0x77, 0x02, 0xBE, 0x01, 0x59, 0x02, 0x4D, 0x06, 0x5E, 0x09, 0x3C, 0x0D, 0xD5, 0x10,
-  0xE3, 0x09, 0x75, 0xF9, 0x33, 0xEE, 0xF6, 0xED, 0x09, 0xF3, 0xC8, 0xF9, 0x68, 0x00, 0x08, 0x02,
-  0x82, 0x01, 0x10, 0x05, 0xD5, 0x0B, 0x0B, 0x0F, 0x64, 0x0C, 0xE3, 0x04, 0x3D, 0xFB, 0xA0, 0xF4,
-  0x41, 0xF4, 0x44, 0xF8, 0x4F, 0xFD, 0x95, 0xFE, 0x3F, 0xF8, 0x5C, 0xF3, 0xC7, 0xF5, 0xCC, 0xFC,
-  0xEC, 0x04, 0x92, 0x06, 0x15, 0x02, 0xA0, 0xFD, 0x4C, 0xFE, 0xB6, 0x01, 0x41, 0x05, 0xBC, 0x03,
-  0xD3, 0xFF, 0xD8, 0xFC, 0x1E, 0xFD, 0x9B, 0xFF, 0x92, 0xFF, 0x72, 0xFE, 0x1F, 0xFD, 0x14, 0xFF,
-  0x4F, 0x03, 0x62, 0x06, 0x2F, 0x06, 0x4C, 0x02, 0x6B, 0x01, 0x61, 0xFF, 0x02, 0x02, 0x4E, 0x03,
-  0xC3, 0x01, 0xEC, 0xFC, 0x25, 0xFA, 0x9A, 0xFB, 0xCD, 0xFE, 0x27, 0x00, 0x3F, 0x00, 0xC8, 0x00,
-  0x77, 0x00, 0xF1, 0x00, 0xC9, 0x01, 0x06, 0x02, 0x15, 0x03, 0xE2, 0x03, 0x91, 0x04, 0xCF, 0x05,
-  0xF7, 0x09, 0x6A, 0x10, 0xB2, 0x15, 0xE3, 0x10, 0x43, 0x03, 0xEA, 0xF4, 0x72, 0xE7, 0xA2, 0xE1,
-  0xD5, 0xEA, 0x9E, 0xFA, 0xDC, 0xFF, 0xCA, 0x00, 0x60, 0x04, 0x9D, 0x08, 0xDA, 0x0B, 0x8C, 0x10,
-  0x80, 0x0F, 0xA7, 0x03, 0x6C, 0xF6, 0x71, 0xF0, 0xF5, 0xEF, 0xCF, 0xF2, 0x0F, 0xFA, 0xBB, 0xFF,
-  0xCC, 0x00, 0x4C, 0x02, 0xD3, 0x07, 0xB8, 0x0D, 0xBF, 0x0F, 0xDE, 0x0B, 0x92, 0x02, 0xB8, 0xF9,
-  0x4E, 0xF5, 0x58, 0xF5, 0x4E, 0xF8, 0x93, 0xFC, 0xBC, 0xFE, 0x26, 0x00, 0x97, 0xFC, 0x91, 0xEE,
-  0x52, 0xF2, 0x83, 0xFF, 0x28, 0x09, 0x86, 0x02, 0x73, 0xFC, 0x45, 0xFB, 0x9B, 0x03, 0xAA, 0x06,
-  0xDC, 0x06, 0x87, 0x04, 0xAD, 0xFE, 0x88, 0xFB, 0xA3, 0xF9, 0x72, 0xFD, 0xED, 0xFE, 0x38, 0xFF,
-  0x7D, 0xFE, 0x14, 0xFF, 0xD1, 0x03, 0x98, 0x08, 0x79, 0x09, 0xB2, 0x04, 0x28, 0x01, 0xB8, 0xFF,
-  0x44, 0x00, 0xAA, 0xFF, 0xA8, 0xFC, 0x0B, 0xFC, 0x85, 0xFA, 0xB5, 0xFC, 0x33, 0xFC, 0x8F, 0x01,
-  0xC5, 0x01, 0x16, 0x01, 0xB5, 0x03, 0xF9, 0x07, 0xB2, 0x0A, 0x1E, 0x0A, 0xFA, 0x0A, 0x43, 0x0E,
-  0x38, 0x13, 0x9E, 0x10, 0xDA, 0x06, 0x17, 0xF7, 0x9F, 0xE5, 0xFE, 0xDC, 0x1A, 0xE6, 0xC0, 0xF9,
-  0xB0, 0x01, 0xFB, 0x01, 0x21, 0x04, 0xAC, 0x08, 0x3E, 0x0B, 0x0B, 0x10, 0xF0, 0x10, 0xA0, 0x06,
-  0x11, 0xF8, 0x28, 0xEF, 0x99, 0xEE, 0x0B, 0xF2, 0x9E, 0xF9, 0x05, 0xFF, 0xB4, 0xFF, 0x7A, 0x00,
-  0xCF, 0x06, 0x8A, 0x0E, 0x48, 0x11, 0xD4, 0x0C, 0x61, 0x03, 0x41, 0xFB, 0xE5, 0xF6, 0x43, 0xF6,
-  0x0A, 0xF8, 0x8F, 0xFB, 0x02, 0xFD, 0x59, 0xFE, 0x84, 0xFD, 0x1B, 0xFA, 0x1C, 0xFA, 0xF7, 0xFA,
-  0x78, 0xFB, 0x03, 0xFD, 0xCE, 0xFD, 0xBA, 0xFD, 0xEA, 0xFF, 0xB8, 0x02, 0xE1, 0x05, 0xD6, 0x06,
-  0x75, 0x03, 0xEA, 0x00, 0x0A, 0xFE, 0x17, 0xFC, 0x5D, 0xF9, 0xE4, 0xF9, 0x51, 0xFD, 0xDF, 0x01,
-  0x91, 0x03, 0xC5, 0x03, 0x44, 0x05, 0xF2, 0x06, 0x8A, 0x09, 0x1F, 0x06, 0x85, 0x00, 0xC4, 0xF9,
-  0xC9, 0xF9, 0x5F, 0xFD, 0xAB, 0xFC, 0xCE, 0xFB, 0x66, 0xFB, 0xBE, 0xFD, 0x6C, 0x02, 0xCC, 0x06,
-  0x76, 0x09, 0x0F, 0x0A, 0x3D, 0x0B, 0xE4, 0x0E, 0x36, 0x15, 0xFA, 0x16, 0x60, 0x12, 0x1E, 0x03,
-  0xF7, 0xEC, 0x87, 0xD8, 0x19, 0xD9, 0x0D, 0xEF, 0x2D, 0x01, 0x05, 0x02, 0x0C, 0xFF, 0x6B, 0x02,
-  0xE3, 0x09, 0x7F, 0x13, 0xBE, 0x17, 0x04, 0x10, 0xD5, 0xFE, 0xD4, 0xF0, 0xAF, 0xEB, 0x6D, 0xED,
-  0xFB, 0xF4, 0x66, 0xFC, 0x00, 0xFD, 0x1C, 0xFC, 0x4B, 0x02, 0xCC, 0x0C, 0x56, 0x15, 0x98, 0x14,
-  0x69, 0x09, 0xFC, 0xFC, 0xB4, 0xF7, 0x5D, 0xF7, 0x90, 0xF7, 0x54, 0xF8, 0x1B, 0xF9, 0x34, 0xFA,
-  0xD7, 0xFE, 0xB3, 0x02, 0xDA, 0xFF, 0xFE, 0xFA, 0x66, 0xF6, 0x0F, 0xFA, 0xD6, 0xFD, 0xFC, 0xFE,
-  0xDF, 0xFB, 0xBD, 0xFC, 0x71, 0xFF, 0xC6, 0x05, 0x92, 0x07, 0x27, 0x06, 0x09, 0x02, 0x05, 0xFE,
-  0x9C, 0xFB, 0x3C, 0xF9, 0xE1, 0xF9, 0x1B, 0xFD, 0xEA, 0xFF, 0xB0, 0x00, 0xD3, 0x02, 0x13, 0x06,
-  0xAF, 0x08, 0xFB, 0x07, 0x90, 0x04, 0x83, 0x04, 0xA0, 0x01, 0x44, 0xFD, 0x01, 0xF6, 0xD1, 0xF6,
-  0x49, 0xFB, 0x83, 0x00, 0xC3, 0x02, 0x19, 0x05, 0xD9, 0x08, 0x32, 0x10, 0x6A, 0x18, 0xA1, 0x1D,
-  0x4C, 0x1F, 0x88, 0x16, 0xF4, 0xFE, 0x38, 0xDC, 0xF5, 0xC9, 0xF4, 0xDB, 0xC1, 0xF7, 0x64, 0xFE,
-  0x67, 0xF7, 0xBE, 0xF8, 0x05, 0x06, 0x63, 0x17, 0xE6, 0x21, 0x6E, 0x1E, 0xC1, 0x0D, 0x71, 0xFB,
-  0xE6, 0xEE, 0xF2, 0xE9, 0x2D, 0xED, 0x1B, 0xF3, 0x62, 0xF2, 0xAC, 0xEF, 0x28, 0xF6, 0x45, 0x06,
-  0x4B, 0x17, 0x37, 0x1D, 0x58, 0x14, 0x11, 0x08, 0x87, 0x02, 0x15, 0x00, 0xDB, 0xFB, 0x8D, 0xF6,
-  0x9D, 0xF1, 0x5C, 0xEF, 0xCD, 0xF2, 0xF8, 0xFA, 0xD4, 0xF9, 0x78, 0xF4, 0xCF, 0xFA, 0x55, 0x07,
-  0x07, 0x0B, 0x34, 0x04, 0x02, 0xFE, 0x30, 0xFE, 0xF1, 0xFF, 0x1C, 0xFE, 0xF0, 0xFE, 0x69, 0x00,
-  0xF9, 0xFF, 0xDF, 0xFC, 0x55, 0xFA, 0x9E, 0xFC, 0x80, 0xFF, 0x40, 0x01, 0x57, 0x00, 0xB9, 0xFF,
-  0xB9, 0x00, 0x19, 0x05, 0x01, 0x06, 0x58, 0x03, 0x1C, 0x00, 0x24, 0x00, 0x94, 0x01, 0xD9, 0x01,
-  0xCB, 0xFF, 0xE4, 0xFC, 0xE0, 0xFD, 0x11, 0x04, 0x32, 0x0B, 0x59, 0x0F, 0xD9, 0x15, 0x98, 0x21,
-  0xC8, 0x27, 0x64, 0x1C, 0x63, 0xFA, 0x96, 0xD2, 0xA4, 0xCB, 0x24, 0xEA, 0x74, 0xFD, 0x5F, 0xF0,
-  0xDA, 0xE4, 0xEF, 0xF0, 0x67, 0x08, 0x2E, 0x1C, 0x67, 0x24, 0x33, 0x1E, 0x99, 0x0F, 0x44, 0x01,
-  0x9D, 0xF7, 0x57, 0xF6, 0x6C, 0xF8, 0x6F, 0xF0, 0x0F, 0xE2, 0xB3, 0xE0, 0x37, 0xF1, 0x67, 0x08,
-  0x38, 0x17, 0x93, 0x14, 0xD5, 0x0B, 0x12, 0x0D, 0xD2, 0x11, 0x4A, 0x0E, 0x78, 0x04, 0x66, 0xF8,
-  0x54, 0xED, 0x37, 0xE9, 0x4B, 0xEB, 0xB2, 0xE1, 0x0C, 0xE6, 0x4D, 0xF7, 0xE2, 0x09, 0xA0, 0x0B,
-  0x2D, 0x0A, 0x47, 0x0A, 0xE6, 0x10, 0xDC, 0x0A, 0xFD, 0x00, 0x1D, 0xFB, 0xA5, 0xFA, 0x8A, 0xF7,
-  0xC8, 0xF2, 0x99, 0xF2, 0x6F, 0xF9, 0x36, 0x01, 0x0C, 0x04, 0x2B, 0x04, 0x72, 0x03, 0xFA, 0x05,
-  0x81, 0x06, 0x8F, 0x01, 0xF4, 0x00, 0x98, 0x01, 0x4B, 0x00, 0x95, 0xFE, 0xD3, 0xFD, 0xFE, 0xFF,
-  0x1C, 0x05, 0xE9, 0x0A, 0x81, 0x0F, 0xFD, 0x17, 0x61, 0x2A, 0x67, 0x3B, 0xEA, 0x2A, 0x6A, 0xE7,
-  0x37, 0xB0, 0x60, 0xCE, 0x08, 0x0C, 0xE7, 0x02, 0x73, 0xD4, 0x6F, 0xCD, 0x1E, 0xED, 0x7B, 0x14,
-  0xB2, 0x28, 0x98, 0x23, 0xC8, 0x1A, 0x89, 0x0F, 0x21, 0x01, 0xB2, 0x04, 0x0A, 0x11, 0x84, 0x01,
-  0x3B, 0xDD, 0x14, 0xCC, 0xB5, 0xDC, 0x02, 0xFD, 0x76, 0x0D, 0x04, 0x03, 0x9C, 0xFA, 0xE3, 0x08,
-  0x0D, 0x1E, 0x4E, 0x26, 0xFF, 0x1B, 0xC6, 0x07, 0x1A, 0xF8, 0x82, 0xF0, 0xDB, 0xDE, 0xC5, 0xD6,
-  0x5A, 0xDF, 0x2F, 0xEC, 0x84, 0xED, 0xEC, 0xF7, 0x0E, 0x08, 0x81, 0x19, 0xBF, 0x16, 0x1D, 0x0D,
-  0x5B, 0x08, 0xDB, 0x0B, 0xF6, 0x05, 0xBA, 0xF9, 0x40, 0xEF, 0xD4, 0xEF, 0x8C, 0xF0, 0x4E, 0xF4,
-  0x15, 0xFD, 0x09, 0x05, 0x7A, 0x05, 0x04, 0x06, 0xFB, 0x06, 0xA1, 0x0B, 0x04, 0x0C, 0x43, 0x07,
-  0x01, 0xFF, 0x83, 0x01, 0xBE, 0x06, 0x94, 0x0C, 0x52, 0x0F, 0xC5, 0x16, 0xA8, 0x22, 0xFA, 0x33,
-  0x11, 0x24, 0x06, 0xE2, 0x4F, 0xBA, 0x63, 0xE8, 0x74, 0x15, 0xB0, 0xFB, 0xD9, 0xCC, 0x54, 0xBD,
-  0x66, 0xED, 0x2D, 0x2B, 0x0F, 0x20, 0xB7, 0xFF, 0x9C, 0x09, 0x77, 0x11, 0x59, 0x17, 0xEF, 0x1D,
-  0x5C, 0x10, 0x3C, 0xFE, 0x4D, 0xEA, 0x02, 0xDB, 0x85, 0xEC, 0x2A, 0xFE, 0x9E, 0xF7, 0x2A, 0xE8,
-  0x86, 0xE6, 0xBE, 0x02, 0x3B, 0x22, 0xF1, 0x1D, 0xAE, 0x0D, 0x3A, 0xFD, 0x9C, 0xF5, 0x89, 0xFB,
-  0x27, 0xFC, 0x63, 0xED, 0x5D, 0xE3, 0xBF, 0xE1, 0x48, 0xF0, 0xBF, 0xFE, 0x1F, 0x05, 0xF4, 0x03,
-  0xF4, 0x03, 0xA6, 0x09, 0x90, 0x12, 0xED, 0x0D, 0xB2, 0x02, 0x17, 0xFA, 0x24, 0xF7, 0x7C, 0xF9,
-  0x00, 0xFB, 0xE4, 0xF7, 0x8F, 0xF8, 0x85, 0xFD, 0x47, 0x03, 0xEB, 0x05, 0xE9, 0x05, 0xA7, 0x07,
-  0xF3, 0x08, 0xA8, 0x0B, 0xA4, 0x10, 0xB2, 0x12, 0x64, 0x15, 0x72, 0x1F, 0xF9, 0x35, 0xF8, 0x42,
-  0x42, 0x08, 0xC5, 0xB2, 0x79, 0xC6, 0xA8, 0x0D, 0x2C, 0x11, 0x16, 0xDF, 0x46, 0xA9, 0x8B, 0xBF,
-  0x12, 0x18, 0x50, 0x2F, 0xF4, 0x02, 0xCF, 0xF6, 0xB7, 0x0D, 0xD6, 0x25, 0xE9, 0x28, 0xAC, 0x19,
-  0x64, 0x08, 0x75, 0xF6, 0xAE, 0xEE, 0xEB, 0xF4, 0x37, 0xF6, 0x0B, 0xF4, 0x44, 0xE8, 0x6A, 0xDA,
-  0xEB, 0xED, 0x42, 0x0D, 0x85, 0x09, 0x4D, 0xEF, 0x10, 0xEB, 0xC1, 0xFF, 0xE5, 0x11, 0xA1, 0x0C,
-  0x15, 0xF4, 0xA0, 0xE9, 0xEA, 0xFB, 0x05, 0x10, 0xE0, 0x04, 0x25, 0xF3, 0xFF, 0xF6, 0x0A, 0x04,
-  0x6B, 0x09, 0xA7, 0x04, 0x9C, 0xF9, 0x28, 0xF6, 0x1E, 0xFF, 0x7F, 0x06, 0xAD, 0x02, 0x34, 0xFD,
-  0x13, 0xFD, 0x7E, 0xFF, 0xF9, 0x03, 0x71, 0x0A, 0xF2, 0x0A, 0xD3, 0x05, 0x87, 0x07, 0x7A, 0x0D,
-  0x03, 0x18, 0x95, 0x23, 0x37, 0x2C, 0x5B, 0x3D, 0xE6, 0x17, 0xAE, 0xD5, 0x85, 0xE3, 0x00, 0x0F,
-  0x05, 0x08, 0x5D, 0xEE, 0x8F, 0xB5, 0x40, 0xB7, 0x94, 0x03, 0x93, 0x13, 0x24, 0xEA, 0x48, 0xE2,
-  0x48, 0x00, 0xDE, 0x26, 0xF3, 0x25, 0xBD, 0x18, 0x65, 0x0E, 0x93, 0x08, 0x9C, 0x16, 0x86, 0x12,
-  0xB7, 0xF8, 0x38, 0xF7, 0x8C, 0xEF, 0xDA, 0xE0, 0x40, 0xDE, 0x51, 0xE1, 0x0B, 0xE4, 0xB0, 0xE8,
-  0x20, 0xED, 0xC9, 0xFB, 0x29, 0xFA, 0x75, 0x06, 0x27, 0x0F, 0xB6, 0x07, 0x49, 0x0B, 0x34, 0x0E,
-  0x6C, 0x08, 0x3D, 0x04, 0xA1, 0xFF, 0x92, 0xFD, 0xDD, 0xFA, 0x51, 0xFB, 0x12, 0xFB, 0x5D, 0xF9,
-  0xD8, 0xFF, 0x1D, 0x07, 0x9F, 0x00, 0x01, 0xFC, 0x17, 0xFF, 0xF4, 0x05, 0xED, 0x09, 0x1B, 0x09,
-  0x0F, 0x05, 0x70, 0x06, 0x45, 0x11, 0x10, 0x1B, 0xAB, 0x1F, 0xD0, 0x29, 0xD8, 0x2B, 0xB5, 0x05,
-  0xAA, 0xEF, 0x4B, 0x04, 0x2F, 0x0A, 0x8E, 0x06, 0x07, 0xED, 0x67, 0xC7, 0xA2, 0xD6, 0x81, 0xFB,
-  0x75, 0xF9, 0xD7, 0xE0, 0xD8, 0xDC, 0xBC, 0xF9, 0xCB, 0x10, 0x2E, 0x12, 0x1D, 0x08, 0x26, 0x00,
-  0x08, 0x0E, 0xDB, 0x1F, 0x28, 0x12, 0x6B, 0xFB, 0xC2, 0xF7, 0x8A, 0xF9, 0x48, 0xF5, 0x63, 0xF1,
-  0xD7, 0xE9, 0xC9, 0xE4, 0x4F, 0xEB, 0x92, 0xF6, 0xC4, 0xF6, 0xDD, 0xF6, 0x11, 0xFE, 0xAB, 0x00,
-  0xD1, 0x03, 0x2A, 0x0B, 0x8F, 0x08, 0xC8, 0x01, 0xFF, 0x01, 0x23, 0x05, 0xBE, 0x04, 0xDE, 0x04,
-  0x42, 0x04, 0xC9, 0x00, 0x06, 0x03, 0x86, 0x08, 0x9B, 0x07, 0xDE, 0x01, 0xE9, 0xFF, 0xD8, 0x02,
-  0xBF, 0x04, 0xD9, 0x04, 0xE4, 0x00, 0x31, 0xFE, 0xF1, 0x02, 0x1D, 0x0A, 0xC1, 0x0B, 0xBC, 0x0B,
-  0xCF, 0x11, 0xDB, 0x0E, 0x3C, 0x04, 0xB2, 0x02, 0x10, 0x07, 0xA1, 0x08, 0x0B, 0x04, 0x2D, 0xF6,
-  0xB7, 0xF0, 0x7E, 0xF8, 0x3F, 0xFF, 0xFD, 0xF7, 0x4D, 0xEE, 0x5B, 0xF2, 0x0E, 0xFD, 0x60, 0x01,
-  0xF7, 0xFC, 0x71, 0xF6, 0xC2, 0xF6, 0xCE, 0xFE, 0x57, 0x03, 0x86, 0xFD, 0x88, 0xF8, 0x58, 0xFB,
-  0x84, 0xFF, 0x38, 0x01, 0x9F, 0xFF, 0x28, 0xFD, 0x6F, 0xFE, 0x1F, 0x02, 0xE6, 0x02, 0x0F, 0x00,
-  0xD9, 0xFE, 0x89, 0x03, 0x05, 0x04, 0x8F, 0x04, 0x12, 0x03, 0x04, 0xFF, 0x92, 0xFB, 0xD3, 0xFA,
-  0x09, 0xFA, 0x86, 0xFA, 0xE8, 0xFA, 0x99, 0xFB, 0x4C, 0xFE, 0xD8, 0x00, 0x4E, 0x04, 0x5E, 0x03,
-  0xB2, 0x01, 0xC2, 0x00, 0xA9, 0x04, 0x6C, 0x07, 0x61, 0x04, 0xF6, 0xFF, 0x99, 0xFF, 0x9B, 0x03,
-  0xD6, 0x05, 0xE1, 0x03, 0xD3, 0x00, 0xD1, 0x00, 0x6E, 0x03, 0x3C, 0x04, 0x92, 0x01, 0x97, 0x00,
-  0xCA, 0x00, 0x37, 0xFF, 0xDA, 0xFD, 0x56, 0xFC, 0xEF, 0xFD, 0xAC, 0x00, 0xAC, 0x00, 0xF2, 0xFE,
-  0x83, 0xFE, 0x01, 0x01, 0xA6, 0x03, 0xDA, 0x02, 0x51, 0x00, 0x06, 0xFF, 0x5A, 0x00, 0x3A, 0x01,
-  0x45, 0x00, 0x9F, 0xFD, 0xF0, 0xFC, 0x3D, 0xFD, 0xD9, 0xFD, 0xD6, 0xFD, 0x94, 0xFC, 0x18, 0xFD,
-  0xE3, 0xFD, 0xD3, 0xFD, 0x1C, 0xFE, 0xD6, 0xFE, 0xE8, 0xFF, 0xB7, 0x00, 0x88, 0x00, 0x5A, 0xFF,
-  0xD8, 0xFE, 0xD2, 0xFF, 0x1C, 0x01, 0xF7, 0x00, 0x74, 0xFF, 0xAB, 0xFE, 0xA5, 0xFD, 0x5B, 0xFE,
-  0x15, 0xFF, 0x8C, 0x00, 0x1B, 0x01, 0xC7, 0xFF, 0x1E, 0xFE, 0x05, 0x00, 0x50, 0x03, 0xB8, 0x04,
-  0xA5, 0x02, 0x63, 0x00, 0x1B, 0x01, 0xA1, 0x02, 0x0F, 0x03, 0x29, 0x01, 0x75, 0xFF, 0xB9, 0x00,
-  0x76, 0x02, 0x1E, 0x02, 0xD7, 0x00, 0xB3, 0xFF, 0x85, 0xFF, 0xF7, 0xFF, 0x8E, 0xFF, 0xC8, 0xFE,
-  0x7C, 0xFE, 0xD2, 0xFE, 0x53, 0xFF, 0xA9, 0xFF, 0x12, 0x00, 0xC8, 0x00, 0xD4, 0x00, 0xAA, 0x00,
-  0xEE, 0x00, 0x2F, 0x01, 0x41, 0x01, 0xE1, 0x00, 0xCE, 0xFF, 0x79, 0xFF, 0xC0, 0xFE, 0xE3, 0xFE,
-  0xF7, 0xFC, 0x84, 0xFE, 0xD6, 0xFE, 0x2C, 0xFF, 0x58, 0xFE, 0xEE, 0xFE, 0xD7, 0xFF, 0x30, 0x01,
-  0x6D, 0x01, 0x73, 0x00, 0x6D, 0xFF, 0xE5, 0xFF, 0xBE, 0x00, 0xA3, 0x00, 0xA6, 0xFF, 0xEC, 0xFE,
-  0xAD, 0xFE, 0x0A, 0xFF, 0x8F, 0xFF, 0xA4, 0xFF, 0x6B, 0xFF, 0xCF, 0xFF, 0x1D, 0x00, 0xA0, 0xFF,
-  0x0C, 0x00, 0xB6, 0x00, 0x3D, 0x00, 0xB8, 0xFF, 0xB7, 0xFF, 0x68, 0x00, 0xD0, 0x01, 0x1B, 0x02,
-  0x6C, 0x01, 0x9D, 0x00, 0x39, 0x01, 0x8D, 0x02, 0x49, 0x02, 0xA2, 0x00, 0x87, 0xFF, 0x5C, 0xFF,
-  0xD9, 0xFF, 0xA2, 0xFF, 0xB6, 0xFE, 0x2E, 0xFE, 0x36, 0xFE, 0xA8, 0xFE, 0xC8, 0xFE, 0xFA, 0xFE,
-  0xC8, 0xFF, 0xB1, 0x00, 0x00, 0x01, 0x32, 0x01, 0x65, 0x01, 0xA6, 0x01, 0x52, 0x02, 0x65, 0x02,
-  0x31, 0x01, 0xB3, 0xFF, 0xF0, 0xFE, 0x2C, 0xFF, 0x94, 0xFF, 0x2B, 0xFF, 0xFD, 0xFD, 0xB8, 0xFD,
-  0x1D, 0xFF, 0x15, 0x00, 0x0A, 0x00, 0x46, 0xFF, 0x03, 0xFF, 0x95, 0xFF, 0x13, 0x00, 0x57, 0x00,
-  0x8B, 0x00, 0x56, 0x00, 0x29, 0x00, 0x5D, 0x00, 0x82, 0x00, 0x77, 0x00, 0x3C, 0x00, 0x8D, 0xFF,
-  0xB4, 0xFF, 0xA9, 0xFF, 0xE1, 0xFE, 0x8B, 0xFE, 0xC0, 0xFE, 0x10, 0xFF, 0x27, 0xFF, 0xFE, 0xFE,
-  0xF6, 0xFF, 0x77, 0x01, 0xCC, 0x01, 0x46, 0x01, 0xF3, 0x00, 0x53, 0x01, 0xB4, 0x01, 0xEE, 0x01,
-  0x24, 0x01, 0x13, 0x00, 0xEA, 0xFF, 0xF6, 0xFF, 0x9C, 0xFF, 0x43, 0xFF, 0x0C, 0xFF, 0xCF, 0xFE,
-  0x0B, 0xFF, 0x28, 0xFF, 0xC1, 0xFE, 0xFE, 0xFE, 0xB6, 0xFF, 0xD7, 0xFF, 0xE5, 0xFF, 0x3B, 0x00,
-  0xCA, 0x00, 0x74, 0x01, 0x86, 0x01, 0x2D, 0x01, 0xA7, 0x00, 0x54, 0x00, 0x57, 0x00, 0x71, 0x00,
-  0x58, 0x00, 0x86, 0xFF, 0xA4, 0xFE, 0xAC, 0xFE, 0x59, 0xFF, 0xDB, 0xFF, 0xA4, 0xFF, 0x33, 0xFF,
-  0x25, 0xFF, 0xA6, 0xFF, 0x50, 0x00, 0x88, 0x00, 0x47, 0x00, 0x22, 0x00, 0x16, 0x00, 0x7D, 0x00,
-  0xBE, 0x00, 0x3E, 0x00, 0xDB, 0xFF, 0x03, 0x00, 0x07, 0x00, 0xD4, 0xFF, 0x5E, 0xFF, 0x29, 0xFF,
-  0x47, 0xFF, 0x27, 0xFF, 0xF5, 0xFE, 0x2C, 0xFF, 0xA9, 0xFF, 0x08, 0x00, 0xED, 0xFF, 0x12, 0x00,
-  0xAE, 0x00, 0x2C, 0x01, 0x3E, 0x01, 0xDA, 0x00, 0x99, 0x00, 0xB8, 0x00, 0xC5, 0x00, 0x96, 0x00,
-  0x30, 0x00, 0xD1, 0xFF, 0xA8, 0xFF, 0x95, 0xFF, 0x74, 0xFF, 0x56, 0xFF, 0x38, 0xFF, 0x4A, 0xFF,
-  0x74, 0xFF, 0x9C, 0xFF, 0x9B, 0xFF, 0xD3, 0xFF, 0x6B, 0x00, 0xB4, 0x00, 0x87, 0x00, 0x92, 0x00,
-  0x8B, 0x00, 0xAD, 0x00, 0xEC, 0x00, 0x94, 0x00, 0x25, 0x00, 0xC1, 0xFF, 0x81, 0xFF, 0xA0, 0xFF,
-  0x9E, 0xFF, 0x49, 0xFF, 0xE1, 0xFE, 0xE7, 0xFE, 0x7C, 0xFF, 0xE6, 0xFF, 0xDE, 0xFF, 0xD5, 0xFF,
-  0x18, 0x00, 0xA5, 0x00, 0xF3, 0x00, 0xB4, 0x00, 0x48, 0x00, 0xEE, 0xFF, 0xFB, 0xFF, 0x1B, 0x00,
-  0xC0, 0xFF, 0x5F, 0xFF, 0x4F, 0xFF, 0x62, 0xFF, 0xA5, 0xFF, 0xB3, 0xFF, 0xC3, 0xFF, 0x02, 0x00,
-  0x36, 0x00, 0x51, 0x00, 0x3C, 0x00, 0x20, 0x00, 0x40, 0x00, 0x3B, 0x00, 0x26, 0x00, 0x1B, 0x00,
-  0xF8, 0xFF, 0x01, 0x00, 0x08, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0x03, 0x00, 0x14, 0x00,
-  0x08, 0x00, 0x11, 0x00, 0x0D, 0x00, 0xE4, 0xFF, 0xE4, 0xFF, 0xDE, 0xFF, 0xF7, 0xFF, 0x16, 0x00,
-  0xF3, 0xFF, 0xE4, 0xFF, 0xDE, 0xFF, 0xE7, 0xFF, 0x2F, 0x00, 0x47, 0x00, 0x38, 0x00, 0x35, 0x00,
-  0x11, 0x00, 0x07, 0x00, 0x26, 0x00, 0x13, 0x00, 0xDB, 0xFF, 0xA5, 0xFF, 0x8F, 0xFF, 0xB6, 0xFF,
-  0xD8, 0xFF, 0xCF, 0xFF, 0xC5, 0xFF, 0xD9, 0xFF, 0x19, 0x00, 0x4A, 0x00, 0x47, 0x00, 0x20, 0x00,
-  0xFA, 0xFF, 0x03, 0x00, 0x21, 0x00, 0x1F, 0x00, 0xE5, 0xFF, 0xAE, 0xFF, 0xB4, 0xFF, 0xD3, 0xFF,
-  0xDC, 0xFF, 0xD3, 0xFF, 0xD9, 0xFF, 0xEF, 0xFF, 0x0D, 0x00, 0xFC, 0xFF, 0x08, 0x00, 0x1C, 0x00,
-  0x31, 0x00, 0x15, 0x00, 0xF8, 0xFF, 0x0E, 0x00, 0x18, 0x00, 0x26, 0x00, 0x28, 0x00, 0x14, 0x00,
-  0x12, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x11, 0x00, 0x0E, 0x00, 0xF8, 0xFF, 0xD7, 0xFF, 0xD5, 0xFF,
-  0xED, 0xFF, 0xF1, 0xFF, 0xF6, 0xFF, 0xFA, 0xFF, 0xF9, 0xFF, 0x10, 0x00, 0x23, 0x00, 0x1D, 0x00,
-  0x1C, 0x00, 0x1A, 0x00, 0x0D, 0x00, 0x01, 0x00, 0xF9, 0xFF, 0xEF, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF,
-  0xE6, 0xFF, 0xD2, 0xFF, 0xD1, 0xFF, 0xE4, 0xFF, 0xFD, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFC, 0xFF,
-  0x0C, 0x00, 0x13, 0x00, 0xF5, 0xFF, 0xD8, 0xFF, 0xE6, 0xFF, 0x05, 0x00, 0x10, 0x00, 0xF0, 0xFF,
-  0xDF, 0xFF, 0xF4, 0xFF, 0x12, 0x00, 0x15, 0x00, 0xFB, 0xFF, 0xEF, 0xFF, 0xFA, 0xFF, 0x0B, 0x00,
-  0x0A, 0x00, 0xF9, 0xFF, 0xF6, 0xFF, 0x08, 0x00, 0x0C, 0x00, 0xFD, 0xFF, 0xEF, 0xFF, 0xED, 0xFF,
-  0xF3, 0xFF, 0xF6, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF, 0x09, 0x00, 0x14, 0x00, 0x11, 0x00, 0x18, 0x00,
-  0x1A, 0x00, 0x0E, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xEB, 0xFF, 0xF0, 0xFF,
-  0xFA, 0xFF, 0x08, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x0C, 0x00, 0x12, 0x00, 0x0E, 0x00, 0xFE, 0xFF,
-  0xED, 0xFF, 0xF2, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xE2, 0xFF, 0xE1, 0xFF, 0xF6, 0xFF, 0x07, 0x00,
-  0x08, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x1D, 0x00, 0x19, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFA, 0xFF,
-  0xF7, 0xFF, 0xF6, 0xFF, 0xE3, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xF3, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xF6, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x08, 0x00, 0x0A, 0x00,
-  0x03, 0x00, 0xF7, 0xFF, 0xF3, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0xF9, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF,
-  0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0x07, 0x00, 0x0A, 0x00,
-  0x09, 0x00, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFE, 0xFF,
-  0xFE, 0xFF, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFC, 0xFF, 0xF9, 0xFF, 0xF4, 0xFF, 0xEF, 0xFF,
-  0xED, 0xFF, 0xED, 0xFF, 0xEF, 0xFF, 0xF5, 0xFF, 0xF6, 0xFF, 0xF9, 0xFF, 0x03, 0x00, 0x0B, 0x00,
-  0x0E, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x05, 0x00, 0xF9, 0xFF, 0xF4, 0xFF,
-  0xFA, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF4, 0xFF, 0xF4, 0xFF, 0xF8, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00,
-  0x03, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF,
-  0xF8, 0xFF, 0xF7, 0xFF, 0xF6, 0xFF, 0xF7, 0xFF, 0xF9, 0xFF, 0xFD, 0xFF, 0x01, 0x00, 0x03, 0x00,
-  0x08, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x09, 0x00, 0x05, 0x00, 0xFE, 0xFF,
-  0xFA, 0xFF, 0xF7, 0xFF, 0xF2, 0xFF, 0xF0, 0xFF, 0xED, 0xFF, 0xEE, 0xFF, 0xF4, 0xFF, 0xF7, 0xFF,
-  0xF8, 0xFF, 0xFB, 0xFF, 0x02, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00,
-  0x05, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF,
-  0xF5, 0xFF, 0xF3, 0xFF, 0xF5, 0xFF, 0xF8, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0x01, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x06, 0x00, 0x07, 0x00, 0x09, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFD, 0xFF, 0xFB, 0xFF, 0xF7, 0xFF, 0xF6, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF,
-  0xFC, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00,
-  0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0xF9, 0xFF,
-  0xF7, 0xFF, 0xF5, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x02, 0x00,
-  0x04, 0x00, 0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-  0xFD, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x02, 0x00,
-  0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFB, 0xFF,
-  0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x02, 0x00,
-  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF,
-  0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFE, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF,
-  0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00,
-  0x02, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x02, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x0A, 0x00, 0xEE, 0xFF,
-  0x02, 0x00, 0x0B, 0x00, 0xFA, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00,
-  0x07, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFB, 0xFF, 0xF0, 0xFF, 0xCD, 0xFF, 0x7F, 0xFF,
-  0x6C, 0xFF, 0xCD, 0xFF, 0x06, 0x01, 0x90, 0xFF, 0x67, 0x00, 0xE5, 0xFF, 0xE3, 0xFF, 0x32, 0x00,
-  0xDF, 0xFF, 0x26, 0x00, 0xD4, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0xEE, 0xFF, 0x29, 0x00, 0xCB, 0xFF,
-  0xFB, 0xFF, 0xDD, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x16, 0x00, 0xFC, 0xFF, 0x16, 0x00, 0xDB, 0xFF,
-  0xEE, 0xFF, 0xCE, 0xFF, 0x04, 0x00, 0x61, 0x00, 0x0D, 0x00, 0xEA, 0xFF, 0xC2, 0xFF, 0xDD, 0xFF,
-  0x12, 0x00, 0xAB, 0xFF, 0xB0, 0xFF, 0xA8, 0xFF, 0xD2, 0xFF, 0xF2, 0xFF, 0x5F, 0x00, 0x5F, 0x00,
-  0x0E, 0x01, 0xE2, 0x00, 0xBE, 0xFA, 0x1F, 0x04, 0x80, 0xFD, 0x31, 0x01, 0xF8, 0xFF, 0x1D, 0xFF,
-  0x74, 0x00, 0xE5, 0xFE, 0x91, 0x00, 0x48, 0xFE, 0x35, 0x01, 0xEB, 0x00, 0xF0, 0xFE, 0xB2, 0x01,
-  0x50, 0xFF, 0xA1, 0x00, 0xFA, 0xFF, 0x85, 0x00, 0x2A, 0x01, 0x7A, 0x04, 0x5D, 0xFC, 0x7E, 0x07,
-  0x66, 0xF7, 0xA6, 0x02, 0x71, 0xFF, 0xB6, 0x03, 0x08, 0xFD, 0xA6, 0x0B, 0x73, 0xF0, 0x77, 0x0E,
-  0x36, 0xF5, 0x2C, 0x04, 0xAF, 0xF9, 0x0A, 0x08, 0xA0, 0xFC, 0x45, 0x01, 0x8D, 0x02, 0x21, 0xFC,
-  0x34, 0x04, 0x96, 0xFC, 0xD7, 0x00, 0x31, 0xFD, 0x6E, 0x03, 0x51, 0xFF, 0x48, 0xFF, 0xF8, 0x03,
-  0xE2, 0xFF, 0x6A, 0xFF, 0x29, 0xFC, 0xEF, 0x03, 0xC9, 0xFA, 0x81, 0x02, 0x1D, 0x02, 0xCF, 0xFB,
-  0x87, 0x03, 0xA4, 0xFD, 0x39, 0xFF, 0x45, 0x00, 0xF7, 0xFE, 0xCC, 0x03, 0x6E, 0xFE, 0xD7, 0xFF,
-  0xE3, 0x02, 0x12, 0xFE, 0xAF, 0x00, 0x7E, 0x02, 0x13, 0xFD, 0xC5, 0x03, 0x87, 0xFE, 0x83, 0x00,
-  0x8C, 0x00, 0x49, 0xFD, 0xA3, 0x01, 0xA8, 0x00, 0x18, 0xFF, 0x22, 0x01, 0x3E, 0x00, 0x0C, 0xFE,
-  0x8B, 0x00, 0xF9, 0xFE, 0x01, 0x00, 0x53, 0x00, 0x94, 0xFF, 0x5B, 0x03, 0xD0, 0xFB, 0x66, 0x05,
-  0xA0, 0xFD, 0x99, 0xFF, 0x78, 0xFF, 0xD4, 0xFC, 0x69, 0x02, 0x05, 0xFD, 0xF5, 0xFF, 0xE6, 0x00,
-  0xB0, 0x00, 0x1D, 0x01, 0x68, 0x00, 0xDA, 0x02, 0xEA, 0x00, 0xAA, 0x01, 0x98, 0xFD, 0x86, 0xFD,
-  0x44, 0x01, 0x05, 0x00, 0x91, 0xFB, 0x4D, 0x04, 0xD6, 0xFD, 0x0A, 0x01, 0x5B, 0xFF, 0x18, 0x02,
-  0xD0, 0xFE, 0x4D, 0x01, 0x7A, 0x04, 0x3B, 0xFE, 0x41, 0xFA, 0xA2, 0x03, 0x79, 0xFF, 0x03, 0x00,
-  0x90, 0xF7, 0x44, 0x09, 0x36, 0xFA, 0xE8, 0xFE, 0x3D, 0x05, 0x84, 0xFA, 0x36, 0x02, 0x80, 0xF9,
-  0x20, 0x03, 0xDB, 0x01, 0x0F, 0xF8, 0x77, 0x13, 0xE8, 0xF2, 0xDC, 0x04, 0x3B, 0x04, 0xEF, 0xFC,
-  0x54, 0xFF, 0x83, 0xFD, 0x6F, 0x07, 0xBA, 0xFB, 0xF4, 0xFB, 0x7F, 0x07, 0xD4, 0xF3, 0xCA, 0x04,
-  0xFD, 0xFF, 0x18, 0x04, 0x3C, 0xFD, 0x19, 0xFF, 0x7B, 0x08, 0x84, 0xF8, 0xD8, 0xFA, 0x12, 0x02,
-  0xBA, 0xFE, 0x0F, 0xFB, 0x34, 0x02, 0x31, 0x02, 0x51, 0xFA, 0x2D, 0x09, 0xCD, 0x0F, 0xBC, 0xED,
-  0x38, 0x0B, 0xB3, 0xF6, 0x51, 0xFE, 0x8D, 0x01, 0x4F, 0xFC, 0xCA, 0x07, 0x15, 0xF5, 0xF7, 0x03,
-  0xC4, 0x02, 0x0B, 0xF4, 0x7C, 0x10, 0xF7, 0xF3, 0x70, 0x07, 0x85, 0xFB, 0x2E, 0xFD, 0xD8, 0x0C,
-  0x87, 0xF4, 0xE9, 0x05, 0x64, 0xFD, 0xCB, 0xFC, 0xC7, 0x07, 0x8F, 0xFD, 0x53, 0xF5, 0x59, 0x11,
-  0x01, 0xF1, 0x7E, 0x02, 0xD1, 0x04, 0x2F, 0xFA, 0xEE, 0x03, 0xA1, 0xFD, 0x42, 0x01, 0x8E, 0x05,
-  0x20, 0xFA, 0xDA, 0x03, 0xB0, 0xFD, 0x84, 0xFF, 0x3F, 0x00, 0xB8, 0x05, 0xF4, 0x01, 0x2D, 0xF9,
-  0x36, 0x03, 0xD4, 0x02, 0x1B, 0x03, 0xF3, 0xF7, 0x40, 0x09, 0x6C, 0xFB, 0x97, 0x06, 0x33, 0xFA,
-  0x10, 0x01, 0xC3, 0x00, 0xB4, 0x0C, 0x98, 0xFB, 0x58, 0x04, 0x5F, 0xF7, 0x4A, 0x01, 0xB6, 0xF8,
-  0xA1, 0x00, 0xA6, 0xFC, 0xE8, 0xFC, 0xFD, 0x03, 0x3D, 0xFD, 0xF7, 0x06, 0x11, 0xF6, 0x7D, 0x08,
-  0x74, 0xFE, 0xF6, 0xF9, 0x6B, 0x0C, 0xDB, 0xF7, 0xC1, 0xFF, 0x63, 0xFD, 0x45, 0xFE, 0x9B, 0x07,
-  0xC1, 0xF9, 0x2C, 0xFF, 0x43, 0x09, 0x4F, 0xF4, 0x20, 0x0E, 0x90, 0x08, 0xA9, 0xFE, 0x05, 0x06,
-  0x95, 0xF7, 0x9D, 0x11, 0xCE, 0xED, 0xE3, 0x02, 0x5E, 0x00, 0x06, 0x01, 0x30, 0xFD, 0x04, 0xFD,
-  0xE9, 0xFA, 0xDE, 0x07, 0xBE, 0xF9, 0xB2, 0xF5, 0x9B, 0x16, 0x85, 0xF1, 0xFD, 0x0A, 0x3E, 0x05,
-  0xB6, 0xF9, 0xF9, 0x05, 0x72, 0xFB, 0x12, 0x02, 0x66, 0x06, 0x35, 0xF9, 0xAA, 0x05, 0x9C, 0x0C,
-  0x7C, 0xEC, 0x61, 0x15, 0x43, 0xF2, 0xC3, 0x08, 0xC0, 0xF8, 0x13, 0xFB, 0xEA, 0x03, 0x3B, 0xF5,
-  0xD9, 0xF4, 0xFC, 0x0C, 0xD2, 0x08, 0x22, 0xF0, 0xD9, 0x09, 0xD6, 0xF4, 0x10, 0x04, 0x8E, 0xFE,
-  0x39, 0xFC, 0x55, 0x03, 0xE6, 0xF4, 0xBC, 0xF6, 0x48, 0x0A, 0x54, 0xF3, 0x14, 0x08, 0x32, 0x03,
-  0x7D, 0xFC, 0x7A, 0x05, 0x5F, 0xFE, 0xA1, 0xFA, 0x71, 0xFB, 0x94, 0xFD, 0x47, 0x0E, 0xAA, 0xF2,
-  0x68, 0x08, 0x67, 0xFA, 0x28, 0xFC, 0xFC, 0x05, 0x62, 0x0C, 0x32, 0xF1, 0x04, 0x07, 0x78, 0xF9,
-  0xDE, 0x08, 0x02, 0xFD, 0x66, 0xFD, 0xAB, 0x0E, 0xFB, 0xF4, 0xA3, 0xFF, 0x8C, 0x0B, 0x50, 0xF1,
-  0x55, 0x08, 0x1D, 0xFD, 0x3D, 0xFE, 0x38, 0x10, 0xB3, 0x0C, 0x2E, 0xFA, 0xCA, 0x0B, 0x31, 0x00,
-  0x1B, 0x09, 0x7F, 0x09, 0x1F, 0x02, 0x4B, 0x0D, 0x11, 0xF8, 0x0A, 0x05, 0x1F, 0x0B, 0xC1, 0xF1,
-  0x30, 0x0E, 0xA4, 0xEE, 0x74, 0x0A, 0xFD, 0xFC, 0x32, 0x04, 0x8D, 0x02, 0x0A, 0xFD, 0xD3, 0x03,
-  0x13, 0xFE, 0xFC, 0x06, 0xEF, 0xFC, 0x96, 0x09, 0xDA, 0xF3, 0x50, 0x13, 0xBD, 0xFE, 0xFC, 0xF2,
-  0xC7, 0x0B, 0x44, 0xFB, 0x14, 0xFA, 0x6B, 0x07, 0x95, 0x03, 0x98, 0xF6, 0x89, 0x0B, 0x70, 0xFD,
-  0x31, 0xEF, 0x45, 0x0B, 0x7B, 0xF1, 0x89, 0x1C, 0x5B, 0xEA, 0x79, 0x02, 0x65, 0x14, 0x9B, 0xDA,
-  0xF2, 0x1B, 0xD6, 0xD7, 0xC6, 0x1F, 0x6B, 0xEF, 0xDE, 0xEA, 0x83, 0x22, 0x31, 0xEB, 0xFC, 0x09,
-  0xBA, 0x0A, 0xB6, 0xF8, 0x19, 0xFF, 0xC3, 0x0D, 0xE9, 0xF7, 0x3B, 0x0A, 0xA6, 0x01, 0x6A, 0x0E,
-  0xE2, 0xE7, 0x78, 0x0C, 0x2C, 0xFA, 0x45, 0x04, 0x98, 0x02, 0x8E, 0xF4, 0xA2, 0xF5, 0xE1, 0x02,
-  0x1B, 0xF2, 0xF9, 0x17, 0xAC, 0xFB, 0x97, 0xEC, 0x6A, 0x1D, 0x89, 0xF8, 0x9D, 0x0B, 0x1B, 0xEA,
-  0xC8, 0x0E, 0x3D, 0x10, 0x1F, 0xEE, 0x34, 0x13, 0xDE, 0x0B, 0x40, 0xE6, 0x0C, 0x03, 0x67, 0x1B,
-  0xDD, 0xEC, 0x4B, 0xFC, 0x78, 0x03, 0x70, 0xFE, 0x7C, 0xFD, 0x52, 0xFD, 0xF2, 0x0B, 0xD0, 0xF7,
-  0xC5, 0xF5, 0x61, 0x1E, 0xF5, 0xEF, 0x72, 0xF4, 0xDA, 0x26, 0x03, 0xE9, 0x31, 0xFD, 0x79, 0x0E,
-  0xC8, 0xF9, 0xAC, 0x1E, 0xE5, 0xD6, 0x92, 0x06, 0xE9, 0x14, 0xD0, 0x0B, 0xEA, 0xEA, 0xCF, 0x1E,
-  0x95, 0xF8, 0x1A, 0xE2, 0xEC, 0xE5, 0x73, 0x11, 0xD5, 0xF8, 0xAC, 0xEF, 0xC4, 0x07, 0xD1, 0x13,
-  0xD8, 0xDB, 0xB8, 0xF5, 0xDD, 0x22, 0xF1, 0xEA, 0x91, 0x05, 0xFC, 0x34, 0x39, 0xE6, 0x8A, 0x1B,
-  0x0A, 0xFE, 0xFA, 0x11, 0xC6, 0xF1, 0xA1, 0xF8, 0x9A, 0x1E, 0x6C, 0xDE, 0xCB, 0xF2, 0x0A, 0x21,
-  0x6D, 0x04, 0xF1, 0xF5, 0x04, 0xEF, 0xB7, 0x26, 0x9F, 0xE1, 0xD0, 0xE9, 0xB7, 0x1F, 0xB2, 0xEE,
-  0x50, 0xFC, 0x75, 0x23, 0x81, 0x03, 0x70, 0xE0, 0x95, 0x03, 0x1B, 0x16, 0xD4, 0xDE, 0x27, 0x12,
-  0xE4, 0x01, 0xEF, 0xF2, 0x4F, 0xEF, 0x71, 0x10, 0x9D, 0xFD, 0xB7, 0xFA, 0x7B, 0x0C, 0xF8, 0xF9,
-  0xA3, 0x03, 0xB0, 0xF8, 0xF2, 0xFB, 0x6F, 0x0C, 0xDF, 0xCF, 0x9D, 0x37, 0x27, 0xCE, 0x96, 0x21,
-  0x90, 0xEC, 0x2E, 0xFD, 0xE6, 0x07, 0xFB, 0x00, 0x8D, 0xE3, 0xFC, 0x17, 0xA7, 0xED, 0x13, 0x10,
-  0xAD, 0xFD, 0x62, 0xF8, 0xA2, 0xFB, 0x6C, 0x02, 0x6B, 0xF5, 0x2A, 0x0F, 0x25, 0xF8, 0xC5, 0x10,
-  0xAA, 0xEF, 0xAD, 0x26, 0xEF, 0xD0, 0x27, 0x2A, 0x6F, 0xE1, 0x8A, 0x0A, 0x1D, 0x06, 0x6B, 0xF1,
-  0xB5, 0x18, 0x9D, 0xFA, 0x11, 0xF6, 0xA0, 0x1C, 0x4C, 0xF2, 0x34, 0x1C, 0xD2, 0xE7, 0x14, 0x0B,
-  0xD8, 0xE8, 0x4C, 0x07, 0x83, 0x0D, 0x0B, 0xF2, 0x56, 0x0F, 0xE1, 0xDF, 0x54, 0xFE, 0xA2, 0x03,
-  0xB8, 0xF9, 0xD3, 0xFA, 0xB7, 0x17, 0x27, 0xE3, 0x3B, 0xF9, 0x6D, 0x25, 0xA9, 0xE9, 0x59, 0x06,
-  0xDF, 0x1A, 0xF2, 0xDD, 0x7B, 0x14, 0x0B, 0xFC, 0x70, 0xF0, 0xA3, 0x18, 0xCE, 0xE2, 0xF1, 0xE9,
-  0x6C, 0x33, 0x58, 0xD5, 0x62, 0x05, 0x8B, 0xFB, 0xE2, 0xFE, 0xB0, 0xE7, 0xA2, 0x17, 0x0D, 0xF0,
-  0x37, 0xE6, 0x25, 0x1A, 0xAB, 0xDF, 0xEC, 0x06, 0x6F, 0x1B, 0xB5, 0xE8, 0x48, 0x02, 0x15, 0x2F,
-  0x1E, 0xCA, 0xF2, 0x1A, 0xE4, 0xE4, 0x35, 0x0F, 0x4A, 0x38, 0x62, 0xDD, 0x79, 0x1A, 0xD0, 0xFD,
-  0xFE, 0xE3, 0x42, 0x35, 0x76, 0xE8, 0x7E, 0xFA, 0x24, 0x0A, 0x73, 0x07, 0xC9, 0xFF, 0x31, 0xDC,
-  0x7F, 0x1A, 0x8D, 0xE7, 0xBF, 0xF1, 0x66, 0x24, 0x4B, 0xD2, 0x58, 0x22, 0xE0, 0xE4, 0xF4, 0x0A,
-  0x06, 0xFF, 0x5E, 0xE9, 0x24, 0x18, 0x57, 0xED, 0x7E, 0x19, 0xD2, 0xEB, 0x0C, 0x0C, 0xCC, 0x0A,
-  0xF2, 0xEA, 0x3B, 0x0A, 0x88, 0xF4, 0xAB, 0x13, 0x31, 0xEA, 0x48, 0xFE, 0x10, 0xFD, 0xCB, 0xEF,
-  0x6A, 0x0A, 0xEB, 0xFF, 0x3D, 0xF4, 0xC1, 0xFD, 0xDA, 0xED, 0x6E, 0x11, 0xEC, 0xF6, 0x2E, 0x28,
-  0x6A, 0xD3, 0xC7, 0x0D, 0x2C, 0xFF, 0xF7, 0x00, 0x41, 0x16, 0x58, 0xFF, 0x92, 0xFC, 0x95, 0xF3,
-  0x84, 0xFD, 0x06, 0xF1, 0x1E, 0x1E, 0x65, 0xEB, 0x09, 0xFF, 0xBB, 0x0A, 0x63, 0xE4, 0x4E, 0x12,
-  0x84, 0xF0, 0xE4, 0xE8, 0x3D, 0x19, 0xB8, 0xFF, 0x4A, 0x11, 0xDF, 0xFC, 0xE0, 0x17, 0x3B, 0x0E,
-  0x44, 0xDB, 0xAD, 0x33, 0xF6, 0xD3, 0xEF, 0x0C, 0x24, 0xFC, 0x4B, 0xE8, 0xC3, 0x0B, 0xC8, 0x05,
-  0x63, 0xF6, 0x76, 0x0E, 0x7C, 0xE9, 0x1D, 0x31, 0x1A, 0xEE, 0x95, 0xDF, 0x17, 0x2D, 0x79, 0xDC,
-  0xB8, 0x10, 0xA0, 0xFF, 0xAF, 0x04, 0xE6, 0x03, 0x37, 0xF1, 0x93, 0x05, 0x72, 0x0A, 0x12, 0xF2,
-  0xF4, 0xFE, 0xFA, 0xFC, 0x9B, 0xE4, 0xF4, 0x38, 0x8E, 0xC8, 0x4D, 0x1D, 0x04, 0x0D, 0xE2, 0xFC,
-  0xCD, 0x0C, 0xA8, 0x07, 0xC0, 0xFD, 0x2E, 0x0F, 0xAF, 0xF4, 0x59, 0xF0, 0x14, 0x2E, 0x33, 0xF3,
-  0x86, 0xEA, 0x2E, 0x24, 0x42, 0xEC, 0xB4, 0xF2, 0xB7, 0x0D, 0x7C, 0xF4, 0x3F, 0x08, 0x3D, 0x04,
-  0xDA, 0xD9, 0xFE, 0x24, 0xDD, 0xEE, 0x9F, 0xE6, 0xAE, 0x28, 0xA0, 0xE8, 0x5F, 0xF2, 0xD9, 0x18,
-  0x0B, 0x0D, 0x1A, 0xF2, 0x26, 0xFB, 0xBE, 0x20, 0x38, 0x00, 0xAB, 0xF3, 0xD2, 0x02, 0x5C, 0xF9,
-  0x79, 0x10, 0xC3, 0xDC, 0x0B, 0xF9, 0x4A, 0x2F, 0x14, 0xD6, 0x25, 0x09, 0x51, 0x01, 0x4D, 0xF1,
-  0x91, 0x07, 0xC5, 0xE5, 0xB0, 0xFC, 0x60, 0x0D, 0x04, 0xEF, 0x19, 0x15, 0xBA, 0xF6, 0xDE, 0xF1,
-  0xC5, 0x0E, 0x8A, 0xFC, 0x45, 0x03, 0x68, 0x0D, 0x38, 0xFF, 0x72, 0x06, 0x11, 0x04, 0xAA, 0x0A,
-  0x77, 0x00, 0x4C, 0xED, 0x04, 0x0B, 0xE7, 0x0F, 0xC1, 0xF1, 0xCC, 0xED, 0xF8, 0x02, 0x9F, 0x12,
-  0x5C, 0xF0, 0x5B, 0xF7, 0xF0, 0x12, 0xDE, 0xE0, 0x32, 0x00, 0x20, 0xFF, 0x3D, 0x09, 0xCB, 0xF1,
-  0xC3, 0xF2, 0x5D, 0x03, 0xBE, 0x18, 0xA6, 0xDD, 0x7C, 0x0A, 0x25, 0x15, 0x83, 0xF5, 0x56, 0xF3,
-  0x76, 0x0D, 0x8F, 0x03, 0x4C, 0xF9, 0x71, 0x25, 0x3B, 0xD0, 0x0F, 0x0D, 0x53, 0x18, 0xDD, 0xCB,
-  0x12, 0x1B, 0x8F, 0x05, 0x25, 0xDA, 0xFE, 0x20, 0x3D, 0xF6, 0x72, 0x0E, 0xCD, 0x00, 0x3C, 0xDE,
-  0xE4, 0x1A, 0x23, 0x21, 0x08, 0xD0, 0xA1, 0xF7, 0x12, 0x27, 0x6C, 0x0A, 0x7D, 0xDC, 0xCE, 0x06,
-  0x14, 0x19, 0xDF, 0xF9, 0x5E, 0xF1, 0xE5, 0x02, 0xB1, 0x01, 0x93, 0x0C, 0x00, 0xEA, 0x76, 0x13,
-  0xC8, 0xFC, 0x77, 0xF2, 0xC9, 0xF8, 0xED, 0xF8, 0xC8, 0x1D, 0x8A, 0xE6, 0x95, 0xF4, 0x64, 0x0A,
-  0xFA, 0x07, 0x45, 0x04, 0x6C, 0xEA, 0x2E, 0x03, 0xC8, 0x18, 0xC9, 0xF5, 0x60, 0xFF, 0x91, 0x08,
-  0xCA, 0xF9, 0x9A, 0x01, 0xA4, 0x08, 0xFE, 0xF7, 0x68, 0xFD, 0xA8, 0x01, 0x55, 0xFD, 0xA1, 0xFC,
-  0xAA, 0xF8, 0x86, 0x08, 0xB7, 0xFE, 0x3C, 0x06, 0xF1, 0xF8, 0xAD, 0xF7, 0xDB, 0x14, 0x94, 0xEF,
-  0x91, 0xFE, 0x33, 0x07, 0x0F, 0x03, 0x07, 0xFD, 0xA0, 0x01, 0x01, 0x00, 0x6D, 0x00, 0xBE, 0xF7,
-  0x79, 0x09, 0xF5, 0xEC, 0x7B, 0x07, 0x5A, 0x06, 0x3A, 0xFC, 0x34, 0xF4, 0xBC, 0xFA, 0x08, 0x1A,
-  0x75, 0xF9, 0x61, 0xEC, 0xAC, 0x11, 0xC7, 0x08, 0xE1, 0xEF, 0xA5, 0x04, 0xA5, 0xFE, 0x8A, 0x15,
-  0xA1, 0xF8, 0x18, 0xEE, 0x7A, 0xFF, 0x16, 0x17, 0xB7, 0xFA, 0xB9, 0xE2, 0x6F, 0x06, 0x47, 0x14,
-  0xF1, 0xF3, 0x98, 0xE4, 0x65, 0x07, 0xF9, 0x08, 0x48, 0xF8, 0xD2, 0xEF, 0xB6, 0x10, 0x1B, 0x05,
-  0x94, 0xF1, 0x37, 0x06, 0x07, 0x12, 0x7F, 0xF8, 0xA7, 0xF9, 0x01, 0x15, 0xDB, 0x11, 0x95, 0x00,
-  0xDD, 0xFB, 0xD9, 0x07, 0xD2, 0x08, 0x8F, 0xFF, 0x18, 0xEC, 0x51, 0xF6, 0xC9, 0x05, 0x3C, 0xF4,
-  0x62, 0xF3, 0x94, 0xF0, 0x83, 0xFF, 0x1F, 0x01, 0x05, 0xEF, 0xC9, 0xF3, 0x04, 0x0C, 0x3D, 0x08,
-  0xAC, 0xF8, 0x36, 0x05, 0x7A, 0x10, 0xA2, 0x0B, 0x18, 0x08, 0x8C, 0x0D, 0x87, 0x0C, 0xA9, 0x0A,
-  0xC7, 0x00, 0xCC, 0x01, 0x11, 0x02, 0x59, 0xF6, 0x51, 0xF6, 0x2B, 0xF4, 0xD4, 0xF3, 0xD0, 0xF1,
-  0xA0, 0xF1, 0x99, 0xFA, 0x9C, 0xF1, 0x15, 0xFA, 0x3C, 0x01, 0x64, 0x03, 0xBB, 0x04, 0x54, 0x09,
-  0xAB, 0x11, 0xFF, 0x11, 0x55, 0x0F, 0xCE, 0x06, 0x48, 0x12, 0xC0, 0x13, 0x5D, 0xFE, 0x6A, 0xFD,
-  0x2A, 0xFA, 0xB7, 0xF4, 0x99, 0xEF, 0xF7, 0xF2, 0x2F, 0xF4, 0x51, 0xF4, 0x49, 0xF3, 0xF9, 0xF2,
-  0x29, 0xEF, 0x87, 0xFA, 0x50, 0xFF, 0xBC, 0x0A, 0x3A, 0x06, 0x53, 0x0C, 0x9B, 0x0F, 0x7A, 0x0B,
-  0xD7, 0x10, 0xB6, 0x10, 0x35, 0x0F, 0x6D, 0x05, 0x7F, 0xFA, 0xBD, 0xFC, 0xF3, 0xF8, 0x8B, 0xF2,
-  0x44, 0xF4, 0xEE, 0xF8, 0x52, 0xF8, 0x73, 0xE4, 0x2E, 0xF0, 0x1C, 0x01, 0xDE, 0x06, 0x1D, 0x09,
-  0xB7, 0xFB, 0x99, 0x09, 0x56, 0x19, 0xAD, 0x13, 0x1A, 0x0B, 0xF8, 0x0A, 0xF0, 0x0D, 0x26, 0x04,
-  0x4D, 0xFE, 0x7C, 0xF8, 0x26, 0xF6, 0xDF, 0xF5, 0x75, 0xF2, 0x87, 0xF9, 0x64, 0xF8, 0x81, 0xEB,
-  0x8A, 0xEF, 0x46, 0xF8, 0xE6, 0xFF, 0xFF, 0x08, 0x93, 0x03, 0xB7, 0x02, 0x60, 0x11, 0x22, 0x13,
-  0x2D, 0x0B, 0x0A, 0x0F, 0xF6, 0x0C, 0xB7, 0x05, 0xA9, 0xFF, 0xDC, 0xF8, 0x57, 0xF6, 0xA8, 0xF7,
-  0x7A, 0xFA, 0x80, 0xF3, 0x81, 0xF2, 0x0E, 0xEE, 0xF8, 0xF5, 0x0A, 0xFF, 0xEE, 0xFA, 0x59, 0x01,
-  0x69, 0x08, 0xCC, 0x0D, 0x5C, 0x11, 0xC8, 0x0B, 0x61, 0x08, 0x8A, 0x11, 0xEE, 0x0F, 0xC8, 0x05,
-  0x8A, 0xF9, 0x75, 0xF0, 0xA2, 0xF3, 0xD6, 0xF6, 0x76, 0xF9, 0x2E, 0xF9, 0x69, 0xED, 0x7B, 0xEE,
-  0x30, 0xF5, 0x02, 0x06, 0xC4, 0x03, 0x75, 0x04, 0xCE, 0x02, 0x96, 0x0A, 0x71, 0x15, 0xA2, 0x0F,
-  0xA4, 0x0B, 0xA4, 0x0B, 0x26, 0x09, 0xA3, 0x03, 0x88, 0xFC, 0x97, 0xF1, 0x1D, 0xF1, 0xD3, 0xEE,
-  0xF5, 0xF7, 0x99, 0xF9, 0x4F, 0xF4, 0x5B, 0xEE, 0x12, 0xF1, 0x57, 0x02, 0x9F, 0x09, 0xFE, 0x0E,
-  0x5D, 0x0B, 0x9B, 0x0B, 0x97, 0x0E, 0x33, 0x0F, 0xBC, 0x13, 0x17, 0x13, 0x48, 0x06, 0x91, 0xF9,
-  0x36, 0xF0, 0x4B, 0xEF, 0x03, 0xF4, 0x59, 0xF6, 0x51, 0xF3, 0x66, 0xF1, 0x31, 0xED, 0x59, 0xF0,
-  0xE5, 0xFD, 0x46, 0x07, 0xAE, 0x0A, 0x5B, 0x09, 0x1F, 0x0E, 0xA4, 0x12, 0x7F, 0x13, 0x98, 0x11,
-  0x63, 0x0F, 0x74, 0x09, 0xDD, 0xFE, 0xD1, 0xF9, 0x6D, 0xF1, 0xD9, 0xEF, 0xF4, 0xEE, 0x02, 0xF4,
-  0xF7, 0xF6, 0x40, 0xF1, 0x55, 0xEF, 0x73, 0xF3, 0xE2, 0x00, 0x3E, 0x09, 0x9A, 0x0D, 0x3B, 0x0E,
-  0x9C, 0x10, 0xA2, 0x0F, 0x95, 0x0D, 0xE3, 0x11, 0x09, 0x10, 0x25, 0x06, 0x51, 0xFA, 0xAE, 0xF0,
-  0x00, 0xEC, 0x09, 0xEF, 0xD6, 0xF6, 0xD0, 0xF7, 0xEC, 0xF0, 0x6D, 0xE9, 0xAD, 0xEF, 0xCD, 0xFE,
-  0xC0, 0x08, 0xA1, 0x0D, 0x57, 0x0F, 0x84, 0x0D, 0x11, 0x0F, 0xE0, 0x11, 0x40, 0x15, 0x93, 0x15,
-  0x5B, 0x0B, 0x84, 0xFB, 0xF1, 0xF2, 0x24, 0xEE, 0x46, 0xEF, 0xDA, 0xF1, 0x5B, 0xF6, 0x3C, 0xF2,
-  0xFC, 0xE9, 0x73, 0xEE, 0x42, 0xF9, 0xE9, 0x07, 0xE4, 0x0B, 0xEC, 0x0E, 0xF8, 0x10, 0x62, 0x10,
-  0x1A, 0x13, 0x3C, 0x13, 0xA6, 0x14, 0xA2, 0x0D, 0xDF, 0x00, 0xB5, 0xF5, 0x46, 0xEC, 0x72, 0xEA,
-  0xBE, 0xEB, 0x1C, 0xF4, 0xF4, 0xF4, 0xF9, 0xEE, 0xC6, 0xEC, 0x88, 0xF3, 0x7D, 0x02, 0x70, 0x0A,
-  0x6A, 0x0F, 0x09, 0x10, 0xA1, 0x10, 0xD5, 0x12, 0xDD, 0x13, 0x12, 0x15, 0xFC, 0x10, 0xBF, 0x05,
-  0xE4, 0xF8, 0x02, 0xF0, 0x17, 0xEA, 0xA3, 0xEA, 0x25, 0xF3, 0xEC, 0xF3, 0xA3, 0xF2, 0xB4, 0xEE,
-  0x17, 0xF1, 0xE3, 0xFC, 0xBF, 0x06, 0x5B, 0x0C, 0x3B, 0x11, 0x6C, 0x12, 0xDB, 0x14, 0xCB, 0x14,
-  0xCA, 0x14, 0x8B, 0x13, 0x8E, 0x0A, 0xDA, 0xFC, 0x6D, 0xF4, 0x02, 0xEC, 0x9E, 0xE8, 0xFF, 0xEA,
-  0x9B, 0xF1, 0x6B, 0xF3, 0x74, 0xF1, 0x9A, 0xF0, 0xDC, 0xF6, 0x45, 0x00, 0xB7, 0x04, 0xF2, 0x0D,
-  0x4C, 0x15, 0x1D, 0x18, 0x1B, 0x19, 0x03, 0x12, 0xA1, 0x0F, 0xF6, 0x08, 0xAC, 0xFF, 0xD0, 0xFA,
-  0xAA, 0xF3, 0x10, 0xEC, 0xB8, 0xE6, 0xB8, 0xEC, 0x3A, 0xF0, 0xC7, 0xF1, 0x28, 0xF5, 0xC7, 0xF8,
-  0xE9, 0xFF, 0x94, 0x02, 0xD6, 0x08, 0x08, 0x13, 0x8A, 0x17, 0x3F, 0x1A, 0x31, 0x16, 0x6C, 0x11,
-  0x5A, 0x0C, 0x8C, 0x02, 0x04, 0xFB, 0xF0, 0xF5, 0xA1, 0xEE, 0x91, 0xE7, 0x67, 0xE8, 0x0D, 0xEE,
-  0x06, 0xF1, 0x99, 0xF5, 0x66, 0xF9, 0x66, 0xFE, 0x37, 0x01, 0xC3, 0x04, 0x2D, 0x11, 0xD5, 0x17,
-  0xA8, 0x19, 0x65, 0x16, 0xBF, 0x11, 0xA6, 0x0F, 0x11, 0x06, 0x38, 0xFC, 0xAD, 0xF6, 0xF7, 0xEE,
-  0x97, 0xE9, 0x53, 0xE8, 0x51, 0xED, 0x7D, 0xEF, 0xDE, 0xF0, 0x6E, 0xF5, 0x83, 0xFD, 0x52, 0x01,
-  0x68, 0x03, 0x90, 0x0C, 0x19, 0x16, 0x4C, 0x1B, 0xB1, 0x18, 0xB5, 0x13, 0xEE, 0x11, 0x90, 0x0A,
-  0xD7, 0x01, 0x16, 0xFB, 0x77, 0xF3, 0x0A, 0xEB, 0x2A, 0xE6, 0x59, 0xEB, 0x69, 0xEF, 0x26, 0xF0,
-  0x41, 0xF3, 0x58, 0xFA, 0x7C, 0xFF, 0x9C, 0x00, 0xBA, 0x04, 0x68, 0x0F, 0x92, 0x17, 0x1A, 0x1B,
-  0x6A, 0x16, 0x03, 0x13, 0xDC, 0x0D, 0x35, 0x05, 0x02, 0xFE, 0xB5, 0xF6, 0xFE, 0xEE, 0x8D, 0xE8,
-  0xB5, 0xE8, 0x0F, 0xEF, 0x62, 0xEF, 0xD5, 0xF0, 0x94, 0xF6, 0xC0, 0xFE, 0x45, 0x03, 0x17, 0x05,
-  0xBC, 0x0B, 0x80, 0x13, 0xB9, 0x17, 0x36, 0x15, 0x3E, 0x12, 0x6F, 0x10, 0xC2, 0x0A, 0x91, 0x03,
-  0xCB, 0xFB, 0xF5, 0xF3, 0x38, 0xE9, 0x46, 0xE5, 0x48, 0xEB, 0xBD, 0xEE, 0xB2, 0xF1, 0x4F, 0xF5,
-  0x30, 0xFE, 0xBB, 0x02, 0x17, 0x03, 0x43, 0x06, 0x2F, 0x0D, 0x26, 0x14, 0xC1, 0x15, 0xB1, 0x13,
-  0x95, 0x12, 0x23, 0x0E, 0xB6, 0x08, 0x70, 0xFF, 0x0A, 0xF7, 0x90, 0xED, 0xF1, 0xE3, 0x65, 0xE5,
-  0x65, 0xEC, 0x36, 0xF0, 0xA1, 0xF5, 0xE3, 0xFB, 0xF7, 0x03, 0x8C, 0x05, 0x73, 0x04, 0xA8, 0x08,
-  0x6B, 0x0E, 0x96, 0x13, 0x41, 0x13, 0x02, 0x14, 0xB0, 0x14, 0x0F, 0x0E, 0x1A, 0x06, 0xFE, 0xFA,
-  0x00, 0xF1, 0xAA, 0xE4, 0x8E, 0xDF, 0x7D, 0xE7, 0x2B, 0xEE, 0x01, 0xF5, 0xCB, 0xFA, 0xDC, 0x02,
-  0xA2, 0x06, 0xD8, 0x03, 0x6A, 0x04, 0x4C, 0x09, 0x4D, 0x0F, 0x33, 0x13, 0x9E, 0x14, 0x84, 0x17,
-  0x0F, 0x15, 0xEA, 0x0D, 0x2B, 0x02, 0xCF, 0xF5, 0xE4, 0xE9, 0x29, 0xDF, 0x83, 0xE0, 0x05, 0xE9,
-  0xBB, 0xF1, 0xDD, 0xF8, 0x84, 0xFE, 0x72, 0x06, 0x9D, 0x05, 0x82, 0x01, 0x61, 0x03, 0x99, 0x08,
-  0xED, 0x0F, 0x01, 0x13, 0xE2, 0x17, 0x50, 0x1A, 0x44, 0x15, 0x03, 0x0B, 0x00, 0xFD, 0xD9, 0xEF,
-  0x0F, 0xE4, 0x63, 0xDD, 0xCC, 0xE4, 0x5E, 0xED, 0x4F, 0xF6, 0xD7, 0xFC, 0x75, 0x03, 0x04, 0x07,
-  0xEE, 0x02, 0x99, 0x00, 0x90, 0x02, 0x73, 0x09, 0x10, 0x10, 0x1C, 0x13, 0xB3, 0x19, 0x7D, 0x1A,
-  0x69, 0x13, 0xC2, 0x06, 0x13, 0xF8, 0xAE, 0xEC, 0xC8, 0xE0, 0x77, 0xDE, 0xE3, 0xE6, 0x11, 0xF0,
-  0x31, 0xF9, 0xE9, 0x00, 0xC5, 0x07, 0x6F, 0x07, 0x05, 0x02, 0x0C, 0x00, 0x8F, 0x02, 0x21, 0x09,
-  0xA6, 0x0D, 0xA4, 0x13, 0x65, 0x1A, 0x0E, 0x1A, 0x37, 0x11, 0x62, 0x04, 0x6F, 0xF6, 0x43, 0xEA,
-  0x33, 0xDF, 0x31, 0xDE, 0x48, 0xE6, 0x1B, 0xF0, 0x79, 0xF9, 0xAB, 0x02, 0x13, 0x09, 0x3D, 0x08,
-  0xB1, 0x03, 0x57, 0x02, 0x20, 0x03, 0x44, 0x07, 0xF4, 0x0A, 0xBC, 0x12, 0x35, 0x1A, 0x33, 0x19,
-  0xA3, 0x11, 0x38, 0x05, 0x3E, 0xF9, 0x20, 0xEC, 0xF8, 0xDF, 0xCE, 0xDD, 0x5A, 0xE4, 0xDA, 0xEE,
-  0x0B, 0xF8, 0xA1, 0x01, 0x44, 0x0B, 0x21, 0x0B, 0x75, 0x06, 0x98, 0x03, 0x5B, 0x04, 0xF6, 0x05,
-  0xF7, 0x08, 0xD1, 0x10, 0xD1, 0x17, 0x40, 0x18, 0x92, 0x12, 0x89, 0x09, 0xB4, 0xFD, 0x8B, 0xEE,
-  0x6D, 0xE1, 0xD7, 0xDC, 0xE8, 0xE0, 0x40, 0xE9, 0xD6, 0xF3, 0x0E, 0x01, 0x3B, 0x0C, 0x6F, 0x0D,
-  0x7A, 0x0A, 0xFC, 0x07, 0x1C, 0x05, 0x62, 0x03, 0x9C, 0x04, 0x1B, 0x0B, 0x1A, 0x12, 0x55, 0x15,
-  0xA9, 0x13, 0xAC, 0x0D, 0xFD, 0x03, 0x5C, 0xF5, 0x69, 0xE5, 0x36, 0xDD, 0xA5, 0xDE, 0xF2, 0xE3,
-  0xAB, 0xED, 0xEA, 0xFC, 0x6D, 0x0A, 0x01, 0x10, 0xA8, 0x0F, 0x41, 0x0E, 0x1C, 0x0A, 0xA6, 0x05,
-  0xFC, 0x01, 0xAF, 0x04, 0xEF, 0x0B, 0x81, 0x0F, 0xC5, 0x10, 0x66, 0x10, 0x19, 0x0A, 0xEF, 0xFC,
-  0x62, 0xEC, 0xA3, 0xE1, 0x53, 0xDD, 0xEE, 0xDD, 0x81, 0xE5, 0x8C, 0xF4, 0xAA, 0x04, 0xB8, 0x0E,
-  0xB0, 0x12, 0x42, 0x14, 0x83, 0x11, 0x30, 0x0A, 0x9F, 0x02, 0xA1, 0x01, 0x71, 0x05, 0x6B, 0x08,
-  0xD3, 0x0B, 0xAE, 0x0F, 0x81, 0x0E, 0x1B, 0x05, 0x60, 0xF6, 0x41, 0xEA, 0x5D, 0xE2, 0xB1, 0xDC,
-  0x34, 0xDF, 0x97, 0xEA, 0x36, 0xFA, 0xDC, 0x06, 0x48, 0x10, 0x3B, 0x17, 0x19, 0x19, 0x06, 0x13,
-  0x03, 0x0A, 0x95, 0x05, 0xA0, 0x03, 0xFD, 0x01, 0x89, 0x03, 0x6C, 0x09, 0xFF, 0x0B, 0xF5, 0x07,
-  0x93, 0xFF, 0xC1, 0xF5, 0x39, 0xEC, 0x88, 0xE2, 0xD3, 0xDE, 0x47, 0xE4, 0x05, 0xEF, 0x94, 0xFA,
-  0x35, 0x06, 0x52, 0x12, 0xAF, 0x19, 0x9D, 0x18, 0x21, 0x14, 0x4E, 0x0F, 0xF1, 0x08, 0xAF, 0x02,
-  0x39, 0x00, 0xFB, 0x01, 0xF2, 0x03, 0xAF, 0x02, 0x9B, 0xFF, 0x68, 0xFA, 0xF1, 0xF3, 0x65, 0xEB,
-  0x17, 0xE6, 0xBF, 0xE6, 0xC6, 0xEA, 0x3B, 0xF2, 0x7A, 0xFC, 0x3F, 0x08, 0x10, 0x12, 0x6A, 0x17,
-  0x07, 0x19, 0x20, 0x16, 0x66, 0x11, 0xF7, 0x0A, 0x8D, 0x04, 0x4F, 0x01, 0x36, 0x00, 0x4E, 0xFE,
-  0x49, 0xFC, 0x8B, 0xFA, 0x69, 0xF6, 0x95, 0xF1, 0x2F, 0xED, 0x9D, 0xEB, 0x72, 0xEC, 0x9E, 0xEF,
-  0x69, 0xF5, 0x8C, 0xFE, 0x5F, 0x07, 0xD6, 0x0E, 0x20, 0x14, 0xB8, 0x16, 0x5D, 0x15, 0x19, 0x11,
-  0x69, 0x0D, 0x59, 0x08, 0x53, 0x03, 0x93, 0xFF, 0xE3, 0xFB, 0x7B, 0xF8, 0x81, 0xF4, 0xA3, 0xF0,
-  0xCC, 0xED, 0x08, 0xED, 0x29, 0xED, 0x7A, 0xEF, 0xE3, 0xF5, 0x21, 0xFC, 0x38, 0x03, 0xBC, 0x09,
-  0xB4, 0x0F, 0x06, 0x12, 0x24, 0x12, 0xED, 0x11, 0xD4, 0x0F, 0x4D, 0x0C, 0xF0, 0x08, 0x7E, 0x05,
-  0x48, 0x01, 0x7E, 0xFC, 0x03, 0xF8, 0x3D, 0xF2, 0x1B, 0xEE, 0xBE, 0xEA, 0xCA, 0xEA, 0xBC, 0xEC,
-  0xDA, 0xF0, 0x46, 0xF8, 0x66, 0xFF, 0xBE, 0x06, 0xEE, 0x0C, 0xD3, 0x10, 0x76, 0x12, 0x04, 0x12,
-  0xE1, 0x0F, 0x03, 0x0D, 0x2B, 0x0A, 0xCE, 0x06, 0xE9, 0x03, 0x8D, 0x00, 0x9C, 0xFC, 0x9B, 0xF7,
-  0x4C, 0xF2, 0x81, 0xEE, 0xF2, 0xEA, 0xD7, 0xEA, 0x19, 0xED, 0x63, 0xF1, 0xE1, 0xF7, 0x1F, 0x00,
-  0x76, 0x07, 0x56, 0x0D, 0xF4, 0x11, 0x2C, 0x13, 0x65, 0x12, 0x1E, 0x10, 0x2D, 0x0D, 0x82, 0x09,
-  0xF9, 0x05, 0xDE, 0x03, 0x79, 0xFF, 0xDC, 0xFB, 0xCF, 0xF8, 0x07, 0xF4, 0x3B, 0xF0, 0x04, 0xED,
-  0xB6, 0xEC, 0xFC, 0xED, 0xD9, 0xF1, 0x68, 0xF7, 0x90, 0xFE, 0x41, 0x05, 0x4C, 0x0B, 0x50, 0x10,
-  0xCF, 0x11, 0xDB, 0x11, 0x05, 0x10, 0xE4, 0x0C, 0xD6, 0x09, 0xDE, 0x05, 0x17, 0x03, 0x04, 0xFF,
-  0x15, 0xFC, 0xF4, 0xF8, 0x64, 0xF4, 0x6A, 0xF1, 0xAE, 0xEE, 0x81, 0xEE, 0x88, 0xEF, 0xBE, 0xF2,
-  0x98, 0xF7, 0x13, 0xFD, 0x4F, 0x03, 0xC3, 0x08, 0x27, 0x0D, 0x0A, 0x0F, 0x1F, 0x10, 0x21, 0x0F,
-  0x16, 0x0D, 0x1A, 0x0B, 0x3B, 0x08, 0xB4, 0x05, 0x60, 0x02, 0x0F, 0xFF, 0x20, 0xFB, 0xD3, 0xF6,
-  0x69, 0xF3, 0x8A, 0xEF, 0x4B, 0xEE, 0x93, 0xEE, 0x86, 0xF0, 0xCA, 0xF4, 0xE3, 0xF9, 0x59, 0x00,
-  0x65, 0x05, 0x69, 0x0A, 0xB6, 0x0D, 0x37, 0x0F, 0xF1, 0x0F, 0x84, 0x0E, 0xB4, 0x0C, 0xCF, 0x09,
-  0x23, 0x07, 0x80, 0x04, 0x42, 0x01, 0x24, 0xFE, 0x42, 0xFA, 0x67, 0xF6, 0x77, 0xF2, 0x92, 0xEF,
-  0xF5, 0xEE, 0x2B, 0xEF, 0xF0, 0xF1, 0xB9, 0xF5, 0x28, 0xFB, 0x8E, 0x00, 0xD3, 0x05, 0xD6, 0x0A,
-  0x9D, 0x0D, 0x29, 0x0F, 0x57, 0x0F, 0x66, 0x0E, 0x80, 0x0C, 0xC7, 0x09, 0x31, 0x07, 0xE2, 0x03,
-  0x95, 0x00, 0x45, 0xFD, 0x98, 0xF9, 0xD4, 0xF5, 0x5A, 0xF2, 0xEC, 0xEF, 0xEC, 0xEE, 0xD0, 0xEF,
-  0x3A, 0xF2, 0xCE, 0xF5, 0xAE, 0xFA, 0x1B, 0x00, 0x5B, 0x05, 0xE9, 0x09, 0x7F, 0x0D, 0xCB, 0x0F,
-  0x01, 0x10, 0xAC, 0x0F, 0x9D, 0x0D, 0xC3, 0x0A, 0xF4, 0x07, 0x6D, 0x04, 0xE9, 0x00, 0xEF, 0xFC,
-  0x2A, 0xF9, 0x47, 0xF5, 0xC3, 0xF1, 0x68, 0xEF, 0x10, 0xEE, 0xAA, 0xEE, 0x3F, 0xF1, 0x43, 0xF5,
-  0x51, 0xFA, 0xC8, 0xFF, 0x7E, 0x05, 0x55, 0x0A, 0xBF, 0x0D, 0xF8, 0x0F, 0x76, 0x10, 0xDB, 0x0F,
-  0xE2, 0x0D, 0x28, 0x0B, 0x99, 0x08, 0x40, 0x05, 0xB5, 0x01, 0xEB, 0xFD, 0x05, 0xFA, 0xF1, 0xF5,
-  0x33, 0xF2, 0x33, 0xEF, 0xD5, 0xED, 0xDC, 0xED, 0xCC, 0xEF, 0xD0, 0xF3, 0xAD, 0xF8, 0x4B, 0xFE,
-  0x4A, 0x04, 0x51, 0x09, 0xB3, 0x0D, 0x77, 0x10, 0x24, 0x11, 0xFA, 0x10, 0x61, 0x0F, 0xBE, 0x0C,
-  0xE6, 0x09, 0x5F, 0x06, 0xC7, 0x02, 0x7F, 0xFE, 0xDE, 0xF9, 0xFD, 0xF5, 0xE7, 0xF1, 0xB1, 0xEE,
-  0xD9, 0xED, 0xB3, 0xED, 0x75, 0xEF, 0x21, 0xF3, 0xFF, 0xF7, 0xD6, 0xFD, 0xFC, 0x02, 0x88, 0x08,
-  0xA2, 0x0C, 0xFF, 0x0E, 0x8D, 0x10, 0x9A, 0x10, 0x79, 0x0F, 0x52, 0x0D, 0xBE, 0x0A, 0x56, 0x07,
-  0x8C, 0x03, 0x67, 0xFF, 0xE4, 0xFA, 0x48, 0xF7, 0x09, 0xF3, 0x1D, 0xF0, 0x3A, 0xEE, 0xCB, 0xED,
-  0x5A, 0xEF, 0xD5, 0xF1, 0x2C, 0xF6, 0x2B, 0xFB, 0x68, 0x00, 0x1B, 0x06, 0xB4, 0x0A, 0x21, 0x0E,
-  0x72, 0x10, 0x15, 0x11, 0x90, 0x10, 0x7A, 0x0E, 0x7D, 0x0B, 0x9D, 0x08, 0xAE, 0x04, 0xD9, 0x00,
-  0xF0, 0xFC, 0x05, 0xF9, 0x6E, 0xF5, 0x2F, 0xF2, 0xD2, 0xEF, 0xEC, 0xEE, 0x27, 0xEF, 0xD6, 0xF0,
-  0x37, 0xF4, 0xA0, 0xF8, 0xD2, 0xFD, 0x70, 0x03, 0x62, 0x08, 0x76, 0x0C, 0x0E, 0x0F, 0x28, 0x10,
-  0x67, 0x10, 0x29, 0x0F, 0x05, 0x0D, 0x6F, 0x0A, 0x4C, 0x07, 0xBD, 0x03, 0xC2, 0xFF, 0x15, 0xFC,
-  0x8D, 0xF8, 0x96, 0xF4, 0x9A, 0xF1, 0x7F, 0xEF, 0x05, 0xEF, 0xB8, 0xEF, 0xB7, 0xF1, 0xAD, 0xF5,
-  0xF1, 0xF9, 0xC1, 0xFE, 0xB9, 0x03, 0x1E, 0x08, 0xB8, 0x0B, 0xBB, 0x0D, 0x00, 0x0F, 0x66, 0x0F,
-  0x14, 0x0E, 0x3A, 0x0C, 0xCF, 0x09, 0xE1, 0x06, 0xAA, 0x03, 0x1C, 0x00, 0xD7, 0xFC, 0x9C, 0xF9,
-  0xFF, 0xF5, 0x51, 0xF3, 0x54, 0xF1, 0x9C, 0xF0, 0xED, 0xF0, 0x74, 0xF2, 0xA0, 0xF5, 0x5C, 0xF9,
-  0x94, 0xFD, 0x27, 0x02, 0x5B, 0x06, 0xAB, 0x09, 0xF5, 0x0B, 0x7E, 0x0D, 0xD7, 0x0D, 0x48, 0x0D,
-  0x17, 0x0C, 0x3C, 0x0A, 0xF5, 0x07, 0xBC, 0x04, 0x95, 0x01, 0x54, 0xFE, 0xE7, 0xFA, 0xB9, 0xF7,
-  0xF2, 0xF4, 0xEC, 0xF2, 0x17, 0xF2, 0x9A, 0xF1, 0x70, 0xF2, 0xCA, 0xF4, 0x79, 0xF7, 0x34, 0xFB,
-  0x7F, 0xFF, 0xAB, 0x03, 0x59, 0x07, 0x3E, 0x0A, 0x9C, 0x0C, 0xB5, 0x0D, 0xD1, 0x0D, 0x33, 0x0D,
-  0xB2, 0x0B, 0xA3, 0x09, 0xF5, 0x06, 0x1C, 0x04, 0xFD, 0x00, 0xCB, 0xFD, 0x58, 0xFA, 0x16, 0xF7,
-  0x53, 0xF4, 0x2A, 0xF2, 0xDD, 0xF0, 0xCB, 0xF0, 0x2E, 0xF2, 0x4F, 0xF4, 0xB5, 0xF7, 0x81, 0xFB,
-  0xB9, 0xFF, 0x14, 0x04, 0x62, 0x07, 0x05, 0x0B, 0x91, 0x0D, 0xA7, 0x0E, 0x48, 0x0F, 0x77, 0x0E,
-  0x1A, 0x0D, 0xB7, 0x0A, 0xC3, 0x07, 0x9D, 0x04, 0x3D, 0x01, 0x8C, 0xFD, 0xC7, 0xF9, 0x2D, 0xF6,
-  0xC8, 0xF2, 0xB8, 0xF0, 0x09, 0xEF, 0x03, 0xEF, 0x96, 0xF0, 0xB9, 0xF2, 0xBC, 0xF6, 0xE5, 0xFA,
-  0xDC, 0xFF, 0xE2, 0x04, 0xE5, 0x08, 0xCC, 0x0C, 0x1F, 0x0F, 0x91, 0x10, 0xCB, 0x10, 0xFC, 0x0F,
-  0x7A, 0x0E, 0x45, 0x0B, 0x25, 0x08, 0x75, 0x04, 0x4D, 0x00, 0x2E, 0xFC, 0x3B, 0xF8, 0x9F, 0xF4,
-  0x8E, 0xF1, 0x89, 0xEF, 0x4E, 0xEE, 0xD0, 0xEE, 0x7F, 0xF0, 0x0F, 0xF3, 0x0C, 0xF7, 0x46, 0xFB,
-  0x83, 0x00, 0x3B, 0x05, 0x6E, 0x09, 0x48, 0x0D, 0x87, 0x0F, 0xF5, 0x10, 0xE2, 0x10, 0xBA, 0x0F,
-  0xCC, 0x0D, 0xBC, 0x0A, 0xB1, 0x07, 0xDC, 0x03, 0x20, 0x00, 0x70, 0xFC, 0x8A, 0xF8, 0x57, 0xF5,
-  0x9F, 0xF2, 0x5F, 0xF0, 0x6E, 0xEF, 0x78, 0xEF, 0xAF, 0xF0, 0xFB, 0xF2, 0x59, 0xF6, 0x89, 0xFA,
-  0x2D, 0xFF, 0xD2, 0x03, 0x0A, 0x08, 0x5F, 0x0B, 0x08, 0x0E, 0x72, 0x0F, 0x90, 0x0F, 0xEF, 0x0E,
-  0x64, 0x0D, 0x29, 0x0B, 0x86, 0x08, 0x6C, 0x05, 0x68, 0x02, 0x17, 0xFF, 0xBF, 0xFB, 0x87, 0xF8,
-  0x98, 0xF5, 0x1D, 0xF3, 0x4B, 0xF1, 0x67, 0xF0, 0xCD, 0xF0, 0x2C, 0xF2, 0x8B, 0xF4, 0x1A, 0xF8,
-  0xBC, 0xFB, 0xE6, 0xFF, 0xD8, 0x03, 0x5E, 0x07, 0x6A, 0x0A, 0x9F, 0x0C, 0x54, 0x0E, 0xA3, 0x0E,
-  0x48, 0x0E, 0x37, 0x0D, 0x41, 0x0B, 0xD7, 0x08, 0xF1, 0x05, 0x06, 0x03, 0xB5, 0xFF, 0xA2, 0xFC,
-  0x85, 0xF9, 0x7B, 0xF6, 0xF8, 0xF3, 0x08, 0xF2, 0xF3, 0xF0, 0xB3, 0xF0, 0x79, 0xF1, 0x21, 0xF3,
-  0x16, 0xF6, 0x65, 0xF9, 0x78, 0xFD, 0xD6, 0x01, 0xCF, 0x05, 0xA0, 0x09, 0x63, 0x0C, 0x65, 0x0E,
-  0x4A, 0x0F, 0x04, 0x0F, 0x14, 0x0E, 0x3C, 0x0C, 0x0B, 0x0A, 0x4A, 0x07, 0x83, 0x04, 0x49, 0x01,
-  0x03, 0xFE, 0xD4, 0xFA, 0xA0, 0xF7, 0xEE, 0xF4, 0x98, 0xF2, 0x63, 0xF1, 0xA0, 0xF0, 0x12, 0xF1,
-  0xC0, 0xF2, 0x2C, 0xF5, 0x73, 0xF8, 0x13, 0xFC, 0x21, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x75, 0x0A,
-  0x91, 0x0C, 0x0D, 0x0E, 0x76, 0x0E, 0x24, 0x0E, 0x0E, 0x0D, 0x6C, 0x0B, 0x0C, 0x09, 0x74, 0x06,
-  0xBD, 0x03, 0x8C, 0x00, 0xB5, 0xFD, 0x89, 0xFA, 0xD3, 0xF7, 0x2E, 0xF5, 0x1A, 0xF3, 0xE6, 0xF1,
-  0x1B, 0xF1, 0x7B, 0xF1, 0xA8, 0xF2, 0xED, 0xF4, 0xB3, 0xF7, 0x36, 0xFB, 0x19, 0xFF, 0xE0, 0x02,
-  0xA0, 0x06, 0x72, 0x09, 0x0B, 0x0C, 0x9A, 0x0D, 0x69, 0x0E, 0x97, 0x0E, 0xDD, 0x0D, 0xC1, 0x0C,
-  0x71, 0x0A, 0x2E, 0x08, 0x3E, 0x05, 0x19, 0x02, 0x0F, 0xFF, 0x6F, 0xFB, 0x42, 0xF8, 0x07, 0xF5,
-  0x99, 0xF2, 0xBE, 0xF0, 0xD4, 0xEF, 0x1A, 0xF0, 0x31, 0xF1, 0x7B, 0xF3, 0x38, 0xF6, 0x12, 0xFA,
-  0x26, 0xFE, 0x0E, 0x02, 0x4C, 0x06, 0xAF, 0x09, 0xA0, 0x0C, 0x7C, 0x0E, 0x9A, 0x0F, 0xBF, 0x0F,
-  0xF6, 0x0E, 0x8C, 0x0D, 0x26, 0x0B, 0x90, 0x08, 0x7C, 0x05, 0x53, 0x02, 0x14, 0xFF, 0xD3, 0xFB,
-  0xCC, 0xF8, 0xB9, 0xF5, 0x53, 0xF3, 0x7B, 0xF1, 0x6B, 0xF0, 0x43, 0xF0, 0x06, 0xF1, 0xF2, 0xF2,
-  0x58, 0xF5, 0xB1, 0xF8, 0x3E, 0xFC, 0x13, 0x00, 0xEB, 0x03, 0x46, 0x07, 0x5B, 0x0A, 0x8A, 0x0C,
-  0x26, 0x0E, 0xCA, 0x0E, 0x98, 0x0E, 0xC5, 0x0D, 0x00, 0x0C, 0xFA, 0x09, 0x6B, 0x07, 0xB6, 0x04,
-  0x0B, 0x02, 0x3B, 0xFF, 0x87, 0xFC, 0x90, 0xF9, 0x13, 0xF7, 0xD5, 0xF4, 0xFE, 0xF2, 0xD4, 0xF1,
-  0x6D, 0xF1, 0xE8, 0xF1, 0x1D, 0xF3, 0x34, 0xF5, 0xE3, 0xF7, 0x17, 0xFB, 0x82, 0xFE, 0xE7, 0x01,
-  0x49, 0x05, 0x4F, 0x08, 0xCF, 0x0A, 0x96, 0x0C, 0xDA, 0x0D, 0x43, 0x0E, 0xDB, 0x0D, 0xF8, 0x0C,
-  0x58, 0x0B, 0x44, 0x09, 0xE7, 0x06, 0x3A, 0x04, 0x6B, 0x01, 0x90, 0xFE, 0xBA, 0xFB, 0xF1, 0xF8,
-  0x74, 0xF6, 0x56, 0xF4, 0x9E, 0xF2, 0x9C, 0xF1, 0x67, 0xF1, 0xDE, 0xF1, 0x4A, 0xF3, 0x60, 0xF5,
-  0x23, 0xF8, 0x55, 0xFB, 0xE1, 0xFE, 0x7E, 0x02, 0xE0, 0x05, 0x00, 0x09, 0x63, 0x0B, 0x11, 0x0D,
-  0x0A, 0x0E, 0x36, 0x0E, 0xAE, 0x0D, 0x64, 0x0C, 0xC7, 0x0A, 0x90, 0x08, 0x43, 0x06, 0xBE, 0x03,
-  0x1E, 0x01, 0x98, 0xFE, 0xD8, 0xFB, 0x63, 0xF9, 0xF1, 0xF6, 0x15, 0xF5, 0x72, 0xF3, 0x75, 0xF2,
-  0x30, 0xF2, 0x9C, 0xF2, 0xF9, 0xF3, 0xB9, 0xF5, 0x27, 0xF8, 0xF2, 0xFA, 0x00, 0xFE, 0x39, 0x01,
-  0x4A, 0x04, 0x55, 0x07, 0x93, 0x09, 0x8C, 0x0B, 0xE2, 0x0C, 0x79, 0x0D, 0xA1, 0x0D, 0xF0, 0x0C,
-  0xDF, 0x0B, 0x06, 0x0A, 0xE8, 0x07, 0x7B, 0x05, 0xD6, 0x02, 0x2C, 0x00, 0x58, 0xFD, 0x94, 0xFA,
-  0xDB, 0xF7, 0x8F, 0xF5, 0x95, 0xF3, 0x22, 0xF2, 0x7A, 0xF1, 0x89, 0xF1, 0x5F, 0xF2, 0xE6, 0xF3,
-  0x74, 0xF6, 0x63, 0xF9, 0x93, 0xFC, 0x2F, 0x00, 0x7C, 0x03, 0x99, 0x06, 0x26, 0x09, 0x44, 0x0B,
-  0xC8, 0x0C, 0x97, 0x0D, 0xCB, 0x0D, 0x46, 0x0D, 0x35, 0x0C, 0x88, 0x0A, 0x6B, 0x08, 0x0C, 0x06,
-  0x6A, 0x03, 0xBB, 0x00, 0x0B, 0xFE, 0x8D, 0xFB, 0x25, 0xF9, 0x1F, 0xF7, 0x78, 0xF5, 0x39, 0xF4,
-  0x70, 0xF3, 0x48, 0xF3, 0xC0, 0xF3, 0xD1, 0xF4, 0x8D, 0xF6, 0xE2, 0xF8, 0x91, 0xFB, 0x78, 0xFE,
-  0x5E, 0x01, 0x29, 0x04, 0x89, 0x06, 0x80, 0x08, 0xF4, 0x09, 0xCB, 0x0A, 0x1F, 0x0B, 0xFA, 0x0A,
-  0x5C, 0x0A, 0x61, 0x09, 0x0D, 0x08, 0x68, 0x06, 0x8E, 0x04, 0x9C, 0x02, 0xA3, 0x00, 0xBF, 0xFE,
-  0xED, 0xFC, 0x4C, 0xFB, 0xC2, 0xF9, 0x66, 0xF8, 0x46, 0xF7, 0x68, 0xF6, 0xFA, 0xF5, 0xF3, 0xF5,
-  0x5C, 0xF6, 0x63, 0xF7, 0xDC, 0xF8, 0xBB, 0xFA, 0xEA, 0xFC, 0x46, 0xFF, 0x92, 0x01, 0x9B, 0x03,
-  0x5F, 0x05, 0xCA, 0x06, 0xB6, 0x07, 0x53, 0x08, 0x9B, 0x08, 0x8C, 0x08, 0x39, 0x08, 0xAD, 0x07,
-  0xE6, 0x06, 0xE8, 0x05, 0xC9, 0x04, 0x8E, 0x03, 0x40, 0x02, 0xE3, 0x00, 0x7C, 0xFF, 0x0E, 0xFE,
-  0xA1, 0xFC, 0x38, 0xFB, 0xD1, 0xF9, 0x95, 0xF8, 0x89, 0xF7, 0xCF, 0xF6, 0x8C, 0xF6, 0xC2, 0xF6,
-  0x7B, 0xF7, 0xB3, 0xF8, 0x54, 0xFA, 0x43, 0xFC, 0x42, 0xFE, 0x46, 0x00, 0x10, 0x02, 0x8C, 0x03,
-  0xD7, 0x04, 0xE4, 0x05, 0xB3, 0x06, 0x5A, 0x07, 0xCC, 0x07, 0x06, 0x08, 0x07, 0x08, 0xD3, 0x07,
-  0x64, 0x07, 0xC7, 0x06, 0xE6, 0x05, 0xDF, 0x04, 0xA1, 0x03, 0x27, 0x02, 0x89, 0x00, 0xC1, 0xFE,
-  0x07, 0xFD, 0x3A, 0xFB, 0x83, 0xF9, 0x06, 0xF8, 0xC3, 0xF6, 0xF0, 0xF5, 0x8E, 0xF5, 0xC9, 0xF5,
-  0x8A, 0xF6, 0xD7, 0xF7, 0x9C, 0xF9, 0x98, 0xFB, 0xA3, 0xFD, 0x8B, 0xFF, 0x2D, 0x01, 0x90, 0x02,
-  0xBB, 0x03, 0xAF, 0x04, 0x83, 0x05, 0x4B, 0x06, 0xF0, 0x06, 0x77, 0x07, 0xD7, 0x07, 0x1D, 0x08,
-  0x34, 0x08, 0x09, 0x08, 0xA7, 0x07, 0xF6, 0x06, 0xF1, 0x05, 0xA9, 0x04, 0x1A, 0x03, 0x4B, 0x01,
-  0x62, 0xFF, 0x5F, 0xFD, 0x6F, 0xFB, 0x98, 0xF9, 0xF2, 0xF7, 0xA5, 0xF6, 0xBE, 0xF5, 0x64, 0xF5,
-  0x91, 0xF5, 0x40, 0xF6, 0x78, 0xF7, 0x19, 0xF9, 0xF9, 0xFA, 0xE4, 0xFC, 0xB0, 0xFE, 0x48, 0x00,
-  0xA2, 0x01, 0xB2, 0x02, 0x94, 0x03, 0x5A, 0x04, 0x05, 0x05, 0xAF, 0x05, 0x43, 0x06, 0xB9, 0x06,
-  0x17, 0x07, 0x48, 0x07, 0x55, 0x07, 0x29, 0x07, 0xC7, 0x06, 0x34, 0x06, 0x61, 0x05, 0x50, 0x04,
-  0x09, 0x03, 0x9F, 0x01, 0x0B, 0x00, 0x76, 0xFE, 0xE5, 0xFC, 0x6E, 0xFB, 0x2A, 0xFA, 0x23, 0xF9,
-  0x65, 0xF8, 0xF7, 0xF7, 0xEC, 0xF7, 0x31, 0xF8, 0xC7, 0xF8, 0xB1, 0xF9, 0xD1, 0xFA, 0x0B, 0xFC,
-  0x3E, 0xFD, 0x58, 0xFE, 0x4C, 0xFF, 0x1B, 0x00, 0xC7, 0x00, 0x6D, 0x01, 0x16, 0x02, 0xC6, 0x02,
-  0x7B, 0x03, 0x31, 0x04, 0xE0, 0x04, 0x73, 0x05, 0xEC, 0x05, 0x3F, 0x06, 0x5C, 0x06, 0x4D, 0x06,
-  0x10, 0x06, 0x92, 0x05, 0xDB, 0x04, 0xF0, 0x03, 0xD3, 0x02, 0x98, 0x01, 0x50, 0x00, 0x0C, 0xFF,
-  0xD4, 0xFD, 0xC3, 0xFC, 0xDD, 0xFB, 0x2A, 0xFB, 0xB3, 0xFA, 0x76, 0xFA, 0x72, 0xFA, 0xA8, 0xFA,
-  0x08, 0xFB, 0x88, 0xFB, 0x1A, 0xFC, 0xA9, 0xFC, 0x32, 0xFD, 0xA1, 0xFD, 0x02, 0xFE, 0x4E, 0xFE,
-  0x90, 0xFE, 0xD5, 0xFE, 0x34, 0xFF, 0xB8, 0xFF, 0x71, 0x00, 0x48, 0x01, 0x2F, 0x02, 0x1C, 0x03,
-  0xF1, 0x03, 0xA6, 0x04, 0x2F, 0x05, 0x96, 0x05, 0xDF, 0x05, 0xE9, 0x05, 0xBD, 0x05, 0x59, 0x05,
-  0xAA, 0x04, 0xD1, 0x03, 0xD2, 0x02, 0xBD, 0x01, 0xA5, 0x00, 0x93, 0xFF, 0x99, 0xFE, 0xB7, 0xFD,
-  0xF7, 0xFC, 0x63, 0xFC, 0xFA, 0xFB, 0xAD, 0xFB, 0x90, 0xFB, 0x8D, 0xFB, 0xA3, 0xFB, 0xC8, 0xFB,
-  0xF6, 0xFB, 0x39, 0xFC, 0x7A, 0xFC, 0xC4, 0xFC, 0x16, 0xFD, 0x71, 0xFD, 0xE7, 0xFD, 0x75, 0xFE,
-  0x22, 0xFF, 0xE2, 0xFF, 0xBC, 0x00, 0xA2, 0x01, 0x7F, 0x02, 0x42, 0x03, 0xE9, 0x03, 0x66, 0x04,
-  0xAA, 0x04, 0xC3, 0x04, 0xAB, 0x04, 0x69, 0x04, 0x03, 0x04, 0x81, 0x03, 0xF0, 0x02, 0x54, 0x02,
-  0xB0, 0x01, 0x10, 0x01, 0x78, 0x00, 0xE8, 0xFF, 0x64, 0xFF, 0xF5, 0xFE, 0x90, 0xFE, 0x3A, 0xFE,
-  0xF4, 0xFD, 0xBA, 0xFD, 0x8B, 0xFD, 0x68, 0xFD, 0x58, 0xFD, 0x4C, 0xFD, 0x57, 0xFD, 0x69, 0xFD,
-  0x8A, 0xFD, 0xB9, 0xFD, 0xE9, 0xFD, 0x28, 0xFE, 0x70, 0xFE, 0xBF, 0xFE, 0x1D, 0xFF, 0x81, 0xFF,
-  0xE4, 0xFF, 0x4C, 0x00, 0xA7, 0x00, 0xFC, 0x00, 0x3F, 0x01, 0x73, 0x01, 0x9A, 0x01, 0xB1, 0x01,
-  0xBF, 0x01, 0xC4, 0x01, 0xC1, 0x01, 0xBB, 0x01, 0xB0, 0x01, 0xA8, 0x01, 0x9F, 0x01, 0x98, 0x01,
-  0x92, 0x01, 0x89, 0x01, 0x74, 0x01, 0x56, 0x01, 0x2C, 0x01, 0xF0, 0x00, 0xAA, 0x00, 0x5D, 0x00,
-  0x09, 0x00, 0xB4, 0xFF, 0x5F, 0xFF, 0x0D, 0xFF, 0xC4, 0xFE, 0x8A, 0xFE, 0x59, 0xFE, 0x36, 0xFE,
-  0x1F, 0xFE, 0x14, 0xFE, 0x16, 0xFE, 0x1D, 0xFE, 0x30, 0xFE, 0x48, 0xFE, 0x61, 0xFE, 0x84, 0xFE,
-  0xAF, 0xFE, 0xE4, 0xFE, 0x1F, 0xFF, 0x63, 0xFF, 0xAE, 0xFF, 0xF3, 0xFF, 0x39, 0x00, 0x7F, 0x00,
-  0xC4, 0x00, 0x04, 0x01, 0x3B, 0x01, 0x66, 0x01, 0x8A, 0x01, 0xA8, 0x01, 0xBC, 0x01, 0xC3, 0x01,
-  0xC1, 0x01, 0xBA, 0x01, 0xAD, 0x01, 0x98, 0x01, 0x7F, 0x01, 0x5D, 0x01, 0x31, 0x01, 0xF8, 0x00,
-  0xBA, 0x00, 0x73, 0x00, 0x2B, 0x00, 0xE2, 0xFF, 0x9C, 0xFF, 0x58, 0xFF, 0x1E, 0xFF, 0xEA, 0xFE,
-  0xB9, 0xFE, 0x93, 0xFE, 0x79, 0xFE, 0x68, 0xFE, 0x61, 0xFE, 0x69, 0xFE, 0x78, 0xFE, 0x8E, 0xFE,
-  0xAC, 0xFE, 0xCF, 0xFE, 0xF3, 0xFE, 0x1E, 0xFF, 0x4C, 0xFF, 0x7B, 0xFF, 0xB0, 0xFF, 0xE6, 0xFF,
-  0x23, 0x00, 0x5E, 0x00, 0x99, 0x00, 0xCE, 0x00, 0xFE, 0x00, 0x26, 0x01, 0x42, 0x01, 0x55, 0x01,
-  0x5E, 0x01, 0x63, 0x01, 0x5D, 0x01, 0x47, 0x01, 0x24, 0x01, 0xFF, 0x00, 0xD7, 0x00, 0xAB, 0x00,
-  0x81, 0x00, 0x57, 0x00, 0x2D, 0x00, 0x05, 0x00, 0xDD, 0xFF, 0xB3, 0xFF, 0x93, 0xFF, 0x73, 0xFF,
-  0x57, 0xFF, 0x3F, 0xFF, 0x33, 0xFF, 0x2F, 0xFF, 0x33, 0xFF, 0x3B, 0xFF, 0x46, 0xFF, 0x51, 0xFF,
-  0x62, 0xFF, 0x76, 0xFF, 0x8B, 0xFF, 0xA1, 0xFF, 0xB9, 0xFF, 0xC9, 0xFF, 0xD6, 0xFF, 0xDE, 0xFF,
-  0xE7, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x13, 0x00, 0x1E, 0x00, 0x2D, 0x00, 0x43, 0x00,
-  0x53, 0x00, 0x5F, 0x00, 0x66, 0x00, 0x67, 0x00, 0x62, 0x00, 0x60, 0x00, 0x5C, 0x00, 0x57, 0x00,
-  0x4D, 0x00, 0x46, 0x00, 0x3F, 0x00, 0x3B, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x22, 0x00, 0x16, 0x00,
-  0x0C, 0x00, 0x01, 0x00, 0xF6, 0xFF, 0xE6, 0xFF, 0xD7, 0xFF, 0xCA, 0xFF, 0xC5, 0xFF, 0xC8, 0xFF,
-  0xCD, 0xFF, 0xD3, 0xFF, 0xDB, 0xFF, 0xE4, 0xFF, 0xE7, 0xFF, 0xEA, 0xFF, 0xF2, 0xFF, 0xF8, 0xFF,
-  0xFE, 0xFF, 0x01, 0x00, 0x06, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x12, 0x00,
-  0x12, 0x00, 0x10, 0x00, 0x11, 0x00, 0x16, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x1E, 0x00,
-  0x1C, 0x00, 0x17, 0x00, 0x0B, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xE7, 0xFF, 0xE0, 0xFF, 0xD8, 0xFF,
-  0xD2, 0xFF, 0xD4, 0xFF, 0xD8, 0xFF, 0xDA, 0xFF, 0xDD, 0xFF, 0xE0, 0xFF, 0xE9, 0xFF, 0xED, 0xFF,
-  0xFB, 0xFF, 0x09, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x29, 0x00, 0x34, 0x00, 0x3A, 0x00,
-  0x3C, 0x00, 0x3F, 0x00, 0x41, 0x00, 0x3D, 0x00, 0x35, 0x00, 0x29, 0x00, 0x19, 0x00, 0x0D, 0x00,
-  0xFD, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF, 0xE0, 0xFF, 0xD4, 0xFF, 0xCE, 0xFF, 0xC9, 0xFF, 0xC5, 0xFF,
-  0xC8, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xE8, 0xFF, 0xF9, 0xFF, 0x02, 0x00, 0x0B, 0x00, 0x0E, 0x00,
-  0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xF0, 0xFF, 0xEA, 0xFF, 0xE6, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF,
-  0xEF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x31, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x38, 0x00,
-  0x2A, 0x00, 0x18, 0x00, 0x03, 0x00, 0xF7, 0xFF, 0xF0, 0xFF, 0xE9, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF,
-  0xFE, 0xFF, 0x08, 0x00, 0x0F, 0x00, 0x12, 0x00, 0x16, 0x00, 0x19, 0x00, 0x18, 0x00, 0x15, 0x00,
-  0x11, 0x00, 0x0B, 0x00, 0x02, 0x00, 0xF8, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xE4, 0xFF, 0xE2, 0xFF,
-  0xE5, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xF5, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0x06, 0x00, 0x0F, 0x00,
-  0x10, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x0B, 0x00, 0x10, 0x00, 0x12, 0x00, 0x18, 0x00,
-  0x1B, 0x00, 0x1B, 0x00, 0x16, 0x00, 0x11, 0x00, 0x09, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x09, 0x00, 0x08, 0x00, 0x05, 0x00,
-  0x00, 0x00, 0xFA, 0xFF, 0xF1, 0xFF, 0xE9, 0xFF, 0xE7, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xF2, 0xFF,
-  0xF8, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xF8, 0xFF,
-  0xEE, 0xFF, 0xEB, 0xFF, 0xED, 0xFF, 0xF2, 0xFF, 0xFB, 0xFF, 0x08, 0x00, 0x14, 0x00, 0x23, 0x00,
-  0x24, 0x00, 0x21, 0x00, 0x1D, 0x00, 0x17, 0x00, 0x0C, 0x00, 0xFC, 0xFF, 0xF4, 0xFF, 0xEE, 0xFF,
-  0xED, 0xFF, 0xF0, 0xFF, 0xFA, 0xFF, 0x03, 0x00, 0x0A, 0x00, 0x10, 0x00, 0x12, 0x00, 0x10, 0x00,
-  0x09, 0x00, 0xFF, 0xFF, 0xF2, 0xFF, 0xE8, 0xFF, 0xE1, 0xFF, 0xD9, 0xFF, 0xD6, 0xFF, 0xDD, 0xFF,
-  0xE6, 0xFF, 0xF4, 0xFF, 0x02, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x11, 0x00, 0x10, 0x00, 0x0C, 0x00,
-  0x07, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xFA, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0x02, 0x00,
-  0x0B, 0x00, 0x14, 0x00, 0x19, 0x00, 0x17, 0x00, 0x14, 0x00, 0x11, 0x00, 0x0E, 0x00, 0x0C, 0x00,
-  0x0A, 0x00, 0x09, 0x00, 0x08, 0x00, 0x07, 0x00, 0x04, 0x00, 0xFE, 0xFF, 0xFA, 0xFF, 0xF9, 0xFF,
-  0xF7, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF3, 0xFF, 0xF1, 0xFF, 0xEC, 0xFF, 0xEA, 0xFF, 0xED, 0xFF,
-  0xF0, 0xFF, 0xEE, 0xFF, 0xEC, 0xFF, 0xEB, 0xFF, 0xF0, 0xFF, 0xF2, 0xFF, 0xF1, 0xFF, 0xF4, 0xFF,
-  0xFA, 0xFF, 0x07, 0x00, 0x13, 0x00, 0x1B, 0x00, 0x20, 0x00, 0x21, 0x00, 0x20, 0x00, 0x1B, 0x00,
-  0x15, 0x00, 0x0B, 0x00, 0xFF, 0xFF, 0xF7, 0xFF, 0xF2, 0xFF, 0xF2, 0xFF, 0xF6, 0xFF, 0xFE, 0xFF,
-  0x08, 0x00, 0x0E, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x07, 0x00, 0xFC, 0xFF, 0xF0, 0xFF, 0xE6, 0xFF,
-  0xE0, 0xFF, 0xDF, 0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xF7, 0xFF, 0xFE, 0xFF, 0x03, 0x00, 0x07, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
-  0x07, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x0B, 0x00,
-  0x0C, 0x00, 0x0A, 0x00, 0x07, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF5, 0xFF,
-  0xF5, 0xFF, 0xF8, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-  0xFB, 0xFF, 0xF9, 0xFF, 0xF6, 0xFF, 0xF4, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0xFE, 0xFF, 0x02, 0x00,
-  0x05, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFE, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF,
-  0xFC, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF,
-  0xFB, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xF9, 0xFF,
-  0xF9, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x00,
-  0x07, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFA, 0xFF, 0xF8, 0xFF, 0xF7, 0xFF,
-  0xF9, 0xFF, 0xFC, 0xFF, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00, 0x04, 0x00,
-  0x01, 0x00, 0xFC, 0xFF, 0xF8, 0xFF, 0xF5, 0xFF, 0xF5, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0x00, 0x00,
-  0x03, 0x00, 0x05, 0x00, 0x06, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x02, 0x00,
-  0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF,
-  0xFE, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xFB, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0x00, 0x00, 0x01, 0x00,
-  0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0xFC, 0xFF, 0xFB, 0xFF,
-  0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00,
+// IMA-ADPCM (ima_adpcm.h) : en-tête 4 octets, puis 1 nibble par sample
+// Jouer avec GotchiAudio::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN)
+static const uint8_t SNEEZE_ADPCM[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x90, 0x90, 0x01, 0x00, 0x00, 0x01, 0x91, 0x99, 0x10, 0x01, 0x19, 0x01, 0x91,
+  0x9A, 0x29, 0x01, 0x00, 0x11, 0x91, 0xAB, 0x20, 0x11, 0x19, 0x12, 0xB0, 0xBB, 0x33, 0xB2, 0x19,
+  0x11, 0x09, 0x99, 0x19, 0x11, 0x10, 0x0A, 0x20, 0x00, 0x09, 0x19, 0xBA, 0x49, 0x11, 0xB1, 0x1C,
+  0x10, 0xB9, 0x39, 0x13, 0x1A, 0x13, 0xCB, 0x8B, 0x44, 0x93, 0x9A, 0x1A, 0xB2, 0xAD, 0x42, 0x22,
+  0x98, 0x0C, 0xD8, 0x0C, 0x43, 0x90, 0x88, 0x24, 0xC8, 0xBC, 0x28, 0x32, 0xB0, 0x59, 0x05, 0xAC,
+  0x99, 0x39, 0x12, 0x48, 0x04, 0xAD, 0x1B, 0xA1, 0x30, 0x06, 0x42, 0xE9, 0x8C, 0x80, 0x41, 0x02,
+  0x19, 0x90, 0xCF, 0x29, 0x33, 0x81, 0x0A, 0x10, 0xBF, 0x29, 0x32, 0x88, 0x41, 0x14, 0xDE, 0x0A,
+  0x03, 0x11, 0x20, 0x83, 0xCD, 0x8A, 0x2A, 0x45, 0x01, 0xCA, 0x19, 0x44, 0xEC, 0x39, 0x15, 0x9A,
+  0x9A, 0x40, 0x93, 0xAC, 0x48, 0x04, 0xBB, 0x28, 0x85, 0xDB, 0x48, 0x13, 0xB9, 0x0A, 0x92, 0xBA,
+  0x60, 0x33, 0xC1, 0xAC, 0x08, 0x81, 0x01, 0x83, 0x00, 0x92, 0xFA, 0xBA, 0x41, 0x93, 0x18, 0x33,
+  0x91, 0xF8, 0xAF, 0x32, 0x80, 0x54, 0x86, 0xCE, 0x20, 0x81, 0x01, 0xA9, 0x31, 0xC8, 0x0A, 0x84,
+  0x38, 0xD3, 0x2C, 0x84, 0x8D, 0x13, 0x88, 0x91, 0x8D, 0x11, 0xB9, 0x72, 0xB3, 0x9C, 0x81, 0xCB,
+  0x08, 0x53, 0x82, 0x8B, 0x01, 0xBA, 0x8B, 0x64, 0x13, 0xCA, 0x2A, 0x33, 0x80, 0xCC, 0x73, 0xA2,
+  0x8A, 0xB1, 0x09, 0xE1, 0x71, 0x93, 0xCC, 0x10, 0x21, 0xA8, 0x2A, 0x27, 0xAB, 0x50, 0x82, 0xBA,
+  0xEC, 0x09, 0x18, 0x26, 0x80, 0x98, 0x88, 0xBB, 0x88, 0x63, 0x13, 0x00, 0xFA, 0x9F, 0x11, 0x11,
+  0x21, 0x00, 0xC8, 0x9C, 0x20, 0x01, 0x20, 0x12, 0x99, 0xAD, 0x31, 0xB1, 0x71, 0xA2, 0xBC, 0x32,
+  0xE2, 0x8C, 0x42, 0xA2, 0xAB, 0x24, 0xC8, 0x09, 0x44, 0x81, 0x29, 0x04, 0xFC, 0xAD, 0x20, 0x14,
+  0x80, 0x10, 0xA1, 0xCC, 0x09, 0x33, 0x01, 0x11, 0xEC, 0x8A, 0x19, 0x52, 0x11, 0x01, 0xB9, 0xBB,
+  0x89, 0x53, 0x22, 0x20, 0xB0, 0xAE, 0x21, 0xA8, 0x32, 0x14, 0xF9, 0xA9, 0x01, 0xF8, 0x21, 0x84,
+  0x99, 0x81, 0xB0, 0x1A, 0x44, 0x32, 0x02, 0x71, 0xE3, 0xFF, 0x38, 0x81, 0x00, 0x10, 0x91, 0xDB,
+  0x0A, 0x24, 0x90, 0x89, 0x01, 0xA9, 0x0C, 0x34, 0x81, 0x00, 0x99, 0xCA, 0x0B, 0x45, 0x81, 0x00,
+  0xA8, 0x19, 0xCA, 0x70, 0xA0, 0x08, 0x91, 0x89, 0xB9, 0x50, 0x13, 0xAB, 0x23, 0xD9, 0x18, 0x28,
+  0x77, 0x00, 0x20, 0xF2, 0xEF, 0x31, 0x08, 0x00, 0x00, 0x91, 0xBC, 0x29, 0x14, 0x98, 0x19, 0x00,
+  0xC9, 0x2A, 0x25, 0x90, 0x88, 0x81, 0xEB, 0x39, 0x15, 0xA8, 0x11, 0x90, 0x9B, 0x28, 0xC2, 0x0C,
+  0x32, 0x92, 0x8F, 0x38, 0x80, 0x9A, 0x61, 0x91, 0x0A, 0x25, 0x11, 0x43, 0xF1, 0xFF, 0x20, 0x10,
+  0x80, 0x10, 0x90, 0xCB, 0x1A, 0x24, 0x08, 0x10, 0xC9, 0x9B, 0x19, 0x34, 0x13, 0x00, 0xC9, 0xAD,
+  0x10, 0x21, 0x33, 0x00, 0xBA, 0xAD, 0x51, 0xB0, 0x90, 0x18, 0xA2, 0x8F, 0x23, 0x00, 0xA8, 0x0B,
+  0xA3, 0x2B, 0x47, 0x14, 0x51, 0x05, 0xFF, 0x2B, 0x83, 0x11, 0x88, 0x13, 0xDB, 0xAB, 0x42, 0x82,
+  0x28, 0x12, 0xFA, 0xAD, 0x31, 0x02, 0x11, 0x01, 0xD9, 0xAB, 0x21, 0x13, 0x21, 0x82, 0xEB, 0x9A,
+  0x20, 0xA2, 0x5A, 0x04, 0xEA, 0x09, 0x21, 0x80, 0x81, 0x33, 0xC9, 0x38, 0x56, 0xD2, 0xEF, 0x30,
+  0x81, 0x08, 0x00, 0x82, 0xCB, 0x0A, 0x43, 0x98, 0x38, 0x02, 0xCA, 0xBB, 0x31, 0xE9, 0x60, 0x03,
+  0xA9, 0x09, 0x00, 0x9A, 0x30, 0x03, 0xB9, 0x3A, 0xA5, 0x8B, 0x05, 0x88, 0xBA, 0x28, 0xA1, 0x4B,
+  0x26, 0x88, 0x11, 0x08, 0x77, 0xC0, 0xAE, 0x2A, 0x33, 0x08, 0x01, 0x12, 0xFB, 0x8C, 0x21, 0x01,
+  0x10, 0x12, 0xC9, 0xAC, 0x28, 0x02, 0xAC, 0x41, 0x04, 0xA9, 0x10, 0x82, 0xBB, 0x30, 0x98, 0x3A,
+  0x37, 0xC8, 0xA8, 0x13, 0xEA, 0x1A, 0x03, 0x00, 0x18, 0x01, 0x21, 0x31, 0x77, 0xA5, 0xCE, 0x9A,
+  0x42, 0x01, 0x10, 0x11, 0xD8, 0x9C, 0x18, 0x22, 0x00, 0x42, 0x90, 0xAE, 0x89, 0x11, 0x11, 0xFA,
+  0x58, 0xA2, 0x89, 0x13, 0x98, 0xAA, 0x28, 0x81, 0x08, 0x45, 0xB0, 0x8B, 0x80, 0x8C, 0x29, 0x78,
+  0x80, 0x41, 0x81, 0x30, 0x95, 0xEF, 0xAB, 0x52, 0x01, 0x00, 0x11, 0xB8, 0xAD, 0x18, 0x22, 0x80,
+  0x34, 0xA0, 0xBD, 0x89, 0x11, 0x01, 0xA8, 0x08, 0x11, 0x81, 0x53, 0x04, 0xBB, 0x9C, 0x0C, 0x44,
+  0x81, 0x21, 0xC2, 0xDD, 0x10, 0x88, 0x10, 0x24, 0x02, 0x31, 0x07, 0xFA, 0xBF, 0x30, 0x03, 0x08,
+  0x22, 0xA1, 0xAF, 0x09, 0x12, 0x80, 0x42, 0x02, 0xBD, 0x09, 0x08, 0x00, 0x22, 0xBA, 0x3B, 0x13,
+  0x1C, 0x72, 0x80, 0xAA, 0xAA, 0x31, 0x12, 0x52, 0x82, 0x8C, 0xEA, 0x0D, 0x32, 0x11, 0x62, 0x24,
+  0xC0, 0xFF, 0x19, 0x03, 0x09, 0x22, 0x92, 0xCB, 0x9A, 0x20, 0x98, 0x72, 0x03, 0xB9, 0x89, 0xA9,
+  0x99, 0x42, 0xB8, 0x73, 0xA1, 0x89, 0x80, 0x00, 0x98, 0x19, 0x12, 0x98, 0x61, 0xA0, 0x8A, 0x01,
+  0xCA, 0x71, 0x15, 0x63, 0xB1, 0xFF, 0x29, 0x92, 0x19, 0x23, 0x81, 0xBB, 0x0A, 0xB0, 0x8C, 0x55,
+  0x82, 0x89, 0x91, 0xBA, 0x9B, 0xC0, 0x71, 0x03, 0x08, 0xA1, 0xAA, 0x98, 0x89, 0x34, 0x01, 0x18,
+  0xC0, 0x08, 0x99, 0x28, 0x46, 0x52, 0x47, 0xFB, 0x1F, 0x82, 0x8A, 0x22, 0x01, 0x99, 0x09, 0xA2,
+  0x9E, 0x31, 0x92, 0x29, 0x04, 0xB9, 0x9B, 0x9C, 0x31, 0x20, 0x45, 0xA8, 0x08, 0xB9, 0x0C, 0x10,
+  0x32, 0x80, 0x21, 0xB0, 0x1F, 0x21, 0x41, 0x55, 0xFB, 0x2F, 0xA2, 0x9A, 0x34, 0xA8, 0x10, 0x00,
+  0xA9, 0xAB, 0x42, 0xA9, 0x68, 0x84, 0x9A, 0x09, 0xA0, 0x8A, 0x43, 0x81, 0x10, 0x92, 0xAC, 0x09,
+  0x91, 0x38, 0x23, 0x18, 0x21, 0x16, 0x71, 0x27, 0xFF, 0x20, 0xA0, 0x1B, 0x06, 0x89, 0x20, 0x88,
+  0xA9, 0x08, 0x80, 0x99, 0x62, 0xB8, 0x38, 0x82, 0x9C, 0x42, 0xAA, 0x20, 0x81, 0x9B, 0x23, 0xA9,
+  0x00, 0x33, 0xB0, 0x51, 0x46, 0x52, 0xFF, 0x20, 0x98, 0x0C, 0x14, 0x8A, 0x31, 0x88, 0x89, 0x81,
+  0x0C, 0xA9, 0x08, 0x01, 0x31, 0x48, 0xA2, 0x01, 0xA9, 0x8A, 0x09, 0x98, 0x45, 0xAB, 0x42, 0x81,
+  0x1A, 0x47, 0x21, 0xF1, 0x1F, 0x80, 0xDA, 0x31, 0xA8, 0x48, 0x02, 0x99, 0x32, 0xCB, 0x88, 0x98,
+  0x99, 0x41, 0x80, 0x12, 0x31, 0xB9, 0x28, 0x08, 0xC8, 0x52, 0xC8, 0x29, 0x81, 0xAB, 0x45, 0x81,
+  0x94, 0x8F, 0x01, 0xE9, 0x29, 0xA2, 0x1C, 0x13, 0xA9, 0x48, 0xB2, 0x1A, 0x03, 0x99, 0x31, 0xB0,
+  0x79, 0x00, 0xC9, 0x8A, 0x08, 0x00, 0x43, 0x94, 0x99, 0x25, 0xDA, 0x38, 0xA2, 0x0B, 0x13, 0x8D,
+  0x98, 0xAA, 0x62, 0x98, 0x49, 0x93, 0xAB, 0x12, 0xF9, 0x08, 0x00, 0x0A, 0x82, 0x20, 0x32, 0xC9,
+  0x39, 0x85, 0xAC, 0x2A, 0x52, 0xC1, 0x4B, 0x17, 0xAA, 0x20, 0xB0, 0x2A, 0x83, 0xBB, 0x29, 0xAA,
+  0x19, 0x22, 0x53, 0x90, 0x21, 0xB0, 0xAF, 0x0B, 0x2F, 0x10, 0x2B, 0x44, 0xB1, 0x1C, 0x83, 0xAC,
+  0x18, 0x82, 0x28, 0xB1, 0x53, 0xBA, 0x58, 0x07, 0xA9, 0x42, 0xD8, 0x8A, 0x91, 0xAA, 0x10, 0x01,
+  0x44, 0x01, 0x11, 0x03, 0xDF, 0x09, 0x91, 0x8C, 0x24, 0xA8, 0x28, 0x11, 0x80, 0x19, 0x80, 0xE9,
+  0x00, 0x9D, 0x20, 0x90, 0x47, 0x91, 0x19, 0x01, 0xDB, 0x88, 0x99, 0x89, 0x01, 0x2B, 0x06, 0x20,
+  0x53, 0x90, 0xAB, 0x18, 0xF9, 0x8C, 0x23, 0xA9, 0x38, 0x15, 0x99, 0x20, 0xC2, 0x1B, 0xA0, 0x9D,
+  0x91, 0x2A, 0x26, 0x18, 0x35, 0xB0, 0x1A, 0x90, 0xBD, 0x89, 0x99, 0x09, 0x32, 0x40, 0x47, 0x09,
+  0x18, 0xC2, 0xCB, 0x1A, 0xB8, 0x0D, 0x25, 0x80, 0x42, 0x92, 0xAC, 0x00, 0xCB, 0x08, 0x03, 0x40,
+  0x12, 0x99, 0x82, 0x8A, 0x1C, 0x90, 0x88, 0x31, 0x1A, 0xF8, 0x89, 0x43, 0x9C, 0x18, 0x27, 0x09,
+  0x8B, 0x92, 0xBE, 0x3A, 0x93, 0x28, 0x37, 0xA8, 0x0B, 0x83, 0xBE, 0x20, 0x90, 0x21, 0xA3, 0x32,
+  0xC4, 0x2B, 0x31, 0xC0, 0x98, 0x29, 0xE8, 0x8D, 0x03, 0x00, 0x40, 0x82, 0x88, 0xAB, 0xBA, 0x20,
+  0xCE, 0x38, 0x16, 0x1A, 0x12, 0xBE, 0x42, 0xB0, 0x2A, 0x05, 0x9B, 0x31, 0xB8, 0x38, 0xC1, 0x8B,
+  0x02, 0x1A, 0x37, 0x10, 0xB0, 0x9B, 0xC9, 0x2C, 0x43, 0xA8, 0x24, 0xE9, 0x0B, 0xA8, 0x89, 0x37,
+  0x00, 0x31, 0xE9, 0x99, 0x08, 0x9D, 0x22, 0x02, 0x3A, 0x24, 0xBB, 0x12, 0xDB, 0x19, 0xA3, 0x3A,
+  0x23, 0x99, 0x19, 0x15, 0xA0, 0x1C, 0x02, 0xAB, 0x30, 0x00, 0x8C, 0xCA, 0x08, 0x41, 0x00, 0x17,
+  0x01, 0x88, 0xA8, 0x9E, 0x01, 0x99, 0x10, 0x32, 0x11, 0x13, 0x0A, 0x99, 0x91, 0x1B, 0x90, 0x9A,
+  0x99, 0x19, 0x31, 0x23, 0x33, 0x12, 0xAA, 0xCB, 0x99, 0x8C, 0x19, 0x04, 0x30, 0x34, 0x90, 0x99,
+  0xA9, 0xA9, 0xA9, 0x99, 0x9B, 0x21, 0x12, 0x33, 0x11, 0x11, 0xB1, 0x9B, 0x9A, 0x9B, 0x11, 0x11,
+  0x21, 0x12, 0x11, 0x01, 0x90, 0xB9, 0x9B, 0x1A, 0xA9, 0x31, 0x31, 0x11, 0x12, 0x90, 0x9A, 0x99,
+  0x09, 0x19, 0x10, 0x01, 0x99, 0x10, 0x10, 0x11, 0x01, 0x10, 0xB1, 0x9A, 0x09, 0x00, 0x21, 0x11,
+  0x00, 0x00, 0x90, 0x99, 0x19, 0x91, 0x09, 0x10, 0x01, 0x09, 0x11, 0x00, 0x09, 0x00, 0x19, 0x00,
+  0x00, 0x91, 0x90, 0x01, 0x00, 0x01, 0x90, 0x10, 0x99, 0x01, 0x00, 0x01, 0x00, 0x91, 0x09, 0x90,
+  0x09, 0x10, 0x10, 0x01, 0x01, 0x00, 0x99, 0x00, 0x09, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x19,
+  0x00, 0x90, 0x00, 0x90, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x90, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x19, 0x09, 0x91, 0x01, 0x09, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x91, 0x91, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x19, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x19, 0x90, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x19, 0x00, 0x09, 0x10, 0x09,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x01, 0x00, 0x19, 0x09, 0x10, 0x09, 0x91, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90, 0x10, 0x90, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x99, 0x10, 0x09, 0x21, 0x91, 0x91, 0xB6, 0x7D, 0xB8,
+  0x12, 0x1A, 0x08, 0x00, 0x90, 0xA8, 0xD8, 0xFF, 0x6B, 0xC7, 0xA3, 0x10, 0x2A, 0x0A, 0x80, 0xC2,
+  0x81, 0xA4, 0x80, 0xA0, 0x90, 0x73, 0x9B, 0x19, 0xD2, 0x80, 0x11, 0x87, 0x85, 0x7F, 0x2E, 0x88,
+  0x90, 0xB2, 0x84, 0x3A, 0x2B, 0x19, 0x71, 0x5F, 0x2E, 0x08, 0x49, 0x4E, 0x2B, 0x19, 0x09, 0x90,
+  0xA2, 0x91, 0x92, 0x28, 0x8A, 0x59, 0x3C, 0xB8, 0xA4, 0x00, 0x38, 0x1C, 0xB1, 0x12, 0x4D, 0x0A,
+  0xA0, 0x93, 0x29, 0xB8, 0xA3, 0x02, 0x79, 0x4F, 0x1B, 0x98, 0xB3, 0x02, 0x08, 0x38, 0x0A, 0x0E,
+  0x93, 0x7D, 0x1A, 0x19, 0x19, 0xC2, 0x5A, 0x09, 0x6D, 0x0A, 0xA1, 0xB2, 0x83, 0x7C, 0x2C, 0x90,
+  0x80, 0xB2, 0x30, 0x3E, 0x09, 0x09, 0xD3, 0x10, 0x98, 0x02, 0x6B, 0xF1, 0xB3, 0x01, 0x29, 0x3C,
+  0xB8, 0xB7, 0x92, 0x20, 0x2C, 0x89, 0xA2, 0x79, 0x2C, 0x98, 0x81, 0x00, 0x19, 0x09, 0x10, 0xB9,
+  0x04, 0xC8, 0xB6, 0xB3, 0x01, 0xE3, 0xB2, 0xA2, 0x92, 0x20, 0x4A, 0x4E, 0x8A, 0xC4, 0x81, 0x10,
+  0x1B, 0xE3, 0x84, 0x1A, 0x5A, 0x2D, 0x08, 0x88, 0x28, 0x9A, 0xB7, 0x82, 0x19, 0x19, 0xA0, 0x22,
+  0x4F, 0x2C, 0x09, 0x90, 0x48, 0xC8, 0xA3, 0x81, 0x18, 0x0B, 0xC5, 0x83, 0x19, 0x89, 0x08, 0xD6,
+  0x92, 0x10, 0xE1, 0x92, 0xA2, 0x30, 0x1D, 0xC1, 0x93, 0x38, 0xC8, 0xA3, 0x82, 0x39, 0x2F, 0xC0,
+  0xC4, 0x93, 0x80, 0x08, 0x18, 0x29, 0x5D, 0x9A, 0xA3, 0x28, 0xB8, 0xA6, 0x5A, 0x6B, 0x1C, 0xC1,
+  0xB4, 0xA4, 0x38, 0x1B, 0x90, 0x10, 0x2A, 0x19, 0x3E, 0x09, 0xA0, 0x20, 0x7B, 0x9A, 0xA5, 0xB1,
+  0x03, 0x4C, 0xC8, 0x22, 0x0C, 0x81, 0x88, 0xA2, 0x68, 0x0C, 0xC4, 0x01, 0x39, 0x2E, 0x80, 0x4A,
+  0x9A, 0x30, 0x8A, 0x02, 0x1E, 0xC3, 0x41, 0x2D, 0x19, 0x0A, 0xC2, 0x31, 0x9A, 0x58, 0x0D, 0xB3,
+  0x21, 0xBA, 0x23, 0x3E, 0x99, 0x20, 0x89, 0xA2, 0xA1, 0x30, 0x7F, 0x3C, 0x0A, 0x80, 0x39, 0x3B,
+  0x8A, 0x00, 0x49, 0x3B, 0x6C, 0x3E, 0x1A, 0x88, 0xA2, 0x38, 0x4B, 0x2D, 0x2A, 0xA0, 0xC2, 0x02,
+  0x88, 0xF3, 0x31, 0x1C, 0xC1, 0x93, 0x39, 0x0D, 0xC5, 0x81, 0x90, 0xA3, 0x38, 0x2D, 0xB1, 0x41,
+  0x2F, 0x19, 0xC1, 0x82, 0x49, 0x0B, 0x00, 0xA8, 0xB4, 0x31, 0x3F, 0x1A, 0x98, 0xB3, 0xB3, 0x02,
+  0x3C, 0x3A, 0x1D, 0x90, 0x93, 0x1A, 0x7A, 0x4A, 0x2E, 0x88, 0x91, 0x90, 0x91, 0xC4, 0x11, 0x4B,
+  0x8B, 0x95, 0x90, 0x82, 0x6D, 0x2C, 0x98, 0x01, 0x19, 0x5A, 0x8B, 0xB4, 0x92, 0x00, 0x19, 0xA0,
+  0x81, 0x7B, 0x4D, 0x98, 0x81, 0x08, 0x89, 0xB5, 0x48, 0x0B, 0x91, 0x81, 0x6C, 0x8A, 0xB3, 0x20,
+  0xA8, 0x40, 0x9B, 0x92, 0xF3, 0x41, 0x2D, 0x98, 0xA1, 0x02, 0x4A, 0x8A, 0xA2, 0x11, 0x1A, 0x18,
+  0xCA, 0x05, 0x8C, 0x13, 0x1D, 0xE2, 0x82, 0xA1, 0x10, 0xF2, 0x12, 0x0B, 0x92, 0x58, 0x2F, 0xB0,
+  0x83, 0x5B, 0x1A, 0xA8, 0x04, 0x1D, 0x92, 0x2A, 0xA1, 0x18, 0x18, 0x4C, 0x8A, 0x00, 0xD4, 0x20,
+  0x88, 0x2A, 0xC2, 0x10, 0x09, 0xB1, 0x11, 0x89, 0x48, 0x2A, 0x8C, 0xC7, 0x11, 0x98, 0x81, 0x98,
+  0xE4, 0x83, 0x99, 0x61, 0x9B, 0x84, 0x2B, 0x38, 0x9C, 0x32, 0xCC, 0x14, 0x9B, 0x04, 0x9A, 0x95,
+  0x3A, 0xC1, 0x30, 0xA8, 0x39, 0xA8, 0x2D, 0xB2, 0x88, 0x04, 0x1D, 0x84, 0x2A, 0x92, 0x18, 0x88,
+  0x0C, 0xC8, 0x90, 0x90, 0x40, 0x3C, 0x12, 0x20, 0x85, 0xC8, 0x04, 0x8F, 0x98, 0x08, 0x00, 0x88,
+  0x59, 0x31, 0x29, 0xA1, 0x83, 0xF8, 0x0B, 0xA9, 0x20, 0xF8, 0x51, 0x01, 0x3C, 0x94, 0x0A, 0xA0,
+  0x9A, 0x09, 0x4A, 0xE8, 0x21, 0x32, 0x8A, 0x07, 0x1A, 0xA8, 0xAA, 0x09, 0xC1, 0xA8, 0x35, 0x29,
+  0x24, 0xB1, 0x59, 0xC8, 0xAD, 0x01, 0x81, 0x0D, 0x52, 0x08, 0x28, 0xA4, 0x88, 0x99, 0xCC, 0x90,
+  0x04, 0xAA, 0x71, 0x12, 0x09, 0x00, 0x81, 0xBE, 0x8A, 0x11, 0x99, 0x19, 0x37, 0x81, 0x21, 0x90,
+  0xB9, 0x9F, 0x8B, 0x28, 0xB1, 0x39, 0x47, 0x81, 0x81, 0x18, 0xE8, 0xCB, 0x19, 0x02, 0xBA, 0x72,
+  0x13, 0x80, 0x10, 0x01, 0xED, 0x8A, 0x18, 0x91, 0x1B, 0x55, 0x00, 0x81, 0x00, 0xB0, 0xAE, 0x8B,
+  0x30, 0xB0, 0x38, 0x37, 0x01, 0x00, 0x10, 0xFA, 0x9C, 0x0A, 0x02, 0x98, 0x61, 0x22, 0x01, 0x81,
+  0x90, 0xED, 0x9A, 0x09, 0x12, 0x89, 0x63, 0x31, 0x12, 0xB0, 0xC9, 0x9D, 0xBB, 0x3A, 0x02, 0x32,
+  0x15, 0x54, 0x11, 0xA9, 0xDB, 0x9B, 0xAC, 0x20, 0x31, 0x32, 0x31, 0x57, 0x90, 0x89, 0xBC, 0xBA,
+  0x9A, 0x13, 0x30, 0x17, 0x41, 0x23, 0xA9, 0xC9, 0xBC, 0xCB, 0x2A, 0x02, 0x42, 0x03, 0x72, 0x13,
+  0xA9, 0xDA, 0xBA, 0xBB, 0x48, 0x00, 0x63, 0x11, 0x42, 0x81, 0x99, 0xDB, 0xCB, 0x9C, 0x12, 0x20,
+  0x15, 0x10, 0x43, 0x80, 0xA9, 0xFB, 0xBB, 0x0C, 0x22, 0x32, 0x04, 0x28, 0x24, 0x08, 0xC0, 0xDD,
+  0xCA, 0x29, 0x22, 0x32, 0x91, 0x30, 0x24, 0x20, 0xEA, 0xCD, 0xAB, 0x38, 0x33, 0x42, 0x98, 0x30,
+  0x14, 0x13, 0xFB, 0xBD, 0x9B, 0x22, 0x14, 0x12, 0x99, 0x41, 0x22, 0x03, 0xDD, 0xAD, 0x8B, 0x23,
+  0x33, 0x02, 0x9B, 0x42, 0x42, 0x83, 0xDD, 0xBC, 0x8A, 0x32, 0x24, 0x82, 0x89, 0x20, 0x52, 0x83,
+  0xEC, 0xBB, 0x8C, 0x32, 0x42, 0x83, 0x99, 0x00, 0x51, 0x83, 0xDA, 0xDC, 0x8B, 0x30, 0x43, 0x03,
+  0x89, 0x89, 0x30, 0x14, 0xB8, 0xCF, 0xAC, 0x10, 0x43, 0x04, 0x80, 0x99, 0x19, 0x13, 0x00, 0xFC,
+  0x9C, 0x09, 0x41, 0x24, 0x00, 0xA8, 0x8A, 0x11, 0x11, 0xD8, 0xBE, 0x9A, 0x31, 0x36, 0x21, 0xA0,
+  0xAA, 0x88, 0x30, 0xA1, 0xBF, 0xCB, 0x29, 0x44, 0x33, 0x83, 0xAA, 0xBB, 0x19, 0x91, 0xDA, 0xDC,
+  0x0A, 0x32, 0x36, 0x14, 0x90, 0xA9, 0x9B, 0x89, 0x99, 0xBC, 0x8B, 0x30, 0x66, 0x23, 0x12, 0xA9,
+  0xBA, 0xBB, 0xBB, 0xBC, 0x8B, 0x38, 0x57, 0x33, 0x13, 0x80, 0xB9, 0xBB, 0xCD, 0xCB, 0xAA, 0x28,
+  0x73, 0x43, 0x22, 0x80, 0x99, 0xBA, 0xBA, 0xCC, 0xAC, 0x8A, 0x42, 0x54, 0x23, 0x12, 0xA8, 0xB9,
+  0xAB, 0xBC, 0xDB, 0xAB, 0x18, 0x54, 0x34, 0x33, 0x81, 0xA9, 0xCB, 0xCA, 0xBA, 0xAC, 0x8A, 0x31,
+  0x37, 0x34, 0x12, 0x80, 0xA9, 0xBB, 0xBC, 0xBD, 0xCB, 0x08, 0x51, 0x53, 0x33, 0x02, 0x90, 0xB9,
+  0xBB, 0xCC, 0xAC, 0xAC, 0x08, 0x42, 0x35, 0x43, 0x11, 0x90, 0xA9, 0xCB, 0xBB, 0xCC, 0xAA, 0x19,
+  0x52, 0x44, 0x33, 0x22, 0x88, 0xC9, 0xCA, 0xCB, 0xCA, 0xAA, 0x08, 0x52, 0x34, 0x34, 0x12, 0x80,
+  0xB9, 0xCB, 0xBC, 0xBC, 0xBB, 0x09, 0x62, 0x34, 0x25, 0x22, 0x80, 0xA9, 0xBB, 0xCC, 0xAC, 0xAB,
+  0x09, 0x41, 0x45, 0x42, 0x11, 0x81, 0x98, 0xBA, 0xCC, 0xBB, 0xBB, 0x8A, 0x32, 0x47, 0x33, 0x14,
+  0x02, 0xA8, 0xBB, 0xCC, 0xBB, 0xBB, 0x9B, 0x20, 0x46, 0x44, 0x32, 0x01, 0x90, 0xB9, 0xDB, 0xCB,
+  0xCA, 0x9A, 0x08, 0x52, 0x43, 0x24, 0x12, 0x01, 0xA9, 0xCA, 0xCB, 0xCB, 0xAB, 0x8A, 0x20, 0x45,
+  0x53, 0x22, 0x12, 0x80, 0xB9, 0xDB, 0xCB, 0xBB, 0xAB, 0x99, 0x51, 0x63, 0x43, 0x22, 0x12, 0x88,
+  0xAA, 0xBD, 0xCB, 0xAC, 0xAB, 0x09, 0x31, 0x46, 0x43, 0x32, 0x11, 0x80, 0xBA, 0xCC, 0xBC, 0xCB,
+  0x9B, 0x0A, 0x31, 0x46, 0x43, 0x23, 0x12, 0x88, 0xCA, 0xCB, 0xBC, 0xCB, 0x9A, 0x09, 0x41, 0x34,
+  0x26, 0x32, 0x11, 0x98, 0xC9, 0xCB, 0xBB, 0xBC, 0xAA, 0x09, 0x31, 0x46, 0x34, 0x32, 0x12, 0x90,
+  0xB9, 0xBD, 0xCB, 0xAC, 0xAB, 0x9A, 0x20, 0x54, 0x53, 0x32, 0x13, 0x02, 0xA8, 0xCA, 0xCC, 0xBB,
+  0xCB, 0xAA, 0x0A, 0x30, 0x36, 0x35, 0x24, 0x22, 0x80, 0xB8, 0xDA, 0xBB, 0xBC, 0xAC, 0x9B, 0x08,
+  0x42, 0x35, 0x25, 0x23, 0x12, 0x80, 0xA9, 0xCC, 0xCB, 0xBB, 0xCB, 0x9A, 0x09, 0x42, 0x54, 0x33,
+  0x34, 0x12, 0x81, 0xA8, 0xBC, 0xCC, 0xCB, 0xBB, 0xAB, 0x09, 0x51, 0x63, 0x33, 0x34, 0x12, 0x01,
+  0x99, 0xBC, 0xCC, 0xBB, 0xAC, 0xAB, 0x09, 0x40, 0x53, 0x34, 0x24, 0x13, 0x02, 0x88, 0xBB, 0xBD,
+  0xBC, 0xBC, 0xBA, 0xAA, 0x08, 0x43, 0x45, 0x34, 0x33, 0x22, 0x02, 0xA8, 0xCB, 0xBD, 0xBC, 0xBC,
+  0xBA, 0x9A, 0x08, 0x53, 0x44, 0x34, 0x33, 0x23, 0x81, 0xA8, 0xBC, 0xBD, 0xCB, 0xAC, 0xAB, 0x9A,
+  0x08, 0x43, 0x54, 0x33, 0x34, 0x23, 0x02, 0x90, 0xCA, 0xCC, 0xCB, 0xBB, 0xAC, 0xAB, 0x88, 0x32,
+  0x36, 0x35, 0x24, 0x13, 0x12, 0x88, 0xAA, 0xBD, 0xBC, 0xBC, 0xAB, 0x9B, 0x0A, 0x30, 0x64, 0x43,
+  0x43, 0x22, 0x12, 0x80, 0xA9, 0xCB, 0xDB, 0xBB, 0xBB, 0xAC, 0xAA, 0x09, 0x31, 0x46, 0x53, 0x23,
+  0x23, 0x11, 0x00, 0x99, 0xBB, 0xBD, 0xBC, 0xBC, 0xCB, 0xBB, 0xAB, 0x08, 0x53, 0x45, 0x43, 0x23,
+  0x22, 0x21, 0x01, 0x88, 0xB9, 0xCC, 0xCC, 0xBC, 0xDB, 0xAA, 0x9B, 0x08, 0x41, 0x35, 0x34, 0x22,
+  0x23, 0x21, 0x12, 0x11, 0x80, 0xCA, 0xCD, 0xCC, 0xBC, 0xBB, 0xAC, 0x89, 0x10, 0x53, 0x34, 0x43,
+  0x12, 0x12, 0x12, 0x12, 0x01, 0x90, 0xC9, 0xCC, 0xCC, 0xCB, 0xCB, 0xAA, 0x99, 0x00, 0x32, 0x35,
+  0x24, 0x23, 0x22, 0x32, 0x43, 0x33, 0x22, 0x80, 0xCA, 0xCD, 0xBD, 0xBC, 0xBB, 0xAB, 0x9A, 0x00,
+  0x42, 0x33, 0x33, 0x23, 0x32, 0x54, 0x45, 0x33, 0x24, 0x22, 0x01, 0xA9, 0xCD, 0xCC, 0xBB, 0xBB,
+  0xAB, 0x9A, 0x88, 0x01, 0x22, 0x32, 0x44, 0x44, 0x34, 0x35, 0x24, 0x22, 0x01, 0x99, 0xCA, 0xCB,
+  0xCB, 0xAB, 0xBB, 0xAB, 0xAA, 0x9A, 0x98, 0x11, 0x32, 0x45, 0x43, 0x35, 0x43, 0x32, 0x22, 0x12,
+  0x00, 0x88, 0x89, 0x98, 0x98, 0xDB, 0xCD, 0xCC, 0xCB, 0xBB, 0xBB, 0xAB, 0x89, 0x08, 0x32, 0x43,
+  0x45, 0x53, 0x33, 0x34, 0x43, 0x22, 0x12, 0x11, 0x88, 0xA9, 0xDB, 0xCC, 0xBC, 0xBC, 0xAC, 0xAB,
+  0xBA, 0x99, 0x08, 0x31, 0x53, 0x43, 0x34, 0x34, 0x34, 0x43, 0x32, 0x11, 0x01, 0xA9, 0xBC, 0xBD,
+  0xCB, 0xBB, 0xDB, 0xAA, 0xAA, 0x09, 0x00, 0x12, 0x43, 0x24, 0x14, 0x12, 0x21, 0x22, 0x32, 0x45,
+  0x23, 0x01, 0x89, 0xA9, 0xBB, 0x9B, 0xBD, 0xBC, 0xBC, 0xEB, 0xBB, 0x08, 0x21, 0x33, 0x11, 0x25,
+  0x12, 0x32, 0x13, 0x30, 0x90, 0x30, 0x17, 0x99, 0xA8, 0xCC, 0xCB, 0xA9, 0x1A, 0x01, 0x11, 0x16,
+  0x44, 0x21, 0x31, 0x14, 0x11, 0x90, 0xCC, 0xBC, 0xAC, 0xAA, 0x9C, 0x99, 0x21, 0x35, 0x25, 0x11,
+  0xB9, 0xAB, 0xAA, 0x39, 0x65, 0x33, 0x34, 0x90, 0xCC, 0x9C, 0x99, 0x28, 0x32, 0x12, 0x11, 0x90,
+  0xCB, 0xBC, 0xAC, 0x89, 0x20, 0x24, 0x40, 0x34, 0xA0, 0x98, 0x41, 0x20, 0x03, 0xCB, 0xAB, 0x99,
+  0x99, 0x10, 0x04, 0xA8, 0xCB, 0xAC, 0x09, 0x32, 0x34, 0x12, 0x91, 0xAC, 0x9D, 0x21, 0x63, 0x53,
+  0x80, 0x99, 0xBC, 0xAA, 0x18, 0x24, 0x23, 0x80, 0xCC, 0xBC, 0xBA, 0x29, 0x64, 0x23, 0x01, 0xA8,
+  0xA9, 0xB8, 0x9B, 0x42, 0x43, 0x82, 0xB9, 0x9A, 0x9A, 0x99, 0xCA, 0x89, 0x09, 0xB0, 0xBA, 0x2A,
+  0x92, 0x9A, 0x23, 0x29, 0x54, 0x33, 0x02, 0xA8, 0xCC, 0xAC, 0x0A, 0x41, 0x23, 0x81, 0xCD, 0xBB,
+  0x8A, 0x41, 0x24, 0x12, 0x80, 0xBB, 0x1B, 0x22, 0x33, 0x11, 0x00, 0x09, 0x91, 0xAB, 0xBB, 0x0C,
+  0x28, 0x31, 0x01, 0x91, 0x9A, 0x9B, 0x30, 0x33, 0x13, 0x00, 0x99, 0xAA, 0x11, 0xA0, 0x31, 0x10,
+  0x09, 0x00, 0x90, 0x9A, 0x09, 0x01, 0x19, 0x19, 0x99, 0x31, 0x01, 0xBB, 0x10, 0x11, 0x13, 0x23,
+  0xA9, 0xA9, 0xAA, 0x99, 0x21, 0x33, 0x11, 0x99, 0xBA, 0xBB, 0x20, 0x33, 0x12, 0x91, 0x99, 0x09,
+  0x09, 0x99, 0x09, 0x31, 0x91, 0xA9, 0x0B, 0x11, 0x21, 0x11, 0x09, 0x19, 0x01, 0x90, 0x0B, 0x10,
+  0x11, 0x09, 0x00, 0x00, 0x90, 0x99, 0x19, 0x11, 0x11, 0x01, 0x90, 0x90, 0x09, 0x11, 0x11, 0x00,
+  0x99, 0xB9, 0x90, 0x21, 0x11, 0x99, 0x90, 0x00, 0x01, 0x90, 0x10, 0x11, 0x11, 0x91, 0x99, 0x9B,
+  0x10, 0x11, 0x11, 0x01, 0x99, 0x19, 0x00, 0x00, 0x00, 0x11, 0x00, 0x99, 0x00, 0x09, 0x09, 0x01,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x01, 0x01, 0x99, 0x00,
+  0x01, 0x10, 0x90, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x99, 0x00, 0x00, 0x11, 0x01, 0x99, 0x99, 0x10, 0x01, 0x01, 0x90, 0x09, 0x00,
+  0x10, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x01, 0x00,
+  0x90, 0x09, 0x10, 0x10, 0x00, 0x09, 0x90, 0x10, 0x10, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x19,
+  0x19, 0x09, 0x01, 0x00, 0x90, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00,
 };
@@ -26,6 +26,11 @@
 #define GOTCHI_LCD_WIDTH 466
 #define GOTCHI_LCD_HEIGHT 466
 
+// Cadence cible de la tâche de rendu (modifiable au runtime : "face fps <n>")
+#ifndef GOTCHI_TARGET_FPS
+#define GOTCHI_TARGET_FPS 30
+#endif
+
 // ============================================
 // Touch CST9217 (I2C)
 // ============================================
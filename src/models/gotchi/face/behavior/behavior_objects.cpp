@@ -1,17 +1,12 @@
 #include "behavior_objects.h"
-#include "dirt_overlay.h"
-#include "../overlay/face_overlay_layer.h"
 #include "../../config/config.h"
 #include "../face_renderer.h"
 #include "sprites/sprite_asset.h"
-#include <Arduino_GFX_Library.h>
-#include <esp_heap_caps.h>
+#include "sprite_blit.h"
 #include <pgmspace.h>
 #include <cmath>
 #include <cstring>
 
-extern Arduino_GFX* getGotchiGfx();
-
 namespace {
 
 constexpr int16_t SCR_W = GOTCHI_LCD_WIDTH;
@@ -74,46 +69,11 @@ void drawRect(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY,
   }
 }
 
-// Mélange une couleur source 565 sur un fond 565 selon alpha (0..255)
-inline uint16_t blend565(uint16_t bg, uint16_t fg, uint8_t alpha) {
-  if (alpha == 0) return bg;
-  if (alpha >= 250) return fg;
-  uint16_t br = (bg >> 11) & 0x1F;
-  uint16_t bgn = (bg >> 5) & 0x3F;
-  uint16_t bb = bg & 0x1F;
-  uint16_t fr = (fg >> 11) & 0x1F;
-  uint16_t fgn = (fg >> 5) & 0x3F;
-  uint16_t fb_ = fg & 0x1F;
-  uint16_t inv = 255 - alpha;
-  uint16_t r = (fr * alpha + br * inv) / 255;
-  uint16_t g = (fgn * alpha + bgn * inv) / 255;
-  uint16_t b = (fb_ * alpha + bb * inv) / 255;
-  return (r << 11) | (g << 5) | b;
-}
-
-// Blit générique d'un SpriteAsset (alpha-only ou RGBA) dans le FB principal.
-// Pour alpha-only : `color` est utilisé. Pour RGBA : couleur native du sprite.
+// Blit d'un SpriteAsset (alpha-only, RGBA ou spans) centré en (cx, cy) dans le FB principal.
+// Pour alpha-only : `color` est utilisé. Sinon : couleur native du sprite.
 void drawSprite(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY,
                 int16_t cx, int16_t cy, const SpriteAsset& s, uint16_t color) {
-  const int16_t srcW = s.width;
-  const int16_t srcH = s.height;
-  const int16_t x0 = cx - srcW / 2;
-  const int16_t y0 = cy - srcH / 2;
-  const bool hasRgb = (s.rgb565 != nullptr);
-  for (int16_t dy = 0; dy < srcH; dy++) {
-    int16_t ly = (y0 + dy) - fbY;
-    if (ly < 0 || ly >= fbH) continue;
-    const int rowOff = dy * srcW;
-    for (int16_t dx = 0; dx < srcW; dx++) {
-      uint8_t a = pgm_read_byte(&s.alpha[rowOff + dx]);
-      if (a == 0) continue;
-      int16_t lx = (x0 + dx) - fbX;
-      if (lx < 0 || lx >= fbW) continue;
-      uint16_t src = hasRgb ? pgm_read_word(&s.rgb565[rowOff + dx]) : color;
-      uint16_t* p = &fb[ly * fbW + lx];
-      *p = blend565(*p, src, a);
-    }
-  }
+  SpriteBlit::blit(fb, fbW, fbH, cx - s.width / 2 - fbX, cy - s.height / 2 - fbY, s, color);
 }
 
 // Dessiner une goutte (cercle + triangle en bas)
@@ -193,74 +153,13 @@ void update(uint32_t dtMs) {
   }
 }
 
-// Mini framebuffer pour objets au-dessus du FB principal (zone haute)
-constexpr int16_t TOP_X = 20;
-constexpr int16_t TOP_Y = 30;
-constexpr int16_t TOP_W = 426;
-constexpr int16_t TOP_H = 100;  // y=30 a y=130 (juste au-dessus du FB principal)
-static uint16_t* s_topBuf = nullptr;
-static bool s_topDirty = false;
-static bool s_topWasDirty = false;  // etait dirty au frame precedent
-
-inline void topPx(int16_t sx, int16_t sy, uint16_t color) {
-  int16_t lx = sx - TOP_X;
-  int16_t ly = sy - TOP_Y;
-  if (lx >= 0 && lx < TOP_W && ly >= 0 && ly < TOP_H)
-    s_topBuf[ly * TOP_W + lx] = color;
-}
+// Bande haute du FB (ex top buffer y=30-130) passée au callback custom.
+// Le FB commence à l'écran en (20, 30) : coordonnées locales inchangées.
+constexpr int16_t TOP_H = 100;
 
-void topFillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-  for (int16_t dy = -r; dy <= r; dy++) {
-    int16_t dx = (int16_t)sqrtf((float)(r * r - dy * dy));
-    for (int16_t x = cx - dx; x <= cx + dx; x++) {
-      topPx(x, cy + dy, color);
-    }
-  }
-}
-
-// Variante top buffer du blit générique de sprite
-void topDrawSprite(int16_t cx, int16_t cy, const SpriteAsset& s, uint16_t color) {
-  const int16_t srcW = s.width;
-  const int16_t srcH = s.height;
-  const int16_t x0 = cx - srcW / 2;
-  const int16_t y0 = cy - srcH / 2;
-  const bool hasRgb = (s.rgb565 != nullptr);
-  for (int16_t dy = 0; dy < srcH; dy++) {
-    int16_t ly = (y0 + dy) - TOP_Y;
-    if (ly < 0 || ly >= TOP_H) continue;
-    const int rowOff = dy * srcW;
-    for (int16_t dx = 0; dx < srcW; dx++) {
-      uint8_t a = pgm_read_byte(&s.alpha[rowOff + dx]);
-      if (a == 0) continue;
-      int16_t lx = (x0 + dx) - TOP_X;
-      if (lx < 0 || lx >= TOP_W) continue;
-      uint16_t src = hasRgb ? pgm_read_word(&s.rgb565[rowOff + dx]) : color;
-      uint16_t* p = &s_topBuf[ly * TOP_W + lx];
-      *p = blend565(*p, src, a);
-    }
-  }
-}
-
-void draw() {
-  uint16_t* fb = FaceRenderer::getNextBuffer();
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY) {
   if (!fb) return;
 
-  int16_t fbX = FaceRenderer::getFbX();
-  int16_t fbY = FaceRenderer::getFbY();
-  int16_t fbW = FaceRenderer::getFbW();
-  int16_t fbH = FaceRenderer::getFbH();
-  Arduino_GFX* gfx = getGotchiGfx();
-
-  // Allouer le top buffer au premier appel
-  if (!s_topBuf) {
-    s_topBuf = (uint16_t*)heap_caps_malloc(TOP_W * TOP_H * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
-    if (!s_topBuf) return;
-  }
-
-  // Clear le top buffer
-  memset(s_topBuf, 0, TOP_W * TOP_H * sizeof(uint16_t));
-  s_topDirty = false;
-
   for (int i = 0; i < MAX_VISUAL_OBJECTS; i++) {
     const auto& o = s_pool[i];
     if (!o.alive) continue;
@@ -269,53 +168,40 @@ void draw() {
     int16_t sy = (int16_t)o.y;
     int16_t r = o.size / 2;
 
-    // Dessiner dans le FB principal (zone basse y=130-400)
+    // Dessiner dans le FB + signaler la bbox au damage tracking du renderer
     switch (o.shape) {
       case ObjectShape::Circle:
         drawCircle(fb, fbW, fbH, fbX, fbY, sx, sy, r, o.color565);
+        FaceRenderer::markDirty(sx - r - fbX, sy - r - fbY, 2 * r + 1, 2 * r + 1);
         break;
       case ObjectShape::Rect:
         drawRect(fb, fbW, fbH, fbX, fbY, sx, sy, o.size, o.size, o.color565);
+        FaceRenderer::markDirty(sx - o.size / 2 - fbX, sy - o.size / 2 - fbY, o.size, o.size);
         break;
-      case ObjectShape::Drop:
+      case ObjectShape::Drop: {
         drawDrop(fb, fbW, fbH, fbX, fbY, sx, sy, o.size, o.color565);
+        int16_t dr = o.size / 3;
+        FaceRenderer::markDirty(sx - dr - fbX, sy - dr - fbY, 2 * dr + 1, 2 * dr + o.size / 2 + 1);
         break;
+      }
       case ObjectShape::Sprite:
-        if (o.asset) drawSprite(fb, fbW, fbH, fbX, fbY, sx, sy, *o.asset, o.color565);
+        if (o.asset) {
+          drawSprite(fb, fbW, fbH, fbX, fbY, sx, sy, *o.asset, o.color565);
+          FaceRenderer::markDirty(sx - o.asset->width / 2 - fbX, sy - o.asset->height / 2 - fbY,
+                                  o.asset->width, o.asset->height);
+        }
         break;
     }
-
-    // Aussi dessiner dans le top buffer (zone haute y=30-130)
-    if (o.shape == ObjectShape::Sprite) {
-      if (o.asset && sy - (int16_t)(o.asset->height / 2) < fbY) {
-        topDrawSprite(sx, sy, *o.asset, o.color565);
-        s_topDirty = true;
-      }
-    } else if (sy - r < fbY) {
-      topFillCircle(sx, sy, r, o.color565);
-      s_topDirty = true;
-    }
-  }
-
-  // Saleté + éponge + brosse dans le top buffer (skip si ZZZ actifs pour éviter le clignotement)
-  if (s_topBuf && !FaceOverlayLayer::isSleepZzz()) {
-    DirtOverlay::drawIntoTopBuf(s_topBuf, TOP_W, TOP_H);
-    DirtOverlay::drawSpongeIntoTopBuf(s_topBuf, TOP_W, TOP_H);
-    DirtOverlay::drawBrushIntoTopBuf(s_topBuf, TOP_W, TOP_H);
-    if (DirtOverlay::isDirty() || DirtOverlay::isWashMode() || DirtOverlay::isBrushMode()) s_topDirty = true;
-  }
-
-  // Callback custom pour dessiner dans le top buffer (ex: température)
-  if (s_topDrawCb && s_topBuf) {
-    s_topDrawCb(s_topBuf, TOP_W, TOP_H);
-    s_topDirty = true;
   }
 
-  // Flush le top buffer si dirty OU si c'etait dirty au frame precedent (pour nettoyer)
-  if ((s_topDirty || s_topWasDirty) && gfx) {
-    gfx->draw16bitRGBBitmap(TOP_X, TOP_Y, s_topBuf, TOP_W, TOP_H);
+  // Callback custom (ex: température) : contenu inconnu, toute la bande est à diffuser.
+  // Il dessine en coordonnées du haut du FB : seulement si fb commence au haut du FB
+  // (en rendu bi-cœur, la bande basse ne le contient pas).
+  if (s_topDrawCb && fbY == FaceRenderer::getFbY()) {
+    const int16_t topH = fbH < TOP_H ? fbH : TOP_H;
+    s_topDrawCb(fb, fbW, topH);
+    FaceRenderer::markDirty(0, 0, fbW, topH);
   }
-  s_topWasDirty = s_topDirty;
 }
 
 int spawn(ObjectShape shape, uint32_t color, int16_t size,
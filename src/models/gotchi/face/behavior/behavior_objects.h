@@ -13,7 +13,8 @@ namespace BehaviorObjects {
 
 void init();
 void update(uint32_t dtMs);
-void draw();  // Dessiner les objets dans le framebuffer (appeler apres FaceRenderer::render)
+// Couche du compositeur FaceRenderer : dessine les objets dans le FB (y=30-440)
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
 
 // Spawn un objet, retourne son ID (0 à MAX-1) ou -1 si pool plein
 int spawn(ObjectShape shape, uint32_t color, int16_t size,
@@ -46,8 +47,8 @@ bool getLookTarget(float& outX, float& outY);
 using BounceCallback = void(*)(int objId);
 void setBounceCallback(BounceCallback cb);
 
-// Callback pour dessiner du contenu custom dans le top buffer (426x100px).
-// Appelé dans draw() après les sprites, avant le flush à l'écran.
+// Callback pour dessiner du contenu custom dans la bande haute du FB
+// (426x100px, écran y=30-130, stride = topW). Appelé après les objets.
 using TopDrawCallback = void(*)(uint16_t* topBuf, int16_t topW, int16_t topH);
 void setTopDrawCallback(TopDrawCallback cb);
 
@@ -459,7 +459,7 @@ void updateSceneSneeze(uint32_t /*dtMs*/) {
     FaceEngine::lookAt(0, 0.5f);
     FaceEngine::trauma(0, 0.8f);
     GotchiHaptic::angerBurst();
-    GotchiSpeakerTest::playSoundAsync(SNEEZE_PCM, SNEEZE_PCM_LEN);
+    GotchiSpeakerTest::playAdpcmAsync(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN);
     // Petites particules qui jaillissent
     BehaviorObjects::spawnSprite(SPRITE_SPARKLE_26_ASSET, 0,
       200.0f, 310.0f, -0.08f, -0.04f, 0, 0, false, 1500);
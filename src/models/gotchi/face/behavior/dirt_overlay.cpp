@@ -1,6 +1,7 @@
 #include "dirt_overlay.h"
 #include "behavior_engine.h"
 #include "../face_engine.h"
+#include "../face_renderer.h"
 #include "sprites/sprite_dirt_big_0.h"
 #include "sprites/sprite_dirt_big_1.h"
 #include "sprites/sprite_dirt_big_2.h"
@@ -11,6 +12,7 @@
 #include "sprites/sprite_bubbles_emoji_22.h"
 #include "behavior_objects.h"
 #include "sprites/sprite_asset.h"
+#include "sprite_blit.h"
 #include <pgmspace.h>
 #include <cstring>
 #include <cstdlib>
@@ -42,7 +44,6 @@ float s_fingerY = -100;
 float s_targetX = -100;      // Position cible (touch brut)
 float s_targetY = -100;
 bool s_fingerActive = false;
-constexpr int16_t SPONGE_SIZE = 64;
 
 // --- Brush mode (brossage de dents) ---
 bool s_brushMode = false;
@@ -67,55 +68,24 @@ constexpr int NUM_TILES = 4;
 
 constexpr int16_t SCR_W = 466;
 constexpr int16_t SCR_H = 466;
-constexpr int16_t TOP_BUF_X = 20;
-constexpr int16_t TOP_BUF_Y = 30;
-constexpr int16_t TOP_BUF_W = 426;
-constexpr int16_t TOP_BUF_H = 100;
-
-// Alpha blend avec facteur d'opacité global
-inline uint16_t blend565(uint16_t bg, uint16_t fg, uint8_t a) {
-  if (a == 0) return bg;
-  if (a >= 250) return fg;
-  uint8_t inv = 255 - a;
-  uint16_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * inv) / 255;
-  uint16_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * inv) / 255;
-  uint16_t b = ((fg & 0x1F) * a + (bg & 0x1F) * inv) / 255;
-  return (r << 11) | (g << 5) | b;
-}
 
-// Blit un sprite avec un facteur d'opacité (1-3 → 33%-100%)
+// Blit un sprite avec un facteur d'opacité (1-3 → 50%-100%)
 void blitTile(uint16_t* buf, int16_t bufW, int16_t bufH,
               int16_t bufOffX, int16_t bufOffY,
               int16_t spotX, int16_t spotY,
               const SpriteAsset& tile, uint8_t opacity) {
-  const int16_t tw = tile.width;
-  const int16_t th = tile.height;
-  const int16_t x0 = spotX - tw / 2;
-  const int16_t y0 = spotY - th / 2;
-  const bool hasRgb = (tile.rgb565 != nullptr);
   // Facteur d'opacité : 1=50%, 2=75%, 3=100%
   static const uint8_t opacityLevels[] = {0, 128, 192, 255};
-  uint16_t opacityScale = opacityLevels[opacity > 3 ? 3 : opacity];
-
-  for (int16_t dy = 0; dy < th; dy++) {
-    int16_t sy = y0 + dy;
-    int16_t py = sy - bufOffY;
-    if (py < 0 || py >= bufH) continue;
-    const int rowOff = dy * tw;
-    for (int16_t dx = 0; dx < tw; dx++) {
-      int16_t sx = x0 + dx;
-      int16_t px = sx - bufOffX;
-      if (px < 0 || px >= bufW) continue;
-      uint8_t a = pgm_read_byte(&tile.alpha[rowOff + dx]);
-      if (a == 0) continue;
-      // Appliquer le facteur d'opacité
-      a = (uint8_t)((uint16_t)a * opacityScale / 255);
-      if (a == 0) continue;
-      uint16_t src = hasRgb ? pgm_read_word(&tile.rgb565[rowOff + dx]) : 0x4A28;
-      uint16_t* p = &buf[py * bufW + px];
-      *p = blend565(*p, src, a);
-    }
-  }
+  SpriteBlit::blit(buf, bufW, bufH,
+                   spotX - tile.width / 2 - bufOffX, spotY - tile.height / 2 - bufOffY,
+                   tile, 0x4A28, opacityLevels[opacity > 3 ? 3 : opacity]);
+}
+
+// Signale au renderer la zone du FB couverte par un sprite centré en (spotX, spotY)
+inline void markTileFB(int16_t fbX, int16_t fbY, int16_t spotX, int16_t spotY,
+                       const SpriteAsset& tile) {
+  FaceRenderer::markDirty(spotX - tile.width / 2 - fbX, spotY - tile.height / 2 - fbY,
+                          tile.width, tile.height);
 }
 
 // Position aléatoire dans l'écran rond
@@ -295,21 +265,7 @@ void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY
     const SpriteAsset& tile = *DIRT_TILES[s_spots[i].tileIdx];
     blitTile(fb, fbW, fbH, fbX, fbY,
              s_spots[i].x, s_spots[i].y, tile, s_spots[i].opacity);
-  }
-
-  // Éponge dessinée séparément via drawSponge()
-}
-
-void drawIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH) {
-  if (!s_hasDirt || !buf) return;
-
-  for (int i = 0; i < MAX_SPOTS; i++) {
-    if (s_spots[i].opacity == 0) continue;
-    int16_t spotTop = s_spots[i].y - 32;
-    if (spotTop >= TOP_BUF_Y + TOP_BUF_H) continue;
-    const SpriteAsset& tile = *DIRT_TILES[s_spots[i].tileIdx];
-    blitTile(buf, bufW, bufH, TOP_BUF_X, TOP_BUF_Y,
-             s_spots[i].x, s_spots[i].y, tile, s_spots[i].opacity);
+    markTileFB(fbX, fbY, s_spots[i].x, s_spots[i].y, tile);
   }
 
   // Éponge dessinée séparément via drawSponge()
@@ -320,15 +276,7 @@ void drawSpongeIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16
   blitTile(fb, fbW, fbH, fbX, fbY,
            (int16_t)s_fingerX, (int16_t)s_fingerY,
            SPRITE_SPONGE_EMOJI_64_ASSET, MAX_OPACITY);
-}
-
-void drawSpongeIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH) {
-  if (!s_washMode || !s_fingerActive || !buf) return;
-  // Seulement si l'éponge touche la zone top (y < 130)
-  if ((int16_t)s_fingerY - SPONGE_SIZE / 2 >= TOP_BUF_Y + TOP_BUF_H) return;
-  blitTile(buf, bufW, bufH, TOP_BUF_X, TOP_BUF_Y,
-           (int16_t)s_fingerX, (int16_t)s_fingerY,
-           SPRITE_SPONGE_EMOJI_64_ASSET, MAX_OPACITY);
+  markTileFB(fbX, fbY, (int16_t)s_fingerX, (int16_t)s_fingerY, SPRITE_SPONGE_EMOJI_64_ASSET);
 }
 
 // --- Mode brossage de dents ---
@@ -436,14 +384,7 @@ void drawBrushIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_
   blitTile(fb, fbW, fbH, fbX, fbY,
            (int16_t)s_brushX, (int16_t)s_brushY,
            SPRITE_TOOTHBRUSH_EMOJI_88_ASSET, MAX_OPACITY);
-}
-
-void drawBrushIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH) {
-  if (!s_brushMode || !s_brushActive || !buf) return;
-  if ((int16_t)s_brushY - 32 >= TOP_BUF_Y + TOP_BUF_H) return;
-  blitTile(buf, bufW, bufH, TOP_BUF_X, TOP_BUF_Y,
-           (int16_t)s_brushX, (int16_t)s_brushY,
-           SPRITE_TOOTHBRUSH_EMOJI_88_ASSET, MAX_OPACITY);
+  markTileFB(fbX, fbY, (int16_t)s_brushX, (int16_t)s_brushY, SPRITE_TOOTHBRUSH_EMOJI_88_ASSET);
 }
 
 bool isDirty() {
@@ -24,24 +24,20 @@ bool onFingerMove(float screenX, float screenY);
 // Appelé chaque frame pour gérer le cooldown post-nettoyage.
 void update(uint32_t dtMs);
 
-// Dessiner les taches dans le framebuffer principal (zone y=130-440).
-void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
+// Couches du compositeur FaceRenderer (FB y=30-440) : dessinent dans le FB
+// et signalent leur zone via FaceRenderer::markDirty().
 
-// Dessiner les taches dans le top buffer (zone y=30-130).
-void drawIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH);
+// Dessiner les taches dans le framebuffer.
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
 
-// Dessiner l'éponge dans le framebuffer principal (alpha blend).
+// Dessiner l'éponge dans le framebuffer (alpha blend).
 void drawSpongeIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
 
-// Dessiner l'éponge dans le top buffer (zone y=30-130).
-void drawSpongeIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH);
-
 // --- Mode brossage de dents ---
 void setBrushMode(bool enabled);
 bool isBrushMode();
 bool onBrushFingerMove(float screenX, float screenY);
 void drawBrushIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
-void drawBrushIntoTopBuf(uint16_t* buf, int16_t bufW, int16_t bufH);
 
 // Y a-t-il de la saleté à l'écran ?
 bool isDirty();
@@ -0,0 +1,90 @@
+#include "sprite_blit.h"
+#include <pgmspace.h>
+#include "../blend565.h"
+
+namespace {
+
+// Format flat (rgba ou alpha-only) : lignes [dyStart, dyEnd) déjà clippées
+void blitFlat(uint16_t* buf, int16_t bufW, int16_t x0, int16_t y0,
+              int16_t dyStart, int16_t dyEnd, const SpriteAsset& s,
+              uint16_t color, uint8_t opacity) {
+  const int16_t srcW = s.width;
+  const bool hasRgb = (s.rgb565 != nullptr);
+  const int16_t dxStart = (x0 < 0) ? -x0 : 0;
+  const int16_t dxEnd = (x0 + srcW > bufW) ? bufW - x0 : srcW;
+  for (int16_t dy = dyStart; dy < dyEnd; dy++) {
+    const int rowOff = dy * srcW;
+    uint16_t* dst = buf + (y0 + dy) * bufW;
+    for (int16_t dx = dxStart; dx < dxEnd; dx++) {
+      uint8_t a = Blend565::scaleAlpha(pgm_read_byte(&s.alpha[rowOff + dx]), opacity);
+      if (a == 0) continue;
+      uint16_t src = hasRgb ? pgm_read_word(&s.rgb565[rowOff + dx]) : color;
+      uint16_t* p = &dst[x0 + dx];
+      *p = Blend565::over(*p, src, a);
+    }
+  }
+}
+
+// Format spans : les runs sont clippés en X, les lignes hors buffer ne sont
+// jamais décodées grâce à la table rows.
+void blitSpans(uint16_t* buf, int16_t bufW, int16_t x0, int16_t y0,
+               int16_t dyStart, int16_t dyEnd, const SpriteSpans& sp,
+               uint8_t opacity) {
+  for (int16_t dy = dyStart; dy < dyEnd; dy++) {
+    const uint8_t* op = sp.ops + pgm_read_word(&sp.rows[dy * 2]);
+    const uint16_t* px = sp.px + pgm_read_word(&sp.rows[dy * 2 + 1]);
+    uint16_t* dst = buf + (y0 + dy) * bufW;
+    int16_t x = x0;
+    while (x < bufW) {
+      const uint8_t ctl = pgm_read_byte(op++);
+      const uint8_t type = ctl & SPAN_TYPE_MASK;
+      if (type == SPAN_EOL) break;
+      const int16_t len = (ctl & SPAN_LEN_MASK) + 1;
+      if (type == SPAN_SKIP) {
+        x += len;
+        continue;
+      }
+      // Portion visible du run : [i0, i1)
+      const int16_t i0 = (x < 0) ? -x : 0;
+      const int16_t i1 = (x + len > bufW) ? bufW - x : len;
+      if (type == SPAN_OPAQUE) {
+        // memcpy si opacité pleine, sinon 2 pixels par mot à alpha constant
+        if (i0 < i1) Blend565::overRun(dst + x + i0, px + i0, i1 - i0, opacity);
+      } else if (opacity == 255) {  // SPAN_BLEND, couleurs pré-multipliées
+        for (int16_t i = i0; i < i1; i++) {
+          dst[x + i] = Blend565::overPremul(dst[x + i], pgm_read_word(&px[i]), pgm_read_byte(&op[i]));
+        }
+        op += len;
+      } else {
+        for (int16_t i = i0; i < i1; i++) {
+          dst[x + i] = Blend565::overPremul(dst[x + i], pgm_read_word(&px[i]), pgm_read_byte(&op[i]), opacity);
+        }
+        op += len;
+      }
+      px += len;
+      x += len;
+    }
+  }
+}
+
+} // namespace
+
+namespace SpriteBlit {
+
+void blit(uint16_t* buf, int16_t bufW, int16_t bufH, int16_t x0, int16_t y0,
+          const SpriteAsset& s, uint16_t color, uint8_t opacity) {
+  if (!buf || opacity == 0) return;
+  if (x0 >= bufW || y0 >= bufH) return;
+  if (x0 + (int16_t)s.width <= 0 || y0 + (int16_t)s.height <= 0) return;
+
+  const int16_t dyStart = (y0 < 0) ? -y0 : 0;
+  const int16_t dyEnd = (y0 + (int16_t)s.height > bufH) ? bufH - y0 : (int16_t)s.height;
+
+  if (s.spans) {
+    blitSpans(buf, bufW, x0, y0, dyStart, dyEnd, *s.spans, opacity);
+  } else if (s.alpha) {
+    blitFlat(buf, bufW, x0, y0, dyStart, dyEnd, s, color, opacity);
+  }
+}
+
+} // namespace SpriteBlit
@@ -0,0 +1,22 @@
+#ifndef SPRITE_BLIT_H
+#define SPRITE_BLIT_H
+
+#include <cstdint>
+#include "sprites/sprite_asset.h"
+
+// SpriteBlit — dessin d'un SpriteAsset dans un buffer RGB565 (FB principal,
+// top buffer, buffer overlay...). Gère les trois formats de SpriteAsset :
+//   - spans : transparent sauté sans lecture, runs opaques en memcpy,
+//     blend pré-multiplié seulement sur les bords anti-aliasés
+//   - rgba / alpha-only (flat) : parcours pixel par pixel
+namespace SpriteBlit {
+
+// (x0, y0) : coin haut-gauche du sprite, en coordonnées du buffer.
+// color    : couleur des sprites alpha-only (ignorée pour rgba/spans).
+// opacity  : opacité globale 0-255 (fade, niveaux de saleté...).
+void blit(uint16_t* buf, int16_t bufW, int16_t bufH, int16_t x0, int16_t y0,
+          const SpriteAsset& s, uint16_t color, uint8_t opacity = 255);
+
+} // namespace SpriteBlit
+
+#endif
@@ -5,66 +5,77 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from airplane_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from airplane_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 359/484 pixels visibles, 1329 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_AIRPLANE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_AIRPLANE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_AIRPLANE_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD5F, 0x0000, 0xE73C, 0xE77E, 0xCEDC, 0xD6DC, 0xCEBB,
-  0x0000, 0x7BFF, 0x3DFF, 0x3BF7, 0x3BF7, 0x555F, 0x555F, 0x7FFF, 0x0000, 0x6BD0, 0x07FF, 0x0000, 0x7BEF, 0x001F, 0xBDF7, 0x0000, 0xCEBB, 0xCEBB, 0xBE5A, 0xD6FC, 0xE75E, 0xCEBB,
-  0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x638E, 0x6BF0, 0x638F, 0x5000, 0x0000, 0x0000, 0x0000, 0xC69B, 0xD6FC, 0xCEBB, 0x7C52, 0x8472, 0xD71C, 0xCEBB,
-  0x0000, 0x557E, 0x5DBF, 0x555D, 0x557D, 0x557D, 0x559E, 0x5C76, 0x6C33, 0x63F2, 0x63D1, 0x5C77, 0x7DBE, 0x03FD, 0xBE9C, 0xD6DC, 0xCEDC, 0xCEBB, 0xD6FC, 0x7C52, 0xBE3A, 0xDF5D,
-  0x559D, 0x557D, 0x5DDF, 0x5DBF, 0x5DBF, 0x5D9E, 0x5D9E, 0x5D9E, 0x557D, 0x555D, 0x555D, 0x557E, 0x4D5D, 0x75BD, 0xCEBB, 0xD6DC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xC67A, 0xFFFF,
-  0x557C, 0x555D, 0x559E, 0x5D9F, 0x5DBF, 0x557E, 0x557D, 0x557D, 0x555D, 0x557D, 0x557D, 0x557E, 0x6DBE, 0xCEDC, 0xD6DB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xD71C, 0xD6FC, 0x0000,
-  0x0000, 0x0000, 0x559E, 0x557D, 0x557D, 0x557E, 0x5D9E, 0x5DDF, 0x5D9E, 0x557D, 0x555D, 0x659D, 0xC69B, 0xD6BB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DC, 0xD6DC, 0xC67A, 0x0000, 0xAD5F,
-  0x001F, 0x07FF, 0x0000, 0x0000, 0x0000, 0x555D, 0x557D, 0x557E, 0x557E, 0x557E, 0x5D7D, 0xBE9B, 0xD6DB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB, 0xCEDC, 0xC67B, 0x0000, 0xBDF7, 0x0000,
-  0x0000, 0x0000, 0x7BFF, 0x3DF7, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x6DBD, 0xBEBC, 0xD6DB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6BB, 0xCEDC, 0x6DBD, 0x001F, 0xAD55, 0x07FF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x9E7F, 0x7DFF, 0xD6BD, 0xD6DB, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB, 0xC69B, 0x6DBE, 0x4D5D, 0x7EBF, 0x0000, 0x07FF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0xF81F, 0xB5BB, 0xCEDB, 0xDF3D, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB, 0xBE9B, 0x659D, 0x557E, 0x557D, 0x5C76, 0x0000, 0x0000, 0x0000,
-  0x555F, 0x7DFF, 0x3DFF, 0x3DF7, 0x7DFF, 0x7FFF, 0xBFFF, 0xCEDB, 0xDF3D, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6FC, 0xBE7B, 0x5D7D, 0x555D, 0x557D, 0x555D, 0x63F1, 0x638F, 0x7391, 0x7BEF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE9B, 0xDF5E, 0xD6DC, 0xCEBB, 0xCEBB, 0xDF3D, 0xD6DB, 0x6D9D, 0x557E, 0x557D, 0x557D, 0x555D, 0x63F2, 0x6BF0, 0x6BD0, 0x0000,
-  0x555D, 0x5DBF, 0x555D, 0x555D, 0x4D3E, 0xBE7B, 0xE77E, 0xBE39, 0xADD8, 0xD6DC, 0xDF3D, 0xCEDC, 0xE73A, 0x0000, 0x557D, 0x559E, 0x557D, 0x557D, 0x6C33, 0x638E, 0x7BEF, 0x52AA,
-  0x555D, 0x661F, 0x5DBF, 0x55BF, 0x75FE, 0xDF3D, 0xB5F8, 0x7411, 0xBE39, 0xDF5E, 0xCEDB, 0xC638, 0x03FF, 0xFFFF, 0x557D, 0x5DBF, 0x557D, 0x5D9E, 0x5C75, 0x0000, 0x03FF, 0x0000,
-  0x555D, 0x559E, 0x5DBF, 0x555D, 0xBEBC, 0xBE18, 0x6BD0, 0xB5F8, 0xE77E, 0xCEBB, 0xCE79, 0x0000, 0x7D5A, 0x0000, 0x555D, 0x5DBF, 0x557D, 0x559E, 0x55BF, 0x7BEF, 0x555F, 0x0000,
-  0x0000, 0x5D7D, 0x4D5E, 0x7E1E, 0xBE18, 0x6BD0, 0xBE18, 0xDF3D, 0xC69B, 0x0000, 0x0000, 0x7BEF, 0x07FF, 0x0000, 0x4DBC, 0x555D, 0x557E, 0x5D9E, 0x555D, 0x0000, 0x555F, 0x0000,
-  0x555F, 0x0000, 0x0000, 0x9D98, 0x8CD4, 0xBE18, 0xBEBC, 0x75FE, 0x3D1E, 0x0000, 0x7DFF, 0x0000, 0x0000, 0x5555, 0x0000, 0x557D, 0x5DBF, 0x559E, 0x555D, 0x0000, 0x555F, 0x0000,
-  0x0000, 0x5555, 0x6BF2, 0x636E, 0xA5D9, 0x7DFE, 0x555D, 0x55BF, 0x557D, 0x0000, 0x3DFF, 0x0000, 0x0000, 0x3DFF, 0x0000, 0x555D, 0x5DBF, 0x5DBF, 0x555D, 0x0000, 0x3BF7, 0x0000,
-  0x0000, 0x0000, 0x53EF, 0x7BF5, 0x0000, 0x4D3D, 0x5DBF, 0x5DBF, 0x557D, 0x0000, 0x3DFF, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x5D7E, 0x557D, 0x5DDF, 0x555D, 0x0000, 0x3BF7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07FF, 0xAD55, 0x659D, 0x557E, 0x661F, 0x555D, 0x0000, 0x3DFF, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x555D, 0x5DBF, 0x557E, 0x0000, 0x7BFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x555D, 0x5DFF, 0x557D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x4D9D, 0x553D, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_AIRPLANE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 14, 7, 40, 25, 60, 37, 87, 58, 110, 80, 130, 101, 153, 120,
+  174, 137, 195, 152, 219, 167, 242, 182, 269, 204, 286, 219, 316, 240, 340, 260,
+  370, 279, 397, 295, 425, 309, 452, 326, 480, 339, 504, 351
 };
 
-const uint8_t SPRITE_AIRPLANE_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0A, 0x57, 0x9A, 0xB9, 0x52,
-  0x00, 0x02, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x00, 0x33, 0x01, 0x00, 0x02, 0x01, 0x04, 0x00, 0x40, 0xD6, 0xFF, 0xFF, 0xFF, 0xBD,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xFF, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x44, 0xF6, 0xFF, 0xFC, 0xF9, 0xFC, 0x9D,
-  0x00, 0x28, 0x54, 0x55, 0x51, 0x47, 0x41, 0x7E, 0xFF, 0xFF, 0xF5, 0x29, 0x11, 0x0C, 0x44, 0xF5, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0x59,
-  0x2A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF8, 0xF1, 0xED, 0xE2, 0xFB, 0xFF, 0xFD, 0xFF, 0xFC, 0xFF, 0xDD, 0x0D,
-  0x16, 0xB2, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xF5, 0x3E, 0x00,
-  0x00, 0x00, 0x25, 0x5F, 0xA5, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF, 0xF6, 0x44, 0x00, 0x03,
-  0x01, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x43, 0x8C, 0xD2, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF3, 0x41, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x02, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x49, 0xF5, 0xFE, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xE0, 0x03, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x04, 0x0C, 0xBD, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFF, 0xE9, 0x0C, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x07, 0xC0, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xF1, 0x29, 0x00, 0x00, 0x01,
-  0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0xB2, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xF7, 0xED, 0x9B, 0x09, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0xFF, 0xFA, 0xFF, 0xFB, 0xFF, 0xBF, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x00,
-  0x5B, 0x8C, 0x86, 0x74, 0x54, 0x9F, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xBF, 0x0B, 0x00, 0xDC, 0xFF, 0xFD, 0xFD, 0xFF, 0x76, 0x02, 0x03,
-  0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFB, 0xFF, 0xB2, 0x09, 0x02, 0x01, 0x95, 0xFE, 0xF9, 0xFF, 0x7D, 0x00, 0x02, 0x00,
-  0x43, 0xE2, 0xFF, 0xFB, 0xFC, 0xFD, 0xFF, 0xFD, 0xFF, 0xA5, 0x05, 0x00, 0x06, 0x00, 0x4C, 0xFF, 0xFC, 0xFF, 0x32, 0x02, 0x03, 0x00,
-  0x00, 0x1C, 0xAA, 0xFA, 0xFA, 0xFF, 0xFC, 0xFF, 0x9E, 0x00, 0x00, 0x02, 0x01, 0x00, 0x11, 0xEB, 0xFF, 0xFF, 0x47, 0x00, 0x03, 0x00,
-  0x03, 0x00, 0x00, 0xA6, 0xFF, 0xFA, 0xFC, 0xFF, 0x4D, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0xAE, 0xFF, 0xFF, 0x49, 0x00, 0x03, 0x00,
-  0x00, 0x03, 0x0C, 0x8B, 0xA0, 0xFF, 0xFB, 0xFF, 0x74, 0x01, 0x04, 0x00, 0x00, 0x04, 0x01, 0x67, 0xFF, 0xFE, 0x55, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x06, 0x06, 0x00, 0xAD, 0xFF, 0xFD, 0x86, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x25, 0xFC, 0xFF, 0x59, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x1A, 0xE5, 0xFF, 0x93, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0xA8, 0xF8, 0x2C, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x42, 0xD0, 0x5A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x2E, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_AIRPLANE_22_SPAN_OPS[] PROGMEM = {
+  0x07, 0x80, 0x02, 0x05, 0x80, 0x03, 0x00, 0x84, 0x0A, 0x57, 0x9A, 0xB9, 0x52, 0xC0, 0x00, 0x86, 0x02, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x00,
+  0x81, 0x33, 0x01, 0x00, 0x82, 0x02, 0x01, 0x04, 0x00, 0x81, 0x40, 0xD6, 0x42, 0x80, 0xBD, 0xC0, 0x80, 0x01, 0x06, 0x80, 0x76, 0x40, 0x81, 0x9D,
+  0x03, 0x02, 0x81, 0x44, 0xF6, 0x40, 0x83, 0xFC, 0xF9, 0xFC, 0x9D, 0xC0, 0x00, 0x86, 0x28, 0x54, 0x55, 0x51, 0x47, 0x41, 0x7E, 0x41, 0x85, 0xF5,
+  0x29, 0x11, 0x0C, 0x44, 0xF5, 0x40, 0x80, 0xFC, 0x40, 0x80, 0xFC, 0x40, 0x80, 0x59, 0xC0, 0x80, 0x2A, 0x46, 0x80, 0xFE, 0x40, 0x84, 0xF8, 0xF1,
+  0xED, 0xE2, 0xFB, 0x40, 0x80, 0xFD, 0x40, 0x80, 0xFC, 0x40, 0x81, 0xDD, 0x0D, 0xC0, 0x82, 0x16, 0xB2, 0xF7, 0x42, 0x82, 0xFC, 0xF9, 0xFD, 0x45,
+  0x80, 0xFE, 0x40, 0x80, 0xFD, 0x40, 0x81, 0xF5, 0x3E, 0xC0, 0x01, 0x83, 0x25, 0x5F, 0xA5, 0xE1, 0x44, 0x83, 0xFE, 0xFE, 0xFD, 0xFE, 0x40, 0x80,
+  0xFE, 0x40, 0x81, 0xF6, 0x44, 0x00, 0x80, 0x03, 0xC0, 0x81, 0x01, 0x01, 0x02, 0x85, 0x0C, 0x43, 0x8C, 0xD2, 0xFB, 0xFE, 0x43, 0x83, 0xFE, 0xFE,
+  0xF3, 0x41, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x82, 0x02, 0x04, 0x03, 0x03, 0x83, 0x49, 0xF5, 0xFE, 0xFE, 0x41, 0x80, 0xFD, 0x40, 0x83, 0xE0, 0x03,
+  0x03, 0x01, 0xC0, 0x04, 0x84, 0x01, 0x05, 0x04, 0x0C, 0xBD, 0x40, 0x80, 0xFD, 0x40, 0x80, 0xFE, 0x40, 0x80, 0xFD, 0x40, 0x81, 0xE9, 0x0C, 0x00,
+  0x80, 0x01, 0xC0, 0x04, 0x83, 0x02, 0x01, 0x07, 0xC0, 0x40, 0x80, 0xFD, 0x40, 0x80, 0xFD, 0x41, 0x80, 0xFE, 0x40, 0x81, 0xF1, 0x29, 0x01, 0x80,
+  0x01, 0xC0, 0x87, 0x03, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0xB2, 0x40, 0x80, 0xFB, 0x40, 0x80, 0xFD, 0x40, 0x81, 0xFC, 0xFE, 0x41, 0x84, 0xF7,
+  0xED, 0x9B, 0x09, 0x02, 0xC0, 0x05, 0x80, 0xA6, 0x40, 0x80, 0xFA, 0x40, 0x80, 0xFB, 0x40, 0x81, 0xBF, 0x4E, 0x45, 0x80, 0x33, 0xC0, 0x85, 0x5B,
+  0x8C, 0x86, 0x74, 0x54, 0x9F, 0x40, 0x80, 0xFB, 0x40, 0x80, 0xFA, 0x40, 0x81, 0xBF, 0x0B, 0x00, 0x80, 0xDC, 0x40, 0x81, 0xFD, 0xFD, 0x40, 0x82,
+  0x76, 0x02, 0x03, 0xC0, 0x80, 0xE3, 0x44, 0x80, 0xFD, 0x40, 0x80, 0xFB, 0x40, 0x86, 0xB2, 0x09, 0x02, 0x01, 0x95, 0xFE, 0xF9, 0x40, 0x80, 0x7D,
+  0x00, 0x80, 0x02, 0xC0, 0x81, 0x43, 0xE2, 0x40, 0x82, 0xFB, 0xFC, 0xFD, 0x40, 0x80, 0xFD, 0x40, 0x81, 0xA5, 0x05, 0x00, 0x80, 0x06, 0x00, 0x80,
+  0x4C, 0x40, 0x80, 0xFC, 0x40, 0x82, 0x32, 0x02, 0x03, 0xC0, 0x00, 0x83, 0x1C, 0xAA, 0xFA, 0xFA, 0x40, 0x80, 0xFC, 0x40, 0x80, 0x9E, 0x01, 0x81,
+  0x02, 0x01, 0x00, 0x81, 0x11, 0xEB, 0x41, 0x80, 0x47, 0x00, 0x80, 0x03, 0xC0, 0x80, 0x03, 0x01, 0x80, 0xA6, 0x40, 0x81, 0xFA, 0xFC, 0x40, 0x80,
+  0x4D, 0x00, 0x80, 0x04, 0x01, 0x80, 0x03, 0x00, 0x80, 0xAE, 0x41, 0x80, 0x49, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x83, 0x03, 0x0C, 0x8B, 0xA0, 0x40,
+  0x80, 0xFB, 0x40, 0x82, 0x74, 0x01, 0x04, 0x01, 0x82, 0x04, 0x01, 0x67, 0x40, 0x81, 0xFE, 0x55, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x81, 0x06, 0x06,
+  0x00, 0x80, 0xAD, 0x40, 0x81, 0xFD, 0x86, 0x00, 0x80, 0x04, 0x01, 0x80, 0x02, 0x00, 0x81, 0x25, 0xFC, 0x40, 0x80, 0x59, 0x00, 0x80, 0x04, 0xC0,
+  0x02, 0x83, 0x01, 0x03, 0x1A, 0xE5, 0x40, 0x80, 0x93, 0x00, 0x80, 0x04, 0x02, 0x80, 0x02, 0x00, 0x82, 0xA8, 0xF8, 0x2C, 0x00, 0x80, 0x02, 0xC0,
+  0x03, 0x80, 0x02, 0x00, 0x82, 0x42, 0xD0, 0x5A, 0x00, 0x80, 0x03, 0x02, 0x80, 0x01, 0x00, 0x81, 0x0D, 0x2E, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_AIRPLANE_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x4A8A, 0x7410, 0x94D4, 0x3A08, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x31A6, 0xAD96, 0xBE5A, 0xD6FC, 0xE75E, 0x94F4, 0x0000, 0x29A6, 0x6BF0, 0x3A29, 0x0000, 0x31C7, 0xCEBB,
+  0xCEBB, 0x7C52, 0x7C31, 0xD71C, 0x7C30, 0x08C4, 0x19EA, 0x19C9, 0x19A9, 0x1188, 0x1167, 0x2A2B, 0x6C33, 0x63F2, 0x5BB0, 0x08A3,
+  0x0041, 0x0021, 0x31C7, 0xCE9B, 0xCEDC, 0xCEBB, 0xD6FC, 0x7C52, 0xBE3A, 0x4A69, 0x08C4, 0x557D, 0x5DDF, 0x5DBF, 0x5DBF, 0x5D9E,
+  0x5D9E, 0x5D9E, 0x557D, 0x555D, 0x4D1C, 0x4D1C, 0x44FB, 0x64F9, 0xC67A, 0xD6DC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xAD96, 0x0861,
+  0x0082, 0x3393, 0x4D5D, 0x5D9F, 0x5DBF, 0x557E, 0x557D, 0x4D3C, 0x555D, 0x557D, 0x557D, 0x557E, 0x6DBE, 0xCEDC, 0xD6DB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEDC, 0xCEDB, 0x31A7, 0x08C4, 0x1A0A, 0x3393, 0x44BA, 0x5D9E, 0x5DDF, 0x5D9E, 0x557D, 0x555D, 0x659D, 0xC69B,
+  0xD6BB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DC, 0xCE9B, 0x31C7, 0x0000, 0x0000, 0x0000, 0x0041, 0x1147, 0x2B10, 0x4458, 0x4D3D, 0x5D7D,
+  0xBE9B, 0xD6DB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB, 0xBE5A, 0x3186, 0x0020, 0x0000, 0x0020, 0x0000, 0x1988, 0xB67B, 0xD6DB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xD6BB, 0xCEDC, 0x5CF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 0x9D14, 0xD6FC, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xD6DB, 0xC69B, 0x6DBE, 0x44DA, 0x0061, 0x0000, 0x0000, 0x0000, 0x0020, 0x9514, 0xDF3D, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB,
+  0xBE9B, 0x659D, 0x557E, 0x4D1B, 0x08A3, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x8CB2, 0xDF3D, 0xC67A,
+  0xCEBB, 0xCEBB, 0xD6FC, 0xBE7B, 0x5D7D, 0x555D, 0x557D, 0x4D1C, 0x5BAF, 0x3A08, 0x0000, 0x0000, 0x8451, 0xDF5E, 0xCE9B, 0xCEBB,
+  0xC67A, 0xDF3D, 0x9D14, 0x21A9, 0x557E, 0x557D, 0x557D, 0x555D, 0x63F2, 0x6BF0, 0x10A3, 0x19C9, 0x3331, 0x2ACF, 0x226D, 0x19CA,
+  0x73F0, 0xE77E, 0xB5F8, 0xADD8, 0xCE9B, 0xDF3D, 0x9515, 0x0020, 0x44B9, 0x559E, 0x557D, 0x557D, 0x6C33, 0x29A6, 0x0000, 0x0000,
+  0x4499, 0x661F, 0x5DBF, 0x55BF, 0x75FE, 0xDF3D, 0xB5F8, 0x7411, 0xB5F8, 0xDF5E, 0x8CB2, 0x0020, 0x0000, 0x0000, 0x2B31, 0x5DBF,
+  0x4D3C, 0x5D9E, 0x2A2A, 0x0000, 0x1147, 0x44DA, 0x5DBF, 0x4D1C, 0xBEBC, 0xBE18, 0x6BD0, 0xB5F8, 0xE77E, 0x8451, 0x0020, 0x0020,
+  0x19A9, 0x5DBF, 0x557D, 0x559E, 0x0905, 0x0000, 0x0000, 0x08A3, 0x2B73, 0x75DD, 0xB5D7, 0x6BD0, 0xBE18, 0xDF3D, 0x7C10, 0x0000,
+  0x0000, 0x0041, 0x4CDA, 0x557E, 0x5D9E, 0x1168, 0x0000, 0x0000, 0x638F, 0x8CD4, 0xB5D7, 0xBEBC, 0x75FE, 0x1189, 0x0020, 0x0000,
+  0x33B3, 0x5DBF, 0x559E, 0x1168, 0x0000, 0x0000, 0x0021, 0x31C7, 0x638F, 0x7DFE, 0x4D1C, 0x55BF, 0x228D, 0x0000, 0x0020, 0x0020,
+  0x0000, 0x222B, 0x5DBF, 0x5DBF, 0x19C9, 0x0000, 0x0000, 0x0000, 0x3393, 0x5DBF, 0x5DBF, 0x2ACF, 0x0020, 0x0000, 0x08C4, 0x557D,
+  0x5DDF, 0x19C9, 0x0000, 0x0000, 0x0000, 0x0882, 0x4CDB, 0x661F, 0x2AF0, 0x0020, 0x0000, 0x3373, 0x557E, 0x0905, 0x0000, 0x0000,
+  0x1147, 0x44D9, 0x19C9, 0x0000, 0x0000, 0x0041, 0x08E5
+};
+
+inline constexpr SpriteSpans SPRITE_AIRPLANE_22_SPANS = {
+  SPRITE_AIRPLANE_22_SPAN_ROWS, SPRITE_AIRPLANE_22_SPAN_OPS, SPRITE_AIRPLANE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_AIRPLANE_22_ASSET = {
   SPRITE_AIRPLANE_22_WIDTH, SPRITE_AIRPLANE_22_HEIGHT,
-  SPRITE_AIRPLANE_22_ALPHA, SPRITE_AIRPLANE_22_RGB565
+  nullptr, nullptr, &SPRITE_AIRPLANE_22_SPANS
 };
 
 #endif // SPRITE_AIRPLANE_22_INCLUDED
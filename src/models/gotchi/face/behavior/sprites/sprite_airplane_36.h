@@ -5,94 +5,131 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from airplane_36.png (36x36)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from airplane_36.png (36x36) — RGBA multi-couleur, encodé en spans
+// 853/1296 pixels visibles, 2881 bytes flash (flat : 3888). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_AIRPLANE_36_WIDTH = 36;
 constexpr uint16_t SPRITE_AIRPLANE_36_HEIGHT = 36;
 
-const uint16_t SPRITE_AIRPLANE_36_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xCEDB, 0xCEDC, 0xCEBB, 0xCEBB, 0xCE9B, 0x7BEF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xCEBB, 0xD6FC, 0xCEDB, 0xCEBB, 0xD6FC, 0xDF3D, 0xD6FC, 0xCE9B,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x6BCF, 0x538E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xCEBB, 0xCEDC, 0xD71D, 0xCEBB, 0xD6DC, 0xCEBB, 0xCEBB, 0xDF3D, 0xCEBB,
-  0x0000, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x001F, 0x001F, 0x001F, 0xAD55, 0x0000, 0x63AF, 0x6BD0, 0x63AF, 0x5B6F, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xCEBB, 0xDF3D, 0xCE9B, 0x7411, 0x638F, 0x8CB3, 0xC69B, 0xCEBB, 0xD6FC, 0xCEBB,
-  0x0000, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x638F, 0x6BD0, 0x63B0, 0x6BF1, 0x63B0, 0x5C34, 0x555A, 0x64DF, 0x3BF7, 0x64D9, 0xBDF7, 0x0000, 0xCEBB, 0xDF1D, 0xCEBB, 0xCEBB, 0xBE39, 0x9515, 0x5B4E, 0x8CB4, 0xD6DC, 0xCEBB, 0xCEBB,
-  0x0000, 0x0000, 0x0000, 0x5D1D, 0x5D1D, 0x5D1D, 0x5D1D, 0x555D, 0x667F, 0x64D9, 0x6C9B, 0x7BEF, 0x638F, 0x6BD0, 0x638F, 0x638F, 0x6B8F, 0x638E, 0x7960, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCEBB, 0xDF1D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xD71C, 0x9515, 0x638F, 0xCEBB, 0xCEBB, 0xB659,
-  0x0000, 0x5D7D, 0x557D, 0x555D, 0x557D, 0x555D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x555D, 0x5CFA, 0x5CFA, 0x5CD9, 0x5CB8, 0x5CD8, 0x5CD9, 0x555D, 0x557E, 0x557D, 0x557D, 0x455D, 0xB67C, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xBE39, 0x73F1, 0xD71D, 0xCEDB, 0x0000,
-  0x0000, 0x557D, 0x5DFF, 0x557D, 0x557E, 0x557E, 0x557E, 0x557E, 0x5D9E, 0x5D9E, 0x5D9E, 0x5D9E, 0x557E, 0x557E, 0x557E, 0x559E, 0x557E, 0x559F, 0x5DDF, 0x5DDF, 0x5DBF, 0x559F, 0x8E3E, 0xD71D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xCEBB, 0x0000,
-  0x0000, 0x557D, 0x5DDF, 0x559E, 0x557D, 0x557D, 0x557D, 0x557D, 0x555D, 0x557D, 0x557D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x557D, 0x557D, 0x4D5D, 0x85FC, 0xD6DB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF3D, 0xCEBB, 0x0000, 0xFFFF,
-  0x0000, 0xFFFF, 0x557D, 0x559E, 0x557E, 0x5DBF, 0x5DBF, 0x559E, 0x557D, 0x555D, 0x555D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0x7DDD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF1D, 0xCEBB, 0x0000, 0xFFFF, 0x07FF,
-  0x0000, 0x0000, 0x0000, 0x52B5, 0x557E, 0x557D, 0x557E, 0x557D, 0x557E, 0x5DBF, 0x5D9E, 0x557D, 0x557D, 0x557D, 0x555D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0x7DDD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF1D, 0xCEBB, 0x0000, 0xFFFF, 0x001F, 0x0000,
-  0x0000, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x3D5A, 0x557E, 0x555D, 0x557D, 0x557D, 0x5DBF, 0x5DBF, 0x557E, 0x555D, 0x557D, 0x4D5D, 0x75BD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD71C, 0xCEBB, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x001F, 0x7BFF, 0x3DFF, 0x5555, 0x0000, 0x0000, 0x0000, 0x52B5, 0x557D, 0x557D, 0x557E, 0x555D, 0x5DBF, 0x559F, 0x75BD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6FC, 0xBE9C, 0x0000, 0xAD5F, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x555F, 0x3DFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x657C, 0x4D5E, 0x6DBD, 0xC6DC, 0xD6BB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6DB, 0x8E3E, 0x3D1E, 0xFFFF, 0x3DFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x7BFF, 0x3DFF, 0xBDFF, 0x0000, 0xFF79, 0xDEFC, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x85FC, 0x559F, 0x5D7D, 0x0000, 0x3DFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0xC69B, 0xCEBB, 0xD71D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x7DDD, 0x4D5D, 0x5DBF, 0x555D, 0xFFFF, 0x34D9, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xCE9B, 0xCEDB, 0xD71C, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x7DDD, 0x4D5D, 0x557D, 0x5DDF, 0x557D, 0x0000, 0x555F, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0xBE7B, 0xCEBB, 0xDF1D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6BB, 0xCEBB, 0x75BD, 0x4D5D, 0x557D, 0x557D, 0x5DDF, 0x557E, 0x6B2A, 0x5BF2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x001F, 0xCEDB, 0xCEBB, 0xDF1D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6FC, 0xC6DC, 0x75BD, 0x4D5D, 0x557D, 0x557D, 0x555D, 0x559F, 0x5CB8, 0x638E, 0x63B0, 0x5B6F, 0x0000, 0xFFFF, 0x0000,
-  0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xCE79, 0xCEBB, 0xDF3D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD71D, 0xD6DB, 0x6DBD, 0x559F, 0x557D, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CD8, 0x638F, 0x6BF1, 0x63AF, 0x63AE, 0x7BEF, 0xFFFF,
-  0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7DF7, 0xAD55, 0xFD55, 0xCEBB, 0xDF1D, 0xCEBB, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD71C, 0xD6DC, 0xEF1B, 0x453D, 0x5DDF, 0x557D, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CB8, 0x638F, 0x63B0, 0x6BD0, 0x638F, 0x0000, 0x7BEF,
-  0x0000, 0x54BA, 0x5DBD, 0x5D1D, 0x5CFB, 0x7FFF, 0x0000, 0x0000, 0x0000, 0xCEBB, 0xDF3D, 0xCEBB, 0xD6FC, 0xC69B, 0xCE9B, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF1D, 0xCEDB, 0xBE39, 0x0000, 0x5D7D, 0x555D, 0x557E, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CB8, 0x638F, 0x6BD0, 0x63AF, 0x07FF, 0xFFFF, 0x0000,
-  0x557D, 0x559E, 0x557D, 0x555D, 0x557D, 0x555D, 0x557D, 0x453E, 0x9E3C, 0xD6FC, 0xCEBB, 0xD6FC, 0xADB7, 0x7C52, 0xC69B, 0xCEBB, 0xCEBB, 0xDF1D, 0xCEBB, 0xC6DB, 0x0000, 0xFD55, 0x0000, 0x557D, 0x5DBF, 0x557D, 0x557D, 0x555D, 0x557E, 0x5CF9, 0x6BD0, 0x638F, 0x0000, 0xFFFF, 0x0000, 0x0000,
-  0x555D, 0x5DBF, 0x557D, 0x557E, 0x559E, 0x5D9E, 0x559F, 0x6DFF, 0xCEFD, 0xCEBB, 0xD6DC, 0x9D36, 0x5B6F, 0xADB7, 0xD6FC, 0xCEBB, 0xDF3D, 0xCEBB, 0xC69A, 0x0000, 0xAD5F, 0x3BF7, 0x0000, 0x557D, 0x5DDF, 0x555D, 0x557D, 0x555D, 0x557E, 0x5D1A, 0x638F, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000,
-  0x555D, 0x5DBF, 0x557D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0xA63C, 0xD6DB, 0xCEDC, 0x9515, 0x5B4E, 0x9D56, 0xD6FC, 0xCEBB, 0xDF3D, 0xCEBB, 0xB65B, 0x0000, 0xAD55, 0x0000, 0x555F, 0x0000, 0x555D, 0x557D, 0x557D, 0x557D, 0x557D, 0x5DBF, 0x555D, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x555D, 0x5D9E, 0x5D9E, 0x557D, 0x4D5D, 0x6DBD, 0xCEBB, 0xD6DC, 0x9515, 0x5B4E, 0x9515, 0xD6DC, 0xCEBB, 0xDF3D, 0xCEDC, 0xCE79, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x001F, 0x0000, 0x34D9, 0x555D, 0x559E, 0x555D, 0x557D, 0x5D9F, 0x555D, 0x7BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFFF, 0x0000, 0x555D, 0x557E, 0x5DBF, 0x4D5E, 0xA65C, 0xDEFC, 0x9515, 0x5B4E, 0x94F5, 0xCEDC, 0xCEBB, 0xDEFC, 0xCEBB, 0xAD55, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x557D, 0x5DBF, 0x555D, 0x557D, 0x5D9E, 0x557D, 0x53FF, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7FFF, 0x0000, 0x4CFB, 0x557E, 0x659D, 0xCEDC, 0x9515, 0x5B4E, 0x9515, 0xD6DC, 0xD6DB, 0xCEFD, 0xA65C, 0x0000, 0x7BEF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x557D, 0x559E, 0x555D, 0x555D, 0x5D9E, 0x557D, 0x64DF, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x555F, 0x0000, 0x0000, 0xBEDD, 0xA577, 0x532E, 0x9515, 0xDEFC, 0xCEBB, 0xA63C, 0x6DFF, 0x4D3D, 0x0000, 0x7DF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x4D3E, 0x555D, 0x557E, 0x557D, 0x5D9E, 0x555D, 0x64DF, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x64D9, 0x0000, 0x8472, 0x7432, 0xA576, 0xCEDC, 0xA65C, 0x6DBD, 0x4D5D, 0x559F, 0x5D7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x557D, 0x5DBF, 0x557D, 0x557E, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6BD0, 0x5B6F, 0x8492, 0xC6DE, 0x659D, 0x4D5E, 0x555D, 0x557D, 0x5D9E, 0x557D, 0x52BF, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x64D9, 0x0000, 0x555D, 0x5DBF, 0x555D, 0x557E, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x632F, 0x73F1, 0x0000, 0x0000, 0x4D5D, 0x5DBF, 0x557D, 0x557D, 0x559E, 0x557D, 0x5CFF, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF, 0x0000, 0x555D, 0x557D, 0x557D, 0x557E, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BF5, 0xFFFF, 0x5DBD, 0x557D, 0x5D9E, 0x555D, 0x557E, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x7FFF, 0x555D, 0x5D9E, 0x557D, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x557D, 0x5D9F, 0x557D, 0x557D, 0x557D, 0x5D1D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x557D, 0x5DDF, 0x5DFF, 0x557D, 0x7BFF, 0xFFFF, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x555D, 0x5DBF, 0x5DBF, 0x557D, 0x555D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x07FF, 0x0000, 0x555D, 0x5DBF, 0x553D, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x03FF, 0x0000, 0x557D, 0x5DBF, 0x555D, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_AIRPLANE_36_SPAN_ROWS[] PROGMEM = {
+  0, 0, 16, 9, 36, 21, 61, 36, 102, 63, 136, 88, 168, 116, 206, 150,
+  222, 184, 253, 218, 275, 252, 298, 283, 323, 310, 347, 336, 369, 357, 391, 377,
+  410, 396, 431, 416, 457, 438, 482, 463, 515, 496, 549, 525, 586, 555, 626, 586,
+  658, 616, 698, 645, 730, 671, 763, 697, 801, 720, 835, 741, 864, 759, 901, 780,
+  934, 798, 962, 816, 993, 833, 1019, 846
 };
 
-const uint8_t SPRITE_AIRPLANE_36_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0E, 0x42, 0x6E, 0x87, 0x57, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x38, 0x9A, 0xE5, 0xFC, 0xFF, 0xFF, 0xFF, 0x57,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x26, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x82, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFE, 0x88,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x71, 0xF9, 0xBA, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x8C, 0xFF, 0xFE, 0xFB, 0xFE, 0xFE, 0xFF, 0xFD, 0xFF, 0x6F,
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x73, 0xFF, 0xFE, 0xFF, 0xBF, 0x13, 0x06, 0x05, 0x04, 0x05, 0x04, 0x00, 0x8C, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x43,
-  0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x05, 0x05, 0x07, 0x02, 0x72, 0xFF, 0xFD, 0xFD, 0xFD, 0xF7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xE5, 0x0E,
-  0x00, 0x1C, 0xB4, 0xF1, 0xF1, 0xF1, 0xF1, 0xEC, 0xD5, 0xD5, 0xD5, 0xCA, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xDA, 0x80, 0x80, 0x71, 0x63, 0x61, 0x8E, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x9D, 0x00,
-  0x00, 0xA3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFD, 0x34, 0x00,
-  0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFB, 0xFA, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFA, 0xFB, 0xFD, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x81, 0x00, 0x02,
-  0x00, 0x01, 0x6C, 0xCD, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x8C, 0x00, 0x02, 0x01,
-  0x00, 0x00, 0x00, 0x03, 0x23, 0x64, 0x9D, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x8C, 0x00, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x42, 0x83, 0xCB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x8C, 0x00, 0x02, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x03, 0x00, 0x00, 0x00, 0x03, 0x2C, 0x71, 0xB5, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x85, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x59, 0xC5, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x59, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x00, 0x1B, 0xD6, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x65, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xE4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x65, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x7E, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0F, 0xD0, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x7D, 0x1C, 0x0E, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0E, 0xBD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xD7, 0xF3, 0xBE, 0x0E, 0x00, 0x01, 0x00,
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x05, 0xBB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xDA, 0xC9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0x0F, 0x02, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x03, 0xA6, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xDF, 0x21, 0x5D, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0x26, 0x00, 0x02,
-  0x00, 0x0C, 0x0E, 0x0E, 0x08, 0x02, 0x00, 0x00, 0x00, 0xA4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD3, 0x20, 0x00, 0x28, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0x70, 0x01, 0x01, 0x00,
-  0x65, 0xEC, 0xF0, 0xF1, 0xDE, 0xCC, 0xB8, 0x99, 0xAE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD0, 0x1B, 0x00, 0x03, 0x00, 0xC1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x73, 0x00, 0x01, 0x00, 0x00,
-  0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBD, 0x11, 0x00, 0x03, 0x04, 0x00, 0x7D, 0xFF, 0xFB, 0xFF, 0xFE, 0xFE, 0xFC, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x70, 0xFF, 0xFC, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xBB, 0x0E, 0x00, 0x03, 0x00, 0x03, 0x00, 0x37, 0xFE, 0xFE, 0xFF, 0xFC, 0xFF, 0xBD, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x81, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xA5, 0x05, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x05, 0xD9, 0xFF, 0xFD, 0xFC, 0xFF, 0xC6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x47, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xA3, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x94, 0xFF, 0xFB, 0xFD, 0xFF, 0xD8, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x10, 0x8B, 0xF6, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAA, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4E, 0xFF, 0xFE, 0xFD, 0xFF, 0xD4, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x6D, 0xFB, 0xFA, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x98, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0xEB, 0xFF, 0xFC, 0xFF, 0xD7, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xAD, 0xFF, 0xFA, 0xFF, 0xEF, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x13, 0xBC, 0x74, 0x6C, 0xF9, 0xFE, 0xFE, 0xFD, 0xFF, 0xCC, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6A, 0xFF, 0xFB, 0xFF, 0xF1, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0A, 0x12, 0x00, 0x00, 0x8C, 0xFF, 0xFC, 0xFD, 0xFF, 0xDE, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2A, 0xFC, 0xFF, 0xFF, 0xF0, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xDB, 0xFE, 0xFB, 0xFF, 0xF1, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xCA, 0xFD, 0xFB, 0xF2, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x44, 0xFF, 0xFB, 0xFD, 0xF1, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5E, 0xFF, 0xFF, 0xBD, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0xF3, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x74, 0xA3, 0x29, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x74, 0xBA, 0x66, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_AIRPLANE_36_SPAN_OPS[] PROGMEM = {
+  0x0E, 0x81, 0x02, 0x01, 0x09, 0x80, 0x02, 0x01, 0x85, 0x0E, 0x42, 0x6E, 0x87, 0x57, 0x02, 0xC0, 0x0D, 0x80, 0x02, 0x01, 0x80, 0x01, 0x06, 0x81,
+  0x01, 0x02, 0x00, 0x83, 0x38, 0x9A, 0xE5, 0xFC, 0x42, 0x80, 0x57, 0xC0, 0x0C, 0x80, 0x02, 0x00, 0x81, 0x26, 0x09, 0x00, 0x80, 0x01, 0x04, 0x81,
+  0x01, 0x02, 0x00, 0x81, 0x82, 0xFD, 0x42, 0x83, 0xFD, 0xF7, 0xFE, 0x88, 0xC0, 0x02, 0x89, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x00, 0x83, 0x71, 0xF9, 0xBA, 0x0E, 0x00, 0x80, 0x01, 0x02, 0x81, 0x01, 0x02, 0x00, 0x80, 0x8C, 0x40, 0x83, 0xFE, 0xFB, 0xFE, 0xFE, 0x40,
+  0x80, 0xFD, 0x40, 0x80, 0x6F, 0xC0, 0x00, 0x81, 0x01, 0x01, 0x07, 0x80, 0x01, 0x00, 0x80, 0x73, 0x40, 0x80, 0xFE, 0x40, 0x86, 0xBF, 0x13, 0x06,
+  0x05, 0x04, 0x05, 0x04, 0x00, 0x80, 0x8C, 0x40, 0x81, 0xFB, 0xFE, 0x44, 0x81, 0xFD, 0x43, 0xC0, 0x02, 0x89, 0x0E, 0x0E, 0x0E, 0x0E, 0x0C, 0x05,
+  0x05, 0x07, 0x02, 0x72, 0x40, 0x84, 0xFD, 0xFD, 0xFD, 0xF7, 0x11, 0x04, 0x80, 0x8C, 0x40, 0x80, 0xFC, 0x44, 0x83, 0xFE, 0xFE, 0xE5, 0x0E, 0xC0,
+  0x00, 0x8A, 0x1C, 0xB4, 0xF1, 0xF1, 0xF1, 0xF1, 0xEC, 0xD5, 0xD5, 0xD5, 0xCA, 0x40, 0x82, 0xFE, 0xFE, 0xFE, 0x40, 0x86, 0xDA, 0x80, 0x80, 0x71,
+  0x63, 0x61, 0x8E, 0x40, 0x81, 0xFD, 0xFE, 0x44, 0x80, 0xFB, 0x40, 0x80, 0x9D, 0xC0, 0x00, 0x80, 0xA3, 0x40, 0x80, 0xFD, 0x53, 0x80, 0xFD, 0x45,
+  0x83, 0xFE, 0xFC, 0xFD, 0x34, 0xC0, 0x00, 0x80, 0x80, 0x42, 0x86, 0xFB, 0xFA, 0xFC, 0xFD, 0xFD, 0xFD, 0xFD, 0x44, 0x86, 0xFE, 0xFA, 0xFA, 0xFB,
+  0xFD, 0xFD, 0xFC, 0x46, 0x80, 0xFB, 0x40, 0x80, 0x81, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x83, 0x01, 0x6C, 0xCD, 0xF6, 0x43, 0x82, 0xFB, 0xFD, 0xFE,
+  0x51, 0x80, 0xFC, 0x40, 0x80, 0x8C, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x02, 0x84, 0x03, 0x23, 0x64, 0x9D, 0xE1, 0x43, 0x82, 0xFC, 0xFC, 0xFE, 0x4D,
+  0x80, 0xFD, 0x40, 0x80, 0x8C, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x03, 0x84, 0x0C, 0x42, 0x83, 0xCB, 0xFA, 0x42, 0x81, 0xFD, 0xFD,
+  0x4A, 0x80, 0xFD, 0x40, 0x80, 0x8C, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x02, 0x83, 0x01, 0x02, 0x04, 0x03, 0x02, 0x84, 0x03, 0x2C, 0x71, 0xB5, 0xF2,
+  0x4B, 0x80, 0xFD, 0x40, 0x80, 0x85, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x06, 0x82, 0x01, 0x03, 0x04, 0x03, 0x82, 0x1D, 0x59, 0xC5, 0x40, 0x80, 0xFD,
+  0x47, 0x80, 0xFC, 0x40, 0x82, 0x59, 0x01, 0x04, 0xC0, 0x09, 0x83, 0x01, 0x02, 0x04, 0x04, 0x00, 0x83, 0x1B, 0xD6, 0xFE, 0xFE, 0x47, 0x80, 0xFC,
+  0x40, 0x80, 0x65, 0x00, 0x80, 0x04, 0xC0, 0x0B, 0x80, 0x03, 0x00, 0x81, 0x1D, 0xE4, 0x40, 0x80, 0xFD, 0x48, 0x80, 0xFC, 0x40, 0x82, 0x65, 0x01,
+  0x05, 0xC0, 0x0A, 0x80, 0x02, 0x00, 0x81, 0x1C, 0xD3, 0x40, 0x80, 0xFC, 0x49, 0x80, 0xFA, 0x40, 0x80, 0x7E, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x09,
+  0x80, 0x02, 0x00, 0x81, 0x0F, 0xD0, 0x40, 0x80, 0xFC, 0x44, 0x81, 0xFD, 0xFD, 0x43, 0x80, 0xFA, 0x40, 0x82, 0x7D, 0x1C, 0x0E, 0x00, 0x80, 0x01,
+  0xC0, 0x08, 0x83, 0x02, 0x01, 0x0E, 0xBD, 0x40, 0x80, 0xFB, 0x44, 0x80, 0xFD, 0x45, 0x80, 0xFE, 0x40, 0x83, 0xD7, 0xF3, 0xBE, 0x0E, 0x00, 0x80,
+  0x01, 0xC0, 0x00, 0x84, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0x05, 0xBB, 0x40, 0x80, 0xFB, 0x44, 0x80, 0xFC, 0x40, 0x81, 0xDA,
+  0xC9, 0x40, 0x80, 0xFD, 0x46, 0x83, 0xBB, 0x0F, 0x02, 0x01, 0xC0, 0x80, 0x01, 0x05, 0x83, 0x04, 0x03, 0x03, 0xA6, 0x40, 0x80, 0xFB, 0x44, 0x80,
+  0xFC, 0x40, 0x82, 0xDF, 0x21, 0x5D, 0x40, 0x80, 0xFC, 0x43, 0x82, 0xFE, 0xFD, 0xFC, 0x40, 0x80, 0x26, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x84, 0x0C,
+  0x0E, 0x0E, 0x08, 0x02, 0x02, 0x80, 0xA4, 0x40, 0x80, 0xFB, 0x44, 0x80, 0xFB, 0x40, 0x81, 0xD3, 0x20, 0x00, 0x81, 0x28, 0xF9, 0x40, 0x80, 0xFE,
+  0x42, 0x81, 0xFE, 0xFD, 0x40, 0x82, 0x70, 0x01, 0x01, 0xC0, 0x88, 0x65, 0xEC, 0xF0, 0xF1, 0xDE, 0xCC, 0xB8, 0x99, 0xAE, 0x40, 0x80, 0xFD, 0x44,
+  0x80, 0xFB, 0x40, 0x81, 0xD0, 0x1B, 0x00, 0x80, 0x03, 0x00, 0x80, 0xC1, 0x40, 0x80, 0xFC, 0x41, 0x81, 0xFE, 0xFE, 0x40, 0x80, 0x73, 0x00, 0x80,
+  0x01, 0xC0, 0x80, 0xC7, 0x47, 0x80, 0xFD, 0x44, 0x80, 0xFB, 0x40, 0x81, 0xBD, 0x11, 0x00, 0x81, 0x03, 0x04, 0x00, 0x80, 0x7D, 0x40, 0x80, 0xFB,
+  0x40, 0x83, 0xFE, 0xFE, 0xFC, 0x73, 0x00, 0x80, 0x03, 0xC0, 0x80, 0x70, 0x40, 0x86, 0xFC, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xFC, 0x44, 0x80, 0xFB,
+  0x40, 0x81, 0xBB, 0x0E, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x82, 0x37, 0xFE, 0xFE, 0x40, 0x80, 0xFC, 0x40, 0x80, 0xBD, 0x00, 0x81, 0x02,
+  0x01, 0xC0, 0x00, 0x80, 0x81, 0x41, 0x80, 0xFC, 0x47, 0x80, 0xFD, 0x40, 0x81, 0xA5, 0x05, 0x00, 0x80, 0x02, 0x01, 0x80, 0x01, 0x00, 0x81, 0x05,
+  0xD9, 0x40, 0x81, 0xFD, 0xFC, 0x40, 0x81, 0xC6, 0x04, 0xC0, 0x80, 0x01, 0x00, 0x81, 0x47, 0xD6, 0x47, 0x80, 0xFD, 0x40, 0x83, 0xA3, 0x03, 0x01,
+  0x02, 0x03, 0x80, 0x03, 0x00, 0x80, 0x94, 0x40, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xD8, 0x06, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x84,
+  0x10, 0x8B, 0xF6, 0xFE, 0xFE, 0x42, 0x80, 0xFC, 0x40, 0x80, 0xAA, 0x00, 0x81, 0x02, 0x02, 0x04, 0x80, 0x04, 0x00, 0x80, 0x4E, 0x40, 0x81, 0xFE,
+  0xFD, 0x40, 0x81, 0xD4, 0x05, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x01, 0x82, 0x6D, 0xFB, 0xFA, 0x42, 0x80, 0xFB, 0x40, 0x82, 0x98, 0x01,
+  0x04, 0x05, 0x80, 0x01, 0x00, 0x81, 0x11, 0xEB, 0x40, 0x80, 0xFC, 0x40, 0x81, 0xD7, 0x05, 0x00, 0x80, 0x01, 0xC0, 0x02, 0x80, 0x05, 0x00, 0x80,
+  0x75, 0x44, 0x80, 0xFC, 0x40, 0x80, 0xB9, 0x08, 0x80, 0x02, 0x00, 0x80, 0xAD, 0x40, 0x80, 0xFA, 0x40, 0x81, 0xEF, 0x0E, 0x00, 0x80, 0x01, 0xC0,
+  0x01, 0x80, 0x01, 0x00, 0x87, 0x13, 0xBC, 0x74, 0x6C, 0xF9, 0xFE, 0xFE, 0xFD, 0x40, 0x81, 0xCC, 0x03, 0x00, 0x80, 0x01, 0x05, 0x80, 0x05, 0x00,
+  0x80, 0x6A, 0x40, 0x80, 0xFB, 0x40, 0x81, 0xF1, 0x0E, 0x00, 0x80, 0x01, 0xC0, 0x03, 0x81, 0x0A, 0x12, 0x01, 0x80, 0x8C, 0x40, 0x81, 0xFC, 0xFD,
+  0x40, 0x81, 0xDE, 0x08, 0x00, 0x80, 0x01, 0x05, 0x80, 0x02, 0x00, 0x81, 0x2A, 0xFC, 0x41, 0x81, 0xF0, 0x0E, 0x00, 0x80, 0x01, 0xC0, 0x05, 0x85,
+  0x06, 0x03, 0x0E, 0xDB, 0xFE, 0xFB, 0x40, 0x81, 0xF1, 0x0E, 0x00, 0x80, 0x01, 0x06, 0x86, 0x01, 0x02, 0xCA, 0xFD, 0xFB, 0xF2, 0x0E, 0x00, 0x80,
+  0x01, 0xC0, 0x04, 0x80, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x44, 0x40, 0x83, 0xFB, 0xFD, 0xF1, 0x0E, 0x00, 0x80, 0x01, 0x06, 0x80, 0x03, 0x00,
+  0x80, 0x5E, 0x41, 0x83, 0xBD, 0x02, 0x01, 0x01, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x80, 0x80, 0x41, 0x81, 0xF3, 0x0C, 0x00, 0x80, 0x01, 0x06, 0x81,
+  0x01, 0x01, 0x00, 0x82, 0x74, 0xA3, 0x29, 0x00, 0x80, 0x02, 0xC0, 0x07, 0x81, 0x01, 0x02, 0x00, 0x84, 0x74, 0xBA, 0x66, 0x01, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_AIRPLANE_36_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0861, 0x31A7, 0x52EB, 0x6B8E, 0x4229, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x7C10, 0xB618,
+  0xCEBB, 0xD6FC, 0xDF3D, 0xD6FC, 0x4229, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x634D, 0xCEDC, 0xD71D, 0xCEBB, 0xD6DC,
+  0xCEBB, 0xC67A, 0xDF3D, 0x6B8E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2986, 0x63AF,
+  0x428A, 0x0020, 0x0000, 0x0000, 0x0000, 0x73AF, 0xDF3D, 0xCE9B, 0x6BF0, 0x638F, 0x8CB3, 0xC69B, 0xCEBB, 0xD6FC, 0x52EB, 0x0000,
+  0x0000, 0x0000, 0x2986, 0x6BD0, 0x63B0, 0x6BF1, 0x4AAC, 0x0041, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x73AF, 0xDF1D, 0xC67A,
+  0xCEBB, 0xBE39, 0x9515, 0x5B4E, 0x8CB4, 0xD6DC, 0xCEBB, 0x31A6, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0020, 0x0020,
+  0x0000, 0x2986, 0x6BD0, 0x638F, 0x638F, 0x6B8F, 0x5B6D, 0x0000, 0x73AF, 0xDF1D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xD71C, 0x9515,
+  0x638F, 0xCEBB, 0xB618, 0x0861, 0x08A3, 0x3BD4, 0x4CFB, 0x4D1B, 0x4CFB, 0x4D1B, 0x4D1B, 0x4498, 0x4498, 0x4498, 0x3C16, 0x5CFA,
+  0x5CFA, 0x5CD9, 0x5CB8, 0x5CD8, 0x4C15, 0x2AAE, 0x2AAF, 0x224C, 0x1A0A, 0x19EA, 0x638F, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEDC, 0xBE39, 0x6BD0, 0xD71D, 0x7C30, 0x3352, 0x5DFF, 0x557D, 0x557E, 0x557E, 0x557E, 0x557E, 0x5D9E, 0x5D9E, 0x5D9E,
+  0x5D9E, 0x557E, 0x557E, 0x557E, 0x559E, 0x557E, 0x559F, 0x5DDF, 0x5DDF, 0x5DBF, 0x559F, 0x8E3E, 0xD71D, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0x2965, 0x2AAE, 0x5DDF, 0x559E, 0x557D, 0x4D3C, 0x4D3C, 0x557D, 0x555D,
+  0x557D, 0x557D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x555D, 0x4D3C, 0x4D3C, 0x451C, 0x85FC, 0xD6DB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xC67A, 0xDF3D, 0x634D, 0x0000, 0x0000, 0x224C, 0x4478, 0x4D3D, 0x5DBF, 0x5DBF,
+  0x559E, 0x557D, 0x4D1C, 0x555D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0x7DDD, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF1D, 0x73AF, 0x0000, 0x0000, 0x0000, 0x08A3, 0x222B, 0x3352,
+  0x44B9, 0x557E, 0x5DBF, 0x5D9E, 0x557D, 0x557D, 0x557D, 0x555D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0x7DDD, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xDF1D, 0x73AF, 0x0000, 0x0000, 0x0000, 0x0041, 0x1147, 0x2AAE, 0x3C36,
+  0x4D3C, 0x5DBF, 0x5DBF, 0x557E, 0x555D, 0x557D, 0x4D5D, 0x75BD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xD71C, 0x73AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0905, 0x224C, 0x3BD5, 0x4CFB, 0x5DBF,
+  0x559F, 0x75BD, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6FC, 0x636E, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x08A3, 0x19CA, 0x5476, 0xC6DC, 0xD6BB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xD6DB, 0x8E3E, 0x11AA, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x10A2, 0xB5D7, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x85FC, 0x559F, 0x222B, 0x0020, 0x0000, 0x18C3, 0xB618, 0xD71D, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x7DDD, 0x4D5D, 0x5DBF, 0x222B, 0x0000, 0x0020, 0x0000, 0x18C3, 0xA575, 0xD71C,
+  0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0x7DDD, 0x4D5D, 0x4D3C, 0x5DDF, 0x2AAE, 0x0000, 0x0000,
+  0x0000, 0x0861, 0xA575, 0xDF1D, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD6BB, 0xCEBB, 0x75BD, 0x4D5D, 0x557D,
+  0x4D3C, 0x5DDF, 0x2AAF, 0x0861, 0x0021, 0x0000, 0x0000, 0x0000, 0x0861, 0x94F4, 0xDF1D, 0xC67A, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xCEBB, 0xCEBB, 0xD6FC, 0xC6DC, 0x75BD, 0x4D5D, 0x557D, 0x557D, 0x555D, 0x559F, 0x4BF4, 0x5B4D, 0x4AAC, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8CD3, 0xDF3D, 0xC67A, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB,
+  0xD71D, 0xADB6, 0x5476, 0x559F, 0x557D, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CD8, 0x638F, 0x6BF1, 0x428A, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0000, 0x0000, 0x8451, 0xDF1D, 0xC67A, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xD71C, 0xB5F8, 0x18E3,
+  0x19EA, 0x5DDF, 0x557D, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CB8, 0x638F, 0x63B0, 0x6BD0, 0x0882, 0x0000, 0x0041, 0x0041, 0x0041,
+  0x0020, 0x0000, 0x8451, 0xDF3D, 0xC67A, 0xD6FC, 0xC69B, 0xCE9B, 0xCEBB, 0xCEBB, 0xC67A, 0xDF1D, 0xA575, 0x10C3, 0x08C4, 0x4D1C,
+  0x557E, 0x557D, 0x557D, 0x555D, 0x559E, 0x5CB8, 0x638F, 0x6BD0, 0x2986, 0x0000, 0x0000, 0x222B, 0x4D3C, 0x4D1B, 0x4CFB, 0x44B9,
+  0x4457, 0x3BD4, 0x2311, 0x6C33, 0xD6FC, 0xCEBB, 0xD6FC, 0xADB7, 0x7C52, 0xC69B, 0xCEBB, 0xC67A, 0xDF1D, 0xA575, 0x10A2, 0x0000,
+  0x3C15, 0x5DBF, 0x557D, 0x557D, 0x555D, 0x557E, 0x5CF9, 0x6BD0, 0x2986, 0x0000, 0x3C16, 0x5DBF, 0x557D, 0x557E, 0x559E, 0x5D9E,
+  0x559F, 0x6DFF, 0xCEFD, 0xCEBB, 0xD6DC, 0x9D36, 0x5B6F, 0xADB7, 0xD6FC, 0xC67A, 0xDF3D, 0x94F4, 0x0861, 0x0000, 0x0000, 0x2AAE,
+  0x5DDF, 0x4D1C, 0x557D, 0x555D, 0x557E, 0x5D1A, 0x2986, 0x0000, 0x224C, 0x5DBF, 0x557D, 0x557D, 0x557D, 0x557D, 0x4D5D, 0x9DFB,
+  0xD6DB, 0xCEDC, 0x9515, 0x5B4E, 0x9D56, 0xD6FC, 0xC67A, 0xDF3D, 0x8CD3, 0x0861, 0x0000, 0x0000, 0x1126, 0x557D, 0x557D, 0x557D,
+  0x557D, 0x5DBF, 0x3BF5, 0x0000, 0x0000, 0x2AAE, 0x5D9E, 0x5D9E, 0x557D, 0x4D5D, 0x6DBD, 0xCEBB, 0xD6DC, 0x9515, 0x5B4E, 0x9515,
+  0xD6DC, 0xCEBB, 0xDF3D, 0x8472, 0x0020, 0x0000, 0x0000, 0x0020, 0x4478, 0x559E, 0x555D, 0x557D, 0x5D9F, 0x3C16, 0x0000, 0x0000,
+  0x1168, 0x4499, 0x5DBF, 0x4D5E, 0xA65C, 0xDEFC, 0x9515, 0x5B4E, 0x94F5, 0xCEDC, 0xCEBB, 0xDEFC, 0x7C30, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2B31, 0x5DBF, 0x4D1C, 0x557D, 0x5D9E, 0x4498, 0x0000, 0x0000, 0x0000, 0x0041, 0x2ACF, 0x5D5C, 0xCEDC, 0x9515, 0x5B4E,
+  0x9515, 0xD6DC, 0xD6DB, 0xCEFD, 0x6C12, 0x0000, 0x0000, 0x0000, 0x19A9, 0x559E, 0x555D, 0x555D, 0x5D9E, 0x4498, 0x0020, 0x0000,
+  0x0000, 0x52EC, 0x9D36, 0x4B0D, 0x9515, 0xDEFC, 0xCEBB, 0x9DFB, 0x6DFF, 0x2B11, 0x0000, 0x0020, 0x0000, 0x0041, 0x4CDA, 0x557E,
+  0x557D, 0x5D9E, 0x4478, 0x0020, 0x0000, 0x0020, 0x3A08, 0x7432, 0xA576, 0xCEDC, 0xA65C, 0x6DBD, 0x4D5D, 0x559F, 0x3BD4, 0x0000,
+  0x33B3, 0x5DBF, 0x4D3C, 0x557E, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x0021, 0x428B, 0x3A08, 0x52ED, 0x5D5C, 0x4D5E, 0x555D, 0x557D,
+  0x5D9E, 0x4457, 0x0000, 0x0000, 0x0020, 0x222B, 0x5DBF, 0x4D1C, 0x557E, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x0021, 0x2AF0, 0x5DBF,
+  0x557D, 0x557D, 0x559E, 0x44B9, 0x0020, 0x0000, 0x0000, 0x08C4, 0x557D, 0x557D, 0x557E, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x0000,
+  0x0041, 0x4498, 0x5D9E, 0x4D1C, 0x557E, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x0000, 0x3C16, 0x5D9E, 0x4D3C, 0x4D1B, 0x0041, 0x0000,
+  0x0000, 0x0000, 0x1188, 0x5D9F, 0x4D3C, 0x557D, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x1A0A, 0x5DDF, 0x5DFF, 0x3C15, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x2AAE, 0x5DBF, 0x5DBF, 0x4D1B, 0x0041, 0x0000, 0x0000, 0x0000, 0x226D, 0x3393, 0x08C4, 0x0000, 0x0000, 0x0000,
+  0x228D, 0x3C16, 0x222B, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_AIRPLANE_36_SPANS = {
+  SPRITE_AIRPLANE_36_SPAN_ROWS, SPRITE_AIRPLANE_36_SPAN_OPS, SPRITE_AIRPLANE_36_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_AIRPLANE_36_ASSET = {
   SPRITE_AIRPLANE_36_WIDTH, SPRITE_AIRPLANE_36_HEIGHT,
-  SPRITE_AIRPLANE_36_ALPHA, SPRITE_AIRPLANE_36_RGB565
+  nullptr, nullptr, &SPRITE_AIRPLANE_36_SPANS
 };
 
 #endif // SPRITE_AIRPLANE_36_INCLUDED
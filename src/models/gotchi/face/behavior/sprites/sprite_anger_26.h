@@ -5,74 +5,87 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from anger_26.png (26x26)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from anger_26.png (26x26) — RGBA multi-couleur, encodé en spans
+// 404/676 pixels visibles, 1566 bytes flash (flat : 2028). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_ANGER_26_WIDTH = 26;
 constexpr uint16_t SPRITE_ANGER_26_HEIGHT = 26;
 
-const uint16_t SPRITE_ANGER_26_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0C6, 0xC086, 0xF800, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0xF800, 0xF800, 0xF800, 0xB8C5, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xF80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x7800, 0x0000, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8E6, 0xF800, 0xA80A, 0x0000, 0x0000, 0xF800, 0xB807, 0x0000, 0xB0E5, 0xA805, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xB8C6, 0xB8C5, 0x0000, 0xC806, 0x0000, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0xB807, 0xB807, 0xB807, 0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xB8C6, 0x0000, 0xF80F, 0x0000, 0x0000,
-  0x0000, 0xF800, 0xB807, 0xB8C6, 0xC8C6, 0xB8C6, 0xC986, 0xFAAA, 0xA800, 0x9806, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0x0000, 0x0000, 0xC0E7, 0xC0C6, 0xC0C6, 0xC0C6, 0xD0C6, 0xB8C6, 0x0000, 0xA80A, 0x0000,
-  0x0000, 0xF800, 0xA8E7, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C6, 0x0000, 0x9806, 0x0000, 0xB8A6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8E7, 0x7800, 0xF800, 0x0000,
-  0x0000, 0xF800, 0x0000, 0xB8C5, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xA805, 0x0000, 0xB8C5, 0xC0C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0x0000, 0xA800, 0x7800, 0x0000,
-  0x0000, 0x0000, 0xF80A, 0x0000, 0xB8A5, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0x7800, 0x7800, 0x0000, 0xB0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0x0000, 0xB807, 0xB807, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7807, 0x0000, 0xB8A6, 0xC8C6, 0xB8C6, 0xC0C6, 0x0000, 0x7800, 0xF80F, 0x0000, 0x0000, 0xC0E6, 0xB8C6, 0xB8A5, 0xB086, 0x0000, 0x0000, 0xA945, 0x0000, 0x0000, 0xB8E6, 0xC0C5, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xB807, 0xF800, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0xB807, 0x0000, 0xA8A5, 0xC0C6, 0xC0C6, 0xB8C6, 0xF800,
-  0x0000, 0x0000, 0x0000, 0xA80A, 0xF800, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C5, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x7800, 0xA80A, 0xA80A, 0xF800, 0xA80A, 0x0000, 0xB8C5, 0xC0C6, 0xC8C6, 0xC0C6, 0xC8C6, 0xB8C6,
-  0x0000, 0x0000, 0x7800, 0xC806, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8A5, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB0E5,
-  0x0000, 0xB807, 0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xC0E7, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8A6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB865, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xC806, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0x0000, 0xB807, 0x0000,
-  0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF80F, 0x0000, 0xB8C5, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xC806, 0xF800, 0x0000, 0x0000,
-  0xB8E6, 0xB8C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xA80A, 0x7800, 0xB807, 0xB807, 0xF80A, 0xF800, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8A6, 0xA80A, 0xB807, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8E3, 0x0000, 0xC806, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xA80A, 0x0000, 0xC0A6, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000,
-  0xF800, 0xB126, 0xB0A5, 0x0000, 0x0000, 0xA945, 0x0000, 0x0000, 0xC0C6, 0xB8C6, 0xC0C6, 0xB8C5, 0xB8E5, 0x0000, 0xF800, 0xF800, 0x0000, 0xB8A5, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8A5, 0xF800, 0xF800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x9806, 0xF800, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xF80F, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8C5, 0x0000, 0xF80A, 0x0000, 0x0000,
-  0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xC8C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC8C6, 0xB8C6, 0x0000, 0x9806, 0xF800, 0xC0C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0xA800, 0x0000,
-  0x0000, 0xF800, 0x7800, 0xB8A5, 0xC0C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C5, 0xB8C6, 0xC0C6, 0xC0C6, 0xC8C6, 0xB8C6, 0x0000, 0xA945, 0x0000, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8E5, 0xF800, 0x7800,
-  0x0000, 0xF800, 0x0000, 0xB8C5, 0xC0C6, 0xC8C6, 0xC0C6, 0xC0C6, 0x0000, 0x0000, 0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8E5, 0xF800, 0xC806, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xA805, 0x7800, 0x0000,
-  0x0000, 0x0000, 0xA80A, 0x0000, 0xB8C6, 0xC8C6, 0xB8A6, 0x0000, 0xA800, 0xB807, 0xA800, 0xD00A, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0x0000, 0x7807, 0xF800, 0xB807, 0xB8C5, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x6006, 0x0000, 0xF80A, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80A, 0xB129, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8E6, 0xF800, 0xF800, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD145, 0xB8A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_ANGER_26_SPAN_ROWS[] PROGMEM = {
+  0, 0, 11, 6, 28, 16, 55, 31, 82, 45, 110, 65, 139, 88, 166, 107,
+  196, 124, 224, 138, 251, 154, 278, 172, 304, 187, 330, 203, 356, 218, 382, 233,
+  409, 252, 436, 265, 464, 283, 491, 300, 515, 320, 545, 343, 573, 361, 600, 377,
+  625, 389, 645, 400
 };
 
-const uint8_t SPRITE_ANGER_26_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x1A, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x1C, 0xAD, 0xFD, 0x8D, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x01, 0x13, 0xEA, 0xFF, 0xF5, 0x23, 0x01, 0x03, 0x00, 0x00, 0x01, 0x04, 0x00, 0x1B, 0x06, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4E, 0x1C, 0x00, 0x05, 0x00, 0x5F, 0xFF, 0xFF, 0xB4, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x3D, 0xE8, 0x90, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x01, 0x04, 0x7C, 0xFF, 0xBE, 0x05, 0x03, 0x03, 0x05, 0xC7, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x09, 0x76, 0xF7, 0xFF, 0xFF, 0x4F, 0x00, 0x03, 0x00,
-  0x01, 0x01, 0x09, 0xD2, 0xFF, 0xFF, 0x8D, 0x00, 0x05, 0x00, 0x2C, 0xF3, 0xFE, 0xFF, 0xB4, 0x69, 0x82, 0xD4, 0xFF, 0xFF, 0xFF, 0x96, 0x12, 0x02, 0x01, 0x00,
-  0x00, 0x02, 0x00, 0x1C, 0xE6, 0xFD, 0xFF, 0x3C, 0x00, 0x06, 0x00, 0x47, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0x64, 0x00, 0x00, 0x03, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x4C, 0xFE, 0xFF, 0xBD, 0x00, 0x02, 0x04, 0x00, 0x35, 0xB9, 0xF2, 0xFF, 0xFC, 0xE2, 0x91, 0x1F, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0xB5, 0xFF, 0xF7, 0x25, 0x00, 0x02, 0x02, 0x00, 0x00, 0x23, 0x3F, 0x36, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2C, 0x26, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x01, 0x58, 0xFF, 0xFF, 0x58, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x16, 0x89, 0xF9, 0xBA, 0x01,
-  0x00, 0x00, 0x00, 0x03, 0x02, 0x3E, 0xFF, 0xFE, 0x65, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x03, 0x00, 0x51, 0xE1, 0xFF, 0xFF, 0xFF, 0x44,
-  0x00, 0x00, 0x02, 0x05, 0x00, 0x94, 0xFE, 0xFF, 0x41, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x6A, 0xFF, 0xFF, 0xFF, 0xDA, 0x65, 0x11,
-  0x01, 0x04, 0x00, 0x00, 0x6C, 0xFC, 0xFF, 0xD9, 0x09, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4C, 0xFF, 0xFD, 0xFE, 0x8A, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x1E, 0xA0, 0xFF, 0xFE, 0xFF, 0x49, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0xD3, 0xFE, 0xFB, 0x5C, 0x00, 0x00, 0x04, 0x00,
-  0x13, 0x7F, 0xED, 0xFF, 0xFF, 0xFC, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0xFC, 0xFF, 0x9B, 0x00, 0x05, 0x01, 0x00, 0x00,
-  0x24, 0xFD, 0xFF, 0xFF, 0xCF, 0x3E, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x45, 0xFF, 0xFF, 0x61, 0x03, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x83, 0xE4, 0x6D, 0x08, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x36, 0xFC, 0xFF, 0x83, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x0E, 0x17, 0x00, 0x00, 0x06, 0x00, 0x00, 0x25, 0x58, 0x67, 0x50, 0x12, 0x00, 0x01, 0x01, 0x00, 0x0B, 0xE1, 0xFE, 0xDE, 0x0B, 0x02, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x33, 0xAF, 0xF4, 0xFF, 0xFF, 0xFF, 0xE4, 0x6B, 0x00, 0x02, 0x04, 0x00, 0x89, 0xFF, 0xFF, 0x86, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x00, 0x00, 0x7A, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x05, 0x01, 0x15, 0xE7, 0xFE, 0xFD, 0x4E, 0x00, 0x03, 0x00,
-  0x00, 0x01, 0x02, 0x17, 0xAB, 0xFF, 0xFF, 0xFF, 0xBC, 0x5E, 0x3B, 0x7C, 0xF5, 0xFC, 0xFF, 0x5F, 0x00, 0x06, 0x00, 0x51, 0xFF, 0xFF, 0xF7, 0x1B, 0x01, 0x02,
-  0x00, 0x02, 0x00, 0x2E, 0xFC, 0xFF, 0xEE, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x48, 0xF9, 0xFD, 0xED, 0x1B, 0x01, 0x05, 0x00, 0x84, 0xF9, 0x65, 0x06, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x52, 0xCF, 0x2C, 0x00, 0x03, 0x04, 0x03, 0x06, 0x00, 0x7B, 0xFF, 0xFF, 0x95, 0x00, 0x04, 0x01, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xD6, 0xFF, 0xFF, 0x2E, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x58, 0xF1, 0x8F, 0x1A, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_ANGER_26_SPAN_OPS[] PROGMEM = {
+  0x09, 0x83, 0x44, 0x1A, 0x01, 0x02, 0x05, 0x81, 0x02, 0x01, 0xC0, 0x03, 0x87, 0x03, 0x01, 0x01, 0x01, 0x1C, 0xAD, 0xFD, 0x8D, 0x00, 0x80, 0x03,
+  0x04, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x02, 0x01, 0x83, 0x02, 0x01, 0x13, 0xEA, 0x40, 0x83, 0xF5, 0x23, 0x01, 0x03, 0x01, 0x81, 0x01, 0x04, 0x00,
+  0x81, 0x1B, 0x06, 0x00, 0x80, 0x01, 0xC0, 0x03, 0x81, 0x4E, 0x1C, 0x00, 0x80, 0x05, 0x00, 0x80, 0x5F, 0x41, 0x80, 0xB4, 0x00, 0x82, 0x04, 0x04,
+  0x04, 0x01, 0x82, 0x3D, 0xE8, 0x90, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x82, 0x01, 0x04, 0x7C, 0x40, 0x85, 0xBE, 0x05, 0x03, 0x03, 0x05, 0xC7, 0x41,
+  0x80, 0x81, 0x02, 0x82, 0x09, 0x76, 0xF7, 0x41, 0x80, 0x4F, 0x00, 0x80, 0x03, 0xC0, 0x83, 0x01, 0x01, 0x09, 0xD2, 0x41, 0x80, 0x8D, 0x00, 0x80,
+  0x05, 0x00, 0x82, 0x2C, 0xF3, 0xFE, 0x40, 0x83, 0xB4, 0x69, 0x82, 0xD4, 0x42, 0x83, 0x96, 0x12, 0x02, 0x01, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x82,
+  0x1C, 0xE6, 0xFD, 0x40, 0x80, 0x3C, 0x00, 0x80, 0x06, 0x00, 0x81, 0x47, 0xF4, 0x45, 0x81, 0xED, 0x64, 0x01, 0x81, 0x03, 0x02, 0xC0, 0x01, 0x80,
+  0x03, 0x00, 0x81, 0x4C, 0xFE, 0x40, 0x80, 0xBD, 0x00, 0x81, 0x02, 0x04, 0x00, 0x82, 0x35, 0xB9, 0xF2, 0x40, 0x83, 0xFC, 0xE2, 0x91, 0x1F, 0x00,
+  0x81, 0x04, 0x04, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0xB5, 0x40, 0x81, 0xF7, 0x25, 0x00, 0x81, 0x02, 0x02, 0x01, 0x83, 0x23, 0x3F, 0x36, 0x0E,
+  0x01, 0x80, 0x06, 0x01, 0x81, 0x2C, 0x26, 0xC0, 0x02, 0x82, 0x04, 0x01, 0x58, 0x41, 0x80, 0x58, 0x00, 0x80, 0x04, 0x00, 0x81, 0x02, 0x01, 0x03,
+  0x81, 0x03, 0x04, 0x00, 0x84, 0x16, 0x89, 0xF9, 0xBA, 0x01, 0xC0, 0x02, 0x82, 0x03, 0x02, 0x3E, 0x40, 0x81, 0xFE, 0x65, 0x00, 0x80, 0x04, 0x02,
+  0x84, 0x02, 0x03, 0x03, 0x01, 0x03, 0x00, 0x81, 0x51, 0xE1, 0x42, 0x80, 0x44, 0xC0, 0x01, 0x81, 0x02, 0x05, 0x00, 0x81, 0x94, 0xFE, 0x40, 0x80,
+  0x41, 0x00, 0x80, 0x03, 0x05, 0x80, 0x03, 0x00, 0x80, 0x6A, 0x42, 0x82, 0xDA, 0x65, 0x11, 0xC0, 0x81, 0x01, 0x04, 0x01, 0x81, 0x6C, 0xFC, 0x40,
+  0x83, 0xD9, 0x09, 0x01, 0x01, 0x04, 0x80, 0x03, 0x00, 0x80, 0x4C, 0x40, 0x83, 0xFD, 0xFE, 0x8A, 0x10, 0xC0, 0x01, 0x81, 0x1E, 0xA0, 0x40, 0x80,
+  0xFE, 0x40, 0x80, 0x49, 0x00, 0x80, 0x03, 0x04, 0x86, 0x01, 0x01, 0x05, 0xD3, 0xFE, 0xFB, 0x5C, 0x01, 0x80, 0x04, 0xC0, 0x82, 0x13, 0x7F, 0xED,
+  0x41, 0x81, 0xFC, 0x64, 0x00, 0x80, 0x03, 0x05, 0x80, 0x02, 0x00, 0x81, 0x30, 0xFC, 0x40, 0x80, 0x9B, 0x00, 0x81, 0x05, 0x01, 0xC0, 0x81, 0x24,
+  0xFD, 0x41, 0x81, 0xCF, 0x3E, 0x00, 0x85, 0x03, 0x02, 0x04, 0x04, 0x03, 0x01, 0x01, 0x80, 0x03, 0x00, 0x80, 0x45, 0x41, 0x82, 0x61, 0x03, 0x04,
+  0xC0, 0x00, 0x83, 0x83, 0xE4, 0x6D, 0x08, 0x00, 0x81, 0x05, 0x02, 0x04, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x81, 0x36, 0xFC, 0x40, 0x80, 0x83,
+  0x00, 0x80, 0x04, 0xC0, 0x82, 0x01, 0x0E, 0x17, 0x01, 0x80, 0x06, 0x01, 0x84, 0x25, 0x58, 0x67, 0x50, 0x12, 0x00, 0x81, 0x01, 0x01, 0x00, 0x86,
+  0x0B, 0xE1, 0xFE, 0xDE, 0x0B, 0x02, 0x01, 0xC0, 0x02, 0x81, 0x05, 0x02, 0x00, 0x82, 0x33, 0xAF, 0xF4, 0x42, 0x81, 0xE4, 0x6B, 0x00, 0x81, 0x02,
+  0x04, 0x00, 0x80, 0x89, 0x41, 0x80, 0x86, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x81, 0x01, 0x02, 0x01, 0x81, 0x7A, 0xF9, 0x46, 0x80, 0x8C, 0x00, 0x86,
+  0x05, 0x01, 0x15, 0xE7, 0xFE, 0xFD, 0x4E, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x83, 0x01, 0x02, 0x17, 0xAB, 0x42, 0x85, 0xBC, 0x5E, 0x3B, 0x7C, 0xF5,
+  0xFC, 0x40, 0x80, 0x5F, 0x00, 0x80, 0x06, 0x00, 0x80, 0x51, 0x41, 0x83, 0xF7, 0x1B, 0x01, 0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x2E, 0xFC,
+  0x40, 0x81, 0xEE, 0x5F, 0x03, 0x86, 0x48, 0xF9, 0xFD, 0xED, 0x1B, 0x01, 0x05, 0x00, 0x84, 0x84, 0xF9, 0x65, 0x06, 0x02, 0xC0, 0x01, 0x80, 0x03,
+  0x00, 0x82, 0x52, 0xCF, 0x2C, 0x00, 0x83, 0x03, 0x04, 0x03, 0x06, 0x00, 0x80, 0x7B, 0x41, 0x80, 0x95, 0x00, 0x83, 0x04, 0x01, 0x04, 0x30, 0xC0,
+  0x02, 0x80, 0x01, 0x00, 0x80, 0x05, 0x00, 0x80, 0x03, 0x02, 0x83, 0x01, 0x03, 0x07, 0xD6, 0x41, 0x80, 0x2E, 0x00, 0x80, 0x03, 0x01, 0x80, 0x02,
+  0xC0, 0x03, 0x80, 0x01, 0x00, 0x80, 0x02, 0x04, 0x80, 0x04, 0x00, 0x87, 0x58, 0xF1, 0x8F, 0x1A, 0x01, 0x01, 0x01, 0x02, 0xC0, 0x04, 0x80, 0x01,
+  0x06, 0x82, 0x01, 0x06, 0x24, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_ANGER_26_SPAN_PX[] PROGMEM = {
+  0x3021, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x7884, 0xC8C6, 0x6063, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0800, 0xA0A5, 0xC0C6, 0xB8A5, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0000, 0x3821,
+  0x1000, 0x0000, 0x4042, 0xC8C6, 0xC0C6, 0x8084, 0x0000, 0x0000, 0x0000, 0x2821, 0xA8A5, 0x6063, 0x0000, 0x0000, 0x0000, 0x5863,
+  0xC8C6, 0x8884, 0x0000, 0x0000, 0x0000, 0x0000, 0x8884, 0xC0C6, 0xC0C6, 0x5863, 0x0000, 0x5842, 0xB8A5, 0xC0C6, 0xD0C6, 0x3821,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x9084, 0xC0C6, 0xC8C6, 0x6063, 0x0000, 0x2001, 0xB0A5, 0xC0C6, 0xC0C6, 0x8084, 0x4842, 0x5863,
+  0xA0A5, 0xC0C6, 0xC0C6, 0xC0C6, 0x7063, 0x0800, 0x0000, 0x0000, 0x0000, 0x1000, 0xA8A5, 0xC0C6, 0xC0C6, 0x2821, 0x0000, 0x3021,
+  0xB8A5, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xB0A5, 0x4842, 0x0000, 0x0000, 0x0000, 0x3821, 0xC0C6, 0xC0C6, 0x8884,
+  0x0000, 0x0000, 0x2021, 0x8884, 0xB0A5, 0xB8C6, 0xB8C6, 0xA0A5, 0x6863, 0x1000, 0x0000, 0x0000, 0x0000, 0x8064, 0xC8C6, 0xB0A5,
+  0x1800, 0x0000, 0x0000, 0x1800, 0x2821, 0x2821, 0x0800, 0x0000, 0x2021, 0x1800, 0x0000, 0x0000, 0x3842, 0xC0C6, 0xC0C6, 0x3842,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x6063, 0xB8A5, 0x8084, 0x0000, 0x0000, 0x0000, 0x2821, 0xC0C6, 0xC8C6, 0x4842,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3821, 0xA8A5, 0xC8C6, 0xC0C6, 0xC8C6, 0x3021, 0x0000, 0x0000, 0x6863, 0xC0C6,
+  0xC0C6, 0x2821, 0x0000, 0x0000, 0x4842, 0xC0C6, 0xC0C6, 0xC0C6, 0xA0A5, 0x4842, 0x0800, 0x0000, 0x0000, 0x5042, 0xC0C6, 0xC0C6,
+  0x98A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x3821, 0xC0C6, 0xC0C6, 0xC0C6, 0x6063, 0x0800, 0x1000, 0x7863, 0xC0C6, 0xC0C6, 0xC0C6,
+  0x3021, 0x0000, 0x0000, 0x0000, 0x0000, 0x9084, 0xC0C6, 0xB8A5, 0x4042, 0x0000, 0x0800, 0x6063, 0xB0A5, 0xC0C6, 0xC0C6, 0xC0C6,
+  0x4842, 0x0000, 0x0000, 0x2020, 0xB8C6, 0xC8C6, 0x6863, 0x0000, 0x0000, 0x1820, 0xB8C6, 0xC8C6, 0xC0C6, 0x9884, 0x2821, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0xC0C6, 0xC0C6, 0x4022, 0x0000, 0x0000, 0x5863, 0xB0A5, 0x5042, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2821, 0xB8C6, 0xC8C6, 0x5863, 0x0000, 0x0000, 0x0800, 0x1000, 0x0000, 0x1800, 0x3842, 0x4842,
+  0x3821, 0x0800, 0x0000, 0x0000, 0x0000, 0xA0A5, 0xC8C6, 0xA0A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2021, 0x8084, 0xB8A5,
+  0xC0C6, 0xC8C6, 0xC0C6, 0xA8A5, 0x4842, 0x0000, 0x0000, 0x6063, 0xC8C6, 0xC0C6, 0x6062, 0x0000, 0x0000, 0x0000, 0x5042, 0xB8A5,
+  0xC8C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC8C6, 0x6063, 0x0000, 0x0000, 0x1000, 0xA0A5, 0xC0C6, 0xC0C6, 0x3821, 0x0000,
+  0x0000, 0x0000, 0x1000, 0x7863, 0xC8C6, 0xC0C6, 0xC0C6, 0x8884, 0x4042, 0x2821, 0x5863, 0xB8A5, 0xC0C6, 0xC8C6, 0x4042, 0x0000,
+  0x3821, 0xC0C6, 0xC0C6, 0xB0A5, 0x1000, 0x0000, 0x0000, 0x0000, 0x2020, 0xC0C6, 0xC8C6, 0xB0A5, 0x4842, 0x3021, 0xB8A5, 0xC0C6,
+  0xB0A5, 0x1000, 0x0000, 0x0000, 0x6063, 0xC0A5, 0x4842, 0x0000, 0x0000, 0x0000, 0x3821, 0xA084, 0x2001, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5042, 0xC0C6, 0xC0C6, 0x6863, 0x0000, 0x0000, 0x0000, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x98A5,
+  0xC8C6, 0xC0C6, 0x2021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3842, 0xB8A5, 0x6863, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1800
+};
+
+inline constexpr SpriteSpans SPRITE_ANGER_26_SPANS = {
+  SPRITE_ANGER_26_SPAN_ROWS, SPRITE_ANGER_26_SPAN_OPS, SPRITE_ANGER_26_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_ANGER_26_ASSET = {
   SPRITE_ANGER_26_WIDTH, SPRITE_ANGER_26_HEIGHT,
-  SPRITE_ANGER_26_ALPHA, SPRITE_ANGER_26_RGB565
+  nullptr, nullptr, &SPRITE_ANGER_26_SPANS
 };
 
 #endif // SPRITE_ANGER_26_INCLUDED
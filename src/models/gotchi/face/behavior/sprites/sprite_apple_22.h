@@ -5,66 +5,73 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from apple_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from apple_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 387/484 pixels visibles, 1233 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_APPLE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_APPLE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_APPLE_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x7800, 0x6123, 0x6902, 0x6122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x6102, 0x6902, 0x4800, 0x0000, 0x7D8A, 0x7DAB, 0x75AA, 0x554A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF80F, 0xB9E7, 0xFAAA, 0xA80A, 0xC986, 0xFAAA, 0x6122, 0x6902, 0x6041, 0x7E2C, 0x7DAA, 0x7D8A, 0x7DAA, 0x758A, 0x7DAA, 0x758A, 0x754A, 0xFFFF,
-  0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60E1, 0x6122, 0x6DEA, 0x7E2B, 0x7DEB, 0x75AA, 0x75AA, 0x75EB, 0x7DCB, 0x758A, 0x7508, 0xFFFF,
-  0x0000, 0x0000, 0xF800, 0x0000, 0xD988, 0xE168, 0xD968, 0xD968, 0xD968, 0xE969, 0x68E2, 0x6983, 0xA40A, 0x9C4A, 0x8CCA, 0x850A, 0x8CEA, 0x94CA, 0x570B, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xF80F, 0x0000, 0xD968, 0xE168, 0xE989, 0xE989, 0xE989, 0xE988, 0xF189, 0x9124, 0x8904, 0xE908, 0xE148, 0xD968, 0xD968, 0xD968, 0xE928, 0xE108, 0x07E0, 0xF80F, 0x0000,
-  0xFAAA, 0x0000, 0xD968, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD168, 0xD168, 0xD988, 0xD968, 0xD968, 0xD968, 0xD968, 0xD988, 0xF189, 0xD968, 0x0000, 0xFAAA,
-  0xF800, 0xC986, 0xD968, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xD968, 0xC986, 0xF800,
-  0x0000, 0xD188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD188, 0x0000,
-  0x0000, 0xD948, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xD947, 0x0000,
-  0x0000, 0xD968, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xD948, 0x0000,
-  0x0000, 0xD948, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD948, 0x0000,
-  0x0000, 0xD989, 0xD968, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xD968, 0xD989, 0x0000,
-  0xF800, 0xF800, 0xD968, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xD968, 0xF800, 0xF800,
-  0xB9E7, 0x0000, 0xD968, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xD968, 0x0000, 0xB9E7,
-  0xB9E7, 0x0000, 0xD968, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xD968, 0x0000, 0xB9E7,
-  0xF800, 0x0000, 0xD988, 0xD968, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xD968, 0xD988, 0x0000, 0xF800,
-  0x0000, 0xFAAA, 0x0000, 0xD968, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xD968, 0x0000, 0xFAAA, 0x0000,
-  0x0000, 0x7800, 0xF800, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xD968, 0xD188, 0xF800, 0x7800, 0x0000,
-  0x0000, 0x0000, 0xFAAA, 0x0000, 0xD968, 0xF189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xF189, 0xD968, 0x0000, 0xFAAA, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFAAA, 0x0000, 0xD968, 0xE989, 0xD968, 0xD968, 0xE168, 0xE988, 0xE988, 0xE168, 0xD968, 0xD968, 0xE989, 0xD968, 0x0000, 0xFAAA, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0xD968, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xD968, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_APPLE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 11, 6, 25, 15, 48, 33, 65, 46, 86, 62, 106, 81, 127, 101,
+  141, 123, 150, 143, 163, 163, 176, 183, 185, 203, 200, 223, 216, 245, 232, 265,
+  250, 285, 268, 305, 287, 323, 304, 343, 331, 359, 350, 373
 };
 
-const uint8_t SPRITE_APPLE_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x14, 0xEB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xAA, 0xEB, 0x0D, 0x02, 0x27, 0x2E, 0x29, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x03, 0x03, 0x05, 0x03, 0x28, 0xFF, 0x4A, 0x54, 0xD0, 0xFC, 0xFF, 0xFD, 0xDC, 0x85, 0x09, 0x01,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xF4, 0xAA, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x9D, 0x0B, 0x01,
-  0x00, 0x00, 0x01, 0x00, 0x2F, 0x85, 0xB5, 0xBA, 0xA5, 0x57, 0xB2, 0xE6, 0xE2, 0xFD, 0xFC, 0xFD, 0xFE, 0xBD, 0x21, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x7D, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xFF, 0xFF, 0xFE, 0xFE, 0xEA, 0x73, 0x01, 0x02, 0x00,
-  0x03, 0x00, 0x5E, 0xFF, 0xFE, 0xFB, 0xFC, 0xFC, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x03,
-  0x01, 0x05, 0xD6, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xD6, 0x05, 0x01,
-  0x00, 0x25, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x25, 0x00,
-  0x00, 0x2F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x30, 0x00,
-  0x00, 0x2E, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2F, 0x00,
-  0x00, 0x29, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x29, 0x00,
-  0x00, 0x15, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0x15, 0x00,
-  0x01, 0x01, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD1, 0x01, 0x01,
-  0x04, 0x00, 0x9C, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x9C, 0x00, 0x04,
-  0x04, 0x00, 0x53, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x53, 0x00, 0x04,
-  0x01, 0x00, 0x0F, 0xE9, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE9, 0x0F, 0x00, 0x01,
-  0x00, 0x03, 0x00, 0x8C, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x8C, 0x00, 0x03, 0x00,
-  0x00, 0x02, 0x01, 0x1B, 0xF0, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF0, 0x1A, 0x01, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x6B, 0xFF, 0xFB, 0xFE, 0xFF, 0xFE, 0xFC, 0xFC, 0xFE, 0xFF, 0xFE, 0xFB, 0xFF, 0x6A, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x9B, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x9B, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x89, 0xF4, 0xFD, 0xD7, 0x89, 0x89, 0xD7, 0xFD, 0xF4, 0x89, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00
+const uint8_t SPRITE_APPLE_22_SPAN_OPS[] PROGMEM = {
+  0x08, 0x84, 0x02, 0x02, 0x14, 0xEB, 0x71, 0x04, 0x80, 0x03, 0xC0, 0x08, 0x80, 0x02, 0x00, 0x87, 0xAA, 0xEB, 0x0D, 0x02, 0x27, 0x2E, 0x29, 0x06,
+  0xC0, 0x03, 0x86, 0x02, 0x04, 0x03, 0x03, 0x05, 0x03, 0x28, 0x40, 0x83, 0x4A, 0x54, 0xD0, 0xFC, 0x40, 0x84, 0xFD, 0xDC, 0x85, 0x09, 0x01, 0xC0,
+  0x02, 0x80, 0x03, 0x05, 0x82, 0x71, 0xF4, 0xAA, 0x42, 0x80, 0xFE, 0x41, 0x82, 0x9D, 0x0B, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x8E, 0x2F, 0x85,
+  0xB5, 0xBA, 0xA5, 0x57, 0xB2, 0xE6, 0xE2, 0xFD, 0xFC, 0xFD, 0xFE, 0xBD, 0x21, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x7D, 0xFA, 0x45, 0x81, 0xFC,
+  0xF9, 0x41, 0x85, 0xFE, 0xFE, 0xEA, 0x73, 0x01, 0x02, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x5E, 0x40, 0x86, 0xFE, 0xFB, 0xFC, 0xFC, 0xFB, 0xFC, 0xFE,
+  0x47, 0x80, 0x5E, 0x00, 0x80, 0x03, 0xC0, 0x84, 0x01, 0x05, 0xD6, 0xFD, 0xFC, 0x4B, 0x84, 0xFC, 0xFD, 0xD6, 0x05, 0x01, 0xC0, 0x00, 0x81, 0x25,
+  0xFB, 0x4F, 0x81, 0xFB, 0x25, 0xC0, 0x00, 0x80, 0x2F, 0x40, 0x80, 0xFE, 0x4D, 0x80, 0xFE, 0x40, 0x80, 0x30, 0xC0, 0x00, 0x80, 0x2E, 0x40, 0x80,
+  0xFE, 0x4D, 0x80, 0xFE, 0x40, 0x80, 0x2F, 0xC0, 0x00, 0x81, 0x29, 0xFE, 0x4F, 0x81, 0xFE, 0x29, 0xC0, 0x00, 0x81, 0x15, 0xEF, 0x40, 0x80, 0xFE,
+  0x4B, 0x80, 0xFE, 0x40, 0x81, 0xEF, 0x15, 0xC0, 0x82, 0x01, 0x01, 0xD1, 0x40, 0x80, 0xFD, 0x4B, 0x80, 0xFD, 0x40, 0x82, 0xD1, 0x01, 0x01, 0xC0,
+  0x80, 0x04, 0x00, 0x82, 0x9C, 0xFE, 0xFB, 0x4B, 0x82, 0xFB, 0xFE, 0x9C, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x04, 0x00, 0x80, 0x53, 0x40, 0x80, 0xFC,
+  0x4B, 0x80, 0xFC, 0x40, 0x80, 0x53, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x01, 0x00, 0x83, 0x0F, 0xE9, 0xFE, 0xFD, 0x49, 0x83, 0xFD, 0xFE, 0xE9, 0x0F,
+  0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x80, 0x8C, 0x40, 0x80, 0xFB, 0x49, 0x80, 0xFB, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x03, 0xC0, 0x00,
+  0x85, 0x02, 0x01, 0x1B, 0xF0, 0xFD, 0xFE, 0x47, 0x85, 0xFE, 0xFD, 0xF0, 0x1A, 0x01, 0x02, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x80, 0x6B, 0x40, 0x81,
+  0xFB, 0xFE, 0x40, 0x83, 0xFE, 0xFC, 0xFC, 0xFE, 0x40, 0x81, 0xFE, 0xFB, 0x40, 0x80, 0x6A, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x80,
+  0x9B, 0x40, 0x80, 0xFE, 0x45, 0x80, 0xFE, 0x40, 0x80, 0x9B, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x81, 0x01, 0x02, 0x00, 0x89, 0x89, 0xF4, 0xFD, 0xD7,
+  0x89, 0x89, 0xD7, 0xFD, 0xF4, 0x89, 0x00, 0x81, 0x02, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_APPLE_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0800, 0x58E1, 0x2860, 0x0000, 0x0000, 0x38A1, 0x58E1, 0x0000, 0x0000, 0x10C1, 0x1102, 0x10E1, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x6902, 0x1800, 0x2A04, 0x6488, 0x7D8A, 0x7DAA, 0x758A, 0x6CE8, 0x3AE5, 0x0020,
+  0x0000, 0x0000, 0x2860, 0x5901, 0x43C6, 0x7E2B, 0x7DEB, 0x75AA, 0x75AA, 0x75EB, 0x7DCB, 0x4366, 0x0020, 0x0000, 0x0000, 0x2841,
+  0x70A4, 0x98E5, 0x98E5, 0x88E5, 0x4863, 0x4081, 0x5942, 0x8B88, 0x9C4A, 0x8CCA, 0x850A, 0x8CEA, 0x6B87, 0x08E1, 0x0000, 0x68A4,
+  0xD947, 0xE989, 0xE989, 0xE989, 0xE988, 0xF189, 0x9124, 0x8904, 0xE0E7, 0xE148, 0xD968, 0xD968, 0xD968, 0xD107, 0x6063, 0x0000,
+  0x0000, 0x0000, 0x5083, 0xE989, 0xD968, 0xD147, 0xD968, 0xD968, 0xD147, 0xD968, 0xD168, 0xD168, 0xD988, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD988, 0xF189, 0x5083, 0x0000, 0x0000, 0x0000, 0xB126, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xB126, 0x0000, 0x0000, 0x2021, 0xD147, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0x2021, 0x2821,
+  0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xE168, 0x2821, 0x2841, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0x2821, 0x2021, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0x2021, 0x1020, 0xC947, 0xE168, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xC947, 0x1020, 0x0000,
+  0x0000, 0xA906, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xE188, 0xA906, 0x0000, 0x0000, 0x0000, 0x80C5, 0xE989, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE989, 0x80C5, 0x0000, 0x0000, 0x4062, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0x4062, 0x0000, 0x0000, 0x0800, 0xC127,
+  0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xC127, 0x0800,
+  0x0000, 0x0000, 0x78C4, 0xE989, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147,
+  0xE989, 0x78C4, 0x0000, 0x0000, 0x0000, 0x1020, 0xD147, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xE168, 0xC947, 0x1020, 0x0000, 0x0000, 0x0000, 0x5083, 0xF189, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD147, 0xF189, 0x5083, 0x0000, 0x0000, 0x80C4, 0xE989, 0xD968, 0xD968, 0xE168, 0xE988, 0xE988, 0xE168,
+  0xD968, 0xD968, 0xE989, 0x80C4, 0x0000, 0x0000, 0x0000, 0x70A4, 0xD967, 0xD968, 0xB126, 0x70A4, 0x70A4, 0xB126, 0xD968, 0xD967,
+  0x70A4, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_APPLE_22_SPANS = {
+  SPRITE_APPLE_22_SPAN_ROWS, SPRITE_APPLE_22_SPAN_OPS, SPRITE_APPLE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_APPLE_22_ASSET = {
   SPRITE_APPLE_22_WIDTH, SPRITE_APPLE_22_HEIGHT,
-  SPRITE_APPLE_22_ALPHA, SPRITE_APPLE_22_RGB565
+  nullptr, nullptr, &SPRITE_APPLE_22_SPANS
 };
 
 #endif // SPRITE_APPLE_22_INCLUDED
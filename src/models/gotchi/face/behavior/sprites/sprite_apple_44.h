@@ -5,110 +5,193 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from apple_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from apple_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1615/1936 pixels visibles, 4755 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_APPLE_44_WIDTH = 44;
 constexpr uint16_t SPRITE_APPLE_44_HEIGHT = 44;
 
-const uint16_t SPRITE_APPLE_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x5000, 0x58E0, 0x0000, 0x0000, 0x68E2, 0x6902, 0x6902, 0x6122, 0x6183, 0x6AA5, 0x7EAA, 0x7DEF, 0x64C6, 0x52AA, 0x7BEF, 0x7BEF, 0x7DE7, 0x7EAA, 0x8E2A, 0x7D89, 0x95A9, 0xFFE0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5000, 0x5000, 0x7940, 0x7800, 0x58E1, 0x6902, 0x6902, 0x6902, 0x6102, 0x58C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5140, 0x0000, 0x5000, 0x68E1, 0x6102, 0x6122, 0x6922, 0x6922, 0x6102, 0x4000, 0x0000, 0x0000, 0x7BE0, 0x7D09, 0x6DAB, 0x654A, 0x6DAB, 0x3DEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80F, 0xF80F, 0xFBEF, 0xFBEF, 0xF80F, 0xF80F, 0xAAAA, 0xB807, 0x88E3, 0x0000, 0x0000, 0x6922, 0x6102, 0x68E2, 0x68C2, 0x6881, 0x68C1, 0xAFFA, 0x7DEB, 0x74E9, 0x7D8A, 0x7D8A, 0x7DAB, 0x7D8A, 0x758A, 0x756A, 0x756A, 0x75CA, 0x7DAA, 0x7D6A, 0x7D4A, 0x0000, 0x0000, 0xFFE0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF80F, 0xC806, 0xDA49, 0xD9E7, 0xD9E7, 0xF9E7, 0xD8E7, 0xC0E7, 0xC986, 0xF9E7, 0xC986, 0xF81F, 0x0000, 0x6922, 0x6922, 0x68C2, 0x6821, 0x6800, 0x8BC9, 0x862C, 0x7DCB, 0x7D6A, 0x7D8A, 0x7D8A, 0x7DAA, 0x7D8A, 0x7D6A, 0x758A, 0x758A, 0x75AA, 0x758A, 0x756A, 0x6D49, 0x0000, 0x0000, 0x7DE7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x780F, 0xF81F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5182, 0x6102, 0x6902, 0x68E2, 0x6163, 0x6549, 0x76AC, 0x7E4B, 0x7DEB, 0x7DAA, 0x860B, 0x860B, 0x862B, 0x862B, 0x860B, 0x862B, 0x860B, 0x7DAA, 0x7D8A, 0x758A, 0x6D49, 0x0000, 0x0000, 0x7EAF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xC80C, 0xD929, 0xF807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58E0, 0x6162, 0x60C1, 0x68C1, 0x6163, 0x63C6, 0x6F0C, 0x76AC, 0x7E6B, 0x7E0B, 0x7DEB, 0x7DEB, 0x7DCB, 0x7DCB, 0x7DEB, 0x7E0B, 0x8E6C, 0x968C, 0x8E0B, 0x7D8A, 0x756A, 0x7529, 0x0000, 0x0000, 0x7EAF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xC908, 0xD147, 0xD167, 0xD968, 0xD948, 0xD148, 0xC947, 0xE168, 0xF9CA, 0x70E3, 0x6122, 0x60A1, 0x60C1, 0x69E4, 0x6C88, 0x7E6C, 0x7E4B, 0x866B, 0x7E0B, 0x75EA, 0x75CA, 0x75AA, 0x75AA, 0x75CA, 0x75EB, 0x7E2B, 0x7E2B, 0x7DEB, 0x7DAA, 0x756A, 0x6D09, 0x0000, 0x0000, 0x7DEF,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xB800, 0xF800, 0x0000, 0x0000, 0xB9E7, 0xD1A7, 0xD948, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD148, 0xE169, 0xF98A, 0xA926, 0x7103, 0x60C1, 0x6102, 0x7224, 0x8408, 0x954B, 0x8D2A, 0x8D4A, 0x856A, 0x756A, 0x758A, 0x7D8A, 0x7D6A, 0x7D6A, 0x856A, 0x7DCB, 0x6E8B, 0x66EB, 0x7D8B, 0x8D0A, 0x7CEB, 0x0000, 0x0000, 0xFFFF,
-  0x0000, 0x0000, 0xF81F, 0xF800, 0x0000, 0x0000, 0xC1C7, 0xD167, 0xD988, 0xE988, 0xE169, 0xE168, 0xE168, 0xE168, 0xE168, 0xE168, 0xD968, 0xE989, 0xF98A, 0xC947, 0x8904, 0x60E2, 0x6122, 0x81C4, 0xAAC8, 0xBB4A, 0xB369, 0xA369, 0x9BC9, 0x9C09, 0x9429, 0x9C4A, 0x9C2A, 0xA40A, 0xABC9, 0xAB89, 0x9B69, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x0000,
-  0x0000, 0xF800, 0xF9EF, 0x0000, 0x0000, 0x9986, 0xC967, 0xD168, 0xE168, 0xE989, 0xE989, 0xE989, 0xE988, 0xE188, 0xE988, 0xE188, 0xE188, 0xF189, 0xF98A, 0xD968, 0x9925, 0x7102, 0x6902, 0x9125, 0xC967, 0xE989, 0xD9A8, 0xC9C8, 0xC9E8, 0xCA08, 0xCA28, 0xCA28, 0xCA28, 0xD208, 0xD9C8, 0xE188, 0xD907, 0xF006, 0x0000, 0x0000, 0x0000, 0xC80C, 0xF800, 0x0000,
-  0xF800, 0xF800, 0xF98C, 0x0000, 0xA94A, 0xD968, 0xE168, 0xE188, 0xE168, 0xF989, 0xF189, 0xE989, 0xE989, 0xE189, 0xE988, 0xE188, 0xE188, 0xF189, 0xF9AA, 0xE989, 0xB966, 0x9144, 0x9124, 0xB105, 0xE0E7, 0xF0E8, 0xE908, 0xE108, 0xE108, 0xE128, 0xE128, 0xE108, 0xE128, 0xE908, 0xE908, 0xF128, 0xF148, 0xE168, 0xD1E8, 0xAAAA, 0x07E0, 0xF80F, 0xF800, 0x7BEF,
-  0xCB2C, 0x0000, 0xF80F, 0x9806, 0xC147, 0xE988, 0xE989, 0xF189, 0xE989, 0xE168, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xE168, 0xD167, 0xC167, 0xC167, 0xC947, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE128, 0xE148, 0xE148, 0xE148, 0xF169, 0xF989, 0xE989, 0xE188, 0xC188, 0x9806, 0xF81F, 0x0000, 0xCB2C,
-  0xD9E7, 0x0000, 0x0000, 0xC0E7, 0xD148, 0xE168, 0xE989, 0xF9A9, 0xE188, 0xD968, 0xD968, 0xD968, 0xD948, 0xD948, 0xD948, 0xD948, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD988, 0xD988, 0xD9A8, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD188, 0xD988, 0xE9A9, 0xF9C9, 0xE989, 0xE168, 0xD148, 0xC0E7, 0x0000, 0x0000, 0xD9E7,
-  0xE0E7, 0x0000, 0x0000, 0xD187, 0xD968, 0xD968, 0xE989, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168, 0xD988, 0xD988, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xE989, 0xE989, 0xD968, 0xD968, 0xD187, 0x0000, 0x0000, 0xE0E7,
-  0xF929, 0x0000, 0xF800, 0xD968, 0xD968, 0xE168, 0xE188, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xE168, 0xD968, 0xD968, 0xF800, 0x0000, 0xF929,
-  0xF9E7, 0x0000, 0x9B26, 0xD968, 0xD968, 0xE989, 0xE988, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE988, 0xE989, 0xD968, 0xD968, 0x9B26, 0x0000, 0xF9E7,
-  0xFBEF, 0x0000, 0xC1C7, 0xD968, 0xD968, 0xF189, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xF189, 0xD968, 0xD968, 0xB186, 0x0000, 0xFBEF,
-  0xF80F, 0x0000, 0xC926, 0xE168, 0xE168, 0xF189, 0xE189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE189, 0xF189, 0xE168, 0xD968, 0xD926, 0x0000, 0xF80F,
-  0xF80F, 0x0000, 0xB8E5, 0xE168, 0xE168, 0xF189, 0xE189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE189, 0xF189, 0xE168, 0xE168, 0xD0E5, 0x0000, 0xF80F,
-  0xF80F, 0x0000, 0xC906, 0xE168, 0xE168, 0xF189, 0xE189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE189, 0xF189, 0xE168, 0xE168, 0xC8E5, 0x0000, 0xF80F,
-  0xF80F, 0x0000, 0xD127, 0xD968, 0xE168, 0xF189, 0xE189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE189, 0xF189, 0xE168, 0xD968, 0xD926, 0x0000, 0xF80F,
-  0xAAAA, 0x0000, 0xD0A7, 0xD968, 0xD968, 0xF189, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xF189, 0xD968, 0xD968, 0xD0A7, 0x0000, 0xAAAA,
-  0x79E7, 0x0000, 0xD8E7, 0xD948, 0xD968, 0xE989, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xE989, 0xD968, 0xD948, 0xF929, 0x0000, 0x79E7,
-  0xC986, 0x0000, 0xF80F, 0xD948, 0xD968, 0xE189, 0xE989, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE989, 0xE189, 0xD968, 0xD948, 0xF80F, 0x0000, 0xC986,
-  0xD924, 0x0000, 0x0000, 0xD968, 0xD968, 0xE168, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xE168, 0xD968, 0xD968, 0x0000, 0x0000, 0xD924,
-  0xD8E7, 0x0000, 0x0000, 0xD968, 0xD968, 0xD968, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xD968, 0xD968, 0xD968, 0x0000, 0x0000, 0xD8E7,
-  0xE0C6, 0x0000, 0x0000, 0xD168, 0xD968, 0xD968, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xD968, 0xD968, 0xD168, 0x0000, 0x0000, 0xE0C6,
-  0xE189, 0x0000, 0x0000, 0xD188, 0xD168, 0xE168, 0xE989, 0xE989, 0xE168, 0xD948, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD948, 0xE168, 0xE989, 0xE989, 0xE168, 0xD168, 0xD188, 0x0000, 0x0000, 0xE189,
-  0xE189, 0x0000, 0x0000, 0xD168, 0xD148, 0xE168, 0xE989, 0xF189, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xF189, 0xE989, 0xE168, 0xD148, 0xD168, 0x0000, 0x0000, 0xE189,
-  0xC1C7, 0x0000, 0x0000, 0xB965, 0xD147, 0xE168, 0xE989, 0xF189, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xF189, 0xE989, 0xE168, 0xD147, 0xB965, 0x0000, 0x0000, 0xC1C7,
-  0xB244, 0x0000, 0xF800, 0xB800, 0xD127, 0xE188, 0xE168, 0xF189, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xF189, 0xE168, 0xE188, 0xD127, 0xB800, 0xF800, 0x0000, 0xB244,
-  0xF800, 0xF800, 0xB9E7, 0x0000, 0xB129, 0xD968, 0xD968, 0xE988, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xE988, 0xD968, 0xD968, 0xB129, 0x0000, 0xB9E7, 0xF800, 0xF800,
-  0xF800, 0xF800, 0xD145, 0x0000, 0x0000, 0xD168, 0xD968, 0xD968, 0xE988, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE988, 0xD968, 0xD968, 0xD168, 0x0000, 0x0000, 0xD145, 0xF800, 0xF800,
-  0x0000, 0xF800, 0xFAAA, 0x0000, 0x0000, 0xD148, 0xD968, 0xE168, 0xE989, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xE989, 0xE168, 0xD967, 0xD147, 0x0000, 0x0000, 0xFAAA, 0xF800, 0x0000,
-  0x0000, 0xF800, 0xFB2C, 0x0000, 0xF800, 0xD988, 0xD968, 0xE168, 0xE989, 0xF189, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xF189, 0xE968, 0xE168, 0xD968, 0xD986, 0xF800, 0x0000, 0xFB2C, 0xF800, 0x0000,
-  0x0000, 0x0000, 0xA800, 0x7800, 0xB9E7, 0xAAAA, 0xD967, 0xE168, 0xE168, 0xF189, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xF189, 0xE168, 0xE168, 0xD967, 0xAAAA, 0xF9E7, 0x7800, 0xA800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7800, 0xD145, 0x0000, 0x0000, 0xD948, 0xD968, 0xE168, 0xE989, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xE989, 0xE168, 0xD968, 0xD147, 0x0000, 0x0000, 0xF945, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xD929, 0x0000, 0x0000, 0xC927, 0xD147, 0xE168, 0xE989, 0xF189, 0xE168, 0xD148, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD148, 0xE168, 0xF189, 0xE989, 0xE168, 0xD148, 0xC927, 0x0000, 0x0000, 0xD929, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xC98C, 0xF800, 0xC986, 0xB129, 0xC947, 0xE168, 0xE989, 0xF189, 0xF189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xF189, 0xF189, 0xE989, 0xE168, 0xC987, 0xB129, 0xC986, 0xF800, 0xC98C, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80F, 0xFA49, 0x0000, 0x9124, 0xD168, 0xD968, 0xE988, 0xF189, 0xF189, 0xE188, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xF189, 0xF189, 0xF189, 0xF189, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968, 0xE188, 0xF189, 0xF189, 0xE988, 0xD968, 0xD168, 0xD145, 0x0000, 0xFA49, 0xF80F, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF80F, 0xFAAA, 0xF800, 0x0000, 0xB0C9, 0xC967, 0xD968, 0xE989, 0xE989, 0xE188, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168, 0xE988, 0xE988, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xE188, 0xE989, 0xE989, 0xD968, 0xC967, 0xC8C9, 0x0000, 0xF800, 0xFAAA, 0xF80F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 0xB906, 0xD968, 0xE188, 0xE188, 0xE188, 0xE168, 0xE188, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xE188, 0xE168, 0xE188, 0xE188, 0xE188, 0xD968, 0xB906, 0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF9C7, 0xF800, 0x0000, 0xF80F, 0xD968, 0xD968, 0xE168, 0xE188, 0xE188, 0xD968, 0xD968, 0xD968, 0xD968, 0xD168, 0xD168, 0xD968, 0xD968, 0xD968, 0xD968, 0xE188, 0xE188, 0xE168, 0xD968, 0xD968, 0xF80F, 0x0000, 0xF800, 0xF9C7, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_APPLE_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 27, 22, 42, 34, 64, 51, 102, 82, 142, 115, 168, 140, 195, 167,
+  237, 202, 281, 239, 323, 273, 367, 310, 400, 353, 427, 395, 466, 435, 502, 475,
+  529, 517, 555, 559, 579, 601, 603, 643, 627, 685, 651, 727, 675, 769, 699, 811,
+  723, 853, 749, 895, 775, 935, 803, 975, 829, 1015, 855, 1055, 881, 1095, 909, 1135,
+  937, 1177, 969, 1219, 999, 1259, 1028, 1297, 1057, 1339, 1088, 1381, 1131, 1419, 1172, 1453,
+  1205, 1491, 1236, 1525, 1275, 1557, 1314, 1587
 };
 
-const uint8_t SPRITE_APPLE_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x08, 0x00, 0x00, 0x38, 0xBC, 0xEF, 0xB0, 0x53, 0x18, 0x06, 0x04, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x07, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 0x02, 0x11, 0x64, 0xDA, 0xEE, 0x92, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x03, 0x11, 0x4F, 0xB1, 0xFE, 0xDD, 0x60, 0x0B, 0x00, 0x00, 0x02, 0x0E, 0x0E, 0x0F, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x09, 0x00, 0x00, 0x2E, 0xA1, 0xF0, 0xE7, 0x91, 0x27, 0x06, 0x20, 0x3E, 0x52, 0x60, 0x62, 0x63, 0x61, 0x54, 0x3C, 0x29, 0x1F, 0x13, 0x06, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x08, 0x0A, 0x01, 0x00, 0x53, 0xD8, 0xF3, 0x99, 0x3B, 0x23, 0x47, 0x85, 0xB9, 0xCF, 0xD5, 0xD7, 0xD8, 0xD6, 0xCC, 0xB4, 0x99, 0x78, 0x4A, 0x18, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x74, 0xF0, 0xEB, 0x7B, 0x37, 0x60, 0x9E, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xC5, 0x79, 0x27, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x36, 0x92, 0xF0, 0xEB, 0xA0, 0x87, 0xC2, 0xE9, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x84, 0x2B, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x0F, 0x19, 0x20, 0x22, 0x23, 0x23, 0x23, 0x16, 0x09, 0x18, 0x5A, 0xA7, 0xE3, 0xE6, 0xC9, 0xCC, 0xFD, 0xFF, 0xFF, 0xF8, 0xF8, 0xF9, 0xF8, 0xF6, 0xED, 0xE0, 0xCE, 0xBD, 0x96, 0x5D, 0x1E, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x04, 0x21, 0x4A, 0x6C, 0x82, 0x8B, 0x8C, 0x8C, 0x87, 0x63, 0x39, 0x3F, 0x7E, 0xBD, 0xE0, 0xE4, 0xDC, 0xE2, 0xFE, 0xFF, 0xFF, 0xFB, 0xF9, 0xFE, 0xFE, 0xF8, 0xDD, 0xA6, 0x63, 0x3B, 0x2B, 0x1C, 0x08, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x09, 0x21, 0x4A, 0x72, 0x9B, 0xBB, 0xD2, 0xDB, 0xDD, 0xDC, 0xD6, 0xB4, 0x8A, 0x8A, 0xB1, 0xD7, 0xE7, 0xEA, 0xEA, 0xEC, 0xF5, 0xFB, 0xFC, 0xFB, 0xFA, 0xFF, 0xFE, 0xFB, 0xDC, 0x97, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x01, 0x04, 0x00, 0x00, 0x05, 0x36, 0x79, 0xBC, 0xDC, 0xE9, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFB, 0xF0, 0xE3, 0xE3, 0xED, 0xF6, 0xF7, 0xF6, 0xF6, 0xF8, 0xFC, 0xFE, 0xFE, 0xFD, 0xFD, 0xFE, 0xFC, 0xFE, 0xEF, 0xBE, 0x6E, 0x24, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
-  0x01, 0x01, 0x05, 0x00, 0x06, 0x27, 0x7B, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFC, 0xE8, 0xBC, 0x7A, 0x2D, 0x09, 0x01, 0x04, 0x01, 0x02,
-  0x05, 0x00, 0x02, 0x05, 0x24, 0x67, 0xC8, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFB, 0xFB, 0xF0, 0xC7, 0x69, 0x25, 0x05, 0x01, 0x00, 0x05,
-  0x08, 0x00, 0x00, 0x11, 0x54, 0xAB, 0xF5, 0xFF, 0xFB, 0xF2, 0xF6, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF8, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xF6, 0xAB, 0x54, 0x11, 0x00, 0x00, 0x08,
-  0x09, 0x00, 0x00, 0x25, 0x8F, 0xE4, 0xFF, 0xFF, 0xFD, 0xF8, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xFF, 0xFF, 0xE4, 0x8F, 0x25, 0x00, 0x00, 0x09,
-  0x07, 0x00, 0x01, 0x3B, 0xB9, 0xFE, 0xFE, 0xF7, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xF6, 0xFD, 0xFE, 0xB9, 0x3B, 0x01, 0x00, 0x07,
-  0x04, 0x00, 0x05, 0x51, 0xCE, 0xFF, 0xFF, 0xF8, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF8, 0xFF, 0xFF, 0xCE, 0x51, 0x05, 0x00, 0x04,
-  0x02, 0x00, 0x09, 0x5D, 0xD4, 0xFD, 0xFE, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFE, 0xFD, 0xD4, 0x5E, 0x0A, 0x00, 0x02,
-  0x02, 0x00, 0x0E, 0x63, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD8, 0x64, 0x0E, 0x00, 0x02,
-  0x02, 0x00, 0x10, 0x63, 0xD7, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD7, 0x64, 0x11, 0x00, 0x02,
-  0x02, 0x00, 0x0F, 0x62, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD8, 0x64, 0x10, 0x00, 0x02,
-  0x02, 0x00, 0x0D, 0x62, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD8, 0x62, 0x0E, 0x00, 0x02,
-  0x03, 0x00, 0x0C, 0x5F, 0xD7, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xD7, 0x60, 0x0C, 0x00, 0x03,
-  0x04, 0x00, 0x08, 0x59, 0xD2, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xD2, 0x59, 0x07, 0x00, 0x04,
-  0x05, 0x00, 0x02, 0x4D, 0xC8, 0xFF, 0xFF, 0xFA, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFF, 0xFF, 0xC8, 0x4D, 0x02, 0x00, 0x05,
-  0x07, 0x00, 0x00, 0x3F, 0xBC, 0xFE, 0xFF, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFE, 0xBC, 0x3F, 0x00, 0x00, 0x07,
-  0x08, 0x00, 0x00, 0x30, 0xAB, 0xF6, 0xFF, 0xFC, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFC, 0xFF, 0xF6, 0xAB, 0x30, 0x00, 0x00, 0x08,
-  0x0A, 0x00, 0x00, 0x27, 0x99, 0xE8, 0xFD, 0xFE, 0xFE, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFE, 0xFE, 0xFD, 0xE8, 0x99, 0x27, 0x00, 0x00, 0x0A,
-  0x0A, 0x00, 0x00, 0x1F, 0x80, 0xCF, 0xF6, 0xFF, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xFF, 0xFF, 0xF6, 0xCF, 0x80, 0x1F, 0x00, 0x00, 0x0A,
-  0x0A, 0x00, 0x00, 0x16, 0x63, 0xB3, 0xEF, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xEF, 0xB3, 0x63, 0x16, 0x00, 0x00, 0x0A,
-  0x09, 0x00, 0x00, 0x0B, 0x40, 0x91, 0xE5, 0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFD, 0xE5, 0x91, 0x40, 0x0B, 0x00, 0x00, 0x09,
-  0x07, 0x00, 0x01, 0x04, 0x21, 0x6F, 0xDB, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xDB, 0x6F, 0x21, 0x04, 0x01, 0x00, 0x07,
-  0x03, 0x01, 0x04, 0x00, 0x07, 0x4B, 0xC7, 0xFF, 0xFF, 0xF8, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xF8, 0xFF, 0xFF, 0xC7, 0x4B, 0x07, 0x00, 0x04, 0x01, 0x03,
-  0x01, 0x01, 0x06, 0x00, 0x00, 0x31, 0xAA, 0xF5, 0xFE, 0xFA, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFD, 0xFA, 0xFE, 0xF5, 0xAA, 0x31, 0x00, 0x00, 0x06, 0x01, 0x01,
-  0x00, 0x02, 0x06, 0x00, 0x00, 0x1D, 0x7C, 0xCC, 0xF4, 0xFB, 0xFE, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFE, 0xFB, 0xF4, 0xCC, 0x7C, 0x1D, 0x00, 0x00, 0x06, 0x02, 0x00,
-  0x00, 0x02, 0x05, 0x01, 0x02, 0x0F, 0x45, 0x99, 0xEC, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xEC, 0x98, 0x45, 0x0F, 0x02, 0x01, 0x05, 0x02, 0x00,
-  0x00, 0x01, 0x03, 0x02, 0x04, 0x03, 0x10, 0x61, 0xD6, 0xFF, 0xFE, 0xF5, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF5, 0xFE, 0xFF, 0xD7, 0x60, 0x10, 0x03, 0x04, 0x02, 0x03, 0x01, 0x00,
-  0x00, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00, 0x35, 0xA9, 0xF0, 0xFF, 0xFC, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFD, 0xFC, 0xFF, 0xF0, 0xA8, 0x35, 0x00, 0x00, 0x06, 0x02, 0x01, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x15, 0x64, 0xB8, 0xF5, 0xFF, 0xFB, 0xF5, 0xFC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF9, 0xF8, 0xF8, 0xF9, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFC, 0xF5, 0xFB, 0xFF, 0xF5, 0xB7, 0x63, 0x15, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x05, 0x01, 0x05, 0x07, 0x2B, 0x74, 0xD4, 0xFE, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0xD4, 0x73, 0x2A, 0x07, 0x05, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x07, 0x32, 0x98, 0xE5, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xE5, 0x98, 0x32, 0x06, 0x00, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0A, 0x48, 0x8E, 0xCD, 0xEB, 0xF8, 0xFC, 0xFE, 0xFD, 0xF9, 0xF0, 0xE5, 0xDE, 0xDE, 0xE5, 0xF0, 0xF9, 0xFD, 0xFE, 0xFC, 0xF8, 0xEB, 0xCD, 0x8E, 0x48, 0x0A, 0x00, 0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x00, 0x0F, 0x33, 0x7C, 0xBD, 0xE9, 0xFE, 0xFF, 0xF9, 0xEC, 0xCF, 0xAD, 0x97, 0x97, 0xAD, 0xCF, 0xEC, 0xF9, 0xFF, 0xFE, 0xE9, 0xBD, 0x7C, 0x33, 0x0F, 0x00, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x01, 0x00, 0x02, 0x4E, 0xA2, 0xE0, 0xFF, 0xFF, 0xF6, 0xE4, 0xBB, 0x8C, 0x6D, 0x6D, 0x8C, 0xBB, 0xE4, 0xF6, 0xFF, 0xFF, 0xE0, 0xA2, 0x4E, 0x02, 0x00, 0x01, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_APPLE_44_SPAN_OPS[] PROGMEM = {
+  0x10, 0x83, 0x01, 0x01, 0x03, 0x08, 0x01, 0x91, 0x38, 0xBC, 0xEF, 0xB0, 0x53, 0x18, 0x06, 0x04, 0x05, 0x03, 0x02, 0x02, 0x04, 0x06, 0x09, 0x0A,
+  0x07, 0x02, 0xC0, 0x10, 0x8B, 0x01, 0x03, 0x03, 0x06, 0x02, 0x11, 0x64, 0xDA, 0xEE, 0x92, 0x33, 0x03, 0xC0, 0x10, 0x8A, 0x01, 0x06, 0x01, 0x03,
+  0x11, 0x4F, 0xB1, 0xFE, 0xDD, 0x60, 0x0B, 0x01, 0x85, 0x02, 0x0E, 0x0E, 0x0F, 0x0E, 0x04, 0xC0, 0x08, 0x89, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x03, 0x04, 0x09, 0x01, 0x93, 0x2E, 0xA1, 0xF0, 0xE7, 0x91, 0x27, 0x06, 0x20, 0x3E, 0x52, 0x60, 0x62, 0x63, 0x61, 0x54, 0x3C, 0x29, 0x1F,
+  0x13, 0x06, 0x01, 0x80, 0x01, 0xC0, 0x07, 0x8B, 0x02, 0x05, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x08, 0x0A, 0x01, 0x00, 0x93, 0x53, 0xD8,
+  0xF3, 0x99, 0x3B, 0x23, 0x47, 0x85, 0xB9, 0xCF, 0xD5, 0xD7, 0xD8, 0xD6, 0xCC, 0xB4, 0x99, 0x78, 0x4A, 0x18, 0x01, 0x80, 0x04, 0xC0, 0x05, 0x82,
+  0x01, 0x02, 0x01, 0x0A, 0x88, 0x0F, 0x74, 0xF0, 0xEB, 0x7B, 0x37, 0x60, 0x9E, 0xD6, 0x47, 0x83, 0xF9, 0xC5, 0x79, 0x27, 0x01, 0x80, 0x06, 0xC0,
+  0x04, 0x83, 0x01, 0x05, 0x07, 0x04, 0x09, 0x89, 0x08, 0x36, 0x92, 0xF0, 0xEB, 0xA0, 0x87, 0xC2, 0xE9, 0xFA, 0x48, 0x82, 0xD8, 0x84, 0x2B, 0x01,
+  0x80, 0x06, 0xC0, 0x03, 0x81, 0x01, 0x01, 0x02, 0x91, 0x02, 0x0F, 0x19, 0x20, 0x22, 0x23, 0x23, 0x23, 0x16, 0x09, 0x18, 0x5A, 0xA7, 0xE3, 0xE6,
+  0xC9, 0xCC, 0xFD, 0x41, 0x8B, 0xF8, 0xF8, 0xF9, 0xF8, 0xF6, 0xED, 0xE0, 0xCE, 0xBD, 0x96, 0x5D, 0x1E, 0x01, 0x80, 0x04, 0xC0, 0x02, 0x82, 0x01,
+  0x04, 0x02, 0x01, 0x92, 0x04, 0x21, 0x4A, 0x6C, 0x82, 0x8B, 0x8C, 0x8C, 0x87, 0x63, 0x39, 0x3F, 0x7E, 0xBD, 0xE0, 0xE4, 0xDC, 0xE2, 0xFE, 0x41,
+  0x8B, 0xFB, 0xF9, 0xFE, 0xFE, 0xF8, 0xDD, 0xA6, 0x63, 0x3B, 0x2B, 0x1C, 0x08, 0x01, 0x80, 0x01, 0xC0, 0x01, 0x81, 0x01, 0x01, 0x01, 0x98, 0x09,
+  0x21, 0x4A, 0x72, 0x9B, 0xBB, 0xD2, 0xDB, 0xDD, 0xDC, 0xD6, 0xB4, 0x8A, 0x8A, 0xB1, 0xD7, 0xE7, 0xEA, 0xEA, 0xEC, 0xF5, 0xFB, 0xFC, 0xFB, 0xFA,
+  0x40, 0x84, 0xFE, 0xFB, 0xDC, 0x97, 0x38, 0x03, 0x80, 0x02, 0xC0, 0x00, 0x81, 0x01, 0x04, 0x01, 0xA0, 0x05, 0x36, 0x79, 0xBC, 0xDC, 0xE9, 0xF0,
+  0xF8, 0xFC, 0xFC, 0xFC, 0xFB, 0xF0, 0xE3, 0xE3, 0xED, 0xF6, 0xF7, 0xF6, 0xF6, 0xF8, 0xFC, 0xFE, 0xFE, 0xFD, 0xFD, 0xFE, 0xFC, 0xFE, 0xEF, 0xBE,
+  0x6E, 0x24, 0x02, 0x81, 0x05, 0x01, 0xC0, 0x82, 0x01, 0x01, 0x05, 0x00, 0x83, 0x06, 0x27, 0x7B, 0xC8, 0x4E, 0x83, 0xFE, 0xFB, 0xFB, 0xFE, 0x43,
+  0x81, 0xFE, 0xFC, 0x40, 0x89, 0xFC, 0xE8, 0xBC, 0x7A, 0x2D, 0x09, 0x01, 0x04, 0x01, 0x02, 0xC0, 0x80, 0x05, 0x00, 0x85, 0x02, 0x05, 0x24, 0x67,
+  0xC8, 0xF6, 0x57, 0x80, 0xFE, 0x40, 0x87, 0xFB, 0xFB, 0xF0, 0xC7, 0x69, 0x25, 0x05, 0x01, 0x00, 0x80, 0x05, 0xC0, 0x80, 0x08, 0x01, 0x83, 0x11,
+  0x54, 0xAB, 0xF5, 0x40, 0x8E, 0xFB, 0xF2, 0xF6, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF8, 0xFB, 0xFC, 0xFE, 0x49, 0x81, 0xFE, 0xF9,
+  0x41, 0x83, 0xF6, 0xAB, 0x54, 0x11, 0x01, 0x80, 0x08, 0xC0, 0x80, 0x09, 0x01, 0x82, 0x25, 0x8F, 0xE4, 0x41, 0x8D, 0xFD, 0xF8, 0xFC, 0xFD, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0x4A, 0x81, 0xFE, 0xFA, 0x42, 0x82, 0xE4, 0x8F, 0x25, 0x01, 0x80, 0x09, 0xC0, 0x80, 0x07,
+  0x00, 0x87, 0x01, 0x3B, 0xB9, 0xFE, 0xFE, 0xF7, 0xFC, 0xFC, 0x56, 0x88, 0xFE, 0xFC, 0xFC, 0xF6, 0xFD, 0xFE, 0xB9, 0x3B, 0x01, 0x00, 0x80, 0x07,
+  0xC0, 0x80, 0x04, 0x00, 0x82, 0x05, 0x51, 0xCE, 0x41, 0x82, 0xF8, 0xFE, 0xFE, 0x57, 0x82, 0xFE, 0xFD, 0xF8, 0x41, 0x82, 0xCE, 0x51, 0x05, 0x00,
+  0x80, 0x04, 0xC0, 0x80, 0x02, 0x00, 0x86, 0x09, 0x5D, 0xD4, 0xFD, 0xFE, 0xF9, 0xFE, 0x59, 0x86, 0xFE, 0xF9, 0xFE, 0xFD, 0xD4, 0x5E, 0x0A, 0x00,
+  0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x0E, 0x63, 0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x59, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD8, 0x64, 0x0E, 0x00,
+  0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x10, 0x63, 0xD7, 0x41, 0x81, 0xF8, 0xFD, 0x59, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD7, 0x64, 0x11, 0x00,
+  0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x0F, 0x62, 0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x59, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD8, 0x64, 0x10, 0x00,
+  0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x0D, 0x62, 0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x59, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD8, 0x62, 0x0E, 0x00,
+  0x80, 0x02, 0xC0, 0x80, 0x03, 0x00, 0x82, 0x0C, 0x5F, 0xD7, 0x41, 0x81, 0xF9, 0xFD, 0x59, 0x81, 0xFD, 0xF9, 0x41, 0x82, 0xD7, 0x60, 0x0C, 0x00,
+  0x80, 0x03, 0xC0, 0x80, 0x04, 0x00, 0x82, 0x08, 0x59, 0xD2, 0x41, 0x81, 0xF9, 0xFD, 0x59, 0x81, 0xFD, 0xF9, 0x41, 0x82, 0xD2, 0x59, 0x07, 0x00,
+  0x80, 0x04, 0xC0, 0x80, 0x05, 0x00, 0x82, 0x02, 0x4D, 0xC8, 0x41, 0x82, 0xFA, 0xFD, 0xFE, 0x57, 0x82, 0xFE, 0xFD, 0xFA, 0x41, 0x82, 0xC8, 0x4D,
+  0x02, 0x00, 0x80, 0x05, 0xC0, 0x80, 0x07, 0x01, 0x82, 0x3F, 0xBC, 0xFE, 0x40, 0x82, 0xFB, 0xFD, 0xFE, 0x57, 0x82, 0xFE, 0xFD, 0xFB, 0x40, 0x82,
+  0xFE, 0xBC, 0x3F, 0x01, 0x80, 0x07, 0xC0, 0x80, 0x08, 0x01, 0x82, 0x30, 0xAB, 0xF6, 0x40, 0x83, 0xFC, 0xFE, 0xFD, 0xFE, 0x55, 0x83, 0xFE, 0xFD,
+  0xFE, 0xFC, 0x40, 0x82, 0xF6, 0xAB, 0x30, 0x01, 0x80, 0x08, 0xC0, 0x80, 0x0A, 0x01, 0x87, 0x27, 0x99, 0xE8, 0xFD, 0xFE, 0xFE, 0xFB, 0xFE, 0x55,
+  0x87, 0xFE, 0xFB, 0xFE, 0xFE, 0xFD, 0xE8, 0x99, 0x27, 0x01, 0x80, 0x0A, 0xC0, 0x80, 0x0A, 0x01, 0x83, 0x1F, 0x80, 0xCF, 0xF6, 0x41, 0x81, 0xFA,
+  0xFD, 0x55, 0x81, 0xFD, 0xFA, 0x41, 0x83, 0xF6, 0xCF, 0x80, 0x1F, 0x01, 0x80, 0x0A, 0xC0, 0x80, 0x0A, 0x01, 0x83, 0x16, 0x63, 0xB3, 0xEF, 0x41,
+  0x81, 0xF8, 0xFD, 0x55, 0x81, 0xFD, 0xF8, 0x41, 0x83, 0xEF, 0xB3, 0x63, 0x16, 0x01, 0x80, 0x0A, 0xC0, 0x80, 0x09, 0x01, 0x84, 0x0B, 0x40, 0x91,
+  0xE5, 0xFD, 0x40, 0x81, 0xF7, 0xFD, 0x55, 0x81, 0xFD, 0xF7, 0x40, 0x84, 0xFD, 0xE5, 0x91, 0x40, 0x0B, 0x01, 0x80, 0x09, 0xC0, 0x80, 0x07, 0x00,
+  0x84, 0x01, 0x04, 0x21, 0x6F, 0xDB, 0x41, 0x81, 0xF7, 0xFD, 0x55, 0x81, 0xFD, 0xF7, 0x41, 0x84, 0xDB, 0x6F, 0x21, 0x04, 0x01, 0x00, 0x80, 0x07,
+  0xC0, 0x82, 0x03, 0x01, 0x04, 0x00, 0x82, 0x07, 0x4B, 0xC7, 0x41, 0x83, 0xF8, 0xFD, 0xFE, 0xFE, 0x51, 0x83, 0xFE, 0xFE, 0xFD, 0xF8, 0x41, 0x82,
+  0xC7, 0x4B, 0x07, 0x00, 0x82, 0x04, 0x01, 0x03, 0xC0, 0x82, 0x01, 0x01, 0x06, 0x01, 0x87, 0x31, 0xAA, 0xF5, 0xFE, 0xFA, 0xFD, 0xFC, 0xFE, 0x51,
+  0x87, 0xFE, 0xFC, 0xFD, 0xFA, 0xFE, 0xF5, 0xAA, 0x31, 0x01, 0x82, 0x06, 0x01, 0x01, 0xC0, 0x00, 0x81, 0x02, 0x06, 0x01, 0x87, 0x1D, 0x7C, 0xCC,
+  0xF4, 0xFB, 0xFE, 0xF9, 0xFD, 0x51, 0x87, 0xFD, 0xF9, 0xFE, 0xFB, 0xF4, 0xCC, 0x7C, 0x1D, 0x01, 0x81, 0x06, 0x02, 0xC0, 0x00, 0x87, 0x02, 0x05,
+  0x01, 0x02, 0x0F, 0x45, 0x99, 0xEC, 0x41, 0x81, 0xF7, 0xFD, 0x51, 0x81, 0xFD, 0xF7, 0x41, 0x87, 0xEC, 0x98, 0x45, 0x0F, 0x02, 0x01, 0x05, 0x02,
+  0xC0, 0x00, 0x87, 0x01, 0x03, 0x02, 0x04, 0x03, 0x10, 0x61, 0xD6, 0x40, 0x82, 0xFE, 0xF5, 0xFC, 0x51, 0x82, 0xFC, 0xF5, 0xFE, 0x40, 0x87, 0xD7,
+  0x60, 0x10, 0x03, 0x04, 0x02, 0x03, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x01, 0x02, 0x06, 0x01, 0x82, 0x35, 0xA9, 0xF0, 0x40, 0x83, 0xFC, 0xFD, 0xFB,
+  0xFE, 0x43, 0x85, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0x43, 0x83, 0xFE, 0xFB, 0xFD, 0xFC, 0x40, 0x82, 0xF0, 0xA8, 0x35, 0x01, 0x83, 0x06, 0x02,
+  0x01, 0x01, 0xC0, 0x02, 0x81, 0x02, 0x07, 0x01, 0x83, 0x15, 0x64, 0xB8, 0xF5, 0x40, 0x82, 0xFB, 0xF5, 0xFC, 0x42, 0x87, 0xFD, 0xFB, 0xF9, 0xF8,
+  0xF8, 0xF9, 0xFB, 0xFD, 0x42, 0x82, 0xFC, 0xF5, 0xFB, 0x40, 0x83, 0xF5, 0xB7, 0x63, 0x15, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x02, 0x88, 0x02, 0x05,
+  0x01, 0x05, 0x07, 0x2B, 0x74, 0xD4, 0xFE, 0x40, 0x82, 0xFE, 0xFE, 0xFE, 0x4B, 0x82, 0xFE, 0xFE, 0xFE, 0x40, 0x88, 0xFE, 0xD4, 0x73, 0x2A, 0x07,
+  0x05, 0x01, 0x05, 0x02, 0xC0, 0x03, 0x82, 0x01, 0x02, 0x07, 0x00, 0x83, 0x07, 0x32, 0x98, 0xE5, 0x42, 0x81, 0xFB, 0xFE, 0x49, 0x81, 0xFE, 0xFB,
+  0x42, 0x83, 0xE5, 0x98, 0x32, 0x06, 0x00, 0x82, 0x07, 0x02, 0x01, 0xC0, 0x04, 0x82, 0x02, 0x06, 0x01, 0x00, 0x99, 0x0A, 0x48, 0x8E, 0xCD, 0xEB,
+  0xF8, 0xFC, 0xFE, 0xFD, 0xF9, 0xF0, 0xE5, 0xDE, 0xDE, 0xE5, 0xF0, 0xF9, 0xFD, 0xFE, 0xFC, 0xF8, 0xEB, 0xCD, 0x8E, 0x48, 0x0A, 0x00, 0x82, 0x01,
+  0x06, 0x02, 0xC0, 0x05, 0x82, 0x03, 0x01, 0x02, 0x00, 0x85, 0x0F, 0x33, 0x7C, 0xBD, 0xE9, 0xFE, 0x40, 0x89, 0xF9, 0xEC, 0xCF, 0xAD, 0x97, 0x97,
+  0xAD, 0xCF, 0xEC, 0xF9, 0x40, 0x85, 0xFE, 0xE9, 0xBD, 0x7C, 0x33, 0x0F, 0x00, 0x82, 0x02, 0x01, 0x03, 0xC0, 0x06, 0x82, 0x03, 0x09, 0x01, 0x00,
+  0x83, 0x02, 0x4E, 0xA2, 0xE0, 0x41, 0x89, 0xF6, 0xE4, 0xBB, 0x8C, 0x6D, 0x6D, 0x8C, 0xBB, 0xE4, 0xF6, 0x41, 0x83, 0xE0, 0xA2, 0x4E, 0x02, 0x00,
+  0x82, 0x01, 0x09, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_APPLE_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x48C1, 0x60E1, 0x40C1, 0x1860, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2860, 0x50C1, 0x60E1, 0x3081,
+  0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1840, 0x40C1, 0x6922, 0x58E1, 0x2060, 0x0000, 0x0000, 0x0040, 0x0040,
+  0x0040, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x38A1, 0x60C1,
+  0x58A1, 0x3840, 0x1000, 0x0020, 0x08A1, 0x1922, 0x21A3, 0x2A03, 0x2A04, 0x2A03, 0x2A03, 0x21C3, 0x1942, 0x10E1, 0x08A1, 0x0040,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2040, 0x50E1,
+  0x60A1, 0x3800, 0x1000, 0x1061, 0x21A3, 0x3B05, 0x53C7, 0x6468, 0x64A8, 0x64A8, 0x64A8, 0x6488, 0x5C68, 0x53E7, 0x4345, 0x3284,
+  0x1982, 0x0860, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x2860, 0x60E1, 0x58C1, 0x28A1, 0x1121, 0x2A64, 0x4BE6, 0x64E9, 0x7DAA,
+  0x860B, 0x860B, 0x862B, 0x862B, 0x860B, 0x862B, 0x860B, 0x7569, 0x5C47, 0x3284, 0x10C1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1040, 0x3060, 0x60A0, 0x5122, 0x3A43, 0x33A6, 0x54E9, 0x6DC9, 0x75CA, 0x7DEB, 0x7DEB, 0x7DCB, 0x7DCB, 0x7DEB, 0x7E0B,
+  0x8E6C, 0x968C, 0x8E0B, 0x64A8, 0x3AC5, 0x10C1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x1000, 0x1820, 0x1821, 0x1821, 0x1821,
+  0x1820, 0x1020, 0x0000, 0x0800, 0x2060, 0x3860, 0x50A0, 0x59A3, 0x5386, 0x6529, 0x7E4B, 0x866B, 0x7E0B, 0x6DA9, 0x6D89, 0x6D69,
+  0x6D69, 0x6D89, 0x6D8A, 0x6D49, 0x64E8, 0x5C68, 0x4345, 0x2A03, 0x08A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x3842,
+  0x5883, 0x68A4, 0x70A4, 0x78C4, 0x78C4, 0x68A4, 0x5083, 0x3042, 0x2841, 0x3881, 0x4880, 0x50E1, 0x61E3, 0x7387, 0x7C89, 0x8D2A,
+  0x8D4A, 0x856A, 0x6D29, 0x6D49, 0x7D8A, 0x7D6A, 0x7529, 0x74A8, 0x4BC7, 0x2264, 0x1182, 0x10C1, 0x10A1, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1820, 0x3862, 0x60A3, 0x80C5, 0xA0E5, 0xB106, 0xB926, 0xC127, 0xC127, 0xB126, 0xA106, 0x80C5, 0x68A3, 0x58A2,
+  0x50A1, 0x5101, 0x7183, 0x9A67, 0xAB09, 0xAB48, 0x9B48, 0x9BC9, 0x93E8, 0x8BE8, 0x9C4A, 0x9C2A, 0x9BE9, 0x9347, 0x6205, 0x20A1,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0x60A3, 0xA906, 0xC947, 0xD148, 0xD968, 0xE167, 0xE188, 0xE988, 0xE188, 0xD967, 0xE168,
+  0xD948, 0xB927, 0x8904, 0x68E1, 0x60E1, 0x8904, 0xC146, 0xE168, 0xD9A8, 0xC9C8, 0xC9E8, 0xCA08, 0xCA28, 0xCA28, 0xCA28, 0xD208,
+  0xC9A7, 0xA926, 0x5863, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2021, 0x68A3, 0xA926, 0xE168, 0xF989, 0xF189,
+  0xE989, 0xE989, 0xE189, 0xE988, 0xE188, 0xE188, 0xF189, 0xF9AA, 0xE989, 0xB966, 0x9144, 0x9124, 0xB105, 0xD8C6, 0xE8C7, 0xE908,
+  0xE108, 0xE108, 0xE128, 0xE128, 0xE108, 0xE128, 0xE908, 0xE908, 0xD907, 0xB0E6, 0x68A3, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1821, 0x5883, 0xB127, 0xE968, 0xE989, 0xE168, 0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xE168, 0xE989, 0xE168, 0xD167, 0xC167, 0xC167, 0xC947, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE148, 0xE128,
+  0xE148, 0xE148, 0xD927, 0xE948, 0xE968, 0xB127, 0x5883, 0x1821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x4062, 0x90E5, 0xE168,
+  0xF9A9, 0xD967, 0xC947, 0xD147, 0xD147, 0xD127, 0xD127, 0xD127, 0xD127, 0xD147, 0xD147, 0xD147, 0xD147, 0xD147, 0xD968, 0xD968,
+  0xD988, 0xD988, 0xD9A8, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD988, 0xD188, 0xD167, 0xE9A9, 0xF9C9, 0xE168, 0x90E5,
+  0x4062, 0x0800, 0x0000, 0x0000, 0x2021, 0x78C4, 0xC127, 0xE989, 0xE989, 0xE168, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168, 0xD988, 0xD988, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD147, 0xE188, 0xE989, 0xE989, 0xC127, 0x78C4, 0x2021, 0x0000, 0x0000, 0x0000, 0x2841, 0x98E5, 0xE168,
+  0xE188, 0xD947, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE188,
+  0xE168, 0x98E5, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x4062, 0xA906, 0xE989, 0xE988, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE988, 0xE989, 0xA906, 0x4062, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x5083, 0xB126, 0xF189, 0xE188, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD147, 0xE188, 0xF189, 0xB126, 0x5083, 0x0000, 0x0000, 0x0000, 0x0800, 0x5083, 0xB926, 0xF189, 0xE189, 0xD147,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE189, 0xF189, 0xB926,
+  0x5083, 0x0800, 0x0000, 0x0000, 0x0800, 0x5083, 0xB926, 0xF189, 0xE189, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE189, 0xF189, 0xB926, 0x5883, 0x0800, 0x0000, 0x0000, 0x0800, 0x5083,
+  0xB926, 0xF189, 0xE189, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD147, 0xE189, 0xF189, 0xB926, 0x5883, 0x0800, 0x0000, 0x0000, 0x0800, 0x5083, 0xB926, 0xF189, 0xE189, 0xD147, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE189, 0xF189, 0xB926, 0x5083, 0x0800,
+  0x0000, 0x0000, 0x0800, 0x5083, 0xB126, 0xF189, 0xE989, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE989, 0xF189, 0xB126, 0x5083, 0x0800, 0x0000, 0x0000, 0x0000, 0x4862, 0xA906, 0xE989,
+  0xE989, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE989,
+  0xE989, 0xA906, 0x4862, 0x0000, 0x0000, 0x0000, 0x0000, 0x4062, 0xA906, 0xE189, 0xE989, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE989, 0xE189, 0xA906, 0x4062, 0x0000, 0x0000, 0x0000,
+  0x3042, 0xA106, 0xE168, 0xE989, 0xD947, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD947, 0xE989, 0xE168, 0xA106, 0x3042, 0x0000, 0x0000, 0x2841, 0x88E5, 0xD147, 0xE989, 0xE168, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE989, 0xD147, 0x88E5, 0x2841, 0x0000, 0x0000,
+  0x2021, 0x80C4, 0xC127, 0xE989, 0xE168, 0xD968, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147,
+  0xD968, 0xE168, 0xE989, 0xC127, 0x80C4, 0x2021, 0x0000, 0x0000, 0x1821, 0x68A4, 0xB106, 0xE168, 0xE989, 0xE168, 0xD127, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD127, 0xE168, 0xE989, 0xE168, 0xB106, 0x68A4, 0x1821, 0x0000, 0x0000,
+  0x1020, 0x4863, 0x98E5, 0xD968, 0xF189, 0xE168, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147,
+  0xE168, 0xF189, 0xD968, 0x98E5, 0x4863, 0x1020, 0x0000, 0x0000, 0x0000, 0x3041, 0x78C4, 0xD148, 0xF189, 0xE168, 0xD147, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE168, 0xF189, 0xD148, 0x78C4, 0x3041, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1820, 0x60A3, 0xB926, 0xF189, 0xE168, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD147, 0xE168, 0xF189, 0xB926, 0x60A3, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3862, 0xA906, 0xE988,
+  0xE188, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE188, 0xE988, 0xA906, 0x3862, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x88E5, 0xD147, 0xE988, 0xD947, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD947, 0xE988, 0xD147, 0x88E5, 0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1821, 0x68A4, 0xB106,
+  0xE168, 0xE168, 0xE168, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE168, 0xE168, 0xE168, 0xB106, 0x68A3, 0x1820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3862, 0x80C4, 0xD968, 0xF189, 0xE168, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD147, 0xE168, 0xF189, 0xD947, 0x80C4, 0x3862, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0800, 0x5083, 0xB926, 0xF189, 0xE188, 0xD147, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xE168, 0xF189, 0xB926, 0x5083, 0x0800,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0x88E5, 0xD147, 0xE989, 0xE188, 0xD968, 0xD147,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968,
+  0xD147, 0xD968, 0xE188, 0xE989, 0xD147, 0x88E5, 0x2841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x5082, 0xA0E5,
+  0xE168, 0xF189, 0xD947, 0xC927, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD147, 0xD147, 0xD147, 0xD147, 0xD147, 0xD147, 0xD968,
+  0xD968, 0xD968, 0xD968, 0xD968, 0xC927, 0xD947, 0xF189, 0xE168, 0xA0E5, 0x4863, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1821, 0x68A3, 0xC147, 0xF189, 0xF189, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xE168, 0xE168, 0xE168,
+  0xE168, 0xE168, 0xE168, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xD968, 0xF189, 0xF189, 0xC147, 0x6083, 0x1821, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x80C4, 0xD147, 0xF189, 0xF189, 0xE188, 0xD147, 0xD968, 0xD968,
+  0xE168, 0xE989, 0xF189, 0xF189, 0xF189, 0xF189, 0xE989, 0xE168, 0xD968, 0xD968, 0xD147, 0xE188, 0xF189, 0xF189, 0xD147, 0x80C4,
+  0x2041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3861, 0x78C4, 0xB927, 0xD148, 0xD967, 0xD968, 0xD968,
+  0xD968, 0xD947, 0xD147, 0xC927, 0xC947, 0xC947, 0xC927, 0xD147, 0xD947, 0xD968, 0xD968, 0xD968, 0xD967, 0xD148, 0xB927, 0x78C4,
+  0x3861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2841, 0x70C4, 0xA926, 0xC947, 0xE168, 0xE188, 0xD147,
+  0xC947, 0xA906, 0x98E5, 0x80C4, 0x80C4, 0x98E5, 0xA906, 0xC947, 0xD147, 0xE188, 0xE168, 0xC947, 0xA926, 0x70C4, 0x2841, 0x0800,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4062, 0x80C5, 0xC127, 0xE188, 0xE188, 0xD147, 0xC127, 0x98E5, 0x78C4,
+  0x5883, 0x5883, 0x78C4, 0x98E5, 0xC127, 0xD147, 0xE188, 0xE188, 0xC127, 0x80C5, 0x4062, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_APPLE_44_SPANS = {
+  SPRITE_APPLE_44_SPAN_ROWS, SPRITE_APPLE_44_SPAN_OPS, SPRITE_APPLE_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_APPLE_44_ASSET = {
   SPRITE_APPLE_44_WIDTH, SPRITE_APPLE_44_HEIGHT,
-  SPRITE_APPLE_44_ALPHA, SPRITE_APPLE_44_RGB565
+  nullptr, nullptr, &SPRITE_APPLE_44_SPANS
 };
 
 #endif // SPRITE_APPLE_44_INCLUDED
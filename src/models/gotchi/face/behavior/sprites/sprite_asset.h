@@ -3,21 +3,52 @@
 
 #include <cstdint>
 
+// Sprite encodé en runs par ligne (produit par png_to_sprite_rgba.py, format
+// par défaut). Seuls les pixels visibles sont stockés :
+//   - rows : 2 offsets par ligne (début dans ops, début dans px) → clipping
+//     vertical sans décoder les lignes sautées
+//   - ops  : octets de contrôle, 2 bits de type + 6 bits (longueur - 1)
+//       SPAN_SKIP   : transparent, rien à lire
+//       SPAN_OPAQUE : alpha 255, couleurs copiées telles quelles
+//       SPAN_BLEND  : alpha partiel, suivi de <longueur> octets d'alpha
+//       SPAN_EOL    : fin de ligne (le transparent de fin de ligne est implicite)
+//   - px   : couleurs RGB565 des runs OPAQUE et BLEND, dans l'ordre. Les
+//     couleurs des runs BLEND sont pré-multipliées par leur alpha (sur 5 bits,
+//     voir Blend565::overPremul)
+struct SpriteSpans {
+  const uint16_t* rows;  // PROGMEM, h*2 words
+  const uint8_t* ops;    // PROGMEM
+  const uint16_t* px;    // PROGMEM
+};
+
+constexpr uint8_t SPAN_TYPE_MASK = 0xC0;
+constexpr uint8_t SPAN_LEN_MASK  = 0x3F;
+constexpr uint8_t SPAN_SKIP      = 0x00;
+constexpr uint8_t SPAN_OPAQUE    = 0x40;
+constexpr uint8_t SPAN_BLEND     = 0x80;
+constexpr uint8_t SPAN_EOL       = 0xC0;
+
 // Décrit un sprite stocké en PROGMEM.
 //
-// Deux modes :
+// Trois modes :
 //   - alpha-only (rgb565 == nullptr) : 1 byte/pixel = alpha. La couleur est
 //     fournie au runtime → permet de coloriser dynamiquement (étoile jaune,
 //     bleue, blanche selon le contexte). Format produit par png_to_sprite.py.
 //
 //   - rgba (rgb565 != nullptr) : 2 bytes/pixel pour la couleur native + 1
 //     byte/pixel pour l'alpha. Le sprite garde ses couleurs d'origine, idéal
-//     pour les emojis multi-couleur. Format produit par png_to_sprite_rgba.py.
+//     pour les emojis multi-couleur. png_to_sprite_rgba.py --format flat.
+//
+//   - spans (spans != nullptr, alpha == rgb565 == nullptr) : rgba encodé en
+//     runs, voir SpriteSpans. Format par défaut de png_to_sprite_rgba.py.
+//
+// Toujours dessiner via SpriteBlit::blit() qui gère les trois modes.
 struct SpriteAsset {
   uint16_t width;
   uint16_t height;
-  const uint8_t* alpha;    // PROGMEM, w*h bytes, toujours présent
-  const uint16_t* rgb565;  // PROGMEM, w*h words, nullptr si mono-alpha
+  const uint8_t* alpha;       // PROGMEM, w*h bytes, nullptr si spans
+  const uint16_t* rgb565;     // PROGMEM, w*h words, nullptr si mono-alpha ou spans
+  const SpriteSpans* spans = nullptr;
 };
 
 #endif // GOTCHI_SPRITE_ASSET_H
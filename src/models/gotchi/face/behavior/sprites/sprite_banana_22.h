@@ -5,66 +5,72 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from banana_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from banana_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 316/484 pixels visibles, 1183 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_BANANA_22_WIDTH = 22;
 constexpr uint16_t SPRITE_BANANA_22_HEIGHT = 22;
 
-const uint16_t SPRITE_BANANA_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4F, 0x0000, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFF56, 0xFFD8, 0xFF56, 0x0000, 0xFFEF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xF800, 0xFF56, 0xFF36, 0xFFF8, 0xFF56, 0xFF57, 0x0000, 0xFBEF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFF5, 0x0000, 0xFF36, 0xFF77, 0xFF36, 0xFF97, 0xFF35, 0x0000, 0xFDF7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFF7, 0x0000, 0xFF56, 0xFFD8, 0xFF56, 0xFF74, 0xFF35, 0x0000, 0xFFF7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFF5, 0xFDF7, 0xFFFF, 0xFD55, 0xFFF7, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFF36, 0xFFB8, 0xFF36, 0xFF52, 0xFF36, 0x0000, 0xFFF7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE79, 0xFBEF, 0xFF56, 0xFF77, 0xFF57, 0xFF14, 0xFF52, 0xFF56, 0x0000, 0xFFF7,
-  0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0xFD4A, 0xFF77, 0xFF77, 0xFF57, 0xFF56, 0xFF77, 0xFF36, 0x0000, 0x0000, 0xFF56, 0xFFB8, 0xFF57, 0xFEF2, 0xFF52, 0xFF57, 0x0000, 0xFFF5,
-  0x0000, 0x0000, 0xFBEF, 0x0000, 0xFF36, 0xFF97, 0xFF97, 0xFFD8, 0xFFF9, 0xFFF9, 0xFFF8, 0xFF98, 0xFF57, 0xFF56, 0xFF97, 0xFF56, 0xFF36, 0xFED0, 0xFF13, 0xFF79, 0x0000, 0xFFFF,
-  0x0000, 0xFFFF, 0xFFFF, 0xFF56, 0xFF77, 0xFFB7, 0xFFB7, 0xFF56, 0xFF56, 0xFF36, 0xFE8C, 0xFECC, 0xFF33, 0xFF57, 0xFF56, 0xFF57, 0xFF14, 0xFEF0, 0xFF15, 0xFFFF, 0x0000, 0xFFE0,
-  0x0000, 0xFDF7, 0x0000, 0xFF36, 0xFFF9, 0xFF56, 0xFF77, 0xFF37, 0x0000, 0x0000, 0xFE24, 0xFE48, 0xFE8A, 0xFF56, 0xFF36, 0xFF36, 0xFED0, 0xFF73, 0xFF56, 0x0000, 0xFFFF, 0x0000,
-  0xFFFF, 0xFFE0, 0xFF96, 0xFF57, 0xFF97, 0xFF77, 0x0000, 0x0000, 0xFEB5, 0x0000, 0xFE49, 0xFEAA, 0xFE49, 0xFF14, 0xFF58, 0xFF14, 0xFEF2, 0xFF34, 0xFF7A, 0xFFFF, 0xFFFF, 0x0000,
-  0xFFFF, 0x0000, 0xFF57, 0xFF77, 0xFEB3, 0x0000, 0xFEEF, 0x0000, 0x0000, 0xFE6A, 0xFECB, 0xFE6A, 0xFE49, 0xFE8C, 0xFEF2, 0xFF57, 0xFF57, 0xFF77, 0xFF36, 0x0000, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFF3, 0x0000, 0xFE06, 0xFEAD, 0xFF30, 0xFED0, 0xFED0, 0xFEAD, 0xFE48, 0xFE48, 0xFED0, 0xFF57, 0xFF56, 0xFFF8, 0xFF36, 0x0000, 0xFFF5,
-  0x0000, 0x0000, 0x0000, 0xFFF5, 0x0000, 0x0000, 0xFE8B, 0xFECE, 0xFF31, 0xFED0, 0xFED0, 0xFED0, 0xFE8C, 0xFE49, 0xFE69, 0xFE89, 0xFF12, 0xFF57, 0xFF77, 0xFF56, 0xFF16, 0x0000,
-  0x0000, 0xFFE0, 0xFDE7, 0x0000, 0xFDA1, 0xFE8C, 0xFF10, 0xFEF1, 0xFEB0, 0xFED0, 0xFED0, 0xFE8C, 0xFE49, 0xFE69, 0xFEEA, 0xFE48, 0xFF14, 0xFF57, 0xFF36, 0xFF97, 0xFF36, 0x0000,
-  0xFFE0, 0x0000, 0x0000, 0xFE27, 0xFECD, 0xFF31, 0xFED0, 0xFED0, 0xFED0, 0xFEAF, 0xFE6A, 0xFE49, 0xFE69, 0xFEEA, 0xFE69, 0xFFFF, 0xFFFF, 0xFF36, 0xFF77, 0xFF97, 0xFF36, 0x0000,
-  0x0000, 0xFFE4, 0xFE8B, 0xFEEE, 0xFF11, 0xFED0, 0xFED0, 0xFECF, 0xFE8C, 0xFE49, 0xFE49, 0xFE8A, 0xFEAA, 0xFE69, 0x0000, 0xFFF5, 0xFF97, 0xFF36, 0xFF77, 0xFF56, 0xFF57, 0x0000,
-  0xDCC9, 0xFDE9, 0xFF0D, 0xFEAF, 0xFEAE, 0xFE8D, 0xFE6B, 0xFE69, 0xFE49, 0xFE69, 0xFECA, 0xFE89, 0xFE6A, 0x0000, 0x0000, 0x0000, 0xFED2, 0xFF77, 0xFF77, 0xFF56, 0xFFF7, 0xFFFF,
-  0xC369, 0xF4AB, 0xFE89, 0xFE69, 0xFE69, 0xFE89, 0xFE89, 0xFECA, 0xFECA, 0xFE69, 0xFEAA, 0xFFE5, 0x0000, 0x0000, 0xFE27, 0xFF12, 0xFF35, 0xFF77, 0xFFD8, 0xFF56, 0x0000, 0xFFF5,
-  0xDCAA, 0xF5A9, 0xFE89, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFEAA, 0x0AC4, 0x7DAC, 0xAEB1, 0xEE6B, 0xFF33, 0xFFF9, 0xFFB8, 0xFF77, 0xFF36, 0x0000, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0xDDEB, 0xFE69, 0xFE69, 0xFE69, 0xFFE7, 0x0000, 0x0000, 0x0000, 0x43A3, 0x6D09, 0xBEF1, 0xF66B, 0xFF37, 0xFF57, 0xFF56, 0xFF37, 0x0000, 0xFFFF, 0x0000, 0x0000
+const uint16_t SPRITE_BANANA_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 7, 2, 19, 7, 33, 15, 49, 22, 63, 29, 88, 43, 106, 53,
+  132, 68, 155, 86, 182, 106, 208, 122, 234, 140, 260, 156, 280, 171, 301, 187,
+  326, 206, 351, 225, 375, 244, 399, 263, 418, 282, 441, 302
 };
 
-const uint8_t SPRITE_BANANA_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x55, 0xD5, 0x6F, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0D, 0xEA, 0xFF, 0xF8, 0x1A, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3D, 0xFF, 0xF9, 0xFF, 0x50, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x78, 0xFE, 0xF7, 0xFE, 0x6B, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02, 0x00, 0x01, 0x00, 0xC4, 0xFF, 0xF9, 0xFF, 0x71, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x2E, 0xFB, 0xFE, 0xFB, 0xFF, 0x65, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x52, 0x97, 0xB4, 0xAF, 0x80, 0x31, 0x00, 0x00, 0xA7, 0xFF, 0xFB, 0xFC, 0xFF, 0x4C, 0x00, 0x03,
-  0x00, 0x00, 0x02, 0x00, 0x40, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x7C, 0x48, 0xFE, 0xFD, 0xFE, 0xFF, 0xFC, 0x2A, 0x00, 0x02,
-  0x00, 0x02, 0x01, 0x33, 0xF6, 0xFF, 0xFF, 0xEB, 0x9D, 0x54, 0x93, 0xFF, 0xFF, 0xFA, 0xFF, 0xFE, 0xFD, 0xFF, 0xDE, 0x06, 0x00, 0x01,
-  0x00, 0x04, 0x00, 0x90, 0xFF, 0xF4, 0x8B, 0x1E, 0x00, 0x00, 0x0D, 0xF6, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x96, 0x00, 0x03, 0x00,
-  0x01, 0x01, 0x11, 0xEB, 0xE0, 0x3A, 0x00, 0x00, 0x06, 0x00, 0x97, 0xFF, 0xFC, 0xFE, 0xFF, 0xFE, 0xFE, 0xF2, 0x1C, 0x01, 0x02, 0x00,
-  0x01, 0x00, 0x0C, 0x59, 0x18, 0x00, 0x08, 0x00, 0x00, 0x81, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF4, 0x71, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1D, 0xB5, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x53, 0xE7, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF2, 0xFE, 0xFD, 0xEE, 0x11, 0x00,
-  0x00, 0x01, 0x04, 0x00, 0x11, 0x9A, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xA0, 0x34, 0xFB, 0xFE, 0xFF, 0x40, 0x00,
-  0x01, 0x00, 0x00, 0x49, 0xD9, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xA7, 0x01, 0x07, 0xE6, 0xFF, 0xFE, 0x49, 0x00,
-  0x00, 0x07, 0x90, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0x85, 0x00, 0x03, 0x13, 0xED, 0xFF, 0xFD, 0x28, 0x00,
-  0x14, 0xBA, 0xFF, 0xFC, 0xFC, 0xFE, 0xFD, 0xFC, 0xFB, 0xFF, 0xFF, 0xE6, 0x54, 0x00, 0x00, 0x00, 0x5C, 0xFE, 0xFD, 0xD5, 0x04, 0x01,
-  0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x8A, 0x06, 0x00, 0x00, 0x1F, 0x6F, 0xEE, 0xFF, 0xFF, 0x5B, 0x00, 0x03,
-  0x18, 0x96, 0xD7, 0xEE, 0xF6, 0xE8, 0xD3, 0xB0, 0x70, 0x1F, 0x1F, 0x4F, 0x62, 0x9F, 0xFF, 0xFF, 0xFF, 0xF2, 0x76, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x1A, 0x1F, 0x15, 0x04, 0x00, 0x00, 0x00, 0xAC, 0xFF, 0xA9, 0x81, 0x6C, 0x66, 0x64, 0x28, 0x00, 0x01, 0x00, 0x00
+const uint8_t SPRITE_BANANA_22_SPAN_OPS[] PROGMEM = {
+  0x10, 0x80, 0x06, 0x00, 0x80, 0x01, 0xC0, 0x0D, 0x80, 0x02, 0x00, 0x82, 0x55, 0xD5, 0x6F, 0x00, 0x80, 0x02, 0xC0, 0x0C, 0x83, 0x01, 0x01, 0x0D,
+  0xEA, 0x40, 0x81, 0xF8, 0x1A, 0x00, 0x80, 0x02, 0xC0, 0x0C, 0x80, 0x03, 0x00, 0x80, 0x3D, 0x40, 0x80, 0xF9, 0x40, 0x80, 0x50, 0x00, 0x80, 0x04,
+  0xC0, 0x0C, 0x80, 0x04, 0x00, 0x84, 0x78, 0xFE, 0xF7, 0xFE, 0x6B, 0x00, 0x80, 0x04, 0xC0, 0x04, 0x86, 0x01, 0x03, 0x04, 0x02, 0x03, 0x04, 0x02,
+  0x00, 0x80, 0x01, 0x00, 0x80, 0xC4, 0x40, 0x80, 0xF9, 0x40, 0x80, 0x71, 0x00, 0x80, 0x04, 0xC0, 0x03, 0x80, 0x02, 0x06, 0x85, 0x05, 0x02, 0x2E,
+  0xFB, 0xFE, 0xFB, 0x40, 0x80, 0x65, 0x00, 0x80, 0x04, 0xC0, 0x02, 0x80, 0x02, 0x00, 0x86, 0x03, 0x52, 0x97, 0xB4, 0xAF, 0x80, 0x31, 0x01, 0x80,
+  0xA7, 0x40, 0x81, 0xFB, 0xFC, 0x40, 0x80, 0x4C, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x81, 0x40, 0xCE, 0x44, 0x85, 0xFD, 0x7C, 0x48,
+  0xFE, 0xFD, 0xFE, 0x40, 0x81, 0xFC, 0x2A, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x83, 0x02, 0x01, 0x33, 0xF6, 0x41, 0x83, 0xEB, 0x9D, 0x54, 0x93, 0x41,
+  0x80, 0xFA, 0x40, 0x81, 0xFE, 0xFD, 0x40, 0x81, 0xDE, 0x06, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x04, 0x00, 0x80, 0x90, 0x40, 0x82, 0xF4, 0x8B,
+  0x1E, 0x01, 0x82, 0x0D, 0xF6, 0xFD, 0x42, 0x80, 0xFB, 0x40, 0x80, 0x96, 0x00, 0x80, 0x03, 0xC0, 0x85, 0x01, 0x01, 0x11, 0xEB, 0xE0, 0x3A, 0x01,
+  0x80, 0x06, 0x00, 0x80, 0x97, 0x40, 0x81, 0xFC, 0xFE, 0x40, 0x85, 0xFE, 0xFE, 0xF2, 0x1C, 0x01, 0x02, 0xC0, 0x80, 0x01, 0x00, 0x82, 0x0C, 0x59,
+  0x18, 0x00, 0x80, 0x08, 0x01, 0x80, 0x81, 0x40, 0x80, 0xFD, 0x42, 0x83, 0xFE, 0xFD, 0xF4, 0x71, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x05, 0x00,
+  0x81, 0x1D, 0xB5, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFD, 0x42, 0x80, 0x6D, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x06, 0x01, 0x81, 0x53, 0xE7, 0x40,
+  0x80, 0xFB, 0x43, 0x80, 0xFD, 0x40, 0x84, 0xF2, 0xFE, 0xFD, 0xEE, 0x11, 0xC0, 0x00, 0x81, 0x01, 0x04, 0x00, 0x81, 0x11, 0x9A, 0x41, 0x80, 0xFC,
+  0x42, 0x81, 0xFE, 0xFA, 0x40, 0x83, 0xA0, 0x34, 0xFB, 0xFE, 0x40, 0x80, 0x40, 0xC0, 0x80, 0x01, 0x01, 0x81, 0x49, 0xD9, 0x40, 0x81, 0xFD, 0xFE,
+  0x42, 0x81, 0xFD, 0xFC, 0x40, 0x83, 0xA7, 0x01, 0x07, 0xE6, 0x40, 0x81, 0xFE, 0x49, 0xC0, 0x00, 0x81, 0x07, 0x90, 0x41, 0x80, 0xFC, 0x42, 0x81,
+  0xFE, 0xFB, 0x41, 0x80, 0x85, 0x00, 0x82, 0x03, 0x13, 0xED, 0x40, 0x81, 0xFD, 0x28, 0xC0, 0x81, 0x14, 0xBA, 0x40, 0x85, 0xFC, 0xFC, 0xFE, 0xFD,
+  0xFC, 0xFB, 0x41, 0x81, 0xE6, 0x54, 0x02, 0x85, 0x5C, 0xFE, 0xFD, 0xD5, 0x04, 0x01, 0xC0, 0x80, 0x6D, 0x47, 0x82, 0xF4, 0x8A, 0x06, 0x01, 0x82,
+  0x1F, 0x6F, 0xEE, 0x41, 0x80, 0x5B, 0x00, 0x80, 0x03, 0xC0, 0x8D, 0x18, 0x96, 0xD7, 0xEE, 0xF6, 0xE8, 0xD3, 0xB0, 0x70, 0x1F, 0x1F, 0x4F, 0x62,
+  0x9F, 0x42, 0x81, 0xF2, 0x76, 0x00, 0x80, 0x02, 0xC0, 0x01, 0x84, 0x08, 0x1A, 0x1F, 0x15, 0x04, 0x02, 0x80, 0xAC, 0x40, 0x85, 0xA9, 0x81, 0x6C,
+  0x66, 0x64, 0x28, 0x00, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_BANANA_22_SPAN_PX[] PROGMEM = {
+  0x0020, 0x0000, 0x0000, 0x5267, 0xD694, 0x6B29, 0x0000, 0x0000, 0x0000, 0x0861, 0xE673, 0xFFF8, 0xF715, 0x10A2, 0x0000, 0x0000,
+  0x39C5, 0xFF77, 0xF6F5, 0xFF97, 0x4A26, 0x0020, 0x0020, 0x736A, 0xFFD8, 0xF715, 0xFF74, 0x62E8, 0x0020, 0x0000, 0x0000, 0x0020,
+  0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0xC591, 0xFFB8, 0xF6F5, 0xFF52, 0x6B09, 0x0020, 0x0000, 0x0020, 0x0000, 0x2944, 0xF736,
+  0xFF57, 0xF6D3, 0xFF52, 0x62E8, 0x0020, 0x0000, 0x0000, 0x4A47, 0x946D, 0xB530, 0xACEF, 0x7BAB, 0x2944, 0xA4CE, 0xFFB8, 0xF716,
+  0xFEF2, 0xFF52, 0x4A47, 0x0000, 0x0000, 0x39C5, 0xCE12, 0xFF97, 0xFFD8, 0xFFF9, 0xFFF9, 0xFFF8, 0xFF98, 0x7BAB, 0x4206, 0xFF97,
+  0xFF56, 0xFF36, 0xFED0, 0xFF13, 0x2123, 0x0000, 0x0000, 0x0000, 0x2944, 0xF736, 0xFFB7, 0xFFB7, 0xE693, 0x9C8D, 0x5267, 0x8BA6,
+  0xFECC, 0xFF33, 0xF716, 0xFF56, 0xFF57, 0xFF14, 0xFEF0, 0xDE32, 0x0020, 0x0000, 0x0020, 0x8C0C, 0xFFF9, 0xF715, 0x83EC, 0x18E2,
+  0x0860, 0xF607, 0xFE8A, 0xFF56, 0xFF36, 0xFF36, 0xF68F, 0xFF73, 0x944D, 0x0000, 0x0000, 0x0000, 0x0861, 0xE694, 0xDE94, 0x3185,
+  0x0020, 0x93A5, 0xFEAA, 0xFE49, 0xFF14, 0xFF58, 0xFF14, 0xFEF2, 0xEEB2, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0861, 0x5287, 0x1081,
+  0x0020, 0x7B25, 0xFECB, 0xFE6A, 0xFE49, 0xFE8C, 0xFEF2, 0xFF57, 0xFF57, 0xF736, 0x6B09, 0x0000, 0x0020, 0x18C0, 0xB4C9, 0xFF30,
+  0xFED0, 0xFED0, 0xFEAD, 0xFE48, 0xFE48, 0xFED0, 0xFF57, 0xFF56, 0xFFF8, 0x6B09, 0x0000, 0x0020, 0x4A03, 0xE60C, 0xFF31, 0xF68F,
+  0xFED0, 0xFED0, 0xFE8C, 0xFE49, 0xFE69, 0xFE89, 0xEE90, 0xFF57, 0xFF77, 0xEED4, 0x0861, 0x0000, 0x0020, 0x0840, 0x93C7, 0xFF10,
+  0xFEF1, 0xFEB0, 0xFED0, 0xFED0, 0xFE8C, 0xFE49, 0xF628, 0xFEEA, 0x9BE5, 0x3184, 0xF716, 0xFF36, 0xFF97, 0x39C5, 0x0000, 0x41A1,
+  0xD5AA, 0xFF31, 0xFED0, 0xFED0, 0xFED0, 0xFEAF, 0xFE6A, 0xFE49, 0xFE69, 0xFEEA, 0xA425, 0x0000, 0x0020, 0xE673, 0xFF77, 0xFF97,
+  0x4206, 0x0020, 0x8BA6, 0xFEEE, 0xFF11, 0xFED0, 0xFED0, 0xFECF, 0xFE8C, 0xFE49, 0xF608, 0xFE8A, 0xFEAA, 0x8364, 0x0000, 0x0861,
+  0xEEB4, 0xFF77, 0xFF56, 0x2123, 0x1060, 0xB426, 0xFF0D, 0xFEAF, 0xFEAE, 0xFE8D, 0xFE6B, 0xFE69, 0xF608, 0xFE69, 0xFECA, 0xE5E8,
+  0x5223, 0x5A86, 0xFF77, 0xFF77, 0xD612, 0x0020, 0x0000, 0x5163, 0xF4AB, 0xFE89, 0xFE69, 0xFE69, 0xFE89, 0xFE89, 0xFECA, 0xFECA,
+  0xF628, 0x8385, 0x0020, 0x18C0, 0x6B07, 0xEEB3, 0xFF77, 0xFFD8, 0x5267, 0x0000, 0x1060, 0x8B45, 0xD567, 0xEDC8, 0xF628, 0xE5A8,
+  0xCD27, 0xAC66, 0x6AC3, 0x18C1, 0x0040, 0x21C3, 0x3A66, 0x93E6, 0xFF33, 0xFFF9, 0xFFB8, 0xEEF5, 0x734A, 0x0000, 0x0020, 0x1080,
+  0x18C1, 0x1080, 0x0020, 0x2A62, 0x6D09, 0x7C8B, 0x7B25, 0x6B0A, 0x62E9, 0x62E8, 0x2103, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_BANANA_22_SPANS = {
+  SPRITE_BANANA_22_SPAN_ROWS, SPRITE_BANANA_22_SPAN_OPS, SPRITE_BANANA_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_BANANA_22_ASSET = {
   SPRITE_BANANA_22_WIDTH, SPRITE_BANANA_22_HEIGHT,
-  SPRITE_BANANA_22_ALPHA, SPRITE_BANANA_22_RGB565
+  nullptr, nullptr, &SPRITE_BANANA_22_SPANS
 };
 
 #endif // SPRITE_BANANA_22_INCLUDED
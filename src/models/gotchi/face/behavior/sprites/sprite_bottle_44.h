@@ -5,110 +5,106 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from bottle_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from bottle_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 750/1936 pixels visibles, 2247 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_BOTTLE_44_WIDTH = 44;
 constexpr uint16_t SPRITE_BOTTLE_44_HEIGHT = 44;
 
-const uint16_t SPRITE_BOTTLE_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE5A, 0xCE5A, 0xCE5A, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xCE5A, 0xCE5A, 0xCE5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0x95BB, 0x95BB, 0x95BB, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0x95BB, 0x95BB, 0x95BB, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0x95BB, 0x95BB, 0x95BB, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xDF5F, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xFFDE, 0xDF5F, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xDF5F, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xDF5F, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDF5F, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xDF5F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_BOTTLE_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 3, 5, 6, 14, 9, 27, 12, 40, 15, 55, 18, 70, 21, 85,
+  24, 100, 27, 115, 30, 130, 33, 143, 36, 160, 39, 179, 42, 200, 45, 221,
+  63, 240, 83, 257, 103, 274, 125, 293, 147, 312, 169, 331, 191, 350, 213, 369,
+  235, 388, 257, 407, 279, 426, 301, 445, 323, 464, 345, 483, 367, 502, 389, 521,
+  411, 540, 433, 559, 455, 578, 477, 597, 499, 616, 521, 635, 543, 654, 552, 671,
+  559, 688, 562, 705, 565, 722, 568, 737
 };
 
-const uint8_t SPRITE_BOTTLE_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_BOTTLE_44_SPAN_OPS[] PROGMEM = {
+  0x13, 0x44, 0xC0, 0x11, 0x48, 0xC0, 0x0F, 0x4C, 0xC0, 0x0F, 0x4C, 0xC0, 0x0E, 0x4E, 0xC0, 0x0E, 0x4E, 0xC0, 0x0E, 0x4E, 0xC0, 0x0E, 0x4E, 0xC0,
+  0x0E, 0x4E, 0xC0, 0x0E, 0x4E, 0xC0, 0x0F, 0x4C, 0xC0, 0x0D, 0x50, 0xC0, 0x0C, 0x52, 0xC0, 0x0B, 0x54, 0xC0, 0x0B, 0x54, 0xC0, 0x0C, 0x42, 0x8C,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x42, 0xC0, 0x0D, 0x90, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0D, 0x90, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C,
+  0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0,
+  0xF0, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0, 0xFA, 0x78,
+  0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xB4, 0xB4, 0xB4, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0,
+  0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C,
+  0x92, 0xF0, 0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0,
+  0xF0, 0xFA, 0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xFA,
+  0xFA, 0x78, 0x78, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xC0, 0x0C, 0x92, 0xF0, 0xF0, 0xF0, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF0, 0xF0, 0xF0, 0xC0, 0x0D, 0x81, 0xF0, 0xF0, 0x4C, 0x81, 0xF0, 0xF0, 0xC0,
+  0x0D, 0x80, 0xF0, 0x4E, 0x80, 0xF0, 0xC0, 0x0D, 0x50, 0xC0, 0x0D, 0x50, 0xC0, 0x0E, 0x4E, 0xC0, 0x0F, 0x4C, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_BOTTLE_44_SPAN_PX[] PROGMEM = {
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xCE5A,
+  0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCE5A, 0xCE5A, 0xCE5A,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x6413, 0x6413, 0x6413, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE,
+  0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0x6413, 0x6413, 0x6413, 0x73AE, 0x73AE,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D,
+  0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0x6413, 0x6413, 0x6413,
+  0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D, 0x73AE, 0x73AE, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xF79D, 0xF79D,
+  0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xCEDD,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B
+};
+
+inline constexpr SpriteSpans SPRITE_BOTTLE_44_SPANS = {
+  SPRITE_BOTTLE_44_SPAN_ROWS, SPRITE_BOTTLE_44_SPAN_OPS, SPRITE_BOTTLE_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_BOTTLE_44_ASSET = {
   SPRITE_BOTTLE_44_WIDTH, SPRITE_BOTTLE_44_HEIGHT,
-  SPRITE_BOTTLE_44_ALPHA, SPRITE_BOTTLE_44_RGB565
+  nullptr, nullptr, &SPRITE_BOTTLE_44_SPANS
 };
 
 #endif // SPRITE_BOTTLE_44_INCLUDED
@@ -5,154 +5,256 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from bottle_66.png (66x66)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from bottle_66.png (66x66) — RGBA multi-couleur, encodé en spans
+// 2048/4356 pixels visibles, 6511 bytes flash (flat : 13068). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_BOTTLE_66_WIDTH = 66;
 constexpr uint16_t SPRITE_BOTTLE_66_HEIGHT = 66;
 
-const uint16_t SPRITE_BOTTLE_66_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xD3EF, 0xFC92, 0xFBEF, 0x0000, 0x0000, 0xEC4E, 0xEC4F, 0xFCF0, 0xEC6F, 0xEC6F, 0xEC6F, 0xFC8F, 0xFCD0, 0xEC4E, 0x0000, 0x0000, 0x0000, 0xFC92, 0xFC92, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEC6E, 0xFCF0, 0xEC4E, 0xEC6F, 0xFCAF, 0xEC4E, 0xEC6F, 0xEC4E, 0xF46F, 0xFC8F, 0xEC6E, 0xFC8F, 0xFCD0, 0xEC2E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xFBEA, 0xF44F, 0xFCEF, 0xEC6E, 0xEC4F, 0xFD52, 0xFCB0, 0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xEC4E, 0xF48F, 0xFD11, 0xFD31, 0xEC4F, 0xF46F, 0xFCAF, 0xF42F, 0xF800, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFCD3, 0xFD4A, 0xF44E, 0xF46F, 0xFCD0, 0xF46F, 0xF46F, 0xFCAF, 0xFC8F, 0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xF46F, 0xFC8F, 0xFCAF, 0xF46E, 0xFC8F, 0xFCB0, 0xEC6F, 0xD3EF, 0xF800, 0xFCD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFC92, 0x0000, 0xBB4A, 0xEC6F, 0xFD72, 0xFCB0, 0xEC6F, 0xEC4E, 0xF44F, 0xEC6F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6E, 0xEC4E, 0xEC4E, 0xF46F, 0xFD11, 0xFD52, 0xEC4E, 0x0000, 0x0000, 0xFC92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xFCD3, 0xEC6F, 0xF48F, 0xF46F, 0xFCD0, 0xF46F, 0xEC6F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6E, 0xF48F, 0xFCB0, 0xF46F, 0xEC6F, 0xFBEF, 0xFCD3, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCD3, 0x0000, 0xF800, 0xEC4E, 0xFCB0, 0xF48F, 0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xFCD0, 0xF46F, 0xEC6E, 0xF800, 0xFCD3, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB6D, 0x0000, 0x0000, 0xEC6F, 0xFD31, 0xFCAF, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xEC4E, 0xFD31, 0xEC6F, 0xEC4E, 0x0000, 0xFB6D, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xEC4F, 0xFCB0, 0xFC8F, 0xF46E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xF46E, 0xFCD0, 0xF46F, 0xEC6E, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xEC4E, 0xFCB0, 0xFC8F, 0xEC6E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xEC6E, 0xFCF0, 0xF46F, 0xEC4E, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xEC4E, 0xFCB0, 0xFC8F, 0xEC6E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xEC6E, 0xFCF0, 0xF46F, 0xEC4E, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xEC4E, 0xFCB0, 0xFC8F, 0xEC6E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xEC6E, 0xFCF0, 0xF46F, 0xEC4E, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xEC4F, 0xFCB0, 0xFC8F, 0xF46E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xF46E, 0xFCD0, 0xF46F, 0xEC6E, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFB6D, 0x07FF, 0x9E79, 0xEC6F, 0xFD52, 0xFCB0, 0xEC4F, 0xF46F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xF46F, 0xEC6F, 0xEC6F, 0xFD52, 0xEC6F, 0xECB0, 0xFFFF, 0xFB6D, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0xF40D, 0xFCAF, 0xFC6F, 0xF46E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xFCD0, 0xF44E, 0xF2E6, 0x0000, 0xFBEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFDF7, 0x0000, 0x0000, 0xFBCA, 0xF42E, 0xFCAF, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xFC6E, 0xFC8F, 0xF42D, 0xF800, 0x0000, 0x0000, 0xD6BA, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xC63C, 0x0000, 0x0000, 0xC619, 0xE77F, 0xBE5A, 0xDD75, 0xE5B5, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xE575, 0xE595, 0xD596, 0xCF1E, 0xDEFD, 0xBDB7, 0x0000, 0xFFFF, 0xDEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xAD57, 0xD69B, 0xCE5A, 0xEF7F, 0xD6BC, 0xC67B, 0xC65B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xCE9B, 0xE71D, 0xE73E, 0xCE7B, 0xC639, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BA, 0x0000, 0x0000, 0xC619, 0xDEDC, 0xD69B, 0xCE7B, 0xCE7B, 0xCE5A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xCE7A, 0xD69B, 0xCE7B, 0xDEFD, 0xC63A, 0xA514, 0x0000, 0xD6BA, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0xBDF7, 0xBDF9, 0xC63A, 0xD6BB, 0xE71D, 0xCE7A, 0xC639, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xC63A, 0xC639, 0xDEFC, 0xD69B, 0xD6BC, 0xC63A, 0xBDF7, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xDEDB, 0x0000, 0xC639, 0xC63A, 0xEF5E, 0xC639, 0xC63A, 0xCE5A, 0xCE5A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE5A, 0xCE5A, 0xC619, 0xD69B, 0xEF7F, 0xC63A, 0x0000, 0x0000, 0xDEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xDEDB, 0x0000, 0xC639, 0xC63A, 0xEF5E, 0xC639, 0xC63A, 0xCE5A, 0xCE5A, 0xCE3A, 0xC639, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC639, 0xC639, 0xCE3A, 0xCE5A, 0xCE5A, 0xC639, 0xD69B, 0xEF7F, 0xC63A, 0x0000, 0x0000, 0xDEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0xBDF7, 0xBDF9, 0xC63A, 0xD6BB, 0xE71D, 0xCE7A, 0xC619, 0xCE5A, 0xCEBC, 0xD6DD, 0xD6DC, 0xD6DD, 0xD6DD, 0xD6DC, 0xD6DC, 0xD6DD, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6DC, 0xD6BC, 0xD6DD, 0xD6DD, 0xCE7B, 0xC619, 0xC619, 0xDEFD, 0xD69B, 0xD6BC, 0xC63A, 0xBDF7, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BA, 0x0000, 0x0000, 0xC619, 0xDEDC, 0xD69C, 0xCE5A, 0xCE9B, 0xDF5F, 0xE79F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF9F, 0xDF9F, 0xD6FD, 0xCE5A, 0xCE5A, 0xDF1D, 0xC65A, 0xA517, 0x0000, 0xD6BA, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xCE59, 0xDF1E, 0xDF3F, 0xE77E, 0xDF3F, 0xDF5F, 0xDF7F, 0xDF5F, 0xDF5F, 0xDF7F, 0xDF5F, 0xDF7F, 0xDF5F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF7F, 0xDF5F, 0xDF3E, 0xDF5F, 0xDF5F, 0xCE7A, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xC63D, 0x0000, 0x0000, 0xDF7F, 0xEFFF, 0xDF7F, 0xDF5F, 0xDF5F, 0xEF9F, 0xEF9F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF7F, 0xDF9F, 0xE7BF, 0xD75F, 0x0000, 0x0000, 0xE73F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xCE7F, 0xD73E, 0xDF5F, 0xDF5F, 0xE77F, 0xDF5F, 0xDF5F, 0xEF9F, 0xFFFF, 0xFFFF, 0xEF9F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF7F, 0xDF7F, 0xD73E, 0xCE7F, 0xCE7F, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE7F, 0x0000, 0xFFFF, 0xDF5F, 0xDF7F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE79F, 0xFFFF, 0xFFFF, 0xE79F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xE71F, 0xFFFF, 0xCE7F, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDF, 0x0000, 0x0000, 0xDF5F, 0xFFFF, 0xE7BF, 0xE79F, 0xE77F, 0xE79F, 0xEFBF, 0xFFFF, 0xFFFF, 0xE77F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xF7FF, 0xDF7F, 0xE75F, 0x0000, 0xDEDF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF7F, 0xDF7F, 0xD73F, 0xD71F, 0xD71F, 0xD71F, 0xE77F, 0xFFFF, 0xFFFF, 0xE79F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xD73F, 0xA61C, 0x8D7B, 0x9DDB, 0x95BB, 0xC69D, 0xFFFF, 0xFFFF, 0xE79F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xDF5F, 0xBE9D, 0xB65D, 0xB67D, 0xB65D, 0xD6FE, 0xFFFF, 0xFFFF, 0xE79F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE79F, 0xE77F, 0xE79F, 0xE77F, 0xE79F, 0xEFBF, 0xFFFF, 0xFFFF, 0xE79F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE79F, 0xDF7F, 0xDF7F, 0xDF5F, 0xDF5F, 0xEF9F, 0xFFFF, 0xFFFF, 0xEF9F, 0xDF5F, 0xDF5F, 0xDF7F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE77F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE79F, 0xFFFF, 0xFFFF, 0xE79F, 0xD73F, 0xD75F, 0xDF5F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xD75F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE77F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE77F, 0xFFFF, 0xFFFF, 0xEF9F, 0xDF5F, 0xDF7F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xE77F, 0xDF7F, 0xDF5F, 0xDF5F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE77F, 0xDF5F, 0xDF5F, 0xDF5F, 0xD73F, 0xE77F, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFBE, 0xFFDD, 0xF7BE, 0xDF5F, 0xD75F, 0xDF7F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xE79F, 0xE79F, 0xE79F, 0xE79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xF7BE, 0xE75F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF7F, 0xDF7F, 0xD73F, 0xCF1F, 0xD73F, 0xF79E, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBD, 0xFFDD, 0xFFDD, 0xF7BE, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xDF3F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xD73F, 0xAE1C, 0x8D7B, 0x9DBB, 0x9DBB, 0xC6BD, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xF7BE, 0xDF7F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xDF5F, 0xBE9D, 0xBE7C, 0xCEBC, 0xC6BC, 0xDF3D, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBD, 0xFFDD, 0xFFDD, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF7F, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF5F, 0xF7BF, 0xFFFE, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xD75F, 0xEF9E, 0xFFDD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF5F, 0xEF9E, 0xFFFD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xD75F, 0xEF9E, 0xFFDD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xE77F, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE77F, 0xDF7F, 0xD73F, 0xE75E, 0xF79D, 0xF7BE, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xD73F, 0xA61C, 0x959A, 0x9DDB, 0x95BB, 0xC6BD, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xE79F, 0xDF5F, 0xBE9D, 0xBE7C, 0xC6BC, 0xC6BC, 0xDF3D, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF7F, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF5F, 0xF7BF, 0xFFFE, 0xFFFF, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xD75F, 0xEF9E, 0xFFDD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF5F, 0xEFBE, 0xFFFD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDE, 0xE77F, 0xE79F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD6BF, 0x0000, 0x0000, 0xDF5F, 0xDF7F, 0xDF5F, 0xEFBE, 0xFFFD, 0xFFFE, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFDE, 0xFFFE, 0xFFDE, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFDD, 0xFFBD, 0xFFFD, 0xFFDE, 0xE77F, 0xDF9F, 0xDF5F, 0xDF7F, 0x0000, 0xD6BF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDF, 0x0000, 0x0000, 0xDF5F, 0xF7FF, 0xDF5F, 0xE77F, 0xF7BE, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFDE, 0xEF9F, 0xDF5F, 0xF7FF, 0xDF7F, 0xE79F, 0x0000, 0xDEDF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE7F, 0x0000, 0xFFFF, 0xDF5F, 0xE77F, 0xDF5F, 0xDF5F, 0xDF5F, 0xF79D, 0xFFBD, 0xFFDE, 0xFFDE, 0xF7BD, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xF79D, 0xEF7E, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xE71F, 0xFFFF, 0xCE7F, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xCE7F, 0xDF7F, 0xDF5F, 0xDF5F, 0xE7BF, 0xDF5F, 0xCE9C, 0xC67B, 0xCEBC, 0xCE9C, 0xCE9C, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xD6FE, 0xDF7F, 0xDF7F, 0xDF5F, 0xDF7F, 0xBFFF, 0xCE7F, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xDEDF, 0x0000, 0xFFFF, 0xE79F, 0xEFBF, 0xCE9C, 0xBE3B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB63B, 0xB61B, 0xB61B, 0xBE5B, 0xD71E, 0xE79F, 0xE79F, 0x0000, 0x0000, 0xDEDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xD6BF, 0xFFFF, 0xDF9F, 0xDF5F, 0xDF3F, 0xBE1A, 0xBE3B, 0xC65B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xC65B, 0xC65B, 0xBE1A, 0xC69C, 0xDF5F, 0xDF9F, 0xCFFF, 0xFFFF, 0xD6BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xD6BA, 0x001F, 0xBE7C, 0xC67C, 0xD6FE, 0xBE3B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xC67C, 0xCEDE, 0xC67C, 0xFFFF, 0x0000, 0xD6BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xDED6, 0x0000, 0xB63A, 0xBE3B, 0xDF5F, 0xBE3B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xC69C, 0xDF5F, 0xBE1A, 0x0000, 0x0000, 0xDED6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xCE79, 0xFFFF, 0xBE5B, 0xBE5B, 0xD6FE, 0xC67C, 0xBE5B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xBE3B, 0xC67C, 0xCE9D, 0xCEDD, 0xBE5B, 0xFFFF, 0x0000, 0xCE79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xD6BA, 0xBDFF, 0xBE1B, 0xC65C, 0xDF5F, 0xC69D, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xBE3B, 0xDF5F, 0xBE5B, 0xC69C, 0xBE7B, 0xD6BA, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xADD9, 0xCEDD, 0xC67C, 0xCE9D, 0xBE3B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xC67C, 0xC69C, 0xCEDD, 0xBE3B, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xC63A, 0x0000, 0x9555, 0xBE3B, 0xD71F, 0xBE5B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xC69C, 0xCEDE, 0xBE1A, 0x0000, 0xFFFF, 0xCE7C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_BOTTLE_66_SPAN_ROWS[] PROGMEM = {
+  0, 0, 24, 16, 42, 30, 63, 54, 82, 81, 108, 105, 130, 134, 153, 163,
+  175, 190, 196, 217, 219, 244, 241, 271, 264, 298, 285, 325, 306, 355, 329, 382,
+  353, 408, 381, 438, 398, 470, 415, 503, 447, 541, 470, 577, 493, 613, 536, 651,
+  576, 684, 614, 715, 652, 744, 690, 779, 730, 814, 772, 847, 812, 880, 853, 913,
+  894, 946, 937, 979, 979, 1012, 1021, 1045, 1063, 1078, 1105, 1111, 1147, 1144, 1188, 1177,
+  1229, 1210, 1270, 1243, 1312, 1276, 1354, 1309, 1396, 1342, 1438, 1375, 1480, 1408, 1521, 1441,
+  1562, 1474, 1603, 1507, 1644, 1540, 1686, 1573, 1728, 1606, 1770, 1639, 1811, 1672, 1851, 1705,
+  1893, 1738, 1931, 1773, 1968, 1808, 1995, 1838, 2015, 1871, 2036, 1903, 2059, 1933, 2082, 1965,
+  2105, 1997, 2128, 2023
 };
 
-const uint8_t SPRITE_BOTTLE_66_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x07, 0x04, 0x00, 0x00, 0x0D, 0xDB, 0xFF, 0xF8, 0xFE, 0xF8, 0xFF, 0xFF, 0x75, 0x00, 0x00, 0x00, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x73, 0x82, 0xEC, 0xFF, 0xFC, 0xFE, 0xFC, 0xFF, 0xFF, 0xB6, 0x73, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x23, 0x22, 0x41, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x22, 0x22, 0x17, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x03, 0x23, 0xC4, 0xDF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xDF, 0x74, 0x06, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x0C, 0xF2, 0xFF, 0xFF, 0xFC, 0xF9, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xF9, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x10, 0x3D, 0xDD, 0xF8, 0xF4, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF9, 0xF8, 0x8D, 0x1D, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x70, 0xE2, 0xFA, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF9, 0xEE, 0xC1, 0x1D, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xFF, 0xF7, 0x25, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7D, 0xF9, 0xFE, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFC, 0xD8, 0x20, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xDD, 0x21, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xDE, 0x21, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xDD, 0x21, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7D, 0xF9, 0xFE, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFC, 0xD8, 0x20, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x05, 0x94, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xFF, 0xFD, 0x2B, 0x02, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x65, 0xDA, 0xFA, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFA, 0xEA, 0xB7, 0x13, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x2C, 0xE0, 0xFE, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFE, 0x87, 0x08, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x6F, 0x72, 0x74, 0xEA, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAE, 0x67, 0x7D, 0x35, 0x00, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0C, 0x40, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0x1B, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x65, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0x0B, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x10, 0x69, 0xCB, 0xFF, 0xFD, 0xF5, 0xFA, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xF8, 0xF5, 0xFF, 0xFF, 0x8E, 0x3C, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x25, 0xF9, 0xFF, 0xF2, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x25, 0xF9, 0xFF, 0xF2, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFD, 0xFF, 0x8F, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x10, 0x69, 0xCB, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9, 0xF5, 0xF4, 0xF4, 0xF6, 0xF8, 0xF8, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xFD, 0xFF, 0xFB, 0xFF, 0xFF, 0x8E, 0x3C, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x66, 0xE3, 0xF9, 0xFA, 0xFA, 0xF0, 0xEF, 0xF4, 0xF4, 0xF1, 0xEE, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xF6, 0xFE, 0xF9, 0xEF, 0xBF, 0x0B, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0E, 0x42, 0xD8, 0xFE, 0xEC, 0xEE, 0xF4, 0xFA, 0xFA, 0xF4, 0xEF, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0xFA, 0xFD, 0x8D, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x00, 0xC7, 0xFF, 0xEA, 0xF4, 0xD4, 0xAD, 0xAD, 0xD4, 0xF5, 0xF3, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xE8, 0xF9, 0xFF, 0x5A, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x13, 0x41, 0xD7, 0xFC, 0xF0, 0xFA, 0xB2, 0x5F, 0x5F, 0xB2, 0xFB, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEB, 0xF8, 0xFC, 0x8D, 0x20, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x69, 0xE3, 0xF3, 0xE8, 0xF3, 0xF9, 0xB4, 0x65, 0x65, 0xB5, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xF0, 0xED, 0xEE, 0xB7, 0x1B, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x84, 0xFF, 0xFF, 0xED, 0xFE, 0xFF, 0xBC, 0x6D, 0x6D, 0xB9, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xEE, 0xE8, 0xFF, 0xE8, 0x22, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x76, 0xF9, 0xEF, 0xDD, 0xEB, 0xEF, 0xB2, 0x6B, 0x6A, 0xB7, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEB, 0xFC, 0xCC, 0x1E, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7E, 0xFB, 0xC7, 0xA9, 0xBB, 0xBC, 0x9A, 0x6E, 0x6C, 0xB5, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD0, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7C, 0xFD, 0xD9, 0xBF, 0xD0, 0xD2, 0xA5, 0x6C, 0x6B, 0xB6, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x77, 0xFF, 0xFE, 0xEE, 0xFB, 0xFF, 0xBA, 0x6A, 0x6A, 0xB7, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xFB, 0xEA, 0xF8, 0xFD, 0xB8, 0x6A, 0x6A, 0xB7, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF8, 0xE5, 0xF4, 0xF9, 0xB6, 0x6A, 0x6A, 0xB6, 0xF9, 0xF4, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF9, 0xE7, 0xF5, 0xFA, 0xB7, 0x6A, 0x6A, 0xB8, 0xFB, 0xF6, 0xEE, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF8, 0xE5, 0xF3, 0xF8, 0xB6, 0x69, 0x69, 0xBB, 0xFE, 0xFE, 0xF6, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xF8, 0xF0, 0xEF, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xBF, 0x68, 0x68, 0xBD, 0xFF, 0xFF, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFB, 0xF6, 0xF1, 0xED, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x79, 0xFE, 0xF1, 0xDB, 0xEB, 0xF4, 0xB7, 0x69, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFC, 0xF6, 0xEF, 0xEA, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0xFC, 0xC8, 0xA9, 0xBA, 0xBD, 0x9B, 0x6E, 0x6B, 0xBA, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFA, 0xF7, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7C, 0xFD, 0xD9, 0xC2, 0xD5, 0xD4, 0xA6, 0x6C, 0x6A, 0xBB, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFC, 0xF9, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x77, 0xFF, 0xFE, 0xF3, 0xFF, 0xFF, 0xC0, 0x67, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xFB, 0xEF, 0xFF, 0xFF, 0xBD, 0x68, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF8, 0xEA, 0xFD, 0xFD, 0xBB, 0x68, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF9, 0xEC, 0xFF, 0xFF, 0xBC, 0x68, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF8, 0xEA, 0xFD, 0xFD, 0xBB, 0x68, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x77, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0xC1, 0x67, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x79, 0xFE, 0xF0, 0xE0, 0xF3, 0xF3, 0xB6, 0x69, 0x69, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0xFC, 0xC8, 0xA9, 0xBB, 0xBC, 0x9B, 0x6E, 0x6B, 0xBA, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7C, 0xFD, 0xD9, 0xC1, 0xD4, 0xD4, 0xA7, 0x6C, 0x6A, 0xBB, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x77, 0xFF, 0xFE, 0xF3, 0xFF, 0xFF, 0xC0, 0x67, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xFB, 0xEF, 0xFF, 0xFF, 0xBD, 0x68, 0x68, 0xBC, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFF, 0xF8, 0xEA, 0xFD, 0xFD, 0xBD, 0x6C, 0x6C, 0xBD, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD1, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x78, 0xFE, 0xF9, 0xEC, 0xFF, 0xFF, 0xBA, 0x62, 0x62, 0xBA, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0xFF, 0xD0, 0x1F, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x75, 0xF9, 0xF8, 0xED, 0xFF, 0xFF, 0xB7, 0x5C, 0x5C, 0xB7, 0xFF, 0xFF, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF9, 0xEC, 0xFC, 0xCC, 0x1E, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x85, 0xFF, 0xFE, 0xE8, 0xF9, 0xFC, 0xDB, 0xB0, 0xB0, 0xDA, 0xFC, 0xFC, 0xF8, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xF9, 0xF2, 0xE8, 0xFF, 0xE8, 0x22, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x69, 0xE2, 0xF5, 0xEC, 0xEF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xF4, 0xEE, 0xED, 0xEE, 0xB6, 0x1B, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x0F, 0x3C, 0xD7, 0xFC, 0xEB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xF1, 0xF6, 0xFC, 0x8A, 0x1B, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x05, 0xCA, 0xFF, 0xF3, 0xFE, 0xFE, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0x67, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x03, 0x24, 0xD2, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0x7A, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x20, 0xD7, 0xFC, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFE, 0xF9, 0x7C, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x25, 0xF8, 0xFF, 0xF2, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFD, 0xFF, 0x90, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x1D, 0xC1, 0xF4, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE4, 0x6F, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x1D, 0x9F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFA, 0x42, 0x10, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x2D, 0x85, 0xED, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xFC, 0xBA, 0x61, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x0C, 0xDB, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x74, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_BOTTLE_66_SPAN_OPS[] PROGMEM = {
+  0x16, 0x83, 0x01, 0x06, 0x07, 0x04, 0x01, 0x81, 0x0D, 0xDB, 0x40, 0x82, 0xF8, 0xFE, 0xF8, 0x41, 0x80, 0x75, 0x02, 0x82, 0x07, 0x07, 0x03, 0xC0,
+  0x1A, 0x83, 0x64, 0x73, 0x82, 0xEC, 0x40, 0x82, 0xFC, 0xFE, 0xFC, 0x41, 0x83, 0xB6, 0x73, 0x73, 0x31, 0xC0, 0x14, 0x80, 0x01, 0x00, 0x84, 0x06,
+  0x23, 0x22, 0x41, 0xFA, 0x4B, 0x84, 0x9D, 0x22, 0x22, 0x17, 0x01, 0x00, 0x80, 0x01, 0xC0, 0x13, 0x86, 0x01, 0x05, 0x03, 0x23, 0xC4, 0xDF, 0xDF,
+  0x4C, 0x86, 0xEF, 0xDF, 0xDF, 0x74, 0x06, 0x01, 0x05, 0xC0, 0x13, 0x81, 0x01, 0x07, 0x00, 0x81, 0x0C, 0xF2, 0x41, 0x83, 0xFC, 0xF9, 0xFA, 0xFE,
+  0x45, 0x82, 0xFD, 0xF9, 0xF9, 0x42, 0x80, 0x7F, 0x01, 0x80, 0x07, 0xC0, 0x12, 0x88, 0x01, 0x01, 0x05, 0x10, 0x3D, 0xDD, 0xF8, 0xF4, 0xFD, 0x4B,
+  0x87, 0xF7, 0xF9, 0xF8, 0x8D, 0x1D, 0x04, 0x05, 0x01, 0xC0, 0x12, 0x80, 0x05, 0x00, 0x85, 0x01, 0x70, 0xE2, 0xFA, 0xF9, 0xFE, 0x4C, 0x88, 0xFE,
+  0xFD, 0xF9, 0xEE, 0xC1, 0x1D, 0x01, 0x05, 0x01, 0xC0, 0x12, 0x80, 0x07, 0x01, 0x80, 0x8E, 0x41, 0x80, 0xF8, 0x4E, 0x81, 0xFE, 0xF8, 0x40, 0x81,
+  0xF7, 0x25, 0x00, 0x81, 0x07, 0x01, 0xC0, 0x12, 0x80, 0x06, 0x01, 0x83, 0x7D, 0xF9, 0xFE, 0xF9, 0x4E, 0x84, 0xFE, 0xF9, 0xFC, 0xD8, 0x20, 0x00,
+  0x81, 0x06, 0x01, 0xC0, 0x12, 0x80, 0x06, 0x01, 0x81, 0x80, 0xFE, 0x40, 0x80, 0xF9, 0x4E, 0x81, 0xFE, 0xF9, 0x40, 0x81, 0xDD, 0x21, 0x00, 0x81,
+  0x06, 0x01, 0xC0, 0x12, 0x80, 0x06, 0x01, 0x80, 0x80, 0x41, 0x80, 0xF9, 0x4E, 0x81, 0xFE, 0xF9, 0x40, 0x81, 0xDE, 0x21, 0x00, 0x81, 0x06, 0x01,
+  0xC0, 0x12, 0x80, 0x06, 0x01, 0x81, 0x80, 0xFE, 0x40, 0x80, 0xF9, 0x4E, 0x81, 0xFE, 0xF9, 0x40, 0x81, 0xDD, 0x21, 0x00, 0x81, 0x06, 0x01, 0xC0,
+  0x12, 0x80, 0x06, 0x01, 0x83, 0x7D, 0xF9, 0xFE, 0xF9, 0x4E, 0x84, 0xFE, 0xF9, 0xFC, 0xD8, 0x20, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x12, 0x83, 0x07,
+  0x01, 0x05, 0x94, 0x41, 0x80, 0xF8, 0x4E, 0x81, 0xFE, 0xF8, 0x40, 0x84, 0xFD, 0x2B, 0x02, 0x07, 0x01, 0xC0, 0x12, 0x80, 0x06, 0x01, 0x84, 0x65,
+  0xDA, 0xFA, 0xFA, 0xFE, 0x4C, 0x85, 0xFE, 0xFE, 0xFA, 0xEA, 0xB7, 0x13, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x12, 0x81, 0x04, 0x04, 0x01, 0x84, 0x2C,
+  0xE0, 0xFE, 0xF9, 0xFE, 0x4B, 0x80, 0xF9, 0x40, 0x82, 0xFE, 0x87, 0x08, 0x01, 0x81, 0x06, 0x01, 0xC0, 0x10, 0x81, 0x01, 0x09, 0x01, 0x83, 0x6F,
+  0x72, 0x74, 0xEA, 0x40, 0x81, 0xFB, 0xFE, 0x4B, 0x80, 0xFB, 0x41, 0x83, 0xAE, 0x67, 0x7D, 0x35, 0x00, 0x81, 0x02, 0x07, 0xC0, 0x0F, 0x80, 0x01,
+  0x01, 0x82, 0x0C, 0x40, 0xF3, 0x57, 0x81, 0x9A, 0x1B, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x81, 0x65, 0xE4, 0x58, 0x82, 0xF4,
+  0xBF, 0x0B, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0E, 0x84, 0x03, 0x04, 0x10, 0x69, 0xCB, 0x40, 0x83, 0xFD, 0xF5, 0xFA, 0xFE, 0x40, 0x80, 0xFE, 0x4C,
+  0x80, 0xFE, 0x41, 0x82, 0xFD, 0xF8, 0xF5, 0x41, 0x84, 0x8E, 0x3C, 0x04, 0x01, 0x03, 0xC0, 0x0D, 0x81, 0x01, 0x07, 0x00, 0x81, 0x25, 0xF9, 0x40,
+  0x81, 0xF2, 0xFD, 0x57, 0x81, 0xF5, 0xFD, 0x40, 0x80, 0x8F, 0x01, 0x80, 0x07, 0xC0, 0x0D, 0x81, 0x01, 0x07, 0x00, 0x81, 0x25, 0xF9, 0x40, 0x81,
+  0xF2, 0xFD, 0x57, 0x81, 0xF5, 0xFD, 0x40, 0x80, 0x8F, 0x01, 0x80, 0x07, 0xC0, 0x0E, 0x84, 0x03, 0x04, 0x10, 0x69, 0xCB, 0x41, 0x80, 0xFC, 0x40,
+  0x93, 0xF9, 0xF5, 0xF4, 0xF4, 0xF6, 0xF8, 0xF8, 0xF7, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xFD, 0x40, 0x80, 0xFB,
+  0x41, 0x84, 0x8E, 0x3C, 0x04, 0x01, 0x03, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x9D, 0x66, 0xE3, 0xF9, 0xFA, 0xFA, 0xF0, 0xEF, 0xF4, 0xF4, 0xF1, 0xEE,
+  0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xF6, 0xFE, 0xF9, 0xEF, 0xBF, 0x0B, 0x00, 0x81, 0x06, 0x01, 0xC0,
+  0x0F, 0x80, 0x01, 0x01, 0x9C, 0x0E, 0x42, 0xD8, 0xFE, 0xEC, 0xEE, 0xF4, 0xFA, 0xFA, 0xF4, 0xEF, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+  0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEC, 0xFA, 0xFD, 0x8D, 0x20, 0x01, 0x80, 0x01, 0xC0, 0x10, 0x81, 0x02, 0x0D, 0x01, 0x80, 0xC7, 0x40, 0x95, 0xEA,
+  0xF4, 0xD4, 0xAD, 0xAD, 0xD4, 0xF5, 0xF3, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xF1, 0xE8, 0xF9, 0x40, 0x80, 0x5A,
+  0x01, 0x80, 0x0A, 0xC0, 0x0F, 0xA2, 0x01, 0x01, 0x05, 0x13, 0x41, 0xD7, 0xFC, 0xF0, 0xFA, 0xB2, 0x5F, 0x5F, 0xB2, 0xFB, 0xF5, 0xED, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEB, 0xF8, 0xFC, 0x8D, 0x20, 0x05, 0x05, 0x01, 0xC0, 0x0F, 0x80, 0x05, 0x00, 0xA1, 0x01,
+  0x69, 0xE3, 0xF3, 0xE8, 0xF3, 0xF9, 0xB4, 0x65, 0x65, 0xB5, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xEF, 0xF0, 0xED, 0xEE, 0xB7, 0x1B, 0x01, 0x05, 0x01, 0xC0, 0x0F, 0x80, 0x07, 0x01, 0x80, 0x84, 0x41, 0x81, 0xED, 0xFE, 0x40, 0x94, 0xBC, 0x6D,
+  0x6D, 0xB9, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xEE, 0xE8, 0x40, 0x81, 0xE8, 0x22, 0x00,
+  0x81, 0x07, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x9D, 0x76, 0xF9, 0xEF, 0xDD, 0xEB, 0xEF, 0xB2, 0x6B, 0x6A, 0xB7, 0xFA, 0xF5, 0xED, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEB, 0xFC, 0xCC, 0x1E, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01,
+  0x9A, 0x7E, 0xFB, 0xC7, 0xA9, 0xBB, 0xBC, 0x9A, 0x6E, 0x6C, 0xB5, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81, 0xD0, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x9A, 0x7C, 0xFD, 0xD9, 0xBF, 0xD0, 0xD2,
+  0xA5, 0x6C, 0x6B, 0xB6, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81, 0xD1,
+  0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x77, 0x40, 0x82, 0xFE, 0xEE, 0xFB, 0x40, 0x94, 0xBA, 0x6A, 0x6A, 0xB7, 0xFA,
+  0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01,
+  0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x98, 0xFB, 0xEA, 0xF8, 0xFD, 0xB8, 0x6A, 0x6A, 0xB7, 0xFA, 0xF5, 0xED, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80,
+  0x78, 0x40, 0x98, 0xF8, 0xE5, 0xF4, 0xF9, 0xB6, 0x6A, 0x6A, 0xB6, 0xF9, 0xF4, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF,
+  0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x98, 0xF9, 0xE7, 0xF5,
+  0xFA, 0xB7, 0x6A, 0x6A, 0xB8, 0xFB, 0xF6, 0xEE, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xEF, 0xEA, 0x40, 0x81,
+  0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x98, 0xF8, 0xE5, 0xF3, 0xF8, 0xB6, 0x69, 0x69, 0xBB, 0xFE,
+  0xFE, 0xF6, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xF8, 0xF0, 0xEF, 0xEF, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01,
+  0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x77, 0x41, 0x81, 0xEF, 0xFE, 0x40, 0x83, 0xBF, 0x68, 0x68, 0xBD, 0x41, 0x8E, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFB, 0xF6, 0xF1, 0xED, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89,
+  0x79, 0xFE, 0xF1, 0xDB, 0xEB, 0xF4, 0xB7, 0x69, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFC,
+  0xF6, 0xEF, 0xEA, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89, 0x7F, 0xFC, 0xC8, 0xA9, 0xBA, 0xBD, 0x9B,
+  0x6E, 0x6B, 0xBA, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xFA, 0xF7, 0xEB, 0x40, 0x81, 0xD1, 0x1F,
+  0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89, 0x7C, 0xFD, 0xD9, 0xC2, 0xD5, 0xD4, 0xA6, 0x6C, 0x6A, 0xBB, 0x41, 0x8E, 0xF7, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFC, 0xF9, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80,
+  0x06, 0x01, 0x80, 0x77, 0x40, 0x81, 0xFE, 0xF3, 0x41, 0x83, 0xC0, 0x67, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x81,
+  0xFB, 0xEF, 0x41, 0x83, 0xBD, 0x68, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8,
+  0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x87, 0xF8, 0xEA, 0xFD, 0xFD, 0xBB, 0x68,
+  0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00,
+  0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x81, 0xF9, 0xEC, 0x41, 0x83, 0xBC, 0x68, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80,
+  0x06, 0x01, 0x80, 0x78, 0x40, 0x87, 0xF8, 0xEA, 0xFD, 0xFD, 0xBB, 0x68, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x77, 0x41, 0x80,
+  0xF6, 0x41, 0x83, 0xC1, 0x67, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB,
+  0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89, 0x79, 0xFE, 0xF0, 0xE0, 0xF3, 0xF3, 0xB6, 0x69, 0x69, 0xBC,
+  0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06,
+  0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89, 0x7F, 0xFC, 0xC8, 0xA9, 0xBB, 0xBC, 0x9B, 0x6E, 0x6B, 0xBA, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x89,
+  0x7C, 0xFD, 0xD9, 0xC1, 0xD4, 0xD4, 0xA7, 0x6C, 0x6A, 0xBB, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x77, 0x40, 0x81, 0xFE, 0xF3, 0x41, 0x83,
+  0xC0, 0x67, 0x68, 0xBC, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1,
+  0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x81, 0xFB, 0xEF, 0x41, 0x83, 0xBD, 0x68, 0x68, 0xBC, 0x41, 0x8E,
+  0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0,
+  0x0F, 0x80, 0x06, 0x01, 0x80, 0x78, 0x40, 0x87, 0xF8, 0xEA, 0xFD, 0xFD, 0xBD, 0x6C, 0x6C, 0xBD, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA,
+  0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF8, 0xEB, 0x40, 0x81, 0xD1, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x83, 0x78,
+  0xFE, 0xF9, 0xEC, 0x41, 0x83, 0xBA, 0x62, 0x62, 0xBA, 0x41, 0x8E, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB,
+  0xF8, 0xEB, 0x40, 0x81, 0xD0, 0x1F, 0x00, 0x81, 0x06, 0x01, 0xC0, 0x0F, 0x80, 0x06, 0x01, 0x83, 0x75, 0xF9, 0xF8, 0xED, 0x41, 0x83, 0xB7, 0x5C,
+  0x5C, 0xB7, 0x41, 0x91, 0xF7, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF9, 0xEC, 0xFC, 0xCC, 0x1E, 0x00, 0x81,
+  0x06, 0x01, 0xC0, 0x0F, 0x80, 0x07, 0x01, 0x80, 0x85, 0x40, 0x98, 0xFE, 0xE8, 0xF9, 0xFC, 0xDB, 0xB0, 0xB0, 0xDA, 0xFC, 0xFC, 0xF8, 0xF9, 0xF9,
+  0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xF9, 0xF2, 0xE8, 0x40, 0x81, 0xE8, 0x22, 0x00, 0x81, 0x07, 0x01, 0xC0, 0x0F, 0x80, 0x05,
+  0x00, 0x86, 0x01, 0x69, 0xE2, 0xF5, 0xEC, 0xEF, 0xF9, 0x43, 0x96, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+  0xFC, 0xF4, 0xEE, 0xED, 0xEE, 0xB6, 0x1B, 0x01, 0x05, 0x01, 0xC0, 0x0F, 0x88, 0x01, 0x01, 0x05, 0x0F, 0x3C, 0xD7, 0xFC, 0xEB, 0xFB, 0x43, 0x8C,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x40, 0x87, 0xF1, 0xF6, 0xFC, 0x8A, 0x1B, 0x04, 0x05, 0x01, 0xC0,
+  0x10, 0x81, 0x01, 0x07, 0x00, 0x81, 0x05, 0xCA, 0x40, 0x85, 0xF3, 0xFE, 0xFE, 0xFC, 0xFC, 0xFE, 0x4D, 0x81, 0xF7, 0xFD, 0x40, 0x80, 0x67, 0x01,
+  0x80, 0x07, 0xC0, 0x10, 0x86, 0x01, 0x06, 0x03, 0x24, 0xD2, 0xFE, 0xFB, 0x52, 0x80, 0xFC, 0x40, 0x84, 0xFE, 0x7A, 0x05, 0x01, 0x06, 0xC0, 0x10,
+  0x87, 0x01, 0x06, 0x01, 0x20, 0xD7, 0xFC, 0xFA, 0xFE, 0x51, 0x84, 0xFA, 0xFE, 0xF9, 0x7C, 0x01, 0x00, 0x80, 0x06, 0xC0, 0x10, 0x81, 0x01, 0x07,
+  0x00, 0x81, 0x25, 0xF8, 0x40, 0x81, 0xF2, 0xFD, 0x51, 0x81, 0xF5, 0xFD, 0x40, 0x80, 0x90, 0x01, 0x80, 0x07, 0xC0, 0x10, 0x85, 0x01, 0x05, 0x01,
+  0x1D, 0xC1, 0xF4, 0x41, 0x80, 0xFE, 0x4F, 0x80, 0xFE, 0x41, 0x82, 0xE4, 0x6F, 0x01, 0x00, 0x80, 0x05, 0xC0, 0x11, 0x84, 0x01, 0x06, 0x04, 0x1D,
+  0x9F, 0x41, 0x80, 0xF9, 0x4E, 0x81, 0xFE, 0xF9, 0x40, 0x85, 0xFA, 0x42, 0x10, 0x06, 0x01, 0x01, 0xC0, 0x12, 0x80, 0x03, 0x01, 0x85, 0x2D, 0x85,
+  0xED, 0xFC, 0xFC, 0xFE, 0x4B, 0x84, 0xFC, 0xFE, 0xFC, 0xBA, 0x61, 0x01, 0x81, 0x03, 0x01, 0xC0, 0x13, 0x81, 0x02, 0x0D, 0x00, 0x81, 0x0C, 0xDB,
+  0x40, 0x81, 0xF8, 0xFE, 0x4B, 0x80, 0xF8, 0x41, 0x80, 0x74, 0x00, 0x81, 0x03, 0x0A, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_BOTTLE_66_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x0000, 0x0840, 0xC38C, 0xFCF0, 0xE42E, 0xEC6F, 0xE42E, 0xFC8F, 0xFCD0, 0x69E6, 0x0020, 0x0020, 0x0000,
+  0x59C5, 0x6A27, 0x7227, 0xDC0E, 0xFCAF, 0xEC4E, 0xEC6F, 0xEC4E, 0xF46F, 0xFC8F, 0xA32A, 0x69E6, 0x6A07, 0x28C2, 0x0000, 0x0000,
+  0x1881, 0x1881, 0x3903, 0xE40E, 0xFD52, 0xFCB0, 0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xEC4E, 0xF48F, 0xFD11, 0xFD31,
+  0x92A9, 0x1881, 0x1881, 0x1061, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x1881, 0xBB6B, 0xDC2E, 0xD3CD, 0xF46F, 0xFCAF, 0xFC8F,
+  0xF46F, 0xEC4E, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xF46F, 0xFC8F, 0xFCAF, 0xE40D, 0xDBED, 0xDC0E, 0x6A07, 0x0000, 0x0000,
+  0x0020, 0x0000, 0x0020, 0x0820, 0xDC0E, 0xFD72, 0xFCB0, 0xEC6F, 0xE40D, 0xEC0E, 0xEC6F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xEC6E, 0xE40D, 0xE40D, 0xF46F, 0xFD11, 0xFD52, 0x7227, 0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x3923, 0xD3CD, 0xF48F,
+  0xEC2E, 0xEC6F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xE42D, 0xEC4E,
+  0xF46F, 0x8268, 0x1881, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x61C6, 0xDC0E, 0xEC4E, 0xEC2E, 0xEC4E, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xF46F, 0xEC2E, 0xEC6F, 0xB34B, 0x1881,
+  0x0000, 0x0020, 0x0000, 0x0000, 0x8268, 0xFD31, 0xFCAF, 0xE40D, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC4E, 0xE40D, 0xFD31, 0xE42E, 0x20A2, 0x0000, 0x0000, 0x0000, 0x7227,
+  0xF46F, 0xFC8F, 0xEC2D, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xEC6F, 0xEC2D, 0xFCD0, 0xCBAC, 0x1881, 0x0000, 0x0000, 0x0000, 0x7227, 0xFCB0, 0xFC8F, 0xE42D, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xE42D, 0xFCF0,
+  0xD3CD, 0x1881, 0x0000, 0x0000, 0x0000, 0x7227, 0xFCB0, 0xFC8F, 0xE42D, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xE42D, 0xFCF0, 0xD3CD, 0x1881, 0x0000, 0x0000, 0x0000,
+  0x7227, 0xFCB0, 0xFC8F, 0xE42D, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xE42D, 0xFCF0, 0xD3CD, 0x1881, 0x0000, 0x0000, 0x0000, 0x7227, 0xF46F, 0xFC8F, 0xEC2D, 0xF46F,
+  0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xF46F, 0xEC6F, 0xEC2D,
+  0xFCD0, 0xCBAC, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x8A88, 0xFD52, 0xFCB0, 0xE40E, 0xF46F, 0xEC6F, 0xEC6F, 0xEC6F,
+  0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC6F, 0xF46F, 0xEC6F, 0xE42E, 0xFD52, 0xEC6F, 0x20A2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x61A5, 0xD3EC, 0xF42E, 0xEC2D, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E,
+  0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xF44E, 0xEC0D, 0xE44E, 0xAB0A, 0x0820, 0x0000, 0x0000, 0x0020, 0x0020,
+  0x28A1, 0xD38C, 0xFCAF, 0xEBED, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E, 0xF42E,
+  0xF42E, 0xEBED, 0xFC6E, 0xFC8F, 0x7A26, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x52AA, 0x632D, 0x52EC, 0xC4D3, 0xE5B5, 0xD513,
+  0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xDD54, 0xD513, 0xE575, 0xE595,
+  0x8BCF, 0x52CC, 0x6B6E, 0x2925, 0x0000, 0x0020, 0x0000, 0x0841, 0x31A6, 0xBDD8, 0xEF7F, 0xD6BC, 0xC67B, 0xC65B, 0xC67B, 0xC67B,
+  0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xCE9B,
+  0xE71D, 0xE73E, 0x73D0, 0x1082, 0x0000, 0x0000, 0x0020, 0x4A6A, 0xC619, 0xD69B, 0xCE7B, 0xCE7B, 0xCE5A, 0xC65A, 0xC65A, 0xC65A,
+  0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xC65A, 0xCE7A,
+  0xD69B, 0xCE7B, 0xD6BC, 0x9493, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841, 0x4A6A, 0xA535, 0xE71D, 0xCE7A, 0xBDF8, 0xC5F9,
+  0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A,
+  0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xBDF9, 0xBDF8, 0xDEFC, 0xD69B, 0x73AF, 0x3186, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x18E3,
+  0xBDF9, 0xEF5E, 0xB5B7, 0xC63A, 0xCE5A, 0xCE5A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A,
+  0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE3A, 0xCE5A, 0xCE5A, 0xBDD8, 0xD69B, 0xEF7F, 0x6B6E,
+  0x0020, 0x0000, 0x0020, 0x18E3, 0xBDF9, 0xEF5E, 0xB5B7, 0xC63A, 0xCE5A, 0xCE5A, 0xCE3A, 0xC639, 0xC63A, 0xC63A, 0xC63A, 0xC63A,
+  0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC63A, 0xC639, 0xC639, 0xCE3A, 0xCE5A, 0xCE5A,
+  0xBDF8, 0xD69B, 0xEF7F, 0x6B6E, 0x0020, 0x0000, 0x0020, 0x0841, 0x4A6A, 0xA535, 0xE71D, 0xCE7A, 0xC619, 0xCE5A, 0xC67B, 0xCE9C,
+  0xCE9B, 0xCE9C, 0xCE9C, 0xCE9B, 0xCE9B, 0xCE9C, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE9B, 0xCE7B, 0xCE9C,
+  0xCE9C, 0xCE7B, 0xC619, 0xBDD8, 0xDEFD, 0xD69B, 0x73AF, 0x3186, 0x0020, 0x0000, 0x0000, 0x0020, 0x4A6A, 0xBDF8, 0xCE5B, 0xC619,
+  0xC65A, 0xCEDD, 0xD71D, 0xD73E, 0xD73E, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD,
+  0xCEFD, 0xCEFD, 0xCF1D, 0xCF1D, 0xCEBC, 0xCE5A, 0xC619, 0xCE9B, 0x94B3, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x31C7, 0xB61A,
+  0xE77E, 0xCEBD, 0xCEDD, 0xD73E, 0xD71E, 0xD71E, 0xD73E, 0xCEDD, 0xCEFD, 0xCEDD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD,
+  0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEFD, 0xCEDD, 0xD6FD, 0xDF5F, 0x7C11, 0x18C3, 0x0000, 0x0000, 0x0861, 0xADD8, 0xEFFF, 0xC6BC,
+  0xD71E, 0xB61A, 0x9D35, 0x9D35, 0xB61A, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xC6BC, 0xD75E, 0xE7BF, 0x426A, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x31C7, 0xB61A, 0xE77F, 0xCEDD,
+  0xD71E, 0x9D35, 0x5AEB, 0x5AEB, 0x9D35, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xD71E, 0xDF7F, 0x7C31, 0x18E3, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x52EC, 0xBE7B, 0xCEDD,
+  0xC69C, 0xCEDD, 0xD71E, 0xA576, 0x632C, 0x632C, 0xA576, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xD73D, 0x9D36, 0x10A2, 0x0000, 0x0020, 0x0000, 0x0020, 0x73D0,
+  0xFFFF, 0xE7BF, 0xD71D, 0xE77F, 0xE79F, 0xADB7, 0x6B6D, 0x6B6D, 0xA556, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xF7FF, 0xC6BC, 0x18E3, 0x0020, 0x0000, 0x0020,
+  0x636E, 0xD73E, 0xC6BD, 0xB63B, 0xBE5C, 0xC69D, 0x9D15, 0x632C, 0x632C, 0xA576, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000,
+  0x0020, 0x73CF, 0xCEFE, 0x7CB5, 0x5B91, 0x6C33, 0x6C34, 0x73D1, 0x6B6D, 0x6B6D, 0xA576, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020,
+  0x0000, 0x0020, 0x73CF, 0xDF5F, 0x9D78, 0x84B5, 0x8D37, 0x8D17, 0x8C93, 0x6B6D, 0x632C, 0xA576, 0xD71E, 0xD71E, 0xCEDD, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3,
+  0x0020, 0x0000, 0x0020, 0x636E, 0xE79F, 0xE77F, 0xD71D, 0xDF3E, 0xE79F, 0xA576, 0x632C, 0x632C, 0xA576, 0xD71E, 0xD71E, 0xCEDD,
+  0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9,
+  0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xE79F, 0xD73E, 0xC6BC, 0xD71E, 0xDF5F, 0xA576, 0x632C, 0x632C, 0xA576, 0xD71E, 0xD71E,
+  0xCEFD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C, 0xE7BF,
+  0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xE77F, 0xD71E, 0xC69C, 0xD71E, 0xD71E, 0xA576, 0x632C, 0x632C, 0xA576, 0xCEFE,
+  0xCF1E, 0xCEDD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xC6DD, 0xCEDD, 0xCEDD, 0xCEDD, 0xCEDD, 0xC69C,
+  0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xE77F, 0xD71E, 0xC69C, 0xD71E, 0xD71E, 0xA556, 0x632C, 0x632C, 0xA576,
+  0xD71E, 0xD73E, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xD6FD, 0xCEFD, 0xCEDD, 0xCEDD, 0xCEDD,
+  0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xE77F, 0xD71E, 0xC69C, 0xCEDD, 0xCEFE, 0xA556, 0x632C, 0x632C,
+  0xB595, 0xFFFE, 0xFFBE, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF77D, 0xF79C, 0xEF7D, 0xCEDD, 0xC6DD,
+  0xCEFD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xE79F, 0xE79F, 0xD71D, 0xE79F, 0xFFFF, 0xBDF7, 0x632C,
+  0x632C, 0xBDF6, 0xFFFE, 0xFFFD, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xFFDD, 0xF79C, 0xEF7D,
+  0xD6DD, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xC6BD, 0xADFA, 0xBE7C, 0xEF5D, 0xB595,
+  0x632C, 0x632C, 0xBDD6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77C, 0xF79C,
+  0xFFDD, 0xEF7D, 0xCEDD, 0xC69C, 0xE7BF, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x73CF, 0xD73F, 0x84B5, 0x5B91, 0x6C13, 0x7434,
+  0x73F1, 0x6B6D, 0x632C, 0xB595, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xEF7D, 0xC6BC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x73CF, 0xDF5F, 0x9D78, 0x8CD5, 0xAD97,
+  0xA597, 0x8CB3, 0x6B6D, 0x632C, 0xB595, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF77C, 0xFFDD, 0xF79C, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xDF7F, 0xE75D,
+  0xFFFF, 0xFFFF, 0xBDF6, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xD71E,
+  0xE73D, 0xFFFE, 0xFFFF, 0xBDF6, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F,
+  0xCF1E, 0xD6DB, 0xFFDD, 0xFFFE, 0xB595, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E,
+  0xDF7F, 0xD71E, 0xDF1C, 0xFFFD, 0xFFFE, 0xBDD6, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020,
+  0x636E, 0xDF7F, 0xCF1E, 0xD6DB, 0xFFDD, 0xFFFE, 0xB595, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000,
+  0x0020, 0x636E, 0xDF7F, 0xE77F, 0xEF9E, 0xFFFF, 0xFFFF, 0xBDF6, 0x632C, 0x632C, 0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020,
+  0x0000, 0x0020, 0x6B6E, 0xDF7F, 0xC6BD, 0xC65A, 0xE71B, 0xE73C, 0xAD75, 0x632C, 0x632C, 0xBDD6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3,
+  0x0020, 0x0000, 0x0020, 0x73CF, 0xD73F, 0x7CB5, 0x5B91, 0x6C33, 0x6C34, 0x73F1, 0x6B6D, 0x632C, 0xB595, 0xFFFE, 0xFFDE, 0xF79C,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F, 0xADF9,
+  0x18E3, 0x0020, 0x0000, 0x0020, 0x73CF, 0xDF5F, 0x9D78, 0x8CD5, 0xA597, 0xA597, 0x8CB3, 0x6B6D, 0x632C, 0xB595, 0xFFFE, 0xFFDE,
+  0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC, 0xE79F,
+  0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xDF7F, 0xE75D, 0xFFFF, 0xFFFF, 0xBDF6, 0x632C, 0x632C, 0xBDF6, 0xFFFE,
+  0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D, 0xCEBC,
+  0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xD71E, 0xE73D, 0xFFFE, 0xFFFF, 0xBDF6, 0x632C, 0x632C, 0xBDF6,
+  0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF77D,
+  0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xCF1E, 0xD6DB, 0xFFDD, 0xFFFE, 0xBDD6, 0x6B6D, 0x6B6D,
+  0xBDF6, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF77D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xDF7F, 0xD71E, 0xDF3C, 0xFFFD, 0xFFFE, 0xB595, 0x5AEB,
+  0x5AEB, 0xB5B5, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF79C, 0xF79D, 0xCEBC, 0xE79F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x636E, 0xD73E, 0xD71E, 0xDF3C, 0xFFFD, 0xFFFE, 0xB595,
+  0x5AEB, 0x5AEB, 0xB595, 0xFFFE, 0xFFDE, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C, 0xF79C,
+  0xF77C, 0xF7BC, 0xF79D, 0xD6FD, 0xDF9F, 0xADF9, 0x18E3, 0x0020, 0x0000, 0x0020, 0x73D0, 0xF7FF, 0xDF5F, 0xCEBC, 0xEF7D, 0xFFFE,
+  0xD6B9, 0xAD75, 0xAD75, 0xD6B9, 0xFFFE, 0xFFFE, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD, 0xF7BD,
+  0xF7BD, 0xF7BD, 0xF79D, 0xDF1D, 0xC69C, 0xF7FF, 0xC6BC, 0x18E3, 0x0020, 0x0000, 0x0020, 0x0000, 0x52EC, 0xC67B, 0xD71E, 0xCEDD,
+  0xCEDD, 0xEF5C, 0xFFBD, 0xFFDE, 0xFFDE, 0xF7BD, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C, 0xEF5C,
+  0xEF5C, 0xEF5C, 0xEF5C, 0xF79D, 0xE73D, 0xCEDD, 0xCEDD, 0xD73D, 0x9D36, 0x10A2, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0861, 0x31C7, 0xB61A, 0xE7BF, 0xC69C, 0xC65B, 0xC67B, 0xCEBC, 0xCE9C, 0xCE9C, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B,
+  0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67B, 0xC67C, 0xD73E, 0xDF7F, 0x73D0, 0x10A2, 0x0020, 0x0020, 0x0000,
+  0x0000, 0x0020, 0x0020, 0xADD8, 0xEFBF, 0xBE1A, 0xBE3B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B,
+  0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB61B, 0xB63B, 0xB61B, 0xB61B, 0xB61A, 0xD71E, 0xE79F, 0x5B0C, 0x0020, 0x0000, 0x0020,
+  0x0000, 0x2124, 0xADF9, 0xDF3F, 0xB5D9, 0xBE3B, 0xC65B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xC65B, 0xC65B, 0xBE1A, 0xC69C, 0xDF5F, 0x638E, 0x0020, 0x0000, 0x0020, 0x0000,
+  0x0020, 0x0000, 0x10C3, 0xA577, 0xD6FE, 0xB5FA, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xB5FA, 0xC67C, 0xC69D, 0x632E, 0x0000, 0x0020, 0x0000,
+  0x0020, 0x18E4, 0xB5FA, 0xDF5F, 0xADB9, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xB5FA, 0xC69C, 0xDF5F, 0x636E, 0x0020, 0x0000, 0x0020, 0x0000,
+  0x10C3, 0x8CB4, 0xCEBD, 0xC67C, 0xBE5B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xBE3B, 0xC67C, 0xCE9D, 0xB61A, 0x52AB, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020,
+  0x10C3, 0x7BF1, 0xDF5F, 0xC69D, 0xB5FA, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE3B, 0xB5FA, 0xDF5F, 0xB61A, 0x31A7, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x1904, 0x6B8F,
+  0xB5FA, 0xCE9D, 0xBE3B, 0xBE3B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B,
+  0xBE3B, 0xC67C, 0xC69C, 0x8CD4, 0x424A, 0x0000, 0x0000, 0x0000, 0x0861, 0x0841, 0x9D36, 0xD71F, 0xB61A, 0xBE3B, 0xBE5B, 0xBE5B,
+  0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xBE5B, 0xB61A, 0xC69C, 0xCEDE, 0x52CC, 0x0000, 0x0020
+};
+
+inline constexpr SpriteSpans SPRITE_BOTTLE_66_SPANS = {
+  SPRITE_BOTTLE_66_SPAN_ROWS, SPRITE_BOTTLE_66_SPAN_OPS, SPRITE_BOTTLE_66_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_BOTTLE_66_ASSET = {
   SPRITE_BOTTLE_66_WIDTH, SPRITE_BOTTLE_66_HEIGHT,
-  SPRITE_BOTTLE_66_ALPHA, SPRITE_BOTTLE_66_RGB565
+  nullptr, nullptr, &SPRITE_BOTTLE_66_SPANS
 };
 
 #endif // SPRITE_BOTTLE_66_INCLUDED
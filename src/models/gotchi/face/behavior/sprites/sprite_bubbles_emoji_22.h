@@ -5,66 +5,71 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from bubbles_emoji_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from bubbles_emoji_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 325/484 pixels visibles, 1157 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_BUBBLES_EMOJI_22_WIDTH = 22;
 constexpr uint16_t SPRITE_BUBBLES_EMOJI_22_HEIGHT = 22;
 
-const uint16_t SPRITE_BUBBLES_EMOJI_22_RGB565[] PROGMEM = {
-  0x0000, 0xFFFF, 0x0000, 0x0000, 0x9E5D, 0x9E7E, 0xA6BE, 0x8E3E, 0x2CBC, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7FFF, 0x0000, 0x9E3D, 0xAEBE, 0xB6FF, 0xCF5F, 0xCF7F, 0xB71F, 0x65BE, 0x555D, 0x3C7A, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xAEBD, 0xB6FF, 0xDFDF, 0xF7DF, 0xFFFF, 0xFFFF, 0xCF5F, 0x7E3E, 0x7E7F, 0x5D9D, 0x44FC, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1C5B, 0x861E, 0xE7DF, 0xFFFF, 0xFFFF, 0xF7DF, 0xEFBF, 0xB6FE, 0x761D, 0x863D, 0x867F, 0x555C, 0x2BFA, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x44FC, 0x969F, 0xFFFF, 0xFFFF, 0xDF7F, 0xC71F, 0xB6FE, 0x863E, 0x7E1E, 0x7E1E, 0x863E, 0x763F, 0x4D1C, 0x0000, 0x3DF7, 0x0000, 0x7FFF, 0xAFFF, 0xAD5F, 0xFFFF, 0x0000, 0x0000,
-  0x555D, 0xCF5F, 0xFFFF, 0xC73F, 0x967E, 0x9E9E, 0x863E, 0x7E1E, 0x7E1E, 0x7E1E, 0x761D, 0x7E5F, 0x5D5D, 0x0000, 0x7DFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000,
-  0x5D7D, 0xE7BF, 0xFFFF, 0x967E, 0x75FD, 0x7E1D, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0xB6FE, 0x96BF, 0x555D, 0x0000, 0x0000, 0x0000, 0x9E9F, 0xA6BF, 0xA69E, 0x6D5A, 0x0000, 0x7BFF,
-  0x5D7D, 0xCF5F, 0xEFBF, 0x863E, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0x863E, 0xFFDF, 0xAEFF, 0x555C, 0x0000, 0xAE7E, 0xAEBE, 0xB6FF, 0xC75F, 0xC73F, 0x8E5E, 0x3CDB, 0x0000,
-  0x5D7D, 0x7E3E, 0x7E1D, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E3E, 0x863E, 0x75FD, 0x9E9E, 0xFFDF, 0x96BF, 0x555D, 0x0000, 0xA69E, 0xDFDF, 0xF7DF, 0xFFFF, 0xEFBF, 0xA6DF, 0x65BE, 0x4D1C,
-  0x553C, 0x7E5F, 0x7E3D, 0x7E1E, 0x7E1E, 0x7E1E, 0x75FD, 0x75FD, 0x8E5E, 0xEFBF, 0xD75F, 0x763F, 0x553C, 0x3CDC, 0xAF1F, 0xFFFF, 0xFFFF, 0xFFFF, 0xDF7F, 0x8E5E, 0x763E, 0x5D5C,
-  0x3CBC, 0x5D7D, 0x865F, 0x7E1D, 0x7E1E, 0x863E, 0xA6BE, 0xBF1F, 0xF7DF, 0xE79F, 0x869F, 0x555D, 0x001F, 0x451C, 0xAF1F, 0xFFFF, 0xEFBF, 0xBEFE, 0x967E, 0x865E, 0x967E, 0x5D7D,
-  0x0000, 0x44FC, 0x65BE, 0x867F, 0x7E1D, 0x967E, 0xEFBF, 0xEFBF, 0xBF1E, 0x867F, 0x5D9D, 0x4CFC, 0x0000, 0x4D1C, 0x9EDF, 0xEFDF, 0xAEDE, 0x761D, 0x6DDD, 0xBF1F, 0xE79F, 0x5D7D,
-  0x555F, 0x0000, 0x44DB, 0x5D7D, 0x6DDE, 0x7E5F, 0x7E5F, 0x763F, 0x5DBD, 0x557D, 0x44BB, 0x0000, 0xFFFF, 0x4D1C, 0x761F, 0x863E, 0x761D, 0x863E, 0xA6BE, 0xF7DF, 0xBF3F, 0x4D3C,
-  0x0000, 0x7FFF, 0x0000, 0x0000, 0x44FD, 0x4D1C, 0x4D3D, 0x4D3D, 0x3CFC, 0x0000, 0xFFFF, 0x659C, 0x0000, 0x0000, 0x555C, 0x7E7F, 0x761D, 0xBF1F, 0xFFFF, 0xCF7F, 0x65BE, 0x44FC,
-  0x0000, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF3E, 0xAEDF, 0xAEBE, 0xB6DE, 0xA69E, 0x3CBB, 0x44DC, 0x555D, 0x65DE, 0x763F, 0x7E1E, 0x5D9E, 0x44FC, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x555A, 0x667F, 0x75DD, 0xAEBE, 0xDFDF, 0xEFDF, 0xEFDF, 0xBF5F, 0x5D7D, 0x3C7C, 0x0000, 0x44FD, 0x453D, 0x3CFC, 0x2BF7, 0x0000, 0x7BFF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x4D1C, 0xBF5F, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E9E, 0x765F, 0x553C, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x4D1C, 0xBF5F, 0xFFFF, 0xDF7F, 0x967E, 0xB6DE, 0x9EDF, 0x4D3C, 0x0000, 0x56BA, 0x555F, 0x555F, 0x07FF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x4D3C, 0x96BF, 0xCF5F, 0x8E5E, 0x8E5E, 0xFFFF, 0xB73F, 0x451C, 0x0000, 0x3DF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x4CFC, 0x6DFF, 0x761E, 0x9E9E, 0xFFFF, 0xDF9F, 0x761F, 0x44FC, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x4D3C, 0x65DE, 0x7E3F, 0x8E7F, 0x65DE, 0x44FC, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x3CBB, 0x451C, 0x3CDC, 0x34BB, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_BUBBLES_EMOJI_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 14, 7, 30, 18, 47, 30, 63, 44, 84, 62, 101, 78, 119, 96,
+  135, 116, 156, 137, 179, 159, 200, 181, 225, 201, 251, 221, 277, 237, 296, 251,
+  317, 267, 337, 278, 357, 291, 374, 301, 391, 311, 406, 319
 };
 
-const uint8_t SPRITE_BUBBLES_EMOJI_22_ALPHA[] PROGMEM = {
-  0x00, 0x02, 0x00, 0x00, 0x30, 0x62, 0x69, 0x5C, 0x24, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x2D, 0xB3, 0xF8, 0xFF, 0xFF, 0xFF, 0xF1, 0x9E, 0x19, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3D, 0xF1, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0xFF, 0xFF, 0xDD, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0xE5, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xCB, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x5C, 0x00, 0x04, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00,
-  0xE4, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xB2, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x2C, 0x47, 0x3F, 0x0C, 0x00, 0x02,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD2, 0x00, 0x15, 0xAE, 0xFC, 0xFF, 0xFF, 0xDF, 0x53, 0x00,
-  0xE7, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xB4, 0x00, 0xC5, 0xFF, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF, 0x47,
-  0x96, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x51, 0x45, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xD2,
-  0x1D, 0xEB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xD6, 0x01, 0x8C, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0x00, 0x46, 0xF6, 0xFF, 0xFD, 0xFB, 0xFB, 0xFB, 0xFE, 0xFF, 0xE5, 0x2D, 0x00, 0x90, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE,
-  0x03, 0x00, 0x37, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB0, 0x1F, 0x00, 0x02, 0x57, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xD2,
-  0x00, 0x02, 0x00, 0x00, 0x38, 0x6A, 0x70, 0x65, 0x27, 0x00, 0x02, 0x0A, 0x00, 0x00, 0xC4, 0xFF, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF, 0x47,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xA7, 0xE4, 0xE2, 0xA7, 0x1D, 0x12, 0xAF, 0xFC, 0xFF, 0xFF, 0xDF, 0x53, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x05, 0x1A, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x12, 0x00, 0x2D, 0x47, 0x3F, 0x0C, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0xFF, 0xF8, 0xFE, 0xFE, 0xF8, 0xFF, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xAD, 0xFD, 0xFB, 0xFF, 0xFF, 0xFB, 0xFD, 0xAD, 0x00, 0x06, 0x03, 0x03, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x9F, 0xFE, 0xFA, 0xFF, 0xFF, 0xFA, 0xFE, 0x9F, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x43, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0x43, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6E, 0xF3, 0xFF, 0xFF, 0xF3, 0x6E, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2A, 0x67, 0x67, 0x2A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_BUBBLES_EMOJI_22_SPAN_OPS[] PROGMEM = {
+  0x00, 0x80, 0x02, 0x01, 0x84, 0x30, 0x62, 0x69, 0x5C, 0x24, 0x01, 0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x2D, 0xB3, 0xF8, 0x42, 0x82, 0xF1,
+  0x9E, 0x19, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x81, 0x3D, 0xF1, 0x41, 0x82, 0xFD, 0xFC, 0xFD, 0x41, 0x81, 0xDD, 0x22, 0x00, 0x80, 0x02, 0xC0, 0x81,
+  0x18, 0xE5, 0x40, 0x80, 0xFA, 0x43, 0x81, 0xFE, 0xF9, 0x40, 0x82, 0xCB, 0x06, 0x01, 0xC0, 0x80, 0x90, 0x40, 0x80, 0xFB, 0x46, 0x80, 0xFA, 0x40,
+  0x80, 0x5C, 0x00, 0x80, 0x04, 0x00, 0x83, 0x02, 0x03, 0x03, 0x01, 0xC0, 0x82, 0xE4, 0xFE, 0xFE, 0x46, 0x82, 0xFB, 0xFE, 0xB2, 0x00, 0x81, 0x04,
+  0x01, 0x03, 0x80, 0x03, 0xC0, 0x80, 0xFE, 0x48, 0x80, 0xFD, 0x40, 0x80, 0xCF, 0x02, 0x83, 0x2C, 0x47, 0x3F, 0x0C, 0x00, 0x80, 0x02, 0xC0, 0x49,
+  0x80, 0xFD, 0x40, 0x80, 0xD2, 0x00, 0x82, 0x15, 0xAE, 0xFC, 0x41, 0x81, 0xDF, 0x53, 0xC0, 0x82, 0xE7, 0xFE, 0xFE, 0x46, 0x82, 0xFB, 0xFE, 0xB4,
+  0x00, 0x80, 0xC5, 0x40, 0x82, 0xFD, 0xFC, 0xFC, 0x41, 0x80, 0x47, 0xC0, 0x80, 0x96, 0x40, 0x80, 0xFB, 0x46, 0x80, 0xFA, 0x40, 0x81, 0x51, 0x45,
+  0x40, 0x81, 0xF9, 0xFE, 0x41, 0x80, 0xFB, 0x40, 0x80, 0xD2, 0xC0, 0x81, 0x1D, 0xEB, 0x40, 0x80, 0xFB, 0x44, 0x80, 0xFA, 0x40, 0x84, 0xD6, 0x01,
+  0x8C, 0xFD, 0xFB, 0x43, 0x81, 0xFE, 0xFE, 0xC0, 0x00, 0x81, 0x46, 0xF6, 0x40, 0x84, 0xFD, 0xFB, 0xFB, 0xFB, 0xFE, 0x40, 0x81, 0xE5, 0x2D, 0x00,
+  0x82, 0x90, 0xFD, 0xFB, 0x43, 0x81, 0xFE, 0xFE, 0xC0, 0x80, 0x03, 0x00, 0x81, 0x37, 0xC2, 0x43, 0x82, 0xFD, 0xB0, 0x1F, 0x00, 0x81, 0x02, 0x57,
+  0x40, 0x81, 0xF9, 0xFE, 0x41, 0x80, 0xFB, 0x40, 0x80, 0xD2, 0xC0, 0x00, 0x80, 0x02, 0x01, 0x84, 0x38, 0x6A, 0x70, 0x65, 0x27, 0x00, 0x81, 0x02,
+  0x0A, 0x01, 0x80, 0xC4, 0x40, 0x82, 0xFD, 0xFC, 0xFC, 0x41, 0x80, 0x47, 0xC0, 0x01, 0x80, 0x02, 0x04, 0x88, 0x14, 0xA7, 0xE4, 0xE2, 0xA7, 0x1D,
+  0x12, 0xAF, 0xFC, 0x41, 0x81, 0xDF, 0x53, 0xC0, 0x03, 0x84, 0x03, 0x06, 0x05, 0x1A, 0xDE, 0x43, 0x81, 0xDC, 0x12, 0x00, 0x83, 0x2D, 0x47, 0x3F,
+  0x0C, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x04, 0x00, 0x80, 0x80, 0x40, 0x83, 0xF8, 0xFE, 0xFE, 0xF8, 0x40, 0x81, 0x81, 0x01, 0x03, 0x80, 0x03,
+  0xC0, 0x04, 0x80, 0x04, 0x00, 0x82, 0xAD, 0xFD, 0xFB, 0x41, 0x82, 0xFB, 0xFD, 0xAD, 0x00, 0x83, 0x06, 0x03, 0x03, 0x01, 0xC0, 0x04, 0x80, 0x04,
+  0x00, 0x82, 0x9F, 0xFE, 0xFA, 0x41, 0x82, 0xFA, 0xFE, 0x9F, 0x00, 0x80, 0x04, 0xC0, 0x04, 0x80, 0x03, 0x00, 0x80, 0x43, 0x41, 0x81, 0xFB, 0xFB,
+  0x41, 0x80, 0x43, 0x00, 0x80, 0x03, 0xC0, 0x05, 0x80, 0x02, 0x00, 0x81, 0x6E, 0xF3, 0x41, 0x81, 0xF3, 0x6E, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x80,
+  0x01, 0x00, 0x83, 0x2A, 0x67, 0x67, 0x2A, 0x00, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_BUBBLES_EMOJI_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x1925, 0x3A6B, 0x42AC, 0x324B, 0x00A4, 0x0000, 0x0000, 0x1925, 0x7494, 0xAEBE, 0xCF5F, 0xCF7F, 0xB71F, 0x5D5C, 0x3352,
+  0x0062, 0x0000, 0x29A7, 0xA67D, 0xDFDF, 0xF7DF, 0xFFFF, 0xFFFF, 0xCF5F, 0x7E3E, 0x7E7F, 0x4CD9, 0x0883, 0x0000, 0x0062, 0x757B,
+  0xE7DF, 0xF7BE, 0xFFFF, 0xF7DF, 0xEFBF, 0xB6FE, 0x761D, 0x7DFC, 0x867F, 0x3C15, 0x0000, 0x0000, 0x22AF, 0x969F, 0xF7BE, 0xFFFF,
+  0xDF7F, 0xC71F, 0xB6FE, 0x863E, 0x7E1E, 0x7E1E, 0x7DFD, 0x763F, 0x19EA, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x4CDA, 0xCF5F,
+  0xFFFF, 0xC73F, 0x967E, 0x9E9E, 0x863E, 0x7E1E, 0x7E1E, 0x7E1E, 0x6DDC, 0x7E5F, 0x3B93, 0x0020, 0x0000, 0x0000, 0x5D7D, 0xE7BF,
+  0xFFFF, 0x967E, 0x75FD, 0x7E1D, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0xB6FE, 0x96BF, 0x4457, 0x1925, 0x29C8, 0x29A7, 0x0041, 0x0000,
+  0x5D7D, 0xCF5F, 0xEFBF, 0x863E, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E1E, 0x863E, 0xFFDF, 0xAEFF, 0x4456, 0x0882, 0x7494, 0xB6FF,
+  0xC75F, 0xC73F, 0x757A, 0x1168, 0x4CDA, 0x7E3E, 0x7E1D, 0x7E1E, 0x7E1E, 0x7E1E, 0x7E3E, 0x863E, 0x75FD, 0x9E9E, 0xF79E, 0x96BF,
+  0x3BD4, 0x7D17, 0xDFDF, 0xF7DF, 0xFFFF, 0xEFBF, 0xA6DF, 0x65BE, 0x1167, 0x2B10, 0x7E5F, 0x75FC, 0x7E1E, 0x7E1E, 0x7E1E, 0x75FD,
+  0x75FD, 0x8E5E, 0xEFBF, 0xCF1E, 0x763F, 0x1988, 0x0947, 0xAF1F, 0xF7BE, 0xFFFF, 0xFFFF, 0xDF7F, 0x861D, 0x763E, 0x4456, 0x0083,
+  0x4CDA, 0x865F, 0x75DC, 0x7E1E, 0x863E, 0xA6BE, 0xBF1F, 0xF7DF, 0xDF5E, 0x869F, 0x4478, 0x0000, 0x22CF, 0xAF1F, 0xF7BE, 0xEFBF,
+  0xBEFE, 0x967E, 0x865E, 0x967E, 0x5D7D, 0x1147, 0x5D7D, 0x867F, 0x7E1D, 0x8E3D, 0xE77E, 0xE77E, 0xBF1E, 0x867F, 0x4CFA, 0x08E5,
+  0x2ACF, 0x9EDF, 0xE79E, 0xAEDE, 0x761D, 0x6DDD, 0xBF1F, 0xE79F, 0x5D7D, 0x0000, 0x0905, 0x4415, 0x6DDE, 0x7E5F, 0x7E5F, 0x763F,
+  0x5DBD, 0x33B3, 0x0883, 0x0000, 0x19A9, 0x761F, 0x7DFD, 0x761D, 0x863E, 0xA6BE, 0xEF9E, 0xBF3F, 0x3C36, 0x0000, 0x0906, 0x1A0B,
+  0x1A2C, 0x1A0B, 0x08C4, 0x0000, 0x0020, 0x3C15, 0x7E7F, 0x761D, 0xBF1F, 0xFFFF, 0xCF7F, 0x65BE, 0x1147, 0x0000, 0x10A2, 0x6C74,
+  0x9E1B, 0x9DFA, 0x6C53, 0x0083, 0x0041, 0x3393, 0x65DE, 0x763F, 0x7E1E, 0x4CDA, 0x1188, 0x0000, 0x0020, 0x0020, 0x0882, 0x95DA,
+  0xDFDF, 0xEFDF, 0xEFDF, 0xBF5F, 0x4CB9, 0x0041, 0x08E5, 0x1168, 0x0927, 0x0021, 0x0000, 0x0020, 0x228E, 0xBF5F, 0xF7BE, 0xFFFF,
+  0xFFFF, 0x965D, 0x765F, 0x2A8E, 0x0000, 0x0000, 0x0020, 0x3373, 0xBF5F, 0xF7BE, 0xDF7F, 0x967E, 0xAE9D, 0x9EDF, 0x3393, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x2B31, 0x96BF, 0xC71E, 0x8E5E, 0x8E5E, 0xF7BE, 0xB73F, 0x2B31, 0x0020, 0x0000, 0x1127, 0x6DFF,
+  0x761E, 0x965D, 0xF7BE, 0xDF9F, 0x761F, 0x1127, 0x0000, 0x0000, 0x1A2C, 0x5D7C, 0x7E3F, 0x8E7F, 0x5D7C, 0x1A2C, 0x0000, 0x0000,
+  0x08A4, 0x1A0B, 0x11EB, 0x00A4, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_BUBBLES_EMOJI_22_SPANS = {
+  SPRITE_BUBBLES_EMOJI_22_SPAN_ROWS, SPRITE_BUBBLES_EMOJI_22_SPAN_OPS, SPRITE_BUBBLES_EMOJI_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_BUBBLES_EMOJI_22_ASSET = {
   SPRITE_BUBBLES_EMOJI_22_WIDTH, SPRITE_BUBBLES_EMOJI_22_HEIGHT,
-  SPRITE_BUBBLES_EMOJI_22_ALPHA, SPRITE_BUBBLES_EMOJI_22_RGB565
+  nullptr, nullptr, &SPRITE_BUBBLES_EMOJI_22_SPANS
 };
 
 #endif // SPRITE_BUBBLES_EMOJI_22_INCLUDED
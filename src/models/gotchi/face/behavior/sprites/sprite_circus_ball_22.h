@@ -5,66 +5,68 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from circus_ball_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from circus_ball_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 336/484 pixels visibles, 1109 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_CIRCUS_BALL_22_WIDTH = 22;
 constexpr uint16_t SPRITE_CIRCUS_BALL_22_HEIGHT = 22;
 
-const uint16_t SPRITE_CIRCUS_BALL_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x555D, 0x5D9F, 0x557D, 0x557D, 0x5D9E, 0x557E, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DFF, 0x0000, 0x5D9E, 0x663F, 0x5DBF, 0x557E, 0x559E, 0x557D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E7, 0x0000, 0x1126, 0x2AAF, 0x559E, 0x4D1B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39E7, 0xFFFF, 0x0840, 0x0800, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE79, 0x0000, 0xC65A, 0xC65A, 0x0000, 0x95BB, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE79, 0x0000, 0xC67A, 0xEFBF, 0xEF9F, 0xC69B, 0x0000, 0xCE7F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0xAD55, 0x0000, 0xC67A, 0xDF3D, 0xE75D, 0xE75D, 0xDF3D, 0xC67A, 0x0000, 0xAD55, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAD55, 0xAFFF, 0x0000, 0x0000, 0xC69B, 0xDF1D, 0xEF9E, 0xDF1C, 0xDF1C, 0xEF7E, 0xDF1D, 0xC6BB, 0x0000, 0x0000, 0xAFFF, 0xAD55, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xD6DC, 0xCEBB, 0xDF3D, 0xF7BF, 0xD6FC, 0xDF3D, 0xDF3D, 0xD6FC, 0xF7BF, 0xDF3D, 0xCEBB, 0xCEDC, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xCEDB, 0xCEDB, 0xCEBB, 0xE75D, 0xF7DF, 0xE77E, 0xC69B, 0xEF7E, 0xEF7E, 0xC69B, 0xE77E, 0xF7BF, 0xE75D, 0xCEBB, 0xCEDC, 0xCEDB, 0x0000, 0x0000, 0x0000,
-  0x7BEF, 0xBEFB, 0xCEBB, 0xD6FC, 0xDF1D, 0xE73D, 0xF7DF, 0xEF9E, 0xCEBB, 0xCEDB, 0xF7BF, 0xF7BF, 0xCEDB, 0xCEBB, 0xEF9E, 0xF7DF, 0xE73D, 0xD71D, 0xD6FC, 0xCEBB, 0xBEFB, 0x7BEF,
-  0x0000, 0xCEBB, 0xDF1D, 0xCEBB, 0xD6DB, 0xF7DF, 0xFFDF, 0xDF1C, 0xC69B, 0xD6FC, 0xF7DF, 0xF7DF, 0xD6FC, 0xC69B, 0xDF1C, 0xFFDF, 0xF7DF, 0xD6DB, 0xCEBB, 0xDF1D, 0xCEBB, 0x0000,
-  0x0000, 0xCEDB, 0xD6DC, 0xCE9B, 0xD6DC, 0xF7BE, 0xF7BF, 0xDF1C, 0xC67A, 0xD6FC, 0xF7BF, 0xF7BF, 0xD6FC, 0xC67A, 0xDF1C, 0xF7BF, 0xF7BE, 0xD6DC, 0xCE9B, 0xD6DC, 0xCEDB, 0x0000,
-  0x0000, 0xCEBB, 0xD71D, 0xCF3D, 0xCEBB, 0xF7FF, 0xFFFF, 0xDF1D, 0xCF1D, 0xDF1D, 0xFFFF, 0xFFFF, 0xD71D, 0xCF1D, 0xDF1D, 0xFFFF, 0xF7FF, 0xCEBB, 0xCF3D, 0xD71D, 0xCEBB, 0x0000,
-  0xFFFF, 0xFFFF, 0xCC11, 0xCCF5, 0xCA6B, 0xDC32, 0xDCF5, 0xCAAC, 0xCCB4, 0x4A29, 0x8431, 0x8431, 0x4A29, 0xCCB4, 0xCA8C, 0xDCF5, 0xDC32, 0xCA6B, 0xCCF5, 0xCC11, 0xFFFF, 0xFFFF,
-  0xF800, 0x0000, 0xD0E6, 0xD8E6, 0xD927, 0xD0E6, 0xD0C6, 0xD927, 0xC989, 0x0800, 0x0000, 0x0000, 0x0800, 0xD1A9, 0xD948, 0xD0C6, 0xD0E6, 0xD927, 0xD8E6, 0xD0E6, 0x0000, 0xF800,
-  0x0000, 0xB9EF, 0xD988, 0xE1A9, 0xD988, 0xD989, 0xD968, 0xEA4B, 0xD2AD, 0x0820, 0x0000, 0x0000, 0x0820, 0xD2AD, 0xEA8C, 0xD968, 0xD988, 0xD988, 0xE1A9, 0xD988, 0xB9EF, 0x0000,
-  0x0000, 0xE167, 0xD968, 0xE168, 0xD968, 0xD968, 0xD9C9, 0xF2EE, 0xB22A, 0x0000, 0x0000, 0x0000, 0x0000, 0xB22A, 0xF2EE, 0xE20A, 0xD968, 0xD968, 0xE168, 0xD968, 0xE167, 0x0000,
-  0x0000, 0xD148, 0xD968, 0xE168, 0xD968, 0xD988, 0xE28D, 0xFB0E, 0x89A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x89A8, 0xFAEE, 0xE2CD, 0xD9A9, 0xD968, 0xE168, 0xD968, 0xD148, 0x0000,
-  0x0000, 0xD968, 0xE168, 0xD968, 0xD968, 0xD968, 0xD9C9, 0xFB0E, 0x6125, 0x0000, 0x0000, 0x0000, 0x0000, 0x6125, 0xFB0F, 0xDA0A, 0xD968, 0xD968, 0xD968, 0xE168, 0xD968, 0x0000,
-  0x0000, 0xE148, 0xE168, 0xE989, 0xE989, 0xE989, 0xE968, 0xEA4B, 0x2882, 0x0000, 0x0000, 0x0000, 0x0000, 0x2882, 0xF26C, 0xE968, 0xE988, 0xE989, 0xE989, 0xE168, 0xE148, 0x0000,
-  0xF800, 0x0000, 0xD968, 0xE189, 0xD968, 0xD968, 0xE168, 0xC168, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xC9A9, 0xD968, 0xD968, 0xD968, 0xE189, 0xD968, 0x0000, 0xF800
+const uint16_t SPRITE_CIRCUS_BALL_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 15, 8, 29, 16, 40, 22, 50, 27, 62, 32, 75, 38, 93, 48,
+  114, 60, 137, 74, 159, 92, 175, 114, 192, 134, 203, 154, 212, 174, 228, 196,
+  246, 216, 261, 236, 276, 256, 291, 276, 316, 296, 323, 316
 };
 
-const uint8_t SPRITE_CIRCUS_BALL_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x83, 0xEC, 0xC5, 0xA3, 0x7C, 0x25, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xE8, 0x51, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xA7, 0xD1, 0x3E, 0x1E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xAC, 0xA5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xC2, 0xC4, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6C, 0xFF, 0xFF, 0x69, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x5E, 0xFF, 0xFD, 0xFD, 0xFE, 0x5E, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x78, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0x78, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x35, 0xBA, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xBA, 0x35, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x3D, 0xA9, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0xA8, 0x3D, 0x00, 0x00, 0x01,
-  0x02, 0x08, 0x9D, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9D, 0x08, 0x02,
-  0x00, 0x2D, 0xFF, 0xFE, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0xFF, 0x2D, 0x00,
-  0x00, 0x30, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0x30, 0x00,
-  0x00, 0x26, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x26, 0x00,
-  0x01, 0x01, 0xC3, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xC3, 0x01, 0x01,
-  0x01, 0x00, 0xCB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xCB, 0x00, 0x01,
-  0x00, 0x04, 0xDE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDE, 0x04, 0x00,
-  0x00, 0x11, 0xE9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xE9, 0x11, 0x00,
-  0x00, 0x1E, 0xF6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0x1E, 0x00,
-  0x00, 0x2E, 0xFF, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFF, 0x2E, 0x00,
-  0x00, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x00,
-  0x01, 0x00, 0x49, 0x6A, 0x68, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x68, 0x6A, 0x49, 0x00, 0x01
+const uint8_t SPRITE_CIRCUS_BALL_22_SPAN_OPS[] PROGMEM = {
+  0x07, 0x80, 0x04, 0x00, 0x85, 0x83, 0xEC, 0xC5, 0xA3, 0x7C, 0x25, 0x00, 0x80, 0x01, 0xC0, 0x07, 0x80, 0x04, 0x00, 0x80, 0x9F, 0x42, 0x81, 0xE8,
+  0x51, 0x00, 0x80, 0x03, 0xC0, 0x07, 0x80, 0x04, 0x00, 0x84, 0xA7, 0xD1, 0x3E, 0x1E, 0x01, 0xC0, 0x07, 0x83, 0x04, 0x01, 0xAC, 0xA5, 0x02, 0x80,
+  0x01, 0xC0, 0x07, 0x80, 0x05, 0x00, 0x81, 0xC2, 0xC4, 0x00, 0x81, 0x07, 0x01, 0xC0, 0x06, 0x80, 0x05, 0x00, 0x80, 0x6C, 0x41, 0x80, 0x69, 0x00,
+  0x80, 0x05, 0xC0, 0x04, 0x81, 0x03, 0x03, 0x00, 0x80, 0x5E, 0x40, 0x83, 0xFD, 0xFD, 0xFE, 0x5E, 0x00, 0x81, 0x03, 0x03, 0xC0, 0x02, 0x81, 0x03,
+  0x03, 0x01, 0x80, 0x78, 0x40, 0x83, 0xFE, 0xFE, 0xFE, 0xFE, 0x40, 0x80, 0x78, 0x01, 0x81, 0x03, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x01, 0x81, 0x35,
+  0xBA, 0x40, 0x81, 0xFE, 0xFE, 0x41, 0x81, 0xFE, 0xFE, 0x40, 0x81, 0xBA, 0x35, 0x01, 0x80, 0x02, 0xC0, 0x80, 0x01, 0x01, 0x82, 0x3D, 0xA9, 0xFC,
+  0x40, 0x80, 0xFC, 0x45, 0x80, 0xFC, 0x40, 0x82, 0xFC, 0xA8, 0x3D, 0x01, 0x80, 0x01, 0xC0, 0x82, 0x02, 0x08, 0x9D, 0x42, 0x80, 0xFC, 0x47, 0x80,
+  0xFC, 0x42, 0x82, 0x9D, 0x08, 0x02, 0xC0, 0x00, 0x80, 0x2D, 0x40, 0x82, 0xFE, 0xFC, 0xFE, 0x49, 0x82, 0xFE, 0xFC, 0xFE, 0x40, 0x80, 0x2D, 0xC0,
+  0x00, 0x82, 0x30, 0xFE, 0xFD, 0x4D, 0x82, 0xFD, 0xFE, 0x30, 0xC0, 0x00, 0x81, 0x26, 0xFA, 0x4F, 0x81, 0xFA, 0x26, 0xC0, 0x82, 0x01, 0x01, 0xC3,
+  0x40, 0x80, 0xFC, 0x4B, 0x80, 0xFC, 0x40, 0x82, 0xC3, 0x01, 0x01, 0xC0, 0x80, 0x01, 0x00, 0x80, 0xCB, 0x40, 0x80, 0xFC, 0x4B, 0x80, 0xFC, 0x40,
+  0x80, 0xCB, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x81, 0x04, 0xDE, 0x40, 0x80, 0xFD, 0x4B, 0x80, 0xFD, 0x40, 0x81, 0xDE, 0x04, 0xC0, 0x00, 0x81, 0x11,
+  0xE9, 0x40, 0x80, 0xFE, 0x4B, 0x80, 0xFE, 0x40, 0x81, 0xE9, 0x11, 0xC0, 0x00, 0x81, 0x1E, 0xF6, 0x40, 0x80, 0xFE, 0x4B, 0x80, 0xFE, 0x40, 0x81,
+  0xF6, 0x1E, 0xC0, 0x00, 0x80, 0x2E, 0x40, 0x8F, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB,
+  0x40, 0x80, 0x2E, 0xC0, 0x00, 0x80, 0x24, 0x51, 0x80, 0x24, 0xC0, 0x80, 0x01, 0x00, 0x91, 0x49, 0x6A, 0x68, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A,
+  0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x68, 0x6A, 0x49, 0x00, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_CIRCUS_BALL_22_SPAN_PX[] PROGMEM = {
+  0x0020, 0x2AAE, 0x553D, 0x3C36, 0x3352, 0x2ACF, 0x08C4, 0x0000, 0x0020, 0x3372, 0x663F, 0x5DBF, 0x557E, 0x4CFB, 0x19A9, 0x0000,
+  0x0000, 0x08A3, 0x222C, 0x1167, 0x08A3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x94B3, 0x94F4, 0x0020, 0x0000,
+  0x0020, 0x52CB, 0xEFBF, 0xEF9F, 0x4AAA, 0x0020, 0x0000, 0x0000, 0x4A69, 0xDF3D, 0xE75D, 0xE75D, 0xDF3D, 0x4A69, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x5B0C, 0xDF1D, 0xEF9E, 0xDF1C, 0xDF1C, 0xEF7E, 0xDF1D, 0x5B0C, 0x0000, 0x0000, 0x0000, 0x2966, 0x8CD3, 0xDF3D,
+  0xF7BF, 0xD6FC, 0xDF3D, 0xDF3D, 0xD6FC, 0xF7BF, 0xDF3D, 0x8CD3, 0x2966, 0x0000, 0x0000, 0x31A6, 0x8471, 0xCEBB, 0xE75D, 0xF7DF,
+  0xE77E, 0xC69B, 0xEF7E, 0xEF7E, 0xC69B, 0xE77E, 0xF7BF, 0xE75D, 0xCEBB, 0x8472, 0x31A6, 0x0000, 0x0000, 0x0020, 0x7C30, 0xD6FC,
+  0xDF1D, 0xE73D, 0xF7DF, 0xEF9E, 0xCEBB, 0xCEDB, 0xF7BF, 0xF7BF, 0xCEDB, 0xCEBB, 0xEF9E, 0xF7DF, 0xE73D, 0xD71D, 0xD6FC, 0x7C30,
+  0x0020, 0x0000, 0x2125, 0xDF1D, 0xCEBB, 0xD6DB, 0xF7DF, 0xFFDF, 0xDF1C, 0xC69B, 0xD6FC, 0xF7DF, 0xF7DF, 0xD6FC, 0xC69B, 0xDF1C,
+  0xFFDF, 0xF7DF, 0xD6DB, 0xCEBB, 0xDF1D, 0x2125, 0x2145, 0xD6DC, 0xCE9B, 0xD6DC, 0xF7BE, 0xF7BF, 0xDF1C, 0xC67A, 0xD6FC, 0xF7BF,
+  0xF7BF, 0xD6FC, 0xC67A, 0xDF1C, 0xF7BF, 0xF7BE, 0xD6DC, 0xCE9B, 0xD6DC, 0x2145, 0x1904, 0xCEDC, 0xCF3D, 0xCEBB, 0xF7FF, 0xFFFF,
+  0xDF1D, 0xCF1D, 0xDF1D, 0xFFFF, 0xFFFF, 0xD71D, 0xCF1D, 0xDF1D, 0xFFFF, 0xF7FF, 0xCEBB, 0xCF3D, 0xCEDC, 0x1904, 0x0000, 0x0000,
+  0x930C, 0xCCF5, 0xCA6B, 0xDC32, 0xDCF5, 0xCAAC, 0xCCB4, 0x4A29, 0x8431, 0x8431, 0x4A29, 0xCCB4, 0xCA8C, 0xDCF5, 0xDC32, 0xCA6B,
+  0xCCF5, 0x930C, 0x0000, 0x0000, 0x0000, 0xA0A4, 0xD8E6, 0xD927, 0xD0E6, 0xD0C6, 0xD927, 0xC989, 0x0800, 0x0000, 0x0000, 0x0800,
+  0xD1A9, 0xD948, 0xD0C6, 0xD0E6, 0xD927, 0xD8E6, 0xA0A4, 0x0000, 0x0000, 0xB947, 0xE1A9, 0xD988, 0xD989, 0xD968, 0xEA4B, 0xD2AD,
+  0x0820, 0x0000, 0x0000, 0x0820, 0xD2AD, 0xEA8C, 0xD968, 0xD988, 0xD988, 0xE1A9, 0xB947, 0x0000, 0x0800, 0xC127, 0xE168, 0xD968,
+  0xD968, 0xD9C9, 0xF2EE, 0xB22A, 0x0000, 0x0000, 0x0000, 0x0000, 0xB22A, 0xF2EE, 0xE20A, 0xD968, 0xD968, 0xE168, 0xC127, 0x0800,
+  0x1821, 0xD147, 0xE168, 0xD968, 0xD988, 0xE28D, 0xFB0E, 0x89A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x89A8, 0xFAEE, 0xE2CD, 0xD9A9,
+  0xD968, 0xE168, 0xD147, 0x1821, 0x2841, 0xE168, 0xD147, 0xD968, 0xD968, 0xD9C9, 0xFB0E, 0x6125, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x6125, 0xFB0F, 0xDA0A, 0xD968, 0xD968, 0xD147, 0xE168, 0x2841, 0x2021, 0xE168, 0xE989, 0xE989, 0xE989, 0xE968, 0xEA4B, 0x2882,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2882, 0xF26C, 0xE968, 0xE988, 0xE989, 0xE989, 0xE168, 0x2021, 0x0000, 0x3862, 0x5883, 0x5083,
+  0x5083, 0x5883, 0x4883, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50A3, 0x5083, 0x5083, 0x5083, 0x5883, 0x3862, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_CIRCUS_BALL_22_SPANS = {
+  SPRITE_CIRCUS_BALL_22_SPAN_ROWS, SPRITE_CIRCUS_BALL_22_SPAN_OPS, SPRITE_CIRCUS_BALL_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_CIRCUS_BALL_22_ASSET = {
   SPRITE_CIRCUS_BALL_22_WIDTH, SPRITE_CIRCUS_BALL_22_HEIGHT,
-  SPRITE_CIRCUS_BALL_22_ALPHA, SPRITE_CIRCUS_BALL_22_RGB565
+  nullptr, nullptr, &SPRITE_CIRCUS_BALL_22_SPANS
 };
 
 #endif // SPRITE_CIRCUS_BALL_22_INCLUDED
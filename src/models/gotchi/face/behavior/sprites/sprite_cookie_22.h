@@ -5,66 +5,73 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from cookie_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from cookie_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 412/484 pixels visibles, 1255 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_COOKIE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_COOKIE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_COOKIE_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0xDD10, 0xE531, 0xDCF0, 0xDD10, 0xDCF0, 0xDCEF, 0xD48F, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0xD4F0, 0xE530, 0xDD10, 0xE530, 0xE551, 0xE531, 0xE530, 0xE530, 0xE531, 0xE530, 0xDD10, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xBBEF, 0x0000, 0xD4D0, 0xE510, 0xED51, 0xE531, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xD4F0, 0xC42D, 0xDCF0, 0xED71, 0xDD10, 0xD4CF, 0x0000, 0xAD55, 0x0000, 0x0000,
-  0x0000, 0xAD4A, 0x0000, 0xD4AF, 0xE531, 0xE551, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0xBBCC, 0x79C5, 0x9B09, 0xDCF0, 0xE531, 0xE530, 0xD4F0, 0x0000, 0xBBEF, 0x0000,
-  0xAAAA, 0x0000, 0xD4D0, 0xE531, 0xCC6E, 0xA34A, 0xD4F0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xCC8E, 0x9AE9, 0x9AE9, 0xD4CF, 0xDCF0, 0xDD10, 0xE531, 0xD4EF, 0x0000, 0xFD55,
-  0xFBEF, 0xBBEF, 0xD4F0, 0xED71, 0xB38B, 0x9AE9, 0xDD10, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD11, 0xFFE0,
-  0x0000, 0xDCF0, 0xE551, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xC42D, 0xAB6A, 0xCCAF, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xED51, 0xDD10, 0x0000,
-  0xFFE0, 0xDCF0, 0xE551, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4D0, 0x9287, 0x79E5, 0xA32A, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDCF0, 0xDD51,
-  0xD4F0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xA309, 0x8205, 0x9AC8, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xC42D, 0xCC6E, 0xDD10, 0xD4CF,
-  0xDCF0, 0xE551, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xD4CF, 0xA329, 0xB3AB, 0xDD10, 0xDCF0, 0xDD30, 0xDD10, 0xDD10, 0xDD10, 0xD4AF, 0x8246, 0xBC0C, 0xE551, 0xD4D0,
-  0xDCF0, 0xE531, 0xDD10, 0xD4CF, 0xCC6E, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD30, 0xDD10, 0xDD10, 0xDCF0, 0xAB8B, 0x9B09, 0xCC8E, 0xDD10, 0xDCF0, 0xCC8E, 0xDCF0, 0xE551, 0xDCF0,
-  0xDCF0, 0xE531, 0xDCF0, 0x9B09, 0x8226, 0xB3CC, 0xDD30, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xA329, 0x8206, 0x7A05, 0xA32A, 0xDD31, 0xDCF0, 0xDD10, 0xDCF0, 0xE531, 0xDCF0,
-  0xD4D0, 0xE551, 0xC42D, 0x8206, 0x8205, 0xAB8B, 0xDD31, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0x9AE9, 0x8A47, 0x8A67, 0xBC0D, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0xDCF0,
-  0xCC8E, 0xDD10, 0xCC6E, 0x92A8, 0xAB8B, 0xDCF0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xCC8F, 0xD4AF, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCD0,
-  0x0000, 0xDCF0, 0xED51, 0xDCF0, 0xDD30, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xD4D0, 0xDD10, 0xDCF0, 0xDCF0, 0xE531, 0xDCF0, 0xFDEF,
-  0x0000, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDD30, 0xBBEC, 0x8A46, 0xC40D, 0xDD10, 0xDCF0, 0xED51, 0xDD10, 0x0000,
-  0xFFEF, 0x0000, 0xD4F0, 0xE551, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xD4CF, 0xAB6A, 0xBC0D, 0xDD10, 0xDCF0, 0xDD10, 0xC42D, 0x8A47, 0xA32A, 0xDD10, 0xE531, 0xDCF0, 0xCCCC, 0xFBEF,
-  0xAAAA, 0xF800, 0xD4F0, 0xE510, 0xDD10, 0xDCF0, 0xDCF0, 0xDD31, 0xB3AB, 0x79E5, 0x8A67, 0xD4F0, 0xDD10, 0xDCF0, 0xDD10, 0xD4F0, 0xD4CF, 0xDD10, 0xE510, 0xDCF0, 0x0000, 0xAAAA,
-  0x0000, 0xAAAA, 0x0000, 0xD4CF, 0xED51, 0xDD10, 0xDCF0, 0xDD30, 0xA32A, 0x8206, 0xB3AB, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0xE531, 0xD4F0, 0x0000, 0xAD55, 0x0000,
-  0x0000, 0x0000, 0xAD55, 0x0000, 0xDCF0, 0xE530, 0xE551, 0xED51, 0xCC8F, 0xC44D, 0xDD10, 0xDCF0, 0xDCF0, 0xE530, 0xED51, 0xED51, 0xE510, 0xD4F0, 0x0000, 0xFD55, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xD510, 0xE510, 0xDD10, 0xDD10, 0xE551, 0xE531, 0xE531, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCEF, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000, 0xDCEF, 0xDCF0, 0xDD10, 0xDCF0, 0xDD10, 0xE511, 0x0000, 0x0000, 0x0000, 0xFD55, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_COOKIE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 17, 10, 34, 23, 56, 39, 79, 57, 99, 77, 114, 99, 127, 119,
+  139, 141, 148, 163, 160, 185, 172, 207, 183, 229, 195, 251, 206, 273, 219, 294,
+  231, 314, 248, 335, 265, 356, 288, 374, 308, 390, 328, 404
 };
 
-const uint8_t SPRITE_COOKIE_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x4C, 0x74, 0x60, 0x56, 0x55, 0x38, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x1F, 0x68, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE5, 0x89, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x57, 0xF3, 0xFF, 0xFF, 0xFE, 0xFC, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xBC, 0x30, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x45, 0xF9, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xF8, 0x61, 0x00, 0x04, 0x00,
-  0x03, 0x00, 0x2D, 0xF3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0x52, 0x00, 0x03,
-  0x02, 0x04, 0xCB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xEF, 0x1C, 0x01,
-  0x00, 0x4B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x9C, 0x00,
-  0x01, 0xBA, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xE7, 0x0F,
-  0x3F, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x38,
-  0x6B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x5B,
-  0x6A, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x6A,
-  0x69, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x77,
-  0x4D, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x67,
-  0x1A, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x36,
-  0x00, 0xA4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCF, 0x04,
-  0x00, 0x34, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x62, 0x00,
-  0x02, 0x00, 0xB6, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xCD, 0x05, 0x02,
-  0x03, 0x01, 0x2D, 0xF9, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xF8, 0x30, 0x00, 0x03,
-  0x00, 0x03, 0x00, 0x64, 0xFF, 0xFF, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFB, 0xFF, 0xFF, 0x5D, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x5E, 0xE7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x4C, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x13, 0x53, 0xB3, 0xF6, 0xFF, 0xFF, 0xFF, 0xFD, 0xDB, 0xA7, 0x58, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x5C, 0x69, 0x65, 0x39, 0x0B, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_COOKIE_22_SPAN_OPS[] PROGMEM = {
+  0x03, 0x80, 0x02, 0x01, 0x87, 0x01, 0x4C, 0x74, 0x60, 0x56, 0x55, 0x38, 0x13, 0x01, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x82, 0x1F, 0x68,
+  0xC5, 0x44, 0x82, 0xFC, 0xE5, 0x89, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x04, 0x00, 0x81, 0x57, 0xF3, 0x41, 0x84, 0xFE, 0xFC, 0xFD, 0xFD, 0xFE,
+  0x42, 0x81, 0xBC, 0x30, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x81, 0x45, 0xF9, 0x40, 0x81, 0xFA, 0xFD, 0x45, 0x81, 0xFE, 0xFB, 0x40,
+  0x81, 0xF8, 0x61, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x03, 0x00, 0x81, 0x2D, 0xF3, 0x40, 0x80, 0xFD, 0x49, 0x81, 0xFC, 0xFE, 0x40, 0x80, 0x52, 0x00,
+  0x80, 0x03, 0xC0, 0x82, 0x02, 0x04, 0xCB, 0x40, 0x80, 0xFB, 0x4B, 0x84, 0xFC, 0xFE, 0xEF, 0x1C, 0x01, 0xC0, 0x00, 0x80, 0x4B, 0x40, 0x80, 0xFC,
+  0x4D, 0x80, 0xFB, 0x40, 0x80, 0x9C, 0xC0, 0x83, 0x01, 0xBA, 0xFE, 0xFC, 0x4D, 0x83, 0xFE, 0xFE, 0xE7, 0x0F, 0xC0, 0x82, 0x3F, 0xFE, 0xFE, 0x50,
+  0x81, 0xFD, 0x38, 0xC0, 0x80, 0x6B, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFD, 0x40, 0x80, 0x5B, 0xC0, 0x80, 0x6A, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC,
+  0x40, 0x80, 0x6A, 0xC0, 0x82, 0x69, 0xFE, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0x77, 0xC0, 0x80, 0x4D, 0x40, 0x80, 0xFE, 0x4F, 0x80, 0xFD, 0x40,
+  0x80, 0x67, 0xC0, 0x81, 0x1A, 0xEF, 0x40, 0x80, 0xFE, 0x4F, 0x81, 0xFD, 0x36, 0xC0, 0x00, 0x80, 0xA4, 0x40, 0x80, 0xFC, 0x4D, 0x83, 0xFD, 0xFE,
+  0xCF, 0x04, 0xC0, 0x00, 0x82, 0x34, 0xFE, 0xFD, 0x4D, 0x80, 0xFB, 0x40, 0x80, 0x62, 0xC0, 0x80, 0x02, 0x00, 0x80, 0xB6, 0x40, 0x80, 0xFB, 0x4B,
+  0x80, 0xFC, 0x40, 0x82, 0xCD, 0x05, 0x02, 0xC0, 0x85, 0x03, 0x01, 0x2D, 0xF9, 0xFC, 0xFC, 0x49, 0x83, 0xFC, 0xFD, 0xF8, 0x30, 0x00, 0x80, 0x03,
+  0xC0, 0x00, 0x80, 0x03, 0x00, 0x80, 0x64, 0x41, 0x82, 0xFC, 0xFC, 0xFE, 0x43, 0x82, 0xFD, 0xFC, 0xFB, 0x41, 0x80, 0x5D, 0x00, 0x80, 0x03, 0xC0,
+  0x01, 0x80, 0x03, 0x00, 0x81, 0x5E, 0xE7, 0x42, 0x82, 0xFD, 0xFC, 0xFC, 0x43, 0x81, 0xD7, 0x4C, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x02, 0x00,
+  0x83, 0x13, 0x53, 0xB3, 0xF6, 0x42, 0x84, 0xFD, 0xDB, 0xA7, 0x58, 0x08, 0x00, 0x80, 0x02, 0xC0, 0x03, 0x80, 0x03, 0x02, 0x85, 0x28, 0x5C, 0x69,
+  0x65, 0x39, 0x0B, 0x02, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_COOKIE_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x4185, 0x6A67, 0x51C6, 0x49A5, 0x49A5, 0x2903, 0x0840, 0x0000, 0x0000, 0x1882, 0x5A06, 0xABEC, 0xE530, 0xE551,
+  0xE531, 0xE530, 0xE530, 0xE531, 0xCCAE, 0x72A8, 0x0000, 0x0000, 0x41A5, 0xD4AF, 0xED51, 0xE531, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10,
+  0xD4F0, 0xC42D, 0xDCF0, 0xED71, 0xA3CC, 0x20E2, 0x0000, 0x0000, 0x3944, 0xDCF0, 0xE551, 0xD4AF, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xE531, 0xBBCC, 0x79C5, 0x9B09, 0xD4AF, 0xE531, 0xDCEF, 0x49C6, 0x0000, 0x0000, 0x20E3, 0xD4CF, 0xCC6E, 0xA34A, 0xD4F0, 0xDD10,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xCC8E, 0x9AE9, 0x9AE9, 0xD4CF, 0xDCF0, 0xDD10, 0xE531, 0x4184, 0x0000, 0x0000, 0x0000, 0xA3CC,
+  0xED71, 0xAB6A, 0x9AE9, 0xDD10, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10,
+  0xCCAF, 0x18A2, 0x0000, 0x3944, 0xE551, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xC42D, 0xAB6A, 0xCCAF, 0xDD10, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4AF, 0xED51, 0x832A, 0x0000, 0x9B8B, 0xE551, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4D0, 0x9287,
+  0x79E5, 0xA32A, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xC46E, 0x0841, 0x3124, 0xDD10, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xA309, 0x8205, 0x9AC8, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xC42D,
+  0xCC6E, 0xDD10, 0x2903, 0x51E6, 0xE551, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xD4CF, 0xA329, 0xB3AB, 0xDD10, 0xDCF0,
+  0xDD30, 0xDD10, 0xDD10, 0xDD10, 0xD4AF, 0x8246, 0xBC0C, 0xE551, 0x41A5, 0x51E6, 0xE531, 0xDD10, 0xD4CF, 0xCC6E, 0xDD10, 0xDCF0,
+  0xDCF0, 0xDD10, 0xDD30, 0xDD10, 0xDD10, 0xDCF0, 0xAB8B, 0x9B09, 0xCC8E, 0xDD10, 0xDCF0, 0xCC8E, 0xDCF0, 0xE551, 0x51E6, 0x51E6,
+  0xE531, 0xDCF0, 0x9B09, 0x8226, 0xB3CC, 0xDD30, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xA329, 0x8206, 0x7A05, 0xA32A, 0xDD31,
+  0xDCF0, 0xDD10, 0xDCF0, 0xE531, 0x6247, 0x4165, 0xE551, 0xC42D, 0x8206, 0x8205, 0xAB8B, 0xDD31, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDCF0, 0x9AE9, 0x8A47, 0x8A67, 0xBC0D, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0x51E6, 0x1061, 0xCCAF, 0xCC6E, 0x92A8, 0xAB8B,
+  0xDCF0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xCC8F, 0xD4AF, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10,
+  0x2903, 0x8B2A, 0xED51, 0xDCF0, 0xDD30, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xD4D0,
+  0xDD10, 0xDCF0, 0xDCF0, 0xE531, 0xABED, 0x0020, 0x2903, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDD10,
+  0xDCF0, 0xDCF0, 0xDD30, 0xBBEC, 0x8A46, 0xC40D, 0xDD10, 0xD4AF, 0xED51, 0x51E6, 0x0000, 0x938B, 0xE551, 0xD4AF, 0xDCF0, 0xDCF0,
+  0xDD10, 0xD4CF, 0xAB6A, 0xBC0D, 0xDD10, 0xDCF0, 0xDD10, 0xC42D, 0x8A47, 0xA32A, 0xDD10, 0xE531, 0xABED, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x20E3, 0xDCCF, 0xDD10, 0xDCF0, 0xDCF0, 0xDD31, 0xB3AB, 0x79E5, 0x8A67, 0xD4F0, 0xDD10, 0xDCF0, 0xDD10, 0xD4F0, 0xD4CF,
+  0xDD10, 0xDCCF, 0x28E3, 0x0000, 0x0000, 0x51E6, 0xED51, 0xDD10, 0xDCF0, 0xDD30, 0xA32A, 0x8206, 0xB3AB, 0xDD10, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xD4AF, 0xE531, 0xE531, 0x49C6, 0x0000, 0x0000, 0x51C6, 0xCCAE, 0xE551, 0xED51, 0xCC8F, 0xC44D, 0xDD10, 0xDCF0, 0xDCF0,
+  0xE530, 0xED51, 0xED51, 0xBC2D, 0x4185, 0x0000, 0x0000, 0x0841, 0x4185, 0x936B, 0xD4CF, 0xE551, 0xE531, 0xE531, 0xDD10, 0xB42D,
+  0x8B4A, 0x49A5, 0x0020, 0x0000, 0x0000, 0x20C2, 0x51C6, 0x5206, 0x51E6, 0x2903, 0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_COOKIE_22_SPANS = {
+  SPRITE_COOKIE_22_SPAN_ROWS, SPRITE_COOKIE_22_SPAN_OPS, SPRITE_COOKIE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_COOKIE_22_ASSET = {
   SPRITE_COOKIE_22_WIDTH, SPRITE_COOKIE_22_HEIGHT,
-  SPRITE_COOKIE_22_ALPHA, SPRITE_COOKIE_22_RGB565
+  nullptr, nullptr, &SPRITE_COOKIE_22_SPANS
 };
 
 #endif // SPRITE_COOKIE_22_INCLUDED
@@ -5,110 +5,193 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from cookie_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from cookie_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1726/1936 pixels visibles, 4827 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_COOKIE_44_WIDTH = 44;
 constexpr uint16_t SPRITE_COOKIE_44_HEIGHT = 44;
 
-const uint16_t SPRITE_COOKIE_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFBEF, 0xDC8D, 0xFBEF, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0xD4F0, 0xDCD0, 0xDD10, 0xDD10, 0xD4F0, 0xD4CF, 0xD4CF, 0xD50F, 0xD4CF, 0xD4EF, 0xCCAE, 0xCC8D, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDEF, 0xDDB2, 0xD54F, 0x7BE7, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBEF, 0xE530, 0xDCF0, 0xD4D0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xE530, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xE530, 0xE530, 0xE4F0, 0xDCF0, 0xD4AF, 0xBC4E, 0x0000, 0x0000, 0x0000, 0xBBE7, 0xAD4A, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xBBE7, 0xFD4A, 0x0000, 0x0000, 0x0000, 0xBCAF, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE510, 0xE551, 0xED51, 0xE551, 0xE531, 0xE531, 0xE530, 0xE530, 0xE510, 0xE510, 0xDD31, 0xE531, 0xE510, 0xDCF0, 0xDCF0, 0xD4CF, 0x0000, 0x0000, 0x0000, 0xDCEF, 0xDC8D, 0xBDEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0xFFE0, 0xAAAA, 0x0000, 0x0000, 0xCC8F, 0xD4CF, 0xE530, 0xE551, 0xE531, 0xE510, 0xDD10, 0xF572, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF5B2, 0xF592, 0xE531, 0xE531, 0xE530, 0xDD10, 0xCCAF, 0x9B2C, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7BEF, 0xD3EF, 0xAD4A, 0xFFEF, 0x0000, 0xC48E, 0xCCAF, 0xDCD0, 0xE531, 0xED71, 0xED51, 0xE531, 0xE531, 0xE531, 0xE531, 0xE530, 0xE530, 0xE531, 0xE531, 0xE531, 0xE551, 0xE551, 0xE531, 0xDCF0, 0xDD10, 0xE531, 0xF572, 0xED72, 0xED51, 0xE530, 0xD4CF, 0xC4AE, 0x780F, 0x0000, 0x0000, 0x7DEF, 0xCE73, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0x7BEF, 0xFCD3, 0x0000, 0x0000, 0xD4AF, 0xD4F0, 0xE531, 0xE551, 0xFDB3, 0xFDB2, 0xED51, 0xE551, 0xDD10, 0xDCF0, 0xD4F0, 0xD4F0, 0xD4F0, 0xD4D0, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xC44D, 0xB38B, 0xAB8B, 0xC42D, 0xDCF0, 0xED71, 0xF592, 0xE531, 0xDD10, 0xE510, 0xDCF0, 0xC48F, 0xAAAA, 0x0000, 0x7FFF, 0xFFFF, 0x7BEF, 0x0000, 0x0000,
-  0x0000, 0xFFE0, 0xAFF5, 0x7BEF, 0xFDEF, 0x0000, 0xAB4A, 0xD4AF, 0xDD11, 0xF592, 0xF5B2, 0xED92, 0xE551, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xDD10, 0xCC6E, 0xAB6A, 0x8A67, 0x8226, 0x9AE9, 0xBC0D, 0xDCF0, 0xED51, 0xE551, 0xED51, 0xED51, 0xDD10, 0xD4D0, 0xCC6F, 0x0000, 0xFFFF, 0xFBEF, 0xCCD3, 0x7BEF, 0x0000,
-  0xF800, 0xFFE0, 0xBDEF, 0x0000, 0x0000, 0xD4F1, 0xD4CF, 0xDD10, 0xE531, 0xF572, 0xE510, 0xD4CF, 0xD4CF, 0xD4F0, 0xDCF0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xDD10, 0xE531, 0xDD10, 0xCC6E, 0xA32A, 0x8205, 0x7184, 0x8226, 0xA34A, 0xCC6E, 0xDD31, 0xE531, 0xED51, 0xF592, 0xE530, 0xE531, 0xDCF0, 0xD4AF, 0x0000, 0x0000, 0xD3EF, 0x7BEF, 0xFFFF,
-  0xFAAA, 0xF800, 0xFBEF, 0x0000, 0x0000, 0xE511, 0xDD10, 0xE531, 0xE511, 0xD48E, 0xBBEC, 0xBBCC, 0xCC8E, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4D0, 0xD4D0, 0xD4D0, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xB3CC, 0x92C8, 0x8206, 0x8226, 0xA329, 0xC46E, 0xDD10, 0xDD10, 0xDD10, 0xE530, 0xED51, 0xF572, 0xE530, 0xDD10, 0xC48D, 0x7BE0, 0xCCCC, 0xFFFF, 0xFCD3,
-  0xDB6D, 0xF800, 0x0000, 0x9B2C, 0xBC4E, 0xDD11, 0xE551, 0xF592, 0xD4AF, 0xAB6B, 0x92C8, 0xA329, 0xCC6E, 0xE531, 0xDD30, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xCC8E, 0xBBEC, 0xAB4A, 0xA32A, 0xB3AC, 0xCC8E, 0xDD10, 0xDD10, 0xD4CF, 0xD4F0, 0xE531, 0xF592, 0xE531, 0xDD10, 0xD4EF, 0xCCCE, 0x0000, 0x0000, 0xDCEF,
-  0xE551, 0xF800, 0x0000, 0xC46F, 0xCC8F, 0xDD10, 0xED72, 0xED71, 0xC42D, 0x9AE9, 0x8A67, 0xA309, 0xCC6E, 0xE551, 0xDD10, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xD4CF, 0xD4AF, 0xCC8E, 0xD4AF, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4F0, 0xDD10, 0xE531, 0xED51, 0xE531, 0xD4F0, 0xD510, 0x0000, 0x0000, 0xDDAD,
-  0xDCEF, 0x0000, 0xAD4A, 0xD4CF, 0xD4D0, 0xE551, 0xED92, 0xE510, 0xC42D, 0xAB6B, 0xA32A, 0xB3AB, 0xD4AF, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xE531, 0xE531, 0xE531, 0xE531, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0xF572, 0xDD10, 0xDD10, 0xD570, 0xBBEF, 0xCCC6,
-  0xFD55, 0xFBEF, 0xD50E, 0xE530, 0xE531, 0xF592, 0xED51, 0xDCF0, 0xD4AF, 0xCC8F, 0xCC8E, 0xD4AF, 0xD4F0, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xC44E, 0xBBEC, 0xBC0D, 0xCCAF, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD30, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xD4D0, 0xE510, 0xF572, 0xE531, 0xDD10, 0xD50F, 0xD52F, 0xFBEF,
-  0x0000, 0xB48D, 0xD4EF, 0xDD10, 0xED51, 0xF592, 0xDD10, 0xD4D0, 0xDD10, 0xE551, 0xE551, 0xDD31, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xC42D, 0xAB4A, 0x9AE8, 0xA309, 0xBBEC, 0xD4AF, 0xDD10, 0xDD10, 0xDCF0, 0xD4D0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xED51, 0xED51, 0xE510, 0xD4F0, 0xD4EF, 0x0000,
-  0x0000, 0xCCEF, 0xD4EF, 0xDD10, 0xE531, 0xED51, 0xDD10, 0xD4D0, 0xDCF0, 0xDD31, 0xDD30, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xCC6E, 0xAB4A, 0x8A67, 0x8206, 0x8A67, 0x9B09, 0xBC0D, 0xD4F0, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xE551, 0xED51, 0xE530, 0xD4F0, 0xDCF0, 0x0000,
-  0xCCD3, 0xD4CF, 0xD4F0, 0xE510, 0xE531, 0xDD10, 0xDD10, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD30, 0xDD31, 0xCC4E, 0x9B09, 0x7A05, 0x71C4, 0x79E5, 0x8A67, 0xAB8B, 0xD4AF, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xE531, 0xED51, 0xD4F0, 0xDCF0, 0xFDEF,
-  0xCCCF, 0xDCF0, 0xDCF0, 0xED71, 0xE531, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD30, 0xE531, 0xCC8E, 0xA34A, 0x8A46, 0x79E5, 0x79E5, 0x8A46, 0xAB4A, 0xCC8F, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xD4F0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4CF, 0xCC8F, 0xCC8F, 0xDD10, 0xED72, 0xDD10, 0xDD10, 0xCCCF,
-  0xCCCF, 0xDD10, 0xDD10, 0xF592, 0xE531, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xD4CF, 0xBC0D, 0xA309, 0x8A47, 0x8206, 0x8A67, 0xAB6A, 0xD48F, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD30, 0xCC8F, 0xB3CC, 0xAB8B, 0xBBEC, 0xDCCF, 0xF592, 0xE531, 0xE531, 0xCC6F,
-  0xCCCF, 0xDD10, 0xE531, 0xF5B2, 0xE530, 0xD4CF, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xBC0D, 0xA309, 0x9287, 0x9AE9, 0xB3CC, 0xD4CF, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xE551, 0xE551, 0xE531, 0xDD10, 0xDD10, 0xDCF0, 0xDD30, 0xDD30, 0xC42D, 0x92C8, 0x8A67, 0xA34A, 0xD4AF, 0xF5B2, 0xE551, 0xE531, 0xCC4E,
-  0xD4D0, 0xDD10, 0xE551, 0xF592, 0xE530, 0xD4F0, 0xDD10, 0xDD30, 0xDD30, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xD4CF, 0xBC0C, 0xAB8B, 0xB3CC, 0xC44E, 0xD4F0, 0xE531, 0xE531, 0xDD10, 0xDCF0, 0xD4CF, 0xD4CF, 0xD4CF, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xC42D, 0x9AC8, 0x9287, 0xAB8B, 0xDCCF, 0xF5B2, 0xED51, 0xE511, 0xCC6E,
-  0xD4CF, 0xDD10, 0xE551, 0xF592, 0xE531, 0xDCF0, 0xDD10, 0xDCF0, 0xD4D0, 0xD4F0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xD4CF, 0xD4CF, 0xD4CF, 0xDCF0, 0xDD31, 0xE531, 0xDCF0, 0xCC6E, 0xB3CC, 0xAB8B, 0xB3CC, 0xCC8E, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xCC8F, 0xBC0D, 0xBBEC, 0xC44E, 0xE510, 0xF5B2, 0xE551, 0xE530, 0xD4CF,
-  0xD4CF, 0xDD10, 0xE531, 0xF592, 0xE551, 0xDCF0, 0xCCAF, 0xC44D, 0xBBEC, 0xBC0D, 0xCC8E, 0xDCF0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xC44D, 0xAB6B, 0x92C8, 0x8A87, 0x9AE8, 0xB3AB, 0xCC8E, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE531, 0xF592, 0xE531, 0xDD10, 0xD4CF,
-  0xD4CF, 0xDCF0, 0xE530, 0xF5B2, 0xED51, 0xD4AF, 0xBBEC, 0xA309, 0x92A7, 0x9AE8, 0xB3AB, 0xCC8E, 0xDD10, 0xDD10, 0xDD10, 0xD4F0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD30, 0xD4CF, 0xBC0C, 0xA32A, 0x9287, 0x8226, 0x8205, 0x8A46, 0x9AE9, 0xBBEC, 0xD4F0, 0xE551, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xE531, 0xF592, 0xE531, 0xDD10, 0xD4D0,
-  0xD4AF, 0xDD10, 0xE530, 0xF5B2, 0xE531, 0xC44D, 0xA329, 0x8226, 0x71C4, 0x8206, 0x9AE9, 0xC40D, 0xDCF0, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xD4F0, 0xD4CF, 0xD4CF, 0xDD10, 0xE531, 0xCC8E, 0xA34A, 0x8A67, 0x8205, 0x79C5, 0x79C5, 0x8206, 0x92A8, 0xB3CC, 0xD4CF, 0xE551, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4F0, 0xE530, 0xF592, 0xE531, 0xDD10, 0xD4D0,
-  0xCC6E, 0xDD30, 0xE551, 0xF5B2, 0xDCF0, 0xB3AC, 0x92A8, 0x79C5, 0x71A4, 0x8206, 0x9AC8, 0xBBEC, 0xDCF0, 0xE551, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xCC8E, 0xA32A, 0x8A46, 0x8206, 0x79E5, 0x79E5, 0x8A47, 0xA32A, 0xC42D, 0xDCF0, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xE530, 0xF592, 0xE551, 0xDD10, 0xD4D0,
-  0xCC6E, 0xDD31, 0xE551, 0xF5B2, 0xDCCF, 0xAB6B, 0x8A67, 0x79C5, 0x8205, 0x92A8, 0xAB6A, 0xC42D, 0xDCF0, 0xDD31, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xB3CC, 0xA32A, 0x9AE9, 0x9AC8, 0x92C8, 0xA34A, 0xBC0C, 0xD4AF, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xD4F0, 0xD4F0, 0xE531, 0xF5B2, 0xE531, 0xDD10, 0xD4D0,
-  0xB3EC, 0xDD10, 0xDD10, 0xF592, 0xDCF0, 0xB3AB, 0x92A8, 0x8226, 0x92A8, 0xAB8B, 0xC44D, 0xD4CF, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4AF, 0xCC6E, 0xC42D, 0xBC0D, 0xBC0D, 0xCC6E, 0xD4AF, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE551, 0xF592, 0xDD10, 0xDCF0, 0xDCD1,
-  0x0000, 0xD4F0, 0xDCF0, 0xED51, 0xE530, 0xCC4D, 0xAB8B, 0xA32A, 0xB3AB, 0xCC6E, 0xDCF0, 0xDD31, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDD30, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE551, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xE551, 0xED72, 0xD4F0, 0xDCF0, 0xE4B0,
-  0x0000, 0xCCCF, 0xD4F0, 0xE531, 0xED51, 0xE510, 0xD4AF, 0xCC8E, 0xD4CF, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD31, 0xE531, 0xE551, 0xE551, 0xE531, 0xDD31, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xD4D0, 0xDD10, 0xFD55,
-  0xFFFF, 0xC4CF, 0xD4EF, 0xDD10, 0xED51, 0xF592, 0xE551, 0xDD10, 0xDD31, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xCC8F, 0xC44E, 0xC44E, 0xD4CF, 0xDD10, 0xDD10, 0xDCF0, 0xD4F0, 0xDD10, 0xE551, 0xE531, 0xDCF0, 0xD4CF, 0xDD0F, 0x0000,
-  0x0000, 0xFD55, 0xD4F0, 0xDD10, 0xE530, 0xF592, 0xE551, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xDD10, 0xDD10, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xDD10, 0xCC8E, 0xB3AB, 0x9AE9, 0xA309, 0xBBEC, 0xD4CF, 0xDD30, 0xDD10, 0xD4F0, 0xDD10, 0xF592, 0xED71, 0xDD10, 0xCCCF, 0xCCCE, 0x0000,
-  0xFD55, 0x0000, 0xDDB2, 0xDD10, 0xDD10, 0xED51, 0xE531, 0xDCF0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xDCF0, 0xC44E, 0xA309, 0x8205, 0x8205, 0xA309, 0xC44D, 0xDCF0, 0xDD10, 0xDD10, 0xE530, 0xF592, 0xE551, 0xE531, 0xCCCF, 0xD54F, 0xFD55,
-  0xDCEF, 0x0000, 0x0000, 0xD4AF, 0xD4CF, 0xDD10, 0xE531, 0xE530, 0xDCF0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xC42D, 0xBBEC, 0xC44D, 0xD4AF, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xDD31, 0xDD10, 0xCC6E, 0xA34A, 0x8226, 0x79E5, 0x9287, 0xB3CB, 0xD4AF, 0xE531, 0xE531, 0xE530, 0xE510, 0xDCF0, 0xDCF0, 0xB48D, 0x0000, 0xDBEF,
-  0xE551, 0xF800, 0xFFFF, 0xBC4E, 0xD4AF, 0xDCF0, 0xE531, 0xF572, 0xE510, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xD4F0, 0xC42D, 0xA34A, 0x9AC8, 0xA32A, 0xBBEC, 0xD4CF, 0xDD30, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xBC0C, 0xA32A, 0x9AC8, 0xA309, 0xB3CC, 0xCCAF, 0xE551, 0xED72, 0xE510, 0xD4F0, 0xCCCF, 0xCC6F, 0x0000, 0x0000, 0xE471,
-  0xDB6D, 0x7800, 0xF800, 0xBBEF, 0xCC8F, 0xDCF0, 0xE511, 0xF592, 0xE531, 0xD4F0, 0xDCF0, 0xD4F0, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xCC6E, 0xAB6B, 0x8A87, 0x7A05, 0x8226, 0xA32A, 0xCC6E, 0xDD31, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xCC8E, 0xC44D, 0xC44D, 0xCC8E, 0xD4D0, 0xE551, 0xF592, 0xE510, 0xDCF0, 0xCC8F, 0xBBEF, 0x0000, 0x0000, 0xDB6D,
-  0xFAAA, 0x7800, 0xCB2C, 0x0000, 0xFFFF, 0xDD10, 0xDCF0, 0xED51, 0xED51, 0xE530, 0xDD10, 0xD4F0, 0xD4CF, 0xDD10, 0xE531, 0xD4F0, 0xBBEC, 0x9AC8, 0x79E5, 0x71A4, 0x7A05, 0xA309, 0xCC6E, 0xDD31, 0xDD30, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xDD31, 0xDD10, 0xDD30, 0xE531, 0xE551, 0xED51, 0xED51, 0xDD10, 0xDD30, 0xF81F, 0x0000, 0xCCD3, 0xF800, 0xFAAA,
-  0xF800, 0xFFFF, 0xFCCC, 0x0000, 0x0000, 0xD4AF, 0xD4D0, 0xE510, 0xED31, 0xF5B2, 0xE551, 0xDCF0, 0xD4CF, 0xDD10, 0xE531, 0xD4CF, 0xB3AB, 0x8A87, 0x79C5, 0x79C5, 0x9287, 0xB3AB, 0xD4AF, 0xDD31, 0xDD10, 0xD4F0, 0xDCF0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xE531, 0xED71, 0xFDB2, 0xE531, 0xE530, 0xD4EF, 0xCCCF, 0x0000, 0x0000, 0xCCD3, 0xFFFF, 0xF800,
-  0x0000, 0xFFFF, 0xBDEF, 0x7BEF, 0xBBEF, 0x7BE7, 0xC46E, 0xD4F0, 0xE531, 0xF572, 0xED71, 0xE531, 0xE530, 0xE531, 0xE551, 0xD4F0, 0xBBEC, 0x9AE9, 0x8A67, 0x92C8, 0xB38B, 0xCC6E, 0xDCF0, 0xDD10, 0xDD10, 0xD4F0, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xE531, 0xE531, 0xED51, 0xF571, 0xE530, 0xD4F0, 0xBC4E, 0x7BEF, 0xBBEF, 0x7BEF, 0xBDF7, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0x7BEF, 0xCE73, 0x0000, 0x9B26, 0xD4CF, 0xDD10, 0xE531, 0xE531, 0xED71, 0xF592, 0xED72, 0xED72, 0xE510, 0xCC8E, 0xBBEC, 0xAB8B, 0xB3EC, 0xCC6E, 0xD4F0, 0xDCF0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDD10, 0xE530, 0xE531, 0xED71, 0xED72, 0xF592, 0xE551, 0xE531, 0xE531, 0xDCF0, 0xD48F, 0x52AA, 0x0000, 0xFDF7, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7BEF, 0xAD4F, 0xFBEF, 0x0000, 0x0000, 0xC46E, 0xD4CF, 0xDCF0, 0xE531, 0xE551, 0xED51, 0xED51, 0xE531, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xE551, 0xED51, 0xE551, 0xE530, 0xE531, 0xE551, 0xE551, 0xE551, 0xE531, 0xED51, 0xED51, 0xE551, 0xE531, 0xDCF0, 0xCCAF, 0xBCCF, 0x0000, 0x0000, 0xFBEF, 0xFCD3, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0xF800, 0x0000, 0x0000, 0x79E7, 0xC42F, 0xDD10, 0xE531, 0xE531, 0xE530, 0xE530, 0xDD10, 0xED51, 0xF592, 0xFDB2, 0xF5B2, 0xFDB2, 0xFDB2, 0xF592, 0xF592, 0xF592, 0xED71, 0xE531, 0xE510, 0xE530, 0xE531, 0xE531, 0xE531, 0xE511, 0xD4CF, 0xBC4C, 0x07E0, 0x0000, 0x0000, 0xFFE0, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFD55, 0xBBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0xDCCF, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE530, 0xE551, 0xE531, 0xE531, 0xE531, 0xE531, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xD4CF, 0x0000, 0x0000, 0x0000, 0xFFF5, 0xFE73, 0xFFF5, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0xD4AF, 0xD4EF, 0xDCF0, 0xDD10, 0xDD10, 0xDD31, 0xDD31, 0xE531, 0xE530, 0xE510, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xD4F0, 0xD4D0, 0xD4EE, 0x7BEF, 0x0000, 0x0000, 0x0000, 0xFBEF, 0xFFEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xAD4A, 0xDCEF, 0xDDAD, 0xCCCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCC8D, 0xCC8F, 0xCCAF, 0xDCEF, 0xDD10, 0xDCF0, 0xD4CF, 0xDCD0, 0xE54F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE73, 0xDDF3, 0xDCEF, 0xFCD3, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_COOKIE_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 29, 22, 61, 47, 96, 75, 125, 108, 154, 143, 197, 181, 239, 222,
+  276, 263, 310, 305, 342, 346, 370, 387, 397, 430, 420, 474, 441, 516, 462, 558,
+  484, 602, 504, 646, 524, 690, 542, 734, 561, 778, 579, 822, 597, 866, 615, 910,
+  633, 954, 652, 998, 670, 1042, 688, 1086, 708, 1129, 732, 1172, 753, 1215, 775, 1257,
+  801, 1300, 827, 1342, 854, 1384, 884, 1426, 926, 1468, 967, 1508, 1006, 1550, 1046, 1588,
+  1076, 1622, 1107, 1655, 1141, 1682, 1173, 1707
 };
 
-const uint8_t SPRITE_COOKIE_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x48, 0x5F, 0x60, 0x53, 0x44, 0x40, 0x41, 0x41, 0x3A, 0x29, 0x13, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x06, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x1D, 0x33, 0x5C, 0x7C, 0x8D, 0x8D, 0x84, 0x7A, 0x76, 0x77, 0x77, 0x72, 0x64, 0x55, 0x43, 0x31, 0x1D, 0x0B, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x2D, 0x52, 0x7B, 0xA1, 0xC6, 0xD6, 0xDB, 0xDA, 0xD8, 0xD5, 0xD4, 0xD4, 0xD4, 0xD3, 0xCC, 0xC6, 0xB8, 0xA0, 0x76, 0x3B, 0x00, 0x00, 0x00, 0x08, 0x07, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x01, 0x15, 0x3E, 0x60, 0x84, 0xAC, 0xDA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xD3, 0x91, 0x43, 0x1B, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x06, 0x03, 0x02, 0x00, 0x1A, 0x59, 0xAB, 0xD8, 0xE2, 0xEB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE1, 0xAE, 0x71, 0x2B, 0x02, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x05, 0x00, 0x00, 0x16, 0x5A, 0xA8, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 0xF9, 0xF8, 0xFC, 0xFF, 0xFF, 0xF1, 0xC0, 0x7C, 0x42, 0x17, 0x03, 0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
-  0x00, 0x01, 0x03, 0x02, 0x04, 0x00, 0x0C, 0x4E, 0xB4, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xF4, 0xDF, 0xB1, 0x61, 0x20, 0x01, 0x01, 0x02, 0x05, 0x02, 0x00,
-  0x01, 0x01, 0x04, 0x00, 0x00, 0x0D, 0x48, 0x9A, 0xEF, 0xFF, 0xFD, 0xF3, 0xF5, 0xF7, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xF7, 0xF8, 0xFF, 0xFF, 0xF8, 0xB1, 0x64, 0x1D, 0x01, 0x00, 0x06, 0x02, 0x01,
-  0x03, 0x01, 0x04, 0x00, 0x00, 0x3A, 0xA5, 0xE8, 0xFF, 0xFF, 0xFE, 0xFA, 0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xEF, 0xBE, 0x5A, 0x17, 0x02, 0x05, 0x01, 0x05,
-  0x07, 0x01, 0x00, 0x05, 0x2B, 0x81, 0xE6, 0xFF, 0xFE, 0xF5, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF3, 0xFC, 0xFF, 0xF5, 0xA6, 0x50, 0x0F, 0x00, 0x00, 0x08,
-  0x09, 0x01, 0x00, 0x1D, 0x7A, 0xD0, 0xFE, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF9, 0xFC, 0xFF, 0xFF, 0xEB, 0xA3, 0x34, 0x00, 0x00, 0x07,
-  0x08, 0x00, 0x03, 0x3C, 0xB8, 0xFB, 0xFF, 0xF7, 0xFC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xF4, 0xFD, 0xFF, 0xDC, 0x6A, 0x13, 0x04, 0x05,
-  0x03, 0x02, 0x16, 0x65, 0xD7, 0xFF, 0xFF, 0xF7, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF6, 0xFF, 0xFF, 0xF3, 0xAC, 0x4E, 0x11, 0x02,
-  0x00, 0x07, 0x39, 0x98, 0xE9, 0xFD, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFE, 0xFA, 0xF9, 0xDD, 0x81, 0x1F, 0x00,
-  0x00, 0x15, 0x6B, 0xCE, 0xFA, 0xFF, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFA, 0xFF, 0xFA, 0xA3, 0x2F, 0x00,
-  0x05, 0x30, 0x9B, 0xF0, 0xFE, 0xFD, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFE, 0xFF, 0xB7, 0x40, 0x04,
-  0x19, 0x53, 0xC2, 0xFE, 0xFF, 0xF9, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xC6, 0x54, 0x14,
-  0x35, 0x71, 0xD4, 0xFF, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFD, 0xCD, 0x65, 0x28,
-  0x50, 0x83, 0xDB, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD4, 0x75, 0x3D,
-  0x5B, 0x89, 0xD9, 0xFE, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD6, 0x7E, 0x4B,
-  0x58, 0x88, 0xD9, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD8, 0x84, 0x52,
-  0x56, 0x87, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xDA, 0x8A, 0x5A,
-  0x56, 0x87, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xDC, 0x90, 0x63,
-  0x52, 0x83, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xDD, 0x91, 0x65,
-  0x42, 0x77, 0xD4, 0xFE, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xD9, 0x8A, 0x5C,
-  0x27, 0x65, 0xCF, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xD7, 0x7D, 0x47,
-  0x0A, 0x4D, 0xC1, 0xFF, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFE, 0xFD, 0xCF, 0x68, 0x29,
-  0x00, 0x37, 0xAB, 0xFA, 0xFF, 0xFB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xC3, 0x4F, 0x11,
-  0x00, 0x23, 0x87, 0xE1, 0xFA, 0xFD, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFA, 0xFF, 0xFE, 0xA9, 0x33, 0x03,
-  0x01, 0x12, 0x58, 0xB7, 0xF4, 0xFF, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFE, 0xFD, 0xFD, 0xE5, 0x82, 0x1E, 0x00,
-  0x00, 0x03, 0x25, 0x80, 0xE3, 0xFF, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFD, 0xFC, 0xEE, 0xAF, 0x51, 0x0F, 0x00,
-  0x03, 0x00, 0x07, 0x52, 0xCC, 0xFE, 0xFF, 0xF8, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF7, 0xFF, 0xFF, 0xDD, 0x76, 0x26, 0x06, 0x03,
-  0x08, 0x00, 0x00, 0x2F, 0xA4, 0xEB, 0xFC, 0xFA, 0xFE, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xF8, 0xFF, 0xFC, 0xBB, 0x42, 0x07, 0x01, 0x08,
-  0x09, 0x01, 0x01, 0x18, 0x69, 0xBF, 0xFA, 0xFF, 0xFF, 0xF6, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF8, 0xFF, 0xFF, 0xFE, 0xD1, 0x7C, 0x1D, 0x00, 0x00, 0x09,
-  0x07, 0x02, 0x02, 0x04, 0x26, 0x7C, 0xE6, 0xFF, 0xFD, 0xF2, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xF2, 0xFC, 0xFF, 0xE8, 0x84, 0x2D, 0x04, 0x00, 0x00, 0x07,
-  0x03, 0x02, 0x05, 0x00, 0x01, 0x40, 0xB1, 0xEF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFA, 0xFE, 0xFF, 0xFF, 0xEE, 0xAF, 0x3F, 0x01, 0x00, 0x05, 0x01, 0x03,
-  0x01, 0x01, 0x05, 0x00, 0x00, 0x16, 0x61, 0xB4, 0xF9, 0xFF, 0xFD, 0xF4, 0xF6, 0xF8, 0xF9, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFA, 0xF9, 0xF7, 0xF6, 0xF4, 0xFF, 0xFF, 0xF9, 0xAF, 0x5C, 0x14, 0x00, 0x00, 0x05, 0x01, 0x01,
-  0x00, 0x01, 0x04, 0x02, 0x04, 0x04, 0x24, 0x68, 0xC2, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE8, 0xBC, 0x62, 0x1F, 0x02, 0x04, 0x02, 0x04, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x05, 0x00, 0x05, 0x21, 0x65, 0xAB, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0x99, 0x58, 0x1C, 0x03, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x06, 0x02, 0x00, 0x00, 0x20, 0x5B, 0xA1, 0xCC, 0xDC, 0xE6, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF4, 0xE9, 0xDC, 0xBF, 0x8D, 0x49, 0x14, 0x00, 0x00, 0x02, 0x05, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x04, 0x15, 0x33, 0x50, 0x71, 0x98, 0xC7, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xDF, 0xC3, 0x9D, 0x73, 0x45, 0x24, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x40, 0x6A, 0x92, 0xB5, 0xC9, 0xD3, 0xD7, 0xD9, 0xD9, 0xD8, 0xD6, 0xD0, 0xC3, 0xAD, 0x98, 0x80, 0x66, 0x44, 0x1E, 0x00, 0x00, 0x00, 0x03, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x18, 0x27, 0x42, 0x5C, 0x73, 0x81, 0x85, 0x87, 0x86, 0x7D, 0x69, 0x53, 0x3A, 0x29, 0x1F, 0x17, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3B, 0x4F, 0x54, 0x56, 0x55, 0x49, 0x2E, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x08, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_COOKIE_44_SPAN_OPS[] PROGMEM = {
+  0x06, 0x84, 0x01, 0x04, 0x07, 0x06, 0x02, 0x03, 0x8B, 0x1F, 0x48, 0x5F, 0x60, 0x53, 0x44, 0x40, 0x41, 0x41, 0x3A, 0x29, 0x13, 0x03, 0x84, 0x04,
+  0x07, 0x06, 0x04, 0x01, 0xC0, 0x05, 0x81, 0x01, 0x01, 0x03, 0x93, 0x08, 0x11, 0x1D, 0x33, 0x5C, 0x7C, 0x8D, 0x8D, 0x84, 0x7A, 0x76, 0x77, 0x77,
+  0x72, 0x64, 0x55, 0x43, 0x31, 0x1D, 0x0B, 0x02, 0x82, 0x04, 0x03, 0x01, 0xC0, 0x04, 0x82, 0x01, 0x04, 0x03, 0x02, 0x94, 0x0C, 0x2D, 0x52, 0x7B,
+  0xA1, 0xC6, 0xD6, 0xDB, 0xDA, 0xD8, 0xD5, 0xD4, 0xD4, 0xD4, 0xD3, 0xCC, 0xC6, 0xB8, 0xA0, 0x76, 0x3B, 0x02, 0x83, 0x08, 0x07, 0x04, 0x01, 0xC0,
+  0x02, 0x83, 0x01, 0x02, 0x01, 0x03, 0x00, 0x87, 0x01, 0x15, 0x3E, 0x60, 0x84, 0xAC, 0xDA, 0xFD, 0x4C, 0x85, 0xFD, 0xD3, 0x91, 0x43, 0x1B, 0x05,
+  0x02, 0x81, 0x01, 0x01, 0xC0, 0x02, 0x83, 0x02, 0x06, 0x03, 0x02, 0x00, 0x86, 0x1A, 0x59, 0xAB, 0xD8, 0xE2, 0xEB, 0xFB, 0x4E, 0x85, 0xF9, 0xE1,
+  0xAE, 0x71, 0x2B, 0x02, 0x01, 0x82, 0x04, 0x05, 0x01, 0xC0, 0x01, 0x82, 0x01, 0x02, 0x05, 0x01, 0x83, 0x16, 0x5A, 0xA8, 0xF2, 0x43, 0x8E, 0xFD,
+  0xF9, 0xF8, 0xF8, 0xF8, 0xF9, 0xF8, 0xF8, 0xF8, 0xF9, 0xF9, 0xFA, 0xF9, 0xF8, 0xFC, 0x41, 0x85, 0xF1, 0xC0, 0x7C, 0x42, 0x17, 0x03, 0x00, 0x83,
+  0x02, 0x01, 0x02, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x03, 0x02, 0x04, 0x00, 0x83, 0x0C, 0x4E, 0xB4, 0xEC, 0x45, 0x8D, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD,
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0x41, 0x8A, 0xFE, 0xF4, 0xDF, 0xB1, 0x61, 0x20, 0x01, 0x01, 0x02, 0x05, 0x02, 0xC0, 0x82,
+  0x01, 0x01, 0x04, 0x01, 0x83, 0x0D, 0x48, 0x9A, 0xEF, 0x40, 0x85, 0xFD, 0xF3, 0xF5, 0xF7, 0xFA, 0xFD, 0x4C, 0x83, 0xFC, 0xF9, 0xF7, 0xF8, 0x41,
+  0x84, 0xF8, 0xB1, 0x64, 0x1D, 0x01, 0x00, 0x82, 0x06, 0x02, 0x01, 0xC0, 0x82, 0x03, 0x01, 0x04, 0x01, 0x82, 0x3A, 0xA5, 0xE8, 0x41, 0x85, 0xFE,
+  0xFA, 0xFB, 0xFD, 0xFE, 0xFE, 0x4C, 0x83, 0xFE, 0xFD, 0xFC, 0xFC, 0x42, 0x87, 0xEF, 0xBE, 0x5A, 0x17, 0x02, 0x05, 0x01, 0x05, 0xC0, 0x81, 0x07,
+  0x01, 0x00, 0x83, 0x05, 0x2B, 0x81, 0xE6, 0x40, 0x83, 0xFE, 0xF5, 0xFB, 0xFE, 0x52, 0x84, 0xFE, 0xFC, 0xF8, 0xF3, 0xFC, 0x40, 0x83, 0xF5, 0xA6,
+  0x50, 0x0F, 0x01, 0x80, 0x08, 0xC0, 0x81, 0x09, 0x01, 0x00, 0x83, 0x1D, 0x7A, 0xD0, 0xFE, 0x41, 0x81, 0xF8, 0xFD, 0x54, 0x83, 0xFE, 0xFC, 0xF9,
+  0xFC, 0x41, 0x82, 0xEB, 0xA3, 0x34, 0x01, 0x80, 0x07, 0xC0, 0x80, 0x08, 0x00, 0x83, 0x03, 0x3C, 0xB8, 0xFB, 0x40, 0x82, 0xF7, 0xFC, 0xFB, 0x57,
+  0x83, 0xFD, 0xFA, 0xF4, 0xFD, 0x40, 0x84, 0xDC, 0x6A, 0x13, 0x04, 0x05, 0xC0, 0x84, 0x03, 0x02, 0x16, 0x65, 0xD7, 0x41, 0x82, 0xF7, 0xFD, 0xFE,
+  0x58, 0x81, 0xFC, 0xF6, 0x41, 0x84, 0xF3, 0xAC, 0x4E, 0x11, 0x02, 0xC0, 0x00, 0x87, 0x07, 0x39, 0x98, 0xE9, 0xFD, 0xFE, 0xF7, 0xFD, 0x59, 0x87,
+  0xFE, 0xF9, 0xFE, 0xFA, 0xF9, 0xDD, 0x81, 0x1F, 0xC0, 0x00, 0x83, 0x15, 0x6B, 0xCE, 0xFA, 0x41, 0x81, 0xF9, 0xFE, 0x5A, 0x82, 0xFD, 0xFE, 0xFA,
+  0x40, 0x82, 0xFA, 0xA3, 0x2F, 0xC0, 0x85, 0x05, 0x30, 0x9B, 0xF0, 0xFE, 0xFD, 0x40, 0x81, 0xFC, 0xFE, 0x5B, 0x82, 0xFE, 0xF9, 0xFE, 0x40, 0x82,
+  0xB7, 0x40, 0x04, 0xC0, 0x83, 0x19, 0x53, 0xC2, 0xFE, 0x40, 0x82, 0xF9, 0xFD, 0xFE, 0x5C, 0x81, 0xFE, 0xF9, 0x41, 0x82, 0xC6, 0x54, 0x14, 0xC0,
+  0x82, 0x35, 0x71, 0xD4, 0x40, 0x82, 0xFE, 0xF7, 0xFD, 0x5D, 0x81, 0xFE, 0xF9, 0x40, 0x83, 0xFD, 0xCD, 0x65, 0x28, 0xC0, 0x82, 0x50, 0x83, 0xDB,
+  0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD4, 0x75, 0x3D, 0xC0, 0x83, 0x5B, 0x89, 0xD9, 0xFE, 0x40, 0x81, 0xF8, 0xFD, 0x5D,
+  0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD6, 0x7E, 0x4B, 0xC0, 0x82, 0x58, 0x88, 0xD9, 0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD8,
+  0x84, 0x52, 0xC0, 0x82, 0x56, 0x87, 0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xDA, 0x8A, 0x5A, 0xC0, 0x82, 0x56, 0x87,
+  0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xDC, 0x90, 0x63, 0xC0, 0x82, 0x52, 0x83, 0xD8, 0x41, 0x81, 0xF8, 0xFD, 0x5D,
+  0x81, 0xFD, 0xF8, 0x41, 0x82, 0xDD, 0x91, 0x65, 0xC0, 0x83, 0x42, 0x77, 0xD4, 0xFE, 0x40, 0x81, 0xF9, 0xFD, 0x5D, 0x81, 0xFD, 0xF9, 0x41, 0x82,
+  0xD9, 0x8A, 0x5C, 0xC0, 0x82, 0x27, 0x65, 0xCF, 0x41, 0x81, 0xF9, 0xFD, 0x5D, 0x81, 0xFD, 0xF9, 0x41, 0x82, 0xD7, 0x7D, 0x47, 0xC0, 0x82, 0x0A,
+  0x4D, 0xC1, 0x41, 0x81, 0xF9, 0xFE, 0x5D, 0x86, 0xFE, 0xF9, 0xFE, 0xFD, 0xCF, 0x68, 0x29, 0xC0, 0x00, 0x82, 0x37, 0xAB, 0xFA, 0x40, 0x82, 0xFB,
+  0xFE, 0xFD, 0x5C, 0x81, 0xFE, 0xF9, 0x41, 0x82, 0xC3, 0x4F, 0x11, 0xC0, 0x00, 0x84, 0x23, 0x87, 0xE1, 0xFA, 0xFD, 0x40, 0x81, 0xFB, 0xFE, 0x59,
+  0x83, 0xFE, 0xFD, 0xFE, 0xFA, 0x40, 0x83, 0xFE, 0xA9, 0x33, 0x03, 0xC0, 0x84, 0x01, 0x12, 0x58, 0xB7, 0xF4, 0x41, 0x81, 0xF9, 0xFE, 0x59, 0x87,
+  0xFE, 0xFA, 0xFE, 0xFD, 0xFD, 0xE5, 0x82, 0x1E, 0xC0, 0x00, 0x83, 0x03, 0x25, 0x80, 0xE3, 0x40, 0x82, 0xFE, 0xF7, 0xFD, 0x59, 0x87, 0xFD, 0xF7,
+  0xFD, 0xFC, 0xEE, 0xAF, 0x51, 0x0F, 0xC0, 0x80, 0x03, 0x00, 0x83, 0x07, 0x52, 0xCC, 0xFE, 0x40, 0x82, 0xF8, 0xFD, 0xFE, 0x57, 0x82, 0xFE, 0xFD,
+  0xF7, 0x41, 0x84, 0xDD, 0x76, 0x26, 0x06, 0x03, 0xC0, 0x80, 0x08, 0x01, 0x87, 0x2F, 0xA4, 0xEB, 0xFC, 0xFA, 0xFE, 0xFB, 0xFE, 0x56, 0x82, 0xFC,
+  0xFD, 0xF8, 0x40, 0x85, 0xFC, 0xBB, 0x42, 0x07, 0x01, 0x08, 0xC0, 0x86, 0x09, 0x01, 0x01, 0x18, 0x69, 0xBF, 0xFA, 0x41, 0x81, 0xF6, 0xFB, 0x54,
+  0x82, 0xFE, 0xFD, 0xF8, 0x41, 0x83, 0xFE, 0xD1, 0x7C, 0x1D, 0x01, 0x80, 0x09, 0xC0, 0x86, 0x07, 0x02, 0x02, 0x04, 0x26, 0x7C, 0xE6, 0x40, 0x83,
+  0xFD, 0xF2, 0xF8, 0xFE, 0x53, 0x83, 0xFD, 0xF9, 0xF2, 0xFC, 0x40, 0x83, 0xE8, 0x84, 0x2D, 0x04, 0x01, 0x80, 0x07, 0xC0, 0x82, 0x03, 0x02, 0x05,
+  0x00, 0x83, 0x01, 0x40, 0xB1, 0xEF, 0x40, 0x87, 0xFE, 0xFC, 0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0x48, 0x87, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC,
+  0xFA, 0xFE, 0x41, 0x83, 0xEE, 0xAF, 0x3F, 0x01, 0x00, 0x82, 0x05, 0x01, 0x03, 0xC0, 0x82, 0x01, 0x01, 0x05, 0x01, 0x83, 0x16, 0x61, 0xB4, 0xF9,
+  0x40, 0x87, 0xFD, 0xF4, 0xF6, 0xF8, 0xF9, 0xFB, 0xFD, 0xFE, 0x47, 0x86, 0xFC, 0xFC, 0xFA, 0xF9, 0xF7, 0xF6, 0xF4, 0x41, 0x83, 0xF9, 0xAF, 0x5C,
+  0x14, 0x01, 0x82, 0x05, 0x01, 0x01, 0xC0, 0x00, 0x88, 0x01, 0x04, 0x02, 0x04, 0x04, 0x24, 0x68, 0xC2, 0xEE, 0x44, 0x8C, 0xFE, 0xFD, 0xFD, 0xFD,
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFD, 0xFE, 0x44, 0x89, 0xFC, 0xE8, 0xBC, 0x62, 0x1F, 0x02, 0x04, 0x02, 0x04, 0x01, 0xC0, 0x01, 0x82,
+  0x01, 0x02, 0x05, 0x00, 0x84, 0x05, 0x21, 0x65, 0xAB, 0xEC, 0x43, 0x8C, 0xFD, 0xFA, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFB,
+  0xFD, 0x44, 0x84, 0xDC, 0x99, 0x58, 0x1C, 0x03, 0x00, 0x82, 0x04, 0x01, 0x01, 0xC0, 0x02, 0x82, 0x02, 0x06, 0x02, 0x01, 0x86, 0x20, 0x5B, 0xA1,
+  0xCC, 0xDC, 0xE6, 0xF6, 0x4C, 0x87, 0xFC, 0xF4, 0xE9, 0xDC, 0xBF, 0x8D, 0x49, 0x14, 0x01, 0x82, 0x02, 0x05, 0x01, 0xC0, 0x02, 0x82, 0x01, 0x02,
+  0x01, 0x01, 0x87, 0x04, 0x15, 0x33, 0x50, 0x71, 0x98, 0xC7, 0xF0, 0x4A, 0x88, 0xF7, 0xDF, 0xC3, 0x9D, 0x73, 0x45, 0x24, 0x0F, 0x01, 0x01, 0x81,
+  0x01, 0x02, 0xC0, 0x04, 0x82, 0x01, 0x03, 0x04, 0x03, 0x93, 0x1C, 0x40, 0x6A, 0x92, 0xB5, 0xC9, 0xD3, 0xD7, 0xD9, 0xD9, 0xD8, 0xD6, 0xD0, 0xC3,
+  0xAD, 0x98, 0x80, 0x66, 0x44, 0x1E, 0x02, 0x83, 0x03, 0x05, 0x03, 0x01, 0xC0, 0x05, 0x81, 0x01, 0x01, 0x03, 0x93, 0x02, 0x0C, 0x18, 0x27, 0x42,
+  0x5C, 0x73, 0x81, 0x85, 0x87, 0x86, 0x7D, 0x69, 0x53, 0x3A, 0x29, 0x1F, 0x17, 0x0D, 0x02, 0x02, 0x82, 0x02, 0x02, 0x01, 0xC0, 0x06, 0x84, 0x01,
+  0x06, 0x08, 0x07, 0x05, 0x04, 0x88, 0x1C, 0x3B, 0x4F, 0x54, 0x56, 0x55, 0x49, 0x2E, 0x12, 0x05, 0x84, 0x05, 0x08, 0x08, 0x05, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_COOKIE_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x1882, 0x3944, 0x51E6, 0x51E6, 0x4185, 0x3944, 0x3123, 0x3143, 0x3123, 0x2903, 0x18A2,
+  0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1882, 0x20E3, 0x51E6, 0x7288, 0x7AE9, 0x7AE9,
+  0x72A8, 0x6247, 0x6247, 0x6247, 0x6247, 0x5A27, 0x5A06, 0x49C5, 0x3924, 0x28E3, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0840, 0x20E3, 0x4185, 0x6247, 0x830A, 0xABEC, 0xBC6E, 0xC46E, 0xBC6E, 0xBC4E, 0xBC4E, 0xBC4D, 0xBC4D, 0xBC2D,
+  0xB40D, 0xAC2D, 0xAC0D, 0xA38B, 0x830A, 0x6247, 0x2903, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1061, 0x3123, 0x51E6, 0x72C9, 0x9B8B, 0xBC2D, 0xDD10, 0xF572, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592, 0xF592,
+  0xF592, 0xF592, 0xF5B2, 0xF592, 0xE531, 0xB42D, 0x7AE9, 0x3144, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1061, 0x4185, 0x8B0A, 0xBC4E, 0xCCAE, 0xD4CF, 0xDCF0, 0xE531, 0xE531, 0xE531, 0xE530, 0xE530, 0xE531, 0xE531, 0xE531, 0xE551,
+  0xE551, 0xE531, 0xDCF0, 0xDD10, 0xE531, 0xF572, 0xE531, 0xCC8E, 0x9B8B, 0x5A06, 0x18A2, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x1061, 0x41A5, 0x934B, 0xD4EF, 0xFDB3, 0xFDB2, 0xED51, 0xE551, 0xDD10, 0xD4AF, 0xCCAF, 0xCCAF, 0xCCAF, 0xCC8F,
+  0xD4AF, 0xD4CF, 0xD4CF, 0xCC8E, 0xBC0C, 0xAB6A, 0xA36A, 0xBBEC, 0xDCF0, 0xED71, 0xF592, 0xD4CF, 0xA3CC, 0x7288, 0x3124, 0x1061,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x4164, 0x9B8C, 0xE530, 0xF5B2, 0xED92, 0xE551,
+  0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xDD10, 0xCC6E, 0xAB6A, 0x8A67, 0x8226, 0x9AE9,
+  0xBC0D, 0xDCF0, 0xED51, 0xE551, 0xE510, 0xCC8E, 0x936B, 0x49C6, 0x1881, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0841, 0x3944, 0x82E9, 0xD4CF, 0xF572, 0xE510, 0xC46E, 0xCC8E, 0xCCAF, 0xD4AF, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xD4F0, 0xDD10, 0xE531, 0xDD10, 0xCC6E, 0xA32A, 0x8205, 0x7184, 0x8226, 0xA34A, 0xC42D, 0xD4F0, 0xDCF0, 0xED51, 0xF592, 0xDCEF,
+  0x9B8B, 0x51E6, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3103, 0x8B4A, 0xCCAF, 0xE511, 0xD48E, 0xBBEC,
+  0xB3AB, 0xC44D, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4D0, 0xD4D0, 0xD4D0, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xB3CC, 0x92C8,
+  0x8206, 0x8226, 0xA329, 0xC46E, 0xDD10, 0xDD10, 0xDD10, 0xE530, 0xED51, 0xE510, 0xABCC, 0x49A5, 0x1061, 0x0000, 0x0020, 0x0000,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x18A2, 0x6A88, 0xCCCF, 0xF592, 0xD4AF, 0xA34A, 0x8AA7, 0xA329, 0xCC6E, 0xE531, 0xDD30, 0xDCF0,
+  0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xCC8E, 0xBBEC, 0xAB4A, 0xA32A, 0xB3AC, 0xCC8E, 0xDD10,
+  0xDD10, 0xCC8E, 0xC48F, 0xE531, 0xF592, 0xDCF0, 0x8B4A, 0x4184, 0x0840, 0x0020, 0x0020, 0x0000, 0x1881, 0x5A07, 0xAC0D, 0xED72,
+  0xED71, 0xC42D, 0x92C8, 0x8A67, 0xA309, 0xCC6E, 0xE551, 0xDD10, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xDD10, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDD10, 0xDCF0, 0xD4CF, 0xD4AF, 0xCC8E, 0xD4AF, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xCCAF, 0xDD10, 0xE531, 0xED51, 0xCCAF,
+  0x830A, 0x2903, 0x0020, 0x0020, 0x0000, 0x3123, 0x936B, 0xDD10, 0xED92, 0xDCCF, 0xC42D, 0xA34A, 0xA32A, 0xB3AB, 0xD4AF, 0xE531,
+  0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xE531, 0xE531, 0xE531, 0xE531,
+  0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xD4AF, 0xD4AF, 0xE531, 0xF572, 0xBC6E, 0x5206, 0x0841, 0x0000, 0x0020, 0x0000, 0x0000,
+  0x1061, 0x5A06, 0xBC4E, 0xF592, 0xED51, 0xD4AF, 0xD4AF, 0xCC8F, 0xCC8E, 0xD4AF, 0xD4F0, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xC44E,
+  0xBBEC, 0xBC0D, 0xCCAF, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD30, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDD10, 0xDCF0, 0xCC8F, 0xE510, 0xF572, 0xD4CF, 0x936B, 0x4184, 0x0840, 0x0000, 0x0020, 0x2903, 0x82E9, 0xD4CF, 0xF592, 0xDD10,
+  0xCC8F, 0xDD10, 0xE551, 0xE551, 0xDD31, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xC42D, 0xAB4A, 0x9AE8, 0xA309, 0xBBEC, 0xD4AF, 0xDD10,
+  0xDD10, 0xDCF0, 0xD4D0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xD4AF, 0xDD10, 0xE510,
+  0xE510, 0xC46E, 0x6A68, 0x1881, 0x1061, 0x51E6, 0xAC0D, 0xDCF0, 0xED51, 0xDD10, 0xCC8F, 0xDCF0, 0xDD31, 0xDD30, 0xDD10, 0xDCF0,
+  0xDD10, 0xDD10, 0xCC6E, 0xAB4A, 0x8A67, 0x8206, 0x8A67, 0x9B09, 0xBC0D, 0xD4F0, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xED51, 0xDCEF, 0x830A, 0x28E3, 0x0020, 0x20E2,
+  0x7AE9, 0xD4AF, 0xE531, 0xDD10, 0xDD10, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD30, 0xDD31, 0xCC4E, 0x9B09, 0x7A05,
+  0x71C4, 0x79E5, 0x8A67, 0xAB8B, 0xD4AF, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xE531, 0xED51, 0x938B, 0x3124, 0x0020, 0x1061, 0x4185, 0xA3AC, 0xED71, 0xE531, 0xD4AF,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD30, 0xE531, 0xCC8E, 0xA34A, 0x8A46, 0x79E5, 0x79E5, 0x8A46, 0xAB4A,
+  0xCC8F, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xD4F0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4CF, 0xCC8F,
+  0xC44E, 0xDD10, 0xED72, 0xABEC, 0x49A5, 0x1061, 0x2903, 0x5A27, 0xB42D, 0xF592, 0xE531, 0xD4AF, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xD4CF, 0xBC0D, 0xA309, 0x8A47, 0x8206, 0x8A67, 0xAB6A, 0xD48F, 0xE531, 0xDD10, 0xDCF0,
+  0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD30, 0xCC8F, 0xB3CC, 0xAB8B, 0xB3CB, 0xDCCF, 0xF592, 0xB42D,
+  0x5A06, 0x18A2, 0x3964, 0x6A88, 0xBC4E, 0xF5B2, 0xE530, 0xCC8E, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10,
+  0xDD10, 0xDD10, 0xD4CF, 0xBC0D, 0xA309, 0x9287, 0x9AE9, 0xB3CC, 0xD4CF, 0xE531, 0xDD10, 0xDCF0, 0xDD10, 0xE551, 0xE551, 0xE531,
+  0xDD10, 0xDD10, 0xDCF0, 0xDD30, 0xDD30, 0xC42D, 0x92C8, 0x8A67, 0x9B29, 0xD4AF, 0xF5B2, 0xBC6E, 0x6A67, 0x3103, 0x41A5, 0x72A8,
+  0xBC6E, 0xF592, 0xE530, 0xCCAF, 0xDD10, 0xDD30, 0xDD30, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xD4CF,
+  0xBC0C, 0xAB8B, 0xB3CC, 0xC44E, 0xD4F0, 0xE531, 0xE531, 0xDD10, 0xDCF0, 0xD4CF, 0xD4CF, 0xD4CF, 0xDCF0, 0xDD10, 0xDD10, 0xDD10,
+  0xDD10, 0xC42D, 0x9AC8, 0x9287, 0xA36A, 0xDCCF, 0xF5B2, 0xC46E, 0x7288, 0x3923, 0x41A5, 0x72A8, 0xBC6E, 0xF592, 0xE531, 0xD4AF,
+  0xDD10, 0xDCF0, 0xD4D0, 0xD4F0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xD4CF, 0xD4CF, 0xD4CF,
+  0xDCF0, 0xDD31, 0xE531, 0xDCF0, 0xCC6E, 0xB3CC, 0xAB8B, 0xB3CC, 0xCC8E, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xCC8F, 0xBC0D, 0xBBEC,
+  0xBC0D, 0xE510, 0xF5B2, 0xBC6E, 0x72A8, 0x4164, 0x41A5, 0x72A8, 0xBC4E, 0xF592, 0xE551, 0xD4AF, 0xCCAF, 0xC44D, 0xBBEC, 0xBC0D,
+  0xCC8E, 0xDCF0, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE531, 0xDD10, 0xDD10, 0xDD10, 0xD4CF, 0xC44D,
+  0xAB6B, 0x92C8, 0x8A87, 0x9AE8, 0xB3AB, 0xCC8E, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4AF, 0xE531, 0xF592, 0xBC4E,
+  0x72A8, 0x41A5, 0x41A5, 0x7288, 0xBC4D, 0xF5B2, 0xED51, 0xCC6E, 0xBBEC, 0xA309, 0x92A7, 0x9AE8, 0xB3AB, 0xCC8E, 0xDD10, 0xDD10,
+  0xDD10, 0xD4F0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD30, 0xD4CF, 0xBC0C, 0xA32A, 0x9287, 0x8226, 0x8205, 0x8A46,
+  0x9AE9, 0xBBEC, 0xD4F0, 0xE551, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xE531, 0xF592, 0xC46E, 0x7AC9, 0x49C6, 0x4164, 0x6A88,
+  0xBC4D, 0xF5B2, 0xE531, 0xBC0C, 0xA329, 0x8226, 0x71C4, 0x8206, 0x9AE9, 0xC40D, 0xDCF0, 0xE531, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0,
+  0xD4F0, 0xD4CF, 0xD4CF, 0xDD10, 0xE531, 0xCC8E, 0xA34A, 0x8A67, 0x8205, 0x79C5, 0x79C5, 0x8206, 0x92A8, 0xB3CC, 0xD4CF, 0xE551,
+  0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xCCAF, 0xE530, 0xF592, 0xC46E, 0x7AC9, 0x51E6, 0x3103, 0x6267, 0xBC6E, 0xF5B2, 0xDCF0, 0xAB8B,
+  0x92A8, 0x79C5, 0x71A4, 0x8206, 0x9AC8, 0xBBEC, 0xDCF0, 0xE551, 0xDD10, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xDD10,
+  0xDD31, 0xCC8E, 0xA32A, 0x8A46, 0x8206, 0x79E5, 0x79E5, 0x8A47, 0xA32A, 0xC42D, 0xDCF0, 0xE531, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xCCAF, 0xE530, 0xF592, 0xBC6E, 0x72A8, 0x49C6, 0x18A2, 0x5206, 0xB44D, 0xF5B2, 0xDCCF, 0xA34A, 0x8A67, 0x79C5, 0x8205, 0x92A8,
+  0xAB6A, 0xC42D, 0xDCF0, 0xDD31, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xB3CC, 0xA32A,
+  0x9AE9, 0x9AC8, 0x92C8, 0xA34A, 0xBC0C, 0xD4AF, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xD4F0, 0xCCAF, 0xE531, 0xF5B2, 0xBC4E,
+  0x6A88, 0x3944, 0x0000, 0x4185, 0xA3CC, 0xF592, 0xDCF0, 0xAB8A, 0x92A8, 0x8226, 0x92A8, 0xAB8B, 0xC44D, 0xD4CF, 0xDD10, 0xDD10,
+  0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0, 0xD4AF, 0xCC6E, 0xC42D, 0xBC0D, 0xBC0D, 0xCC6E,
+  0xD4AF, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4AF, 0xE551, 0xF592, 0xAC0D, 0x51E6, 0x20A2, 0x2903, 0x8B2A,
+  0xE510, 0xE530, 0xC40C, 0xAB8B, 0xA32A, 0xB3AB, 0xCC6E, 0xDCF0, 0xDD31, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xDD30, 0xDCF0, 0xDCF0, 0xDD10, 0xE531, 0xE551, 0xE551, 0xDD10, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xD4AF, 0xE551, 0xED72, 0x9BAC, 0x4185, 0x0841, 0x1881, 0x6A88, 0xC46E, 0xE510, 0xE510, 0xD4AF, 0xC44D,
+  0xD4CF, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4F0, 0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDD10,
+  0xDD10, 0xDD10, 0xDD10, 0xDD31, 0xE531, 0xE551, 0xE551, 0xE531, 0xDD31, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xD4CF, 0xE531,
+  0xDD10, 0x8B0A, 0x28E3, 0x0000, 0x0000, 0x0840, 0x41A5, 0x9B8B, 0xE510, 0xF592, 0xE551, 0xD4CF, 0xDD31, 0xE531, 0xDD10, 0xDCF0,
+  0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10,
+  0xDCF0, 0xCC8F, 0xC44E, 0xC44E, 0xD4CF, 0xDD10, 0xDD10, 0xDCF0, 0xCCAF, 0xDD10, 0xE551, 0xE531, 0xC46E, 0x6A67, 0x18A1, 0x0000,
+  0x20C2, 0x6A88, 0xC46E, 0xF592, 0xE551, 0xD4CF, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10,
+  0xE531, 0xE551, 0xE531, 0xDD10, 0xDD10, 0xDCF0, 0xD4F0, 0xDD10, 0xDD31, 0xDD10, 0xCC8E, 0xB3AB, 0x9AE9, 0xA309, 0xBBEC, 0xD4CF,
+  0xDD30, 0xDD10, 0xCCAF, 0xDD10, 0xF592, 0xDD0F, 0x936B, 0x3964, 0x0840, 0x0000, 0x0020, 0x4185, 0xAC0D, 0xED51, 0xE531, 0xD4AF,
+  0xD4F0, 0xD4F0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDCF0,
+  0xD4F0, 0xDD10, 0xDD31, 0xDCF0, 0xC44E, 0xA309, 0x8205, 0x8205, 0xA309, 0xC44D, 0xDCF0, 0xDD10, 0xD4CF, 0xE530, 0xF592, 0xC48E,
+  0x6A67, 0x18A2, 0x0020, 0x0000, 0x0020, 0x20C2, 0x8B09, 0xC48E, 0xE531, 0xDCEF, 0xDCF0, 0xCCAF, 0xDCF0, 0xDCF0, 0xDCF0, 0xDCF0,
+  0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xC42D, 0xBBEC, 0xC44D, 0xD4AF, 0xDD10, 0xDD10, 0xDCF0, 0xDD10, 0xDD31, 0xDD10, 0xCC6E, 0xA34A,
+  0x8226, 0x79E5, 0x9287, 0xB3CB, 0xD4AF, 0xE531, 0xDCF0, 0xE530, 0xE510, 0x9B8B, 0x3124, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
+  0x0000, 0x1061, 0x51E6, 0xA3AC, 0xDCF0, 0xF572, 0xE510, 0xCCAF, 0xD4AF, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xDD10, 0xD4F0, 0xC42D,
+  0xA34A, 0x9AC8, 0xA32A, 0xBBEC, 0xD4CF, 0xDD30, 0xDD10, 0xDCF0, 0xDD10, 0xDD10, 0xD4AF, 0xBC0C, 0xA32A, 0x9AC8, 0xA309, 0xB3CC,
+  0xC46E, 0xE551, 0xED72, 0xE510, 0xABED, 0x6267, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A2, 0x6A68, 0xCC8F, 0xF592,
+  0xE531, 0xC48F, 0xD4AF, 0xD4F0, 0xDCF0, 0xDD10, 0xE531, 0xDD10, 0xCC6E, 0xAB6B, 0x8A87, 0x7A05, 0x8226, 0xA32A, 0xCC6E, 0xDD31,
+  0xDD10, 0xDCF0, 0xDCF0, 0xDD10, 0xDD10, 0xD4CF, 0xCC8E, 0xC44D, 0xC44D, 0xC44D, 0xC46F, 0xE551, 0xF592, 0xCC8E, 0x7288, 0x20C2,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3144, 0x934B, 0xDCEF, 0xED51, 0xE530, 0xDD10, 0xCCAF, 0xD4CF, 0xDD10, 0xE531,
+  0xD4F0, 0xBBEC, 0x9AC8, 0x79E5, 0x71A4, 0x7A05, 0xA309, 0xCC6E, 0xDD31, 0xDD30, 0xDCF0, 0xDCF0, 0xDCF0, 0xDD10, 0xDD31, 0xDD31,
+  0xDD10, 0xD4EF, 0xE531, 0xE551, 0xED51, 0xDCEF, 0x936B, 0x3144, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061,
+  0x49C6, 0xA38B, 0xE4F0, 0xF5B2, 0xE551, 0xD4AF, 0xCC8E, 0xD4CF, 0xDCF0, 0xCC8E, 0xB3AB, 0x8A87, 0x79C5, 0x79C5, 0x9287, 0xB3AB,
+  0xD4AF, 0xDD31, 0xDD10, 0xD4F0, 0xDCF0, 0xD4F0, 0xD4AF, 0xD4AF, 0xD4CF, 0xD4CF, 0xDCF0, 0xED71, 0xFDB2, 0xDCF0, 0x9B8B, 0x49C5,
+  0x1061, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x18A2, 0x51E6, 0xABCC, 0xE510, 0xED71, 0xE531, 0xE530,
+  0xE531, 0xE551, 0xD4F0, 0xBBEC, 0x9AE9, 0x8A67, 0x92C8, 0xB38B, 0xCC6E, 0xDCF0, 0xDD10, 0xDD10, 0xD4F0, 0xDD10, 0xDCF0, 0xDCF0,
+  0xDD10, 0xDD10, 0xE531, 0xE531, 0xED51, 0xDCCF, 0xABCC, 0x49C6, 0x1081, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0000, 0x1881, 0x5206, 0x934B, 0xD4CF, 0xED71, 0xF592, 0xED72, 0xED72, 0xE510, 0xC44D, 0xB3CB, 0xA36A, 0xABCB, 0xC42D,
+  0xCCAF, 0xD4AF, 0xCCAF, 0xD4AF, 0xD4AF, 0xD4CF, 0xE530, 0xE531, 0xED71, 0xED72, 0xF592, 0xE551, 0xC46E, 0x830A, 0x49A5, 0x1881,
+  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x1881, 0x41A5, 0x830A, 0xB42D, 0xC48E, 0xD4CF, 0xE510, 0xE531, 0xE531,
+  0xDD10, 0xDCF0, 0xDD10, 0xE551, 0xED51, 0xE551, 0xE530, 0xE531, 0xE551, 0xE551, 0xE551, 0xE531, 0xE510, 0xD4CF, 0xC48E, 0xABCC,
+  0x7AA9, 0x3944, 0x1061, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x28E3, 0x4185, 0x6227, 0x8309, 0xAC0C,
+  0xCCAF, 0xED51, 0xF592, 0xFDB2, 0xF5B2, 0xFDB2, 0xFDB2, 0xF592, 0xF592, 0xF592, 0xED71, 0xE531, 0xDCCF, 0xC46E, 0xABCC, 0x8B2A,
+  0x6227, 0x3964, 0x20A2, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x3124, 0x51E6, 0x7AA9, 0x9B8B, 0xAC0C,
+  0xB44D, 0xBC4E, 0xBC4E, 0xBC4E, 0xBC4E, 0xBC4E, 0xAC0D, 0xA3AC, 0x934B, 0x82E9, 0x6A88, 0x5206, 0x3944, 0x1881, 0x0000, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1061, 0x20C2, 0x3144, 0x51E6, 0x5A27, 0x6A88, 0x72A9, 0x72A8, 0x72A8, 0x6A88,
+  0x5206, 0x4185, 0x2903, 0x20C2, 0x1882, 0x1061, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x1881, 0x28E3, 0x3964, 0x49A5, 0x49A5, 0x49A5, 0x3944, 0x28E3, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_COOKIE_44_SPANS = {
+  SPRITE_COOKIE_44_SPAN_ROWS, SPRITE_COOKIE_44_SPAN_OPS, SPRITE_COOKIE_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_COOKIE_44_ASSET = {
   SPRITE_COOKIE_44_WIDTH, SPRITE_COOKIE_44_HEIGHT,
-  SPRITE_COOKIE_44_ALPHA, SPRITE_COOKIE_44_RGB565
+  nullptr, nullptr, &SPRITE_COOKIE_44_SPANS
 };
 
 #endif // SPRITE_COOKIE_44_INCLUDED
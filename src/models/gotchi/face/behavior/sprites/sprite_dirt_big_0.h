@@ -5,150 +5,321 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_big_0.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_big_0.png (64x64) — RGBA multi-couleur, encodé en spans
+// 2638/4096 pixels visibles, 8384 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_BIG_0_WIDTH = 64;
 constexpr uint16_t SPRITE_DIRT_BIG_0_HEIGHT = 64;
 
-const uint16_t SPRITE_DIRT_BIG_0_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1881, 0x20C1, 0x2902, 0x3122, 0x3922, 0x3922, 0x3922, 0x3122, 0x2902, 0x20C1, 0x1881, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x3102, 0x3942, 0x4162, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x3942, 0x3102, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x3942, 0x4182, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4182, 0x3942, 0x28E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E2, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x28E2, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3942, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x3942, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1081, 0x2902, 0x4162, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4162, 0x2902, 0x1061, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3122, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x3922, 0x3921, 0x3922, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x3122, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x18A1, 0x3922, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x3122, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x1040, 0x1060, 0x20C1, 0x3122, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4182, 0x3102, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 0x20A1, 0x28E1, 0x3922, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x3962, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1860, 0x1060, 0x0840, 0x0820, 0x0820, 0x1040, 0x1881, 0x28E1, 0x3122, 0x3942, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3122, 0x28E1, 0x20C1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x1881, 0x1060, 0x0820, 0x0000, 0x0020, 0x1060, 0x20A1, 0x3122, 0x4162, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x49A3, 0x4182, 0x3942, 0x3102, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x20A1, 0x20A1, 0x1880, 0x0840, 0x0020, 0x0820, 0x1060, 0x28E1, 0x4142, 0x4983, 0x4983, 0x4982, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4142, 0x3122, 0x28E1, 0x18A1, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1080, 0x18A1, 0x20C1, 0x3101, 0x3102, 0x28E1, 0x1881, 0x1060, 0x1040, 0x1881, 0x28E1, 0x4162, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4982, 0x4982, 0x4982, 0x4982, 0x4982, 0x4162, 0x4162, 0x3942, 0x3922, 0x3101, 0x28C1, 0x20A1, 0x1060, 0x1040, 0x1060, 0x18A1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x1040, 0x1881, 0x20C1, 0x2902, 0x3122, 0x3942, 0x3942, 0x3922, 0x28E1, 0x20A1, 0x1881, 0x20A1, 0x28E1, 0x3942, 0x4983, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x3942, 0x3942, 0x3922, 0x3101, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1060, 0x0840, 0x0840, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1061, 0x1881, 0x1881, 0x1060, 0x1881, 0x20A1, 0x20E1, 0x3102, 0x3942, 0x4162, 0x4162, 0x4142, 0x3922, 0x30E1, 0x28C1, 0x28C1, 0x30E1, 0x3942, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4142, 0x3942, 0x3922, 0x3922, 0x3922, 0x3101, 0x28E1, 0x20C1, 0x28C1, 0x28E1, 0x28C1, 0x20A1, 0x1060, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E2, 0x3122, 0x3102, 0x28E1, 0x18A1, 0x1881, 0x18A1, 0x28C1, 0x3102, 0x3942, 0x3942, 0x3942, 0x3922, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x3942, 0x3922, 0x3922, 0x3922, 0x3101, 0x28C1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061, 0x28E2, 0x4162, 0x4983, 0x4983, 0x3922, 0x20C1, 0x1860, 0x1860, 0x20A1, 0x28E1, 0x3102, 0x3922, 0x3922, 0x3921, 0x3921, 0x3922, 0x3942, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x59E3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x3922, 0x3922, 0x3101, 0x28C1, 0x20A1, 0x20A1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x28C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18A1, 0x3922, 0x49A3, 0x51C3, 0x51A3, 0x4162, 0x28E1, 0x1881, 0x1881, 0x20A1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3922, 0x3942, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59C3, 0x59C3, 0x51C3, 0x51A3, 0x4982, 0x4962, 0x4142, 0x3922, 0x3101, 0x28E1, 0x28C1, 0x28E1, 0x3101, 0x3922, 0x3922, 0x3922, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3942, 0x51C3, 0x59E3, 0x51C3, 0x4182, 0x3102, 0x28C1, 0x28C1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x4982, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59C3, 0x59E3, 0x51C3, 0x51A3, 0x49A3, 0x4982, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x4162, 0x4142, 0x3922, 0x28E1, 0x18A1, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x28E1, 0x4183, 0x51E3, 0x59E4, 0x59E3, 0x49A3, 0x4142, 0x3922, 0x3922, 0x3922, 0x3102, 0x3101, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x4982, 0x4983, 0x4983, 0x4983, 0x4983, 0x51A3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x4982, 0x4962, 0x4982, 0x4983, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x3942, 0x3101, 0x20C1, 0x1880, 0x1060, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3122, 0x49C3, 0x5A04, 0x5A04, 0x5A04, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x4142, 0x3942, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x4142, 0x4982, 0x49A3, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x3922, 0x30E1, 0x28E1, 0x20A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x4163, 0x51E4, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4982, 0x4962, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4983, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x3922, 0x3922, 0x3101, 0x28E1, 0x20A1, 0x1040, 0x0020, 0x0000, 0x0000, 0x0820, 0x1880, 0x20A1, 0x18A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1040, 0x28E1, 0x4183, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51A3, 0x51A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x4983, 0x4983, 0x4962, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x3942, 0x3942, 0x3922, 0x3122, 0x28E1, 0x1881, 0x0820, 0x0000, 0x0000, 0x0820, 0x1880, 0x20C1, 0x20C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x1081, 0x3102, 0x49A3, 0x59E4, 0x5A04, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51C3, 0x59E3, 0x59E3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x3942, 0x3922, 0x3922, 0x3122, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0840, 0x1881, 0x28E1, 0x20C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x1881, 0x3122, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4142, 0x3922, 0x3922, 0x3121, 0x3101, 0x28E1, 0x28C1, 0x18A1, 0x1040, 0x0820, 0x1040, 0x20A1, 0x28E1, 0x20C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x1061, 0x2902, 0x4162, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x4983, 0x4962, 0x4162, 0x3942, 0x3121, 0x3101, 0x28E1, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x1040, 0x18A1, 0x28C1, 0x20C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3942, 0x4983, 0x49A3, 0x49A3, 0x51A3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59C3, 0x59C3, 0x59C3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x3922, 0x3101, 0x28E1, 0x28C1, 0x1881, 0x0840, 0x0020, 0x0820, 0x1880, 0x20C1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x1081, 0x28E1, 0x3922, 0x4142, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51A3, 0x4983, 0x4982, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x4162, 0x3922, 0x3101, 0x28E1, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x1040, 0x1881, 0x18A1, 0x1860, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x3101, 0x3122, 0x3942, 0x4983, 0x51A3, 0x51A3, 0x4983, 0x4962, 0x4962, 0x4983, 0x51A3, 0x51A3, 0x4982, 0x4962, 0x4982, 0x51A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51A3, 0x4162, 0x3922, 0x3101, 0x30E1, 0x28C1, 0x1860, 0x0820, 0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x3942, 0x4983, 0x49A3, 0x4983, 0x4982, 0x4983, 0x51A3, 0x51A3, 0x49A3, 0x4162, 0x4142, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x4983, 0x4142, 0x3922, 0x3101, 0x3101, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1881, 0x28E1, 0x3922, 0x4142, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x4983, 0x4142, 0x3922, 0x3101, 0x3101, 0x28E1, 0x20A1, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x18A1, 0x28C1, 0x28E1, 0x3922, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x51C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x3942, 0x3902, 0x3101, 0x3101, 0x30E1, 0x20A1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x20C1, 0x28E1, 0x30E1, 0x3922, 0x4962, 0x51A3, 0x51A3, 0x4983, 0x4142, 0x3942, 0x4162, 0x51A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x51A3, 0x4983, 0x4162, 0x3922, 0x3101, 0x3101, 0x3101, 0x28E1, 0x20A1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x3122, 0x3102, 0x3101, 0x3922, 0x4162, 0x4983, 0x4983, 0x4162, 0x3942, 0x4142, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4982, 0x4142, 0x3922, 0x3101, 0x3101, 0x3101, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3942, 0x49A3, 0x49C3, 0x4183, 0x3942, 0x4142, 0x4162, 0x4983, 0x4983, 0x4162, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x3922, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28C1, 0x20A1, 0x1880, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3122, 0x49C3, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4983, 0x4983, 0x49A3, 0x4983, 0x4162, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x4983, 0x3942, 0x30E1, 0x28C1, 0x28C1, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x18A1, 0x1860, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18A1, 0x3942, 0x51E4, 0x5A24, 0x6224, 0x5A04, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4982, 0x4142, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51A3, 0x4162, 0x3102, 0x20C1, 0x20A1, 0x28C1, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x20A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3122, 0x49C3, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x4162, 0x3942, 0x3922, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59C3, 0x51C3, 0x51A3, 0x4162, 0x28E1, 0x20C1, 0x20C1, 0x28E1, 0x3122, 0x3922, 0x3102, 0x3102, 0x3102, 0x30E1, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3942, 0x49A3, 0x49A3, 0x4163, 0x3942, 0x3942, 0x4162, 0x4162, 0x4162, 0x3922, 0x3922, 0x4142, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51C3, 0x51A3, 0x4162, 0x3122, 0x3102, 0x3102, 0x3922, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x3922, 0x3102, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x2922, 0x3122, 0x20E1, 0x20A1, 0x20C1, 0x3102, 0x3922, 0x3942, 0x3922, 0x3922, 0x4142, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x51A3, 0x4983, 0x4983, 0x4962, 0x4982, 0x49A3, 0x51A3, 0x4983, 0x4162, 0x3942, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4183, 0x4163, 0x4162, 0x3942, 0x28E1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1081, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1081, 0x1081, 0x1040, 0x0840, 0x1040, 0x18A1, 0x28E1, 0x3121, 0x3922, 0x3922, 0x4142, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x49A3, 0x4962, 0x4162, 0x4142, 0x4142, 0x4162, 0x4983, 0x49A3, 0x4983, 0x4183, 0x4162, 0x4162, 0x4962, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4162, 0x3122, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3122, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0820, 0x1060, 0x28C1, 0x3101, 0x3922, 0x3942, 0x4162, 0x51A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x51A3, 0x4162, 0x4142, 0x3922, 0x3922, 0x3922, 0x3922, 0x4142, 0x4162, 0x4162, 0x4163, 0x4162, 0x4983, 0x4983, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4183, 0x3942, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4163, 0x3943, 0x3122, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3101, 0x3922, 0x4142, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51A3, 0x4983, 0x4142, 0x3922, 0x3901, 0x3101, 0x3101, 0x3101, 0x3101, 0x3102, 0x3922, 0x4162, 0x4982, 0x49A3, 0x51A3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4142, 0x28E1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3943, 0x3963, 0x3963, 0x3942, 0x3122, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x30E1, 0x3922, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x49A3, 0x4162, 0x3922, 0x3901, 0x3101, 0x3101, 0x28E1, 0x28C1, 0x20A1, 0x20C1, 0x3101, 0x3942, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4183, 0x3942, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20C1, 0x28E2, 0x3122, 0x3942, 0x3943, 0x3942, 0x3122, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28C1, 0x3101, 0x4142, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x4983, 0x4142, 0x3922, 0x3101, 0x3101, 0x28E1, 0x20A1, 0x1880, 0x1880, 0x18A1, 0x28E1, 0x3922, 0x4163, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4162, 0x3102, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0840, 0x1060, 0x18A1, 0x28E1, 0x3122, 0x3942, 0x3943, 0x3942, 0x3122, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x3101, 0x4142, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x59C3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x59E3, 0x51C3, 0x4983, 0x3922, 0x3101, 0x28E1, 0x20C1, 0x18A1, 0x1060, 0x1040, 0x1060, 0x1880, 0x20C1, 0x3102, 0x3942, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4183, 0x4162, 0x3922, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x28E1, 0x3122, 0x3942, 0x3943, 0x3942, 0x3122, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x1040, 0x20A1, 0x3101, 0x4162, 0x51A3, 0x51C3, 0x59C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59C3, 0x59C3, 0x59C3, 0x51A3, 0x4162, 0x3102, 0x20C1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x1040, 0x1060, 0x1880, 0x1881, 0x20C1, 0x3102, 0x4142, 0x49A3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x3942, 0x3102, 0x28C1, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x28E1, 0x3122, 0x3942, 0x3943, 0x3122, 0x28E2, 0x1061, 0x0820, 0x0800, 0x1040, 0x20A1, 0x3922, 0x4162, 0x51A3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x4162, 0x3102, 0x20A1, 0x1060, 0x1040, 0x1040, 0x1040, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x28E1, 0x3922, 0x4983, 0x51A3, 0x51A3, 0x4183, 0x3922, 0x28E1, 0x20A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x28E1, 0x3122, 0x3122, 0x2902, 0x1881, 0x0820, 0x0820, 0x1060, 0x28C1, 0x3922, 0x4162, 0x4983, 0x4162, 0x4162, 0x3922, 0x3102, 0x28E1, 0x2901, 0x3122, 0x3942, 0x4162, 0x4162, 0x3942, 0x3102, 0x20C1, 0x1860, 0x1040, 0x0840, 0x1040, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x1040, 0x18A1, 0x28E2, 0x3942, 0x4983, 0x49A3, 0x49A3, 0x3942, 0x28E1, 0x1881, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x20C1, 0x20A1, 0x1061, 0x0820, 0x0820, 0x1880, 0x28C1, 0x3122, 0x3922, 0x3122, 0x3101, 0x28C1, 0x20A1, 0x1881, 0x1060, 0x1080, 0x18A1, 0x28C1, 0x30E1, 0x3101, 0x28E1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x1060, 0x1860, 0x1860, 0x1060, 0x0840, 0x0820, 0x0820, 0x1060, 0x20C1, 0x3922, 0x4162, 0x4983, 0x4983, 0x4162, 0x3122, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0020, 0x0820, 0x1060, 0x20A1, 0x20C1, 0x20C1, 0x1881, 0x1060, 0x1040, 0x0840, 0x0820, 0x0020, 0x0020, 0x0840, 0x1060, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0020, 0x1060, 0x28E1, 0x3942, 0x4163, 0x4163, 0x4162, 0x3122, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1880, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x20A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x3942, 0x3922, 0x3102, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28C1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x20C1, 0x28E1, 0x20C1, 0x1881, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x28E1, 0x20A1, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1860, 0x28C1, 0x3101, 0x28E1, 0x20A1, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x30E1, 0x3122, 0x3101, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x3101, 0x28E1, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x20C1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_BIG_0_SPAN_ROWS[] PROGMEM = {
+  0, 0, 18, 15, 40, 34, 62, 53, 86, 74, 112, 97, 138, 120, 166, 145,
+  195, 171, 231, 204, 268, 238, 306, 273, 345, 309, 386, 347, 429, 387, 475, 430,
+  522, 474, 569, 518, 617, 563, 665, 608, 713, 653, 768, 703, 827, 757, 888, 813,
+  949, 871, 1011, 930, 1075, 991, 1138, 1051, 1201, 1111, 1264, 1171, 1327, 1231, 1388, 1289,
+  1448, 1346, 1507, 1400, 1559, 1449, 1610, 1497, 1662, 1546, 1715, 1596, 1770, 1648, 1826, 1701,
+  1882, 1754, 1937, 1806, 1997, 1862, 2058, 1919, 2121, 1978, 2184, 2037, 2246, 2095, 2308, 2153,
+  2369, 2212, 2429, 2270, 2488, 2326, 2544, 2379, 2596, 2428, 2645, 2474, 2692, 2516, 2731, 2548,
+  2763, 2573, 2783, 2588, 2797, 2599, 2811, 2610, 2823, 2619, 2835, 2628, 2845, 2635, 2851, 2638
 };
 
-const uint8_t SPRITE_DIRT_BIG_0_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0C, 0x14, 0x1D, 0x23, 0x26, 0x26, 0x26, 0x23, 0x1D, 0x14, 0x0C, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x17, 0x21, 0x2C, 0x33, 0x35, 0x35, 0x35, 0x33, 0x2C, 0x21, 0x17, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x16, 0x22, 0x2D, 0x38, 0x40, 0x45, 0x47, 0x47, 0x47, 0x45, 0x40, 0x38, 0x2D, 0x22, 0x16, 0x0C, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x1B, 0x2B, 0x38, 0x41, 0x47, 0x4B, 0x4D, 0x4E, 0x4E, 0x4E, 0x4D, 0x4B, 0x47, 0x41, 0x38, 0x2B, 0x1B, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x16, 0x2B, 0x3D, 0x47, 0x4B, 0x4E, 0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4E, 0x4B, 0x47, 0x3D, 0x2B, 0x16, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x21, 0x38, 0x47, 0x4D, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4B, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4D, 0x47, 0x38, 0x21, 0x0D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x2B, 0x40, 0x4C, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4A, 0x4A, 0x4A, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4C, 0x40, 0x2B, 0x14, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x09, 0x1A, 0x32, 0x45, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x4B, 0x4A, 0x4A, 0x4A, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x45, 0x31, 0x19, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x06, 0x0E, 0x1E, 0x34, 0x46, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4A, 0x4A, 0x4B, 0x4D, 0x50, 0x51, 0x50, 0x4F, 0x4E, 0x45, 0x32, 0x19, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x0B, 0x0B, 0x0A, 0x0A, 0x0A, 0x0B, 0x0F, 0x18, 0x26, 0x37, 0x45, 0x4D, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4C, 0x4D, 0x50, 0x52, 0x53, 0x52, 0x50, 0x4C, 0x41, 0x2D, 0x17, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x11, 0x13, 0x11, 0x0E, 0x0D, 0x0D, 0x10, 0x18, 0x24, 0x33, 0x41, 0x4A, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4E, 0x4F, 0x51, 0x53, 0x53, 0x51, 0x4E, 0x48, 0x3A, 0x28, 0x18, 0x0E, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x18, 0x1A, 0x13, 0x0D, 0x0A, 0x0B, 0x10, 0x1E, 0x32, 0x45, 0x51, 0x55, 0x54, 0x52, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x51, 0x52, 0x51, 0x4D, 0x47, 0x3F, 0x32, 0x25, 0x1D, 0x18, 0x0F, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x14, 0x1F, 0x20, 0x16, 0x0C, 0x07, 0x08, 0x11, 0x25, 0x3E, 0x53, 0x5E, 0x60, 0x5C, 0x57, 0x54, 0x52, 0x51, 0x50, 0x50, 0x52, 0x53, 0x53, 0x51, 0x4B, 0x42, 0x38, 0x2E, 0x25, 0x22, 0x22, 0x1F, 0x15, 0x0A, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x0D, 0x1C, 0x29, 0x2B, 0x22, 0x16, 0x0F, 0x0E, 0x17, 0x2D, 0x45, 0x57, 0x61, 0x65, 0x65, 0x62, 0x5E, 0x5B, 0x57, 0x56, 0x57, 0x5A, 0x5B, 0x58, 0x4F, 0x41, 0x32, 0x24, 0x1B, 0x17, 0x1A, 0x20, 0x1F, 0x15, 0x0A, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x08, 0x0E, 0x13, 0x19, 0x26, 0x34, 0x39, 0x34, 0x2B, 0x22, 0x1E, 0x22, 0x32, 0x46, 0x54, 0x5E, 0x66, 0x6D, 0x71, 0x70, 0x69, 0x62, 0x5F, 0x62, 0x66, 0x65, 0x5D, 0x4B, 0x36, 0x27, 0x1C, 0x13, 0x0E, 0x11, 0x16, 0x16, 0x0F, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x07, 0x08, 0x09, 0x10, 0x19, 0x21, 0x27, 0x31, 0x3C, 0x43, 0x46, 0x46, 0x41, 0x39, 0x36, 0x3D, 0x49, 0x54, 0x5E, 0x69, 0x76, 0x7F, 0x7D, 0x71, 0x65, 0x61, 0x66, 0x6D, 0x6B, 0x5D, 0x46, 0x32, 0x27, 0x1E, 0x15, 0x0F, 0x0F, 0x0F, 0x0E, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x13, 0x18, 0x19, 0x17, 0x18, 0x1D, 0x25, 0x2F, 0x3B, 0x47, 0x4F, 0x56, 0x5D, 0x5E, 0x58, 0x54, 0x52, 0x56, 0x5D, 0x67, 0x72, 0x7F, 0x84, 0x7F, 0x6E, 0x5D, 0x58, 0x5F, 0x6A, 0x69, 0x59, 0x40, 0x32, 0x2E, 0x2C, 0x23, 0x1C, 0x18, 0x13, 0x0D, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x0B, 0x19, 0x27, 0x2F, 0x30, 0x2A, 0x21, 0x1C, 0x22, 0x32, 0x48, 0x58, 0x60, 0x66, 0x6D, 0x70, 0x6D, 0x68, 0x64, 0x62, 0x65, 0x6D, 0x79, 0x85, 0x85, 0x79, 0x61, 0x4E, 0x48, 0x53, 0x61, 0x65, 0x54, 0x3B, 0x2F, 0x31, 0x37, 0x37, 0x33, 0x2C, 0x20, 0x11, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x05, 0x12, 0x27, 0x38, 0x41, 0x41, 0x39, 0x2B, 0x22, 0x29, 0x3C, 0x58, 0x6B, 0x73, 0x74, 0x76, 0x77, 0x77, 0x72, 0x69, 0x61, 0x5F, 0x67, 0x75, 0x83, 0x83, 0x76, 0x60, 0x4B, 0x46, 0x53, 0x61, 0x65, 0x55, 0x3E, 0x33, 0x35, 0x41, 0x4A, 0x47, 0x3E, 0x2A, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x07, 0x16, 0x2D, 0x3F, 0x48, 0x49, 0x43, 0x36, 0x30, 0x3A, 0x50, 0x6A, 0x7A, 0x7F, 0x7C, 0x79, 0x79, 0x78, 0x70, 0x5F, 0x4F, 0x4B, 0x53, 0x66, 0x79, 0x81, 0x7B, 0x69, 0x5A, 0x57, 0x5F, 0x6B, 0x6B, 0x5F, 0x4C, 0x43, 0x42, 0x4B, 0x53, 0x50, 0x45, 0x2C, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x07, 0x15, 0x2B, 0x3B, 0x46, 0x4B, 0x4C, 0x48, 0x48, 0x53, 0x68, 0x7A, 0x83, 0x83, 0x7E, 0x7A, 0x79, 0x75, 0x67, 0x4F, 0x3C, 0x34, 0x3E, 0x54, 0x6E, 0x7F, 0x83, 0x7C, 0x73, 0x70, 0x74, 0x78, 0x78, 0x70, 0x65, 0x5E, 0x59, 0x54, 0x51, 0x4E, 0x41, 0x2A, 0x15, 0x09, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x06, 0x11, 0x22, 0x30, 0x3D, 0x4A, 0x57, 0x5F, 0x64, 0x6F, 0x7C, 0x84, 0x87, 0x83, 0x7D, 0x7A, 0x79, 0x73, 0x63, 0x4B, 0x34, 0x2A, 0x35, 0x4D, 0x6A, 0x80, 0x89, 0x88, 0x84, 0x83, 0x83, 0x82, 0x81, 0x7F, 0x7B, 0x74, 0x6A, 0x59, 0x4C, 0x45, 0x3A, 0x2D, 0x21, 0x18, 0x11, 0x08, 0x04, 0x01, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x07, 0x10, 0x1A, 0x24, 0x2F, 0x43, 0x5C, 0x6F, 0x79, 0x83, 0x8A, 0x8C, 0x89, 0x83, 0x7D, 0x7A, 0x7A, 0x77, 0x69, 0x52, 0x3E, 0x34, 0x3F, 0x54, 0x70, 0x83, 0x8B, 0x8C, 0x8B, 0x8B, 0x89, 0x88, 0x87, 0x88, 0x86, 0x80, 0x71, 0x5E, 0x4E, 0x46, 0x3E, 0x39, 0x35, 0x31, 0x28, 0x1A, 0x0C, 0x03, 0x00, 0x01, 0x04, 0x08, 0x0B, 0x0A, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x05, 0x0C, 0x15, 0x19, 0x1E, 0x28, 0x3D, 0x5A, 0x74, 0x83, 0x8D, 0x93, 0x91, 0x8C, 0x85, 0x80, 0x7D, 0x7D, 0x7C, 0x75, 0x64, 0x53, 0x4D, 0x54, 0x66, 0x7C, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x88, 0x82, 0x77, 0x68, 0x5A, 0x52, 0x4A, 0x46, 0x45, 0x47, 0x3F, 0x2F, 0x17, 0x07, 0x01, 0x02, 0x06, 0x0D, 0x14, 0x14, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x0D, 0x1A, 0x22, 0x21, 0x22, 0x2C, 0x41, 0x5C, 0x73, 0x85, 0x91, 0x96, 0x93, 0x8E, 0x89, 0x86, 0x84, 0x82, 0x83, 0x81, 0x7A, 0x70, 0x6C, 0x70, 0x7B, 0x85, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x85, 0x7E, 0x75, 0x6A, 0x5F, 0x51, 0x49, 0x4B, 0x50, 0x4B, 0x3B, 0x1F, 0x0C, 0x03, 0x03, 0x09, 0x14, 0x20, 0x21, 0x17, 0x0A, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x07, 0x17, 0x2A, 0x33, 0x31, 0x30, 0x39, 0x4D, 0x61, 0x72, 0x82, 0x8F, 0x93, 0x92, 0x8E, 0x8B, 0x8A, 0x89, 0x87, 0x88, 0x89, 0x87, 0x83, 0x80, 0x82, 0x88, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x83, 0x7E, 0x75, 0x65, 0x51, 0x46, 0x45, 0x4E, 0x4C, 0x3D, 0x25, 0x11, 0x07, 0x05, 0x0E, 0x1E, 0x29, 0x29, 0x1D, 0x0C, 0x03, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x09, 0x1C, 0x32, 0x3D, 0x3E, 0x3E, 0x48, 0x57, 0x65, 0x6E, 0x7A, 0x87, 0x8E, 0x8E, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8B, 0x8B, 0x88, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x87, 0x83, 0x7C, 0x6B, 0x57, 0x4B, 0x48, 0x4E, 0x4C, 0x40, 0x2E, 0x1B, 0x0D, 0x0B, 0x13, 0x26, 0x31, 0x2D, 0x1D, 0x0C, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x08, 0x19, 0x2F, 0x3D, 0x41, 0x43, 0x4D, 0x5A, 0x63, 0x66, 0x6E, 0x7C, 0x86, 0x8A, 0x8A, 0x8B, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8B, 0x88, 0x85, 0x85, 0x88, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x88, 0x83, 0x78, 0x68, 0x5A, 0x55, 0x58, 0x56, 0x4D, 0x3B, 0x23, 0x12, 0x0C, 0x14, 0x27, 0x31, 0x2D, 0x1E, 0x0D, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x10, 0x23, 0x34, 0x3B, 0x3F, 0x49, 0x57, 0x5F, 0x62, 0x69, 0x75, 0x7F, 0x83, 0x86, 0x88, 0x89, 0x88, 0x87, 0x88, 0x89, 0x86, 0x7E, 0x76, 0x76, 0x7E, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x83, 0x7B, 0x73, 0x6D, 0x6D, 0x6A, 0x5F, 0x49, 0x29, 0x12, 0x09, 0x0E, 0x1F, 0x2A, 0x2B, 0x20, 0x10, 0x05, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x08, 0x16, 0x25, 0x2F, 0x33, 0x3E, 0x50, 0x5F, 0x69, 0x6F, 0x78, 0x7C, 0x7B, 0x7E, 0x83, 0x83, 0x7E, 0x7B, 0x7E, 0x81, 0x7C, 0x6C, 0x60, 0x60, 0x6C, 0x7E, 0x88, 0x8C, 0x8C, 0x8B, 0x89, 0x88, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x87, 0x82, 0x7E, 0x7D, 0x7B, 0x6E, 0x54, 0x2E, 0x13, 0x08, 0x08, 0x13, 0x21, 0x24, 0x1C, 0x0F, 0x04, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x0C, 0x16, 0x1E, 0x24, 0x30, 0x46, 0x5F, 0x71, 0x7C, 0x81, 0x7E, 0x78, 0x7B, 0x7F, 0x7B, 0x70, 0x6A, 0x6F, 0x74, 0x6E, 0x5D, 0x4F, 0x4E, 0x5B, 0x73, 0x84, 0x8B, 0x8B, 0x87, 0x7F, 0x7B, 0x7F, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8A, 0x87, 0x84, 0x83, 0x82, 0x76, 0x5C, 0x37, 0x1A, 0x09, 0x04, 0x09, 0x11, 0x14, 0x10, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x04, 0x0A, 0x0F, 0x15, 0x21, 0x38, 0x55, 0x6E, 0x7D, 0x83, 0x84, 0x7E, 0x7F, 0x7F, 0x76, 0x67, 0x61, 0x65, 0x6E, 0x6A, 0x59, 0x4B, 0x49, 0x55, 0x6D, 0x80, 0x88, 0x87, 0x7F, 0x70, 0x6B, 0x70, 0x7F, 0x89, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x84, 0x79, 0x64, 0x43, 0x22, 0x0C, 0x02, 0x02, 0x05, 0x06, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x09, 0x12, 0x25, 0x40, 0x59, 0x69, 0x78, 0x81, 0x84, 0x85, 0x82, 0x76, 0x63, 0x5C, 0x60, 0x6B, 0x6B, 0x60, 0x53, 0x50, 0x59, 0x6B, 0x79, 0x81, 0x82, 0x79, 0x6A, 0x65, 0x6B, 0x7B, 0x88, 0x8B, 0x8C, 0x8B, 0x87, 0x7F, 0x7C, 0x7D, 0x81, 0x83, 0x85, 0x85, 0x7D, 0x6A, 0x4C, 0x28, 0x0F, 0x02, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x08, 0x17, 0x29, 0x3A, 0x4A, 0x61, 0x73, 0x80, 0x85, 0x81, 0x74, 0x62, 0x5A, 0x5D, 0x6A, 0x6D, 0x67, 0x5D, 0x5C, 0x61, 0x69, 0x71, 0x77, 0x7C, 0x78, 0x6E, 0x6A, 0x70, 0x7F, 0x89, 0x8C, 0x8C, 0x88, 0x7E, 0x6E, 0x68, 0x6D, 0x78, 0x80, 0x83, 0x85, 0x7F, 0x6E, 0x4F, 0x29, 0x0F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x15, 0x20, 0x2A, 0x35, 0x48, 0x5E, 0x72, 0x7B, 0x7A, 0x6D, 0x5E, 0x58, 0x5C, 0x66, 0x6A, 0x69, 0x65, 0x65, 0x66, 0x68, 0x6B, 0x6F, 0x75, 0x79, 0x7A, 0x79, 0x7F, 0x87, 0x8B, 0x8C, 0x8B, 0x84, 0x74, 0x62, 0x5C, 0x62, 0x71, 0x7B, 0x7F, 0x83, 0x7D, 0x6C, 0x4C, 0x27, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x10, 0x1F, 0x2B, 0x31, 0x35, 0x3F, 0x54, 0x69, 0x72, 0x71, 0x64, 0x58, 0x56, 0x5C, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6A, 0x6F, 0x77, 0x7F, 0x84, 0x88, 0x8B, 0x8C, 0x8C, 0x8A, 0x81, 0x6F, 0x5F, 0x5A, 0x62, 0x70, 0x77, 0x7A, 0x7D, 0x76, 0x63, 0x44, 0x24, 0x0E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1F, 0x32, 0x40, 0x44, 0x43, 0x48, 0x58, 0x6A, 0x70, 0x6C, 0x5E, 0x55, 0x56, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6B, 0x72, 0x7D, 0x85, 0x8A, 0x8C, 0x8C, 0x8B, 0x89, 0x80, 0x71, 0x63, 0x60, 0x65, 0x69, 0x6B, 0x6E, 0x70, 0x68, 0x55, 0x39, 0x21, 0x11, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x15, 0x2D, 0x42, 0x4E, 0x51, 0x52, 0x58, 0x68, 0x74, 0x75, 0x6C, 0x5C, 0x54, 0x56, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6E, 0x78, 0x82, 0x89, 0x8C, 0x8C, 0x8C, 0x8A, 0x83, 0x79, 0x6E, 0x65, 0x5D, 0x57, 0x55, 0x59, 0x5C, 0x57, 0x49, 0x36, 0x26, 0x1B, 0x10, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x19, 0x32, 0x47, 0x52, 0x54, 0x55, 0x5D, 0x6C, 0x79, 0x7B, 0x70, 0x5F, 0x55, 0x56, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x75, 0x80, 0x88, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x82, 0x78, 0x64, 0x4E, 0x43, 0x40, 0x49, 0x52, 0x52, 0x48, 0x3D, 0x34, 0x2B, 0x1D, 0x0F, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x15, 0x2D, 0x42, 0x4D, 0x4F, 0x4E, 0x54, 0x63, 0x74, 0x7A, 0x74, 0x63, 0x58, 0x57, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x80, 0x88, 0x8C, 0x8C, 0x8B, 0x8A, 0x88, 0x85, 0x78, 0x61, 0x49, 0x3C, 0x3D, 0x4A, 0x54, 0x58, 0x55, 0x50, 0x4B, 0x40, 0x2E, 0x1B, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1F, 0x32, 0x3F, 0x41, 0x3C, 0x40, 0x4E, 0x62, 0x70, 0x70, 0x66, 0x5D, 0x5A, 0x5F, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x80, 0x88, 0x8A, 0x8A, 0x88, 0x86, 0x83, 0x80, 0x76, 0x62, 0x50, 0x4A, 0x4E, 0x59, 0x61, 0x66, 0x64, 0x61, 0x5D, 0x52, 0x41, 0x29, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x10, 0x1E, 0x29, 0x2A, 0x23, 0x24, 0x30, 0x46, 0x5B, 0x65, 0x65, 0x60, 0x5D, 0x61, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x75, 0x80, 0x86, 0x87, 0x85, 0x83, 0x7F, 0x7B, 0x75, 0x6E, 0x64, 0x5D, 0x5C, 0x5F, 0x64, 0x68, 0x6A, 0x69, 0x67, 0x64, 0x5D, 0x50, 0x39, 0x1C, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0B, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0D, 0x13, 0x13, 0x0E, 0x0F, 0x18, 0x2D, 0x44, 0x57, 0x60, 0x61, 0x60, 0x63, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6E, 0x77, 0x80, 0x82, 0x81, 0x7F, 0x7D, 0x7A, 0x74, 0x6C, 0x66, 0x63, 0x65, 0x66, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x61, 0x59, 0x46, 0x29, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x17, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x00, 0x01, 0x03, 0x05, 0x05, 0x04, 0x04, 0x0B, 0x1E, 0x37, 0x4F, 0x5E, 0x64, 0x66, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6B, 0x72, 0x7B, 0x81, 0x7F, 0x7D, 0x7A, 0x79, 0x76, 0x6F, 0x65, 0x5D, 0x5F, 0x65, 0x66, 0x60, 0x59, 0x56, 0x59, 0x5E, 0x61, 0x62, 0x62, 0x5E, 0x4F, 0x35, 0x19, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0x1E, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x08, 0x1A, 0x35, 0x4E, 0x5F, 0x69, 0x6E, 0x6F, 0x6D, 0x6A, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x7C, 0x7F, 0x7D, 0x7A, 0x78, 0x76, 0x72, 0x67, 0x58, 0x52, 0x56, 0x60, 0x5F, 0x53, 0x49, 0x47, 0x4D, 0x58, 0x5E, 0x61, 0x62, 0x5F, 0x52, 0x3A, 0x1C, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x1D, 0x1E, 0x1E, 0x1D, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x01, 0x07, 0x17, 0x32, 0x4D, 0x5F, 0x6B, 0x74, 0x78, 0x75, 0x6F, 0x6B, 0x6A, 0x69, 0x68, 0x68, 0x66, 0x65, 0x69, 0x70, 0x78, 0x7B, 0x7A, 0x78, 0x76, 0x6F, 0x64, 0x54, 0x45, 0x41, 0x4B, 0x56, 0x55, 0x49, 0x3D, 0x3C, 0x45, 0x54, 0x5D, 0x61, 0x62, 0x5D, 0x4E, 0x35, 0x19, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x11, 0x14, 0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x00, 0x03, 0x11, 0x2A, 0x48, 0x5D, 0x6B, 0x78, 0x80, 0x7E, 0x78, 0x73, 0x6F, 0x6D, 0x6B, 0x68, 0x63, 0x60, 0x61, 0x67, 0x6F, 0x74, 0x75, 0x71, 0x6B, 0x5E, 0x4C, 0x37, 0x2D, 0x2F, 0x3D, 0x4B, 0x4D, 0x44, 0x39, 0x39, 0x42, 0x52, 0x5D, 0x61, 0x60, 0x58, 0x45, 0x29, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x09, 0x0D, 0x13, 0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x02, 0x0D, 0x23, 0x42, 0x5A, 0x6A, 0x79, 0x84, 0x86, 0x82, 0x7D, 0x78, 0x75, 0x73, 0x6C, 0x63, 0x5C, 0x5A, 0x5D, 0x63, 0x67, 0x65, 0x5F, 0x55, 0x43, 0x2F, 0x21, 0x1D, 0x22, 0x30, 0x3E, 0x44, 0x3F, 0x38, 0x38, 0x41, 0x50, 0x5A, 0x5C, 0x58, 0x4B, 0x35, 0x1B, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x02, 0x04, 0x08, 0x0D, 0x13, 0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0C, 0x05, 0x02, 0x0A, 0x1D, 0x3B, 0x57, 0x6C, 0x7C, 0x86, 0x87, 0x81, 0x7C, 0x78, 0x78, 0x77, 0x72, 0x65, 0x5A, 0x56, 0x53, 0x51, 0x4F, 0x4B, 0x42, 0x34, 0x28, 0x1C, 0x16, 0x18, 0x1C, 0x22, 0x2A, 0x32, 0x35, 0x34, 0x36, 0x3D, 0x49, 0x50, 0x4E, 0x45, 0x35, 0x21, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x13, 0x19, 0x1D, 0x1E, 0x1B, 0x14, 0x0A, 0x05, 0x0B, 0x1C, 0x38, 0x59, 0x71, 0x7C, 0x7F, 0x7C, 0x75, 0x6C, 0x67, 0x6B, 0x6F, 0x6D, 0x62, 0x57, 0x4E, 0x45, 0x3A, 0x30, 0x2B, 0x25, 0x1E, 0x19, 0x14, 0x15, 0x15, 0x15, 0x14, 0x18, 0x20, 0x27, 0x2C, 0x31, 0x36, 0x3C, 0x3C, 0x36, 0x2A, 0x1B, 0x0F, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x13, 0x19, 0x1A, 0x15, 0x0C, 0x06, 0x0C, 0x1E, 0x3B, 0x5A, 0x6C, 0x71, 0x6B, 0x62, 0x59, 0x4C, 0x46, 0x4B, 0x56, 0x5A, 0x55, 0x4A, 0x3E, 0x31, 0x26, 0x1C, 0x17, 0x15, 0x15, 0x15, 0x16, 0x14, 0x0F, 0x0C, 0x0C, 0x10, 0x18, 0x1F, 0x25, 0x2B, 0x2D, 0x2C, 0x25, 0x1B, 0x12, 0x09, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x10, 0x0F, 0x09, 0x06, 0x0D, 0x1E, 0x39, 0x50, 0x5A, 0x57, 0x4A, 0x3D, 0x32, 0x28, 0x23, 0x27, 0x31, 0x3C, 0x3D, 0x37, 0x2F, 0x27, 0x1E, 0x19, 0x16, 0x15, 0x17, 0x18, 0x14, 0x0E, 0x07, 0x06, 0x09, 0x11, 0x18, 0x1D, 0x21, 0x26, 0x26, 0x20, 0x14, 0x0B, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x07, 0x07, 0x05, 0x05, 0x0C, 0x1A, 0x2D, 0x3A, 0x3B, 0x31, 0x26, 0x1D, 0x16, 0x0F, 0x0C, 0x0E, 0x16, 0x1F, 0x23, 0x28, 0x2A, 0x27, 0x22, 0x21, 0x20, 0x1D, 0x18, 0x14, 0x0D, 0x07, 0x02, 0x03, 0x09, 0x12, 0x19, 0x1D, 0x1E, 0x1E, 0x1C, 0x16, 0x0B, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x03, 0x09, 0x10, 0x19, 0x1E, 0x1D, 0x15, 0x0D, 0x09, 0x05, 0x02, 0x01, 0x02, 0x06, 0x0C, 0x13, 0x21, 0x2F, 0x33, 0x2D, 0x27, 0x22, 0x1B, 0x12, 0x0B, 0x06, 0x02, 0x00, 0x02, 0x07, 0x10, 0x17, 0x19, 0x19, 0x15, 0x11, 0x0C, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x09, 0x0A, 0x09, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0E, 0x21, 0x32, 0x36, 0x2E, 0x23, 0x1A, 0x11, 0x09, 0x04, 0x02, 0x00, 0x00, 0x01, 0x04, 0x0A, 0x10, 0x12, 0x11, 0x0B, 0x07, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x13, 0x28, 0x37, 0x36, 0x28, 0x17, 0x0D, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x09, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x1F, 0x34, 0x3E, 0x39, 0x28, 0x13, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x13, 0x29, 0x3C, 0x44, 0x3E, 0x2C, 0x15, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x13, 0x28, 0x39, 0x3F, 0x3A, 0x29, 0x13, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x1C, 0x2B, 0x30, 0x2B, 0x1C, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0C, 0x15, 0x18, 0x15, 0x0C, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x07, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_BIG_0_SPAN_OPS[] PROGMEM = {
+  0x1B, 0x8E, 0x01, 0x04, 0x0C, 0x14, 0x1D, 0x23, 0x26, 0x26, 0x26, 0x23, 0x1D, 0x14, 0x0C, 0x04, 0x01, 0xC0, 0x19, 0x92, 0x01, 0x03, 0x07, 0x0E,
+  0x17, 0x21, 0x2C, 0x33, 0x35, 0x35, 0x35, 0x33, 0x2C, 0x21, 0x17, 0x0E, 0x07, 0x03, 0x01, 0xC0, 0x19, 0x92, 0x05, 0x0C, 0x16, 0x22, 0x2D, 0x38,
+  0x40, 0x45, 0x47, 0x47, 0x47, 0x45, 0x40, 0x38, 0x2D, 0x22, 0x16, 0x0C, 0x05, 0xC0, 0x18, 0x94, 0x03, 0x0C, 0x1B, 0x2B, 0x38, 0x41, 0x47, 0x4B,
+  0x4D, 0x4E, 0x4E, 0x4E, 0x4D, 0x4B, 0x47, 0x41, 0x38, 0x2B, 0x1B, 0x0C, 0x03, 0xC0, 0x17, 0x96, 0x01, 0x07, 0x16, 0x2B, 0x3D, 0x47, 0x4B, 0x4E,
+  0x4F, 0x4F, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4E, 0x4B, 0x47, 0x3D, 0x2B, 0x16, 0x07, 0x01, 0xC0, 0x17, 0x96, 0x03, 0x0D, 0x21, 0x38, 0x47, 0x4D,
+  0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4B, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4D, 0x47, 0x38, 0x21, 0x0D, 0x03, 0xC0, 0x16, 0x98, 0x01, 0x06, 0x14, 0x2B,
+  0x40, 0x4C, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4A, 0x4A, 0x4A, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4C, 0x40, 0x2B, 0x14, 0x06, 0x01, 0xC0, 0x15, 0x99,
+  0x01, 0x02, 0x09, 0x1A, 0x32, 0x45, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x4B, 0x4A, 0x4A, 0x4A, 0x4C, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x45, 0x31, 0x19,
+  0x08, 0x01, 0xC0, 0x0E, 0xA0, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x04, 0x06, 0x0E, 0x1E, 0x34, 0x46, 0x4E, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C,
+  0x4A, 0x4A, 0x4B, 0x4D, 0x50, 0x51, 0x50, 0x4F, 0x4E, 0x45, 0x32, 0x19, 0x08, 0x01, 0xC0, 0x0D, 0xA1, 0x01, 0x04, 0x08, 0x0B, 0x0B, 0x0A, 0x0A,
+  0x0A, 0x0B, 0x0F, 0x18, 0x26, 0x37, 0x45, 0x4D, 0x4F, 0x4F, 0x4F, 0x4F, 0x4E, 0x4C, 0x4C, 0x4D, 0x50, 0x52, 0x53, 0x52, 0x50, 0x4C, 0x41, 0x2D,
+  0x17, 0x08, 0x03, 0xC0, 0x0D, 0xA2, 0x03, 0x09, 0x11, 0x13, 0x11, 0x0E, 0x0D, 0x0D, 0x10, 0x18, 0x24, 0x33, 0x41, 0x4A, 0x4E, 0x4F, 0x4F, 0x4F,
+  0x4F, 0x4F, 0x4E, 0x4E, 0x4F, 0x51, 0x53, 0x53, 0x51, 0x4E, 0x48, 0x3A, 0x28, 0x18, 0x0E, 0x07, 0x02, 0xC0, 0x0D, 0xA3, 0x04, 0x0E, 0x18, 0x1A,
+  0x13, 0x0D, 0x0A, 0x0B, 0x10, 0x1E, 0x32, 0x45, 0x51, 0x55, 0x54, 0x52, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x50, 0x51, 0x52, 0x51, 0x4D, 0x47,
+  0x3F, 0x32, 0x25, 0x1D, 0x18, 0x0F, 0x06, 0x02, 0xC0, 0x0C, 0xA5, 0x01, 0x07, 0x14, 0x1F, 0x20, 0x16, 0x0C, 0x07, 0x08, 0x11, 0x25, 0x3E, 0x53,
+  0x5E, 0x60, 0x5C, 0x57, 0x54, 0x52, 0x51, 0x50, 0x50, 0x52, 0x53, 0x53, 0x51, 0x4B, 0x42, 0x38, 0x2E, 0x25, 0x22, 0x22, 0x1F, 0x15, 0x0A, 0x04,
+  0x01, 0xC0, 0x0A, 0xA7, 0x02, 0x04, 0x06, 0x0D, 0x1C, 0x29, 0x2B, 0x22, 0x16, 0x0F, 0x0E, 0x17, 0x2D, 0x45, 0x57, 0x61, 0x65, 0x65, 0x62, 0x5E,
+  0x5B, 0x57, 0x56, 0x57, 0x5A, 0x5B, 0x58, 0x4F, 0x41, 0x32, 0x24, 0x1B, 0x17, 0x1A, 0x20, 0x1F, 0x15, 0x0A, 0x04, 0x01, 0xC0, 0x06, 0xAA, 0x01,
+  0x01, 0x01, 0x03, 0x08, 0x0E, 0x13, 0x19, 0x26, 0x34, 0x39, 0x34, 0x2B, 0x22, 0x1E, 0x22, 0x32, 0x46, 0x54, 0x5E, 0x66, 0x6D, 0x71, 0x70, 0x69,
+  0x62, 0x5F, 0x62, 0x66, 0x65, 0x5D, 0x4B, 0x36, 0x27, 0x1C, 0x13, 0x0E, 0x11, 0x16, 0x16, 0x0F, 0x06, 0x02, 0xC0, 0x04, 0xAB, 0x01, 0x03, 0x05,
+  0x07, 0x08, 0x09, 0x10, 0x19, 0x21, 0x27, 0x31, 0x3C, 0x43, 0x46, 0x46, 0x41, 0x39, 0x36, 0x3D, 0x49, 0x54, 0x5E, 0x69, 0x76, 0x7F, 0x7D, 0x71,
+  0x65, 0x61, 0x66, 0x6D, 0x6B, 0x5D, 0x46, 0x32, 0x27, 0x1E, 0x15, 0x0F, 0x0F, 0x0F, 0x0E, 0x08, 0x02, 0xC0, 0x04, 0xAB, 0x04, 0x0B, 0x13, 0x18,
+  0x19, 0x17, 0x18, 0x1D, 0x25, 0x2F, 0x3B, 0x47, 0x4F, 0x56, 0x5D, 0x5E, 0x58, 0x54, 0x52, 0x56, 0x5D, 0x67, 0x72, 0x7F, 0x84, 0x7F, 0x6E, 0x5D,
+  0x58, 0x5F, 0x6A, 0x69, 0x59, 0x40, 0x32, 0x2E, 0x2C, 0x23, 0x1C, 0x18, 0x13, 0x0D, 0x05, 0x01, 0xC0, 0x03, 0xAC, 0x02, 0x0B, 0x19, 0x27, 0x2F,
+  0x30, 0x2A, 0x21, 0x1C, 0x22, 0x32, 0x48, 0x58, 0x60, 0x66, 0x6D, 0x70, 0x6D, 0x68, 0x64, 0x62, 0x65, 0x6D, 0x79, 0x85, 0x85, 0x79, 0x61, 0x4E,
+  0x48, 0x53, 0x61, 0x65, 0x54, 0x3B, 0x2F, 0x31, 0x37, 0x37, 0x33, 0x2C, 0x20, 0x11, 0x05, 0x01, 0xC0, 0x02, 0xAC, 0x01, 0x05, 0x12, 0x27, 0x38,
+  0x41, 0x41, 0x39, 0x2B, 0x22, 0x29, 0x3C, 0x58, 0x6B, 0x73, 0x74, 0x76, 0x77, 0x77, 0x72, 0x69, 0x61, 0x5F, 0x67, 0x75, 0x83, 0x83, 0x76, 0x60,
+  0x4B, 0x46, 0x53, 0x61, 0x65, 0x55, 0x3E, 0x33, 0x35, 0x41, 0x4A, 0x47, 0x3E, 0x2A, 0x12, 0x05, 0xC0, 0x02, 0xAC, 0x01, 0x07, 0x16, 0x2D, 0x3F,
+  0x48, 0x49, 0x43, 0x36, 0x30, 0x3A, 0x50, 0x6A, 0x7A, 0x7F, 0x7C, 0x79, 0x79, 0x78, 0x70, 0x5F, 0x4F, 0x4B, 0x53, 0x66, 0x79, 0x81, 0x7B, 0x69,
+  0x5A, 0x57, 0x5F, 0x6B, 0x6B, 0x5F, 0x4C, 0x43, 0x42, 0x4B, 0x53, 0x50, 0x45, 0x2C, 0x13, 0x05, 0xC0, 0x02, 0xAE, 0x01, 0x07, 0x15, 0x2B, 0x3B,
+  0x46, 0x4B, 0x4C, 0x48, 0x48, 0x53, 0x68, 0x7A, 0x83, 0x83, 0x7E, 0x7A, 0x79, 0x75, 0x67, 0x4F, 0x3C, 0x34, 0x3E, 0x54, 0x6E, 0x7F, 0x83, 0x7C,
+  0x73, 0x70, 0x74, 0x78, 0x78, 0x70, 0x65, 0x5E, 0x59, 0x54, 0x51, 0x4E, 0x41, 0x2A, 0x15, 0x09, 0x04, 0x01, 0x04, 0x82, 0x01, 0x01, 0x01, 0xC0,
+  0x02, 0xB0, 0x01, 0x06, 0x11, 0x22, 0x30, 0x3D, 0x4A, 0x57, 0x5F, 0x64, 0x6F, 0x7C, 0x84, 0x87, 0x83, 0x7D, 0x7A, 0x79, 0x73, 0x63, 0x4B, 0x34,
+  0x2A, 0x35, 0x4D, 0x6A, 0x80, 0x89, 0x88, 0x84, 0x83, 0x83, 0x82, 0x81, 0x7F, 0x7B, 0x74, 0x6A, 0x59, 0x4C, 0x45, 0x3A, 0x2D, 0x21, 0x18, 0x11,
+  0x08, 0x04, 0x01, 0x01, 0x84, 0x01, 0x03, 0x04, 0x04, 0x02, 0xC0, 0x02, 0xB0, 0x02, 0x07, 0x10, 0x1A, 0x24, 0x2F, 0x43, 0x5C, 0x6F, 0x79, 0x83,
+  0x8A, 0x8C, 0x89, 0x83, 0x7D, 0x7A, 0x7A, 0x77, 0x69, 0x52, 0x3E, 0x34, 0x3F, 0x54, 0x70, 0x83, 0x8B, 0x8C, 0x8B, 0x8B, 0x89, 0x88, 0x87, 0x88,
+  0x86, 0x80, 0x71, 0x5E, 0x4E, 0x46, 0x3E, 0x39, 0x35, 0x31, 0x28, 0x1A, 0x0C, 0x03, 0x00, 0x86, 0x01, 0x04, 0x08, 0x0B, 0x0A, 0x06, 0x01, 0xC0,
+  0x01, 0xB9, 0x01, 0x05, 0x0C, 0x15, 0x19, 0x1E, 0x28, 0x3D, 0x5A, 0x74, 0x83, 0x8D, 0x93, 0x91, 0x8C, 0x85, 0x80, 0x7D, 0x7D, 0x7C, 0x75, 0x64,
+  0x53, 0x4D, 0x54, 0x66, 0x7C, 0x88, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8B, 0x88, 0x82, 0x77, 0x68, 0x5A, 0x52, 0x4A, 0x46, 0x45, 0x47,
+  0x3F, 0x2F, 0x17, 0x07, 0x01, 0x02, 0x06, 0x0D, 0x14, 0x14, 0x0D, 0x05, 0xC0, 0x01, 0xBA, 0x04, 0x0D, 0x1A, 0x22, 0x21, 0x22, 0x2C, 0x41, 0x5C,
+  0x73, 0x85, 0x91, 0x96, 0x93, 0x8E, 0x89, 0x86, 0x84, 0x82, 0x83, 0x81, 0x7A, 0x70, 0x6C, 0x70, 0x7B, 0x85, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8B, 0x89, 0x85, 0x7E, 0x75, 0x6A, 0x5F, 0x51, 0x49, 0x4B, 0x50, 0x4B, 0x3B, 0x1F, 0x0C, 0x03, 0x03, 0x09, 0x14, 0x20, 0x21, 0x17,
+  0x0A, 0x02, 0xC0, 0x00, 0xBC, 0x01, 0x07, 0x17, 0x2A, 0x33, 0x31, 0x30, 0x39, 0x4D, 0x61, 0x72, 0x82, 0x8F, 0x93, 0x92, 0x8E, 0x8B, 0x8A, 0x89,
+  0x87, 0x88, 0x89, 0x87, 0x83, 0x80, 0x82, 0x88, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x83, 0x7E, 0x75, 0x65,
+  0x51, 0x46, 0x45, 0x4E, 0x4C, 0x3D, 0x25, 0x11, 0x07, 0x05, 0x0E, 0x1E, 0x29, 0x29, 0x1D, 0x0C, 0x03, 0x01, 0xC0, 0x00, 0xBB, 0x01, 0x09, 0x1C,
+  0x32, 0x3D, 0x3E, 0x3E, 0x48, 0x57, 0x65, 0x6E, 0x7A, 0x87, 0x8E, 0x8E, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8B, 0x8B, 0x88, 0x89, 0x8B,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x87, 0x83, 0x7C, 0x6B, 0x57, 0x4B, 0x48, 0x4E, 0x4C, 0x40, 0x2E, 0x1B,
+  0x0D, 0x0B, 0x13, 0x26, 0x31, 0x2D, 0x1D, 0x0C, 0x03, 0xC0, 0x00, 0xBB, 0x01, 0x08, 0x19, 0x2F, 0x3D, 0x41, 0x43, 0x4D, 0x5A, 0x63, 0x66, 0x6E,
+  0x7C, 0x86, 0x8A, 0x8A, 0x8B, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8B, 0x88, 0x85, 0x85, 0x88, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8C, 0x8A, 0x88, 0x83, 0x78, 0x68, 0x5A, 0x55, 0x58, 0x56, 0x4D, 0x3B, 0x23, 0x12, 0x0C, 0x14, 0x27, 0x31, 0x2D, 0x1E, 0x0D, 0x03,
+  0xC0, 0x01, 0xBB, 0x04, 0x10, 0x23, 0x34, 0x3B, 0x3F, 0x49, 0x57, 0x5F, 0x62, 0x69, 0x75, 0x7F, 0x83, 0x86, 0x88, 0x89, 0x88, 0x87, 0x88, 0x89,
+  0x86, 0x7E, 0x76, 0x76, 0x7E, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x83, 0x7B, 0x73, 0x6D,
+  0x6D, 0x6A, 0x5F, 0x49, 0x29, 0x12, 0x09, 0x0E, 0x1F, 0x2A, 0x2B, 0x20, 0x10, 0x05, 0x01, 0xC0, 0x01, 0xBB, 0x01, 0x08, 0x16, 0x25, 0x2F, 0x33,
+  0x3E, 0x50, 0x5F, 0x69, 0x6F, 0x78, 0x7C, 0x7B, 0x7E, 0x83, 0x83, 0x7E, 0x7B, 0x7E, 0x81, 0x7C, 0x6C, 0x60, 0x60, 0x6C, 0x7E, 0x88, 0x8C, 0x8C,
+  0x8B, 0x89, 0x88, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x87, 0x82, 0x7E, 0x7D, 0x7B, 0x6E, 0x54, 0x2E, 0x13, 0x08, 0x08, 0x13,
+  0x21, 0x24, 0x1C, 0x0F, 0x04, 0x01, 0xC0, 0x02, 0xB9, 0x04, 0x0C, 0x16, 0x1E, 0x24, 0x30, 0x46, 0x5F, 0x71, 0x7C, 0x81, 0x7E, 0x78, 0x7B, 0x7F,
+  0x7B, 0x70, 0x6A, 0x6F, 0x74, 0x6E, 0x5D, 0x4F, 0x4E, 0x5B, 0x73, 0x84, 0x8B, 0x8B, 0x87, 0x7F, 0x7B, 0x7F, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x8B, 0x8A, 0x87, 0x84, 0x83, 0x82, 0x76, 0x5C, 0x37, 0x1A, 0x09, 0x04, 0x09, 0x11, 0x14, 0x10, 0x08, 0x02, 0xC0, 0x02, 0xB8, 0x01, 0x04,
+  0x0A, 0x0F, 0x15, 0x21, 0x38, 0x55, 0x6E, 0x7D, 0x83, 0x84, 0x7E, 0x7F, 0x7F, 0x76, 0x67, 0x61, 0x65, 0x6E, 0x6A, 0x59, 0x4B, 0x49, 0x55, 0x6D,
+  0x80, 0x88, 0x87, 0x7F, 0x70, 0x6B, 0x70, 0x7F, 0x89, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x84, 0x79, 0x64, 0x43, 0x22,
+  0x0C, 0x02, 0x02, 0x05, 0x06, 0x05, 0x02, 0xC0, 0x03, 0xB2, 0x01, 0x03, 0x06, 0x09, 0x12, 0x25, 0x40, 0x59, 0x69, 0x78, 0x81, 0x84, 0x85, 0x82,
+  0x76, 0x63, 0x5C, 0x60, 0x6B, 0x6B, 0x60, 0x53, 0x50, 0x59, 0x6B, 0x79, 0x81, 0x82, 0x79, 0x6A, 0x65, 0x6B, 0x7B, 0x88, 0x8B, 0x8C, 0x8B, 0x87,
+  0x7F, 0x7C, 0x7D, 0x81, 0x83, 0x85, 0x85, 0x7D, 0x6A, 0x4C, 0x28, 0x0F, 0x02, 0x00, 0x82, 0x01, 0x01, 0x01, 0xC0, 0x05, 0xB0, 0x01, 0x03, 0x08,
+  0x17, 0x29, 0x3A, 0x4A, 0x61, 0x73, 0x80, 0x85, 0x81, 0x74, 0x62, 0x5A, 0x5D, 0x6A, 0x6D, 0x67, 0x5D, 0x5C, 0x61, 0x69, 0x71, 0x77, 0x7C, 0x78,
+  0x6E, 0x6A, 0x70, 0x7F, 0x89, 0x8C, 0x8C, 0x88, 0x7E, 0x6E, 0x68, 0x6D, 0x78, 0x80, 0x83, 0x85, 0x7F, 0x6E, 0x4F, 0x29, 0x0F, 0x02, 0xC0, 0x06,
+  0xAF, 0x02, 0x07, 0x15, 0x20, 0x2A, 0x35, 0x48, 0x5E, 0x72, 0x7B, 0x7A, 0x6D, 0x5E, 0x58, 0x5C, 0x66, 0x6A, 0x69, 0x65, 0x65, 0x66, 0x68, 0x6B,
+  0x6F, 0x75, 0x79, 0x7A, 0x79, 0x7F, 0x87, 0x8B, 0x8C, 0x8B, 0x84, 0x74, 0x62, 0x5C, 0x62, 0x71, 0x7B, 0x7F, 0x83, 0x7D, 0x6C, 0x4C, 0x27, 0x0E,
+  0x02, 0xC0, 0x05, 0xB0, 0x01, 0x05, 0x10, 0x1F, 0x2B, 0x31, 0x35, 0x3F, 0x54, 0x69, 0x72, 0x71, 0x64, 0x58, 0x56, 0x5C, 0x64, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x6A, 0x6F, 0x77, 0x7F, 0x84, 0x88, 0x8B, 0x8C, 0x8C, 0x8A, 0x81, 0x6F, 0x5F, 0x5A, 0x62, 0x70, 0x77, 0x7A, 0x7D, 0x76,
+  0x63, 0x44, 0x24, 0x0E, 0x03, 0xC0, 0x05, 0xB1, 0x03, 0x0D, 0x1F, 0x32, 0x40, 0x44, 0x43, 0x48, 0x58, 0x6A, 0x70, 0x6C, 0x5E, 0x55, 0x56, 0x5E,
+  0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6B, 0x72, 0x7D, 0x85, 0x8A, 0x8C, 0x8C, 0x8B, 0x89, 0x80, 0x71, 0x63, 0x60, 0x65, 0x69,
+  0x6B, 0x6E, 0x70, 0x68, 0x55, 0x39, 0x21, 0x11, 0x07, 0x02, 0xC0, 0x04, 0xB3, 0x01, 0x06, 0x15, 0x2D, 0x42, 0x4E, 0x51, 0x52, 0x58, 0x68, 0x74,
+  0x75, 0x6C, 0x5C, 0x54, 0x56, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6E, 0x78, 0x82, 0x89, 0x8C, 0x8C, 0x8C, 0x8A,
+  0x83, 0x79, 0x6E, 0x65, 0x5D, 0x57, 0x55, 0x59, 0x5C, 0x57, 0x49, 0x36, 0x26, 0x1B, 0x10, 0x07, 0x02, 0xC0, 0x04, 0xB4, 0x01, 0x08, 0x19, 0x32,
+  0x47, 0x52, 0x54, 0x55, 0x5D, 0x6C, 0x79, 0x7B, 0x70, 0x5F, 0x55, 0x56, 0x5E, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C,
+  0x75, 0x80, 0x88, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x82, 0x78, 0x64, 0x4E, 0x43, 0x40, 0x49, 0x52, 0x52, 0x48, 0x3D, 0x34, 0x2B, 0x1D, 0x0F, 0x05,
+  0x01, 0xC0, 0x04, 0xB4, 0x01, 0x06, 0x15, 0x2D, 0x42, 0x4D, 0x4F, 0x4E, 0x54, 0x63, 0x74, 0x7A, 0x74, 0x63, 0x58, 0x57, 0x5E, 0x65, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x80, 0x88, 0x8C, 0x8C, 0x8B, 0x8A, 0x88, 0x85, 0x78, 0x61, 0x49, 0x3C, 0x3D, 0x4A, 0x54,
+  0x58, 0x55, 0x50, 0x4B, 0x40, 0x2E, 0x1B, 0x0A, 0x02, 0xC0, 0x05, 0xB3, 0x03, 0x0D, 0x1F, 0x32, 0x3F, 0x41, 0x3C, 0x40, 0x4E, 0x62, 0x70, 0x70,
+  0x66, 0x5D, 0x5A, 0x5F, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x80, 0x88, 0x8A, 0x8A, 0x88, 0x86, 0x83, 0x80,
+  0x76, 0x62, 0x50, 0x4A, 0x4E, 0x59, 0x61, 0x66, 0x64, 0x61, 0x5D, 0x52, 0x41, 0x29, 0x12, 0x05, 0xC0, 0x82, 0x03, 0x02, 0x01, 0x02, 0xB4, 0x01,
+  0x05, 0x10, 0x1E, 0x29, 0x2A, 0x23, 0x24, 0x30, 0x46, 0x5B, 0x65, 0x65, 0x60, 0x5D, 0x61, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x6C, 0x75, 0x80, 0x86, 0x87, 0x85, 0x83, 0x7F, 0x7B, 0x75, 0x6E, 0x64, 0x5D, 0x5C, 0x5F, 0x64, 0x68, 0x6A, 0x69, 0x67, 0x64, 0x5D, 0x50,
+  0x39, 0x1C, 0x0A, 0x01, 0xC0, 0x84, 0x0B, 0x08, 0x04, 0x02, 0x01, 0x01, 0xB3, 0x01, 0x05, 0x0D, 0x13, 0x13, 0x0E, 0x0F, 0x18, 0x2D, 0x44, 0x57,
+  0x60, 0x61, 0x60, 0x63, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6E, 0x77, 0x80, 0x82, 0x81, 0x7F, 0x7D, 0x7A, 0x74, 0x6C,
+  0x66, 0x63, 0x65, 0x66, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x61, 0x59, 0x46, 0x29, 0x11, 0x04, 0xC0, 0x86, 0x17, 0x13, 0x0D, 0x08, 0x04,
+  0x02, 0x01, 0x00, 0xB3, 0x01, 0x03, 0x05, 0x05, 0x04, 0x04, 0x0B, 0x1E, 0x37, 0x4F, 0x5E, 0x64, 0x66, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x6B, 0x72, 0x7B, 0x81, 0x7F, 0x7D, 0x7A, 0x79, 0x76, 0x6F, 0x65, 0x5D, 0x5F, 0x65, 0x66, 0x60, 0x59, 0x56, 0x59, 0x5E, 0x61,
+  0x62, 0x62, 0x5E, 0x4F, 0x35, 0x19, 0x08, 0x01, 0xC0, 0x8B, 0x1F, 0x1E, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0xAE,
+  0x01, 0x08, 0x1A, 0x35, 0x4E, 0x5F, 0x69, 0x6E, 0x6F, 0x6D, 0x6A, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6C, 0x74, 0x7C, 0x7F, 0x7D, 0x7A,
+  0x78, 0x76, 0x72, 0x67, 0x58, 0x52, 0x56, 0x60, 0x5F, 0x53, 0x49, 0x47, 0x4D, 0x58, 0x5E, 0x61, 0x62, 0x5F, 0x52, 0x3A, 0x1C, 0x09, 0x01, 0xC0,
+  0x8A, 0x1D, 0x1E, 0x1E, 0x1D, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x01, 0x01, 0xAE, 0x01, 0x07, 0x17, 0x32, 0x4D, 0x5F, 0x6B, 0x74, 0x78, 0x75,
+  0x6F, 0x6B, 0x6A, 0x69, 0x68, 0x68, 0x66, 0x65, 0x69, 0x70, 0x78, 0x7B, 0x7A, 0x78, 0x76, 0x6F, 0x64, 0x54, 0x45, 0x41, 0x4B, 0x56, 0x55, 0x49,
+  0x3D, 0x3C, 0x45, 0x54, 0x5D, 0x61, 0x62, 0x5D, 0x4E, 0x35, 0x19, 0x08, 0x01, 0xC0, 0x8C, 0x11, 0x14, 0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0D,
+  0x08, 0x04, 0x02, 0x01, 0x00, 0xAC, 0x03, 0x11, 0x2A, 0x48, 0x5D, 0x6B, 0x78, 0x80, 0x7E, 0x78, 0x73, 0x6F, 0x6D, 0x6B, 0x68, 0x63, 0x60, 0x61,
+  0x67, 0x6F, 0x74, 0x75, 0x71, 0x6B, 0x5E, 0x4C, 0x37, 0x2D, 0x2F, 0x3D, 0x4B, 0x4D, 0x44, 0x39, 0x39, 0x42, 0x52, 0x5D, 0x61, 0x60, 0x58, 0x45,
+  0x29, 0x11, 0x04, 0xC0, 0xBA, 0x06, 0x09, 0x0D, 0x13, 0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0D, 0x08, 0x04, 0x02, 0x02, 0x0D, 0x23, 0x42, 0x5A,
+  0x6A, 0x79, 0x84, 0x86, 0x82, 0x7D, 0x78, 0x75, 0x73, 0x6C, 0x63, 0x5C, 0x5A, 0x5D, 0x63, 0x67, 0x65, 0x5F, 0x55, 0x43, 0x2F, 0x21, 0x1D, 0x22,
+  0x30, 0x3E, 0x44, 0x3F, 0x38, 0x38, 0x41, 0x50, 0x5A, 0x5C, 0x58, 0x4B, 0x35, 0x1B, 0x09, 0x01, 0xC0, 0xB9, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x13,
+  0x19, 0x1D, 0x1E, 0x1D, 0x19, 0x13, 0x0C, 0x05, 0x02, 0x0A, 0x1D, 0x3B, 0x57, 0x6C, 0x7C, 0x86, 0x87, 0x81, 0x7C, 0x78, 0x78, 0x77, 0x72, 0x65,
+  0x5A, 0x56, 0x53, 0x51, 0x4F, 0x4B, 0x42, 0x34, 0x28, 0x1C, 0x16, 0x18, 0x1C, 0x22, 0x2A, 0x32, 0x35, 0x34, 0x36, 0x3D, 0x49, 0x50, 0x4E, 0x45,
+  0x35, 0x21, 0x0F, 0x04, 0xC0, 0x01, 0xB7, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x13, 0x19, 0x1D, 0x1E, 0x1B, 0x14, 0x0A, 0x05, 0x0B, 0x1C, 0x38, 0x59,
+  0x71, 0x7C, 0x7F, 0x7C, 0x75, 0x6C, 0x67, 0x6B, 0x6F, 0x6D, 0x62, 0x57, 0x4E, 0x45, 0x3A, 0x30, 0x2B, 0x25, 0x1E, 0x19, 0x14, 0x15, 0x15, 0x15,
+  0x14, 0x18, 0x20, 0x27, 0x2C, 0x31, 0x36, 0x3C, 0x3C, 0x36, 0x2A, 0x1B, 0x0F, 0x05, 0x01, 0xC0, 0x03, 0xB4, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x13,
+  0x19, 0x1A, 0x15, 0x0C, 0x06, 0x0C, 0x1E, 0x3B, 0x5A, 0x6C, 0x71, 0x6B, 0x62, 0x59, 0x4C, 0x46, 0x4B, 0x56, 0x5A, 0x55, 0x4A, 0x3E, 0x31, 0x26,
+  0x1C, 0x17, 0x15, 0x15, 0x15, 0x16, 0x14, 0x0F, 0x0C, 0x0C, 0x10, 0x18, 0x1F, 0x25, 0x2B, 0x2D, 0x2C, 0x25, 0x1B, 0x12, 0x09, 0x04, 0x01, 0xC0,
+  0x05, 0xB0, 0x01, 0x02, 0x04, 0x08, 0x0D, 0x10, 0x0F, 0x09, 0x06, 0x0D, 0x1E, 0x39, 0x50, 0x5A, 0x57, 0x4A, 0x3D, 0x32, 0x28, 0x23, 0x27, 0x31,
+  0x3C, 0x3D, 0x37, 0x2F, 0x27, 0x1E, 0x19, 0x16, 0x15, 0x17, 0x18, 0x14, 0x0E, 0x07, 0x06, 0x09, 0x11, 0x18, 0x1D, 0x21, 0x26, 0x26, 0x20, 0x14,
+  0x0B, 0x05, 0x01, 0xC0, 0x07, 0xAD, 0x01, 0x02, 0x04, 0x07, 0x07, 0x05, 0x05, 0x0C, 0x1A, 0x2D, 0x3A, 0x3B, 0x31, 0x26, 0x1D, 0x16, 0x0F, 0x0C,
+  0x0E, 0x16, 0x1F, 0x23, 0x28, 0x2A, 0x27, 0x22, 0x21, 0x20, 0x1D, 0x18, 0x14, 0x0D, 0x07, 0x02, 0x03, 0x09, 0x12, 0x19, 0x1D, 0x1E, 0x1E, 0x1C,
+  0x16, 0x0B, 0x04, 0x01, 0xC0, 0x09, 0x9E, 0x01, 0x02, 0x02, 0x01, 0x03, 0x09, 0x10, 0x19, 0x1E, 0x1D, 0x15, 0x0D, 0x09, 0x05, 0x02, 0x01, 0x02,
+  0x06, 0x0C, 0x13, 0x21, 0x2F, 0x33, 0x2D, 0x27, 0x22, 0x1B, 0x12, 0x0B, 0x06, 0x02, 0x00, 0x8A, 0x02, 0x07, 0x10, 0x17, 0x19, 0x19, 0x15, 0x11,
+  0x0C, 0x05, 0x01, 0xC0, 0x0D, 0x88, 0x01, 0x04, 0x07, 0x09, 0x0A, 0x09, 0x05, 0x01, 0x01, 0x03, 0x8C, 0x01, 0x04, 0x0E, 0x21, 0x32, 0x36, 0x2E,
+  0x23, 0x1A, 0x11, 0x09, 0x04, 0x02, 0x01, 0x89, 0x01, 0x04, 0x0A, 0x10, 0x12, 0x11, 0x0B, 0x07, 0x04, 0x02, 0xC0, 0x0E, 0x84, 0x01, 0x02, 0x01,
+  0x01, 0x01, 0x06, 0x8B, 0x01, 0x06, 0x13, 0x28, 0x37, 0x36, 0x28, 0x17, 0x0D, 0x07, 0x03, 0x01, 0x03, 0x87, 0x01, 0x04, 0x08, 0x09, 0x08, 0x04,
+  0x02, 0x01, 0xC0, 0x1A, 0x89, 0x03, 0x0D, 0x1F, 0x34, 0x3E, 0x39, 0x28, 0x13, 0x06, 0x02, 0x06, 0x84, 0x01, 0x02, 0x02, 0x02, 0x01, 0xC0, 0x19,
+  0x8A, 0x01, 0x05, 0x13, 0x29, 0x3C, 0x44, 0x3E, 0x2C, 0x15, 0x06, 0x01, 0xC0, 0x19, 0x8A, 0x01, 0x05, 0x13, 0x28, 0x39, 0x3F, 0x3A, 0x29, 0x13,
+  0x05, 0x01, 0xC0, 0x1A, 0x88, 0x03, 0x0C, 0x1C, 0x2B, 0x30, 0x2B, 0x1C, 0x0C, 0x03, 0xC0, 0x1A, 0x88, 0x01, 0x05, 0x0C, 0x15, 0x18, 0x15, 0x0C,
+  0x05, 0x01, 0xC0, 0x1B, 0x86, 0x01, 0x03, 0x06, 0x07, 0x06, 0x03, 0x01, 0xC0, 0x1D, 0x82, 0x01, 0x01, 0x01, 0xC0, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_BIG_0_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1060,
+  0x1060, 0x1880, 0x1880, 0x1880, 0x1080, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1080, 0x1060, 0x0840, 0x0840, 0x0840, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1880, 0x1040, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x0840, 0x0840, 0x0840,
+  0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1080, 0x1060, 0x0840, 0x0840,
+  0x0840, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1080, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1881, 0x1881,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1040, 0x0820, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060,
+  0x1060, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1881, 0x1881, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x1881, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0000, 0x0020,
+  0x0820, 0x0840, 0x1881, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20A1, 0x1880, 0x1880, 0x1860, 0x1080, 0x1880, 0x1060, 0x1060, 0x0820,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x1060, 0x1881, 0x20A1,
+  0x20C1, 0x28E1, 0x28C1, 0x20C1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0840, 0x1060, 0x1060, 0x1080, 0x1860, 0x1060, 0x1060, 0x1060, 0x1060, 0x1860, 0x1881, 0x20C1, 0x20C1, 0x28E1, 0x28C1,
+  0x20A1, 0x1880, 0x1060, 0x0840, 0x1040, 0x1060, 0x1060, 0x0840, 0x0020, 0x0020, 0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
+  0x1060, 0x1860, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x1880,
+  0x1060, 0x1040, 0x1040, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1880, 0x1880,
+  0x1060, 0x1880, 0x1880, 0x1880, 0x1881, 0x1060, 0x1060, 0x1880, 0x20A1, 0x28C1, 0x28E1, 0x20C1, 0x20A1, 0x1880, 0x1860, 0x1860,
+  0x1060, 0x1060, 0x0840, 0x0820, 0x0820, 0x0840, 0x0840, 0x1040, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1060, 0x1880, 0x1060, 0x1060, 0x0840, 0x0820, 0x0820, 0x1040, 0x1060, 0x1880, 0x1880, 0x1880, 0x1060, 0x1880, 0x1880,
+  0x1880, 0x1060, 0x1060, 0x0840, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20A1, 0x18A1, 0x20A0, 0x1880, 0x1880, 0x1860,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x0840, 0x1061, 0x1880, 0x1881, 0x1860, 0x1060, 0x1860, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1060,
+  0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0820, 0x0840, 0x1880, 0x20A1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20C1,
+  0x20A1, 0x20C1, 0x20A1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1081, 0x18A1, 0x18A1, 0x20A1, 0x20A1,
+  0x20A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1080, 0x1060, 0x0840, 0x1060, 0x1881, 0x20C1, 0x28E1,
+  0x28E1, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x1060, 0x0840, 0x0820,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0840, 0x0840, 0x1081, 0x18A1, 0x20C1, 0x28C1, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1881, 0x20A1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1060, 0x1081, 0x20A1,
+  0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x20C1, 0x20A1, 0x20C1, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x28C1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1,
+  0x1881, 0x1060, 0x0840, 0x0840, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1040, 0x1060, 0x1060, 0x1880, 0x18A1, 0x20C1, 0x28C1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101,
+  0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1060, 0x0840, 0x0840,
+  0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x20A1, 0x20A1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x3101, 0x3101,
+  0x3101, 0x30E1, 0x28E1, 0x28E1, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101,
+  0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040,
+  0x1060, 0x1060, 0x1880, 0x1881, 0x18A1, 0x20A1, 0x18A1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x28E1,
+  0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101,
+  0x3101, 0x3101, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x0840, 0x1060, 0x1060, 0x1881, 0x18A1,
+  0x1881, 0x18A1, 0x20A1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1,
+  0x28E1, 0x20C1, 0x18A0, 0x1880, 0x1860, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x1040, 0x1060, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x20C1,
+  0x20A1, 0x28C1, 0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x3101,
+  0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28C1, 0x20A1,
+  0x1881, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1881, 0x20A1, 0x28C1, 0x20C1, 0x20A1, 0x20A0, 0x20A1, 0x28C1, 0x20C1, 0x18A0,
+  0x1880, 0x18A0, 0x20C1, 0x20C1, 0x20A1, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x28E1,
+  0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x0840, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x1060, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x28C1, 0x20C1, 0x1880, 0x1860, 0x1880, 0x18A1, 0x20A1, 0x18A1, 0x1880,
+  0x1880, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A0, 0x20C1, 0x20C1, 0x28E1, 0x28E1,
+  0x20C1, 0x1880, 0x1060, 0x1880, 0x18A1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1,
+  0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1881, 0x1880, 0x1880,
+  0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1060,
+  0x1880, 0x20C1, 0x28E1, 0x28E1, 0x20A1, 0x1880, 0x1060, 0x1880, 0x18A1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1,
+  0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20A1, 0x20A0,
+  0x18A1, 0x1881, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820,
+  0x1060, 0x1880, 0x20C1, 0x20C1, 0x18A1, 0x1860, 0x1060, 0x1880, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1881, 0x1881, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820,
+  0x0840, 0x1060, 0x1880, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1881, 0x1880,
+  0x1880, 0x1880, 0x1060, 0x1880, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060,
+  0x1060, 0x0840, 0x1060, 0x1880, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1881,
+  0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x1060, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x20A1, 0x20C1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28E1,
+  0x20C1, 0x20A1, 0x1881, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x1081, 0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x20A1, 0x18A0, 0x1860, 0x1060, 0x1060,
+  0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x3101,
+  0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x0840, 0x0820, 0x0820, 0x0820, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x20A1,
+  0x20A1, 0x18A0, 0x1060, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x0820, 0x0820, 0x0820, 0x0820,
+  0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060,
+  0x1040, 0x0840, 0x1060, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28E1, 0x20C1, 0x1880,
+  0x0840, 0x0840, 0x0840, 0x1060, 0x1860, 0x1880, 0x1880, 0x1860, 0x1860, 0x1040, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1080, 0x1060, 0x1060, 0x1860,
+  0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28C1,
+  0x20C1, 0x20C1, 0x20A1, 0x20A0, 0x20C1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x1860, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881,
+  0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1860, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x18A0, 0x18A1, 0x18A1, 0x1881,
+  0x1881, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
+  0x1060, 0x1080, 0x1880, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x28C1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1880, 0x1860, 0x1880, 0x1880, 0x1880, 0x1881, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1880, 0x18A1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x28C1, 0x20C1, 0x20A1, 0x1880, 0x1860, 0x1060,
+  0x1060, 0x1060, 0x1040, 0x0840, 0x1060, 0x1880, 0x1880, 0x1080, 0x1060, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1880, 0x20C1, 0x20C1, 0x28E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A0, 0x1880, 0x1860, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0820, 0x0840, 0x1060,
+  0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x1060, 0x1880, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1,
+  0x1880, 0x1880, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1080, 0x1881, 0x1881, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1880, 0x20C1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x0840, 0x0840, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x1040, 0x1060, 0x1060, 0x1080, 0x1881, 0x1881, 0x1060, 0x0840,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1880, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20A1, 0x1881, 0x1881, 0x1880, 0x1060, 0x0840, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x0840, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x1880,
+  0x28C1, 0x28E1, 0x28C1, 0x20C1, 0x18A1, 0x1880, 0x1880, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1040, 0x1060, 0x0840,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A1, 0x1880, 0x1880, 0x1060, 0x0840, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0820, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_BIG_0_SPANS = {
+  SPRITE_DIRT_BIG_0_SPAN_ROWS, SPRITE_DIRT_BIG_0_SPAN_OPS, SPRITE_DIRT_BIG_0_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_BIG_0_ASSET = {
   SPRITE_DIRT_BIG_0_WIDTH, SPRITE_DIRT_BIG_0_HEIGHT,
-  SPRITE_DIRT_BIG_0_ALPHA, SPRITE_DIRT_BIG_0_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_BIG_0_SPANS
 };
 
 #endif // SPRITE_DIRT_BIG_0_INCLUDED
@@ -5,150 +5,291 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_big_1.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_big_1.png (64x64) — RGBA multi-couleur, encodé en spans
+// 2343/4096 pixels visibles, 7487 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_BIG_1_WIDTH = 64;
 constexpr uint16_t SPRITE_DIRT_BIG_1_HEIGHT = 64;
 
-const uint16_t SPRITE_DIRT_BIG_1_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x18A1, 0x1880, 0x1040, 0x0840, 0x0820, 0x0020, 0x0820, 0x0840, 0x1060, 0x1060, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x1040, 0x0840, 0x1040, 0x1880, 0x20A1, 0x20A1, 0x18A1, 0x1860, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x28C1, 0x20A1, 0x1060, 0x0840, 0x0840, 0x1040, 0x1060, 0x1880, 0x20A1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x20E1, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28C1, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x0020, 0x0820, 0x1060, 0x18A1, 0x28C1, 0x30E1, 0x3101, 0x3101, 0x3101, 0x28E1, 0x28C1, 0x20A1, 0x1860, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3122, 0x3142, 0x2902, 0x1881, 0x0820, 0x0840, 0x1040, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0820, 0x1060, 0x20C1, 0x30E1, 0x30E1, 0x28C1, 0x1860, 0x0820, 0x0000, 0x0020, 0x0840, 0x1881, 0x20C1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x30E1, 0x28C1, 0x20A1, 0x1060, 0x0840, 0x0820, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1081, 0x2902, 0x3963, 0x3943, 0x2902, 0x1881, 0x0840, 0x1040, 0x1881, 0x20A1, 0x18A1, 0x1860, 0x1040, 0x0840, 0x1040, 0x18A1, 0x28E1, 0x3101, 0x3101, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0020, 0x0840, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x18A1, 0x1880, 0x1880, 0x1881, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1081, 0x2902, 0x3142, 0x3122, 0x20C1, 0x1040, 0x0820, 0x1060, 0x20A1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1881, 0x1881, 0x28C1, 0x30E1, 0x3101, 0x3101, 0x30E1, 0x20A1, 0x1060, 0x0820, 0x0840, 0x1060, 0x20A1, 0x28C1, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x20C1, 0x20C1, 0x1060, 0x0820, 0x0840, 0x1060, 0x20C1, 0x30E1, 0x3101, 0x3101, 0x28E1, 0x28C1, 0x28C1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3101, 0x28C1, 0x18A1, 0x1860, 0x1880, 0x20A1, 0x28E1, 0x3101, 0x30E1, 0x20C1, 0x18A1, 0x1881, 0x2081, 0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1860, 0x1860, 0x1060, 0x1060, 0x1060, 0x18A1, 0x28C1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x30E1, 0x28C1, 0x20C1, 0x28C1, 0x28E1, 0x3101, 0x3101, 0x30E1, 0x28C1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x28C1, 0x20C1, 0x20A1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1880, 0x20A1, 0x20A1, 0x28C1, 0x28E1, 0x30E1, 0x3101, 0x3101, 0x3921, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x30E1, 0x3102, 0x3122, 0x3122, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x18A1, 0x28C1, 0x3101, 0x3102, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3101, 0x3101, 0x3101, 0x3101, 0x3921, 0x3922, 0x3922, 0x3922, 0x3101, 0x3101, 0x3101, 0x3921, 0x3921, 0x3922, 0x3922, 0x4142, 0x4182, 0x4983, 0x4182, 0x3942, 0x2901, 0x20A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x20A1, 0x28E1, 0x3102, 0x3942, 0x4162, 0x4983, 0x4182, 0x4162, 0x4142, 0x4162, 0x4162, 0x4162, 0x3942, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3942, 0x4142, 0x3942, 0x3922, 0x3921, 0x3921, 0x3922, 0x3942, 0x3942, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51A3, 0x4182, 0x3922, 0x28E1, 0x20A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x28E1, 0x3102, 0x4142, 0x49A3, 0x51C3, 0x51E4, 0x51C3, 0x49A3, 0x4182, 0x4983, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4142, 0x3942, 0x4142, 0x4162, 0x4982, 0x4983, 0x4182, 0x4142, 0x3942, 0x3942, 0x4142, 0x4162, 0x4982, 0x4982, 0x4983, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x3942, 0x3101, 0x28E1, 0x20A1, 0x1060, 0x1060, 0x1880, 0x1880, 0x1860, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3101, 0x3922, 0x4162, 0x51C3, 0x5A04, 0x5A04, 0x5A04, 0x51C3, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4182, 0x4162, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4162, 0x3922, 0x3101, 0x30E1, 0x20C1, 0x1880, 0x1880, 0x20A1, 0x28C1, 0x28C1, 0x20A1, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x30E1, 0x3101, 0x3922, 0x4162, 0x49A3, 0x59E4, 0x5A04, 0x59E4, 0x49A3, 0x4162, 0x4162, 0x4982, 0x51C3, 0x51E3, 0x59E4, 0x59E4, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x4983, 0x4962, 0x4142, 0x3922, 0x3101, 0x3101, 0x28C1, 0x20A1, 0x20C1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x28E1, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28C1, 0x3101, 0x3101, 0x3921, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x3922, 0x4142, 0x4982, 0x51C3, 0x5A04, 0x5A04, 0x5A24, 0x5A04, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4142, 0x3942, 0x3922, 0x3901, 0x3101, 0x28E1, 0x28E1, 0x3101, 0x3121, 0x3922, 0x3922, 0x3922, 0x3922, 0x28E1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x20A1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3922, 0x3942, 0x4162, 0x4162, 0x4162, 0x3942, 0x3922, 0x3921, 0x3922, 0x4142, 0x49A3, 0x51E3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x59E4, 0x51C3, 0x49A3, 0x4162, 0x4142, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x4982, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x3922, 0x3922, 0x3101, 0x3101, 0x3101, 0x3922, 0x3922, 0x3922, 0x3922, 0x3942, 0x3942, 0x3101, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1860, 0x20C1, 0x30E1, 0x3101, 0x3101, 0x3101, 0x3921, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3101, 0x3101, 0x3921, 0x3942, 0x4982, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x49A3, 0x4162, 0x3922, 0x3922, 0x4142, 0x4162, 0x4162, 0x4142, 0x3922, 0x3921, 0x3921, 0x3922, 0x3922, 0x3922, 0x3901, 0x3921, 0x3922, 0x3942, 0x3942, 0x3942, 0x3922, 0x3922, 0x3942, 0x3942, 0x3922, 0x28E1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x28C1, 0x3101, 0x3101, 0x3101, 0x3101, 0x3922, 0x3922, 0x3922, 0x3922, 0x3921, 0x3101, 0x3101, 0x3901, 0x3922, 0x4142, 0x4982, 0x51C3, 0x51E3, 0x5A04, 0x6224, 0x6224, 0x6224, 0x5A04, 0x51C3, 0x4162, 0x3922, 0x3921, 0x3922, 0x3942, 0x3942, 0x3922, 0x3921, 0x3101, 0x3101, 0x3901, 0x3921, 0x3901, 0x3901, 0x3922, 0x4142, 0x4162, 0x4162, 0x4162, 0x3942, 0x3922, 0x3942, 0x4142, 0x3942, 0x3101, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3922, 0x3922, 0x3942, 0x3942, 0x3922, 0x3922, 0x3921, 0x3922, 0x3922, 0x4142, 0x4182, 0x49A3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x51C3, 0x4162, 0x3922, 0x3901, 0x3921, 0x3921, 0x3921, 0x3921, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3101, 0x3921, 0x3922, 0x4162, 0x4983, 0x49A3, 0x4983, 0x4142, 0x3942, 0x3942, 0x4142, 0x4142, 0x3922, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1881, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3922, 0x3922, 0x3942, 0x4142, 0x3942, 0x3942, 0x3942, 0x4142, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51E3, 0x59E3, 0x59E3, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x4162, 0x3922, 0x3901, 0x3101, 0x3101, 0x3101, 0x3101, 0x3921, 0x3922, 0x3922, 0x3922, 0x3921, 0x3901, 0x3922, 0x4142, 0x4982, 0x51A3, 0x51C3, 0x49A3, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3922, 0x28E1, 0x1060, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x28E1, 0x3101, 0x3101, 0x3101, 0x3901, 0x3922, 0x3942, 0x4162, 0x4182, 0x4182, 0x4183, 0x4983, 0x51C3, 0x51E3, 0x5A04, 0x5A04, 0x5A04, 0x59E3, 0x59E3, 0x51E3, 0x51C3, 0x51E3, 0x51C3, 0x49A3, 0x4162, 0x3922, 0x3901, 0x3101, 0x3101, 0x3101, 0x3921, 0x3922, 0x4142, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4982, 0x51A3, 0x51C3, 0x49A3, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3922, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x30E1, 0x3101, 0x3921, 0x3901, 0x3901, 0x3922, 0x4142, 0x4983, 0x51C3, 0x51C3, 0x51E3, 0x59E4, 0x5A04, 0x5A24, 0x6224, 0x6224, 0x5A24, 0x5A04, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x4162, 0x3942, 0x3921, 0x3101, 0x3101, 0x3101, 0x3901, 0x3922, 0x4142, 0x4982, 0x4983, 0x4983, 0x4162, 0x4142, 0x3922, 0x3922, 0x3942, 0x4983, 0x49A3, 0x4983, 0x4162, 0x4142, 0x4142, 0x4142, 0x3942, 0x3101, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x3101, 0x3922, 0x3922, 0x3922, 0x3921, 0x3922, 0x4142, 0x49A3, 0x51E3, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6224, 0x6224, 0x6224, 0x6224, 0x5A04, 0x51C3, 0x4982, 0x4982, 0x4982, 0x4162, 0x4142, 0x3922, 0x3901, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3102, 0x28C1, 0x28E1, 0x3922, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3922, 0x28E1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x3101, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51E3, 0x59E4, 0x5A04, 0x5A04, 0x5A24, 0x6224, 0x6224, 0x6224, 0x5A04, 0x51C3, 0x4982, 0x4982, 0x4162, 0x4162, 0x3922, 0x3921, 0x3101, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x49A3, 0x51C3, 0x59C3, 0x51C3, 0x4983, 0x3922, 0x20C1, 0x1881, 0x1881, 0x28E1, 0x3922, 0x3922, 0x3922, 0x3942, 0x4142, 0x3942, 0x3101, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x30E1, 0x3921, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3942, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51E3, 0x59E4, 0x5A04, 0x5A24, 0x5A24, 0x5A04, 0x51E3, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x3922, 0x3901, 0x3101, 0x3101, 0x3901, 0x3101, 0x3922, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x51C3, 0x4162, 0x28E1, 0x1060, 0x0820, 0x0840, 0x1881, 0x28C1, 0x3101, 0x3922, 0x3942, 0x3942, 0x3922, 0x30E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x20C1, 0x30E1, 0x3101, 0x3922, 0x3922, 0x3922, 0x3942, 0x3942, 0x3942, 0x3942, 0x4142, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51E3, 0x59E4, 0x59E4, 0x59E4, 0x51E3, 0x51C3, 0x4983, 0x4142, 0x3922, 0x3901, 0x3901, 0x3921, 0x3922, 0x3921, 0x3922, 0x4162, 0x49A3, 0x51E3, 0x59E3, 0x49A3, 0x3942, 0x18A1, 0x0820, 0x0000, 0x0020, 0x1040, 0x1881, 0x28C1, 0x3101, 0x3922, 0x3942, 0x3922, 0x28E1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1080, 0x20A1, 0x28E1, 0x3101, 0x3102, 0x3122, 0x3922, 0x3942, 0x4142, 0x4142, 0x3942, 0x3942, 0x3922, 0x3942, 0x4142, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x3921, 0x3901, 0x3922, 0x3922, 0x3942, 0x3922, 0x3922, 0x4142, 0x4983, 0x51E3, 0x51E4, 0x49C3, 0x3122, 0x1881, 0x0820, 0x0000, 0x0000, 0x0820, 0x1040, 0x1880, 0x28C1, 0x3101, 0x3922, 0x3922, 0x28E1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1880, 0x20A1, 0x28E1, 0x28E1, 0x3101, 0x3122, 0x4142, 0x4162, 0x4162, 0x4142, 0x3942, 0x3922, 0x3922, 0x3922, 0x3942, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x3942, 0x3922, 0x3921, 0x3922, 0x3942, 0x4142, 0x4142, 0x4142, 0x3942, 0x4142, 0x4982, 0x51E3, 0x5A04, 0x51C4, 0x3942, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1880, 0x28C1, 0x30E1, 0x3101, 0x28C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1880, 0x20A1, 0x20C1, 0x28E1, 0x3122, 0x4162, 0x49A3, 0x49A3, 0x4162, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x4162, 0x49A3, 0x51E3, 0x51E4, 0x51C3, 0x4162, 0x3942, 0x3922, 0x3921, 0x3922, 0x3942, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4982, 0x51E3, 0x5A04, 0x51E4, 0x4183, 0x28E2, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x28E1, 0x3102, 0x3942, 0x49A3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x4142, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51E3, 0x51E3, 0x49A3, 0x4162, 0x3922, 0x3922, 0x3922, 0x3922, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x51C3, 0x5A04, 0x59E4, 0x49A3, 0x3122, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1880, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x18A1, 0x28E1, 0x3102, 0x3122, 0x3942, 0x4983, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4142, 0x3922, 0x3922, 0x3922, 0x4142, 0x4983, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4142, 0x3942, 0x3942, 0x3942, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x4183, 0x3122, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1860, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3102, 0x3102, 0x3102, 0x3102, 0x3942, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x3922, 0x3922, 0x3942, 0x4162, 0x4983, 0x49A3, 0x4983, 0x4182, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4983, 0x49A3, 0x49A3, 0x4183, 0x3922, 0x28E1, 0x18A1, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820, 0x0840, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20A1, 0x28E1, 0x3102, 0x3122, 0x3942, 0x3942, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4982, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x4983, 0x4182, 0x3922, 0x28C1, 0x1881, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x18A1, 0x1881, 0x1060, 0x1040, 0x1860, 0x20C1, 0x3101, 0x3102, 0x3922, 0x3922, 0x3922, 0x3922, 0x4162, 0x49A3, 0x51E4, 0x5A04, 0x5A04, 0x51E3, 0x51C3, 0x4983, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4962, 0x4982, 0x4142, 0x3101, 0x1881, 0x1040, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1040, 0x0840, 0x0820, 0x0820, 0x1060, 0x20C1, 0x3102, 0x3922, 0x3922, 0x3922, 0x3921, 0x3922, 0x4162, 0x51C3, 0x5A04, 0x6224, 0x5A04, 0x59E4, 0x51C3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4142, 0x3922, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x3942, 0x3942, 0x3922, 0x3921, 0x3922, 0x4162, 0x51E3, 0x5A04, 0x5A24, 0x5A04, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x4982, 0x4983, 0x4182, 0x4162, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x3942, 0x3121, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3122, 0x4162, 0x4142, 0x3942, 0x3922, 0x3922, 0x4162, 0x51C3, 0x5A04, 0x59E4, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x3942, 0x3942, 0x3942, 0x4142, 0x4142, 0x4142, 0x3942, 0x3101, 0x28C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3122, 0x4163, 0x4162, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x51A3, 0x51C3, 0x49A3, 0x4162, 0x4142, 0x4142, 0x4162, 0x4182, 0x4982, 0x4983, 0x4162, 0x3922, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3922, 0x4163, 0x4162, 0x3942, 0x3922, 0x3922, 0x3942, 0x4163, 0x4983, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51A3, 0x4162, 0x3122, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3122, 0x4162, 0x4142, 0x3922, 0x28E1, 0x28E1, 0x28E1, 0x2902, 0x3942, 0x4163, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x51C3, 0x59E4, 0x5A04, 0x59E3, 0x49A3, 0x4142, 0x30E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3122, 0x3942, 0x3922, 0x28E1, 0x18A1, 0x1060, 0x1060, 0x1881, 0x28E1, 0x3942, 0x4163, 0x4983, 0x4983, 0x4983, 0x4983, 0x4163, 0x4162, 0x3942, 0x3962, 0x4183, 0x49C3, 0x51E4, 0x5A04, 0x5A04, 0x51C3, 0x4163, 0x3102, 0x20C1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20C1, 0x3102, 0x3122, 0x28E1, 0x1880, 0x0840, 0x0020, 0x0020, 0x0840, 0x1881, 0x28E2, 0x3942, 0x4163, 0x4983, 0x4983, 0x4163, 0x3942, 0x3102, 0x20C1, 0x20C1, 0x2902, 0x3962, 0x49A3, 0x51E4, 0x51E4, 0x49A3, 0x3942, 0x28C1, 0x1881, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x28E2, 0x28E1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3922, 0x4142, 0x4142, 0x3922, 0x28E1, 0x18A1, 0x1060, 0x1040, 0x1881, 0x28E1, 0x3942, 0x4183, 0x49A3, 0x4183, 0x3122, 0x18A1, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x18A1, 0x20C1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x28E2, 0x28E2, 0x20C1, 0x1881, 0x0840, 0x0820, 0x0820, 0x1060, 0x18A1, 0x28C1, 0x3102, 0x3122, 0x3142, 0x28E2, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1881, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x1881, 0x1060, 0x0820, 0x0020, 0x0020, 0x0840, 0x1060, 0x1880, 0x1880, 0x1881, 0x18A1, 0x20C1, 0x18A1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1040, 0x0840, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1060, 0x1040, 0x0820, 0x0840, 0x1040, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0000, 0x0820, 0x1040, 0x1880, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1040, 0x1040, 0x0840, 0x0820, 0x0820, 0x0840, 0x1060, 0x1060, 0x1040, 0x0840, 0x1040, 0x1060, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x1040, 0x1880, 0x1881, 0x1880, 0x1060, 0x1060, 0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x0820, 0x1040, 0x1060, 0x1880, 0x1860, 0x1060, 0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x1040, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_BIG_1_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 3, 0, 8, 2, 17, 8, 33, 19, 53, 36,
+  80, 58, 116, 87, 155, 121, 199, 162, 245, 205, 292, 249, 339, 293, 386, 337,
+  432, 380, 479, 424, 528, 470, 580, 519, 633, 569, 688, 621, 744, 674, 800, 727,
+  858, 782, 916, 837, 975, 893, 1034, 949, 1093, 1005, 1153, 1062, 1213, 1119, 1272, 1175,
+  1331, 1231, 1389, 1286, 1447, 1341, 1506, 1397, 1564, 1452, 1623, 1506, 1678, 1558, 1732, 1609,
+  1787, 1661, 1843, 1714, 1899, 1767, 1953, 1818, 1997, 1859, 2038, 1895, 2076, 1930, 2113, 1964,
+  2151, 1999, 2188, 2033, 2225, 2067, 2263, 2102, 2299, 2133, 2334, 2165, 2368, 2196, 2402, 2227,
+  2435, 2257, 2465, 2284, 2493, 2307, 2518, 2327, 2534, 2338, 2542, 2343, 2543, 2343, 2544, 2343
 };
 
-const uint8_t SPRITE_DIRT_BIG_1_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x06, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0D, 0x14, 0x12, 0x0A, 0x04, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x1E, 0x28, 0x26, 0x18, 0x0C, 0x06, 0x03, 0x02, 0x03, 0x05, 0x09, 0x08, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x35, 0x45, 0x3D, 0x28, 0x16, 0x0E, 0x09, 0x07, 0x09, 0x0E, 0x15, 0x16, 0x11, 0x0B, 0x07, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x2A, 0x4C, 0x60, 0x51, 0x33, 0x1D, 0x12, 0x10, 0x10, 0x14, 0x1D, 0x26, 0x28, 0x22, 0x1B, 0x15, 0x0F, 0x0A, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x12, 0x11, 0x0A, 0x04, 0x04, 0x06, 0x05, 0x03, 0x01, 0x00, 0x00, 0x09, 0x1D, 0x3F, 0x64, 0x71, 0x5C, 0x36, 0x1B, 0x10, 0x11, 0x16, 0x20, 0x2C, 0x36, 0x39, 0x34, 0x2E, 0x29, 0x22, 0x1A, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x18, 0x21, 0x1F, 0x13, 0x0B, 0x0E, 0x14, 0x15, 0x11, 0x09, 0x03, 0x04, 0x11, 0x2D, 0x55, 0x76, 0x7C, 0x61, 0x38, 0x19, 0x0D, 0x0C, 0x16, 0x25, 0x36, 0x41, 0x43, 0x41, 0x3D, 0x3A, 0x35, 0x2C, 0x1D, 0x0E, 0x05, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x12, 0x22, 0x2A, 0x27, 0x18, 0x13, 0x1C, 0x2B, 0x2F, 0x29, 0x1C, 0x12, 0x11, 0x1F, 0x3F, 0x67, 0x82, 0x82, 0x67, 0x40, 0x1E, 0x0B, 0x0A, 0x15, 0x28, 0x3B, 0x46, 0x49, 0x46, 0x42, 0x40, 0x3E, 0x36, 0x28, 0x18, 0x0D, 0x09, 0x09, 0x07, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x16, 0x24, 0x29, 0x24, 0x17, 0x16, 0x28, 0x44, 0x52, 0x4D, 0x3C, 0x2C, 0x29, 0x36, 0x57, 0x78, 0x89, 0x86, 0x71, 0x4E, 0x29, 0x12, 0x12, 0x20, 0x37, 0x48, 0x4F, 0x4D, 0x43, 0x3D, 0x3C, 0x3A, 0x35, 0x2D, 0x25, 0x1D, 0x18, 0x15, 0x11, 0x0B, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x14, 0x1D, 0x1E, 0x17, 0x10, 0x15, 0x2F, 0x54, 0x6A, 0x6B, 0x61, 0x52, 0x4B, 0x56, 0x6F, 0x84, 0x8D, 0x89, 0x79, 0x5C, 0x39, 0x24, 0x26, 0x36, 0x50, 0x5F, 0x61, 0x54, 0x3D, 0x2F, 0x2C, 0x2C, 0x2B, 0x2C, 0x2F, 0x2D, 0x2A, 0x24, 0x1C, 0x12, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0D, 0x12, 0x16, 0x14, 0x13, 0x1B, 0x36, 0x5C, 0x76, 0x7D, 0x7B, 0x71, 0x6D, 0x74, 0x83, 0x8E, 0x90, 0x8C, 0x81, 0x6C, 0x51, 0x41, 0x46, 0x58, 0x6E, 0x77, 0x72, 0x5A, 0x39, 0x23, 0x1B, 0x1C, 0x1E, 0x26, 0x2F, 0x32, 0x31, 0x2D, 0x24, 0x16, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x13, 0x1A, 0x1F, 0x22, 0x2C, 0x41, 0x60, 0x77, 0x83, 0x84, 0x83, 0x83, 0x88, 0x8F, 0x91, 0x8E, 0x8C, 0x87, 0x7C, 0x6D, 0x65, 0x68, 0x74, 0x81, 0x84, 0x7A, 0x5E, 0x38, 0x1E, 0x14, 0x14, 0x15, 0x1B, 0x24, 0x2A, 0x2D, 0x2B, 0x25, 0x18, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x15, 0x22, 0x2D, 0x37, 0x3D, 0x43, 0x50, 0x64, 0x74, 0x7E, 0x82, 0x86, 0x8B, 0x91, 0x93, 0x90, 0x8D, 0x8C, 0x8A, 0x84, 0x7F, 0x7D, 0x7F, 0x84, 0x8A, 0x88, 0x7B, 0x60, 0x3B, 0x21, 0x16, 0x14, 0x14, 0x1B, 0x1F, 0x24, 0x26, 0x23, 0x20, 0x17, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x18, 0x2A, 0x3C, 0x47, 0x4B, 0x4C, 0x4E, 0x54, 0x62, 0x6B, 0x70, 0x74, 0x7C, 0x86, 0x8F, 0x90, 0x8E, 0x8B, 0x88, 0x85, 0x80, 0x81, 0x84, 0x88, 0x8A, 0x88, 0x85, 0x78, 0x60, 0x3F, 0x28, 0x1C, 0x1B, 0x1D, 0x27, 0x2E, 0x32, 0x2D, 0x21, 0x1B, 0x15, 0x0D, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x19, 0x2F, 0x45, 0x52, 0x56, 0x50, 0x4B, 0x49, 0x4D, 0x57, 0x5E, 0x5E, 0x5D, 0x67, 0x76, 0x83, 0x89, 0x8A, 0x86, 0x7E, 0x75, 0x71, 0x74, 0x7E, 0x85, 0x86, 0x7F, 0x77, 0x6E, 0x5C, 0x42, 0x2E, 0x25, 0x27, 0x30, 0x40, 0x4C, 0x4D, 0x40, 0x29, 0x1B, 0x17, 0x14, 0x0D, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x14, 0x2D, 0x47, 0x57, 0x5E, 0x59, 0x4A, 0x3E, 0x38, 0x3D, 0x48, 0x51, 0x51, 0x4D, 0x51, 0x5F, 0x6F, 0x7B, 0x7F, 0x79, 0x6B, 0x5C, 0x57, 0x5C, 0x6C, 0x77, 0x78, 0x6E, 0x61, 0x5A, 0x52, 0x45, 0x38, 0x34, 0x3A, 0x4A, 0x5F, 0x69, 0x68, 0x54, 0x36, 0x23, 0x20, 0x23, 0x1E, 0x15, 0x0D, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x20, 0x3F, 0x55, 0x5F, 0x5F, 0x54, 0x42, 0x35, 0x30, 0x35, 0x41, 0x4C, 0x4E, 0x49, 0x46, 0x4B, 0x58, 0x67, 0x6C, 0x66, 0x56, 0x46, 0x43, 0x49, 0x5A, 0x65, 0x65, 0x59, 0x4C, 0x48, 0x48, 0x4A, 0x48, 0x49, 0x51, 0x61, 0x73, 0x7B, 0x77, 0x5E, 0x3E, 0x2F, 0x31, 0x38, 0x34, 0x2A, 0x1E, 0x13, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x29, 0x48, 0x5C, 0x64, 0x60, 0x55, 0x44, 0x37, 0x32, 0x37, 0x44, 0x51, 0x55, 0x4F, 0x45, 0x42, 0x47, 0x52, 0x59, 0x55, 0x47, 0x3B, 0x39, 0x41, 0x52, 0x5D, 0x5B, 0x4E, 0x42, 0x3F, 0x44, 0x4F, 0x58, 0x5E, 0x64, 0x6D, 0x7B, 0x81, 0x7B, 0x63, 0x48, 0x3D, 0x41, 0x49, 0x47, 0x3E, 0x32, 0x23, 0x12, 0x06, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x2F, 0x4C, 0x5D, 0x63, 0x62, 0x5B, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x59, 0x5E, 0x59, 0x4E, 0x43, 0x3E, 0x42, 0x48, 0x49, 0x42, 0x3A, 0x3A, 0x45, 0x57, 0x60, 0x5D, 0x4E, 0x42, 0x41, 0x4A, 0x5A, 0x69, 0x6E, 0x6D, 0x6F, 0x79, 0x80, 0x7B, 0x68, 0x52, 0x48, 0x4B, 0x53, 0x51, 0x49, 0x3F, 0x32, 0x1E, 0x0C, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x18, 0x34, 0x4E, 0x5E, 0x63, 0x63, 0x60, 0x5A, 0x54, 0x51, 0x54, 0x5A, 0x60, 0x62, 0x5F, 0x56, 0x49, 0x3E, 0x3A, 0x3D, 0x42, 0x43, 0x42, 0x46, 0x54, 0x66, 0x6E, 0x69, 0x59, 0x4E, 0x4E, 0x59, 0x6C, 0x78, 0x7A, 0x72, 0x6F, 0x76, 0x7E, 0x7B, 0x6C, 0x58, 0x4E, 0x4F, 0x56, 0x56, 0x4F, 0x46, 0x3B, 0x2A, 0x14, 0x07, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x20, 0x3D, 0x55, 0x62, 0x65, 0x63, 0x62, 0x5F, 0x5D, 0x5D, 0x5F, 0x61, 0x63, 0x63, 0x60, 0x59, 0x4C, 0x3E, 0x36, 0x37, 0x3C, 0x42, 0x48, 0x53, 0x63, 0x75, 0x7D, 0x7B, 0x6E, 0x63, 0x63, 0x6E, 0x7C, 0x84, 0x82, 0x7A, 0x76, 0x7A, 0x80, 0x7B, 0x6B, 0x58, 0x4F, 0x51, 0x58, 0x58, 0x51, 0x4A, 0x42, 0x34, 0x1E, 0x0C, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x2C, 0x4C, 0x61, 0x6B, 0x6A, 0x65, 0x61, 0x5E, 0x5D, 0x5F, 0x62, 0x63, 0x63, 0x62, 0x5F, 0x56, 0x49, 0x3C, 0x35, 0x34, 0x36, 0x3D, 0x46, 0x55, 0x68, 0x7B, 0x86, 0x86, 0x7F, 0x79, 0x79, 0x7F, 0x86, 0x89, 0x88, 0x84, 0x82, 0x83, 0x83, 0x79, 0x65, 0x54, 0x4D, 0x50, 0x58, 0x58, 0x51, 0x4B, 0x46, 0x3B, 0x28, 0x12, 0x05, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1B, 0x3A, 0x5C, 0x72, 0x78, 0x72, 0x6A, 0x62, 0x5C, 0x5A, 0x5E, 0x61, 0x63, 0x63, 0x62, 0x5E, 0x54, 0x46, 0x3B, 0x37, 0x35, 0x34, 0x36, 0x3E, 0x4F, 0x64, 0x79, 0x87, 0x8A, 0x89, 0x87, 0x87, 0x88, 0x89, 0x89, 0x88, 0x88, 0x89, 0x89, 0x84, 0x75, 0x5F, 0x4F, 0x49, 0x4E, 0x56, 0x57, 0x51, 0x4B, 0x48, 0x3F, 0x2E, 0x16, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x24, 0x48, 0x68, 0x7B, 0x81, 0x7C, 0x73, 0x69, 0x60, 0x5C, 0x5D, 0x61, 0x62, 0x62, 0x60, 0x5C, 0x53, 0x48, 0x3E, 0x3B, 0x3A, 0x37, 0x35, 0x3B, 0x4A, 0x61, 0x77, 0x86, 0x8B, 0x8C, 0x8B, 0x8B, 0x89, 0x86, 0x82, 0x82, 0x84, 0x88, 0x89, 0x83, 0x73, 0x5C, 0x4D, 0x48, 0x4D, 0x54, 0x55, 0x4F, 0x4A, 0x48, 0x41, 0x30, 0x18, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0F, 0x29, 0x4E, 0x69, 0x79, 0x7E, 0x80, 0x7E, 0x75, 0x6B, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5A, 0x55, 0x4D, 0x46, 0x43, 0x41, 0x3D, 0x3A, 0x3F, 0x4D, 0x64, 0x79, 0x86, 0x8B, 0x8C, 0x8C, 0x8A, 0x85, 0x7D, 0x76, 0x74, 0x77, 0x7F, 0x83, 0x7C, 0x6B, 0x56, 0x4A, 0x49, 0x4F, 0x53, 0x52, 0x4C, 0x49, 0x47, 0x3F, 0x2E, 0x16, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x29, 0x4A, 0x60, 0x6B, 0x71, 0x79, 0x7F, 0x7D, 0x75, 0x69, 0x61, 0x5D, 0x5C, 0x5B, 0x59, 0x58, 0x57, 0x54, 0x50, 0x4C, 0x49, 0x44, 0x42, 0x47, 0x56, 0x6C, 0x7E, 0x89, 0x8C, 0x8C, 0x8B, 0x87, 0x7E, 0x71, 0x66, 0x61, 0x66, 0x6F, 0x72, 0x6A, 0x59, 0x49, 0x44, 0x49, 0x52, 0x54, 0x50, 0x4B, 0x48, 0x45, 0x3B, 0x28, 0x12, 0x05, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x29, 0x47, 0x5A, 0x5C, 0x5D, 0x67, 0x75, 0x7A, 0x79, 0x6F, 0x66, 0x5F, 0x5A, 0x55, 0x53, 0x54, 0x56, 0x57, 0x55, 0x50, 0x4C, 0x48, 0x47, 0x4C, 0x5A, 0x6F, 0x81, 0x8A, 0x8C, 0x8C, 0x8A, 0x85, 0x79, 0x67, 0x59, 0x53, 0x57, 0x5C, 0x5A, 0x4E, 0x3C, 0x35, 0x39, 0x48, 0x54, 0x57, 0x51, 0x4B, 0x48, 0x41, 0x34, 0x1E, 0x0C, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x2E, 0x4F, 0x5E, 0x5C, 0x54, 0x56, 0x60, 0x6C, 0x73, 0x74, 0x6F, 0x66, 0x5D, 0x52, 0x4D, 0x4E, 0x54, 0x58, 0x56, 0x51, 0x4C, 0x49, 0x48, 0x4B, 0x57, 0x6C, 0x7F, 0x89, 0x8C, 0x8C, 0x8B, 0x84, 0x77, 0x63, 0x54, 0x4E, 0x4D, 0x4B, 0x41, 0x2E, 0x21, 0x20, 0x2D, 0x43, 0x52, 0x57, 0x51, 0x4B, 0x46, 0x3C, 0x2A, 0x14, 0x07, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x35, 0x5B, 0x6E, 0x6A, 0x59, 0x53, 0x55, 0x5A, 0x65, 0x6F, 0x71, 0x6E, 0x66, 0x58, 0x51, 0x52, 0x57, 0x5B, 0x59, 0x53, 0x4E, 0x4B, 0x4C, 0x4E, 0x58, 0x6A, 0x7D, 0x87, 0x89, 0x88, 0x88, 0x84, 0x79, 0x67, 0x58, 0x50, 0x4B, 0x3F, 0x2B, 0x18, 0x0F, 0x12, 0x22, 0x39, 0x4B, 0x53, 0x50, 0x49, 0x41, 0x34, 0x1F, 0x0D, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x38, 0x5B, 0x72, 0x73, 0x69, 0x60, 0x56, 0x53, 0x55, 0x5F, 0x68, 0x6C, 0x6B, 0x66, 0x60, 0x60, 0x64, 0x65, 0x61, 0x5A, 0x54, 0x53, 0x55, 0x5A, 0x64, 0x72, 0x7F, 0x83, 0x81, 0x7F, 0x81, 0x82, 0x7D, 0x71, 0x63, 0x5A, 0x4E, 0x39, 0x20, 0x0D, 0x05, 0x08, 0x15, 0x2A, 0x3F, 0x4A, 0x4B, 0x44, 0x39, 0x2A, 0x17, 0x08, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x15, 0x30, 0x4C, 0x61, 0x6B, 0x6B, 0x66, 0x5E, 0x57, 0x4F, 0x50, 0x54, 0x5E, 0x65, 0x6A, 0x6D, 0x71, 0x72, 0x6D, 0x65, 0x5E, 0x5D, 0x60, 0x66, 0x6E, 0x76, 0x7C, 0x7F, 0x7B, 0x74, 0x71, 0x74, 0x7A, 0x7D, 0x7A, 0x70, 0x67, 0x57, 0x3C, 0x1E, 0x0B, 0x02, 0x03, 0x0A, 0x18, 0x29, 0x38, 0x3D, 0x38, 0x2D, 0x20, 0x11, 0x06, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0B, 0x1D, 0x31, 0x42, 0x4F, 0x56, 0x5A, 0x5A, 0x59, 0x51, 0x4C, 0x4C, 0x50, 0x55, 0x62, 0x6E, 0x76, 0x75, 0x6B, 0x5E, 0x5A, 0x61, 0x6D, 0x78, 0x7F, 0x82, 0x80, 0x7A, 0x70, 0x69, 0x66, 0x69, 0x70, 0x78, 0x7B, 0x78, 0x71, 0x61, 0x47, 0x26, 0x0F, 0x03, 0x01, 0x03, 0x0A, 0x16, 0x24, 0x2A, 0x28, 0x21, 0x17, 0x0D, 0x06, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0B, 0x19, 0x27, 0x34, 0x3C, 0x43, 0x4A, 0x52, 0x54, 0x52, 0x4F, 0x4E, 0x4C, 0x55, 0x62, 0x6D, 0x6D, 0x62, 0x56, 0x56, 0x60, 0x74, 0x80, 0x84, 0x83, 0x7B, 0x71, 0x67, 0x63, 0x61, 0x63, 0x66, 0x6D, 0x73, 0x76, 0x75, 0x6A, 0x55, 0x35, 0x19, 0x08, 0x01, 0x00, 0x03, 0x0A, 0x14, 0x1C, 0x1C, 0x17, 0x10, 0x09, 0x04, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x1C, 0x2A, 0x33, 0x37, 0x3E, 0x4A, 0x55, 0x5A, 0x5B, 0x57, 0x52, 0x54, 0x5D, 0x67, 0x69, 0x61, 0x57, 0x57, 0x63, 0x75, 0x7D, 0x7F, 0x7C, 0x73, 0x69, 0x62, 0x60, 0x5F, 0x5F, 0x5E, 0x5F, 0x64, 0x6D, 0x73, 0x6D, 0x5C, 0x3F, 0x24, 0x0F, 0x04, 0x01, 0x01, 0x05, 0x0D, 0x16, 0x17, 0x11, 0x0A, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0F, 0x1E, 0x2C, 0x35, 0x37, 0x3C, 0x45, 0x50, 0x58, 0x5E, 0x63, 0x64, 0x63, 0x65, 0x6B, 0x6F, 0x69, 0x61, 0x63, 0x6A, 0x70, 0x6F, 0x6F, 0x6E, 0x6A, 0x64, 0x60, 0x5F, 0x5F, 0x5D, 0x58, 0x52, 0x54, 0x61, 0x6A, 0x67, 0x58, 0x3E, 0x28, 0x14, 0x08, 0x04, 0x03, 0x06, 0x0D, 0x15, 0x16, 0x11, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x18, 0x28, 0x32, 0x33, 0x32, 0x35, 0x3C, 0x46, 0x4D, 0x57, 0x66, 0x73, 0x76, 0x74, 0x70, 0x6C, 0x68, 0x68, 0x6E, 0x6E, 0x65, 0x5B, 0x59, 0x5C, 0x60, 0x61, 0x60, 0x5F, 0x5E, 0x5C, 0x55, 0x4D, 0x4F, 0x5C, 0x63, 0x5C, 0x49, 0x32, 0x21, 0x14, 0x0D, 0x0A, 0x0A, 0x0B, 0x0F, 0x15, 0x17, 0x12, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0E, 0x1E, 0x2A, 0x2D, 0x27, 0x22, 0x26, 0x2F, 0x3B, 0x45, 0x53, 0x68, 0x79, 0x7E, 0x79, 0x6B, 0x5F, 0x5D, 0x65, 0x6E, 0x6B, 0x5F, 0x52, 0x4E, 0x56, 0x5D, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x57, 0x52, 0x55, 0x61, 0x65, 0x55, 0x3A, 0x22, 0x15, 0x11, 0x0E, 0x0D, 0x0D, 0x0D, 0x0F, 0x12, 0x13, 0x0F, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0D, 0x1A, 0x22, 0x1F, 0x16, 0x12, 0x18, 0x26, 0x37, 0x46, 0x58, 0x6F, 0x7D, 0x7F, 0x74, 0x5E, 0x4E, 0x4D, 0x57, 0x66, 0x6A, 0x63, 0x58, 0x55, 0x5D, 0x64, 0x64, 0x61, 0x5F, 0x5F, 0x5F, 0x5E, 0x5F, 0x66, 0x6F, 0x6D, 0x56, 0x34, 0x1B, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x08, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0E, 0x12, 0x0F, 0x09, 0x08, 0x11, 0x24, 0x38, 0x4D, 0x62, 0x77, 0x81, 0x7F, 0x71, 0x58, 0x47, 0x45, 0x4E, 0x62, 0x6D, 0x6D, 0x69, 0x68, 0x6C, 0x6D, 0x69, 0x65, 0x62, 0x61, 0x62, 0x66, 0x6D, 0x76, 0x7D, 0x78, 0x5D, 0x37, 0x19, 0x09, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x04, 0x03, 0x04, 0x0E, 0x22, 0x39, 0x51, 0x68, 0x7B, 0x84, 0x81, 0x74, 0x5C, 0x4A, 0x47, 0x50, 0x61, 0x6C, 0x70, 0x71, 0x71, 0x71, 0x6F, 0x6D, 0x6B, 0x67, 0x66, 0x68, 0x6E, 0x75, 0x7C, 0x81, 0x7A, 0x5F, 0x38, 0x18, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x0B, 0x1F, 0x3A, 0x56, 0x6F, 0x7F, 0x87, 0x85, 0x79, 0x66, 0x57, 0x53, 0x59, 0x64, 0x6B, 0x6E, 0x6F, 0x6F, 0x6D, 0x6C, 0x70, 0x73, 0x71, 0x6F, 0x70, 0x71, 0x73, 0x77, 0x7A, 0x71, 0x56, 0x30, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x1F, 0x3D, 0x5A, 0x70, 0x7B, 0x80, 0x7E, 0x73, 0x67, 0x60, 0x60, 0x63, 0x68, 0x6B, 0x6B, 0x6C, 0x6B, 0x6A, 0x6C, 0x74, 0x7B, 0x7C, 0x79, 0x73, 0x6A, 0x66, 0x68, 0x69, 0x5E, 0x43, 0x22, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x22, 0x3F, 0x58, 0x67, 0x6B, 0x6D, 0x69, 0x5F, 0x5B, 0x5E, 0x65, 0x69, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6D, 0x74, 0x7B, 0x7F, 0x7C, 0x70, 0x60, 0x55, 0x54, 0x53, 0x48, 0x31, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x10, 0x27, 0x43, 0x53, 0x56, 0x51, 0x4D, 0x48, 0x40, 0x43, 0x51, 0x61, 0x69, 0x6B, 0x6B, 0x6B, 0x6B, 0x69, 0x67, 0x65, 0x69, 0x71, 0x78, 0x78, 0x6D, 0x5C, 0x4E, 0x47, 0x41, 0x36, 0x24, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x2D, 0x46, 0x51, 0x47, 0x34, 0x2B, 0x25, 0x20, 0x29, 0x3D, 0x55, 0x64, 0x69, 0x6B, 0x6B, 0x69, 0x64, 0x5B, 0x53, 0x53, 0x5A, 0x66, 0x6E, 0x6D, 0x63, 0x52, 0x41, 0x33, 0x27, 0x1A, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x30, 0x46, 0x4A, 0x3A, 0x20, 0x13, 0x0D, 0x0C, 0x13, 0x27, 0x41, 0x57, 0x63, 0x68, 0x68, 0x63, 0x57, 0x45, 0x36, 0x32, 0x39, 0x4B, 0x5D, 0x67, 0x65, 0x58, 0x41, 0x2A, 0x1B, 0x12, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x2D, 0x3D, 0x3A, 0x2A, 0x13, 0x06, 0x01, 0x02, 0x07, 0x14, 0x29, 0x41, 0x53, 0x5B, 0x5B, 0x53, 0x41, 0x2A, 0x1C, 0x1A, 0x22, 0x31, 0x46, 0x58, 0x5C, 0x54, 0x40, 0x24, 0x12, 0x0A, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x23, 0x2D, 0x2B, 0x1D, 0x0D, 0x04, 0x00, 0x00, 0x02, 0x07, 0x14, 0x26, 0x38, 0x43, 0x43, 0x38, 0x26, 0x14, 0x0D, 0x0E, 0x16, 0x22, 0x2F, 0x3E, 0x47, 0x45, 0x37, 0x1F, 0x0C, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x15, 0x1E, 0x1F, 0x17, 0x0E, 0x07, 0x03, 0x02, 0x01, 0x02, 0x07, 0x10, 0x1C, 0x23, 0x23, 0x1C, 0x11, 0x08, 0x08, 0x0E, 0x16, 0x1C, 0x1D, 0x21, 0x27, 0x2B, 0x25, 0x16, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x0F, 0x11, 0x11, 0x0F, 0x0B, 0x08, 0x06, 0x03, 0x02, 0x02, 0x05, 0x0B, 0x0E, 0x0F, 0x0C, 0x06, 0x05, 0x0B, 0x14, 0x19, 0x17, 0x10, 0x0D, 0x11, 0x17, 0x17, 0x10, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x07, 0x09, 0x0C, 0x0D, 0x0E, 0x0D, 0x09, 0x06, 0x05, 0x04, 0x06, 0x09, 0x0A, 0x07, 0x06, 0x08, 0x11, 0x18, 0x18, 0x11, 0x08, 0x03, 0x06, 0x0E, 0x14, 0x13, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x06, 0x0A, 0x0F, 0x11, 0x10, 0x0D, 0x0B, 0x0A, 0x0C, 0x0F, 0x10, 0x0E, 0x0D, 0x10, 0x17, 0x19, 0x14, 0x0B, 0x03, 0x01, 0x06, 0x10, 0x1B, 0x1B, 0x10, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0D, 0x0F, 0x0F, 0x0E, 0x0E, 0x11, 0x16, 0x19, 0x17, 0x16, 0x17, 0x19, 0x16, 0x0E, 0x06, 0x01, 0x01, 0x05, 0x10, 0x1B, 0x1B, 0x10, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x08, 0x0A, 0x0A, 0x0B, 0x0F, 0x15, 0x18, 0x18, 0x17, 0x17, 0x15, 0x0E, 0x07, 0x02, 0x00, 0x00, 0x03, 0x09, 0x10, 0x10, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x07, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x0C, 0x07, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_BIG_1_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0x1D, 0x81, 0x01, 0x01, 0xC0, 0x1B, 0x85, 0x01, 0x04, 0x06, 0x05, 0x02, 0x01, 0xC0, 0x1B, 0x86, 0x05, 0x0D, 0x14, 0x12, 0x0A,
+  0x04, 0x02, 0x02, 0x83, 0x01, 0x02, 0x02, 0x01, 0xC0, 0x1A, 0x90, 0x02, 0x0C, 0x1E, 0x28, 0x26, 0x18, 0x0C, 0x06, 0x03, 0x02, 0x03, 0x05, 0x09,
+  0x08, 0x05, 0x03, 0x01, 0xC0, 0x0E, 0x81, 0x01, 0x01, 0x09, 0x93, 0x07, 0x19, 0x35, 0x45, 0x3D, 0x28, 0x16, 0x0E, 0x09, 0x07, 0x09, 0x0E, 0x15,
+  0x16, 0x11, 0x0B, 0x07, 0x04, 0x02, 0x01, 0xC0, 0x0C, 0x85, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0x00, 0x80, 0x01, 0x04, 0x95, 0x03, 0x11, 0x2A,
+  0x4C, 0x60, 0x51, 0x33, 0x1D, 0x12, 0x10, 0x10, 0x14, 0x1D, 0x26, 0x28, 0x22, 0x1B, 0x15, 0x0F, 0x0A, 0x05, 0x02, 0xC0, 0x0C, 0x8A, 0x04, 0x0B,
+  0x12, 0x11, 0x0A, 0x04, 0x04, 0x06, 0x05, 0x03, 0x01, 0x01, 0x96, 0x09, 0x1D, 0x3F, 0x64, 0x71, 0x5C, 0x36, 0x1B, 0x10, 0x11, 0x16, 0x20, 0x2C,
+  0x36, 0x39, 0x34, 0x2E, 0x29, 0x22, 0x1A, 0x0F, 0x07, 0x01, 0xC0, 0x0B, 0xA8, 0x02, 0x0A, 0x18, 0x21, 0x1F, 0x13, 0x0B, 0x0E, 0x14, 0x15, 0x11,
+  0x09, 0x03, 0x04, 0x11, 0x2D, 0x55, 0x76, 0x7C, 0x61, 0x38, 0x19, 0x0D, 0x0C, 0x16, 0x25, 0x36, 0x41, 0x43, 0x41, 0x3D, 0x3A, 0x35, 0x2C, 0x1D,
+  0x0E, 0x05, 0x02, 0x02, 0x02, 0x01, 0xC0, 0x0A, 0xAA, 0x01, 0x06, 0x12, 0x22, 0x2A, 0x27, 0x18, 0x13, 0x1C, 0x2B, 0x2F, 0x29, 0x1C, 0x12, 0x11,
+  0x1F, 0x3F, 0x67, 0x82, 0x82, 0x67, 0x40, 0x1E, 0x0B, 0x0A, 0x15, 0x28, 0x3B, 0x46, 0x49, 0x46, 0x42, 0x40, 0x3E, 0x36, 0x28, 0x18, 0x0D, 0x09,
+  0x09, 0x07, 0x05, 0x01, 0xC0, 0x0A, 0xAB, 0x03, 0x09, 0x16, 0x24, 0x29, 0x24, 0x17, 0x16, 0x28, 0x44, 0x52, 0x4D, 0x3C, 0x2C, 0x29, 0x36, 0x57,
+  0x78, 0x89, 0x86, 0x71, 0x4E, 0x29, 0x12, 0x12, 0x20, 0x37, 0x48, 0x4F, 0x4D, 0x43, 0x3D, 0x3C, 0x3A, 0x35, 0x2D, 0x25, 0x1D, 0x18, 0x15, 0x11,
+  0x0B, 0x04, 0x01, 0xC0, 0x0A, 0xAB, 0x03, 0x09, 0x14, 0x1D, 0x1E, 0x17, 0x10, 0x15, 0x2F, 0x54, 0x6A, 0x6B, 0x61, 0x52, 0x4B, 0x56, 0x6F, 0x84,
+  0x8D, 0x89, 0x79, 0x5C, 0x39, 0x24, 0x26, 0x36, 0x50, 0x5F, 0x61, 0x54, 0x3D, 0x2F, 0x2C, 0x2C, 0x2B, 0x2C, 0x2F, 0x2D, 0x2A, 0x24, 0x1C, 0x12,
+  0x08, 0x02, 0xC0, 0x0A, 0xAB, 0x01, 0x05, 0x0D, 0x12, 0x16, 0x14, 0x13, 0x1B, 0x36, 0x5C, 0x76, 0x7D, 0x7B, 0x71, 0x6D, 0x74, 0x83, 0x8E, 0x90,
+  0x8C, 0x81, 0x6C, 0x51, 0x41, 0x46, 0x58, 0x6E, 0x77, 0x72, 0x5A, 0x39, 0x23, 0x1B, 0x1C, 0x1E, 0x26, 0x2F, 0x32, 0x31, 0x2D, 0x24, 0x16, 0x0A,
+  0x03, 0xC0, 0x0B, 0xAA, 0x04, 0x0C, 0x13, 0x1A, 0x1F, 0x22, 0x2C, 0x41, 0x60, 0x77, 0x83, 0x84, 0x83, 0x83, 0x88, 0x8F, 0x91, 0x8E, 0x8C, 0x87,
+  0x7C, 0x6D, 0x65, 0x68, 0x74, 0x81, 0x84, 0x7A, 0x5E, 0x38, 0x1E, 0x14, 0x14, 0x15, 0x1B, 0x24, 0x2A, 0x2D, 0x2B, 0x25, 0x18, 0x0B, 0x02, 0xC0,
+  0x0A, 0xAB, 0x02, 0x09, 0x15, 0x22, 0x2D, 0x37, 0x3D, 0x43, 0x50, 0x64, 0x74, 0x7E, 0x82, 0x86, 0x8B, 0x91, 0x93, 0x90, 0x8D, 0x8C, 0x8A, 0x84,
+  0x7F, 0x7D, 0x7F, 0x84, 0x8A, 0x88, 0x7B, 0x60, 0x3B, 0x21, 0x16, 0x14, 0x14, 0x1B, 0x1F, 0x24, 0x26, 0x23, 0x20, 0x17, 0x0C, 0x03, 0xC0, 0x09,
+  0xAD, 0x03, 0x0A, 0x18, 0x2A, 0x3C, 0x47, 0x4B, 0x4C, 0x4E, 0x54, 0x62, 0x6B, 0x70, 0x74, 0x7C, 0x86, 0x8F, 0x90, 0x8E, 0x8B, 0x88, 0x85, 0x80,
+  0x81, 0x84, 0x88, 0x8A, 0x88, 0x85, 0x78, 0x60, 0x3F, 0x28, 0x1C, 0x1B, 0x1D, 0x27, 0x2E, 0x32, 0x2D, 0x21, 0x1B, 0x15, 0x0D, 0x05, 0x01, 0xC0,
+  0x08, 0xB0, 0x01, 0x09, 0x19, 0x2F, 0x45, 0x52, 0x56, 0x50, 0x4B, 0x49, 0x4D, 0x57, 0x5E, 0x5E, 0x5D, 0x67, 0x76, 0x83, 0x89, 0x8A, 0x86, 0x7E,
+  0x75, 0x71, 0x74, 0x7E, 0x85, 0x86, 0x7F, 0x77, 0x6E, 0x5C, 0x42, 0x2E, 0x25, 0x27, 0x30, 0x40, 0x4C, 0x4D, 0x40, 0x29, 0x1B, 0x17, 0x14, 0x0D,
+  0x06, 0x03, 0x01, 0xC0, 0x08, 0xB1, 0x05, 0x14, 0x2D, 0x47, 0x57, 0x5E, 0x59, 0x4A, 0x3E, 0x38, 0x3D, 0x48, 0x51, 0x51, 0x4D, 0x51, 0x5F, 0x6F,
+  0x7B, 0x7F, 0x79, 0x6B, 0x5C, 0x57, 0x5C, 0x6C, 0x77, 0x78, 0x6E, 0x61, 0x5A, 0x52, 0x45, 0x38, 0x34, 0x3A, 0x4A, 0x5F, 0x69, 0x68, 0x54, 0x36,
+  0x23, 0x20, 0x23, 0x1E, 0x15, 0x0D, 0x07, 0x02, 0xC0, 0x07, 0xB3, 0x02, 0x0C, 0x20, 0x3F, 0x55, 0x5F, 0x5F, 0x54, 0x42, 0x35, 0x30, 0x35, 0x41,
+  0x4C, 0x4E, 0x49, 0x46, 0x4B, 0x58, 0x67, 0x6C, 0x66, 0x56, 0x46, 0x43, 0x49, 0x5A, 0x65, 0x65, 0x59, 0x4C, 0x48, 0x48, 0x4A, 0x48, 0x49, 0x51,
+  0x61, 0x73, 0x7B, 0x77, 0x5E, 0x3E, 0x2F, 0x31, 0x38, 0x34, 0x2A, 0x1E, 0x13, 0x08, 0x02, 0xC0, 0x07, 0xB4, 0x03, 0x11, 0x29, 0x48, 0x5C, 0x64,
+  0x60, 0x55, 0x44, 0x37, 0x32, 0x37, 0x44, 0x51, 0x55, 0x4F, 0x45, 0x42, 0x47, 0x52, 0x59, 0x55, 0x47, 0x3B, 0x39, 0x41, 0x52, 0x5D, 0x5B, 0x4E,
+  0x42, 0x3F, 0x44, 0x4F, 0x58, 0x5E, 0x64, 0x6D, 0x7B, 0x81, 0x7B, 0x63, 0x48, 0x3D, 0x41, 0x49, 0x47, 0x3E, 0x32, 0x23, 0x12, 0x06, 0x01, 0xC0,
+  0x07, 0xB4, 0x05, 0x15, 0x2F, 0x4C, 0x5D, 0x63, 0x62, 0x5B, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x59, 0x5E, 0x59, 0x4E, 0x43, 0x3E, 0x42, 0x48, 0x49,
+  0x42, 0x3A, 0x3A, 0x45, 0x57, 0x60, 0x5D, 0x4E, 0x42, 0x41, 0x4A, 0x5A, 0x69, 0x6E, 0x6D, 0x6F, 0x79, 0x80, 0x7B, 0x68, 0x52, 0x48, 0x4B, 0x53,
+  0x51, 0x49, 0x3F, 0x32, 0x1E, 0x0C, 0x03, 0xC0, 0x06, 0xB6, 0x01, 0x07, 0x18, 0x34, 0x4E, 0x5E, 0x63, 0x63, 0x60, 0x5A, 0x54, 0x51, 0x54, 0x5A,
+  0x60, 0x62, 0x5F, 0x56, 0x49, 0x3E, 0x3A, 0x3D, 0x42, 0x43, 0x42, 0x46, 0x54, 0x66, 0x6E, 0x69, 0x59, 0x4E, 0x4E, 0x59, 0x6C, 0x78, 0x7A, 0x72,
+  0x6F, 0x76, 0x7E, 0x7B, 0x6C, 0x58, 0x4E, 0x4F, 0x56, 0x56, 0x4F, 0x46, 0x3B, 0x2A, 0x14, 0x07, 0x01, 0xC0, 0x06, 0xB6, 0x03, 0x0C, 0x20, 0x3D,
+  0x55, 0x62, 0x65, 0x63, 0x62, 0x5F, 0x5D, 0x5D, 0x5F, 0x61, 0x63, 0x63, 0x60, 0x59, 0x4C, 0x3E, 0x36, 0x37, 0x3C, 0x42, 0x48, 0x53, 0x63, 0x75,
+  0x7D, 0x7B, 0x6E, 0x63, 0x63, 0x6E, 0x7C, 0x84, 0x82, 0x7A, 0x76, 0x7A, 0x80, 0x7B, 0x6B, 0x58, 0x4F, 0x51, 0x58, 0x58, 0x51, 0x4A, 0x42, 0x34,
+  0x1E, 0x0C, 0x03, 0xC0, 0x06, 0xB7, 0x04, 0x13, 0x2C, 0x4C, 0x61, 0x6B, 0x6A, 0x65, 0x61, 0x5E, 0x5D, 0x5F, 0x62, 0x63, 0x63, 0x62, 0x5F, 0x56,
+  0x49, 0x3C, 0x35, 0x34, 0x36, 0x3D, 0x46, 0x55, 0x68, 0x7B, 0x86, 0x86, 0x7F, 0x79, 0x79, 0x7F, 0x86, 0x89, 0x88, 0x84, 0x82, 0x83, 0x83, 0x79,
+  0x65, 0x54, 0x4D, 0x50, 0x58, 0x58, 0x51, 0x4B, 0x46, 0x3B, 0x28, 0x12, 0x05, 0x01, 0xC0, 0x06, 0xB7, 0x08, 0x1B, 0x3A, 0x5C, 0x72, 0x78, 0x72,
+  0x6A, 0x62, 0x5C, 0x5A, 0x5E, 0x61, 0x63, 0x63, 0x62, 0x5E, 0x54, 0x46, 0x3B, 0x37, 0x35, 0x34, 0x36, 0x3E, 0x4F, 0x64, 0x79, 0x87, 0x8A, 0x89,
+  0x87, 0x87, 0x88, 0x89, 0x89, 0x88, 0x88, 0x89, 0x89, 0x84, 0x75, 0x5F, 0x4F, 0x49, 0x4E, 0x56, 0x57, 0x51, 0x4B, 0x48, 0x3F, 0x2E, 0x16, 0x07,
+  0x01, 0xC0, 0x06, 0xB7, 0x0C, 0x24, 0x48, 0x68, 0x7B, 0x81, 0x7C, 0x73, 0x69, 0x60, 0x5C, 0x5D, 0x61, 0x62, 0x62, 0x60, 0x5C, 0x53, 0x48, 0x3E,
+  0x3B, 0x3A, 0x37, 0x35, 0x3B, 0x4A, 0x61, 0x77, 0x86, 0x8B, 0x8C, 0x8B, 0x8B, 0x89, 0x86, 0x82, 0x82, 0x84, 0x88, 0x89, 0x83, 0x73, 0x5C, 0x4D,
+  0x48, 0x4D, 0x54, 0x55, 0x4F, 0x4A, 0x48, 0x41, 0x30, 0x18, 0x07, 0x01, 0xC0, 0x05, 0xB8, 0x02, 0x0F, 0x29, 0x4E, 0x69, 0x79, 0x7E, 0x80, 0x7E,
+  0x75, 0x6B, 0x62, 0x5F, 0x5F, 0x5F, 0x5F, 0x5D, 0x5A, 0x55, 0x4D, 0x46, 0x43, 0x41, 0x3D, 0x3A, 0x3F, 0x4D, 0x64, 0x79, 0x86, 0x8B, 0x8C, 0x8C,
+  0x8A, 0x85, 0x7D, 0x76, 0x74, 0x77, 0x7F, 0x83, 0x7C, 0x6B, 0x56, 0x4A, 0x49, 0x4F, 0x53, 0x52, 0x4C, 0x49, 0x47, 0x3F, 0x2E, 0x16, 0x07, 0x01,
+  0xC0, 0x05, 0xB8, 0x02, 0x10, 0x29, 0x4A, 0x60, 0x6B, 0x71, 0x79, 0x7F, 0x7D, 0x75, 0x69, 0x61, 0x5D, 0x5C, 0x5B, 0x59, 0x58, 0x57, 0x54, 0x50,
+  0x4C, 0x49, 0x44, 0x42, 0x47, 0x56, 0x6C, 0x7E, 0x89, 0x8C, 0x8C, 0x8B, 0x87, 0x7E, 0x71, 0x66, 0x61, 0x66, 0x6F, 0x72, 0x6A, 0x59, 0x49, 0x44,
+  0x49, 0x52, 0x54, 0x50, 0x4B, 0x48, 0x45, 0x3B, 0x28, 0x12, 0x05, 0x01, 0xC0, 0x05, 0xB7, 0x02, 0x10, 0x29, 0x47, 0x5A, 0x5C, 0x5D, 0x67, 0x75,
+  0x7A, 0x79, 0x6F, 0x66, 0x5F, 0x5A, 0x55, 0x53, 0x54, 0x56, 0x57, 0x55, 0x50, 0x4C, 0x48, 0x47, 0x4C, 0x5A, 0x6F, 0x81, 0x8A, 0x8C, 0x8C, 0x8A,
+  0x85, 0x79, 0x67, 0x59, 0x53, 0x57, 0x5C, 0x5A, 0x4E, 0x3C, 0x35, 0x39, 0x48, 0x54, 0x57, 0x51, 0x4B, 0x48, 0x41, 0x34, 0x1E, 0x0C, 0x03, 0xC0,
+  0x05, 0xB7, 0x03, 0x11, 0x2E, 0x4F, 0x5E, 0x5C, 0x54, 0x56, 0x60, 0x6C, 0x73, 0x74, 0x6F, 0x66, 0x5D, 0x52, 0x4D, 0x4E, 0x54, 0x58, 0x56, 0x51,
+  0x4C, 0x49, 0x48, 0x4B, 0x57, 0x6C, 0x7F, 0x89, 0x8C, 0x8C, 0x8B, 0x84, 0x77, 0x63, 0x54, 0x4E, 0x4D, 0x4B, 0x41, 0x2E, 0x21, 0x20, 0x2D, 0x43,
+  0x52, 0x57, 0x51, 0x4B, 0x46, 0x3C, 0x2A, 0x14, 0x07, 0x01, 0xC0, 0x05, 0xB6, 0x04, 0x14, 0x35, 0x5B, 0x6E, 0x6A, 0x59, 0x53, 0x55, 0x5A, 0x65,
+  0x6F, 0x71, 0x6E, 0x66, 0x58, 0x51, 0x52, 0x57, 0x5B, 0x59, 0x53, 0x4E, 0x4B, 0x4C, 0x4E, 0x58, 0x6A, 0x7D, 0x87, 0x89, 0x88, 0x88, 0x84, 0x79,
+  0x67, 0x58, 0x50, 0x4B, 0x3F, 0x2B, 0x18, 0x0F, 0x12, 0x22, 0x39, 0x4B, 0x53, 0x50, 0x49, 0x41, 0x34, 0x1F, 0x0D, 0x03, 0xC0, 0x05, 0xB6, 0x06,
+  0x18, 0x38, 0x5B, 0x72, 0x73, 0x69, 0x60, 0x56, 0x53, 0x55, 0x5F, 0x68, 0x6C, 0x6B, 0x66, 0x60, 0x60, 0x64, 0x65, 0x61, 0x5A, 0x54, 0x53, 0x55,
+  0x5A, 0x64, 0x72, 0x7F, 0x83, 0x81, 0x7F, 0x81, 0x82, 0x7D, 0x71, 0x63, 0x5A, 0x4E, 0x39, 0x20, 0x0D, 0x05, 0x08, 0x15, 0x2A, 0x3F, 0x4A, 0x4B,
+  0x44, 0x39, 0x2A, 0x17, 0x08, 0x01, 0xC0, 0x04, 0xB7, 0x01, 0x06, 0x15, 0x30, 0x4C, 0x61, 0x6B, 0x6B, 0x66, 0x5E, 0x57, 0x4F, 0x50, 0x54, 0x5E,
+  0x65, 0x6A, 0x6D, 0x71, 0x72, 0x6D, 0x65, 0x5E, 0x5D, 0x60, 0x66, 0x6E, 0x76, 0x7C, 0x7F, 0x7B, 0x74, 0x71, 0x74, 0x7A, 0x7D, 0x7A, 0x70, 0x67,
+  0x57, 0x3C, 0x1E, 0x0B, 0x02, 0x03, 0x0A, 0x18, 0x29, 0x38, 0x3D, 0x38, 0x2D, 0x20, 0x11, 0x06, 0x01, 0xC0, 0x05, 0xB6, 0x03, 0x0B, 0x1D, 0x31,
+  0x42, 0x4F, 0x56, 0x5A, 0x5A, 0x59, 0x51, 0x4C, 0x4C, 0x50, 0x55, 0x62, 0x6E, 0x76, 0x75, 0x6B, 0x5E, 0x5A, 0x61, 0x6D, 0x78, 0x7F, 0x82, 0x80,
+  0x7A, 0x70, 0x69, 0x66, 0x69, 0x70, 0x78, 0x7B, 0x78, 0x71, 0x61, 0x47, 0x26, 0x0F, 0x03, 0x01, 0x03, 0x0A, 0x16, 0x24, 0x2A, 0x28, 0x21, 0x17,
+  0x0D, 0x06, 0x02, 0xC0, 0x05, 0xAB, 0x01, 0x04, 0x0B, 0x19, 0x27, 0x34, 0x3C, 0x43, 0x4A, 0x52, 0x54, 0x52, 0x4F, 0x4E, 0x4C, 0x55, 0x62, 0x6D,
+  0x6D, 0x62, 0x56, 0x56, 0x60, 0x74, 0x80, 0x84, 0x83, 0x7B, 0x71, 0x67, 0x63, 0x61, 0x63, 0x66, 0x6D, 0x73, 0x76, 0x75, 0x6A, 0x55, 0x35, 0x19,
+  0x08, 0x01, 0x00, 0x89, 0x03, 0x0A, 0x14, 0x1C, 0x1C, 0x17, 0x10, 0x09, 0x04, 0x01, 0xC0, 0x07, 0xB3, 0x04, 0x0E, 0x1C, 0x2A, 0x33, 0x37, 0x3E,
+  0x4A, 0x55, 0x5A, 0x5B, 0x57, 0x52, 0x54, 0x5D, 0x67, 0x69, 0x61, 0x57, 0x57, 0x63, 0x75, 0x7D, 0x7F, 0x7C, 0x73, 0x69, 0x62, 0x60, 0x5F, 0x5F,
+  0x5E, 0x5F, 0x64, 0x6D, 0x73, 0x6D, 0x5C, 0x3F, 0x24, 0x0F, 0x04, 0x01, 0x01, 0x05, 0x0D, 0x16, 0x17, 0x11, 0x0A, 0x04, 0x01, 0xC0, 0x07, 0xB2,
+  0x05, 0x0F, 0x1E, 0x2C, 0x35, 0x37, 0x3C, 0x45, 0x50, 0x58, 0x5E, 0x63, 0x64, 0x63, 0x65, 0x6B, 0x6F, 0x69, 0x61, 0x63, 0x6A, 0x70, 0x6F, 0x6F,
+  0x6E, 0x6A, 0x64, 0x60, 0x5F, 0x5F, 0x5D, 0x58, 0x52, 0x54, 0x61, 0x6A, 0x67, 0x58, 0x3E, 0x28, 0x14, 0x08, 0x04, 0x03, 0x06, 0x0D, 0x15, 0x16,
+  0x11, 0x08, 0x02, 0xC0, 0x06, 0xB3, 0x02, 0x0A, 0x18, 0x28, 0x32, 0x33, 0x32, 0x35, 0x3C, 0x46, 0x4D, 0x57, 0x66, 0x73, 0x76, 0x74, 0x70, 0x6C,
+  0x68, 0x68, 0x6E, 0x6E, 0x65, 0x5B, 0x59, 0x5C, 0x60, 0x61, 0x60, 0x5F, 0x5E, 0x5C, 0x55, 0x4D, 0x4F, 0x5C, 0x63, 0x5C, 0x49, 0x32, 0x21, 0x14,
+  0x0D, 0x0A, 0x0A, 0x0B, 0x0F, 0x15, 0x17, 0x12, 0x09, 0x03, 0xC0, 0x05, 0xB4, 0x01, 0x04, 0x0E, 0x1E, 0x2A, 0x2D, 0x27, 0x22, 0x26, 0x2F, 0x3B,
+  0x45, 0x53, 0x68, 0x79, 0x7E, 0x79, 0x6B, 0x5F, 0x5D, 0x65, 0x6E, 0x6B, 0x5F, 0x52, 0x4E, 0x56, 0x5D, 0x60, 0x60, 0x5F, 0x5F, 0x5D, 0x57, 0x52,
+  0x55, 0x61, 0x65, 0x55, 0x3A, 0x22, 0x15, 0x11, 0x0E, 0x0D, 0x0D, 0x0D, 0x0F, 0x12, 0x13, 0x0F, 0x08, 0x03, 0xC0, 0x05, 0xB4, 0x01, 0x04, 0x0D,
+  0x1A, 0x22, 0x1F, 0x16, 0x12, 0x18, 0x26, 0x37, 0x46, 0x58, 0x6F, 0x7D, 0x7F, 0x74, 0x5E, 0x4E, 0x4D, 0x57, 0x66, 0x6A, 0x63, 0x58, 0x55, 0x5D,
+  0x64, 0x64, 0x61, 0x5F, 0x5F, 0x5F, 0x5E, 0x5F, 0x66, 0x6F, 0x6D, 0x56, 0x34, 0x1B, 0x0D, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x08,
+  0x04, 0x01, 0xC0, 0x06, 0xB2, 0x02, 0x07, 0x0E, 0x12, 0x0F, 0x09, 0x08, 0x11, 0x24, 0x38, 0x4D, 0x62, 0x77, 0x81, 0x7F, 0x71, 0x58, 0x47, 0x45,
+  0x4E, 0x62, 0x6D, 0x6D, 0x69, 0x68, 0x6C, 0x6D, 0x69, 0x65, 0x62, 0x61, 0x62, 0x66, 0x6D, 0x76, 0x7D, 0x78, 0x5D, 0x37, 0x19, 0x09, 0x04, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0xC0, 0x07, 0xA8, 0x02, 0x04, 0x05, 0x04, 0x03, 0x04, 0x0E, 0x22, 0x39, 0x51, 0x68, 0x7B, 0x84,
+  0x81, 0x74, 0x5C, 0x4A, 0x47, 0x50, 0x61, 0x6C, 0x70, 0x71, 0x71, 0x71, 0x6F, 0x6D, 0x6B, 0x67, 0x66, 0x68, 0x6E, 0x75, 0x7C, 0x81, 0x7A, 0x5F,
+  0x38, 0x18, 0x07, 0x01, 0xC0, 0x09, 0x80, 0x01, 0x01, 0xA2, 0x02, 0x0B, 0x1F, 0x3A, 0x56, 0x6F, 0x7F, 0x87, 0x85, 0x79, 0x66, 0x57, 0x53, 0x59,
+  0x64, 0x6B, 0x6E, 0x6F, 0x6F, 0x6D, 0x6C, 0x70, 0x73, 0x71, 0x6F, 0x70, 0x71, 0x73, 0x77, 0x7A, 0x71, 0x56, 0x30, 0x14, 0x04, 0xC0, 0x0C, 0xA2,
+  0x01, 0x0B, 0x1F, 0x3D, 0x5A, 0x70, 0x7B, 0x80, 0x7E, 0x73, 0x67, 0x60, 0x60, 0x63, 0x68, 0x6B, 0x6B, 0x6C, 0x6B, 0x6A, 0x6C, 0x74, 0x7B, 0x7C,
+  0x79, 0x73, 0x6A, 0x66, 0x68, 0x69, 0x5E, 0x43, 0x22, 0x0C, 0x01, 0xC0, 0x0C, 0xA1, 0x02, 0x0D, 0x22, 0x3F, 0x58, 0x67, 0x6B, 0x6D, 0x69, 0x5F,
+  0x5B, 0x5E, 0x65, 0x69, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6A, 0x6D, 0x74, 0x7B, 0x7F, 0x7C, 0x70, 0x60, 0x55, 0x54, 0x53, 0x48, 0x31, 0x16, 0x06,
+  0xC0, 0x0B, 0xA2, 0x01, 0x03, 0x10, 0x27, 0x43, 0x53, 0x56, 0x51, 0x4D, 0x48, 0x40, 0x43, 0x51, 0x61, 0x69, 0x6B, 0x6B, 0x6B, 0x6B, 0x69, 0x67,
+  0x65, 0x69, 0x71, 0x78, 0x78, 0x6D, 0x5C, 0x4E, 0x47, 0x41, 0x36, 0x24, 0x10, 0x04, 0xC0, 0x0C, 0xA1, 0x04, 0x13, 0x2D, 0x46, 0x51, 0x47, 0x34,
+  0x2B, 0x25, 0x20, 0x29, 0x3D, 0x55, 0x64, 0x69, 0x6B, 0x6B, 0x69, 0x64, 0x5B, 0x53, 0x53, 0x5A, 0x66, 0x6E, 0x6D, 0x63, 0x52, 0x41, 0x33, 0x27,
+  0x1A, 0x0D, 0x04, 0xC0, 0x0C, 0xA1, 0x05, 0x15, 0x30, 0x46, 0x4A, 0x3A, 0x20, 0x13, 0x0D, 0x0C, 0x13, 0x27, 0x41, 0x57, 0x63, 0x68, 0x68, 0x63,
+  0x57, 0x45, 0x36, 0x32, 0x39, 0x4B, 0x5D, 0x67, 0x65, 0x58, 0x41, 0x2A, 0x1B, 0x12, 0x09, 0x03, 0xC0, 0x0B, 0xA2, 0x01, 0x06, 0x14, 0x2D, 0x3D,
+  0x3A, 0x2A, 0x13, 0x06, 0x01, 0x02, 0x07, 0x14, 0x29, 0x41, 0x53, 0x5B, 0x5B, 0x53, 0x41, 0x2A, 0x1C, 0x1A, 0x22, 0x31, 0x46, 0x58, 0x5C, 0x54,
+  0x40, 0x24, 0x12, 0x0A, 0x04, 0x01, 0xC0, 0x0C, 0x87, 0x05, 0x10, 0x23, 0x2D, 0x2B, 0x1D, 0x0D, 0x04, 0x01, 0x96, 0x02, 0x07, 0x14, 0x26, 0x38,
+  0x43, 0x43, 0x38, 0x26, 0x14, 0x0D, 0x0E, 0x16, 0x22, 0x2F, 0x3E, 0x47, 0x45, 0x37, 0x1F, 0x0C, 0x04, 0x01, 0xC0, 0x0C, 0x9F, 0x02, 0x09, 0x15,
+  0x1E, 0x1F, 0x17, 0x0E, 0x07, 0x03, 0x02, 0x01, 0x02, 0x07, 0x10, 0x1C, 0x23, 0x23, 0x1C, 0x11, 0x08, 0x08, 0x0E, 0x16, 0x1C, 0x1D, 0x21, 0x27,
+  0x2B, 0x25, 0x16, 0x08, 0x02, 0xC0, 0x0D, 0x9E, 0x03, 0x09, 0x0F, 0x11, 0x11, 0x0F, 0x0B, 0x08, 0x06, 0x03, 0x02, 0x02, 0x05, 0x0B, 0x0E, 0x0F,
+  0x0C, 0x06, 0x05, 0x0B, 0x14, 0x19, 0x17, 0x10, 0x0D, 0x11, 0x17, 0x17, 0x10, 0x07, 0x02, 0xC0, 0x0D, 0x9E, 0x01, 0x02, 0x05, 0x07, 0x09, 0x0C,
+  0x0D, 0x0E, 0x0D, 0x09, 0x06, 0x05, 0x04, 0x06, 0x09, 0x0A, 0x07, 0x06, 0x08, 0x11, 0x18, 0x18, 0x11, 0x08, 0x03, 0x06, 0x0E, 0x14, 0x13, 0x0B,
+  0x03, 0xC0, 0x0F, 0x9D, 0x01, 0x02, 0x03, 0x06, 0x0A, 0x0F, 0x11, 0x10, 0x0D, 0x0B, 0x0A, 0x0C, 0x0F, 0x10, 0x0E, 0x0D, 0x10, 0x17, 0x19, 0x14,
+  0x0B, 0x03, 0x01, 0x06, 0x10, 0x1B, 0x1B, 0x10, 0x05, 0x01, 0xC0, 0x12, 0x9A, 0x02, 0x05, 0x09, 0x0D, 0x0F, 0x0F, 0x0E, 0x0E, 0x11, 0x16, 0x19,
+  0x17, 0x16, 0x17, 0x19, 0x16, 0x0E, 0x06, 0x01, 0x01, 0x05, 0x10, 0x1B, 0x1B, 0x10, 0x05, 0x01, 0xC0, 0x13, 0x90, 0x01, 0x03, 0x06, 0x08, 0x0A,
+  0x0A, 0x0B, 0x0F, 0x15, 0x18, 0x18, 0x17, 0x17, 0x15, 0x0E, 0x07, 0x02, 0x01, 0x85, 0x03, 0x09, 0x10, 0x10, 0x09, 0x03, 0xC0, 0x15, 0x8D, 0x02,
+  0x02, 0x03, 0x03, 0x04, 0x07, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x0C, 0x07, 0x02, 0x02, 0x85, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0xC0, 0x19, 0x88,
+  0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x05, 0x02, 0x05, 0x81, 0x01, 0x01, 0xC0, 0x1C, 0x84, 0x01, 0x01, 0x01, 0x02, 0x01, 0xC0, 0xC0, 0xC0,
+  0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_BIG_1_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x1860, 0x1860, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
+  0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880,
+  0x1880, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820, 0x0820, 0x0820,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1040, 0x1040, 0x0840, 0x0820, 0x0020, 0x0820, 0x1040, 0x1860, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060,
+  0x1880, 0x1060, 0x1060, 0x1040, 0x1040, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1040, 0x0020, 0x0000, 0x0020, 0x0820, 0x1060,
+  0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1860, 0x1040, 0x0840, 0x1040, 0x1060, 0x1880, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0820, 0x0840, 0x1040, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
+  0x1040, 0x1060, 0x1060, 0x1060, 0x1860, 0x1880, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1040, 0x0820, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1860, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1881,
+  0x1880, 0x1880, 0x1881, 0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1080, 0x1080, 0x1881, 0x1880, 0x1880, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1881, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x1060, 0x1060, 0x1060, 0x1040, 0x0820,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1, 0x18A1, 0x1881, 0x1881,
+  0x1060, 0x1060, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1080, 0x1880, 0x1860,
+  0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881,
+  0x1881, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1080, 0x1060, 0x1060, 0x1060, 0x1080, 0x1881,
+  0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820, 0x0840, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1081, 0x1081, 0x1881, 0x1881, 0x1081, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1080,
+  0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x1040,
+  0x1040, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x1081, 0x1061,
+  0x1060, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1080, 0x1080, 0x1880, 0x1880, 0x1880, 0x1880, 0x1860, 0x1880, 0x1880, 0x1881,
+  0x1060, 0x1060, 0x1040, 0x1040, 0x1040, 0x1060, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x1881, 0x1880, 0x1881, 0x18A0, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840,
+  0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20A1,
+  0x18A0, 0x1881, 0x1880, 0x1881, 0x1880, 0x1880, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1860, 0x1080, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1, 0x20A1, 0x18A0, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x1040,
+  0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1060, 0x1880, 0x1880, 0x1860, 0x1060, 0x1060, 0x1860,
+  0x1060, 0x1060, 0x1060, 0x1860, 0x1880, 0x1881, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1,
+  0x18A0, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1881, 0x1880, 0x1880,
+  0x1880, 0x1060, 0x1080, 0x1060, 0x1060, 0x1060, 0x1040, 0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1040, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1080, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A1,
+  0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x18A1, 0x18A0, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1881, 0x1880, 0x1880, 0x1880, 0x18A1, 0x1881, 0x1881, 0x1080, 0x1880, 0x1060, 0x1060, 0x1080, 0x1060, 0x1060, 0x1060, 0x1040,
+  0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1860, 0x1860, 0x1880, 0x1881,
+  0x1880, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1881, 0x1880, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1880, 0x1880, 0x1881, 0x1881, 0x1880, 0x1880, 0x1060,
+  0x1060, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x18A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1881, 0x1880, 0x1880, 0x1881, 0x1880, 0x1881, 0x1881, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1040, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1860, 0x1880, 0x18A0, 0x18A1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x1880, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1860, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x1880, 0x1881, 0x1881, 0x1880, 0x1880, 0x1060, 0x0840,
+  0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x1040, 0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x1060, 0x1040, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x18A1, 0x18A1, 0x1881, 0x1880,
+  0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1080, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1881, 0x18A0, 0x18A1, 0x1881, 0x1880, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x1060,
+  0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x20A1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1880, 0x1881, 0x1881,
+  0x1880, 0x1860, 0x1880, 0x1880, 0x1880, 0x1881, 0x1880, 0x1881, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x1080, 0x0840, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1080, 0x1880, 0x1880,
+  0x18A1, 0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0820,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x1040, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1860, 0x1880, 0x18A0, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A0, 0x18A1, 0x1881,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A0, 0x20E1, 0x20E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0820, 0x0840, 0x1060, 0x1881, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1860, 0x1880, 0x1881,
+  0x18A1, 0x18A1, 0x18A1, 0x18A0, 0x18A1, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1860, 0x1860, 0x1860, 0x1880, 0x1880, 0x18A0,
+  0x20E1, 0x28E1, 0x20C1, 0x1081, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1881, 0x1881, 0x1881, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1080, 0x1880, 0x1881, 0x18A1, 0x18A1, 0x1881, 0x18A0, 0x1881, 0x1881, 0x1881, 0x1860, 0x1880, 0x1860, 0x1860, 0x1860,
+  0x1860, 0x1860, 0x1880, 0x1880, 0x20C1, 0x20E1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0840, 0x1060, 0x1080, 0x1881,
+  0x1881, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1080,
+  0x1880, 0x1860, 0x1860, 0x1860, 0x1860, 0x1060, 0x1060, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x1081, 0x0840, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820,
+  0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1881, 0x18A1, 0x18A1, 0x18A0, 0x1880,
+  0x1060, 0x1060, 0x1880, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x1881, 0x0840,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1080, 0x1880, 0x1881, 0x1880, 0x1880, 0x1881,
+  0x18A1, 0x20A1, 0x18A1, 0x1881, 0x1881, 0x1060, 0x1060, 0x1060, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1860, 0x1060, 0x1060,
+  0x1880, 0x1881, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1860,
+  0x1881, 0x1881, 0x18A0, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x1880, 0x1880, 0x1880, 0x1860,
+  0x1860, 0x1860, 0x1860, 0x1860, 0x1880, 0x1880, 0x18A0, 0x1880, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1040, 0x1060, 0x1880, 0x1880, 0x1881, 0x1880, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x20C1, 0x18A1, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1860, 0x1860, 0x1860, 0x1880, 0x1880, 0x18A0, 0x20A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1060, 0x1080, 0x1880, 0x1880, 0x1881, 0x18A0, 0x18A1, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1,
+  0x1880, 0x1880, 0x18A0, 0x18A1, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x18A1, 0x1080, 0x0840, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A1, 0x1881, 0x1881, 0x18A0, 0x20A1, 0x18A1,
+  0x1881, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1061, 0x1880, 0x1880, 0x1881, 0x18A1,
+  0x1880, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x18A0, 0x20A1, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1881, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1061, 0x1880,
+  0x1080, 0x1860, 0x1060, 0x1060, 0x1061, 0x1881, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x20C1,
+  0x20A1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0820, 0x0840, 0x1060, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x1880, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0840, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1060, 0x1060, 0x1060, 0x1081, 0x18A1, 0x20C1, 0x20E1, 0x20C1, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1060, 0x0840, 0x0020, 0x0020, 0x0820, 0x0860, 0x1881, 0x20C1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1081, 0x1881, 0x1081,
+  0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0840,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_BIG_1_SPANS = {
+  SPRITE_DIRT_BIG_1_SPAN_ROWS, SPRITE_DIRT_BIG_1_SPAN_OPS, SPRITE_DIRT_BIG_1_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_BIG_1_ASSET = {
   SPRITE_DIRT_BIG_1_WIDTH, SPRITE_DIRT_BIG_1_HEIGHT,
-  SPRITE_DIRT_BIG_1_ALPHA, SPRITE_DIRT_BIG_1_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_BIG_1_SPANS
 };
 
 #endif // SPRITE_DIRT_BIG_1_INCLUDED
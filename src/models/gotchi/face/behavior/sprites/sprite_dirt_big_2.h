@@ -5,150 +5,282 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_big_2.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_big_2.png (64x64) — RGBA multi-couleur, encodé en spans
+// 2264/4096 pixels visibles, 7236 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_BIG_2_WIDTH = 64;
 constexpr uint16_t SPRITE_DIRT_BIG_2_HEIGHT = 64;
 
-const uint16_t SPRITE_DIRT_BIG_2_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1880, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x20A1, 0x20A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x0840, 0x0820, 0x0020, 0x0820, 0x1060, 0x1881, 0x18A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20A1, 0x20A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x1060, 0x20A1, 0x2902, 0x3122, 0x3102, 0x28E1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0020, 0x0840, 0x1880, 0x1881, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x3122, 0x3963, 0x3963, 0x3122, 0x20C1, 0x20C1, 0x3102, 0x3942, 0x4183, 0x49A3, 0x4183, 0x3942, 0x28E1, 0x18A1, 0x1040, 0x0840, 0x1060, 0x1881, 0x1881, 0x1061, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3122, 0x4183, 0x41A3, 0x4183, 0x3942, 0x3922, 0x3942, 0x4983, 0x51C3, 0x51E4, 0x51E4, 0x51C3, 0x4183, 0x3122, 0x20A1, 0x1881, 0x20A1, 0x28E1, 0x20C1, 0x1081, 0x0820, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0820, 0x0820, 0x0820, 0x0840, 0x1881, 0x28E1, 0x3942, 0x4183, 0x4183, 0x4163, 0x4163, 0x4983, 0x49A3, 0x51E3, 0x5A04, 0x6224, 0x5A04, 0x51E4, 0x4183, 0x3102, 0x28C1, 0x28C1, 0x2902, 0x20C1, 0x1061, 0x0020, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x1881, 0x20A1, 0x28E1, 0x3122, 0x3942, 0x4163, 0x4983, 0x49A3, 0x51C3, 0x51E3, 0x5A04, 0x5A24, 0x5A24, 0x5A04, 0x51C3, 0x3942, 0x28E1, 0x20C1, 0x20C1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0820, 0x1881, 0x20C1, 0x20C1, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x20A1, 0x28C1, 0x2902, 0x3102, 0x3102, 0x3102, 0x2902, 0x28E1, 0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x3122, 0x3942, 0x4183, 0x49A3, 0x49A3, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x4163, 0x28E1, 0x20A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0020, 0x1060, 0x28C1, 0x3122, 0x3122, 0x28C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3102, 0x3942, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x3942, 0x3122, 0x3102, 0x28E1, 0x28E1, 0x3101, 0x3922, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51E4, 0x5A04, 0x5A04, 0x5204, 0x4983, 0x3102, 0x20C1, 0x1881, 0x1060, 0x0840, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3942, 0x3942, 0x3101, 0x1881, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3922, 0x4162, 0x4163, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4163, 0x4162, 0x3942, 0x3922, 0x3122, 0x3102, 0x3922, 0x4142, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x51C3, 0x3942, 0x28E1, 0x20C1, 0x18A1, 0x1060, 0x0820, 0x0820, 0x1881, 0x28E1, 0x3942, 0x3942, 0x3101, 0x1881, 0x1040, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3942, 0x4162, 0x4163, 0x4163, 0x4983, 0x4163, 0x4162, 0x4162, 0x4162, 0x4163, 0x4162, 0x4162, 0x4142, 0x3942, 0x3942, 0x3942, 0x4142, 0x4142, 0x4162, 0x4982, 0x51A3, 0x51E3, 0x5A04, 0x59E4, 0x51E4, 0x51C3, 0x4983, 0x3942, 0x3101, 0x28C1, 0x1881, 0x1060, 0x1040, 0x1880, 0x28E1, 0x3122, 0x3122, 0x28C1, 0x1881, 0x1040, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28C1, 0x3922, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x3922, 0x3101, 0x20A1, 0x1880, 0x1060, 0x20A1, 0x3101, 0x3122, 0x3102, 0x20A1, 0x1060, 0x0840, 0x1040, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x3102, 0x3942, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4983, 0x4962, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x49A3, 0x4983, 0x4162, 0x4142, 0x4162, 0x4162, 0x4162, 0x3942, 0x3101, 0x20C1, 0x18A1, 0x20A1, 0x28E1, 0x3942, 0x4162, 0x3922, 0x20A1, 0x1040, 0x0820, 0x0820, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28C1, 0x3922, 0x4162, 0x4162, 0x4162, 0x4162, 0x4183, 0x4983, 0x4183, 0x4162, 0x4162, 0x4162, 0x4183, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4162, 0x4983, 0x4162, 0x4142, 0x3922, 0x3942, 0x4142, 0x4142, 0x3942, 0x3122, 0x3101, 0x28E1, 0x3102, 0x3942, 0x4983, 0x4183, 0x3942, 0x20C1, 0x1040, 0x0020, 0x0820, 0x0840, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061, 0x28E1, 0x3942, 0x4162, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4142, 0x3942, 0x3942, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4163, 0x4983, 0x49A3, 0x4183, 0x3122, 0x20A1, 0x0840, 0x0020, 0x0000, 0x0840, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3942, 0x4162, 0x4183, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4182, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x3942, 0x28E1, 0x1881, 0x1060, 0x0820, 0x0820, 0x0840, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3942, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x4182, 0x3922, 0x28C1, 0x20A1, 0x20A1, 0x1880, 0x1040, 0x1040, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3101, 0x3942, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4983, 0x51C3, 0x59E3, 0x59E3, 0x59C3, 0x51C3, 0x49A3, 0x4162, 0x3922, 0x3101, 0x3102, 0x3102, 0x28C1, 0x1881, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3101, 0x4142, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x59C3, 0x51C3, 0x51A3, 0x49A3, 0x4982, 0x4162, 0x3942, 0x3942, 0x4142, 0x3942, 0x3102, 0x20A1, 0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x20C1, 0x3102, 0x4142, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4962, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x30E2, 0x20A1, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3922, 0x4142, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x3122, 0x28C1, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3922, 0x4142, 0x4142, 0x4162, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4982, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4142, 0x3922, 0x3101, 0x20A1, 0x1860, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3922, 0x3922, 0x3942, 0x4142, 0x4162, 0x4982, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x3942, 0x3922, 0x3101, 0x20A1, 0x1860, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x20C1, 0x3101, 0x3921, 0x3921, 0x3922, 0x3942, 0x4162, 0x4162, 0x4982, 0x4982, 0x4982, 0x4162, 0x4162, 0x4142, 0x3942, 0x4142, 0x4162, 0x4162, 0x4982, 0x4982, 0x4983, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4982, 0x49A3, 0x51A3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x3942, 0x3101, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28C1, 0x3101, 0x3101, 0x3101, 0x3921, 0x3942, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x3922, 0x3942, 0x4142, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4962, 0x4982, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x3942, 0x3101, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x30E1, 0x3101, 0x3101, 0x3101, 0x3922, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4162, 0x4983, 0x51C3, 0x59E3, 0x5A04, 0x59E3, 0x51E3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4962, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4142, 0x3922, 0x3101, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x3101, 0x3101, 0x3901, 0x3922, 0x3942, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x59E4, 0x59E3, 0x51C3, 0x4983, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4982, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x3922, 0x3902, 0x30E1, 0x20C1, 0x1880, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3101, 0x3922, 0x3922, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x59E3, 0x5A04, 0x59E4, 0x59E4, 0x5A04, 0x6224, 0x6224, 0x6224, 0x5A04, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3922, 0x3122, 0x30E1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28C1, 0x3922, 0x3922, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51E3, 0x5A04, 0x6224, 0x6224, 0x6224, 0x6224, 0x5A24, 0x5A04, 0x5A04, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4142, 0x3122, 0x28E1, 0x18A1, 0x1860, 0x1060, 0x1060, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3101, 0x3922, 0x3942, 0x3922, 0x3922, 0x4142, 0x4982, 0x51C3, 0x5A04, 0x6224, 0x5A24, 0x5A04, 0x5A04, 0x59E3, 0x51E3, 0x51C3, 0x51E3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x4162, 0x3922, 0x28C1, 0x1860, 0x0840, 0x0820, 0x0820, 0x1040, 0x1880, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3922, 0x3942, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51E3, 0x59E4, 0x51E3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x4142, 0x4162, 0x4982, 0x51A3, 0x49C3, 0x4183, 0x3102, 0x18A1, 0x1040, 0x0020, 0x0020, 0x0820, 0x1060, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x3101, 0x3922, 0x3942, 0x3922, 0x3942, 0x4142, 0x4182, 0x49A3, 0x49A3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4162, 0x4983, 0x51E3, 0x59E4, 0x51E3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x3942, 0x3922, 0x3921, 0x3921, 0x3922, 0x3942, 0x4142, 0x4162, 0x4983, 0x51C3, 0x59E4, 0x51C3, 0x4183, 0x3102, 0x18A1, 0x0840, 0x0020, 0x0020, 0x0840, 0x1060, 0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3922, 0x4142, 0x3942, 0x3922, 0x3942, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4983, 0x51E3, 0x5A04, 0x5A04, 0x51E3, 0x51A3, 0x4982, 0x4162, 0x4142, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x4142, 0x4162, 0x4983, 0x51C3, 0x5A04, 0x5A04, 0x51C3, 0x4162, 0x28E1, 0x1060, 0x0820, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x30E1, 0x3922, 0x4142, 0x3942, 0x3922, 0x3922, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4983, 0x51C3, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x49A3, 0x51E3, 0x5A04, 0x59E4, 0x49A3, 0x3102, 0x1881, 0x0840, 0x0020, 0x0820, 0x1060, 0x1880, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20A1, 0x3101, 0x3942, 0x4142, 0x3942, 0x3922, 0x3922, 0x3942, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x49A3, 0x51C3, 0x51E3, 0x51C3, 0x49A3, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51E3, 0x49A3, 0x3942, 0x20C1, 0x1060, 0x0820, 0x0840, 0x1060, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28C1, 0x3922, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x3942, 0x4142, 0x4142, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4162, 0x4962, 0x4982, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x4162, 0x2902, 0x1881, 0x1060, 0x1060, 0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1860, 0x28E1, 0x3922, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x3942, 0x3942, 0x4142, 0x4162, 0x4162, 0x4142, 0x4142, 0x4162, 0x4162, 0x4962, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x4982, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x4983, 0x3922, 0x20C1, 0x1881, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x30E1, 0x3922, 0x3942, 0x4142, 0x4142, 0x4142, 0x3942, 0x4142, 0x3942, 0x3942, 0x4142, 0x4142, 0x4142, 0x4142, 0x4962, 0x4982, 0x4983, 0x4982, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x4183, 0x4183, 0x4983, 0x49A3, 0x4983, 0x3942, 0x28E1, 0x20A1, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3922, 0x3942, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4962, 0x49A3, 0x51A3, 0x4983, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x4162, 0x4983, 0x4183, 0x4163, 0x3942, 0x3122, 0x3122, 0x3942, 0x4162, 0x4162, 0x3922, 0x28E1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x3101, 0x3922, 0x3942, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4162, 0x4983, 0x49A3, 0x4983, 0x4982, 0x4162, 0x4142, 0x4162, 0x4162, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x4142, 0x4162, 0x3942, 0x3122, 0x28E1, 0x20C1, 0x18A1, 0x18A1, 0x28C1, 0x3102, 0x3122, 0x28E1, 0x20A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x20A1, 0x3101, 0x3922, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x4142, 0x4162, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4982, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x3922, 0x3101, 0x20A1, 0x1060, 0x1040, 0x0840, 0x1040, 0x1881, 0x20C1, 0x20C1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x1880, 0x28E1, 0x3922, 0x4142, 0x4142, 0x4142, 0x3942, 0x3942, 0x3922, 0x3942, 0x4162, 0x4183, 0x4182, 0x4162, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4142, 0x3942, 0x3101, 0x20C1, 0x1060, 0x0820, 0x0820, 0x0820, 0x1040, 0x1060, 0x1880, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20C1, 0x3922, 0x4162, 0x4162, 0x4142, 0x3942, 0x3922, 0x3101, 0x3101, 0x3102, 0x3122, 0x3922, 0x3942, 0x4162, 0x4982, 0x49A3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4142, 0x3922, 0x30E1, 0x18A1, 0x1040, 0x0820, 0x0840, 0x1040, 0x1060, 0x1060, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3102, 0x4142, 0x4162, 0x3942, 0x3102, 0x3101, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x28E1, 0x3101, 0x3942, 0x4162, 0x4982, 0x4982, 0x4162, 0x4162, 0x4142, 0x4142, 0x3922, 0x28E1, 0x1881, 0x1040, 0x0840, 0x1040, 0x1060, 0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x30E1, 0x3942, 0x3942, 0x3122, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1880, 0x20A1, 0x28E1, 0x3922, 0x3942, 0x4162, 0x4162, 0x4142, 0x4142, 0x4142, 0x3942, 0x3922, 0x28E1, 0x1881, 0x1060, 0x1040, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x3122, 0x3102, 0x28C1, 0x1881, 0x1080, 0x1881, 0x18A1, 0x1880, 0x1060, 0x1881, 0x28C1, 0x3101, 0x3922, 0x3942, 0x3942, 0x4142, 0x4142, 0x3942, 0x3922, 0x3101, 0x20C1, 0x1880, 0x1060, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x20C1, 0x28C1, 0x20C1, 0x1880, 0x0840, 0x0840, 0x0840, 0x1040, 0x0840, 0x0840, 0x1060, 0x20A1, 0x28E1, 0x3101, 0x3121, 0x3922, 0x3922, 0x3942, 0x3922, 0x3102, 0x28C1, 0x1881, 0x1040, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x20C1, 0x28C1, 0x28E1, 0x3101, 0x3922, 0x3922, 0x28E1, 0x1881, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1881, 0x28C1, 0x3101, 0x3101, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1880, 0x20C1, 0x20C1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_BIG_2_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 3, 0, 4, 0, 13, 6, 22, 12, 40, 25,
+  68, 46, 97, 72, 126, 98, 156, 125, 195, 161, 236, 199, 280, 240, 329, 286,
+  380, 334, 432, 383, 484, 432, 537, 482, 590, 532, 645, 584, 700, 636, 755, 688,
+  810, 740, 865, 792, 920, 844, 975, 896, 1030, 948, 1085, 1000, 1139, 1051, 1192, 1101,
+  1244, 1150, 1296, 1199, 1349, 1249, 1402, 1299, 1455, 1349, 1509, 1400, 1563, 1451, 1618, 1503,
+  1672, 1554, 1726, 1605, 1780, 1656, 1834, 1707, 1887, 1757, 1939, 1806, 1991, 1855, 2043, 1904,
+  2093, 1951, 2142, 1997, 2189, 2041, 2227, 2076, 2263, 2109, 2299, 2142, 2333, 2173, 2364, 2201,
+  2393, 2225, 2415, 2242, 2428, 2252, 2437, 2258, 2445, 2263, 2449, 2264, 2450, 2264, 2451, 2264
 };
 
-const uint8_t SPRITE_DIRT_BIG_2_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x11, 0x11, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0B, 0x19, 0x24, 0x24, 0x19, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x04, 0x09, 0x0D, 0x0C, 0x09, 0x05, 0x02, 0x01, 0x00, 0x00, 0x01, 0x04, 0x11, 0x24, 0x30, 0x2F, 0x24, 0x11, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x06, 0x04, 0x03, 0x09, 0x13, 0x1B, 0x1D, 0x1A, 0x15, 0x0D, 0x07, 0x02, 0x01, 0x01, 0x05, 0x12, 0x25, 0x31, 0x2F, 0x24, 0x11, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0C, 0x10, 0x10, 0x0C, 0x0C, 0x14, 0x21, 0x2F, 0x35, 0x35, 0x2F, 0x23, 0x17, 0x0C, 0x05, 0x04, 0x07, 0x11, 0x1E, 0x27, 0x25, 0x19, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0C, 0x14, 0x1B, 0x1D, 0x1A, 0x1A, 0x24, 0x35, 0x46, 0x4F, 0x53, 0x50, 0x44, 0x32, 0x21, 0x13, 0x0D, 0x10, 0x18, 0x1C, 0x1A, 0x14, 0x0B, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x0E, 0x17, 0x20, 0x27, 0x2A, 0x2B, 0x34, 0x45, 0x54, 0x5F, 0x65, 0x65, 0x5F, 0x52, 0x3F, 0x29, 0x1E, 0x1E, 0x24, 0x21, 0x14, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x0A, 0x0B, 0x0A, 0x09, 0x09, 0x0A, 0x0D, 0x14, 0x1F, 0x2B, 0x34, 0x38, 0x3E, 0x4A, 0x57, 0x5F, 0x67, 0x6C, 0x6D, 0x67, 0x57, 0x40, 0x2E, 0x27, 0x29, 0x21, 0x12, 0x06, 0x01, 0x04, 0x08, 0x0C, 0x0C, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0A, 0x12, 0x1A, 0x1E, 0x20, 0x1E, 0x1C, 0x1B, 0x18, 0x16, 0x18, 0x1F, 0x2B, 0x37, 0x3F, 0x44, 0x48, 0x4E, 0x53, 0x5B, 0x66, 0x6E, 0x6F, 0x64, 0x4F, 0x36, 0x27, 0x23, 0x1A, 0x0D, 0x03, 0x02, 0x08, 0x12, 0x19, 0x19, 0x12, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x10, 0x1D, 0x2B, 0x37, 0x3C, 0x3C, 0x39, 0x36, 0x35, 0x31, 0x2A, 0x27, 0x29, 0x30, 0x3A, 0x47, 0x4E, 0x4E, 0x4C, 0x4B, 0x4C, 0x56, 0x64, 0x6B, 0x66, 0x54, 0x37, 0x25, 0x1F, 0x15, 0x0A, 0x03, 0x05, 0x0E, 0x1B, 0x25, 0x25, 0x1B, 0x0F, 0x05, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x13, 0x25, 0x38, 0x47, 0x50, 0x51, 0x4F, 0x4B, 0x49, 0x49, 0x47, 0x44, 0x41, 0x3E, 0x3F, 0x46, 0x56, 0x5F, 0x5E, 0x56, 0x4D, 0x46, 0x48, 0x51, 0x5D, 0x5D, 0x53, 0x3D, 0x2D, 0x25, 0x1B, 0x0E, 0x06, 0x07, 0x11, 0x20, 0x2C, 0x2D, 0x23, 0x14, 0x09, 0x05, 0x05, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x13, 0x27, 0x3F, 0x52, 0x5D, 0x5F, 0x5C, 0x57, 0x54, 0x52, 0x53, 0x55, 0x58, 0x5B, 0x5A, 0x57, 0x5B, 0x69, 0x73, 0x73, 0x6A, 0x5B, 0x4B, 0x42, 0x42, 0x4A, 0x55, 0x56, 0x4C, 0x3F, 0x36, 0x2B, 0x1A, 0x0D, 0x0A, 0x12, 0x22, 0x2E, 0x2F, 0x26, 0x18, 0x0E, 0x0D, 0x0E, 0x0D, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x25, 0x40, 0x56, 0x64, 0x6B, 0x69, 0x64, 0x5E, 0x5B, 0x5A, 0x5B, 0x5F, 0x66, 0x6C, 0x6B, 0x69, 0x6D, 0x78, 0x82, 0x83, 0x7C, 0x6D, 0x59, 0x46, 0x3D, 0x3F, 0x4C, 0x5A, 0x5E, 0x59, 0x50, 0x40, 0x29, 0x17, 0x10, 0x14, 0x22, 0x2D, 0x2D, 0x24, 0x17, 0x11, 0x12, 0x15, 0x13, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x1D, 0x3A, 0x55, 0x67, 0x70, 0x73, 0x71, 0x6C, 0x68, 0x64, 0x63, 0x64, 0x68, 0x6E, 0x72, 0x71, 0x70, 0x74, 0x7D, 0x87, 0x8A, 0x86, 0x7D, 0x6A, 0x53, 0x41, 0x3A, 0x43, 0x58, 0x66, 0x69, 0x60, 0x4D, 0x32, 0x1E, 0x15, 0x16, 0x20, 0x27, 0x24, 0x1B, 0x10, 0x0D, 0x12, 0x17, 0x15, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x13, 0x2C, 0x4C, 0x64, 0x71, 0x75, 0x75, 0x73, 0x70, 0x6D, 0x69, 0x68, 0x69, 0x6D, 0x70, 0x71, 0x6F, 0x6D, 0x71, 0x7C, 0x86, 0x8B, 0x8A, 0x86, 0x78, 0x60, 0x47, 0x3A, 0x40, 0x54, 0x68, 0x70, 0x65, 0x4F, 0x31, 0x1D, 0x14, 0x16, 0x1D, 0x21, 0x1C, 0x12, 0x09, 0x07, 0x0C, 0x13, 0x14, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x1D, 0x3B, 0x59, 0x6C, 0x74, 0x73, 0x71, 0x6E, 0x6C, 0x6B, 0x69, 0x68, 0x69, 0x6B, 0x6C, 0x6C, 0x6A, 0x69, 0x6D, 0x77, 0x82, 0x89, 0x8B, 0x8A, 0x80, 0x6C, 0x52, 0x44, 0x48, 0x59, 0x6D, 0x72, 0x65, 0x4C, 0x32, 0x20, 0x18, 0x18, 0x1C, 0x1C, 0x17, 0x0E, 0x07, 0x04, 0x08, 0x0F, 0x13, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x24, 0x45, 0x60, 0x6F, 0x73, 0x6E, 0x6B, 0x69, 0x68, 0x67, 0x65, 0x64, 0x63, 0x64, 0x66, 0x67, 0x67, 0x67, 0x6B, 0x74, 0x80, 0x88, 0x8C, 0x8B, 0x85, 0x76, 0x62, 0x58, 0x5B, 0x69, 0x77, 0x76, 0x67, 0x4E, 0x39, 0x29, 0x20, 0x1D, 0x1C, 0x1A, 0x15, 0x0F, 0x09, 0x05, 0x06, 0x0D, 0x14, 0x13, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0F, 0x28, 0x4C, 0x65, 0x70, 0x6F, 0x6A, 0x67, 0x66, 0x66, 0x64, 0x5F, 0x5B, 0x59, 0x5B, 0x5F, 0x64, 0x66, 0x66, 0x6A, 0x73, 0x7F, 0x88, 0x8C, 0x8A, 0x84, 0x76, 0x69, 0x65, 0x6D, 0x79, 0x80, 0x79, 0x68, 0x51, 0x3D, 0x2F, 0x26, 0x22, 0x24, 0x23, 0x1F, 0x1C, 0x15, 0x0D, 0x09, 0x0D, 0x16, 0x15, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x2C, 0x50, 0x68, 0x70, 0x6C, 0x68, 0x66, 0x66, 0x64, 0x60, 0x56, 0x4E, 0x4A, 0x4E, 0x56, 0x60, 0x64, 0x66, 0x6B, 0x74, 0x80, 0x88, 0x8B, 0x87, 0x7B, 0x6C, 0x64, 0x67, 0x74, 0x7F, 0x7F, 0x72, 0x5E, 0x4A, 0x38, 0x2D, 0x2A, 0x2F, 0x37, 0x3A, 0x37, 0x33, 0x2B, 0x1B, 0x10, 0x0F, 0x16, 0x15, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x17, 0x34, 0x56, 0x6A, 0x6F, 0x69, 0x66, 0x66, 0x65, 0x62, 0x5C, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x5C, 0x63, 0x67, 0x6D, 0x77, 0x82, 0x88, 0x89, 0x7F, 0x6D, 0x5B, 0x55, 0x5E, 0x71, 0x7A, 0x73, 0x61, 0x4A, 0x39, 0x31, 0x31, 0x38, 0x46, 0x55, 0x5D, 0x5B, 0x52, 0x40, 0x28, 0x17, 0x11, 0x15, 0x12, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x1F, 0x41, 0x60, 0x6E, 0x6F, 0x69, 0x66, 0x66, 0x65, 0x62, 0x5C, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x5C, 0x63, 0x69, 0x71, 0x7C, 0x86, 0x8A, 0x87, 0x79, 0x63, 0x53, 0x4D, 0x57, 0x68, 0x6D, 0x60, 0x48, 0x39, 0x32, 0x36, 0x40, 0x50, 0x63, 0x70, 0x77, 0x73, 0x66, 0x4D, 0x2F, 0x1C, 0x14, 0x13, 0x0E, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x2C, 0x52, 0x6F, 0x77, 0x73, 0x6B, 0x67, 0x66, 0x66, 0x64, 0x60, 0x56, 0x4E, 0x4A, 0x4E, 0x57, 0x60, 0x67, 0x6D, 0x76, 0x80, 0x88, 0x8A, 0x87, 0x79, 0x64, 0x55, 0x50, 0x58, 0x5F, 0x59, 0x47, 0x38, 0x32, 0x37, 0x47, 0x5B, 0x6C, 0x77, 0x80, 0x84, 0x7E, 0x70, 0x54, 0x34, 0x1F, 0x15, 0x11, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x38, 0x5F, 0x7A, 0x80, 0x7B, 0x6F, 0x69, 0x66, 0x66, 0x66, 0x64, 0x5F, 0x5A, 0x58, 0x5B, 0x61, 0x67, 0x6C, 0x72, 0x79, 0x81, 0x87, 0x89, 0x88, 0x80, 0x70, 0x62, 0x5C, 0x5C, 0x55, 0x45, 0x37, 0x32, 0x38, 0x48, 0x61, 0x74, 0x7C, 0x7F, 0x80, 0x80, 0x7D, 0x72, 0x59, 0x37, 0x20, 0x14, 0x0E, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x09, 0x1C, 0x3C, 0x61, 0x7A, 0x81, 0x7E, 0x74, 0x6D, 0x69, 0x68, 0x67, 0x66, 0x65, 0x63, 0x61, 0x62, 0x67, 0x6C, 0x71, 0x74, 0x79, 0x7D, 0x82, 0x85, 0x88, 0x86, 0x7F, 0x76, 0x6B, 0x5C, 0x49, 0x39, 0x33, 0x38, 0x48, 0x62, 0x77, 0x82, 0x82, 0x7B, 0x74, 0x70, 0x70, 0x6B, 0x57, 0x38, 0x20, 0x12, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x36, 0x58, 0x6E, 0x76, 0x76, 0x72, 0x70, 0x6E, 0x6C, 0x6B, 0x6A, 0x69, 0x66, 0x62, 0x60, 0x63, 0x6A, 0x71, 0x73, 0x74, 0x75, 0x77, 0x7C, 0x83, 0x88, 0x87, 0x83, 0x75, 0x5E, 0x48, 0x3A, 0x3B, 0x48, 0x62, 0x78, 0x84, 0x85, 0x7C, 0x6C, 0x5D, 0x55, 0x58, 0x5B, 0x51, 0x39, 0x1F, 0x0F, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x25, 0x44, 0x58, 0x61, 0x63, 0x69, 0x70, 0x75, 0x75, 0x74, 0x72, 0x70, 0x69, 0x5E, 0x56, 0x58, 0x61, 0x69, 0x6B, 0x69, 0x68, 0x68, 0x6D, 0x79, 0x84, 0x89, 0x88, 0x7D, 0x69, 0x53, 0x48, 0x4F, 0x62, 0x77, 0x85, 0x89, 0x86, 0x78, 0x63, 0x50, 0x46, 0x46, 0x4D, 0x4A, 0x38, 0x1E, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x2B, 0x3F, 0x49, 0x50, 0x5D, 0x6D, 0x7A, 0x80, 0x80, 0x7E, 0x79, 0x6C, 0x5A, 0x4D, 0x4B, 0x52, 0x5A, 0x5C, 0x5A, 0x5A, 0x5A, 0x60, 0x6D, 0x7D, 0x87, 0x8B, 0x86, 0x79, 0x68, 0x62, 0x66, 0x74, 0x83, 0x8A, 0x8B, 0x87, 0x7A, 0x64, 0x4F, 0x42, 0x41, 0x4A, 0x49, 0x38, 0x1C, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x19, 0x2C, 0x3B, 0x46, 0x56, 0x6C, 0x7F, 0x88, 0x88, 0x82, 0x7A, 0x6A, 0x56, 0x47, 0x43, 0x46, 0x4A, 0x4B, 0x4C, 0x4E, 0x50, 0x57, 0x63, 0x76, 0x84, 0x8B, 0x8A, 0x85, 0x7C, 0x75, 0x73, 0x7B, 0x84, 0x8A, 0x8C, 0x8A, 0x81, 0x6F, 0x58, 0x4A, 0x48, 0x51, 0x4F, 0x3B, 0x1E, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x11, 0x24, 0x37, 0x47, 0x59, 0x70, 0x83, 0x8B, 0x88, 0x7C, 0x71, 0x60, 0x4F, 0x43, 0x3F, 0x3F, 0x41, 0x41, 0x43, 0x45, 0x48, 0x4C, 0x56, 0x6A, 0x7D, 0x88, 0x8C, 0x8A, 0x85, 0x7D, 0x76, 0x78, 0x81, 0x88, 0x8B, 0x8C, 0x87, 0x7B, 0x69, 0x59, 0x52, 0x55, 0x4D, 0x3C, 0x22, 0x10, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x23, 0x3D, 0x53, 0x67, 0x7B, 0x8A, 0x8D, 0x86, 0x74, 0x62, 0x52, 0x47, 0x40, 0x3E, 0x3E, 0x3E, 0x3F, 0x40, 0x41, 0x40, 0x40, 0x47, 0x58, 0x70, 0x82, 0x8A, 0x8B, 0x88, 0x80, 0x79, 0x79, 0x81, 0x88, 0x8A, 0x8B, 0x88, 0x7F, 0x6E, 0x5C, 0x50, 0x49, 0x40, 0x32, 0x22, 0x17, 0x0E, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x24, 0x44, 0x60, 0x77, 0x87, 0x92, 0x92, 0x88, 0x73, 0x5D, 0x4B, 0x42, 0x40, 0x40, 0x41, 0x43, 0x45, 0x45, 0x42, 0x3B, 0x34, 0x37, 0x46, 0x5F, 0x78, 0x86, 0x8A, 0x88, 0x82, 0x7D, 0x7D, 0x81, 0x82, 0x82, 0x83, 0x82, 0x79, 0x67, 0x4F, 0x3C, 0x2E, 0x25, 0x1E, 0x1C, 0x1A, 0x14, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x21, 0x40, 0x62, 0x7B, 0x8C, 0x94, 0x96, 0x8E, 0x7B, 0x62, 0x4F, 0x47, 0x46, 0x49, 0x4C, 0x51, 0x53, 0x50, 0x48, 0x3C, 0x2F, 0x2F, 0x3C, 0x54, 0x6F, 0x80, 0x87, 0x82, 0x7B, 0x7A, 0x7B, 0x7A, 0x73, 0x6F, 0x72, 0x74, 0x6B, 0x5B, 0x3F, 0x28, 0x19, 0x11, 0x0E, 0x13, 0x19, 0x18, 0x11, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x31, 0x57, 0x75, 0x89, 0x93, 0x96, 0x92, 0x85, 0x6F, 0x5D, 0x56, 0x57, 0x5A, 0x5F, 0x63, 0x64, 0x5D, 0x51, 0x42, 0x34, 0x31, 0x3D, 0x55, 0x6F, 0x7F, 0x81, 0x78, 0x6E, 0x6D, 0x72, 0x6F, 0x66, 0x5F, 0x63, 0x6A, 0x67, 0x5B, 0x42, 0x2A, 0x19, 0x0E, 0x08, 0x0C, 0x14, 0x19, 0x17, 0x0E, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x21, 0x44, 0x68, 0x81, 0x90, 0x95, 0x95, 0x8C, 0x7D, 0x71, 0x6D, 0x6E, 0x6F, 0x71, 0x72, 0x71, 0x67, 0x5A, 0x4C, 0x40, 0x3E, 0x49, 0x60, 0x76, 0x81, 0x80, 0x73, 0x69, 0x68, 0x6E, 0x6E, 0x65, 0x5E, 0x62, 0x6B, 0x6D, 0x66, 0x54, 0x3E, 0x28, 0x16, 0x0B, 0x08, 0x0E, 0x17, 0x1A, 0x16, 0x0D, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1A, 0x3D, 0x62, 0x7E, 0x8D, 0x93, 0x96, 0x92, 0x89, 0x81, 0x7C, 0x7D, 0x7C, 0x7E, 0x7D, 0x79, 0x70, 0x62, 0x56, 0x4D, 0x4E, 0x5A, 0x6F, 0x80, 0x87, 0x83, 0x78, 0x6E, 0x6E, 0x75, 0x78, 0x73, 0x6E, 0x70, 0x76, 0x77, 0x73, 0x68, 0x54, 0x3A, 0x21, 0x0F, 0x07, 0x09, 0x13, 0x1A, 0x19, 0x10, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1D, 0x40, 0x65, 0x7F, 0x8C, 0x92, 0x96, 0x95, 0x8F, 0x88, 0x7F, 0x7D, 0x7E, 0x83, 0x84, 0x82, 0x79, 0x6C, 0x60, 0x59, 0x5C, 0x69, 0x7A, 0x86, 0x8A, 0x88, 0x83, 0x7D, 0x7D, 0x81, 0x85, 0x84, 0x81, 0x82, 0x81, 0x7F, 0x7A, 0x73, 0x61, 0x45, 0x28, 0x13, 0x09, 0x0A, 0x13, 0x1A, 0x18, 0x0F, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x27, 0x4D, 0x70, 0x84, 0x8D, 0x91, 0x95, 0x96, 0x90, 0x84, 0x76, 0x70, 0x74, 0x7F, 0x86, 0x87, 0x81, 0x78, 0x6D, 0x67, 0x68, 0x71, 0x7D, 0x87, 0x8B, 0x8B, 0x8A, 0x88, 0x88, 0x89, 0x8B, 0x8B, 0x8A, 0x8A, 0x88, 0x84, 0x7F, 0x78, 0x6A, 0x52, 0x33, 0x1B, 0x0F, 0x0F, 0x17, 0x19, 0x14, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x2E, 0x58, 0x78, 0x88, 0x8C, 0x8F, 0x93, 0x95, 0x8F, 0x7E, 0x6D, 0x64, 0x6A, 0x78, 0x84, 0x87, 0x80, 0x7A, 0x77, 0x74, 0x71, 0x74, 0x7C, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8A, 0x8A, 0x89, 0x86, 0x81, 0x7C, 0x73, 0x60, 0x43, 0x28, 0x1A, 0x17, 0x19, 0x16, 0x0E, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x34, 0x5E, 0x7C, 0x8A, 0x8C, 0x8E, 0x91, 0x93, 0x8F, 0x80, 0x6F, 0x67, 0x6C, 0x7A, 0x81, 0x7D, 0x74, 0x72, 0x76, 0x7A, 0x76, 0x76, 0x7C, 0x84, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x87, 0x86, 0x84, 0x81, 0x7D, 0x79, 0x79, 0x77, 0x69, 0x50, 0x33, 0x22, 0x1B, 0x17, 0x0E, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C, 0x3E, 0x63, 0x7D, 0x88, 0x89, 0x8A, 0x8C, 0x8E, 0x8D, 0x87, 0x7C, 0x77, 0x7C, 0x82, 0x7E, 0x6F, 0x60, 0x5F, 0x6A, 0x78, 0x7B, 0x7C, 0x7F, 0x86, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8A, 0x87, 0x81, 0x7B, 0x74, 0x6F, 0x68, 0x67, 0x6B, 0x70, 0x68, 0x54, 0x37, 0x24, 0x1A, 0x11, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x21, 0x40, 0x5F, 0x72, 0x7A, 0x7B, 0x7B, 0x7C, 0x83, 0x88, 0x8A, 0x89, 0x87, 0x8B, 0x8B, 0x7F, 0x6B, 0x57, 0x54, 0x5F, 0x75, 0x81, 0x83, 0x82, 0x82, 0x84, 0x88, 0x8A, 0x8C, 0x8C, 0x8A, 0x83, 0x76, 0x67, 0x5A, 0x51, 0x49, 0x49, 0x53, 0x5E, 0x5D, 0x4D, 0x34, 0x21, 0x15, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x1C, 0x35, 0x4B, 0x57, 0x5B, 0x5B, 0x5C, 0x61, 0x6D, 0x7C, 0x87, 0x8B, 0x8D, 0x90, 0x90, 0x86, 0x71, 0x5C, 0x53, 0x5C, 0x71, 0x7F, 0x82, 0x7B, 0x74, 0x74, 0x7D, 0x86, 0x8B, 0x8C, 0x88, 0x7D, 0x68, 0x4D, 0x37, 0x2D, 0x27, 0x2A, 0x36, 0x45, 0x48, 0x3C, 0x27, 0x18, 0x0D, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1E, 0x2A, 0x2F, 0x30, 0x31, 0x32, 0x3B, 0x4F, 0x6B, 0x7E, 0x86, 0x88, 0x8D, 0x91, 0x8B, 0x7A, 0x62, 0x54, 0x56, 0x66, 0x75, 0x76, 0x69, 0x5D, 0x5D, 0x6A, 0x7D, 0x88, 0x8C, 0x85, 0x74, 0x57, 0x35, 0x1F, 0x14, 0x12, 0x16, 0x22, 0x2D, 0x2E, 0x24, 0x16, 0x0C, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0A, 0x10, 0x11, 0x11, 0x11, 0x13, 0x1F, 0x35, 0x58, 0x6F, 0x7A, 0x7D, 0x84, 0x8A, 0x85, 0x75, 0x5C, 0x4A, 0x46, 0x56, 0x68, 0x69, 0x58, 0x4B, 0x4B, 0x5D, 0x75, 0x84, 0x89, 0x81, 0x6A, 0x48, 0x26, 0x12, 0x0B, 0x0C, 0x11, 0x18, 0x1B, 0x1A, 0x11, 0x09, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x0E, 0x23, 0x44, 0x5A, 0x66, 0x6B, 0x72, 0x78, 0x74, 0x65, 0x4B, 0x36, 0x32, 0x44, 0x5A, 0x60, 0x52, 0x48, 0x4A, 0x5D, 0x74, 0x83, 0x87, 0x7E, 0x63, 0x3D, 0x1D, 0x0F, 0x0D, 0x12, 0x14, 0x14, 0x0F, 0x0B, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x17, 0x30, 0x46, 0x52, 0x56, 0x5A, 0x5C, 0x58, 0x4C, 0x38, 0x29, 0x26, 0x36, 0x4C, 0x56, 0x54, 0x51, 0x58, 0x6A, 0x7D, 0x87, 0x87, 0x7A, 0x5D, 0x37, 0x1C, 0x11, 0x12, 0x14, 0x12, 0x0D, 0x07, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x24, 0x38, 0x44, 0x46, 0x41, 0x3A, 0x36, 0x34, 0x2D, 0x22, 0x21, 0x2C, 0x40, 0x4F, 0x58, 0x62, 0x6F, 0x7E, 0x87, 0x8C, 0x86, 0x74, 0x56, 0x34, 0x1D, 0x13, 0x10, 0x0E, 0x0A, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0F, 0x21, 0x32, 0x3A, 0x37, 0x2B, 0x1F, 0x1B, 0x1F, 0x21, 0x1C, 0x1B, 0x25, 0x38, 0x4A, 0x5C, 0x6C, 0x7C, 0x88, 0x8E, 0x8D, 0x82, 0x6B, 0x49, 0x2A, 0x17, 0x0E, 0x09, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0E, 0x1D, 0x29, 0x2C, 0x26, 0x19, 0x0E, 0x0B, 0x0F, 0x11, 0x10, 0x10, 0x1A, 0x2E, 0x44, 0x57, 0x6A, 0x7B, 0x87, 0x8D, 0x89, 0x77, 0x5A, 0x36, 0x1C, 0x0D, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x13, 0x19, 0x19, 0x13, 0x0B, 0x05, 0x03, 0x04, 0x05, 0x05, 0x06, 0x0E, 0x1F, 0x33, 0x43, 0x52, 0x64, 0x76, 0x81, 0x7E, 0x66, 0x42, 0x22, 0x0E, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x0A, 0x0A, 0x06, 0x03, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x0E, 0x1A, 0x24, 0x2F, 0x41, 0x5A, 0x6A, 0x69, 0x50, 0x2B, 0x12, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x0D, 0x14, 0x21, 0x36, 0x49, 0x4B, 0x36, 0x1A, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x0C, 0x1A, 0x28, 0x2B, 0x1F, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x11, 0x14, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_BIG_2_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0xC0, 0x26, 0x85, 0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0xC0, 0x26, 0x85, 0x04, 0x0B, 0x11, 0x11, 0x0B, 0x04, 0xC0, 0x1A, 0x84,
+  0x01, 0x03, 0x04, 0x03, 0x02, 0x05, 0x87, 0x02, 0x0B, 0x19, 0x24, 0x24, 0x19, 0x0B, 0x02, 0xC0, 0x15, 0x82, 0x01, 0x02, 0x01, 0x01, 0x87, 0x04,
+  0x09, 0x0D, 0x0C, 0x09, 0x05, 0x02, 0x01, 0x01, 0x89, 0x01, 0x04, 0x11, 0x24, 0x30, 0x2F, 0x24, 0x11, 0x04, 0x01, 0xC0, 0x14, 0x99, 0x02, 0x05,
+  0x07, 0x06, 0x04, 0x03, 0x09, 0x13, 0x1B, 0x1D, 0x1A, 0x15, 0x0D, 0x07, 0x02, 0x01, 0x01, 0x05, 0x12, 0x25, 0x31, 0x2F, 0x24, 0x11, 0x04, 0x01,
+  0xC0, 0x13, 0x99, 0x02, 0x07, 0x0C, 0x10, 0x10, 0x0C, 0x0C, 0x14, 0x21, 0x2F, 0x35, 0x35, 0x2F, 0x23, 0x17, 0x0C, 0x05, 0x04, 0x07, 0x11, 0x1E,
+  0x27, 0x25, 0x19, 0x0B, 0x02, 0xC0, 0x12, 0x9A, 0x01, 0x05, 0x0C, 0x14, 0x1B, 0x1D, 0x1A, 0x1A, 0x24, 0x35, 0x46, 0x4F, 0x53, 0x50, 0x44, 0x32,
+  0x21, 0x13, 0x0D, 0x10, 0x18, 0x1C, 0x1A, 0x14, 0x0B, 0x04, 0x01, 0xC0, 0x0D, 0xA3, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x0E, 0x17, 0x20,
+  0x27, 0x2A, 0x2B, 0x34, 0x45, 0x54, 0x5F, 0x65, 0x65, 0x5F, 0x52, 0x3F, 0x29, 0x1E, 0x1E, 0x24, 0x21, 0x14, 0x0A, 0x03, 0x02, 0x02, 0x04, 0x04,
+  0x02, 0x01, 0xC0, 0x0B, 0xA5, 0x02, 0x04, 0x08, 0x0A, 0x0B, 0x0A, 0x09, 0x09, 0x0A, 0x0D, 0x14, 0x1F, 0x2B, 0x34, 0x38, 0x3E, 0x4A, 0x57, 0x5F,
+  0x67, 0x6C, 0x6D, 0x67, 0x57, 0x40, 0x2E, 0x27, 0x29, 0x21, 0x12, 0x06, 0x01, 0x04, 0x08, 0x0C, 0x0C, 0x08, 0x03, 0xC0, 0x09, 0xA8, 0x02, 0x04,
+  0x0A, 0x12, 0x1A, 0x1E, 0x20, 0x1E, 0x1C, 0x1B, 0x18, 0x16, 0x18, 0x1F, 0x2B, 0x37, 0x3F, 0x44, 0x48, 0x4E, 0x53, 0x5B, 0x66, 0x6E, 0x6F, 0x64,
+  0x4F, 0x36, 0x27, 0x23, 0x1A, 0x0D, 0x03, 0x02, 0x08, 0x12, 0x19, 0x19, 0x12, 0x08, 0x02, 0xC0, 0x08, 0xAD, 0x02, 0x07, 0x10, 0x1D, 0x2B, 0x37,
+  0x3C, 0x3C, 0x39, 0x36, 0x35, 0x31, 0x2A, 0x27, 0x29, 0x30, 0x3A, 0x47, 0x4E, 0x4E, 0x4C, 0x4B, 0x4C, 0x56, 0x64, 0x6B, 0x66, 0x54, 0x37, 0x25,
+  0x1F, 0x15, 0x0A, 0x03, 0x05, 0x0E, 0x1B, 0x25, 0x25, 0x1B, 0x0F, 0x05, 0x01, 0x01, 0x02, 0x01, 0xC0, 0x07, 0xAF, 0x02, 0x07, 0x13, 0x25, 0x38,
+  0x47, 0x50, 0x51, 0x4F, 0x4B, 0x49, 0x49, 0x47, 0x44, 0x41, 0x3E, 0x3F, 0x46, 0x56, 0x5F, 0x5E, 0x56, 0x4D, 0x46, 0x48, 0x51, 0x5D, 0x5D, 0x53,
+  0x3D, 0x2D, 0x25, 0x1B, 0x0E, 0x06, 0x07, 0x11, 0x20, 0x2C, 0x2D, 0x23, 0x14, 0x09, 0x05, 0x05, 0x06, 0x03, 0x01, 0xC0, 0x06, 0xB0, 0x01, 0x06,
+  0x13, 0x27, 0x3F, 0x52, 0x5D, 0x5F, 0x5C, 0x57, 0x54, 0x52, 0x53, 0x55, 0x58, 0x5B, 0x5A, 0x57, 0x5B, 0x69, 0x73, 0x73, 0x6A, 0x5B, 0x4B, 0x42,
+  0x42, 0x4A, 0x55, 0x56, 0x4C, 0x3F, 0x36, 0x2B, 0x1A, 0x0D, 0x0A, 0x12, 0x22, 0x2E, 0x2F, 0x26, 0x18, 0x0E, 0x0D, 0x0E, 0x0D, 0x08, 0x03, 0xC0,
+  0x06, 0xB0, 0x04, 0x10, 0x25, 0x40, 0x56, 0x64, 0x6B, 0x69, 0x64, 0x5E, 0x5B, 0x5A, 0x5B, 0x5F, 0x66, 0x6C, 0x6B, 0x69, 0x6D, 0x78, 0x82, 0x83,
+  0x7C, 0x6D, 0x59, 0x46, 0x3D, 0x3F, 0x4C, 0x5A, 0x5E, 0x59, 0x50, 0x40, 0x29, 0x17, 0x10, 0x14, 0x22, 0x2D, 0x2D, 0x24, 0x17, 0x11, 0x12, 0x15,
+  0x13, 0x0B, 0x04, 0xC0, 0x05, 0xB1, 0x01, 0x0A, 0x1D, 0x3A, 0x55, 0x67, 0x70, 0x73, 0x71, 0x6C, 0x68, 0x64, 0x63, 0x64, 0x68, 0x6E, 0x72, 0x71,
+  0x70, 0x74, 0x7D, 0x87, 0x8A, 0x86, 0x7D, 0x6A, 0x53, 0x41, 0x3A, 0x43, 0x58, 0x66, 0x69, 0x60, 0x4D, 0x32, 0x1E, 0x15, 0x16, 0x20, 0x27, 0x24,
+  0x1B, 0x10, 0x0D, 0x12, 0x17, 0x15, 0x0D, 0x04, 0xC0, 0x05, 0xB1, 0x04, 0x13, 0x2C, 0x4C, 0x64, 0x71, 0x75, 0x75, 0x73, 0x70, 0x6D, 0x69, 0x68,
+  0x69, 0x6D, 0x70, 0x71, 0x6F, 0x6D, 0x71, 0x7C, 0x86, 0x8B, 0x8A, 0x86, 0x78, 0x60, 0x47, 0x3A, 0x40, 0x54, 0x68, 0x70, 0x65, 0x4F, 0x31, 0x1D,
+  0x14, 0x16, 0x1D, 0x21, 0x1C, 0x12, 0x09, 0x07, 0x0C, 0x13, 0x14, 0x0D, 0x05, 0xC0, 0x04, 0xB3, 0x01, 0x0A, 0x1D, 0x3B, 0x59, 0x6C, 0x74, 0x73,
+  0x71, 0x6E, 0x6C, 0x6B, 0x69, 0x68, 0x69, 0x6B, 0x6C, 0x6C, 0x6A, 0x69, 0x6D, 0x77, 0x82, 0x89, 0x8B, 0x8A, 0x80, 0x6C, 0x52, 0x44, 0x48, 0x59,
+  0x6D, 0x72, 0x65, 0x4C, 0x32, 0x20, 0x18, 0x18, 0x1C, 0x1C, 0x17, 0x0E, 0x07, 0x04, 0x08, 0x0F, 0x13, 0x0F, 0x07, 0x01, 0xC0, 0x04, 0xB3, 0x01,
+  0x0D, 0x24, 0x45, 0x60, 0x6F, 0x73, 0x6E, 0x6B, 0x69, 0x68, 0x67, 0x65, 0x64, 0x63, 0x64, 0x66, 0x67, 0x67, 0x67, 0x6B, 0x74, 0x80, 0x88, 0x8C,
+  0x8B, 0x85, 0x76, 0x62, 0x58, 0x5B, 0x69, 0x77, 0x76, 0x67, 0x4E, 0x39, 0x29, 0x20, 0x1D, 0x1C, 0x1A, 0x15, 0x0F, 0x09, 0x05, 0x06, 0x0D, 0x14,
+  0x13, 0x0A, 0x03, 0xC0, 0x04, 0xB3, 0x02, 0x0F, 0x28, 0x4C, 0x65, 0x70, 0x6F, 0x6A, 0x67, 0x66, 0x66, 0x64, 0x5F, 0x5B, 0x59, 0x5B, 0x5F, 0x64,
+  0x66, 0x66, 0x6A, 0x73, 0x7F, 0x88, 0x8C, 0x8A, 0x84, 0x76, 0x69, 0x65, 0x6D, 0x79, 0x80, 0x79, 0x68, 0x51, 0x3D, 0x2F, 0x26, 0x22, 0x24, 0x23,
+  0x1F, 0x1C, 0x15, 0x0D, 0x09, 0x0D, 0x16, 0x15, 0x0C, 0x04, 0xC0, 0x04, 0xB3, 0x03, 0x12, 0x2C, 0x50, 0x68, 0x70, 0x6C, 0x68, 0x66, 0x66, 0x64,
+  0x60, 0x56, 0x4E, 0x4A, 0x4E, 0x56, 0x60, 0x64, 0x66, 0x6B, 0x74, 0x80, 0x88, 0x8B, 0x87, 0x7B, 0x6C, 0x64, 0x67, 0x74, 0x7F, 0x7F, 0x72, 0x5E,
+  0x4A, 0x38, 0x2D, 0x2A, 0x2F, 0x37, 0x3A, 0x37, 0x33, 0x2B, 0x1B, 0x10, 0x0F, 0x16, 0x15, 0x0C, 0x04, 0xC0, 0x04, 0xB3, 0x06, 0x17, 0x34, 0x56,
+  0x6A, 0x6F, 0x69, 0x66, 0x66, 0x65, 0x62, 0x5C, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x5C, 0x63, 0x67, 0x6D, 0x77, 0x82, 0x88, 0x89, 0x7F, 0x6D, 0x5B,
+  0x55, 0x5E, 0x71, 0x7A, 0x73, 0x61, 0x4A, 0x39, 0x31, 0x31, 0x38, 0x46, 0x55, 0x5D, 0x5B, 0x52, 0x40, 0x28, 0x17, 0x11, 0x15, 0x12, 0x0A, 0x03,
+  0xC0, 0x04, 0xB3, 0x0A, 0x1F, 0x41, 0x60, 0x6E, 0x6F, 0x69, 0x66, 0x66, 0x65, 0x62, 0x5C, 0x4F, 0x44, 0x3F, 0x44, 0x4F, 0x5C, 0x63, 0x69, 0x71,
+  0x7C, 0x86, 0x8A, 0x87, 0x79, 0x63, 0x53, 0x4D, 0x57, 0x68, 0x6D, 0x60, 0x48, 0x39, 0x32, 0x36, 0x40, 0x50, 0x63, 0x70, 0x77, 0x73, 0x66, 0x4D,
+  0x2F, 0x1C, 0x14, 0x13, 0x0E, 0x06, 0x01, 0xC0, 0x03, 0xB3, 0x03, 0x11, 0x2C, 0x52, 0x6F, 0x77, 0x73, 0x6B, 0x67, 0x66, 0x66, 0x64, 0x60, 0x56,
+  0x4E, 0x4A, 0x4E, 0x57, 0x60, 0x67, 0x6D, 0x76, 0x80, 0x88, 0x8A, 0x87, 0x79, 0x64, 0x55, 0x50, 0x58, 0x5F, 0x59, 0x47, 0x38, 0x32, 0x37, 0x47,
+  0x5B, 0x6C, 0x77, 0x80, 0x84, 0x7E, 0x70, 0x54, 0x34, 0x1F, 0x15, 0x11, 0x0A, 0x03, 0xC0, 0x03, 0xB3, 0x06, 0x18, 0x38, 0x5F, 0x7A, 0x80, 0x7B,
+  0x6F, 0x69, 0x66, 0x66, 0x66, 0x64, 0x5F, 0x5A, 0x58, 0x5B, 0x61, 0x67, 0x6C, 0x72, 0x79, 0x81, 0x87, 0x89, 0x88, 0x80, 0x70, 0x62, 0x5C, 0x5C,
+  0x55, 0x45, 0x37, 0x32, 0x38, 0x48, 0x61, 0x74, 0x7C, 0x7F, 0x80, 0x80, 0x7D, 0x72, 0x59, 0x37, 0x20, 0x14, 0x0E, 0x06, 0x01, 0xC0, 0x02, 0xB3,
+  0x01, 0x09, 0x1C, 0x3C, 0x61, 0x7A, 0x81, 0x7E, 0x74, 0x6D, 0x69, 0x68, 0x67, 0x66, 0x65, 0x63, 0x61, 0x62, 0x67, 0x6C, 0x71, 0x74, 0x79, 0x7D,
+  0x82, 0x85, 0x88, 0x86, 0x7F, 0x76, 0x6B, 0x5C, 0x49, 0x39, 0x33, 0x38, 0x48, 0x62, 0x77, 0x82, 0x82, 0x7B, 0x74, 0x70, 0x70, 0x6B, 0x57, 0x38,
+  0x20, 0x12, 0x0A, 0x03, 0xC0, 0x03, 0xB2, 0x06, 0x18, 0x36, 0x58, 0x6E, 0x76, 0x76, 0x72, 0x70, 0x6E, 0x6C, 0x6B, 0x6A, 0x69, 0x66, 0x62, 0x60,
+  0x63, 0x6A, 0x71, 0x73, 0x74, 0x75, 0x77, 0x7C, 0x83, 0x88, 0x87, 0x83, 0x75, 0x5E, 0x48, 0x3A, 0x3B, 0x48, 0x62, 0x78, 0x84, 0x85, 0x7C, 0x6C,
+  0x5D, 0x55, 0x58, 0x5B, 0x51, 0x39, 0x1F, 0x0F, 0x06, 0x01, 0xC0, 0x03, 0xB1, 0x02, 0x0E, 0x25, 0x44, 0x58, 0x61, 0x63, 0x69, 0x70, 0x75, 0x75,
+  0x74, 0x72, 0x70, 0x69, 0x5E, 0x56, 0x58, 0x61, 0x69, 0x6B, 0x69, 0x68, 0x68, 0x6D, 0x79, 0x84, 0x89, 0x88, 0x7D, 0x69, 0x53, 0x48, 0x4F, 0x62,
+  0x77, 0x85, 0x89, 0x86, 0x78, 0x63, 0x50, 0x46, 0x46, 0x4D, 0x4A, 0x38, 0x1E, 0x0C, 0x03, 0xC0, 0x04, 0xB0, 0x06, 0x15, 0x2B, 0x3F, 0x49, 0x50,
+  0x5D, 0x6D, 0x7A, 0x80, 0x80, 0x7E, 0x79, 0x6C, 0x5A, 0x4D, 0x4B, 0x52, 0x5A, 0x5C, 0x5A, 0x5A, 0x5A, 0x60, 0x6D, 0x7D, 0x87, 0x8B, 0x86, 0x79,
+  0x68, 0x62, 0x66, 0x74, 0x83, 0x8A, 0x8B, 0x87, 0x7A, 0x64, 0x4F, 0x42, 0x41, 0x4A, 0x49, 0x38, 0x1C, 0x0A, 0x02, 0xC0, 0x04, 0xB0, 0x02, 0x0A,
+  0x19, 0x2C, 0x3B, 0x46, 0x56, 0x6C, 0x7F, 0x88, 0x88, 0x82, 0x7A, 0x6A, 0x56, 0x47, 0x43, 0x46, 0x4A, 0x4B, 0x4C, 0x4E, 0x50, 0x57, 0x63, 0x76,
+  0x84, 0x8B, 0x8A, 0x85, 0x7C, 0x75, 0x73, 0x7B, 0x84, 0x8A, 0x8C, 0x8A, 0x81, 0x6F, 0x58, 0x4A, 0x48, 0x51, 0x4F, 0x3B, 0x1E, 0x0B, 0x03, 0xC0,
+  0x04, 0xB1, 0x01, 0x05, 0x11, 0x24, 0x37, 0x47, 0x59, 0x70, 0x83, 0x8B, 0x88, 0x7C, 0x71, 0x60, 0x4F, 0x43, 0x3F, 0x3F, 0x41, 0x41, 0x43, 0x45,
+  0x48, 0x4C, 0x56, 0x6A, 0x7D, 0x88, 0x8C, 0x8A, 0x85, 0x7D, 0x76, 0x78, 0x81, 0x88, 0x8B, 0x8C, 0x87, 0x7B, 0x69, 0x59, 0x52, 0x55, 0x4D, 0x3C,
+  0x22, 0x10, 0x07, 0x02, 0xC0, 0x05, 0xB1, 0x03, 0x0E, 0x23, 0x3D, 0x53, 0x67, 0x7B, 0x8A, 0x8D, 0x86, 0x74, 0x62, 0x52, 0x47, 0x40, 0x3E, 0x3E,
+  0x3E, 0x3F, 0x40, 0x41, 0x40, 0x40, 0x47, 0x58, 0x70, 0x82, 0x8A, 0x8B, 0x88, 0x80, 0x79, 0x79, 0x81, 0x88, 0x8A, 0x8B, 0x88, 0x7F, 0x6E, 0x5C,
+  0x50, 0x49, 0x40, 0x32, 0x22, 0x17, 0x0E, 0x06, 0x01, 0xC0, 0x05, 0xB1, 0x02, 0x0E, 0x24, 0x44, 0x60, 0x77, 0x87, 0x92, 0x92, 0x88, 0x73, 0x5D,
+  0x4B, 0x42, 0x40, 0x40, 0x41, 0x43, 0x45, 0x45, 0x42, 0x3B, 0x34, 0x37, 0x46, 0x5F, 0x78, 0x86, 0x8A, 0x88, 0x82, 0x7D, 0x7D, 0x81, 0x82, 0x82,
+  0x83, 0x82, 0x79, 0x67, 0x4F, 0x3C, 0x2E, 0x25, 0x1E, 0x1C, 0x1A, 0x14, 0x0B, 0x03, 0xC0, 0x05, 0xB2, 0x02, 0x0C, 0x21, 0x40, 0x62, 0x7B, 0x8C,
+  0x94, 0x96, 0x8E, 0x7B, 0x62, 0x4F, 0x47, 0x46, 0x49, 0x4C, 0x51, 0x53, 0x50, 0x48, 0x3C, 0x2F, 0x2F, 0x3C, 0x54, 0x6F, 0x80, 0x87, 0x82, 0x7B,
+  0x7A, 0x7B, 0x7A, 0x73, 0x6F, 0x72, 0x74, 0x6B, 0x5B, 0x3F, 0x28, 0x19, 0x11, 0x0E, 0x13, 0x19, 0x18, 0x11, 0x08, 0x02, 0xC0, 0x06, 0xB2, 0x05,
+  0x16, 0x31, 0x57, 0x75, 0x89, 0x93, 0x96, 0x92, 0x85, 0x6F, 0x5D, 0x56, 0x57, 0x5A, 0x5F, 0x63, 0x64, 0x5D, 0x51, 0x42, 0x34, 0x31, 0x3D, 0x55,
+  0x6F, 0x7F, 0x81, 0x78, 0x6E, 0x6D, 0x72, 0x6F, 0x66, 0x5F, 0x63, 0x6A, 0x67, 0x5B, 0x42, 0x2A, 0x19, 0x0E, 0x08, 0x0C, 0x14, 0x19, 0x17, 0x0E,
+  0x07, 0x02, 0xC0, 0x06, 0xB3, 0x02, 0x0C, 0x21, 0x44, 0x68, 0x81, 0x90, 0x95, 0x95, 0x8C, 0x7D, 0x71, 0x6D, 0x6E, 0x6F, 0x71, 0x72, 0x71, 0x67,
+  0x5A, 0x4C, 0x40, 0x3E, 0x49, 0x60, 0x76, 0x81, 0x80, 0x73, 0x69, 0x68, 0x6E, 0x6E, 0x65, 0x5E, 0x62, 0x6B, 0x6D, 0x66, 0x54, 0x3E, 0x28, 0x16,
+  0x0B, 0x08, 0x0E, 0x17, 0x1A, 0x16, 0x0D, 0x05, 0x01, 0xC0, 0x07, 0xB2, 0x07, 0x1A, 0x3D, 0x62, 0x7E, 0x8D, 0x93, 0x96, 0x92, 0x89, 0x81, 0x7C,
+  0x7D, 0x7C, 0x7E, 0x7D, 0x79, 0x70, 0x62, 0x56, 0x4D, 0x4E, 0x5A, 0x6F, 0x80, 0x87, 0x83, 0x78, 0x6E, 0x6E, 0x75, 0x78, 0x73, 0x6E, 0x70, 0x76,
+  0x77, 0x73, 0x68, 0x54, 0x3A, 0x21, 0x0F, 0x07, 0x09, 0x13, 0x1A, 0x19, 0x10, 0x06, 0x02, 0xC0, 0x07, 0xB2, 0x09, 0x1D, 0x40, 0x65, 0x7F, 0x8C,
+  0x92, 0x96, 0x95, 0x8F, 0x88, 0x7F, 0x7D, 0x7E, 0x83, 0x84, 0x82, 0x79, 0x6C, 0x60, 0x59, 0x5C, 0x69, 0x7A, 0x86, 0x8A, 0x88, 0x83, 0x7D, 0x7D,
+  0x81, 0x85, 0x84, 0x81, 0x82, 0x81, 0x7F, 0x7A, 0x73, 0x61, 0x45, 0x28, 0x13, 0x09, 0x0A, 0x13, 0x1A, 0x18, 0x0F, 0x06, 0x01, 0xC0, 0x06, 0xB2,
+  0x02, 0x0D, 0x27, 0x4D, 0x70, 0x84, 0x8D, 0x91, 0x95, 0x96, 0x90, 0x84, 0x76, 0x70, 0x74, 0x7F, 0x86, 0x87, 0x81, 0x78, 0x6D, 0x67, 0x68, 0x71,
+  0x7D, 0x87, 0x8B, 0x8B, 0x8A, 0x88, 0x88, 0x89, 0x8B, 0x8B, 0x8A, 0x8A, 0x88, 0x84, 0x7F, 0x78, 0x6A, 0x52, 0x33, 0x1B, 0x0F, 0x0F, 0x17, 0x19,
+  0x14, 0x0B, 0x03, 0xC0, 0x06, 0xB2, 0x02, 0x10, 0x2E, 0x58, 0x78, 0x88, 0x8C, 0x8F, 0x93, 0x95, 0x8F, 0x7E, 0x6D, 0x64, 0x6A, 0x78, 0x84, 0x87,
+  0x80, 0x7A, 0x77, 0x74, 0x71, 0x74, 0x7C, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8A, 0x8A, 0x89, 0x86, 0x81, 0x7C, 0x73, 0x60,
+  0x43, 0x28, 0x1A, 0x17, 0x19, 0x16, 0x0E, 0x06, 0x01, 0xC0, 0x06, 0xB1, 0x04, 0x14, 0x34, 0x5E, 0x7C, 0x8A, 0x8C, 0x8E, 0x91, 0x93, 0x8F, 0x80,
+  0x6F, 0x67, 0x6C, 0x7A, 0x81, 0x7D, 0x74, 0x72, 0x76, 0x7A, 0x76, 0x76, 0x7C, 0x84, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8A, 0x87, 0x86, 0x84,
+  0x81, 0x7D, 0x79, 0x79, 0x77, 0x69, 0x50, 0x33, 0x22, 0x1B, 0x17, 0x0E, 0x07, 0x02, 0xC0, 0x06, 0xB0, 0x08, 0x1C, 0x3E, 0x63, 0x7D, 0x88, 0x89,
+  0x8A, 0x8C, 0x8E, 0x8D, 0x87, 0x7C, 0x77, 0x7C, 0x82, 0x7E, 0x6F, 0x60, 0x5F, 0x6A, 0x78, 0x7B, 0x7C, 0x7F, 0x86, 0x89, 0x8B, 0x8C, 0x8C, 0x8C,
+  0x8A, 0x87, 0x81, 0x7B, 0x74, 0x6F, 0x68, 0x67, 0x6B, 0x70, 0x68, 0x54, 0x37, 0x24, 0x1A, 0x11, 0x08, 0x02, 0xC0, 0x05, 0xB0, 0x02, 0x0C, 0x21,
+  0x40, 0x5F, 0x72, 0x7A, 0x7B, 0x7B, 0x7C, 0x83, 0x88, 0x8A, 0x89, 0x87, 0x8B, 0x8B, 0x7F, 0x6B, 0x57, 0x54, 0x5F, 0x75, 0x81, 0x83, 0x82, 0x82,
+  0x84, 0x88, 0x8A, 0x8C, 0x8C, 0x8A, 0x83, 0x76, 0x67, 0x5A, 0x51, 0x49, 0x49, 0x53, 0x5E, 0x5D, 0x4D, 0x34, 0x21, 0x15, 0x0B, 0x03, 0xC0, 0x05,
+  0xB0, 0x02, 0x0A, 0x1C, 0x35, 0x4B, 0x57, 0x5B, 0x5B, 0x5C, 0x61, 0x6D, 0x7C, 0x87, 0x8B, 0x8D, 0x90, 0x90, 0x86, 0x71, 0x5C, 0x53, 0x5C, 0x71,
+  0x7F, 0x82, 0x7B, 0x74, 0x74, 0x7D, 0x86, 0x8B, 0x8C, 0x88, 0x7D, 0x68, 0x4D, 0x37, 0x2D, 0x27, 0x2A, 0x36, 0x45, 0x48, 0x3C, 0x27, 0x18, 0x0D,
+  0x06, 0x01, 0xC0, 0x06, 0xAE, 0x04, 0x10, 0x1E, 0x2A, 0x2F, 0x30, 0x31, 0x32, 0x3B, 0x4F, 0x6B, 0x7E, 0x86, 0x88, 0x8D, 0x91, 0x8B, 0x7A, 0x62,
+  0x54, 0x56, 0x66, 0x75, 0x76, 0x69, 0x5D, 0x5D, 0x6A, 0x7D, 0x88, 0x8C, 0x85, 0x74, 0x57, 0x35, 0x1F, 0x14, 0x12, 0x16, 0x22, 0x2D, 0x2E, 0x24,
+  0x16, 0x0C, 0x06, 0x02, 0xC0, 0x06, 0xAD, 0x01, 0x05, 0x0A, 0x10, 0x11, 0x11, 0x11, 0x13, 0x1F, 0x35, 0x58, 0x6F, 0x7A, 0x7D, 0x84, 0x8A, 0x85,
+  0x75, 0x5C, 0x4A, 0x46, 0x56, 0x68, 0x69, 0x58, 0x4B, 0x4B, 0x5D, 0x75, 0x84, 0x89, 0x81, 0x6A, 0x48, 0x26, 0x12, 0x0B, 0x0C, 0x11, 0x18, 0x1B,
+  0x1A, 0x11, 0x09, 0x04, 0x02, 0xC0, 0x07, 0xAB, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x0E, 0x23, 0x44, 0x5A, 0x66, 0x6B, 0x72, 0x78, 0x74,
+  0x65, 0x4B, 0x36, 0x32, 0x44, 0x5A, 0x60, 0x52, 0x48, 0x4A, 0x5D, 0x74, 0x83, 0x87, 0x7E, 0x63, 0x3D, 0x1D, 0x0F, 0x0D, 0x12, 0x14, 0x14, 0x0F,
+  0x0B, 0x06, 0x03, 0x01, 0xC0, 0x0E, 0xA2, 0x06, 0x17, 0x30, 0x46, 0x52, 0x56, 0x5A, 0x5C, 0x58, 0x4C, 0x38, 0x29, 0x26, 0x36, 0x4C, 0x56, 0x54,
+  0x51, 0x58, 0x6A, 0x7D, 0x87, 0x87, 0x7A, 0x5D, 0x37, 0x1C, 0x11, 0x12, 0x14, 0x12, 0x0D, 0x07, 0x03, 0x02, 0xC0, 0x0E, 0xA0, 0x04, 0x10, 0x24,
+  0x38, 0x44, 0x46, 0x41, 0x3A, 0x36, 0x34, 0x2D, 0x22, 0x21, 0x2C, 0x40, 0x4F, 0x58, 0x62, 0x6F, 0x7E, 0x87, 0x8C, 0x86, 0x74, 0x56, 0x34, 0x1D,
+  0x13, 0x10, 0x0E, 0x0A, 0x06, 0x02, 0xC0, 0x0D, 0xA0, 0x01, 0x05, 0x0F, 0x21, 0x32, 0x3A, 0x37, 0x2B, 0x1F, 0x1B, 0x1F, 0x21, 0x1C, 0x1B, 0x25,
+  0x38, 0x4A, 0x5C, 0x6C, 0x7C, 0x88, 0x8E, 0x8D, 0x82, 0x6B, 0x49, 0x2A, 0x17, 0x0E, 0x09, 0x06, 0x03, 0x02, 0xC0, 0x0D, 0x9E, 0x01, 0x04, 0x0E,
+  0x1D, 0x29, 0x2C, 0x26, 0x19, 0x0E, 0x0B, 0x0F, 0x11, 0x10, 0x10, 0x1A, 0x2E, 0x44, 0x57, 0x6A, 0x7B, 0x87, 0x8D, 0x89, 0x77, 0x5A, 0x36, 0x1C,
+  0x0D, 0x06, 0x03, 0x02, 0xC0, 0x0E, 0x9B, 0x02, 0x08, 0x13, 0x19, 0x19, 0x13, 0x0B, 0x05, 0x03, 0x04, 0x05, 0x05, 0x06, 0x0E, 0x1F, 0x33, 0x43,
+  0x52, 0x64, 0x76, 0x81, 0x7E, 0x66, 0x42, 0x22, 0x0E, 0x04, 0x02, 0xC0, 0x0F, 0x86, 0x03, 0x08, 0x0A, 0x0A, 0x06, 0x03, 0x01, 0x01, 0x90, 0x01,
+  0x01, 0x01, 0x05, 0x0E, 0x1A, 0x24, 0x2F, 0x41, 0x5A, 0x6A, 0x69, 0x50, 0x2B, 0x12, 0x04, 0x01, 0xC0, 0x10, 0x83, 0x02, 0x02, 0x02, 0x01, 0x06,
+  0x8C, 0x01, 0x04, 0x08, 0x0D, 0x14, 0x21, 0x36, 0x49, 0x4B, 0x36, 0x1A, 0x08, 0x01, 0xC0, 0x1D, 0x89, 0x01, 0x01, 0x04, 0x0C, 0x1A, 0x28, 0x2B,
+  0x1F, 0x0C, 0x02, 0xC0, 0x20, 0x85, 0x02, 0x09, 0x11, 0x14, 0x0D, 0x05, 0xC0, 0x21, 0x84, 0x02, 0x04, 0x05, 0x04, 0x01, 0xC0, 0x23, 0x80, 0x01,
+  0xC0, 0xC0, 0xC0, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_BIG_2_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1080, 0x1060,
+  0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0820, 0x0820, 0x0820, 0x0840, 0x1881, 0x18A1, 0x20C1, 0x20C1,
+  0x18A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840,
+  0x1040, 0x1060, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x20E1, 0x20C1, 0x1081, 0x0840, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1040, 0x1060, 0x1060, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x20E1, 0x20E1,
+  0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0820, 0x0840, 0x1060, 0x1080, 0x1080, 0x1060, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x1061, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0840,
+  0x1060, 0x1880, 0x1881, 0x1881, 0x1080, 0x1060, 0x1081, 0x18A1, 0x20C1, 0x18C1, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1040, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x1060, 0x1061, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1040, 0x1060, 0x1880, 0x1880, 0x1880, 0x1881, 0x1060, 0x1061, 0x1081, 0x1881, 0x18A1, 0x1881, 0x1060, 0x0820, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1060, 0x1060, 0x1060, 0x1881, 0x1880, 0x1880, 0x1880,
+  0x1080, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1881, 0x1080, 0x1081, 0x1061, 0x1881, 0x1881, 0x1881, 0x1060, 0x0840,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x1880, 0x1060, 0x0840, 0x1060, 0x1881, 0x1881,
+  0x1880, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1080, 0x1880, 0x18A0, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x18A1, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A0, 0x1881, 0x1060, 0x0840, 0x1040,
+  0x1060, 0x1880, 0x1880, 0x1080, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A0, 0x1880, 0x1880, 0x18A1, 0x18A1, 0x1881,
+  0x1880, 0x1880, 0x1880, 0x1881, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x18A1, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1,
+  0x1060, 0x1040, 0x0840, 0x1060, 0x1880, 0x1880, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x18A1,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x20A0, 0x20A1, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1060, 0x1060, 0x1080, 0x1880, 0x18A0, 0x1880, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820,
+  0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x1080, 0x1880, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x18A0, 0x18A1, 0x1880,
+  0x1060, 0x0840, 0x0840, 0x0820, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x1080, 0x1880, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1060, 0x1880,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x20A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1,
+  0x20A1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1040, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1080, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x18A1, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060,
+  0x1060, 0x1880, 0x1880, 0x18A0, 0x1880, 0x1881, 0x1060, 0x1060, 0x1040, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840,
+  0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A1, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x18A0, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x1880, 0x1860, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1040, 0x1060, 0x1060, 0x1080, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x1060, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881,
+  0x18A1, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1060, 0x1060, 0x0840,
+  0x1060, 0x1060, 0x1880, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x20A1, 0x18A0, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x18A0, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1860, 0x1860, 0x1880, 0x1880,
+  0x1060, 0x1060, 0x0840, 0x1060, 0x1060, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1880, 0x20A1, 0x20A1, 0x18A0, 0x18A1, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x18A0, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x0840, 0x1060, 0x1060, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1860, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x18A0, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x18A0, 0x18A0, 0x18A0,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x18A1,
+  0x1860, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040,
+  0x1060, 0x1060, 0x1060, 0x1880, 0x18A0, 0x18A0, 0x20A0, 0x18A0, 0x18A0, 0x1880, 0x1880, 0x1060, 0x1060, 0x1860, 0x1880, 0x1880,
+  0x1880, 0x1880, 0x1881, 0x18A0, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1080, 0x1060, 0x1880, 0x1880, 0x18A0, 0x20A1,
+  0x20A1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x0840, 0x1040, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x0840, 0x0840, 0x1060, 0x1860, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1060, 0x1040, 0x0840, 0x1060, 0x1880,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1880, 0x1880, 0x18A0, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x0840, 0x1040, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x1060, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x1060, 0x1040, 0x1040, 0x1060,
+  0x1060, 0x1880, 0x18A1, 0x1880, 0x1880, 0x1881, 0x1881, 0x20A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x18A0,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x1040, 0x1040, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1040, 0x1860, 0x1881, 0x18A1, 0x20A1, 0x20C1, 0x18A1, 0x1881, 0x1080, 0x1060, 0x1060,
+  0x1060, 0x1081, 0x1881, 0x1881, 0x1881, 0x1881, 0x1880, 0x1881, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A0,
+  0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1080, 0x1060, 0x1040, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1880, 0x1881, 0x18A1, 0x20A1, 0x20C1, 0x18A1, 0x1880, 0x1881, 0x1061,
+  0x1061, 0x1081, 0x1881, 0x1881, 0x1881, 0x1081, 0x1081, 0x1060, 0x1060, 0x1881, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x18A0, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1860, 0x1060, 0x0840, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1081, 0x1881, 0x1881, 0x1081, 0x1060, 0x1060, 0x0840, 0x1060, 0x1880, 0x1880, 0x20A1, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A0,
+  0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1080, 0x1060, 0x0840, 0x0840, 0x1040, 0x1060, 0x1880,
+  0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A0, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x18A1, 0x18A1, 0x20A1,
+  0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1881, 0x1880, 0x1060, 0x1040, 0x0840, 0x1040,
+  0x1060, 0x1880, 0x20A1, 0x20A1, 0x1880, 0x1860, 0x1860, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x18A1, 0x1081, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060,
+  0x1881, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1881, 0x18A1, 0x1881,
+  0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x20A1, 0x18A1, 0x1860, 0x1060, 0x1060, 0x1860, 0x1880, 0x1880, 0x1880, 0x1881, 0x20A1,
+  0x20C1, 0x20A1, 0x1081, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0840, 0x1881, 0x20A1, 0x18A1, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A0,
+  0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1880, 0x1881, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1860, 0x1860, 0x1880, 0x1880, 0x1880,
+  0x1880, 0x18A1, 0x20C1, 0x28E1, 0x20E1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1881, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x18A1, 0x20A1, 0x20A1, 0x20A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x18A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x18A1,
+  0x20A1, 0x1880, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x28E1, 0x20E1, 0x18A1, 0x1060, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x20A1, 0x20A1, 0x20A1,
+  0x18A1, 0x20A1, 0x18A1, 0x20A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A0, 0x20A0, 0x20A1, 0x18A0, 0x18A0,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x28C1, 0x28E1,
+  0x20C1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881,
+  0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x18A0, 0x1880, 0x18A0,
+  0x18A0, 0x18A0, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x1881, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x1040, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x1880, 0x1880,
+  0x1881, 0x1880, 0x18A0, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0840, 0x1860, 0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x20A1,
+  0x1880, 0x1881, 0x1881, 0x1881, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x1881, 0x1061, 0x1060, 0x0840, 0x0840, 0x1060, 0x1880, 0x1880, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x18A1, 0x18A1,
+  0x20A1, 0x1880, 0x1881, 0x1080, 0x1881, 0x18A0, 0x20A1, 0x20A1, 0x18A0, 0x18A0, 0x18A0, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x20A1, 0x1080, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x18A1,
+  0x18A1, 0x1880, 0x1880, 0x1881, 0x1881, 0x1881, 0x18A0, 0x18A0, 0x1880, 0x1880, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x20A1, 0x20A1,
+  0x1880, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1860, 0x1880, 0x20A1, 0x20A1, 0x18A1, 0x18A1,
+  0x1880, 0x1060, 0x1060, 0x1060, 0x1080, 0x1880, 0x1880, 0x1880, 0x1060, 0x1060, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x18A1, 0x1060,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x0840, 0x0820,
+  0x0820, 0x0840, 0x1060, 0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x18A0, 0x20A1, 0x20A1, 0x1881, 0x1040, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1040, 0x0840, 0x0820, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x20A1, 0x20A1, 0x20A1,
+  0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x0840, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1880, 0x1880, 0x20A1,
+  0x20A1, 0x20A1, 0x18A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1880,
+  0x18A1, 0x20A1, 0x20A1, 0x18A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040,
+  0x1060, 0x1880, 0x1881, 0x18A1, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x1040,
+  0x1060, 0x1881, 0x1881, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_BIG_2_SPANS = {
+  SPRITE_DIRT_BIG_2_SPAN_ROWS, SPRITE_DIRT_BIG_2_SPAN_OPS, SPRITE_DIRT_BIG_2_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_BIG_2_ASSET = {
   SPRITE_DIRT_BIG_2_WIDTH, SPRITE_DIRT_BIG_2_HEIGHT,
-  SPRITE_DIRT_BIG_2_ALPHA, SPRITE_DIRT_BIG_2_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_BIG_2_SPANS
 };
 
 #endif // SPRITE_DIRT_BIG_2_INCLUDED
@@ -5,150 +5,282 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_big_3.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_big_3.png (64x64) — RGBA multi-couleur, encodé en spans
+// 2269/4096 pixels visibles, 7245 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_BIG_3_WIDTH = 64;
 constexpr uint16_t SPRITE_DIRT_BIG_3_HEIGHT = 64;
 
-const uint16_t SPRITE_DIRT_BIG_3_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1081, 0x1081, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x20C1, 0x2902, 0x2922, 0x20C1, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x1040, 0x20A1, 0x3122, 0x4183, 0x41A3, 0x3942, 0x28E1, 0x20A1, 0x1881, 0x1881, 0x1881, 0x1060, 0x0840, 0x0840, 0x0840, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x2902, 0x4183, 0x51E4, 0x51E4, 0x49A3, 0x4162, 0x3922, 0x3122, 0x3122, 0x3102, 0x28E1, 0x20C1, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x1881, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20C1, 0x3122, 0x49A3, 0x51E4, 0x5A04, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4182, 0x4162, 0x4162, 0x3922, 0x3122, 0x3102, 0x3922, 0x3922, 0x28E1, 0x20A1, 0x1860, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28E1, 0x3142, 0x3942, 0x3102, 0x28C1, 0x28C1, 0x3122, 0x4983, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4162, 0x4162, 0x3942, 0x3101, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28E1, 0x3942, 0x3942, 0x3102, 0x28C1, 0x28C1, 0x3122, 0x4162, 0x49A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x4982, 0x4162, 0x4162, 0x4162, 0x4162, 0x3942, 0x3922, 0x3101, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x20A1, 0x28E1, 0x3102, 0x28C1, 0x20A1, 0x28C1, 0x3102, 0x3942, 0x4162, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4982, 0x4982, 0x4982, 0x4162, 0x4142, 0x3942, 0x3121, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1881, 0x20A1, 0x20C1, 0x20C1, 0x28C1, 0x28E1, 0x3101, 0x3942, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4982, 0x4982, 0x4162, 0x4142, 0x3922, 0x3101, 0x20A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1881, 0x20A1, 0x20C1, 0x28E1, 0x3101, 0x3101, 0x3922, 0x4142, 0x4982, 0x51A3, 0x51C3, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4162, 0x3942, 0x3101, 0x28E1, 0x20A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x1060, 0x1881, 0x20A1, 0x20A1, 0x28C1, 0x3101, 0x3922, 0x3942, 0x3942, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4162, 0x4162, 0x3922, 0x3102, 0x28E1, 0x28C1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x28E1, 0x28E2, 0x28E1, 0x28E1, 0x2901, 0x3101, 0x3102, 0x3942, 0x4982, 0x4983, 0x4982, 0x49A3, 0x49A3, 0x51C3, 0x59E3, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x4162, 0x4142, 0x4142, 0x3942, 0x3942, 0x3922, 0x3102, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18A1, 0x3122, 0x4183, 0x4183, 0x4183, 0x4162, 0x4162, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4982, 0x4142, 0x3922, 0x3942, 0x4162, 0x4982, 0x4983, 0x4983, 0x4162, 0x3102, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x2902, 0x4183, 0x51E4, 0x5A04, 0x51E4, 0x51C3, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3922, 0x3921, 0x3922, 0x4142, 0x4982, 0x49A3, 0x49A3, 0x4982, 0x3122, 0x20A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20C1, 0x3962, 0x51E4, 0x5A24, 0x6224, 0x5A04, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x3922, 0x3101, 0x3922, 0x4142, 0x4982, 0x49A3, 0x49A3, 0x4162, 0x3122, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061, 0x2902, 0x49A3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x51E4, 0x51E3, 0x51E3, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3942, 0x3922, 0x3942, 0x4162, 0x4983, 0x49A3, 0x49A3, 0x4142, 0x3101, 0x20A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3122, 0x49C3, 0x5A24, 0x6224, 0x6224, 0x5A04, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x59E3, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4962, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4142, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x49A3, 0x3942, 0x28E1, 0x18A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3942, 0x51E4, 0x6224, 0x6244, 0x6224, 0x5A04, 0x51E4, 0x51E4, 0x5A04, 0x5A24, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3922, 0x3922, 0x3922, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4982, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x4983, 0x3922, 0x20C1, 0x1881, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18A1, 0x3942, 0x51C3, 0x6224, 0x6244, 0x6224, 0x5A04, 0x51E4, 0x51E4, 0x5A04, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4162, 0x3942, 0x3922, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51A3, 0x4162, 0x3102, 0x18A1, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x18A1, 0x3122, 0x49A3, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x51E4, 0x59E4, 0x5A04, 0x5A24, 0x5A04, 0x59E3, 0x51E3, 0x51E3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4142, 0x4162, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x49A3, 0x3942, 0x20C1, 0x1060, 0x1040, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3942, 0x49C3, 0x5A04, 0x5A04, 0x51E4, 0x51E3, 0x59E4, 0x5A04, 0x5A04, 0x59E3, 0x51E3, 0x51C3, 0x51E3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4182, 0x4982, 0x4982, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x4162, 0x3102, 0x1881, 0x0840, 0x0840, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x1881, 0x28E1, 0x3962, 0x51C3, 0x51E4, 0x51E3, 0x51E3, 0x59E4, 0x59E4, 0x59E3, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4982, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x49A3, 0x4983, 0x3942, 0x20C1, 0x1040, 0x0820, 0x0840, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0820, 0x0840, 0x1060, 0x20C1, 0x3122, 0x4983, 0x51C3, 0x51E3, 0x51E4, 0x59E4, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4982, 0x3122, 0x20A1, 0x1040, 0x0820, 0x0840, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1061, 0x1881, 0x1881, 0x1060, 0x1081, 0x18A1, 0x28C1, 0x3122, 0x4183, 0x51C3, 0x51E3, 0x59E4, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4142, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51E3, 0x51E3, 0x51E3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x3922, 0x28C1, 0x1881, 0x1060, 0x1060, 0x1881, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x2902, 0x3122, 0x3122, 0x2902, 0x28E2, 0x3102, 0x3122, 0x4163, 0x49A3, 0x51C3, 0x59E4, 0x59E4, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4982, 0x49A3, 0x49A3, 0x49A3, 0x4162, 0x4162, 0x4142, 0x4162, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x51E3, 0x59E3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E3, 0x51A3, 0x4182, 0x3942, 0x3102, 0x28C1, 0x20C1, 0x28C1, 0x20A1, 0x1880, 0x0840, 0x0020, 0x0000, 0x0820, 0x1040, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x3962, 0x4183, 0x4183, 0x4163, 0x3942, 0x3942, 0x3942, 0x3963, 0x41A3, 0x49C3, 0x51E4, 0x51E4, 0x59E3, 0x51E3, 0x51C3, 0x51A3, 0x49A3, 0x4982, 0x4982, 0x4982, 0x4982, 0x4982, 0x4162, 0x4142, 0x4142, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51E3, 0x59E3, 0x5A04, 0x6224, 0x6224, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4182, 0x3942, 0x3922, 0x3922, 0x3102, 0x28C1, 0x1881, 0x1060, 0x0840, 0x0840, 0x1060, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x4163, 0x49A3, 0x49A3, 0x4183, 0x3942, 0x3102, 0x2902, 0x3102, 0x3122, 0x3962, 0x4183, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4962, 0x4162, 0x4162, 0x4142, 0x3942, 0x3922, 0x3942, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4182, 0x4162, 0x3942, 0x3922, 0x3101, 0x20C1, 0x1081, 0x0840, 0x1060, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x3122, 0x3942, 0x4162, 0x3922, 0x28E1, 0x20A1, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x3102, 0x3962, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x3942, 0x3922, 0x3922, 0x3922, 0x4142, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4982, 0x4162, 0x4162, 0x4162, 0x4162, 0x3122, 0x20C1, 0x1060, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1040, 0x1040, 0x1040, 0x1060, 0x1881, 0x28C1, 0x3942, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4983, 0x4162, 0x4142, 0x3942, 0x3942, 0x4142, 0x4162, 0x4983, 0x51A3, 0x51C3, 0x51E3, 0x5A04, 0x6224, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x6224, 0x5A04, 0x51E3, 0x51C3, 0x49A3, 0x4162, 0x4162, 0x4162, 0x4982, 0x4982, 0x4162, 0x28E1, 0x1081, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x20A1, 0x1881, 0x1060, 0x1040, 0x1040, 0x1060, 0x1881, 0x20A1, 0x2902, 0x4162, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x4162, 0x4982, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4162, 0x4162, 0x4983, 0x51A3, 0x51A3, 0x4983, 0x3122, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x1881, 0x1881, 0x1880, 0x1881, 0x20A1, 0x28C1, 0x3102, 0x3922, 0x4162, 0x4983, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x49A3, 0x4982, 0x4982, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x3922, 0x18A1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x3102, 0x3942, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x3942, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1860, 0x1881, 0x1881, 0x18A1, 0x28C1, 0x3122, 0x4162, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x28E1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1880, 0x1060, 0x1060, 0x20A1, 0x3102, 0x4163, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4162, 0x3122, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1860, 0x1060, 0x1060, 0x1881, 0x3102, 0x4163, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4182, 0x4162, 0x3922, 0x2902, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1881, 0x28E2, 0x4162, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x3942, 0x28E1, 0x20A1, 0x1080, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840, 0x1040, 0x1880, 0x28E1, 0x3942, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6244, 0x6244, 0x6244, 0x6244, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4162, 0x3122, 0x28E1, 0x1881, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x1060, 0x20A1, 0x3922, 0x4183, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x6224, 0x6224, 0x6244, 0x6244, 0x6224, 0x6224, 0x5A04, 0x59E3, 0x51C3, 0x51A3, 0x4982, 0x3922, 0x20C1, 0x1081, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x3102, 0x3942, 0x3942, 0x3942, 0x4162, 0x4183, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E3, 0x5A04, 0x5A24, 0x6224, 0x6224, 0x5A24, 0x5A04, 0x59E3, 0x51C3, 0x51C3, 0x49A3, 0x4182, 0x3122, 0x18A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28C1, 0x28E1, 0x20C1, 0x20C1, 0x28E1, 0x3922, 0x4162, 0x4162, 0x4982, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4182, 0x3122, 0x20A1, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1860, 0x1060, 0x1040, 0x1040, 0x1881, 0x28C1, 0x3102, 0x3942, 0x4162, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4982, 0x3942, 0x2901, 0x20A1, 0x1061, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0820, 0x0000, 0x0020, 0x0840, 0x1881, 0x28E1, 0x3922, 0x4162, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x4983, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x3942, 0x3122, 0x28E1, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x28E1, 0x3942, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4983, 0x4183, 0x4983, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4983, 0x4183, 0x4163, 0x3942, 0x3102, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3102, 0x4142, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x4983, 0x4162, 0x3942, 0x3922, 0x3922, 0x3942, 0x4163, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4162, 0x4162, 0x4142, 0x3942, 0x3122, 0x3122, 0x28E1, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28E1, 0x3942, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4163, 0x3922, 0x28E1, 0x20A1, 0x20C1, 0x3102, 0x3942, 0x4983, 0x49A3, 0x51A3, 0x49A3, 0x4983, 0x4983, 0x4163, 0x4142, 0x3922, 0x28E2, 0x20C1, 0x18A1, 0x1881, 0x1061, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20A1, 0x3122, 0x4142, 0x4162, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x4142, 0x28E1, 0x1881, 0x1040, 0x1060, 0x20C1, 0x3122, 0x4162, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x4983, 0x4142, 0x3122, 0x28E1, 0x1881, 0x1040, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3942, 0x4162, 0x4983, 0x4983, 0x49A3, 0x51A3, 0x49A3, 0x49A3, 0x4983, 0x4983, 0x3942, 0x20C1, 0x1040, 0x0820, 0x1040, 0x20C1, 0x3122, 0x4162, 0x4182, 0x4983, 0x4983, 0x4983, 0x4162, 0x3122, 0x28C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20C1, 0x3122, 0x3942, 0x4162, 0x4162, 0x4163, 0x4163, 0x4162, 0x3942, 0x4162, 0x4163, 0x3142, 0x20A1, 0x1040, 0x0820, 0x1881, 0x28E1, 0x3942, 0x4142, 0x4162, 0x4162, 0x4983, 0x4162, 0x3942, 0x28E1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x28E1, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x28E1, 0x28E1, 0x3102, 0x3142, 0x3122, 0x18A1, 0x1040, 0x1040, 0x20A1, 0x3102, 0x3942, 0x3942, 0x3942, 0x4162, 0x4982, 0x4162, 0x3122, 0x20A1, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1881, 0x20C1, 0x20A1, 0x18A1, 0x1881, 0x1881, 0x1060, 0x1060, 0x18A1, 0x20E1, 0x20C1, 0x1881, 0x1040, 0x1060, 0x20C1, 0x3102, 0x3922, 0x3122, 0x3942, 0x4162, 0x4983, 0x4162, 0x3102, 0x1881, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1880, 0x1060, 0x1040, 0x1040, 0x0840, 0x0820, 0x0820, 0x1040, 0x1081, 0x1881, 0x1060, 0x0840, 0x1060, 0x18A1, 0x20C1, 0x28C1, 0x28E1, 0x3102, 0x3942, 0x4162, 0x3942, 0x28E1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x1040, 0x1060, 0x1060, 0x1040, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x20A1, 0x28E1, 0x3102, 0x28E1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1880, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0820, 0x0820, 0x0820, 0x0840, 0x1060, 0x1881, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_BIG_3_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 3, 0, 12, 6, 26, 17, 48, 36, 76, 61,
+  107, 89, 139, 118, 173, 149, 208, 181, 244, 214, 281, 248, 322, 286, 364, 325,
+  407, 365, 451, 406, 497, 449, 543, 492, 590, 536, 636, 579, 684, 624, 732, 669,
+  780, 714, 828, 759, 877, 805, 932, 855, 992, 912, 1053, 970, 1115, 1029, 1176, 1087,
+  1237, 1145, 1295, 1200, 1352, 1254, 1408, 1307, 1464, 1360, 1521, 1414, 1578, 1468, 1634, 1521,
+  1690, 1574, 1745, 1626, 1797, 1675, 1844, 1719, 1891, 1763, 1938, 1807, 1985, 1851, 2032, 1895,
+  2074, 1934, 2115, 1972, 2154, 2008, 2192, 2043, 2227, 2075, 2260, 2105, 2292, 2134, 2323, 2162,
+  2353, 2189, 2381, 2214, 2409, 2239, 2431, 2256, 2447, 2269, 2448, 2269, 2449, 2269, 2450, 2269
 };
 
-const uint8_t SPRITE_DIRT_BIG_3_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x09, 0x0E, 0x0E, 0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0C, 0x15, 0x1E, 0x1F, 0x17, 0x0E, 0x08, 0x07, 0x07, 0x06, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x12, 0x1A, 0x25, 0x2E, 0x2F, 0x29, 0x1E, 0x18, 0x16, 0x16, 0x13, 0x10, 0x0B, 0x07, 0x05, 0x05, 0x05, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x08, 0x0E, 0x18, 0x22, 0x2A, 0x31, 0x39, 0x3B, 0x39, 0x33, 0x2F, 0x2D, 0x2C, 0x29, 0x23, 0x1C, 0x15, 0x10, 0x0D, 0x0B, 0x08, 0x07, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x0C, 0x0F, 0x15, 0x21, 0x2B, 0x33, 0x38, 0x3E, 0x42, 0x45, 0x45, 0x42, 0x40, 0x3E, 0x3C, 0x38, 0x32, 0x2A, 0x20, 0x18, 0x13, 0x12, 0x12, 0x11, 0x0D, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0C, 0x11, 0x14, 0x17, 0x1F, 0x2A, 0x33, 0x3A, 0x41, 0x48, 0x4D, 0x4E, 0x4B, 0x49, 0x46, 0x44, 0x43, 0x40, 0x3C, 0x31, 0x25, 0x1E, 0x1E, 0x21, 0x21, 0x1B, 0x12, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0D, 0x11, 0x13, 0x14, 0x1A, 0x25, 0x32, 0x3D, 0x46, 0x4D, 0x4F, 0x4E, 0x4A, 0x47, 0x44, 0x43, 0x43, 0x44, 0x44, 0x3E, 0x34, 0x2B, 0x2B, 0x2E, 0x2E, 0x28, 0x1C, 0x0D, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0D, 0x10, 0x13, 0x17, 0x1E, 0x2A, 0x38, 0x43, 0x4A, 0x4D, 0x4C, 0x49, 0x44, 0x41, 0x3E, 0x3E, 0x3F, 0x41, 0x45, 0x46, 0x40, 0x38, 0x35, 0x34, 0x32, 0x2D, 0x20, 0x10, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x09, 0x0D, 0x12, 0x15, 0x1B, 0x24, 0x2D, 0x38, 0x41, 0x48, 0x49, 0x48, 0x46, 0x43, 0x40, 0x3D, 0x3B, 0x3B, 0x3C, 0x3D, 0x43, 0x48, 0x47, 0x40, 0x39, 0x34, 0x31, 0x2A, 0x1E, 0x0F, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x06, 0x0B, 0x13, 0x18, 0x1C, 0x22, 0x2E, 0x3C, 0x47, 0x4A, 0x49, 0x47, 0x44, 0x42, 0x41, 0x40, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x40, 0x46, 0x49, 0x44, 0x3D, 0x36, 0x34, 0x2E, 0x23, 0x18, 0x0E, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0C, 0x11, 0x14, 0x18, 0x21, 0x27, 0x2C, 0x35, 0x49, 0x59, 0x5E, 0x58, 0x4C, 0x44, 0x40, 0x3F, 0x3F, 0x3F, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x44, 0x4A, 0x49, 0x45, 0x42, 0x43, 0x40, 0x3A, 0x30, 0x20, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0F, 0x1E, 0x29, 0x2C, 0x30, 0x39, 0x3F, 0x45, 0x50, 0x63, 0x71, 0x6F, 0x62, 0x4E, 0x42, 0x3E, 0x3F, 0x3F, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x42, 0x49, 0x4D, 0x50, 0x57, 0x5D, 0x5F, 0x5E, 0x53, 0x3D, 0x20, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x1C, 0x32, 0x41, 0x44, 0x49, 0x53, 0x5C, 0x63, 0x6C, 0x79, 0x7F, 0x7B, 0x6B, 0x54, 0x45, 0x3F, 0x3F, 0x3F, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x45, 0x4D, 0x57, 0x64, 0x71, 0x79, 0x78, 0x6C, 0x51, 0x2E, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x2A, 0x42, 0x4E, 0x51, 0x57, 0x62, 0x6E, 0x76, 0x7C, 0x85, 0x89, 0x84, 0x75, 0x5E, 0x4B, 0x41, 0x3F, 0x3E, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x3A, 0x3B, 0x40, 0x48, 0x55, 0x67, 0x7B, 0x86, 0x86, 0x78, 0x5B, 0x35, 0x18, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x20, 0x37, 0x49, 0x50, 0x53, 0x59, 0x63, 0x6E, 0x76, 0x7E, 0x87, 0x8A, 0x88, 0x7D, 0x69, 0x53, 0x45, 0x41, 0x3F, 0x3D, 0x3C, 0x3C, 0x3C, 0x3D, 0x3F, 0x41, 0x40, 0x3F, 0x3E, 0x43, 0x50, 0x64, 0x7B, 0x87, 0x88, 0x77, 0x59, 0x35, 0x1A, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x12, 0x28, 0x3D, 0x49, 0x4B, 0x4D, 0x52, 0x5B, 0x63, 0x6A, 0x74, 0x80, 0x88, 0x89, 0x80, 0x6E, 0x57, 0x48, 0x43, 0x41, 0x40, 0x40, 0x41, 0x43, 0x46, 0x4A, 0x4F, 0x51, 0x4D, 0x47, 0x47, 0x51, 0x66, 0x7C, 0x86, 0x82, 0x6D, 0x4D, 0x2F, 0x1A, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x29, 0x3C, 0x46, 0x48, 0x4A, 0x4F, 0x57, 0x5A, 0x5D, 0x65, 0x73, 0x81, 0x84, 0x7D, 0x6B, 0x56, 0x48, 0x44, 0x43, 0x44, 0x49, 0x4F, 0x55, 0x59, 0x60, 0x67, 0x69, 0x62, 0x57, 0x54, 0x5C, 0x6E, 0x7F, 0x85, 0x7D, 0x64, 0x40, 0x27, 0x19, 0x0E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x29, 0x3B, 0x44, 0x46, 0x49, 0x4F, 0x56, 0x56, 0x54, 0x59, 0x68, 0x78, 0x7D, 0x76, 0x64, 0x53, 0x4A, 0x47, 0x46, 0x4A, 0x55, 0x62, 0x6D, 0x72, 0x77, 0x7B, 0x78, 0x6D, 0x5F, 0x5B, 0x62, 0x73, 0x81, 0x84, 0x78, 0x5B, 0x3A, 0x23, 0x18, 0x10, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x28, 0x3A, 0x43, 0x46, 0x49, 0x4F, 0x54, 0x54, 0x50, 0x54, 0x62, 0x72, 0x77, 0x6F, 0x61, 0x59, 0x55, 0x50, 0x4E, 0x54, 0x63, 0x74, 0x7F, 0x84, 0x86, 0x85, 0x7D, 0x6D, 0x5D, 0x58, 0x5D, 0x6D, 0x7C, 0x7F, 0x6E, 0x4E, 0x2E, 0x1D, 0x18, 0x13, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x13, 0x23, 0x34, 0x3F, 0x46, 0x4A, 0x4F, 0x51, 0x4E, 0x4C, 0x54, 0x66, 0x73, 0x75, 0x6C, 0x65, 0x66, 0x66, 0x61, 0x5C, 0x61, 0x6F, 0x7E, 0x87, 0x8B, 0x8B, 0x85, 0x78, 0x62, 0x51, 0x4C, 0x51, 0x62, 0x72, 0x76, 0x5F, 0x3C, 0x21, 0x16, 0x16, 0x15, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0F, 0x1B, 0x2A, 0x38, 0x44, 0x4C, 0x50, 0x4E, 0x4A, 0x4E, 0x5C, 0x6F, 0x7A, 0x7B, 0x72, 0x70, 0x76, 0x76, 0x6E, 0x65, 0x66, 0x70, 0x7D, 0x87, 0x8C, 0x8B, 0x84, 0x75, 0x5D, 0x4C, 0x46, 0x4C, 0x5D, 0x6B, 0x69, 0x4F, 0x2C, 0x15, 0x10, 0x16, 0x16, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x0A, 0x12, 0x1F, 0x2F, 0x42, 0x50, 0x54, 0x50, 0x4E, 0x57, 0x69, 0x7B, 0x84, 0x82, 0x7D, 0x7D, 0x80, 0x7C, 0x70, 0x64, 0x60, 0x67, 0x75, 0x82, 0x8A, 0x8B, 0x85, 0x78, 0x62, 0x51, 0x4B, 0x51, 0x61, 0x68, 0x5C, 0x3D, 0x1F, 0x0E, 0x0E, 0x16, 0x16, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x1F, 0x31, 0x46, 0x57, 0x5D, 0x5B, 0x5D, 0x69, 0x78, 0x83, 0x86, 0x83, 0x80, 0x83, 0x84, 0x7A, 0x69, 0x5A, 0x55, 0x5A, 0x6A, 0x7B, 0x87, 0x8B, 0x87, 0x7D, 0x6B, 0x5C, 0x57, 0x5D, 0x68, 0x68, 0x56, 0x37, 0x1E, 0x13, 0x12, 0x18, 0x17, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0E, 0x13, 0x14, 0x13, 0x15, 0x1D, 0x2B, 0x3E, 0x54, 0x63, 0x67, 0x67, 0x6C, 0x78, 0x82, 0x85, 0x80, 0x7A, 0x79, 0x7E, 0x7F, 0x76, 0x63, 0x53, 0x4E, 0x54, 0x64, 0x78, 0x86, 0x8A, 0x86, 0x7B, 0x6A, 0x5D, 0x5A, 0x61, 0x6D, 0x6A, 0x5B, 0x44, 0x2E, 0x23, 0x22, 0x25, 0x20, 0x12, 0x07, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x05, 0x0B, 0x14, 0x1E, 0x28, 0x2C, 0x29, 0x2B, 0x33, 0x3F, 0x4F, 0x5E, 0x67, 0x69, 0x6C, 0x74, 0x7F, 0x85, 0x81, 0x74, 0x68, 0x67, 0x70, 0x75, 0x6F, 0x5F, 0x50, 0x4C, 0x53, 0x65, 0x7A, 0x85, 0x86, 0x7D, 0x6E, 0x5E, 0x54, 0x53, 0x5B, 0x68, 0x6F, 0x6B, 0x5F, 0x50, 0x44, 0x3F, 0x3E, 0x34, 0x22, 0x14, 0x0A, 0x05, 0x04, 0x06, 0x07, 0x06, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x08, 0x11, 0x1C, 0x2A, 0x36, 0x3C, 0x39, 0x38, 0x3D, 0x46, 0x51, 0x59, 0x5D, 0x60, 0x67, 0x72, 0x7F, 0x84, 0x7E, 0x6F, 0x61, 0x5C, 0x60, 0x65, 0x5F, 0x53, 0x47, 0x47, 0x52, 0x69, 0x7C, 0x83, 0x7E, 0x6E, 0x5B, 0x4C, 0x45, 0x45, 0x4C, 0x5A, 0x6A, 0x76, 0x76, 0x70, 0x69, 0x64, 0x5D, 0x4D, 0x3C, 0x2B, 0x1D, 0x11, 0x08, 0x07, 0x09, 0x07, 0x04, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x08, 0x11, 0x1D, 0x2B, 0x39, 0x40, 0x3D, 0x37, 0x35, 0x37, 0x3B, 0x41, 0x46, 0x4D, 0x5B, 0x6E, 0x7F, 0x86, 0x82, 0x74, 0x65, 0x5C, 0x55, 0x51, 0x4A, 0x41, 0x3B, 0x40, 0x50, 0x6C, 0x7E, 0x81, 0x76, 0x60, 0x4D, 0x41, 0x3C, 0x3C, 0x41, 0x4D, 0x60, 0x76, 0x81, 0x82, 0x7F, 0x78, 0x6B, 0x5A, 0x4B, 0x40, 0x36, 0x22, 0x0F, 0x07, 0x07, 0x06, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x05, 0x0B, 0x15, 0x23, 0x32, 0x39, 0x35, 0x2A, 0x21, 0x1F, 0x20, 0x24, 0x2C, 0x3C, 0x54, 0x6F, 0x82, 0x8A, 0x87, 0x80, 0x74, 0x66, 0x54, 0x49, 0x40, 0x3B, 0x3A, 0x44, 0x56, 0x70, 0x7F, 0x7E, 0x70, 0x57, 0x45, 0x3C, 0x3A, 0x3A, 0x3C, 0x45, 0x56, 0x6F, 0x80, 0x83, 0x7E, 0x72, 0x61, 0x51, 0x4A, 0x4A, 0x46, 0x34, 0x19, 0x09, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0B, 0x17, 0x25, 0x2B, 0x26, 0x1D, 0x16, 0x13, 0x14, 0x19, 0x24, 0x3A, 0x58, 0x74, 0x85, 0x8C, 0x8B, 0x89, 0x81, 0x73, 0x5D, 0x4E, 0x47, 0x48, 0x4B, 0x55, 0x67, 0x7A, 0x81, 0x7A, 0x68, 0x50, 0x41, 0x3B, 0x3A, 0x3A, 0x3B, 0x41, 0x4E, 0x64, 0x74, 0x79, 0x72, 0x61, 0x4C, 0x40, 0x3F, 0x49, 0x50, 0x40, 0x23, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x10, 0x1C, 0x21, 0x1F, 0x1B, 0x18, 0x1C, 0x24, 0x2D, 0x38, 0x4C, 0x67, 0x7E, 0x8A, 0x8C, 0x8C, 0x8C, 0x88, 0x7E, 0x6E, 0x60, 0x5C, 0x62, 0x68, 0x71, 0x7B, 0x84, 0x82, 0x76, 0x5F, 0x49, 0x3D, 0x3A, 0x3A, 0x3A, 0x3A, 0x3D, 0x45, 0x53, 0x60, 0x64, 0x5D, 0x4E, 0x3F, 0x37, 0x3A, 0x48, 0x56, 0x4B, 0x2B, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x1A, 0x21, 0x23, 0x24, 0x29, 0x34, 0x42, 0x4F, 0x5A, 0x69, 0x7A, 0x87, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x87, 0x7F, 0x78, 0x76, 0x7A, 0x7E, 0x83, 0x88, 0x8A, 0x83, 0x71, 0x58, 0x44, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3C, 0x40, 0x46, 0x48, 0x46, 0x42, 0x3E, 0x3A, 0x42, 0x51, 0x60, 0x54, 0x33, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0E, 0x1A, 0x24, 0x29, 0x2E, 0x3B, 0x4C, 0x5C, 0x6A, 0x74, 0x7E, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x86, 0x86, 0x88, 0x8A, 0x8B, 0x8C, 0x8B, 0x82, 0x6F, 0x56, 0x42, 0x39, 0x38, 0x39, 0x39, 0x3A, 0x38, 0x37, 0x34, 0x36, 0x37, 0x3A, 0x40, 0x49, 0x4D, 0x55, 0x65, 0x6D, 0x60, 0x3D, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x19, 0x20, 0x24, 0x2C, 0x3A, 0x51, 0x66, 0x78, 0x83, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x83, 0x70, 0x56, 0x43, 0x3A, 0x38, 0x38, 0x38, 0x38, 0x37, 0x35, 0x31, 0x31, 0x32, 0x38, 0x49, 0x5F, 0x69, 0x6F, 0x75, 0x73, 0x62, 0x41, 0x22, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0D, 0x17, 0x1B, 0x19, 0x1E, 0x2E, 0x49, 0x65, 0x7B, 0x87, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x83, 0x72, 0x58, 0x45, 0x3B, 0x3A, 0x39, 0x39, 0x38, 0x38, 0x38, 0x37, 0x37, 0x38, 0x41, 0x56, 0x6A, 0x76, 0x78, 0x75, 0x6B, 0x57, 0x38, 0x1D, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x15, 0x18, 0x15, 0x17, 0x24, 0x3E, 0x60, 0x79, 0x88, 0x8C, 0x8C, 0x8B, 0x88, 0x86, 0x86, 0x88, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x85, 0x76, 0x5F, 0x49, 0x3D, 0x3A, 0x3A, 0x3A, 0x3A, 0x3B, 0x41, 0x47, 0x49, 0x4A, 0x51, 0x60, 0x69, 0x6A, 0x62, 0x59, 0x4D, 0x39, 0x23, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x10, 0x14, 0x13, 0x15, 0x22, 0x3B, 0x60, 0x7A, 0x89, 0x8D, 0x8C, 0x87, 0x7F, 0x77, 0x77, 0x7F, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x89, 0x7D, 0x68, 0x50, 0x41, 0x3B, 0x3A, 0x3A, 0x3B, 0x40, 0x4C, 0x5B, 0x65, 0x67, 0x66, 0x65, 0x5C, 0x4D, 0x3D, 0x31, 0x28, 0x1B, 0x0E, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x0C, 0x0E, 0x12, 0x20, 0x3A, 0x5F, 0x78, 0x87, 0x8A, 0x89, 0x7F, 0x6F, 0x64, 0x65, 0x70, 0x80, 0x89, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x82, 0x70, 0x56, 0x45, 0x3C, 0x3A, 0x3A, 0x3C, 0x44, 0x56, 0x6C, 0x7B, 0x7E, 0x78, 0x66, 0x4A, 0x30, 0x1E, 0x14, 0x0E, 0x08, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x0B, 0x19, 0x31, 0x55, 0x6B, 0x79, 0x7C, 0x7C, 0x74, 0x62, 0x58, 0x5B, 0x67, 0x7B, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x85, 0x76, 0x5F, 0x4B, 0x3F, 0x3B, 0x3B, 0x3F, 0x4C, 0x60, 0x77, 0x86, 0x8A, 0x82, 0x66, 0x3E, 0x1E, 0x0C, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x10, 0x25, 0x40, 0x52, 0x5A, 0x5F, 0x64, 0x65, 0x5E, 0x58, 0x5D, 0x69, 0x7A, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x88, 0x7D, 0x6B, 0x57, 0x49, 0x42, 0x42, 0x49, 0x58, 0x6C, 0x7F, 0x8D, 0x8F, 0x86, 0x65, 0x38, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0B, 0x19, 0x28, 0x30, 0x32, 0x36, 0x42, 0x51, 0x5C, 0x62, 0x6A, 0x73, 0x7D, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x88, 0x81, 0x74, 0x64, 0x57, 0x4F, 0x4F, 0x57, 0x65, 0x76, 0x85, 0x8F, 0x91, 0x86, 0x65, 0x3A, 0x19, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0F, 0x15, 0x16, 0x16, 0x19, 0x25, 0x3A, 0x54, 0x69, 0x75, 0x7B, 0x7F, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x87, 0x86, 0x84, 0x80, 0x79, 0x6F, 0x65, 0x5B, 0x5A, 0x61, 0x6E, 0x7A, 0x85, 0x8E, 0x90, 0x86, 0x6A, 0x43, 0x25, 0x11, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x09, 0x07, 0x06, 0x08, 0x13, 0x28, 0x48, 0x65, 0x76, 0x7D, 0x7F, 0x84, 0x89, 0x8C, 0x8C, 0x8C, 0x8C, 0x89, 0x85, 0x81, 0x7D, 0x7B, 0x7A, 0x78, 0x73, 0x69, 0x5D, 0x5A, 0x61, 0x6E, 0x79, 0x82, 0x8A, 0x8D, 0x84, 0x70, 0x4F, 0x32, 0x1F, 0x11, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x02, 0x0C, 0x21, 0x42, 0x61, 0x75, 0x7D, 0x7D, 0x81, 0x86, 0x8A, 0x8C, 0x8C, 0x8A, 0x86, 0x80, 0x78, 0x6F, 0x6B, 0x6D, 0x70, 0x6F, 0x63, 0x56, 0x53, 0x5C, 0x6C, 0x77, 0x7F, 0x86, 0x88, 0x7E, 0x6A, 0x4F, 0x36, 0x24, 0x15, 0x0A, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x20, 0x40, 0x60, 0x74, 0x7C, 0x7C, 0x7F, 0x85, 0x8A, 0x8C, 0x8B, 0x88, 0x82, 0x79, 0x6A, 0x59, 0x52, 0x55, 0x5E, 0x60, 0x56, 0x4D, 0x50, 0x5D, 0x6E, 0x77, 0x7E, 0x82, 0x7E, 0x6E, 0x58, 0x40, 0x2D, 0x1E, 0x11, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x1C, 0x3A, 0x5C, 0x73, 0x7D, 0x7D, 0x7F, 0x85, 0x8A, 0x8B, 0x89, 0x84, 0x7D, 0x6F, 0x59, 0x40, 0x32, 0x34, 0x41, 0x49, 0x47, 0x47, 0x52, 0x63, 0x71, 0x77, 0x79, 0x77, 0x6A, 0x53, 0x3A, 0x26, 0x19, 0x10, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x32, 0x58, 0x73, 0x7F, 0x7F, 0x7F, 0x84, 0x88, 0x88, 0x84, 0x7E, 0x74, 0x62, 0x45, 0x29, 0x1A, 0x1C, 0x28, 0x32, 0x3B, 0x46, 0x57, 0x67, 0x71, 0x74, 0x6E, 0x62, 0x4C, 0x31, 0x1D, 0x0F, 0x08, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x2C, 0x53, 0x70, 0x7D, 0x7E, 0x7C, 0x7F, 0x81, 0x7E, 0x77, 0x70, 0x66, 0x51, 0x32, 0x19, 0x0D, 0x0F, 0x1B, 0x26, 0x33, 0x44, 0x56, 0x63, 0x6A, 0x67, 0x5A, 0x45, 0x2C, 0x17, 0x0A, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x24, 0x48, 0x66, 0x72, 0x71, 0x6D, 0x6E, 0x6F, 0x69, 0x5F, 0x59, 0x52, 0x41, 0x25, 0x11, 0x0A, 0x0E, 0x19, 0x24, 0x2F, 0x3E, 0x4E, 0x59, 0x5C, 0x54, 0x41, 0x28, 0x15, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x36, 0x51, 0x5C, 0x5A, 0x53, 0x52, 0x51, 0x48, 0x3D, 0x3B, 0x3B, 0x31, 0x1C, 0x0E, 0x0B, 0x13, 0x1F, 0x27, 0x2F, 0x3C, 0x49, 0x50, 0x4E, 0x41, 0x2A, 0x15, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x21, 0x34, 0x3B, 0x38, 0x30, 0x2E, 0x2C, 0x25, 0x1F, 0x21, 0x26, 0x23, 0x15, 0x0B, 0x0C, 0x18, 0x22, 0x28, 0x2E, 0x3A, 0x44, 0x48, 0x42, 0x32, 0x1B, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x1F, 0x25, 0x21, 0x19, 0x15, 0x13, 0x10, 0x10, 0x13, 0x17, 0x16, 0x10, 0x0D, 0x11, 0x19, 0x20, 0x22, 0x26, 0x2F, 0x39, 0x3B, 0x34, 0x24, 0x11, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x11, 0x19, 0x19, 0x14, 0x10, 0x0F, 0x0E, 0x0F, 0x10, 0x12, 0x12, 0x10, 0x11, 0x12, 0x15, 0x16, 0x14, 0x16, 0x1D, 0x25, 0x27, 0x22, 0x16, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x17, 0x1A, 0x1A, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x12, 0x10, 0x0D, 0x0C, 0x0A, 0x08, 0x08, 0x0C, 0x11, 0x13, 0x10, 0x0A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x12, 0x16, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x13, 0x0E, 0x0A, 0x06, 0x04, 0x03, 0x02, 0x02, 0x03, 0x04, 0x05, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x09, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0A, 0x06, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_BIG_3_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0x19, 0x85, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01, 0xC0, 0x18, 0x8A, 0x01, 0x04, 0x09, 0x0E, 0x0E, 0x09, 0x04, 0x01, 0x01, 0x01,
+  0x01, 0xC0, 0x16, 0x92, 0x01, 0x03, 0x06, 0x0C, 0x15, 0x1E, 0x1F, 0x17, 0x0E, 0x08, 0x07, 0x07, 0x06, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0xC0,
+  0x13, 0x98, 0x01, 0x02, 0x02, 0x05, 0x0B, 0x12, 0x1A, 0x25, 0x2E, 0x2F, 0x29, 0x1E, 0x18, 0x16, 0x16, 0x13, 0x10, 0x0B, 0x07, 0x05, 0x05, 0x05,
+  0x03, 0x02, 0x01, 0xC0, 0x12, 0x9B, 0x01, 0x03, 0x06, 0x08, 0x0E, 0x18, 0x22, 0x2A, 0x31, 0x39, 0x3B, 0x39, 0x33, 0x2F, 0x2D, 0x2C, 0x29, 0x23,
+  0x1C, 0x15, 0x10, 0x0D, 0x0B, 0x08, 0x07, 0x05, 0x04, 0x02, 0xC0, 0x12, 0x9C, 0x03, 0x08, 0x0C, 0x0F, 0x15, 0x21, 0x2B, 0x33, 0x38, 0x3E, 0x42,
+  0x45, 0x45, 0x42, 0x40, 0x3E, 0x3C, 0x38, 0x32, 0x2A, 0x20, 0x18, 0x13, 0x12, 0x12, 0x11, 0x0D, 0x08, 0x03, 0xC0, 0x11, 0x9E, 0x02, 0x05, 0x0C,
+  0x11, 0x14, 0x17, 0x1F, 0x2A, 0x33, 0x3A, 0x41, 0x48, 0x4D, 0x4E, 0x4B, 0x49, 0x46, 0x44, 0x43, 0x40, 0x3C, 0x31, 0x25, 0x1E, 0x1E, 0x21, 0x21,
+  0x1B, 0x12, 0x07, 0x02, 0xC0, 0x11, 0x9F, 0x02, 0x06, 0x0D, 0x11, 0x13, 0x14, 0x1A, 0x25, 0x32, 0x3D, 0x46, 0x4D, 0x4F, 0x4E, 0x4A, 0x47, 0x44,
+  0x43, 0x43, 0x44, 0x44, 0x3E, 0x34, 0x2B, 0x2B, 0x2E, 0x2E, 0x28, 0x1C, 0x0D, 0x05, 0x01, 0xC0, 0x10, 0xA0, 0x01, 0x03, 0x07, 0x0D, 0x10, 0x13,
+  0x17, 0x1E, 0x2A, 0x38, 0x43, 0x4A, 0x4D, 0x4C, 0x49, 0x44, 0x41, 0x3E, 0x3E, 0x3F, 0x41, 0x45, 0x46, 0x40, 0x38, 0x35, 0x34, 0x32, 0x2D, 0x20,
+  0x10, 0x06, 0x01, 0xC0, 0x0F, 0xA1, 0x01, 0x05, 0x09, 0x0D, 0x12, 0x15, 0x1B, 0x24, 0x2D, 0x38, 0x41, 0x48, 0x49, 0x48, 0x46, 0x43, 0x40, 0x3D,
+  0x3B, 0x3B, 0x3C, 0x3D, 0x43, 0x48, 0x47, 0x40, 0x39, 0x34, 0x31, 0x2A, 0x1E, 0x0F, 0x06, 0x01, 0xC0, 0x0C, 0xA5, 0x01, 0x03, 0x04, 0x06, 0x0B,
+  0x13, 0x18, 0x1C, 0x22, 0x2E, 0x3C, 0x47, 0x4A, 0x49, 0x47, 0x44, 0x42, 0x41, 0x40, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x40, 0x46, 0x49, 0x44,
+  0x3D, 0x36, 0x34, 0x2E, 0x23, 0x18, 0x0E, 0x05, 0x01, 0xC0, 0x0B, 0xA6, 0x01, 0x05, 0x0C, 0x11, 0x14, 0x18, 0x21, 0x27, 0x2C, 0x35, 0x49, 0x59,
+  0x5E, 0x58, 0x4C, 0x44, 0x40, 0x3F, 0x3F, 0x3F, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x44, 0x4A, 0x49, 0x45, 0x42, 0x43, 0x40, 0x3A, 0x30,
+  0x20, 0x10, 0x05, 0xC0, 0x0B, 0xA7, 0x04, 0x0F, 0x1E, 0x29, 0x2C, 0x30, 0x39, 0x3F, 0x45, 0x50, 0x63, 0x71, 0x6F, 0x62, 0x4E, 0x42, 0x3E, 0x3F,
+  0x3F, 0x3D, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3D, 0x42, 0x49, 0x4D, 0x50, 0x57, 0x5D, 0x5F, 0x5E, 0x53, 0x3D, 0x20, 0x0C, 0x02, 0xC0, 0x0A,
+  0xA8, 0x02, 0x0A, 0x1C, 0x32, 0x41, 0x44, 0x49, 0x53, 0x5C, 0x63, 0x6C, 0x79, 0x7F, 0x7B, 0x6B, 0x54, 0x45, 0x3F, 0x3F, 0x3F, 0x3D, 0x3B, 0x3B,
+  0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3E, 0x45, 0x4D, 0x57, 0x64, 0x71, 0x79, 0x78, 0x6C, 0x51, 0x2E, 0x12, 0x03, 0xC0, 0x09, 0xAA, 0x01, 0x06, 0x14,
+  0x2A, 0x42, 0x4E, 0x51, 0x57, 0x62, 0x6E, 0x76, 0x7C, 0x85, 0x89, 0x84, 0x75, 0x5E, 0x4B, 0x41, 0x3F, 0x3E, 0x3C, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+  0x3C, 0x3A, 0x3B, 0x40, 0x48, 0x55, 0x67, 0x7B, 0x86, 0x86, 0x78, 0x5B, 0x35, 0x18, 0x07, 0x01, 0xC0, 0x09, 0xAA, 0x03, 0x0D, 0x20, 0x37, 0x49,
+  0x50, 0x53, 0x59, 0x63, 0x6E, 0x76, 0x7E, 0x87, 0x8A, 0x88, 0x7D, 0x69, 0x53, 0x45, 0x41, 0x3F, 0x3D, 0x3C, 0x3C, 0x3C, 0x3D, 0x3F, 0x41, 0x40,
+  0x3F, 0x3E, 0x43, 0x50, 0x64, 0x7B, 0x87, 0x88, 0x77, 0x59, 0x35, 0x1A, 0x0A, 0x03, 0xC0, 0x08, 0xAB, 0x01, 0x05, 0x12, 0x28, 0x3D, 0x49, 0x4B,
+  0x4D, 0x52, 0x5B, 0x63, 0x6A, 0x74, 0x80, 0x88, 0x89, 0x80, 0x6E, 0x57, 0x48, 0x43, 0x41, 0x40, 0x40, 0x41, 0x43, 0x46, 0x4A, 0x4F, 0x51, 0x4D,
+  0x47, 0x47, 0x51, 0x66, 0x7C, 0x86, 0x82, 0x6D, 0x4D, 0x2F, 0x1A, 0x0C, 0x04, 0xC0, 0x09, 0xAA, 0x05, 0x13, 0x29, 0x3C, 0x46, 0x48, 0x4A, 0x4F,
+  0x57, 0x5A, 0x5D, 0x65, 0x73, 0x81, 0x84, 0x7D, 0x6B, 0x56, 0x48, 0x44, 0x43, 0x44, 0x49, 0x4F, 0x55, 0x59, 0x60, 0x67, 0x69, 0x62, 0x57, 0x54,
+  0x5C, 0x6E, 0x7F, 0x85, 0x7D, 0x64, 0x40, 0x27, 0x19, 0x0E, 0x05, 0xC0, 0x08, 0xAC, 0x01, 0x06, 0x14, 0x29, 0x3B, 0x44, 0x46, 0x49, 0x4F, 0x56,
+  0x56, 0x54, 0x59, 0x68, 0x78, 0x7D, 0x76, 0x64, 0x53, 0x4A, 0x47, 0x46, 0x4A, 0x55, 0x62, 0x6D, 0x72, 0x77, 0x7B, 0x78, 0x6D, 0x5F, 0x5B, 0x62,
+  0x73, 0x81, 0x84, 0x78, 0x5B, 0x3A, 0x23, 0x18, 0x10, 0x07, 0x01, 0xC0, 0x08, 0xAC, 0x01, 0x06, 0x14, 0x28, 0x3A, 0x43, 0x46, 0x49, 0x4F, 0x54,
+  0x54, 0x50, 0x54, 0x62, 0x72, 0x77, 0x6F, 0x61, 0x59, 0x55, 0x50, 0x4E, 0x54, 0x63, 0x74, 0x7F, 0x84, 0x86, 0x85, 0x7D, 0x6D, 0x5D, 0x58, 0x5D,
+  0x6D, 0x7C, 0x7F, 0x6E, 0x4E, 0x2E, 0x1D, 0x18, 0x13, 0x0A, 0x03, 0xC0, 0x08, 0xAC, 0x01, 0x06, 0x13, 0x23, 0x34, 0x3F, 0x46, 0x4A, 0x4F, 0x51,
+  0x4E, 0x4C, 0x54, 0x66, 0x73, 0x75, 0x6C, 0x65, 0x66, 0x66, 0x61, 0x5C, 0x61, 0x6F, 0x7E, 0x87, 0x8B, 0x8B, 0x85, 0x78, 0x62, 0x51, 0x4C, 0x51,
+  0x62, 0x72, 0x76, 0x5F, 0x3C, 0x21, 0x16, 0x16, 0x15, 0x0C, 0x04, 0xC0, 0x08, 0xAC, 0x02, 0x06, 0x0F, 0x1B, 0x2A, 0x38, 0x44, 0x4C, 0x50, 0x4E,
+  0x4A, 0x4E, 0x5C, 0x6F, 0x7A, 0x7B, 0x72, 0x70, 0x76, 0x76, 0x6E, 0x65, 0x66, 0x70, 0x7D, 0x87, 0x8C, 0x8B, 0x84, 0x75, 0x5D, 0x4C, 0x46, 0x4C,
+  0x5D, 0x6B, 0x69, 0x4F, 0x2C, 0x15, 0x10, 0x16, 0x16, 0x0D, 0x04, 0xC0, 0x07, 0xAD, 0x01, 0x02, 0x04, 0x0A, 0x12, 0x1F, 0x2F, 0x42, 0x50, 0x54,
+  0x50, 0x4E, 0x57, 0x69, 0x7B, 0x84, 0x82, 0x7D, 0x7D, 0x80, 0x7C, 0x70, 0x64, 0x60, 0x67, 0x75, 0x82, 0x8A, 0x8B, 0x85, 0x78, 0x62, 0x51, 0x4B,
+  0x51, 0x61, 0x68, 0x5C, 0x3D, 0x1F, 0x0E, 0x0E, 0x16, 0x16, 0x0D, 0x04, 0xC0, 0x04, 0xB0, 0x01, 0x02, 0x04, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x1F,
+  0x31, 0x46, 0x57, 0x5D, 0x5B, 0x5D, 0x69, 0x78, 0x83, 0x86, 0x83, 0x80, 0x83, 0x84, 0x7A, 0x69, 0x5A, 0x55, 0x5A, 0x6A, 0x7B, 0x87, 0x8B, 0x87,
+  0x7D, 0x6B, 0x5C, 0x57, 0x5D, 0x68, 0x68, 0x56, 0x37, 0x1E, 0x13, 0x12, 0x18, 0x17, 0x0D, 0x04, 0x03, 0x80, 0x01, 0xC0, 0x03, 0xB8, 0x02, 0x05,
+  0x09, 0x0E, 0x13, 0x14, 0x13, 0x15, 0x1D, 0x2B, 0x3E, 0x54, 0x63, 0x67, 0x67, 0x6C, 0x78, 0x82, 0x85, 0x80, 0x7A, 0x79, 0x7E, 0x7F, 0x76, 0x63,
+  0x53, 0x4E, 0x54, 0x64, 0x78, 0x86, 0x8A, 0x86, 0x7B, 0x6A, 0x5D, 0x5A, 0x61, 0x6D, 0x6A, 0x5B, 0x44, 0x2E, 0x23, 0x22, 0x25, 0x20, 0x12, 0x07,
+  0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0xC0, 0x02, 0xB9, 0x01, 0x05, 0x0B, 0x14, 0x1E, 0x28, 0x2C, 0x29, 0x2B, 0x33, 0x3F, 0x4F, 0x5E, 0x67,
+  0x69, 0x6C, 0x74, 0x7F, 0x85, 0x81, 0x74, 0x68, 0x67, 0x70, 0x75, 0x6F, 0x5F, 0x50, 0x4C, 0x53, 0x65, 0x7A, 0x85, 0x86, 0x7D, 0x6E, 0x5E, 0x54,
+  0x53, 0x5B, 0x68, 0x6F, 0x6B, 0x5F, 0x50, 0x44, 0x3F, 0x3E, 0x34, 0x22, 0x14, 0x0A, 0x05, 0x04, 0x06, 0x07, 0x06, 0x03, 0xC0, 0x02, 0xBA, 0x03,
+  0x08, 0x11, 0x1C, 0x2A, 0x36, 0x3C, 0x39, 0x38, 0x3D, 0x46, 0x51, 0x59, 0x5D, 0x60, 0x67, 0x72, 0x7F, 0x84, 0x7E, 0x6F, 0x61, 0x5C, 0x60, 0x65,
+  0x5F, 0x53, 0x47, 0x47, 0x52, 0x69, 0x7C, 0x83, 0x7E, 0x6E, 0x5B, 0x4C, 0x45, 0x45, 0x4C, 0x5A, 0x6A, 0x76, 0x76, 0x70, 0x69, 0x64, 0x5D, 0x4D,
+  0x3C, 0x2B, 0x1D, 0x11, 0x08, 0x07, 0x09, 0x07, 0x04, 0x01, 0xC0, 0x02, 0xB9, 0x03, 0x08, 0x11, 0x1D, 0x2B, 0x39, 0x40, 0x3D, 0x37, 0x35, 0x37,
+  0x3B, 0x41, 0x46, 0x4D, 0x5B, 0x6E, 0x7F, 0x86, 0x82, 0x74, 0x65, 0x5C, 0x55, 0x51, 0x4A, 0x41, 0x3B, 0x40, 0x50, 0x6C, 0x7E, 0x81, 0x76, 0x60,
+  0x4D, 0x41, 0x3C, 0x3C, 0x41, 0x4D, 0x60, 0x76, 0x81, 0x82, 0x7F, 0x78, 0x6B, 0x5A, 0x4B, 0x40, 0x36, 0x22, 0x0F, 0x07, 0x07, 0x06, 0x03, 0xC0,
+  0x02, 0xB9, 0x01, 0x05, 0x0B, 0x15, 0x23, 0x32, 0x39, 0x35, 0x2A, 0x21, 0x1F, 0x20, 0x24, 0x2C, 0x3C, 0x54, 0x6F, 0x82, 0x8A, 0x87, 0x80, 0x74,
+  0x66, 0x54, 0x49, 0x40, 0x3B, 0x3A, 0x44, 0x56, 0x70, 0x7F, 0x7E, 0x70, 0x57, 0x45, 0x3C, 0x3A, 0x3A, 0x3C, 0x45, 0x56, 0x6F, 0x80, 0x83, 0x7E,
+  0x72, 0x61, 0x51, 0x4A, 0x4A, 0x46, 0x34, 0x19, 0x09, 0x04, 0x02, 0x01, 0xC0, 0x03, 0xB6, 0x02, 0x05, 0x0B, 0x17, 0x25, 0x2B, 0x26, 0x1D, 0x16,
+  0x13, 0x14, 0x19, 0x24, 0x3A, 0x58, 0x74, 0x85, 0x8C, 0x8B, 0x89, 0x81, 0x73, 0x5D, 0x4E, 0x47, 0x48, 0x4B, 0x55, 0x67, 0x7A, 0x81, 0x7A, 0x68,
+  0x50, 0x41, 0x3B, 0x3A, 0x3A, 0x3B, 0x41, 0x4E, 0x64, 0x74, 0x79, 0x72, 0x61, 0x4C, 0x40, 0x3F, 0x49, 0x50, 0x40, 0x23, 0x0D, 0x02, 0xC0, 0x04,
+  0xB5, 0x01, 0x06, 0x10, 0x1C, 0x21, 0x1F, 0x1B, 0x18, 0x1C, 0x24, 0x2D, 0x38, 0x4C, 0x67, 0x7E, 0x8A, 0x8C, 0x8C, 0x8C, 0x88, 0x7E, 0x6E, 0x60,
+  0x5C, 0x62, 0x68, 0x71, 0x7B, 0x84, 0x82, 0x76, 0x5F, 0x49, 0x3D, 0x3A, 0x3A, 0x3A, 0x3A, 0x3D, 0x45, 0x53, 0x60, 0x64, 0x5D, 0x4E, 0x3F, 0x37,
+  0x3A, 0x48, 0x56, 0x4B, 0x2B, 0x10, 0x02, 0xC0, 0x05, 0xB4, 0x04, 0x0D, 0x1A, 0x21, 0x23, 0x24, 0x29, 0x34, 0x42, 0x4F, 0x5A, 0x69, 0x7A, 0x87,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x87, 0x7F, 0x78, 0x76, 0x7A, 0x7E, 0x83, 0x88, 0x8A, 0x83, 0x71, 0x58, 0x44, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+  0x3C, 0x40, 0x46, 0x48, 0x46, 0x42, 0x3E, 0x3A, 0x42, 0x51, 0x60, 0x54, 0x33, 0x14, 0x04, 0xC0, 0x05, 0xB4, 0x04, 0x0E, 0x1A, 0x24, 0x29, 0x2E,
+  0x3B, 0x4C, 0x5C, 0x6A, 0x74, 0x7E, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x88, 0x86, 0x86, 0x88, 0x8A, 0x8B, 0x8C, 0x8B, 0x82, 0x6F,
+  0x56, 0x42, 0x39, 0x38, 0x39, 0x39, 0x3A, 0x38, 0x37, 0x34, 0x36, 0x37, 0x3A, 0x40, 0x49, 0x4D, 0x55, 0x65, 0x6D, 0x60, 0x3D, 0x1C, 0x08, 0xC0,
+  0x05, 0xB5, 0x04, 0x0D, 0x19, 0x20, 0x24, 0x2C, 0x3A, 0x51, 0x66, 0x78, 0x83, 0x89, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B,
+  0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x83, 0x70, 0x56, 0x43, 0x3A, 0x38, 0x38, 0x38, 0x38, 0x37, 0x35, 0x31, 0x31, 0x32, 0x38, 0x49, 0x5F, 0x69,
+  0x6F, 0x75, 0x73, 0x62, 0x41, 0x22, 0x0C, 0x02, 0xC0, 0x05, 0xB5, 0x04, 0x0D, 0x17, 0x1B, 0x19, 0x1E, 0x2E, 0x49, 0x65, 0x7B, 0x87, 0x8C, 0x8C,
+  0x8C, 0x8C, 0x8B, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x83, 0x72, 0x58, 0x45, 0x3B, 0x3A, 0x39, 0x39, 0x38,
+  0x38, 0x38, 0x37, 0x37, 0x38, 0x41, 0x56, 0x6A, 0x76, 0x78, 0x75, 0x6B, 0x57, 0x38, 0x1D, 0x0A, 0x02, 0xC0, 0x05, 0xB4, 0x04, 0x0C, 0x15, 0x18,
+  0x15, 0x17, 0x24, 0x3E, 0x60, 0x79, 0x88, 0x8C, 0x8C, 0x8B, 0x88, 0x86, 0x86, 0x88, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B,
+  0x85, 0x76, 0x5F, 0x49, 0x3D, 0x3A, 0x3A, 0x3A, 0x3A, 0x3B, 0x41, 0x47, 0x49, 0x4A, 0x51, 0x60, 0x69, 0x6A, 0x62, 0x59, 0x4D, 0x39, 0x23, 0x11,
+  0x04, 0xC0, 0x05, 0xB4, 0x03, 0x09, 0x10, 0x14, 0x13, 0x15, 0x22, 0x3B, 0x60, 0x7A, 0x89, 0x8D, 0x8C, 0x87, 0x7F, 0x77, 0x77, 0x7F, 0x87, 0x8B,
+  0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x89, 0x7D, 0x68, 0x50, 0x41, 0x3B, 0x3A, 0x3A, 0x3B, 0x40, 0x4C, 0x5B, 0x65, 0x67, 0x66, 0x65,
+  0x5C, 0x4D, 0x3D, 0x31, 0x28, 0x1B, 0x0E, 0x05, 0x01, 0xC0, 0x05, 0xB3, 0x01, 0x04, 0x08, 0x0C, 0x0E, 0x12, 0x20, 0x3A, 0x5F, 0x78, 0x87, 0x8A,
+  0x89, 0x7F, 0x6F, 0x64, 0x65, 0x70, 0x80, 0x89, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x82, 0x70, 0x56, 0x45, 0x3C, 0x3A, 0x3A,
+  0x3C, 0x44, 0x56, 0x6C, 0x7B, 0x7E, 0x78, 0x66, 0x4A, 0x30, 0x1E, 0x14, 0x0E, 0x08, 0x03, 0x01, 0xC0, 0x06, 0xB0, 0x01, 0x02, 0x04, 0x06, 0x0B,
+  0x19, 0x31, 0x55, 0x6B, 0x79, 0x7C, 0x7C, 0x74, 0x62, 0x58, 0x5B, 0x67, 0x7B, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x85,
+  0x76, 0x5F, 0x4B, 0x3F, 0x3B, 0x3B, 0x3F, 0x4C, 0x60, 0x77, 0x86, 0x8A, 0x82, 0x66, 0x3E, 0x1E, 0x0C, 0x04, 0x01, 0x01, 0xC0, 0x08, 0xAB, 0x01,
+  0x02, 0x05, 0x10, 0x25, 0x40, 0x52, 0x5A, 0x5F, 0x64, 0x65, 0x5E, 0x58, 0x5D, 0x69, 0x7A, 0x87, 0x8B, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+  0x8C, 0x88, 0x7D, 0x6B, 0x57, 0x49, 0x42, 0x42, 0x49, 0x58, 0x6C, 0x7F, 0x8D, 0x8F, 0x86, 0x65, 0x38, 0x16, 0x05, 0xC0, 0x09, 0xAB, 0x01, 0x03,
+  0x0B, 0x19, 0x28, 0x30, 0x32, 0x36, 0x42, 0x51, 0x5C, 0x62, 0x6A, 0x73, 0x7D, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x8B, 0x8A, 0x88,
+  0x81, 0x74, 0x64, 0x57, 0x4F, 0x4F, 0x57, 0x65, 0x76, 0x85, 0x8F, 0x91, 0x86, 0x65, 0x3A, 0x19, 0x08, 0x02, 0xC0, 0x0A, 0xAB, 0x02, 0x07, 0x0F,
+  0x15, 0x16, 0x16, 0x19, 0x25, 0x3A, 0x54, 0x69, 0x75, 0x7B, 0x7F, 0x86, 0x8A, 0x8C, 0x8C, 0x8C, 0x8C, 0x8B, 0x89, 0x87, 0x86, 0x84, 0x80, 0x79,
+  0x6F, 0x65, 0x5B, 0x5A, 0x61, 0x6E, 0x7A, 0x85, 0x8E, 0x90, 0x86, 0x6A, 0x43, 0x25, 0x11, 0x08, 0x03, 0xC0, 0x0B, 0xAB, 0x03, 0x06, 0x09, 0x07,
+  0x06, 0x08, 0x13, 0x28, 0x48, 0x65, 0x76, 0x7D, 0x7F, 0x84, 0x89, 0x8C, 0x8C, 0x8C, 0x8C, 0x89, 0x85, 0x81, 0x7D, 0x7B, 0x7A, 0x78, 0x73, 0x69,
+  0x5D, 0x5A, 0x61, 0x6E, 0x79, 0x82, 0x8A, 0x8D, 0x84, 0x70, 0x4F, 0x32, 0x1F, 0x11, 0x07, 0x02, 0xC0, 0x0C, 0xAB, 0x02, 0x02, 0x02, 0x01, 0x02,
+  0x0C, 0x21, 0x42, 0x61, 0x75, 0x7D, 0x7D, 0x81, 0x86, 0x8A, 0x8C, 0x8C, 0x8A, 0x86, 0x80, 0x78, 0x6F, 0x6B, 0x6D, 0x70, 0x6F, 0x63, 0x56, 0x53,
+  0x5C, 0x6C, 0x77, 0x7F, 0x86, 0x88, 0x7E, 0x6A, 0x4F, 0x36, 0x24, 0x15, 0x0A, 0x03, 0x01, 0xC0, 0x10, 0xA6, 0x01, 0x0B, 0x20, 0x40, 0x60, 0x74,
+  0x7C, 0x7C, 0x7F, 0x85, 0x8A, 0x8C, 0x8B, 0x88, 0x82, 0x79, 0x6A, 0x59, 0x52, 0x55, 0x5E, 0x60, 0x56, 0x4D, 0x50, 0x5D, 0x6E, 0x77, 0x7E, 0x82,
+  0x7E, 0x6E, 0x58, 0x40, 0x2D, 0x1E, 0x11, 0x07, 0x02, 0xC0, 0x10, 0xA5, 0x01, 0x09, 0x1C, 0x3A, 0x5C, 0x73, 0x7D, 0x7D, 0x7F, 0x85, 0x8A, 0x8B,
+  0x89, 0x84, 0x7D, 0x6F, 0x59, 0x40, 0x32, 0x34, 0x41, 0x49, 0x47, 0x47, 0x52, 0x63, 0x71, 0x77, 0x79, 0x77, 0x6A, 0x53, 0x3A, 0x26, 0x19, 0x10,
+  0x08, 0x03, 0xC0, 0x11, 0xA3, 0x05, 0x16, 0x32, 0x58, 0x73, 0x7F, 0x7F, 0x7F, 0x84, 0x88, 0x88, 0x84, 0x7E, 0x74, 0x62, 0x45, 0x29, 0x1A, 0x1C,
+  0x28, 0x32, 0x3B, 0x46, 0x57, 0x67, 0x71, 0x74, 0x6E, 0x62, 0x4C, 0x31, 0x1D, 0x0F, 0x08, 0x05, 0x02, 0xC0, 0x11, 0xA2, 0x02, 0x10, 0x2C, 0x53,
+  0x70, 0x7D, 0x7E, 0x7C, 0x7F, 0x81, 0x7E, 0x77, 0x70, 0x66, 0x51, 0x32, 0x19, 0x0D, 0x0F, 0x1B, 0x26, 0x33, 0x44, 0x56, 0x63, 0x6A, 0x67, 0x5A,
+  0x45, 0x2C, 0x17, 0x0A, 0x03, 0x01, 0x01, 0xC0, 0x11, 0x9F, 0x02, 0x0D, 0x24, 0x48, 0x66, 0x72, 0x71, 0x6D, 0x6E, 0x6F, 0x69, 0x5F, 0x59, 0x52,
+  0x41, 0x25, 0x11, 0x0A, 0x0E, 0x19, 0x24, 0x2F, 0x3E, 0x4E, 0x59, 0x5C, 0x54, 0x41, 0x28, 0x15, 0x07, 0x02, 0xC0, 0x12, 0x9D, 0x07, 0x19, 0x36,
+  0x51, 0x5C, 0x5A, 0x53, 0x52, 0x51, 0x48, 0x3D, 0x3B, 0x3B, 0x31, 0x1C, 0x0E, 0x0B, 0x13, 0x1F, 0x27, 0x2F, 0x3C, 0x49, 0x50, 0x4E, 0x41, 0x2A,
+  0x15, 0x08, 0x02, 0xC0, 0x12, 0x9C, 0x02, 0x0C, 0x21, 0x34, 0x3B, 0x38, 0x30, 0x2E, 0x2C, 0x25, 0x1F, 0x21, 0x26, 0x23, 0x15, 0x0B, 0x0C, 0x18,
+  0x22, 0x28, 0x2E, 0x3A, 0x44, 0x48, 0x42, 0x32, 0x1B, 0x0A, 0x03, 0xC0, 0x13, 0x9B, 0x05, 0x10, 0x1F, 0x25, 0x21, 0x19, 0x15, 0x13, 0x10, 0x10,
+  0x13, 0x17, 0x16, 0x10, 0x0D, 0x11, 0x19, 0x20, 0x22, 0x26, 0x2F, 0x39, 0x3B, 0x34, 0x24, 0x11, 0x06, 0x01, 0xC0, 0x13, 0x9A, 0x01, 0x07, 0x11,
+  0x19, 0x19, 0x14, 0x10, 0x0F, 0x0E, 0x0F, 0x10, 0x12, 0x12, 0x10, 0x11, 0x12, 0x15, 0x16, 0x14, 0x16, 0x1D, 0x25, 0x27, 0x22, 0x16, 0x09, 0x02,
+  0xC0, 0x14, 0x98, 0x04, 0x0C, 0x17, 0x1A, 0x1A, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x12, 0x10, 0x0D, 0x0C, 0x0A, 0x08, 0x08, 0x0C, 0x11,
+  0x13, 0x10, 0x0A, 0x04, 0xC0, 0x14, 0x98, 0x03, 0x09, 0x12, 0x16, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x13, 0x0E, 0x0A, 0x06, 0x04, 0x03,
+  0x02, 0x02, 0x03, 0x04, 0x05, 0x04, 0x02, 0x01, 0xC0, 0x14, 0x8F, 0x01, 0x04, 0x09, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0C, 0x0A, 0x06,
+  0x04, 0x02, 0x01, 0x04, 0x80, 0x01, 0xC0, 0x15, 0x8C, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0xC0, 0xC0,
+  0xC0, 0xC0, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_BIG_3_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1060, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x0840, 0x1061, 0x1081, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
+  0x1060, 0x1060, 0x1880, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x1040, 0x0840, 0x0820, 0x0820, 0x0020, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1060,
+  0x1080, 0x1060, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0820, 0x0820, 0x0820,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840,
+  0x1060, 0x1060, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0840, 0x0840,
+  0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820,
+  0x0840, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x0840, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0840, 0x0820,
+  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x1060,
+  0x18A0, 0x18A1, 0x1880, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x1880, 0x1880, 0x20A1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x1060, 0x1040, 0x1040, 0x1060, 0x1880, 0x18A0, 0x20A1,
+  0x20A1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1,
+  0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 0x1880, 0x20A0, 0x20C1, 0x20C1, 0x20A0, 0x1060, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1081, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x20A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840,
+  0x0840, 0x1040, 0x1880, 0x20A0, 0x20C1, 0x20C1, 0x18A0, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x1060, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060,
+  0x1040, 0x1040, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1880, 0x1080, 0x1060, 0x0840, 0x0840, 0x1060, 0x1880, 0x20C1,
+  0x20C1, 0x20C1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x1881, 0x1881, 0x1881, 0x18A1,
+  0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20A1, 0x1881, 0x1060, 0x0840, 0x0840, 0x0840, 0x1060, 0x1080,
+  0x1881, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x1881, 0x1060, 0x1060, 0x1880, 0x18A1, 0x28C1, 0x28E1, 0x20C1, 0x1080, 0x0820, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1,
+  0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x1080, 0x1060, 0x0840, 0x0840, 0x0840, 0x1060, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x18A1, 0x1881, 0x1880, 0x1881, 0x18A1, 0x28E1, 0x28E1, 0x20A1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1,
+  0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1040, 0x1060, 0x1880, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20A1, 0x1881,
+  0x1881, 0x1881, 0x20A1, 0x28E1, 0x28C1, 0x1880, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0840, 0x1081, 0x1881, 0x1881, 0x18A1, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20E1, 0x20C1, 0x20A1, 0x20A1,
+  0x1881, 0x1880, 0x1860, 0x1880, 0x18A0, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1881,
+  0x20C1, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0860,
+  0x1881, 0x18A1, 0x1881, 0x1880, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x20E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A0, 0x1880,
+  0x1880, 0x18A0, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1, 0x1880, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1881,
+  0x18A1, 0x1880, 0x1881, 0x18A1, 0x20C1, 0x20E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x18A1, 0x1880, 0x1880, 0x1880,
+  0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060,
+  0x1881, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1060, 0x1060,
+  0x1060, 0x1880, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1880, 0x1060, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0840, 0x1081, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x20C1,
+  0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20E1, 0x20C1, 0x18A1, 0x1881, 0x18A1, 0x20C1, 0x1881,
+  0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0020, 0x0020, 0x0820, 0x0840, 0x1060, 0x1881, 0x20A1, 0x20C1, 0x20C1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1880, 0x20C1,
+  0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20A1, 0x1880, 0x1060, 0x0840, 0x0820, 0x0820, 0x0820,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
+  0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x1060, 0x1081, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28C1, 0x18A1, 0x1880,
+  0x1880, 0x1880, 0x1880, 0x1880, 0x1060, 0x1040, 0x1040, 0x1060, 0x1881, 0x28C1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x18A1, 0x1881,
+  0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x18A0, 0x1080, 0x1060, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x1060, 0x1060, 0x0840, 0x0820, 0x0820,
+  0x0820, 0x0840, 0x0860, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1880, 0x1060, 0x1060, 0x1040, 0x0840,
+  0x0820, 0x0840, 0x1060, 0x18A1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1,
+  0x28E1, 0x28E1, 0x20C1, 0x18A0, 0x1880, 0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x18A1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1880, 0x1060, 0x0840, 0x0840, 0x0820, 0x0820, 0x1040, 0x1060, 0x18A1, 0x28E1, 0x28E1,
+  0x20C1, 0x18A1, 0x1881, 0x1881, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x18A0, 0x1880, 0x1060,
+  0x1060, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20A1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x18A1, 0x1880,
+  0x1060, 0x0840, 0x0840, 0x1040, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x20E1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1881, 0x18A1, 0x20C1, 0x20E1, 0x20C1, 0x18A1, 0x1880, 0x1060, 0x1040, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1880, 0x20C1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x18A1, 0x1880, 0x1880, 0x1880, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1,
+  0x1881, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x1881, 0x1060, 0x1040, 0x0840, 0x1040,
+  0x1060, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840,
+  0x1060, 0x1880, 0x20A1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x1081, 0x1880, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x0840, 0x1060, 0x1880, 0x1881, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0840, 0x1060, 0x1880, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1080, 0x1881, 0x20A1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1880, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0840, 0x1060, 0x1060, 0x1881, 0x18A1, 0x20C1, 0x20C1,
+  0x18A1, 0x1880, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x20A1, 0x1880, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1881, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1881, 0x1881, 0x1880, 0x1060, 0x1880, 0x1881, 0x1881, 0x1880, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1880, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1,
+  0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20A1, 0x20A1, 0x1881, 0x1880, 0x1060, 0x0820,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x20C1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x28E1,
+  0x20C1, 0x1880, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1060, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1881, 0x1060, 0x1060, 0x1881, 0x18A1, 0x20C1,
+  0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1060, 0x1060, 0x1060, 0x1880, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1,
+  0x28E1, 0x28E1, 0x20C1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820,
+  0x1040, 0x1880, 0x1880, 0x1880, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1060, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1040, 0x1080, 0x18A0, 0x20A1,
+  0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x20A1,
+  0x1881, 0x1881, 0x18A1, 0x20A1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x20C1, 0x1080, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A0, 0x20C1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20A1,
+  0x20C1, 0x20C1, 0x28E1, 0x20C1, 0x18A1, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0820, 0x1060, 0x18A0, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x20A1,
+  0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1880, 0x1881, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x1881,
+  0x1060, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1860, 0x18A0, 0x20C1, 0x20C1, 0x20C1,
+  0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28C1, 0x20A1, 0x1880, 0x1060, 0x1040, 0x1060, 0x1060, 0x1881, 0x1881, 0x1880, 0x1880,
+  0x1881, 0x18A1, 0x20A1, 0x20C1, 0x20A1, 0x20A1, 0x1880, 0x1060, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0820, 0x1060, 0x1880, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x1060, 0x0820,
+  0x0000, 0x0020, 0x0840, 0x0840, 0x1060, 0x1060, 0x1880, 0x1881, 0x18A1, 0x20A1, 0x18A1, 0x1880, 0x1060, 0x0840, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x1880, 0x20A1, 0x20C1, 0x20C1, 0x28C1, 0x28E1, 0x28E1, 0x28E1,
+  0x20C1, 0x20A1, 0x1860, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20A1, 0x1880,
+  0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x20A1, 0x20C1, 0x20C1,
+  0x20C1, 0x28C1, 0x20C1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1060, 0x1881,
+  0x1881, 0x1881, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060,
+  0x1880, 0x1880, 0x1880, 0x1881, 0x1881, 0x1880, 0x1060, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x0820, 0x1040, 0x1060, 0x1881, 0x1880, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060,
+  0x1040, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0820, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820,
+  0x0840, 0x1060, 0x1060, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0820, 0x0840, 0x1060,
+  0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_BIG_3_SPANS = {
+  SPRITE_DIRT_BIG_3_SPAN_ROWS, SPRITE_DIRT_BIG_3_SPAN_OPS, SPRITE_DIRT_BIG_3_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_BIG_3_ASSET = {
   SPRITE_DIRT_BIG_3_WIDTH, SPRITE_DIRT_BIG_3_HEIGHT,
-  SPRITE_DIRT_BIG_3_ALPHA, SPRITE_DIRT_BIG_3_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_BIG_3_SPANS
 };
 
 #endif // SPRITE_DIRT_BIG_3_INCLUDED
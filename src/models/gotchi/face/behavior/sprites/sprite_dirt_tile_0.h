@@ -5,86 +5,134 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_tile_0.png (32x32)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_tile_0.png (32x32) — RGBA multi-couleur, encodé en spans
+// 927/1024 pixels visibles, 3003 bytes flash (flat : 3072). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_TILE_0_WIDTH = 32;
 constexpr uint16_t SPRITE_DIRT_TILE_0_HEIGHT = 32;
 
-const uint16_t SPRITE_DIRT_TILE_0_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x51C4, 0x6224, 0x6225, 0x6225, 0x6204, 0x5A04, 0x5A04, 0x5A04, 0x6204, 0x6225, 0x6225, 0x6224, 0x51C4, 0x20C1, 0x0820, 0x0000, 0x0000, 0x0840, 0x1060, 0x0840, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20A1, 0x4183, 0x5A04, 0x6225, 0x6204, 0x5A04, 0x51E4, 0x51C4, 0x51C4, 0x51C4, 0x51E4, 0x5A04, 0x6204, 0x6225, 0x5A04, 0x4183, 0x20A1, 0x0840, 0x1081, 0x2902, 0x3122, 0x2902, 0x1061, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18A1, 0x4183, 0x5A04, 0x6225, 0x5A04, 0x51E4, 0x51C4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C4, 0x51E4, 0x5A04, 0x6225, 0x5A04, 0x4183, 0x28E2, 0x3122, 0x4162, 0x4183, 0x4163, 0x2902, 0x0840,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x4163, 0x5A04, 0x6224, 0x6204, 0x59E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C4, 0x5A04, 0x6224, 0x5A04, 0x51C3, 0x4983, 0x4183, 0x4183, 0x49A3, 0x3942, 0x1061,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x51C4, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C4, 0x5A04, 0x6224, 0x5A04, 0x51C3, 0x4183, 0x4183, 0x4163, 0x3122, 0x18A1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x4163, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51E4, 0x6204, 0x6224, 0x51E4, 0x4163, 0x3922, 0x3102, 0x20C1, 0x2902,
-  0x0000, 0x0000, 0x0020, 0x1061, 0x2902, 0x3942, 0x49A3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C4, 0x5A04, 0x6224, 0x51C4, 0x20C1, 0x18A1, 0x1881, 0x0840, 0x1060,
-  0x0000, 0x0020, 0x1081, 0x3102, 0x4162, 0x4183, 0x4183, 0x49A3, 0x51E4, 0x59E4, 0x5A04, 0x5A04, 0x59E4, 0x51C4, 0x51E4, 0x59E4, 0x51E4, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51E4, 0x5A04, 0x49A3, 0x20C1, 0x20C1, 0x18A1, 0x0820, 0x0000,
-  0x0000, 0x0840, 0x2902, 0x4162, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x51C3, 0x51E4, 0x51E4, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C4, 0x59E4, 0x49A3, 0x20C1, 0x1060, 0x0840, 0x0000, 0x0000,
-  0x0000, 0x1060, 0x3122, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x51C3, 0x51C3, 0x49C3, 0x49C3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x49A3, 0x3922, 0x1881, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0840, 0x2902, 0x4162, 0x4183, 0x4183, 0x4183, 0x4183, 0x49A3, 0x49A3, 0x51C3, 0x51E4, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x4983, 0x3122, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x1081, 0x3102, 0x4163, 0x4183, 0x4983, 0x49A3, 0x51C3, 0x51A3, 0x51C3, 0x59E4, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51A3, 0x3942, 0x1881, 0x0840, 0x0020,
-  0x0000, 0x0000, 0x0820, 0x18A1, 0x3962, 0x49A3, 0x51C3, 0x59E4, 0x59E4, 0x51C4, 0x51C3, 0x51E4, 0x51E4, 0x51E4, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x51C4, 0x51C3, 0x4162, 0x28E2, 0x3102, 0x18A1,
-  0x0000, 0x0000, 0x0820, 0x20A1, 0x49A3, 0x59E4, 0x5A04, 0x6224, 0x6204, 0x51E4, 0x51C3, 0x59E4, 0x5A04, 0x59E4, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C4, 0x51C4, 0x4183, 0x3963, 0x3942, 0x3122, 0x3942, 0x4183, 0x3942,
-  0x0000, 0x0820, 0x1881, 0x3922, 0x51C3, 0x6204, 0x6225, 0x6225, 0x6225, 0x5A04, 0x59E4, 0x59E4, 0x5A04, 0x59E4, 0x51E4, 0x51E4, 0x59E4, 0x59E4, 0x51E4, 0x51C3, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x4163, 0x20A1, 0x1060, 0x1060, 0x1060, 0x18A1, 0x3102, 0x18A1,
-  0x1081, 0x20C1, 0x4163, 0x49A3, 0x51C4, 0x6204, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51E4, 0x59E4, 0x59E4, 0x51E4, 0x51E4, 0x51E4, 0x51C3, 0x51C3, 0x51A3, 0x49A3, 0x4182, 0x4182, 0x3962, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0020, 0x1060, 0x1881, 0x0840,
-  0x3963, 0x49A3, 0x5A04, 0x5A04, 0x5A04, 0x6225, 0x6225, 0x5A04, 0x5A04, 0x6224, 0x5A04, 0x5A04, 0x59E4, 0x51E4, 0x51C4, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x51C3, 0x4183, 0x3962, 0x3962, 0x3942, 0x28E1, 0x0840, 0x0000, 0x0000, 0x0840, 0x20C1, 0x20E1, 0x0840,
-  0x3942, 0x51E4, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51E3, 0x51E3, 0x5A04, 0x6225, 0x6224, 0x6204, 0x5A04, 0x51E4, 0x51C4, 0x51C4, 0x51C4, 0x51E4, 0x51E4, 0x4183, 0x3962, 0x3962, 0x3942, 0x2902, 0x0840, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0020,
-  0x51C4, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x59E4, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6204, 0x6204, 0x6204, 0x6204, 0x5A04, 0x5A04, 0x49A3, 0x3962, 0x3962, 0x3142, 0x20E1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5A04, 0x5A04, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51E3, 0x51E3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51E4, 0x4183, 0x3122, 0x20E1, 0x1060, 0x0020, 0x0000, 0x0000, 0x0840, 0x1060, 0x0840, 0x0020,
-  0x51C3, 0x51E4, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6204, 0x51E4, 0x59E4, 0x4183, 0x18A1, 0x0840, 0x0820, 0x0840, 0x1060, 0x1881, 0x3122, 0x3942, 0x3122, 0x18A1,
-  0x5A04, 0x6204, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x59E4, 0x3963, 0x1060, 0x0000, 0x0820, 0x20C1, 0x3922, 0x4163, 0x49A3, 0x49A3, 0x49A3, 0x4163,
-  0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x49C3, 0x4183, 0x20A1, 0x0020, 0x0000, 0x0020, 0x1881, 0x3943, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3,
-  0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x6224, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x41A3, 0x3942, 0x1060, 0x0000, 0x0000, 0x0000, 0x1060, 0x3942, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3,
-  0x51C4, 0x5A04, 0x6225, 0x6224, 0x6224, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x49A3, 0x3942, 0x1060, 0x0000, 0x0000, 0x0000, 0x0840, 0x3102, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x49A3,
-  0x28E2, 0x51C4, 0x6224, 0x6225, 0x6225, 0x5A04, 0x51C3, 0x51E4, 0x5A24, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x4183, 0x2902, 0x0840, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3122, 0x4983, 0x49A3, 0x49A3, 0x4163,
-  0x1061, 0x4163, 0x5A04, 0x6225, 0x6225, 0x5A04, 0x49A3, 0x51E4, 0x51E4, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6204, 0x59E4, 0x4183, 0x18A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3102, 0x3942, 0x3122, 0x18A1,
-  0x0020, 0x18A1, 0x4183, 0x5A04, 0x6225, 0x5A04, 0x49A3, 0x51C3, 0x49C3, 0x51C3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A24, 0x51E4, 0x4183, 0x3102, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x0840, 0x0020,
-  0x0000, 0x0820, 0x20A1, 0x4183, 0x5A04, 0x5A04, 0x49A3, 0x51C3, 0x51E4, 0x51E4, 0x5A04, 0x6224, 0x6224, 0x6224, 0x6224, 0x5A04, 0x51E4, 0x3963, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x20A1, 0x4183, 0x51E4, 0x49A3, 0x49A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x3963, 0x18A1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x4183, 0x51C3, 0x49C3, 0x51E4, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x3963, 0x20A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x3142, 0x41A3, 0x51C3, 0x49A3, 0x49A3, 0x51E4, 0x5A04, 0x5A04, 0x59E4, 0x49A3, 0x20C1, 0x1060, 0x20C1, 0x20C1, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_TILE_0_SPAN_ROWS[] PROGMEM = {
+  0, 0, 27, 24, 56, 50, 85, 76, 115, 103, 147, 132, 180, 162, 214, 193,
+  248, 224, 281, 255, 314, 286, 348, 318, 382, 349, 416, 380, 450, 411, 484, 443,
+  518, 475, 552, 507, 587, 538, 621, 570, 655, 602, 689, 634, 723, 666, 758, 697,
+  793, 728, 828, 759, 862, 789, 895, 818, 927, 846, 957, 872, 979, 891, 1000, 909
 };
 
-const uint8_t SPRITE_DIRT_TILE_0_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D, 0x33, 0x70, 0x85, 0x89, 0x89, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x85, 0x70, 0x33, 0x0D, 0x03, 0x06, 0x0E, 0x10, 0x0E, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0B, 0x2C, 0x5F, 0x7F, 0x87, 0x87, 0x85, 0x81, 0x80, 0x80, 0x80, 0x81, 0x85, 0x87, 0x87, 0x7F, 0x5F, 0x2C, 0x10, 0x17, 0x2B, 0x32, 0x2B, 0x14, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x2A, 0x5D, 0x7C, 0x86, 0x85, 0x81, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7F, 0x81, 0x84, 0x84, 0x7C, 0x5F, 0x36, 0x35, 0x3E, 0x41, 0x3F, 0x2A, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1C, 0x58, 0x7C, 0x83, 0x83, 0x80, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7A, 0x73, 0x76, 0x82, 0x7E, 0x67, 0x4D, 0x45, 0x44, 0x46, 0x2F, 0x10,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x0D, 0x30, 0x6D, 0x7F, 0x7C, 0x7A, 0x79, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x73, 0x5B, 0x5A, 0x79, 0x85, 0x79, 0x5A, 0x47, 0x42, 0x3F, 0x2F, 0x1D,
-  0x00, 0x00, 0x02, 0x08, 0x16, 0x2B, 0x5B, 0x7B, 0x7B, 0x77, 0x76, 0x76, 0x78, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x79, 0x70, 0x70, 0x7D, 0x86, 0x83, 0x6C, 0x45, 0x36, 0x2E, 0x22, 0x30,
-  0x00, 0x01, 0x09, 0x23, 0x48, 0x5B, 0x6F, 0x7C, 0x79, 0x75, 0x76, 0x76, 0x77, 0x7C, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x7B, 0x7F, 0x85, 0x85, 0x6C, 0x30, 0x1E, 0x16, 0x0C, 0x11,
-  0x00, 0x07, 0x23, 0x4C, 0x66, 0x6D, 0x70, 0x73, 0x73, 0x6F, 0x74, 0x76, 0x79, 0x7E, 0x82, 0x84, 0x83, 0x80, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x80, 0x81, 0x69, 0x2D, 0x28, 0x1A, 0x08, 0x04,
-  0x03, 0x15, 0x47, 0x66, 0x6D, 0x6F, 0x6F, 0x6F, 0x6A, 0x62, 0x70, 0x78, 0x7C, 0x7B, 0x82, 0x86, 0x86, 0x85, 0x83, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x75, 0x60, 0x29, 0x14, 0x0A, 0x02, 0x00,
-  0x03, 0x19, 0x52, 0x6B, 0x6F, 0x6F, 0x6F, 0x6F, 0x6C, 0x66, 0x6C, 0x78, 0x76, 0x6D, 0x7D, 0x84, 0x86, 0x86, 0x84, 0x80, 0x7D, 0x7D, 0x7D, 0x79, 0x6C, 0x57, 0x4A, 0x31, 0x16, 0x05, 0x01, 0x00,
-  0x03, 0x15, 0x47, 0x66, 0x6D, 0x6F, 0x6F, 0x70, 0x6B, 0x5A, 0x5A, 0x75, 0x7E, 0x7B, 0x82, 0x86, 0x86, 0x86, 0x86, 0x83, 0x7F, 0x7D, 0x7B, 0x73, 0x57, 0x47, 0x43, 0x3C, 0x29, 0x0D, 0x04, 0x01,
-  0x00, 0x07, 0x23, 0x4C, 0x67, 0x6E, 0x70, 0x75, 0x77, 0x71, 0x71, 0x7B, 0x7A, 0x77, 0x81, 0x86, 0x86, 0x86, 0x86, 0x84, 0x7F, 0x7D, 0x7B, 0x70, 0x50, 0x46, 0x45, 0x3F, 0x32, 0x16, 0x13, 0x09,
-  0x00, 0x01, 0x0A, 0x27, 0x56, 0x69, 0x71, 0x7D, 0x80, 0x7D, 0x7B, 0x77, 0x67, 0x62, 0x7A, 0x84, 0x86, 0x86, 0x86, 0x83, 0x7F, 0x7D, 0x7B, 0x73, 0x57, 0x49, 0x4B, 0x43, 0x38, 0x31, 0x42, 0x2A,
-  0x00, 0x01, 0x07, 0x1C, 0x46, 0x5E, 0x6E, 0x7E, 0x82, 0x7E, 0x7A, 0x74, 0x76, 0x76, 0x7C, 0x7C, 0x82, 0x86, 0x84, 0x80, 0x7D, 0x7D, 0x7C, 0x7A, 0x67, 0x43, 0x3D, 0x42, 0x3B, 0x4C, 0x60, 0x51,
-  0x03, 0x07, 0x16, 0x28, 0x39, 0x5D, 0x75, 0x7E, 0x80, 0x7D, 0x79, 0x75, 0x7B, 0x7D, 0x76, 0x6C, 0x7C, 0x84, 0x83, 0x7F, 0x7B, 0x79, 0x78, 0x74, 0x58, 0x24, 0x14, 0x15, 0x16, 0x28, 0x42, 0x2A,
-  0x14, 0x1C, 0x39, 0x41, 0x45, 0x6A, 0x7B, 0x7E, 0x7E, 0x7C, 0x77, 0x71, 0x73, 0x77, 0x7C, 0x7A, 0x80, 0x7F, 0x7E, 0x7C, 0x75, 0x6D, 0x69, 0x5D, 0x36, 0x0F, 0x04, 0x03, 0x08, 0x17, 0x1C, 0x0D,
-  0x37, 0x3C, 0x50, 0x56, 0x5C, 0x75, 0x7B, 0x72, 0x70, 0x77, 0x70, 0x66, 0x71, 0x7A, 0x7D, 0x7E, 0x7E, 0x7D, 0x7C, 0x7A, 0x6D, 0x67, 0x64, 0x5E, 0x43, 0x13, 0x03, 0x02, 0x0E, 0x29, 0x20, 0x0A,
-  0x34, 0x4B, 0x59, 0x5F, 0x68, 0x77, 0x72, 0x59, 0x56, 0x70, 0x77, 0x74, 0x7A, 0x7C, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7C, 0x6C, 0x65, 0x64, 0x60, 0x4A, 0x16, 0x03, 0x00, 0x05, 0x0F, 0x0B, 0x04,
-  0x4E, 0x57, 0x5D, 0x63, 0x71, 0x77, 0x6F, 0x64, 0x6B, 0x78, 0x7D, 0x7F, 0x80, 0x81, 0x82, 0x82, 0x7F, 0x83, 0x84, 0x7F, 0x6F, 0x66, 0x62, 0x5B, 0x40, 0x13, 0x03, 0x01, 0x03, 0x05, 0x05, 0x02,
-  0x54, 0x54, 0x5B, 0x63, 0x72, 0x71, 0x5F, 0x58, 0x6F, 0x7B, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85, 0x86, 0x83, 0x75, 0x62, 0x50, 0x40, 0x1E, 0x08, 0x03, 0x09, 0x17, 0x1C, 0x19, 0x0B,
-  0x48, 0x47, 0x56, 0x60, 0x6A, 0x6B, 0x6D, 0x6E, 0x79, 0x80, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x81, 0x69, 0x4C, 0x26, 0x14, 0x09, 0x09, 0x0F, 0x28, 0x51, 0x60, 0x54, 0x30,
-  0x56, 0x55, 0x5A, 0x5C, 0x5A, 0x5A, 0x6F, 0x78, 0x7E, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x80, 0x76, 0x5F, 0x3D, 0x13, 0x04, 0x07, 0x18, 0x30, 0x50, 0x69, 0x79, 0x78, 0x6B,
-  0x5C, 0x5C, 0x5D, 0x60, 0x67, 0x6C, 0x72, 0x6F, 0x71, 0x7E, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85, 0x82, 0x5F, 0x25, 0x08, 0x00, 0x04, 0x1D, 0x4E, 0x55, 0x5A, 0x75, 0x80, 0x7F,
-  0x5B, 0x5D, 0x5D, 0x5F, 0x66, 0x6C, 0x6B, 0x55, 0x57, 0x75, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x87, 0x89, 0x67, 0x1F, 0x05, 0x00, 0x03, 0x1D, 0x5D, 0x71, 0x73, 0x7E, 0x82, 0x82,
-  0x4D, 0x58, 0x5D, 0x5F, 0x62, 0x5D, 0x68, 0x61, 0x6C, 0x7D, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7A, 0x50, 0x17, 0x03, 0x00, 0x03, 0x18, 0x53, 0x75, 0x7F, 0x81, 0x81, 0x7F,
-  0x27, 0x4B, 0x5A, 0x5D, 0x5E, 0x5E, 0x65, 0x66, 0x74, 0x7F, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7E, 0x73, 0x56, 0x2B, 0x0B, 0x01, 0x00, 0x00, 0x09, 0x28, 0x59, 0x76, 0x7D, 0x79, 0x6B,
-  0x15, 0x3C, 0x54, 0x5B, 0x5D, 0x5F, 0x64, 0x62, 0x67, 0x72, 0x7E, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7F, 0x74, 0x5C, 0x3F, 0x17, 0x04, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x28, 0x53, 0x60, 0x54, 0x30,
-  0x07, 0x1D, 0x40, 0x55, 0x5C, 0x5F, 0x64, 0x60, 0x5D, 0x5C, 0x72, 0x7E, 0x81, 0x82, 0x81, 0x7F, 0x76, 0x5D, 0x3A, 0x20, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x18, 0x1C, 0x18, 0x0B,
-  0x01, 0x08, 0x1D, 0x40, 0x56, 0x5E, 0x64, 0x61, 0x5E, 0x5C, 0x67, 0x75, 0x7A, 0x7A, 0x7A, 0x74, 0x61, 0x43, 0x1B, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01,
-  0x00, 0x02, 0x08, 0x1D, 0x41, 0x58, 0x63, 0x64, 0x61, 0x5A, 0x5F, 0x64, 0x67, 0x67, 0x65, 0x5D, 0x44, 0x20, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x09, 0x1F, 0x44, 0x54, 0x61, 0x61, 0x56, 0x5B, 0x5F, 0x5F, 0x5E, 0x58, 0x42, 0x22, 0x13, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x0F, 0x2C, 0x39, 0x56, 0x65, 0x61, 0x5E, 0x5E, 0x5E, 0x5B, 0x4D, 0x25, 0x14, 0x24, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_TILE_0_SPAN_OPS[] PROGMEM = {
+  0x06, 0x97, 0x02, 0x0D, 0x33, 0x70, 0x85, 0x89, 0x89, 0x86, 0x86, 0x86, 0x86, 0x86, 0x89, 0x89, 0x85, 0x70, 0x33, 0x0D, 0x03, 0x06, 0x0E, 0x10,
+  0x0E, 0x06, 0xC0, 0x05, 0x99, 0x02, 0x0B, 0x2C, 0x5F, 0x7F, 0x87, 0x87, 0x85, 0x81, 0x80, 0x80, 0x80, 0x81, 0x85, 0x87, 0x87, 0x7F, 0x5F, 0x2C,
+  0x10, 0x17, 0x2B, 0x32, 0x2B, 0x14, 0x05, 0xC0, 0x05, 0x99, 0x0A, 0x2A, 0x5D, 0x7C, 0x86, 0x85, 0x81, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7F,
+  0x81, 0x84, 0x84, 0x7C, 0x5F, 0x36, 0x35, 0x3E, 0x41, 0x3F, 0x2A, 0x0D, 0xC0, 0x04, 0x9A, 0x04, 0x1C, 0x58, 0x7C, 0x83, 0x83, 0x80, 0x7D, 0x7D,
+  0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7A, 0x73, 0x76, 0x82, 0x7E, 0x67, 0x4D, 0x45, 0x44, 0x46, 0x2F, 0x10, 0xC0, 0x02, 0x9C, 0x01, 0x03, 0x0D,
+  0x30, 0x6D, 0x7F, 0x7C, 0x7A, 0x79, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x73, 0x5B, 0x5A, 0x79, 0x85, 0x79, 0x5A, 0x47, 0x42, 0x3F,
+  0x2F, 0x1D, 0xC0, 0x01, 0x9D, 0x02, 0x08, 0x16, 0x2B, 0x5B, 0x7B, 0x7B, 0x77, 0x76, 0x76, 0x78, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x79,
+  0x70, 0x70, 0x7D, 0x86, 0x83, 0x6C, 0x45, 0x36, 0x2E, 0x22, 0x30, 0xC0, 0x00, 0x9E, 0x01, 0x09, 0x23, 0x48, 0x5B, 0x6F, 0x7C, 0x79, 0x75, 0x76,
+  0x76, 0x77, 0x7C, 0x7E, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x7B, 0x7F, 0x85, 0x85, 0x6C, 0x30, 0x1E, 0x16, 0x0C, 0x11, 0xC0, 0x00, 0x9E,
+  0x07, 0x23, 0x4C, 0x66, 0x6D, 0x70, 0x73, 0x73, 0x6F, 0x74, 0x76, 0x79, 0x7E, 0x82, 0x84, 0x83, 0x80, 0x7E, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 0x80,
+  0x81, 0x69, 0x2D, 0x28, 0x1A, 0x08, 0x04, 0xC0, 0x9E, 0x03, 0x15, 0x47, 0x66, 0x6D, 0x6F, 0x6F, 0x6F, 0x6A, 0x62, 0x70, 0x78, 0x7C, 0x7B, 0x82,
+  0x86, 0x86, 0x85, 0x83, 0x7F, 0x7D, 0x7D, 0x7D, 0x7D, 0x7B, 0x75, 0x60, 0x29, 0x14, 0x0A, 0x02, 0xC0, 0x9E, 0x03, 0x19, 0x52, 0x6B, 0x6F, 0x6F,
+  0x6F, 0x6F, 0x6C, 0x66, 0x6C, 0x78, 0x76, 0x6D, 0x7D, 0x84, 0x86, 0x86, 0x84, 0x80, 0x7D, 0x7D, 0x7D, 0x79, 0x6C, 0x57, 0x4A, 0x31, 0x16, 0x05,
+  0x01, 0xC0, 0x9F, 0x03, 0x15, 0x47, 0x66, 0x6D, 0x6F, 0x6F, 0x70, 0x6B, 0x5A, 0x5A, 0x75, 0x7E, 0x7B, 0x82, 0x86, 0x86, 0x86, 0x86, 0x83, 0x7F,
+  0x7D, 0x7B, 0x73, 0x57, 0x47, 0x43, 0x3C, 0x29, 0x0D, 0x04, 0x01, 0xC0, 0x00, 0x9E, 0x07, 0x23, 0x4C, 0x67, 0x6E, 0x70, 0x75, 0x77, 0x71, 0x71,
+  0x7B, 0x7A, 0x77, 0x81, 0x86, 0x86, 0x86, 0x86, 0x84, 0x7F, 0x7D, 0x7B, 0x70, 0x50, 0x46, 0x45, 0x3F, 0x32, 0x16, 0x13, 0x09, 0xC0, 0x00, 0x9E,
+  0x01, 0x0A, 0x27, 0x56, 0x69, 0x71, 0x7D, 0x80, 0x7D, 0x7B, 0x77, 0x67, 0x62, 0x7A, 0x84, 0x86, 0x86, 0x86, 0x83, 0x7F, 0x7D, 0x7B, 0x73, 0x57,
+  0x49, 0x4B, 0x43, 0x38, 0x31, 0x42, 0x2A, 0xC0, 0x00, 0x9E, 0x01, 0x07, 0x1C, 0x46, 0x5E, 0x6E, 0x7E, 0x82, 0x7E, 0x7A, 0x74, 0x76, 0x76, 0x7C,
+  0x7C, 0x82, 0x86, 0x84, 0x80, 0x7D, 0x7D, 0x7C, 0x7A, 0x67, 0x43, 0x3D, 0x42, 0x3B, 0x4C, 0x60, 0x51, 0xC0, 0x9F, 0x03, 0x07, 0x16, 0x28, 0x39,
+  0x5D, 0x75, 0x7E, 0x80, 0x7D, 0x79, 0x75, 0x7B, 0x7D, 0x76, 0x6C, 0x7C, 0x84, 0x83, 0x7F, 0x7B, 0x79, 0x78, 0x74, 0x58, 0x24, 0x14, 0x15, 0x16,
+  0x28, 0x42, 0x2A, 0xC0, 0x9F, 0x14, 0x1C, 0x39, 0x41, 0x45, 0x6A, 0x7B, 0x7E, 0x7E, 0x7C, 0x77, 0x71, 0x73, 0x77, 0x7C, 0x7A, 0x80, 0x7F, 0x7E,
+  0x7C, 0x75, 0x6D, 0x69, 0x5D, 0x36, 0x0F, 0x04, 0x03, 0x08, 0x17, 0x1C, 0x0D, 0xC0, 0x9F, 0x37, 0x3C, 0x50, 0x56, 0x5C, 0x75, 0x7B, 0x72, 0x70,
+  0x77, 0x70, 0x66, 0x71, 0x7A, 0x7D, 0x7E, 0x7E, 0x7D, 0x7C, 0x7A, 0x6D, 0x67, 0x64, 0x5E, 0x43, 0x13, 0x03, 0x02, 0x0E, 0x29, 0x20, 0x0A, 0xC0,
+  0x9A, 0x34, 0x4B, 0x59, 0x5F, 0x68, 0x77, 0x72, 0x59, 0x56, 0x70, 0x77, 0x74, 0x7A, 0x7C, 0x7E, 0x7E, 0x7D, 0x7E, 0x7E, 0x7C, 0x6C, 0x65, 0x64,
+  0x60, 0x4A, 0x16, 0x03, 0x00, 0x83, 0x05, 0x0F, 0x0B, 0x04, 0xC0, 0x9F, 0x4E, 0x57, 0x5D, 0x63, 0x71, 0x77, 0x6F, 0x64, 0x6B, 0x78, 0x7D, 0x7F,
+  0x80, 0x81, 0x82, 0x82, 0x7F, 0x83, 0x84, 0x7F, 0x6F, 0x66, 0x62, 0x5B, 0x40, 0x13, 0x03, 0x01, 0x03, 0x05, 0x05, 0x02, 0xC0, 0x9F, 0x54, 0x54,
+  0x5B, 0x63, 0x72, 0x71, 0x5F, 0x58, 0x6F, 0x7B, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85, 0x86, 0x83, 0x75, 0x62, 0x50, 0x40, 0x1E, 0x08,
+  0x03, 0x09, 0x17, 0x1C, 0x19, 0x0B, 0xC0, 0x9F, 0x48, 0x47, 0x56, 0x60, 0x6A, 0x6B, 0x6D, 0x6E, 0x79, 0x80, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x84, 0x85, 0x81, 0x69, 0x4C, 0x26, 0x14, 0x09, 0x09, 0x0F, 0x28, 0x51, 0x60, 0x54, 0x30, 0xC0, 0x9F, 0x56, 0x55, 0x5A, 0x5C, 0x5A, 0x5A,
+  0x6F, 0x78, 0x7E, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x80, 0x76, 0x5F, 0x3D, 0x13, 0x04, 0x07, 0x18, 0x30, 0x50, 0x69, 0x79,
+  0x78, 0x6B, 0xC0, 0x96, 0x5C, 0x5C, 0x5D, 0x60, 0x67, 0x6C, 0x72, 0x6F, 0x71, 0x7E, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85, 0x82,
+  0x5F, 0x25, 0x08, 0x00, 0x87, 0x04, 0x1D, 0x4E, 0x55, 0x5A, 0x75, 0x80, 0x7F, 0xC0, 0x96, 0x5B, 0x5D, 0x5D, 0x5F, 0x66, 0x6C, 0x6B, 0x55, 0x57,
+  0x75, 0x81, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x87, 0x89, 0x67, 0x1F, 0x05, 0x00, 0x87, 0x03, 0x1D, 0x5D, 0x71, 0x73, 0x7E, 0x82, 0x82,
+  0xC0, 0x96, 0x4D, 0x58, 0x5D, 0x5F, 0x62, 0x5D, 0x68, 0x61, 0x6C, 0x7D, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7A, 0x50, 0x17,
+  0x03, 0x00, 0x87, 0x03, 0x18, 0x53, 0x75, 0x7F, 0x81, 0x81, 0x7F, 0xC0, 0x96, 0x27, 0x4B, 0x5A, 0x5D, 0x5E, 0x5E, 0x65, 0x66, 0x74, 0x7F, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7E, 0x73, 0x56, 0x2B, 0x0B, 0x01, 0x01, 0x86, 0x09, 0x28, 0x59, 0x76, 0x7D, 0x79, 0x6B, 0xC0, 0x95, 0x15,
+  0x3C, 0x54, 0x5B, 0x5D, 0x5F, 0x64, 0x62, 0x67, 0x72, 0x7E, 0x83, 0x83, 0x83, 0x83, 0x83, 0x7F, 0x74, 0x5C, 0x3F, 0x17, 0x04, 0x02, 0x86, 0x02,
+  0x0A, 0x28, 0x53, 0x60, 0x54, 0x30, 0xC0, 0x95, 0x07, 0x1D, 0x40, 0x55, 0x5C, 0x5F, 0x64, 0x60, 0x5D, 0x5C, 0x72, 0x7E, 0x81, 0x82, 0x81, 0x7F,
+  0x76, 0x5D, 0x3A, 0x20, 0x0A, 0x01, 0x03, 0x85, 0x02, 0x09, 0x18, 0x1C, 0x18, 0x0B, 0xC0, 0x94, 0x01, 0x08, 0x1D, 0x40, 0x56, 0x5E, 0x64, 0x61,
+  0x5E, 0x5C, 0x67, 0x75, 0x7A, 0x7A, 0x7A, 0x74, 0x61, 0x43, 0x1B, 0x09, 0x03, 0x05, 0x84, 0x01, 0x03, 0x03, 0x03, 0x01, 0xC0, 0x00, 0x92, 0x02,
+  0x08, 0x1D, 0x41, 0x58, 0x63, 0x64, 0x61, 0x5A, 0x5F, 0x64, 0x67, 0x67, 0x65, 0x5D, 0x44, 0x20, 0x09, 0x02, 0xC0, 0x01, 0x91, 0x02, 0x09, 0x1F,
+  0x44, 0x54, 0x61, 0x61, 0x56, 0x5B, 0x5F, 0x5F, 0x5E, 0x58, 0x42, 0x22, 0x13, 0x09, 0x02, 0xC0, 0x02, 0x91, 0x03, 0x0F, 0x2C, 0x39, 0x56, 0x65,
+  0x61, 0x5E, 0x5E, 0x5E, 0x5B, 0x4D, 0x25, 0x14, 0x24, 0x18, 0x06, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_TILE_0_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x20C1, 0x3122, 0x3122, 0x3122, 0x3102, 0x2902, 0x2902, 0x2902, 0x3102, 0x3122, 0x3122, 0x3122, 0x20C1,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x2902, 0x3122, 0x3102, 0x2902,
+  0x28E2, 0x28E2, 0x28E2, 0x28E2, 0x28E2, 0x2902, 0x3102, 0x3122, 0x2902, 0x1881, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x2902, 0x3122, 0x2902, 0x28E2, 0x28E2, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28E1, 0x28E2,
+  0x28E2, 0x2902, 0x3122, 0x2902, 0x1881, 0x0820, 0x0820, 0x1040, 0x1060, 0x1040, 0x0020, 0x0000, 0x0000, 0x0000, 0x1061, 0x2902,
+  0x3102, 0x3102, 0x28E2, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x28E1, 0x3102, 0x2902,
+  0x20A1, 0x1060, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20C1, 0x2902, 0x2902, 0x28E1, 0x28E1,
+  0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1881, 0x28E1, 0x3122, 0x28E1, 0x1881, 0x1060,
+  0x1060, 0x1040, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20E1, 0x28E1,
+  0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20A1, 0x20A1, 0x28E2, 0x3102, 0x3102, 0x20C1, 0x1060, 0x0820, 0x0820,
+  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x18A1, 0x28E2, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1,
+  0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x28E2, 0x2902, 0x3122, 0x20C1, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E2, 0x28E2, 0x28E2,
+  0x28E2, 0x28E1, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x28E2, 0x2902, 0x18A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0840, 0x1880, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20E1, 0x28E2, 0x20E1, 0x2902, 0x2902,
+  0x2902, 0x28E2, 0x28E2, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x28E1, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0840, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x18C1, 0x28E2, 0x2902, 0x2902,
+  0x2902, 0x28E2, 0x28E1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1880, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x20E1, 0x28E2, 0x20E1, 0x2902, 0x2902, 0x2902, 0x2902,
+  0x2902, 0x28E2, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20A1, 0x20C1, 0x28E1, 0x20E1, 0x20E1, 0x2902, 0x2902, 0x2902, 0x2902, 0x2902,
+  0x28E2, 0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1060, 0x18A1, 0x20C1, 0x28E2, 0x28E2, 0x28E2, 0x20C1, 0x20E1, 0x20C1, 0x18A1, 0x28E1, 0x2902, 0x2902, 0x2902, 0x2902, 0x28E2,
+  0x28E1, 0x28C1, 0x20C1, 0x20A1, 0x1881, 0x1060, 0x1061, 0x1060, 0x0840, 0x0020, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060,
+  0x20A1, 0x20E1, 0x3102, 0x3102, 0x28E2, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E2, 0x2902, 0x2902, 0x2902, 0x28E2, 0x28E1, 0x28C1,
+  0x28C1, 0x28C1, 0x20C1, 0x20A1, 0x1060, 0x0840, 0x0840, 0x0820, 0x1060, 0x1881, 0x1060, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060,
+  0x20C1, 0x28E2, 0x3102, 0x3102, 0x2902, 0x28E1, 0x28E1, 0x28E1, 0x28E2, 0x20E1, 0x20C1, 0x28E2, 0x28E2, 0x28E2, 0x28E1, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1061,
+  0x20C1, 0x28E2, 0x3102, 0x3102, 0x3102, 0x28E1, 0x20C1, 0x20C1, 0x28E1, 0x28E2, 0x20E1, 0x28E2, 0x28E1, 0x28E1, 0x28C1, 0x20C1,
+  0x18A0, 0x1880, 0x1080, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x18A1, 0x18A1, 0x20C1,
+  0x28E2, 0x28E2, 0x20E1, 0x20E1, 0x28E1, 0x20E1, 0x20C1, 0x20C1, 0x20E1, 0x28E2, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x18A1,
+  0x1080, 0x1080, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1081, 0x20A1, 0x20C1, 0x20C2,
+  0x28E2, 0x20E1, 0x18A1, 0x18A1, 0x20E1, 0x28E2, 0x28E1, 0x28E1, 0x2902, 0x28E2, 0x28E2, 0x28E2, 0x28E2, 0x28E2, 0x28E2, 0x18A1,
+  0x1080, 0x1080, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x28E2, 0x28E2,
+  0x20E1, 0x20C1, 0x20C1, 0x28E2, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x2902, 0x2902, 0x18A1, 0x1080,
+  0x1080, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x28E2, 0x20E1,
+  0x18A1, 0x18A1, 0x20E1, 0x28E2, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3122, 0x3122, 0x2902, 0x20E1, 0x1881,
+  0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x1081, 0x20A1, 0x20C1, 0x20C2, 0x20C2,
+  0x20E1, 0x20E1, 0x28E2, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3122, 0x3102, 0x28E2, 0x20C1, 0x1060,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x0000, 0x18A1, 0x20A1, 0x20A1, 0x20C1, 0x20A1, 0x20A1,
+  0x28E2, 0x28E2, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x28E1, 0x20A1, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x18A1, 0x20C1, 0x20C1, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C2, 0x28E2,
+  0x28E2, 0x28E2, 0x28E2, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x2902, 0x20E1, 0x1881, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1060, 0x1881, 0x1881, 0x20C1, 0x28C1, 0x20C1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C2, 0x28E2, 0x20C1,
+  0x18A1, 0x20A1, 0x28E1, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3122, 0x2902, 0x20C1, 0x1080, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1060, 0x18A1, 0x20A1, 0x28C1, 0x28C1, 0x28C1, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1,
+  0x28E1, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x2902, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0840, 0x20A1, 0x20C1, 0x28C1, 0x28C1, 0x20C1, 0x0020, 0x1061, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x20C1, 0x28E1,
+  0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x20E1, 0x1081, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1060, 0x20A1, 0x20C1, 0x20C1, 0x1881, 0x0000, 0x1040, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x20C1, 0x20E1, 0x3102,
+  0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x3102, 0x28E1, 0x20A1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060,
+  0x1060, 0x0000, 0x0000, 0x0000, 0x1060, 0x18A1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20E1, 0x3102, 0x3102, 0x3102,
+  0x3102, 0x3102, 0x28E1, 0x18A1, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1060, 0x18A1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x18A1, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x18A1, 0x1881, 0x18A1, 0x18A1,
+  0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x1881,
+  0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
+  0x0840, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x20C1, 0x20C1, 0x18A1, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_TILE_0_SPANS = {
+  SPRITE_DIRT_TILE_0_SPAN_ROWS, SPRITE_DIRT_TILE_0_SPAN_OPS, SPRITE_DIRT_TILE_0_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_TILE_0_ASSET = {
   SPRITE_DIRT_TILE_0_WIDTH, SPRITE_DIRT_TILE_0_HEIGHT,
-  SPRITE_DIRT_TILE_0_ALPHA, SPRITE_DIRT_TILE_0_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_TILE_0_SPANS
 };
 
 #endif // SPRITE_DIRT_TILE_0_INCLUDED
@@ -5,86 +5,134 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_tile_1.png (32x32)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_tile_1.png (32x32) — RGBA multi-couleur, encodé en spans
+// 926/1024 pixels visibles, 2993 bytes flash (flat : 3072). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_TILE_1_WIDTH = 32;
 constexpr uint16_t SPRITE_DIRT_TILE_1_HEIGHT = 32;
 
-const uint16_t SPRITE_DIRT_TILE_1_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0820, 0x1061, 0x1881, 0x20C1, 0x3122, 0x3942, 0x3962, 0x3942, 0x3122, 0x1080, 0x0820, 0x1060, 0x3942, 0x4183, 0x18A1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0840, 0x1061, 0x20C1, 0x4163, 0x49A3, 0x49A3, 0x4183, 0x3962, 0x3962, 0x3962, 0x3942, 0x2901, 0x1081, 0x1081, 0x20E1, 0x3942, 0x2902, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0840, 0x28E2, 0x4163, 0x49C4, 0x5A04, 0x6224, 0x5A04, 0x59E4, 0x49A3, 0x3962, 0x3962, 0x3962, 0x3942, 0x3142, 0x3122, 0x3122, 0x28E1, 0x18A1, 0x0840, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x20A1, 0x49A4, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6204, 0x51E4, 0x4183, 0x3982, 0x4183, 0x4183, 0x4183, 0x4183, 0x4162, 0x3942, 0x3102, 0x20C1, 0x3102, 0x3102, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1881, 0x49A3, 0x6224, 0x6225, 0x6224, 0x6224, 0x6225, 0x5A04, 0x4183, 0x4182, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4182, 0x4163, 0x49A3, 0x49A3, 0x3963, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1060, 0x4163, 0x5A04, 0x6204, 0x5A04, 0x59E4, 0x5A04, 0x51E4, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x51C3, 0x49A3, 0x3922, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x18A1, 0x4183, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4182, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x49A3, 0x49A3, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x4983, 0x3122, 0x1881, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x20A1, 0x4183, 0x51E4, 0x51E4, 0x49A3, 0x4182, 0x3962, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x49A3, 0x49C3, 0x49C3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x3122, 0x1881, 0x0020, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1061, 0x28E2, 0x4163, 0x49A3, 0x4183, 0x4162, 0x3962, 0x4162, 0x4183, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4983, 0x3922, 0x1881, 0x0820, 0x0840, 0x20A1, 0x18A1, 0x0840,
-  0x0000, 0x0000, 0x0840, 0x28E1, 0x3942, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4162, 0x4183, 0x4183, 0x4983, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x3963, 0x18A1, 0x0840, 0x0840, 0x0820, 0x0000,
-  0x0000, 0x0020, 0x1881, 0x3922, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4182, 0x4183, 0x49A3, 0x49A3, 0x51C3, 0x59E4, 0x51E4, 0x51E3, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4163, 0x20A1, 0x0820, 0x0000, 0x0000,
-  0x0000, 0x0840, 0x2902, 0x4162, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x49A3, 0x49A3, 0x4183, 0x49A3, 0x51C3, 0x5204, 0x5A04, 0x51E4, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C4, 0x4163, 0x18A1, 0x0820, 0x0000,
-  0x0000, 0x1060, 0x3122, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4182, 0x4182, 0x3962, 0x4162, 0x41A3, 0x51E3, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x51E4, 0x4183, 0x18A1, 0x0020,
-  0x0000, 0x0840, 0x2902, 0x4162, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4162, 0x3962, 0x3962, 0x3962, 0x4183, 0x51E3, 0x5A04, 0x59E4, 0x59E4, 0x51E4, 0x51C4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x59E4, 0x59E4, 0x4163, 0x1061,
-  0x0000, 0x0020, 0x1881, 0x3942, 0x4183, 0x4183, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x4182, 0x3962, 0x3962, 0x4162, 0x41A3, 0x51E3, 0x51E4, 0x51C3, 0x51C3, 0x51C4, 0x59E4, 0x59E4, 0x51C4, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x51E4, 0x59E4, 0x4983, 0x1881,
-  0x0020, 0x1060, 0x20A1, 0x3942, 0x4183, 0x4183, 0x4183, 0x4183, 0x4983, 0x49A3, 0x51C3, 0x49A3, 0x4183, 0x4183, 0x49A3, 0x51C3, 0x51E4, 0x51C3, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x4163, 0x1081,
-  0x0840, 0x28E2, 0x3962, 0x3962, 0x4162, 0x4183, 0x4983, 0x4983, 0x49A3, 0x51E4, 0x51E4, 0x51C3, 0x49A3, 0x51C4, 0x59E4, 0x5A04, 0x59E4, 0x51C4, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x4182, 0x4162, 0x4183, 0x49C3, 0x4183, 0x1881,
-  0x0820, 0x18A1, 0x3942, 0x3962, 0x4182, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x51C3, 0x51C3, 0x5A04, 0x6225, 0x6204, 0x59E4, 0x51C4, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4162, 0x3962, 0x3962, 0x3962, 0x4182, 0x3942, 0x1060,
-  0x1060, 0x18A1, 0x3942, 0x4183, 0x4183, 0x49A3, 0x51A3, 0x51C3, 0x51E4, 0x5A04, 0x5A04, 0x6224, 0x5A04, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6204, 0x51E4, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x4183, 0x3962, 0x3962, 0x3962, 0x3942, 0x3122, 0x1881, 0x0020,
-  0x20E1, 0x2902, 0x4163, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51C4, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x4183, 0x3962, 0x3962, 0x3962, 0x3942, 0x3122, 0x1081, 0x0020,
-  0x0840, 0x1881, 0x3122, 0x4983, 0x49A3, 0x51A3, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51C4, 0x49A3, 0x4983, 0x4183, 0x49A3, 0x49A3, 0x4182, 0x3962, 0x3962, 0x3962, 0x3942, 0x20C1, 0x0840,
-  0x0000, 0x0820, 0x1881, 0x4163, 0x49A3, 0x51A3, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51C3, 0x49A3, 0x51C3, 0x59E4, 0x51C4, 0x51C3, 0x51A3, 0x51C3, 0x51E4, 0x51E3, 0x49A3, 0x4183, 0x4183, 0x4162, 0x3122, 0x1081, 0x0020,
-  0x0000, 0x0000, 0x1040, 0x3122, 0x4983, 0x51A3, 0x51A3, 0x51C3, 0x51E4, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x5A04, 0x51C3, 0x4983, 0x4983, 0x4983, 0x51C3, 0x59E4, 0x5A04, 0x59E4, 0x51E4, 0x5A04, 0x5A04, 0x51E4, 0x51E3, 0x51E3, 0x49C3, 0x3942, 0x1060, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x1881, 0x4163, 0x49A3, 0x51A3, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x6224, 0x6225, 0x5A04, 0x49A3, 0x4183, 0x4183, 0x4183, 0x49A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x4183, 0x18A1, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x1040, 0x3122, 0x4983, 0x49A3, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x49C3, 0x4183, 0x4183, 0x4183, 0x49C3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x3942, 0x1060,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3122, 0x4983, 0x51A3, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x41A3, 0x49A3, 0x51E3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x4183, 0x1081,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3922, 0x49A3, 0x51C4, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x4183, 0x1881,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3943, 0x49A3, 0x51C4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E3, 0x49A3, 0x51C3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x4183, 0x20A1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x20A1, 0x3943, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x51E4, 0x51E4, 0x51E3, 0x49A3, 0x4183, 0x49A3, 0x51E4, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x51C3, 0x3962, 0x28E2,
-  0x0020, 0x0840, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x3942, 0x49A3, 0x51E4, 0x51E4, 0x51E4, 0x49C3, 0x49A3, 0x4183, 0x4183, 0x4182, 0x4182, 0x4183, 0x4183, 0x4183, 0x49A3, 0x51E4, 0x51E4, 0x51E4, 0x49A3, 0x3942, 0x18A1, 0x1060,
-  0x0840, 0x20C1, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x18A1, 0x3942, 0x4183, 0x3942, 0x20E1, 0x2902, 0x3102, 0x3102, 0x3122, 0x3942, 0x4163, 0x3122, 0x18A1, 0x20C1, 0x3942, 0x4183, 0x3942, 0x18A1, 0x1060, 0x0020, 0x0000,
-  0x0020, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1081, 0x1060, 0x0840, 0x0840, 0x0860, 0x0860, 0x1060, 0x20A1, 0x3102, 0x1881, 0x0820, 0x0820, 0x1060, 0x1081, 0x1060, 0x0820, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_TILE_1_SPAN_ROWS[] PROGMEM = {
+  0, 0, 21, 18, 44, 39, 68, 61, 94, 85, 121, 110, 149, 136, 182, 164,
+  215, 194, 248, 224, 282, 255, 315, 285, 349, 317, 383, 349, 417, 381, 451, 413,
+  485, 445, 519, 477, 553, 509, 587, 541, 621, 573, 655, 605, 689, 637, 723, 668,
+  756, 698, 789, 728, 821, 757, 853, 786, 884, 814, 918, 843, 951, 872, 984, 901
 };
 
-const uint8_t SPRITE_DIRT_TILE_1_ALPHA[] PROGMEM = {
-  0x00, 0x01, 0x02, 0x06, 0x0F, 0x13, 0x1C, 0x34, 0x3C, 0x3E, 0x3C, 0x33, 0x18, 0x09, 0x14, 0x38, 0x34, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x08, 0x0B, 0x17, 0x2D, 0x35, 0x38, 0x3D, 0x3E, 0x3E, 0x3E, 0x3A, 0x2C, 0x18, 0x17, 0x27, 0x32, 0x1D, 0x08, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x19, 0x24, 0x34, 0x40, 0x44, 0x44, 0x42, 0x40, 0x3E, 0x3E, 0x3E, 0x3C, 0x36, 0x34, 0x31, 0x25, 0x18, 0x0C, 0x0D, 0x08, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x14, 0x33, 0x41, 0x45, 0x44, 0x41, 0x40, 0x41, 0x40, 0x3F, 0x42, 0x42, 0x41, 0x41, 0x3F, 0x37, 0x32, 0x2D, 0x35, 0x21, 0x0D, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x10, 0x34, 0x43, 0x45, 0x40, 0x35, 0x34, 0x3E, 0x3F, 0x3F, 0x42, 0x43, 0x43, 0x43, 0x43, 0x42, 0x4A, 0x60, 0x6A, 0x4A, 0x2F, 0x1D, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x0D, 0x2D, 0x40, 0x43, 0x3C, 0x34, 0x3A, 0x40, 0x41, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x5E, 0x80, 0x7B, 0x68, 0x51, 0x29, 0x0C, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x16, 0x30, 0x40, 0x43, 0x42, 0x42, 0x40, 0x3F, 0x42, 0x43, 0x43, 0x43, 0x43, 0x44, 0x47, 0x46, 0x58, 0x83, 0x87, 0x6A, 0x5C, 0x5A, 0x2E, 0x0D, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00,
-  0x00, 0x00, 0x07, 0x19, 0x37, 0x4D, 0x52, 0x4D, 0x44, 0x41, 0x42, 0x43, 0x43, 0x43, 0x44, 0x47, 0x4D, 0x49, 0x60, 0x88, 0x92, 0x88, 0x84, 0x86, 0x68, 0x2F, 0x0D, 0x03, 0x05, 0x0F, 0x0B, 0x04,
-  0x00, 0x00, 0x09, 0x1F, 0x3C, 0x68, 0x75, 0x6E, 0x58, 0x4D, 0x43, 0x43, 0x45, 0x43, 0x43, 0x44, 0x48, 0x52, 0x78, 0x8F, 0x96, 0x96, 0x96, 0x96, 0x8B, 0x68, 0x2F, 0x0D, 0x0E, 0x28, 0x1D, 0x09,
-  0x00, 0x04, 0x1C, 0x52, 0x6D, 0x80, 0x85, 0x82, 0x79, 0x6B, 0x4D, 0x46, 0x4B, 0x46, 0x43, 0x41, 0x46, 0x52, 0x72, 0x81, 0x92, 0x98, 0x98, 0x98, 0x96, 0x8A, 0x65, 0x2D, 0x10, 0x10, 0x0B, 0x04,
-  0x00, 0x0A, 0x30, 0x6C, 0x82, 0x87, 0x88, 0x88, 0x85, 0x79, 0x58, 0x4C, 0x56, 0x4A, 0x43, 0x3E, 0x48, 0x4B, 0x4C, 0x57, 0x83, 0x95, 0x98, 0x98, 0x98, 0x95, 0x88, 0x62, 0x2C, 0x0E, 0x03, 0x00,
-  0x04, 0x1A, 0x57, 0x7D, 0x87, 0x88, 0x88, 0x88, 0x88, 0x82, 0x6D, 0x49, 0x3E, 0x3E, 0x40, 0x46, 0x4D, 0x4E, 0x4C, 0x57, 0x7D, 0x92, 0x98, 0x98, 0x98, 0x98, 0x94, 0x84, 0x60, 0x2C, 0x0B, 0x02,
-  0x04, 0x1E, 0x64, 0x82, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x76, 0x4C, 0x3C, 0x3C, 0x3D, 0x43, 0x4C, 0x50, 0x4F, 0x54, 0x68, 0x88, 0x94, 0x97, 0x98, 0x98, 0x99, 0x95, 0x82, 0x5E, 0x2A, 0x0A,
-  0x04, 0x1A, 0x57, 0x7E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x79, 0x50, 0x3F, 0x3D, 0x3D, 0x41, 0x4B, 0x4F, 0x4F, 0x51, 0x5B, 0x76, 0x83, 0x92, 0x98, 0x98, 0x98, 0x97, 0x8B, 0x7C, 0x56, 0x1C,
-  0x02, 0x0D, 0x32, 0x6F, 0x85, 0x88, 0x88, 0x88, 0x88, 0x86, 0x7E, 0x5A, 0x45, 0x3F, 0x3D, 0x3E, 0x45, 0x4B, 0x4A, 0x4B, 0x4C, 0x4F, 0x59, 0x85, 0x95, 0x96, 0x92, 0x8B, 0x83, 0x76, 0x57, 0x1D,
-  0x06, 0x15, 0x2F, 0x6E, 0x86, 0x88, 0x88, 0x86, 0x84, 0x82, 0x7F, 0x75, 0x58, 0x47, 0x43, 0x3D, 0x3A, 0x45, 0x48, 0x49, 0x49, 0x49, 0x56, 0x83, 0x95, 0x93, 0x85, 0x72, 0x6E, 0x5B, 0x3F, 0x14,
-  0x10, 0x33, 0x4E, 0x7B, 0x89, 0x86, 0x83, 0x7F, 0x7A, 0x7B, 0x7C, 0x7F, 0x6F, 0x57, 0x53, 0x4F, 0x49, 0x4B, 0x49, 0x49, 0x49, 0x4A, 0x55, 0x77, 0x91, 0x96, 0x92, 0x83, 0x77, 0x6F, 0x57, 0x1D,
-  0x0A, 0x27, 0x60, 0x85, 0x89, 0x7D, 0x79, 0x76, 0x74, 0x76, 0x72, 0x6A, 0x61, 0x50, 0x55, 0x58, 0x58, 0x54, 0x4D, 0x49, 0x49, 0x48, 0x4A, 0x59, 0x87, 0x96, 0x90, 0x80, 0x77, 0x6F, 0x53, 0x1B,
-  0x12, 0x26, 0x65, 0x84, 0x85, 0x7D, 0x7E, 0x78, 0x74, 0x6E, 0x64, 0x5E, 0x5B, 0x57, 0x59, 0x5B, 0x5B, 0x57, 0x4F, 0x49, 0x49, 0x49, 0x49, 0x59, 0x86, 0x8E, 0x82, 0x78, 0x72, 0x60, 0x2D, 0x0B,
-  0x29, 0x32, 0x64, 0x7A, 0x7A, 0x7E, 0x82, 0x7A, 0x6F, 0x63, 0x5D, 0x5B, 0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5B, 0x55, 0x4D, 0x49, 0x46, 0x49, 0x62, 0x82, 0x80, 0x79, 0x74, 0x71, 0x5B, 0x22, 0x06,
-  0x10, 0x1F, 0x52, 0x71, 0x72, 0x74, 0x71, 0x66, 0x5F, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5E, 0x61, 0x63, 0x61, 0x5A, 0x4E, 0x48, 0x41, 0x48, 0x70, 0x7D, 0x79, 0x74, 0x74, 0x70, 0x5B, 0x28, 0x09,
-  0x02, 0x0A, 0x2B, 0x60, 0x6D, 0x68, 0x55, 0x4B, 0x53, 0x58, 0x5B, 0x5B, 0x5B, 0x5D, 0x66, 0x72, 0x75, 0x71, 0x63, 0x55, 0x4D, 0x4E, 0x57, 0x72, 0x79, 0x78, 0x74, 0x73, 0x6F, 0x59, 0x1F, 0x05,
-  0x00, 0x03, 0x18, 0x4E, 0x69, 0x6B, 0x64, 0x5F, 0x5C, 0x59, 0x58, 0x5B, 0x5C, 0x62, 0x72, 0x7A, 0x7C, 0x7B, 0x75, 0x68, 0x5B, 0x67, 0x70, 0x79, 0x7C, 0x7A, 0x72, 0x6E, 0x6B, 0x58, 0x1C, 0x04,
-  0x00, 0x00, 0x09, 0x29, 0x5B, 0x6C, 0x6D, 0x6C, 0x67, 0x5F, 0x58, 0x5A, 0x5B, 0x62, 0x74, 0x7C, 0x7C, 0x7C, 0x7B, 0x77, 0x70, 0x76, 0x7A, 0x82, 0x7D, 0x74, 0x6D, 0x6C, 0x6A, 0x59, 0x26, 0x09,
-  0x00, 0x00, 0x03, 0x18, 0x4B, 0x67, 0x6D, 0x6F, 0x6D, 0x66, 0x5A, 0x56, 0x57, 0x5F, 0x6F, 0x77, 0x71, 0x70, 0x78, 0x79, 0x78, 0x79, 0x7E, 0x82, 0x76, 0x6F, 0x6C, 0x6C, 0x6C, 0x64, 0x46, 0x16,
-  0x00, 0x00, 0x00, 0x08, 0x24, 0x4C, 0x66, 0x6C, 0x69, 0x5E, 0x57, 0x54, 0x54, 0x58, 0x5F, 0x66, 0x56, 0x52, 0x6D, 0x77, 0x79, 0x7D, 0x84, 0x83, 0x74, 0x6D, 0x6C, 0x6C, 0x6C, 0x69, 0x52, 0x1C,
-  0x00, 0x00, 0x00, 0x02, 0x09, 0x23, 0x48, 0x5A, 0x5A, 0x56, 0x55, 0x54, 0x54, 0x54, 0x57, 0x58, 0x53, 0x58, 0x6E, 0x76, 0x79, 0x7D, 0x85, 0x84, 0x77, 0x6F, 0x6C, 0x6C, 0x6C, 0x6A, 0x56, 0x1E,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x1A, 0x2A, 0x33, 0x4B, 0x53, 0x54, 0x54, 0x54, 0x54, 0x54, 0x56, 0x5F, 0x6C, 0x6F, 0x75, 0x79, 0x83, 0x86, 0x80, 0x76, 0x6F, 0x6D, 0x6D, 0x6E, 0x58, 0x22,
-  0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0B, 0x19, 0x3F, 0x4F, 0x52, 0x54, 0x54, 0x54, 0x53, 0x5A, 0x67, 0x68, 0x60, 0x6F, 0x77, 0x7C, 0x82, 0x84, 0x80, 0x77, 0x73, 0x71, 0x6C, 0x44, 0x20,
-  0x04, 0x09, 0x06, 0x02, 0x00, 0x00, 0x00, 0x02, 0x07, 0x1C, 0x38, 0x44, 0x4E, 0x51, 0x4E, 0x4B, 0x58, 0x6A, 0x6C, 0x6A, 0x74, 0x7D, 0x76, 0x6E, 0x71, 0x7E, 0x7F, 0x79, 0x69, 0x54, 0x23, 0x0C,
-  0x09, 0x18, 0x11, 0x05, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x11, 0x1D, 0x37, 0x3E, 0x38, 0x2D, 0x47, 0x56, 0x59, 0x5C, 0x69, 0x75, 0x5C, 0x32, 0x33, 0x59, 0x66, 0x58, 0x2F, 0x1A, 0x08, 0x02,
-  0x04, 0x0A, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x12, 0x14, 0x12, 0x0D, 0x18, 0x1D, 0x1E, 0x22, 0x37, 0x59, 0x31, 0x0F, 0x0C, 0x1C, 0x22, 0x1C, 0x0B, 0x03, 0x01, 0x00
+const uint8_t SPRITE_DIRT_TILE_1_SPAN_OPS[] PROGMEM = {
+  0x00, 0x91, 0x01, 0x02, 0x06, 0x0F, 0x13, 0x1C, 0x34, 0x3C, 0x3E, 0x3C, 0x33, 0x18, 0x09, 0x14, 0x38, 0x34, 0x14, 0x05, 0xC0, 0x94, 0x02, 0x08,
+  0x0B, 0x17, 0x2D, 0x35, 0x38, 0x3D, 0x3E, 0x3E, 0x3E, 0x3A, 0x2C, 0x18, 0x17, 0x27, 0x32, 0x1D, 0x08, 0x03, 0x01, 0xC0, 0x95, 0x07, 0x19, 0x24,
+  0x34, 0x40, 0x44, 0x44, 0x42, 0x40, 0x3E, 0x3E, 0x3E, 0x3C, 0x36, 0x34, 0x31, 0x25, 0x18, 0x0C, 0x0D, 0x08, 0x03, 0xC0, 0x97, 0x04, 0x14, 0x33,
+  0x41, 0x45, 0x44, 0x41, 0x40, 0x41, 0x40, 0x3F, 0x42, 0x42, 0x41, 0x41, 0x3F, 0x37, 0x32, 0x2D, 0x35, 0x21, 0x0D, 0x05, 0x01, 0xC0, 0x98, 0x02,
+  0x10, 0x34, 0x43, 0x45, 0x40, 0x35, 0x34, 0x3E, 0x3F, 0x3F, 0x42, 0x43, 0x43, 0x43, 0x43, 0x42, 0x4A, 0x60, 0x6A, 0x4A, 0x2F, 0x1D, 0x0A, 0x02,
+  0xC0, 0x99, 0x02, 0x0D, 0x2D, 0x40, 0x43, 0x3C, 0x34, 0x3A, 0x40, 0x41, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x48, 0x5E, 0x80, 0x7B, 0x68,
+  0x51, 0x29, 0x0C, 0x02, 0xC0, 0x00, 0x99, 0x05, 0x16, 0x30, 0x40, 0x43, 0x42, 0x42, 0x40, 0x3F, 0x42, 0x43, 0x43, 0x43, 0x43, 0x44, 0x47, 0x46,
+  0x58, 0x83, 0x87, 0x6A, 0x5C, 0x5A, 0x2E, 0x0D, 0x02, 0x01, 0x81, 0x02, 0x02, 0xC0, 0x01, 0x9D, 0x07, 0x19, 0x37, 0x4D, 0x52, 0x4D, 0x44, 0x41,
+  0x42, 0x43, 0x43, 0x43, 0x44, 0x47, 0x4D, 0x49, 0x60, 0x88, 0x92, 0x88, 0x84, 0x86, 0x68, 0x2F, 0x0D, 0x03, 0x05, 0x0F, 0x0B, 0x04, 0xC0, 0x01,
+  0x9D, 0x09, 0x1F, 0x3C, 0x68, 0x75, 0x6E, 0x58, 0x4D, 0x43, 0x43, 0x45, 0x43, 0x43, 0x44, 0x48, 0x52, 0x78, 0x8F, 0x96, 0x96, 0x96, 0x96, 0x8B,
+  0x68, 0x2F, 0x0D, 0x0E, 0x28, 0x1D, 0x09, 0xC0, 0x00, 0x9E, 0x04, 0x1C, 0x52, 0x6D, 0x80, 0x85, 0x82, 0x79, 0x6B, 0x4D, 0x46, 0x4B, 0x46, 0x43,
+  0x41, 0x46, 0x52, 0x72, 0x81, 0x92, 0x98, 0x98, 0x98, 0x96, 0x8A, 0x65, 0x2D, 0x10, 0x10, 0x0B, 0x04, 0xC0, 0x00, 0x9D, 0x0A, 0x30, 0x6C, 0x82,
+  0x87, 0x88, 0x88, 0x85, 0x79, 0x58, 0x4C, 0x56, 0x4A, 0x43, 0x3E, 0x48, 0x4B, 0x4C, 0x57, 0x83, 0x95, 0x98, 0x98, 0x98, 0x95, 0x88, 0x62, 0x2C,
+  0x0E, 0x03, 0xC0, 0x9F, 0x04, 0x1A, 0x57, 0x7D, 0x87, 0x88, 0x88, 0x88, 0x88, 0x82, 0x6D, 0x49, 0x3E, 0x3E, 0x40, 0x46, 0x4D, 0x4E, 0x4C, 0x57,
+  0x7D, 0x92, 0x98, 0x98, 0x98, 0x98, 0x94, 0x84, 0x60, 0x2C, 0x0B, 0x02, 0xC0, 0x9F, 0x04, 0x1E, 0x64, 0x82, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86,
+  0x76, 0x4C, 0x3C, 0x3C, 0x3D, 0x43, 0x4C, 0x50, 0x4F, 0x54, 0x68, 0x88, 0x94, 0x97, 0x98, 0x98, 0x99, 0x95, 0x82, 0x5E, 0x2A, 0x0A, 0xC0, 0x9F,
+  0x04, 0x1A, 0x57, 0x7E, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x79, 0x50, 0x3F, 0x3D, 0x3D, 0x41, 0x4B, 0x4F, 0x4F, 0x51, 0x5B, 0x76, 0x83, 0x92,
+  0x98, 0x98, 0x98, 0x97, 0x8B, 0x7C, 0x56, 0x1C, 0xC0, 0x9F, 0x02, 0x0D, 0x32, 0x6F, 0x85, 0x88, 0x88, 0x88, 0x88, 0x86, 0x7E, 0x5A, 0x45, 0x3F,
+  0x3D, 0x3E, 0x45, 0x4B, 0x4A, 0x4B, 0x4C, 0x4F, 0x59, 0x85, 0x95, 0x96, 0x92, 0x8B, 0x83, 0x76, 0x57, 0x1D, 0xC0, 0x9F, 0x06, 0x15, 0x2F, 0x6E,
+  0x86, 0x88, 0x88, 0x86, 0x84, 0x82, 0x7F, 0x75, 0x58, 0x47, 0x43, 0x3D, 0x3A, 0x45, 0x48, 0x49, 0x49, 0x49, 0x56, 0x83, 0x95, 0x93, 0x85, 0x72,
+  0x6E, 0x5B, 0x3F, 0x14, 0xC0, 0x9F, 0x10, 0x33, 0x4E, 0x7B, 0x89, 0x86, 0x83, 0x7F, 0x7A, 0x7B, 0x7C, 0x7F, 0x6F, 0x57, 0x53, 0x4F, 0x49, 0x4B,
+  0x49, 0x49, 0x49, 0x4A, 0x55, 0x77, 0x91, 0x96, 0x92, 0x83, 0x77, 0x6F, 0x57, 0x1D, 0xC0, 0x9F, 0x0A, 0x27, 0x60, 0x85, 0x89, 0x7D, 0x79, 0x76,
+  0x74, 0x76, 0x72, 0x6A, 0x61, 0x50, 0x55, 0x58, 0x58, 0x54, 0x4D, 0x49, 0x49, 0x48, 0x4A, 0x59, 0x87, 0x96, 0x90, 0x80, 0x77, 0x6F, 0x53, 0x1B,
+  0xC0, 0x9F, 0x12, 0x26, 0x65, 0x84, 0x85, 0x7D, 0x7E, 0x78, 0x74, 0x6E, 0x64, 0x5E, 0x5B, 0x57, 0x59, 0x5B, 0x5B, 0x57, 0x4F, 0x49, 0x49, 0x49,
+  0x49, 0x59, 0x86, 0x8E, 0x82, 0x78, 0x72, 0x60, 0x2D, 0x0B, 0xC0, 0x9F, 0x29, 0x32, 0x64, 0x7A, 0x7A, 0x7E, 0x82, 0x7A, 0x6F, 0x63, 0x5D, 0x5B,
+  0x5B, 0x5B, 0x5B, 0x5C, 0x5C, 0x5B, 0x55, 0x4D, 0x49, 0x46, 0x49, 0x62, 0x82, 0x80, 0x79, 0x74, 0x71, 0x5B, 0x22, 0x06, 0xC0, 0x9F, 0x10, 0x1F,
+  0x52, 0x71, 0x72, 0x74, 0x71, 0x66, 0x5F, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5E, 0x61, 0x63, 0x61, 0x5A, 0x4E, 0x48, 0x41, 0x48, 0x70, 0x7D, 0x79,
+  0x74, 0x74, 0x70, 0x5B, 0x28, 0x09, 0xC0, 0x9F, 0x02, 0x0A, 0x2B, 0x60, 0x6D, 0x68, 0x55, 0x4B, 0x53, 0x58, 0x5B, 0x5B, 0x5B, 0x5D, 0x66, 0x72,
+  0x75, 0x71, 0x63, 0x55, 0x4D, 0x4E, 0x57, 0x72, 0x79, 0x78, 0x74, 0x73, 0x6F, 0x59, 0x1F, 0x05, 0xC0, 0x00, 0x9E, 0x03, 0x18, 0x4E, 0x69, 0x6B,
+  0x64, 0x5F, 0x5C, 0x59, 0x58, 0x5B, 0x5C, 0x62, 0x72, 0x7A, 0x7C, 0x7B, 0x75, 0x68, 0x5B, 0x67, 0x70, 0x79, 0x7C, 0x7A, 0x72, 0x6E, 0x6B, 0x58,
+  0x1C, 0x04, 0xC0, 0x01, 0x9D, 0x09, 0x29, 0x5B, 0x6C, 0x6D, 0x6C, 0x67, 0x5F, 0x58, 0x5A, 0x5B, 0x62, 0x74, 0x7C, 0x7C, 0x7C, 0x7B, 0x77, 0x70,
+  0x76, 0x7A, 0x82, 0x7D, 0x74, 0x6D, 0x6C, 0x6A, 0x59, 0x26, 0x09, 0xC0, 0x01, 0x9D, 0x03, 0x18, 0x4B, 0x67, 0x6D, 0x6F, 0x6D, 0x66, 0x5A, 0x56,
+  0x57, 0x5F, 0x6F, 0x77, 0x71, 0x70, 0x78, 0x79, 0x78, 0x79, 0x7E, 0x82, 0x76, 0x6F, 0x6C, 0x6C, 0x6C, 0x64, 0x46, 0x16, 0xC0, 0x02, 0x9C, 0x08,
+  0x24, 0x4C, 0x66, 0x6C, 0x69, 0x5E, 0x57, 0x54, 0x54, 0x58, 0x5F, 0x66, 0x56, 0x52, 0x6D, 0x77, 0x79, 0x7D, 0x84, 0x83, 0x74, 0x6D, 0x6C, 0x6C,
+  0x6C, 0x69, 0x52, 0x1C, 0xC0, 0x02, 0x9C, 0x02, 0x09, 0x23, 0x48, 0x5A, 0x5A, 0x56, 0x55, 0x54, 0x54, 0x54, 0x57, 0x58, 0x53, 0x58, 0x6E, 0x76,
+  0x79, 0x7D, 0x85, 0x84, 0x77, 0x6F, 0x6C, 0x6C, 0x6C, 0x6A, 0x56, 0x1E, 0xC0, 0x03, 0x9B, 0x02, 0x08, 0x1A, 0x2A, 0x33, 0x4B, 0x53, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x56, 0x5F, 0x6C, 0x6F, 0x75, 0x79, 0x83, 0x86, 0x80, 0x76, 0x6F, 0x6D, 0x6D, 0x6E, 0x58, 0x22, 0xC0, 0x00, 0x81, 0x02, 0x01,
+  0x01, 0x9A, 0x01, 0x05, 0x0B, 0x19, 0x3F, 0x4F, 0x52, 0x54, 0x54, 0x54, 0x53, 0x5A, 0x67, 0x68, 0x60, 0x6F, 0x77, 0x7C, 0x82, 0x84, 0x80, 0x77,
+  0x73, 0x71, 0x6C, 0x44, 0x20, 0xC0, 0x83, 0x04, 0x09, 0x06, 0x02, 0x02, 0x98, 0x02, 0x07, 0x1C, 0x38, 0x44, 0x4E, 0x51, 0x4E, 0x4B, 0x58, 0x6A,
+  0x6C, 0x6A, 0x74, 0x7D, 0x76, 0x6E, 0x71, 0x7E, 0x7F, 0x79, 0x69, 0x54, 0x23, 0x0C, 0xC0, 0x84, 0x09, 0x18, 0x11, 0x05, 0x01, 0x02, 0x97, 0x01,
+  0x06, 0x11, 0x1D, 0x37, 0x3E, 0x38, 0x2D, 0x47, 0x56, 0x59, 0x5C, 0x69, 0x75, 0x5C, 0x32, 0x33, 0x59, 0x66, 0x58, 0x2F, 0x1A, 0x08, 0x02, 0xC0,
+  0x83, 0x04, 0x0A, 0x07, 0x02, 0x05, 0x94, 0x02, 0x06, 0x12, 0x14, 0x12, 0x0D, 0x18, 0x1D, 0x1E, 0x22, 0x37, 0x59, 0x31, 0x0F, 0x0C, 0x1C, 0x22,
+  0x1C, 0x0B, 0x03, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_TILE_1_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840, 0x0820, 0x0000, 0x0000, 0x0000, 0x0840, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x0840, 0x0840, 0x1060, 0x0840, 0x0840, 0x0840, 0x0840, 0x0020, 0x0000,
+  0x0000, 0x0020, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0860, 0x1081, 0x1881, 0x1881, 0x1061, 0x1060,
+  0x0840, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x1081, 0x1881, 0x1881, 0x1881, 0x1881, 0x1061, 0x1060, 0x0860, 0x1060, 0x1060, 0x1060, 0x1060, 0x1040, 0x0840, 0x0820, 0x0020,
+  0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x1881, 0x1881, 0x1060, 0x1061, 0x1081, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x18A1, 0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x1081, 0x1881, 0x1081, 0x1060, 0x1060, 0x1061, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1881, 0x20C1, 0x20C1, 0x18A1, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1081, 0x1081, 0x1081, 0x1061, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x20C1, 0x28C1, 0x20A1, 0x1881, 0x1060, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x1881, 0x1080, 0x1060, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1080, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x28C1, 0x20C1, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1881, 0x20C1, 0x18A1, 0x1060, 0x1060, 0x1040, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1080, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0840, 0x1880, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1080, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1860, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1080, 0x1060, 0x1881, 0x1060, 0x1060, 0x1061, 0x1081, 0x1080,
+  0x1080, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x18A1, 0x18A1, 0x1881,
+  0x18A1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x2901, 0x28E2, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1060, 0x1060, 0x0840, 0x1040, 0x1060, 0x1880, 0x18A1, 0x18A1,
+  0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E2, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1060, 0x0840, 0x0840, 0x0840, 0x1060, 0x1080, 0x18A1, 0x1881,
+  0x1881, 0x18A1, 0x20C1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E1, 0x28E2, 0x28E2, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1880, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x1080, 0x0860, 0x0840, 0x1040, 0x1060, 0x1080, 0x1081, 0x1060,
+  0x1060, 0x1881, 0x1881, 0x18A1, 0x28E2, 0x28E1, 0x28E1, 0x28E1, 0x20C1, 0x28E2, 0x28E1, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1880, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x20C1, 0x1081, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1881, 0x28C1, 0x28E1, 0x28E1, 0x20C1, 0x18A1, 0x18A1, 0x1881, 0x1040, 0x0000, 0x0000, 0x0020, 0x1060,
+  0x18A0, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20E1, 0x28E2, 0x28E1, 0x18A1, 0x1881, 0x1881, 0x18A1, 0x1881, 0x1061, 0x1060,
+  0x1060, 0x1060, 0x1060, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x20C1, 0x20A1, 0x18A1, 0x18C1, 0x1081, 0x0000, 0x0000, 0x0000, 0x1060,
+  0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28E1, 0x20E1, 0x20C1, 0x18A1, 0x1880, 0x18A1, 0x20A1, 0x20A1, 0x18A1, 0x1881,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x20C1, 0x20C1, 0x18C1, 0x18A1, 0x18A0, 0x18A0, 0x1060, 0x0000, 0x0000, 0x0000, 0x1080,
+  0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x20C1, 0x20E1, 0x20E1, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x1881,
+  0x1060, 0x1060, 0x1060, 0x1060, 0x1881, 0x20C1, 0x18C1, 0x18A1, 0x18A0, 0x1880, 0x1060, 0x0000, 0x0000, 0x0020, 0x0020, 0x1881,
+  0x20C1, 0x20C1, 0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20A1, 0x18A1,
+  0x1881, 0x1060, 0x1060, 0x1060, 0x1881, 0x20C1, 0x18A1, 0x18A0, 0x18A0, 0x1880, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x18A1, 0x18A1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1,
+  0x1881, 0x1060, 0x1060, 0x1060, 0x18A1, 0x20C1, 0x18A0, 0x18A0, 0x18A0, 0x1880, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1881, 0x18A1, 0x20A1, 0x1881, 0x1060, 0x1881, 0x18A1, 0x20A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1,
+  0x1881, 0x1880, 0x1880, 0x1881, 0x20C1, 0x20E1, 0x20C1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x1881, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x20C1, 0x20A1, 0x20C1, 0x20C1,
+  0x18A1, 0x20C1, 0x20C1, 0x28E1, 0x2902, 0x20E1, 0x20C1, 0x20C1, 0x18A1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x18A1,
+  0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x18A1, 0x20A1, 0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20E1, 0x20E1, 0x28E1,
+  0x28E1, 0x2902, 0x2902, 0x28E1, 0x20E1, 0x20E1, 0x20C1, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x18A1, 0x20A1,
+  0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x18C1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20E1, 0x28E1, 0x28E1, 0x2902, 0x2902,
+  0x28E1, 0x20E1, 0x20E1, 0x20E1, 0x20E1, 0x20C1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20A1, 0x20A1, 0x20A1, 0x18A1,
+  0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1081, 0x1080, 0x20C1, 0x28E1, 0x28E1, 0x2902, 0x2902, 0x2902, 0x28E1, 0x20E1, 0x20E1,
+  0x20E1, 0x20E1, 0x20C1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1,
+  0x18A1, 0x18A1, 0x1881, 0x18A1, 0x20E1, 0x28E1, 0x28E1, 0x28E2, 0x2902, 0x2902, 0x28E1, 0x20E1, 0x20E1, 0x20E1, 0x20E1, 0x20C1,
+  0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1061, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1,
+  0x20E1, 0x20E1, 0x20E1, 0x20C1, 0x28E1, 0x2902, 0x2902, 0x28E1, 0x20E1, 0x20E1, 0x20E1, 0x20C1, 0x1081, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1880, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x18A1, 0x18A1,
+  0x18A1, 0x20C1, 0x28E2, 0x28E2, 0x2902, 0x28E1, 0x20E1, 0x20C1, 0x20C1, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0840, 0x1060, 0x1881, 0x1881, 0x1881, 0x1060, 0x1881, 0x1881, 0x18A1, 0x1880, 0x18A0, 0x20C1, 0x18A1, 0x18A1,
+  0x18A1, 0x28E2, 0x28E2, 0x20E1, 0x18A1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0840, 0x1060, 0x0840, 0x0020, 0x0840, 0x1040, 0x1040, 0x1060, 0x1080, 0x18A1, 0x1060, 0x0000, 0x0020, 0x1060, 0x1881,
+  0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_TILE_1_SPANS = {
+  SPRITE_DIRT_TILE_1_SPAN_ROWS, SPRITE_DIRT_TILE_1_SPAN_OPS, SPRITE_DIRT_TILE_1_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_TILE_1_ASSET = {
   SPRITE_DIRT_TILE_1_WIDTH, SPRITE_DIRT_TILE_1_HEIGHT,
-  SPRITE_DIRT_TILE_1_ALPHA, SPRITE_DIRT_TILE_1_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_TILE_1_SPANS
 };
 
 #endif // SPRITE_DIRT_TILE_1_INCLUDED
@@ -5,86 +5,138 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from dirt_tile_2.png (32x32)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from dirt_tile_2.png (32x32) — RGBA multi-couleur, encodé en spans
+// 965/1024 pixels visibles, 3108 bytes flash (flat : 3072). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DIRT_TILE_2_WIDTH = 32;
 constexpr uint16_t SPRITE_DIRT_TILE_2_HEIGHT = 32;
 
-const uint16_t SPRITE_DIRT_TILE_2_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x0860, 0x0860, 0x1060, 0x1060, 0x1881, 0x28E2, 0x51C4, 0x6204, 0x51C4, 0x20C1, 0x0820, 0x0000, 0x0000, 0x0820, 0x1060, 0x1081, 0x1060, 0x0820, 0x0840, 0x20E1, 0x20E1, 0x0840,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1061, 0x28E1, 0x2902, 0x2902, 0x2902, 0x3122, 0x3963, 0x49A3, 0x5A04, 0x6225, 0x5A04, 0x4183, 0x20A1, 0x0840, 0x1060, 0x18A1, 0x3942, 0x4183, 0x3942, 0x20A1, 0x1061, 0x1060, 0x0840, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x3102, 0x3962, 0x3962, 0x3942, 0x3942, 0x3962, 0x4183, 0x49A3, 0x5A04, 0x6225, 0x6225, 0x5A04, 0x4163, 0x20C1, 0x3942, 0x4983, 0x51E4, 0x51E4, 0x51E4, 0x4983, 0x3142, 0x1060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1881, 0x3122, 0x3122, 0x3942, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x51E4, 0x6225, 0x6225, 0x6224, 0x51C4, 0x3122, 0x49A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x18A1, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x3122, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x49A3, 0x5A04, 0x6225, 0x5A04, 0x51C4, 0x49C3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x3942, 0x1060, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x18A1, 0x4183, 0x4182, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x5A04, 0x6224, 0x51E4, 0x4163, 0x49C3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x4183, 0x1061, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1060, 0x3942, 0x49C3, 0x4183, 0x3962, 0x4182, 0x4182, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x51E4, 0x59E4, 0x51E4, 0x51C3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x3942, 0x1060, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x18A1, 0x4183, 0x51C3, 0x4183, 0x4182, 0x49A3, 0x49A3, 0x4182, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x4183, 0x49A3, 0x51C3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x59E4, 0x49A3, 0x18A1, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x1060, 0x3942, 0x51E4, 0x51E3, 0x41A3, 0x4182, 0x4183, 0x4182, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4182, 0x4182, 0x41A3, 0x51E3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51C3, 0x4163, 0x1081, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x18A1, 0x49A3, 0x59E4, 0x5A04, 0x51C3, 0x41A3, 0x4162, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x4183, 0x4182, 0x41A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x51E3, 0x4183, 0x3942, 0x18A1, 0x0840, 0x0020,
-  0x0000, 0x0840, 0x3122, 0x51C3, 0x5A04, 0x5A04, 0x5204, 0x51E3, 0x41A3, 0x4162, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4162, 0x49A3, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4182, 0x3962, 0x3942, 0x3102, 0x1881,
-  0x0000, 0x1060, 0x3963, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4183, 0x4183, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x5A04, 0x6204, 0x5A04, 0x51C3, 0x4183, 0x3962, 0x3962, 0x3942, 0x3122,
-  0x0000, 0x1060, 0x4163, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6224, 0x5A04, 0x5A04, 0x51E4, 0x4183, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x5A04, 0x6204, 0x5A04, 0x51E3, 0x41A3, 0x3962, 0x3962, 0x3962, 0x3962,
-  0x0000, 0x1060, 0x3943, 0x51C3, 0x51E4, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x4183, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4162, 0x4183, 0x5A04, 0x6204, 0x5A04, 0x5A04, 0x49C3, 0x4183, 0x3962, 0x3962, 0x3962,
-  0x0020, 0x1881, 0x4143, 0x51C3, 0x59E4, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x49A3, 0x4182, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4183, 0x49A3, 0x49A3, 0x5A04, 0x6204, 0x5A04, 0x5A04, 0x51E3, 0x4183, 0x3962, 0x3962, 0x3962,
-  0x0840, 0x20C1, 0x3942, 0x49A3, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x6204, 0x51E4, 0x49A3, 0x4162, 0x3962, 0x3962, 0x3962, 0x3962, 0x3962, 0x4182, 0x49A3, 0x59E4, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x51E3, 0x4183, 0x3962, 0x3962, 0x3962,
-  0x0020, 0x0840, 0x18A1, 0x3942, 0x59E4, 0x5A04, 0x51E4, 0x51C3, 0x49A3, 0x49A3, 0x51C4, 0x5A04, 0x5A24, 0x59E4, 0x49A3, 0x4162, 0x3962, 0x3962, 0x3962, 0x4162, 0x49A3, 0x59E4, 0x6224, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x51E3, 0x4183, 0x3962, 0x3962, 0x4183,
-  0x0020, 0x0840, 0x1060, 0x20C1, 0x49A3, 0x5A04, 0x51E4, 0x49A3, 0x4983, 0x49A3, 0x51C4, 0x5A04, 0x6225, 0x6224, 0x59E4, 0x49A3, 0x4183, 0x4183, 0x4183, 0x49A3, 0x59E4, 0x6224, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x49C3, 0x4183, 0x3962, 0x3962, 0x3962,
-  0x0840, 0x20A1, 0x20A1, 0x18A1, 0x3962, 0x51C4, 0x49C3, 0x49A3, 0x4983, 0x51C3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x51E4, 0x41A3, 0x4162, 0x3962, 0x3962, 0x3962,
-  0x0000, 0x0840, 0x0840, 0x1060, 0x3142, 0x49A3, 0x49A3, 0x49A3, 0x51C3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4183, 0x3962, 0x3962, 0x3962,
-  0x0000, 0x0000, 0x0000, 0x0840, 0x3122, 0x4182, 0x49A3, 0x51C3, 0x59E4, 0x6204, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x51E4, 0x49A3, 0x4183, 0x3962,
-  0x0000, 0x0000, 0x0000, 0x0840, 0x20E1, 0x3942, 0x4162, 0x49A3, 0x51C3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6224, 0x5A04, 0x51E4, 0x4183,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x1080, 0x3122, 0x3962, 0x4162, 0x49A3, 0x5A04, 0x6225, 0x6225, 0x6225, 0x6224, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x49C3,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20E1, 0x3142, 0x3962, 0x4183, 0x51E4, 0x6224, 0x6225, 0x6225, 0x6225, 0x6224, 0x6224, 0x6225, 0x6225, 0x6225, 0x5A04, 0x49C3, 0x49A3, 0x51E4, 0x5A04, 0x51E4, 0x51E4, 0x5A04, 0x6204, 0x6225, 0x6225, 0x6225, 0x5A04,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x28E1, 0x3942, 0x3962, 0x49A3, 0x59E4, 0x6224, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x6225, 0x5A04, 0x51C4, 0x49A3, 0x49A3, 0x51E4, 0x51E4, 0x51C3, 0x49A3, 0x51C3, 0x59E4, 0x6204, 0x6225, 0x6225, 0x6225,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1060, 0x28E1, 0x3122, 0x3962, 0x41A3, 0x51E4, 0x5A04, 0x5A04, 0x5A04, 0x6224, 0x6225, 0x5A04, 0x51C4, 0x51A3, 0x51A3, 0x51A3, 0x51C3, 0x51C3, 0x49A3, 0x4983, 0x49A3, 0x51C4, 0x5A04, 0x6225, 0x6225, 0x6224,
-  0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1080, 0x28E1, 0x3122, 0x3942, 0x49A3, 0x59E4, 0x5A04, 0x5A04, 0x5A04, 0x51C4, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51E4, 0x6204, 0x5A04, 0x51C4,
-  0x0820, 0x18A1, 0x18A1, 0x0820, 0x0000, 0x0000, 0x0820, 0x0840, 0x0020, 0x0840, 0x0840, 0x1060, 0x20C1, 0x4163, 0x51C3, 0x51C4, 0x51C4, 0x51A3, 0x49A3, 0x49A3, 0x49A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51A3, 0x51C4, 0x51E4, 0x4183, 0x20C1,
-  0x0000, 0x1060, 0x1881, 0x0820, 0x0000, 0x0020, 0x1881, 0x1881, 0x0820, 0x0020, 0x0000, 0x0020, 0x1060, 0x3102, 0x4163, 0x49A3, 0x49A3, 0x49A3, 0x4163, 0x3943, 0x4163, 0x49A3, 0x51A3, 0x51C3, 0x51C3, 0x51A3, 0x51A3, 0x49A3, 0x4183, 0x3943, 0x18A1, 0x0820,
-  0x0020, 0x18A1, 0x3122, 0x1881, 0x0020, 0x0000, 0x0820, 0x0840, 0x1060, 0x0840, 0x0020, 0x0840, 0x1060, 0x20A1, 0x28E2, 0x3922, 0x3942, 0x3122, 0x18A1, 0x1881, 0x20C1, 0x4163, 0x49A3, 0x59E4, 0x59E4, 0x51C3, 0x49A3, 0x4163, 0x20A1, 0x1060, 0x0020, 0x0000,
-  0x1040, 0x3102, 0x49A3, 0x3102, 0x0840, 0x0000, 0x0000, 0x0840, 0x20C1, 0x20C1, 0x1060, 0x18A1, 0x28E1, 0x2902, 0x28E2, 0x1881, 0x1060, 0x0840, 0x0820, 0x0820, 0x18A1, 0x3122, 0x4163, 0x49A3, 0x51C3, 0x49A3, 0x4163, 0x3102, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x20A1, 0x3963, 0x20A1, 0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0820, 0x0840, 0x1060, 0x1060, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x20A1, 0x4163, 0x49A3, 0x4163, 0x20A1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DIRT_TILE_2_SPAN_ROWS[] PROGMEM = {
+  0, 0, 28, 25, 57, 51, 87, 78, 117, 105, 149, 134, 181, 163, 214, 193,
+  246, 222, 279, 252, 313, 284, 347, 316, 381, 348, 415, 380, 449, 412, 483, 444,
+  517, 476, 551, 508, 585, 540, 619, 572, 653, 604, 687, 635, 720, 665, 752, 694,
+  784, 723, 815, 751, 850, 781, 885, 812, 919, 844, 953, 876, 987, 908, 1019, 938
 };
 
-const uint8_t SPRITE_DIRT_TILE_2_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x13, 0x14, 0x18, 0x19, 0x1A, 0x1E, 0x37, 0x6E, 0x81, 0x6E, 0x32, 0x0C, 0x02, 0x03, 0x0B, 0x1B, 0x1F, 0x1B, 0x0C, 0x0C, 0x1B, 0x13, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x1F, 0x3A, 0x3E, 0x48, 0x4C, 0x4E, 0x53, 0x61, 0x7B, 0x84, 0x7D, 0x5D, 0x2A, 0x10, 0x19, 0x2E, 0x55, 0x60, 0x55, 0x2E, 0x1B, 0x0F, 0x06, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x14, 0x23, 0x42, 0x4C, 0x56, 0x5D, 0x5F, 0x62, 0x64, 0x63, 0x79, 0x84, 0x84, 0x7A, 0x59, 0x31, 0x51, 0x68, 0x79, 0x7D, 0x79, 0x68, 0x4F, 0x1A, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x1E, 0x41, 0x4F, 0x5A, 0x5C, 0x5F, 0x62, 0x62, 0x62, 0x63, 0x66, 0x77, 0x83, 0x86, 0x82, 0x6D, 0x49, 0x6B, 0x7D, 0x81, 0x82, 0x81, 0x7D, 0x68, 0x2D, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x14, 0x41, 0x5A, 0x60, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x6F, 0x7E, 0x83, 0x7E, 0x70, 0x6C, 0x7C, 0x82, 0x82, 0x81, 0x80, 0x80, 0x79, 0x54, 0x18, 0x03,
-  0x00, 0x00, 0x00, 0x07, 0x23, 0x51, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x60, 0x62, 0x63, 0x6B, 0x79, 0x77, 0x68, 0x55, 0x70, 0x80, 0x82, 0x80, 0x7B, 0x77, 0x7E, 0x7D, 0x61, 0x1C, 0x03,
-  0x00, 0x00, 0x03, 0x14, 0x43, 0x5E, 0x63, 0x62, 0x62, 0x5E, 0x60, 0x60, 0x5A, 0x58, 0x5E, 0x63, 0x68, 0x6E, 0x5E, 0x51, 0x5B, 0x72, 0x7F, 0x81, 0x7C, 0x6E, 0x65, 0x78, 0x78, 0x54, 0x18, 0x03,
-  0x00, 0x00, 0x07, 0x24, 0x52, 0x63, 0x63, 0x63, 0x60, 0x56, 0x5C, 0x5B, 0x4C, 0x47, 0x59, 0x61, 0x63, 0x63, 0x5D, 0x5A, 0x61, 0x6B, 0x7A, 0x80, 0x7F, 0x7B, 0x77, 0x7B, 0x69, 0x2E, 0x09, 0x00,
-  0x00, 0x03, 0x14, 0x44, 0x5F, 0x66, 0x63, 0x61, 0x62, 0x5E, 0x60, 0x60, 0x5A, 0x58, 0x5E, 0x62, 0x62, 0x60, 0x5D, 0x5A, 0x60, 0x67, 0x74, 0x7A, 0x7F, 0x80, 0x7D, 0x76, 0x5D, 0x1E, 0x04, 0x00,
-  0x01, 0x0A, 0x2A, 0x56, 0x64, 0x65, 0x5F, 0x5B, 0x60, 0x62, 0x62, 0x62, 0x61, 0x60, 0x62, 0x62, 0x60, 0x5E, 0x5A, 0x52, 0x5B, 0x62, 0x65, 0x69, 0x73, 0x76, 0x70, 0x60, 0x4A, 0x1D, 0x08, 0x03,
-  0x04, 0x1B, 0x57, 0x67, 0x67, 0x63, 0x55, 0x4E, 0x60, 0x63, 0x64, 0x63, 0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x5E, 0x5A, 0x5E, 0x60, 0x60, 0x5E, 0x5E, 0x5D, 0x5A, 0x53, 0x4A, 0x30, 0x20, 0x16,
-  0x05, 0x21, 0x68, 0x6E, 0x69, 0x66, 0x61, 0x63, 0x76, 0x71, 0x6E, 0x6B, 0x64, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x60, 0x60, 0x60, 0x5C, 0x59, 0x56, 0x54, 0x51, 0x4F, 0x48, 0x44, 0x3F,
-  0x05, 0x22, 0x6C, 0x74, 0x6B, 0x69, 0x6E, 0x7F, 0x8A, 0x8A, 0x87, 0x7E, 0x6A, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x60, 0x5C, 0x5A, 0x55, 0x53, 0x51, 0x51, 0x50, 0x4F, 0x4F,
-  0x05, 0x23, 0x71, 0x83, 0x6F, 0x6A, 0x71, 0x88, 0x90, 0x92, 0x8F, 0x86, 0x6C, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x5A, 0x5D, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51,
-  0x08, 0x27, 0x69, 0x84, 0x6F, 0x6A, 0x71, 0x88, 0x8F, 0x92, 0x91, 0x88, 0x70, 0x63, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x59, 0x50, 0x58, 0x5B, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51, 0x51, 0x50,
-  0x0C, 0x29, 0x4A, 0x73, 0x6B, 0x67, 0x6F, 0x80, 0x83, 0x8A, 0x8C, 0x88, 0x74, 0x62, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x59, 0x5B, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4B,
-  0x05, 0x11, 0x26, 0x58, 0x62, 0x64, 0x6A, 0x6E, 0x69, 0x76, 0x7B, 0x74, 0x59, 0x4F, 0x56, 0x5C, 0x5F, 0x5F, 0x60, 0x63, 0x66, 0x5F, 0x5C, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x50, 0x4C, 0x42,
-  0x05, 0x0F, 0x14, 0x2C, 0x54, 0x61, 0x6B, 0x71, 0x71, 0x71, 0x67, 0x55, 0x46, 0x43, 0x4A, 0x54, 0x58, 0x59, 0x5D, 0x68, 0x6F, 0x63, 0x5D, 0x5C, 0x59, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4B,
-  0x0D, 0x21, 0x1D, 0x25, 0x5A, 0x66, 0x70, 0x75, 0x71, 0x66, 0x51, 0x44, 0x40, 0x3F, 0x42, 0x45, 0x46, 0x48, 0x50, 0x66, 0x66, 0x5E, 0x59, 0x57, 0x55, 0x53, 0x54, 0x53, 0x52, 0x51, 0x51, 0x50,
-  0x04, 0x0D, 0x0D, 0x20, 0x5F, 0x6C, 0x72, 0x6D, 0x62, 0x4F, 0x44, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x44, 0x4F, 0x58, 0x58, 0x52, 0x50, 0x50, 0x54, 0x5B, 0x5B, 0x58, 0x52, 0x51, 0x51,
-  0x00, 0x02, 0x05, 0x1E, 0x62, 0x79, 0x74, 0x5E, 0x4C, 0x42, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x47, 0x53, 0x52, 0x4E, 0x4D, 0x4F, 0x58, 0x6C, 0x6F, 0x62, 0x52, 0x56, 0x53,
-  0x00, 0x00, 0x03, 0x19, 0x55, 0x79, 0x7E, 0x71, 0x60, 0x48, 0x41, 0x3F, 0x3F, 0x40, 0x42, 0x3F, 0x3F, 0x3F, 0x40, 0x45, 0x52, 0x50, 0x4D, 0x4D, 0x4F, 0x59, 0x70, 0x6B, 0x50, 0x47, 0x5F, 0x59,
-  0x00, 0x00, 0x00, 0x09, 0x2F, 0x6A, 0x80, 0x7E, 0x6E, 0x4D, 0x41, 0x3F, 0x40, 0x43, 0x48, 0x3E, 0x3D, 0x3F, 0x40, 0x46, 0x52, 0x51, 0x4D, 0x4D, 0x52, 0x5C, 0x6A, 0x5F, 0x52, 0x53, 0x65, 0x60,
-  0x00, 0x00, 0x00, 0x03, 0x1B, 0x55, 0x79, 0x80, 0x75, 0x57, 0x44, 0x3F, 0x3F, 0x40, 0x42, 0x3F, 0x3F, 0x3F, 0x45, 0x50, 0x5A, 0x57, 0x4C, 0x4C, 0x5A, 0x68, 0x66, 0x5D, 0x55, 0x56, 0x5E, 0x68,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x58, 0x6D, 0x6E, 0x69, 0x54, 0x44, 0x3F, 0x3D, 0x3C, 0x3E, 0x40, 0x44, 0x56, 0x6F, 0x77, 0x6B, 0x53, 0x4D, 0x66, 0x6F, 0x72, 0x6D, 0x5B, 0x54, 0x56, 0x5A,
-  0x00, 0x01, 0x01, 0x00, 0x02, 0x0A, 0x1F, 0x35, 0x44, 0x69, 0x6A, 0x51, 0x42, 0x3B, 0x36, 0x3E, 0x45, 0x56, 0x73, 0x82, 0x83, 0x7A, 0x70, 0x6C, 0x6F, 0x68, 0x75, 0x74, 0x61, 0x56, 0x53, 0x52,
-  0x04, 0x08, 0x06, 0x01, 0x00, 0x02, 0x07, 0x0F, 0x21, 0x50, 0x5E, 0x52, 0x41, 0x48, 0x4B, 0x50, 0x59, 0x73, 0x84, 0x87, 0x81, 0x7D, 0x7B, 0x7B, 0x79, 0x76, 0x7A, 0x7A, 0x6E, 0x59, 0x4E, 0x44,
-  0x09, 0x17, 0x12, 0x05, 0x01, 0x04, 0x0A, 0x09, 0x0A, 0x18, 0x1D, 0x1D, 0x2A, 0x5E, 0x72, 0x78, 0x7B, 0x84, 0x87, 0x84, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7B, 0x7D, 0x7B, 0x70, 0x55, 0x3A, 0x1F,
-  0x05, 0x10, 0x16, 0x0A, 0x02, 0x09, 0x1B, 0x14, 0x07, 0x04, 0x05, 0x08, 0x1C, 0x53, 0x6C, 0x7E, 0x82, 0x7F, 0x71, 0x6A, 0x6A, 0x76, 0x7A, 0x77, 0x73, 0x79, 0x7C, 0x76, 0x5E, 0x3D, 0x1A, 0x09,
-  0x09, 0x23, 0x3F, 0x22, 0x08, 0x04, 0x0B, 0x0A, 0x0B, 0x07, 0x06, 0x0E, 0x13, 0x24, 0x35, 0x5A, 0x66, 0x59, 0x32, 0x27, 0x39, 0x5F, 0x70, 0x6B, 0x63, 0x73, 0x77, 0x64, 0x2F, 0x14, 0x06, 0x02,
-  0x13, 0x3F, 0x5D, 0x3F, 0x11, 0x02, 0x03, 0x08, 0x17, 0x13, 0x10, 0x23, 0x20, 0x1D, 0x19, 0x1D, 0x1F, 0x19, 0x0B, 0x10, 0x2A, 0x3E, 0x5B, 0x6F, 0x72, 0x73, 0x64, 0x4C, 0x18, 0x05, 0x00, 0x00,
-  0x09, 0x2A, 0x4E, 0x29, 0x09, 0x00, 0x00, 0x03, 0x09, 0x08, 0x06, 0x0F, 0x0D, 0x0B, 0x07, 0x05, 0x04, 0x03, 0x02, 0x04, 0x0F, 0x15, 0x30, 0x66, 0x77, 0x67, 0x34, 0x1B, 0x07, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DIRT_TILE_2_SPAN_OPS[] PROGMEM = {
+  0x06, 0x98, 0x02, 0x08, 0x13, 0x14, 0x18, 0x19, 0x1A, 0x1E, 0x37, 0x6E, 0x81, 0x6E, 0x32, 0x0C, 0x02, 0x03, 0x0B, 0x1B, 0x1F, 0x1B, 0x0C, 0x0C,
+  0x1B, 0x13, 0x06, 0xC0, 0x05, 0x99, 0x02, 0x09, 0x1F, 0x3A, 0x3E, 0x48, 0x4C, 0x4E, 0x53, 0x61, 0x7B, 0x84, 0x7D, 0x5D, 0x2A, 0x10, 0x19, 0x2E,
+  0x55, 0x60, 0x55, 0x2E, 0x1B, 0x0F, 0x06, 0x02, 0xC0, 0x03, 0x9A, 0x01, 0x06, 0x14, 0x23, 0x42, 0x4C, 0x56, 0x5D, 0x5F, 0x62, 0x64, 0x63, 0x79,
+  0x84, 0x84, 0x7A, 0x59, 0x31, 0x51, 0x68, 0x79, 0x7D, 0x79, 0x68, 0x4F, 0x1A, 0x04, 0xC0, 0x03, 0x9A, 0x07, 0x1E, 0x41, 0x4F, 0x5A, 0x5C, 0x5F,
+  0x62, 0x62, 0x62, 0x63, 0x66, 0x77, 0x83, 0x86, 0x82, 0x6D, 0x49, 0x6B, 0x7D, 0x81, 0x82, 0x81, 0x7D, 0x68, 0x2D, 0x09, 0xC0, 0x02, 0x9C, 0x03,
+  0x14, 0x41, 0x5A, 0x60, 0x61, 0x61, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64, 0x6F, 0x7E, 0x83, 0x7E, 0x70, 0x6C, 0x7C, 0x82, 0x82, 0x81, 0x80, 0x80,
+  0x79, 0x54, 0x18, 0x03, 0xC0, 0x02, 0x9C, 0x07, 0x23, 0x51, 0x60, 0x62, 0x62, 0x62, 0x62, 0x62, 0x61, 0x60, 0x62, 0x63, 0x6B, 0x79, 0x77, 0x68,
+  0x55, 0x70, 0x80, 0x82, 0x80, 0x7B, 0x77, 0x7E, 0x7D, 0x61, 0x1C, 0x03, 0xC0, 0x01, 0x9D, 0x03, 0x14, 0x43, 0x5E, 0x63, 0x62, 0x62, 0x5E, 0x60,
+  0x60, 0x5A, 0x58, 0x5E, 0x63, 0x68, 0x6E, 0x5E, 0x51, 0x5B, 0x72, 0x7F, 0x81, 0x7C, 0x6E, 0x65, 0x78, 0x78, 0x54, 0x18, 0x03, 0xC0, 0x01, 0x9C,
+  0x07, 0x24, 0x52, 0x63, 0x63, 0x63, 0x60, 0x56, 0x5C, 0x5B, 0x4C, 0x47, 0x59, 0x61, 0x63, 0x63, 0x5D, 0x5A, 0x61, 0x6B, 0x7A, 0x80, 0x7F, 0x7B,
+  0x77, 0x7B, 0x69, 0x2E, 0x09, 0xC0, 0x00, 0x9D, 0x03, 0x14, 0x44, 0x5F, 0x66, 0x63, 0x61, 0x62, 0x5E, 0x60, 0x60, 0x5A, 0x58, 0x5E, 0x62, 0x62,
+  0x60, 0x5D, 0x5A, 0x60, 0x67, 0x74, 0x7A, 0x7F, 0x80, 0x7D, 0x76, 0x5D, 0x1E, 0x04, 0xC0, 0x9F, 0x01, 0x0A, 0x2A, 0x56, 0x64, 0x65, 0x5F, 0x5B,
+  0x60, 0x62, 0x62, 0x62, 0x61, 0x60, 0x62, 0x62, 0x60, 0x5E, 0x5A, 0x52, 0x5B, 0x62, 0x65, 0x69, 0x73, 0x76, 0x70, 0x60, 0x4A, 0x1D, 0x08, 0x03,
+  0xC0, 0x9F, 0x04, 0x1B, 0x57, 0x67, 0x67, 0x63, 0x55, 0x4E, 0x60, 0x63, 0x64, 0x63, 0x62, 0x62, 0x62, 0x60, 0x60, 0x60, 0x5E, 0x5A, 0x5E, 0x60,
+  0x60, 0x5E, 0x5E, 0x5D, 0x5A, 0x53, 0x4A, 0x30, 0x20, 0x16, 0xC0, 0x9F, 0x05, 0x21, 0x68, 0x6E, 0x69, 0x66, 0x61, 0x63, 0x76, 0x71, 0x6E, 0x6B,
+  0x64, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x60, 0x60, 0x60, 0x5C, 0x59, 0x56, 0x54, 0x51, 0x4F, 0x48, 0x44, 0x3F, 0xC0, 0x9F, 0x05, 0x22,
+  0x6C, 0x74, 0x6B, 0x69, 0x6E, 0x7F, 0x8A, 0x8A, 0x87, 0x7E, 0x6A, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5F, 0x60, 0x5C, 0x5A, 0x55,
+  0x53, 0x51, 0x51, 0x50, 0x4F, 0x4F, 0xC0, 0x9F, 0x05, 0x23, 0x71, 0x83, 0x6F, 0x6A, 0x71, 0x88, 0x90, 0x92, 0x8F, 0x86, 0x6C, 0x62, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x5E, 0x5A, 0x5D, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51, 0x51, 0x51, 0xC0, 0x9F, 0x08, 0x27, 0x69, 0x84, 0x6F, 0x6A,
+  0x71, 0x88, 0x8F, 0x92, 0x91, 0x88, 0x70, 0x63, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5E, 0x59, 0x50, 0x58, 0x5B, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51,
+  0x51, 0x50, 0xC0, 0x9F, 0x0C, 0x29, 0x4A, 0x73, 0x6B, 0x67, 0x6F, 0x80, 0x83, 0x8A, 0x8C, 0x88, 0x74, 0x62, 0x5F, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x5E, 0x59, 0x5B, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4B, 0xC0, 0x9F, 0x05, 0x11, 0x26, 0x58, 0x62, 0x64, 0x6A, 0x6E, 0x69, 0x76,
+  0x7B, 0x74, 0x59, 0x4F, 0x56, 0x5C, 0x5F, 0x5F, 0x60, 0x63, 0x66, 0x5F, 0x5C, 0x5C, 0x5A, 0x55, 0x53, 0x53, 0x51, 0x50, 0x4C, 0x42, 0xC0, 0x9F,
+  0x05, 0x0F, 0x14, 0x2C, 0x54, 0x61, 0x6B, 0x71, 0x71, 0x71, 0x67, 0x55, 0x46, 0x43, 0x4A, 0x54, 0x58, 0x59, 0x5D, 0x68, 0x6F, 0x63, 0x5D, 0x5C,
+  0x59, 0x55, 0x53, 0x53, 0x51, 0x51, 0x4F, 0x4B, 0xC0, 0x9F, 0x0D, 0x21, 0x1D, 0x25, 0x5A, 0x66, 0x70, 0x75, 0x71, 0x66, 0x51, 0x44, 0x40, 0x3F,
+  0x42, 0x45, 0x46, 0x48, 0x50, 0x66, 0x66, 0x5E, 0x59, 0x57, 0x55, 0x53, 0x54, 0x53, 0x52, 0x51, 0x51, 0x50, 0xC0, 0x9F, 0x04, 0x0D, 0x0D, 0x20,
+  0x5F, 0x6C, 0x72, 0x6D, 0x62, 0x4F, 0x44, 0x3F, 0x3F, 0x3F, 0x3F, 0x40, 0x40, 0x41, 0x44, 0x4F, 0x58, 0x58, 0x52, 0x50, 0x50, 0x54, 0x5B, 0x5B,
+  0x58, 0x52, 0x51, 0x51, 0xC0, 0x00, 0x9E, 0x02, 0x05, 0x1E, 0x62, 0x79, 0x74, 0x5E, 0x4C, 0x42, 0x40, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x40, 0x47, 0x53, 0x52, 0x4E, 0x4D, 0x4F, 0x58, 0x6C, 0x6F, 0x62, 0x52, 0x56, 0x53, 0xC0, 0x01, 0x9D, 0x03, 0x19, 0x55, 0x79, 0x7E, 0x71, 0x60,
+  0x48, 0x41, 0x3F, 0x3F, 0x40, 0x42, 0x3F, 0x3F, 0x3F, 0x40, 0x45, 0x52, 0x50, 0x4D, 0x4D, 0x4F, 0x59, 0x70, 0x6B, 0x50, 0x47, 0x5F, 0x59, 0xC0,
+  0x02, 0x9C, 0x09, 0x2F, 0x6A, 0x80, 0x7E, 0x6E, 0x4D, 0x41, 0x3F, 0x40, 0x43, 0x48, 0x3E, 0x3D, 0x3F, 0x40, 0x46, 0x52, 0x51, 0x4D, 0x4D, 0x52,
+  0x5C, 0x6A, 0x5F, 0x52, 0x53, 0x65, 0x60, 0xC0, 0x02, 0x9C, 0x03, 0x1B, 0x55, 0x79, 0x80, 0x75, 0x57, 0x44, 0x3F, 0x3F, 0x40, 0x42, 0x3F, 0x3F,
+  0x3F, 0x45, 0x50, 0x5A, 0x57, 0x4C, 0x4C, 0x5A, 0x68, 0x66, 0x5D, 0x55, 0x56, 0x5E, 0x68, 0xC0, 0x03, 0x9B, 0x09, 0x28, 0x58, 0x6D, 0x6E, 0x69,
+  0x54, 0x44, 0x3F, 0x3D, 0x3C, 0x3E, 0x40, 0x44, 0x56, 0x6F, 0x77, 0x6B, 0x53, 0x4D, 0x66, 0x6F, 0x72, 0x6D, 0x5B, 0x54, 0x56, 0x5A, 0xC0, 0x00,
+  0x81, 0x01, 0x01, 0x00, 0x9B, 0x02, 0x0A, 0x1F, 0x35, 0x44, 0x69, 0x6A, 0x51, 0x42, 0x3B, 0x36, 0x3E, 0x45, 0x56, 0x73, 0x82, 0x83, 0x7A, 0x70,
+  0x6C, 0x6F, 0x68, 0x75, 0x74, 0x61, 0x56, 0x53, 0x52, 0xC0, 0x83, 0x04, 0x08, 0x06, 0x01, 0x00, 0x9A, 0x02, 0x07, 0x0F, 0x21, 0x50, 0x5E, 0x52,
+  0x41, 0x48, 0x4B, 0x50, 0x59, 0x73, 0x84, 0x87, 0x81, 0x7D, 0x7B, 0x7B, 0x79, 0x76, 0x7A, 0x7A, 0x6E, 0x59, 0x4E, 0x44, 0xC0, 0x9F, 0x09, 0x17,
+  0x12, 0x05, 0x01, 0x04, 0x0A, 0x09, 0x0A, 0x18, 0x1D, 0x1D, 0x2A, 0x5E, 0x72, 0x78, 0x7B, 0x84, 0x87, 0x84, 0x7D, 0x7C, 0x7D, 0x7C, 0x7B, 0x7B,
+  0x7D, 0x7B, 0x70, 0x55, 0x3A, 0x1F, 0xC0, 0x9F, 0x05, 0x10, 0x16, 0x0A, 0x02, 0x09, 0x1B, 0x14, 0x07, 0x04, 0x05, 0x08, 0x1C, 0x53, 0x6C, 0x7E,
+  0x82, 0x7F, 0x71, 0x6A, 0x6A, 0x76, 0x7A, 0x77, 0x73, 0x79, 0x7C, 0x76, 0x5E, 0x3D, 0x1A, 0x09, 0xC0, 0x9F, 0x09, 0x23, 0x3F, 0x22, 0x08, 0x04,
+  0x0B, 0x0A, 0x0B, 0x07, 0x06, 0x0E, 0x13, 0x24, 0x35, 0x5A, 0x66, 0x59, 0x32, 0x27, 0x39, 0x5F, 0x70, 0x6B, 0x63, 0x73, 0x77, 0x64, 0x2F, 0x14,
+  0x06, 0x02, 0xC0, 0x9D, 0x13, 0x3F, 0x5D, 0x3F, 0x11, 0x02, 0x03, 0x08, 0x17, 0x13, 0x10, 0x23, 0x20, 0x1D, 0x19, 0x1D, 0x1F, 0x19, 0x0B, 0x10,
+  0x2A, 0x3E, 0x5B, 0x6F, 0x72, 0x73, 0x64, 0x4C, 0x18, 0x05, 0xC0, 0x84, 0x09, 0x2A, 0x4E, 0x29, 0x09, 0x01, 0x95, 0x03, 0x09, 0x08, 0x06, 0x0F,
+  0x0D, 0x0B, 0x07, 0x05, 0x04, 0x03, 0x02, 0x04, 0x0F, 0x15, 0x30, 0x66, 0x77, 0x67, 0x34, 0x1B, 0x07, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DIRT_TILE_2_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x20C1, 0x3102, 0x20C1, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x0840, 0x0840,
+  0x0840, 0x1060, 0x1881, 0x28E1, 0x3122, 0x2902, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x1881, 0x1060, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060, 0x1060, 0x1080, 0x1881, 0x1881, 0x28E1,
+  0x3122, 0x3122, 0x28E1, 0x1061, 0x0020, 0x1060, 0x1881, 0x20E1, 0x28E2, 0x20E1, 0x1881, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x0840, 0x1060, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1881, 0x20E1, 0x3102, 0x3122, 0x3102, 0x20C1, 0x0840,
+  0x18A1, 0x28E2, 0x2902, 0x2902, 0x2902, 0x28E2, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1080, 0x1080, 0x1080,
+  0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x18A1, 0x2902, 0x3102, 0x2902, 0x20C1, 0x18C1, 0x28E2, 0x2902, 0x2902, 0x2902,
+  0x2902, 0x2902, 0x20E1, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x1880, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1080, 0x1080, 0x1080, 0x1881, 0x28E1, 0x28E1, 0x20C1, 0x1061, 0x18C1, 0x28E2, 0x2902, 0x2902, 0x28E1, 0x28E1, 0x2902, 0x28E2,
+  0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A1, 0x1881, 0x1080, 0x1880, 0x1880, 0x1080, 0x1080, 0x1060, 0x1060, 0x1080,
+  0x1080, 0x1881, 0x20C1, 0x20A1, 0x1881, 0x1881, 0x20C1, 0x2902, 0x2902, 0x2902, 0x20E1, 0x20C1, 0x28E1, 0x20E1, 0x1060, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1060, 0x18A1, 0x1881, 0x1880, 0x1881, 0x1881, 0x1880, 0x1060, 0x1060, 0x0860, 0x1060, 0x1080, 0x1080,
+  0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1, 0x28E1, 0x2902, 0x2902, 0x28E1, 0x28E1, 0x28E1, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0840, 0x18A1, 0x20C1, 0x1881, 0x1880, 0x1881, 0x1880, 0x1080, 0x1080, 0x1060, 0x1060, 0x1080, 0x1080, 0x1080, 0x1080, 0x1880,
+  0x1080, 0x1881, 0x20C1, 0x28E1, 0x28E1, 0x2902, 0x2902, 0x2902, 0x20C1, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881,
+  0x20C1, 0x20C1, 0x18A1, 0x1081, 0x1880, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1081, 0x1060,
+  0x1080, 0x1881, 0x20C1, 0x20C1, 0x20E1, 0x28E1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x20A1,
+  0x20C1, 0x20C1, 0x18A1, 0x1880, 0x1881, 0x1880, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1060,
+  0x1080, 0x1880, 0x1881, 0x20C1, 0x20C1, 0x18A1, 0x1881, 0x1060, 0x0860, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x1081, 0x20C1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20E1, 0x18A1, 0x18A1, 0x1881, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1080, 0x1080, 0x1881, 0x20C1, 0x20A1, 0x18A1, 0x1881, 0x1060, 0x1060, 0x0860, 0x0840, 0x0840, 0x0000, 0x0000, 0x1881, 0x20E1,
+  0x20C1, 0x20C1, 0x20E1, 0x3102, 0x3122, 0x2902, 0x2902, 0x28E2, 0x1881, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1080, 0x1080, 0x1881, 0x20C1, 0x20A1, 0x18A1, 0x1880, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x1881, 0x28E1,
+  0x20C1, 0x20C1, 0x20E1, 0x3122, 0x3122, 0x3122, 0x3122, 0x2902, 0x18A1, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1080, 0x1060, 0x1881, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x1881, 0x28E1,
+  0x20C1, 0x20C1, 0x20E1, 0x3122, 0x3122, 0x3122, 0x3122, 0x2902, 0x18A1, 0x1880, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1081, 0x1080, 0x1881, 0x18A1, 0x20A1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x0840, 0x18A1,
+  0x20C1, 0x20C1, 0x20E1, 0x2902, 0x2902, 0x2902, 0x3122, 0x3102, 0x20E1, 0x1881, 0x1880, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+  0x1880, 0x1881, 0x18A1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x0860, 0x0000, 0x0000, 0x0000, 0x1060,
+  0x20A1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x20C1, 0x20C1, 0x28E1, 0x18A1, 0x1881, 0x1881, 0x1880, 0x1080, 0x1080, 0x1080, 0x1880,
+  0x18A1, 0x20A1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1880, 0x1060, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x1881, 0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x18A1, 0x20A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1081, 0x1081, 0x1881, 0x18A1,
+  0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x1080, 0x1060, 0x1060, 0x1060, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1060, 0x20A1, 0x18C1, 0x20C1, 0x18A1, 0x20A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x20C1,
+  0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x1080, 0x1060, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1060, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1,
+  0x20A1, 0x20A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1081, 0x1060, 0x1060, 0x1060, 0x0000, 0x0000, 0x0000, 0x1060,
+  0x18A0, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1,
+  0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x18A1, 0x20E1, 0x20E1, 0x18A1, 0x1080, 0x1081, 0x1060, 0x0000, 0x0000, 0x0840, 0x1880, 0x20A1,
+  0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x18A1,
+  0x18A1, 0x18A1, 0x18A1, 0x28E1, 0x20C2, 0x18A1, 0x1881, 0x18A1, 0x1081, 0x0000, 0x0000, 0x1060, 0x18A1, 0x20A1, 0x18A1, 0x18A1,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1081, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1881, 0x18A1, 0x18A1, 0x18A1, 0x20C1,
+  0x20C1, 0x20C1, 0x18A1, 0x18A1, 0x20C1, 0x18A1, 0x0000, 0x0000, 0x0840, 0x1080, 0x18A1, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x18A1, 0x1881, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x20C1, 0x20C1, 0x20A1,
+  0x20A1, 0x20C1, 0x20C1, 0x0000, 0x0000, 0x0840, 0x1880, 0x1880, 0x18A1, 0x18A1, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881, 0x1881,
+  0x1881, 0x18A1, 0x20C1, 0x20C1, 0x18A1, 0x1881, 0x1881, 0x20A1, 0x18A1, 0x20C1, 0x20C1, 0x20A1, 0x20A1, 0x20A1, 0x20A1, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0840, 0x1080, 0x18A1, 0x1881, 0x1081, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x20C1,
+  0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x18A1, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x18A1, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1060, 0x1060, 0x1060, 0x1881, 0x1881, 0x18A1, 0x18A1, 0x20C1, 0x28C1, 0x28C1,
+  0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20A1, 0x18A1, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x20C1, 0x20C1,
+  0x20C1, 0x28C1, 0x28C1, 0x28C1, 0x20C1, 0x20C1, 0x28C1, 0x20C1, 0x20C1, 0x18A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x20C1, 0x20C1, 0x20C1, 0x1881, 0x1081,
+  0x1881, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x20C1, 0x28C1, 0x20C1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1060, 0x1080, 0x1060, 0x0000, 0x0000,
+  0x0020, 0x1881, 0x18A1, 0x20C1, 0x20A1, 0x20C1, 0x20C1, 0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x1881, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0840, 0x1061, 0x18A1, 0x20C1, 0x18A1, 0x1881, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881,
+  0x20C1, 0x1881, 0x0020, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DIRT_TILE_2_SPANS = {
+  SPRITE_DIRT_TILE_2_SPAN_ROWS, SPRITE_DIRT_TILE_2_SPAN_OPS, SPRITE_DIRT_TILE_2_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DIRT_TILE_2_ASSET = {
   SPRITE_DIRT_TILE_2_WIDTH, SPRITE_DIRT_TILE_2_HEIGHT,
-  SPRITE_DIRT_TILE_2_ALPHA, SPRITE_DIRT_TILE_2_RGB565
+  nullptr, nullptr, &SPRITE_DIRT_TILE_2_SPANS
 };
 
 #endif // SPRITE_DIRT_TILE_2_INCLUDED
@@ -5,66 +5,72 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from donut_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from donut_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 378/484 pixels visibles, 1218 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DONUT_22_WIDTH = 22;
 constexpr uint16_t SPRITE_DONUT_22_HEIGHT = 22;
 
-const uint16_t SPRITE_DONUT_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x7BEF, 0xAAAA, 0x79E7, 0x79E7, 0x79E7, 0x52AA, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x79E7, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x79E7, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000, 0x8AC9, 0x8AA9, 0x8A67, 0x8A67, 0x8225, 0x69A3, 0x8205, 0x92A7, 0x0000, 0x0000, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7800, 0x0000, 0x732A, 0x8A67, 0x8A67, 0x8A25, 0x8A05, 0x9267, 0x9267, 0xA2C9, 0xBBCE, 0x92A8, 0x8A46, 0x8A67, 0x8A67, 0x8A26, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xF800, 0x0000, 0x8A46, 0x9225, 0x9266, 0x9246, 0x8B6D, 0x8BF0, 0x8A67, 0x8225, 0xBBCE, 0xFD98, 0x9AEA, 0x8A25, 0x9246, 0x9266, 0x8A67, 0x8A47, 0xFFFF, 0x0000, 0x0000,
-  0x7BE0, 0x52AA, 0x8A46, 0x92A8, 0x6C97, 0x736E, 0x89E4, 0x8C32, 0x8E9F, 0x8B0B, 0x8A25, 0x8A87, 0x9287, 0x8A25, 0x82CA, 0x64B8, 0x7B0C, 0x8A25, 0x9267, 0x8A26, 0x9AE7, 0x7800,
-  0x0000, 0x8247, 0x9A87, 0x8268, 0x6497, 0x7390, 0x8A25, 0x8A46, 0x8289, 0x8227, 0x8227, 0x8227, 0x7A27, 0x8206, 0x7B2C, 0x64F9, 0x7AAA, 0xA30A, 0xF557, 0xCC0F, 0x8205, 0x0000,
-  0x8A66, 0x8A47, 0x8226, 0x8226, 0x8A25, 0x8A26, 0x8A47, 0x8247, 0xA2A5, 0xBB44, 0xC384, 0xC384, 0xBB64, 0xA2E5, 0x8A46, 0x8A25, 0x8A25, 0x9AEA, 0xCC51, 0xAB4C, 0x8246, 0x9287,
-  0x8A47, 0x8A67, 0xA2EA, 0xE4F4, 0xD472, 0x8226, 0x8A67, 0xDC03, 0xFCE1, 0xFC81, 0xFCA1, 0xFCA1, 0xFC81, 0xFCC1, 0xE422, 0x9286, 0x8A47, 0x8A26, 0x8205, 0x8226, 0x9267, 0x8A46,
-  0x9286, 0x9287, 0xECF5, 0xED15, 0xA32B, 0x8226, 0x9AA6, 0xEC62, 0xFD40, 0xFE40, 0xFFE0, 0xFFE0, 0xFDE0, 0xFD40, 0xFC81, 0xA2E6, 0x8226, 0x82A9, 0x8AA9, 0x8A46, 0x9287, 0xA2E6,
-  0xB346, 0x9287, 0x92A8, 0x8A47, 0x8225, 0x8A67, 0x8A88, 0x8A46, 0x7A27, 0x8248, 0x8247, 0x8227, 0x7A27, 0x7A28, 0x8A67, 0x8A46, 0x8A67, 0x5D3B, 0x6BF3, 0x8A05, 0x9287, 0xC3C6,
-  0xDC46, 0x9AA7, 0x8226, 0x8A67, 0x8A46, 0x64B8, 0x6456, 0x9225, 0x9287, 0x8A46, 0x8A67, 0x8A67, 0x9267, 0x9246, 0x8A46, 0x8A25, 0x73B0, 0x559F, 0x82CA, 0x8206, 0x9AC7, 0xF506,
-  0xFD86, 0xBB67, 0x79E7, 0x8247, 0x8A46, 0x6476, 0x7B6E, 0x8A25, 0x9288, 0xBBCE, 0x8A87, 0x8A46, 0x8A67, 0x8B8E, 0x8ACA, 0x8A26, 0x82CA, 0x830C, 0x8A26, 0x8247, 0xDC86, 0xFD86,
-  0xFD66, 0xFD66, 0xAB26, 0xA2E6, 0x92A6, 0x8206, 0x8A46, 0x8246, 0x92A8, 0xFDB9, 0xBBCE, 0x8225, 0x8A87, 0x8E1D, 0x8D58, 0x8A25, 0x8A46, 0x8206, 0x9AE6, 0xECE6, 0xFDC6, 0xFD46,
-  0xFD46, 0xFD86, 0xFD66, 0xFD66, 0xF546, 0xAB46, 0x8227, 0x8A67, 0x8226, 0xCC30, 0xC3EF, 0x7A06, 0x8226, 0x82A9, 0x8AEA, 0x8A46, 0x8247, 0x8A67, 0xECE6, 0xFD86, 0xFD86, 0xFD46,
-  0xFFE0, 0xFD46, 0xFDC6, 0xFD46, 0xFD66, 0xFD66, 0xAB46, 0x8227, 0x8227, 0x8226, 0x8A66, 0x9AE6, 0xA2E7, 0x9AA6, 0x8A46, 0x8247, 0x9286, 0xE486, 0xFD66, 0xFD86, 0xFD66, 0xFD86,
-  0xF800, 0xFD26, 0xFD86, 0xFDA6, 0xFD46, 0xFD66, 0xFD66, 0xE486, 0xCC26, 0xDC86, 0xF506, 0xFD66, 0xFD66, 0xFD46, 0xED06, 0xE4A6, 0xFD26, 0xFD86, 0xFD86, 0xFD86, 0xFD45, 0x0000,
-  0xFBE0, 0x0000, 0xFD46, 0xFD86, 0xFDC6, 0xFD86, 0xFD46, 0xFD86, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFDC6, 0xFD86, 0xFD26, 0x0000, 0xFFE0,
-  0x0000, 0xFBE0, 0x0000, 0xE463, 0xFD66, 0xFD66, 0xFD86, 0xFDC6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDC6, 0xFD86, 0xFD66, 0xFD66, 0xECE5, 0x0000, 0xFD4A, 0x0000,
-  0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xFD45, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD86, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE7, 0xFFE0, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DONUT_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 12, 8, 23, 14, 40, 24, 60, 41, 83, 61, 103, 83,
+  124, 103, 144, 125, 162, 147, 187, 169, 214, 191, 226, 213, 248, 235, 258, 257,
+  270, 279, 284, 301, 301, 322, 327, 342, 344, 360, 365, 374
 };
 
-const uint8_t SPRITE_DONUT_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x35, 0x50, 0x5D, 0x60, 0x52, 0x39, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x00, 0x0F, 0x67, 0xBB, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC1, 0x70, 0x1A, 0x00, 0x00, 0x01, 0x00,
-  0x01, 0x01, 0x00, 0x67, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xEC, 0x79, 0x01, 0x00, 0x01,
-  0x02, 0x03, 0x9E, 0xFF, 0xFF, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFF, 0xFF, 0xB2, 0x08, 0x02,
-  0x00, 0x7E, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0x9B, 0x00,
-  0x1D, 0xF2, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0x33,
-  0x51, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xEA, 0xE7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x69,
-  0x63, 0xFE, 0xFC, 0xFF, 0xFF, 0xFD, 0xFE, 0xD4, 0x3C, 0x0E, 0x04, 0x02, 0x0C, 0x31, 0xC4, 0xFE, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0x7E,
-  0x7E, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFE, 0xE3, 0x7A, 0x4D, 0x3C, 0x3D, 0x48, 0x71, 0xDD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0x9E,
-  0x92, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAF,
-  0x95, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFC, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF,
-  0x8A, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xA9,
-  0x44, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x60,
-  0x01, 0xBB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD4, 0x0A,
-  0x01, 0x23, 0xE7, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xFF, 0xF5, 0x36, 0x00,
-  0x02, 0x00, 0x2A, 0xCC, 0xFF, 0xFF, 0xFE, 0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFD, 0xFF, 0xFF, 0xDB, 0x3D, 0x00, 0x02,
-  0x00, 0x02, 0x00, 0x09, 0x71, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x80, 0x10, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x06, 0x3C, 0x76, 0xA0, 0xBC, 0xC1, 0xC1, 0xBF, 0xA3, 0x7C, 0x43, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DONUT_22_SPAN_OPS[] PROGMEM = {
+  0xC0, 0x06, 0x87, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0xC0, 0x03, 0x82, 0x01, 0x04, 0x02, 0x07, 0x82, 0x01, 0x04, 0x01, 0xC0, 0x02,
+  0x80, 0x03, 0x02, 0x87, 0x14, 0x35, 0x50, 0x5D, 0x60, 0x52, 0x39, 0x15, 0x02, 0x80, 0x03, 0xC0, 0x00, 0x81, 0x01, 0x02, 0x00, 0x83, 0x0F, 0x67,
+  0xBB, 0xEE, 0x45, 0x83, 0xF0, 0xC1, 0x70, 0x1A, 0x01, 0x80, 0x01, 0xC0, 0x81, 0x01, 0x01, 0x00, 0x81, 0x67, 0xE0, 0x43, 0x84, 0xFC, 0xFB, 0xFB,
+  0xFC, 0xFE, 0x42, 0x82, 0xEC, 0x79, 0x01, 0x00, 0x80, 0x01, 0xC0, 0x82, 0x02, 0x03, 0x9E, 0x41, 0x82, 0xFC, 0xFC, 0xFE, 0x45, 0x82, 0xFE, 0xFC,
+  0xFB, 0x41, 0x82, 0xB2, 0x08, 0x02, 0xC0, 0x00, 0x80, 0x7E, 0x40, 0x81, 0xFA, 0xFD, 0x43, 0x83, 0xFE, 0xFE, 0xFD, 0xFE, 0x43, 0x81, 0xFE, 0xF9,
+  0x40, 0x80, 0x9B, 0xC0, 0x83, 0x1D, 0xF2, 0xFD, 0xFE, 0x42, 0x81, 0xFE, 0xFD, 0x43, 0x81, 0xFE, 0xFD, 0x42, 0x83, 0xFE, 0xFC, 0xFE, 0x33, 0xC0,
+  0x80, 0x51, 0x40, 0x80, 0xFE, 0x45, 0x83, 0xFB, 0xEA, 0xE7, 0xF7, 0x45, 0x80, 0xFC, 0x40, 0x80, 0x69, 0xC0, 0x82, 0x63, 0xFE, 0xFC, 0x41, 0x8B,
+  0xFD, 0xFE, 0xD4, 0x3C, 0x0E, 0x04, 0x02, 0x0C, 0x31, 0xC4, 0xFE, 0xFD, 0x41, 0x80, 0xFC, 0x40, 0x80, 0x7E, 0xC0, 0x80, 0x7E, 0x40, 0x80, 0xFC,
+  0x41, 0x89, 0xFE, 0xFE, 0xE3, 0x7A, 0x4D, 0x3C, 0x3D, 0x48, 0x71, 0xDD, 0x40, 0x80, 0xFE, 0x41, 0x80, 0xFC, 0x40, 0x80, 0x9E, 0xC0, 0x80, 0x92,
+  0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0xAF, 0xC0, 0x80, 0x95, 0x40, 0x80, 0xFC, 0x43, 0x87, 0xFE, 0xFB, 0xFC, 0xFE, 0xFE, 0xFD, 0xFB,
+  0xFE, 0x43, 0x80, 0xFD, 0x40, 0x80, 0xBF, 0xC0, 0x82, 0x8A, 0xFE, 0xFC, 0x4F, 0x82, 0xFC, 0xFE, 0xA9, 0xC0, 0x80, 0x44, 0x40, 0x80, 0xFD, 0x4F,
+  0x80, 0xFC, 0x40, 0x80, 0x60, 0xC0, 0x81, 0x01, 0xBB, 0x40, 0x80, 0xFA, 0x4D, 0x80, 0xFB, 0x40, 0x81, 0xD4, 0x0A, 0xC0, 0x82, 0x01, 0x23, 0xE7,
+  0x40, 0x81, 0xFA, 0xFD, 0x49, 0x81, 0xFD, 0xFA, 0x40, 0x81, 0xF5, 0x36, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x2A, 0xCC, 0x41, 0x89, 0xFE, 0xFB, 0xFB,
+  0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFD, 0x41, 0x81, 0xDB, 0x3D, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x82, 0x09, 0x71, 0xD7, 0x49,
+  0x82, 0xDE, 0x80, 0x10, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x01, 0x8B, 0x06, 0x3C, 0x76, 0xA0, 0xBC, 0xC1, 0xC1, 0xBF, 0xA3, 0x7C, 0x43,
+  0x0A, 0x01, 0x80, 0x02, 0xC0, 0x02, 0x81, 0x01, 0x04, 0x0B, 0x81, 0x04, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DONUT_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x1881, 0x28A2, 0x30E2, 0x30C1, 0x2080, 0x1861, 0x0820, 0x0000, 0x0000, 0x0000, 0x0020, 0x30E2, 0x61A5, 0x79E4, 0x8A05, 0x9267,
+  0x9267, 0xA2C9, 0xBBCE, 0x92A8, 0x7A05, 0x61C5, 0x3903, 0x0820, 0x0000, 0x0000, 0x0000, 0x30E2, 0x79C4, 0x9266, 0x9246, 0x8B6D,
+  0x8BF0, 0x8A67, 0x7A04, 0xB3AD, 0xFD98, 0x9AEA, 0x8A25, 0x9246, 0x9266, 0x7A26, 0x3903, 0x0000, 0x0000, 0x0000, 0x0000, 0x5163,
+  0x92A8, 0x6C97, 0x736E, 0x89E4, 0x8C32, 0x8E9F, 0x8B0B, 0x8A25, 0x8A87, 0x9287, 0x8A25, 0x82CA, 0x64B8, 0x72EB, 0x8A25, 0x9267,
+  0x5964, 0x0000, 0x0000, 0x4123, 0x9A87, 0x7A47, 0x6497, 0x7390, 0x8A25, 0x8A46, 0x8289, 0x8227, 0x8227, 0x8227, 0x7A27, 0x8206,
+  0x7B2C, 0x64F9, 0x7AAA, 0xA30A, 0xED16, 0xCC0F, 0x4922, 0x1040, 0x7A06, 0x8226, 0x8226, 0x8A25, 0x8A26, 0x8A47, 0x8247, 0xA2A5,
+  0xBB44, 0xC384, 0xC384, 0xBB64, 0xA2E5, 0x8A46, 0x8A25, 0x8A25, 0x9AEA, 0xCC51, 0xAB4C, 0x8246, 0x1861, 0x28A2, 0x8A67, 0xA2EA,
+  0xE4F4, 0xD472, 0x8226, 0x8A67, 0xDC03, 0xFCE1, 0xF440, 0xE420, 0xE420, 0xF440, 0xFCC1, 0xE422, 0x9286, 0x8A47, 0x8A26, 0x8205,
+  0x8226, 0x9267, 0x30E2, 0x30E2, 0x9287, 0xECF5, 0xED15, 0xA32B, 0x8226, 0x9AA6, 0xC3A1, 0x3940, 0x0860, 0x0020, 0x0000, 0x0840,
+  0x28E0, 0xC380, 0xA2E6, 0x8226, 0x82A9, 0x8AA9, 0x8A46, 0x9287, 0x5163, 0x59A3, 0x9287, 0x92A8, 0x8A47, 0x8225, 0x8A67, 0x8A88,
+  0x71E5, 0x38E3, 0x28A2, 0x2081, 0x2081, 0x2081, 0x30E3, 0x7206, 0x8A46, 0x8A67, 0x5D3B, 0x6BF3, 0x8A05, 0x9287, 0x7A43, 0x7A63,
+  0x9AA7, 0x8226, 0x8A67, 0x8A46, 0x64B8, 0x6456, 0x9225, 0x9287, 0x8A46, 0x8A67, 0x8A67, 0x9267, 0x9246, 0x8A46, 0x8A25, 0x73B0,
+  0x559F, 0x82CA, 0x8206, 0x9AC7, 0xA364, 0x9343, 0xBB67, 0x79E7, 0x8247, 0x8A46, 0x6476, 0x7B6E, 0x8A25, 0x8A67, 0xBBCE, 0x8A87,
+  0x8A46, 0x8A67, 0x836D, 0x8ACA, 0x8A26, 0x82CA, 0x830C, 0x8A26, 0x8247, 0xDC86, 0xBC24, 0x82C3, 0xFD66, 0xAB26, 0xA2E6, 0x92A6,
+  0x8206, 0x8A46, 0x8246, 0x92A8, 0xFDB9, 0xBBCE, 0x8225, 0x8A87, 0x8E1D, 0x8D58, 0x8A25, 0x8A46, 0x8206, 0x9AE6, 0xECE6, 0xFDC6,
+  0xA363, 0x4161, 0xFD86, 0xFD66, 0xFD66, 0xF546, 0xAB46, 0x8227, 0x8A67, 0x8226, 0xCC30, 0xC3EF, 0x7A06, 0x8226, 0x82A9, 0x8AEA,
+  0x8A46, 0x8247, 0x8A67, 0xECE6, 0xFD86, 0xFD86, 0x59E2, 0x0000, 0xB3C4, 0xFDC6, 0xF505, 0xFD66, 0xFD66, 0xAB46, 0x8227, 0x8227,
+  0x8226, 0x8A66, 0x9AE6, 0xA2E7, 0x9AA6, 0x8A46, 0x8247, 0x9286, 0xE486, 0xF525, 0xFD86, 0xD485, 0x0020, 0x0000, 0x18A0, 0xE4E5,
+  0xFDA6, 0xF505, 0xFD66, 0xFD66, 0xE486, 0xCC26, 0xDC86, 0xF506, 0xFD66, 0xFD66, 0xFD46, 0xED06, 0xE4A6, 0xFD26, 0xF545, 0xFD86,
+  0xF545, 0x3121, 0x0000, 0x20C0, 0xCC64, 0xFDC6, 0xFD86, 0xFD46, 0xF545, 0xF545, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xF525,
+  0xFD86, 0xFD86, 0xFDC6, 0xD4A5, 0x3941, 0x0000, 0x0000, 0x0020, 0x6A42, 0xD485, 0xFD86, 0xFDC6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6,
+  0xFDA6, 0xFDA6, 0xFDC6, 0xFD86, 0xDCA5, 0x7AA3, 0x0840, 0x0000, 0x0000, 0x0020, 0x3941, 0x7262, 0x9B43, 0xBC04, 0xBBE4, 0xBBE4,
+  0xBC04, 0x9B43, 0x7AA3, 0x3941, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DONUT_22_SPANS = {
+  SPRITE_DONUT_22_SPAN_ROWS, SPRITE_DONUT_22_SPAN_OPS, SPRITE_DONUT_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DONUT_22_ASSET = {
   SPRITE_DONUT_22_WIDTH, SPRITE_DONUT_22_HEIGHT,
-  SPRITE_DONUT_22_ALPHA, SPRITE_DONUT_22_RGB565
+  nullptr, nullptr, &SPRITE_DONUT_22_SPANS
 };
 
 #endif // SPRITE_DONUT_22_INCLUDED
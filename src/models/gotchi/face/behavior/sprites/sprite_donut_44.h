@@ -5,110 +5,191 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from donut_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from donut_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1572/1936 pixels visibles, 4672 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DONUT_44_WIDTH = 44;
 constexpr uint16_t SPRITE_DONUT_44_HEIGHT = 44;
 
-const uint16_t SPRITE_DONUT_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x7800, 0x7800, 0x7800, 0x7800, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x7800, 0xAAAA, 0xAAAA, 0x9986, 0x9B26, 0x7AA5, 0x7AA5, 0x7AA5, 0x7AA5, 0x7945, 0x7945, 0x79E7, 0x79E7, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x7BEF, 0x7BE0, 0x7BE0, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0xF800, 0x7800, 0xF800, 0x7800, 0x7BEF, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5000, 0x7AA5, 0x9249, 0x79E3, 0x9364, 0x7945, 0x79E0, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x79E7, 0x9986, 0xAAA5, 0x9244, 0x79E7, 0x7AAA, 0xA800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x7BE0, 0xF800, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x7BE7, 0x6A44, 0x71C7, 0x7A66, 0x6186, 0x38E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x7BEF, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x9B26, 0x9249, 0xA945, 0x79E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x9516, 0x8B6D, 0x7A87, 0x8A46, 0x8246, 0x8A47, 0x7A26, 0x69A3, 0x50E0, 0x48C0, 0x6140, 0x81E5, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0xAAA5, 0x9249, 0x9B26, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x6333, 0x7AA8, 0x8A68, 0x8A46, 0x8A25, 0x8A05, 0x8A05, 0x8A25, 0x8A46, 0x8A67, 0x8A67, 0x8A67, 0x8A46, 0x8A46, 0x8246, 0x8A46, 0x8A46, 0x8A66, 0x8A67, 0x8A87, 0x8288, 0x7AA8, 0x7AC9, 0x79E7, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7945, 0x9986, 0xF800, 0x0000, 0x0000, 0x07FF, 0x82EA, 0x8A88, 0x8A67, 0x8A46, 0x8A05, 0x89E4, 0x89E4, 0x8A05, 0x9266, 0x9287, 0x9267, 0x9267, 0x9267, 0x9AC9, 0xAB2B, 0xAB2B, 0x9AC9, 0x8A67, 0x8A46, 0x8267, 0x8268, 0x8288, 0x8288, 0x8267, 0x79E5, 0x0000, 0x0000, 0x0000, 0x79E7, 0x6186, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x5000, 0x0000, 0x0000, 0x0000, 0x5145, 0x9180, 0x91A0, 0x99E3, 0x9225, 0x9266, 0x8A67, 0x8A47, 0x8A67, 0x9267, 0x9266, 0x9267, 0x9A87, 0x9287, 0x9267, 0x9A87, 0xA2E9, 0xC3AE, 0xDC92, 0xDC71, 0xB36C, 0x9AA8, 0x8A66, 0x8A46, 0x8A25, 0x9246, 0x9246, 0x9266, 0x8A67, 0x8A47, 0x8A48, 0x9AE7, 0x0000, 0x0000, 0x0000, 0x5000, 0x0000, 0x0000,
-  0x0000, 0x7800, 0x7AA5, 0x7BE0, 0x0000, 0x0000, 0x7A47, 0x89E3, 0x91C2, 0x91E3, 0x9A25, 0x9246, 0x9246, 0x8A87, 0x92EA, 0x932C, 0x934C, 0x930B, 0x92A8, 0x8A25, 0x8225, 0x8A67, 0xAB2B, 0xDC72, 0xFD97, 0xF536, 0xBBCE, 0x9288, 0x8A26, 0x9225, 0x9204, 0x9A24, 0x9A45, 0x9266, 0x8A67, 0x8A67, 0x9288, 0x9AA9, 0x0000, 0x0000, 0xF800, 0x6A44, 0x0000, 0x0000,
-  0x52A0, 0xF800, 0x0000, 0x0000, 0x79E5, 0x8A46, 0x9267, 0x8A87, 0x8A88, 0x8AA9, 0x92C9, 0x9267, 0x9225, 0x8A67, 0x8B4C, 0x8C73, 0x8D17, 0x8C94, 0x8B2C, 0x8225, 0x81E4, 0x8A46, 0xA32A, 0xCC51, 0xED35, 0xDCB3, 0xAB6C, 0x8A67, 0x8226, 0x8A67, 0x8AA8, 0x8AC9, 0x92A8, 0x9AA8, 0x9267, 0x8A46, 0x8A25, 0x8205, 0x71A3, 0x5901, 0x0000, 0x0000, 0x0000, 0x5000,
-  0x9364, 0x0000, 0x0000, 0x6945, 0x8226, 0x8A25, 0x9266, 0x8B0B, 0x7BD1, 0x7413, 0x7B8F, 0x82A9, 0x8A04, 0x8A26, 0x8B6D, 0x8558, 0x8E9F, 0x8E1C, 0x8C10, 0x8A66, 0x8A04, 0x8A46, 0x9AA8, 0xA32A, 0xAB4C, 0xAB2A, 0x92A7, 0x8A46, 0x8A47, 0x7B0C, 0x6BF2, 0x6C13, 0x7B6E, 0x8AA9, 0x8A46, 0x8A25, 0x8A05, 0x8205, 0x79E4, 0x71A3, 0x7A25, 0x0000, 0x0000, 0x78E3,
-  0x9364, 0x0000, 0x7A66, 0x8246, 0x8A67, 0x9246, 0x9A66, 0x8B6D, 0x6CB7, 0x5D1B, 0x6455, 0x7AEB, 0x8205, 0x8A04, 0x8B0B, 0x84B5, 0x85FC, 0x859A, 0x83CF, 0x8247, 0x8206, 0x8226, 0x8226, 0x8226, 0x7A06, 0x79E5, 0x8205, 0x8A25, 0x8288, 0x73B0, 0x5CFA, 0x5D1B, 0x6BD2, 0x8289, 0x8A26, 0x9A67, 0xA2E9, 0xAB2B, 0x9AE9, 0x9288, 0x8A67, 0x5961, 0x0000, 0x7800,
-  0x79E7, 0x72A7, 0x7A47, 0x8A67, 0x92A7, 0x9A86, 0x9A66, 0x832D, 0x64B8, 0x5D1B, 0x6455, 0x7B2D, 0x8A46, 0x8A04, 0x8A66, 0x8B2B, 0x8BAF, 0x836E, 0x82AA, 0x7A27, 0x7A07, 0x7A07, 0x7A07, 0x79E7, 0x71E7, 0x79E6, 0x81E5, 0x8A26, 0x82C9, 0x73F2, 0x5D3B, 0x5CFA, 0x6B90, 0x8268, 0x9267, 0xB34C, 0xD451, 0xE4D4, 0xD450, 0xB34C, 0x9287, 0x69A3, 0x3880, 0x0000,
-  0x0000, 0x8247, 0x8246, 0x9267, 0x9287, 0x9A66, 0x8A05, 0x7289, 0x6B90, 0x6BF3, 0x7390, 0x82EB, 0x8A67, 0x8A25, 0x81E5, 0x81E6, 0x81E6, 0x8206, 0x8226, 0x8A46, 0x8A67, 0x8A67, 0x8A47, 0x8A67, 0x8A67, 0x8A47, 0x8A26, 0x8226, 0x7A69, 0x734F, 0x6C34, 0x6BF3, 0x7B0C, 0x8247, 0x9AA8, 0xBBCF, 0xED36, 0xFD98, 0xE4D4, 0xBB8D, 0x9287, 0x71C4, 0x6962, 0x0000,
-  0x0000, 0x8A66, 0x8247, 0x9267, 0x9267, 0x8A26, 0x8205, 0x7A05, 0x7A27, 0x8268, 0x8288, 0x8A67, 0x8A67, 0x8227, 0x7A06, 0x79E6, 0x8A05, 0x9245, 0xA2A5, 0xAB05, 0xB325, 0xB305, 0xB325, 0xB305, 0xAB05, 0xA2E5, 0x92A6, 0x8A46, 0x7A27, 0x7A49, 0x82AA, 0x8289, 0x8246, 0x8A46, 0x92A8, 0xB3AE, 0xDCB4, 0xE4F5, 0xD451, 0xB34C, 0x9287, 0x7A05, 0x7A05, 0xD44E,
-  0x8A67, 0x8A66, 0x8A67, 0x9287, 0x8A46, 0x8246, 0x92A8, 0xA2C9, 0xA287, 0xA246, 0x9225, 0x8A05, 0x8246, 0x8A67, 0x9287, 0xA2E6, 0xBB45, 0xCBA4, 0xDBE3, 0xDC03, 0xE403, 0xE403, 0xE423, 0xE423, 0xE403, 0xDC04, 0xCBC4, 0xBB65, 0xA2C5, 0x9A44, 0x91E4, 0x89E4, 0x8A05, 0x8A46, 0x9288, 0xA30A, 0xB38D, 0xB38D, 0xAB2B, 0x9AC9, 0x9AA8, 0x8246, 0x8A46, 0x9AAA,
-  0x8A67, 0x8A66, 0x8A67, 0x9A87, 0x8A67, 0x9AEA, 0xBBCF, 0xD472, 0xD451, 0xBB6C, 0x9287, 0x79E5, 0x8226, 0x92A7, 0xB345, 0xDC03, 0xFCA2, 0xFCE2, 0xFCE2, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCC2, 0xFCE2, 0xFCA2, 0xE423, 0xC343, 0x9A84, 0x8A05, 0x8226, 0x8A67, 0x8A67, 0x8A67, 0x8A67, 0x8A47, 0x8A47, 0x8A67, 0x9AA7, 0x8A67, 0x8A46, 0x8227,
-  0x8A88, 0x8A46, 0x8A46, 0x9AC8, 0xAB4B, 0xCC31, 0xED16, 0xF577, 0xE515, 0xBBEF, 0x92A9, 0x7A06, 0x8226, 0xAAE6, 0xDBE3, 0xFCC1, 0xFD21, 0xFD20, 0xFCE0, 0xFCA0, 0xFCC0, 0xFCC0, 0xFCE0, 0xFCC0, 0xFCA0, 0xFCC0, 0xFD00, 0xFD20, 0xFCE1, 0xE423, 0xAB26, 0x8A88, 0x8248, 0x8A47, 0x8A25, 0x8204, 0x81E3, 0x79C4, 0x79E5, 0x8A46, 0x9A87, 0x9287, 0x8A67, 0x8226,
-  0x9AA7, 0x8A25, 0x8245, 0xAB2A, 0xD451, 0xF557, 0xFDB8, 0xED36, 0xCC51, 0xA32B, 0x8A67, 0x7A26, 0x8A47, 0xB326, 0xE422, 0xFCE0, 0xFD80, 0xFDC0, 0xFD80, 0xFD20, 0xFD40, 0xFD00, 0xFD20, 0xFD40, 0xFD00, 0xFD40, 0xFDA0, 0xFDA0, 0xFD40, 0xF462, 0xBB65, 0x9287, 0x8247, 0x8226, 0x8A26, 0x8A46, 0x8246, 0x8226, 0x8226, 0x8A46, 0x9A87, 0x9287, 0x9AA7, 0x9AC6,
-  0xA2E7, 0x8A65, 0x8A45, 0xAB2A, 0xD451, 0xECF5, 0xDCD4, 0xC410, 0xA32B, 0x8A67, 0x8205, 0x8A05, 0x9246, 0xAAE5, 0xCBA3, 0xDC02, 0xD422, 0x6305, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02B1, 0xD443, 0xE442, 0xD3C3, 0xAB26, 0x9286, 0x8A05, 0x8247, 0x7AEB, 0x7B6E, 0x834D, 0x82EB, 0x8A67, 0x9246, 0x9A87, 0x92A7, 0xA2E7, 0xAB26,
-  0xB366, 0xA2C6, 0x9286, 0xA2E8, 0xAB2B, 0xAB4C, 0xA30B, 0x92A8, 0x8A67, 0x8225, 0x8A05, 0x8A25, 0x8A46, 0x9286, 0x9AA6, 0x9AA6, 0x8246, 0x61C9, 0x59CE, 0x59CE, 0x08EF, 0x000D, 0x000D, 0x000B, 0x28AB, 0x290A, 0x51EB, 0x8288, 0x9AC6, 0x9AC6, 0x92A7, 0x9245, 0x8A04, 0x82A9, 0x6C13, 0x64D8, 0x6C55, 0x7B4E, 0x8A67, 0x9205, 0x9A66, 0x9AC8, 0xAB47, 0xC3A6,
-  0xC3C6, 0xAB46, 0x9AA7, 0x9287, 0x8A67, 0x8226, 0x8225, 0x8205, 0x8204, 0x8246, 0x82CA, 0x7B0C, 0x7B0C, 0x7AAA, 0x8228, 0x8206, 0x8227, 0x8247, 0x8226, 0x8A26, 0x8A66, 0x9287, 0x9286, 0x9267, 0x8A67, 0x8A66, 0x8A26, 0x8207, 0x8227, 0x8227, 0x8247, 0x8A25, 0x8A46, 0x736F, 0x5D3C, 0x55BF, 0x64B8, 0x7B2D, 0x8A46, 0x8A04, 0x9246, 0x9AE8, 0xBBA7, 0xDC65,
-  0xDC65, 0xBBA6, 0xA2E7, 0x9287, 0x8A46, 0x8226, 0x8246, 0x8A25, 0x8A04, 0x8288, 0x73D1, 0x6497, 0x6476, 0x7390, 0x8268, 0x89E5, 0x9246, 0x8A67, 0x8A46, 0x8A25, 0x8A46, 0x9267, 0x9267, 0x8A67, 0x9267, 0x9266, 0x9246, 0x8A26, 0x8A47, 0x8A26, 0x8A05, 0x8A26, 0x82CA, 0x6C55, 0x4DBF, 0x559F, 0x7413, 0x82A8, 0x8A25, 0x8A26, 0x9267, 0xA307, 0xD446, 0xFD26,
-  0xF525, 0xD426, 0xAB07, 0x9A87, 0x8227, 0x8227, 0x8268, 0x9246, 0x9204, 0x82EA, 0x6476, 0x555D, 0x5CFA, 0x73D1, 0x8A88, 0x9A04, 0x9A66, 0x9AC8, 0x9AA8, 0x9A87, 0x9287, 0x9287, 0x9287, 0x9AA7, 0x9A87, 0x9A87, 0x9A87, 0x9A87, 0x9266, 0x8A25, 0x8A04, 0x8A46, 0x7B0C, 0x6C35, 0x5D1B, 0x64B8, 0x7B2C, 0x8A05, 0x81C5, 0x8227, 0x9AC7, 0xBBA7, 0xE4C6, 0xFDA6,
-  0xFDC5, 0xE4C6, 0xBB87, 0xA2C7, 0x8227, 0x79E7, 0x8247, 0x8A25, 0x9204, 0x82EB, 0x6C76, 0x5D1B, 0x6476, 0x7B4D, 0x8A67, 0x9204, 0x9246, 0x9AEA, 0xAB4B, 0xAB2B, 0x9AA8, 0x8A46, 0x8A66, 0x9267, 0x9267, 0x9288, 0x92EA, 0x8AEA, 0x8AA8, 0x8A46, 0x8A25, 0x8A46, 0x82AA, 0x7B4E, 0x73D1, 0x7B6E, 0x8AA8, 0x81C5, 0x71A6, 0x8A67, 0xBB87, 0xE486, 0xFD46, 0xFDA6,
-  0xFDC6, 0xF546, 0xDC66, 0xC387, 0x9267, 0x79E7, 0x8227, 0x8A26, 0x8A05, 0x7A89, 0x7390, 0x6BF2, 0x7B6E, 0x82A9, 0x8A46, 0x8205, 0x8A26, 0xA32B, 0xCC51, 0xCC51, 0xAB4C, 0x8A67, 0x8246, 0x8225, 0x8A05, 0x8AEA, 0x8C11, 0x8494, 0x8C11, 0x8B2B, 0x8A67, 0x8A25, 0x8A67, 0x82A9, 0x82A9, 0x8268, 0x8A46, 0x8A06, 0x8A66, 0xB347, 0xDCA7, 0xF546, 0xFD86, 0xFD86,
-  0xFD86, 0xFD86, 0xFD46, 0xE4A7, 0xAB47, 0x8A66, 0x8A66, 0x9286, 0x8A46, 0x8247, 0x7A68, 0x8289, 0x8A88, 0x8A67, 0x8A46, 0x8205, 0x8226, 0xB36D, 0xED16, 0xF577, 0xCC31, 0x9AE9, 0x8A66, 0x81E4, 0x8A04, 0x8B4D, 0x8D58, 0x8E5F, 0x8DBB, 0x8C32, 0x8AA9, 0x89E4, 0x8A25, 0x8A67, 0x8A46, 0x8A26, 0x8A46, 0x9AC6, 0xC3C6, 0xE4C6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD45,
-  0xF525, 0xFDA6, 0xFDC6, 0xFDA7, 0xD446, 0xBB86, 0xB366, 0xBB86, 0xB367, 0xA2E6, 0x9225, 0x89C4, 0x8A05, 0x8A46, 0x8A67, 0x8246, 0x8225, 0xAB4C, 0xED15, 0xFDB9, 0xE4D4, 0xAB6C, 0x8A67, 0x79C4, 0x81E4, 0x8B2C, 0x8CF6, 0x8DFD, 0x8DBB, 0x8C52, 0x8AC9, 0x89E4, 0x8A25, 0x8247, 0x8206, 0x8226, 0x9AE7, 0xC3E6, 0xECE6, 0xFDA6, 0xFE27, 0xFDA6, 0xFD66, 0xFD05,
-  0xF4E6, 0xFD86, 0xFDA6, 0xFE07, 0xF566, 0xECE6, 0xECE6, 0xED06, 0xECE6, 0xD446, 0xB325, 0x9245, 0x8206, 0x8227, 0x8A87, 0x8A66, 0x8225, 0x9AE9, 0xD451, 0xED35, 0xDCB3, 0xB38D, 0x8A67, 0x79C4, 0x81E5, 0x8A89, 0x8B4D, 0x8BD0, 0x8BF0, 0x8B6C, 0x8AA8, 0x8A45, 0x8A46, 0x8227, 0x79E6, 0x9286, 0xC3E6, 0xED06, 0xFD66, 0xFDC6, 0xFE27, 0xFD86, 0xFD66, 0xFD25,
-  0xF4E7, 0xFD46, 0xFD66, 0xFE07, 0xFDE6, 0xFDA6, 0xFD86, 0xFDA6, 0xFDA6, 0xF546, 0xD467, 0xAB67, 0x8A87, 0x7A27, 0x8227, 0x8226, 0x79E5, 0x8A47, 0xA30B, 0xB3AE, 0xB3AE, 0xA30B, 0x8A47, 0x79E5, 0x8206, 0x8A26, 0x8206, 0x8206, 0x8247, 0x8247, 0x8247, 0x8226, 0x8227, 0x8227, 0x8A87, 0xB367, 0xE4C6, 0xFD86, 0xFDA6, 0xFDA6, 0xFE07, 0xFD66, 0xFD46, 0xFD46,
-  0xFBE7, 0xFD25, 0xFD46, 0xFDA6, 0xFDE6, 0xFDC6, 0xFD86, 0xFD66, 0xFD86, 0xFDA6, 0xF566, 0xDC86, 0xAB47, 0x8A67, 0x7A07, 0x79E6, 0x79E6, 0x7A06, 0x8227, 0x8A48, 0x8A68, 0x8A88, 0x8A67, 0x8A66, 0x9286, 0x9266, 0x8A46, 0x8A05, 0x8205, 0x8206, 0x8206, 0x7A07, 0x7A07, 0x9287, 0xBB86, 0xDC86, 0xFD46, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD46, 0xFD46, 0xFD05,
-  0x0000, 0xFD26, 0xFD26, 0xFD46, 0xFD86, 0xFDC7, 0xFD86, 0xFD46, 0xFD26, 0xFD86, 0xFDA6, 0xFD46, 0xD446, 0xB366, 0x9AC6, 0x9287, 0x8A67, 0x9266, 0x8A66, 0x9265, 0x92A5, 0xA306, 0xB366, 0xBB87, 0xBBA7, 0xBB86, 0xB366, 0xAB26, 0xA2E6, 0x9AC6, 0x9AC6, 0x9AA7, 0x9AC6, 0xBB86, 0xDC86, 0xF526, 0xFD66, 0xFD86, 0xFDC7, 0xFDA6, 0xFD46, 0xFD45, 0xFD46, 0x0000,
-  0xF800, 0xFD40, 0xFCE6, 0xFD26, 0xFD66, 0xFDE7, 0xFDC7, 0xFD86, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xF546, 0xECC6, 0xD446, 0xC3C6, 0xBB86, 0xBB86, 0xBBA6, 0xCBE5, 0xD426, 0xE486, 0xECC6, 0xED06, 0xED06, 0xECE6, 0xECE6, 0xE4A6, 0xDC86, 0xD446, 0xD426, 0xD426, 0xDC66, 0xECC6, 0xF526, 0xFD86, 0xFD86, 0xFDC6, 0xFE07, 0xFD86, 0xFD46, 0xFD25, 0xFE66, 0x0000,
-  0xFBE5, 0x0000, 0x0000, 0xFD46, 0xFD46, 0xFD86, 0xFDC6, 0xFDC6, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD86, 0xFD86, 0xFD26, 0xECC6, 0xE4A6, 0xE4A6, 0xECC6, 0xF526, 0xFD46, 0xFD86, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFD66, 0xFD46, 0xF526, 0xF526, 0xFD66, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD66, 0xFCC6, 0x0000, 0xFDE0,
-  0xFCC0, 0x0000, 0x0000, 0xFCE7, 0xFD46, 0xFD66, 0xFD86, 0xFDA6, 0xFE07, 0xFDC7, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFD86, 0xFD66, 0xFD86, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFDC6, 0xFDC6, 0xFE07, 0xFDC6, 0xFD86, 0xFD66, 0xFD46, 0xFD46, 0x0000, 0x0000, 0xFE60,
-  0xFD40, 0xFFE0, 0xFDE7, 0x0000, 0x0000, 0xFD46, 0xFD46, 0xFD86, 0xFDC6, 0xFDC6, 0xFDA6, 0xFD86, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDC6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD46, 0xFD06, 0xE3E6, 0x0000, 0xFD4A, 0xFBE0, 0xFFE0,
-  0xF800, 0xF800, 0xFBE0, 0x0000, 0x0000, 0xFCC6, 0xFD06, 0xFD66, 0xFD86, 0xFD86, 0xFD66, 0xFD86, 0xFDC6, 0xFDE7, 0xFDE7, 0xFDE7, 0xFDE6, 0xFDC6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDC6, 0xFDE7, 0xFDE7, 0xFDE7, 0xFDE6, 0xFD86, 0xFD86, 0xFD86, 0xFD86, 0xFD86, 0xFD25, 0xFC45, 0x0000, 0x0000, 0xFFEF, 0xFFE0, 0xFFE0,
-  0x0000, 0xF800, 0xFBE0, 0xFCC0, 0xFC89, 0x0000, 0x0000, 0x0000, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFC84, 0x0000, 0x0000, 0xFE66, 0xFD45, 0xFD4A, 0xFFE0, 0x0000,
-  0x0000, 0x0000, 0xF800, 0xFBE0, 0xFD40, 0x0000, 0x0000, 0x0000, 0xFDA4, 0xFD25, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD66, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD46, 0xFD05, 0xFD05, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFBE0, 0xFBE0, 0xFBE5, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCE7, 0xFD05, 0xFD25, 0xFD26, 0xFD46, 0xFD46, 0xFD46, 0xFD46, 0xFD46, 0xFD26, 0xFD26, 0xFD46, 0xFD46, 0xFD45, 0xFD45, 0xFD26, 0xFD06, 0xFD26, 0xFD46, 0xFD47, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0xFD45, 0xFFE7, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE7, 0xFCA5, 0xFCC5, 0xFD25, 0xFD45, 0xFD66, 0xFD46, 0xFD46, 0xFD06, 0xFD06, 0xFD26, 0xFD45, 0xFD25, 0xFD05, 0xFCE6, 0xFD06, 0xFCE7, 0xFD45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFFE0, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFDA9, 0xFE27, 0xFDE7, 0xFD45, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFD45, 0xFCE3, 0xFD47, 0xFCE7, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DONUT_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 16, 12, 35, 28, 56, 44, 77, 60, 102, 78, 132, 101,
+  169, 131, 209, 164, 239, 201, 268, 239, 310, 279, 350, 319, 387, 362, 431, 406,
+  471, 448, 513, 491, 533, 535, 551, 579, 595, 623, 642, 667, 682, 703, 728, 747,
+  773, 791, 809, 835, 827, 879, 845, 923, 880, 967, 915, 1011, 934, 1055, 952, 1099,
+  972, 1143, 994, 1187, 1018, 1229, 1045, 1272, 1090, 1313, 1134, 1353, 1159, 1394, 1185, 1434,
+  1225, 1471, 1266, 1505, 1303, 1535, 1335, 1560
 };
 
-const uint8_t SPRITE_DONUT_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x07, 0x08, 0x07, 0x06, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x07, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1C, 0x28, 0x30, 0x37, 0x3A, 0x3C, 0x39, 0x33, 0x2A, 0x1F, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x07, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x1E, 0x29, 0x3A, 0x4B, 0x5E, 0x6C, 0x79, 0x81, 0x87, 0x8B, 0x8D, 0x8A, 0x84, 0x7B, 0x6F, 0x61, 0x4D, 0x3C, 0x2B, 0x20, 0x14, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x06, 0x05, 0x01, 0x00, 0x00, 0x02, 0x2B, 0x56, 0x7D, 0x9B, 0xB7, 0xC7, 0xD5, 0xDA, 0xDE, 0xE0, 0xE3, 0xE4, 0xE4, 0xE3, 0xE1, 0xDF, 0xDB, 0xD6, 0xC9, 0xB9, 0xA0, 0x83, 0x5D, 0x35, 0x0C, 0x00, 0x00, 0x00, 0x04, 0x05, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x06, 0x15, 0x2C, 0x4D, 0x7C, 0xA6, 0xCE, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xD4, 0xAD, 0x85, 0x5A, 0x38, 0x1B, 0x08, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00,
-  0x00, 0x02, 0x06, 0x02, 0x00, 0x00, 0x26, 0x60, 0x9B, 0xC5, 0xDF, 0xEC, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xEC, 0xE2, 0xCF, 0xAB, 0x71, 0x32, 0x00, 0x00, 0x01, 0x07, 0x03, 0x00,
-  0x03, 0x01, 0x00, 0x00, 0x11, 0x31, 0x71, 0xB1, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF6, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0xC1, 0x80, 0x3C, 0x16, 0x00, 0x00, 0x01, 0x03,
-  0x07, 0x00, 0x00, 0x0C, 0x4F, 0x96, 0xD2, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xDB, 0xA8, 0x60, 0x12, 0x00, 0x00, 0x08,
-  0x07, 0x00, 0x0A, 0x3B, 0x99, 0xE1, 0xFF, 0xFF, 0xFD, 0xF6, 0xF7, 0xF8, 0xFA, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF9, 0xF8, 0xF6, 0xF7, 0xFC, 0xFF, 0xFF, 0xF1, 0xAD, 0x4B, 0x10, 0x01, 0x06,
-  0x04, 0x09, 0x35, 0x88, 0xDA, 0xFE, 0xFF, 0xFD, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFF, 0xFF, 0xE6, 0xA2, 0x49, 0x0D, 0x01,
-  0x00, 0x1B, 0x6E, 0xCB, 0xFB, 0xFE, 0xFA, 0xF3, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF4, 0xFA, 0xFC, 0xFF, 0xE1, 0x87, 0x26, 0x00,
-  0x00, 0x37, 0xA7, 0xF6, 0xFF, 0xFC, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF9, 0xFA, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFC, 0xF9, 0xFF, 0xFC, 0xBB, 0x4A, 0x0D,
-  0x0D, 0x53, 0xC8, 0xFF, 0xFD, 0xF6, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF4, 0xFD, 0xFF, 0xD4, 0x69, 0x26,
-  0x2D, 0x6B, 0xD4, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xDB, 0x80, 0x48,
-  0x42, 0x77, 0xD3, 0xFD, 0xFE, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xEE, 0xDB, 0xCE, 0xC9, 0xC2, 0xB9, 0xB3, 0xB0, 0xB5, 0xBF, 0xC5, 0xCC, 0xD8, 0xEA, 0xF7, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFD, 0xD8, 0x8B, 0x5E,
-  0x4C, 0x7E, 0xD6, 0xFE, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xEF, 0xC1, 0x7E, 0x50, 0x40, 0x3C, 0x35, 0x33, 0x30, 0x32, 0x3A, 0x3D, 0x49, 0x72, 0xB3, 0xE4, 0xFC, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xDC, 0x93, 0x68,
-  0x54, 0x85, 0xD8, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0xFD, 0xFE, 0xEA, 0xAD, 0x52, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x43, 0x9B, 0xDD, 0xFB, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xE0, 0x9C, 0x74,
-  0x65, 0x91, 0xDC, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xFE, 0xEE, 0xBD, 0x73, 0x3D, 0x24, 0x1A, 0x10, 0x0E, 0x0E, 0x10, 0x17, 0x1D, 0x33, 0x67, 0xB2, 0xE7, 0xFD, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xE5, 0xAB, 0x89,
-  0x74, 0x9C, 0xE0, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xF6, 0xDD, 0xB4, 0x96, 0x85, 0x7C, 0x74, 0x71, 0x72, 0x74, 0x79, 0x7F, 0x8F, 0xAE, 0xD8, 0xF4, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xE8, 0xB5, 0x97,
-  0x80, 0xA4, 0xE3, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xED, 0xE6, 0xE1, 0xDE, 0xDC, 0xDB, 0xDB, 0xDC, 0xDD, 0xDF, 0xE4, 0xEC, 0xF6, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xFF, 0xEA, 0xBB, 0x9F,
-  0x86, 0xA9, 0xE4, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xFF, 0xEC, 0xC2, 0xAA,
-  0x86, 0xA9, 0xE4, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xEE, 0xC9, 0xB4,
-  0x89, 0xAA, 0xE4, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF9, 0xF7, 0xF6, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF7, 0xF7, 0xF8, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xEF, 0xCB, 0xB8,
-  0x84, 0xA6, 0xE1, 0xFE, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xEB, 0xC1, 0xAB,
-  0x6B, 0x97, 0xE0, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFE, 0xE7, 0xAF, 0x8E,
-  0x40, 0x7A, 0xD6, 0xFD, 0xFD, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFE, 0xFB, 0xDC, 0x91, 0x63,
-  0x1A, 0x56, 0xC5, 0xFF, 0xFF, 0xF8, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF7, 0xFF, 0xFF, 0xD1, 0x6B, 0x33,
-  0x04, 0x30, 0xA0, 0xF6, 0xFF, 0xF8, 0xFA, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFB, 0xF6, 0xFF, 0xFF, 0xB5, 0x40, 0x0B,
-  0x00, 0x14, 0x64, 0xC7, 0xFC, 0xFF, 0xFF, 0xF7, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF, 0xDF, 0x7C, 0x1E, 0x00,
-  0x01, 0x03, 0x1F, 0x77, 0xDE, 0xFF, 0xFF, 0xF5, 0xF6, 0xF6, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xF8, 0xF6, 0xF4, 0xFF, 0xFF, 0xEB, 0x8F, 0x31, 0x05, 0x00,
-  0x06, 0x00, 0x00, 0x31, 0x95, 0xDE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0xE4, 0xA8, 0x42, 0x05, 0x00, 0x04,
-  0x05, 0x00, 0x00, 0x08, 0x34, 0x7A, 0xCB, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF7, 0xF7, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xDB, 0x8D, 0x46, 0x0F, 0x00, 0x00, 0x05,
-  0x03, 0x01, 0x04, 0x00, 0x00, 0x2A, 0x7B, 0xBB, 0xDF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE4, 0xC7, 0x8D, 0x3D, 0x0A, 0x00, 0x03, 0x02, 0x04,
-  0x01, 0x01, 0x02, 0x00, 0x00, 0x05, 0x1E, 0x46, 0x7F, 0xB5, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0xC2, 0x8D, 0x52, 0x26, 0x0B, 0x00, 0x00, 0x02, 0x01, 0x01,
-  0x00, 0x01, 0x02, 0x05, 0x07, 0x00, 0x00, 0x00, 0x2F, 0x65, 0x96, 0xBA, 0xD4, 0xE0, 0xE8, 0xEE, 0xF5, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xF6, 0xEF, 0xEA, 0xE2, 0xD7, 0xBE, 0x9F, 0x72, 0x3D, 0x07, 0x00, 0x00, 0x05, 0x06, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x07, 0x17, 0x28, 0x3F, 0x5F, 0x7C, 0x99, 0xAF, 0xC4, 0xD2, 0xE1, 0xE7, 0xE9, 0xE9, 0xE8, 0xEA, 0xE9, 0xE4, 0xD5, 0xC6, 0xB4, 0x9F, 0x83, 0x66, 0x44, 0x2D, 0x1C, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x26, 0x40, 0x55, 0x67, 0x74, 0x82, 0x88, 0x8A, 0x8A, 0x89, 0x8A, 0x8A, 0x85, 0x77, 0x6A, 0x59, 0x45, 0x2C, 0x12, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x12, 0x17, 0x1B, 0x1F, 0x21, 0x21, 0x21, 0x21, 0x22, 0x21, 0x20, 0x1C, 0x18, 0x13, 0x0D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x09, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x09, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DONUT_44_SPAN_OPS[] PROGMEM = {
+  0xC0, 0x0F, 0x8B, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0xC0, 0x0D, 0x8F, 0x01, 0x02, 0x03, 0x03, 0x05, 0x05,
+  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x02, 0x01, 0xC0, 0x08, 0x87, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x09, 0x87, 0x01,
+  0x01, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0xC0, 0x08, 0x87, 0x03, 0x06, 0x07, 0x08, 0x07, 0x06, 0x04, 0x02, 0x09, 0x87, 0x02, 0x04, 0x05, 0x06,
+  0x07, 0x08, 0x06, 0x03, 0xC0, 0x05, 0x83, 0x01, 0x02, 0x01, 0x02, 0x06, 0x89, 0x01, 0x04, 0x07, 0x09, 0x0A, 0x0A, 0x09, 0x08, 0x05, 0x01, 0x06,
+  0x83, 0x01, 0x01, 0x02, 0x01, 0xC0, 0x04, 0x84, 0x01, 0x05, 0x07, 0x06, 0x04, 0x05, 0x8C, 0x0E, 0x1C, 0x28, 0x30, 0x37, 0x3A, 0x3C, 0x39, 0x33,
+  0x2A, 0x1F, 0x11, 0x01, 0x04, 0x84, 0x02, 0x06, 0x07, 0x05, 0x01, 0xC0, 0x02, 0x82, 0x01, 0x02, 0x02, 0x03, 0x97, 0x05, 0x12, 0x1E, 0x29, 0x3A,
+  0x4B, 0x5E, 0x6C, 0x79, 0x81, 0x87, 0x8B, 0x8D, 0x8A, 0x84, 0x7B, 0x6F, 0x61, 0x4D, 0x3C, 0x2B, 0x20, 0x14, 0x08, 0x03, 0x82, 0x01, 0x01, 0x01,
+  0xC0, 0x02, 0x83, 0x03, 0x06, 0x05, 0x01, 0x01, 0x99, 0x02, 0x2B, 0x56, 0x7D, 0x9B, 0xB7, 0xC7, 0xD5, 0xDA, 0xDE, 0xE0, 0xE3, 0xE4, 0xE4, 0xE3,
+  0xE1, 0xDF, 0xDB, 0xD6, 0xC9, 0xB9, 0xA0, 0x83, 0x5D, 0x35, 0x0C, 0x02, 0x82, 0x04, 0x05, 0x02, 0xC0, 0x00, 0x82, 0x01, 0x03, 0x01, 0x01, 0x87,
+  0x06, 0x15, 0x2C, 0x4D, 0x7C, 0xA6, 0xCE, 0xEB, 0x4F, 0x87, 0xEF, 0xD4, 0xAD, 0x85, 0x5A, 0x38, 0x1B, 0x08, 0x02, 0x81, 0x03, 0x01, 0xC0, 0x00,
+  0x82, 0x02, 0x06, 0x02, 0x01, 0x86, 0x26, 0x60, 0x9B, 0xC5, 0xDF, 0xEC, 0xF8, 0x51, 0x86, 0xFA, 0xEC, 0xE2, 0xCF, 0xAB, 0x71, 0x32, 0x01, 0x82,
+  0x01, 0x07, 0x03, 0xC0, 0x81, 0x03, 0x01, 0x01, 0x84, 0x11, 0x31, 0x71, 0xB1, 0xEA, 0x43, 0x91, 0xFD, 0xFA, 0xF9, 0xF9, 0xF8, 0xF8, 0xF6, 0xF7,
+  0xF7, 0xF7, 0xF7, 0xF7, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFC, 0x43, 0x84, 0xF6, 0xC1, 0x80, 0x3C, 0x16, 0x01, 0x81, 0x01, 0x03, 0xC0, 0x80, 0x07,
+  0x01, 0x84, 0x0C, 0x4F, 0x96, 0xD2, 0xF0, 0x44, 0x91, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+  0xFD, 0xFE, 0xFE, 0x44, 0x84, 0xF5, 0xDB, 0xA8, 0x60, 0x12, 0x01, 0x80, 0x08, 0xC0, 0x80, 0x07, 0x00, 0x83, 0x0A, 0x3B, 0x99, 0xE1, 0x41, 0x87,
+  0xFD, 0xF6, 0xF7, 0xF8, 0xFA, 0xFB, 0xFD, 0xFE, 0x4B, 0x87, 0xFE, 0xFE, 0xFC, 0xF9, 0xF8, 0xF6, 0xF7, 0xFC, 0x41, 0x85, 0xF1, 0xAD, 0x4B, 0x10,
+  0x01, 0x06, 0xC0, 0x85, 0x04, 0x09, 0x35, 0x88, 0xDA, 0xFE, 0x40, 0x87, 0xFD, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0x42, 0x87, 0xFE, 0xFE,
+  0xFE, 0xFE, 0xFD, 0xFD, 0xFE, 0xFE, 0x43, 0x86, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0x41, 0x84, 0xE6, 0xA2, 0x49, 0x0D, 0x01, 0xC0, 0x00,
+  0x88, 0x1B, 0x6E, 0xCB, 0xFB, 0xFE, 0xFA, 0xF3, 0xFA, 0xFE, 0x44, 0x8E, 0xFE, 0xFD, 0xFD, 0xFC, 0xFD, 0xFD, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+  0xFD, 0xFE, 0xFE, 0x44, 0x83, 0xFB, 0xF4, 0xFA, 0xFC, 0x40, 0x82, 0xE1, 0x87, 0x26, 0xC0, 0x00, 0x82, 0x37, 0xA7, 0xF6, 0x40, 0x83, 0xFC, 0xFD,
+  0xFB, 0xFE, 0x44, 0x8F, 0xFE, 0xFC, 0xF8, 0xF7, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF9, 0xFA, 0xFC, 0x44, 0x83, 0xFE, 0xFB,
+  0xFC, 0xF9, 0x40, 0x83, 0xFC, 0xBB, 0x4A, 0x0D, 0xC0, 0x82, 0x0D, 0x53, 0xC8, 0x40, 0x82, 0xFD, 0xF6, 0xFC, 0x5D, 0x82, 0xFC, 0xF4, 0xFD, 0x40,
+  0x82, 0xD4, 0x69, 0x26, 0xC0, 0x82, 0x2D, 0x6B, 0xD4, 0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFD, 0xF7, 0x41, 0x82, 0xDB, 0x80, 0x48, 0xC0, 0x86,
+  0x42, 0x77, 0xD3, 0xFD, 0xFE, 0xF9, 0xFD, 0x42, 0x80, 0xFE, 0x42, 0x90, 0xFB, 0xEE, 0xDB, 0xCE, 0xC9, 0xC2, 0xB9, 0xB3, 0xB0, 0xB5, 0xBF, 0xC5,
+  0xCC, 0xD8, 0xEA, 0xF7, 0xFE, 0x41, 0x80, 0xFE, 0x42, 0x81, 0xFD, 0xF8, 0x40, 0x83, 0xFD, 0xD8, 0x8B, 0x5E, 0xC0, 0x83, 0x4C, 0x7E, 0xD6, 0xFE,
+  0x40, 0x81, 0xF8, 0xFD, 0x41, 0x95, 0xFE, 0xFD, 0xFE, 0xFD, 0xFE, 0xEF, 0xC1, 0x7E, 0x50, 0x40, 0x3C, 0x35, 0x33, 0x30, 0x32, 0x3A, 0x3D, 0x49,
+  0x72, 0xB3, 0xE4, 0xFC, 0x41, 0x81, 0xFD, 0xFE, 0x41, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xDC, 0x93, 0x68, 0xC0, 0x82, 0x54, 0x85, 0xD8, 0x41, 0x81,
+  0xF8, 0xFD, 0x41, 0x88, 0xFE, 0xFC, 0xFE, 0xFD, 0xFE, 0xEA, 0xAD, 0x52, 0x12, 0x07, 0x84, 0x09, 0x43, 0x9B, 0xDD, 0xFB, 0x41, 0x81, 0xFC, 0xFE,
+  0x41, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xE0, 0x9C, 0x74, 0xC0, 0x82, 0x65, 0x91, 0xDC, 0x41, 0x81, 0xF8, 0xFD, 0x42, 0x80, 0xFC, 0x40, 0x92, 0xFE,
+  0xFE, 0xEE, 0xBD, 0x73, 0x3D, 0x24, 0x1A, 0x10, 0x0E, 0x0E, 0x10, 0x17, 0x1D, 0x33, 0x67, 0xB2, 0xE7, 0xFD, 0x41, 0x81, 0xFC, 0xFE, 0x41, 0x81,
+  0xFD, 0xF9, 0x41, 0x82, 0xE5, 0xAB, 0x89, 0xC0, 0x82, 0x74, 0x9C, 0xE0, 0x41, 0x81, 0xF8, 0xFD, 0x42, 0x80, 0xFE, 0x40, 0x91, 0xFE, 0xFE, 0xF6,
+  0xDD, 0xB4, 0x96, 0x85, 0x7C, 0x74, 0x71, 0x72, 0x74, 0x79, 0x7F, 0x8F, 0xAE, 0xD8, 0xF4, 0x42, 0x81, 0xFE, 0xFE, 0x41, 0x81, 0xFD, 0xF9, 0x41,
+  0x82, 0xE8, 0xB5, 0x97, 0xC0, 0x82, 0x80, 0xA4, 0xE3, 0x41, 0x81, 0xF9, 0xFD, 0x46, 0x8F, 0xFD, 0xF7, 0xED, 0xE6, 0xE1, 0xDE, 0xDC, 0xDB, 0xDB,
+  0xDC, 0xDD, 0xDF, 0xE4, 0xEC, 0xF6, 0xFD, 0x46, 0x81, 0xFE, 0xFA, 0x41, 0x82, 0xEA, 0xBB, 0x9F, 0xC0, 0x82, 0x86, 0xA9, 0xE4, 0x41, 0x81, 0xF9,
+  0xFD, 0x5D, 0x81, 0xFE, 0xFA, 0x41, 0x82, 0xEC, 0xC2, 0xAA, 0xC0, 0x82, 0x86, 0xA9, 0xE4, 0x41, 0x81, 0xF9, 0xFD, 0x5D, 0x81, 0xFE, 0xFB, 0x41,
+  0x82, 0xEE, 0xC9, 0xB4, 0xC0, 0x82, 0x89, 0xAA, 0xE4, 0x41, 0x81, 0xF9, 0xFD, 0x47, 0x8E, 0xFC, 0xF9, 0xF7, 0xF6, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF7, 0xF7, 0xF8, 0xFB, 0xFE, 0x46, 0x81, 0xFE, 0xFB, 0x41, 0x82, 0xEF, 0xCB, 0xB8, 0xC0, 0x83, 0x84, 0xA6, 0xE1, 0xFE, 0x40, 0x81, 0xF9,
+  0xFD, 0x47, 0x8D, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0x47, 0x81, 0xFE, 0xFB, 0x41, 0x82, 0xEB,
+  0xC1, 0xAB, 0xC0, 0x82, 0x6B, 0x97, 0xE0, 0x41, 0x81, 0xF8, 0xFD, 0x5D, 0x81, 0xFE, 0xF9, 0x40, 0x83, 0xFE, 0xE7, 0xAF, 0x8E, 0xC0, 0x86, 0x40,
+  0x7A, 0xD6, 0xFD, 0xFD, 0xF7, 0xFD, 0x5D, 0x86, 0xFD, 0xF8, 0xFE, 0xFB, 0xDC, 0x91, 0x63, 0xC0, 0x82, 0x1A, 0x56, 0xC5, 0x41, 0x82, 0xF8, 0xFC,
+  0xFD, 0x5B, 0x82, 0xFE, 0xFC, 0xF7, 0x41, 0x82, 0xD1, 0x6B, 0x33, 0xC0, 0x83, 0x04, 0x30, 0xA0, 0xF6, 0x40, 0x83, 0xF8, 0xFA, 0xF9, 0xFE, 0x5A,
+  0x82, 0xFB, 0xFB, 0xF6, 0x41, 0x82, 0xB5, 0x40, 0x0B, 0xC0, 0x00, 0x83, 0x14, 0x64, 0xC7, 0xFC, 0x41, 0x83, 0xF7, 0xFB, 0xFD, 0xFE, 0x55, 0x83,
+  0xFE, 0xFD, 0xFC, 0xF8, 0x42, 0x82, 0xDF, 0x7C, 0x1E, 0xC0, 0x84, 0x01, 0x03, 0x1F, 0x77, 0xDE, 0x41, 0x84, 0xF5, 0xF6, 0xF6, 0xFB, 0xFE, 0x53,
+  0x84, 0xFE, 0xFB, 0xF8, 0xF6, 0xF4, 0x41, 0x83, 0xEB, 0x8F, 0x31, 0x05, 0xC0, 0x80, 0x06, 0x01, 0x83, 0x31, 0x95, 0xDE, 0xF7, 0x42, 0x97, 0xFE,
+  0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFE, 0x42,
+  0x84, 0xFC, 0xE4, 0xA8, 0x42, 0x05, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x05, 0x01, 0x83, 0x08, 0x34, 0x7A, 0xCB, 0x42, 0x97, 0xFE, 0xF9, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xF9, 0xF8, 0xF7, 0xF7, 0xF7, 0xF9, 0xFD, 0x42, 0x83, 0xDB, 0x8D,
+  0x46, 0x0F, 0x01, 0x80, 0x05, 0xC0, 0x82, 0x03, 0x01, 0x04, 0x01, 0x84, 0x2A, 0x7B, 0xBB, 0xDF, 0xF1, 0x57, 0x85, 0xF4, 0xE4, 0xC7, 0x8D, 0x3D,
+  0x0A, 0x00, 0x82, 0x03, 0x02, 0x04, 0xC0, 0x82, 0x01, 0x01, 0x02, 0x01, 0x85, 0x05, 0x1E, 0x46, 0x7F, 0xB5, 0xE5, 0x55, 0x85, 0xEC, 0xC2, 0x8D,
+  0x52, 0x26, 0x0B, 0x01, 0x82, 0x02, 0x01, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x02, 0x05, 0x07, 0x02, 0x8A, 0x2F, 0x65, 0x96, 0xBA, 0xD4, 0xE0, 0xE8,
+  0xEE, 0xF5, 0xF9, 0xFD, 0x45, 0x8B, 0xFE, 0xFA, 0xF6, 0xEF, 0xEA, 0xE2, 0xD7, 0xBE, 0x9F, 0x72, 0x3D, 0x07, 0x01, 0x83, 0x05, 0x06, 0x03, 0x01,
+  0xC0, 0x01, 0x82, 0x01, 0x02, 0x03, 0x02, 0x9B, 0x07, 0x17, 0x28, 0x3F, 0x5F, 0x7C, 0x99, 0xAF, 0xC4, 0xD2, 0xE1, 0xE7, 0xE9, 0xE9, 0xE8, 0xEA,
+  0xE9, 0xE4, 0xD5, 0xC6, 0xB4, 0x9F, 0x83, 0x66, 0x44, 0x2D, 0x1C, 0x0B, 0x02, 0x82, 0x02, 0x02, 0x01, 0xC0, 0x02, 0x84, 0x01, 0x02, 0x04, 0x06,
+  0x04, 0x03, 0x93, 0x0D, 0x26, 0x40, 0x55, 0x67, 0x74, 0x82, 0x88, 0x8A, 0x8A, 0x89, 0x8A, 0x8A, 0x85, 0x77, 0x6A, 0x59, 0x45, 0x2C, 0x12, 0x03,
+  0x84, 0x03, 0x06, 0x04, 0x02, 0x01, 0xC0, 0x04, 0x82, 0x01, 0x01, 0x02, 0x04, 0x91, 0x04, 0x0C, 0x12, 0x17, 0x1B, 0x1F, 0x21, 0x21, 0x21, 0x21,
+  0x22, 0x21, 0x20, 0x1C, 0x18, 0x13, 0x0D, 0x06, 0x04, 0x83, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x06, 0x85, 0x03, 0x07, 0x09, 0x08, 0x06, 0x02, 0x11,
+  0x85, 0x01, 0x06, 0x08, 0x09, 0x08, 0x04, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DONUT_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0841, 0x1061, 0x1061, 0x1861, 0x1861, 0x1861, 0x1881, 0x1040, 0x0820, 0x0800, 0x0820, 0x0800, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1041, 0x1040, 0x1861, 0x2081, 0x30C1, 0x38E2,
+  0x3902, 0x4123, 0x4943, 0x4943, 0x4943, 0x4923, 0x4123, 0x3902, 0x38E2, 0x30E2, 0x28A2, 0x20A1, 0x1061, 0x0841, 0x0840, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x28C2, 0x4123, 0x5143, 0x6163, 0x6963, 0x7183, 0x71A4,
+  0x7A05, 0x7A26, 0x7A06, 0x8226, 0x8226, 0x8267, 0x92A9, 0x92A9, 0x8247, 0x7205, 0x69C4, 0x59A5, 0x5165, 0x4144, 0x30E3, 0x1881,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1840, 0x2880, 0x4902, 0x5983, 0x69E5, 0x7A06, 0x8A67,
+  0x9267, 0x9266, 0x9267, 0x9A87, 0x9287, 0x9267, 0x9A87, 0xA2E9, 0xC3AE, 0xDC92, 0xDC71, 0xB36C, 0x9AA8, 0x8A66, 0x8A46, 0x79E4,
+  0x79E5, 0x6184, 0x4943, 0x28C2, 0x1861, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1041, 0x30A1, 0x5101, 0x7162,
+  0x81C4, 0x8205, 0x8A25, 0x8A87, 0x92EA, 0x932C, 0x934C, 0x930B, 0x92A8, 0x8A25, 0x8225, 0x8A67, 0xAB2B, 0xDC72, 0xFD97, 0xF536,
+  0xBBCE, 0x9288, 0x8A26, 0x9225, 0x9204, 0x9203, 0x8A04, 0x7A05, 0x69E5, 0x5984, 0x3903, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1861, 0x3903, 0x59A4, 0x7A47, 0x8AA9, 0x92C9, 0x9267, 0x9225, 0x8A67, 0x832B, 0x8432, 0x84D6, 0x8453, 0x830B,
+  0x7A04, 0x79C3, 0x8225, 0x9B09, 0xC410, 0xE4F4, 0xD472, 0xA34B, 0x8246, 0x7A05, 0x8246, 0x8AA8, 0x8AC9, 0x92A8, 0x9AA8, 0x9267,
+  0x8225, 0x6183, 0x4102, 0x1860, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A1, 0x5142, 0x71E4, 0x7ACA, 0x7BD1, 0x7413, 0x7B8F,
+  0x82A9, 0x8A04, 0x8A26, 0x8B6D, 0x8558, 0x8E9F, 0x8E1C, 0x8C10, 0x8A66, 0x8A04, 0x8A46, 0x9AA8, 0xA32A, 0xAB4C, 0xAB2A, 0x92A7,
+  0x8A46, 0x8A47, 0x7B0C, 0x6BF2, 0x6C13, 0x7B6E, 0x8AA9, 0x8A46, 0x8A25, 0x81E4, 0x69A4, 0x4922, 0x2881, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x1861, 0x5164, 0x79E5, 0x9A66, 0x8B6D, 0x6CB7, 0x54DA, 0x5C14, 0x72CA, 0x79E4, 0x81E3, 0x8B0B, 0x84B5, 0x85FC, 0x859A,
+  0x83CF, 0x8247, 0x8206, 0x8226, 0x8226, 0x8226, 0x7A06, 0x79E5, 0x8205, 0x8A25, 0x8288, 0x73B0, 0x5CFA, 0x54DA, 0x63B1, 0x7A68,
+  0x8205, 0x9A67, 0xA2E9, 0xAB2B, 0x8AA8, 0x61A5, 0x20A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1861, 0x4943, 0x7A25, 0x9A86,
+  0x9A66, 0x832D, 0x64B8, 0x5D1B, 0x6455, 0x7B2D, 0x8A46, 0x8A04, 0x8A66, 0x8B2B, 0x8BAF, 0x836E, 0x82AA, 0x7A27, 0x7A07, 0x7A07,
+  0x7A07, 0x79E7, 0x71E7, 0x79E6, 0x81E5, 0x8A26, 0x82C9, 0x73F2, 0x5D3B, 0x5CFA, 0x6B90, 0x8268, 0x9267, 0xB34C, 0xD451, 0xE4D4,
+  0xD450, 0x9AEA, 0x5984, 0x1860, 0x0000, 0x0000, 0x0820, 0x38E2, 0x71C5, 0x8A66, 0x9A66, 0x81E4, 0x6A48, 0x636F, 0x6BF3, 0x7390,
+  0x82EB, 0x8A67, 0x8A25, 0x81E5, 0x81E6, 0x81E6, 0x8206, 0x8226, 0x8A46, 0x8A67, 0x8A67, 0x8A47, 0x8A67, 0x8A67, 0x8A47, 0x8A26,
+  0x8226, 0x7A69, 0x734F, 0x6C34, 0x6BF3, 0x7B0C, 0x8247, 0x9AA8, 0xB3AE, 0xE4F5, 0xF557, 0xE4D4, 0xBB8D, 0x7A26, 0x38E2, 0x1020,
+  0x1881, 0x5164, 0x8A46, 0x9267, 0x8A26, 0x8205, 0x71E4, 0x7A27, 0x8268, 0x8288, 0x8A67, 0x8A67, 0x8227, 0x7A06, 0x79E6, 0x81E4,
+  0x8A24, 0x9A84, 0xA2E4, 0xAB04, 0xAAE4, 0xAB04, 0xAAE4, 0xA2E4, 0x9AC4, 0x8A85, 0x8225, 0x7206, 0x7A49, 0x82AA, 0x8289, 0x8246,
+  0x8A46, 0x92A8, 0xB3AE, 0xD473, 0xE4F5, 0xCC10, 0xB34C, 0x9287, 0x5163, 0x2081, 0x0840, 0x0820, 0x28A1, 0x69C5, 0x9287, 0x8A46,
+  0x7A25, 0x92A8, 0xA2C9, 0xA287, 0xA246, 0x9225, 0x8A05, 0x8246, 0x8A67, 0x9287, 0xA2E6, 0xBB45, 0xCBA4, 0xDBE3, 0xDC03, 0xE403,
+  0xE403, 0xE423, 0xE423, 0xE403, 0xDC04, 0xCBC4, 0xBB65, 0xA2C5, 0x9A44, 0x91E4, 0x89E4, 0x8A05, 0x8A46, 0x9288, 0xA30A, 0xB38D,
+  0xB38D, 0xA30A, 0x9AC9, 0x9AA8, 0x69E5, 0x30E2, 0x1061, 0x1861, 0x30E2, 0x7205, 0x9A87, 0x8A67, 0x92C9, 0xBBCF, 0xD472, 0xD451,
+  0xBB6C, 0x9287, 0x79E5, 0x8226, 0x92A7, 0xB345, 0xDC03, 0xFCA2, 0xFCE2, 0xFCE2, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCA1,
+  0xFCC2, 0xFCE2, 0xFCA2, 0xE423, 0xC343, 0x9A84, 0x8A05, 0x8226, 0x8A67, 0x8A67, 0x8A67, 0x8A67, 0x8A47, 0x8226, 0x8A67, 0x9AA7,
+  0x7205, 0x4123, 0x2081, 0x20A2, 0x3902, 0x69C4, 0x9AC8, 0xAB4B, 0xC3F0, 0xED16, 0xF577, 0xE515, 0xBBEF, 0x92A9, 0x7A06, 0x8226,
+  0xAAE6, 0xD3C2, 0xEC60, 0xD440, 0xCC20, 0xC3C0, 0xBB60, 0xB360, 0xAB40, 0xAB40, 0xB360, 0xBB60, 0xC3A0, 0xCC00, 0xD440, 0xE460,
+  0xDBE2, 0xAB26, 0x8A88, 0x8248, 0x8A47, 0x8A25, 0x8204, 0x81E3, 0x79C4, 0x71C4, 0x8A46, 0x9A87, 0x7A05, 0x4943, 0x30C2, 0x28C2,
+  0x4102, 0x69E4, 0xAB2A, 0xD451, 0xED16, 0xFDB8, 0xED36, 0xCC51, 0xA32B, 0x8A67, 0x7A26, 0x8A47, 0xB326, 0xD3C1, 0xBBA0, 0x7AC0,
+  0x49C0, 0x3960, 0x3940, 0x3120, 0x28E0, 0x28E0, 0x28E0, 0x3100, 0x3940, 0x4180, 0x6A60, 0xAB80, 0xDBE1, 0xBB65, 0x9287, 0x8247,
+  0x8226, 0x8A26, 0x8A46, 0x8246, 0x8226, 0x7A05, 0x8A46, 0x9A87, 0x7A26, 0x5163, 0x3902, 0x30E2, 0x4942, 0x71E4, 0xAB2A, 0xD451,
+  0xE4B4, 0xDCD4, 0xC410, 0xA32B, 0x8A67, 0x8205, 0x8A05, 0x9246, 0xAAE5, 0xB342, 0x92C1, 0x4140, 0x0020, 0x0000, 0x3100, 0x8281,
+  0xB342, 0xA305, 0x9286, 0x8A05, 0x8247, 0x7AEB, 0x7B6E, 0x834D, 0x82EB, 0x8246, 0x9246, 0x9A87, 0x7A46, 0x61C4, 0x4962, 0x4142,
+  0x5983, 0x7A25, 0xA2E8, 0xAB2B, 0xA32B, 0xA30B, 0x92A8, 0x8A67, 0x8225, 0x8A05, 0x8A25, 0x8A46, 0x9286, 0x8A65, 0x71E4, 0x38E2,
+  0x1862, 0x0842, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0021, 0x0842, 0x3103, 0x69E4, 0x8A65, 0x92A7, 0x9245, 0x8A04,
+  0x82A9, 0x6C13, 0x64D8, 0x6C55, 0x7B4E, 0x8246, 0x9205, 0x9A66, 0x8A67, 0x6A24, 0x61E3, 0x59C2, 0x6A03, 0x8246, 0x9287, 0x8A67,
+  0x7A05, 0x8225, 0x8205, 0x8204, 0x8246, 0x82CA, 0x7B0C, 0x7B0C, 0x7AAA, 0x7A07, 0x71C5, 0x5985, 0x4944, 0x4123, 0x4103, 0x3902,
+  0x3903, 0x3902, 0x4103, 0x3903, 0x4123, 0x4923, 0x5964, 0x69C5, 0x7A06, 0x8247, 0x8A25, 0x8A46, 0x736F, 0x5D3C, 0x55BF, 0x64B8,
+  0x7B2D, 0x8225, 0x8A04, 0x9246, 0x8A87, 0x8285, 0x8282, 0x6A22, 0x7A63, 0x8A86, 0x9287, 0x8A46, 0x7A05, 0x8246, 0x8A25, 0x8A04,
+  0x8288, 0x73D1, 0x6497, 0x6476, 0x7390, 0x8268, 0x81C4, 0x8205, 0x7A26, 0x71E5, 0x71C4, 0x71E5, 0x7A05, 0x7A05, 0x7206, 0x7A06,
+  0x7A05, 0x8205, 0x79E5, 0x8226, 0x8A26, 0x8A05, 0x8A26, 0x82CA, 0x6C55, 0x4DBF, 0x559F, 0x7413, 0x82A8, 0x8204, 0x8A26, 0x9267,
+  0x92A6, 0x9304, 0x9B23, 0x7AA2, 0x8AA3, 0x9AA6, 0x9A87, 0x8227, 0x7A06, 0x8268, 0x9246, 0x9204, 0x82EA, 0x6476, 0x555D, 0x5CFA,
+  0x73D1, 0x8A88, 0x9A04, 0x9A66, 0x9AC8, 0x9AA8, 0x9A87, 0x9287, 0x9287, 0x9287, 0x9AA7, 0x9A87, 0x9A87, 0x9A87, 0x9A87, 0x9266,
+  0x8A25, 0x8A04, 0x8A46, 0x7B0C, 0x6C35, 0x5D1B, 0x64B8, 0x7B2C, 0x8A05, 0x79A4, 0x8227, 0x9AC7, 0xAB66, 0xAB84, 0xA3A3, 0x8302,
+  0x9303, 0xA326, 0xA2C7, 0x8227, 0x71C6, 0x8247, 0x8A25, 0x9204, 0x82EB, 0x6C76, 0x5D1B, 0x6476, 0x7B4D, 0x8A67, 0x9204, 0x9246,
+  0x9AEA, 0xAB4B, 0xAB2B, 0x9AA8, 0x8A46, 0x8A66, 0x9267, 0x9267, 0x9288, 0x92EA, 0x8AEA, 0x8AA8, 0x8A46, 0x8A25, 0x8A46, 0x82AA,
+  0x7B4E, 0x73D1, 0x7B6E, 0x8AA8, 0x81C5, 0x6985, 0x8A67, 0xBB87, 0xD425, 0xC404, 0xB404, 0x8303, 0x9B63, 0xC3E5, 0xC387, 0x9267,
+  0x71C6, 0x8227, 0x8A26, 0x8A05, 0x7A89, 0x7390, 0x6BF2, 0x7B6E, 0x82A9, 0x8A46, 0x8205, 0x8205, 0x9B0A, 0xC410, 0xC410, 0xA32B,
+  0x8246, 0x7A25, 0x7A04, 0x81E4, 0x82C9, 0x83F0, 0x7C53, 0x83F0, 0x8B2B, 0x8A67, 0x8A25, 0x8A67, 0x82A9, 0x82A9, 0x8268, 0x8A46,
+  0x8A06, 0x8245, 0xB347, 0xDCA7, 0xE4E5, 0xC444, 0xB3E4, 0x82E3, 0xA383, 0xDC85, 0xE4A7, 0xAB47, 0x8245, 0x8A66, 0x9286, 0x8A46,
+  0x8247, 0x7A68, 0x8289, 0x8A88, 0x8A67, 0x8A46, 0x8205, 0x8226, 0xB36D, 0xED16, 0xF577, 0xCC31, 0x9AE9, 0x8A66, 0x81E4, 0x8A04,
+  0x8B4D, 0x8D58, 0x8E5F, 0x8DBB, 0x8C32, 0x8AA9, 0x89E4, 0x8A25, 0x8A67, 0x8A46, 0x8A26, 0x8A46, 0x9AC6, 0xBBA5, 0xE4C6, 0xFDA6,
+  0xE505, 0xBC24, 0xA363, 0x6202, 0x9343, 0xDD05, 0xFDA7, 0xD446, 0xB365, 0xB366, 0xBB86, 0xB367, 0xA2E6, 0x9225, 0x89C4, 0x8A05,
+  0x8A46, 0x8A67, 0x8246, 0x8225, 0xAB4C, 0xED15, 0xFDB9, 0xE4D4, 0xAB6C, 0x8A67, 0x79C4, 0x81E4, 0x8B2C, 0x8CF6, 0x8DFD, 0x8DBB,
+  0x8C52, 0x8AC9, 0x89E4, 0x8A25, 0x8247, 0x8206, 0x8226, 0x9AE7, 0xC3E6, 0xE4A5, 0xFDA6, 0xFE27, 0xE505, 0xABA4, 0x8AC2, 0x3921,
+  0x7282, 0xD4A5, 0xFE07, 0xF566, 0xE4A5, 0xECE6, 0xED06, 0xECE6, 0xD446, 0xB325, 0x9245, 0x8206, 0x8227, 0x8A87, 0x8A66, 0x8225,
+  0x9AE9, 0xD451, 0xED35, 0xDCB3, 0xB38D, 0x8A67, 0x79C4, 0x81E5, 0x8A89, 0x8B4D, 0x8BD0, 0x8BF0, 0x8B6C, 0x8AA8, 0x8A45, 0x8A46,
+  0x8227, 0x79E6, 0x9286, 0xC3E6, 0xED06, 0xF525, 0xFDC6, 0xF5E6, 0xDCC5, 0x8B03, 0x59E1, 0x1060, 0x51C2, 0xC424, 0xFE07, 0xFDE6,
+  0xF565, 0xFD86, 0xFDA6, 0xFDA6, 0xF546, 0xD467, 0xAB67, 0x8A87, 0x7A27, 0x8227, 0x8226, 0x79E5, 0x8A47, 0xA30B, 0xB3AE, 0xB3AE,
+  0xA30B, 0x8A47, 0x79E5, 0x8206, 0x8A26, 0x8206, 0x8206, 0x8247, 0x8247, 0x8247, 0x8226, 0x8227, 0x8227, 0x8A87, 0xB367, 0xE4C6,
+  0xFD86, 0xF565, 0xFDA6, 0xFE07, 0xCC44, 0x6222, 0x28E1, 0x0000, 0x28E0, 0x9B43, 0xF565, 0xFDE6, 0xF585, 0xF545, 0xF525, 0xFD86,
+  0xFDA6, 0xF566, 0xDC86, 0xAB47, 0x8A67, 0x7A07, 0x79E6, 0x79E6, 0x7A06, 0x8227, 0x8A48, 0x8A68, 0x8A88, 0x8A67, 0x8A66, 0x9286,
+  0x9266, 0x8A46, 0x8A05, 0x8205, 0x8206, 0x8206, 0x7A07, 0x7A07, 0x9287, 0xBB86, 0xDC86, 0xF505, 0xF545, 0xF565, 0xFDA6, 0xFDA6,
+  0xB3C4, 0x3941, 0x0020, 0x1060, 0x6202, 0xC404, 0xFD86, 0xFDC7, 0xFD86, 0xF505, 0xF4E5, 0xFD86, 0xFDA6, 0xFD46, 0xD446, 0xB366,
+  0x9AC6, 0x9287, 0x8A67, 0x9266, 0x8A66, 0x9265, 0x92A5, 0xA306, 0xB366, 0xBB87, 0xBBA7, 0xBB86, 0xB366, 0xAB26, 0xA2E6, 0x9AC6,
+  0x9AC6, 0x9AA7, 0x9AC6, 0xBB86, 0xDC86, 0xF526, 0xF525, 0xFD86, 0xFDC7, 0xFDA6, 0xDC85, 0x7AA2, 0x18A0, 0x0000, 0x0000, 0x1880,
+  0x7262, 0xDCA5, 0xFDE7, 0xFDC7, 0xF545, 0xF505, 0xF505, 0xF525, 0xFD66, 0xF546, 0xECC6, 0xD446, 0xC3C6, 0xBB86, 0xBB86, 0xBBA6,
+  0xCBE5, 0xD426, 0xE486, 0xECC6, 0xED06, 0xED06, 0xECE6, 0xECE6, 0xE4A6, 0xDC86, 0xD446, 0xD426, 0xD426, 0xDC66, 0xE485, 0xECE5,
+  0xF545, 0xF545, 0xFDC6, 0xFE07, 0xE4E5, 0x8AE3, 0x28E0, 0x0020, 0x0000, 0x28E1, 0x9303, 0xDCC5, 0xF585, 0xFDC6, 0xFDA6, 0xFD66,
+  0xFD46, 0xFD66, 0xFD86, 0xFD86, 0xFD26, 0xECC6, 0xE4A6, 0xE4A6, 0xECC6, 0xF526, 0xFD46, 0xFD86, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6,
+  0xFD86, 0xFD86, 0xFD66, 0xFD46, 0xF526, 0xF526, 0xFD66, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xE505, 0xA383, 0x3941, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x3121, 0x7282, 0xC444, 0xFDA6, 0xFE07, 0xFDC7, 0xFD86, 0xF525, 0xF525, 0xF525, 0xF525, 0xF505, 0xF525,
+  0xF525, 0xF525, 0xF545, 0xF545, 0xF545, 0xF525, 0xF545, 0xF545, 0xF545, 0xF525, 0xF525, 0xF525, 0xF525, 0xF525, 0xF545, 0xF545,
+  0xFDC6, 0xFDC6, 0xFE07, 0xFDC6, 0xD4A5, 0x8B03, 0x4161, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x20C0, 0x7262, 0xB3E4, 0xDD05,
+  0xED65, 0xFDA6, 0xFD86, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDC6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xF565, 0xE505, 0xC444, 0x8AE3, 0x3941, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x18A0, 0x4181, 0x7AC3, 0xB3E4, 0xE4C5, 0xFD86, 0xFDC6, 0xFDE7, 0xFDE7, 0xFDE7,
+  0xFDE6, 0xFDC6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDC6, 0xFDE7, 0xFDE7, 0xFDE7, 0xFDE6,
+  0xFD86, 0xED25, 0xBC24, 0x8B03, 0x49A1, 0x20C0, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x28E1, 0x6222,
+  0x9323, 0xB3C4, 0xD4A5, 0xDCC5, 0xE505, 0xED45, 0xF565, 0xF545, 0xFD86, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6,
+  0xF565, 0xF565, 0xED45, 0xE505, 0xDCC5, 0xD485, 0xBC04, 0x9B43, 0x6A42, 0x3941, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x1060, 0x20C0, 0x3941, 0x5A02, 0x7AC3, 0x9343, 0xABA4, 0xC424, 0xCC44, 0xDCA5, 0xE4C5, 0xE4C5, 0xE4C5,
+  0xE4C5, 0xE4C5, 0xE4C5, 0xE4C5, 0xD485, 0xC444, 0xB3C4, 0x9B63, 0x7AC3, 0x6222, 0x4181, 0x28E1, 0x18A0, 0x0020, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x20C0, 0x3941, 0x51C2, 0x6222, 0x7262, 0x7AA3, 0x82C3, 0x82C3, 0x82A3,
+  0x82A3, 0x82C3, 0x82C3, 0x82C2, 0x7262, 0x6202, 0x51A2, 0x4161, 0x28E1, 0x0840, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0840, 0x0840, 0x1060, 0x1060, 0x18A0, 0x18A0, 0x18A0, 0x18A0, 0x18A0, 0x18A0, 0x18A0, 0x18A0, 0x18A0,
+  0x1060, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DONUT_44_SPANS = {
+  SPRITE_DONUT_44_SPAN_ROWS, SPRITE_DONUT_44_SPAN_OPS, SPRITE_DONUT_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DONUT_44_ASSET = {
   SPRITE_DONUT_44_WIDTH, SPRITE_DONUT_44_HEIGHT,
-  SPRITE_DONUT_44_ALPHA, SPRITE_DONUT_44_RGB565
+  nullptr, nullptr, &SPRITE_DONUT_44_SPANS
 };
 
 #endif // SPRITE_DONUT_44_INCLUDED
@@ -5,66 +5,66 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from droplet_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from droplet_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 274/484 pixels visibles, 1010 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_DROPLET_22_WIDTH = 22;
 constexpr uint16_t SPRITE_DROPLET_22_HEIGHT = 22;
 
-const uint16_t SPRITE_DROPLET_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x5DDC, 0x65DE, 0x07FF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x5D7D, 0x5D5D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0xFFFF, 0x653D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x5D5D, 0x65BF, 0x5D9E, 0x5D7D, 0x555C, 0x7FFF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x5D7D, 0x5D9E, 0x5D7D, 0x5D5D, 0x65DF, 0x5D5D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x5D5D, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x5D7D, 0x0000, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x5D7D, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D5D, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x7FFF, 0x6DBB, 0x5D7D, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D7D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x5D5D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x5D7D, 0x5D1D, 0x7BFF, 0x03FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7BFF, 0x07FF, 0x655E, 0x5D7D, 0x5D9E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D5D, 0x0000, 0x555F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x5D5D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x5D5D, 0x0000, 0x7FFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7FFF, 0x0000, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x7BFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3DFF, 0x0000, 0x5D7D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D3D, 0x0000, 0x7BFF, 0x0000,
-  0x0000, 0x0000, 0x555F, 0x0000, 0x5D7D, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D7D, 0x0000, 0x3BF7, 0x0000,
-  0x0000, 0x0000, 0x07FF, 0x0000, 0x5D7D, 0x65BE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x3BF7, 0x0000,
-  0x0000, 0x0000, 0x555F, 0x0000, 0x5D7D, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D7D, 0x0000, 0x555F, 0x0000,
-  0x0000, 0x0000, 0x3DF7, 0x0000, 0x5D7D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x653D, 0x0000, 0x07FF, 0x0000,
-  0x0000, 0x0000, 0x7BFF, 0x0000, 0x5D7D, 0x5D7D, 0x5D9D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x7FFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x659E, 0x5D9E, 0x5D7D, 0x07FF, 0x7BFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x5D7D, 0x65DF, 0x65BE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D9E, 0x5D5D, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x5D7D, 0x659E, 0x5D7D, 0x65BE, 0x65BF, 0x65BE, 0x5D9E, 0x5D9E, 0x553B, 0x0000, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x3BF7, 0x657E, 0x5D5D, 0x5D9E, 0x5D7D, 0x65BE, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_DROPLET_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 9, 6, 20, 10, 33, 17, 47, 25, 63, 33, 80, 42, 99, 52,
+  117, 65, 135, 79, 153, 94, 172, 109, 191, 125, 210, 142, 228, 159, 246, 176,
+  264, 193, 283, 210, 302, 226, 323, 242, 342, 255, 359, 266
 };
 
-const uint8_t SPRITE_DROPLET_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0B, 0x12, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7C, 0xB2, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x17, 0xEC, 0xFF, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x96, 0xFF, 0xFD, 0xD8, 0x09, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2F, 0xFA, 0xFD, 0xFB, 0xFF, 0x7E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xB8, 0xFF, 0xFC, 0xFE, 0xFD, 0xF6, 0x26, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4D, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xB6, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0xD5, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x54, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x71, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE1, 0x0E, 0x02, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x01, 0x15, 0xEA, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x8D, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x94, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFA, 0x31, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x29, 0xFA, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xB6, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x82, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFA, 0x23, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0xB5, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x50, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0xC6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x5A, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0xB3, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x4D, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x7B, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF7, 0x1D, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x1F, 0xF6, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xAA, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x78, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xF0, 0x22, 0x01, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFD, 0xFF, 0xFF, 0xED, 0x43, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5A, 0xCF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF0, 0xA5, 0x26, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x3D, 0x68, 0x6C, 0x5C, 0x22, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_DROPLET_22_SPAN_OPS[] PROGMEM = {
+  0x07, 0x85, 0x01, 0x01, 0x0B, 0x12, 0x01, 0x01, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x81, 0x7C, 0xB2, 0x00, 0x80, 0x03, 0xC0, 0x06, 0x83, 0x02, 0x01,
+  0x17, 0xEC, 0x40, 0x80, 0x46, 0x00, 0x80, 0x03, 0xC0, 0x06, 0x80, 0x03, 0x00, 0x80, 0x96, 0x40, 0x84, 0xFD, 0xD8, 0x09, 0x02, 0x01, 0xC0, 0x05,
+  0x80, 0x02, 0x00, 0x83, 0x2F, 0xFA, 0xFD, 0xFB, 0x40, 0x80, 0x7E, 0x00, 0x80, 0x03, 0xC0, 0x05, 0x80, 0x02, 0x00, 0x80, 0xB8, 0x40, 0x84, 0xFC,
+  0xFE, 0xFD, 0xF6, 0x26, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x03, 0x00, 0x80, 0x4D, 0x40, 0x80, 0xFC, 0x41, 0x80, 0xFC, 0x40, 0x80, 0xB6, 0x00,
+  0x80, 0x03, 0xC0, 0x03, 0x85, 0x01, 0x02, 0x07, 0xD5, 0xFE, 0xFD, 0x42, 0x80, 0xFC, 0x40, 0x80, 0x54, 0x00, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x04,
+  0x00, 0x80, 0x71, 0x40, 0x80, 0xFC, 0x43, 0x85, 0xFD, 0xFE, 0xE1, 0x0E, 0x02, 0x02, 0xC0, 0x02, 0x85, 0x02, 0x01, 0x15, 0xEA, 0xFD, 0xFD, 0x44,
+  0x80, 0xFB, 0x40, 0x80, 0x8D, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x80, 0x94, 0x40, 0x80, 0xFB, 0x45, 0x83, 0xFE, 0xFC, 0xFA, 0x31,
+  0x00, 0x80, 0x02, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x83, 0x29, 0xFA, 0xFD, 0xFE, 0x46, 0x80, 0xFC, 0x40, 0x80, 0xB6, 0x00, 0x80, 0x02, 0xC0, 0x01,
+  0x80, 0x04, 0x00, 0x80, 0x82, 0x40, 0x80, 0xFB, 0x47, 0x83, 0xFE, 0xFE, 0xFA, 0x23, 0x00, 0x80, 0x02, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82, 0xB5,
+  0xFE, 0xFC, 0x48, 0x80, 0xFC, 0x40, 0x80, 0x50, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x80, 0xC6, 0x40, 0x80, 0xFC, 0x48, 0x82, 0xFB,
+  0xFE, 0x5A, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82, 0xB3, 0xFE, 0xFC, 0x48, 0x80, 0xFC, 0x40, 0x80, 0x4D, 0x00, 0x80, 0x03, 0xC0,
+  0x01, 0x80, 0x04, 0x00, 0x80, 0x7B, 0x40, 0x80, 0xFB, 0x47, 0x83, 0xFE, 0xFE, 0xF7, 0x1D, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x83,
+  0x1F, 0xF6, 0xFC, 0xFE, 0x46, 0x80, 0xFA, 0x40, 0x80, 0xAA, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x80, 0x78, 0x40, 0x81, 0xFA, 0xFD,
+  0x43, 0x81, 0xFE, 0xFA, 0x40, 0x83, 0xF0, 0x22, 0x01, 0x02, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x80, 0x92, 0x42, 0x82, 0xFC, 0xFC, 0xFD, 0x41, 0x81,
+  0xED, 0x43, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x02, 0x00, 0x82, 0x5A, 0xCF, 0xFE, 0x42, 0x82, 0xF0, 0xA5, 0x26, 0x00, 0x80, 0x02, 0xC0, 0x05,
+  0x80, 0x02, 0x00, 0x85, 0x04, 0x3D, 0x68, 0x6C, 0x5C, 0x22, 0x01, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_DROPLET_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x0041, 0x0000, 0x0000, 0x0000, 0x2AAE, 0x3B93, 0x0000, 0x0000, 0x0000, 0x0862, 0x551B, 0x65DF, 0x1988,
+  0x0000, 0x0000, 0x3311, 0x65BF, 0x5D9E, 0x4C98, 0x0020, 0x0000, 0x0000, 0x0000, 0x1105, 0x555D, 0x5D7D, 0x551C, 0x65DF, 0x2AAE,
+  0x0000, 0x0000, 0x3BD4, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x555D, 0x08C4, 0x0000, 0x0000, 0x19A9, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D,
+  0x5D7D, 0x65BF, 0x3BD4, 0x0000, 0x0000, 0x0000, 0x0020, 0x4C98, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x19C9,
+  0x0000, 0x0000, 0x224C, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x4CB9, 0x0041, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0862, 0x4CDA, 0x5D9E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x65DF, 0x32F0, 0x0000, 0x0000, 0x3311,
+  0x65DF, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x555D, 0x10E5, 0x0000, 0x0000, 0x08C4, 0x553C,
+  0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x3BD4, 0x0000, 0x0020, 0x2AAE, 0x65DF,
+  0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x08A3, 0x0000, 0x0000, 0x3BD4,
+  0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x19A9, 0x0000, 0x0000,
+  0x4436, 0x65BE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x65DF, 0x19C9, 0x0000,
+  0x0000, 0x3BB3, 0x65BF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x19A9,
+  0x0000, 0x0020, 0x2A8D, 0x65DF, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C,
+  0x08A3, 0x0000, 0x0000, 0x08A3, 0x553C, 0x5D9D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x65DF,
+  0x3B93, 0x0000, 0x0000, 0x2A8D, 0x65FF, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x659E, 0x553C, 0x08A3,
+  0x0000, 0x0000, 0x0000, 0x3310, 0x65DF, 0x65BE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x553C, 0x1147, 0x0000, 0x0000,
+  0x19C9, 0x4C78, 0x5D7D, 0x65BE, 0x65BF, 0x65BE, 0x553C, 0x3B93, 0x08C4, 0x0000, 0x0000, 0x0000, 0x1947, 0x222B, 0x226D, 0x220A,
+  0x08A3, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_DROPLET_22_SPANS = {
+  SPRITE_DROPLET_22_SPAN_ROWS, SPRITE_DROPLET_22_SPAN_OPS, SPRITE_DROPLET_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_DROPLET_22_ASSET = {
   SPRITE_DROPLET_22_WIDTH, SPRITE_DROPLET_22_HEIGHT,
-  SPRITE_DROPLET_22_ALPHA, SPRITE_DROPLET_22_RGB565
+  nullptr, nullptr, &SPRITE_DROPLET_22_SPANS
 };
 
 #endif // SPRITE_DROPLET_22_INCLUDED
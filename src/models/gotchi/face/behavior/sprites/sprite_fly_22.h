@@ -5,66 +5,78 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from fly_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from fly_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 376/484 pixels visibles, 1346 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_FLY_22_WIDTH = 22;
 constexpr uint16_t SPRITE_FLY_22_HEIGHT = 22;
 
-const uint16_t SPRITE_FLY_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x31A7, 0x31A7, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x2987, 0x31A7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x39E7, 0x0000, 0x31A7, 0x31E8, 0x31A7, 0x0000, 0x03EF, 0x0000, 0x0000, 0x31A7, 0x31C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x29A7, 0x31C8, 0x31A7, 0x0000, 0x39E7, 0x0000,
-  0x0000, 0x0000, 0x7BEF, 0x0000, 0x31C7, 0x31C7, 0x31A7, 0xF800, 0xC0A5, 0x7947, 0x29A7, 0x29C7, 0x7147, 0xC0C6, 0xF80F, 0x2967, 0x31A7, 0x31C7, 0x39E7, 0x7BEF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x03EF, 0x0000, 0x29C7, 0x31C7, 0x09E7, 0xF803, 0xB8E6, 0x39A7, 0x29C7, 0x31C7, 0x39C8, 0xB0E6, 0xF805, 0x01E7, 0x31A7, 0x29A7, 0x0000, 0x52AA, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x03EF, 0x0000, 0x31C7, 0x31C7, 0x11A8, 0xF800, 0x9106, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x8906, 0xF800, 0x0228, 0x31A7, 0x31A7, 0x0000, 0x52AA, 0x0000, 0x0000,
-  0x0000, 0x000F, 0x2AAA, 0x39E7, 0x31A7, 0x31E8, 0x31C8, 0x11E7, 0x29C7, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x29C7, 0x19E7, 0x31C7, 0x31E8, 0x29A7, 0x39E7, 0x52AA, 0x03EF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2986, 0x2987, 0x31C7, 0x31C7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C7, 0x31A7, 0x2987, 0x29A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x31A7, 0x31C8, 0x31C7, 0x2146, 0x634E, 0x8C72, 0x5B0C, 0x2986, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x2987, 0x52EC, 0x7C10, 0x424A, 0x2966, 0x31C7, 0x31C8, 0x29A7, 0x0000,
-  0x0000, 0x31A7, 0x31E8, 0x2987, 0x52CC, 0x8C92, 0x94D3, 0x7BF0, 0x29A7, 0x29A7, 0x31C7, 0x31C7, 0x31A7, 0x2987, 0x73F0, 0x94F4, 0x8431, 0x4249, 0x2986, 0x31C8, 0x31A7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF7DF, 0xE75D, 0xD6DB, 0xADB7, 0x94F4, 0x6B6E, 0x31C7, 0x2987, 0x2987, 0x31C7, 0x636E, 0x94F4, 0xAD97, 0xD6DC, 0xE75D, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x7BFF, 0x0000, 0xDF3D, 0xE73D, 0xE75D, 0xE75E, 0xEF9F, 0xE75E, 0x9D14, 0x8451, 0x6B8F, 0x6B8F, 0x8451, 0x9D14, 0xE75D, 0xEFBF, 0xE75E, 0xE73D, 0xDF3D, 0xDEFF, 0x7BEF, 0x0000,
-  0xFFFF, 0x7BEF, 0xE75D, 0xDF3D, 0xDF3D, 0xDF1D, 0xE75E, 0xC65A, 0x8C92, 0x94B3, 0x73CF, 0x7C31, 0x8CB3, 0x8C92, 0xC639, 0xE77E, 0xDF1D, 0xE73D, 0xE73D, 0xE73D, 0x0000, 0xFFFF,
-  0x0000, 0xE71D, 0xE73D, 0xE73D, 0xE73D, 0xDF3D, 0xEF9E, 0x9CF4, 0x8C92, 0x8CB3, 0x4249, 0x5B0D, 0x94D3, 0x8C92, 0x94F4, 0xEF7E, 0xDF3D, 0xE73D, 0xE73D, 0xDF3D, 0xFFFF, 0x0000,
-  0x0000, 0xDF3D, 0xE73D, 0xE73D, 0xE73D, 0xE75E, 0xD6DB, 0x8C72, 0x94B3, 0x73AF, 0x2987, 0x39E8, 0x8451, 0x8C93, 0x8C72, 0xD6DB, 0xE75E, 0xE73D, 0xE73D, 0xE73D, 0xE73E, 0x0000,
-  0x0000, 0xDF3D, 0xE73D, 0xE73D, 0xDF3D, 0xEF7E, 0xBE18, 0x94B3, 0x7C31, 0x39E8, 0x31A7, 0x2987, 0x426A, 0x8C92, 0x8CB3, 0xB5D8, 0xEF9F, 0xDF3D, 0xE75D, 0xE73D, 0xE75D, 0x0000,
-  0x0000, 0xDF3D, 0xE73D, 0xE73D, 0xDF1D, 0xEF7E, 0x9D35, 0x7C10, 0x3A08, 0x29A7, 0x31C7, 0x31C7, 0x2987, 0x4A6A, 0x8472, 0x9D35, 0xE77E, 0xE73D, 0xE73D, 0xE73D, 0xDEFB, 0x0000,
-  0xFFFF, 0x0000, 0xE73D, 0xDF3D, 0xEF9E, 0xB5B7, 0x5B0D, 0x31C7, 0x29A7, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x2987, 0x3A08, 0x6B6E, 0xB5D7, 0xEF7E, 0xDF3D, 0xDF3D, 0x0000, 0xFFFF,
-  0x0000, 0x0000, 0x0000, 0xAD55, 0xFFFF, 0x31A7, 0x2986, 0x31A7, 0x31C8, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C8, 0x2987, 0x2986, 0x31E8, 0xFFFF, 0x6C92, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7BEF, 0x0000, 0x2986, 0x31E8, 0x39E8, 0x31A7, 0x31E8, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31E8, 0x31C7, 0x39E8, 0x31E8, 0x2987, 0x0000, 0x7BEF, 0x0000, 0x0000,
-  0x0000, 0x7BEF, 0x0000, 0x31A7, 0x31E8, 0x31C7, 0x0000, 0x02AA, 0x31A7, 0x31E8, 0x31C8, 0x31C8, 0x31E8, 0x31A7, 0x3186, 0x0000, 0x31A7, 0x39E8, 0x31A7, 0x0000, 0x7BEF, 0x0000,
-  0x7BEF, 0x0000, 0x31A7, 0x31E8, 0x31A7, 0x0000, 0x52AA, 0x0000, 0x0000, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x03EF, 0x0000, 0x39E7, 0x0000, 0x31A7, 0x31E8, 0x31C7, 0x0000, 0x52AA,
-  0x0000, 0x0000, 0x3187, 0x31A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31C7, 0x29A7, 0x0000, 0x0000
+const uint16_t SPRITE_FLY_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 27, 10, 56, 22, 79, 40, 99, 56, 121, 73, 148, 93, 162, 105,
+  185, 125, 204, 145, 222, 161, 247, 182, 272, 203, 297, 223, 316, 243, 339, 263,
+  360, 283, 378, 303, 397, 319, 424, 335, 451, 351, 483, 367
 };
 
-const uint8_t SPRITE_FLY_22_ALPHA[] PROGMEM = {
-  0x00, 0x02, 0x00, 0x3E, 0x44, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x3C, 0x42, 0x00, 0x02, 0x00,
-  0x00, 0x04, 0x00, 0x80, 0xFF, 0x4F, 0x00, 0x02, 0x00, 0x00, 0x18, 0x1A, 0x00, 0x00, 0x02, 0x00, 0x41, 0xFF, 0x8D, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x9E, 0xFC, 0x18, 0x01, 0x95, 0xD4, 0xED, 0xEF, 0xD4, 0x94, 0x02, 0x10, 0xF5, 0xB0, 0x04, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x2C, 0xFF, 0x20, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0x14, 0xFE, 0x40, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x3A, 0xFD, 0x17, 0x03, 0xD1, 0xFD, 0xFC, 0xFC, 0xFD, 0xD1, 0x04, 0x0B, 0xF9, 0x4F, 0x01, 0x03, 0x00, 0x00,
-  0x00, 0x02, 0x06, 0x04, 0x2E, 0xFF, 0x77, 0x0C, 0xDE, 0xFF, 0xFD, 0xFD, 0xFF, 0xE1, 0x11, 0x74, 0xFF, 0x3C, 0x04, 0x06, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xFD, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCD, 0xFE, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x45, 0x7A, 0x79, 0x64, 0x43, 0xB4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xA9, 0x3D, 0x66, 0x79, 0x7A, 0x4B, 0x00,
-  0x00, 0x8C, 0xE8, 0xE2, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xFB, 0xE1, 0xE8, 0x93, 0x00,
-  0x00, 0x00, 0x00, 0x33, 0x87, 0x8C, 0xAB, 0xE5, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0xB0, 0x8F, 0x7D, 0x17, 0x00, 0x00, 0x00,
-  0x02, 0x01, 0x1F, 0x84, 0x7F, 0x7C, 0x78, 0x7C, 0xDE, 0xFF, 0xFE, 0xFE, 0xFF, 0xE2, 0x7E, 0x77, 0x7B, 0x85, 0x71, 0x08, 0x02, 0x00,
-  0x01, 0x02, 0x65, 0x87, 0x7F, 0x82, 0x7D, 0x99, 0xF6, 0xFE, 0xFF, 0xFF, 0xFE, 0xF8, 0x9D, 0x7C, 0x82, 0x7E, 0x8A, 0x43, 0x00, 0x02,
-  0x00, 0x1B, 0x84, 0x7F, 0x80, 0x81, 0x7A, 0xD9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xDE, 0x7B, 0x81, 0x7F, 0x83, 0x71, 0x05, 0x00,
-  0x00, 0x37, 0x89, 0x7E, 0x80, 0x7E, 0x8A, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x8C, 0x7D, 0x80, 0x80, 0x81, 0x15, 0x00,
-  0x00, 0x3C, 0x89, 0x7D, 0x81, 0x79, 0xA2, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xA7, 0x78, 0x81, 0x7E, 0x84, 0x19, 0x00,
-  0x00, 0x1F, 0x88, 0x83, 0x83, 0x7E, 0xDB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xDE, 0x7E, 0x81, 0x88, 0x76, 0x08, 0x00,
-  0x01, 0x00, 0x3D, 0x7B, 0x73, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x74, 0x73, 0x26, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x0C, 0x03, 0xC5, 0xC9, 0xC8, 0xFD, 0xFD, 0xFF, 0xFF, 0xFD, 0xFD, 0xCE, 0xC4, 0xCF, 0x04, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x58, 0xFF, 0x31, 0x53, 0xFF, 0xF9, 0xFC, 0xFC, 0xF9, 0xFF, 0x5F, 0x28, 0xFF, 0x68, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x57, 0xFF, 0x83, 0x00, 0x03, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x05, 0x00, 0x82, 0xFF, 0x66, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x35, 0xFF, 0x82, 0x00, 0x03, 0x01, 0x00, 0x6A, 0xBB, 0xBC, 0x6E, 0x02, 0x00, 0x04, 0x00, 0x80, 0xFF, 0x3E, 0x00, 0x03,
-  0x01, 0x00, 0x1E, 0x57, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x55, 0x20, 0x00, 0x01
+const uint8_t SPRITE_FLY_22_SPAN_OPS[] PROGMEM = {
+  0x00, 0x80, 0x02, 0x00, 0x81, 0x3E, 0x44, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02, 0x03, 0x80, 0x02, 0x00, 0x80, 0x01, 0x00, 0x81, 0x3C, 0x42, 0x00,
+  0x80, 0x02, 0xC0, 0x00, 0x80, 0x04, 0x00, 0x80, 0x80, 0x40, 0x80, 0x4F, 0x00, 0x80, 0x02, 0x01, 0x81, 0x18, 0x1A, 0x01, 0x80, 0x02, 0x00, 0x80,
+  0x41, 0x40, 0x80, 0x8D, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x90, 0x9E, 0xFC, 0x18, 0x01, 0x95, 0xD4, 0xED, 0xEF, 0xD4, 0x94, 0x02,
+  0x10, 0xF5, 0xB0, 0x04, 0x02, 0x01, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x80, 0x2C, 0x40, 0x81, 0x20, 0x10, 0x45, 0x83, 0x13, 0x14, 0xFE, 0x40, 0x00,
+  0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x8F, 0x3A, 0xFD, 0x17, 0x03, 0xD1, 0xFD, 0xFC, 0xFC, 0xFD, 0xD1, 0x04, 0x0B, 0xF9, 0x4F, 0x01, 0x03,
+  0xC0, 0x00, 0x83, 0x02, 0x06, 0x04, 0x2E, 0x40, 0x82, 0x77, 0x0C, 0xDE, 0x40, 0x81, 0xFD, 0xFD, 0x40, 0x82, 0xE1, 0x11, 0x74, 0x40, 0x83, 0x3C,
+  0x04, 0x06, 0x02, 0xC0, 0x04, 0x82, 0x69, 0xFD, 0xC8, 0x43, 0x80, 0xFE, 0x40, 0x82, 0xCD, 0xFE, 0x6B, 0xC0, 0x00, 0x85, 0x45, 0x7A, 0x79, 0x64,
+  0x43, 0xB4, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFC, 0x40, 0x85, 0xA9, 0x3D, 0x66, 0x79, 0x7A, 0x4B, 0xC0, 0x00, 0x82, 0x8C, 0xE8, 0xE2, 0x41, 0x80,
+  0xFC, 0x46, 0x81, 0xFE, 0xFA, 0x40, 0x83, 0xFB, 0xE1, 0xE8, 0x93, 0xC0, 0x02, 0x84, 0x33, 0x87, 0x8C, 0xAB, 0xE5, 0x40, 0x80, 0xFE, 0x43, 0x84,
+  0xE8, 0xB0, 0x8F, 0x7D, 0x17, 0xC0, 0x88, 0x02, 0x01, 0x1F, 0x84, 0x7F, 0x7C, 0x78, 0x7C, 0xDE, 0x40, 0x81, 0xFE, 0xFE, 0x40, 0x87, 0xE2, 0x7E,
+  0x77, 0x7B, 0x85, 0x71, 0x08, 0x02, 0xC0, 0x89, 0x01, 0x02, 0x65, 0x87, 0x7F, 0x82, 0x7D, 0x99, 0xF6, 0xFE, 0x41, 0x87, 0xFE, 0xF8, 0x9D, 0x7C,
+  0x82, 0x7E, 0x8A, 0x43, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x86, 0x1B, 0x84, 0x7F, 0x80, 0x81, 0x7A, 0xD9, 0x40, 0x80, 0xFD, 0x41, 0x80, 0xFD, 0x40,
+  0x86, 0xDE, 0x7B, 0x81, 0x7F, 0x83, 0x71, 0x05, 0xC0, 0x00, 0x86, 0x37, 0x89, 0x7E, 0x80, 0x7E, 0x8A, 0xF8, 0x45, 0x86, 0xFA, 0x8C, 0x7D, 0x80,
+  0x80, 0x81, 0x15, 0xC0, 0x00, 0x85, 0x3C, 0x89, 0x7D, 0x81, 0x79, 0xA2, 0x40, 0x80, 0xFE, 0x43, 0x80, 0xFE, 0x40, 0x85, 0xA7, 0x78, 0x81, 0x7E,
+  0x84, 0x19, 0xC0, 0x00, 0x87, 0x1F, 0x88, 0x83, 0x83, 0x7E, 0xDB, 0xFE, 0xFD, 0x43, 0x87, 0xFE, 0xFE, 0xDE, 0x7E, 0x81, 0x88, 0x76, 0x08, 0xC0,
+  0x80, 0x01, 0x00, 0x83, 0x3D, 0x7B, 0x73, 0x95, 0x49, 0x83, 0x9C, 0x74, 0x73, 0x26, 0x00, 0x80, 0x01, 0xC0, 0x02, 0x86, 0x0C, 0x03, 0xC5, 0xC9,
+  0xC8, 0xFD, 0xFD, 0x41, 0x86, 0xFD, 0xFD, 0xCE, 0xC4, 0xCF, 0x04, 0x07, 0xC0, 0x01, 0x80, 0x04, 0x00, 0x80, 0x58, 0x40, 0x81, 0x31, 0x53, 0x40,
+  0x83, 0xF9, 0xFC, 0xFC, 0xF9, 0x40, 0x81, 0x5F, 0x28, 0x40, 0x80, 0x68, 0x00, 0x80, 0x04, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x80, 0x57, 0x40, 0x80,
+  0x83, 0x00, 0x81, 0x03, 0xA6, 0x43, 0x81, 0xB0, 0x05, 0x00, 0x80, 0x82, 0x40, 0x80, 0x66, 0x00, 0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x80, 0x35,
+  0x40, 0x80, 0x82, 0x00, 0x81, 0x03, 0x01, 0x00, 0x84, 0x6A, 0xBB, 0xBC, 0x6E, 0x02, 0x00, 0x80, 0x04, 0x00, 0x80, 0x80, 0x40, 0x80, 0x3E, 0x00,
+  0x80, 0x03, 0xC0, 0x80, 0x01, 0x00, 0x81, 0x1E, 0x57, 0x00, 0x80, 0x02, 0x07, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x81, 0x55, 0x20, 0x00, 0x80,
+  0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_FLY_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0861, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x0000, 0x0000, 0x18C3, 0x31E8, 0x0882, 0x0000, 0x0020,
+  0x0020, 0x0000, 0x0861, 0x31C8, 0x18E3, 0x0000, 0x0000, 0x1904, 0x31C7, 0x0020, 0x0000, 0x7042, 0x6105, 0x2186, 0x21A6, 0x5905,
+  0x7063, 0x0000, 0x0000, 0x2986, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x31C7, 0x0020, 0x0800, 0xB8E6, 0x39A7, 0x29C7,
+  0x31C7, 0x39C8, 0xB0E6, 0x0800, 0x0020, 0x31A7, 0x0861, 0x0000, 0x0000, 0x0861, 0x31C7, 0x0020, 0x0000, 0x70C4, 0x31C7, 0x31A7,
+  0x31A7, 0x31C7, 0x68C4, 0x0000, 0x0000, 0x2986, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x31E8, 0x10C3, 0x0000,
+  0x2186, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x2186, 0x0000, 0x10C3, 0x31E8, 0x0861, 0x0000, 0x0000, 0x0000, 0x1082, 0x2987, 0x2145,
+  0x31C7, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C7, 0x2145, 0x2987, 0x10A2, 0x0861, 0x10C3, 0x10C3, 0x0882, 0x18C3, 0x632C, 0x5B0C,
+  0x2986, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x2987, 0x52EC, 0x4AAA, 0x1082, 0x1082, 0x10C3, 0x10C3, 0x0861, 0x18E3, 0x29A7, 0x2146,
+  0x52CC, 0x8C92, 0x94D3, 0x7BF0, 0x29A7, 0x29A7, 0x31C7, 0x31C7, 0x31A7, 0x2987, 0x73F0, 0x8CB3, 0x8431, 0x3A28, 0x2145, 0x2987,
+  0x18E3, 0x2965, 0x73CF, 0x73CF, 0x6BAF, 0x8472, 0x6B6E, 0x31C7, 0x2987, 0x2987, 0x31C7, 0x636E, 0x8472, 0x73CF, 0x73CF, 0x73AE,
+  0x10A2, 0x0000, 0x0000, 0x18E3, 0x73CF, 0x73AE, 0x73AF, 0x6B8E, 0x73AF, 0x8471, 0x8451, 0x6B8F, 0x6B8F, 0x8451, 0x8471, 0x73AE,
+  0x6B8E, 0x6B6E, 0x73CF, 0x5B0C, 0x0020, 0x0000, 0x0000, 0x0000, 0x5AEB, 0x73CF, 0x6B8E, 0x6B8E, 0x73AF, 0x73AF, 0x8451, 0x94B3,
+  0x73CF, 0x7C31, 0x8CB3, 0x8451, 0x7BCF, 0x73AF, 0x6B8E, 0x738E, 0x73CF, 0x39C7, 0x0000, 0x10A2, 0x73CF, 0x738E, 0x738E, 0x6B8E,
+  0x6B8E, 0x8410, 0x8C92, 0x8CB3, 0x4249, 0x5B0D, 0x94D3, 0x8C92, 0x7C51, 0x6B6E, 0x6B8E, 0x738E, 0x738E, 0x5B0C, 0x0020, 0x2986,
+  0x73CF, 0x738E, 0x738E, 0x73AF, 0x6B8E, 0x8431, 0x94B3, 0x73AF, 0x2987, 0x39E8, 0x8451, 0x8C93, 0x8431, 0x73CF, 0x73AF, 0x738E,
+  0x738E, 0x738E, 0x10A2, 0x31C7, 0x73CF, 0x738E, 0x6B8E, 0x6B6E, 0x73CF, 0x94B3, 0x7C31, 0x39E8, 0x31A7, 0x2987, 0x426A, 0x8C92,
+  0x8CB3, 0x73CF, 0x6B8E, 0x6B8E, 0x73AE, 0x73CF, 0x10A2, 0x18E3, 0x73CF, 0x738E, 0x6B8E, 0x73AF, 0x8451, 0x7C10, 0x3A08, 0x29A7,
+  0x31C7, 0x31C7, 0x2987, 0x4A6A, 0x8472, 0x8472, 0x73AF, 0x738E, 0x73CF, 0x6B4D, 0x0020, 0x0000, 0x39C7, 0x634D, 0x634D, 0x6B4D,
+  0x5B0D, 0x31C7, 0x29A7, 0x31C7, 0x31A7, 0x31A7, 0x31C7, 0x2987, 0x3A08, 0x6B6E, 0x6B8E, 0x6B6E, 0x5B0C, 0x2104, 0x0000, 0x0841,
+  0x0000, 0x2145, 0x1924, 0x2145, 0x31C8, 0x31A7, 0x31A7, 0x31A7, 0x31A7, 0x31C8, 0x2125, 0x1924, 0x2186, 0x0020, 0x0020, 0x0000,
+  0x0882, 0x31E8, 0x0841, 0x0882, 0x31E8, 0x2986, 0x31A7, 0x31A7, 0x2986, 0x31E8, 0x10A2, 0x0841, 0x31E8, 0x1082, 0x0000, 0x0000,
+  0x1082, 0x31E8, 0x18E3, 0x0000, 0x1904, 0x31E8, 0x31C8, 0x31C8, 0x31E8, 0x2104, 0x0000, 0x18C3, 0x39E8, 0x10A2, 0x0000, 0x0000,
+  0x0841, 0x31E8, 0x18C3, 0x0000, 0x0000, 0x10A2, 0x2125, 0x2125, 0x10A3, 0x0000, 0x0000, 0x18C3, 0x31E8, 0x0861, 0x0000, 0x0000,
+  0x0020, 0x1082, 0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_FLY_22_SPANS = {
+  SPRITE_FLY_22_SPAN_ROWS, SPRITE_FLY_22_SPAN_OPS, SPRITE_FLY_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_FLY_22_ASSET = {
   SPRITE_FLY_22_WIDTH, SPRITE_FLY_22_HEIGHT,
-  SPRITE_FLY_22_ALPHA, SPRITE_FLY_22_RGB565
+  nullptr, nullptr, &SPRITE_FLY_22_SPANS
 };
 
 #endif // SPRITE_FLY_22_INCLUDED
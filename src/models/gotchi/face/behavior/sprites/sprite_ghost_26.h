@@ -5,74 +5,90 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from ghost_26.png (26x26)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from ghost_26.png (26x26) — RGBA multi-couleur, encodé en spans
+// 546/676 pixels visibles, 1714 bytes flash (flat : 2028). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_GHOST_26_WIDTH = 26;
 constexpr uint16_t SPRITE_GHOST_26_HEIGHT = 26;
 
-const uint16_t SPRITE_GHOST_26_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0x0000, 0xE73C, 0xE75E, 0xE75D, 0xE75D, 0xE75E, 0xE73C, 0x0000, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD5F, 0x0000, 0xD71C, 0xE77E, 0xE77E, 0xE75D, 0xEF9E, 0xEF9E, 0xE75D, 0xE77E, 0xE77E, 0xD71C, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0xDF1D, 0xE77E, 0xF7DF, 0xE77E, 0xE75D, 0xE73D, 0xE73D, 0xE75D, 0xE77E, 0xF7DF, 0xEF9E, 0xDF3D, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xDF1D, 0xE77E, 0xEF9E, 0xE73D, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xDF3D, 0xEF9E, 0xE77E, 0xE75D, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xCE7F, 0xE73D, 0xEFBF, 0xDF3D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xE77E, 0xEF9F, 0xE77E, 0xEF9F, 0xDF3D, 0xCE7F, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xAD55,
-  0x0000, 0x0000, 0x0000, 0xBDF7, 0x0000, 0xE73D, 0xEFBF, 0xE73D, 0xDF3D, 0xDF3D, 0xDF3D, 0xE75D, 0xE75D, 0xE73D, 0xEF9E, 0xCEBB, 0xB5D7, 0xC65A, 0xEF7E, 0xF7BF, 0xDF3D, 0x0000, 0xBDF7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xE73D, 0xEFBF, 0xE75D, 0xEF9E, 0xEF9E, 0xEF7E, 0xE75D, 0xDF3D, 0xEF9E, 0x9D14, 0x29A7, 0x1925, 0x2166, 0x7C10, 0xF7DF, 0xE73D, 0x0000, 0xFFFF, 0xE75D, 0xEFBF, 0xE75D,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xE75D, 0xE77E, 0xE75D, 0x8C92, 0x4A6A, 0xA576, 0xE77E, 0xE77E, 0xCE9A, 0x2986, 0x2125, 0x39E8, 0x2966, 0x18E4, 0xADB7, 0xEF9F, 0x3BEF, 0xFFFF, 0xE73D, 0xFFFF, 0xE75D,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0xD7FF, 0xDF3D, 0xEF9E, 0xCEBB, 0x2145, 0x10C3, 0x4229, 0xE75E, 0xEF9F, 0xAD96, 0x1904, 0x638F, 0x9D77, 0x7C52, 0x1904, 0x8472, 0xF7DF, 0x9CD3, 0xE71E, 0xE73D, 0xE75D, 0xE75D,
-  0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xDFFF, 0xE73D, 0xE77E, 0xDF3D, 0x5B0C, 0x1925, 0x7C10, 0xE77E, 0xEF7E, 0xBE18, 0x1904, 0x8CF4, 0xADF8, 0xA597, 0x2145, 0x94F4, 0xEFBF, 0x0000, 0xE73D, 0xEFBF, 0xE73D, 0xE75D,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0xC71C, 0xE75D, 0xE77E, 0xE75D, 0xDF1D, 0xC67A, 0xE75D, 0xE75D, 0xDF3D, 0xE77E, 0x636E, 0x424A, 0x8473, 0x52EC, 0x4A6A, 0xDF3D, 0xE75D, 0xDF3D, 0xE75D, 0xE75D, 0xE75D, 0xE75D,
-  0x0000, 0xAD55, 0x0000, 0xDF3D, 0xE77E, 0xE75D, 0xE75D, 0xE73D, 0xE75D, 0xEF7E, 0xE73D, 0xE73D, 0xE75E, 0xE77E, 0xE75D, 0x94D3, 0x73CF, 0x8472, 0xD6FC, 0xE77E, 0xE75D, 0xEFBF, 0xE75D, 0xE73D, 0xE77E, 0xE75D,
-  0xFFFF, 0x0000, 0xDF3D, 0xEFBF, 0xEF9E, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xE77E, 0xE77E, 0xD6DC, 0xD6DB, 0xE77E, 0xFFFF, 0xEFBF, 0xEFBF, 0xE75E, 0xE73D, 0xE75D, 0xE73D, 0xE73D, 0xE75D, 0xEF9F, 0xE75D,
-  0x0000, 0xDF3D, 0xEFBF, 0xE75D, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE73D, 0xE77E, 0xD6DB, 0x632D, 0x31C7, 0x31C7, 0x52CB, 0xA555, 0xE77E, 0xDF3D, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xEF9E, 0xE73D,
-  0xDFFF, 0xE73D, 0xEF9E, 0xE73D, 0xE75D, 0xE73D, 0xE75D, 0xE75D, 0xDF3D, 0xEF9E, 0x636E, 0x10C3, 0x2966, 0x2166, 0x2125, 0x1904, 0x73F0, 0xE77E, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE73D, 0xF7FF, 0xE73D, 0xFFFF,
-  0xE73D, 0xEF9E, 0xE73D, 0xE73D, 0xE77E, 0xE77E, 0xE73D, 0xE73D, 0xE75D, 0xDF1C, 0x3A08, 0x2166, 0x2986, 0x2986, 0x2986, 0x2986, 0x18E4, 0x94D3, 0xEF9F, 0xDF3D, 0xE75D, 0xE75D, 0xEF9F, 0xE77E, 0xDF3E, 0xFFFF,
-  0xE73D, 0xEF9F, 0xDF3D, 0xEF9E, 0xE73D, 0xE73D, 0xE77E, 0xE73D, 0xE75D, 0xE75D, 0x4A6A, 0x2145, 0x2986, 0x2966, 0x2966, 0x2986, 0x2145, 0x4229, 0xDF3D, 0xE75D, 0xE75D, 0xE75D, 0xE77D, 0x0000, 0x0000, 0xFFFF,
-  0xE75D, 0xE75D, 0xEF9F, 0xE75D, 0xEF5F, 0xE73D, 0xF7DF, 0xE75D, 0xDF3D, 0xEFBF, 0x8C92, 0x18E4, 0x29A7, 0x2986, 0x2966, 0x2986, 0x2966, 0x2986, 0xCEBB, 0xE77E, 0xDF3D, 0xEF9E, 0xE71D, 0xFFFF, 0xCE79, 0x0000,
-  0xE73D, 0xE75D, 0xE77E, 0xE75D, 0x0000, 0xE75D, 0xF7BF, 0xE75D, 0xE73D, 0xE75D, 0xE75D, 0x5B0C, 0x18E4, 0x2966, 0x2986, 0x2986, 0x2145, 0x31C7, 0xD6FC, 0xE75E, 0xE73D, 0xEFBF, 0xDF3D, 0x0000, 0xFFFF, 0x0000,
-  0xEF9E, 0xEFBF, 0xDF3D, 0xE73C, 0xFFFF, 0xE73D, 0xEFBF, 0xE73D, 0xE75D, 0xE73D, 0xE75E, 0xDF3D, 0x73D0, 0x2986, 0x1925, 0x1925, 0x2146, 0x94F4, 0xEF9E, 0xDF3D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0x0000, 0xAD55,
-  0xE75D, 0xEFBF, 0xE75D, 0x0000, 0x0000, 0xE77D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xE73D, 0xE75D, 0xEF9F, 0xCE9A, 0x9D35, 0x94F4, 0xC659, 0xEF9E, 0xE73D, 0xE75D, 0xE75D, 0xDF3D, 0xF7DF, 0xDF3D, 0x0000, 0xFFFF,
-  0x0000, 0xDEDB, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xE73D, 0xEF9E, 0xE73D, 0xE73D, 0xE75D, 0xE73D, 0xDF3D, 0xE77E, 0xEF9F, 0xEFBF, 0xE77E, 0xDF3D, 0xE73D, 0xE75D, 0xE75D, 0xE73D, 0xE77E, 0xE75D, 0xE73E, 0x0000,
-  0xFFFF, 0x0000, 0x7BEF, 0x0000, 0xBDF7, 0x0000, 0xE75D, 0xFFFF, 0xE77E, 0xE77E, 0xE73D, 0xE73D, 0xE75D, 0xE73D, 0xDF3D, 0xDF3D, 0xDF3D, 0xE77E, 0xEF7E, 0xE73D, 0xE73D, 0xE75D, 0xE73D, 0xEFBF, 0xE73D, 0x0000,
-  0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xDEFD, 0xE75D, 0xE77E, 0xE75D, 0xE77E, 0xEFBF, 0xE73D, 0xE73D, 0xE73D, 0xE77E, 0xEF9E, 0xE73D, 0xE73D, 0xE77E, 0xEF9F, 0xE73D, 0xE73D, 0xFFFF, 0xE73D, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF5D, 0xE73D, 0xE75D, 0xE77E, 0xEF9E, 0xEF9E, 0xE77E, 0xE75D, 0xDF7D, 0xE73C, 0xE73D, 0xE77E, 0xEF7E, 0xEFBF, 0xE77E, 0xDF3D, 0xFFFF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xE77E, 0xE79E, 0xE75E, 0xDF1D, 0x0000, 0x0000, 0x0000, 0x0000, 0xCF3C, 0xE77E, 0xEFBF, 0xDF1C, 0x0000, 0xFFFF
+const uint16_t SPRITE_GHOST_26_SPAN_ROWS[] PROGMEM = {
+  0, 0, 15, 8, 34, 20, 53, 34, 76, 50, 98, 73, 117, 91, 137, 112,
+  160, 135, 182, 158, 205, 181, 227, 204, 242, 228, 258, 253, 272, 278, 287, 304,
+  302, 330, 324, 354, 342, 379, 363, 402, 380, 428, 398, 451, 422, 474, 452, 496,
+  479, 518, 498, 535
 };
 
-const uint8_t SPRITE_GHOST_26_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0A, 0x3A, 0x4C, 0x4C, 0x3A, 0x0A, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x82, 0xDB, 0xFD, 0xFF, 0xFF, 0xFD, 0xDB, 0x82, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x38, 0xDC, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xDD, 0x39, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2F, 0xF1, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xF1, 0x2D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0xCE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xCD, 0x05, 0x01, 0x01, 0x02, 0x04, 0x03,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x58, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x5A, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0xB1, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xB1, 0x00, 0x02, 0x2D, 0x7F, 0x3D,
-  0x00, 0x00, 0x01, 0x00, 0x04, 0xDE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xDF, 0x04, 0x01, 0xD2, 0xFF, 0xF4,
-  0x00, 0x00, 0x01, 0x00, 0x0B, 0xE9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xE9, 0x05, 0x12, 0xF2, 0xFB, 0xFF,
-  0x00, 0x00, 0x01, 0x03, 0x07, 0xE5, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xE7, 0x00, 0x6B, 0xFF, 0xFC, 0xFF,
-  0x00, 0x00, 0x03, 0x00, 0x09, 0xEA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0x88, 0xF8, 0xFE, 0xFE, 0xF7,
-  0x00, 0x03, 0x00, 0x56, 0xD0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD9,
-  0x03, 0x00, 0x79, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xFC, 0xFE, 0xA7,
-  0x00, 0x49, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x4C,
-  0x07, 0xD3, 0xFE, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xB1, 0x02,
-  0x55, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xB4, 0x14, 0x01,
-  0xAC, 0xFE, 0xFC, 0xFF, 0xDC, 0xE7, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF8, 0x52, 0x00, 0x00, 0x01,
-  0xE0, 0xFF, 0xFF, 0xB7, 0x0C, 0xA2, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0x42, 0x01, 0x05, 0x00,
-  0xFA, 0xFD, 0xF7, 0x2E, 0x00, 0x87, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xB4, 0x00, 0x02, 0x00,
-  0xFF, 0xFF, 0xEA, 0x0A, 0x01, 0x5B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0x28, 0x01, 0x03,
-  0x9B, 0xE6, 0x7C, 0x00, 0x00, 0x2A, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x90, 0x00, 0x03,
-  0x00, 0x07, 0x00, 0x01, 0x01, 0x04, 0xD7, 0xFC, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xEC, 0x13, 0x00,
-  0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFC, 0xFF, 0x6B, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x0F, 0xB2, 0xD5, 0xE1, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xE4, 0xE0, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0x8E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x42, 0xC3, 0xFF, 0xFF, 0xFF, 0xE6, 0x63, 0x0E, 0x0A, 0x48, 0xD2, 0xFF, 0xFF, 0xE1, 0x29, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x4B, 0x4B, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x46, 0x4C, 0x1B, 0x00, 0x01
+const uint8_t SPRITE_GHOST_26_SPAN_OPS[] PROGMEM = {
+  0x06, 0x80, 0x03, 0x01, 0x85, 0x0A, 0x3A, 0x4C, 0x4C, 0x3A, 0x0A, 0x01, 0x80, 0x03, 0xC0, 0x05, 0x80, 0x03, 0x00, 0x83, 0x11, 0x82, 0xDB, 0xFD,
+  0x41, 0x83, 0xFD, 0xDB, 0x82, 0x11, 0x00, 0x80, 0x03, 0xC0, 0x04, 0x80, 0x03, 0x00, 0x81, 0x38, 0xDC, 0x42, 0x81, 0xFD, 0xFD, 0x42, 0x81, 0xDD,
+  0x39, 0x00, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x02, 0x00, 0x81, 0x2F, 0xF1, 0x40, 0x81, 0xFA, 0xFE, 0x43, 0x81, 0xFE, 0xFA, 0x40, 0x81, 0xF1, 0x2D,
+  0x00, 0x80, 0x02, 0xC0, 0x02, 0x83, 0x01, 0x01, 0x05, 0xCE, 0x40, 0x80, 0xFB, 0x47, 0x80, 0xFB, 0x40, 0x86, 0xCD, 0x05, 0x01, 0x01, 0x02, 0x04,
+  0x03, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0x58, 0x40, 0x80, 0xFB, 0x49, 0x80, 0xFB, 0x40, 0x80, 0x5A, 0x00, 0x80, 0x04, 0xC0, 0x02, 0x80, 0x02,
+  0x00, 0x82, 0xB1, 0xFE, 0xFB, 0x49, 0x82, 0xFB, 0xFE, 0xB1, 0x00, 0x83, 0x02, 0x2D, 0x7F, 0x3D, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x81, 0x04, 0xDE,
+  0x40, 0x80, 0xFE, 0x49, 0x80, 0xFE, 0x40, 0x83, 0xDF, 0x04, 0x01, 0xD2, 0x40, 0x80, 0xF4, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x81, 0x0B, 0xE9, 0x40,
+  0x80, 0xFE, 0x49, 0x80, 0xFE, 0x40, 0x84, 0xE9, 0x05, 0x12, 0xF2, 0xFB, 0x40, 0xC0, 0x01, 0x83, 0x01, 0x03, 0x07, 0xE5, 0x40, 0x80, 0xFE, 0x49,
+  0x80, 0xFE, 0x40, 0x80, 0xE7, 0x00, 0x80, 0x6B, 0x40, 0x80, 0xFC, 0x40, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x81, 0x09, 0xEA, 0x40, 0x80, 0xFE, 0x49,
+  0x80, 0xFE, 0x40, 0x85, 0xEA, 0x88, 0xF8, 0xFE, 0xFE, 0xF7, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x82, 0x56, 0xD0, 0xFE, 0x50, 0x80, 0xFD, 0x40, 0x80,
+  0xD9, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x79, 0x41, 0x80, 0xFE, 0x4E, 0x84, 0xFC, 0xFE, 0xFC, 0xFE, 0xA7, 0xC0, 0x00, 0x80, 0x49, 0x40, 0x81, 0xFC,
+  0xFC, 0x51, 0x80, 0xFB, 0x40, 0x80, 0x4C, 0xC0, 0x85, 0x07, 0xD3, 0xFE, 0xFC, 0xFD, 0xFE, 0x4F, 0x80, 0xFB, 0x40, 0x81, 0xB1, 0x02, 0xC0, 0x80,
+  0x55, 0x40, 0x81, 0xFD, 0xFD, 0x50, 0x80, 0xFE, 0x40, 0x82, 0xB4, 0x14, 0x01, 0xC0, 0x82, 0xAC, 0xFE, 0xFC, 0x40, 0x81, 0xDC, 0xE7, 0x40, 0x80,
+  0xFE, 0x4A, 0x80, 0xFE, 0x40, 0x81, 0xF8, 0x52, 0x01, 0x80, 0x01, 0xC0, 0x80, 0xE0, 0x41, 0x82, 0xB7, 0x0C, 0xA2, 0x40, 0x80, 0xFB, 0x4B, 0x84,
+  0xFD, 0xFE, 0x42, 0x01, 0x05, 0xC0, 0x83, 0xFA, 0xFD, 0xF7, 0x2E, 0x00, 0x80, 0x87, 0x40, 0x80, 0xFB, 0x4B, 0x80, 0xFB, 0x40, 0x80, 0xB4, 0x00,
+  0x80, 0x02, 0xC0, 0x41, 0x83, 0xEA, 0x0A, 0x01, 0x5B, 0x40, 0x80, 0xFC, 0x4C, 0x84, 0xFE, 0xF9, 0x28, 0x01, 0x03, 0xC0, 0x82, 0x9B, 0xE6, 0x7C,
+  0x01, 0x81, 0x2A, 0xFB, 0x4D, 0x80, 0xFC, 0x40, 0x80, 0x90, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x07, 0x00, 0x86, 0x01, 0x01, 0x04, 0xD7, 0xFC,
+  0xFB, 0xFD, 0x46, 0x81, 0xFD, 0xFD, 0x41, 0x80, 0xFE, 0x40, 0x81, 0xEC, 0x13, 0xC0, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x04, 0x00, 0x80,
+  0x7C, 0x42, 0x81, 0xFE, 0xFC, 0x42, 0x81, 0xFE, 0xFD, 0x41, 0x81, 0xFE, 0xFD, 0x40, 0x80, 0xFC, 0x40, 0x80, 0x6B, 0xC0, 0x00, 0x80, 0x01, 0x01,
+  0x85, 0x01, 0x01, 0x0F, 0xB2, 0xD5, 0xE1, 0x42, 0x81, 0xFD, 0xFD, 0x41, 0x81, 0xE4, 0xE0, 0x41, 0x81, 0xFD, 0xF9, 0x40, 0x80, 0x8E, 0xC0, 0x08,
+  0x82, 0x0D, 0x42, 0xC3, 0x42, 0x85, 0xE6, 0x63, 0x0E, 0x0A, 0x48, 0xD2, 0x41, 0x82, 0xE1, 0x29, 0x01, 0xC0, 0x05, 0x81, 0x01, 0x02, 0x03, 0x83,
+  0x3E, 0x4B, 0x4B, 0x1B, 0x03, 0x83, 0x0A, 0x46, 0x4C, 0x1B, 0x00, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_GHOST_26_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0020, 0x3186, 0x4249, 0x4249, 0x3186, 0x0020, 0x0000, 0x0000, 0x0861, 0x73AF, 0xBE39, 0xE75D, 0xEF9E, 0xEF9E, 0xE75D,
+  0xBE39, 0x73AF, 0x0861, 0x0000, 0x0000, 0x2986, 0xC67A, 0xF7DF, 0xE77E, 0xE75D, 0xE73D, 0xE73D, 0xE75D, 0xE77E, 0xF7DF, 0xCE9A,
+  0x2986, 0x0000, 0x0000, 0x2945, 0xD6FC, 0xEF9E, 0xDEFC, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xD6FC, 0xEF9E, 0xD6FC,
+  0x2945, 0x0000, 0x0000, 0x0000, 0x0020, 0xB5D7, 0xEFBF, 0xD6FC, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xE77E, 0xEF9F,
+  0xDF3D, 0xEF9F, 0xADD7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x4A69, 0xEFBF, 0xDEFC, 0xDF3D, 0xDF3D, 0xDF3D,
+  0xE75D, 0xE75D, 0xE73D, 0xEF9E, 0xCEBB, 0xB5D7, 0xC65A, 0xE73D, 0xF7BF, 0x4A69, 0x0020, 0x0000, 0x9CF3, 0xEFBF, 0xDF1C, 0xEF9E,
+  0xEF9E, 0xEF7E, 0xE75D, 0xDF3D, 0xEF9E, 0x9D14, 0x29A7, 0x1925, 0x2166, 0x73EF, 0xF7DF, 0x9CF3, 0x0000, 0x2945, 0x73CF, 0x39C7,
+  0x0000, 0x0020, 0xC659, 0xE77E, 0xE75D, 0x8C92, 0x4A6A, 0xA576, 0xE77E, 0xE77E, 0xCE9A, 0x2986, 0x2125, 0x39E8, 0x2966, 0x18E4,
+  0xADB7, 0xCE9B, 0x0000, 0x0000, 0xB5D7, 0xFFFF, 0xDF1C, 0x0000, 0x0020, 0xC67A, 0xEF9E, 0xCEBB, 0x2145, 0x10C3, 0x4229, 0xE75E,
+  0xEF9F, 0xAD96, 0x1904, 0x638F, 0x9D77, 0x7C52, 0x1904, 0x8472, 0xDF1C, 0x0020, 0x0861, 0xD6BB, 0xDF1C, 0xE75D, 0x0000, 0x0000,
+  0x0020, 0xCE7A, 0xE77E, 0xDF3D, 0x5B0C, 0x1925, 0x7C10, 0xE77E, 0xEF7E, 0xBE18, 0x1904, 0x8CF4, 0xADF8, 0xA597, 0x2145, 0x94F4,
+  0xD6FC, 0x5AEB, 0xEFBF, 0xE73D, 0xE75D, 0x0000, 0x0020, 0xCE9A, 0xE77E, 0xE75D, 0xDF1D, 0xC67A, 0xE75D, 0xE75D, 0xDF3D, 0xE77E,
+  0x636E, 0x424A, 0x8473, 0x52EC, 0x4A6A, 0xDF3D, 0xCE9A, 0x73CF, 0xDF1C, 0xE75D, 0xE75D, 0xDF1C, 0x0000, 0x4A69, 0xB5F8, 0xE75D,
+  0xE75D, 0xE73D, 0xE75D, 0xEF7E, 0xE73D, 0xE73D, 0xE75E, 0xE77E, 0xE75D, 0x94D3, 0x73CF, 0x8472, 0xD6FC, 0xE77E, 0xE75D, 0xEFBF,
+  0xE75D, 0xE73D, 0xE77E, 0xBE18, 0x0000, 0x634D, 0xEFBF, 0xEF9E, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xDF3D, 0xE77E, 0xE77E, 0xD6DC,
+  0xD6DB, 0xE77E, 0xFFFF, 0xEFBF, 0xEFBF, 0xE75E, 0xE73D, 0xE75D, 0xE73D, 0xE73D, 0xE75D, 0xEF9F, 0x94D3, 0x3A08, 0xEFBF, 0xE75D,
+  0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xE73D, 0xE77E, 0xD6DB, 0x632D, 0x31C7, 0x31C7, 0x52CB, 0xA555, 0xE77E, 0xDF3D, 0xE73D, 0xE75D,
+  0xE75D, 0xE75D, 0xE75D, 0xDF1C, 0xEF9E, 0x4229, 0x0020, 0xB5D7, 0xEF9E, 0xE73D, 0xE75D, 0xE73D, 0xE75D, 0xE75D, 0xDF3D, 0xEF9E,
+  0x636E, 0x10C3, 0x2966, 0x2166, 0x2125, 0x1904, 0x73F0, 0xE77E, 0xE73D, 0xE75D, 0xE75D, 0xE75D, 0xDEFC, 0xF7FF, 0x9CF3, 0x0000,
+  0x4A69, 0xEF9E, 0xE73D, 0xE73D, 0xE77E, 0xE77E, 0xE73D, 0xE73D, 0xE75D, 0xDF1C, 0x3A08, 0x2166, 0x2986, 0x2986, 0x2986, 0x2986,
+  0x18E4, 0x94D3, 0xEF9F, 0xDF3D, 0xE75D, 0xE75D, 0xEF9F, 0xA555, 0x10A2, 0x0000, 0x9CF3, 0xEF9F, 0xDF3D, 0xEF9E, 0xC639, 0xCE7A,
+  0xE77E, 0xE73D, 0xE75D, 0xE75D, 0x4A6A, 0x2145, 0x2986, 0x2966, 0x2966, 0x2986, 0x2145, 0x4229, 0xDF3D, 0xE75D, 0xE75D, 0xDF1C,
+  0x4249, 0x0000, 0xC659, 0xE75D, 0xEF9F, 0xA534, 0x0861, 0x8C72, 0xF7DF, 0xDF1C, 0xDF3D, 0xEFBF, 0x8C92, 0x18E4, 0x29A7, 0x2986,
+  0x2966, 0x2986, 0x2966, 0x2986, 0xCEBB, 0xE77E, 0xDF3D, 0xEF9E, 0x39C7, 0x0000, 0x0020, 0xDEFC, 0xE75D, 0xDF3D, 0x2945, 0x73CF,
+  0xF7BF, 0xDF1C, 0xE73D, 0xE75D, 0xE75D, 0x5B0C, 0x18E4, 0x2966, 0x2986, 0x2986, 0x2145, 0x31C7, 0xD6FC, 0xE75E, 0xDEFC, 0xEFBF,
+  0x9D14, 0x0000, 0xEF9E, 0xEFBF, 0xC67A, 0x0020, 0x0000, 0x4A69, 0xEFBF, 0xE73D, 0xE75D, 0xE73D, 0xE75E, 0xDF3D, 0x73D0, 0x2986,
+  0x1925, 0x1925, 0x2146, 0x94F4, 0xEF9E, 0xDF3D, 0xE75D, 0xE75D, 0xDF1C, 0x2104, 0x0000, 0x0000, 0x8451, 0xD6FC, 0x73AE, 0x2124,
+  0xDF1C, 0xE75D, 0xE75D, 0xE75D, 0xE73D, 0xE75D, 0xEF9F, 0xCE9A, 0x9D35, 0x94F4, 0xC659, 0xEF9E, 0xE73D, 0xE75D, 0xE75D, 0xDF3D,
+  0xF7DF, 0x7C10, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0xBE18, 0xEF9E, 0xDEFC, 0xE73D, 0xE75D, 0xE73D, 0xDF3D, 0xE77E, 0xEF9F,
+  0xEFBF, 0xE77E, 0xDF3D, 0xE73D, 0xE75D, 0xE75D, 0xE73D, 0xE77E, 0xD6DB, 0x0861, 0x0000, 0x0000, 0x0020, 0x73AE, 0xFFFF, 0xE77E,
+  0xE77E, 0xE73D, 0xE73D, 0xE75D, 0xE73D, 0xDF3D, 0xDF3D, 0xDF3D, 0xE77E, 0xEF7E, 0xE73D, 0xE73D, 0xE75D, 0xE73D, 0xEFBF, 0x5AEB,
+  0x0000, 0x0000, 0x0000, 0x0861, 0x9CF3, 0xBE39, 0xC659, 0xE77E, 0xEFBF, 0xE73D, 0xE73D, 0xE73D, 0xE77E, 0xEF9E, 0xCE7A, 0xC639,
+  0xE77E, 0xEF9F, 0xE73D, 0xDEFC, 0xFFFF, 0x7C10, 0x0861, 0x39C7, 0xAD75, 0xE77E, 0xEF9E, 0xEF9E, 0xCEBB, 0x52AA, 0x0861, 0x0020,
+  0x3A08, 0xB5F8, 0xEF7E, 0xEFBF, 0xC67A, 0x2104, 0x0000, 0x0000, 0x0000, 0x39C7, 0x3A08, 0x3A08, 0x10A2, 0x0020, 0x3A08, 0x4A69,
+  0x10A2, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_GHOST_26_SPANS = {
+  SPRITE_GHOST_26_SPAN_ROWS, SPRITE_GHOST_26_SPAN_OPS, SPRITE_GHOST_26_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_GHOST_26_ASSET = {
   SPRITE_GHOST_26_WIDTH, SPRITE_GHOST_26_HEIGHT,
-  SPRITE_GHOST_26_ALPHA, SPRITE_GHOST_26_RGB565
+  nullptr, nullptr, &SPRITE_GHOST_26_SPANS
 };
 
 #endif // SPRITE_GHOST_26_INCLUDED
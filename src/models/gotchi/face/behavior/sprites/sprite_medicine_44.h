@@ -5,110 +5,125 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from medicine_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from medicine_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 796/1936 pixels visibles, 2716 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_MEDICINE_44_WIDTH = 44;
 constexpr uint16_t SPRITE_MEDICINE_44_HEIGHT = 44;
 
-const uint16_t SPRITE_MEDICINE_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xD145, 0xD9E7, 0xD9E7, 0xD929, 0xD929, 0xD9E7, 0xD9E7, 0xD145, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF81F, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFAAA, 0xFAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBEF, 0xAD55, 0xD6BA, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC0E3, 0xD946, 0xF1A8, 0xE187, 0xD987, 0xD987, 0xE187, 0xE987, 0xD967, 0xC1C7, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEFB, 0xF79F, 0xFFFF, 0xFFFF, 0xF79F, 0xF79F, 0xFFFF, 0xFFFF, 0xF79F, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xD145, 0xD966, 0xF1A8, 0xE9A8, 0xD987, 0xD987, 0xE1A8, 0xF1C8, 0xD987, 0xC987, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF5E, 0xF7BF, 0xFFFF, 0xFFFF, 0xF79F, 0xF79F, 0xFFFF, 0xFFFF, 0xF7BF, 0xF79E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xF800, 0xF9E7, 0xF28B, 0xFAEB, 0xFACB, 0xE229, 0xD9C8, 0xF1C8, 0xE987, 0xD966, 0xD966, 0xE987, 0xF187, 0xE166, 0xE1A7, 0xECB2, 0xCE9B, 0xCE9B, 0xE77D, 0xFFBF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFBEF, 0x7800, 0xD145, 0xFAAA, 0xFAEB, 0xFAEB, 0xFAEB, 0xF2EB, 0xF2AB, 0xFA6A, 0xF1E8, 0xE987, 0xE9A7, 0xF1C7, 0xF1C7, 0xF1A7, 0xFA49, 0xEC72, 0xCDF8, 0xCE9B, 0xEF7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFAAA, 0x0000, 0x0000, 0xFD51, 0xFB6D, 0xFB6D, 0xFB6D, 0xFB2C, 0xFAEB, 0xFB8D, 0xFD14, 0xFDD6, 0xFD96, 0xFDB6, 0xFDF7, 0xFC91, 0xFA48, 0xE3CF, 0xCDB7, 0xCEBB, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFAAA, 0x0000, 0x0000, 0x0020, 0xFBAE, 0xFBAE, 0xFBCF, 0xFAAA, 0xF985, 0xFC0F, 0xFF1C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEFB, 0xFB0B, 0xE30C, 0xCD97, 0xCEDC, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0xF800, 0xF800, 0xFBEF, 0xE168, 0xE187, 0xF209, 0xF28A, 0xF26A, 0xF28A, 0xF26A, 0xFB6D, 0xFDD7, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF9E, 0xFD96, 0xE492, 0xCDB8, 0xCEBB, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x0000, 0x7800, 0xD14A, 0x0000, 0xF800, 0xD1A7, 0xD987, 0xF1C8, 0xE9C8, 0xD967, 0xE146, 0xE28B, 0xF5B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBE, 0xEEFC, 0xCE3A, 0xCE9B, 0xEF5E, 0xFFDF, 0xFFDF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF79F, 0xFFFF, 0x0000, 0xDEFB,
-  0x0000, 0x7800, 0xD8E7, 0x0000, 0x0000, 0xD987, 0xD987, 0xF9E9, 0xF1E8, 0xE146, 0xE905, 0xE28B, 0xF659, 0xFFFF, 0xFFFF, 0xFF9E, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BF, 0xCE7B, 0xCE7A, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0x0000, 0x0000, 0xE73C,
-  0x0000, 0x7800, 0xD929, 0x0000, 0x0000, 0xD187, 0xD987, 0xF9C8, 0xF1C8, 0xD946, 0xE126, 0xE28B, 0xF639, 0xFFFF, 0xFFFF, 0xFFBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7E, 0xCE7A, 0xCE7A, 0xEF5E, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0x0000, 0x0000, 0xE73C,
-  0x0000, 0x7800, 0xD929, 0x0000, 0x0000, 0xD187, 0xD987, 0xF1C8, 0xE9C8, 0xD946, 0xD905, 0xE2AB, 0xF69A, 0xFFFF, 0xFFFF, 0xFF9E, 0xFFDF, 0xFFFF, 0xFFBF, 0xFFFF, 0xFFFF, 0xF7FF, 0xCE7B, 0xCE7A, 0xEF5E, 0xFFDF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0x0000, 0x0000, 0xE73C,
-  0x0000, 0x7800, 0xD8E7, 0x0000, 0x0000, 0xD987, 0xD987, 0xF9E9, 0xE9C8, 0xD126, 0xD905, 0xE2AB, 0xFEFB, 0xFFFF, 0xFFFF, 0xFF5D, 0xFF9E, 0xFF9E, 0xFF7E, 0xFFFF, 0xFFFF, 0xF7FF, 0xCE9B, 0xCE5A, 0xEF3D, 0xFFDF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0x0000, 0x0000, 0xE73C,
-  0x0000, 0x7800, 0xD14A, 0xF800, 0xFBEF, 0xD1A7, 0xD987, 0xF1A8, 0xE1C8, 0xE967, 0xE146, 0xDA4A, 0xECD4, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFEDB, 0xE5F8, 0xCDF8, 0xCEBB, 0xEF7E, 0xFFBF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79F, 0xF79F, 0xFFFF, 0xFFFF, 0xDEFB,
-  0x0000, 0x0000, 0xF800, 0xF800, 0xDA49, 0xD168, 0xD987, 0xE1A8, 0xD987, 0xF9C8, 0xE1A7, 0xD987, 0xE1E8, 0xEBAF, 0xFF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF1C, 0xEB4E, 0xD28B, 0xC4D4, 0xD73D, 0xEFBF, 0xFFBF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xF79F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xDA49, 0x0000, 0x0000, 0xB967, 0xD987, 0xF1C8, 0xE1C8, 0xE946, 0xE0E5, 0xD9E8, 0xECD4, 0xFEFB, 0xF67A, 0xF69A, 0xF73C, 0xEC92, 0xE9A7, 0xD987, 0xC472, 0xD77E, 0xEFDF, 0xFFFF, 0xF7BF, 0xF79F, 0xF79E, 0xF7BF, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BF, 0xDEDE, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFBEF, 0x0000, 0x0000, 0x0000, 0xD166, 0xE9C8, 0xE1A7, 0xF9A8, 0xE946, 0xD967, 0xDA4A, 0xE2CC, 0xE2AB, 0xE2AB, 0xDAEC, 0xE209, 0xF146, 0xE209, 0xC4B4, 0xD75E, 0xF7FF, 0xFFFF, 0xF7BF, 0xF79F, 0xF79E, 0xF7BF, 0xF7BF, 0xF79F, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF79F, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD1C7, 0xF800, 0x0000, 0xA965, 0xD967, 0xF1C8, 0xE1C8, 0xE9A8, 0xE967, 0xE926, 0xE926, 0xF146, 0xF146, 0xE125, 0xE146, 0xD26B, 0xC515, 0xD73D, 0xEFBF, 0xFFBF, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xDEDE, 0x0000, 0xFFFF, 0xEF5D, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB9E7, 0x0000, 0x0000, 0x0000, 0xD167, 0xE9C8, 0xE1A7, 0xF9C8, 0xF9A8, 0xE967, 0xE967, 0xF987, 0xF988, 0xD946, 0xD966, 0xD28B, 0xCDB8, 0xCF3D, 0xEFBF, 0xF79F, 0xF7BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xF79F, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFFFF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD1C7, 0x0000, 0x0000, 0xA965, 0xD987, 0xF1C8, 0xE9C8, 0xD9C8, 0xD9C8, 0xE9C8, 0xF1E8, 0xD9A8, 0xC22A, 0x0000, 0x0000, 0x0000, 0x0000, 0xE73F, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF7BF, 0xDEDE, 0x0000, 0xFFFF, 0xEF5D, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB9E7, 0x0000, 0x0000, 0x0000, 0xD167, 0xF9C8, 0xF1C8, 0xE1C8, 0xE1C8, 0xE9C9, 0xF9E9, 0xD1C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xFFFF, 0xFFFF, 0xF79F, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xD145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDA49, 0xD3F5, 0xD7FF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x780F, 0x7BEF, 0x7BEF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xD145, 0xD9E7, 0xD9E7, 0xD929, 0xD929, 0xD9E7, 0xD9E7, 0xD145, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_MEDICINE_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 0, 7, 0,
+  8, 0, 9, 0, 30, 16, 55, 36, 70, 44, 87, 54, 112, 74, 137, 94,
+  180, 130, 223, 170, 266, 206, 308, 241, 353, 283, 401, 324, 436, 363, 471, 402,
+  519, 441, 567, 480, 612, 523, 658, 565, 700, 601, 742, 635, 773, 669, 802, 699,
+  836, 724, 865, 744, 882, 754, 895, 760, 920, 780, 941, 796, 942, 796, 943, 796,
+  944, 796, 945, 796, 946, 796, 947, 796
 };
 
-const uint8_t SPRITE_MEDICINE_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x3F, 0x40, 0x3D, 0x3D, 0x40, 0x40, 0x31, 0x09, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2E, 0x3E, 0x3E, 0x3A, 0x3A, 0x3E, 0x3E, 0x2E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xA9, 0xDA, 0xDB, 0xD3, 0xD3, 0xDC, 0xDC, 0xAC, 0x28, 0x00, 0x00, 0x00, 0x00, 0x24, 0xA4, 0xD7, 0xD7, 0xCB, 0xCB, 0xD7, 0xD7, 0xA4, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x08, 0x19, 0x18, 0x17, 0x46, 0xCA, 0xF8, 0xF5, 0xEA, 0xEB, 0xF4, 0xF4, 0xC3, 0x42, 0x1B, 0x28, 0x29, 0x1F, 0x47, 0xC9, 0xFE, 0xFE, 0xF1, 0xF1, 0xFE, 0xFE, 0xCA, 0x49, 0x1C, 0x1D, 0x1C, 0x09, 0x01, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x06, 0x18, 0x46, 0x5B, 0x58, 0x60, 0x89, 0x94, 0x8E, 0x88, 0x89, 0x8C, 0x8D, 0x7A, 0x54, 0x66, 0x94, 0x99, 0x74, 0x69, 0x94, 0xA9, 0xA9, 0xA4, 0xA4, 0xA8, 0xA8, 0x97, 0x6E, 0x68, 0x6C, 0x52, 0x1B, 0x06, 0x02, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x09, 0x4B, 0x71, 0x6C, 0x5A, 0x4A, 0x4D, 0x59, 0x61, 0x5F, 0x5F, 0x63, 0x58, 0x58, 0x85, 0xCD, 0xD5, 0x98, 0x68, 0x5B, 0x5D, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x61, 0x71, 0x85, 0x8B, 0x5E, 0x0D, 0x00, 0x00, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x41, 0x67, 0x63, 0x50, 0x4A, 0x60, 0x89, 0xA0, 0x9A, 0x9B, 0xA2, 0x85, 0x5E, 0x79, 0xC1, 0xCD, 0x8E, 0x61, 0x5D, 0x63, 0x62, 0x61, 0x61, 0x61, 0x61, 0x63, 0x6A, 0x7A, 0x81, 0x54, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x01, 0x02, 0x0B, 0x2A, 0x46, 0x72, 0x89, 0x88, 0x79, 0x73, 0x87, 0xB1, 0xC8, 0xC3, 0xC3, 0xCB, 0xAB, 0x79, 0x7F, 0xB2, 0xC2, 0x9F, 0x8A, 0x92, 0x99, 0x98, 0x97, 0x97, 0x97, 0x97, 0x95, 0x8E, 0x95, 0x97, 0x7E, 0x49, 0x2A, 0x0B, 0x02, 0x01, 0x02,
-  0x00, 0x02, 0x06, 0x00, 0x01, 0x2B, 0x9F, 0xCE, 0xD9, 0xDE, 0xDF, 0xCF, 0xAE, 0xA3, 0xB1, 0xBE, 0xBB, 0xBB, 0xBE, 0xB3, 0xA4, 0xA6, 0xBB, 0xD0, 0xDB, 0xE0, 0xE0, 0xDE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xDF, 0xDD, 0xDE, 0xDA, 0xDD, 0xCE, 0x9D, 0x2B, 0x01, 0x00, 0x08,
-  0x00, 0x02, 0x08, 0x00, 0x00, 0x3B, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xD0, 0xB2, 0xAE, 0xB3, 0xB2, 0xB1, 0xB1, 0xB3, 0xBB, 0xBC, 0xC0, 0xD7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xDA, 0x3B, 0x00, 0x00, 0x0B,
-  0x00, 0x02, 0x07, 0x00, 0x00, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xCC, 0xB1, 0xB0, 0xB5, 0xB4, 0xB3, 0xB3, 0xB4, 0xB9, 0xBB, 0xC0, 0xD6, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xCD, 0x38, 0x00, 0x00, 0x0A,
-  0x00, 0x02, 0x07, 0x00, 0x00, 0x38, 0xCF, 0xFF, 0xFB, 0xF6, 0xFA, 0xEA, 0xBD, 0xA6, 0xAE, 0xB7, 0xB6, 0xB5, 0xB7, 0xB2, 0xAD, 0xAF, 0xBD, 0xD5, 0xEE, 0xFB, 0xF9, 0xF4, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF6, 0xF7, 0xF4, 0xEC, 0xFC, 0xFF, 0xCD, 0x38, 0x00, 0x00, 0x0A,
-  0x00, 0x02, 0x08, 0x00, 0x00, 0x3B, 0xDC, 0xFF, 0xFD, 0xF5, 0xFC, 0xED, 0xBD, 0xA5, 0xAE, 0xB9, 0xB8, 0xB7, 0xB9, 0xB2, 0xAC, 0xAD, 0xBD, 0xD6, 0xF1, 0xFE, 0xFC, 0xF7, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xF5, 0xEA, 0xFE, 0xFF, 0xDA, 0x3B, 0x00, 0x00, 0x0B,
-  0x00, 0x02, 0x06, 0x01, 0x02, 0x2B, 0x9E, 0xD8, 0xFF, 0xFF, 0xFF, 0xF0, 0xD0, 0xBA, 0xB0, 0xAF, 0xB0, 0xAF, 0xAE, 0xB3, 0xBF, 0xC2, 0xC2, 0xD1, 0xEE, 0xFE, 0xFD, 0xF8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF9, 0xF6, 0xFC, 0xFF, 0xFF, 0xD8, 0x9D, 0x2B, 0x02, 0x01, 0x08,
-  0x00, 0x00, 0x01, 0x02, 0x07, 0x0B, 0x29, 0x66, 0xE9, 0xFF, 0xFF, 0xF3, 0xF1, 0xE0, 0xBA, 0xA6, 0xAA, 0xAA, 0xA5, 0xBB, 0xE1, 0xE4, 0xC9, 0xC7, 0xE6, 0xF9, 0xFB, 0xF8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF6, 0xEC, 0xFE, 0xFF, 0xE6, 0x65, 0x29, 0x0B, 0x06, 0x02, 0x02,
-  0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x16, 0x99, 0xD8, 0xFF, 0xFF, 0xFF, 0xF5, 0xD0, 0xBC, 0xC1, 0xBF, 0xB9, 0xD7, 0xFF, 0xFF, 0xE0, 0xD7, 0xFA, 0xFF, 0xFF, 0xF6, 0xF8, 0xF9, 0xF9, 0xF7, 0xF6, 0xFB, 0xFF, 0xFF, 0xD9, 0x95, 0x15, 0x00, 0x00, 0x06, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x26, 0x66, 0xE9, 0xFF, 0xFF, 0xF1, 0xEA, 0xE7, 0xE8, 0xE7, 0xE3, 0xF4, 0xFF, 0xFF, 0xE6, 0xE1, 0xFF, 0xFF, 0xFD, 0xF0, 0xF2, 0xF4, 0xF4, 0xF0, 0xEB, 0xFD, 0xFF, 0xE6, 0x66, 0x25, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x01, 0x00, 0x16, 0x99, 0xD8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBB, 0xA2, 0xA2, 0xBA, 0xD8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x95, 0x15, 0x00, 0x01, 0x0D, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x27, 0x66, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x66, 0x32, 0x2B, 0x2B, 0x32, 0x65, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x66, 0x26, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0D, 0x00, 0x00, 0x16, 0x99, 0xCA, 0xC8, 0xBE, 0xBE, 0xC7, 0xC7, 0x97, 0x16, 0x00, 0x00, 0x00, 0x00, 0x15, 0x96, 0xCA, 0xCA, 0xBD, 0xBD, 0xCA, 0xCB, 0x95, 0x15, 0x00, 0x01, 0x0D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x27, 0x36, 0x35, 0x32, 0x32, 0x35, 0x35, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x36, 0x36, 0x32, 0x32, 0x36, 0x36, 0x26, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x06, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_MEDICINE_44_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0B, 0x87, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x05, 0x87, 0x01, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x01, 0xC0, 0x0A, 0x89, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x03, 0x89, 0x02, 0x06, 0x08, 0x08,
+  0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0xC0, 0x08, 0x81, 0x01, 0x01, 0x09, 0x83, 0x01, 0x01, 0x01, 0x01, 0x09, 0x81, 0x01, 0x01, 0xC0, 0x07, 0x82,
+  0x01, 0x03, 0x03, 0x09, 0x83, 0x04, 0x06, 0x06, 0x04, 0x09, 0x82, 0x04, 0x04, 0x02, 0xC0, 0x0A, 0x89, 0x09, 0x30, 0x3F, 0x40, 0x3D, 0x3D, 0x40,
+  0x40, 0x31, 0x09, 0x03, 0x89, 0x08, 0x2E, 0x3E, 0x3E, 0x3A, 0x3A, 0x3E, 0x3E, 0x2E, 0x07, 0xC0, 0x0A, 0x89, 0x26, 0xA9, 0xDA, 0xDB, 0xD3, 0xD3,
+  0xDC, 0xDC, 0xAC, 0x28, 0x03, 0x89, 0x24, 0xA4, 0xD7, 0xD7, 0xCB, 0xCB, 0xD7, 0xD7, 0xA4, 0x23, 0xC0, 0x03, 0x80, 0x01, 0x00, 0xA1, 0x01, 0x08,
+  0x19, 0x18, 0x17, 0x46, 0xCA, 0xF8, 0xF5, 0xEA, 0xEB, 0xF4, 0xF4, 0xC3, 0x42, 0x1B, 0x28, 0x29, 0x1F, 0x47, 0xC9, 0xFE, 0xFE, 0xF1, 0xF1, 0xFE,
+  0xFE, 0xCA, 0x49, 0x1C, 0x1D, 0x1C, 0x09, 0x01, 0x00, 0x80, 0x01, 0xC0, 0x02, 0xA7, 0x01, 0x02, 0x02, 0x06, 0x18, 0x46, 0x5B, 0x58, 0x60, 0x89,
+  0x94, 0x8E, 0x88, 0x89, 0x8C, 0x8D, 0x7A, 0x54, 0x66, 0x94, 0x99, 0x74, 0x69, 0x94, 0xA9, 0xA9, 0xA4, 0xA4, 0xA8, 0xA8, 0x97, 0x6E, 0x68, 0x6C,
+  0x52, 0x1B, 0x06, 0x02, 0x02, 0x01, 0xC0, 0x02, 0x81, 0x01, 0x03, 0x01, 0x9F, 0x09, 0x4B, 0x71, 0x6C, 0x5A, 0x4A, 0x4D, 0x59, 0x61, 0x5F, 0x5F,
+  0x63, 0x58, 0x58, 0x85, 0xCD, 0xD5, 0x98, 0x68, 0x5B, 0x5D, 0x5C, 0x5C, 0x5C, 0x5B, 0x5B, 0x61, 0x71, 0x85, 0x8B, 0x5E, 0x0D, 0x01, 0x81, 0x03,
+  0x01, 0xC0, 0x02, 0x81, 0x01, 0x03, 0x02, 0x9E, 0x41, 0x67, 0x63, 0x50, 0x4A, 0x60, 0x89, 0xA0, 0x9A, 0x9B, 0xA2, 0x85, 0x5E, 0x79, 0xC1, 0xCD,
+  0x8E, 0x61, 0x5D, 0x63, 0x62, 0x61, 0x61, 0x61, 0x61, 0x63, 0x6A, 0x7A, 0x81, 0x54, 0x03, 0x01, 0x81, 0x03, 0x01, 0xC0, 0x01, 0xA9, 0x01, 0x01,
+  0x02, 0x0B, 0x2A, 0x46, 0x72, 0x89, 0x88, 0x79, 0x73, 0x87, 0xB1, 0xC8, 0xC3, 0xC3, 0xCB, 0xAB, 0x79, 0x7F, 0xB2, 0xC2, 0x9F, 0x8A, 0x92, 0x99,
+  0x98, 0x97, 0x97, 0x97, 0x97, 0x95, 0x8E, 0x95, 0x97, 0x7E, 0x49, 0x2A, 0x0B, 0x02, 0x01, 0x02, 0xC0, 0x00, 0x81, 0x02, 0x06, 0x00, 0xA5, 0x01,
+  0x2B, 0x9F, 0xCE, 0xD9, 0xDE, 0xDF, 0xCF, 0xAE, 0xA3, 0xB1, 0xBE, 0xBB, 0xBB, 0xBE, 0xB3, 0xA4, 0xA6, 0xBB, 0xD0, 0xDB, 0xE0, 0xE0, 0xDE, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xDF, 0xDD, 0xDE, 0xDA, 0xDD, 0xCE, 0x9D, 0x2B, 0x01, 0x00, 0x80, 0x08, 0xC0, 0x00, 0x81, 0x02, 0x08, 0x01, 0x81, 0x3B,
+  0xDC, 0x43, 0x8D, 0xFE, 0xD0, 0xB2, 0xAE, 0xB3, 0xB2, 0xB1, 0xB1, 0xB3, 0xBB, 0xBC, 0xC0, 0xD7, 0xFB, 0x4A, 0x80, 0xFD, 0x41, 0x81, 0xDA, 0x3B,
+  0x01, 0x80, 0x0B, 0xC0, 0x00, 0x81, 0x02, 0x07, 0x01, 0x81, 0x38, 0xCF, 0x43, 0x8D, 0xF8, 0xCC, 0xB1, 0xB0, 0xB5, 0xB4, 0xB3, 0xB3, 0xB4, 0xB9,
+  0xBB, 0xC0, 0xD6, 0xF7, 0x4A, 0x80, 0xF9, 0x41, 0x81, 0xCD, 0x38, 0x01, 0x80, 0x0A, 0xC0, 0x00, 0x81, 0x02, 0x07, 0x01, 0x81, 0x38, 0xCF, 0x40,
+  0x9D, 0xFB, 0xF6, 0xFA, 0xEA, 0xBD, 0xA6, 0xAE, 0xB7, 0xB6, 0xB5, 0xB7, 0xB2, 0xAD, 0xAF, 0xBD, 0xD5, 0xEE, 0xFB, 0xF9, 0xF4, 0xF6, 0xF6, 0xF6,
+  0xF6, 0xF6, 0xF6, 0xF7, 0xF4, 0xEC, 0xFC, 0x40, 0x81, 0xCD, 0x38, 0x01, 0x80, 0x0A, 0xC0, 0x00, 0x81, 0x02, 0x08, 0x01, 0x81, 0x3B, 0xDC, 0x40,
+  0x9D, 0xFD, 0xF5, 0xFC, 0xED, 0xBD, 0xA5, 0xAE, 0xB9, 0xB8, 0xB7, 0xB9, 0xB2, 0xAC, 0xAD, 0xBD, 0xD6, 0xF1, 0xFE, 0xFC, 0xF7, 0xF9, 0xF9, 0xF9,
+  0xF9, 0xF9, 0xF9, 0xFA, 0xF5, 0xEA, 0xFE, 0x40, 0x81, 0xDA, 0x3B, 0x01, 0x80, 0x0B, 0xC0, 0x00, 0x86, 0x02, 0x06, 0x01, 0x02, 0x2B, 0x9E, 0xD8,
+  0x42, 0x98, 0xF0, 0xD0, 0xBA, 0xB0, 0xAF, 0xB0, 0xAF, 0xAE, 0xB3, 0xBF, 0xC2, 0xC2, 0xD1, 0xEE, 0xFE, 0xFD, 0xF8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB,
+  0xF9, 0xF6, 0xFC, 0x41, 0x85, 0xD8, 0x9D, 0x2B, 0x02, 0x01, 0x08, 0xC0, 0x01, 0x86, 0x01, 0x02, 0x07, 0x0B, 0x29, 0x66, 0xE9, 0x41, 0x98, 0xF3,
+  0xF1, 0xE0, 0xBA, 0xA6, 0xAA, 0xAA, 0xA5, 0xBB, 0xE1, 0xE4, 0xC9, 0xC7, 0xE6, 0xF9, 0xFB, 0xF8, 0xFA, 0xFA, 0xFA, 0xFA, 0xFB, 0xF6, 0xEC, 0xFE,
+  0x40, 0x86, 0xE6, 0x65, 0x29, 0x0B, 0x06, 0x02, 0x02, 0xC0, 0x02, 0x81, 0x02, 0x07, 0x01, 0x82, 0x16, 0x99, 0xD8, 0x42, 0x86, 0xF5, 0xD0, 0xBC,
+  0xC1, 0xBF, 0xB9, 0xD7, 0x41, 0x82, 0xE0, 0xD7, 0xFA, 0x41, 0x86, 0xF6, 0xF8, 0xF9, 0xF9, 0xF7, 0xF6, 0xFB, 0x41, 0x82, 0xD9, 0x95, 0x15, 0x01,
+  0x81, 0x06, 0x02, 0xC0, 0x02, 0x81, 0x01, 0x02, 0x02, 0x82, 0x26, 0x66, 0xE9, 0x41, 0x86, 0xF1, 0xEA, 0xE7, 0xE8, 0xE7, 0xE3, 0xF4, 0x41, 0x81,
+  0xE6, 0xE1, 0x41, 0x87, 0xFD, 0xF0, 0xF2, 0xF4, 0xF4, 0xF0, 0xEB, 0xFD, 0x40, 0x82, 0xE6, 0x66, 0x25, 0x02, 0x81, 0x02, 0x01, 0xC0, 0x04, 0x82,
+  0x03, 0x0D, 0x01, 0x00, 0x83, 0x16, 0x99, 0xD8, 0xFE, 0x46, 0x86, 0xD7, 0xBB, 0xA2, 0xA2, 0xBA, 0xD8, 0xFD, 0x46, 0x82, 0xD9, 0x95, 0x15, 0x00,
+  0x82, 0x01, 0x0D, 0x03, 0xC0, 0x04, 0x81, 0x01, 0x04, 0x02, 0x82, 0x27, 0x66, 0xE9, 0x45, 0x87, 0xEC, 0x66, 0x32, 0x2B, 0x2B, 0x32, 0x65, 0xE5,
+  0x45, 0x82, 0xE6, 0x66, 0x26, 0x02, 0x81, 0x04, 0x01, 0xC0, 0x06, 0x81, 0x03, 0x0D, 0x01, 0x89, 0x16, 0x99, 0xCA, 0xC8, 0xBE, 0xBE, 0xC7, 0xC7,
+  0x97, 0x16, 0x03, 0x89, 0x15, 0x96, 0xCA, 0xCA, 0xBD, 0xBD, 0xCA, 0xCB, 0x95, 0x15, 0x00, 0x82, 0x01, 0x0D, 0x03, 0xC0, 0x06, 0x81, 0x01, 0x04,
+  0x02, 0x87, 0x27, 0x36, 0x35, 0x32, 0x32, 0x35, 0x35, 0x27, 0x05, 0x87, 0x26, 0x36, 0x36, 0x32, 0x32, 0x36, 0x36, 0x26, 0x02, 0x81, 0x04, 0x01,
+  0xC0, 0x08, 0x81, 0x02, 0x06, 0x09, 0x84, 0x07, 0x06, 0x06, 0x07, 0x01, 0x07, 0x82, 0x01, 0x06, 0x02, 0xC0, 0x09, 0x80, 0x01, 0x09, 0x83, 0x02,
+  0x02, 0x02, 0x02, 0x09, 0x80, 0x01, 0xC0, 0x0A, 0x89, 0x02, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0x03, 0x89, 0x02, 0x06, 0x08,
+  0x08, 0x07, 0x07, 0x08, 0x08, 0x06, 0x02, 0xC0, 0x0B, 0x87, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x05, 0x87, 0x01, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x01, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_MEDICINE_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x2821, 0x3862, 0x3861, 0x3061, 0x3061, 0x3861, 0x3861, 0x2841, 0x0000,
+  0x0020, 0x2965, 0x39E7, 0x39E7, 0x31A6, 0x31A6, 0x39E7, 0x39E7, 0x2965, 0x0020, 0x2020, 0x88E3, 0xC946, 0xC146, 0xA925, 0xA925,
+  0xC167, 0xD187, 0x9104, 0x1821, 0x2124, 0x9D14, 0xD6BA, 0xD6BA, 0xBDD8, 0xBDD8, 0xD6BA, 0xD6BA, 0x9D14, 0x18E3, 0x0000, 0x0000,
+  0x0000, 0x1021, 0x1041, 0x1041, 0x3882, 0xA946, 0xE9A7, 0xE166, 0xC125, 0xC125, 0xE166, 0xE966, 0xA904, 0x3861, 0x1061, 0x1904,
+  0x1904, 0x18E3, 0x4228, 0xBDF8, 0xFFFF, 0xFFFF, 0xE73D, 0xE73D, 0xFFFF, 0xFFFF, 0xBDF8, 0x4228, 0x18E3, 0x18E3, 0x18E3, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x40C3, 0x50E3, 0x50E3, 0x5904, 0x7965, 0x9165, 0x8104, 0x78C3, 0x78C3,
+  0x80E3, 0x80E3, 0x70C3, 0x50C3, 0x59C7, 0x736E, 0x73D0, 0x6B6E, 0x632C, 0x94B2, 0xA534, 0xA514, 0xA514, 0xA514, 0xA534, 0xA534,
+  0x9492, 0x6B6D, 0x632C, 0x6B6D, 0x4A69, 0x10A2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x40E3, 0x6965, 0x6965,
+  0x5104, 0x40C3, 0x4904, 0x51A6, 0x5A28, 0x5A08, 0x5A08, 0x5A28, 0x5185, 0x50C2, 0x71E7, 0xA492, 0xAD96, 0x8C71, 0x632C, 0x52AA,
+  0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x52AA, 0x52AA, 0x5AEB, 0x6B6D, 0x8430, 0x8430, 0x5AEB, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x38E3, 0x6165, 0x5965, 0x48C3, 0x4061, 0x5985, 0x83AE, 0x9CF3, 0x94B2, 0x94B2, 0x9CF3, 0x83AE, 0x5924, 0x6965, 0x9431, 0xA576,
+  0x8430, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x5AEB, 0x632C, 0x73AE, 0x7BEF, 0x52AA, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2021, 0x4082, 0x6904, 0x7945, 0x7945, 0x7104, 0x6965, 0x830C, 0xAD34, 0xC638, 0xBDF7,
+  0xBDF7, 0xC638, 0xA4F3, 0x728A, 0x7249, 0x8BD0, 0x94F4, 0x94B2, 0x8430, 0x8C71, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492, 0x9492,
+  0x9492, 0x8C51, 0x9492, 0x9492, 0x7BEF, 0x4228, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x80E4,
+  0xC166, 0xC166, 0xB926, 0xC105, 0xB208, 0xA3CF, 0x9CF3, 0xAD75, 0xBDF7, 0xB5B6, 0xB5B6, 0xBDF7, 0xAD75, 0xA513, 0x9C92, 0x8C72,
+  0xA555, 0xC619, 0xDEDB, 0xDEDB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xD6BB, 0xCE7A, 0xDEFB, 0xCE79,
+  0x94D3, 0x2124, 0x0000, 0x0020, 0x0000, 0x0000, 0x2841, 0xB946, 0xF9E9, 0xF1E8, 0xE146, 0xE905, 0xE28B, 0xC514, 0xAD75, 0xAD75,
+  0xAD34, 0xAD55, 0xAD75, 0xAD55, 0xAD75, 0xB5B6, 0xB5B7, 0x94D4, 0xAD75, 0xE71C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BF, 0xFFFF, 0xFFFF, 0xCE7A, 0x31A6, 0x0020, 0x0000, 0x0000, 0x2841, 0xA925, 0xF9C8,
+  0xF1C8, 0xD946, 0xE126, 0xDA6A, 0xC4F4, 0xAD75, 0xAD75, 0xB575, 0xB5B6, 0xAD75, 0xAD75, 0xB5B6, 0xB5B6, 0xA555, 0x94D3, 0xAD75,
+  0xE71D, 0xFFFF, 0xFFFF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xF7BF, 0xEF7E, 0xFFFF, 0xFFFF, 0xC639,
+  0x31A6, 0x0020, 0x0000, 0x0000, 0x2841, 0xA925, 0xF1C8, 0xE1A7, 0xD125, 0xD0E4, 0xCA69, 0xB4F3, 0xA534, 0xAD75, 0xB575, 0xB596,
+  0xB5B6, 0xB576, 0xAD75, 0xAD75, 0xA575, 0x94D4, 0xAD75, 0xDEDC, 0xF79E, 0xEF7E, 0xEF7E, 0xEF5E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E,
+  0xEF7E, 0xEF7E, 0xEF5E, 0xE73D, 0xFFFF, 0xFFFF, 0xC639, 0x31A6, 0x0020, 0x0000, 0x0000, 0x2841, 0xB946, 0xF9E9, 0xE9C8, 0xC905,
+  0xD905, 0xD26A, 0xBD34, 0xA534, 0xAD75, 0xB534, 0xB575, 0xB575, 0xB555, 0xAD75, 0xAD75, 0xA575, 0x94F4, 0xAD55, 0xDEBB, 0xFFDF,
+  0xF7BF, 0xEF7E, 0xEF5E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF5E, 0xDEFC, 0xFFFF, 0xFFFF, 0xCE7A, 0x31A6, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x80E4, 0xC946, 0xE1C8, 0xE967, 0xE146, 0xCA09, 0xBBD0, 0xB534, 0xAD75, 0xAD75, 0xAD75,
+  0xAD75, 0xAD75, 0xAD75, 0xBD14, 0xAC72, 0x9472, 0xA575, 0xDEFC, 0xFFBF, 0xF7BF, 0xEF7E, 0xEF5E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E,
+  0xEF5E, 0xEF7E, 0xF7BF, 0xFFDF, 0xFFFF, 0xD6BA, 0x94B3, 0x2124, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x2021,
+  0x58A3, 0xC146, 0xF9C8, 0xE1A7, 0xC966, 0xD1C7, 0xCB2D, 0xB534, 0xA534, 0xA534, 0xA534, 0xA534, 0xB514, 0xCACC, 0xBA49, 0x93AF,
+  0xA596, 0xD6FC, 0xF77E, 0xEF7E, 0xEF7E, 0xEF5E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF7E, 0xEF5E, 0xE73D, 0xFFFF, 0xFFFF, 0xDEFC, 0x630C,
+  0x2124, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x80E4, 0xC966, 0xE1C8, 0xE946, 0xE0E5, 0xD1C7, 0xBBD0, 0xBD34,
+  0xB4D3, 0xB4F3, 0xAD14, 0xC3CF, 0xE9A7, 0xD987, 0xABCF, 0xAE39, 0xE79E, 0xFFFF, 0xF7BF, 0xEF5E, 0xEF5D, 0xEF7E, 0xEF7E, 0xEF7E,
+  0xEF5E, 0xEF7E, 0xFFDF, 0xFFFF, 0xD6BA, 0x8C92, 0x10A2, 0x0020, 0x0000, 0x0000, 0x0000, 0x2020, 0x58A3, 0xC966, 0xF9A8, 0xE946,
+  0xC946, 0xC209, 0xCA6A, 0xCA69, 0xCA69, 0xBA8A, 0xD9E8, 0xF146, 0xE209, 0xAC32, 0xB65A, 0xF7FF, 0xFFFF, 0xF7BF, 0xE71D, 0xE71C,
+  0xEF7E, 0xEF7E, 0xE71D, 0xDEFC, 0xFFFF, 0xFFFF, 0xE71C, 0x632C, 0x2124, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0820, 0x80C4,
+  0xC966, 0xE1C8, 0xE9A8, 0xE967, 0xE926, 0xE926, 0xF146, 0xF146, 0xE125, 0xB905, 0x91A7, 0x7B2D, 0x8472, 0xA576, 0xD67A, 0xF7BF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x8C92, 0x10A2, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x2021,
+  0x58A3, 0xC966, 0xF9C8, 0xF9A8, 0xE967, 0xE967, 0xF987, 0xF988, 0xC925, 0x5082, 0x2062, 0x18E3, 0x1904, 0x2965, 0x630C, 0xDEFC,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x632C, 0x2124, 0x0020, 0x0000, 0x0000, 0x0800, 0x0820, 0x80E4, 0xB946,
+  0xB146, 0xA146, 0xA146, 0xB146, 0xB966, 0x80E4, 0x1020, 0x10A2, 0x8C92, 0xC638, 0xC638, 0xB5B7, 0xB5B7, 0xC638, 0xC638, 0x8C92,
+  0x10A2, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x2021, 0x3061, 0x3061, 0x2841, 0x2841, 0x3061, 0x3061, 0x2041, 0x2124, 0x31A6,
+  0x31A6, 0x2965, 0x2965, 0x31A6, 0x31A6, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_MEDICINE_44_SPANS = {
+  SPRITE_MEDICINE_44_SPAN_ROWS, SPRITE_MEDICINE_44_SPAN_OPS, SPRITE_MEDICINE_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_MEDICINE_44_ASSET = {
   SPRITE_MEDICINE_44_WIDTH, SPRITE_MEDICINE_44_HEIGHT,
-  SPRITE_MEDICINE_44_ALPHA, SPRITE_MEDICINE_44_RGB565
+  nullptr, nullptr, &SPRITE_MEDICINE_44_SPANS
 };
 
 #endif // SPRITE_MEDICINE_44_INCLUDED
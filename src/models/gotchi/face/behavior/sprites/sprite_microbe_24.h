@@ -5,70 +5,81 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from microbe_24.png (24x24)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from microbe_24.png (24x24) — RGBA multi-couleur, encodé en spans
+// 450/576 pixels visibles, 1474 bytes flash (flat : 1728). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_MICROBE_24_WIDTH = 24;
 constexpr uint16_t SPRITE_MICROBE_24_HEIGHT = 24;
 
-const uint16_t SPRITE_MICROBE_24_RGB565[] PROGMEM = {
-  0x0000, 0x5C86, 0x5407, 0x0000, 0x5C87, 0x5C87, 0x5C87, 0x5C87, 0x5C87, 0x5C87, 0x6487, 0x5C87, 0x4BE6, 0x5CA7, 0x5C47, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x554A, 0x5C87, 0x64E8, 0x5C87, 0x64A7, 0x5CA7, 0x5C87, 0x5C67, 0x5446, 0x5C66, 0x5C87, 0x64C7, 0x8E8E, 0x5C87, 0x5C87, 0x0000, 0x5C26, 0x0000, 0x554A, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x5426, 0x64C7, 0x5CA7, 0x4C05, 0x43C4, 0x3B63, 0x3B83, 0x3B83, 0x3B63, 0x3B83, 0x43A3, 0x43A4, 0x5CA7, 0x64C8, 0x5C67, 0x5CA7, 0x5C87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5C67, 0x64C7, 0x5446, 0x43A3, 0x43C3, 0x4C05, 0x5CA7, 0x64C7, 0x6D08, 0x6508, 0x64C7, 0x5446, 0x43E4, 0x3B83, 0x3B83, 0x5CA7, 0x5CA7, 0x0000, 0x5C67, 0x5C87, 0x0000, 0x7BE0, 0x0000, 0x0000,
-  0x5C67, 0x64A7, 0x4C05, 0x43A4, 0x6D29, 0x7DAA, 0x85CC, 0x962E, 0x7DAB, 0x7DAB, 0x7DAB, 0x7DAB, 0x756A, 0x5CA7, 0x43E4, 0x43E4, 0x4C05, 0x5CA7, 0x6D08, 0x5C87, 0x554A, 0x4C89, 0x0000, 0x0000,
-  0x0000, 0x6487, 0x3B63, 0x5CA7, 0x7DCB, 0x7569, 0x8E0E, 0xC715, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7DCB, 0x756A, 0x4C05, 0x3B63, 0x5C86, 0x5CA7, 0x5446, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5C67, 0x6508, 0x43E4, 0x4C05, 0x7DAB, 0x758A, 0x758A, 0x7DAB, 0x758A, 0x758A, 0x7D8A, 0x756A, 0x960E, 0xBF15, 0x7DAB, 0x7DAA, 0x5446, 0x3B83, 0x4383, 0x0000, 0x5C87, 0x5C87, 0x0000, 0x7BEF,
-  0x5C67, 0x64A8, 0x43C4, 0x3B83, 0x5C87, 0x7DAB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x7569, 0x7DAB, 0x960E, 0x758A, 0x758A, 0x7DAA, 0x4C25, 0x3B63, 0x5C87, 0x6D28, 0x5C87, 0x7BE0, 0x3BE7,
-  0x0000, 0x5467, 0x64C7, 0x5446, 0x3B63, 0x4C05, 0x7549, 0x7DAB, 0x758A, 0x758A, 0x85CC, 0x962E, 0x7D8A, 0x7569, 0x7D8A, 0x758A, 0x7D8A, 0x754A, 0x43C4, 0x4C05, 0x64A8, 0x3BE7, 0x0000, 0x0000,
-  0x554A, 0x5C87, 0x64C7, 0x64A8, 0x43E4, 0x43A4, 0x43C4, 0x64E8, 0x7DAB, 0x7D8A, 0xBEF4, 0xD778, 0xA691, 0x758A, 0x758A, 0x7DAB, 0x7D8A, 0x7DAA, 0x5CC7, 0x3B43, 0x0000, 0x0000, 0x5466, 0x64C6,
-  0x0000, 0x5C67, 0x5447, 0x4C47, 0x64A7, 0x5CA7, 0x43C4, 0x3B42, 0x64E8, 0x7DAB, 0xBEF4, 0xD778, 0xA691, 0x6D69, 0x85CC, 0xBEF4, 0xBEF4, 0x85CC, 0x6D49, 0x43C4, 0x4BE4, 0x5CA7, 0x64C7, 0x5C67,
-  0x0000, 0x0000, 0x0000, 0x5C87, 0x64C7, 0x5C87, 0x6CA8, 0x4BE4, 0x43C4, 0x6D49, 0x85CC, 0x960E, 0x7DAB, 0x7569, 0x960E, 0xD778, 0xD778, 0x960E, 0x758A, 0x4C25, 0x43E4, 0x64A7, 0x5C87, 0x5CA7,
-  0x0000, 0x3BE7, 0x7BEF, 0x5C47, 0x5C67, 0x5C87, 0x64C8, 0x5CA7, 0x3B63, 0x5466, 0x7DAA, 0x7569, 0x758A, 0x758A, 0x7DAB, 0xA691, 0xA671, 0x7D8B, 0x7DAA, 0x5CA7, 0x3B63, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C67, 0x5CA7, 0x7D4A, 0x43A4, 0x43C4, 0x7549, 0x7DAB, 0x758A, 0x7DAA, 0x758A, 0x6D49, 0x758A, 0x758A, 0x7DAB, 0x64C7, 0x3B63, 0x5C67, 0x5C87, 0x5C87,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x554A, 0x0000, 0x5387, 0x5C87, 0x5CA7, 0x3BA3, 0x5CA7, 0x7DAB, 0x7D8A, 0x6D49, 0x4BE5, 0x43A4, 0x5466, 0x758A, 0x7DAB, 0x5CA7, 0x43A3, 0x64C7, 0x6508, 0x5C87,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x554A, 0x0000, 0x5C87, 0x64C7, 0x5CA7, 0x3B62, 0x5445, 0x7DAA, 0x7DAB, 0x5446, 0x3B62, 0x3B83, 0x3B63, 0x64E8, 0x7DCB, 0x5C86, 0x3B63, 0x5CA7, 0x5C87, 0x3BE7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4C84, 0x4BE6, 0x64A8, 0x4C25, 0x43C4, 0x7549, 0x7DCB, 0x5446, 0x3B62, 0x3B83, 0x3B63, 0x64E8, 0x7DCB, 0x4C25, 0x43A4, 0x64A8, 0x5C47, 0x5C45,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x5C87, 0x64C7, 0x5C67, 0x3B42, 0x64E8, 0x7DAB, 0x6D49, 0x4BE5, 0x3BA3, 0x5446, 0x7DAA, 0x6D29, 0x3B63, 0x5446, 0x64E8, 0x64C7, 0x5C87,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554A, 0x0000, 0x5C87, 0x5CA7, 0x64C8, 0x3BA3, 0x5445, 0x7DAB, 0x758A, 0x758A, 0x756A, 0x7DAA, 0x7DAB, 0x4C25, 0x3B63, 0x6CA7, 0x5C87, 0x5C87, 0x5545,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0x4B64, 0x64A7, 0x5466, 0x3B63, 0x64E8, 0x7DCB, 0x7DAB, 0x7DCB, 0x7DAA, 0x5446, 0x3B83, 0x5C66, 0x5C87, 0x5C66, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BE7, 0x0000, 0x5C67, 0x6D28, 0x64A7, 0x43A4, 0x43E4, 0x5466, 0x64E8, 0x64C7, 0x4C05, 0x43E3, 0x4BE5, 0x64A7, 0x6508, 0x5C87, 0x53E5, 0x07E0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C46, 0x5C87, 0x5467, 0x5C87, 0x4C05, 0x3B83, 0x3B63, 0x43A3, 0x3B63, 0x5C66, 0x64C8, 0x5C26, 0x5C87, 0x5CA7, 0x0000, 0x07E0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5C67, 0x5C87, 0x5CA7, 0x5C87, 0x5C87, 0x5C87, 0x64C8, 0x5C87, 0x64E7, 0x5C87, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x554A, 0x0000, 0x5C87, 0x5C25, 0x5C87, 0x5C87, 0x5C87, 0x64E8, 0x5C67, 0x5446, 0x5C66, 0x7BEF, 0x554A, 0x0000, 0x0000
+const uint16_t SPRITE_MICROBE_24_SPAN_ROWS[] PROGMEM = {
+  0, 0, 19, 14, 44, 33, 67, 50, 87, 71, 112, 93, 129, 112, 149, 134,
+  167, 158, 185, 179, 203, 201, 224, 224, 244, 245, 265, 265, 283, 284, 295, 304,
+  316, 324, 335, 342, 356, 360, 379, 378, 400, 394, 423, 411, 447, 427, 460, 437
 };
 
-const uint8_t SPRITE_MICROBE_24_ALPHA[] PROGMEM = {
-  0x00, 0x25, 0x1F, 0x00, 0xEB, 0x6C, 0xB7, 0x97, 0x79, 0xB3, 0x35, 0xC8, 0x0A, 0x2B, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xBE, 0xFF, 0x62, 0xA2, 0xE5, 0x9D, 0xE8, 0xA6, 0xE1, 0x72, 0xFF, 0x0B, 0xD7, 0xA1, 0x00, 0x17, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x13, 0x8C, 0xFC, 0xAC, 0xFF, 0xE8, 0xFF, 0xFC, 0xFB, 0xF8, 0xF2, 0x96, 0xFF, 0x4B, 0x26, 0xF4, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8E, 0xB8, 0x73, 0xE9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0xD3, 0xE0, 0x01, 0x56, 0x44, 0x00, 0x02, 0x00, 0x00,
-  0x99, 0xC5, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x6B, 0x50, 0xFF, 0x8A, 0x03, 0x07, 0x00, 0x00,
-  0x00, 0x25, 0xD4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xF8, 0xFF, 0xAD, 0x0F, 0x00, 0x00, 0x00, 0x00,
-  0xB5, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0x33, 0x00, 0x67, 0x5A, 0x00, 0x02,
-  0x67, 0x4F, 0x62, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDC, 0xAB, 0xFF, 0x88, 0x02, 0x04,
-  0x00, 0x12, 0xC5, 0xFF, 0xF9, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0x6F, 0x04, 0x00, 0x00,
-  0x03, 0xBF, 0xFF, 0x3A, 0x47, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xDE, 0x00, 0x00, 0x20, 0x0A,
-  0x00, 0x57, 0x3D, 0x0D, 0xCC, 0xF8, 0xBF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xA7, 0x98, 0xFF, 0x50,
-  0x00, 0x00, 0x00, 0x74, 0xFF, 0x2A, 0x27, 0xE4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA, 0x8E, 0x11,
-  0x00, 0x04, 0x02, 0x16, 0x28, 0x3F, 0xFF, 0xE6, 0xE8, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCF, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xAE, 0x06, 0x76, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE6, 0x22, 0x47, 0x4C,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x09, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x4B, 0xFC, 0x61, 0xA5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCD, 0x4D, 0x3D, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0E, 0x1F, 0xC7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCA, 0x1B, 0x1F, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2C, 0xFF, 0xE8, 0xED, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0x4D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5F, 0xD0, 0x21, 0xD8, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC9, 0x11, 0x4C, 0x47, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0E, 0xBF, 0xFE, 0xF9, 0xFD, 0xFF, 0xFE, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0x76, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4E, 0xFF, 0x3D, 0xAF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x87, 0xFF, 0xD4, 0x06, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x4A, 0x09, 0xE7, 0xCF, 0xF2, 0xF5, 0xFF, 0xBF, 0xD0, 0xD1, 0x13, 0x28, 0x2B, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x58, 0xF0, 0x7B, 0xB1, 0xD0, 0x42, 0xF0, 0xB0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x35, 0x11, 0xCC, 0x8B, 0x26, 0xEF, 0x3E, 0x1C, 0x29, 0x02, 0x03, 0x00, 0x00
+const uint8_t SPRITE_MICROBE_24_SPAN_OPS[] PROGMEM = {
+  0x00, 0x81, 0x25, 0x1F, 0x00, 0x8B, 0xEB, 0x6C, 0xB7, 0x97, 0x79, 0xB3, 0x35, 0xC8, 0x0A, 0x2B, 0x1F, 0x01, 0xC0, 0x81, 0x03, 0xBE, 0x40, 0x87,
+  0x62, 0xA2, 0xE5, 0x9D, 0xE8, 0xA6, 0xE1, 0x72, 0x40, 0x82, 0x0B, 0xD7, 0xA1, 0x00, 0x83, 0x17, 0x01, 0x03, 0x02, 0xC0, 0x00, 0x83, 0x13, 0x8C,
+  0xFC, 0xAC, 0x40, 0x80, 0xE8, 0x40, 0x84, 0xFC, 0xFB, 0xF8, 0xF2, 0x96, 0x40, 0x83, 0x4B, 0x26, 0xF4, 0x31, 0xC0, 0x83, 0x8E, 0xB8, 0x73, 0xE9,
+  0x40, 0x80, 0xFE, 0x47, 0x85, 0x93, 0xD3, 0xE0, 0x01, 0x56, 0x44, 0x00, 0x80, 0x02, 0xC0, 0x81, 0x99, 0xC5, 0x41, 0x80, 0xFC, 0x40, 0x80, 0xFE,
+  0x42, 0x80, 0xFE, 0x40, 0x80, 0xFC, 0x42, 0x81, 0x6B, 0x50, 0x40, 0x82, 0x8A, 0x03, 0x07, 0xC0, 0x00, 0x81, 0x25, 0xD4, 0x40, 0x80, 0xFD, 0x48,
+  0x82, 0xFC, 0xFD, 0xF8, 0x40, 0x81, 0xAD, 0x0F, 0xC0, 0x80, 0xB5, 0x42, 0x80, 0xFE, 0x49, 0x80, 0xFE, 0x40, 0x81, 0xF6, 0x33, 0x00, 0x81, 0x67,
+  0x5A, 0x00, 0x80, 0x02, 0xC0, 0x83, 0x67, 0x4F, 0x62, 0xFD, 0x4B, 0x80, 0xFD, 0x40, 0x81, 0xDC, 0xAB, 0x40, 0x82, 0x88, 0x02, 0x04, 0xC0, 0x00,
+  0x81, 0x12, 0xC5, 0x40, 0x82, 0xF9, 0xFE, 0xFC, 0x49, 0x80, 0xFE, 0x40, 0x82, 0xF6, 0x6F, 0x04, 0xC0, 0x81, 0x03, 0xBF, 0x40, 0x82, 0x3A, 0x47,
+  0xF9, 0x4A, 0x82, 0xFD, 0xFD, 0xDE, 0x01, 0x81, 0x20, 0x0A, 0xC0, 0x00, 0x87, 0x57, 0x3D, 0x0D, 0xCC, 0xF8, 0xBF, 0xF7, 0xFE, 0x48, 0x80, 0xFE,
+  0x40, 0x81, 0xA7, 0x98, 0x40, 0x80, 0x50, 0xC0, 0x02, 0x80, 0x74, 0x40, 0x82, 0x2A, 0x27, 0xE4, 0x40, 0x80, 0xFD, 0x48, 0x80, 0xFE, 0x40, 0x82,
+  0xEA, 0x8E, 0x11, 0xC0, 0x00, 0x84, 0x04, 0x02, 0x16, 0x28, 0x3F, 0x40, 0x81, 0xE6, 0xE8, 0x40, 0x80, 0xFE, 0x46, 0x80, 0xFD, 0x40, 0x80, 0xCF,
+  0xC0, 0x04, 0x85, 0x67, 0xAE, 0x06, 0x76, 0xFE, 0xFC, 0x46, 0x80, 0xFD, 0x40, 0x83, 0xE6, 0x22, 0x47, 0x4C, 0xC0, 0x02, 0x81, 0x01, 0x03, 0x00,
+  0x81, 0x09, 0xA9, 0x4E, 0x80, 0xB6, 0xC0, 0x03, 0x85, 0x03, 0x01, 0x4B, 0xFC, 0x61, 0xA5, 0x40, 0x80, 0xFC, 0x45, 0x80, 0xFD, 0x40, 0x83, 0xCD,
+  0x4D, 0x3D, 0x04, 0xC0, 0x05, 0x83, 0x07, 0x0E, 0x1F, 0xC7, 0x40, 0x80, 0xFD, 0x45, 0x80, 0xFD, 0x40, 0x83, 0xCA, 0x1B, 0x1F, 0x0B, 0xC0, 0x04,
+  0x80, 0x02, 0x00, 0x80, 0x2C, 0x40, 0x81, 0xE8, 0xED, 0x40, 0x80, 0xFE, 0x45, 0x81, 0xFC, 0xFC, 0x41, 0x80, 0x4D, 0xC0, 0x04, 0x80, 0x03, 0x00,
+  0x83, 0x5F, 0xD0, 0x21, 0xD8, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFD, 0x40, 0x84, 0xC9, 0x11, 0x4C, 0x47, 0x06, 0xC0, 0x05, 0x86, 0x01, 0x02, 0x0E,
+  0xBF, 0xFE, 0xF9, 0xFD, 0x40, 0x80, 0xFE, 0x40, 0x81, 0xFD, 0xFD, 0x41, 0x81, 0x76, 0x14, 0xC0, 0x05, 0x80, 0x04, 0x00, 0x80, 0x4E, 0x40, 0x81,
+  0x3D, 0xAF, 0x40, 0x80, 0xFE, 0x43, 0x81, 0x81, 0x87, 0x40, 0x82, 0xD4, 0x06, 0x01, 0xC0, 0x05, 0x80, 0x01, 0x00, 0x86, 0x18, 0x4A, 0x09, 0xE7,
+  0xCF, 0xF2, 0xF5, 0x40, 0x85, 0xBF, 0xD0, 0xD1, 0x13, 0x28, 0x2B, 0x00, 0x80, 0x01, 0xC0, 0x09, 0x89, 0x1B, 0xFD, 0x58, 0xF0, 0x7B, 0xB1, 0xD0,
+  0x42, 0xF0, 0xB0, 0xC0, 0x07, 0x81, 0x01, 0x03, 0x00, 0x8A, 0x35, 0x11, 0xCC, 0x8B, 0x26, 0xEF, 0x3E, 0x1C, 0x29, 0x02, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_MICROBE_24_SPAN_PX[] PROGMEM = {
+  0x08A0, 0x0880, 0x4C06, 0x21E3, 0x3B25, 0x32A4, 0x2A03, 0x3B04, 0x10E1, 0x4385, 0x0000, 0x08A1, 0x0880, 0x0000, 0x0000, 0x4365,
+  0x64E8, 0x21A2, 0x3AE4, 0x4C26, 0x32C4, 0x4BE6, 0x32C3, 0x4BC5, 0x21E3, 0x64C7, 0x0020, 0x4BC5, 0x32C4, 0x0860, 0x0000, 0x0000,
+  0x0000, 0x0040, 0x32A3, 0x5CA7, 0x32C3, 0x43C4, 0x3302, 0x3B83, 0x3B83, 0x3342, 0x3362, 0x3B62, 0x2222, 0x5CA7, 0x1942, 0x08A1,
+  0x5466, 0x10C1, 0x3263, 0x4365, 0x21C2, 0x3B42, 0x43C3, 0x4C05, 0x5CA7, 0x64C7, 0x6D08, 0x6508, 0x64C7, 0x5446, 0x43E4, 0x3B83,
+  0x19E1, 0x43C5, 0x4C06, 0x0000, 0x1982, 0x1941, 0x0000, 0x3284, 0x4B85, 0x4C05, 0x43A4, 0x6D29, 0x7DAA, 0x85CC, 0x962E, 0x7DAB,
+  0x7DAB, 0x7DAB, 0x7DAB, 0x756A, 0x5CA7, 0x43E4, 0x43E4, 0x19A2, 0x1962, 0x6D08, 0x2A63, 0x0000, 0x0020, 0x08A1, 0x2AC2, 0x5CA7,
+  0x7DCB, 0x7569, 0x8E0E, 0xC715, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7DCB, 0x756A, 0x4C05, 0x3342, 0x5C86, 0x3B24, 0x0040,
+  0x3B25, 0x6508, 0x43E4, 0x4C05, 0x7DAB, 0x758A, 0x758A, 0x7DAB, 0x758A, 0x758A, 0x7D8A, 0x756A, 0x960E, 0xBF15, 0x7DAB, 0x7DAA,
+  0x5446, 0x3362, 0x08A0, 0x21C2, 0x1982, 0x0000, 0x21C2, 0x1962, 0x1961, 0x3B83, 0x5C87, 0x7DAB, 0x7DAA, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x7569, 0x7DAB, 0x960E, 0x758A, 0x758A, 0x7DAA, 0x4C25, 0x32E2, 0x3AE4, 0x6D28, 0x2A63, 0x0000, 0x0000, 0x0040, 0x4BA5,
+  0x5446, 0x3342, 0x4C05, 0x7549, 0x7DAB, 0x758A, 0x758A, 0x85CC, 0x962E, 0x7D8A, 0x7569, 0x7D8A, 0x758A, 0x7D8A, 0x754A, 0x43C4,
+  0x43E4, 0x2A03, 0x0000, 0x0000, 0x4365, 0x64C7, 0x1101, 0x1101, 0x3B83, 0x43C4, 0x64E8, 0x7DAB, 0x7D8A, 0xBEF4, 0xD778, 0xA691,
+  0x758A, 0x758A, 0x7DAB, 0x7D8A, 0x7DAA, 0x5CC7, 0x32C2, 0x0880, 0x0020, 0x1982, 0x1101, 0x0040, 0x4BC5, 0x5466, 0x32C3, 0x3321,
+  0x64E8, 0x7DAB, 0xBEF4, 0xD778, 0xA691, 0x6D69, 0x85CC, 0xBEF4, 0xBEF4, 0x85CC, 0x6D49, 0x43C4, 0x2A82, 0x32A4, 0x64C7, 0x1942,
+  0x2A03, 0x64C7, 0x08A1, 0x10A1, 0x4383, 0x43C4, 0x6D49, 0x85CC, 0x960E, 0x7DAB, 0x7569, 0x960E, 0xD778, 0xD778, 0x960E, 0x758A,
+  0x4C25, 0x43E4, 0x5426, 0x3283, 0x0040, 0x0000, 0x0000, 0x0860, 0x08A1, 0x1121, 0x64C8, 0x4C26, 0x3302, 0x5466, 0x7DAA, 0x7569,
+  0x758A, 0x758A, 0x7DAB, 0xA691, 0xA671, 0x7D8B, 0x7DAA, 0x5CA7, 0x2AA2, 0x21C2, 0x3B24, 0x0020, 0x19A1, 0x43C4, 0x7549, 0x7DAB,
+  0x758A, 0x7DAA, 0x758A, 0x6D49, 0x758A, 0x758A, 0x7DAB, 0x64C7, 0x3302, 0x0880, 0x1941, 0x1962, 0x0000, 0x0000, 0x0000, 0x3AE4,
+  0x5CA7, 0x3BA3, 0x5CA7, 0x7DAB, 0x7D8A, 0x6D49, 0x4BE5, 0x43A4, 0x5466, 0x758A, 0x7DAB, 0x5CA7, 0x43A3, 0x64C7, 0x6508, 0x3B25,
+  0x0000, 0x0000, 0x1941, 0x64C7, 0x21A2, 0x2221, 0x5445, 0x7DAA, 0x7DAB, 0x5446, 0x3B62, 0x3B83, 0x3B63, 0x64E8, 0x7DCB, 0x5C86,
+  0x2AA2, 0x1962, 0x1121, 0x0000, 0x0020, 0x0020, 0x0881, 0x3B23, 0x43C4, 0x7549, 0x7DCB, 0x5446, 0x3B62, 0x3B83, 0x3B63, 0x64E8,
+  0x7DCB, 0x4C25, 0x32C3, 0x0860, 0x0880, 0x0020, 0x0000, 0x10C1, 0x64C7, 0x4BE6, 0x3301, 0x64E8, 0x7DAB, 0x6D49, 0x4BE5, 0x3BA3,
+  0x5446, 0x7DAA, 0x6D29, 0x3B63, 0x5446, 0x64E8, 0x64C7, 0x1962, 0x0000, 0x21A2, 0x43C5, 0x0881, 0x2B02, 0x5445, 0x7DAB, 0x758A,
+  0x758A, 0x756A, 0x7DAA, 0x7DAB, 0x4C25, 0x2AA2, 0x0040, 0x1962, 0x1941, 0x0020, 0x0000, 0x0000, 0x0020, 0x4B65, 0x5466, 0x3342,
+  0x64E8, 0x7DCB, 0x7DAB, 0x7DCB, 0x7DAA, 0x5446, 0x3B83, 0x5C66, 0x2A03, 0x0860, 0x0000, 0x1942, 0x6D28, 0x1921, 0x2A62, 0x43E4,
+  0x5466, 0x64E8, 0x64C7, 0x4C05, 0x43E3, 0x21E2, 0x3263, 0x6508, 0x4BC5, 0x0000, 0x0000, 0x0000, 0x0860, 0x1941, 0x0020, 0x4C06,
+  0x3B44, 0x3342, 0x3342, 0x43A3, 0x2A82, 0x4384, 0x4BC6, 0x0040, 0x08A1, 0x08A1, 0x0000, 0x0860, 0x5C87, 0x1982, 0x5426, 0x2A03,
+  0x3B04, 0x4BC6, 0x1121, 0x5C86, 0x3B04, 0x0000, 0x0000, 0x10E1, 0x0040, 0x43A5, 0x2A63, 0x08A1, 0x5C87, 0x1101, 0x0880, 0x08A0,
+  0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_MICROBE_24_SPANS = {
+  SPRITE_MICROBE_24_SPAN_ROWS, SPRITE_MICROBE_24_SPAN_OPS, SPRITE_MICROBE_24_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_MICROBE_24_ASSET = {
   SPRITE_MICROBE_24_WIDTH, SPRITE_MICROBE_24_HEIGHT,
-  SPRITE_MICROBE_24_ALPHA, SPRITE_MICROBE_24_RGB565
+  nullptr, nullptr, &SPRITE_MICROBE_24_SPANS
 };
 
 #endif // SPRITE_MICROBE_24_INCLUDED
@@ -5,66 +5,75 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from note_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from note_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 348/484 pixels visibles, 1272 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_NOTE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_NOTE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_NOTE_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x659D, 0x657D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x5D9E, 0x5DBE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x659E, 0x65BF, 0x65BF, 0x65BE, 0x659E, 0x5D9E, 0x5D9E,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x5D7D, 0x661F, 0x65DF, 0x65DF, 0x65BF, 0x65BE, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x659E, 0x65BE, 0x65BF, 0x65DF, 0x65DF, 0x65BE, 0x5D9E, 0x5D7D, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x5D9E, 0x5D9E, 0x65DF, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D5D, 0x5D7D, 0x6DBF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5D5D, 0x65DF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x661F, 0x5D5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x5555, 0x3DFF, 0x7DFF, 0x555F, 0x5D5D, 0x65DF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x661F, 0x5D7D, 0x3DFF, 0x6DBF, 0x7BFF, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x7DFF, 0x0000, 0x5D5D, 0x65DF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x661F, 0x5D7D, 0x0000, 0x7DFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7DFF, 0x0000, 0x5D5D, 0x65DF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x661F, 0x5D7D, 0x0000, 0x7DFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x7EBF, 0x7BFF, 0x5D5D, 0x65DF, 0x5D7D,
-  0x0000, 0x0000, 0x0000, 0x000F, 0x07FF, 0x07FF, 0x5D7D, 0x661F, 0x5D7D, 0x0000, 0x7DFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x5D7D, 0x65DF, 0x5D7D,
-  0x0000, 0x7BFF, 0x555F, 0x0000, 0x0000, 0x07FF, 0x5D7D, 0x661F, 0x5D7D, 0x0000, 0x7DFF, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x65BE, 0x65FF, 0x5D7E, 0x5D7D, 0x65DF, 0x5D7D,
-  0x7FFF, 0x0000, 0x0000, 0x4C9B, 0x5DFF, 0x0000, 0x5D7D, 0x661F, 0x5D7D, 0x0000, 0x7DFF, 0x0000, 0x07FF, 0x0000, 0x5D5D, 0x5D9E, 0x5D9E, 0x5D9E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x0000, 0x555C, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65FF, 0x5D7D, 0x0000, 0x7DFF, 0x07FF, 0x07FF, 0x5D7D, 0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x5D7D, 0x5D9E, 0x65DF, 0x5D9E, 0x5D9E, 0x65BE, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x7DFF, 0x3DFF, 0x0000, 0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x5D7D, 0x65BE, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x7DFF, 0x7DFF, 0x0000, 0x5D7D, 0x65DF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
-  0x5D7D, 0x5D5D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D5D, 0x0000, 0x7DFF, 0x3DFF, 0x0000, 0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x5D7D,
-  0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65DF, 0x5D7D, 0x0000, 0x7DFF, 0x07FF, 0x07FF, 0x5D7D, 0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BE, 0x65BE, 0x5D7D,
-  0x5D7D, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x5D7D, 0x5D7D, 0x001F, 0x03FF, 0x0000, 0x03EF, 0x0000, 0x5D9D, 0x5D9E, 0x5D9E, 0x5D9E, 0x5D7D, 0x659E, 0x5D5C, 0x0000,
-  0x7BFF, 0x5D7D, 0x659E, 0x65BE, 0x65BF, 0x659E, 0x659E, 0x5D5D, 0x0000, 0x03FF, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x5DBE, 0x65BF, 0x659D, 0x3BF7, 0x0000, 0x7BFF,
-  0x0000, 0x0000, 0x5D7D, 0x5D7D, 0x659E, 0x5D9E, 0x3CF7, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000
+const uint16_t SPRITE_NOTE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 13, 10, 29, 27, 45, 46, 67, 64, 81, 82, 102, 100, 124, 113,
+  146, 126, 171, 140, 194, 150, 217, 162, 240, 174, 267, 188, 296, 204, 319, 224,
+  347, 244, 370, 264, 395, 284, 420, 305, 446, 324, 470, 339
 };
 
-const uint8_t SPRITE_NOTE_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x36, 0x54, 0x6F, 0x8E, 0xAF, 0xC8, 0xE7, 0xCC,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x5D, 0x79, 0x94, 0xB3, 0xC9, 0xDE, 0xF2, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFC, 0xFD, 0xFE, 0xFE,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xDF, 0xFC, 0xF9, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xDA, 0xFF, 0xFB, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xDC, 0xC7, 0xAC, 0x8E, 0x77, 0x50, 0x95, 0xFF, 0xFB,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD9, 0xFF, 0xC0, 0x61, 0x48, 0x2B, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFF, 0xFA,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD7, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x08, 0x03, 0x73, 0xFF, 0xFA,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD7, 0xFF, 0x8E, 0x04, 0x07, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x71, 0xFF, 0xFA,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD7, 0xFF, 0x8C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x71, 0xFF, 0xFA,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xD7, 0xFF, 0x8C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x02, 0x72, 0xFF, 0xFA,
-  0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0xD7, 0xFF, 0x8C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFA,
-  0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0xD8, 0xFF, 0x8C, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1C, 0x32, 0x26, 0x78, 0xFF, 0xFA,
-  0x02, 0x00, 0x00, 0x07, 0x08, 0x00, 0xD4, 0xFF, 0x8C, 0x00, 0x04, 0x00, 0x01, 0x00, 0x1B, 0xA8, 0xF2, 0xFF, 0xFC, 0xF0, 0xFF, 0xFF,
-  0x00, 0x2C, 0xA4, 0xDF, 0xE5, 0xCC, 0xED, 0xFF, 0x8D, 0x00, 0x04, 0x01, 0x01, 0x10, 0xD6, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x3C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8E, 0x00, 0x04, 0x04, 0x00, 0x6F, 0xFF, 0xF8, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFE,
-  0xD6, 0xFF, 0xFA, 0xFE, 0xFE, 0xFD, 0xFA, 0xFF, 0x8D, 0x00, 0x04, 0x04, 0x00, 0x95, 0xFC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x90, 0x00, 0x04, 0x04, 0x00, 0x6F, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0xFC, 0xFE, 0xEA,
-  0xF6, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x04, 0x01, 0x01, 0x10, 0xD6, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0x60,
-  0x87, 0xFF, 0xFF, 0xFC, 0xFC, 0xFC, 0xFF, 0xF3, 0x22, 0x01, 0x02, 0x00, 0x02, 0x00, 0x1B, 0xA9, 0xF3, 0xFF, 0xFF, 0xD5, 0x58, 0x00,
-  0x02, 0x87, 0xF3, 0xFF, 0xFF, 0xFF, 0xD3, 0x3D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1C, 0x2E, 0x2A, 0x04, 0x00, 0x02,
-  0x00, 0x00, 0x28, 0x63, 0x69, 0x4E, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00
+const uint8_t SPRITE_NOTE_22_SPAN_OPS[] PROGMEM = {
+  0x0B, 0x89, 0x0D, 0x1D, 0x36, 0x54, 0x6F, 0x8E, 0xAF, 0xC8, 0xE7, 0xCC, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x88, 0x1A, 0x5D, 0x79, 0x94, 0xB3, 0xC9,
+  0xDE, 0xF2, 0xFD, 0x46, 0xC0, 0x02, 0x83, 0x01, 0x01, 0x01, 0xC9, 0x47, 0x86, 0xFE, 0xFC, 0xFC, 0xFC, 0xFD, 0xFE, 0xFE, 0xC0, 0x02, 0x80, 0x01,
+  0x00, 0x8E, 0x01, 0xDF, 0xFC, 0xF9, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFC, 0xFE, 0x41, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81,
+  0x01, 0xDA, 0x40, 0x82, 0xFB, 0xFB, 0xFD, 0x4A, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xDB, 0x44, 0x87, 0xF1, 0xDC, 0xC7, 0xAC, 0x8E, 0x77,
+  0x50, 0x95, 0x40, 0x80, 0xFB, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xD9, 0x40, 0x85, 0xC0, 0x61, 0x48, 0x2B, 0x19, 0x07, 0x04, 0x80, 0x6A,
+  0x40, 0x80, 0xFA, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xD7, 0x40, 0x80, 0x84, 0x04, 0x85, 0x01, 0x03, 0x04, 0x08, 0x03, 0x73, 0x40, 0x80,
+  0xFA, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xD7, 0x40, 0x85, 0x8E, 0x04, 0x07, 0x02, 0x01, 0x01, 0x02, 0x80, 0x04, 0x00, 0x80, 0x71, 0x40,
+  0x80, 0xFA, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xD7, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x04, 0x05, 0x80, 0x04, 0x00, 0x80, 0x71, 0x40, 0x80,
+  0xFA, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x01, 0xD7, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x04, 0x04, 0x83, 0x02, 0x06, 0x02, 0x72, 0x40, 0x80, 0xFA,
+  0xC0, 0x02, 0x83, 0x02, 0x01, 0x01, 0xD7, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x04, 0x02, 0x81, 0x01, 0x02, 0x02, 0x80, 0x6F, 0x40, 0x80, 0xFA, 0xC0,
+  0x00, 0x81, 0x02, 0x03, 0x01, 0x81, 0x01, 0xD8, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x04, 0x01, 0x80, 0x01, 0x01, 0x83, 0x1C, 0x32, 0x26, 0x78, 0x40,
+  0x80, 0xFA, 0xC0, 0x80, 0x02, 0x01, 0x81, 0x07, 0x08, 0x00, 0x80, 0xD4, 0x40, 0x80, 0x8C, 0x00, 0x80, 0x04, 0x00, 0x80, 0x01, 0x00, 0x82, 0x1B,
+  0xA8, 0xF2, 0x40, 0x81, 0xFC, 0xF0, 0x41, 0xC0, 0x00, 0x85, 0x2C, 0xA4, 0xDF, 0xE5, 0xCC, 0xED, 0x40, 0x80, 0x8D, 0x00, 0x84, 0x04, 0x01, 0x01,
+  0x10, 0xD6, 0x41, 0x80, 0xFE, 0x43, 0xC0, 0x81, 0x3C, 0xF0, 0x43, 0x80, 0xFE, 0x40, 0x80, 0x8E, 0x00, 0x81, 0x04, 0x04, 0x00, 0x80, 0x6F, 0x40,
+  0x81, 0xF8, 0xFE, 0x40, 0x81, 0xFE, 0xFE, 0x40, 0x80, 0xFE, 0xC0, 0x80, 0xD6, 0x40, 0x84, 0xFA, 0xFE, 0xFE, 0xFD, 0xFA, 0x40, 0x80, 0x8D, 0x00,
+  0x81, 0x04, 0x04, 0x00, 0x82, 0x95, 0xFC, 0xFB, 0x45, 0xC0, 0x40, 0x80, 0xFE, 0x43, 0x82, 0xFB, 0xFE, 0x90, 0x00, 0x81, 0x04, 0x04, 0x00, 0x80,
+  0x6F, 0x40, 0x81, 0xF8, 0xFE, 0x41, 0x82, 0xFC, 0xFE, 0xEA, 0xC0, 0x82, 0xF6, 0xFC, 0xFE, 0x42, 0x80, 0xF9, 0x40, 0x80, 0x80, 0x00, 0x84, 0x04,
+  0x01, 0x01, 0x10, 0xD6, 0x41, 0x81, 0xFE, 0xFE, 0x41, 0x80, 0x60, 0xC0, 0x80, 0x87, 0x41, 0x82, 0xFC, 0xFC, 0xFC, 0x40, 0x83, 0xF3, 0x22, 0x01,
+  0x02, 0x00, 0x80, 0x02, 0x00, 0x82, 0x1B, 0xA9, 0xF3, 0x41, 0x81, 0xD5, 0x58, 0xC0, 0x82, 0x02, 0x87, 0xF3, 0x42, 0x81, 0xD3, 0x3D, 0x00, 0x80,
+  0x02, 0x02, 0x80, 0x01, 0x01, 0x83, 0x1C, 0x2E, 0x2A, 0x04, 0x00, 0x80, 0x02, 0xC0, 0x01, 0x84, 0x28, 0x63, 0x69, 0x4E, 0x08, 0x00, 0x80, 0x02,
+  0x04, 0x81, 0x02, 0x02, 0x03, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_NOTE_22_SPAN_PX[] PROGMEM = {
+  0x0041, 0x08A3, 0x1126, 0x19C9, 0x224C, 0x3310, 0x3BB3, 0x4436, 0x4CDA, 0x4457, 0x0000, 0x0882, 0x220B, 0x2A8D, 0x3331, 0x3BB3,
+  0x4436, 0x4CB9, 0x551B, 0x5D7D, 0x659E, 0x65BF, 0x65BF, 0x65BE, 0x659E, 0x5D9E, 0x5D9E, 0x0000, 0x0000, 0x0000, 0x4436, 0x661F,
+  0x65DF, 0x65DF, 0x65BF, 0x65BE, 0x659E, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x0000, 0x0000,
+  0x4CB9, 0x659E, 0x553C, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x553C, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
+  0x0000, 0x0000, 0x4C98, 0x659E, 0x553C, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x659E, 0x65BE, 0x65BF, 0x65DF, 0x65DF, 0x65BE, 0x5D9E,
+  0x5D7D, 0x5D7D, 0x0000, 0x0000, 0x4C98, 0x5D9E, 0x5D9E, 0x65DF, 0x659E, 0x5D7D, 0x551B, 0x4CB9, 0x4436, 0x3BB3, 0x3310, 0x2A8D,
+  0x19A9, 0x3331, 0x65BF, 0x553C, 0x0000, 0x0000, 0x4C98, 0x65DF, 0x4415, 0x220A, 0x1988, 0x08C4, 0x0882, 0x0020, 0x222B, 0x65DF,
+  0x553C, 0x0000, 0x0000, 0x4C98, 0x661F, 0x2ACF, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x224C, 0x65DF, 0x553C, 0x0000, 0x0000,
+  0x4C98, 0x661F, 0x3310, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x224C, 0x65DF, 0x553C, 0x0000, 0x0000, 0x4C98, 0x661F,
+  0x3310, 0x0020, 0x0020, 0x224C, 0x65DF, 0x553C, 0x0000, 0x0000, 0x4C98, 0x661F, 0x3310, 0x0020, 0x0000, 0x0020, 0x0000, 0x224C,
+  0x65DF, 0x553C, 0x0000, 0x0000, 0x0000, 0x4C98, 0x661F, 0x3310, 0x0020, 0x0000, 0x0000, 0x224C, 0x65DF, 0x553C, 0x0000, 0x0000,
+  0x0000, 0x4C98, 0x661F, 0x3310, 0x0020, 0x0000, 0x08A3, 0x1105, 0x08C4, 0x2A8D, 0x65DF, 0x553C, 0x0000, 0x0020, 0x0020, 0x4C98,
+  0x661F, 0x3310, 0x0020, 0x0000, 0x0862, 0x3B93, 0x553C, 0x5D9E, 0x5D7D, 0x551B, 0x5D7D, 0x5D7D, 0x08E5, 0x3B93, 0x4CB9, 0x4CDA,
+  0x4457, 0x551B, 0x65FF, 0x3310, 0x0020, 0x0000, 0x0000, 0x0041, 0x4C98, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D,
+  0x1147, 0x553C, 0x65DF, 0x5D9E, 0x5D9E, 0x65BE, 0x5D7D, 0x65DF, 0x3310, 0x0020, 0x0020, 0x224C, 0x65FF, 0x553C, 0x5D7D, 0x5D7D,
+  0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x4C98, 0x65BE, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x65DF, 0x3310, 0x0020, 0x0020, 0x3331,
+  0x65DF, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D5D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x553C, 0x65DF,
+  0x32F0, 0x0020, 0x0020, 0x224C, 0x65FF, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D9E, 0x4CDA, 0x553C, 0x5D7D, 0x5D7D, 0x5D7D,
+  0x5D7D, 0x5D7D, 0x553C, 0x65DF, 0x2AAE, 0x0020, 0x0000, 0x0000, 0x0041, 0x4C98, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BE, 0x65BE,
+  0x220A, 0x2ACF, 0x65FF, 0x5D7D, 0x5D7D, 0x5D7D, 0x5D7D, 0x65BF, 0x551B, 0x08A3, 0x0000, 0x0000, 0x0000, 0x0882, 0x3B93, 0x553C,
+  0x5D9E, 0x5D7D, 0x54B9, 0x19C9, 0x0000, 0x2ACF, 0x5D3C, 0x65BE, 0x65BF, 0x659E, 0x4C78, 0x1147, 0x0000, 0x0000, 0x08A3, 0x1105,
+  0x08C4, 0x0000, 0x0000, 0x08C4, 0x220A, 0x222C, 0x19A9, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_NOTE_22_SPANS = {
+  SPRITE_NOTE_22_SPAN_ROWS, SPRITE_NOTE_22_SPAN_OPS, SPRITE_NOTE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_NOTE_22_ASSET = {
   SPRITE_NOTE_22_WIDTH, SPRITE_NOTE_22_HEIGHT,
-  SPRITE_NOTE_22_ALPHA, SPRITE_NOTE_22_RGB565
+  nullptr, nullptr, &SPRITE_NOTE_22_SPANS
 };
 
 #endif // SPRITE_NOTE_22_INCLUDED
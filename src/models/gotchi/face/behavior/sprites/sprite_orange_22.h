@@ -5,66 +5,74 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from orange_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from orange_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 424/484 pixels visibles, 1287 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_ORANGE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_ORANGE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_ORANGE_22_RGB565[] PROGMEM = {
-  0x6180, 0x79E0, 0x7800, 0x0000, 0x07E0, 0x0000, 0x5C87, 0x5CA7, 0x5C87, 0x5C87, 0x5C87, 0x5CA7, 0x4C88, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7BE0, 0x7BE0, 0x5C87, 0x64A7, 0x64A7, 0x5C87, 0x6487, 0x54A7, 0x64A7, 0x9C84, 0xF481, 0x9CC6, 0x0000, 0x0000, 0xFD40, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x6102, 0x6102, 0x6122, 0x0000, 0x5CA7, 0x64E8, 0x5C67, 0x5C87, 0x5487, 0x5487, 0x6C86, 0xD462, 0xFC61, 0xF481, 0xF481, 0xFCA1, 0xFC61, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000,
-  0x6102, 0x6102, 0x6902, 0x6122, 0x5C47, 0x64C7, 0x64C7, 0x6487, 0x7486, 0xA484, 0xEC81, 0xFC81, 0xF481, 0xF481, 0xFCA1, 0xFCC1, 0xFCA1, 0xF481, 0xCCC0, 0x0000, 0xFFE0, 0x0000,
-  0x0000, 0x6000, 0x6102, 0x60E2, 0x5943, 0x6A23, 0x92E3, 0xD422, 0xF481, 0xFC61, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCE1, 0xF481, 0xFCE2, 0xFFE0, 0xFFE0,
-  0x5000, 0x0000, 0x0000, 0xFFE0, 0xDBC1, 0x68E2, 0x7122, 0xF441, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCE1, 0xF481, 0xFBE0, 0xFD40,
-  0x0000, 0xFD40, 0x0000, 0xF461, 0xFCE1, 0xBB21, 0xDC01, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCE1, 0xF461, 0x0000,
-  0xFD40, 0x0000, 0xF481, 0xFCA1, 0xF461, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFC81, 0xF461, 0xF481,
-  0xFD40, 0x0000, 0xF481, 0xFCC1, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xF461,
-  0x0000, 0xE463, 0xF461, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF481,
-  0x0000, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
-  0x0000, 0xF461, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
-  0x0000, 0xF481, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
-  0x0000, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
-  0x0000, 0xFB20, 0xF461, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF481,
-  0xFBE0, 0x0000, 0xF481, 0xFCC1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1, 0xF481,
-  0xFAA0, 0x0000, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461, 0xFCA1,
-  0x0000, 0xFD40, 0x0000, 0xF461, 0xFCE1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xF461, 0x0000,
-  0x0000, 0xF800, 0xFD40, 0xFD40, 0xF461, 0xFCE1, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCE1, 0xF461, 0x0000, 0xFD40,
-  0x0000, 0x0000, 0xFFE0, 0x0000, 0xEC42, 0xFC81, 0xFCE1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1, 0xFCC1, 0xF481, 0xFFE0, 0xAAA0, 0xF800,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFBE0, 0xF481, 0xFC81, 0xFCA1, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xFCA1, 0xFC81, 0xF481, 0x0000, 0x7BE0, 0xF800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0xEC61, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF421, 0x0000, 0xFBE0, 0xF800, 0x0000, 0x0000
+const uint16_t SPRITE_ORANGE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 21, 15, 36, 29, 60, 46, 78, 66, 97, 87, 115, 107, 130, 127,
+  145, 148, 160, 169, 173, 190, 184, 211, 192, 232, 200, 253, 211, 274, 223, 295,
+  238, 316, 253, 337, 270, 356, 291, 376, 314, 395, 331, 411
 };
 
-const uint8_t SPRITE_ORANGE_22_ALPHA[] PROGMEM = {
-  0x05, 0x04, 0x02, 0x01, 0x01, 0x00, 0x55, 0xC0, 0xE9, 0xEF, 0xE1, 0xC5, 0x6A, 0x00, 0x01, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x02, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x21, 0x05, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x95, 0x77, 0x2F, 0x00, 0x86, 0xFF, 0xFB, 0xFD, 0xFE, 0xFE, 0xFE, 0xFB, 0xFA, 0xF9, 0xD7, 0x8D, 0x2B, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0xBA, 0xEF, 0xFF, 0xDA, 0xFA, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x86, 0x05, 0x00, 0x01, 0x00,
-  0x00, 0x05, 0x40, 0xA5, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xBA, 0x0D, 0x01, 0x01,
-  0x03, 0x00, 0x00, 0x03, 0xDC, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xB8, 0x02, 0x03,
-  0x00, 0x03, 0x01, 0xA6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x75, 0x00,
-  0x03, 0x00, 0x3A, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF0, 0x1C,
-  0x03, 0x00, 0xA1, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x7D,
-  0x00, 0x09, 0xE1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCB,
-  0x00, 0x26, 0xFC, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
-  0x00, 0x32, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x31, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x22, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE,
-  0x00, 0x05, 0xDA, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xC1,
-  0x04, 0x00, 0x91, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x6C,
-  0x03, 0x00, 0x2A, 0xFA, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE4, 0x11,
-  0x00, 0x03, 0x00, 0x88, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0x5B, 0x00,
-  0x00, 0x01, 0x03, 0x06, 0xBC, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xFF, 0x99, 0x00, 0x03,
-  0x00, 0x00, 0x01, 0x00, 0x0D, 0xB8, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFF, 0xFF, 0x99, 0x01, 0x03, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x78, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x5F, 0x00, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x20, 0x7E, 0xCA, 0xF4, 0xFF, 0xFF, 0xEF, 0xBF, 0x6B, 0x11, 0x00, 0x02, 0x01, 0x00, 0x00
+const uint8_t SPRITE_ORANGE_22_SPAN_OPS[] PROGMEM = {
+  0x84, 0x05, 0x04, 0x02, 0x01, 0x01, 0x00, 0x86, 0x55, 0xC0, 0xE9, 0xEF, 0xE1, 0xC5, 0x6A, 0x00, 0x82, 0x01, 0x04, 0x02, 0xC0, 0x02, 0x82, 0x02,
+  0x02, 0x96, 0x45, 0x82, 0x73, 0x21, 0x05, 0x01, 0x81, 0x03, 0x01, 0xC0, 0x82, 0x95, 0x77, 0x2F, 0x00, 0x80, 0x86, 0x40, 0x8A, 0xFB, 0xFD, 0xFE,
+  0xFE, 0xFE, 0xFB, 0xFA, 0xF9, 0xD7, 0x8D, 0x2B, 0x01, 0x80, 0x01, 0xC0, 0x81, 0xBA, 0xEF, 0x40, 0x83, 0xDA, 0xFA, 0xFC, 0xFE, 0x48, 0x82, 0xF8,
+  0x86, 0x05, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x84, 0x05, 0x40, 0xA5, 0xF0, 0xFE, 0x46, 0x82, 0xFE, 0xFD, 0xFB, 0x41, 0x83, 0xBA, 0x0D, 0x01, 0x01,
+  0xC0, 0x80, 0x03, 0x01, 0x83, 0x03, 0xDC, 0xFE, 0xFD, 0x48, 0x81, 0xFE, 0xFA, 0x40, 0x82, 0xB8, 0x02, 0x03, 0xC0, 0x00, 0x82, 0x03, 0x01, 0xA6,
+  0x40, 0x80, 0xFC, 0x4B, 0x80, 0xFA, 0x40, 0x80, 0x75, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x3A, 0x40, 0x80, 0xFD, 0x4C, 0x83, 0xFE, 0xFD, 0xF0, 0x1C,
+  0xC0, 0x80, 0x03, 0x00, 0x80, 0xA1, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFC, 0x40, 0x80, 0x7D, 0xC0, 0x00, 0x81, 0x09, 0xE1, 0x40, 0x80, 0xFD, 0x4D,
+  0x82, 0xFD, 0xFE, 0xCB, 0xC0, 0x00, 0x81, 0x26, 0xFC, 0x40, 0x80, 0xFE, 0x4F, 0x80, 0xF3, 0xC0, 0x00, 0x80, 0x32, 0x40, 0x80, 0xFE, 0x51, 0xC0,
+  0x00, 0x80, 0x31, 0x40, 0x80, 0xFE, 0x51, 0xC0, 0x00, 0x81, 0x22, 0xF9, 0x40, 0x80, 0xFE, 0x4F, 0x80, 0xEE, 0xC0, 0x00, 0x83, 0x05, 0xDA, 0xFE,
+  0xFD, 0x4D, 0x82, 0xFD, 0xFE, 0xC1, 0xC0, 0x80, 0x04, 0x00, 0x80, 0x91, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFD, 0x40, 0x80, 0x6C, 0xC0, 0x80, 0x03,
+  0x00, 0x83, 0x2A, 0xFA, 0xFC, 0xFE, 0x4B, 0x83, 0xFD, 0xFE, 0xE4, 0x11, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x80, 0x88, 0x40, 0x80, 0xFA, 0x4A, 0x81,
+  0xFE, 0xFA, 0x40, 0x80, 0x5B, 0xC0, 0x00, 0x83, 0x01, 0x03, 0x06, 0xBC, 0x40, 0x81, 0xFA, 0xFE, 0x47, 0x81, 0xFD, 0xFA, 0x40, 0x80, 0x99, 0x00,
+  0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x81, 0x0D, 0xB8, 0x41, 0x81, 0xFC, 0xFD, 0x42, 0x82, 0xFE, 0xFD, 0xFD, 0x41, 0x83, 0x99, 0x01, 0x03,
+  0x01, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x82, 0x02, 0x78, 0xEB, 0x47, 0x81, 0xDE, 0x5F, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x03, 0x80, 0x01, 0x01, 0x83,
+  0x20, 0x7E, 0xCA, 0xF4, 0x41, 0x83, 0xEF, 0xBF, 0x6B, 0x11, 0x00, 0x81, 0x02, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_ORANGE_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1982, 0x4365, 0x4C06, 0x5426, 0x4BE6, 0x4385, 0x19C3, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x32A4, 0x64A7, 0x64A7, 0x5C87, 0x6487, 0x54A7, 0x64A7, 0x41E1, 0x1880, 0x0020, 0x0000, 0x0000, 0x3881, 0x2860, 0x1020,
+  0x2A63, 0x64E8, 0x5426, 0x5C87, 0x5487, 0x5487, 0x6C86, 0xCC21, 0xF420, 0xEC40, 0xCBC0, 0x8A80, 0x20A0, 0x0000, 0x40A1, 0x58E1,
+  0x6902, 0x50E1, 0x5406, 0x64C7, 0x64C7, 0x6487, 0x7486, 0xA484, 0xEC81, 0xFC81, 0xF481, 0xF481, 0xFCA1, 0xFCC1, 0xF460, 0x7A60,
+  0x0020, 0x0000, 0x0000, 0x1840, 0x3881, 0x5122, 0x6A23, 0x92E3, 0xD422, 0xF481, 0xFC61, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xEC20, 0xF481, 0xFCE1, 0xAB20, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0xBB40, 0x68E2, 0x7122, 0xF441, 0xF481, 0xF461, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC20, 0xFCE1, 0xAB20, 0x0000, 0x0000, 0x0000, 0x0000, 0x9AC0, 0xFCE1, 0xBB21,
+  0xDC01, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC20, 0xFCE1, 0x7200, 0x0000,
+  0x30E0, 0xFCA1, 0xF461, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF461, 0xFC81, 0xE400, 0x1880, 0x0000, 0x92C0, 0xFCC1, 0xEC40, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0x7A20, 0x0020, 0xD3C0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xBB80, 0x20A0, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xE400, 0x28C0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0x28C0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0x1880, 0xEC40, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xE400, 0x0000, 0xCBA0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xB360, 0x0000, 0x8280, 0xFCC1, 0xEC40, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1, 0x69E0, 0x0000, 0x20A0, 0xEC40, 0xF481,
+  0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xDBE0,
+  0x0840, 0x0000, 0x7A40, 0xFCE1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xEC40, 0xFCC1, 0x5180, 0x0000, 0x0000, 0x0020, 0xB340, 0xFCE1, 0xEC20, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xEC40, 0xFCE1, 0x8A80, 0x0000, 0x0000, 0x0840, 0xB320, 0xFCE1, 0xF481, 0xF461, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1, 0xFCC1, 0x8AA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7200, 0xE400, 0xFCA1,
+  0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xFCA1, 0xDBE0, 0x59A0, 0x0000, 0x0000, 0x0000, 0x1880, 0x7A40, 0xBB80, 0xEC40,
+  0xF481, 0xF481, 0xE420, 0xB360, 0x61C0, 0x0840, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_ORANGE_22_SPANS = {
+  SPRITE_ORANGE_22_SPAN_ROWS, SPRITE_ORANGE_22_SPAN_OPS, SPRITE_ORANGE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_ORANGE_22_ASSET = {
   SPRITE_ORANGE_22_WIDTH, SPRITE_ORANGE_22_HEIGHT,
-  SPRITE_ORANGE_22_ALPHA, SPRITE_ORANGE_22_RGB565
+  nullptr, nullptr, &SPRITE_ORANGE_22_SPANS
 };
 
 #endif // SPRITE_ORANGE_22_INCLUDED
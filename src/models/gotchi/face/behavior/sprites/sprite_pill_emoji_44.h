@@ -5,110 +5,146 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from pill_emoji_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from pill_emoji_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1259/1936 pixels visibles, 3461 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_PILL_EMOJI_44_WIDTH = 44;
 constexpr uint16_t SPRITE_PILL_EMOJI_44_HEIGHT = 44;
 
-const uint16_t SPRITE_PILL_EMOJI_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0xF800, 0x0000, 0xFE6C, 0xFE6B, 0xFE6B, 0xFE4A, 0xFE6B, 0xFE4A, 0xFE6B, 0xFE4B, 0xFE4A, 0xFE4B, 0xF64A, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFEF, 0x0000, 0x0000, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE8B, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE6B, 0xFE8B, 0xFEAB, 0xFE6B, 0xFE6B, 0xFE6C, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFBEF, 0x0000, 0xFE2A, 0xFE6B, 0xFEAB, 0xFE8B, 0xFE4B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE4B, 0xFE8B, 0xFECB, 0xFE4A, 0xFE2B, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFE0, 0xFFE0, 0xFE8B, 0xFE4B, 0xFECB, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE4A, 0xFEAB, 0xFE6B, 0xFE4B, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFBEF, 0xFFE0, 0xFE4B, 0xFECB, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE6B, 0xFE4A, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE6A, 0xFEAB, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xFE6B, 0xFE2A, 0x0000, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE8B, 0xFE4A, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xFE6B, 0xFE2A, 0x0000, 0xFDEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4B, 0xFEAB, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE6B, 0xFE4A, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4B, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xFE6B, 0xFE4A, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4A, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xFE6B, 0xFE6A, 0x0000, 0xFDEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE6B, 0xFE2A, 0x0000, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xFE6B, 0xFE2A, 0x0000, 0xBBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE4A, 0xFF2B, 0x0000, 0xBBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4B, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE2A, 0xFEEB, 0xECA9, 0xB005, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4A, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xC127, 0xB8A6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE4B, 0xFEAB, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xC0E6, 0xB8C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE6B, 0xFE4A, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB0C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE6B, 0xFECB, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB0C6, 0x0000, 0xB800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFBEF, 0xFDEB, 0xFE6B, 0xFEAB, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xF56A, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0x0000, 0x7807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFBEF, 0x0000, 0xFE6B, 0xFE4B, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB8A6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C5, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFFEF, 0x0000, 0xFE4B, 0xFE6B, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB0C6, 0x0000, 0xB800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFEA, 0x0000, 0xFE2A, 0xFE6B, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB0C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFEA, 0x0000, 0xFE2A, 0xFE6B, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB0C6, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFDEF, 0x0000, 0xFE6A, 0xFE6B, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF5AA, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0x0000, 0xF80F, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFE4A, 0xFE6B, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE0A, 0xC9E7, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8E6, 0x0000, 0x780F,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFE4A, 0xFE6B, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE0A, 0xC9E7, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8E7, 0x7800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDEF, 0x0000, 0xFE2A, 0xFE6B, 0xFE8B, 0xFE4A, 0xFE6B, 0xFE4B, 0xFE8B, 0xFDEA, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC8C7, 0xB8C6, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEA, 0x0000, 0xFE2A, 0xFE6B, 0xFE8B, 0xFE4A, 0xFE8B, 0xFDEA, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8E6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFE4A, 0xFE6B, 0xFECB, 0xFE0A, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFE4B, 0xFE2B, 0xD288, 0xB066, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0xC9A7, 0xB8C6, 0xC0E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB9E7, 0x0000, 0xB8E6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB9E7, 0x0000, 0xB0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB800, 0x0000, 0xB0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C5, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7807, 0x0000, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8E6,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB800, 0x0000, 0xB0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8A5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC8C7, 0xB8C6, 0x0000, 0x780F,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xB8C6, 0xC0E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC8E6, 0xB8C6, 0xC0E7, 0xF800, 0xF800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB0E6, 0xB8C6, 0xC0E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8E7, 0x0000, 0xF800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB0C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8E6, 0xB0C6, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_PILL_EMOJI_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 23, 14, 39, 30, 63, 49, 84, 71, 102, 94, 119, 117, 135, 142,
+  151, 168, 167, 195, 183, 223, 194, 252, 207, 282, 218, 313, 231, 345, 247, 378,
+  263, 412, 279, 447, 296, 482, 314, 519, 334, 556, 355, 593, 376, 630, 397, 667,
+  418, 704, 439, 741, 458, 778, 475, 813, 492, 848, 509, 882, 526, 915, 540, 947,
+  552, 978, 566, 1008, 578, 1037, 595, 1065, 612, 1092, 628, 1118, 645, 1143, 662, 1166,
+  682, 1188, 704, 1210, 728, 1229, 744, 1245
 };
 
-const uint8_t SPRITE_PILL_EMOJI_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x64, 0xAE, 0xE6, 0xFF, 0xFE, 0xFF, 0xF0, 0xBD, 0x78, 0x1D, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x64, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x7C, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x12, 0xA9, 0xFF, 0xFF, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0xCB, 0x28, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x01, 0x11, 0xC2, 0xFF, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xE1, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x01, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xE6, 0x33, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0B, 0xD6, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE4, 0x32, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x64, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE6, 0x33, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xB0, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xE6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE5, 0x32, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE6, 0x32, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE5, 0x33, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE4, 0x31, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xBD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE4, 0x31, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x78, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE6, 0x33, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1A, 0xE7, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7B, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE4, 0x32, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x08, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE6, 0x33, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x25, 0xE4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x33, 0xE5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE5, 0x32, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x31, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE6, 0x32, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x32, 0xE6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0x31, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x32, 0xE5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE5, 0x33, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x30, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE4, 0x2A, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xCC, 0x08, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x32, 0xE4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xE7, 0x1A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x78,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x31, 0xE4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBD,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x31, 0xE4, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x31, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x32, 0xE6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x32, 0xE5, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xE6,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x30, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xB0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x64,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x32, 0xE4, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xD7, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0xE3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x5B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE6, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xAA, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x31, 0xE2, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFF, 0xC2, 0x11, 0x01, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2D, 0xCB, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xA9, 0x12, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x7C, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x5E, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1D, 0x78, 0xBD, 0xF0, 0xFF, 0xFE, 0xFF, 0xE6, 0xAE, 0x64, 0x0A, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00
+const uint8_t SPRITE_PILL_EMOJI_44_SPAN_OPS[] PROGMEM = {
+  0x02, 0x81, 0x01, 0x01, 0x00, 0x83, 0x0A, 0x64, 0xAE, 0xE6, 0x40, 0x80, 0xFE, 0x40, 0x83, 0xF0, 0xBD, 0x78, 0x1D, 0x01, 0x80, 0x02, 0xC0, 0x01,
+  0x80, 0x02, 0x01, 0x81, 0x64, 0xD5, 0x48, 0x82, 0xE1, 0x7C, 0x0A, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x12, 0xA9, 0x41, 0x82,
+  0xFC, 0xFD, 0xFE, 0x43, 0x81, 0xFD, 0xFB, 0x41, 0x81, 0xCB, 0x28, 0x00, 0x80, 0x03, 0xC0, 0x83, 0x01, 0x01, 0x11, 0xC2, 0x40, 0x81, 0xFB, 0xFC,
+  0x48, 0x81, 0xFD, 0xFB, 0x40, 0x81, 0xE1, 0x31, 0x00, 0x80, 0x04, 0xC0, 0x82, 0x02, 0x01, 0xAA, 0x40, 0x80, 0xFB, 0x4C, 0x80, 0xFB, 0x40, 0x81,
+  0xE6, 0x33, 0x00, 0x80, 0x04, 0xC0, 0x00, 0x80, 0x60, 0x40, 0x80, 0xFB, 0x4E, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x30, 0x00, 0x80, 0x03, 0xC0, 0x83,
+  0x0B, 0xD6, 0xFE, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x81, 0xE4, 0x32, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x64, 0x40, 0x80, 0xFC, 0x51, 0x80, 0xFC, 0x40,
+  0x81, 0xE6, 0x33, 0x00, 0x80, 0x04, 0xC0, 0x80, 0xB0, 0x40, 0x80, 0xFC, 0x52, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x30, 0x00, 0x80, 0x04, 0xC0, 0x80,
+  0xE6, 0x40, 0x80, 0xFE, 0x53, 0x80, 0xFC, 0x40, 0x81, 0xE5, 0x32, 0x00, 0x80, 0x04, 0xC0, 0x57, 0x80, 0xFC, 0x40, 0x81, 0xE6, 0x32, 0x00, 0x80,
+  0x03, 0xC0, 0x80, 0xFE, 0x57, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x31, 0x00, 0x80, 0x04, 0xC0, 0x59, 0x80, 0xFC, 0x40, 0x81, 0xE5, 0x33, 0x00, 0x80,
+  0x04, 0xC0, 0x80, 0xF0, 0x59, 0x80, 0xFD, 0x40, 0x81, 0xE4, 0x31, 0x00, 0x80, 0x03, 0xC0, 0x80, 0xBD, 0x40, 0x80, 0xFD, 0x58, 0x80, 0xFC, 0x40,
+  0x81, 0xE4, 0x31, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x78, 0x40, 0x80, 0xFC, 0x59, 0x80, 0xFC, 0x40, 0x81, 0xE6, 0x33, 0x00, 0x80, 0x04, 0xC0, 0x83,
+  0x1A, 0xE7, 0xFD, 0xFD, 0x59, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x30, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x7B, 0x40, 0x80, 0xFB, 0x5A, 0x80, 0xFC,
+  0x40, 0x81, 0xE4, 0x32, 0x00, 0x80, 0x04, 0xC0, 0x82, 0x02, 0x08, 0xCA, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFC, 0x40, 0x81, 0xE6, 0x33, 0x00, 0x80,
+  0x04, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x25, 0xE4, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x30, 0x00, 0x80, 0x04, 0xC0, 0x00, 0x80,
+  0x02, 0x00, 0x81, 0x33, 0xE5, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFC, 0x40, 0x81, 0xE5, 0x32, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x81,
+  0x31, 0xE3, 0x40, 0x80, 0xFD, 0x5A, 0x80, 0xFC, 0x40, 0x81, 0xE6, 0x32, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x81, 0x32, 0xE6, 0x40,
+  0x80, 0xFC, 0x5A, 0x80, 0xFD, 0x40, 0x81, 0xE3, 0x31, 0x00, 0x80, 0x04, 0xC0, 0x03, 0x80, 0x04, 0x00, 0x81, 0x32, 0xE5, 0x40, 0x80, 0xFC, 0x5A,
+  0x80, 0xFC, 0x40, 0x81, 0xE5, 0x33, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x04, 0x00, 0x81, 0x30, 0xE3, 0x40, 0x80, 0xFD, 0x5A, 0x80, 0xFC, 0x40,
+  0x81, 0xE4, 0x2A, 0x00, 0x80, 0x02, 0xC0, 0x05, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE6, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFC, 0x40, 0x82, 0xCC, 0x08,
+  0x02, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x81, 0x32, 0xE4, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFB, 0x40, 0x80, 0x7B, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x81,
+  0x30, 0xE3, 0x40, 0x80, 0xFD, 0x59, 0x83, 0xFD, 0xFD, 0xE7, 0x1A, 0xC0, 0x08, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE6, 0x40, 0x80, 0xFC, 0x59, 0x80,
+  0xFC, 0x40, 0x80, 0x78, 0xC0, 0x09, 0x80, 0x04, 0x00, 0x81, 0x31, 0xE4, 0x40, 0x80, 0xFC, 0x58, 0x80, 0xFD, 0x40, 0x80, 0xBD, 0xC0, 0x0A, 0x80,
+  0x03, 0x00, 0x81, 0x31, 0xE4, 0x40, 0x80, 0xFD, 0x59, 0x80, 0xF0, 0xC0, 0x0B, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE5, 0x40, 0x80, 0xFC, 0x59, 0xC0,
+  0x0C, 0x80, 0x04, 0x00, 0x81, 0x31, 0xE3, 0x40, 0x80, 0xFD, 0x57, 0x80, 0xFE, 0xC0, 0x0D, 0x80, 0x03, 0x00, 0x81, 0x32, 0xE6, 0x40, 0x80, 0xFC,
+  0x57, 0xC0, 0x0E, 0x80, 0x04, 0x00, 0x81, 0x32, 0xE5, 0x40, 0x80, 0xFC, 0x53, 0x80, 0xFE, 0x40, 0x80, 0xE6, 0xC0, 0x0F, 0x80, 0x04, 0x00, 0x81,
+  0x30, 0xE3, 0x40, 0x80, 0xFD, 0x52, 0x80, 0xFC, 0x40, 0x80, 0xB0, 0xC0, 0x10, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE6, 0x40, 0x80, 0xFC, 0x51, 0x82,
+  0xFC, 0xFE, 0x64, 0xC0, 0x11, 0x80, 0x04, 0x00, 0x81, 0x32, 0xE4, 0x40, 0x80, 0xFC, 0x4F, 0x83, 0xFC, 0xFE, 0xD7, 0x0B, 0xC0, 0x12, 0x80, 0x03,
+  0x00, 0x81, 0x30, 0xE3, 0x40, 0x80, 0xFD, 0x4E, 0x80, 0xFB, 0x40, 0x80, 0x5B, 0xC0, 0x13, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE6, 0x40, 0x80, 0xFB,
+  0x4C, 0x80, 0xFB, 0x40, 0x80, 0xAA, 0x00, 0x80, 0x02, 0xC0, 0x14, 0x80, 0x04, 0x00, 0x81, 0x31, 0xE2, 0x40, 0x81, 0xFB, 0xFD, 0x48, 0x81, 0xFC,
+  0xFB, 0x40, 0x83, 0xC2, 0x11, 0x01, 0x01, 0xC0, 0x15, 0x80, 0x03, 0x00, 0x81, 0x2D, 0xCB, 0x41, 0x81, 0xFB, 0xFD, 0x43, 0x82, 0xFE, 0xFD, 0xFC,
+  0x41, 0x81, 0xA9, 0x12, 0x00, 0x80, 0x01, 0xC0, 0x16, 0x80, 0x02, 0x00, 0x82, 0x0A, 0x7C, 0xE1, 0x48, 0x81, 0xD5, 0x5E, 0x01, 0x80, 0x02, 0xC0,
+  0x17, 0x80, 0x02, 0x01, 0x83, 0x1D, 0x78, 0xBD, 0xF0, 0x40, 0x80, 0xFE, 0x40, 0x83, 0xE6, 0xAE, 0x64, 0x0A, 0x00, 0x81, 0x01, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_PILL_EMOJI_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x6284, 0xAC67, 0xE5A9, 0xFE6B, 0xFE4A, 0xFE6B, 0xEDCA, 0xBCA7, 0x72E5, 0x18C1, 0x0000, 0x0000, 0x6284,
+  0xD549, 0xFE8B, 0xFE8B, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE6B, 0xFE8B, 0xFEAB, 0xDD89, 0x7B25, 0x0020, 0x0000, 0x0000, 0x0860,
+  0xA427, 0xFEAB, 0xFE8B, 0xFE4B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xF60A, 0xFE8B, 0xFECB, 0xC4E7, 0x20E1,
+  0x0000, 0x0000, 0x0000, 0x0860, 0xBCA8, 0xFECB, 0xF62A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4A, 0xF609, 0xFEAB, 0xDD89, 0x2922, 0x0020, 0x0000, 0x0000, 0xA407, 0xFECB, 0xF609, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xF60A, 0xFE8B, 0xE5C9, 0x2921, 0x0020, 0x5A63, 0xFEAB,
+  0xF62A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4A, 0xFE8B, 0xDD89, 0x2921, 0x0000, 0x0020, 0xD548, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xE5C9, 0x2921, 0x0020, 0x6284, 0xFEAB,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xE5C9, 0x2921, 0x0020, 0xAC47, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B,
+  0xDD89, 0x2921, 0x0020, 0xE5A9, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xE5C9, 0x2921, 0x0020, 0xFE6B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xE5C9, 0x2921, 0x0000, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4A, 0xFE8B, 0xDD89, 0x2921, 0x0000, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xE5A9, 0x2942, 0x0000, 0xEDCA, 0xFE6B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE2A, 0xFEEB, 0xD428, 0x2000, 0x0000, 0xBCA7, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xC127, 0xA085, 0x2021, 0x0000, 0x72E5, 0xFEAB, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xC0E6, 0xA0A5, 0x2021, 0x0000, 0x1081, 0xE5A9, 0xFE8B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021, 0x0000, 0x72E5,
+  0xFECB, 0xF609, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xECE9, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5,
+  0x2021, 0x0000, 0x0000, 0x0020, 0xC4E8, 0xFEAB, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFEAB, 0xF56A, 0xB906, 0xB8A6, 0xB8E6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021, 0x0000, 0x0000, 0x20E1, 0xE5A9, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB8A6,
+  0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2020, 0x0000, 0x0000, 0x2922, 0xE5C9, 0xFE8B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B,
+  0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021,
+  0x0000, 0x0000, 0x2921, 0xDD89, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021, 0x0000, 0x0000, 0x2921, 0xE5C9, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF58A, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021, 0x0000, 0x0020, 0x2921, 0xE5C9, 0xFE8B, 0xFE4A,
+  0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xF5AA, 0xC167, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x2021, 0x0000,
+  0x0020, 0x2921, 0xDD89, 0xFE8B, 0xFE4A, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE0A, 0xC9E7, 0xB886, 0xB8E6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xC0C6, 0xA0A5, 0x1820, 0x0000, 0x0020, 0x2921, 0xE5C9, 0xFE8B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE4B, 0xFE8B, 0xFE0A,
+  0xC9E7, 0xB886, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0x9084, 0x0000, 0x0000, 0x0020, 0x2921, 0xE5C9, 0xFE8B, 0xFE4A, 0xFE6B,
+  0xFE4B, 0xFE8B, 0xFDEA, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB0A5, 0xC8C7, 0x5042, 0x0000, 0x2921, 0xDD89,
+  0xFE8B, 0xFE4A, 0xFE8B, 0xFDEA, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xA0A5, 0x1000,
+  0x0020, 0x2921, 0xE5C9, 0xFECB, 0xFE0A, 0xC9E7, 0xB086, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xC0E6, 0x5042, 0x0020, 0x2922, 0xE589, 0xD288, 0xB066, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xC0C6, 0x8884, 0x0000, 0x2041, 0xA0A5, 0xC0E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xA8A5, 0x0000, 0x2021, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0x0000, 0x2021, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0x0000, 0x2021, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0x0000, 0x2021, 0xA0A5,
+  0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xA0A5, 0x0000, 0x2020, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xC0C6, 0x7884, 0x0000, 0x2021, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0x4842, 0x0000, 0x2021,
+  0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0x98A5, 0x0000, 0x0000, 0x2021, 0xA0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB0A5, 0xC0C6, 0x3842, 0x0000, 0x2021,
+  0xA0A5, 0xC0C6, 0xB0A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB0A5, 0xC8C7, 0x7863, 0x0000, 0x0000, 0x2021, 0xA0A5, 0xC0E6, 0xB0A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB0A5, 0xC8E6, 0x8884, 0x0800, 0x0000, 0x0000, 0x0000, 0x2021, 0x8884, 0xC0E6, 0xB8C6, 0xB0A5,
+  0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0x7863, 0x0800, 0x0000, 0x0000, 0x0000, 0x5863,
+  0xA0A5, 0xC0E6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0x98A5, 0x4042, 0x0000, 0x0000, 0x1000, 0x5042,
+  0x8884, 0xA8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xA0A5, 0x7884, 0x4842, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_PILL_EMOJI_44_SPANS = {
+  SPRITE_PILL_EMOJI_44_SPAN_ROWS, SPRITE_PILL_EMOJI_44_SPAN_OPS, SPRITE_PILL_EMOJI_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_PILL_EMOJI_44_ASSET = {
   SPRITE_PILL_EMOJI_44_WIDTH, SPRITE_PILL_EMOJI_44_HEIGHT,
-  SPRITE_PILL_EMOJI_44_ALPHA, SPRITE_PILL_EMOJI_44_RGB565
+  nullptr, nullptr, &SPRITE_PILL_EMOJI_44_SPANS
 };
 
 #endif // SPRITE_PILL_EMOJI_44_INCLUDED
@@ -5,66 +5,67 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from pizza_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from pizza_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 300/484 pixels visibles, 1066 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_PIZZA_22_WIDTH = 22;
 constexpr uint16_t SPRITE_PIZZA_22_HEIGHT = 22;
 
-const uint16_t SPRITE_PIZZA_22_RGB565[] PROGMEM = {
-  0x0000, 0xFFE0, 0x0000, 0x0000, 0xFCE1, 0xFCA1, 0xFCA1, 0xF481, 0xF441, 0xF441, 0xF441, 0xF461, 0xF461, 0xF461, 0xF481, 0xFCA1, 0xFCA1, 0xFCE1, 0x0000, 0x0000, 0xFFE0, 0x0000,
-  0xFFE0, 0x0000, 0xE421, 0xFCA1, 0xFC81, 0xFC81, 0xFCA1, 0xFCA1, 0xFD02, 0xFD43, 0xFD23, 0xF4E3, 0xF4C2, 0xFCC2, 0xFCA1, 0xFCA1, 0xFC81, 0xFC81, 0xFCA1, 0xE421, 0x0000, 0xFFE0,
-  0xF800, 0xF4A1, 0xF481, 0xFCC1, 0xFCC2, 0xF524, 0xFDC7, 0xFE48, 0xECE8, 0xDB27, 0xE3A8, 0xFE09, 0xFE89, 0xFE29, 0xFE28, 0xFDC7, 0xF544, 0xFCC2, 0xFCC1, 0xF481, 0xF481, 0xF800,
-  0x0000, 0xF4A1, 0xF461, 0xFDA5, 0xFE69, 0xFE6A, 0xFECA, 0xECE8, 0xB886, 0xB865, 0xB025, 0xCA06, 0xFE49, 0xFE69, 0xFE49, 0xFE6A, 0xFE6A, 0xFE49, 0xFD85, 0xF461, 0xEC81, 0x0000,
-  0x0000, 0x0000, 0xEBE0, 0xF5A9, 0xFE4A, 0xFE89, 0xFEA9, 0xD287, 0xB865, 0xC0E6, 0xC0E6, 0xB886, 0xF508, 0xFEA9, 0xFEA9, 0xFEC9, 0xFE89, 0xFEAA, 0xFE69, 0xEBE0, 0x0000, 0x0000,
-  0x0000, 0xB9E7, 0x0000, 0xB865, 0xC906, 0xE468, 0xFF0A, 0xD2C7, 0xB845, 0xC0E6, 0xB8C6, 0xB886, 0xF569, 0xFE89, 0xE408, 0xDB67, 0xED08, 0xFEEA, 0xFE29, 0x0000, 0xFDE7, 0x0000,
-  0x0000, 0xF800, 0x7BE0, 0xCA66, 0xB886, 0xC106, 0xFE29, 0xF589, 0xC126, 0xB865, 0xB865, 0xD2E7, 0xFEA9, 0xD267, 0xB825, 0xB845, 0xC0C6, 0xE448, 0xFFED, 0x7BE0, 0xF800, 0x0000,
-  0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8A6, 0xF589, 0xFEA9, 0xFDC9, 0xEC68, 0xECC8, 0xFEA9, 0xF569, 0xB886, 0xB8E6, 0xB8E6, 0xC8C6, 0xB886, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xF800, 0x0000, 0xA825, 0xCA07, 0xFE49, 0xFEA9, 0xFEA9, 0xFEC9, 0xFE89, 0xFE89, 0xF569, 0xB8A6, 0xB8C6, 0xC0E6, 0xC0C6, 0xB906, 0x0000, 0xF800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0xFE09, 0xFECA, 0xED08, 0xF528, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0xD2E7, 0xB845, 0xC066, 0xB8C6, 0x0000, 0xF80F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xBBE7, 0x0000, 0xFDC9, 0xDA87, 0xB865, 0xB886, 0xD2A7, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xEC88, 0xEC68, 0xEC68, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9005, 0xB886, 0xC0C6, 0xB8C6, 0xB845, 0xECA8, 0xFEA9, 0xFE49, 0xFE89, 0xFF0A, 0xFEC9, 0xFFEA, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8E6, 0xC8E6, 0xC106, 0xB865, 0xE408, 0xFEC9, 0xFE69, 0xF569, 0xF5C9, 0xFDE9, 0x0000, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xA800, 0x0000, 0xB8A5, 0xC086, 0xB845, 0xC106, 0xF5A9, 0xFE89, 0xD2E7, 0xB886, 0xC0C6, 0xC986, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0x0000, 0xCA47, 0xDAE7, 0xF528, 0xFEEA, 0xECA8, 0xB845, 0xC8C6, 0xB8C6, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFF4A, 0xFF8A, 0xFEC9, 0xFEC9, 0xE408, 0xB865, 0xC906, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xEC89, 0xDB87, 0xEC68, 0xFEA9, 0xF5A9, 0xC0C6, 0xB885, 0xB124, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF80A, 0x0000, 0xB005, 0xC046, 0xDB47, 0xFEE9, 0xF529, 0xD247, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xC166, 0xC0A6, 0xC106, 0xFE09, 0xFECA, 0xFFAA, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xF800, 0xB885, 0xC906, 0xFE69, 0xFE49, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB865, 0xEBE8, 0xFF0A, 0xFE49, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFE88, 0xFE89, 0xFE69, 0xFE69, 0xFBE0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_PIZZA_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 23, 16, 39, 36, 61, 58, 74, 78, 87, 96, 106, 114, 125, 134,
+  144, 150, 161, 166, 180, 180, 199, 194, 220, 208, 239, 220, 256, 232, 273, 242,
+  292, 252, 311, 262, 328, 270, 343, 278, 354, 286, 367, 292
 };
 
-const uint8_t SPRITE_PIZZA_22_ALPHA[] PROGMEM = {
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x53, 0x95, 0xC8, 0xE8, 0xFD, 0xFF, 0xFF, 0xFD, 0xE8, 0xC8, 0x95, 0x53, 0x10, 0x00, 0x00, 0x01, 0x00,
-  0x01, 0x00, 0x13, 0x87, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x87, 0x13, 0x00, 0x01,
-  0x01, 0x18, 0xE0, 0xFF, 0xFF, 0xFE, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF, 0xE0, 0x17, 0x01,
-  0x00, 0x22, 0xEA, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xEA, 0x21, 0x00,
-  0x00, 0x00, 0x0C, 0xB6, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xB1, 0x0C, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x4E, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x49, 0x00, 0x04, 0x00,
-  0x00, 0x01, 0x02, 0x0A, 0xDF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDA, 0x07, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x85, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x7E, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x29, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x24, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0xB9, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xB4, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x56, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x52, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0xE4, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE1, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x8C, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x88, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2D, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0x28, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xC0, 0xFE, 0xFC, 0xFF, 0xFF, 0xFC, 0xFE, 0xBC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x5D, 0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x59, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0E, 0xE8, 0xFF, 0xFD, 0xFD, 0xFF, 0xE7, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x94, 0xFF, 0xFB, 0xFB, 0xFF, 0x8F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32, 0xFD, 0xFE, 0xFE, 0xFD, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xC5, 0xFE, 0xFE, 0xC5, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x60, 0xFF, 0xFF, 0x5E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0B, 0xCF, 0xCF, 0x0A, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_PIZZA_22_SPAN_OPS[] PROGMEM = {
+  0x00, 0x80, 0x01, 0x01, 0x85, 0x10, 0x53, 0x95, 0xC8, 0xE8, 0xFD, 0x41, 0x85, 0xFD, 0xE8, 0xC8, 0x95, 0x53, 0x10, 0x01, 0x80, 0x01, 0xC0, 0x80,
+  0x01, 0x00, 0x82, 0x13, 0x87, 0xE1, 0x4B, 0x82, 0xE1, 0x87, 0x13, 0x00, 0x80, 0x01, 0xC0, 0x82, 0x01, 0x18, 0xE0, 0x41, 0x83, 0xFE, 0xFC, 0xFD,
+  0xFE, 0x43, 0x83, 0xFE, 0xFD, 0xFC, 0xFE, 0x41, 0x82, 0xE0, 0x17, 0x01, 0xC0, 0x00, 0x83, 0x22, 0xEA, 0xFC, 0xFD, 0x4B, 0x83, 0xFD, 0xFC, 0xEA,
+  0x21, 0xC0, 0x01, 0x83, 0x0C, 0xB6, 0xFE, 0xFC, 0x49, 0x83, 0xFC, 0xFE, 0xB1, 0x0C, 0xC0, 0x00, 0x80, 0x04, 0x00, 0x80, 0x4E, 0x40, 0x80, 0xFD,
+  0x49, 0x80, 0xFD, 0x40, 0x80, 0x49, 0x00, 0x80, 0x04, 0xC0, 0x00, 0x83, 0x01, 0x02, 0x0A, 0xDF, 0x40, 0x80, 0xFD, 0x47, 0x80, 0xFD, 0x40, 0x83,
+  0xDA, 0x07, 0x02, 0x01, 0xC0, 0x01, 0x80, 0x04, 0x00, 0x80, 0x85, 0x40, 0x80, 0xFB, 0x47, 0x80, 0xFB, 0x40, 0x80, 0x7E, 0x00, 0x80, 0x04, 0xC0,
+  0x01, 0x80, 0x02, 0x00, 0x82, 0x29, 0xFA, 0xFE, 0x47, 0x82, 0xFE, 0xF8, 0x24, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x02, 0x00, 0x80, 0xB9, 0x40,
+  0x80, 0xFC, 0x45, 0x80, 0xFC, 0x40, 0x80, 0xB4, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0x56, 0x40, 0x80, 0xFC, 0x45, 0x80, 0xFC,
+  0x40, 0x80, 0x52, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x0C, 0xE4, 0x40, 0x80, 0xFE, 0x43, 0x80, 0xFD, 0x40, 0x81, 0xE1, 0x09,
+  0x00, 0x80, 0x01, 0xC0, 0x03, 0x80, 0x04, 0x00, 0x80, 0x8C, 0x40, 0x80, 0xFB, 0x43, 0x80, 0xFB, 0x40, 0x80, 0x88, 0x00, 0x80, 0x03, 0xC0, 0x03,
+  0x80, 0x03, 0x00, 0x82, 0x2D, 0xFB, 0xFE, 0x43, 0x82, 0xFE, 0xF9, 0x28, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x02, 0x00, 0x82, 0xC0, 0xFE, 0xFC,
+  0x41, 0x82, 0xFC, 0xFE, 0xBC, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x04, 0x00, 0x80, 0x5D, 0x40, 0x80, 0xFC, 0x41, 0x80, 0xFC, 0x40, 0x80, 0x59,
+  0x00, 0x80, 0x04, 0xC0, 0x04, 0x80, 0x01, 0x00, 0x81, 0x0E, 0xE8, 0x40, 0x81, 0xFD, 0xFD, 0x40, 0x81, 0xE7, 0x0E, 0x00, 0x80, 0x01, 0xC0, 0x05,
+  0x80, 0x03, 0x00, 0x80, 0x94, 0x40, 0x81, 0xFB, 0xFB, 0x40, 0x80, 0x8F, 0x00, 0x80, 0x03, 0xC0, 0x05, 0x80, 0x02, 0x00, 0x85, 0x32, 0xFD, 0xFE,
+  0xFE, 0xFD, 0x30, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x87, 0x02, 0x01, 0xC5, 0xFE, 0xFE, 0xC5, 0x01, 0x02, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x80, 0x60,
+  0x41, 0x80, 0x5E, 0x00, 0x80, 0x04, 0xC0, 0x06, 0x87, 0x01, 0x02, 0x0B, 0xCF, 0xCF, 0x0A, 0x02, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_PIZZA_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0840, 0x4960, 0x92A0, 0xBB80, 0xDBC0, 0xF441, 0xF441, 0xF461, 0xF461, 0xDBE0, 0xBB80, 0x92A0, 0x4960, 0x0840, 0x0000,
+  0x0000, 0x0840, 0x8260, 0xDBE0, 0xFC81, 0xFCA1, 0xFCA1, 0xFD02, 0xFD43, 0xFD23, 0xF4E3, 0xF4C2, 0xFCC2, 0xFCA1, 0xFCA1, 0xFC81,
+  0xDBE0, 0x8260, 0x0840, 0x0000, 0x0000, 0x1060, 0xD3E0, 0xFCC1, 0xFCC2, 0xF524, 0xFDC7, 0xFE48, 0xECE8, 0xDB27, 0xE3A8, 0xFE09,
+  0xFE89, 0xFE29, 0xFE28, 0xFDC7, 0xF544, 0xFCC2, 0xFCC1, 0xD3E0, 0x1060, 0x0000, 0x1880, 0xDBE0, 0xFDA5, 0xFE69, 0xFE6A, 0xFECA,
+  0xECE8, 0xB886, 0xB865, 0xB025, 0xCA06, 0xFE49, 0xFE69, 0xFE49, 0xFE6A, 0xFE6A, 0xFE49, 0xFD85, 0xDBE0, 0x1880, 0x0820, 0xAC06,
+  0xFE4A, 0xFE89, 0xFEA9, 0xD287, 0xB865, 0xC0E6, 0xC0E6, 0xB886, 0xF508, 0xFEA9, 0xFEA9, 0xFEC9, 0xFE89, 0xFEAA, 0xAC66, 0x0820,
+  0x0000, 0x3801, 0xC906, 0xE468, 0xFF0A, 0xD2C7, 0xB845, 0xC0E6, 0xB8C6, 0xB886, 0xF569, 0xFE89, 0xE408, 0xDB67, 0xED08, 0xFEEA,
+  0x41A2, 0x0020, 0x0000, 0x0000, 0x0000, 0xA065, 0xC106, 0xFE29, 0xF589, 0xC126, 0xB865, 0xB865, 0xD2E7, 0xFEA9, 0xD267, 0xB825,
+  0xB845, 0xC0C6, 0xBB86, 0x0020, 0x0000, 0x0000, 0x0000, 0x6063, 0xC8A6, 0xED48, 0xFEA9, 0xFDC9, 0xEC68, 0xECC8, 0xFEA9, 0xF569,
+  0xB886, 0xB8E6, 0xB0C5, 0xC8C6, 0x5843, 0x0000, 0x0000, 0x1800, 0xC1E6, 0xFE49, 0xFEA9, 0xFEA9, 0xFEC9, 0xFE89, 0xFE89, 0xF569,
+  0xB8A6, 0xB8C6, 0xC0E6, 0xB8A5, 0x1820, 0x0000, 0x0000, 0xB446, 0xFECA, 0xED08, 0xF528, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0xD2E7,
+  0xB845, 0xC066, 0x8084, 0x0000, 0x0000, 0x51E3, 0xDA87, 0xB865, 0xB886, 0xD2A7, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xEC88, 0xEC68,
+  0x4942, 0x0000, 0x0000, 0x0800, 0xA065, 0xC0C6, 0xB8C6, 0xB845, 0xECA8, 0xFEA9, 0xFE49, 0xFE89, 0xFF0A, 0xDDE7, 0x0020, 0x0000,
+  0x0000, 0x6063, 0xC8E6, 0xB8E5, 0xB865, 0xE408, 0xFEC9, 0xFE69, 0xED28, 0xF5C9, 0x8304, 0x0000, 0x0000, 0x2000, 0xB865, 0xB845,
+  0xC106, 0xF5A9, 0xFE89, 0xD2E7, 0xB886, 0xB8A5, 0x1820, 0x0000, 0x0000, 0x91A5, 0xDAE7, 0xF528, 0xFEEA, 0xECA8, 0xB845, 0xC8C6,
+  0x8884, 0x0000, 0x0020, 0x5AA3, 0xFF8A, 0xFEC9, 0xFEC9, 0xE408, 0xB865, 0xC906, 0x3842, 0x0000, 0x0000, 0x0840, 0xC326, 0xEC68,
+  0xFEA9, 0xF5A9, 0xC0C6, 0xA064, 0x0800, 0x0000, 0x0000, 0x6802, 0xC046, 0xD326, 0xF6A8, 0xF529, 0x7143, 0x0000, 0x0000, 0x2041,
+  0xC0A6, 0xC106, 0xFE09, 0xFECA, 0x2961, 0x0000, 0x0000, 0x0000, 0x8863, 0xC906, 0xFE69, 0xC4E7, 0x0000, 0x0000, 0x0000, 0x4021,
+  0xEBE8, 0xFF0A, 0x5A43, 0x0020, 0x0000, 0x0000, 0x0020, 0xCD47, 0xCD27, 0x0020, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_PIZZA_22_SPANS = {
+  SPRITE_PIZZA_22_SPAN_ROWS, SPRITE_PIZZA_22_SPAN_OPS, SPRITE_PIZZA_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_PIZZA_22_ASSET = {
   SPRITE_PIZZA_22_WIDTH, SPRITE_PIZZA_22_HEIGHT,
-  SPRITE_PIZZA_22_ALPHA, SPRITE_PIZZA_22_RGB565
+  nullptr, nullptr, &SPRITE_PIZZA_22_SPANS
 };
 
 #endif // SPRITE_PIZZA_22_INCLUDED
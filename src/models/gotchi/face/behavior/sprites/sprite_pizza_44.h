@@ -5,110 +5,170 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from pizza_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from pizza_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1282/1936 pixels visibles, 4027 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_PIZZA_44_WIDTH = 44;
 constexpr uint16_t SPRITE_PIZZA_44_HEIGHT = 44;
 
-const uint16_t SPRITE_PIZZA_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0xFFE0, 0xFDE0, 0xFDA0, 0xFD40, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFCE3, 0xFCE2, 0xF4A2, 0xF4A2, 0xF481, 0xF461, 0xF441, 0xEC21, 0xEC21, 0xEC01, 0xF421, 0xF421, 0xF441, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF481, 0xF4A2, 0xFCA2, 0xFCE2, 0xFCE3, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFD40, 0xFDA0, 0xFDE0, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0xFD02, 0xF482, 0xFCA1, 0xFCA1, 0xFC61, 0xFC81, 0xFC81, 0xFC81, 0xF461, 0xF461, 0xF460, 0xF461, 0xF481, 0xF481, 0xF4A1, 0xF481, 0xF461, 0xF461, 0xF461, 0xF461, 0xF440, 0xF460, 0xF461, 0xFC61, 0xFC81, 0xFC81, 0xFC81, 0xFC81, 0xFCA1, 0xFC81, 0xF482, 0xFD02, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000,
-  0xFFE0, 0xFFE0, 0xFBE0, 0x0000, 0x0000, 0xFD43, 0xF4C2, 0xFCA1, 0xFC81, 0xFC81, 0xFC80, 0xFC80, 0xFC80, 0xFC60, 0xFC60, 0xFC61, 0xFCA1, 0xFCC1, 0xFD02, 0xFD22, 0xFD22, 0xFCE2, 0xF4A1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xFC81, 0xFC80, 0xFC80, 0xFC80, 0xFC80, 0xFC80, 0xFC81, 0xFC81, 0xFCA1, 0xF4C2, 0xFC63, 0x0000, 0x0000, 0xFBE0, 0xFFE0, 0xFFE0,
-  0xFD40, 0xFFE0, 0xF800, 0xFCE2, 0xEC41, 0xF481, 0xFCA1, 0xFC81, 0xFC61, 0xFCA1, 0xFD01, 0xFD01, 0xFD02, 0xFD02, 0xFD22, 0xFD43, 0xFD63, 0xFD44, 0xFD24, 0xF504, 0xF524, 0xFD44, 0xFD64, 0xFD64, 0xFD44, 0xFD24, 0xFD24, 0xFD23, 0xFD23, 0xFD22, 0xFD02, 0xFD02, 0xFD01, 0xFD01, 0xFCA1, 0xFC61, 0xFC81, 0xFCC1, 0xF481, 0xEC41, 0xEC42, 0xFFE0, 0xFFE0, 0xFFE0,
-  0xD2A0, 0x0000, 0x0000, 0xF481, 0xF481, 0xF481, 0xFCC0, 0xFC80, 0xFCA1, 0xFCC1, 0xFD02, 0xFD23, 0xFD44, 0xFDA5, 0xFE06, 0xFE07, 0xFDC7, 0xF4E7, 0xE427, 0xE3C7, 0xE407, 0xF4E7, 0xFDE8, 0xFE68, 0xFE48, 0xFE08, 0xFDE8, 0xFDE7, 0xFDE7, 0xFDC6, 0xFDA5, 0xFD64, 0xFD44, 0xFD02, 0xFCC1, 0xFCA1, 0xFCA0, 0xFCC0, 0xF481, 0xF481, 0xEC61, 0x0000, 0x0000, 0xFBE0,
-  0xD2A0, 0x0000, 0xFFE0, 0xEC61, 0xF461, 0xFD21, 0xFD41, 0xFD02, 0xFD03, 0xFD24, 0xF565, 0xFDA6, 0xFDE7, 0xFE48, 0xFE89, 0xF5E9, 0xECA8, 0xDB48, 0xD287, 0xCA27, 0xCA47, 0xDB48, 0xECC9, 0xFE0A, 0xFEAA, 0xFECA, 0xFE8A, 0xFE49, 0xFE49, 0xFE49, 0xFE08, 0xFDE7, 0xFDA7, 0xF565, 0xFD24, 0xFD03, 0xFD02, 0xFD41, 0xFD21, 0xF461, 0xF461, 0xFFE0, 0x0000, 0xFBE0,
-  0xFBE0, 0x0000, 0xFE6C, 0xF460, 0xF460, 0xFD41, 0xFD83, 0xFD85, 0xFDE7, 0xFDE8, 0xFE09, 0xFE29, 0xFE89, 0xFEAA, 0xFE29, 0xEC88, 0xCA47, 0xB8E6, 0xB8C6, 0xB8A6, 0xB8A6, 0xC106, 0xCA47, 0xE408, 0xFE09, 0xFEEA, 0xFEAA, 0xFE4A, 0xFE4A, 0xFE29, 0xFE29, 0xFE29, 0xFE29, 0xFE29, 0xFE08, 0xFDE7, 0xFD85, 0xFD83, 0xFD21, 0xF460, 0xF441, 0xCCCC, 0x0000, 0xFBE0,
-  0xFFE0, 0x0000, 0xFEAA, 0xF440, 0xFC40, 0xFCA2, 0xFD85, 0xFE28, 0xFECA, 0xFECA, 0xFE8A, 0xFEAA, 0xFEEA, 0xFE8A, 0xF529, 0xDB07, 0xB8C6, 0xB005, 0xB005, 0xB845, 0xB025, 0xB005, 0xB885, 0xD267, 0xED08, 0xFE89, 0xFE89, 0xFE49, 0xFE89, 0xFE89, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE8A, 0xFE8A, 0xFE69, 0xFE08, 0xFD65, 0xFCA2, 0xF440, 0xF420, 0xD54A, 0x0000, 0xFBE0,
-  0x0000, 0x0000, 0xFFEF, 0xFC20, 0xF440, 0xF4E3, 0xFDC8, 0xFE49, 0xFECA, 0xFEEA, 0xFEAA, 0xFECA, 0xFEEA, 0xFE09, 0xE408, 0xCA06, 0xB886, 0xB025, 0xB865, 0xB8C6, 0xB8C6, 0xB845, 0xB025, 0xC986, 0xE428, 0xFE09, 0xFE89, 0xFE89, 0xFEA9, 0xFECA, 0xFF0A, 0xFEEA, 0xFEA9, 0xFE8A, 0xFE8A, 0xFE8A, 0xFE69, 0xFE08, 0xFD24, 0xFC60, 0xF420, 0xCCCC, 0x0000, 0x0000,
-  0x0000, 0x07E0, 0xFBEF, 0x0000, 0x0000, 0xCD4E, 0xED09, 0xECE9, 0xF509, 0xFD69, 0xFDE9, 0xFEC9, 0xFF09, 0xF5E9, 0xDB67, 0xC166, 0xB885, 0xB8A5, 0xB8E6, 0xC166, 0xC166, 0xB8A6, 0xB005, 0xC106, 0xE3A8, 0xFDC9, 0xFEC9, 0xFEE9, 0xFE89, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFEA9, 0xFF0A, 0xFECA, 0xFEAA, 0xFE6A, 0xFF53, 0x0000, 0x0000, 0xFDEF, 0x0000, 0x0000,
-  0x0000, 0x7800, 0xA945, 0x0000, 0x0000, 0x001F, 0xCA47, 0xC9E7, 0xD1E7, 0xE2C7, 0xEC48, 0xF629, 0xFF29, 0xFE49, 0xDBA7, 0xC166, 0xB865, 0xB885, 0xB8E6, 0xC166, 0xC166, 0xB8A6, 0xB005, 0xC126, 0xE3C8, 0xFE09, 0xFF0A, 0xFEA9, 0xF589, 0xECA8, 0xE468, 0xECA8, 0xF548, 0xFE69, 0xFF6A, 0xFF2A, 0xFECA, 0xFDEA, 0x0000, 0x0000, 0x0000, 0xFE66, 0xFFE0, 0x0000,
-  0x0000, 0x7800, 0x9986, 0xFD40, 0xFC80, 0xD140, 0x9802, 0xA804, 0xB805, 0xD0E6, 0xDA67, 0xECC8, 0xFEA9, 0xFEA9, 0xECA8, 0xD227, 0xB886, 0xB005, 0xB865, 0xB8A6, 0xB8A6, 0xB825, 0xB845, 0xC9E6, 0xECA8, 0xFE69, 0xFE49, 0xED08, 0xDB87, 0xD267, 0xD247, 0xD287, 0xDB47, 0xF509, 0xFE8A, 0xFECA, 0xFEA9, 0xF467, 0xD140, 0xDBE0, 0xFBE0, 0xFDE7, 0xFFE0, 0x0000,
-  0x0000, 0x0000, 0xF800, 0xFBE0, 0xB244, 0x0000, 0x3800, 0xB005, 0xB825, 0xC046, 0xC8C6, 0xDAE7, 0xF589, 0xFEC9, 0xFDE9, 0xE3A8, 0xC166, 0xB005, 0xB005, 0xB025, 0xB005, 0xB025, 0xC106, 0xDB67, 0xF5E9, 0xFE69, 0xECA8, 0xD267, 0xC126, 0xB886, 0xB886, 0xB8C6, 0xC106, 0xDAA7, 0xEC88, 0xF5C9, 0xFE69, 0xFAAA, 0x0000, 0xBBE3, 0xAAA0, 0xFBE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xB8E3, 0xFFE0, 0x0020, 0xC1E6, 0xB906, 0xB045, 0xC006, 0xD1A7, 0xEC88, 0xFEC9, 0xFEA9, 0xF529, 0xDB27, 0xC186, 0xC106, 0xB8E6, 0xB8E6, 0xC9A6, 0xD307, 0xED08, 0xFE89, 0xF5C9, 0xDB07, 0xB8C6, 0xB005, 0xB005, 0xB025, 0xB825, 0xB825, 0xC906, 0xD2A7, 0xDBE7, 0xE4E8, 0x0000, 0xFFE0, 0xC383, 0xAAA0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xA807, 0x0000, 0x0000, 0xC1C6, 0xB926, 0xB846, 0xC006, 0xD167, 0xEC48, 0xFE69, 0xFEC9, 0xFE49, 0xF549, 0xE428, 0xDB67, 0xDB07, 0xDB47, 0xE448, 0xF569, 0xFE89, 0xFE69, 0xECA8, 0xC9C6, 0xB825, 0xB845, 0xB8A5, 0xB8A5, 0xB886, 0xC886, 0xC8A6, 0xC106, 0xC186, 0xB9A6, 0x0000, 0x0000, 0xD8E7, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xD809, 0x0000, 0x7800, 0xC9A6, 0xB966, 0xC066, 0xC066, 0xD9C7, 0xF468, 0xFE69, 0xFEC9, 0xFECA, 0xFEC9, 0xFE29, 0xF589, 0xF529, 0xF549, 0xFE29, 0xFEC9, 0xFF0A, 0xFE29, 0xE3E8, 0xC146, 0xB025, 0xB8A6, 0xC146, 0xB926, 0xC906, 0xD106, 0xC8C6, 0xB846, 0xA805, 0x9804, 0xFBE0, 0x0000, 0xD00A, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xFBEF, 0xAAAA, 0xA8E5, 0xB845, 0xC0C6, 0xE267, 0xF4E9, 0xFEA9, 0xFEC9, 0xFEA9, 0xFEEA, 0xFEA9, 0xFE89, 0xFE69, 0xFE69, 0xFEA9, 0xFEC9, 0xFEC9, 0xFE09, 0xE408, 0xC146, 0xB005, 0xB8A6, 0xC146, 0xC126, 0xC906, 0xD0E6, 0xC0A6, 0xB865, 0x9804, 0x7800, 0xF80F, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xFFE0, 0xFDEF, 0x0000, 0x0000, 0xC106, 0xD246, 0xEBE8, 0xFE29, 0xFF2A, 0xFEC9, 0xFE69, 0xFE89, 0xFEC9, 0xFEEA, 0xFEEA, 0xFEA9, 0xFE69, 0xFE49, 0xFE89, 0xFE49, 0xECA8, 0xCA06, 0xB865, 0xB045, 0xB886, 0xB886, 0xC086, 0xC0A6, 0xB8C6, 0xC146, 0x0020, 0x0000, 0xF807, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFEAF, 0x0000, 0x0000, 0xE3C7, 0xECA8, 0xFDC9, 0xFEEA, 0xFF0A, 0xFE49, 0xF5A9, 0xF5C9, 0xFE49, 0xFEC9, 0xFEEA, 0xFE89, 0xFE49, 0xFE29, 0xFE89, 0xFEA9, 0xF589, 0xDB47, 0xC146, 0xB025, 0xB005, 0xB805, 0xC046, 0xB885, 0xB8A5, 0xB8E6, 0x0000, 0x0000, 0xF94A, 0xF80F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFECD, 0x0000, 0xF800, 0xFF49, 0xFEA9, 0xFE89, 0xFE4A, 0xFDA9, 0xEC68, 0xDB87, 0xDBA7, 0xEC68, 0xF549, 0xFE09, 0xFE69, 0xFE69, 0xFE29, 0xFE69, 0xFEC9, 0xFE49, 0xECC8, 0xD2E7, 0xC166, 0xC0C6, 0xC8E6, 0xC946, 0xC146, 0xB945, 0xB145, 0xF800, 0x0000, 0xDA49, 0xF80F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xDDAD, 0x0000, 0x0000, 0xFFEB, 0xFF8A, 0xFDA9, 0xEC48, 0xEB28, 0xD1E6, 0xB8E6, 0xC106, 0xC9C6, 0xD2E7, 0xEC88, 0xFE09, 0xFEA9, 0xFE69, 0xFE49, 0xFE69, 0xFE89, 0xFE29, 0xF528, 0xE3C7, 0xE327, 0xEB48, 0xE348, 0xDB47, 0xD346, 0xE326, 0x0000, 0x0000, 0xFBEA, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xCCC6, 0x0000, 0xF800, 0xFFEF, 0xFF29, 0xE388, 0xD227, 0xD947, 0xC086, 0xB005, 0xB005, 0xB845, 0xC106, 0xD2E7, 0xF548, 0xFE89, 0xFEA9, 0xFE49, 0xFE29, 0xFE69, 0xFEC9, 0xFE89, 0xF5E9, 0xFD89, 0xFDA9, 0xF569, 0xF569, 0xF608, 0xFFEA, 0xFFE0, 0x0000, 0xFDEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0x7800, 0xB807, 0x0000, 0xFFEA, 0xC146, 0xC0A6, 0xC086, 0xC086, 0xB885, 0xB886, 0xB045, 0xB025, 0xC166, 0xE408, 0xFDE9, 0xFEA9, 0xFE89, 0xFE49, 0xFE29, 0xFE89, 0xFEC9, 0xFEC9, 0xFF0A, 0xFECA, 0xFE89, 0xFEC9, 0xFFEC, 0x0000, 0xFE6C, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xB004, 0x0000, 0x0000, 0xA004, 0xB045, 0xB886, 0xC8E6, 0xC926, 0xC166, 0xB8A5, 0xB005, 0xB8C6, 0xDB07, 0xF549, 0xFE89, 0xFECA, 0xFEA9, 0xFE49, 0xFE69, 0xFEA9, 0xFF2A, 0xFF6A, 0xFEEA, 0xFEC9, 0xFEAA, 0x0000, 0x0000, 0xFEC9, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB807, 0x0000, 0x0000, 0xA004, 0xB085, 0xB8A6, 0xC8E6, 0xC926, 0xC946, 0xB8C6, 0xB025, 0xB8C6, 0xDAC7, 0xED08, 0xFE69, 0xFF0A, 0xFEEA, 0xFE69, 0xFE29, 0xFE49, 0xFEAA, 0xFECA, 0xFE89, 0xFE69, 0xFEA9, 0x0000, 0x0000, 0xFFE9, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD809, 0x0000, 0xFBE0, 0xCA65, 0xC126, 0xC0E6, 0xC8C6, 0xD0C6, 0xC0E6, 0xB065, 0xB005, 0xC106, 0xDB27, 0xF549, 0xFEA9, 0xFEEA, 0xFE69, 0xF548, 0xEC88, 0xEC48, 0xF489, 0xECA8, 0xF4E8, 0xF548, 0xFDC8, 0xFBE0, 0x0000, 0xFEAA, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xC800, 0xF800, 0xF800, 0xFAAA, 0xB925, 0xC0C5, 0xC086, 0xC886, 0xC086, 0xB005, 0xB005, 0xC166, 0xE3E8, 0xFE29, 0xFEEA, 0xFE69, 0xECE8, 0xDB07, 0xC9C6, 0xC966, 0xD1A7, 0xCA07, 0xDA67, 0xF447, 0xFFEA, 0xF800, 0xF800, 0xF9E0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xA800, 0xF800, 0xB800, 0x0000, 0x9800, 0xB8A5, 0xC0C5, 0xC8A6, 0xC086, 0xB866, 0xC106, 0xD2C7, 0xED28, 0xFEC9, 0xFEC9, 0xF549, 0xD307, 0xC126, 0xB845, 0xB826, 0xC026, 0xB865, 0xB845, 0x7800, 0x0000, 0xB800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xB244, 0x0000, 0x0000, 0xC186, 0xC9A6, 0xC986, 0xC986, 0xD207, 0xDB27, 0xECE8, 0xFE69, 0xFEEA, 0xFE09, 0xE3E8, 0xC186, 0xB825, 0xB846, 0xC086, 0xB866, 0xB065, 0xB005, 0x0000, 0x0000, 0xA945, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xDBE3, 0x0000, 0xF800, 0xD327, 0xD327, 0xDB67, 0xE408, 0xECC8, 0xF589, 0xFE89, 0xFF0A, 0xFEAA, 0xF549, 0xD307, 0xB8C5, 0xB805, 0xC8A6, 0xC946, 0xC106, 0xB8E5, 0xB965, 0xFFFF, 0xF800, 0xB124, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFDA9, 0x0000, 0x0000, 0xED89, 0xEDA9, 0xF649, 0xFEEA, 0xFF4A, 0xFEEA, 0xFEE9, 0xFEEA, 0xFE69, 0xECE8, 0xD2C7, 0xB8C5, 0xB825, 0xD0C6, 0xC946, 0xC106, 0xB8A5, 0xA8A5, 0x0000, 0x0000, 0xD804, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFE6C, 0x0000, 0xFFE0, 0xFFEA, 0xFFEB, 0xFFCA, 0xFF6A, 0xFF6A, 0xFEEA, 0xFEA9, 0xFEE9, 0xFE89, 0xF548, 0xDB27, 0xC0E6, 0xB825, 0xC886, 0xC906, 0xC0E6, 0xB0A5, 0x9806, 0xF800, 0x0000, 0xC806, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x7BE0, 0xFBE7, 0xFFE0, 0xFFED, 0xF5C9, 0xED08, 0xF529, 0xF549, 0xFDC9, 0xFEA9, 0xFEE9, 0xFE09, 0xE3E8, 0xC126, 0xB805, 0xC026, 0xB8A6, 0xB8C6, 0xD145, 0x0000, 0xB807, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xFAA5, 0x0000, 0x0000, 0xC166, 0xCA46, 0xD247, 0xE2C7, 0xEBC8, 0xF548, 0xFEA9, 0xFEC9, 0xF528, 0xDAC7, 0xC906, 0xB886, 0xB8A5, 0xB065, 0x0000, 0x0000, 0xD145, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD929, 0x0000, 0x0000, 0xB005, 0xB8A5, 0xC086, 0xC886, 0xD167, 0xDB27, 0xED48, 0xFEC9, 0xFE89, 0xF509, 0xE348, 0xC9E6, 0xC126, 0xB845, 0x0000, 0x0000, 0xDA49, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80A, 0x0000, 0xFFE0, 0xA865, 0xB005, 0xB005, 0xB805, 0xC846, 0xC986, 0xDBC7, 0xF609, 0xFF2A, 0xFEEA, 0xF569, 0xE408, 0xD267, 0xC065, 0x7800, 0x0000, 0xFBEA, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0xA800, 0xB8A5, 0xB845, 0xB866, 0xC866, 0xC0C6, 0xD287, 0xED28, 0xFF0A, 0xFF6A, 0xFE89, 0xFE69, 0xE528, 0xA80A, 0xF81F, 0x0000, 0xFDE7, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0xA800, 0x0000, 0xFEE7, 0xC986, 0xC126, 0xC086, 0xC046, 0xC9C6, 0xECA8, 0xFECA, 0xFF2A, 0xFEC9, 0xFFAA, 0xFFF2, 0x0000, 0xFBE7, 0x0000, 0xFFEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x9004, 0x0000, 0x0000, 0xC125, 0xB8E6, 0xB845, 0xB825, 0xC9E6, 0xF4E8, 0xFEEA, 0xFEEA, 0xFE69, 0xFF29, 0x0020, 0x0000, 0xFDA9, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xA803, 0x0000, 0x0000, 0xA845, 0xB085, 0xB845, 0xC0C6, 0xE2E8, 0xFDE9, 0xFF0A, 0xFEA9, 0xFDA9, 0xECC8, 0x0000, 0x0000, 0xFEE7, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xB803, 0x0000, 0x0000, 0x7004, 0xA825, 0xC0C6, 0xDA07, 0xFC89, 0xFEEA, 0xFF6A, 0xFEC9, 0xFD89, 0xEBE6, 0x0000, 0x0000, 0xFEC9, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF807, 0x07E0, 0xFFE0, 0x5005, 0x9805, 0xD247, 0xEC08, 0xFDC9, 0xFF0A, 0xFF4A, 0xFEEA, 0xFD69, 0xFCC6, 0xFFE0, 0xF800, 0xFDE7, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x7BE0, 0xFEA5, 0x0000, 0x9004, 0xECE8, 0xFDE9, 0xFE69, 0xFEAA, 0xFEA9, 0xFE89, 0xFD4A, 0x0000, 0xFD45, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xFCE3, 0x0000, 0x0000, 0xFFEA, 0xFF0A, 0xFE89, 0xFE49, 0xFE29, 0xFE48, 0x0000, 0x0000, 0xFDE3, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_PIZZA_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 37, 34, 74, 68, 116, 108, 138, 152, 158, 192, 198, 234, 236, 276,
+  268, 318, 295, 358, 323, 395, 351, 432, 380, 474, 414, 513, 445, 549, 476, 583,
+  507, 619, 536, 657, 570, 692, 601, 722, 632, 754, 663, 784, 694, 816, 726, 846,
+  754, 872, 784, 898, 815, 926, 845, 956, 880, 984, 912, 1007, 941, 1033, 971, 1055,
+  1002, 1079, 1030, 1102, 1055, 1120, 1080, 1138, 1107, 1158, 1133, 1177, 1164, 1195, 1185, 1209,
+  1208, 1225, 1229, 1239, 1250, 1257, 1270, 1272
 };
 
-const uint8_t SPRITE_PIZZA_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x01, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x01, 0x28, 0x50, 0x77, 0x97, 0xB5, 0xCB, 0xDE, 0xEC, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xEC, 0xDE, 0xCB, 0xB5, 0x97, 0x77, 0x50, 0x28, 0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x04, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x1A, 0x2C, 0x43, 0x65, 0x82, 0x9E, 0xB4, 0xCB, 0xDA, 0xE8, 0xF1, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xE8, 0xDA, 0xCB, 0xB4, 0x9E, 0x82, 0x65, 0x43, 0x2C, 0x1A, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x01, 0x01, 0x02, 0x00, 0x00, 0x09, 0x3E, 0x71, 0x9A, 0xB6, 0xCD, 0xD8, 0xE1, 0xE7, 0xEF, 0xF3, 0xF8, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xF8, 0xF3, 0xEF, 0xE7, 0xE1, 0xD8, 0xCD, 0xB6, 0x9A, 0x71, 0x3E, 0x09, 0x00, 0x00, 0x02, 0x01, 0x01,
-  0x03, 0x01, 0x01, 0x0D, 0x2A, 0x59, 0x95, 0xCE, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xCE, 0x95, 0x59, 0x2A, 0x0D, 0x01, 0x01, 0x03,
-  0x06, 0x00, 0x00, 0x33, 0x8A, 0xCB, 0xE3, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE3, 0xCC, 0x8A, 0x32, 0x00, 0x00, 0x06,
-  0x06, 0x00, 0x01, 0x54, 0xD5, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xD5, 0x52, 0x01, 0x00, 0x06,
-  0x04, 0x00, 0x05, 0x5B, 0xDE, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xDD, 0x5A, 0x05, 0x00, 0x04,
-  0x02, 0x00, 0x06, 0x3F, 0x95, 0xCF, 0xE8, 0xF3, 0xFB, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xFB, 0xF2, 0xE7, 0xCF, 0x94, 0x3E, 0x06, 0x00, 0x02,
-  0x00, 0x00, 0x04, 0x11, 0x29, 0x5C, 0xAB, 0xE3, 0xFA, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0xFA, 0xE0, 0xA8, 0x5A, 0x28, 0x11, 0x05, 0x00, 0x00,
-  0x00, 0x01, 0x04, 0x00, 0x00, 0x0F, 0x6D, 0xC4, 0xF6, 0xFF, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xF4, 0xBF, 0x69, 0x0D, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x02, 0x06, 0x00, 0x00, 0x01, 0x3D, 0x93, 0xE7, 0xFD, 0xFE, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFE, 0xFD, 0xE5, 0x8E, 0x38, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00,
-  0x00, 0x02, 0x05, 0x03, 0x07, 0x06, 0x1C, 0x67, 0xD7, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFF, 0xD4, 0x62, 0x19, 0x06, 0x08, 0x04, 0x04, 0x01, 0x00,
-  0x00, 0x01, 0x02, 0x02, 0x07, 0x00, 0x04, 0x42, 0xBE, 0xFF, 0xFF, 0xFA, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFE, 0xFB, 0xFF, 0xFF, 0xB9, 0x3E, 0x03, 0x00, 0x08, 0x03, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x2C, 0x9E, 0xF0, 0xFD, 0xFC, 0xFE, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFE, 0xFD, 0xFC, 0xEB, 0x99, 0x28, 0x00, 0x01, 0x09, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x1A, 0x73, 0xC4, 0xF3, 0xFD, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFD, 0xF1, 0xBF, 0x6D, 0x17, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x02, 0x0E, 0x45, 0x96, 0xE9, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xE7, 0x90, 0x3F, 0x0D, 0x02, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x02, 0x03, 0x18, 0x6B, 0xDA, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xD7, 0x65, 0x14, 0x02, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x04, 0x00, 0x03, 0x49, 0xC4, 0xFC, 0xFF, 0xFA, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFA, 0xFF, 0xFB, 0xC0, 0x45, 0x00, 0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x2C, 0x9F, 0xE9, 0xFE, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFD, 0xFD, 0xE6, 0x9B, 0x2A, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x01, 0x1A, 0x75, 0xC9, 0xF8, 0xFF, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xF7, 0xC5, 0x70, 0x19, 0x01, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x0B, 0x46, 0x9A, 0xE9, 0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFD, 0xE8, 0x96, 0x42, 0x0A, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x01, 0x04, 0x20, 0x6D, 0xD9, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xD8, 0x6A, 0x1E, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x00, 0x06, 0x46, 0xC2, 0xFF, 0xFF, 0xFA, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFA, 0xFF, 0xFF, 0xBF, 0x43, 0x05, 0x00, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x2E, 0xA4, 0xF4, 0xFD, 0xFC, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFD, 0xFC, 0xFD, 0xF1, 0xA1, 0x2B, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x1C, 0x79, 0xCA, 0xF4, 0xFE, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFE, 0xFD, 0xF4, 0xC7, 0x76, 0x1A, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x02, 0x10, 0x4A, 0x9C, 0xEB, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xEA, 0x98, 0x47, 0x0F, 0x02, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x03, 0x1C, 0x70, 0xDB, 0xFF, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF7, 0xFF, 0xFF, 0xD9, 0x6A, 0x18, 0x03, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x04, 0x00, 0x05, 0x4C, 0xC7, 0xFD, 0xFF, 0xF9, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFA, 0xFF, 0xFD, 0xC3, 0x48, 0x02, 0x00, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x2E, 0xA4, 0xEE, 0xFF, 0xFD, 0xFE, 0xFC, 0xFE, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFE, 0xEB, 0xA1, 0x2C, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x01, 0x1C, 0x7C, 0xD0, 0xF9, 0xFE, 0xFE, 0xFA, 0xFE, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xF8, 0xCB, 0x78, 0x1B, 0x01, 0x01, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x0D, 0x4D, 0xA1, 0xEA, 0xFD, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFD, 0xE9, 0x9C, 0x49, 0x0C, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x01, 0x06, 0x25, 0x73, 0xDC, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xDB, 0x70, 0x23, 0x05, 0x01, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x01, 0x07, 0x4A, 0xC6, 0xFF, 0xFF, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0xFF, 0xFF, 0xC5, 0x49, 0x06, 0x00, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x31, 0xAA, 0xF5, 0xFE, 0xFB, 0xFD, 0xFA, 0xFA, 0xFD, 0xFC, 0xFD, 0xF4, 0xA8, 0x31, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x1E, 0x80, 0xD0, 0xF6, 0xFD, 0xFE, 0xF7, 0xF7, 0xFE, 0xFE, 0xF5, 0xCD, 0x7C, 0x1D, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x01, 0x12, 0x51, 0xA4, 0xEE, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0xFF, 0xED, 0xA0, 0x4D, 0x11, 0x02, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x03, 0x22, 0x76, 0xDE, 0xFF, 0xFF, 0xF6, 0xF5, 0xFF, 0xFF, 0xDE, 0x73, 0x20, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0x08, 0x50, 0xCA, 0xFE, 0xFF, 0xF9, 0xF8, 0xFF, 0xFE, 0xCA, 0x4F, 0x07, 0x00, 0x04, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x31, 0xA9, 0xF1, 0xFE, 0xFD, 0xFD, 0xFE, 0xF1, 0xAA, 0x31, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x09, 0x01, 0x00, 0x1E, 0x82, 0xD6, 0xFA, 0xFF, 0xFF, 0xFA, 0xD5, 0x81, 0x1E, 0x00, 0x01, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x0F, 0x53, 0xA8, 0xEE, 0xFF, 0xFF, 0xED, 0xA7, 0x51, 0x0E, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x02, 0x06, 0x25, 0x6C, 0xCC, 0xFB, 0xFB, 0xCB, 0x6B, 0x23, 0x05, 0x02, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x06, 0x01, 0x07, 0x40, 0xAA, 0xF2, 0xF2, 0xAA, 0x3F, 0x06, 0x00, 0x06, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x2C, 0x99, 0xED, 0xED, 0x99, 0x2B, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_PIZZA_44_SPAN_OPS[] PROGMEM = {
+  0x01, 0x83, 0x01, 0x04, 0x07, 0x03, 0x02, 0x89, 0x01, 0x28, 0x50, 0x77, 0x97, 0xB5, 0xCB, 0xDE, 0xEC, 0xF9, 0x45, 0x89, 0xF9, 0xEC, 0xDE, 0xCB,
+  0xB5, 0x97, 0x77, 0x50, 0x28, 0x01, 0x02, 0x83, 0x03, 0x07, 0x04, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x02, 0x8C, 0x0B, 0x1A, 0x2C, 0x43, 0x65, 0x82,
+  0x9E, 0xB4, 0xCB, 0xDA, 0xE8, 0xF1, 0xFB, 0x45, 0x8C, 0xFB, 0xF1, 0xE8, 0xDA, 0xCB, 0xB4, 0x9E, 0x82, 0x65, 0x43, 0x2C, 0x1A, 0x0B, 0x02, 0x80,
+  0x01, 0xC0, 0x82, 0x01, 0x01, 0x02, 0x01, 0x8D, 0x09, 0x3E, 0x71, 0x9A, 0xB6, 0xCD, 0xD8, 0xE1, 0xE7, 0xEF, 0xF3, 0xF8, 0xFB, 0xFE, 0x45, 0x8D,
+  0xFE, 0xFB, 0xF8, 0xF3, 0xEF, 0xE7, 0xE1, 0xD8, 0xCD, 0xB6, 0x9A, 0x71, 0x3E, 0x09, 0x01, 0x82, 0x02, 0x01, 0x01, 0xC0, 0x88, 0x03, 0x01, 0x01,
+  0x0D, 0x2A, 0x59, 0x95, 0xCE, 0xF8, 0x59, 0x88, 0xF8, 0xCE, 0x95, 0x59, 0x2A, 0x0D, 0x01, 0x01, 0x03, 0xC0, 0x80, 0x06, 0x01, 0x84, 0x33, 0x8A,
+  0xCB, 0xE3, 0xF5, 0x5B, 0x84, 0xF4, 0xE3, 0xCC, 0x8A, 0x32, 0x01, 0x80, 0x06, 0xC0, 0x80, 0x06, 0x00, 0x82, 0x01, 0x54, 0xD5, 0x42, 0x89, 0xFD,
+  0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0x47, 0x89, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF9, 0xF9, 0xF9, 0xFD, 0x42, 0x82, 0xD5,
+  0x52, 0x01, 0x00, 0x80, 0x06, 0xC0, 0x80, 0x04, 0x00, 0x82, 0x05, 0x5B, 0xDE, 0x41, 0x88, 0xFE, 0xFD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFE, 0xFE,
+  0x4B, 0x88, 0xFE, 0xFE, 0xFE, 0xFD, 0xFE, 0xFD, 0xFC, 0xFD, 0xFE, 0x41, 0x82, 0xDD, 0x5A, 0x05, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x02, 0x00, 0x87,
+  0x06, 0x3F, 0x95, 0xCF, 0xE8, 0xF3, 0xFB, 0xFD, 0x40, 0x80, 0xFE, 0x53, 0x80, 0xFE, 0x40, 0x87, 0xFD, 0xFB, 0xF2, 0xE7, 0xCF, 0x94, 0x3E, 0x06,
+  0x00, 0x80, 0x02, 0xC0, 0x01, 0x87, 0x04, 0x11, 0x29, 0x5C, 0xAB, 0xE3, 0xFA, 0xFE, 0x40, 0x80, 0xFB, 0x53, 0x80, 0xFC, 0x40, 0x87, 0xFE, 0xFA,
+  0xE0, 0xA8, 0x5A, 0x28, 0x11, 0x05, 0xC0, 0x00, 0x81, 0x01, 0x04, 0x01, 0x83, 0x0F, 0x6D, 0xC4, 0xF6, 0x41, 0x81, 0xF9, 0xFE, 0x51, 0x81, 0xFE,
+  0xF9, 0x41, 0x83, 0xF4, 0xBF, 0x69, 0x0D, 0x01, 0x80, 0x04, 0xC0, 0x00, 0x81, 0x02, 0x06, 0x01, 0x87, 0x01, 0x3D, 0x93, 0xE7, 0xFD, 0xFE, 0xF8,
+  0xFD, 0x51, 0x86, 0xFD, 0xF8, 0xFE, 0xFD, 0xE5, 0x8E, 0x38, 0x02, 0x81, 0x05, 0x01, 0xC0, 0x00, 0x87, 0x02, 0x05, 0x03, 0x07, 0x06, 0x1C, 0x67,
+  0xD7, 0x41, 0x81, 0xF8, 0xFD, 0x51, 0x81, 0xFD, 0xF9, 0x41, 0x87, 0xD4, 0x62, 0x19, 0x06, 0x08, 0x04, 0x04, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x02,
+  0x02, 0x07, 0x00, 0x82, 0x04, 0x42, 0xBE, 0x41, 0x83, 0xFA, 0xFE, 0xFD, 0xFE, 0x4D, 0x83, 0xFE, 0xFD, 0xFE, 0xFB, 0x41, 0x82, 0xB9, 0x3E, 0x03,
+  0x00, 0x82, 0x08, 0x03, 0x02, 0xC0, 0x02, 0x82, 0x02, 0x08, 0x01, 0x00, 0x87, 0x2C, 0x9E, 0xF0, 0xFD, 0xFC, 0xFE, 0xFB, 0xFE, 0x4D, 0x87, 0xFE,
+  0xFB, 0xFE, 0xFD, 0xFC, 0xEB, 0x99, 0x28, 0x00, 0x82, 0x01, 0x09, 0x03, 0xC0, 0x02, 0x81, 0x02, 0x09, 0x01, 0x84, 0x1A, 0x73, 0xC4, 0xF3, 0xFD,
+  0x40, 0x81, 0xF9, 0xFD, 0x4D, 0x81, 0xFD, 0xF9, 0x40, 0x84, 0xFD, 0xF1, 0xBF, 0x6D, 0x17, 0x01, 0x81, 0x08, 0x02, 0xC0, 0x02, 0x81, 0x02, 0x07,
+  0x00, 0x84, 0x02, 0x0E, 0x45, 0x96, 0xE9, 0x41, 0x81, 0xF7, 0xFD, 0x4D, 0x81, 0xFD, 0xF7, 0x41, 0x84, 0xE7, 0x90, 0x3F, 0x0D, 0x02, 0x00, 0x81,
+  0x06, 0x02, 0xC0, 0x02, 0x87, 0x01, 0x04, 0x01, 0x02, 0x03, 0x18, 0x6B, 0xDA, 0x41, 0x81, 0xF7, 0xFD, 0x4D, 0x81, 0xFE, 0xF7, 0x41, 0x87, 0xD7,
+  0x65, 0x14, 0x02, 0x02, 0x01, 0x04, 0x01, 0xC0, 0x02, 0x83, 0x01, 0x02, 0x01, 0x04, 0x00, 0x83, 0x03, 0x49, 0xC4, 0xFC, 0x40, 0x82, 0xFA, 0xFD,
+  0xFE, 0x4B, 0x82, 0xFE, 0xFE, 0xFA, 0x40, 0x82, 0xFB, 0xC0, 0x45, 0x01, 0x83, 0x04, 0x01, 0x02, 0x01, 0xC0, 0x04, 0x81, 0x02, 0x06, 0x01, 0x84,
+  0x2C, 0x9F, 0xE9, 0xFE, 0xFE, 0x40, 0x81, 0xFB, 0xFE, 0x49, 0x81, 0xFE, 0xFB, 0x40, 0x84, 0xFD, 0xFD, 0xE6, 0x9B, 0x2A, 0x01, 0x81, 0x06, 0x02,
+  0xC0, 0x04, 0x81, 0x02, 0x07, 0x00, 0x84, 0x01, 0x1A, 0x75, 0xC9, 0xF8, 0x41, 0x81, 0xF9, 0xFE, 0x49, 0x81, 0xFE, 0xF9, 0x41, 0x84, 0xF7, 0xC5,
+  0x70, 0x19, 0x01, 0x00, 0x81, 0x07, 0x02, 0xC0, 0x04, 0x81, 0x02, 0x07, 0x01, 0x84, 0x0B, 0x46, 0x9A, 0xE9, 0xFD, 0x40, 0x81, 0xF7, 0xFD, 0x49,
+  0x81, 0xFD, 0xF7, 0x40, 0x84, 0xFD, 0xE8, 0x96, 0x42, 0x0A, 0x01, 0x81, 0x06, 0x01, 0xC0, 0x04, 0x81, 0x02, 0x05, 0x00, 0x84, 0x01, 0x04, 0x20,
+  0x6D, 0xD9, 0x41, 0x81, 0xF7, 0xFD, 0x49, 0x81, 0xFD, 0xF7, 0x41, 0x84, 0xD8, 0x6A, 0x1E, 0x03, 0x01, 0x00, 0x81, 0x04, 0x01, 0xC0, 0x05, 0x82,
+  0x02, 0x02, 0x04, 0x00, 0x82, 0x06, 0x46, 0xC2, 0x41, 0x82, 0xFA, 0xFE, 0xFE, 0x46, 0x83, 0xFE, 0xFD, 0xFD, 0xFA, 0x41, 0x82, 0xBF, 0x43, 0x05,
+  0x00, 0x82, 0x05, 0x02, 0x02, 0xC0, 0x06, 0x81, 0x02, 0x07, 0x01, 0x86, 0x2E, 0xA4, 0xF4, 0xFD, 0xFC, 0xFE, 0xFC, 0x46, 0x87, 0xFE, 0xFB, 0xFD,
+  0xFC, 0xFD, 0xF1, 0xA1, 0x2B, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x06, 0x81, 0x02, 0x08, 0x01, 0x84, 0x1C, 0x79, 0xCA, 0xF4, 0xFE, 0x40, 0x81, 0xF9,
+  0xFD, 0x45, 0x87, 0xFD, 0xF9, 0xFE, 0xFD, 0xF4, 0xC7, 0x76, 0x1A, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x06, 0x81, 0x02, 0x07, 0x00, 0x84, 0x02, 0x10,
+  0x4A, 0x9C, 0xEB, 0x41, 0x81, 0xF7, 0xFD, 0x45, 0x81, 0xFD, 0xF7, 0x41, 0x84, 0xEA, 0x98, 0x47, 0x0F, 0x02, 0x00, 0x81, 0x06, 0x02, 0xC0, 0x06,
+  0x87, 0x01, 0x05, 0x01, 0x01, 0x03, 0x1C, 0x70, 0xDB, 0x40, 0x82, 0xFE, 0xF7, 0xFD, 0x45, 0x81, 0xFE, 0xF7, 0x41, 0x87, 0xD9, 0x6A, 0x18, 0x03,
+  0x02, 0x01, 0x04, 0x01, 0xC0, 0x06, 0x83, 0x01, 0x03, 0x01, 0x04, 0x00, 0x83, 0x05, 0x4C, 0xC7, 0xFD, 0x40, 0x82, 0xF9, 0xFD, 0xFE, 0x43, 0x82,
+  0xFE, 0xFE, 0xFA, 0x40, 0x83, 0xFD, 0xC3, 0x48, 0x02, 0x00, 0x83, 0x04, 0x01, 0x02, 0x01, 0xC0, 0x07, 0x82, 0x01, 0x02, 0x07, 0x01, 0x82, 0x2E,
+  0xA4, 0xEE, 0x40, 0x83, 0xFD, 0xFE, 0xFC, 0xFE, 0x41, 0x81, 0xFE, 0xFB, 0x40, 0x84, 0xFE, 0xFE, 0xEB, 0xA1, 0x2C, 0x01, 0x81, 0x06, 0x02, 0xC0,
+  0x08, 0x8B, 0x02, 0x08, 0x01, 0x01, 0x1C, 0x7C, 0xD0, 0xF9, 0xFE, 0xFE, 0xFA, 0xFE, 0x41, 0x81, 0xFE, 0xF9, 0x41, 0x87, 0xF8, 0xCB, 0x78, 0x1B,
+  0x01, 0x01, 0x07, 0x02, 0xC0, 0x08, 0x81, 0x02, 0x07, 0x01, 0x87, 0x0D, 0x4D, 0xA1, 0xEA, 0xFD, 0xFE, 0xF7, 0xFD, 0x41, 0x81, 0xFD, 0xF7, 0x40,
+  0x84, 0xFD, 0xE9, 0x9C, 0x49, 0x0C, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x08, 0x81, 0x02, 0x05, 0x00, 0x84, 0x01, 0x06, 0x25, 0x73, 0xDC, 0x41, 0x81,
+  0xF7, 0xFD, 0x41, 0x81, 0xFD, 0xF7, 0x41, 0x84, 0xDB, 0x70, 0x23, 0x05, 0x01, 0x00, 0x81, 0x05, 0x02, 0xC0, 0x09, 0x86, 0x02, 0x02, 0x04, 0x01,
+  0x07, 0x4A, 0xC6, 0x41, 0x85, 0xF9, 0xFD, 0xFD, 0xFD, 0xFD, 0xFA, 0x41, 0x82, 0xC5, 0x49, 0x06, 0x00, 0x82, 0x04, 0x02, 0x02, 0xC0, 0x0A, 0x81,
+  0x02, 0x06, 0x01, 0x8D, 0x31, 0xAA, 0xF5, 0xFE, 0xFB, 0xFD, 0xFA, 0xFA, 0xFD, 0xFC, 0xFD, 0xF4, 0xA8, 0x31, 0x01, 0x81, 0x06, 0x02, 0xC0, 0x0A,
+  0x81, 0x02, 0x07, 0x01, 0x8D, 0x1E, 0x80, 0xD0, 0xF6, 0xFD, 0xFE, 0xF7, 0xF7, 0xFE, 0xFE, 0xF5, 0xCD, 0x7C, 0x1D, 0x01, 0x81, 0x07, 0x02, 0xC0,
+  0x0A, 0x81, 0x02, 0x06, 0x00, 0x84, 0x01, 0x12, 0x51, 0xA4, 0xEE, 0x41, 0x81, 0xF5, 0xF5, 0x41, 0x84, 0xED, 0xA0, 0x4D, 0x11, 0x02, 0x00, 0x81,
+  0x06, 0x02, 0xC0, 0x0A, 0x81, 0x01, 0x04, 0x01, 0x83, 0x03, 0x22, 0x76, 0xDE, 0x41, 0x81, 0xF6, 0xF5, 0x41, 0x84, 0xDE, 0x73, 0x20, 0x03, 0x01,
+  0x00, 0x81, 0x04, 0x01, 0xC0, 0x0A, 0x81, 0x01, 0x02, 0x00, 0x80, 0x03, 0x00, 0x83, 0x08, 0x50, 0xCA, 0xFE, 0x40, 0x81, 0xF9, 0xF8, 0x40, 0x83,
+  0xFE, 0xCA, 0x4F, 0x07, 0x00, 0x80, 0x04, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x0C, 0x81, 0x02, 0x07, 0x01, 0x89, 0x31, 0xA9, 0xF1, 0xFE, 0xFD, 0xFD,
+  0xFE, 0xF1, 0xAA, 0x31, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x0C, 0x82, 0x02, 0x09, 0x01, 0x00, 0x83, 0x1E, 0x82, 0xD6, 0xFA, 0x41, 0x83, 0xFA, 0xD5,
+  0x81, 0x1E, 0x00, 0x82, 0x01, 0x08, 0x02, 0xC0, 0x0C, 0x81, 0x02, 0x08, 0x01, 0x83, 0x0F, 0x53, 0xA8, 0xEE, 0x41, 0x83, 0xED, 0xA7, 0x51, 0x0E,
+  0x01, 0x81, 0x07, 0x02, 0xC0, 0x0C, 0x91, 0x01, 0x04, 0x01, 0x02, 0x06, 0x25, 0x6C, 0xCC, 0xFB, 0xFB, 0xCB, 0x6B, 0x23, 0x05, 0x02, 0x01, 0x04,
+  0x01, 0xC0, 0x0D, 0x8B, 0x02, 0x02, 0x06, 0x01, 0x07, 0x40, 0xAA, 0xF2, 0xF2, 0xAA, 0x3F, 0x06, 0x00, 0x82, 0x06, 0x02, 0x02, 0xC0, 0x0E, 0x81,
+  0x02, 0x08, 0x01, 0x85, 0x2C, 0x99, 0xED, 0xED, 0x99, 0x2B, 0x01, 0x81, 0x08, 0x02, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_PIZZA_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x20C0, 0x4980, 0x7220, 0x8AA1, 0xAB20, 0xBB60, 0xD3A0, 0xDBC0, 0xE3E0, 0xEC01, 0xF421,
+  0xF421, 0xF441, 0xF461, 0xF461, 0xEC20, 0xE400, 0xD3C0, 0xBB60, 0xAB20, 0x8AA1, 0x7220, 0x4980, 0x20C0, 0x0000, 0x0000, 0x0020,
+  0x0020, 0x0000, 0x0000, 0x0020, 0x1060, 0x28C0, 0x3920, 0x61C0, 0x7A40, 0x9AC0, 0xB320, 0xBB60, 0xCBA0, 0xDBE0, 0xE400, 0xEC40,
+  0xF481, 0xF4A1, 0xF481, 0xF461, 0xF461, 0xF461, 0xEC20, 0xE3E0, 0xDBE0, 0xCBA0, 0xC360, 0xB320, 0x9AC0, 0x7A40, 0x61C0, 0x3920,
+  0x28C0, 0x1060, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3920, 0x6A00, 0x92A0, 0xB320, 0xCBA0, 0xD3C0, 0xDBE0, 0xE3E0,
+  0xEC00, 0xEC00, 0xF460, 0xF480, 0xFD02, 0xFD22, 0xFD22, 0xFCE2, 0xF4A1, 0xF481, 0xF461, 0xF481, 0xEC40, 0xEC40, 0xEC20, 0xEC20,
+  0xE400, 0xDBE0, 0xD3C0, 0xCBA0, 0xB320, 0x92A0, 0x6A00, 0x3920, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
+  0x20A0, 0x5180, 0x92A0, 0xCBA0, 0xF420, 0xFCA1, 0xFD01, 0xFD01, 0xFD02, 0xFD02, 0xFD22, 0xFD43, 0xFD63, 0xFD44, 0xFD24, 0xF504,
+  0xF524, 0xFD44, 0xFD64, 0xFD64, 0xFD44, 0xFD24, 0xFD24, 0xFD23, 0xFD23, 0xFD22, 0xFD02, 0xFD02, 0xFD01, 0xFD01, 0xFCA1, 0xF420,
+  0xCBA0, 0x92C0, 0x5180, 0x20A0, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x28C0, 0x7A60, 0xBB80, 0xDC20, 0xF440, 0xFCA1, 0xFCC1,
+  0xFD02, 0xFD23, 0xFD44, 0xFDA5, 0xFE06, 0xFE07, 0xFDC7, 0xF4E7, 0xE427, 0xE3C7, 0xE407, 0xF4E7, 0xFDE8, 0xFE68, 0xFE48, 0xFE08,
+  0xFDE8, 0xFDE7, 0xFDE7, 0xFDC6, 0xFDA5, 0xFD64, 0xFD44, 0xFD02, 0xFCC1, 0xFCA1, 0xF460, 0xDC20, 0xC3A0, 0x7A60, 0x28C0, 0x0000,
+  0x0000, 0x0000, 0x4980, 0xCBA0, 0xFD21, 0xFD41, 0xFD02, 0xFD03, 0xF4E3, 0xED24, 0xF565, 0xF5A6, 0xF607, 0xF648, 0xF5E9, 0xECA8,
+  0xDB48, 0xD287, 0xCA27, 0xCA47, 0xDB48, 0xECC9, 0xFE0A, 0xFEAA, 0xFECA, 0xFE8A, 0xFE49, 0xFE49, 0xF608, 0xF5C7, 0xF5A6, 0xF566,
+  0xED24, 0xF4E3, 0xFD03, 0xFD02, 0xFD41, 0xFD21, 0xCBA0, 0x4940, 0x0000, 0x0000, 0x0000, 0x0020, 0x5180, 0xD3C0, 0xFD41, 0xFD83,
+  0xFD85, 0xFDE7, 0xFDE8, 0xFE09, 0xFE29, 0xFE89, 0xFEAA, 0xFE29, 0xEC88, 0xCA47, 0xB8E6, 0xB8C6, 0xB8A6, 0xB8A6, 0xC106, 0xCA47,
+  0xE408, 0xFE09, 0xFEEA, 0xFEAA, 0xFE4A, 0xFE4A, 0xFE29, 0xFE29, 0xFE29, 0xFE29, 0xFE29, 0xFE08, 0xFDE7, 0xFD85, 0xFD83, 0xFD21,
+  0xD3C0, 0x5160, 0x0020, 0x0000, 0x0000, 0x0020, 0x3900, 0x9280, 0xCBC1, 0xE4E4, 0xEDA7, 0xF689, 0xFECA, 0xFE8A, 0xFEAA, 0xFEEA,
+  0xFE8A, 0xF529, 0xDB07, 0xB8C6, 0xB005, 0xB005, 0xB845, 0xB025, 0xB005, 0xB885, 0xD267, 0xED08, 0xFE89, 0xFE89, 0xFE49, 0xFE89,
+  0xFE89, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE8A, 0xFE8A, 0xF628, 0xEDA7, 0xE4C4, 0xCBC1, 0x8A80, 0x3900, 0x0020, 0x0000, 0x0020, 0x0840,
+  0x20A0, 0x59C1, 0xA3C5, 0xDD67, 0xF689, 0xFEEA, 0xFEAA, 0xF689, 0xFEEA, 0xFE09, 0xE408, 0xCA06, 0xB886, 0xB025, 0xB865, 0xB8C6,
+  0xB8C6, 0xB845, 0xB025, 0xC986, 0xE428, 0xFE09, 0xFE89, 0xFE89, 0xFEA9, 0xFECA, 0xFF0A, 0xFEEA, 0xFEA9, 0xFE8A, 0xFE8A, 0xF649,
+  0xDD87, 0xA3E5, 0x51C1, 0x20A0, 0x0840, 0x0020, 0x0000, 0x0000, 0x0840, 0x6223, 0xB3C7, 0xECC8, 0xFD69, 0xFDE9, 0xF688, 0xFF09,
+  0xF5E9, 0xDB67, 0xC166, 0xB885, 0xB8A5, 0xB8E6, 0xC166, 0xC166, 0xB8A6, 0xB005, 0xC106, 0xE3A8, 0xFDC9, 0xFEC9, 0xFEE9, 0xFE89,
+  0xFE49, 0xFE49, 0xFE49, 0xF628, 0xFEA9, 0xFF0A, 0xF689, 0xBCE7, 0x6284, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x3081, 0x7103,
+  0xB9A6, 0xE2C7, 0xEC48, 0xEDE8, 0xFF29, 0xFE49, 0xDBA7, 0xC166, 0xB865, 0xB885, 0xB8E6, 0xC166, 0xC166, 0xB8A6, 0xB005, 0xC126,
+  0xE3C8, 0xFE09, 0xFF0A, 0xFEA9, 0xF589, 0xECA8, 0xE468, 0xECA8, 0xED07, 0xFE69, 0xFF6A, 0xE669, 0x8BC5, 0x3142, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x1000, 0x4001, 0x9804, 0xD0E6, 0xDA67, 0xE487, 0xFEA9, 0xFEA9, 0xECA8, 0xD227, 0xB886,
+  0xB005, 0xB865, 0xB8A6, 0xB8A6, 0xB825, 0xB845, 0xC9E6, 0xECA8, 0xFE69, 0xFE49, 0xED08, 0xDB87, 0xD267, 0xD247, 0xD287, 0xD326,
+  0xF509, 0xFE8A, 0xD5A8, 0x5A63, 0x1060, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2801,
+  0x8803, 0xC046, 0xC8C6, 0xD2C6, 0xF589, 0xFEC9, 0xFDE9, 0xE3A8, 0xC166, 0xB005, 0xB005, 0xB025, 0xB005, 0xB025, 0xC106, 0xDB67,
+  0xF5E9, 0xFE69, 0xECA8, 0xD267, 0xC126, 0xB886, 0xB886, 0xB8C6, 0xB8E5, 0xDAA7, 0xEC88, 0xAC26, 0x3982, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x70A3, 0xA024, 0xC006, 0xD1A7, 0xEC88, 0xF688, 0xFEA9, 0xF529, 0xDB27, 0xC186, 0xC106,
+  0xB8E6, 0xB8E6, 0xC9A6, 0xD307, 0xED08, 0xFE89, 0xF5C9, 0xDB07, 0xB8C6, 0xB005, 0xB005, 0xA804, 0xB825, 0xB825, 0xC906, 0xBA66,
+  0x8244, 0x20C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x5062, 0x8824, 0xB005, 0xD167, 0xEC48, 0xF628, 0xFEC9, 0xFE49,
+  0xF549, 0xE428, 0xDB67, 0xDB07, 0xDB47, 0xE448, 0xF569, 0xFE89, 0xFE69, 0xECA8, 0xC9C6, 0xB825, 0xB845, 0xB8A5, 0xB084, 0xB886,
+  0xC886, 0xB885, 0x90C4, 0x50A2, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3061, 0x7023, 0xA845, 0xD9C7, 0xF468,
+  0xF628, 0xFEC9, 0xFECA, 0xFEC9, 0xFE29, 0xF589, 0xF529, 0xF549, 0xFE29, 0xFEC9, 0xFF0A, 0xFE29, 0xE3E8, 0xC146, 0xB025, 0xB8A6,
+  0xC146, 0xB105, 0xC906, 0xD106, 0xB0A5, 0x6023, 0x2801, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0800, 0x4802, 0xA0A5, 0xE267, 0xF4E9, 0xF668, 0xFEC9, 0xFEA9, 0xFEEA, 0xFEA9, 0xFE89, 0xFE69, 0xFE69, 0xFEA9, 0xFEC9, 0xFEC9,
+  0xFE09, 0xE408, 0xC146, 0xB005, 0xB8A6, 0xC146, 0xB905, 0xC906, 0xD0E6, 0xA085, 0x4822, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x3041, 0xA1C4, 0xEBE8, 0xFE29, 0xF6E9, 0xFEC9, 0xFE69, 0xFE89, 0xFEC9, 0xFEEA,
+  0xFEEA, 0xFEA9, 0xFE69, 0xFE49, 0xFE89, 0xFE49, 0xECA8, 0xCA06, 0xB865, 0xB045, 0xB886, 0xB065, 0xC086, 0xB885, 0x8884, 0x3041,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x28A1, 0x92E5, 0xE528, 0xFEEA, 0xFF0A, 0xFE49, 0xED68, 0xF5C9, 0xFE49, 0xFEC9,
+  0xFEEA, 0xFE89, 0xFE49, 0xFE29, 0xFE89, 0xFEA9, 0xF589, 0xDB47, 0xC146, 0xA804, 0xB005, 0xB805, 0xC046, 0xA064, 0x6842, 0x1820,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x10A0, 0x7304, 0xC507, 0xF609, 0xFDA9, 0xEC68, 0xD366, 0xDBA7, 0xEC68, 0xF549, 0xFE09,
+  0xFE69, 0xFE69, 0xFE29, 0xFE69, 0xFEC9, 0xFE49, 0xECC8, 0xD2E7, 0xB945, 0xC0C6, 0xC8E6, 0xC125, 0x90E4, 0x5082, 0x1000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x4202, 0x9345, 0xD3C7, 0xEB28, 0xD1E6, 0xB0C5, 0xC106, 0xC9C6, 0xD2E7, 0xEC88, 0xFE09,
+  0xFEA9, 0xFE69, 0xFE49, 0xFE69, 0xFE89, 0xFE29, 0xF528, 0xDBA6, 0xE327, 0xEB48, 0xCAE7, 0x81E4, 0x30C1, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0000, 0x0020, 0x18E1, 0x6183, 0xA9C5, 0xD947, 0xC086, 0xA804, 0xB005, 0xB845, 0xC106, 0xD2E7, 0xF548, 0xFE89,
+  0xFEA9, 0xFE49, 0xFE29, 0xFE69, 0xFEC9, 0xFE89, 0xEDA8, 0xFD89, 0xFDA9, 0xCC87, 0x6223, 0x18C1, 0x0000, 0x0000, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x3041, 0x9064, 0xC086, 0xC086, 0xB064, 0xB886, 0xB045, 0xB025, 0xC166, 0xE408, 0xFDE9, 0xFEA9,
+  0xFE89, 0xFE49, 0xFE29, 0xFE89, 0xFEC9, 0xF688, 0xFF0A, 0xFECA, 0xBCE6, 0x39A2, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x1800, 0x7023, 0xB065, 0xC8E6, 0xC926, 0xC166, 0xB8A5, 0xB005, 0xB8C6, 0xDB07, 0xF549, 0xFE89, 0xFECA, 0xFEA9, 0xFE49, 0xF628,
+  0xFEA9, 0xFF2A, 0xFF6A, 0xEE69, 0x9C25, 0x2101, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0x5022, 0x8864, 0xC0C5, 0xC926, 0xC946,
+  0xB0A5, 0xB025, 0xB8C6, 0xDAC7, 0xED08, 0xFE69, 0xFF0A, 0xFEEA, 0xFE69, 0xF5E8, 0xFE49, 0xFEAA, 0xF689, 0xC507, 0x72E4, 0x1080,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x3041, 0x7883, 0xB0A5, 0xD0C6, 0xC0E6, 0xA844, 0xB005, 0xC106, 0xDB27, 0xF549,
+  0xFEA9, 0xFEEA, 0xFE69, 0xF548, 0xE447, 0xEC48, 0xF489, 0xD427, 0x8AE4, 0x4162, 0x0840, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1020, 0x5042, 0xA065, 0xC886, 0xC086, 0xA804, 0xB005, 0xC166, 0xE3E8, 0xFE29, 0xFEEA, 0xFE69, 0xECE8,
+  0xDB07, 0xC1A5, 0xC966, 0xD1A7, 0xA9A5, 0x50E2, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x3821, 0x9083, 0xC8A6, 0xC086, 0xB045, 0xC106, 0xD2C7, 0xED28, 0xFEC9, 0xFEC9, 0xF549, 0xD307, 0xC126, 0xB024, 0xB826,
+  0xC026, 0x8843, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2041, 0x8103, 0xB965, 0xC986, 0xD207,
+  0xDB27, 0xECE8, 0xFE69, 0xFEEA, 0xFE09, 0xE3E8, 0xB965, 0xB825, 0xB846, 0xC086, 0xA045, 0x6823, 0x2000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1860, 0x6983, 0xAAA5, 0xDBE7, 0xECC8, 0xF589, 0xF648, 0xFF0A, 0xFEAA, 0xF549, 0xD307, 0xB0A4, 0xB805,
+  0xC8A6, 0xC125, 0x90C4, 0x5062, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x49C2, 0x93E5, 0xE629, 0xFF4A,
+  0xFEEA, 0xF6A8, 0xFEEA, 0xFE69, 0xECE8, 0xD2C7, 0xB0A4, 0xB825, 0xD0C6, 0xB125, 0x78A3, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0000, 0x0020, 0x2121, 0x6B64, 0xDE68, 0xFF6A, 0xFEEA, 0xF668, 0xFEE9, 0xFE89, 0xF548, 0xDB27, 0xB8C5, 0xB825, 0xC886,
+  0xA8C5, 0x5062, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4182, 0xB3E6, 0xF529, 0xF549,
+  0xF588, 0xFEA9, 0xFEE9, 0xFE09, 0xE3E8, 0xB905, 0xB805, 0xC026, 0x8864, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2041, 0x8163, 0xCA26, 0xE2C7, 0xE3A7, 0xF548, 0xF668, 0xF688, 0xF528, 0xDAC7, 0xC906, 0xB065, 0x7863, 0x2000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1000, 0x5842, 0x9864, 0xC065, 0xD167, 0xDB27, 0xE507, 0xF688, 0xFE89, 0xF509, 0xDB27, 0xA184, 0x6083, 0x1000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3001, 0x7003, 0xA804, 0xC846, 0xC986, 0xD3A6, 0xEDC8, 0xFF2A, 0xFEEA, 0xE508,
+  0x8A85, 0x40A2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x5002, 0xA045, 0xC866, 0xC0C6, 0xCA66, 0xE4E7,
+  0xFF0A, 0xFF6A, 0xDDA7, 0x6AC3, 0x18A1, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3861, 0x90E4, 0xC086,
+  0xC046, 0xC1A5, 0xE467, 0xFECA, 0xFF2A, 0xC547, 0x4A63, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x7883, 0xA824,
+  0xB825, 0xC9E6, 0xF4E8, 0xFEEA, 0xEE69, 0xA425, 0x2941, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x5842, 0x9824, 0xB8A5,
+  0xE2E8, 0xFDE9, 0xF6C9, 0xD587, 0x7AC4, 0x1881, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7863, 0xC9E6, 0xFC89,
+  0xFEEA, 0xEEE9, 0xA465, 0x49A2, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x58E3, 0xBB46, 0xF588,
+  0xF6C9, 0xC5A7, 0x62C4, 0x18A1, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x3922, 0xA3C5,
+  0xEDE8, 0xEE29, 0xA445, 0x39A2, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x2961, 0x9425, 0xEE08, 0xEDC8, 0x93A5, 0x20E1,
+  0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_PIZZA_44_SPANS = {
+  SPRITE_PIZZA_44_SPAN_ROWS, SPRITE_PIZZA_44_SPAN_OPS, SPRITE_PIZZA_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_PIZZA_44_ASSET = {
   SPRITE_PIZZA_44_WIDTH, SPRITE_PIZZA_44_HEIGHT,
-  SPRITE_PIZZA_44_ALPHA, SPRITE_PIZZA_44_RGB565
+  nullptr, nullptr, &SPRITE_PIZZA_44_SPANS
 };
 
 #endif // SPRITE_PIZZA_44_INCLUDED
@@ -5,110 +5,163 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from poop_emoji_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from poop_emoji_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1495/1936 pixels visibles, 3960 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_POOP_EMOJI_44_WIDTH = 44;
 constexpr uint16_t SPRITE_POOP_EMOJI_44_HEIGHT = 44;
 
-const uint16_t SPRITE_POOP_EMOJI_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0xBB4A, 0xC36A, 0xBB4A, 0x0000, 0x9986, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB2A, 0xC36A, 0xC36A, 0xC34A, 0xC32A, 0x0000, 0x0000, 0x0000, 0xFBEF, 0xB9E7, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAAA, 0x0000, 0xC36A, 0xC34A, 0xC34A, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xCB6A, 0xC34A, 0xBB4A, 0xC34A, 0xBB4A, 0xB329, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xAAAA, 0xB369, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xCB8A, 0xCB6A, 0xC36A, 0xBB4A, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0xBBE7, 0x0000, 0x0000, 0xCB6B, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xC34A, 0xC32A, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0xB369, 0xC329, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB8B, 0xBB4A, 0xFFE0, 0xCB2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xFFFF, 0xC36A, 0xBB4A, 0xC34A, 0xBB4A, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB8B, 0xBB4A, 0x0000, 0xB369, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xC34A, 0xBB4A, 0xC36A, 0xCB6A, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB6A, 0xBB4A, 0xBB6A, 0x0000, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xCB26, 0xBB2A, 0xCB8B, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xB34A, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAAA, 0x0000, 0xC34A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xCB6A, 0xC36A, 0xBB2A, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xC36A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xC34A, 0xC34A, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xCB6A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB29, 0xBAE8, 0xBAE8, 0xBAE8, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBAE8, 0xBAE8, 0xBAE8, 0xBB29, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xBB4A, 0xBAE7, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAAA, 0xFBEF, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB09, 0xC3CC, 0xDD94, 0xDDD6, 0xDD94, 0xC3CC, 0xBB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xC36B, 0xD553, 0xDDD6, 0xDDB5, 0xCC4E, 0xBB09, 0xC34A, 0xBB4A, 0xBB4A, 0xC36A, 0xC34A, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x7BE0, 0x0000, 0xCB29, 0xBB4A, 0xC36A, 0xBB09, 0xCC4F, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xCC4F, 0xBB09, 0xC34A, 0xBB4A, 0xBB4A, 0xBB29, 0xC3AC, 0xEEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xD512, 0xBB09, 0xBB4A, 0xBB4A, 0xCB6A, 0xBB4A, 0x0000, 0xBBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0xBB4A, 0xBB4A, 0xC34A, 0xBB29, 0xC38B, 0xEF3C, 0xFFFF, 0xFFDF, 0xE71C, 0xDEFB, 0xFFFF, 0xF75C, 0xC38B, 0xBB29, 0xBB4A, 0xBB4A, 0xBB29, 0xE679, 0xFFFF, 0xE71C, 0xDEFB, 0xF7BF, 0xFFFF, 0xF7DF, 0xCC4E, 0xBB09, 0xC34A, 0xCB8B, 0xBB4A, 0xF800, 0x9B26, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xF800, 0xD2E8, 0xC34A, 0xCB6A, 0xC36A, 0xC36A, 0xBB09, 0xDD53, 0xF7FF, 0xFFFF, 0x9CF4, 0x2986, 0x2145, 0x73CF, 0xF7FF, 0xD553, 0xBB09, 0xC34A, 0xBB09, 0xCC6F, 0xFFFF, 0x9CF4, 0x2986, 0x2145, 0x7BF0, 0xF79E, 0xFFFF, 0xE637, 0xBB29, 0xBB4A, 0xCB8B, 0xC34A, 0x0000, 0xAAA5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0xAAAA, 0xBB2A, 0xCB8B, 0xC34A, 0xBB4A, 0xC34A, 0xBB09, 0xE679, 0xFFFF, 0xCE9A, 0x2986, 0x2145, 0x2986, 0x1904, 0xADB7, 0xF6FB, 0xBAE8, 0xC36A, 0xBAE8, 0xE5D5, 0xD6FB, 0x2966, 0x2145, 0x2986, 0x1904, 0xAD75, 0xFFFF, 0xEF3C, 0xC36B, 0xBB29, 0xCB6A, 0xBB4A, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0xBB4A, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xE6BA, 0xFFFF, 0xB5B6, 0x1904, 0x29A7, 0x2986, 0x18E4, 0x8472, 0xFF5C, 0xBAE8, 0xC36A, 0xB2C8, 0xEE57, 0xB618, 0x18E4, 0x29A7, 0x2986, 0x1904, 0x8431, 0xFFFF, 0xEF7D, 0xC38B, 0xBB2A, 0xBB4A, 0xC34A, 0xC34A, 0xCB2A, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xCB2C, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xE6BA, 0xFFFF, 0xB5B6, 0x1904, 0x29A7, 0x2986, 0x18E4, 0x8472, 0xFF5C, 0xBAE8, 0xC36A, 0xB2C8, 0xEE57, 0xB618, 0x18E4, 0x29A7, 0x2986, 0x1904, 0x8431, 0xFFFF, 0xEF7D, 0xC38B, 0xBB2A, 0xBB4A, 0xBB4A, 0xCB8B, 0xBB4A, 0xBBE7, 0xFFFF, 0xF800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7BEF, 0x0000, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xE678, 0xFFFF, 0xD6DB, 0x31A7, 0x2125, 0x2166, 0x1904, 0xB5F8, 0xF6DA, 0xBAE8, 0xC36A, 0xBAE8, 0xE5B5, 0xDF1C, 0x29A6, 0x2125, 0x2166, 0x1925, 0xB5B7, 0xFFFF, 0xEF3C, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB8B, 0xBB4A, 0x0000, 0xFBEF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xD512, 0xF7FF, 0xFFFF, 0xAD76, 0x3A08, 0x31A7, 0x8C71, 0xFFFF, 0xD512, 0xBB09, 0xC34A, 0xBB29, 0xCC2E, 0xFFFF, 0xAD76, 0x39E8, 0x31A7, 0x8C72, 0xF7BF, 0xFFFF, 0xE5F7, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC34A, 0x0000, 0xAAAA, 0x0000,
-  0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xC36B, 0xEF1B, 0xFFFF, 0xFFDF, 0xEF7E, 0xEF7D, 0xFFFF, 0xEF1B, 0xC36B, 0xBB2A, 0xBB4A, 0xBB4A, 0xBB29, 0xE637, 0xFFFF, 0xEF9E, 0xEF7D, 0xFFDF, 0xFFFF, 0xF79E, 0xCC0D, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB6A, 0xC34A, 0x0000, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0x0000, 0xBB09, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xCC0D, 0xEF1B, 0xF7FF, 0xFFFF, 0xFFFF, 0xEF1B, 0xC3ED, 0xBB29, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xC38B, 0xE679, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xD4B0, 0xBB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xFB2C, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xBBE7, 0x0000, 0xBB2A, 0xCB8A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB09, 0xC38B, 0xD512, 0xD553, 0xD512, 0xC38B, 0xBB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xBB4A, 0xD4D1, 0xD553, 0xD533, 0xC3ED, 0xBB09, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xC32A, 0x0000, 0xAAAA,
-  0x0000, 0x0000, 0xFBEF, 0x0000, 0xBB4A, 0xC34A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB2A, 0xBAE8, 0xBAE8, 0xBAE8, 0xBB2A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB08, 0xBAE8, 0xBAE8, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0x0000, 0xAAAA,
-  0x0000, 0xAAAA, 0x0000, 0xBB2A, 0xBB4A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0x0000, 0xAAAA,
-  0x7BEF, 0x0000, 0xBB4A, 0xC34A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0x7BEF, 0xAAAA,
-  0x0000, 0xC36A, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0x0000, 0xAAAA,
-  0xD38B, 0xBB2A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0x8288, 0x5207, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x6227, 0xB329, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xBB2A, 0x0000,
-  0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0x7248, 0x1125, 0x2166, 0x1946, 0x1946, 0x1946, 0x1966, 0x2166, 0x1946, 0x1925, 0x1125, 0x1125, 0x1125, 0x1125, 0x1125, 0x1945, 0x2166, 0x2166, 0x1946, 0x1946, 0x1946, 0x2166, 0x1946, 0x3186, 0xB32A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xCB6A, 0xBB4A, 0xBB2A,
-  0xBB4A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB2A, 0x41C7, 0x2166, 0x2986, 0x2986, 0x2986, 0x2166, 0x1925, 0x2986, 0x4A08, 0x5249, 0x5A4A, 0x524A, 0x524A, 0x4A29, 0x39C7, 0x2145, 0x2145, 0x2986, 0x2986, 0x2986, 0x2986, 0x2166, 0x8AA8, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xBB4A,
-  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xAB09, 0x3186, 0x2166, 0x2966, 0x1945, 0x41E8, 0x938F, 0xC493, 0xE536, 0xFD97, 0xFD98, 0xFD98, 0xFD98, 0xF557, 0xD4D4, 0xAC11, 0x628B, 0x2166, 0x2145, 0x2986, 0x1946, 0x7248, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xBB4A,
-  0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xA2E9, 0x39A6, 0x2166, 0x8B4E, 0xE516, 0xFD98, 0xFD98, 0xF577, 0xF557, 0xED57, 0xF557, 0xF557, 0xF557, 0xFD77, 0xFD98, 0xF577, 0xBC52, 0x4208, 0x2166, 0x7268, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A,
-  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xAB09, 0xA36D, 0xFD98, 0xFD98, 0xF557, 0xED57, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xED57, 0xF577, 0xFDB9, 0xCC72, 0x92C9, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A,
-  0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xCBCD, 0xE4B2, 0xF556, 0xF577, 0xF577, 0xF598, 0xF598, 0xF598, 0xF598, 0xF578, 0xF577, 0xF557, 0xECF4, 0xD42F, 0xC36B, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
-  0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xBB49, 0xC36B, 0xD3EE, 0xDC71, 0xE4B3, 0xE4B3, 0xE4B3, 0xE4B3, 0xDC92, 0xD42F, 0xC3AC, 0xC34A, 0xBB29, 0xBB2A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
-  0xBB4A, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xBB4A,
-  0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB6A, 0xBB4A,
-  0x0000, 0xC34A, 0xCB8B, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xBB4A, 0xC36A,
-  0x7BEF, 0xB369, 0xBB4A, 0xCB8B, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xBB4A, 0x0000,
-  0xFFE0, 0x0000, 0xBB88, 0xBB4A, 0xCB8B, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xCB6A, 0xCB6A, 0xC36A, 0xCB6A, 0xCB6A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xC36A, 0xBB29, 0x0000, 0xFBEF,
-  0x0000, 0x7BE0, 0x0000, 0xCB2C, 0xBB4A, 0xC34A, 0xCB6A, 0xC36A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xCB8B, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xCB8B, 0xC36A, 0xC36A, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xCB6A, 0xC34A, 0xBB29, 0x0000, 0xAAAA, 0x0000,
-  0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0xBB2A, 0xBB4A, 0xC34A, 0xBB4A, 0xC34A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xCB4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xC34A, 0xBB4A, 0xBAEA, 0x0000, 0xFBEF, 0x0000, 0x0000
+const uint16_t SPRITE_POOP_EMOJI_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 13, 6, 30, 15, 49, 25, 72, 39, 92, 56, 118, 75, 139, 95,
+  159, 118, 180, 142, 202, 170, 220, 198, 240, 227, 259, 258, 277, 289, 297, 320,
+  316, 352, 332, 386, 352, 421, 372, 457, 391, 496, 408, 534, 427, 573, 446, 612,
+  463, 651, 483, 690, 502, 730, 522, 771, 541, 814, 558, 856, 571, 899, 584, 943,
+  595, 987, 604, 1031, 611, 1075, 615, 1119, 617, 1163, 625, 1207, 636, 1251, 648, 1295,
+  662, 1338, 688, 1381, 722, 1423, 748, 1463
 };
 
-const uint8_t SPRITE_POOP_EMOJI_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6F, 0xE3, 0x31, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x68, 0xFB, 0xFF, 0xE0, 0x45, 0x00, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2F, 0xF8, 0xFF, 0xFC, 0xFF, 0xFD, 0x95, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0xCC, 0x84, 0x4F, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xDE, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x5A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x10, 0xED, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFF, 0xFB, 0x36, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x2D, 0x5D, 0xF3, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x89, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x48, 0x9B, 0xC9, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFE, 0x93, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xAC, 0x1C, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0xB9, 0xFF, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE7, 0x9D, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x47, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x4B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x81, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xF6, 0x3C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x86, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xD2, 0x08, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x50, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x4D, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0A, 0xD9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x9B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x53, 0xC4, 0xF5, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xAF, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0B, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xA6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xA5, 0xFF, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xB2, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x5C, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xA8, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x05, 0xC5, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBB, 0x08, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x90, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x43, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFA, 0x34, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x3A, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x9B, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x17, 0xF5, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xE4, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x9E, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0x3B, 0x00, 0x03,
-  0x00, 0x00, 0x02, 0x00, 0x1F, 0xA6, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x4B, 0x00, 0x03,
-  0x00, 0x03, 0x00, 0x52, 0xE6, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x4B, 0x00, 0x03,
-  0x02, 0x00, 0x5B, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x3F, 0x02, 0x03,
-  0x00, 0x3C, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0x5D, 0x00, 0x03,
-  0x0B, 0xCE, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF2, 0x3C, 0x00,
-  0x5B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD1, 0x0F,
-  0xB2, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x65,
-  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xBC,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF3,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xD4, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
-  0x8A, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xC0,
-  0x29, 0xF1, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x6D,
-  0x00, 0x82, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xDA, 0x15,
-  0x02, 0x07, 0xB4, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0x4A, 0x00,
-  0x01, 0x00, 0x0B, 0xB2, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x67, 0x00, 0x02,
-  0x00, 0x02, 0x00, 0x05, 0x7C, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xDA, 0xB7, 0x6E, 0x30, 0x61, 0xBA, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x4D, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x28, 0x80, 0xC7, 0xF5, 0xFF, 0xFE, 0xFF, 0xFD, 0xE1, 0xC2, 0x9C, 0x73, 0x47, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x52, 0x74, 0x9F, 0xC1, 0xD9, 0xEE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xF9, 0xBF, 0x6E, 0x13, 0x00, 0x02, 0x00, 0x00
+const uint8_t SPRITE_POOP_EMOJI_44_SPAN_OPS[] PROGMEM = {
+  0x10, 0x80, 0x02, 0x00, 0x82, 0x6F, 0xE3, 0x31, 0x00, 0x81, 0x05, 0x02, 0xC0, 0x0F, 0x80, 0x02, 0x00, 0x81, 0x68, 0xFB, 0x40, 0x81, 0xE0, 0x45,
+  0x02, 0x82, 0x02, 0x04, 0x01, 0xC0, 0x0E, 0x80, 0x03, 0x00, 0x81, 0x2F, 0xF8, 0x40, 0x80, 0xFC, 0x40, 0x82, 0xFD, 0x95, 0x32, 0x03, 0x80, 0x02,
+  0xC0, 0x0E, 0x80, 0x02, 0x00, 0x80, 0x98, 0x40, 0x80, 0xFC, 0x40, 0x80, 0xFD, 0x41, 0x84, 0xF8, 0xCC, 0x84, 0x4F, 0x14, 0x00, 0x80, 0x01, 0xC0,
+  0x0D, 0x85, 0x01, 0x03, 0x07, 0xDE, 0xFE, 0xFD, 0x41, 0x81, 0xFE, 0xFC, 0x43, 0x81, 0xDB, 0x5A, 0x00, 0x80, 0x02, 0xC0, 0x0A, 0x82, 0x01, 0x02,
+  0x04, 0x01, 0x81, 0x10, 0xED, 0x40, 0x80, 0xFE, 0x43, 0x83, 0xFE, 0xFD, 0xFC, 0xFB, 0x40, 0x81, 0xFB, 0x36, 0x00, 0x80, 0x02, 0xC0, 0x09, 0x80,
+  0x01, 0x02, 0x83, 0x07, 0x2D, 0x5D, 0xF3, 0x40, 0x80, 0xFE, 0x47, 0x80, 0xF9, 0x40, 0x82, 0x89, 0x01, 0x05, 0xC0, 0x08, 0x80, 0x01, 0x00, 0x84,
+  0x01, 0x48, 0x9B, 0xC9, 0xF4, 0x4B, 0x82, 0xFA, 0xFE, 0x93, 0x00, 0x81, 0x07, 0x02, 0xC0, 0x07, 0x80, 0x01, 0x00, 0x81, 0x16, 0xBB, 0x43, 0x80,
+  0xFC, 0x4A, 0x80, 0xFC, 0x40, 0x81, 0xAC, 0x1C, 0x01, 0x80, 0x03, 0xC0, 0x06, 0x83, 0x01, 0x01, 0x05, 0xB9, 0x40, 0x83, 0xFC, 0xFC, 0xFC, 0xFE,
+  0x4D, 0x83, 0xFC, 0xE7, 0x9D, 0x22, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x80, 0x03, 0x00, 0x80, 0x47, 0x40, 0x81, 0xFB, 0xFE, 0x53, 0x81, 0xE7, 0x4B,
+  0x00, 0x80, 0x03, 0xC0, 0x06, 0x80, 0x02, 0x00, 0x82, 0x81, 0xFE, 0xFC, 0x52, 0x81, 0xFE, 0xFB, 0x40, 0x81, 0xF6, 0x3C, 0x00, 0x80, 0x02, 0xC0,
+  0x06, 0x80, 0x02, 0x00, 0x80, 0x86, 0x40, 0x80, 0xFC, 0x54, 0x80, 0xFB, 0x40, 0x83, 0xD2, 0x08, 0x01, 0x01, 0xC0, 0x06, 0x82, 0x03, 0x02, 0x50,
+  0x40, 0x80, 0xFD, 0x55, 0x80, 0xFD, 0x40, 0x80, 0x4D, 0x00, 0x80, 0x03, 0xC0, 0x05, 0x81, 0x01, 0x02, 0x00, 0x81, 0x0A, 0xD9, 0x40, 0x80, 0xFD,
+  0x54, 0x82, 0xFC, 0xFE, 0x9B, 0x00, 0x80, 0x04, 0xC0, 0x04, 0x80, 0x01, 0x01, 0x84, 0x53, 0xC4, 0xF5, 0xFE, 0xFE, 0x54, 0x80, 0xFB, 0x40, 0x82,
+  0xAF, 0x01, 0x05, 0xC0, 0x03, 0x83, 0x01, 0x01, 0x0B, 0xA2, 0x59, 0x80, 0xFB, 0x40, 0x80, 0xA6, 0x00, 0x80, 0x06, 0xC0, 0x03, 0x82, 0x02, 0x03,
+  0xA5, 0x40, 0x81, 0xFB, 0xFC, 0x57, 0x80, 0xFC, 0x40, 0x80, 0xB2, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x80, 0x5C, 0x40, 0x80,
+  0xFB, 0x5A, 0x80, 0xFE, 0x40, 0x81, 0xA8, 0x0F, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x83, 0x05, 0xC5, 0xFE, 0xFC, 0x5B, 0x80, 0xFD,
+  0x40, 0x83, 0xBB, 0x08, 0x01, 0x01, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x81, 0x20, 0xFB, 0x5E, 0x80, 0xFA, 0x40, 0x80, 0x90, 0x00, 0x80, 0x02, 0xC0,
+  0x01, 0x80, 0x02, 0x00, 0x80, 0x43, 0x40, 0x80, 0xFE, 0x5D, 0x83, 0xFE, 0xFC, 0xFA, 0x34, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x80,
+  0x3A, 0x40, 0x80, 0xFE, 0x5E, 0x80, 0xFC, 0x40, 0x80, 0x9B, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x81, 0x17, 0xF5, 0x40, 0x80, 0xFE,
+  0x5D, 0x83, 0xFE, 0xFE, 0xE4, 0x05, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0x9E, 0x40, 0x80, 0xFC, 0x5D, 0x80, 0xFE, 0x40, 0x81, 0xFC, 0x3B, 0x00,
+  0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x83, 0x1F, 0xA6, 0xFE, 0xFD, 0x5D, 0x80, 0xFE, 0x41, 0x80, 0x4B, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80,
+  0x03, 0x00, 0x81, 0x52, 0xE6, 0x40, 0x80, 0xFE, 0x5E, 0x80, 0xFE, 0x41, 0x80, 0x4B, 0x00, 0x80, 0x03, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x5B, 0xFB,
+  0x40, 0x80, 0xFC, 0x5F, 0x80, 0xFE, 0x40, 0x83, 0xFD, 0x3F, 0x02, 0x03, 0xC0, 0x00, 0x81, 0x3C, 0xFB, 0x40, 0x80, 0xFC, 0x60, 0x83, 0xFE, 0xFE,
+  0xFD, 0x5D, 0x00, 0x80, 0x03, 0xC0, 0x81, 0x0B, 0xCE, 0x40, 0x80, 0xFC, 0x62, 0x83, 0xFE, 0xFE, 0xF2, 0x3C, 0xC0, 0x80, 0x5B, 0x40, 0x80, 0xFC,
+  0x64, 0x80, 0xFD, 0x40, 0x81, 0xD1, 0x0F, 0xC0, 0x82, 0xB2, 0xFE, 0xFC, 0x65, 0x80, 0xFB, 0x40, 0x80, 0x65, 0xC0, 0x80, 0xF4, 0x67, 0x80, 0xFC,
+  0x40, 0x80, 0xBC, 0xC0, 0x68, 0x80, 0xFE, 0x40, 0x80, 0xF3, 0xC0, 0x80, 0xFE, 0x6A, 0xC0, 0x6B, 0xC0, 0x82, 0xD4, 0xFE, 0xFE, 0x67, 0x80, 0xF9,
+  0xC0, 0x80, 0x8A, 0x40, 0x80, 0xFD, 0x65, 0x82, 0xFD, 0xFE, 0xC0, 0xC0, 0x83, 0x29, 0xF1, 0xFD, 0xFD, 0x64, 0x80, 0xFC, 0x40, 0x80, 0x6D, 0xC0,
+  0x00, 0x80, 0x82, 0x40, 0x80, 0xFB, 0x63, 0x80, 0xFC, 0x40, 0x81, 0xDA, 0x15, 0xC0, 0x82, 0x02, 0x07, 0xB4, 0x40, 0x81, 0xFB, 0xFD, 0x4A, 0x87,
+  0xFE, 0xFD, 0xFC, 0xFD, 0xFD, 0xFD, 0xFC, 0xFD, 0x4D, 0x81, 0xFC, 0xFD, 0x40, 0x80, 0x4A, 0xC0, 0x80, 0x01, 0x00, 0x81, 0x0B, 0xB2, 0x41, 0x81,
+  0xFC, 0xFD, 0x44, 0x83, 0xFE, 0xFD, 0xFC, 0xFB, 0x47, 0x84, 0xFE, 0xFB, 0xFC, 0xFD, 0xFE, 0x46, 0x81, 0xFD, 0xFB, 0x41, 0x80, 0x67, 0x00, 0x80,
+  0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x82, 0x05, 0x7C, 0xE8, 0x4A, 0x87, 0xFC, 0xDA, 0xB7, 0x6E, 0x30, 0x61, 0xBA, 0xE2, 0x4D, 0x81, 0xD9, 0x4D,
+  0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x01, 0x01, 0x83, 0x28, 0x80, 0xC7, 0xF5, 0x40, 0x80, 0xFE, 0x40, 0x86, 0xFD, 0xE1, 0xC2, 0x9C, 0x73, 0x47,
+  0x13, 0x04, 0x86, 0x1F, 0x52, 0x74, 0x9F, 0xC1, 0xD9, 0xEE, 0x40, 0x80, 0xFE, 0x40, 0x80, 0xFE, 0x40, 0x83, 0xF9, 0xBF, 0x6E, 0x13, 0x00, 0x80,
+  0x02, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_POOP_EMOJI_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x5164, 0xAAE8, 0x2081, 0x0000, 0x0000, 0x0000, 0x4944, 0xBB49, 0xC36A, 0xAAC8, 0x30E2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x20A1, 0xBB29, 0xC34A, 0xBB4A, 0xC36A, 0xBB4A, 0x69E5, 0x2081, 0x0000, 0x0000, 0x69E5, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A,
+  0xCB6A, 0xBB29, 0x92A8, 0x61A5, 0x3903, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0xA2C8, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xC34A, 0xC36A, 0xCB8A, 0xCB6A, 0xA2C8, 0x3903, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xAB09, 0xC34A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xB329, 0xC36A, 0xBB29, 0x28A2, 0x0000, 0x0000, 0x0000, 0x2081, 0x4123, 0xAB09,
+  0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xB329, 0xCB8B, 0x61A5, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x30E2, 0x69E5, 0x9287, 0xB329, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xB329, 0xCB8B, 0x61C5, 0x0000, 0x0000, 0x0000, 0x1040, 0x8247, 0xC36A, 0xCB6A, 0xCB6A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB6A, 0x7A26, 0x1061, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x8227, 0xCB8B, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xAAE9, 0x7A06, 0x1061, 0x0000, 0x0000, 0x30E2, 0xCB6A, 0xB329, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xC34A, 0xCB6A, 0xAB09, 0x30E2, 0x0000, 0x0000, 0x59A5, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xC36A, 0xC36A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xBB4A, 0xBB4A, 0xB329, 0xC36A,
+  0xBB29, 0x30C2, 0x0000, 0x0000, 0x61A5, 0xCB6A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB29, 0xBAE8, 0xBAE8, 0xBAE8, 0xBB29, 0xC34A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBAE8, 0xBAE8, 0xBAE8, 0xBB29, 0xBB4A, 0xBB4A, 0xB329, 0xC36A, 0x92A8, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x3903, 0xC36A, 0xBB4A, 0xBB4A, 0xBB09, 0xC3CC, 0xDD94, 0xDDD6, 0xDD94, 0xC3CC, 0xBB09, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xC36B, 0xD553, 0xDDD6, 0xDDB5, 0xCC4E, 0xBB09, 0xC34A, 0xBB4A, 0xBB4A, 0xC36A, 0x3903,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x9AA8, 0xC36A, 0xBB09, 0xCC4F, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xCC4F, 0xBB09, 0xC34A,
+  0xBB4A, 0xBB4A, 0xBB29, 0xC3AC, 0xEEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xD512, 0xBB09, 0xBB4A, 0xBB4A, 0xCB6A, 0x69E5, 0x0000,
+  0x0000, 0x3903, 0x8A87, 0xBB29, 0xBB29, 0xC38B, 0xEF3C, 0xFFFF, 0xFFDF, 0xE71C, 0xDEFB, 0xFFFF, 0xF75C, 0xC38B, 0xBB29, 0xBB4A,
+  0xBB4A, 0xBB29, 0xE679, 0xFFFF, 0xE71C, 0xDEFB, 0xF7BF, 0xFFFF, 0xF7DF, 0xCC4E, 0xBB09, 0xBB29, 0xCB8B, 0x7A26, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x7A06, 0xCB6A, 0xC36A, 0xC36A, 0xBB09, 0xDD53, 0xF7FF, 0xFFFF, 0x9CF4, 0x2986, 0x2145, 0x73CF, 0xF7FF,
+  0xD553, 0xBB09, 0xC34A, 0xBB09, 0xCC6F, 0xFFFF, 0x9CF4, 0x2986, 0x2145, 0x7BF0, 0xF79E, 0xFFFF, 0xE637, 0xBB29, 0xB329, 0xCB8B,
+  0x7A26, 0x0000, 0x0000, 0x0000, 0x7A06, 0xCB8B, 0xBB29, 0xBB4A, 0xC34A, 0xBB09, 0xE679, 0xFFFF, 0xCE9A, 0x2986, 0x2145, 0x2986,
+  0x1904, 0xADB7, 0xF6FB, 0xBAE8, 0xC36A, 0xBAE8, 0xE5D5, 0xD6FB, 0x2966, 0x2145, 0x2986, 0x1904, 0xAD75, 0xFFFF, 0xEF3C, 0xC36B,
+  0xBB29, 0xCB6A, 0x7A26, 0x0000, 0x0000, 0x0000, 0x4123, 0xCB6A, 0xBB29, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xE6BA, 0xFFFF, 0xB5B6,
+  0x1904, 0x29A7, 0x2986, 0x18E4, 0x8472, 0xFF5C, 0xBAE8, 0xC36A, 0xB2C8, 0xEE57, 0xB618, 0x18E4, 0x29A7, 0x2986, 0x1904, 0x8431,
+  0xFFFF, 0xEF7D, 0xC38B, 0xBB2A, 0xBB4A, 0xC34A, 0x7A26, 0x0820, 0x0000, 0x0000, 0x0000, 0x8A87, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xC34A, 0xBB09, 0xE6BA, 0xFFFF, 0xB5B6, 0x1904, 0x29A7, 0x2986, 0x18E4, 0x8472, 0xFF5C, 0xBAE8, 0xC36A, 0xB2C8, 0xEE57, 0xB618,
+  0x18E4, 0x29A7, 0x2986, 0x1904, 0x8431, 0xFFFF, 0xEF7D, 0xC38B, 0xBB2A, 0xBB4A, 0xBB4A, 0xCB8B, 0x8247, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1061, 0xBB29, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xE678, 0xFFFF, 0xD6DB, 0x31A7, 0x2125, 0x2166, 0x1904,
+  0xB5F8, 0xF6DA, 0xBAE8, 0xC36A, 0xBAE8, 0xE5B5, 0xDF1C, 0x29A6, 0x2125, 0x2166, 0x1925, 0xB5B7, 0xFFFF, 0xEF3C, 0xC36A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xB329, 0xCB8B, 0x61C5, 0x0000, 0x0000, 0x28C2, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB09, 0xD512,
+  0xF7FF, 0xFFFF, 0xAD76, 0x3A08, 0x31A7, 0x8C71, 0xFFFF, 0xD512, 0xBB09, 0xC34A, 0xBB29, 0xCC2E, 0xFFFF, 0xAD76, 0x39E8, 0x31A7,
+  0x8C72, 0xF7BF, 0xFFFF, 0xE5F7, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB49, 0x28A2, 0x0000, 0x0000, 0x28A2, 0xC36A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xC36B, 0xEF1B, 0xFFFF, 0xFFDF, 0xEF7E, 0xEF7D, 0xFFFF, 0xEF1B, 0xC36B, 0xBB2A,
+  0xBB4A, 0xBB4A, 0xBB29, 0xE637, 0xFFFF, 0xEF9E, 0xEF7D, 0xFFDF, 0xFFFF, 0xF79E, 0xCC0D, 0xBB29, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xCB6A, 0x71E5, 0x0000, 0x0000, 0x1040, 0xB329, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xCC0D, 0xEF1B,
+  0xF7FF, 0xFFFF, 0xFFFF, 0xEF1B, 0xC3ED, 0xBB29, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xC38B, 0xE679, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
+  0xD4B0, 0xBB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xA2E9, 0x0000, 0x0000, 0x71E6, 0xCB8A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB09, 0xC38B, 0xD512, 0xD553, 0xD512, 0xC38B, 0xBB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB29, 0xBB4A, 0xD4D1, 0xD553, 0xD533, 0xC3ED, 0xBB09, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A,
+  0x28A2, 0x0000, 0x0000, 0x1061, 0x7A26, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB2A, 0xBAE8, 0xBAE8,
+  0xBAE8, 0xBB2A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB08, 0xBAE8, 0xBAE8, 0xBB29, 0xC34A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0x30E2, 0x0000, 0x0000, 0x38E3, 0xA2E9, 0xCB6A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0x30E2, 0x0000, 0x0000, 0x3903, 0xBB29, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0x28C2, 0x0000, 0x0000, 0x30C2, 0xBB29,
+  0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A,
+  0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A, 0xCB6A,
+  0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0x4123, 0x0000, 0x0000, 0x9288, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xC34A, 0x8288, 0x5207, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07,
+  0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x5A07, 0x6227, 0xB329, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xC34A, 0xB329, 0x28C2, 0x3903, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0x7248, 0x1125,
+  0x2166, 0x1946, 0x1946, 0x1946, 0x1966, 0x2166, 0x1946, 0x1925, 0x1125, 0x1125, 0x1125, 0x1125, 0x1125, 0x1945, 0x2166, 0x2166,
+  0x1946, 0x1946, 0x1946, 0x2166, 0x1946, 0x3186, 0xB32A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB2A, 0xCB6A, 0x92A8, 0x0820, 0x7A26,
+  0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB2A, 0x41C7, 0x2166, 0x2986, 0x2986, 0x2986,
+  0x2166, 0x1925, 0x2986, 0x4A08, 0x5249, 0x5A4A, 0x524A, 0x524A, 0x4A29, 0x39C7, 0x2145, 0x2145, 0x2986, 0x2986, 0x2986, 0x2986,
+  0x2166, 0x8AA8, 0xC36A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xC36A, 0x4944, 0xB329, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xAB09, 0x3186, 0x2166, 0x2966, 0x1945, 0x41E8, 0x938F, 0xC493, 0xE536,
+  0xFD97, 0xFD98, 0xFD98, 0xFD98, 0xF557, 0xD4D4, 0xAC11, 0x628B, 0x2166, 0x2145, 0x2986, 0x1946, 0x7248, 0xCB6A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0x8A67, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0xA2E9, 0x39A6, 0x2166, 0x8B4E, 0xE516, 0xFD98, 0xFD98, 0xF577, 0xF557, 0xED57, 0xF557, 0xF557,
+  0xF557, 0xFD77, 0xFD98, 0xF577, 0xBC52, 0x4208, 0x2166, 0x7268, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xC34A, 0xAB09, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xC36A, 0xAB09, 0xA36D, 0xFD98, 0xFD98, 0xF557, 0xED57, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xF557, 0xED57, 0xF577,
+  0xFDB9, 0xCC72, 0x92C9, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xCBCD,
+  0xE4B2, 0xF556, 0xF577, 0xF577, 0xF598, 0xF598, 0xF598, 0xF598, 0xF578, 0xF577, 0xF557, 0xECF4, 0xD42F, 0xC36B, 0xC34A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0x9AA8, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB29, 0xBB49, 0xC36B, 0xD3EE, 0xDC71,
+  0xE4B3, 0xE4B3, 0xE4B3, 0xE4B3, 0xDC92, 0xD42F, 0xC3AC, 0xC34A, 0xBB29, 0xBB2A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xB329, 0x61A5, 0xCB6A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29, 0xBB29,
+  0xBB29, 0xBB29, 0xBB29, 0xBB4A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xC36A, 0x8A67, 0x1881, 0xAB09, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xCB6A, 0x5164, 0x61A5,
+  0xCB8B, 0xB329, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC36A, 0x9AA8, 0x1040, 0x0000, 0x0000, 0x8247, 0xCB8B, 0xB329, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0x30E2, 0x0000, 0x0000, 0x7A26, 0xCB8B, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xB329, 0xBB4A, 0xC36A, 0xCB6A, 0xCB6A, 0xC36A, 0xCB6A, 0xCB6A, 0xC36A, 0xBB4A, 0xB329, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xB329, 0xC36A, 0xC36A, 0x4943, 0x0000, 0x0000,
+  0x0000, 0x59A5, 0xAAE9, 0xCB6A, 0xC36A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A, 0xC34A, 0xC36A, 0xC36A, 0xCB8B, 0xBB4A, 0xA2A8,
+  0x8247, 0x5164, 0x2081, 0x4123, 0x8247, 0xAAC8, 0xC34A, 0xCB8B, 0xC36A, 0xC36A, 0xC34A, 0xC34A, 0xBB4A, 0xBB4A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xBB4A, 0xC36A, 0xCB6A, 0xA2A8, 0x38E2, 0x0000, 0x0000, 0x1861, 0x59A5, 0x9287, 0xB329, 0xC34A, 0xBB4A, 0xC34A, 0xBB4A,
+  0xA2C8, 0x8A67, 0x7206, 0x5164, 0x30E2, 0x0820, 0x1061, 0x3903, 0x5984, 0x7206, 0x8A67, 0x9AA8, 0xAB09, 0xC34A, 0xBB4A, 0xBB4A,
+  0xBB4A, 0xC34A, 0xB329, 0x9267, 0x5164, 0x0820, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_POOP_EMOJI_44_SPANS = {
+  SPRITE_POOP_EMOJI_44_SPAN_ROWS, SPRITE_POOP_EMOJI_44_SPAN_OPS, SPRITE_POOP_EMOJI_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_POOP_EMOJI_44_ASSET = {
   SPRITE_POOP_EMOJI_44_WIDTH, SPRITE_POOP_EMOJI_44_HEIGHT,
-  SPRITE_POOP_EMOJI_44_ALPHA, SPRITE_POOP_EMOJI_44_RGB565
+  nullptr, nullptr, &SPRITE_POOP_EMOJI_44_SPANS
 };
 
 #endif // SPRITE_POOP_EMOJI_44_INCLUDED
@@ -5,70 +5,66 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from question_24.png (24x24)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from question_24.png (24x24) — RGBA multi-couleur, encodé en spans
+// 246/576 pixels visibles, 1000 bytes flash (flat : 1728). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_QUESTION_24_WIDTH = 24;
 constexpr uint16_t SPRITE_QUESTION_24_HEIGHT = 24;
 
-const uint16_t SPRITE_QUESTION_24_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA800, 0x0000, 0x0000, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB0C6, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB8A5, 0xC0C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0xF80F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C6, 0x0000, 0xF80F, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xB8A5, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC8C6, 0xC0C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xC0C6, 0xB8C6, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB124, 0x0000, 0x0000, 0x0000, 0xB8C5, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0x0000, 0x7800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xC8C6, 0xB8A6, 0x0000, 0xB807, 0xB807, 0xA800, 0x0000, 0xB8C6, 0xC0C6, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C6, 0xB8C5, 0x7800, 0x7800, 0xF800, 0x9806, 0x0000, 0xB8A6, 0xC0C6, 0xB8C6, 0xC8C6, 0xB8A5, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB8C6, 0xC8E6, 0xB8A5, 0x0000, 0x9806, 0x7800, 0x0000, 0x0000, 0xB8A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xB8A6, 0x0000, 0xF800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x9806, 0xF800, 0xA8E7, 0xB8C6, 0xC0C6, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xC8C6, 0xB8C6, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xD0E6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8A6, 0x0000, 0xA800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8E5, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xC8C6, 0xB8A6, 0xA80A, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xD0E6, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xD809, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xF800, 0xB8C6, 0xC0C6, 0xC0C6, 0xB8A6, 0xC0E7, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xC0E7, 0xB8C6, 0xC8C6, 0xB8C6, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xD0E6, 0xC8C6, 0xC0C6, 0xB8C6, 0x0000, 0xA80A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xC8C6, 0xB8C5, 0x0000, 0xB807, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8C6, 0xC0C6, 0xC8C6, 0xB8C6, 0xB8E5, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB8A5, 0xC8C6, 0xB0A6, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_QUESTION_24_SPAN_ROWS[] PROGMEM = {
+  0, 0, 7, 2, 23, 11, 39, 24, 61, 38, 83, 55, 107, 72, 130, 86,
+  160, 101, 187, 117, 212, 130, 230, 140, 248, 155, 267, 167, 284, 178, 302, 188,
+  317, 196, 334, 204, 345, 212, 346, 212, 358, 219, 371, 226, 386, 233, 400, 241
 };
 
-const uint8_t SPRITE_QUESTION_24_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x43, 0x8B, 0xA7, 0xA7, 0x96, 0x5D, 0x15, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x6A, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0xEF, 0xFF, 0xFC, 0xF9, 0xF8, 0xF8, 0xF8, 0xFB, 0xFF, 0xFF, 0x83, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x0C, 0xDB, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0x45, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x63, 0xFF, 0xFB, 0xFE, 0xFF, 0xCD, 0x73, 0x6B, 0xAD, 0xFF, 0xFF, 0xFB, 0xFE, 0xC2, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0xA5, 0xFD, 0xF9, 0xFD, 0xBD, 0x07, 0x00, 0x00, 0x00, 0x65, 0xFD, 0xFD, 0xFE, 0xFA, 0x25, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0xAF, 0xFF, 0xF4, 0xFF, 0x58, 0x00, 0x08, 0x04, 0x03, 0x00, 0xC9, 0xFF, 0xFA, 0xFF, 0x4F, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0xFD, 0xFF, 0xDD, 0x1C, 0x02, 0x02, 0x01, 0x05, 0x00, 0xC0, 0xFF, 0xF8, 0xFE, 0x56, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35, 0x5A, 0x17, 0x00, 0x05, 0x02, 0x00, 0x00, 0x43, 0xF9, 0xFD, 0xFB, 0xFF, 0x54, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x6E, 0xF0, 0xFF, 0xFD, 0xFE, 0xFD, 0x2C, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x09, 0x81, 0xB8, 0xE8, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xBD, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFB, 0xFC, 0xFA, 0xFF, 0xF4, 0x2C, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xAF, 0xFC, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xDE, 0x3F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xA8, 0xFF, 0xFB, 0xFE, 0xF8, 0xD3, 0x7D, 0x12, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xAC, 0xFD, 0xF7, 0xFC, 0x6D, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xA1, 0xFF, 0xFD, 0xFF, 0x45, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x29, 0xCE, 0xF3, 0xA0, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x7F, 0xA6, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xB4, 0xFE, 0xF1, 0xFF, 0x5B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x52, 0xF8, 0xFF, 0xD9, 0x1B, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x5B, 0x19, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_QUESTION_24_SPAN_OPS[] PROGMEM = {
+  0x06, 0x80, 0x02, 0x07, 0x80, 0x03, 0xC0, 0x05, 0x80, 0x03, 0x01, 0x86, 0x43, 0x8B, 0xA7, 0xA7, 0x96, 0x5D, 0x15, 0x00, 0x80, 0x02, 0xC0, 0x04,
+  0x80, 0x02, 0x00, 0x81, 0x30, 0xC4, 0x45, 0x81, 0xE7, 0x6A, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x03, 0x80, 0x02, 0x00, 0x81, 0x35, 0xEF, 0x40, 0x85,
+  0xFC, 0xF9, 0xF8, 0xF8, 0xF8, 0xFB, 0x41, 0x80, 0x83, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x83, 0x01, 0x01, 0x0C, 0xDB, 0x40, 0x81, 0xFA, 0xFD, 0x43,
+  0x82, 0xFE, 0xFD, 0xFB, 0x40, 0x80, 0x45, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0x63, 0x40, 0x81, 0xFB, 0xFE, 0x40, 0x83, 0xCD,
+  0x73, 0x6B, 0xAD, 0x41, 0x84, 0xFB, 0xFE, 0xC2, 0x01, 0x02, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x85, 0xA5, 0xFD, 0xF9, 0xFD, 0xBD, 0x07, 0x02, 0x85,
+  0x65, 0xFD, 0xFD, 0xFE, 0xFA, 0x25, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80, 0xAF, 0x40, 0x80, 0xF4, 0x40, 0x80, 0x58, 0x00, 0x82,
+  0x08, 0x04, 0x03, 0x00, 0x80, 0xC9, 0x40, 0x80, 0xFA, 0x40, 0x80, 0x4F, 0x00, 0x80, 0x04, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x81, 0x55, 0xFD, 0x40,
+  0x85, 0xDD, 0x1C, 0x02, 0x02, 0x01, 0x05, 0x00, 0x80, 0xC0, 0x40, 0x82, 0xF8, 0xFE, 0x56, 0x00, 0x80, 0x04, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x82,
+  0x35, 0x5A, 0x17, 0x00, 0x81, 0x05, 0x02, 0x01, 0x83, 0x43, 0xF9, 0xFD, 0xFB, 0x40, 0x80, 0x54, 0x00, 0x80, 0x04, 0xC0, 0x04, 0x80, 0x01, 0x05,
+  0x82, 0x14, 0x6E, 0xF0, 0x40, 0x83, 0xFD, 0xFE, 0xFD, 0x2C, 0x00, 0x80, 0x02, 0xC0, 0x05, 0x86, 0x02, 0x05, 0x02, 0x09, 0x81, 0xB8, 0xE8, 0x42,
+  0x80, 0xFA, 0x40, 0x82, 0xBD, 0x01, 0x02, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x80, 0x81, 0x42, 0x82, 0xFB, 0xFC, 0xFA, 0x40, 0x81, 0xF4, 0x2C, 0x00,
+  0x80, 0x03, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x83, 0xAF, 0xFC, 0xF8, 0xFE, 0x42, 0x81, 0xDE, 0x3F, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x80, 0x04, 0x00,
+  0x80, 0xA8, 0x40, 0x85, 0xFB, 0xFE, 0xF8, 0xD3, 0x7D, 0x12, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x85, 0xAC, 0xFD, 0xF7, 0xFC, 0x6D,
+  0x03, 0x01, 0x80, 0x02, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x80, 0xA1, 0x40, 0x80, 0xFD, 0x40, 0x80, 0x45, 0x00, 0x81, 0x07, 0x01, 0xC0, 0x06, 0x87,
+  0x02, 0x01, 0x29, 0xCE, 0xF3, 0xA0, 0x09, 0x02, 0xC0, 0xC0, 0x06, 0x85, 0x01, 0x01, 0x09, 0x7F, 0xA6, 0x55, 0x00, 0x80, 0x01, 0xC0, 0x06, 0x80,
+  0x04, 0x00, 0x80, 0x80, 0x42, 0x80, 0x35, 0x00, 0x80, 0x03, 0xC0, 0x06, 0x80, 0x04, 0x00, 0x82, 0xB4, 0xFE, 0xF1, 0x40, 0x80, 0x5B, 0x00, 0x80,
+  0x04, 0xC0, 0x06, 0x80, 0x03, 0x00, 0x81, 0x52, 0xF8, 0x40, 0x83, 0xD9, 0x1B, 0x01, 0x01, 0xC0, 0x07, 0x80, 0x01, 0x00, 0x82, 0x38, 0x5B, 0x19,
+  0x00, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_QUESTION_24_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x3021, 0x6063, 0x7863, 0x7863, 0x6863, 0x4042, 0x1000, 0x0000, 0x0000, 0x2000, 0x9084, 0xC8C6, 0xC8C6,
+  0xC8C6, 0xC8C6, 0xC8C6, 0xC8C6, 0xA8A5, 0x4842, 0x0000, 0x0000, 0x0000, 0x2821, 0xB0A5, 0xC8C6, 0xB8C6, 0xB0A5, 0xB0A5, 0xB0A5,
+  0xB0A5, 0xB0A5, 0xC0C6, 0xC8C6, 0x5863, 0x0000, 0x0000, 0x0000, 0x0800, 0x98A5, 0xC0C6, 0xB0A5, 0xB8C6, 0xC0C6, 0xC8C6, 0xC8C6,
+  0xC8C6, 0xB8C6, 0xB8C6, 0xB0A5, 0xC8C6, 0x3021, 0x0000, 0x0000, 0x4042, 0xC8C6, 0xB0A5, 0xB8C6, 0xC0C6, 0x9084, 0x5042, 0x4842,
+  0x7884, 0xC0C6, 0xC0C6, 0xB0A5, 0xC0C6, 0x8884, 0x0000, 0x0000, 0x0000, 0x7863, 0xC8C6, 0xB0A5, 0xC0C6, 0x9084, 0x0000, 0x4842,
+  0xC0C6, 0xB8C6, 0xB8C6, 0xB0A5, 0x1800, 0x0000, 0x0000, 0x7884, 0xC8C6, 0xB0A5, 0xC8C6, 0x3822, 0x0000, 0x0000, 0x0000, 0x8884,
+  0xC0C6, 0xB0A5, 0xC8C6, 0x3821, 0x0000, 0x0000, 0x3842, 0xC0C6, 0xC8C6, 0xA0A5, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8864,
+  0xC0C6, 0xB0A5, 0xC8C6, 0x3821, 0x0000, 0x0000, 0x2821, 0x4042, 0x1000, 0x0000, 0x0000, 0x2821, 0xB8A5, 0xB8C6, 0xB0A5, 0xC8C6,
+  0x3842, 0x0000, 0x0000, 0x1000, 0x5042, 0xB0A5, 0xC0C6, 0xB8C6, 0xB8C6, 0xC0C6, 0x2001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x5863, 0x8884, 0xA0A5, 0xC8C6, 0xC0C6, 0xB8C6, 0xB0A5, 0xC8C6, 0x8884, 0x0000, 0x0000, 0x0000, 0x5863, 0xD0E6, 0xC0C6, 0xC0C6,
+  0xB0A5, 0xB8C6, 0xB0A5, 0xC0C6, 0xB8A5, 0x2001, 0x0000, 0x0000, 0x7884, 0xC8C6, 0xB0A5, 0xB8C6, 0xB8C6, 0xC0C6, 0xC8C6, 0xA8A5,
+  0x2821, 0x0000, 0x0000, 0x7863, 0xC8C6, 0xB0A5, 0xB8C6, 0xB0A5, 0x9884, 0x6063, 0x0800, 0x0000, 0x0000, 0x7884, 0xC8C6, 0xB0A5,
+  0xC8C6, 0x5042, 0x0000, 0x0000, 0x0000, 0x7063, 0xD0E6, 0xB8C6, 0xC8C6, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x9884,
+  0xB0A5, 0x7063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5863, 0x8063, 0x3842, 0x0000, 0x0000, 0x5863, 0xD0E6, 0xC8C6, 0xC0C6,
+  0x2821, 0x0000, 0x0000, 0x8084, 0xC8C6, 0xA8A5, 0xC8C6, 0x3841, 0x0000, 0x0000, 0x3821, 0xB8A5, 0xC8C6, 0x98A5, 0x1000, 0x0000,
+  0x0000, 0x0000, 0x2821, 0x4042, 0x1000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_QUESTION_24_SPANS = {
+  SPRITE_QUESTION_24_SPAN_ROWS, SPRITE_QUESTION_24_SPAN_OPS, SPRITE_QUESTION_24_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_QUESTION_24_ASSET = {
   SPRITE_QUESTION_24_WIDTH, SPRITE_QUESTION_24_HEIGHT,
-  SPRITE_QUESTION_24_ALPHA, SPRITE_QUESTION_24_RGB565
+  nullptr, nullptr, &SPRITE_QUESTION_24_SPANS
 };
 
 #endif // SPRITE_QUESTION_24_INCLUDED
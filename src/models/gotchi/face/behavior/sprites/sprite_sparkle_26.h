@@ -5,74 +5,80 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from sparkle_26.png (26x26)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from sparkle_26.png (26x26) — RGBA multi-couleur, encodé en spans
+// 367/676 pixels visibles, 1400 bytes flash (flat : 2028). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_SPARKLE_26_WIDTH = 26;
 constexpr uint16_t SPRITE_SPARKLE_26_HEIGHT = 26;
 
-const uint16_t SPRITE_SPARKLE_26_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFFE0, 0xFBE0, 0xFE89, 0xFE29, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xFD66, 0xFD46, 0xFD4A, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFE0, 0xFE6C, 0x0000, 0xFE69, 0xFECA, 0xFEA9, 0x0000, 0xFFE7, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0xFD66, 0xFE27, 0xFD66, 0x0000, 0xFD40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFE49, 0xFE69, 0xFECA, 0xFE69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xFD86, 0xFD46, 0xFDE6, 0xFD66, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFEAA, 0xFE69, 0xFFE0, 0xFFEF, 0x0000, 0xFD4A, 0x0000, 0xFD46, 0xFD86, 0xFD86, 0xFD46, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFE89, 0xFECA, 0xFE69, 0xFE49, 0xFE89, 0xFF0A, 0xFE69, 0x0000, 0xFFEF, 0x0000, 0xFBE7, 0x0000, 0xFD66, 0xFDA6, 0xFD46, 0xFD66, 0xFD46, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE28, 0xFE89, 0xFE69, 0xFEAA, 0xFE69, 0xFE29, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0xFD4A, 0xFD66, 0xFD86, 0xFD66, 0xFDA6, 0xFD46, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFE0, 0x0000, 0x0000, 0xFE69, 0xFF2A, 0xFE49, 0x0000, 0xFD4A, 0x0000, 0x0000, 0xFD40, 0xFFE0, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDA6, 0xFD46, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFDE7, 0xFFEF, 0xFE69, 0xFE49, 0xFD4A, 0xFD4A, 0xF800, 0xF800, 0xFD4A, 0xFDA9, 0x0000, 0xFD66, 0xFDC6, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD45, 0x0000, 0xFE66, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFD4A, 0x0000, 0x0000, 0x0000, 0xFD66, 0xFD46, 0xFD86, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0xFD66, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFD4A, 0xFFE0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFEF, 0xFDE7, 0xFFE0, 0x0000, 0x0000, 0xFE66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0x0000, 0x0000, 0x0000, 0xFFE0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xFD46, 0xFD66, 0xFD66, 0xFD86, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD05, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFD46, 0xFDA6, 0xFDA6, 0xFD86, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFD86, 0xFDA6, 0xFD66, 0xFD66,
-  0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0xFD46, 0xFD86, 0xFD66, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD46, 0xFD46, 0xFD86, 0xFDA6, 0xFD66, 0xFD66, 0xFD66,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE3, 0xFD66, 0xFD66, 0xFD66, 0xFDA6, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFDA6, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0xFD46, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFBE0, 0x0000, 0x0000, 0xFBE0, 0xFFE0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFE69, 0xFE49, 0xFD4A, 0x0000, 0x0000, 0x0000, 0xFD46, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD66, 0x0000, 0x0000, 0x0000, 0xFBE7, 0xFBE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFE66, 0xFD4A, 0xFE49, 0xFF4B, 0xFE69, 0xFDE7, 0xFDC8, 0xFBE0, 0xFD46, 0xFDA6, 0xFD46, 0xFD66, 0xFD86, 0xFD46, 0xFDA6, 0xFD4A, 0xFBE0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0xFE49, 0xFF2A, 0xFE49, 0x0000, 0xFE66, 0x0000, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0xFD46, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFE29, 0xFE89, 0xFE69, 0xFE8A, 0xFE49, 0xFE49, 0xFDE7, 0xFFE0, 0x0000, 0xFD46, 0xFDA6, 0xFD66, 0xFDA6, 0xFD66, 0x0000, 0xFBE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFBE0, 0x0000, 0xFE6A, 0xFE69, 0xFEEA, 0xFE69, 0xFE49, 0xFE69, 0xFF0A, 0xFE49, 0x0000, 0x0000, 0xFD66, 0xFDA6, 0xFD66, 0xFD66, 0xFD46, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFFE0, 0x0000, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE89, 0xFE69, 0xFFE0, 0x0000, 0xFD66, 0xFD66, 0xFD86, 0xFD66, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE69, 0xFE69, 0xFECA, 0xFE69, 0xFDE7, 0x0000, 0xFBE0, 0x0000, 0xFCE3, 0xFD46, 0xFDE7, 0xFD46, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xFE66, 0x0000, 0xFE49, 0xFF2A, 0xFE49, 0x0000, 0xFEC9, 0x0000, 0xFFEA, 0x0000, 0xFD66, 0xFE27, 0xFD46, 0x0000, 0xFD40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0xFFE0, 0xFE69, 0xFEEA, 0xFE69, 0xFFE0, 0xFFEF, 0x0000, 0xFBEF, 0x0000, 0xFD66, 0xFD46, 0xFD4A, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFE89, 0xFE49, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_SPARKLE_26_SPAN_ROWS[] PROGMEM = {
+  0, 0, 4, 1, 25, 11, 50, 22, 69, 32, 95, 50, 122, 66, 147, 80,
+  173, 94, 201, 113, 224, 126, 246, 144, 264, 164, 284, 186, 306, 208, 318, 226,
+  341, 242, 365, 255, 389, 273, 414, 285, 437, 299, 459, 314, 485, 329, 505, 340,
+  531, 351, 553, 363
 };
 
-const uint8_t SPRITE_SPARKLE_26_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x1D, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32, 0x7D, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x05, 0x00, 0xA7, 0xFF, 0x18, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xA4, 0xFF, 0x35, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x2A, 0xEE, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0A, 0xDC, 0xFB, 0x7F, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xAA, 0xF0, 0xFF, 0xFE, 0xFB, 0xCC, 0x60, 0x01, 0x02, 0x00, 0x03, 0x00, 0x40, 0xFE, 0xFF, 0xCA, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x39, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x98, 0x00, 0x02, 0x00, 0x04, 0x00, 0x89, 0xFF, 0xFD, 0xF9, 0x27, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x71, 0xF8, 0xFB, 0xBA, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xD1, 0xFF, 0xF9, 0xFF, 0x6D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0xC8, 0xFF, 0x30, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x2E, 0xFD, 0xFE, 0xFB, 0xFF, 0xB8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x02, 0x4F, 0x94, 0x03, 0x03, 0x01, 0x01, 0x03, 0x07, 0x00, 0x72, 0xFF, 0xFB, 0xFE, 0xFF, 0xF1, 0x12, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x13, 0xCA, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x00, 0x05, 0x45, 0x9D, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xC8, 0x73, 0x21, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2A, 0x82, 0xD5, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xB1, 0x57, 0x0B, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xF0, 0x36,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x6B, 0xD8, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFE, 0xFF, 0xFF, 0xF5, 0xB9, 0x23,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x4B, 0x9F, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x79, 0x26, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x5E, 0xB7, 0xFB, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xEA, 0x95, 0x3D, 0x02, 0x00, 0x00, 0x02, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x5B, 0x06, 0x00, 0x00, 0x00, 0xB2, 0xFE, 0xFC, 0xFF, 0xFD, 0xFF, 0x4A, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x83, 0xFF, 0x33, 0x04, 0x0B, 0x02, 0x67, 0xFF, 0xFB, 0xFD, 0xFF, 0xE9, 0x0E, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xBF, 0xFC, 0x72, 0x00, 0x05, 0x00, 0x24, 0xF8, 0xFF, 0xFB, 0xFF, 0xAB, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0D, 0x61, 0xF2, 0xFE, 0xD6, 0x41, 0x04, 0x01, 0x00, 0xC9, 0xFF, 0xF9, 0xFF, 0x63, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x23, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x00, 0x82, 0xFF, 0xFD, 0xF7, 0x21, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x12, 0xA0, 0xE8, 0xFF, 0xFE, 0xFC, 0xD4, 0x71, 0x01, 0x00, 0x3B, 0xFD, 0xFF, 0xC4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE7, 0xFE, 0xAF, 0x04, 0x00, 0x02, 0x00, 0x08, 0xDA, 0xFB, 0x7D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0xB2, 0xFF, 0x65, 0x00, 0x07, 0x00, 0x03, 0x00, 0xA2, 0xFF, 0x33, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x74, 0xFF, 0x2A, 0x01, 0x02, 0x00, 0x02, 0x00, 0x30, 0x7D, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_SPARKLE_26_SPAN_OPS[] PROGMEM = {
+  0x04, 0x80, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x02, 0x1D, 0x44, 0x00, 0x80, 0x01, 0x04, 0x80, 0x02, 0x00, 0x82, 0x32, 0x7D, 0x03, 0x00, 0x80, 0x01,
+  0xC0, 0x81, 0x01, 0x05, 0x00, 0x80, 0xA7, 0x40, 0x80, 0x18, 0x00, 0x80, 0x04, 0x03, 0x80, 0x03, 0x00, 0x80, 0xA4, 0x40, 0x80, 0x35, 0x00, 0x80,
+  0x03, 0xC0, 0x01, 0x83, 0x2A, 0xEE, 0xFE, 0x7F, 0x04, 0x80, 0x01, 0x00, 0x83, 0x0A, 0xDC, 0xFB, 0x7F, 0x00, 0x80, 0x04, 0xC0, 0x82, 0x1F, 0xAA,
+  0xF0, 0x40, 0x85, 0xFE, 0xFB, 0xCC, 0x60, 0x01, 0x02, 0x00, 0x80, 0x03, 0x00, 0x81, 0x40, 0xFE, 0x40, 0x83, 0xCA, 0x01, 0x01, 0x01, 0xC0, 0x81,
+  0x39, 0xFA, 0x40, 0x80, 0xFE, 0x42, 0x80, 0x98, 0x00, 0x80, 0x02, 0x00, 0x80, 0x04, 0x00, 0x80, 0x89, 0x40, 0x82, 0xFD, 0xF9, 0x27, 0x00, 0x80,
+  0x02, 0xC0, 0x00, 0x85, 0x12, 0x71, 0xF8, 0xFB, 0xBA, 0x35, 0x00, 0x80, 0x01, 0x02, 0x81, 0x03, 0xD1, 0x40, 0x80, 0xF9, 0x40, 0x80, 0x6D, 0x00,
+  0x80, 0x04, 0xC0, 0x80, 0x01, 0x01, 0x80, 0xC8, 0x40, 0x80, 0x30, 0x00, 0x80, 0x03, 0x01, 0x85, 0x03, 0x01, 0x2E, 0xFD, 0xFE, 0xFB, 0x40, 0x80,
+  0xB8, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x89, 0x04, 0x02, 0x4F, 0x94, 0x03, 0x03, 0x01, 0x01, 0x03, 0x07, 0x00, 0x80, 0x72, 0x40, 0x81, 0xFB, 0xFE,
+  0x40, 0x81, 0xF1, 0x12, 0x00, 0x81, 0x05, 0x02, 0xC0, 0x05, 0x81, 0x02, 0x03, 0x02, 0x81, 0x13, 0xCA, 0x40, 0x80, 0xFC, 0x40, 0x80, 0xFD, 0x40,
+  0x80, 0x70, 0x02, 0x82, 0x02, 0x03, 0x01, 0xC0, 0x02, 0x82, 0x02, 0x04, 0x01, 0x01, 0x83, 0x05, 0x45, 0x9D, 0xE9, 0x44, 0x84, 0xFE, 0xFD, 0xC8,
+  0x73, 0x21, 0x02, 0x80, 0x01, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x82, 0x2A, 0x82, 0xD5, 0x42, 0x80, 0xFE, 0x47, 0x83, 0xF3, 0xB1, 0x57, 0x0B, 0xC0,
+  0x02, 0x80, 0x02, 0x00, 0x80, 0x91, 0x42, 0x82, 0xFC, 0xFB, 0xFE, 0x46, 0x81, 0xFD, 0xFB, 0x42, 0x81, 0xF0, 0x36, 0xC0, 0x02, 0x80, 0x02, 0x00,
+  0x81, 0x6B, 0xD8, 0x42, 0x81, 0xFC, 0xFC, 0x45, 0x82, 0xFE, 0xFB, 0xFE, 0x41, 0x82, 0xF5, 0xB9, 0x23, 0xC0, 0x05, 0x83, 0x08, 0x4B, 0x9F, 0xE8,
+  0x4A, 0x82, 0xCE, 0x79, 0x26, 0xC0, 0x04, 0x80, 0x02, 0x02, 0x84, 0x15, 0x5E, 0xB7, 0xFB, 0xFE, 0x41, 0x85, 0xFE, 0xFE, 0xEA, 0x95, 0x3D, 0x02,
+  0x01, 0x81, 0x02, 0x01, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x82, 0x1A, 0x5B, 0x06, 0x02, 0x82, 0xB2, 0xFE, 0xFC, 0x40, 0x80, 0xFD, 0x40, 0x80, 0x4A,
+  0x02, 0x81, 0x04, 0x02, 0xC0, 0x03, 0x82, 0x05, 0x03, 0x83, 0x40, 0x84, 0x33, 0x04, 0x0B, 0x02, 0x67, 0x40, 0x81, 0xFB, 0xFD, 0x40, 0x84, 0xE9,
+  0x0E, 0x03, 0x04, 0x01, 0xC0, 0x02, 0x80, 0x01, 0x01, 0x82, 0xBF, 0xFC, 0x72, 0x00, 0x80, 0x05, 0x00, 0x81, 0x24, 0xF8, 0x40, 0x80, 0xFB, 0x40,
+  0x80, 0xAB, 0x00, 0x80, 0x03, 0xC0, 0x03, 0x87, 0x0D, 0x61, 0xF2, 0xFE, 0xD6, 0x41, 0x04, 0x01, 0x00, 0x80, 0xC9, 0x40, 0x80, 0xF9, 0x40, 0x80,
+  0x63, 0x00, 0x80, 0x04, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x23, 0xEF, 0x44, 0x80, 0xB8, 0x01, 0x80, 0x82, 0x40, 0x82, 0xFD, 0xF7, 0x21, 0x00,
+  0x80, 0x02, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x82, 0x12, 0xA0, 0xE8, 0x40, 0x84, 0xFE, 0xFC, 0xD4, 0x71, 0x01, 0x00, 0x81, 0x3B, 0xFD, 0x40, 0x80,
+  0xC4, 0x00, 0x80, 0x01, 0xC0, 0x04, 0x84, 0x1E, 0xE7, 0xFE, 0xAF, 0x04, 0x00, 0x80, 0x02, 0x00, 0x83, 0x08, 0xDA, 0xFB, 0x7D, 0x00, 0x80, 0x04,
+  0xC0, 0x02, 0x81, 0x01, 0x05, 0x00, 0x80, 0xB2, 0x40, 0x80, 0x65, 0x00, 0x80, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0xA2, 0x40, 0x80, 0x33, 0x00,
+  0x80, 0x03, 0xC0, 0x03, 0x82, 0x04, 0x01, 0x74, 0x40, 0x82, 0x2A, 0x01, 0x02, 0x00, 0x80, 0x02, 0x00, 0x82, 0x30, 0x7D, 0x03, 0x00, 0x80, 0x01,
+  0xC0, 0x03, 0x80, 0x01, 0x00, 0x82, 0x11, 0x42, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_SPARKLE_26_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x18C1, 0x41A2, 0x0000, 0x0000, 0x2901, 0x7AA3, 0x0000, 0x0000, 0x0000, 0x0020, 0xA425, 0xFECA, 0x1080,
+  0x0020, 0x0000, 0xA383, 0xFE27, 0x3121, 0x0000, 0x20E1, 0xEDE8, 0xFECA, 0x7B24, 0x0000, 0x0020, 0xDC85, 0xF5A5, 0x7AA3, 0x0020,
+  0x18C1, 0xA445, 0xEDE8, 0xFE69, 0xFE69, 0xF628, 0xCD68, 0x5A63, 0x0000, 0x0000, 0x0000, 0x3941, 0xFD86, 0xFD86, 0xC404, 0x0000,
+  0x0000, 0x0000, 0x3161, 0xF648, 0xFECA, 0xFE69, 0xFE49, 0xFE89, 0xFF0A, 0x93C5, 0x0000, 0x0000, 0x82C3, 0xFDA6, 0xFD46, 0xF525,
+  0x20C0, 0x0000, 0x0860, 0x6AC3, 0xF628, 0xF669, 0xB486, 0x3141, 0x0000, 0x0000, 0xCC44, 0xFD86, 0xF525, 0xFDA6, 0x6A42, 0x0020,
+  0x0000, 0xC4E7, 0xFF2A, 0x2921, 0x0000, 0x0000, 0x0000, 0x28E1, 0xFD66, 0xFD66, 0xF525, 0xFDA6, 0xB3C4, 0x0000, 0x0020, 0x0000,
+  0x49E2, 0x93A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x6A42, 0xFDC6, 0xF505, 0xFD46, 0xFD66, 0xED05, 0x0840, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0840, 0xC404, 0xFD86, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0x6A42, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0000, 0x0020, 0x4181, 0x9B43, 0xE4C5, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xC424, 0x6A42, 0x18A0, 0x0000,
+  0x0000, 0x20C0, 0x7AA3, 0xD485, 0xFD86, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFDA6,
+  0xED05, 0xABA4, 0x51C2, 0x0020, 0x0000, 0x8AE3, 0xFDA6, 0xFDA6, 0xFD86, 0xFD66, 0xF505, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xF505, 0xFD66, 0xFD86, 0xFDA6, 0xED05, 0x3121, 0x0000, 0x6222, 0xD4A5, 0xFD66, 0xFDA6, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xF505, 0xFD46, 0xFD86, 0xFDA6, 0xF525, 0xB3C4, 0x18A0,
+  0x0000, 0x4181, 0x9B43, 0xE4C5, 0xFDA6, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFDA6, 0xFD86, 0xCC44,
+  0x7282, 0x20C0, 0x0000, 0x1060, 0x5A02, 0xB3C4, 0xF525, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xE4C5, 0x9323, 0x3941, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1080, 0x5223, 0x0020, 0xAB84, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0x4181, 0x0000, 0x0000, 0x0020,
+  0x0000, 0x7B24, 0xFF4B, 0x2921, 0x0020, 0x0020, 0x0000, 0x6222, 0xFDA6, 0xF505, 0xFD66, 0xFD86, 0xE4C5, 0x0840, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xBCA6, 0xFF2A, 0x6AA3, 0x0020, 0x20C0, 0xF525, 0xFD66, 0xF505, 0xFDA6, 0xA363, 0x0000, 0x0860, 0x5A63, 0xEDE8,
+  0xFE8A, 0xD547, 0x3982, 0x0020, 0x0000, 0xC404, 0xFDA6, 0xF525, 0xFDA6, 0x5A02, 0x0000, 0x0000, 0x18C1, 0xEDE8, 0xFEEA, 0xFE69,
+  0xFE49, 0xFE69, 0xFF0A, 0xB466, 0x7AA3, 0xFDA6, 0xFD66, 0xF525, 0x18A0, 0x0000, 0x0000, 0x0860, 0x9BE5, 0xE5C8, 0xFE69, 0xFE49,
+  0xFE69, 0xD567, 0x6AC3, 0x0000, 0x3121, 0xFD66, 0xFD86, 0xC424, 0x0000, 0x18C1, 0xE5C8, 0xFECA, 0xAC66, 0x0020, 0x0000, 0x0020,
+  0xD465, 0xF5A6, 0x7AA3, 0x0020, 0x0000, 0x0020, 0xAC46, 0xFF2A, 0x6283, 0x0020, 0x0000, 0x9B43, 0xFE27, 0x28E1, 0x0000, 0x0020,
+  0x0000, 0x72E4, 0xFEEA, 0x20E1, 0x0000, 0x0000, 0x0000, 0x2901, 0x7AA3, 0x0000, 0x0000, 0x0000, 0x0860, 0x3982, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_SPARKLE_26_SPANS = {
+  SPRITE_SPARKLE_26_SPAN_ROWS, SPRITE_SPARKLE_26_SPAN_OPS, SPRITE_SPARKLE_26_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_SPARKLE_26_ASSET = {
   SPRITE_SPARKLE_26_WIDTH, SPRITE_SPARKLE_26_HEIGHT,
-  SPRITE_SPARKLE_26_ALPHA, SPRITE_SPARKLE_26_RGB565
+  nullptr, nullptr, &SPRITE_SPARKLE_26_SPANS
 };
 
 #endif // SPRITE_SPARKLE_26_INCLUDED
@@ -5,118 +5,165 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from sponge_emoji_48.png (48x48)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from sponge_emoji_48.png (48x48) — RGBA multi-couleur, encodé en spans
+// 1520/2304 pixels visibles, 4050 bytes flash (flat : 6912). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_SPONGE_EMOJI_48_WIDTH = 48;
 constexpr uint16_t SPRITE_SPONGE_EMOJI_48_HEIGHT = 48;
 
-const uint16_t SPRITE_SPONGE_EMOJI_48_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFDE7, 0xFD4A, 0xFFE0, 0x0000, 0xFFE0, 0xFFEF, 0xFDE7, 0xFD4A, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xF800, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0xF800, 0xFE69, 0xFE69, 0xFE69, 0xFEAA, 0xFECA, 0xFEAA, 0xFE69, 0xFE69, 0xFECA, 0xFEEA, 0xFE69, 0xFE69, 0xFE69, 0xFD89, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0xFFE0, 0x0000, 0xFE29, 0xFE69, 0xFEAA, 0xFECA, 0xFE89, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFDA7, 0xFE49, 0xFE69, 0xFEAA, 0xFEAA, 0xFE69, 0xFE49, 0x0000, 0xFD40, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xF800, 0x0000, 0xFE69, 0xFE89, 0xFEAA, 0xFE08, 0xFE28, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE89, 0xFE89, 0xFE49, 0x0000, 0xFDE7, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFE0, 0xFFEA, 0xFD4A, 0xFE49, 0xFEAA, 0xFE69, 0xFE08, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE89, 0xFE49, 0x0000, 0xFD4A, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFBEF, 0x0000, 0xFE49, 0xFEAA, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFE08, 0xFE69, 0xFE69, 0xFDC7, 0xFD66, 0xFDE8, 0xFE69, 0xFE69, 0xFE8A, 0xFE69, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE49, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD45, 0xFD87, 0xFE69, 0xFE49, 0xFE69, 0xFECA, 0xFE49, 0xFE2A, 0x0000, 0xFFEF, 0xFD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFEAA, 0xFE49, 0xFEAA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFDC7, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFECA, 0xFE49, 0xFE49, 0x0000, 0x0000, 0xFD4A, 0xFFEA, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFE89, 0xFE49, 0xFDA7, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD86, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFEAA, 0xFE69, 0xFE69, 0xFE29, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFD4A, 0xFDE7, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFECA, 0xFDC7, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD45, 0xFD25, 0xFDE8, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE08, 0xFDC7, 0xFE89, 0xFE69, 0xFE49, 0xFE49, 0xFE89, 0xFEAA, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD4A, 0xFD4A, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE49, 0xFEAA, 0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFDA7, 0xFE29, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE49, 0xFE49, 0xFD66, 0xFD25, 0xFDA7, 0xFE89, 0xFECA, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFE49, 0xFE69, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE49, 0xFEAA, 0xFE08, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFDE8, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFD87, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFEAA, 0xFECA, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0x0000, 0x0000, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFDC7, 0xFEAA, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE29, 0xFE69, 0xFE69, 0xFE08, 0xFD87, 0xFD87, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE49, 0xFEAA, 0xFECA, 0xFE89, 0xFE69, 0xFE8A, 0xFE29, 0x0000, 0xFBEF, 0xFFE0, 0x0000, 0x0000,
-  0xFD65, 0xFE8A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE29, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFDE8, 0xFDC7, 0xFE49, 0xFE69, 0xFECA, 0xFE69, 0xFE69, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xF4A2, 0xFE28, 0xFE6A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFD87, 0xFE6A, 0xFE08, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE49, 0xFE89, 0xFEAA, 0xFE49, 0xFEAA, 0xFFFF, 0xFFE0,
-  0xF461, 0xFD23, 0xFE49, 0xFE69, 0xFDC7, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFE08, 0xFE69, 0xFE28, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFECA, 0xFE69, 0x0000, 0xFFEF,
-  0xF481, 0xFC81, 0xF4E3, 0xFDA6, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFE08, 0xFE69, 0xFDE8, 0xFD87, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFECA, 0xFE49, 0x0000,
-  0xF461, 0xFCA1, 0xF461, 0xF481, 0xF4C3, 0xFD45, 0xFE08, 0xFE8A, 0xFE69, 0xFE49, 0xFE69, 0xFDA7, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFD87, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE28, 0xFE89, 0xFE69, 0xFE69,
-  0xF461, 0xFCA1, 0xF481, 0xF481, 0xF461, 0xF481, 0xF503, 0xFDA6, 0xFE28, 0xFE6A, 0xFE8A, 0xFDE8, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD87, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD46, 0xFDA7, 0xFECA, 0xFE49,
-  0xF461, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4A2, 0xFD24, 0xFDE7, 0xFE69, 0xFE29, 0xFE29, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD45, 0xFDA7, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD87, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD45, 0xFD87, 0xFEAA, 0xFE49,
-  0xF461, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF4E3, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDA7, 0xFD25, 0xFD46, 0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFE08, 0xFEAA, 0xFE49,
-  0xF481, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF503, 0xFE28, 0xFE29, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFD66, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xFE49,
-  0xF4A1, 0xF461, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFD45, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD86, 0xFD46, 0xFDC7, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE29, 0xFE08, 0xFE49, 0xFE69, 0xFE49, 0xFEAA, 0xFDC7,
-  0x0000, 0xF461, 0xFCA1, 0xFCA1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFD46, 0xFD87, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD87, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD86, 0xFE29, 0xFE69, 0xFE8A, 0xFD65,
-  0xFBE0, 0x0000, 0xF461, 0xF481, 0xFCC1, 0xFC81, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD45, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDC7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFDC7, 0xFE8A, 0xFE48, 0xF4E3,
-  0x0000, 0xFBE0, 0x0000, 0xE421, 0xF481, 0xF461, 0xFC81, 0xFCC1, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDE7, 0xFD46, 0xFD46, 0xFD46, 0xFDE8, 0xFE8A, 0xFDE7, 0xF440,
-  0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xFC42, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xFC81, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4E3, 0xFE49, 0xFE69, 0xFE49, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD87, 0xFDC7, 0xFE49, 0xFE69, 0xFD23, 0xF440,
-  0x0000, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0xF461, 0xF481, 0xF461, 0xFCA1, 0xFCA1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xFD03, 0xFE69, 0xFDE8, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE6A, 0xFDC7, 0xFCA1, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAA0, 0xFBE0, 0x0000, 0x0000, 0xFC80, 0xF481, 0xF481, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xFD24, 0xFDA7, 0xFD46, 0xFD46, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xF4C2, 0xFC81, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0xFBE0, 0x0000, 0x0000, 0xFCC0, 0xF481, 0xF481, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFDE8, 0xFD66, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD24, 0xF461, 0xFCA1, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0xFFE0, 0x0000, 0xF461, 0xF481, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4C2, 0xFDE7, 0xFE6A, 0xFE28, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFDA7, 0xFD25, 0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFD44, 0xF461, 0xF461, 0xFCC1, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFBE0, 0x0000, 0xF481, 0xFC81, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD24, 0xFD46, 0xFD66, 0xFDC7, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE28, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD86, 0xFDE8, 0xFE8A, 0xFE28, 0xFD04, 0xF461, 0xF481, 0xF461, 0xFCA1, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBE0, 0x0000, 0xF461, 0xF481, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFD04, 0xFD45, 0xFE69, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xFE8A, 0xFE49, 0xFD86, 0xF4A2, 0xF461, 0xF481, 0xF481, 0xFC81, 0xF481, 0xFC81,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBE0, 0x0000, 0xF461, 0xFC81, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4A2, 0xFD04, 0xFDA6, 0xFE08, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE29, 0xFDC7, 0xFD44, 0xF4C2, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xF481, 0xBBE0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBBE0, 0x0000, 0xF461, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF481, 0xF481, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4A2, 0xF481, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xEC61, 0xFC81, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461, 0xFD40, 0xF800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCB20, 0x0000, 0xF461, 0xFCA1, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFC81, 0xFCA1, 0xF461, 0x0000, 0xAD40,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xF461, 0xFC81, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCC1, 0xF461, 0x0000, 0xFBE0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE0, 0x0000, 0xF441, 0xF481, 0xFCC1, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xFCA1, 0xF461, 0x0000, 0xFBE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0x0000, 0xE421, 0xF481, 0xF481, 0xFCC1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xFCA1, 0xF481, 0xF461, 0x0000, 0xFBE0, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xFCA1, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xFCC1, 0xF481, 0xF481, 0xEC61, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFBE0, 0x0000, 0x0000, 0xF461, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xFC81, 0xFC81, 0xF481, 0xF461, 0xF481, 0xFC81, 0xF461, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0xFCC0, 0xF461, 0xF461, 0xF461, 0xF461, 0xF481, 0xF461, 0xFBE0, 0x0000, 0x0000, 0xF800, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0xFD40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFD40, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_SPONGE_EMOJI_48_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 16, 9, 24, 12, 43, 24, 62, 41, 88, 62,
+  114, 84, 133, 110, 153, 135, 172, 163, 190, 194, 210, 228, 231, 265, 252, 305,
+  272, 347, 293, 392, 308, 436, 324, 484, 340, 531, 352, 578, 364, 626, 376, 674,
+  387, 722, 398, 770, 410, 818, 423, 866, 438, 913, 455, 960, 474, 1006, 493, 1050,
+  513, 1092, 533, 1133, 552, 1171, 570, 1207, 588, 1242, 606, 1275, 623, 1307, 639, 1337,
+  658, 1367, 678, 1395, 699, 1421, 721, 1445, 747, 1468, 767, 1487, 789, 1503, 808, 1515
 };
 
-const uint8_t SPRITE_SPONGE_EMOJI_48_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x03, 0x01, 0x00, 0x01, 0x02, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x4C, 0x71, 0x91, 0xA7, 0x9E, 0x81, 0x60, 0x37, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x52, 0xAF, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xC1, 0x70, 0x0A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x01, 0x00, 0x37, 0xBC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFF, 0xFF, 0xFF, 0xD3, 0x47, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x75, 0xF4, 0xFF, 0xFE, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFD, 0xFF, 0xFB, 0x6D, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x03, 0x03, 0x92, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x72, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x8B, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0x88, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x54, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0x97, 0x09, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0C, 0xCA, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC1, 0x2F, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4C, 0xFE, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xF6, 0x90, 0x31, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF2, 0xAE, 0x71, 0x26, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xAA, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF9, 0xDA, 0xA1, 0x6D, 0x47, 0x1A, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xB0, 0x61, 0x0E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xE8, 0x7B, 0x1B, 0x00, 0x02, 0x01, 0x00, 0x00,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF, 0xDC, 0x68, 0x00, 0x00, 0x00, 0x00,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0x9D, 0x0C, 0x01, 0x01,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xAA, 0x00, 0x02,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x71, 0x00,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xE3, 0x1E,
-  0xAB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x63,
-  0xA9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0x9A,
-  0x82, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAC,
-  0x5C, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x1D, 0xE0, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x49, 0xF6, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x02, 0x00, 0x48, 0xD4, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x02, 0x00, 0x13, 0x78, 0xDE, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x0B, 0x5A, 0xB5, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x36, 0x7B, 0xDB, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x00, 0x00, 0x07, 0x59, 0xC6, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAB,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x05, 0x68, 0xEE, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAA,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x32, 0xD6, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x7E,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x1A, 0xDC, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x57,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x33, 0xE7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE9, 0x2A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3A, 0xF6, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xBB, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4C, 0xF4, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x58, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4E, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCE, 0x03, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x4C, 0xF4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF9, 0x3F, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4D, 0xF4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0x79, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x37, 0xD2, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0x8C, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x8E, 0xFB, 0xFF, 0xFF, 0xFB, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xF3, 0x6B, 0x00, 0x02, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x35, 0xA9, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xB1, 0x2B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x31, 0x73, 0xBA, 0xEF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xCF, 0x8A, 0x3B, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x0A, 0x28, 0x48, 0x5D, 0x59, 0x3D, 0x1D, 0x04, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_SPONGE_EMOJI_48_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0x08, 0x83, 0x02, 0x04, 0x03, 0x01, 0x00, 0x84, 0x01, 0x02, 0x04, 0x03, 0x01, 0xC0, 0x06, 0x81, 0x02, 0x03, 0x09, 0x80, 0x03, 0xC0,
+  0x04, 0x80, 0x03, 0x02, 0x89, 0x24, 0x4C, 0x71, 0x91, 0xA7, 0x9E, 0x81, 0x60, 0x37, 0x01, 0x01, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x83,
+  0x01, 0x52, 0xAF, 0xE5, 0x46, 0x83, 0xF7, 0xC1, 0x70, 0x0A, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x81, 0x01, 0x01, 0x00, 0x81, 0x37, 0xBC, 0x42, 0x86,
+  0xFC, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0x42, 0x81, 0xD3, 0x47, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x01, 0x80, 0x01, 0x00, 0x81, 0x75, 0xF4, 0x40,
+  0x82, 0xFE, 0xFC, 0xFD, 0x46, 0x82, 0xFE, 0xFC, 0xFD, 0x40, 0x81, 0xFB, 0x6D, 0x00, 0x81, 0x04, 0x01, 0xC0, 0x83, 0x01, 0x03, 0x03, 0x92, 0x41,
+  0x80, 0xFD, 0x4C, 0x80, 0xFD, 0x41, 0x80, 0x72, 0x00, 0x81, 0x03, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x80, 0x8B, 0x40, 0x81, 0xFC, 0xFD, 0x4E, 0x81,
+  0xFE, 0xFC, 0x40, 0x80, 0x88, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x54, 0x40, 0x80, 0xFD, 0x51, 0x81, 0xFE, 0xFD, 0x40, 0x81, 0x97, 0x09, 0x00,
+  0x81, 0x02, 0x03, 0xC0, 0x83, 0x0C, 0xCA, 0xFE, 0xFB, 0x53, 0x80, 0xFD, 0x40, 0x81, 0xC1, 0x2F, 0x01, 0x82, 0x03, 0x03, 0x01, 0xC0, 0x83, 0x4C,
+  0xFE, 0xFD, 0xFE, 0x54, 0x80, 0xFB, 0x40, 0x82, 0xF6, 0x90, 0x31, 0x03, 0x83, 0x01, 0x03, 0x04, 0x02, 0xC0, 0x80, 0x7F, 0x40, 0x80, 0xFB, 0x56,
+  0x80, 0xFC, 0x41, 0x84, 0xF2, 0xAE, 0x71, 0x26, 0x06, 0x03, 0x82, 0x03, 0x03, 0x01, 0xC0, 0x80, 0xAA, 0x40, 0x80, 0xFD, 0x58, 0x80, 0xFC, 0x42,
+  0x85, 0xF9, 0xDA, 0xA1, 0x6D, 0x47, 0x1A, 0x02, 0x81, 0x02, 0x02, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x59, 0x82, 0xFE, 0xFB, 0xFE, 0x44, 0x83,
+  0xDB, 0xB0, 0x61, 0x0E, 0x01, 0x80, 0x03, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x5D, 0x83, 0xFE, 0xFC, 0xFB, 0xFD, 0x42, 0x82, 0xE8, 0x7B, 0x1B,
+  0x00, 0x81, 0x02, 0x01, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x61, 0x82, 0xFD, 0xFC, 0xFE, 0x41, 0x81, 0xDC, 0x68, 0xC0, 0x80, 0xAB, 0x40, 0x80,
+  0xFD, 0x64, 0x81, 0xFE, 0xFB, 0x41, 0x83, 0x9D, 0x0C, 0x01, 0x01, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x66, 0x81, 0xFC, 0xFD, 0x40, 0x80, 0xAA,
+  0x00, 0x80, 0x02, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x68, 0x80, 0xFA, 0x40, 0x80, 0x71, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x68, 0x83, 0xFC,
+  0xFD, 0xE3, 0x1E, 0xC0, 0x80, 0xAB, 0x40, 0x80, 0xFD, 0x69, 0x80, 0xFB, 0x40, 0x80, 0x63, 0xC0, 0x80, 0xA9, 0x40, 0x80, 0xFD, 0x69, 0x82, 0xFD,
+  0xFE, 0x9A, 0xC0, 0x82, 0x82, 0xFE, 0xFC, 0x69, 0x80, 0xFD, 0x40, 0x80, 0xAC, 0xC0, 0x80, 0x5C, 0x40, 0x80, 0xFC, 0x69, 0x80, 0xFD, 0x40, 0x80,
+  0xAB, 0xC0, 0x81, 0x1D, 0xE0, 0x40, 0x80, 0xFA, 0x68, 0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x00, 0x81, 0x49, 0xF6, 0x40, 0x81, 0xFA, 0xFE, 0x66,
+  0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x48, 0xD4, 0x42, 0x81, 0xFC, 0xFE, 0x63, 0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x00,
+  0x80, 0x02, 0x00, 0x82, 0x13, 0x78, 0xDE, 0x42, 0x81, 0xFB, 0xFE, 0x61, 0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x01, 0x80, 0x02, 0x01, 0x83, 0x0B,
+  0x5A, 0xB5, 0xF7, 0x42, 0x80, 0xFC, 0x5F, 0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x02, 0x81, 0x02, 0x02, 0x02, 0x82, 0x36, 0x7B, 0xDB, 0x41, 0x81,
+  0xFD, 0xFE, 0x5D, 0x80, 0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x04, 0x82, 0x01, 0x03, 0x02, 0x01, 0x82, 0x07, 0x59, 0xC6, 0x41, 0x80, 0xFC, 0x5C, 0x80,
+  0xFD, 0x40, 0x80, 0xAB, 0xC0, 0x07, 0x81, 0x03, 0x02, 0x01, 0x82, 0x05, 0x68, 0xEE, 0x40, 0x80, 0xFD, 0x5B, 0x80, 0xFD, 0x40, 0x80, 0xAA, 0xC0,
+  0x0A, 0x81, 0x03, 0x01, 0x00, 0x81, 0x32, 0xD6, 0x40, 0x80, 0xFC, 0x5A, 0x80, 0xFC, 0x40, 0x80, 0x7E, 0xC0, 0x0B, 0x81, 0x01, 0x04, 0x00, 0x81,
+  0x1A, 0xDC, 0x40, 0x80, 0xFD, 0x59, 0x80, 0xFC, 0x40, 0x80, 0x57, 0xC0, 0x0D, 0x80, 0x04, 0x00, 0x81, 0x33, 0xE7, 0x40, 0x80, 0xFC, 0x57, 0x80,
+  0xFD, 0x40, 0x81, 0xE9, 0x2A, 0xC0, 0x0E, 0x80, 0x04, 0x00, 0x81, 0x3A, 0xF6, 0x40, 0x80, 0xFD, 0x56, 0x83, 0xFB, 0xFE, 0xBB, 0x04, 0xC0, 0x0F,
+  0x80, 0x04, 0x00, 0x83, 0x4C, 0xF4, 0xFE, 0xFD, 0x55, 0x80, 0xFD, 0x40, 0x80, 0x58, 0xC0, 0x10, 0x80, 0x02, 0x00, 0x81, 0x4E, 0xF7, 0x40, 0x80,
+  0xFD, 0x53, 0x80, 0xFD, 0x40, 0x82, 0xCE, 0x03, 0x01, 0xC0, 0x11, 0x80, 0x05, 0x00, 0x81, 0x4C, 0xF4, 0x40, 0x80, 0xFB, 0x51, 0x83, 0xFD, 0xFB,
+  0xF9, 0x3F, 0x00, 0x80, 0x03, 0xC0, 0x12, 0x80, 0x02, 0x00, 0x81, 0x4D, 0xF4, 0x40, 0x80, 0xFB, 0x4F, 0x81, 0xFE, 0xFC, 0x40, 0x80, 0x79, 0x00,
+  0x80, 0x02, 0xC0, 0x13, 0x80, 0x04, 0x00, 0x81, 0x37, 0xD2, 0x41, 0x81, 0xFC, 0xFE, 0x4A, 0x81, 0xFE, 0xFB, 0x41, 0x80, 0x8C, 0x00, 0x80, 0x02,
+  0xC0, 0x14, 0x80, 0x03, 0x00, 0x82, 0x11, 0x8E, 0xFB, 0x41, 0x82, 0xFB, 0xFD, 0xFE, 0x45, 0x81, 0xFE, 0xFB, 0x41, 0x81, 0xF3, 0x6B, 0x00, 0x81,
+  0x02, 0x01, 0xC0, 0x15, 0x80, 0x02, 0x01, 0x82, 0x35, 0xA9, 0xF2, 0x44, 0x80, 0xFE, 0x44, 0x82, 0xFA, 0xB1, 0x2B, 0x00, 0x80, 0x02, 0xC0, 0x16,
+  0x81, 0x01, 0x02, 0x01, 0x84, 0x31, 0x73, 0xBA, 0xEF, 0xFA, 0x42, 0x84, 0xFE, 0xF9, 0xCF, 0x8A, 0x3B, 0x01, 0x80, 0x02, 0xC0, 0x18, 0x81, 0x02,
+  0x02, 0x02, 0x87, 0x0A, 0x28, 0x48, 0x5D, 0x59, 0x3D, 0x1D, 0x04, 0x01, 0x81, 0x01, 0x02, 0xC0, 0x1A, 0x81, 0x03, 0x03, 0x08, 0x82, 0x02, 0x03,
+  0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_SPONGE_EMOJI_48_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E1, 0x49E2, 0x6AC3,
+  0x8B85, 0xA425, 0x9BE5, 0x7B24, 0x5A63, 0x3161, 0x0000, 0x0000, 0x0000, 0x0000, 0x49E2, 0xAC66, 0xE5C8, 0xFEAA, 0xFECA, 0xFEAA,
+  0xFE69, 0xFE69, 0xFECA, 0xFEEA, 0xF628, 0xBCC6, 0x6AC3, 0x0020, 0x0000, 0x0000, 0x0000, 0x3141, 0xBCC6, 0xFEAA, 0xFECA, 0xFE89,
+  0xFE69, 0xF628, 0xFDC7, 0xFD46, 0xFD46, 0xFDA7, 0xF608, 0xFE69, 0xFEAA, 0xFEAA, 0xCD27, 0x41C2, 0x0000, 0x0000, 0x0000, 0x72E4,
+  0xF648, 0xFEAA, 0xFE08, 0xFE28, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE89,
+  0xF648, 0x6AA3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x8B85, 0xFEAA, 0xFE69, 0xFE08, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE49,
+  0xFD86, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE89, 0x6AA3, 0x0000, 0x0000, 0x0000, 0x8344,
+  0xFEAA, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFE08, 0xFE69, 0xFE69, 0xFDC7,
+  0xFD66, 0xFDE8, 0xFE69, 0xFE69, 0xFE8A, 0x8364, 0x0000, 0x5223, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDE8, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD45, 0xFD87, 0xFE69, 0xFE49, 0xFE69, 0xFECA, 0x93A5,
+  0x0020, 0x0000, 0x0000, 0x0860, 0xC4E7, 0xFEAA, 0xF628, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFDC7, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFECA, 0xBCA6, 0x2921, 0x0000,
+  0x0000, 0x0000, 0x49E2, 0xFE89, 0xFE49, 0xFDA7, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE49, 0xFD87, 0xFD86, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFE08, 0xFE69, 0xFE69, 0xF628, 0xFEAA, 0xF628, 0x8B85, 0x2921,
+  0x0000, 0x0000, 0x0020, 0x0000, 0x7B24, 0xFECA, 0xF586, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFE49, 0xFE69, 0xFE08, 0xFD45, 0xFD25, 0xFDE8, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE08, 0xFDC7,
+  0xFE89, 0xEDE8, 0xAC46, 0x6AA3, 0x2101, 0x0020, 0x0000, 0x0000, 0x0000, 0xA405, 0xFEAA, 0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFDE8,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFDA7, 0xFE29, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFE49, 0xFE49, 0xFD66, 0xFD25, 0xFDA7, 0xFE89, 0xFECA, 0xFE89, 0xF628, 0xD567, 0x9BE5, 0x6AC3, 0x41C2, 0x1080, 0x0000,
+  0x0000, 0xA405, 0xFEAA, 0xFE08, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFDE8, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFD87, 0xFD46, 0xFDC7, 0xFE69, 0xF628,
+  0xFE69, 0xFE69, 0xFE89, 0xFEAA, 0xFECA, 0xFE8A, 0xD567, 0xAC66, 0x5A63, 0x0860, 0x0000, 0xA3C4, 0xFEAA, 0xFE69, 0xFE49, 0xFE29,
+  0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE29, 0xFE69, 0xFE69, 0xFE08,
+  0xFD87, 0xFD87, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xF628, 0xFE49,
+  0xFEAA, 0xFECA, 0xFE89, 0xE5C8, 0x7304, 0x1080, 0x0000, 0x0000, 0xA383, 0xFE8A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFE29, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFDE8, 0xFDC7, 0xFE49,
+  0xFE69, 0xFECA, 0xDD87, 0x6283, 0x9B01, 0xFE28, 0xFE6A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69,
+  0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFD87, 0xFE6A, 0xFE08, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xF608, 0xFE89, 0xFEAA,
+  0x9BE5, 0x0860, 0x0000, 0x0000, 0x9AC0, 0xFD23, 0xFE49, 0xFE69, 0xFDC7, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE6A, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFE08, 0xFE69, 0xFE28, 0xFD66, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
+  0xFECA, 0xA425, 0x0000, 0x9AE0, 0xFC81, 0xF4E3, 0xFDA6, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDE8,
+  0xFE08, 0xFE69, 0xFDE8, 0xFD87, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xF628,
+  0xFECA, 0x6AA3, 0x9AC0, 0xFCA1, 0xF461, 0xF481, 0xF4C3, 0xFD45, 0xFE08, 0xFE8A, 0xFE69, 0xFE49, 0xFE69, 0xFDA7, 0xFD46, 0xFD66,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFD87, 0xFE08,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE28, 0xFE89,
+  0xDD87, 0x18C1, 0x9AC0, 0xFCA1, 0xF481, 0xF481, 0xF461, 0xF481, 0xF503, 0xFDA6, 0xFE28, 0xFE6A, 0xFE8A, 0xFDE8, 0xFD46, 0xFD66,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD87, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFD66,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD46, 0xF566,
+  0xFECA, 0x5A43, 0x9AC0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4A2, 0xFD24, 0xFDE7, 0xFE69, 0xFE29, 0xFE29,
+  0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD45, 0xFDA7, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD87, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD45, 0xFD87,
+  0xFEAA, 0x93A5, 0x7A20, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF4E3, 0xFDC7, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFDA7,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDA7, 0xFD25, 0xFD46, 0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFE08,
+  0xFEAA, 0xAC46, 0x59A0, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF503,
+  0xFE28, 0xFE29, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE08, 0xFE49,
+  0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE08, 0xFD66, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE8A, 0xA405, 0x1880, 0xD3C0, 0xFCA1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
+  0xF4A2, 0xFD45, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFD86, 0xFD46, 0xFDC7, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE29, 0xFE08, 0xFE49, 0xFE69, 0xFE49,
+  0xFEAA, 0xA3C4, 0x4120, 0xF460, 0xFCA1, 0xEC40, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
+  0xF481, 0xFD45, 0xFD46, 0xFD87, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD87, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69,
+  0xFE49, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD86, 0xFE29, 0xFE69, 0xFE8A,
+  0xA383, 0x0000, 0x4120, 0xCBC0, 0xFCC1, 0xFC81, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
+  0xF481, 0xFD45, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD45, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE08, 0xFDC7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFDC7, 0xFE8A, 0xFE48, 0x9B21,
+  0x0000, 0x0840, 0x7200, 0xD3C0, 0xFC81, 0xFCC1, 0xF481, 0xEC40, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2,
+  0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDE7, 0xFD46, 0xFD46, 0xFD46, 0xFDE8, 0xFE8A, 0xFDE7, 0x9AC0, 0x0000, 0x0020,
+  0x5180, 0xAB20, 0xEC40, 0xFCC1, 0xFC81, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4E3, 0xFE49, 0xFE69, 0xFE49,
+  0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD87, 0xFDC7, 0xFE49, 0xFE69, 0xFD23, 0x9AC0, 0x0000, 0x0000, 0x30E0, 0x7200, 0xCBA0, 0xFCA1,
+  0xFCA1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xFD03, 0xFE69, 0xFDE8, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFE6A, 0xFDC7, 0xFCA1, 0x9AC0, 0x0000, 0x0000, 0x0000, 0x0020, 0x5180, 0xBB80, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481,
+  0xF461, 0xFD24, 0xFDA7, 0xFD46, 0xFD46, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7,
+  0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xF4C2, 0xFC81, 0x9AE0, 0x0000, 0x0000, 0x0020,
+  0x61C0, 0xE420, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
+  0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFDE8, 0xFD66, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD24,
+  0xF461, 0xFCA1, 0x9AE0, 0x0000, 0x0000, 0x28C0, 0xCBC0, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4C2, 0xFDE7, 0xFE6A,
+  0xFE28, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFDA7, 0xFD25, 0xFD46, 0xFE29,
+  0xFE69, 0xFE69, 0xFD44, 0xF461, 0xF461, 0xFCC1, 0x7A20, 0x0000, 0x0000, 0x1060, 0xDBE0, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481,
+  0xF461, 0xF481, 0xFD24, 0xFD46, 0xFD66, 0xFDC7, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE28, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE08,
+  0xFD86, 0xFDE8, 0xFE8A, 0xFE28, 0xFD04, 0xF461, 0xF481, 0xF461, 0xFCA1, 0x5180, 0x0000, 0x28C0, 0xDC00, 0xFC81, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFD04, 0xFD45, 0xFE69, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE8A, 0xFE8A, 0xFE49, 0xFD86, 0xF4A2, 0xF461, 0xF481, 0xF481, 0xFC81, 0xDC00, 0x20A0, 0x0000, 0x30E0, 0xF440, 0xFC81, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4A2, 0xFD04, 0xFDA6, 0xFE08, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE29,
+  0xFDC7, 0xFD44, 0xF4C2, 0xF461, 0xF461, 0xF481, 0xF481, 0xEC40, 0xFCC1, 0xAB20, 0x0000, 0x0000, 0x4940, 0xF460, 0xFC81, 0xF461,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF481, 0xF481, 0xF4C3, 0xF4E3, 0xF4E3, 0xF4A2, 0xF481, 0xF481,
+  0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0x5180, 0x0000, 0x4940, 0xF440, 0xFC81, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xFCA1, 0xC380, 0x0000, 0x0000, 0x0000, 0x4940, 0xF460, 0xFC81, 0xEC40, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF440,
+  0xF460, 0x3900, 0x0000, 0x0000, 0x4940, 0xF440, 0xFCA1, 0xEC40, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCC1, 0x7200, 0x0000, 0x0020, 0x30E0, 0xC3A0,
+  0xFCC1, 0xF481, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
+  0xEC40, 0xF481, 0xFCA1, 0x8260, 0x0000, 0x0000, 0x0840, 0x8280, 0xEC40, 0xFCC1, 0xF481, 0xEC40, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xEC40, 0xF481, 0xFCA1, 0xE420, 0x61C0, 0x0000, 0x0000, 0x0000, 0x30E0, 0x9AE0, 0xE420,
+  0xFCC1, 0xFCA1, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xFCC1, 0xEC40, 0xA300, 0x20A0, 0x0000, 0x0000,
+  0x0000, 0x28C0, 0x69E0, 0xAB20, 0xE420, 0xEC40, 0xF481, 0xFC81, 0xFC81, 0xF481, 0xEC20, 0xC3A0, 0x8260, 0x30E0, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x20A0, 0x4120, 0x59A0, 0x5180, 0x3920, 0x1880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_SPONGE_EMOJI_48_SPANS = {
+  SPRITE_SPONGE_EMOJI_48_SPAN_ROWS, SPRITE_SPONGE_EMOJI_48_SPAN_OPS, SPRITE_SPONGE_EMOJI_48_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_SPONGE_EMOJI_48_ASSET = {
   SPRITE_SPONGE_EMOJI_48_WIDTH, SPRITE_SPONGE_EMOJI_48_HEIGHT,
-  SPRITE_SPONGE_EMOJI_48_ALPHA, SPRITE_SPONGE_EMOJI_48_RGB565
+  nullptr, nullptr, &SPRITE_SPONGE_EMOJI_48_SPANS
 };
 
 #endif // SPRITE_SPONGE_EMOJI_48_INCLUDED
@@ -5,150 +5,249 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from sponge_emoji_64.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from sponge_emoji_64.png (64x64) — RGBA multi-couleur, encodé en spans
+// 2650/4096 pixels visibles, 6659 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_SPONGE_EMOJI_64_WIDTH = 64;
 constexpr uint16_t SPRITE_SPONGE_EMOJI_64_HEIGHT = 64;
 
-const uint16_t SPRITE_SPONGE_EMOJI_64_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFFEF, 0xFDE7, 0xFDE7, 0xFFEA, 0xFFEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFD4A, 0xFE66, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE66, 0xFDE7, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBEF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE49, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE89, 0xFDEA, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0xFE6A, 0xFE49, 0xFE69, 0xFE49, 0xFE89, 0xFEAA, 0xFEAA, 0xFE8A, 0xFE69, 0xFE08, 0xFE28, 0xFE89, 0xFEAA, 0xFEAA, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0xFE49, 0xFE69, 0xFE89, 0xFE69, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE89, 0xFE89, 0xFE89, 0xFE69, 0xFE69, 0x0000, 0xFFEF, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0xFFEA, 0xFE49, 0xFE69, 0xFEAA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD87, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE89, 0xFE69, 0xFE49, 0x0000, 0xFD40, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFD4A, 0xFFE0, 0xFEAA, 0xFE49, 0xFE89, 0xFE89, 0xFE49, 0xFE08, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0x0000, 0xFFEA, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFFEF, 0xFFEF, 0xFEAA, 0xFE49, 0xFE89, 0xFE69, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFDA7, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFFF, 0xFFEF, 0xFE69, 0xFE49, 0xFE89, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDA7, 0xFD66, 0xFD66, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFDE8, 0xFD87, 0xFDA7, 0xFE28, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0x0000, 0xFD4A, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFFE0, 0x0000, 0xFE69, 0xFEAA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE28, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xFE49, 0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE6A, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xFE49, 0xFE69, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFE69, 0xFECA, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD87, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xFE49, 0xFE49, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFBE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE09, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDA7, 0xFD66, 0xFDE7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE2A, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFFEA, 0xFFEF, 0xFFE0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE49, 0xFEAA, 0xFE49, 0xFDC7, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46, 0xFD66, 0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD86, 0xFD46, 0xFDA7, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE69, 0xFE89, 0xFE49, 0xFE49, 0xFE6A, 0xFEA9, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0xFE6C, 0xFFEA, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE49, 0xFE8A, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD45, 0xFD46, 0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD87, 0xFE49, 0xFE8A, 0xFECA, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE49, 0xFE49, 0x0000, 0x0000, 0x0000, 0x0000, 0xFE66, 0xFDE7, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFE89, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE29, 0xFDC7, 0xFDA7, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE29, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFEA9, 0xFF0A, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE6A, 0xFEA9, 0x0000, 0x0000, 0xFFEF, 0xFE6C, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFE69, 0xFE69, 0xFE69, 0xFDE8, 0xFD46, 0xFD46, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDC7, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFEAA, 0xFEEA, 0xFECA, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFFE0, 0x0000, 0xFFE0, 0xFFEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFDA6, 0xFE89, 0xFE69, 0xFE69, 0xFE08, 0xFDE8, 0xFDE8, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD66, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD46, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFDC7, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDC7, 0xFDC8, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFECA, 0xFECA, 0xFE49, 0xFE89, 0xFE69, 0xFE2A, 0x0000, 0xFBE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xFD65, 0xFE89, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD45, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFDE8, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46, 0xFD46, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFECA, 0xFE69, 0xFE69, 0xFE69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xF4C3, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD86, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE08, 0xFD86, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFEAA, 0xFE69, 0xFE49, 0xFE49, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000,
-  0xF461, 0xFDA6, 0xFE6A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE28, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xFE49, 0xFE69, 0xFFEF, 0xFFFF, 0xF800, 0x0000,
-  0xF460, 0xFCC2, 0xFE28, 0xFE6A, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE8A, 0xFE49, 0xFD4A, 0xFD4A, 0xFFE0,
-  0xF461, 0xFC81, 0xF4E3, 0xFE08, 0xFE69, 0xFDC7, 0xFD46, 0xFD86, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xFE28, 0xFD66, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDA7, 0xFD87, 0xFD87, 0xFE28, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFD87, 0xFDA7, 0xFE28, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFE29, 0xFBEF, 0xFD4A,
-  0xF461, 0xFC81, 0xF461, 0xF4C2, 0xFD86, 0xFD66, 0xFD66, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFDC7, 0xFE28, 0xFE69, 0xFE08, 0xFDA7, 0xFDA7, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0xFE89, 0xFE6A, 0x0000,
-  0xF461, 0xFC81, 0xF481, 0xF461, 0xF461, 0xF4C2, 0xFD04, 0xFD66, 0xFE08, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD87, 0xFD46, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFDA7, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFEEA, 0xFE49, 0xFE6C,
-  0xF461, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF461, 0xF481, 0xF4C2, 0xFD65, 0xFE08, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD86, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD86, 0xFDC7, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE29, 0xFD66, 0xFD46, 0xFD46, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDA7, 0xFD87, 0xFDE8, 0xFE49, 0xFE89, 0xFE09,
-  0xF461, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF4A2, 0xFD03, 0xFDC6, 0xFE49, 0xFE6A, 0xFE69, 0xFE08, 0xFD66, 0xFD66, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD46, 0xFD46, 0xFD66, 0xFE28, 0xFEAA, 0xFE69,
-  0xF481, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF481, 0xF4A2, 0xFD65, 0xFE28, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD66, 0xFD66, 0xFE29, 0xFE8A, 0xFE69,
-  0xF481, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF481, 0xFD24, 0xFE08, 0xFE69, 0xFE6A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFDE7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFDE8, 0xFE49, 0xFE89, 0xFE49,
-  0xF461, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xFD24, 0xFE28, 0xFE6A, 0xFE69, 0xFE29, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0xFE69,
-  0xFC61, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDE7, 0xFDE8, 0xFD66, 0xFD46, 0xFD87, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE89, 0xFE08,
-  0xFCC0, 0xF481, 0xFCE1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD24, 0xFD66, 0xFD66, 0xFD46, 0xFD87, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDE8, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0xFD65,
-  0x0000, 0xEC42, 0xFC81, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD24, 0xFD66, 0xFD66, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDC8, 0xFD87, 0xFDA7, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFDE8, 0xFD66, 0xFD46, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xF504,
-  0xF800, 0x0000, 0xE421, 0xFC81, 0xFCC1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD04, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE08, 0xF4A2,
-  0x0000, 0xFFE0, 0x0000, 0xDC40, 0xF481, 0xF481, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDE8, 0xFE69, 0xFE6A, 0xFD85, 0xF481,
-  0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xEC81, 0xF481, 0xF461, 0xF481, 0xFC81, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDE8, 0xFD87, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFD66, 0xFE28, 0xFE69, 0xFE6A, 0xFCE3, 0xF440,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0xEC82, 0xF481, 0xF461, 0xF481, 0xFC81, 0xFCA1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFE08, 0xFE6A, 0xFE49, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDE8, 0xFD66, 0xFD66, 0xFD66, 0xFDE8, 0xFE69, 0xFE6A, 0xFDC7, 0xFCA1, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF461, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4E3, 0xFE49, 0xFE6A, 0xFE08, 0xFD86, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDA7, 0xFDC8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xF503, 0xFC81, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFBE0, 0x0000, 0x0000, 0xEC42, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCE3, 0xFE49, 0xFDE8, 0xFD46, 0xFD66, 0xFD46, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE6A, 0xFDA6, 0xF481, 0xFC81, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFDE0, 0xF800, 0x0000, 0x0000, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFD03, 0xFDA7, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE28, 0xF4C2, 0xF461, 0xFCA1, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xCCC0, 0xFBE0, 0x0000, 0x0000, 0xF481, 0xFC81, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFD86, 0xFDC8, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD86, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFD24, 0xF461, 0xF481, 0xFC81, 0xF481,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFBE0, 0xFBE0, 0x0000, 0xEC81, 0xF461, 0xFC81, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDC7, 0xFE8A, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD44, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFB20, 0x0000, 0xFCC0, 0xF461, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFE49, 0xFDE8, 0xFDA7, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFD87, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFD44, 0xF461, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0xF481, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4C2, 0xFD25, 0xFD66, 0xFD46, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFD87, 0xFDE8, 0xFE69, 0xFE69, 0xFE08, 0xFCE3, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xF800, 0x0000, 0xF481, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCE3, 0xFD45, 0xFD25, 0xFE08, 0xFE8A, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE29, 0xFD86, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xFC81, 0xF481, 0xE442,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF461, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF4A2, 0xFD86, 0xFE08, 0xFE49, 0xFE69, 0xFE8A, 0xFE8A, 0xFE6A, 0xFE6A, 0xFE6A, 0xFE6A, 0xFE8A, 0xFE8A, 0xFE69, 0xFE28, 0xFE08, 0xFD86, 0xF4A2, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xF461, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFC63, 0xF481, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF460, 0xF481, 0xFD03, 0xFD65, 0xFDA6, 0xFDC7, 0xFE08, 0xFDE7, 0xFDE7, 0xFE08, 0xFDC7, 0xFDC7, 0xFD65, 0xF4E3, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xF4A1, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF481, 0xF461, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF460, 0xF440, 0xF461, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF461, 0xF440, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xF461, 0xFD00, 0xF800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xF481, 0xFC81, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF461, 0x0000, 0xFBE0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAAA0, 0x0000, 0xF421, 0xFC81, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xF461, 0xFC60, 0xBBE0, 0xF800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0x0000, 0xF421, 0xFC81, 0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCA1, 0xF481, 0xEC82, 0x0000, 0xFAA0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD40, 0x0000, 0xF420, 0xF481, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1, 0xF481, 0xEC61, 0x0000, 0xFD40, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0x0000, 0xF481, 0xFC81, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCA1, 0xF481, 0xF481, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF461, 0xF481, 0xFCA1, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xFCC1, 0xF461, 0xF461, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0x0000, 0xF461, 0xF481, 0xF481, 0xFCC1, 0xFC81, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCC1, 0xF481, 0xF461, 0xF4A1, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFAA0, 0x0000, 0x0000, 0xF461, 0xF481, 0xF481, 0xFCC1, 0xFCC1, 0xF481, 0xF461, 0xF461, 0xF461, 0xF481, 0xF461, 0xF461, 0xF481, 0xF461, 0xF481, 0xF481, 0xFC81, 0xFCE1, 0xF481, 0xFC81, 0xF461, 0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCC1, 0xFCE1, 0xFCC1, 0xFCC1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCC1, 0xFCE1, 0xFCA1, 0xF481, 0xFC81, 0xF481, 0xE441, 0x0000, 0xFD40, 0xAAA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFAA0, 0x0000, 0x0000, 0xEC42, 0xEC61, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF461, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xDB64, 0x0000, 0x0000, 0xFBE0, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFD40, 0xBBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFCE0, 0xF421, 0xEC61, 0xEC40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xAAA0, 0xBBE0, 0xFBE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFD40, 0xFBE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_SPONGE_EMOJI_64_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 2, 0, 3, 0, 13, 7, 25, 14, 42, 24, 59, 38,
+  75, 58, 103, 83, 129, 111, 149, 142, 170, 174, 190, 209, 209, 243, 228, 279,
+  248, 318, 266, 363, 284, 410, 307, 460, 330, 514, 353, 570, 376, 628, 391, 685,
+  410, 746, 427, 809, 442, 873, 457, 937, 469, 1000, 482, 1064, 493, 1128, 505, 1192,
+  516, 1256, 527, 1320, 539, 1384, 550, 1448, 563, 1512, 577, 1575, 594, 1638, 612, 1700,
+  631, 1760, 651, 1818, 671, 1873, 691, 1927, 711, 1979, 731, 2029, 750, 2078, 769, 2125,
+  785, 2170, 802, 2214, 815, 2254, 829, 2295, 845, 2335, 865, 2374, 885, 2413, 906, 2449,
+  927, 2483, 951, 2515, 971, 2543, 999, 2570, 1028, 2593, 1049, 2615, 1074, 2633, 1090, 2642
 };
 
-const uint8_t SPRITE_SPONGE_EMOJI_64_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2D, 0x4F, 0x4F, 0x44, 0x26, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x60, 0xA3, 0xCD, 0xDD, 0xE4, 0xF0, 0xF0, 0xEC, 0xE2, 0xD8, 0xC6, 0x82, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xA5, 0xE9, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xCB, 0x4F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1D, 0x94, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x2D, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x54, 0xE6, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xF1, 0x61, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x01, 0x0C, 0x85, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x6B, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x02, 0x0C, 0x96, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0x6C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x02, 0x0A, 0x90, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0x8B, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x66, 0xFC, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x94, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x29, 0xEC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xAE, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xDB, 0x4A, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x15, 0xE4, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x33, 0x09, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x39, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x4A, 0x23, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x67, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xE8, 0xAB, 0x66, 0x42, 0x2A, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x91, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xAD, 0x86, 0x65, 0x3C, 0x0D, 0x00, 0x00, 0x02, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8A, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xF9, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0xB7, 0x8D, 0x4F, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xF9, 0xFA, 0xFF, 0xFF, 0xFF, 0xEE, 0xBF, 0x78, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xD7, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFC, 0xCA, 0x3E, 0x00, 0x01, 0x01, 0x00, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xEF, 0x67, 0x02, 0x01, 0x01, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0x03, 0x03, 0x01,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0x5B, 0x02, 0x03,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xE0, 0x23, 0x00,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x88, 0x05,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF1, 0x11,
-  0x8C, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x46,
-  0x8B, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x7D,
-  0x55, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8D,
-  0x3B, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x10, 0xF0, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x05, 0x81, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x0F, 0xB8, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x01, 0x00, 0x15, 0xB1, 0xFF, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x01, 0x00, 0x0F, 0x6C, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x21, 0x82, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x5F, 0xCA, 0xF2, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x39, 0xA0, 0xD7, 0xF9, 0xFF, 0xFF, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x0F, 0x6A, 0xB1, 0xEC, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x00, 0x00, 0x4A, 0xA5, 0xF3, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x8A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x04, 0x00, 0x00, 0x49, 0xBD, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x91,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x00, 0x17, 0x92, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x67,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x05, 0x74, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x39,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x86, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x19,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x9A, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xC2, 0x0B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x75, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0xBD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF6, 0x30, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xBC, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xA0, 0x0B, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0xB9, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xF2, 0x41, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x15, 0xB8, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x96, 0x09, 0x04, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0xB9, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xCF, 0x1E, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0xBB, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE7, 0x43, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x99, 0xF8, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xEF, 0x5C, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xDD, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFF, 0xDD, 0x47, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19, 0x9B, 0xE9, 0xFF, 0xFF, 0xFA, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFA, 0xFD, 0xFF, 0xF9, 0xAE, 0x24, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x44, 0x9D, 0xE2, 0xFF, 0xFF, 0xFF, 0xFA, 0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFB, 0xFA, 0xF9, 0xFB, 0xFF, 0xFF, 0xFE, 0xC0, 0x65, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x38, 0x73, 0xAE, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xA1, 0x5B, 0x16, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x0F, 0x2F, 0x4A, 0x64, 0x84, 0x9E, 0xB6, 0xB3, 0xAA, 0x85, 0x70, 0x45, 0x28, 0x07, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x11, 0x10, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_SPONGE_EMOJI_64_SPAN_OPS[] PROGMEM = {
+  0xC0, 0xC0, 0xC0, 0x0E, 0x86, 0x02, 0x02, 0x04, 0x04, 0x03, 0x02, 0x01, 0xC0, 0x0A, 0x83, 0x01, 0x03, 0x05, 0x04, 0x06, 0x82, 0x05, 0x04, 0x02,
+  0xC0, 0x09, 0x80, 0x02, 0x03, 0x86, 0x18, 0x2D, 0x4F, 0x4F, 0x44, 0x26, 0x0C, 0x02, 0x81, 0x02, 0x01, 0xC0, 0x0A, 0x8D, 0x0D, 0x60, 0xA3, 0xCD,
+  0xDD, 0xE4, 0xF0, 0xF0, 0xEC, 0xE2, 0xD8, 0xC6, 0x82, 0x31, 0xC0, 0x04, 0x80, 0x01, 0x02, 0x83, 0x2F, 0xA5, 0xE9, 0xF9, 0x4A, 0x83, 0xF1, 0xCB,
+  0x4F, 0x01, 0xC0, 0x03, 0x80, 0x01, 0x01, 0x82, 0x1D, 0x94, 0xFD, 0x43, 0x88, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0x43, 0x81,
+  0xBD, 0x2D, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x02, 0x80, 0x02, 0x00, 0x82, 0x03, 0x54, 0xE6, 0x42, 0x80, 0xFE, 0x4B, 0x80, 0xFE, 0x40, 0x80, 0xFE,
+  0x40, 0x81, 0xF1, 0x61, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x01, 0x83, 0x03, 0x01, 0x0C, 0x85, 0x41, 0x80, 0xFD, 0x51, 0x80, 0xFD, 0x41, 0x80, 0x6B,
+  0x00, 0x81, 0x03, 0x01, 0xC0, 0x00, 0x83, 0x02, 0x02, 0x0C, 0x96, 0x40, 0x81, 0xFB, 0xFD, 0x53, 0x81, 0xFE, 0xFC, 0x40, 0x80, 0x6C, 0x00, 0x80,
+  0x02, 0xC0, 0x83, 0x01, 0x02, 0x0A, 0x90, 0x40, 0x81, 0xFA, 0xFE, 0x55, 0x83, 0xFE, 0xFD, 0xFD, 0x8B, 0x00, 0x81, 0x03, 0x02, 0xC0, 0x80, 0x01,
+  0x00, 0x83, 0x66, 0xFC, 0xFA, 0xFD, 0x57, 0x81, 0xFE, 0xFE, 0x40, 0x80, 0x94, 0x01, 0x80, 0x02, 0xC0, 0x00, 0x81, 0x29, 0xEC, 0x40, 0x80, 0xFC,
+  0x59, 0x81, 0xFE, 0xFC, 0x40, 0x81, 0xAE, 0x15, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x7F, 0x40, 0x80, 0xFB, 0x5B, 0x81, 0xFE, 0xFD, 0x40, 0x81,
+  0xDB, 0x4A, 0x02, 0x82, 0x01, 0x02, 0x01, 0xC0, 0x83, 0x15, 0xE4, 0xFE, 0xFE, 0x60, 0x82, 0xB0, 0x33, 0x09, 0x02, 0x84, 0x02, 0x03, 0x02, 0x01,
+  0x01, 0xC0, 0x80, 0x39, 0x40, 0x80, 0xFD, 0x63, 0x83, 0xB3, 0x4A, 0x23, 0x0D, 0x03, 0x83, 0x02, 0x05, 0x03, 0x02, 0xC0, 0x80, 0x67, 0x40, 0x80,
+  0xFD, 0x61, 0x81, 0xFE, 0xFE, 0x41, 0x85, 0xE8, 0xAB, 0x66, 0x42, 0x2A, 0x0E, 0x03, 0x82, 0x05, 0x04, 0x01, 0xC0, 0x80, 0x91, 0x40, 0x80, 0xFE,
+  0x63, 0x81, 0xFD, 0xFA, 0x43, 0x85, 0xD7, 0xAD, 0x86, 0x65, 0x3C, 0x0D, 0x01, 0x82, 0x02, 0x05, 0x01, 0xC0, 0x80, 0x8A, 0x40, 0x80, 0xFE, 0x65,
+  0x83, 0xFD, 0xFC, 0xF9, 0xFC, 0x43, 0x84, 0xE5, 0xB7, 0x8D, 0x4F, 0x01, 0x00, 0x81, 0x01, 0x03, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x68, 0x84,
+  0xFE, 0xFC, 0xFB, 0xF9, 0xFA, 0x42, 0x83, 0xEE, 0xBF, 0x78, 0x09, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x6D, 0x82, 0xFD,
+  0xFB, 0xFB, 0x42, 0x81, 0xD7, 0x71, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x70, 0x81, 0xFE, 0xFC, 0x41, 0x82, 0xFC, 0xCA, 0x3E, 0x00, 0x81, 0x01,
+  0x01, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x72, 0x81, 0xFE, 0xFD, 0x41, 0x84, 0xEF, 0x67, 0x02, 0x01, 0x01, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE,
+  0x75, 0x80, 0xFE, 0x41, 0x83, 0x7F, 0x03, 0x03, 0x01, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x76, 0x81, 0xFD, 0xFC, 0x40, 0x82, 0x5B, 0x02, 0x03,
+  0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x77, 0x83, 0xFD, 0xFB, 0xE0, 0x23, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x78, 0x80, 0xFB, 0x40, 0x81, 0x88,
+  0x05, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x79, 0x82, 0xFC, 0xF1, 0x11, 0xC0, 0x80, 0x8C, 0x40, 0x80, 0xFE, 0x79, 0x80, 0xFD, 0x40, 0x80, 0x46,
+  0xC0, 0x80, 0x8B, 0x40, 0x80, 0xFE, 0x79, 0x82, 0xFE, 0xFE, 0x7D, 0xC0, 0x82, 0x55, 0xFE, 0xFD, 0x79, 0x80, 0xFE, 0x40, 0x80, 0x8D, 0xC0, 0x80,
+  0x3B, 0x40, 0x80, 0xFD, 0x79, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x82, 0x10, 0xF0, 0xFB, 0x79, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x81, 0x05,
+  0x81, 0x40, 0x80, 0xF9, 0x78, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x00, 0x81, 0x0F, 0xB8, 0x40, 0x80, 0xF8, 0x77, 0x80, 0xFE, 0x40, 0x80, 0x8C,
+  0xC0, 0x80, 0x01, 0x00, 0x81, 0x15, 0xB1, 0x40, 0x81, 0xFE, 0xFD, 0x75, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x82, 0x0F,
+  0x6C, 0xF0, 0x43, 0x80, 0xFE, 0x71, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x01, 0x80, 0x02, 0x01, 0x82, 0x21, 0x82, 0xEA, 0x43, 0x81, 0xFD, 0xFE,
+  0x6E, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x02, 0x80, 0x01, 0x02, 0x83, 0x0E, 0x5F, 0xCA, 0xF2, 0x42, 0x81, 0xFC, 0xFD, 0x6C, 0x80, 0xFE, 0x40,
+  0x80, 0x8C, 0xC0, 0x04, 0x80, 0x01, 0x03, 0x83, 0x39, 0xA0, 0xD7, 0xF9, 0x41, 0x81, 0xFA, 0xFD, 0x6A, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x07,
+  0x81, 0x01, 0x02, 0x01, 0x83, 0x0F, 0x6A, 0xB1, 0xEC, 0x41, 0x80, 0xFB, 0x69, 0x80, 0xFE, 0x40, 0x80, 0x8C, 0xC0, 0x09, 0x82, 0x01, 0x04, 0x01,
+  0x01, 0x82, 0x4A, 0xA5, 0xF3, 0x40, 0x80, 0xFA, 0x68, 0x80, 0xFE, 0x40, 0x80, 0x8A, 0xC0, 0x0B, 0x82, 0x01, 0x05, 0x04, 0x01, 0x81, 0x49, 0xBD,
+  0x40, 0x81, 0xFC, 0xFE, 0x66, 0x80, 0xFE, 0x40, 0x80, 0x91, 0xC0, 0x0D, 0x82, 0x01, 0x04, 0x02, 0x00, 0x81, 0x17, 0x92, 0x41, 0x80, 0xFE, 0x65,
+  0x80, 0xFD, 0x40, 0x80, 0x67, 0xC0, 0x0F, 0x81, 0x01, 0x05, 0x00, 0x82, 0x05, 0x74, 0xF9, 0x40, 0x80, 0xFE, 0x64, 0x80, 0xFD, 0x40, 0x80, 0x39,
+  0xC0, 0x11, 0x81, 0x02, 0x02, 0x00, 0x80, 0x86, 0x41, 0x80, 0xFE, 0x63, 0x82, 0xFE, 0xFC, 0x19, 0xC0, 0x12, 0x81, 0x01, 0x02, 0x00, 0x80, 0x9A,
+  0x40, 0x80, 0xFD, 0x62, 0x83, 0xFD, 0xFE, 0xC2, 0x0B, 0xC0, 0x16, 0x80, 0x9E, 0x40, 0x80, 0xFC, 0x61, 0x80, 0xFA, 0x40, 0x80, 0x75, 0xC0, 0x15,
+  0x82, 0x01, 0x09, 0xBD, 0x40, 0x80, 0xFB, 0x60, 0x82, 0xFA, 0xF6, 0x30, 0xC0, 0x17, 0x81, 0x13, 0xBC, 0x40, 0x80, 0xFA, 0x5E, 0x80, 0xFA, 0x40,
+  0x82, 0xA0, 0x0B, 0x01, 0xC0, 0x16, 0x80, 0x01, 0x00, 0x81, 0x15, 0xB9, 0x40, 0x80, 0xFA, 0x5C, 0x83, 0xFD, 0xFB, 0xF2, 0x41, 0x00, 0x80, 0x02,
+  0xC0, 0x17, 0x80, 0x03, 0x00, 0x81, 0x15, 0xB8, 0x40, 0x80, 0xFB, 0x5B, 0x80, 0xFA, 0x40, 0x83, 0x96, 0x09, 0x04, 0x01, 0xC0, 0x18, 0x80, 0x03,
+  0x00, 0x81, 0x13, 0xB9, 0x40, 0x80, 0xFD, 0x59, 0x80, 0xFB, 0x40, 0x81, 0xCF, 0x1E, 0x00, 0x80, 0x03, 0xC0, 0x19, 0x80, 0x03, 0x00, 0x81, 0x11,
+  0xBB, 0x41, 0x80, 0xFD, 0x56, 0x80, 0xFC, 0x40, 0x81, 0xE7, 0x43, 0x00, 0x80, 0x03, 0xC0, 0x1A, 0x80, 0x01, 0x00, 0x82, 0x01, 0x99, 0xF8, 0x40,
+  0x81, 0xFD, 0xFD, 0x52, 0x81, 0xFE, 0xFC, 0x40, 0x81, 0xEF, 0x5C, 0x00, 0x80, 0x04, 0xC0, 0x1E, 0x81, 0x57, 0xDD, 0x41, 0x81, 0xFB, 0xFD, 0x4E,
+  0x81, 0xFE, 0xFB, 0x41, 0x81, 0xDD, 0x47, 0x00, 0x80, 0x02, 0xC0, 0x1D, 0x80, 0x02, 0x00, 0x82, 0x19, 0x9B, 0xE9, 0x41, 0x82, 0xFA, 0xFB, 0xFD,
+  0x48, 0x83, 0xFE, 0xFD, 0xFA, 0xFD, 0x40, 0x82, 0xF9, 0xAE, 0x24, 0x00, 0x80, 0x02, 0xC0, 0x1E, 0x80, 0x03, 0x01, 0x82, 0x44, 0x9D, 0xE2, 0x42,
+  0x89, 0xFA, 0xF9, 0xFA, 0xFB, 0xFC, 0xFC, 0xFB, 0xFA, 0xF9, 0xFB, 0x41, 0x82, 0xFE, 0xC0, 0x65, 0x01, 0x80, 0x02, 0xC0, 0x1F, 0x81, 0x02, 0x06,
+  0x01, 0x83, 0x38, 0x73, 0xAE, 0xE2, 0x49, 0x83, 0xD6, 0xA1, 0x5B, 0x16, 0x00, 0x81, 0x03, 0x03, 0xC0, 0x21, 0x81, 0x04, 0x03, 0x01, 0x8D, 0x0F,
+  0x2F, 0x4A, 0x64, 0x84, 0x9E, 0xB6, 0xB3, 0xAA, 0x85, 0x70, 0x45, 0x28, 0x07, 0x01, 0x81, 0x04, 0x01, 0xC0, 0x22, 0x82, 0x01, 0x03, 0x04, 0x04,
+  0x83, 0x08, 0x11, 0x10, 0x0D, 0x04, 0x81, 0x04, 0x02, 0xC0, 0x25, 0x83, 0x01, 0x03, 0x04, 0x02, 0x05, 0x83, 0x01, 0x03, 0x02, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_SPONGE_EMOJI_64_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1080,
+  0x2921, 0x49E2, 0x49E2, 0x41C2, 0x2101, 0x0840, 0x0000, 0x0000, 0x0860, 0x5A63, 0x9BE5, 0xCD27, 0xDD87, 0xE5C8, 0xEDE8, 0xEDE8,
+  0xEDE8, 0xDD87, 0xD567, 0xC4E7, 0x7B24, 0x2921, 0x0000, 0x2921, 0xA405, 0xE5C8, 0xF608, 0xFE89, 0xFEAA, 0xFEAA, 0xFE8A, 0xFE69,
+  0xFE08, 0xFE28, 0xFE89, 0xFEAA, 0xFEAA, 0xFE69, 0xEDE8, 0xC4E7, 0x49E2, 0x0000, 0x0000, 0x18C1, 0x93C5, 0xFE89, 0xFE69, 0xFE89,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE89, 0xFE89, 0xFE89, 0xBCC6,
+  0x2921, 0x0000, 0x0000, 0x0000, 0x0000, 0x5223, 0xE5C8, 0xFEAA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD87,
+  0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE89, 0xEDE8, 0x5A43, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0860, 0x8344, 0xFE89, 0xFE89, 0xFE49, 0xFE08, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0x6283, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0860, 0x93A5, 0xFE89, 0xF628, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFDA7, 0xFD46, 0xFD66,
+  0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0x6AA3, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x8B85, 0xFE89, 0xF628, 0xFE49, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDA7,
+  0xFD66, 0xFD66, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFDE8, 0xFD87, 0xFDA7, 0xFE28, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0x8344, 0x0000,
+  0x0000, 0x0000, 0x6283, 0xFEAA, 0xF628, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE49, 0xFE28, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFEAA, 0x93A5, 0x0000, 0x20E1, 0xEDC8, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE49,
+  0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xAC46, 0x1080, 0x0000, 0x7B24, 0xFECA, 0xF608, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD87,
+  0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xD547, 0x41C2, 0x0000, 0x0000, 0x0000, 0x1080, 0xE5C8,
+  0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFD86, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE29, 0xFDA7, 0xFD66, 0xFDE7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE49,
+  0xFE69, 0xFE89, 0xFE69, 0xAC66, 0x2921, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3141, 0xFEAA, 0xFE49, 0xFDC7, 0xFD46,
+  0xFD66, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46,
+  0xFD66, 0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD86, 0xFD46, 0xFDA7, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29,
+  0xFE69, 0xFE89, 0xAC46, 0x41C2, 0x18C1, 0x0860, 0x0000, 0x0020, 0x0000, 0x0000, 0x6283, 0xFE8A, 0xFE49, 0xFD87, 0xFD46, 0xFD66,
+  0xFD66, 0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD45, 0xFD46,
+  0xFD46, 0xFE29, 0xFE69, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD87,
+  0xFE49, 0xFE8A, 0xFECA, 0xE5C8, 0xA425, 0x6284, 0x3982, 0x20E1, 0x0860, 0x0020, 0x0020, 0x0000, 0x8B85, 0xFE89, 0xFE49, 0xFD87,
+  0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE29,
+  0xFDC7, 0xFDA7, 0xFDE8, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFE29, 0xFE69, 0xFE08, 0xFD46,
+  0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xF628, 0xFE69, 0xFEA9, 0xFF0A, 0xFE69, 0xD567, 0xAC46, 0x8364, 0x6283, 0x3982, 0x0860, 0x0000,
+  0x0020, 0x0000, 0x8364, 0xFE69, 0xFE69, 0xFDE8, 0xFD46, 0xFD46, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDC7,
+  0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xF628, 0xFE69, 0xFE89,
+  0xFEAA, 0xFEEA, 0xFECA, 0xE5A8, 0xB486, 0x8B85, 0x49E2, 0x0000, 0x0000, 0x0000, 0x8B23, 0xFE89, 0xFE69, 0xFE69, 0xFE08, 0xFDE8,
+  0xFDE8, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE28, 0xFD66, 0xFD46, 0xFD66, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD46, 0xFD46, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE49, 0xFE08, 0xFDC7, 0xFE08,
+  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDC7, 0xFDC8, 0xFE49, 0xF628, 0xF608, 0xF628, 0xFE69, 0xFECA, 0xFECA, 0xEDC8, 0xBCE6,
+  0x72E4, 0x0020, 0x0000, 0x0000, 0x8B02, 0xFE89, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8,
+  0xFD45, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE49,
+  0xFE08, 0xFDE8, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFDC7, 0xFD46, 0xFD46,
+  0xFD46, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xF628, 0xF628, 0xFE69, 0xFECA, 0xFE69, 0xD567, 0x6AC3, 0x82A1, 0xFE69, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD86, 0xFD46, 0xFD86, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE29, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE08, 0xFD86,
+  0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFEAA, 0xFE69, 0xC4E7, 0x3982, 0x0000, 0x0000, 0x8260, 0xFDA6, 0xFE6A, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE28, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46, 0xFD66,
+  0xFD66, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE49, 0xFD66, 0xFD66, 0xFD46, 0xFDC7, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xEDC8, 0x6283, 0x0000, 0x0000, 0x0000, 0x8260, 0xFCC2, 0xFE28, 0xFE6A, 0xFE69, 0xFE49, 0xFE29,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFDE8, 0xFD46, 0xFD66, 0xFD66,
+  0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE49, 0xFD66, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE8A, 0x7B24, 0x0000, 0x0000, 0x0000, 0x8260, 0xFC81, 0xF4E3, 0xFE08, 0xFE69, 0xFDC7, 0xFD46,
+  0xFD86, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE8A, 0xFE28, 0xFD66, 0xFD46, 0xFD46,
+  0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE29, 0xFDA7, 0xFD87, 0xFD87, 0xFE28, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFD87, 0xFDA7, 0xFE28, 0xFE69, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0x5203, 0x0000, 0x0000, 0x8260, 0xFC81, 0xF461, 0xF4C2, 0xFD86, 0xFD66, 0xFD66,
+  0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFDC7, 0xFE28, 0xFE69, 0xFE08, 0xFDA7, 0xFDA7,
+  0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xF648, 0xDDA7, 0x18C1, 0x8260, 0xFC81, 0xF481, 0xF461, 0xF461, 0xF4C2, 0xFD04, 0xFD66,
+  0xFE08, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFD87, 0xFD46, 0xFD46, 0xFDA7, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFDA7, 0xFDC7, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xF608, 0xFEEA, 0x8344, 0x0020, 0x8260, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF461, 0xF481, 0xF4C2,
+  0xFD65, 0xFE08, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD86, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
+  0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD86, 0xFDC7, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE29, 0xFD66, 0xFD46, 0xFD46, 0xFD46, 0xFDA7,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE29, 0xFDA7, 0xFD87, 0xFDE8, 0xFE49, 0xEE08, 0x0860, 0x8260, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461,
+  0xF481, 0xF4A2, 0xFD03, 0xFDC6, 0xFE49, 0xFE6A, 0xFE69, 0xFE08, 0xFD66, 0xFD66, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46,
+  0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69,
+  0xFE49, 0xFDC7, 0xFD46, 0xFD46, 0xFD66, 0xFE28, 0xFEAA, 0x41C2, 0x7A60, 0xFC81, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF461, 0xF461, 0xF481, 0xF4A2, 0xFD65, 0xFE28, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFE28, 0xFE69, 0xFE49, 0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFD87, 0xFE29, 0xFE69, 0xFE69,
+  0xFE69, 0xFDC7, 0xFD46, 0xFD66, 0xFD66, 0xFE29, 0xFE8A, 0x7B24, 0x5180, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF461, 0xF481, 0xFD24, 0xFE08, 0xFE69, 0xFE6A, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFDC7, 0xFD66, 0xFDE7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFDA7,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69,
+  0xFE69, 0xFE49, 0xFDA7, 0xFD66, 0xFDE8, 0xFE49, 0xFE89, 0x8B85, 0x30E0, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xFD24, 0xFE28, 0xFE6A, 0xFE69, 0xFE29, 0xFE29, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE28, 0xFDA7, 0xFD87, 0xFDC7, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46, 0xFD46, 0xFD46, 0xFE08, 0xFE69, 0xFE69,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0x8B85, 0x0840, 0xE400, 0xEC40, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDE7, 0xFDE8, 0xFD66, 0xFD46, 0xFD87,
+  0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFDA7, 0xFDE8, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE49, 0xFE89, 0x8B64, 0x0020, 0x7A40, 0xFCE1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD24, 0xFD66, 0xFD66, 0xFD46,
+  0xFD87, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE08, 0xFD46, 0xFD46, 0xFD46, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE69, 0xFE69, 0xFE28,
+  0xFDE8, 0xFE08, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE89, 0x8B02, 0x0840, 0xB320, 0xFCC1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD24, 0xFD66, 0xFD66, 0xFD66,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDC8, 0xFD87, 0xFDA7, 0xFE29, 0xFE69, 0xFE49, 0xFE69, 0xFE69,
+  0xFE69, 0xFE08, 0xFD46, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFDE8, 0xFD66, 0xFD46,
+  0xFD66, 0xFDC7, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0x82C2, 0x0000, 0x1060, 0xAB00, 0xFCC1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD04, 0xFD46, 0xFD86, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD46, 0xFD46, 0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE49, 0xFDA7, 0xFD66, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD66, 0xFD46, 0xFD66, 0xFD46,
+  0xFD66, 0xFE08, 0xFE69, 0xFE69, 0xFE08, 0x8281, 0x0000, 0x0840, 0x69E0, 0xE420, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFE28, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
+  0xFE29, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE08, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDE8,
+  0xFE69, 0xFE6A, 0xFD85, 0x8280, 0x0000, 0x1880, 0x7A40, 0xDBE0, 0xF481, 0xFC81, 0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFDE8, 0xFD87, 0xFDC7, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD86, 0xFD46, 0xFD46, 0xFD46, 0xFD66, 0xFE28, 0xFE69, 0xFE6A, 0xFCE3, 0x8260,
+  0x0000, 0x0840, 0x59A0, 0xBB60, 0xE420, 0xFC81, 0xFCA1, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF461, 0xF4A2, 0xFE08, 0xFE6A, 0xFE49, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFDE8, 0xFD66, 0xFD66, 0xFD66, 0xFDE8, 0xFE69, 0xFE6A, 0xFDC7, 0xFCA1, 0x8260, 0x0000, 0x30E0, 0x92C0, 0xCBC0, 0xEC40, 0xFCC1,
+  0xFC81, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4E3, 0xFE49, 0xFE6A, 0xFE08, 0xFD86, 0xFD66,
+  0xFDC7, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFDA7, 0xFDC8, 0xFE49, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE29, 0xFE49, 0xFE69, 0xFE49, 0xFE69, 0xF503, 0xFC81,
+  0x8280, 0x0000, 0x0000, 0x0840, 0x61C0, 0xA300, 0xE420, 0xFCC1, 0xF481, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF461, 0xFCE3, 0xFE49, 0xFDE8, 0xFD46, 0xFD66, 0xFD46, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
+  0xFDA7, 0xFD46, 0xFD66, 0xFD46, 0xFD87, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE49, 0xFE6A, 0xFDA6, 0xF481, 0xFC81, 0x8260, 0x0000, 0x0020, 0x0000, 0x4140, 0x9AE0, 0xE400, 0xFCC1, 0xEC20, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFD03, 0xFDA7, 0xFD46, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE28, 0xF4C2, 0xF461, 0xFCA1, 0x7A60, 0x0000, 0x0020, 0x0000, 0x4140, 0xBB60,
+  0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFD86, 0xFDC8, 0xFE08, 0xFE69, 0xFE69, 0xFE49,
+  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFDC7,
+  0xFD86, 0xFDA7, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFD24, 0xF461, 0xF481, 0xFC81, 0x8280, 0x0000, 0x0000, 0x0000,
+  0x1060, 0x8260, 0xFC81, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF4A2, 0xFDC7, 0xFE8A, 0xFE69, 0xFE69,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFD87, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFE49, 0xFE69, 0xFE69, 0xFE29,
+  0xFD46, 0xFD66, 0xFD46, 0xFDE8, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFD44, 0xF481, 0xF481, 0xF481, 0xFCA1, 0x61C0, 0x0000, 0x0000,
+  0x0020, 0x7200, 0xEC40, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFD45, 0xFE49, 0xFDE8, 0xFDA7,
+  0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFDC7, 0xFD87, 0xFDA7, 0xFE29, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFD46,
+  0xFD66, 0xFD46, 0xFE08, 0xFE69, 0xFE69, 0xFE49, 0xFD44, 0xF461, 0xF481, 0xF481, 0xF481, 0xFCA1, 0x30E0, 0x0000, 0x0000, 0x7A60,
+  0xFC81, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF461, 0xF4C2, 0xFD25, 0xFD66, 0xFD46, 0xFD87, 0xFE29,
+  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFDE8, 0xFD87, 0xFDE8, 0xFE69,
+  0xFE69, 0xFE08, 0xFCE3, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0x1060, 0x0000, 0x0000, 0x8AA0, 0xFCA1, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCE3, 0xFD45, 0xFD25, 0xFE08, 0xFE8A, 0xFE69, 0xFE69, 0xFE49,
+  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE6A, 0xFE69, 0xFE29, 0xFD86, 0xF481, 0xF461, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xFC81, 0xB360, 0x0020, 0x92A0, 0xFCA1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF461, 0xF481, 0xF4A2, 0xFD86, 0xFE08, 0xFE49, 0xFE69, 0xFE8A, 0xFE8A, 0xFE6A, 0xFE6A, 0xFE6A, 0xFE6A, 0xFE8A, 0xFE8A,
+  0xFE69, 0xFE28, 0xFE08, 0xFD86, 0xF4A2, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC20, 0xFCC1, 0x7200, 0x0000, 0x0020,
+  0xB360, 0xFCC1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF460, 0xF481, 0xFD03,
+  0xFD65, 0xFDA6, 0xFDC7, 0xFE08, 0xFDE7, 0xFDE7, 0xFE08, 0xFDC7, 0xFDC7, 0xFD65, 0xF4E3, 0xF461, 0xF461, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xEC20, 0xF480, 0x28C0, 0x0840, 0xB340, 0xFCC1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF460, 0xF440, 0xF461, 0xF4A2, 0xF4A2, 0xF4A2, 0xF4A2, 0xF461, 0xF440,
+  0xF461, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC40, 0xFCC1, 0x92A0, 0x0020, 0x0000, 0x0000,
+  0x1060, 0xB320, 0xFCC1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xEC40, 0xEC40, 0x3900, 0x0000, 0x0000, 0x1060, 0xB320, 0xFCC1, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC20, 0xFCC1, 0x8A80, 0x0020, 0x0000, 0x0000, 0x0000, 0x0840, 0xB320,
+  0xFCC1, 0xF461, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC40, 0xFCA1, 0xC3A0, 0x1880,
+  0x0000, 0x0000, 0x0840, 0xAB20, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xFCA1,
+  0xDC00, 0x3900, 0x0000, 0x0000, 0x0000, 0x8AA0, 0xF440, 0xFCA1, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF461, 0xF481, 0xFCA1,
+  0xE420, 0x59A0, 0x0000, 0x5180, 0xD3E0, 0xFCA1, 0xFC81, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xEC40, 0xF481, 0xFCC1, 0xD3C0, 0x4120, 0x0000, 0x0000,
+  0x1060, 0x8AA0, 0xDC00, 0xFCC1, 0xFC81, 0xEC20, 0xEC20, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481, 0xF481,
+  0xF481, 0xF481, 0xF481, 0xEC20, 0xF481, 0xFCC1, 0xEC40, 0xA300, 0x20A0, 0x0000, 0x0000, 0x4120, 0x92C0, 0xD3E0, 0xFCC1, 0xFCC1,
+  0xF481, 0xEC20, 0xEC20, 0xEC20, 0xEC40, 0xF461, 0xF461, 0xEC40, 0xEC20, 0xEC40, 0xEC40, 0xFC81, 0xFCE1, 0xF481, 0xBB60, 0x61C0,
+  0x0000, 0x0000, 0x0000, 0x30E0, 0x69E0, 0xA300, 0xD3C0, 0xFCC1, 0xFCE1, 0xFCC1, 0xFCC1, 0xFCA1, 0xFCA1, 0xFCA1, 0xFCC1, 0xFCE1,
+  0xFCA1, 0xCBC0, 0x9AC0, 0x5180, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x28C0, 0x4140, 0x61C0, 0x7A40, 0x92A0, 0xAB20,
+  0xA300, 0x9AE0, 0x7A40, 0x69E0, 0x4140, 0x20A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0840, 0x0840,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_SPONGE_EMOJI_64_SPANS = {
+  SPRITE_SPONGE_EMOJI_64_SPAN_ROWS, SPRITE_SPONGE_EMOJI_64_SPAN_OPS, SPRITE_SPONGE_EMOJI_64_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_SPONGE_EMOJI_64_ASSET = {
   SPRITE_SPONGE_EMOJI_64_WIDTH, SPRITE_SPONGE_EMOJI_64_HEIGHT,
-  SPRITE_SPONGE_EMOJI_64_ALPHA, SPRITE_SPONGE_EMOJI_64_RGB565
+  nullptr, nullptr, &SPRITE_SPONGE_EMOJI_64_SPANS
 };
 
 #endif // SPRITE_SPONGE_EMOJI_64_INCLUDED
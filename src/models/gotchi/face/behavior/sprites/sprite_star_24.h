@@ -5,70 +5,74 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from star_24.png (24x24)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from star_24.png (24x24) — RGBA multi-couleur, encodé en spans
+// 349/576 pixels visibles, 1253 bytes flash (flat : 1728). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_STAR_24_WIDTH = 24;
 constexpr uint16_t SPRITE_STAR_24_HEIGHT = 24;
 
-const uint16_t SPRITE_STAR_24_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xFCE3, 0xFD66, 0xFD66, 0xFCE3, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFD46, 0xFDE7, 0xFDE7, 0xFD46, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0xFD66, 0xFDA6, 0xFDA6, 0xFD66, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFDE7, 0xF800, 0xFD66, 0xFDA6, 0xFD46, 0xFD46, 0xFDA6, 0xFD66, 0xF800, 0xFDE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFD4A, 0xFDE7, 0xFBE7, 0xFDE7, 0xFDE7, 0xFBE7, 0xFD45, 0xF800, 0xFD66, 0xFDA6, 0xFD66, 0xFD66, 0xFDA6, 0xFD46, 0x0000, 0xFD45, 0xFBE7, 0xFDE7, 0xFDE7, 0xFBE7, 0xFDE7, 0xFD4A, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD65, 0xFD66, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFDC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFD46, 0xFDA6, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD86, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD46, 0xFD66, 0xFDA6, 0xFD46, 0x0000,
-  0xFD66, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86, 0xFD66,
-  0xFD66, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFDA6, 0xFD66,
-  0x0000, 0xFD46, 0xFD86, 0xFDA6, 0xFD46, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD46, 0xFDA6, 0xFD86, 0xFD46, 0x0000,
-  0xFFE0, 0x0000, 0xFD25, 0xFD86, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFDA6, 0xFD86, 0xFD25, 0x0000, 0xFFE0,
-  0x0000, 0xFDE7, 0x0000, 0x0000, 0xFD66, 0xFD86, 0xFD86, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD86, 0xFD86, 0xFD66, 0x0000, 0x0000, 0xFDE7, 0x0000,
-  0x0000, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0xFD66, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFD66, 0x0000, 0xFBE0, 0xFBE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFD45, 0x0000, 0xFD66, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFDA6, 0xFD66, 0x0000, 0xFD45, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFFE0, 0x0000, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD46, 0xFD66, 0x0000, 0xFFE0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0xFD46, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDA6, 0xFD46, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFDE7, 0x0000, 0xFD66, 0xFDA6, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0xFD66, 0x0000, 0xFDE7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFE0, 0x0000, 0xFD47, 0xFD46, 0xFD86, 0xFD66, 0xFD46, 0xFDA6, 0xFD86, 0xFD66, 0xFD66, 0xFD86, 0xFDA6, 0xFD46, 0xFD66, 0xFD86, 0xFD46, 0xFDE7, 0x0000, 0xFFE0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFD4A, 0x0000, 0xFD46, 0xFD86, 0xFD46, 0xFD66, 0xFDC6, 0xFD86, 0xFD26, 0x0000, 0x0000, 0xFD66, 0xFD86, 0xFDC6, 0xFD66, 0xFD46, 0xFD86, 0xFD66, 0x0000, 0xFD4A, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFDE7, 0x0000, 0xFD46, 0xFDC6, 0xFD86, 0xFD86, 0xFD66, 0xFCC6, 0x0000, 0xFDE7, 0xFDE7, 0x0000, 0xFCC6, 0xFD66, 0xFD86, 0xFD86, 0xFDC6, 0xFD46, 0x0000, 0xFDE7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFD4A, 0x0000, 0xFD66, 0xFD86, 0xFD66, 0xFD46, 0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xFBE0, 0x0000, 0x0000, 0xFD46, 0xFD66, 0xFD86, 0xFD66, 0x0000, 0xFD4A, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFD26, 0xFCC6, 0x0000, 0xFD4A, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xFD4A, 0x0000, 0xFD06, 0xFD25, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_STAR_24_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 12, 8, 25, 14, 38, 20, 53, 28, 68, 38, 96, 59,
+  109, 67, 136, 89, 145, 113, 169, 137, 186, 159, 206, 181, 227, 199, 248, 217,
+  267, 231, 288, 247, 313, 263, 336, 279, 365, 297, 392, 313, 417, 329, 442, 341
 };
 
-const uint8_t SPRITE_STAR_24_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x08, 0x86, 0x86, 0x08, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x5E, 0xFF, 0xFF, 0x5E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xB3, 0xFC, 0xFC, 0xB3, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0xF2, 0xFF, 0xFF, 0xEF, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x61, 0xFF, 0xFB, 0xFC, 0xFF, 0x59, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x01, 0xB3, 0xFF, 0xFC, 0xFB, 0xFF, 0xAC, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF2, 0xFF, 0xFE, 0xFE, 0xFF, 0xEF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3E, 0x55, 0x54, 0x55, 0x55, 0x57, 0x55, 0x8E, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0x89, 0x55, 0x57, 0x55, 0x55, 0x54, 0x55, 0x3E, 0x00,
-  0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x49,
-  0x4A, 0xFF, 0xFE, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xFE, 0xFF, 0x48,
-  0x00, 0x56, 0xEB, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xEB, 0x56, 0x00,
-  0x01, 0x00, 0x20, 0xB5, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB5, 0x20, 0x00, 0x01,
-  0x00, 0x04, 0x00, 0x00, 0x73, 0xF7, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF7, 0x73, 0x00, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x02, 0x02, 0x00, 0x35, 0xD0, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xD0, 0x35, 0x00, 0x02, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xA3, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xA3, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0xED, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xED, 0x13, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x4F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0x4F, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x9A, 0xFE, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFB, 0xFE, 0x9A, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x09, 0xE0, 0xFF, 0xFD, 0xFB, 0xFF, 0xF0, 0x5D, 0x5D, 0xF0, 0xFF, 0xFB, 0xFD, 0xFF, 0xE0, 0x08, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x3D, 0xFE, 0xFB, 0xFD, 0xFF, 0xC4, 0x2B, 0x00, 0x00, 0x29, 0xC4, 0xFF, 0xFD, 0xFB, 0xFE, 0x3E, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x8A, 0xFF, 0xFF, 0xFF, 0x87, 0x05, 0x00, 0x04, 0x04, 0x00, 0x05, 0x87, 0xFF, 0xFF, 0xFF, 0x89, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x50, 0xF3, 0xD8, 0x46, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x46, 0xD7, 0xF1, 0x4E, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0F, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_STAR_24_SPAN_OPS[] PROGMEM = {
+  0xC0, 0x07, 0x87, 0x01, 0x01, 0x08, 0x86, 0x86, 0x08, 0x01, 0x01, 0xC0, 0x07, 0x80, 0x04, 0x00, 0x80, 0x5E, 0x41, 0x80, 0x5E, 0x00, 0x80, 0x04,
+  0xC0, 0x07, 0x80, 0x02, 0x00, 0x83, 0xB3, 0xFC, 0xFC, 0xB3, 0x00, 0x80, 0x02, 0xC0, 0x06, 0x80, 0x01, 0x00, 0x81, 0x19, 0xF2, 0x41, 0x81, 0xEF,
+  0x15, 0x00, 0x80, 0x01, 0xC0, 0x06, 0x82, 0x04, 0x01, 0x61, 0x40, 0x81, 0xFB, 0xFC, 0x40, 0x82, 0x59, 0x01, 0x04, 0xC0, 0x00, 0x88, 0x03, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x06, 0x01, 0xB3, 0x40, 0x81, 0xFC, 0xFB, 0x40, 0x80, 0xAC, 0x00, 0x86, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0xC0,
+  0x07, 0x81, 0x10, 0xF2, 0x40, 0x81, 0xFE, 0xFE, 0x40, 0x81, 0xEF, 0x0B, 0xC0, 0x00, 0x87, 0x3E, 0x55, 0x54, 0x55, 0x55, 0x57, 0x55, 0x8E, 0x40,
+  0x80, 0xFD, 0x41, 0x80, 0xFD, 0x40, 0x87, 0x89, 0x55, 0x57, 0x55, 0x55, 0x54, 0x55, 0x3E, 0xC0, 0x80, 0x4A, 0x4C, 0x80, 0xFE, 0x47, 0x80, 0x49,
+  0xC0, 0x80, 0x4A, 0x40, 0x86, 0xFE, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0x45, 0x86, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xF8, 0xFE, 0x40, 0x80, 0x48,
+  0xC0, 0x00, 0x81, 0x56, 0xEB, 0x40, 0x81, 0xFB, 0xFE, 0x4B, 0x81, 0xFE, 0xFB, 0x40, 0x81, 0xEB, 0x56, 0xC0, 0x80, 0x01, 0x00, 0x81, 0x20, 0xB5,
+  0x41, 0x80, 0xFD, 0x49, 0x80, 0xFD, 0x41, 0x81, 0xB5, 0x20, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x04, 0x01, 0x81, 0x73, 0xF7, 0x40, 0x80, 0xFE,
+  0x47, 0x80, 0xFE, 0x40, 0x81, 0xF7, 0x73, 0x01, 0x80, 0x04, 0xC0, 0x01, 0x81, 0x02, 0x02, 0x00, 0x83, 0x35, 0xD0, 0xFE, 0xFD, 0x45, 0x83, 0xFD,
+  0xFE, 0xD0, 0x35, 0x00, 0x81, 0x02, 0x02, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x80, 0xA3, 0x40, 0x80, 0xFB, 0x45, 0x80, 0xFB, 0x40, 0x80, 0xA3, 0x00,
+  0x80, 0x06, 0xC0, 0x02, 0x80, 0x01, 0x00, 0x81, 0x13, 0xED, 0x40, 0x80, 0xFE, 0x45, 0x80, 0xFE, 0x40, 0x81, 0xED, 0x13, 0x00, 0x80, 0x01, 0xC0,
+  0x02, 0x80, 0x03, 0x00, 0x80, 0x4F, 0x40, 0x80, 0xFC, 0x41, 0x83, 0xFE, 0xFD, 0xFD, 0xFE, 0x41, 0x80, 0xFC, 0x40, 0x80, 0x4F, 0x00, 0x80, 0x03,
+  0xC0, 0x02, 0x80, 0x04, 0x00, 0x82, 0x9A, 0xFE, 0xFB, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFC, 0x40, 0x82, 0xFB, 0xFE, 0x9A, 0x00, 0x80, 0x04, 0xC0,
+  0x01, 0x80, 0x01, 0x00, 0x81, 0x09, 0xE0, 0x40, 0x81, 0xFD, 0xFB, 0x40, 0x83, 0xF0, 0x5D, 0x5D, 0xF0, 0x40, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xE0,
+  0x08, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x83, 0x3D, 0xFE, 0xFB, 0xFD, 0x40, 0x81, 0xC4, 0x2B, 0x01, 0x81, 0x29, 0xC4, 0x40, 0x83,
+  0xFD, 0xFB, 0xFE, 0x3E, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x04, 0x00, 0x80, 0x8A, 0x42, 0x81, 0x87, 0x05, 0x00, 0x81, 0x04, 0x04, 0x00, 0x81,
+  0x05, 0x87, 0x42, 0x80, 0x89, 0x00, 0x80, 0x04, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x83, 0x50, 0xF3, 0xD8, 0x46, 0x01, 0x80, 0x02, 0x01, 0x80, 0x02,
+  0x01, 0x83, 0x46, 0xD7, 0xF1, 0x4E, 0x00, 0x80, 0x03, 0xC0, 0x04, 0x81, 0x22, 0x0F, 0x00, 0x81, 0x03, 0x01, 0x03, 0x81, 0x01, 0x03, 0x00, 0x81,
+  0x0E, 0x20, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_STAR_24_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0020, 0x82C3, 0x82C3, 0x0020, 0x0000, 0x0000, 0x0020, 0x59E2, 0xFDE7, 0xFDE7, 0x59E2, 0x0020, 0x0000, 0xABA4,
+  0xFDA6, 0xFDA6, 0xABA4, 0x0000, 0x0000, 0x1080, 0xECE5, 0xFD66, 0xFD66, 0xED05, 0x1060, 0x0000, 0x0020, 0x0000, 0x5A02, 0xFDA6,
+  0xF505, 0xFD46, 0xFDA6, 0x51C2, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0xABA4, 0xFDA6,
+  0xFD66, 0xF525, 0xFDA6, 0xAB84, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0840, 0xED05, 0xFD66, 0xFD46, 0xFD46,
+  0xFD66, 0xED05, 0x0020, 0x3941, 0x51E2, 0x51C2, 0x51C2, 0x51C2, 0x51C2, 0x51C2, 0x8B03, 0xFD86, 0xFD46, 0xFD66, 0xFD66, 0xFD66,
+  0xFD86, 0x82C3, 0x51C2, 0x51C2, 0x51C2, 0x51C2, 0x51C2, 0x51E2, 0x3941, 0x4181, 0xFD86, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6,
+  0xFDA6, 0xFDA6, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFDA6, 0xFD86,
+  0x4181, 0x4181, 0xFDA6, 0xFD66, 0xF505, 0xF525, 0xF505, 0xF525, 0xF505, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xF505, 0xF525, 0xF505, 0xF525, 0xF505, 0xFD66, 0xFDA6, 0x4181, 0x51C2, 0xE4E5, 0xFDA6, 0xF505, 0xFD46, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xF505, 0xFDA6, 0xE4E5, 0x51C2, 0x0000,
+  0x18A0, 0xB3E4, 0xFDA6, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD46,
+  0xFD66, 0xFDA6, 0xB3E4, 0x18A0, 0x0000, 0x0020, 0x6A42, 0xF545, 0xFD86, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD46, 0xFD86, 0xF545, 0x6A42, 0x0020, 0x0000, 0x0000, 0x3121, 0xCC64, 0xFD86, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xCC64, 0x3121, 0x0000, 0x0000, 0x0020, 0x9B43, 0xFDA6, 0xF525, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD66, 0xF525, 0xFDA6, 0x9B43, 0x0020, 0x0000, 0x0840, 0xECE5, 0xFD66, 0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFD66,
+  0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xECE5, 0x0840, 0x0000, 0x0000, 0x49A1, 0xFDA6, 0xFD66, 0xFD66, 0xFD66, 0xFD46, 0xFD66, 0xFD66,
+  0xFD46, 0xFD66, 0xFD66, 0xFD66, 0xFDA6, 0x49A1, 0x0000, 0x0020, 0x9323, 0xFDA6, 0xF505, 0xFD66, 0xFD66, 0xFD66, 0xFD86, 0xFD86,
+  0xFD66, 0xFD66, 0xFD66, 0xF505, 0xFDA6, 0x9323, 0x0020, 0x0000, 0x0020, 0xDC85, 0xFD86, 0xFD66, 0xF505, 0xFDA6, 0xED25, 0x5A02,
+  0x5A02, 0xED25, 0xFDA6, 0xF505, 0xFD66, 0xFD86, 0xDC85, 0x0020, 0x0000, 0x0000, 0x3941, 0xFD86, 0xF505, 0xFD66, 0xFDC6, 0xC444,
+  0x20C0, 0x20C0, 0xC444, 0xFDC6, 0xFD66, 0xF505, 0xFD86, 0x3941, 0x0000, 0x0020, 0x82C3, 0xFDC6, 0xFD86, 0xFD86, 0x82C3, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x82C3, 0xFD86, 0xFD86, 0xFDC6, 0x82C3, 0x0020, 0x0000, 0x49A1, 0xED25, 0xD485, 0x4161, 0x0000, 0x0000,
+  0x4161, 0xD485, 0xED25, 0x49A1, 0x0000, 0x18A0, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x18A0
+};
+
+inline constexpr SpriteSpans SPRITE_STAR_24_SPANS = {
+  SPRITE_STAR_24_SPAN_ROWS, SPRITE_STAR_24_SPAN_OPS, SPRITE_STAR_24_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_STAR_24_ASSET = {
   SPRITE_STAR_24_WIDTH, SPRITE_STAR_24_HEIGHT,
-  SPRITE_STAR_24_ALPHA, SPRITE_STAR_24_RGB565
+  nullptr, nullptr, &SPRITE_STAR_24_SPANS
 };
 
 #endif // SPRITE_STAR_24_INCLUDED
@@ -5,66 +5,72 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from strawberry_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from strawberry_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 372/484 pixels visibles, 1211 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_STRAWBERRY_22_WIDTH = 22;
 constexpr uint16_t SPRITE_STRAWBERRY_22_HEIGHT = 22;
 
-const uint16_t SPRITE_STRAWBERRY_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x7BE7, 0x7DAB, 0x7DAA, 0x7DAA, 0x758A, 0x7D8A, 0x7DAA, 0x7DAA, 0x7D8A, 0x7D8A, 0x7D4A, 0x0000, 0xAAAA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7BE0, 0x750B, 0x7DAA, 0x7D8A, 0x7DCB, 0x7DEB, 0x7D8A, 0x7D8A, 0x7DCB, 0x7DAA, 0x7E0B, 0x75EA, 0x760B, 0x66AB, 0x0000, 0x79E7, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xFFE0, 0x07E0, 0x8529, 0x7DCA, 0x7DAA, 0x758A, 0x756A, 0x75AA, 0x75CA, 0x758A, 0x758A, 0x93A8, 0x9388, 0x9469, 0x9409, 0x9AC8, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7BEF, 0x7800, 0x47EC, 0x7D6A, 0x7D6A, 0x75AA, 0x75EB, 0x7D0A, 0x8BE9, 0x7D4A, 0x760B, 0x8C09, 0xC065, 0xC065, 0xC085, 0xC0C6, 0xC0C6, 0x0000, 0xF800, 0xF800, 0x0000,
-  0x0000, 0xAAAA, 0x0000, 0xA9E7, 0xB308, 0x75AA, 0x7D4A, 0x93C9, 0xB166, 0xC065, 0xB146, 0xA247, 0xA267, 0xB8E6, 0xB8C6, 0xB8C6, 0xC0C6, 0xC8E6, 0xB8C6, 0xF800, 0xF80F, 0xF800,
-  0xA80A, 0x0000, 0xB8C6, 0xC886, 0xB926, 0xAA27, 0xB926, 0xC045, 0xB865, 0xB8E6, 0xC0A6, 0xC085, 0xC065, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB885, 0xC8C6, 0xB8C6, 0x0000, 0xF80A,
-  0x7800, 0x0000, 0xB8C6, 0xC8E6, 0xB8A6, 0xC086, 0xB865, 0xD2CD, 0xD28C, 0xB885, 0xB8E6, 0xB8C6, 0xB8C6, 0xD28C, 0xC107, 0xB8A5, 0xB8C6, 0xDB0E, 0xC968, 0xB885, 0xC127, 0x0000,
-  0x0000, 0xB886, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8E6, 0xB885, 0xF516, 0xDB70, 0xB864, 0xB8E6, 0xB8A6, 0xC0E6, 0xEC73, 0xC127, 0xB885, 0xC989, 0xFDD9, 0xC9C9, 0xC085, 0xC106, 0x0000,
-  0x0000, 0xB8C6, 0xC0C6, 0xB8C6, 0xB885, 0xB8A5, 0xB8C5, 0xCA2B, 0xC148, 0xB865, 0xB8C6, 0xB8C6, 0xB8C6, 0xC989, 0xB8C6, 0xB8A5, 0xC127, 0xD28C, 0xB8C6, 0xC0C6, 0xB8E5, 0x0000,
-  0x0000, 0xB8C6, 0xC0C6, 0xB8A5, 0xDB4F, 0xC9CA, 0xB885, 0xB885, 0xB8C6, 0xC9C9, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864, 0xC0C6, 0xB8C6, 0xC0E7, 0x0000,
-  0x0000, 0xB0C6, 0xB8C6, 0xB865, 0xE3B1, 0xEC53, 0xB885, 0xB8C6, 0xC107, 0xF556, 0xCA0A, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xC107, 0xC127, 0xC8C6, 0xB8C6, 0x0000, 0xB807,
-  0xA80A, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xC188, 0xB8C6, 0xB8C6, 0xB8A5, 0xDB70, 0xCA0A, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xECD5, 0xE390, 0xB864, 0xC188, 0x0000, 0x7800,
-  0x7800, 0xF800, 0xC0A5, 0xC0C6, 0xC0C6, 0xB8A5, 0xB8C6, 0xB8A5, 0xB885, 0xB8A5, 0xB8C6, 0xB8A6, 0xC107, 0xC106, 0xB8A5, 0xB8C6, 0xE412, 0xDA4B, 0xB844, 0x0000, 0xF80A, 0x0000,
-  0x0000, 0xA800, 0x0000, 0xB8A5, 0xC0C6, 0xC0E6, 0xB885, 0xD2CD, 0xDAEE, 0xB8A5, 0xB8E6, 0xB885, 0xE3F2, 0xEC74, 0xB8A5, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8E6, 0xF800, 0xF800, 0x0000,
-  0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8E6, 0xB8A5, 0xC9A9, 0xEC74, 0xC148, 0xB8A5, 0xB885, 0xDB2F, 0xE432, 0xB8A5, 0xB8A5, 0xC8C6, 0xB8C6, 0x0000, 0x7800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xB807, 0x0000, 0xB8C6, 0xC8E6, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8C6, 0xB885, 0xDB90, 0xDA0B, 0xB844, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xF800, 0xA80A, 0xB8E7, 0xB8C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xC107, 0xF536, 0xD1CA, 0xB864, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0x0000, 0xB8A5, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xEC53, 0xD2AD, 0xB885, 0xC0E6, 0xC188, 0xC8C6, 0xB8C6, 0x0000, 0xB807, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF80A, 0x0000, 0xB8C6, 0xC8C6, 0xB8C6, 0xB8A5, 0xE433, 0xE3B1, 0xB885, 0xB8C6, 0xB8A5, 0xC0C6, 0xB8A5, 0x0000, 0xF800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80F, 0xD929, 0xB8C6, 0xC8E6, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xD0E6, 0xB8C6, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xB906, 0xC0C6, 0xC8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC806, 0x7800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_STRAWBERRY_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 20, 13, 36, 29, 59, 47, 79, 66, 98, 86, 117, 106, 132, 126,
+  145, 146, 157, 166, 170, 186, 186, 206, 203, 227, 221, 247, 240, 266, 259, 282,
+  277, 298, 295, 314, 314, 328, 334, 341, 353, 354, 368, 366
 };
 
-const uint8_t SPRITE_STRAWBERRY_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x01, 0x00, 0x04, 0x4B, 0x69, 0x6A, 0x41, 0x4C, 0xB5, 0xDD, 0xC4, 0x88, 0x3B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x0B, 0x63, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x9F, 0x3E, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x01, 0x1D, 0xA7, 0xF9, 0xFB, 0xFC, 0xFF, 0xFF, 0xFD, 0xFE, 0xFD, 0xFF, 0xFF, 0xFD, 0x36, 0x00, 0x02, 0x01, 0x00, 0x00,
-  0x00, 0x02, 0x02, 0x19, 0xD6, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFD, 0xEF, 0x79, 0x00, 0x01, 0x01, 0x00,
-  0x00, 0x03, 0x00, 0x81, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xA2, 0x01, 0x02, 0x01,
-  0x03, 0x00, 0x41, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0x70, 0x00, 0x03,
-  0x02, 0x00, 0xC2, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xE6, 0x0D, 0x00,
-  0x00, 0x1A, 0xF5, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x2E, 0x00,
-  0x00, 0x31, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x2B, 0x00,
-  0x00, 0x34, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE0, 0x09, 0x00,
-  0x00, 0x15, 0xF1, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x86, 0x00, 0x04,
-  0x03, 0x00, 0x99, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF0, 0x1A, 0x01, 0x02,
-  0x02, 0x01, 0x16, 0xE6, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x8A, 0x00, 0x03, 0x00,
-  0x00, 0x03, 0x00, 0x42, 0xFE, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF6, 0x22, 0x01, 0x02, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x6C, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xBE, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x96, 0x01, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x08, 0xD2, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x8F, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x71, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x97, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0x2C, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0xC1, 0xFF, 0xFB, 0xFE, 0xFE, 0xFD, 0xFF, 0xFF, 0x9A, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x8B, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x74, 0xD9, 0xEA, 0x99, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_STRAWBERRY_22_SPAN_OPS[] PROGMEM = {
+  0x01, 0x80, 0x01, 0x00, 0x8A, 0x04, 0x4B, 0x69, 0x6A, 0x41, 0x4C, 0xB5, 0xDD, 0xC4, 0x88, 0x3B, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x83, 0x02, 0x0B,
+  0x63, 0xDC, 0x46, 0x82, 0xFA, 0x9F, 0x3E, 0x00, 0x81, 0x04, 0x01, 0xC0, 0x00, 0x86, 0x01, 0x01, 0x1D, 0xA7, 0xF9, 0xFB, 0xFC, 0x41, 0x82, 0xFD,
+  0xFE, 0xFD, 0x41, 0x81, 0xFD, 0x36, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x00, 0x85, 0x02, 0x02, 0x19, 0xD6, 0xFC, 0xFE, 0x45, 0x84, 0xFE, 0xFB, 0xFD,
+  0xEF, 0x79, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x80, 0x81, 0x40, 0x80, 0xFC, 0x48, 0x80, 0xFE, 0x41, 0x83, 0xA2, 0x01, 0x02,
+  0x01, 0xC0, 0x80, 0x03, 0x00, 0x83, 0x41, 0xFB, 0xFC, 0xFE, 0x49, 0x81, 0xFE, 0xFA, 0x40, 0x80, 0x70, 0x00, 0x80, 0x03, 0xC0, 0x80, 0x02, 0x00,
+  0x80, 0xC2, 0x40, 0x80, 0xFC, 0x4B, 0x83, 0xFD, 0xFD, 0xE6, 0x0D, 0xC0, 0x00, 0x83, 0x1A, 0xF5, 0xFE, 0xFE, 0x4C, 0x80, 0xFE, 0x40, 0x80, 0x2E,
+  0xC0, 0x00, 0x80, 0x31, 0x40, 0x80, 0xFE, 0x4D, 0x82, 0xFE, 0xFE, 0x2B, 0xC0, 0x00, 0x80, 0x34, 0x40, 0x80, 0xFE, 0x4C, 0x83, 0xFD, 0xFE, 0xE0,
+  0x09, 0xC0, 0x00, 0x83, 0x15, 0xF1, 0xFE, 0xFE, 0x4B, 0x80, 0xFB, 0x40, 0x80, 0x86, 0x00, 0x80, 0x04, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x99, 0x40,
+  0x80, 0xFB, 0x4A, 0x85, 0xFE, 0xFE, 0xF0, 0x1A, 0x01, 0x02, 0xC0, 0x83, 0x02, 0x01, 0x16, 0xE6, 0x40, 0x80, 0xFD, 0x49, 0x80, 0xFB, 0x40, 0x80,
+  0x8A, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x03, 0x00, 0x83, 0x42, 0xFE, 0xFC, 0xFE, 0x47, 0x80, 0xFE, 0x40, 0x83, 0xF6, 0x22, 0x01, 0x02, 0xC0,
+  0x01, 0x80, 0x04, 0x00, 0x80, 0x6C, 0x40, 0x80, 0xFB, 0x47, 0x80, 0xFC, 0x40, 0x80, 0xBE, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x04, 0x00, 0x80,
+  0x99, 0x40, 0x80, 0xFC, 0x46, 0x80, 0xFB, 0x40, 0x82, 0x96, 0x01, 0x04, 0xC0, 0x02, 0x85, 0x01, 0x03, 0x08, 0xD2, 0xFE, 0xFD, 0x45, 0x80, 0xFB,
+  0x40, 0x80, 0x8F, 0x00, 0x80, 0x04, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x80, 0x40, 0x40, 0x80, 0xFB, 0x45, 0x80, 0xFB, 0x40, 0x80, 0x71, 0x00, 0x80,
+  0x04, 0xC0, 0x04, 0x80, 0x03, 0x00, 0x80, 0x97, 0x40, 0x80, 0xFA, 0x43, 0x81, 0xFE, 0xFB, 0x40, 0x80, 0x2C, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x83,
+  0x01, 0x02, 0x07, 0xC1, 0x40, 0x83, 0xFB, 0xFE, 0xFE, 0xFD, 0x41, 0x80, 0x9A, 0x00, 0x80, 0x02, 0xC0, 0x05, 0x80, 0x01, 0x00, 0x81, 0x0F, 0xB2,
+  0x43, 0x84, 0xF1, 0x8B, 0x05, 0x02, 0x01, 0xC0, 0x06, 0x80, 0x02, 0x01, 0x84, 0x74, 0xD9, 0xEA, 0x99, 0x27, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_STRAWBERRY_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x2183, 0x3244, 0x3244, 0x1962, 0x21A3, 0x5407, 0x6CE8, 0x5C47, 0x3AE5, 0x1922, 0x0000, 0x0000, 0x0020, 0x2A03,
+  0x6CC8, 0x7DCB, 0x7DEB, 0x7D8A, 0x7D8A, 0x7DCB, 0x7DAA, 0x7E0B, 0x6DA9, 0x43C6, 0x19A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A1,
+  0x4BC6, 0x7569, 0x6D49, 0x756A, 0x75AA, 0x75CA, 0x758A, 0x758A, 0x93A8, 0x9388, 0x9469, 0x9409, 0x2081, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00A1, 0x6488, 0x7D6A, 0x75AA, 0x75EB, 0x7D0A, 0x8BE9, 0x7D4A, 0x760B, 0x8C09, 0xC065, 0xB844, 0xC085, 0xB0A5, 0x5842,
+  0x0000, 0x0000, 0x0000, 0x50E3, 0xB308, 0x75AA, 0x7D4A, 0x93C9, 0xB166, 0xC065, 0xB146, 0xA247, 0xA267, 0xB8E6, 0xB8C6, 0xB8C6,
+  0xC0C6, 0xC8E6, 0x7063, 0x0000, 0x0000, 0x0000, 0x0000, 0x2821, 0xC065, 0xB926, 0xAA27, 0xB926, 0xC045, 0xB865, 0xB8E6, 0xC0A6,
+  0xC085, 0xC065, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB064, 0xC8C6, 0x5042, 0x0000, 0x0000, 0x8884, 0xC8E6, 0xB8A6, 0xC086, 0xB865,
+  0xD2CD, 0xD28C, 0xB885, 0xB8E6, 0xB8C6, 0xB8C6, 0xD28C, 0xC107, 0xB8A5, 0xB8C6, 0xDB0E, 0xC968, 0xA064, 0x0800, 0x1000, 0xB0A5,
+  0xB8C6, 0xB8C6, 0xB8E6, 0xB885, 0xF516, 0xDB70, 0xB864, 0xB8E6, 0xB8A6, 0xC0E6, 0xEC73, 0xC127, 0xB885, 0xC989, 0xFDD9, 0xC9C9,
+  0xC085, 0x2021, 0x2021, 0xC0C6, 0xB8C6, 0xB885, 0xB8A5, 0xB8C5, 0xCA2B, 0xC148, 0xB865, 0xB8C6, 0xB8C6, 0xB8C6, 0xC989, 0xB8C6,
+  0xB8A5, 0xC127, 0xD28C, 0xB8C6, 0xC0C6, 0x1820, 0x2821, 0xC0C6, 0xB8A5, 0xDB4F, 0xC9CA, 0xB885, 0xB885, 0xB8C6, 0xC9C9, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864, 0xC0C6, 0xA0A5, 0x0000, 0x1000, 0xA8A5, 0xB865, 0xE3B1, 0xEC53, 0xB885,
+  0xB8C6, 0xC107, 0xF556, 0xCA0A, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xC107, 0xB906, 0xC8C6, 0x6063, 0x0000, 0x0000, 0x6863,
+  0xC8C6, 0xB0A5, 0xC188, 0xB8C6, 0xB8C6, 0xB8A5, 0xDB70, 0xCA0A, 0xB885, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xECD5, 0xE390, 0xA843,
+  0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0xA8A5, 0xC0C6, 0xB8A5, 0xB8C6, 0xB8A5, 0xB885, 0xB8A5, 0xB8C6, 0xB8A6, 0xC107,
+  0xC106, 0xB8A5, 0xB8C6, 0xDBF1, 0xDA4B, 0x6022, 0x0000, 0x0000, 0x2821, 0xC0C6, 0xC0E6, 0xB885, 0xD2CD, 0xDAEE, 0xB8A5, 0xB8E6,
+  0xB885, 0xE3F2, 0xEC74, 0xB8A5, 0xB8C6, 0xB8A5, 0xB084, 0x1000, 0x0000, 0x0000, 0x0000, 0x5042, 0xC8E6, 0xB084, 0xC9A9, 0xEC74,
+  0xC148, 0xB8A5, 0xB885, 0xDB2F, 0xE432, 0xB8A5, 0xB8A5, 0xC8C6, 0x8884, 0x0000, 0x0000, 0x6863, 0xC8E6, 0xB885, 0xB8A5, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8A5, 0xB8C6, 0xB885, 0xD36F, 0xDA0B, 0x6822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9084, 0xC0C6, 0xB8C6,
+  0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xC107, 0xECF5, 0xD1CA, 0x6022, 0x0000, 0x0000, 0x2821, 0xC0C6, 0xB8A5, 0xB8C6, 0xB8C6,
+  0xEC53, 0xD2AD, 0xB885, 0xC0E6, 0xB967, 0xC8C6, 0x5042, 0x0000, 0x0000, 0x6863, 0xC8C6, 0xB0A5, 0xB8A5, 0xE433, 0xE3B1, 0xB885,
+  0xB8C6, 0xB084, 0xC0C6, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8884, 0xC8E6, 0xB084, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xD0E6,
+  0x6863, 0x0000, 0x0000, 0x0800, 0x8084, 0xC8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB0A5, 0x6063, 0x0000, 0x0000, 0x0000, 0x0000, 0x5842,
+  0xA0A5, 0xA8A5, 0x6863, 0x1800
+};
+
+inline constexpr SpriteSpans SPRITE_STRAWBERRY_22_SPANS = {
+  SPRITE_STRAWBERRY_22_SPAN_ROWS, SPRITE_STRAWBERRY_22_SPAN_OPS, SPRITE_STRAWBERRY_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_STRAWBERRY_22_ASSET = {
   SPRITE_STRAWBERRY_22_WIDTH, SPRITE_STRAWBERRY_22_HEIGHT,
-  SPRITE_STRAWBERRY_22_ALPHA, SPRITE_STRAWBERRY_22_RGB565
+  nullptr, nullptr, &SPRITE_STRAWBERRY_22_SPANS
 };
 
 #endif // SPRITE_STRAWBERRY_22_INCLUDED
@@ -5,110 +5,187 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from strawberry_44.png (44x44)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from strawberry_44.png (44x44) — RGBA multi-couleur, encodé en spans
+// 1549/1936 pixels visibles, 4587 bytes flash (flat : 5808). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_STRAWBERRY_44_WIDTH = 44;
 constexpr uint16_t SPRITE_STRAWBERRY_44_HEIGHT = 44;
 
-const uint16_t SPRITE_STRAWBERRY_44_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x7BEA, 0x7DCB, 0x7DEB, 0x75AA, 0x756A, 0x756A, 0x756A, 0x7DAB, 0x756B, 0x756A, 0x7DAA, 0x7DAA, 0x7DCA, 0x7DAA, 0x7DAA, 0x7D6A, 0x7D4A, 0x854A, 0x854A, 0x84CA, 0x8409, 0xC800, 0xF800, 0xA80A, 0xCB26, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x554A, 0x7D8C, 0x7D8A, 0x7D8B, 0x7DCB, 0x7DAA, 0x7DCB, 0x7DAB, 0x7DAB, 0x7DAA, 0x754A, 0x7D6A, 0x7D8A, 0x7DAA, 0x7DCB, 0x7DAA, 0x7DAA, 0x7DCA, 0x7DEA, 0x75CB, 0x75CA, 0x75AA, 0x6DEA, 0x2749, 0x0000, 0x0000, 0xFD4A, 0xFBE0, 0x780F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xAAA0, 0x0000, 0x52AA, 0x6DAB, 0x758A, 0x7D8A, 0x7D8A, 0x7DAA, 0x7DCB, 0x7DEB, 0x7DEB, 0x7DCB, 0x7DAA, 0x7D6A, 0x7D6A, 0x7D8A, 0x7DCB, 0x7DCB, 0x7DAA, 0x75CA, 0x760B, 0x764B, 0x760B, 0x75EA, 0x760A, 0x6E2B, 0x56EB, 0x37EE, 0x0000, 0xC986, 0xF986, 0x9249, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xAD40, 0x0000, 0x9369, 0x7D2A, 0x7D8A, 0x7DAA, 0x758A, 0x7DCB, 0x862B, 0x864C, 0x8E4C, 0x862B, 0x862B, 0x862B, 0x864B, 0x862B, 0x860B, 0x7DEB, 0x7DAA, 0x7DAA, 0x7DAB, 0x85CB, 0x7DEB, 0x75AA, 0x7DEB, 0x7E0B, 0x7E2B, 0x6DEB, 0x572B, 0x0000, 0x0000, 0x07EF, 0x7BE0, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7BE0, 0x0000, 0x7FEF, 0x0000, 0x9B07, 0x8509, 0x7D8A, 0x7DAA, 0x75AA, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x7DAA, 0x7DCB, 0x7E0B, 0x7E2B, 0x7E0B, 0x7DAA, 0x7D8A, 0x7D8A, 0x7D2A, 0x8C69, 0x9429, 0x8C49, 0x8CAA, 0x8D0A, 0x954A, 0x950A, 0x8489, 0x8489, 0x0000, 0x0000, 0x0000, 0xBBE7, 0x9129, 0xA800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7BE0, 0x0000, 0xAD4A, 0x0000, 0x67EC, 0x6E6B, 0x75EB, 0x75CA, 0x7DAA, 0x7D8A, 0x756A, 0x756A, 0x758A, 0x75AA, 0x75CA, 0x75CA, 0x75AA, 0x75AA, 0x75AA, 0x6DEA, 0x6E0B, 0x756A, 0x8C29, 0x9B08, 0xA287, 0xA2C7, 0xA348, 0xABC9, 0xABC9, 0x9B08, 0xA247, 0xB8E6, 0xB0E5, 0x99E7, 0x0000, 0x0000, 0x0000, 0x5000, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x7FEF, 0x780F, 0x7945, 0xF800, 0x0020, 0x5EEB, 0x75EA, 0x758A, 0x7D6A, 0x7D4A, 0x7D6A, 0x758A, 0x6DEA, 0x6DEA, 0x75CA, 0x7D4A, 0x84C9, 0x84C9, 0x7D4A, 0x6E0B, 0x6E6B, 0x760B, 0x84C9, 0x9B08, 0xB146, 0xB8A5, 0xB906, 0xB966, 0xB967, 0xB946, 0xB8E6, 0xC0C6, 0xB8C5, 0xB0A6, 0x0000, 0x0000, 0xF800, 0xB004, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xAD4A, 0x780F, 0xA800, 0x0000, 0x6F4A, 0x7CEA, 0x84CA, 0x850A, 0x7D6A, 0x75CA, 0x75CA, 0x75EB, 0x75EB, 0x7D8A, 0x84CA, 0x93C9, 0x9B08, 0x9B28, 0x8BE9, 0x84EA, 0x7D6A, 0x7D6A, 0x84A9, 0x9B08, 0xB906, 0xC805, 0xC805, 0xC025, 0xC025, 0xC045, 0xC8A6, 0xC0C6, 0xC8E6, 0xC0E6, 0xC0E6, 0x98E5, 0x0000, 0xF800, 0xF800, 0xA80A, 0xF800, 0x0000,
-  0x0000, 0x7800, 0xAAAA, 0xF800, 0xF800, 0x89C7, 0x9267, 0xA2C8, 0xAB28, 0xA42A, 0x856A, 0x6E2B, 0x6DEA, 0x75AA, 0x852A, 0x8C29, 0xA2E8, 0xB1A7, 0xB906, 0xB926, 0xA9C7, 0xA2A7, 0x9B08, 0x9368, 0x9368, 0xA287, 0xB946, 0xC086, 0xC065, 0xB885, 0xC085, 0xB8A6, 0xC0A6, 0xC8E6, 0xD107, 0xC907, 0xC0E6, 0xB0C5, 0x9884, 0x0000, 0x0000, 0xD00A, 0xF800, 0x0000,
-  0xF800, 0x7800, 0x9B2C, 0x0000, 0x0000, 0xB8E6, 0xB126, 0xB967, 0xB9E7, 0xB328, 0x8C89, 0x754A, 0x84E9, 0x8C09, 0x9B28, 0xA227, 0xB106, 0xC065, 0xC025, 0xC045, 0xC086, 0xB8E6, 0xB146, 0xB1A7, 0xA9E7, 0xB1A7, 0xB126, 0xB8C5, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8C6, 0xC0C6, 0xC8A6, 0xC8C6, 0xC0A6, 0xB8C5, 0xB8E6, 0xA8E7, 0x0000, 0xC80C, 0xF800, 0xA800,
-  0xB80F, 0x0000, 0x7800, 0x0000, 0x9988, 0xC0A6, 0xC0A6, 0xC8C6, 0xC126, 0xB1E7, 0x9AE8, 0x9B08, 0xA288, 0xB1A7, 0xB105, 0xB864, 0xB844, 0xB845, 0xC085, 0xC0A6, 0xC086, 0xC085, 0xC085, 0xC0A6, 0xB8C6, 0xB8A5, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864, 0xC885, 0xC8A5, 0xC8A6, 0xC0C6, 0xB0E5, 0x98E7, 0xF80F, 0xF800, 0xD809,
-  0x9807, 0x0000, 0x0000, 0x98E7, 0xB0E6, 0xC0A6, 0xC886, 0xD0A6, 0xC0C6, 0xB126, 0xB166, 0xB146, 0xB8E6, 0xC065, 0xC045, 0xC066, 0xC0A6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8C6, 0xC0A6, 0xC086, 0xC065, 0xC045, 0xC065, 0xC0A6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A6, 0xB8A5, 0xB0C5, 0xC0C6, 0xD0E6, 0xC8C6, 0xC0C6, 0xB0A5, 0xA8A5, 0x0000, 0x0000, 0xC007,
-  0xB0C3, 0x0000, 0x0000, 0xB885, 0xB8A6, 0xC0A6, 0xC8C6, 0xC8C6, 0xC0A5, 0xB8A5, 0xC0A6, 0xC085, 0xB844, 0xC086, 0xC948, 0xD1EB, 0xCA0B, 0xC1A9, 0xB8E6, 0xB885, 0xB8A5, 0xC0C6, 0xC0C6, 0xB885, 0xB865, 0xC0E7, 0xC9A9, 0xC9C9, 0xC127, 0xB8C6, 0xB8C6, 0xB8A5, 0xB885, 0xB907, 0xC1EA, 0xCA2B, 0xD189, 0xC907, 0xB8A5, 0xB885, 0xB885, 0x0000, 0x0000, 0xB803,
-  0xC0E3, 0x0000, 0x0000, 0xB8A5, 0xB8A6, 0xC0C6, 0xC0E6, 0xC0E6, 0xB8C6, 0xC0C6, 0xC0A6, 0xC045, 0xB824, 0xC127, 0xD30E, 0xE412, 0xDBB0, 0xD24C, 0xC0E6, 0xB844, 0xB8A5, 0xB907, 0xB906, 0xB8C5, 0xB8A5, 0xC188, 0xD30E, 0xDB0E, 0xC9C9, 0xB8C5, 0xB8A5, 0xB885, 0xB885, 0xC9CA, 0xE3B1, 0xE412, 0xD28C, 0xC927, 0xC0A5, 0xB885, 0xB885, 0xFD4A, 0x0000, 0xA805,
-  0xB124, 0x0000, 0x0000, 0xB8A5, 0xB8A6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8E6, 0xC0E6, 0xC107, 0xB865, 0xB003, 0xC188, 0xE412, 0xF557, 0xEC94, 0xD2AD, 0xC0E6, 0xB844, 0xB8A5, 0xC107, 0xB8E6, 0xB885, 0xB864, 0xC9EA, 0xE3F1, 0xE412, 0xCA2B, 0xB885, 0xB865, 0xB865, 0xB8A5, 0xD2AD, 0xF536, 0xF577, 0xDB2E, 0xC927, 0xC8A5, 0xB885, 0xB885, 0xD2EB, 0x0000, 0xA800,
-  0xB9E7, 0x0000, 0xA80A, 0xB8C6, 0xB8C6, 0xC8C6, 0xC0C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8E6, 0xB885, 0xB044, 0xC189, 0xE3F2, 0xF4F5, 0xE3F2, 0xCA2B, 0xB8C6, 0xB844, 0xB8A5, 0xC0E6, 0xC0C6, 0xB885, 0xB865, 0xC9C9, 0xDBB0, 0xE3B1, 0xC9EA, 0xB885, 0xB864, 0xB885, 0xB8C6, 0xD2CD, 0xF516, 0xF516, 0xD2CD, 0xC0E6, 0xC8A5, 0xC0A5, 0xC0A5, 0xCA2A, 0x0000, 0xF800,
-  0xF800, 0x0000, 0xA947, 0xB8A6, 0xC0C6, 0xD0E6, 0xC0E6, 0xB8A5, 0xB864, 0xB864, 0xB8A5, 0xB885, 0xB864, 0xC148, 0xD2AD, 0xDB2F, 0xD26C, 0xC148, 0xB885, 0xB864, 0xB8A5, 0xC0E6, 0xB8C6, 0xB8A5, 0xB8A5, 0xC148, 0xCA2B, 0xD22B, 0xC148, 0xB885, 0xB885, 0xB8A5, 0xB8E6, 0xCA0B, 0xDB70, 0xDB4F, 0xC9A9, 0xC0A5, 0xC8A6, 0xC0C6, 0xB8C6, 0xB1A6, 0x0000, 0xF81F,
-  0x0000, 0x0000, 0xA8C6, 0xC0C6, 0xC0C6, 0xD0C6, 0xC0C6, 0xB8C6, 0xC107, 0xC107, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8E6, 0xC168, 0xC168, 0xC107, 0xB8A5, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xC107, 0xC0E6, 0xB8C6, 0xB8A5, 0xB8A6, 0xB8C6, 0xB8C6, 0xC127, 0xC9A9, 0xC168, 0xC0E6, 0xC0A5, 0xC8C6, 0xC0E6, 0xB8C6, 0xB8E3, 0x0000, 0xF80A,
-  0x0000, 0x0000, 0xB066, 0xC0E6, 0xC0E6, 0xD0C6, 0xC085, 0xC127, 0xCA4B, 0xD28C, 0xC9A9, 0xC0E6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8C6, 0xC107, 0xC107, 0xB8C6, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8A5, 0xF800, 0x0000, 0xC986,
-  0xF800, 0x0000, 0xA884, 0xC0E6, 0xC0E6, 0xC8A5, 0xC044, 0xC147, 0xDB2F, 0xE412, 0xDB4F, 0xCA0A, 0xC0E6, 0xB844, 0xB864, 0xB885, 0xB885, 0xC168, 0xD28C, 0xD28C, 0xC188, 0xB8C5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB885, 0xB864, 0xB044, 0xB864, 0xC0C6, 0xC8E6, 0xB8C6, 0xB8A5, 0xB8A5, 0x0000, 0x0000, 0xA8E3,
-  0xB9E7, 0x0000, 0xB807, 0xB8E6, 0xC106, 0xC8A5, 0xB824, 0xC127, 0xDB2F, 0xECB4, 0xECB4, 0xDB4F, 0xC127, 0xB023, 0xB885, 0xB8A5, 0xB885, 0xCA0A, 0xE433, 0xEC94, 0xD2AD, 0xC107, 0xB885, 0xB8A5, 0xB8C6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C5, 0xB8A5, 0xB885, 0xB885, 0xB885, 0xC0A5, 0xC8C6, 0xC8C6, 0xC0C6, 0xB8A5, 0xB085, 0x0000, 0x0000, 0xB0C6,
-  0xB124, 0x0000, 0x0000, 0xB906, 0xB906, 0xC0A5, 0xC064, 0xC0E6, 0xD24B, 0xDBD1, 0xE453, 0xDB4F, 0xC148, 0xB844, 0xB8C6, 0xB8C6, 0xB885, 0xCA2B, 0xECD4, 0xF556, 0xDB4F, 0xC168, 0xB885, 0xB864, 0xB8A5, 0xC0E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8A5, 0xB885, 0xC0E6, 0xC9A9, 0xCA2B, 0xCA0B, 0xC989, 0xD0E7, 0xC885, 0xC0A5, 0xB106, 0xB126, 0xF800, 0x0000, 0xA8E7,
-  0xC0E7, 0x0000, 0x0000, 0xB8E6, 0xB8E6, 0xC0C6, 0xC8A6, 0xC8C6, 0xC127, 0xC1C9, 0xD26C, 0xCA0A, 0xC107, 0xB885, 0xB8E6, 0xB8C6, 0xB865, 0xC9A9, 0xE3B1, 0xEC53, 0xDB0E, 0xC189, 0xB8A5, 0xB864, 0xB8A5, 0xC0E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB885, 0xB844, 0xC168, 0xDB4F, 0xE453, 0xE3F1, 0xDA6C, 0xD0E7, 0xB824, 0xB844, 0xCBAE, 0xAAAA, 0x7800, 0x7800, 0x9800,
-  0xB8E7, 0x0000, 0x7800, 0xB0E5, 0xB8C5, 0xC0C6, 0xC8C6, 0xD0C6, 0xC085, 0xB885, 0xB8C6, 0xC0E6, 0xC0E6, 0xB8C6, 0xB8C6, 0xB864, 0xB824, 0xB8E6, 0xCA2B, 0xD2AD, 0xCA2B, 0xC148, 0xB8C6, 0xB885, 0xB885, 0xB8A5, 0xB885, 0xB8A5, 0xB8E6, 0xB885, 0xB844, 0xC9C9, 0xE453, 0xF598, 0xF494, 0xDA8D, 0xC0E6, 0xB003, 0xA802, 0x0020, 0x0000, 0xA800, 0x7800, 0x7800,
-  0x9800, 0x7800, 0xB807, 0xA800, 0xA8C6, 0xC0C6, 0xC0C6, 0xC8C6, 0xC0A5, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB885, 0xB844, 0xB023, 0xB865, 0xB8E6, 0xC127, 0xC107, 0xB8E6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB885, 0xB8A5, 0xB8C6, 0xB885, 0xB844, 0xC9C9, 0xE412, 0xF4F5, 0xEBB1, 0xDA0B, 0xC0C6, 0xA802, 0x9800, 0x0000, 0x0000, 0xD005, 0x7800, 0x0000,
-  0x7800, 0x7800, 0xA805, 0x0000, 0x0000, 0xB885, 0xB8A5, 0xC0C6, 0xC8E6, 0xC8E6, 0xC0A6, 0xB8A5, 0xB8A5, 0xB8C6, 0xC107, 0xC127, 0xC107, 0xB8A6, 0xB864, 0xB864, 0xB885, 0xB8A5, 0xB885, 0xC0E6, 0xC168, 0xC9EA, 0xC9EA, 0xC188, 0xC0E6, 0xB864, 0xB885, 0xC168, 0xD2CD, 0xDB0F, 0xE24C, 0xC948, 0xC0A5, 0xA803, 0x9800, 0xF80A, 0xF800, 0xD005, 0x7800, 0x0000,
-  0x0000, 0xF800, 0xC800, 0x0000, 0x0000, 0xA803, 0xB8A5, 0xB8C6, 0xC0C6, 0xD0E7, 0xC0E6, 0xB885, 0xB864, 0xC0E6, 0xC9EA, 0xD2AD, 0xD28C, 0xC9A9, 0xB8A5, 0xB844, 0xB8A5, 0xB8A5, 0xB864, 0xC107, 0xD2AD, 0xE3F1, 0xE412, 0xDAEE, 0xC148, 0xB864, 0xB8A5, 0xC127, 0xC147, 0xC948, 0xD107, 0xC0C6, 0xB8A5, 0xA8C5, 0x7800, 0xF800, 0xF800, 0xB800, 0xF800, 0x0000,
-  0x0000, 0xF800, 0xA800, 0xF800, 0xC806, 0x0000, 0xB8A2, 0xC0A5, 0xB8C6, 0xC8E6, 0xC907, 0xC0A5, 0xB864, 0xB8C6, 0xCA2B, 0xDB70, 0xE412, 0xDB2F, 0xC189, 0xB8A5, 0xB8E6, 0xB8A5, 0xB023, 0xC127, 0xDB2F, 0xF516, 0xF577, 0xE412, 0xC989, 0xB024, 0xB064, 0xB8A5, 0xB844, 0xC044, 0xC065, 0xB885, 0xB8C6, 0x0000, 0x0000, 0xF800, 0xF800, 0x7800, 0xF800, 0x0000,
-  0x0000, 0x0000, 0xF800, 0x7800, 0xB009, 0x0000, 0x0000, 0xB084, 0xB0C5, 0xC0E6, 0xC8E7, 0xC8C6, 0xB885, 0xB8A5, 0xC168, 0xDB0E, 0xEC94, 0xE433, 0xCA2B, 0xB8C6, 0xB8C6, 0xB885, 0xB024, 0xC107, 0xD2EE, 0xEC94, 0xF536, 0xE3F2, 0xC989, 0xB023, 0xB023, 0xB884, 0xC064, 0xC085, 0xB8A5, 0xB8A5, 0xB8C6, 0x0000, 0x0000, 0xB124, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x7800, 0xA80A, 0xF800, 0xF80A, 0x7800, 0xA8C5, 0xB8C6, 0xC0C6, 0xC8C6, 0xC8C6, 0xB8A5, 0xB8C6, 0xC9EA, 0xDB90, 0xDB90, 0xCA0B, 0xC0C6, 0xB8A6, 0xB885, 0xB864, 0xC0E6, 0xC9EA, 0xDB0E, 0xDB90, 0xD2CD, 0xC127, 0xB864, 0xB8C6, 0xC148, 0xC948, 0xC907, 0xC0E6, 0xB8A5, 0xB064, 0x7800, 0x0000, 0x98E3, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x780F, 0xF800, 0xD00A, 0x0000, 0x9986, 0xB8A6, 0xB8C6, 0xC0C6, 0xC8C6, 0xC8C6, 0xB8A5, 0xB8E6, 0xC168, 0xC989, 0xC127, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xC127, 0xC168, 0xC189, 0xC127, 0xB885, 0xB8E6, 0xCA2B, 0xDACD, 0xDA4B, 0xD168, 0xC0A6, 0xB024, 0xA002, 0x0000, 0x0000, 0xB807, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB807, 0xF800, 0x0000, 0xB0C3, 0xB0A5, 0xB8C6, 0xC8E6, 0xD0E6, 0xC0A5, 0xB864, 0xB044, 0xB844, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB885, 0xB864, 0xB864, 0xB885, 0xB844, 0xB824, 0xC189, 0xE3D1, 0xEC73, 0xE30E, 0xD168, 0xC085, 0xB003, 0x9800, 0x0000, 0x0000, 0xB807, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80A, 0xF800, 0xF80A, 0x0000, 0xA863, 0xB8C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8A5, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864, 0xB844, 0xB844, 0xB864, 0xB885, 0xB844, 0xB844, 0xCA0B, 0xECD5, 0xF536, 0xEB2F, 0xC948, 0xB865, 0xB003, 0x9800, 0x0000, 0x0000, 0xB807, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA800, 0xB805, 0xF800, 0x0000, 0xC0E6, 0xB8A5, 0xB8C6, 0xC0C6, 0xC8E6, 0xC0E6, 0xB8E6, 0xB8C6, 0xB8A6, 0xB8A5, 0xC0E6, 0xC148, 0xC168, 0xC147, 0xB8E6, 0xB8E6, 0xB885, 0xB885, 0xC9EA, 0xE412, 0xEC53, 0xE28C, 0xC8E7, 0xB885, 0xB064, 0xA842, 0x0000, 0x0000, 0xB807, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB009, 0x0000, 0x0000, 0x5000, 0xB0A5, 0xB8C6, 0xC0C6, 0xD0E6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB865, 0xC168, 0xDAEE, 0xDB90, 0xD2AD, 0xC188, 0xB8C6, 0xB864, 0xB8A5, 0xC168, 0xCA4B, 0xD24B, 0xD168, 0xC8A6, 0xC0A5, 0xB8C6, 0xA8E5, 0x0000, 0x0000, 0x9807, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA80A, 0xF800, 0xC806, 0x0000, 0x9884, 0xC0C6, 0xC0C6, 0xD0C6, 0xC8C6, 0xC0C6, 0xB8E6, 0xB885, 0xB044, 0xC9A9, 0xE412, 0xF536, 0xE432, 0xD26C, 0xB8E6, 0xB844, 0xB8A5, 0xB8E6, 0xB8E6, 0xC0C6, 0xD0C6, 0xC0A5, 0xC0C6, 0xB8E7, 0xA168, 0x0000, 0x0000, 0xD00A, 0x7800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD809, 0x0000, 0x0000, 0xB0A5, 0xB8C5, 0xC0C6, 0xC8C6, 0xC8C6, 0xC0E6, 0xB084, 0xB024, 0xC989, 0xE3F2, 0xF557, 0xECB4, 0xD2EE, 0xC107, 0xB844, 0xB885, 0xB8E6, 0xB8A5, 0xC085, 0xD0C6, 0xC0C6, 0xC0C6, 0xB0E6, 0xAAAA, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xD809, 0xF800, 0xA80A, 0x9884, 0xB0C5, 0xC0C6, 0xC8C6, 0xD0E6, 0xC8E6, 0xB885, 0xB864, 0xC127, 0xD2CD, 0xE3D1, 0xDB90, 0xD26C, 0xC107, 0xB864, 0xB8A5, 0xC0E6, 0xC0C6, 0xC8C6, 0xC8C6, 0xB8C6, 0xB8A5, 0x7800, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80A, 0xF800, 0xF80C, 0x0000, 0xA8E3, 0xB8C6, 0xB8C6, 0xC0C6, 0xD0E6, 0xC8C6, 0xB8A5, 0xB8C6, 0xC147, 0xC189, 0xC1A9, 0xC148, 0xB8C6, 0xB8A5, 0xB8A5, 0xC0E6, 0xD0E6, 0xD0C6, 0xC0C6, 0xB0A6, 0xB085, 0x0000, 0x0000, 0xD005, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xB807, 0x0000, 0x0000, 0xC0C6, 0xB0A5, 0xC0C6, 0xC8C6, 0xD0E6, 0xC8C6, 0xB8A5, 0xB865, 0xB864, 0xB864, 0xB885, 0xC0C6, 0xC0C6, 0xC0C6, 0xC8E6, 0xD0E7, 0xC8E6, 0xC0C6, 0xB085, 0x9863, 0xF800, 0xF800, 0xF806, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF80A, 0x0000, 0x0000, 0x0000, 0xB084, 0xB8C6, 0xC0C6, 0xC0C6, 0xD0E7, 0xD0C6, 0xC8A5, 0xB885, 0xB885, 0xC0A5, 0xC8C6, 0xD0E6, 0xD0E6, 0xC8C6, 0xC8E6, 0xC0E6, 0xC0C6, 0xA865, 0x7800, 0xC806, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0xB004, 0xF800, 0x0000, 0xB8E7, 0xB8A6, 0xC0C6, 0xC8C6, 0xC8C6, 0xC0E6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xD005, 0x0000, 0x0000, 0xC806, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA800, 0xF800, 0x0000, 0x0000, 0xB0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xC0C6, 0xB0C5, 0xA8A5, 0x0000, 0x0000, 0x0000, 0x7800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7800, 0x9800, 0xC8C6, 0xF800, 0x0000, 0x0000, 0xB8E5, 0xB8C6, 0xB8A6, 0xC0C6, 0xC0C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A6, 0x0000, 0x0000, 0x0000, 0xA80A, 0xC806, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_STRAWBERRY_44_SPAN_ROWS[] PROGMEM = {
+  0, 0, 34, 29, 70, 60, 109, 92, 134, 125, 159, 158, 203, 193, 246, 230,
+  284, 270, 317, 310, 348, 351, 381, 393, 407, 433, 434, 473, 461, 514, 485, 555,
+  509, 597, 533, 639, 556, 680, 581, 721, 606, 762, 632, 803, 659, 844, 685, 886,
+  713, 927, 743, 968, 772, 1009, 802, 1049, 837, 1088, 870, 1123, 901, 1161, 933, 1196,
+  963, 1229, 996, 1262, 1027, 1293, 1058, 1323, 1090, 1353, 1121, 1384, 1158, 1415, 1193, 1443,
+  1215, 1469, 1236, 1493, 1264, 1514, 1289, 1532
 };
 
-const uint8_t SPRITE_STRAWBERRY_44_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x06, 0x29, 0x45, 0x52, 0x5A, 0x5D, 0x4C, 0x33, 0x1F, 0x25, 0x4D, 0x8E, 0xC2, 0xD7, 0xD7, 0xC9, 0xAF, 0x8C, 0x67, 0x42, 0x21, 0x05, 0x01, 0x03, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x0A, 0x24, 0x51, 0x73, 0x83, 0x89, 0x8C, 0x7F, 0x6D, 0x5F, 0x63, 0x80, 0xAE, 0xD3, 0xE3, 0xE3, 0xD8, 0xC6, 0xAD, 0x8C, 0x5F, 0x33, 0x0D, 0x00, 0x00, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x0E, 0x2F, 0x61, 0x9D, 0xC5, 0xD7, 0xDA, 0xDB, 0xD6, 0xD1, 0xCC, 0xCE, 0xD7, 0xE6, 0xF1, 0xF6, 0xF6, 0xF1, 0xED, 0xE5, 0xCC, 0x98, 0x61, 0x2F, 0x0F, 0x00, 0x05, 0x05, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x07, 0x22, 0x5B, 0x9E, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xAD, 0x83, 0x52, 0x13, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0x0D, 0x35, 0x79, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xED, 0xE2, 0xB1, 0x43, 0x00, 0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x05, 0x37, 0x8C, 0xD2, 0xF3, 0xFB, 0xFA, 0xF5, 0xF7, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xFB, 0xFC, 0xFC, 0xFF, 0xFF, 0xEF, 0x8E, 0x40, 0x1B, 0x08, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x02, 0x06, 0x01, 0x00, 0x39, 0xA0, 0xE9, 0xFD, 0xFC, 0xFD, 0xFB, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xE1, 0xB0, 0x72, 0x32, 0x00, 0x00, 0x01, 0x07, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x03, 0x02, 0x03, 0x00, 0x0C, 0x52, 0xBB, 0xF7, 0xFF, 0xF9, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xF8, 0xF5, 0xFD, 0xFF, 0xF7, 0xC2, 0x7E, 0x36, 0x12, 0x00, 0x01, 0x01, 0x03, 0x01, 0x00,
-  0x00, 0x02, 0x06, 0x01, 0x01, 0x09, 0x3A, 0x8B, 0xE0, 0xFF, 0xFF, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF, 0xF5, 0xD7, 0x9B, 0x52, 0x0D, 0x00, 0x00, 0x06, 0x02, 0x00,
-  0x01, 0x02, 0x05, 0x00, 0x00, 0x21, 0x7B, 0xC5, 0xF6, 0xFD, 0xFE, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFC, 0xFF, 0xFF, 0xE4, 0x99, 0x34, 0x09, 0x00, 0x05, 0x02, 0x03,
-  0x04, 0x00, 0x02, 0x00, 0x0F, 0x52, 0xBF, 0xF3, 0xFF, 0xF9, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFF, 0xFE, 0xD5, 0x77, 0x30, 0x08, 0x02, 0x01, 0x07,
-  0x08, 0x00, 0x00, 0x08, 0x39, 0x8F, 0xEA, 0xFF, 0xFF, 0xF6, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF3, 0xFB, 0xFE, 0xF5, 0xBB, 0x67, 0x18, 0x00, 0x00, 0x09,
-  0x0A, 0x00, 0x00, 0x1B, 0x79, 0xCD, 0xFD, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFA, 0xFD, 0xFC, 0xFF, 0xF1, 0xA2, 0x2F, 0x00, 0x00, 0x08,
-  0x09, 0x00, 0x00, 0x30, 0xA9, 0xF2, 0xFE, 0xFB, 0xFE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF6, 0xFE, 0xFF, 0xC8, 0x48, 0x03, 0x00, 0x06,
-  0x07, 0x00, 0x00, 0x45, 0xC3, 0xFF, 0xFF, 0xF9, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xD6, 0x5C, 0x0B, 0x00, 0x03,
-  0x04, 0x00, 0x03, 0x54, 0xCE, 0xFE, 0xFE, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFE, 0xFC, 0xD9, 0x66, 0x0F, 0x00, 0x01,
-  0x02, 0x00, 0x0C, 0x60, 0xD6, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFE, 0xFC, 0xD9, 0x65, 0x0E, 0x00, 0x01,
-  0x00, 0x00, 0x13, 0x67, 0xD9, 0xFE, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD1, 0x57, 0x08, 0x00, 0x03,
-  0x00, 0x00, 0x15, 0x69, 0xD9, 0xFD, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xF9, 0xFF, 0xFF, 0xBE, 0x42, 0x02, 0x00, 0x05,
-  0x02, 0x00, 0x0F, 0x62, 0xD9, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFD, 0xFB, 0xFD, 0xF1, 0xA1, 0x2D, 0x00, 0x00, 0x09,
-  0x04, 0x00, 0x04, 0x52, 0xCE, 0xFF, 0xFE, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFE, 0xFC, 0xF3, 0xC7, 0x77, 0x1C, 0x00, 0x00, 0x0A,
-  0x07, 0x00, 0x00, 0x3C, 0xB7, 0xF9, 0xFF, 0xF9, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xE8, 0x94, 0x43, 0x0E, 0x01, 0x00, 0x09,
-  0x09, 0x00, 0x00, 0x24, 0x8B, 0xD7, 0xF7, 0xFA, 0xFD, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD2, 0x5E, 0x0F, 0x03, 0x04, 0x02, 0x05,
-  0x08, 0x00, 0x02, 0x11, 0x50, 0xA2, 0xEF, 0xFF, 0xFF, 0xF7, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFA, 0xFD, 0xF4, 0xB0, 0x38, 0x00, 0x00, 0x06, 0x02, 0x02,
-  0x05, 0x02, 0x04, 0x03, 0x13, 0x5F, 0xD3, 0xFF, 0xFE, 0xF6, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xFD, 0xF4, 0xCA, 0x7C, 0x1D, 0x00, 0x00, 0x06, 0x02, 0x00,
-  0x02, 0x02, 0x06, 0x00, 0x00, 0x2A, 0x95, 0xE7, 0xFF, 0xFF, 0xFE, 0xF9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xE9, 0x97, 0x45, 0x0F, 0x03, 0x01, 0x06, 0x02, 0x00,
-  0x00, 0x01, 0x05, 0x00, 0x00, 0x09, 0x40, 0x99, 0xF0, 0xFF, 0xFD, 0xF4, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xD6, 0x65, 0x13, 0x02, 0x03, 0x02, 0x04, 0x01, 0x00,
-  0x00, 0x01, 0x03, 0x01, 0x05, 0x00, 0x0B, 0x4E, 0xBC, 0xF1, 0xFF, 0xFA, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFB, 0xFF, 0xFA, 0xBC, 0x41, 0x00, 0x00, 0x05, 0x02, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x1B, 0x6B, 0xB8, 0xF5, 0xFF, 0xFD, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFF, 0xEA, 0x9D, 0x29, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x06, 0x02, 0x03, 0x04, 0x28, 0x72, 0xD2, 0xFB, 0xFF, 0xF8, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xFF, 0xFA, 0xD5, 0x83, 0x20, 0x02, 0x01, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x06, 0x00, 0x05, 0x2F, 0x91, 0xDA, 0xFA, 0xFB, 0xFD, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xF4, 0xC2, 0x6F, 0x1A, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x0A, 0x4B, 0x9D, 0xE9, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xF1, 0xB9, 0x69, 0x1A, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x03, 0x00, 0x10, 0x4F, 0xC0, 0xFE, 0xFF, 0xF9, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xF1, 0xB6, 0x65, 0x18, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0B, 0x01, 0x00, 0x19, 0x81, 0xD8, 0xFD, 0xFF, 0xFE, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFF, 0xF0, 0xB4, 0x63, 0x16, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x03, 0x39, 0x91, 0xEB, 0xFF, 0xFD, 0xF5, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0xFF, 0xFD, 0xEA, 0xA5, 0x55, 0x12, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x05, 0x00, 0x0D, 0x52, 0xC7, 0xFA, 0xFF, 0xF8, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF5, 0xFF, 0xFF, 0xEA, 0x8F, 0x3B, 0x0B, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x26, 0x8C, 0xD9, 0xFB, 0xFA, 0xFB, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF2, 0xFC, 0xFF, 0xE1, 0x6F, 0x1A, 0x03, 0x01, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x03, 0x0F, 0x4B, 0x9A, 0xE7, 0xFF, 0xFF, 0xF9, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFF, 0xFB, 0xC5, 0x4B, 0x04, 0x00, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x05, 0x01, 0x10, 0x4A, 0xB7, 0xF9, 0xFF, 0xFC, 0xF9, 0xF6, 0xFC, 0xFF, 0xFE, 0xFD, 0xFB, 0xF9, 0xF6, 0xFB, 0xFF, 0xFF, 0xDD, 0x8F, 0x27, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x15, 0x6C, 0xBC, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDC, 0x99, 0x4E, 0x10, 0x02, 0x01, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x1A, 0x59, 0xB5, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x91, 0x3E, 0x12, 0x02, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x01, 0x00, 0x12, 0x5B, 0x9D, 0xCE, 0xE4, 0xF1, 0xF7, 0xFB, 0xF7, 0xEB, 0xDE, 0xCA, 0xAB, 0x79, 0x3E, 0x06, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x14, 0x34, 0x72, 0xA9, 0xD2, 0xEC, 0xF3, 0xE4, 0xC3, 0x94, 0x62, 0x3A, 0x1E, 0x0C, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x0A, 0x01, 0x00, 0x00, 0x3C, 0x86, 0xC0, 0xE5, 0xEF, 0xDA, 0xAC, 0x6A, 0x25, 0x00, 0x00, 0x00, 0x03, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_STRAWBERRY_44_SPAN_OPS[] PROGMEM = {
+  0x03, 0x82, 0x01, 0x01, 0x02, 0x01, 0x99, 0x06, 0x29, 0x45, 0x52, 0x5A, 0x5D, 0x4C, 0x33, 0x1F, 0x25, 0x4D, 0x8E, 0xC2, 0xD7, 0xD7, 0xC9, 0xAF,
+  0x8C, 0x67, 0x42, 0x21, 0x05, 0x01, 0x03, 0x05, 0x01, 0xC0, 0x03, 0x9A, 0x01, 0x01, 0x02, 0x03, 0x0A, 0x24, 0x51, 0x73, 0x83, 0x89, 0x8C, 0x7F,
+  0x6D, 0x5F, 0x63, 0x80, 0xAE, 0xD3, 0xE3, 0xE3, 0xD8, 0xC6, 0xAD, 0x8C, 0x5F, 0x33, 0x0D, 0x01, 0x83, 0x03, 0x02, 0x02, 0x01, 0xC0, 0x02, 0x81,
+  0x01, 0x03, 0x00, 0x99, 0x03, 0x0E, 0x2F, 0x61, 0x9D, 0xC5, 0xD7, 0xDA, 0xDB, 0xD6, 0xD1, 0xCC, 0xCE, 0xD7, 0xE6, 0xF1, 0xF6, 0xF6, 0xF1, 0xED,
+  0xE5, 0xCC, 0x98, 0x61, 0x2F, 0x0F, 0x00, 0x83, 0x05, 0x05, 0x07, 0x02, 0xC0, 0x02, 0x81, 0x01, 0x03, 0x00, 0x84, 0x07, 0x22, 0x5B, 0x9E, 0xE0,
+  0x50, 0x84, 0xD6, 0xAD, 0x83, 0x52, 0x13, 0x01, 0x83, 0x02, 0x02, 0x02, 0x01, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x86, 0x02, 0x01, 0x0D, 0x35, 0x79,
+  0xBC, 0xEF, 0x50, 0x84, 0xF3, 0xED, 0xE2, 0xB1, 0x43, 0x02, 0x82, 0x04, 0x07, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x80, 0x03, 0x00, 0x96, 0x05,
+  0x37, 0x8C, 0xD2, 0xF3, 0xFB, 0xFA, 0xF5, 0xF7, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xFA, 0xFC, 0xFD, 0xFD, 0xFC, 0xFB, 0xFB, 0xFC, 0xFC, 0x41, 0x84,
+  0xEF, 0x8E, 0x40, 0x1B, 0x08, 0x01, 0x82, 0x01, 0x03, 0x01, 0xC0, 0x00, 0x84, 0x01, 0x02, 0x02, 0x06, 0x01, 0x00, 0x95, 0x39, 0xA0, 0xE9, 0xFD,
+  0xFC, 0xFD, 0xFB, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0x42, 0x83, 0xE1, 0xB0, 0x72, 0x32,
+  0x01, 0x82, 0x01, 0x07, 0x02, 0xC0, 0x00, 0x83, 0x01, 0x03, 0x02, 0x03, 0x00, 0x83, 0x0C, 0x52, 0xBB, 0xF7, 0x40, 0x82, 0xF9, 0xFE, 0xFE, 0x4C,
+  0x84, 0xFD, 0xFA, 0xF8, 0xF5, 0xFD, 0x40, 0x84, 0xF7, 0xC2, 0x7E, 0x36, 0x12, 0x00, 0x83, 0x01, 0x01, 0x03, 0x01, 0xC0, 0x00, 0x87, 0x02, 0x06,
+  0x01, 0x01, 0x09, 0x3A, 0x8B, 0xE0, 0x41, 0x81, 0xF9, 0xFD, 0x4D, 0x84, 0xFE, 0xFE, 0xFD, 0xFB, 0xFE, 0x41, 0x84, 0xF5, 0xD7, 0x9B, 0x52, 0x0D,
+  0x01, 0x81, 0x06, 0x02, 0xC0, 0x82, 0x01, 0x02, 0x05, 0x01, 0x87, 0x21, 0x7B, 0xC5, 0xF6, 0xFD, 0xFE, 0xFA, 0xFD, 0x51, 0x82, 0xFC, 0xF8, 0xFC,
+  0x41, 0x83, 0xE4, 0x99, 0x34, 0x09, 0x00, 0x82, 0x05, 0x02, 0x03, 0xC0, 0x80, 0x04, 0x00, 0x80, 0x02, 0x00, 0x83, 0x0F, 0x52, 0xBF, 0xF3, 0x40,
+  0x82, 0xF9, 0xFC, 0xFD, 0x52, 0x83, 0xFE, 0xFD, 0xFD, 0xFC, 0x40, 0x87, 0xFE, 0xD5, 0x77, 0x30, 0x08, 0x02, 0x01, 0x07, 0xC0, 0x80, 0x08, 0x01,
+  0x83, 0x08, 0x39, 0x8F, 0xEA, 0x41, 0x81, 0xF6, 0xFC, 0x55, 0x87, 0xFB, 0xF3, 0xFB, 0xFE, 0xF5, 0xBB, 0x67, 0x18, 0x01, 0x80, 0x09, 0xC0, 0x80,
+  0x0A, 0x01, 0x83, 0x1B, 0x79, 0xCD, 0xFD, 0x41, 0x81, 0xF8, 0xFD, 0x55, 0x83, 0xFD, 0xFA, 0xFD, 0xFC, 0x40, 0x82, 0xF1, 0xA2, 0x2F, 0x01, 0x80,
+  0x08, 0xC0, 0x80, 0x09, 0x01, 0x86, 0x30, 0xA9, 0xF2, 0xFE, 0xFB, 0xFE, 0xFB, 0x56, 0x84, 0xFE, 0xFE, 0xFC, 0xF6, 0xFE, 0x40, 0x82, 0xC8, 0x48,
+  0x03, 0x00, 0x80, 0x06, 0xC0, 0x80, 0x07, 0x01, 0x81, 0x45, 0xC3, 0x41, 0x82, 0xF9, 0xFD, 0xFD, 0x58, 0x81, 0xFD, 0xF7, 0x41, 0x82, 0xD6, 0x5C,
+  0x0B, 0x00, 0x80, 0x03, 0xC0, 0x80, 0x04, 0x00, 0x86, 0x03, 0x54, 0xCE, 0xFE, 0xFE, 0xF7, 0xFD, 0x59, 0x86, 0xFD, 0xF8, 0xFE, 0xFC, 0xD9, 0x66,
+  0x0F, 0x00, 0x80, 0x01, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x0C, 0x60, 0xD6, 0x41, 0x81, 0xF8, 0xFD, 0x59, 0x86, 0xFD, 0xF8, 0xFE, 0xFC, 0xD9, 0x65,
+  0x0E, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x83, 0x13, 0x67, 0xD9, 0xFE, 0x40, 0x81, 0xF8, 0xFD, 0x59, 0x81, 0xFD, 0xF8, 0x41, 0x82, 0xD1, 0x57, 0x08,
+  0x00, 0x80, 0x03, 0xC0, 0x01, 0x83, 0x15, 0x69, 0xD9, 0xFD, 0x40, 0x81, 0xF8, 0xFD, 0x57, 0x83, 0xFE, 0xFD, 0xFD, 0xF9, 0x41, 0x82, 0xBE, 0x42,
+  0x02, 0x00, 0x80, 0x05, 0xC0, 0x80, 0x02, 0x00, 0x82, 0x0F, 0x62, 0xD9, 0x41, 0x81, 0xF8, 0xFD, 0x57, 0x87, 0xFE, 0xFB, 0xFD, 0xFB, 0xFD, 0xF1,
+  0xA1, 0x2D, 0x01, 0x80, 0x09, 0xC0, 0x80, 0x04, 0x00, 0x82, 0x04, 0x52, 0xCE, 0x40, 0x82, 0xFE, 0xF8, 0xFD, 0x57, 0x87, 0xFD, 0xF9, 0xFE, 0xFC,
+  0xF3, 0xC7, 0x77, 0x1C, 0x01, 0x80, 0x0A, 0xC0, 0x80, 0x07, 0x01, 0x82, 0x3C, 0xB7, 0xF9, 0x40, 0x82, 0xF9, 0xFD, 0xFC, 0x56, 0x81, 0xFD, 0xF8,
+  0x41, 0x84, 0xE8, 0x94, 0x43, 0x0E, 0x01, 0x00, 0x80, 0x09, 0xC0, 0x80, 0x09, 0x01, 0x87, 0x24, 0x8B, 0xD7, 0xF7, 0xFA, 0xFD, 0xF9, 0xFD, 0x55,
+  0x81, 0xFD, 0xF8, 0x41, 0x86, 0xD2, 0x5E, 0x0F, 0x03, 0x04, 0x02, 0x05, 0xC0, 0x80, 0x08, 0x00, 0x84, 0x02, 0x11, 0x50, 0xA2, 0xEF, 0x41, 0x81,
+  0xF7, 0xFC, 0x54, 0x86, 0xFD, 0xFD, 0xFA, 0xFD, 0xF4, 0xB0, 0x38, 0x01, 0x82, 0x06, 0x02, 0x02, 0xC0, 0x86, 0x05, 0x02, 0x04, 0x03, 0x13, 0x5F,
+  0xD3, 0x40, 0x83, 0xFE, 0xF6, 0xFC, 0xFE, 0x52, 0x81, 0xFD, 0xF9, 0x40, 0x84, 0xFD, 0xF4, 0xCA, 0x7C, 0x1D, 0x01, 0x81, 0x06, 0x02, 0xC0, 0x82,
+  0x02, 0x02, 0x06, 0x01, 0x82, 0x2A, 0x95, 0xE7, 0x41, 0x82, 0xFE, 0xF9, 0xFD, 0x51, 0x81, 0xFD, 0xF7, 0x41, 0x87, 0xE9, 0x97, 0x45, 0x0F, 0x03,
+  0x01, 0x06, 0x02, 0xC0, 0x00, 0x81, 0x01, 0x05, 0x01, 0x83, 0x09, 0x40, 0x99, 0xF0, 0x40, 0x82, 0xFD, 0xF4, 0xFC, 0x51, 0x81, 0xFD, 0xF8, 0x41,
+  0x87, 0xD6, 0x65, 0x13, 0x02, 0x03, 0x02, 0x04, 0x01, 0xC0, 0x00, 0x83, 0x01, 0x03, 0x01, 0x05, 0x00, 0x83, 0x0B, 0x4E, 0xBC, 0xF1, 0x40, 0x83,
+  0xFA, 0xFD, 0xFC, 0xFE, 0x4E, 0x82, 0xFD, 0xFD, 0xFB, 0x40, 0x82, 0xFA, 0xBC, 0x41, 0x01, 0x83, 0x05, 0x02, 0x02, 0x01, 0xC0, 0x01, 0x82, 0x01,
+  0x02, 0x07, 0x01, 0x83, 0x1B, 0x6B, 0xB8, 0xF5, 0x40, 0x82, 0xFD, 0xF7, 0xFD, 0x4D, 0x81, 0xFE, 0xFB, 0x40, 0x80, 0xFE, 0x40, 0x82, 0xEA, 0x9D,
+  0x29, 0x01, 0x81, 0x07, 0x02, 0xC0, 0x02, 0x88, 0x02, 0x06, 0x02, 0x03, 0x04, 0x28, 0x72, 0xD2, 0xFB, 0x40, 0x82, 0xF8, 0xFD, 0xFE, 0x4C, 0x81,
+  0xFE, 0xF9, 0x41, 0x87, 0xFA, 0xD5, 0x83, 0x20, 0x02, 0x01, 0x08, 0x02, 0xC0, 0x02, 0x83, 0x01, 0x02, 0x02, 0x06, 0x00, 0x88, 0x05, 0x2F, 0x91,
+  0xDA, 0xFA, 0xFB, 0xFD, 0xFA, 0xFD, 0x4B, 0x81, 0xFD, 0xF8, 0x41, 0x83, 0xF4, 0xC2, 0x6F, 0x1A, 0x01, 0x81, 0x08, 0x02, 0xC0, 0x04, 0x82, 0x02,
+  0x08, 0x02, 0x00, 0x83, 0x0A, 0x4B, 0x9D, 0xE9, 0x41, 0x81, 0xF8, 0xFD, 0x4B, 0x81, 0xFD, 0xF8, 0x41, 0x83, 0xF1, 0xB9, 0x69, 0x1A, 0x01, 0x81,
+  0x08, 0x02, 0xC0, 0x04, 0x83, 0x01, 0x03, 0x02, 0x03, 0x00, 0x83, 0x10, 0x4F, 0xC0, 0xFE, 0x40, 0x83, 0xF9, 0xFD, 0xFE, 0xFE, 0x49, 0x81, 0xFD,
+  0xF8, 0x41, 0x83, 0xF1, 0xB6, 0x65, 0x18, 0x01, 0x81, 0x08, 0x02, 0xC0, 0x06, 0x82, 0x03, 0x0B, 0x01, 0x00, 0x83, 0x19, 0x81, 0xD8, 0xFD, 0x40,
+  0x82, 0xFE, 0xFA, 0xFE, 0x49, 0x81, 0xFD, 0xF8, 0x41, 0x83, 0xF0, 0xB4, 0x63, 0x16, 0x01, 0x81, 0x08, 0x02, 0xC0, 0x06, 0x81, 0x02, 0x07, 0x01,
+  0x83, 0x03, 0x39, 0x91, 0xEB, 0x40, 0x82, 0xFD, 0xF5, 0xFD, 0x49, 0x81, 0xFD, 0xF8, 0x40, 0x84, 0xFD, 0xEA, 0xA5, 0x55, 0x12, 0x01, 0x81, 0x08,
+  0x02, 0xC0, 0x07, 0x82, 0x03, 0x01, 0x05, 0x00, 0x83, 0x0D, 0x52, 0xC7, 0xFA, 0x40, 0x83, 0xF8, 0xFD, 0xFD, 0xFE, 0x47, 0x81, 0xFC, 0xF5, 0x41,
+  0x83, 0xEA, 0x8F, 0x3B, 0x0B, 0x01, 0x81, 0x06, 0x02, 0xC0, 0x07, 0x82, 0x01, 0x02, 0x07, 0x01, 0x87, 0x26, 0x8C, 0xD9, 0xFB, 0xFA, 0xFB, 0xF7,
+  0xFD, 0x47, 0x82, 0xFA, 0xF2, 0xFC, 0x40, 0x87, 0xE1, 0x6F, 0x1A, 0x03, 0x01, 0x01, 0x04, 0x01, 0xC0, 0x08, 0x87, 0x02, 0x07, 0x02, 0x03, 0x0F,
+  0x4B, 0x9A, 0xE7, 0x41, 0x83, 0xF9, 0xFC, 0xFD, 0xFE, 0x41, 0x85, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0x40, 0x83, 0xFB, 0xC5, 0x4B, 0x04, 0x00,
+  0x83, 0x03, 0x01, 0x02, 0x01, 0xC0, 0x08, 0x88, 0x01, 0x03, 0x02, 0x05, 0x01, 0x10, 0x4A, 0xB7, 0xF9, 0x40, 0x83, 0xFC, 0xF9, 0xF6, 0xFC, 0x40,
+  0x85, 0xFE, 0xFD, 0xFB, 0xF9, 0xF6, 0xFB, 0x41, 0x82, 0xDD, 0x8F, 0x27, 0x01, 0x81, 0x06, 0x02, 0xC0, 0x0A, 0x81, 0x02, 0x08, 0x01, 0x83, 0x15,
+  0x6C, 0xBC, 0xEF, 0x4A, 0x88, 0xFB, 0xDC, 0x99, 0x4E, 0x10, 0x02, 0x01, 0x05, 0x02, 0xC0, 0x0A, 0x81, 0x01, 0x03, 0x02, 0x83, 0x1A, 0x59, 0xB5,
+  0xF8, 0x49, 0x87, 0xD7, 0x91, 0x3E, 0x12, 0x02, 0x05, 0x02, 0x02, 0xC0, 0x0C, 0x82, 0x02, 0x07, 0x01, 0x00, 0x8F, 0x12, 0x5B, 0x9D, 0xCE, 0xE4,
+  0xF1, 0xF7, 0xFB, 0xF7, 0xEB, 0xDE, 0xCA, 0xAB, 0x79, 0x3E, 0x06, 0x01, 0x81, 0x05, 0x02, 0xC0, 0x0C, 0x82, 0x01, 0x03, 0x01, 0x01, 0x8D, 0x14,
+  0x34, 0x72, 0xA9, 0xD2, 0xEC, 0xF3, 0xE4, 0xC3, 0x94, 0x62, 0x3A, 0x1E, 0x0C, 0x02, 0x80, 0x02, 0xC0, 0x0C, 0x84, 0x01, 0x02, 0x05, 0x0A, 0x01,
+  0x01, 0x88, 0x3C, 0x86, 0xC0, 0xE5, 0xEF, 0xDA, 0xAC, 0x6A, 0x25, 0x02, 0x82, 0x03, 0x05, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_STRAWBERRY_44_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x10E1, 0x21A3, 0x21C3, 0x21C3, 0x2A03, 0x21A3, 0x1102, 0x08A1, 0x10C1, 0x21C3, 0x4325, 0x5C47,
+  0x64A8, 0x64A8, 0x5C27, 0x5386, 0x4AE5, 0x3224, 0x2122, 0x1081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x10C1, 0x21A3, 0x3284, 0x3AC5, 0x3B05, 0x4326, 0x3AC5, 0x3264, 0x29E3, 0x2A03, 0x3AC5, 0x53C6, 0x64A8, 0x6CE8,
+  0x6CE8, 0x64C8, 0x5C87, 0x4BE7, 0x3B25, 0x2A03, 0x1101, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040,
+  0x1101, 0x2A03, 0x4B66, 0x5C67, 0x64C9, 0x64E9, 0x64E9, 0x64C9, 0x6488, 0x6448, 0x6448, 0x64A8, 0x6D29, 0x756A, 0x7569, 0x6D89,
+  0x6DAA, 0x6DCA, 0x6569, 0x5CC8, 0x4385, 0x2244, 0x0942, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A1,
+  0x29E3, 0x4B86, 0x64C8, 0x7DCB, 0x862B, 0x864C, 0x8E4C, 0x862B, 0x862B, 0x862B, 0x864B, 0x862B, 0x860B, 0x7DEB, 0x7DAA, 0x7DAA,
+  0x7DAB, 0x85CB, 0x7DEB, 0x75AA, 0x64E9, 0x5427, 0x3B05, 0x21C3, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0820, 0x1901, 0x3A84, 0x5C27, 0x6D49, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x7DAA, 0x7DCB, 0x7E0B, 0x7E2B, 0x7E0B, 0x7DAA, 0x7D8A,
+  0x7D8A, 0x7D2A, 0x8C69, 0x9429, 0x8C49, 0x8CAA, 0x7CA9, 0x84E9, 0x7C68, 0x5B06, 0x2122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x1162, 0x3B46, 0x5CA8, 0x7549, 0x7549, 0x6D29, 0x6D29, 0x6D49, 0x6D69, 0x6D89, 0x6D89, 0x6D69, 0x6D69, 0x6D69, 0x6DEA,
+  0x6E0B, 0x756A, 0x8C29, 0x92E7, 0x9A66, 0xA2C7, 0xA348, 0xABC9, 0xABC9, 0x8AC7, 0x5943, 0x2821, 0x1000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1182, 0x43A6, 0x64E9, 0x7D6A, 0x7D4A, 0x7D6A, 0x6D49, 0x6DEA, 0x6DEA, 0x75CA,
+  0x7D4A, 0x84C9, 0x84C9, 0x7D4A, 0x6E0B, 0x6E6B, 0x760B, 0x84C9, 0x9B08, 0xB146, 0xB8A5, 0xB906, 0xB966, 0xB967, 0xB946, 0xA0C5,
+  0x8084, 0x5042, 0x2001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x2183, 0x5B67, 0x7CC9, 0x7D6A, 0x6D89,
+  0x75CA, 0x75EB, 0x75EB, 0x7D8A, 0x84CA, 0x93C9, 0x9B08, 0x9B28, 0x8BE9, 0x84EA, 0x7D6A, 0x7D6A, 0x84A9, 0x9B08, 0xB906, 0xC805,
+  0xC004, 0xB804, 0xB804, 0xC045, 0xC8A6, 0xB8A5, 0x90A4, 0x6063, 0x2821, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1881, 0x5164, 0x92A7, 0xA42A, 0x856A, 0x65EA, 0x6DEA, 0x75AA, 0x852A, 0x8C29, 0xA2E8, 0xB1A7, 0xB906,
+  0xB926, 0xA9C7, 0xA2A7, 0x9B08, 0x9368, 0x9368, 0xA287, 0xB946, 0xC086, 0xC065, 0xB885, 0xB864, 0xB8A6, 0xC0A6, 0xC8E6, 0xC8E6,
+  0xA8C5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x5082, 0x8905, 0xB1C6, 0xB328, 0x8C89, 0x6D09,
+  0x84E9, 0x8C09, 0x9B28, 0xA227, 0xB106, 0xC065, 0xC025, 0xC045, 0xC086, 0xB8E6, 0xB146, 0xB1A7, 0xA9E7, 0xB1A7, 0xB126, 0xB8C5,
+  0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB0A5, 0xC0C6, 0xC8A6, 0xC8C6, 0xA885, 0x6862, 0x2821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0800, 0x3821, 0x9064, 0xB8A5, 0xC126, 0xA9C6, 0x9AE8, 0x9B08, 0xA288, 0xB1A7, 0xB105, 0xB864, 0xB844, 0xB845, 0xC085,
+  0xC0A6, 0xC086, 0xC085, 0xC085, 0xC0A6, 0xB8C6, 0xB8A5, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864,
+  0xC885, 0xC8A5, 0xA885, 0x5842, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2021, 0x6843, 0xB065, 0xD0A6, 0xC0C6,
+  0xA905, 0xB166, 0xB146, 0xB8E6, 0xC065, 0xC045, 0xC066, 0xC0A6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8C6, 0xC0A6, 0xC086, 0xC065, 0xC045,
+  0xC065, 0xC0A6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A6, 0xB084, 0xA0A4, 0xB8A5, 0xD0E6, 0xC0A5, 0x8884, 0x4042, 0x0800,
+  0x0000, 0x0000, 0x1000, 0x5042, 0x9884, 0xC8C6, 0xC8C6, 0xC0A5, 0xB084, 0xC0A6, 0xC085, 0xB844, 0xC086, 0xC948, 0xD1EB, 0xCA0B,
+  0xC1A9, 0xB8E6, 0xB885, 0xB8A5, 0xC0C6, 0xC0C6, 0xB885, 0xB865, 0xC0E7, 0xC9A9, 0xC9C9, 0xC127, 0xB8C6, 0xB8C6, 0xB8A5, 0xB885,
+  0xB907, 0xB9C9, 0xCA2B, 0xD189, 0xC907, 0xA884, 0x7043, 0x2000, 0x0000, 0x0000, 0x2000, 0x7863, 0xB0A5, 0xC0E6, 0xB8C5, 0xB8C6,
+  0xB8A5, 0xC0A6, 0xC045, 0xB824, 0xC127, 0xD30E, 0xE412, 0xDBB0, 0xD24C, 0xC0E6, 0xB844, 0xB8A5, 0xB907, 0xB906, 0xB8C5, 0xB8A5,
+  0xC188, 0xD30E, 0xDB0E, 0xC9C9, 0xB8C5, 0xB8A5, 0xB885, 0xB885, 0xC9CA, 0xE3B1, 0xE412, 0xCA6B, 0xC927, 0xC0A5, 0x8863, 0x3021,
+  0x0000, 0x0000, 0x0000, 0x3021, 0x8864, 0xC0C6, 0xC0C6, 0xB0A5, 0xB8E6, 0xC0E6, 0xC107, 0xB865, 0xB003, 0xC188, 0xE412, 0xF557,
+  0xEC94, 0xD2AD, 0xC0E6, 0xB844, 0xB8A5, 0xC107, 0xB8E6, 0xB885, 0xB864, 0xC9EA, 0xE3F1, 0xE412, 0xCA2B, 0xB885, 0xB865, 0xB865,
+  0xB8A5, 0xD2AD, 0xF536, 0xF577, 0xD30D, 0xC927, 0xC8A5, 0x9864, 0x4021, 0x0000, 0x0000, 0x0000, 0x0000, 0x3842, 0x9084, 0xC8C6,
+  0xC0C6, 0xB084, 0xB8A5, 0xB8A5, 0xB8E6, 0xB885, 0xB044, 0xC189, 0xE3F2, 0xF4F5, 0xE3F2, 0xCA2B, 0xB8C6, 0xB844, 0xB8A5, 0xC0E6,
+  0xC0C6, 0xB885, 0xB865, 0xC9C9, 0xDBB0, 0xE3B1, 0xC9EA, 0xB885, 0xB864, 0xB885, 0xB8C6, 0xD2CD, 0xF516, 0xF516, 0xCAAC, 0xC0E6,
+  0xC8A5, 0xA084, 0x4842, 0x0820, 0x0000, 0x0000, 0x0800, 0x4022, 0xA0A5, 0xD0E6, 0xC0E6, 0xB084, 0xB864, 0xB864, 0xB8A5, 0xB885,
+  0xB864, 0xC148, 0xD2AD, 0xDB2F, 0xD26C, 0xC148, 0xB885, 0xB864, 0xB8A5, 0xC0E6, 0xB8C6, 0xB8A5, 0xB8A5, 0xC148, 0xCA2B, 0xD22B,
+  0xC148, 0xB885, 0xB885, 0xB8A5, 0xB8E6, 0xCA0B, 0xDB70, 0xDB4F, 0xC188, 0xC0A5, 0xC8A6, 0xA0A5, 0x4842, 0x0800, 0x0000, 0x0800,
+  0x4842, 0xA0A5, 0xD0C6, 0xC0C6, 0xB0A5, 0xC107, 0xC107, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8E6, 0xC168, 0xC168, 0xC107, 0xB8A5, 0xB885,
+  0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xC107, 0xC0E6, 0xB8C6, 0xB8A5, 0xB8A6, 0xB8C6, 0xB8C6, 0xC127, 0xC9A9,
+  0xC168, 0xB8C5, 0xC0A5, 0xC8C6, 0x98A4, 0x3842, 0x0000, 0x0000, 0x1000, 0x4842, 0xA0A5, 0xD0C6, 0xC085, 0xB906, 0xCA4B, 0xD28C,
+  0xC9A9, 0xC0E6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8A5, 0xB8C6, 0xC107, 0xC107, 0xB8C6, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6,
+  0xB8A5, 0xB8A5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB085, 0xC0C6, 0xC0C6, 0x8884, 0x2821, 0x0000,
+  0x0000, 0x0000, 0x0800, 0x4842, 0xA0A5, 0xC8A5, 0xC044, 0xB926, 0xDB2F, 0xE412, 0xDB4F, 0xCA0A, 0xC0E6, 0xB844, 0xB864, 0xB885,
+  0xB885, 0xC168, 0xD28C, 0xD28C, 0xC188, 0xB8C5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5,
+  0xB885, 0xB864, 0xA823, 0xB864, 0xB8A5, 0xC8E6, 0xA8A5, 0x7063, 0x2000, 0x0000, 0x0000, 0x0000, 0x3841, 0x98C4, 0xC8A5, 0xB824,
+  0xB906, 0xDB2F, 0xECB4, 0xECB4, 0xDB4F, 0xC127, 0xB023, 0xB885, 0xB8A5, 0xB885, 0xCA0A, 0xE433, 0xEC94, 0xD2AD, 0xC107, 0xB885,
+  0xB8A5, 0xB8C6, 0xB8E6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C5, 0xB8A5, 0xB885, 0xB885, 0xB064, 0xC0A5, 0xC8C6, 0xB8A5, 0x9084,
+  0x5042, 0x1000, 0x0000, 0x0000, 0x2841, 0x80A4, 0xB884, 0xC064, 0xB8C5, 0xD24B, 0xDBD1, 0xE453, 0xDB4F, 0xC148, 0xB844, 0xB8C6,
+  0xB8C6, 0xB885, 0xCA2B, 0xECD4, 0xF556, 0xDB4F, 0xC168, 0xB885, 0xB864, 0xB8A5, 0xC0E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8A5, 0xB885,
+  0xC0E6, 0xC9A9, 0xCA2B, 0xC1EA, 0xC989, 0xD0E7, 0xB064, 0x7042, 0x2841, 0x0800, 0x0000, 0x0000, 0x0000, 0x1820, 0x6063, 0xA0A5,
+  0xC085, 0xC0A5, 0xC127, 0xB9A8, 0xD26C, 0xCA0A, 0xC107, 0xB885, 0xB8E6, 0xB8C6, 0xB865, 0xC9A9, 0xE3B1, 0xEC53, 0xDB0E, 0xC189,
+  0xB8A5, 0xB864, 0xB8A5, 0xC0E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB885, 0xB844, 0xC168, 0xDB4F, 0xE453, 0xDBD0, 0xDA6C, 0xD0E7, 0x9003,
+  0x4001, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3821, 0x7863, 0xB8A5, 0xD0C6, 0xC085, 0xB064, 0xB8C6,
+  0xC0E6, 0xC0E6, 0xB8C6, 0xB8C6, 0xB864, 0xB824, 0xB8E6, 0xCA2B, 0xD2AD, 0xCA2B, 0xC148, 0xB8C6, 0xB885, 0xB885, 0xB8A5, 0xB885,
+  0xB8A5, 0xB8E6, 0xB885, 0xB844, 0xC9C9, 0xE453, 0xF598, 0xEC53, 0xDA8D, 0xB8C5, 0x7802, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0800, 0x4842, 0x9884, 0xC8C6, 0xC0A5, 0xB064, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB885, 0xB844, 0xB023,
+  0xB865, 0xB8E6, 0xC127, 0xC107, 0xB8E6, 0xB8C6, 0xB8A5, 0xB8A5, 0xB8A5, 0xB885, 0xB8A5, 0xB8C6, 0xB885, 0xB844, 0xC9C9, 0xDBF1,
+  0xF4F5, 0xEBB1, 0xD1EA, 0x9084, 0x5001, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x6842, 0xA8A5, 0xC8E6, 0xC8E6,
+  0xC0A6, 0xB084, 0xB8A5, 0xB8C6, 0xC107, 0xC127, 0xC107, 0xB8A6, 0xB864, 0xB864, 0xB885, 0xB8A5, 0xB885, 0xC0E6, 0xC168, 0xC9EA,
+  0xC9EA, 0xC188, 0xC0E6, 0xB864, 0xB885, 0xC168, 0xCAAC, 0xDB0F, 0xE24C, 0xB127, 0x7042, 0x2800, 0x0800, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x2821, 0x6863, 0xB0A5, 0xD0E7, 0xC0E6, 0xB064, 0xB864, 0xC0E6, 0xC9EA, 0xD2AD, 0xD28C, 0xC9A9,
+  0xB8A5, 0xB844, 0xB8A5, 0xB8A5, 0xB864, 0xC107, 0xD2AD, 0xE3F1, 0xE412, 0xDAEE, 0xC148, 0xB864, 0xB8A5, 0xC127, 0xB926, 0xC948,
+  0xD107, 0xA0A5, 0x4842, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3821, 0x8884,
+  0xB8C5, 0xC907, 0xB884, 0xB864, 0xB8C6, 0xCA2B, 0xDB70, 0xE412, 0xDB2F, 0xC189, 0xB8A5, 0xB8E6, 0xB8A5, 0xB023, 0xC127, 0xDB2F,
+  0xF516, 0xF577, 0xE412, 0xC989, 0xB024, 0xB064, 0xB8A5, 0xB023, 0xC044, 0xB844, 0x8863, 0x2821, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1000, 0x4042, 0x88A4, 0xC0C6, 0xC8C6, 0xB885, 0xB084, 0xC168, 0xDB0E, 0xEC94, 0xE433, 0xCA2B, 0xB8C6,
+  0xB8C6, 0xB885, 0xB024, 0xC107, 0xD2EE, 0xEC94, 0xF536, 0xE3F2, 0xC989, 0xB023, 0xA802, 0xB884, 0xC064, 0xC085, 0xA084, 0x7063,
+  0x1800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x5042, 0x9884, 0xC0A5, 0xC8C6, 0xB084, 0xB8C6, 0xC9EA,
+  0xDB90, 0xDB90, 0xCA0B, 0xC0C6, 0xB8A6, 0xB885, 0xB864, 0xC0E6, 0xC9EA, 0xDB0E, 0xDB90, 0xD2CD, 0xC127, 0xB864, 0xB0A5, 0xC148,
+  0xC948, 0xC0E6, 0xA0A5, 0x5842, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2001, 0x6063,
+  0xA0A5, 0xC0A5, 0xC0A5, 0xB8A5, 0xB0C5, 0xC168, 0xC989, 0xC127, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8C6, 0xC0E6, 0xC127, 0xC168, 0xC189,
+  0xC127, 0xB885, 0xB8E6, 0xC20A, 0xDACD, 0xDA4B, 0xC947, 0x9064, 0x4801, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x3021, 0x7063, 0xB0C5, 0xD0E6, 0xC0A5, 0xB043, 0xB044, 0xB844, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8C6, 0xB8A5, 0xB885, 0xB864, 0xB864,
+  0xB885, 0xB844, 0xB824, 0xC189, 0xDBB0, 0xEC73, 0xE30E, 0xC147, 0x8843, 0x4001, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0800, 0x3821, 0x9084, 0xC0C6, 0xC0C6, 0xB084, 0xB885, 0xB885, 0xB8A5, 0xB8C6, 0xB8C6, 0xB8A5, 0xB864, 0xB844, 0xB844,
+  0xB864, 0xB885, 0xB844, 0xB844, 0xCA0B, 0xE494, 0xF536, 0xEB2F, 0xB927, 0x8043, 0x4001, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x1000, 0x5842, 0x98A5, 0xC0C6, 0xC8E6, 0xC0E6, 0xB0C5, 0xB8C6, 0xB8A6, 0xB8A5, 0xC0E6, 0xC148, 0xC168, 0xC147, 0xB8E6,
+  0xB8E6, 0xB885, 0xB885, 0xC9EA, 0xDBF1, 0xEC53, 0xE28C, 0xB8C6, 0x8043, 0x4021, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x2021, 0x6063, 0xA8A5, 0xD0E6, 0xC0C6, 0xB0A5, 0xB8C6, 0xB8A5, 0xB865, 0xC168, 0xDAEE, 0xDB90, 0xD2AD, 0xC188, 0xB8C6, 0xB864,
+  0xB8A5, 0xC168, 0xC22A, 0xD24B, 0xD168, 0xB085, 0x7863, 0x3842, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3821,
+  0x9084, 0xC8A5, 0xC8C6, 0xB8A5, 0xB8E6, 0xB885, 0xB044, 0xC9A9, 0xE412, 0xF536, 0xE432, 0xD26C, 0xB8E6, 0xB844, 0xB8A5, 0xB8E6,
+  0xB0C5, 0xC0C6, 0xD0C6, 0xA884, 0x6863, 0x2821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x6062, 0xA0A5, 0xC0A5,
+  0xC0A5, 0xB8C5, 0xA863, 0xB024, 0xC989, 0xE3F2, 0xF557, 0xECB4, 0xD2EE, 0xC107, 0xB844, 0xB885, 0xB0C5, 0xA884, 0xC085, 0xD0C6,
+  0xA8A5, 0x5042, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3021, 0x7063, 0xB0A5,
+  0xD0E6, 0xC8E6, 0xB064, 0xB864, 0xC127, 0xD2CD, 0xE3D1, 0xDB90, 0xD26C, 0xC107, 0xB864, 0xB8A5, 0xC0E6, 0xB8A5, 0xC8C6, 0xC0A5,
+  0x8884, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3021, 0x8084, 0xB8A5,
+  0xD0E6, 0xC8C6, 0xB084, 0xB0A5, 0xC147, 0xC189, 0xC1A9, 0xC148, 0xB0A5, 0xB084, 0xB084, 0xB8C5, 0xD0E6, 0xD0C6, 0xA8A5, 0x6043,
+  0x1800, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x4842, 0x9084, 0xB8A5, 0xD0E6, 0xC8C6, 0xB8A5, 0xB865, 0xB864, 0xB864, 0xB885,
+  0xC0C6, 0xC0C6, 0xC0C6, 0xC8E6, 0xC8C6, 0xA8C5, 0x7063, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000,
+  0x3842, 0x8884, 0xB8A5, 0xD0E7, 0xD0C6, 0xC8A5, 0xB885, 0xB885, 0xC0A5, 0xC8C6, 0xD0E6, 0xD0E6, 0xC8C6, 0xA8A5, 0x6863, 0x3021,
+  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x3822, 0x7863, 0xA084, 0xB0A5, 0xB0C5, 0xB8A5, 0xB8A5,
+  0xB8A5, 0xA8A5, 0xA8A5, 0x9084, 0x7863, 0x5042, 0x2821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x2821, 0x5042,
+  0x7863, 0x9884, 0xB0A5, 0xB0A5, 0xA8A5, 0x9084, 0x7063, 0x4842, 0x2821, 0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x2821, 0x6063, 0x8864, 0xA8A5, 0xB0A5, 0x98A5, 0x7884, 0x4842, 0x1800, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_STRAWBERRY_44_SPANS = {
+  SPRITE_STRAWBERRY_44_SPAN_ROWS, SPRITE_STRAWBERRY_44_SPAN_OPS, SPRITE_STRAWBERRY_44_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_STRAWBERRY_44_ASSET = {
   SPRITE_STRAWBERRY_44_WIDTH, SPRITE_STRAWBERRY_44_HEIGHT,
-  SPRITE_STRAWBERRY_44_ALPHA, SPRITE_STRAWBERRY_44_RGB565
+  nullptr, nullptr, &SPRITE_STRAWBERRY_44_SPANS
 };
 
 #endif // SPRITE_STRAWBERRY_44_INCLUDED
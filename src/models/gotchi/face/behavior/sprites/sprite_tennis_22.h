@@ -5,66 +5,73 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from tennis_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from tennis_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 436/484 pixels visibles, 1264 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_TENNIS_22_WIDTH = 22;
 constexpr uint16_t SPRITE_TENNIS_22_HEIGHT = 22;
 
-const uint16_t SPRITE_TENNIS_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x554A, 0x0000, 0x0000, 0x7D8B, 0x75AA, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x75AA, 0x7D8B, 0x0000, 0x0000, 0x554A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xAFF5, 0x0000, 0x85AD, 0x7DAA, 0x7DAA, 0x7DCB, 0x7DCB, 0x7D8A, 0x758A, 0x758A, 0x7D8A, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x85AD, 0x0000, 0xAFF5, 0x0000, 0x0000,
-  0x0000, 0x7FEF, 0x0000, 0x7589, 0x758A, 0x860B, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x860B, 0x758A, 0x7589, 0x0000, 0x7FEF, 0x0000,
-  0xFFFF, 0x0000, 0xFFFF, 0xF7BD, 0xA670, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xA670, 0xF7BD, 0xFFFF, 0x0000, 0xFFFF,
-  0xFFFF, 0xAEF3, 0xAEB2, 0xE7BB, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xE7BB, 0xAEB2, 0xAEF3, 0xFFFF,
-  0x0000, 0xA690, 0xB712, 0xA690, 0xF7DD, 0xDF5A, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xDF5A, 0xF7DD, 0xA690, 0xB712, 0xA690, 0x0000,
-  0xA6B0, 0xA6B1, 0xAEB1, 0xA690, 0xC715, 0xFFFF, 0x8DED, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DED, 0xFFFF, 0xC715, 0xA690, 0xAEB1, 0xA6B1, 0xA6B0,
-  0xA6B1, 0xAEF1, 0xA691, 0xA690, 0xAEB1, 0xFFFF, 0xB693, 0x6D69, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xB693, 0xFFFF, 0xAEB1, 0xA690, 0xA691, 0xAEF1, 0xA6B1,
-  0xA690, 0xAED1, 0xA691, 0xA691, 0xA690, 0xF7DD, 0xCF18, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xCF18, 0xF7DD, 0xA690, 0xA691, 0xA691, 0xAED1, 0xA690,
-  0xA690, 0xA6B1, 0xA691, 0xA6B1, 0x9E6F, 0xE79B, 0xDF5A, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF5A, 0xE79B, 0x9E6F, 0xA6B1, 0xA691, 0xA6B1, 0xA690,
-  0xA691, 0xA691, 0xA691, 0xA6B1, 0x9E6F, 0xE79A, 0xE77B, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF7A, 0xE79A, 0x9E6F, 0xA6B1, 0xA691, 0xA691, 0xA691,
-  0xA691, 0xA691, 0xA691, 0xA6B1, 0x9E6F, 0xE79A, 0xE77B, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF7A, 0xE79A, 0x9E6F, 0xA6B1, 0xA691, 0xA691, 0xA691,
-  0xA690, 0xA6B1, 0xA691, 0xA6B1, 0x9E6F, 0xE79B, 0xDF5A, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF5A, 0xE79B, 0x9E6F, 0xA6B1, 0xA691, 0xA6B1, 0xA690,
-  0xA690, 0xAED1, 0xA691, 0xA691, 0xA690, 0xF7DD, 0xCF18, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xCF18, 0xF7DD, 0xA690, 0xA691, 0xA691, 0xAED1, 0xA690,
-  0xA6B1, 0xAEF1, 0xA691, 0xA690, 0xAEB1, 0xFFFF, 0xB693, 0x6D69, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xB693, 0xFFFF, 0xAEB1, 0xA690, 0xA691, 0xAEF1, 0xA6B1,
-  0xA6B0, 0xA6B1, 0xAEB1, 0xA690, 0xC715, 0xFFFF, 0x8DED, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DED, 0xFFFF, 0xC715, 0xA690, 0xAEB1, 0xA6B1, 0xA6B0,
-  0x0000, 0xA690, 0xB712, 0xA690, 0xF7DD, 0xDF5A, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xDF5A, 0xF7DD, 0xA690, 0xB712, 0xA690, 0x0000,
-  0xFFFF, 0xAEF3, 0xAEB2, 0xE7BB, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xE7BB, 0xAEB2, 0xAEF3, 0xFFFF,
-  0xFFFF, 0x0000, 0xFFFF, 0xF7BD, 0xA670, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xA670, 0xF7BD, 0xFFFF, 0x0000, 0xFFFF,
-  0x0000, 0x7FEF, 0x0000, 0x7589, 0x758A, 0x860B, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x860B, 0x758A, 0x7589, 0x0000, 0x7FEF, 0x0000,
-  0x0000, 0x0000, 0xAFF5, 0x0000, 0x85AD, 0x7DAA, 0x7DAA, 0x7DCB, 0x7DCB, 0x7D8A, 0x758A, 0x758A, 0x7D8A, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x85AD, 0x0000, 0xAFF5, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x554A, 0x0000, 0x0000, 0x7D8B, 0x75AA, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x75AA, 0x7D8B, 0x0000, 0x0000, 0x554A, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_TENNIS_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 19, 12, 36, 28, 59, 46, 81, 66, 97, 88, 110, 108, 122, 130,
+  134, 152, 144, 174, 150, 196, 152, 218, 154, 240, 160, 262, 170, 284, 182, 306,
+  194, 328, 207, 348, 223, 370, 245, 390, 268, 408, 285, 424
 };
 
-const uint8_t SPRITE_TENNIS_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x28, 0x84, 0xCB, 0xF4, 0xFF, 0xFF, 0xF4, 0xCB, 0x84, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x11, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x11, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x31, 0xDA, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xDA, 0x31, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x2F, 0xED, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xED, 0x2F, 0x00, 0x02,
-  0x02, 0x10, 0xDD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDD, 0x10, 0x02,
-  0x00, 0x91, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x91, 0x00,
-  0x24, 0xF5, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF5, 0x24,
-  0x84, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x84,
-  0xCB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCB,
-  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xCB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCB,
-  0x84, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x84,
-  0x24, 0xF5, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF5, 0x24,
-  0x00, 0x91, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x91, 0x00,
-  0x02, 0x10, 0xDD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDD, 0x10, 0x02,
-  0x02, 0x00, 0x2F, 0xED, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xED, 0x2F, 0x00, 0x02,
-  0x00, 0x02, 0x00, 0x31, 0xDA, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xDA, 0x31, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x11, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x11, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x28, 0x84, 0xCB, 0xF4, 0xFF, 0xFF, 0xF4, 0xCB, 0x84, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00
+const uint8_t SPRITE_TENNIS_22_SPAN_OPS[] PROGMEM = {
+  0x02, 0x80, 0x03, 0x01, 0x83, 0x28, 0x84, 0xCB, 0xF4, 0x41, 0x83, 0xF4, 0xCB, 0x84, 0x28, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82,
+  0x11, 0x8F, 0xF0, 0x47, 0x82, 0xF0, 0x8F, 0x11, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x31, 0xDA, 0x41, 0x81, 0xFC, 0xFD, 0x43,
+  0x81, 0xFD, 0xFC, 0x41, 0x81, 0xDA, 0x31, 0x00, 0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x2F, 0xED, 0x40, 0x81, 0xFA, 0xFE, 0x47, 0x81, 0xFE,
+  0xFA, 0x40, 0x81, 0xED, 0x2F, 0x00, 0x80, 0x02, 0xC0, 0x82, 0x02, 0x10, 0xDD, 0x40, 0x80, 0xFB, 0x4B, 0x80, 0xFB, 0x40, 0x82, 0xDD, 0x10, 0x02,
+  0xC0, 0x00, 0x80, 0x91, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFB, 0x40, 0x80, 0x91, 0xC0, 0x83, 0x24, 0xF5, 0xFD, 0xFE, 0x4D, 0x83, 0xFE, 0xFD, 0xF5,
+  0x24, 0xC0, 0x80, 0x84, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0x84, 0xC0, 0x82, 0xCB, 0xFE, 0xFD, 0x4F, 0x82, 0xFD, 0xFE, 0xCB, 0xC0,
+  0x80, 0xF4, 0x53, 0x80, 0xF4, 0xC0, 0x55, 0xC0, 0x55, 0xC0, 0x80, 0xF4, 0x53, 0x80, 0xF4, 0xC0, 0x82, 0xCB, 0xFE, 0xFD, 0x4F, 0x82, 0xFD, 0xFE,
+  0xCB, 0xC0, 0x80, 0x84, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0x84, 0xC0, 0x83, 0x24, 0xF5, 0xFD, 0xFE, 0x4D, 0x83, 0xFE, 0xFD, 0xF5,
+  0x24, 0xC0, 0x00, 0x80, 0x91, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFB, 0x40, 0x80, 0x91, 0xC0, 0x82, 0x02, 0x10, 0xDD, 0x40, 0x80, 0xFB, 0x4B, 0x80,
+  0xFB, 0x40, 0x82, 0xDD, 0x10, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x2F, 0xED, 0x40, 0x81, 0xFA, 0xFE, 0x47, 0x81, 0xFE, 0xFA, 0x40, 0x81, 0xED,
+  0x2F, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x31, 0xDA, 0x41, 0x81, 0xFC, 0xFD, 0x43, 0x81, 0xFD, 0xFC, 0x41, 0x81, 0xDA, 0x31,
+  0x00, 0x80, 0x02, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82, 0x11, 0x8F, 0xF0, 0x47, 0x82, 0xF0, 0x8F, 0x11, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03,
+  0x01, 0x83, 0x28, 0x84, 0xCB, 0xF4, 0x41, 0x83, 0xF4, 0xCB, 0x84, 0x28, 0x01, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_TENNIS_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x10C1, 0x3AE5, 0x5447, 0x6D49, 0x758A, 0x758A, 0x6D49, 0x5447, 0x3AE5, 0x10C1, 0x0000, 0x0000, 0x0840, 0x4325, 0x7549,
+  0x7DCB, 0x7DCB, 0x7D8A, 0x758A, 0x758A, 0x7D8A, 0x7DCB, 0x7DCB, 0x7549, 0x4325, 0x0840, 0x0000, 0x0000, 0x1101, 0x5CA8, 0x860B,
+  0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x860B, 0x5CA8, 0x1101, 0x0000, 0x0000, 0x2965,
+  0xE73B, 0xA670, 0x6528, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6528, 0xA670, 0xE73B,
+  0x2965, 0x0000, 0x0000, 0x0861, 0x95CF, 0xE7BB, 0xF7BE, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x7D8A, 0x7569, 0x8DEE, 0xF7BE, 0xE7BB, 0x95CF, 0x0861, 0x0000, 0x5BA9, 0xB712, 0x9E4F, 0xF7DD, 0xDF5A, 0x7569, 0x7D8A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xDF5A, 0xF7DD, 0x9E4F, 0xB712, 0x5BA9, 0x1902, 0x9E70, 0xAEB1, 0xA690,
+  0xC715, 0xFFFF, 0x8DED, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DED, 0xFFFF, 0xC715, 0xA690, 0xAEB1,
+  0x9E70, 0x1902, 0x5389, 0xAEF1, 0xA691, 0xA690, 0xAEB1, 0xFFFF, 0xB693, 0x6D69, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B,
+  0x6D69, 0xB693, 0xFFFF, 0xAEB1, 0xA690, 0xA691, 0xAEF1, 0x5389, 0x7D0C, 0xAED1, 0xA691, 0xA691, 0xA690, 0xF7DD, 0xCF18, 0x6D69,
+  0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xCF18, 0xF7DD, 0xA690, 0xA691, 0xA691, 0xAED1, 0x7D0C, 0x9E4F, 0xA6B1,
+  0xA691, 0xA6B1, 0x9E6F, 0xE79B, 0xDF5A, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF5A, 0xE79B, 0x9E6F,
+  0xA6B1, 0xA691, 0xA6B1, 0x9E4F, 0xA691, 0xA691, 0xA691, 0xA6B1, 0x9E6F, 0xE79A, 0xE77B, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x7D8A, 0x6D69, 0xDF7A, 0xE79A, 0x9E6F, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0x9E6F, 0xE79A,
+  0xE77B, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF7A, 0xE79A, 0x9E6F, 0xA6B1, 0xA691, 0xA691, 0xA691,
+  0x9E4F, 0xA6B1, 0xA691, 0xA6B1, 0x9E6F, 0xE79B, 0xDF5A, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xDF5A,
+  0xE79B, 0x9E6F, 0xA6B1, 0xA691, 0xA6B1, 0x9E4F, 0x7D0C, 0xAED1, 0xA691, 0xA691, 0xA690, 0xF7DD, 0xCF18, 0x6D69, 0x7D8A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xCF18, 0xF7DD, 0xA690, 0xA691, 0xA691, 0xAED1, 0x7D0C, 0x5389, 0xAEF1, 0xA691, 0xA690,
+  0xAEB1, 0xFFFF, 0xB693, 0x6D69, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xB693, 0xFFFF, 0xAEB1, 0xA690, 0xA691,
+  0xAEF1, 0x5389, 0x1902, 0x9E70, 0xAEB1, 0xA690, 0xC715, 0xFFFF, 0x8DED, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A,
+  0x7569, 0x8DED, 0xFFFF, 0xC715, 0xA690, 0xAEB1, 0x9E70, 0x1902, 0x5BA9, 0xB712, 0x9E4F, 0xF7DD, 0xDF5A, 0x7569, 0x7D8A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xDF5A, 0xF7DD, 0x9E4F, 0xB712, 0x5BA9, 0x0000, 0x0861, 0x95CF, 0xE7BB,
+  0xF7BE, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xF7BE, 0xE7BB, 0x95CF,
+  0x0861, 0x0000, 0x0000, 0x2965, 0xE73B, 0xA670, 0x6528, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x7D8A, 0x6528, 0xA670, 0xE73B, 0x2965, 0x0000, 0x0000, 0x1101, 0x5CA8, 0x860B, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x7D8A, 0x860B, 0x5CA8, 0x1101, 0x0000, 0x0000, 0x0840, 0x4325, 0x7549, 0x7DCB, 0x7DCB, 0x7D8A, 0x758A,
+  0x758A, 0x7D8A, 0x7DCB, 0x7DCB, 0x7549, 0x4325, 0x0840, 0x0000, 0x0000, 0x10C1, 0x3AE5, 0x5447, 0x6D49, 0x758A, 0x758A, 0x6D49,
+  0x5447, 0x3AE5, 0x10C1, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_TENNIS_22_SPANS = {
+  SPRITE_TENNIS_22_SPAN_ROWS, SPRITE_TENNIS_22_SPAN_OPS, SPRITE_TENNIS_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_TENNIS_22_ASSET = {
   SPRITE_TENNIS_22_WIDTH, SPRITE_TENNIS_22_HEIGHT,
-  SPRITE_TENNIS_22_ALPHA, SPRITE_TENNIS_22_RGB565
+  nullptr, nullptr, &SPRITE_TENNIS_22_SPANS
 };
 
 #endif // SPRITE_TENNIS_22_INCLUDED
@@ -5,94 +5,129 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from tennis_36.png (36x36)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from tennis_36.png (36x36) — RGBA multi-couleur, encodé en spans
+// 1136/1296 pixels visibles, 2976 bytes flash (flat : 3888). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_TENNIS_36_WIDTH = 36;
 constexpr uint16_t SPRITE_TENNIS_36_HEIGHT = 36;
 
-const uint16_t SPRITE_TENNIS_36_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x554A, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0x554A, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xFFFF, 0x0000, 0x7589, 0x75AA, 0x7DAA, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x75AA, 0x7589, 0x0000, 0xFFFF, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x7DAA, 0x7DAA, 0x85EB, 0x7DCB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DCB, 0x85EB, 0x7DAA, 0x7DAA, 0x0000, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0x7D6B, 0x7DAA, 0x7DEB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DEB, 0x7DAA, 0x7D6B, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x9E30, 0x758A, 0x7DEB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DEB, 0x758A, 0x9E30, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFDF, 0xCF57, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xCF57, 0xFFDF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0xFFFF, 0x0000, 0x8E2D, 0xE79A, 0xFFFF, 0xFFFF, 0xD738, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xD738, 0xFFFF, 0xFFFF, 0xE79A, 0x8E2D, 0x0000, 0xFFFF, 0x0000,
-  0xFFE0, 0xAD55, 0x7BEF, 0xA690, 0xAF11, 0xCF36, 0xFFFF, 0xFFFF, 0xBED5, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xBED5, 0xFFFF, 0xFFFF, 0xCF36, 0xAF11, 0xA690, 0x7BEF, 0xAD4A, 0xFFE0,
-  0xAFF5, 0x0000, 0xA691, 0xB712, 0xA691, 0x9E6F, 0xD758, 0xFFFF, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xFFFF, 0xD758, 0x9E6F, 0xA691, 0xB712, 0xA691, 0x0000, 0xAFF5,
-  0x0000, 0x9E6F, 0xA690, 0xAED1, 0xA691, 0xA691, 0xA690, 0xEFBC, 0xFFFF, 0xC6F7, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xC6F7, 0xFFFF, 0xEFBC, 0xA690, 0xA691, 0xA691, 0xAED1, 0xA690, 0x9E6E, 0x0000,
-  0x0000, 0xA690, 0xB712, 0xA690, 0xA691, 0xAEB1, 0xA690, 0xC716, 0xFFFF, 0xF7DE, 0x85AC, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x85AC, 0xF7DE, 0xFFFF, 0xC716, 0xA690, 0xAEB1, 0xA691, 0xA690, 0xB712, 0xA690, 0x0000,
-  0xCE73, 0xA690, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA690, 0xAEB2, 0xF7DE, 0xFFFF, 0xA651, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xA651, 0xFFFF, 0xF7DE, 0xAEB2, 0xA690, 0xA691, 0xA691, 0xA691, 0xAED1, 0xA690, 0xCE73,
-  0xA691, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xDF7A, 0xFFFF, 0xC6D6, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xC6D6, 0xFFFF, 0xDF7A, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA691,
-  0xA690, 0xAEF1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA68F, 0xCF37, 0xFFFF, 0xD739, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0xD739, 0xFFFF, 0xCF37, 0xA68F, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEF1, 0xA690,
-  0xA691, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA690, 0xC715, 0xFFFF, 0xEF9C, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0xEF9C, 0xFFFF, 0xC715, 0xA690, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAED1, 0xA691,
-  0xA691, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xBED3, 0xFFFF, 0xF7DE, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0xF7DE, 0xFFFF, 0xBED3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA691,
-  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDF, 0x7DAB, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDF, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
-  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDE, 0x7DAB, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDE, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
-  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFFF, 0x85CC, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDE, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
-  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDE, 0x7DAB, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDF, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
-  0xA691, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xBED3, 0xFFFF, 0xF7DE, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0xF7DE, 0xFFFF, 0xBED3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA691,
-  0xA691, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA690, 0xC715, 0xFFFF, 0xEF9C, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0xEF9C, 0xFFFF, 0xC715, 0xA690, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAED1, 0xA691,
-  0xA690, 0xAEF1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA68F, 0xCF37, 0xFFFF, 0xD739, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0xD739, 0xFFFF, 0xCF37, 0xA68F, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEF1, 0xA690,
-  0xA691, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xDF7A, 0xFFFF, 0xC6D6, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xC6D6, 0xFFFF, 0xDF7A, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA691,
-  0xCE73, 0xA690, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA690, 0xAEB2, 0xF7DE, 0xFFFF, 0xA651, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xA651, 0xFFFF, 0xF7DE, 0xAEB2, 0xA690, 0xA691, 0xA691, 0xA691, 0xAED1, 0xA690, 0xCE73,
-  0x0000, 0xA690, 0xB712, 0xA690, 0xA691, 0xAEB1, 0xA690, 0xC716, 0xFFFF, 0xF7DE, 0x85AC, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x85AC, 0xF7DE, 0xFFFF, 0xC716, 0xA690, 0xAEB1, 0xA691, 0xA690, 0xB712, 0xA690, 0x0000,
-  0x0000, 0x9E6F, 0xA690, 0xAED1, 0xA691, 0xA691, 0xA690, 0xEFBC, 0xFFFF, 0xC6F7, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xC6F7, 0xFFFF, 0xEFBC, 0xA690, 0xA691, 0xA691, 0xAED1, 0xA690, 0x9E6E, 0x0000,
-  0xAFF5, 0x0000, 0xA691, 0xB712, 0xA691, 0x9E6F, 0xD758, 0xFFFF, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xFFFF, 0xD758, 0x9E6F, 0xA691, 0xB712, 0xA691, 0x0000, 0xAFF5,
-  0xFFE0, 0xAD55, 0x7BEF, 0xA690, 0xAF11, 0xCF36, 0xFFFF, 0xFFFF, 0xBED5, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xBED5, 0xFFFF, 0xFFFF, 0xCF36, 0xAF11, 0xA690, 0x7BEF, 0xAD4A, 0xFFE0,
-  0x0000, 0xFFFF, 0x0000, 0x8E2D, 0xE79A, 0xFFFF, 0xFFFF, 0xD738, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xD738, 0xFFFF, 0xFFFF, 0xE79A, 0x8E2D, 0x0000, 0xFFFF, 0x0000,
-  0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFDF, 0xCF57, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xCF57, 0xFFDF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x9E30, 0x758A, 0x7DEB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DEB, 0x758A, 0x9E30, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0x7D6B, 0x7DAA, 0x7DEB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DEB, 0x7DAA, 0x7D6B, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x7DAA, 0x7DAA, 0x85EB, 0x7DCB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DCB, 0x85EB, 0x7DAA, 0x7DAA, 0x0000, 0x0000, 0xFFEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BE0, 0xFFFF, 0x0000, 0x7589, 0x75AA, 0x7DAA, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x7DAA, 0x75AA, 0x7589, 0x0000, 0xFFFF, 0x7BE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x554A, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0x554A, 0x0000, 0x0000, 0xAD4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_TENNIS_36_SPAN_ROWS[] PROGMEM = {
+  0, 0, 21, 16, 42, 38, 67, 60, 90, 86, 113, 114, 134, 144, 155, 176,
+  173, 212, 191, 246, 205, 282, 218, 316, 230, 352, 240, 388, 252, 424, 264, 460,
+  276, 496, 278, 532, 280, 568, 282, 604, 284, 640, 296, 676, 308, 712, 320, 748,
+  330, 784, 342, 820, 355, 854, 369, 890, 387, 924, 405, 960, 426, 992, 447, 1022,
+  470, 1050, 493, 1076, 518, 1098, 539, 1120
 };
 
-const uint8_t SPRITE_TENNIS_36_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x45, 0x88, 0xBE, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xBE, 0x88, 0x45, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x14, 0x72, 0xD0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xD0, 0x72, 0x14, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x64, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xDF, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x19, 0xB1, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xB1, 0x19, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x2C, 0xD9, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xD9, 0x2C, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x2B, 0xE4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xE4, 0x2B, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x16, 0xDC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDC, 0x16, 0x00, 0x01, 0x00,
-  0x01, 0x03, 0x02, 0xB3, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xB3, 0x02, 0x03, 0x01,
-  0x03, 0x00, 0x63, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x63, 0x00, 0x03,
-  0x01, 0x14, 0xE4, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE4, 0x14, 0x01,
-  0x00, 0x73, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x73, 0x00,
-  0x05, 0xD3, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xD3, 0x05,
-  0x45, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x45,
-  0x89, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x89,
-  0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF,
-  0xEA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xEA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEA,
-  0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xBF,
-  0x89, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x89,
-  0x45, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x45,
-  0x05, 0xD3, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xD3, 0x05,
-  0x00, 0x73, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x73, 0x00,
-  0x01, 0x14, 0xE4, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xE4, 0x14, 0x01,
-  0x03, 0x00, 0x63, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x63, 0x00, 0x03,
-  0x01, 0x03, 0x02, 0xB3, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xB3, 0x02, 0x03, 0x01,
-  0x00, 0x01, 0x00, 0x16, 0xDC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDC, 0x16, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x2B, 0xE4, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xE4, 0x2B, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x2C, 0xD9, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xD9, 0x2C, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x19, 0xB1, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xB1, 0x19, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x64, 0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xDF, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x14, 0x72, 0xD0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xD0, 0x72, 0x14, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x45, 0x88, 0xBE, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0xBE, 0x88, 0x45, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_TENNIS_36_SPAN_OPS[] PROGMEM = {
+  0x07, 0x80, 0x03, 0x01, 0x84, 0x06, 0x45, 0x88, 0xBE, 0xE9, 0x43, 0x84, 0xE9, 0xBE, 0x88, 0x45, 0x06, 0x01, 0x80, 0x03, 0xC0, 0x05, 0x81, 0x02,
+  0x01, 0x00, 0x83, 0x14, 0x72, 0xD0, 0xFC, 0x49, 0x83, 0xFC, 0xD0, 0x72, 0x14, 0x00, 0x81, 0x01, 0x02, 0xC0, 0x04, 0x80, 0x02, 0x01, 0x81, 0x64,
+  0xDF, 0x42, 0x82, 0xFC, 0xFD, 0xFE, 0x43, 0x82, 0xFE, 0xFD, 0xFC, 0x42, 0x81, 0xDF, 0x64, 0x01, 0x80, 0x02, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x81,
+  0x19, 0xB1, 0x41, 0x81, 0xFC, 0xFD, 0x4B, 0x81, 0xFD, 0xFC, 0x41, 0x81, 0xB1, 0x19, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x81, 0x2C,
+  0xD9, 0x40, 0x81, 0xFC, 0xFD, 0x4F, 0x81, 0xFD, 0xFC, 0x40, 0x81, 0xD9, 0x2C, 0x00, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x81, 0x2B, 0xE4,
+  0x40, 0x80, 0xFB, 0x53, 0x80, 0xFB, 0x40, 0x81, 0xE4, 0x2B, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x81, 0x16, 0xDC, 0x40, 0x80, 0xFB,
+  0x55, 0x80, 0xFB, 0x40, 0x81, 0xDC, 0x16, 0x00, 0x80, 0x01, 0xC0, 0x83, 0x01, 0x03, 0x02, 0xB3, 0x40, 0x80, 0xFB, 0x57, 0x80, 0xFB, 0x40, 0x83,
+  0xB3, 0x02, 0x03, 0x01, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x63, 0x40, 0x80, 0xFB, 0x59, 0x80, 0xFB, 0x40, 0x80, 0x63, 0x00, 0x80, 0x03, 0xC0, 0x84,
+  0x01, 0x14, 0xE4, 0xFE, 0xFD, 0x59, 0x84, 0xFD, 0xFE, 0xE4, 0x14, 0x01, 0xC0, 0x00, 0x80, 0x73, 0x40, 0x80, 0xFC, 0x5B, 0x80, 0xFC, 0x40, 0x80,
+  0x73, 0xC0, 0x83, 0x05, 0xD3, 0xFE, 0xFD, 0x5B, 0x83, 0xFD, 0xFE, 0xD3, 0x05, 0xC0, 0x82, 0x45, 0xFE, 0xFE, 0x5D, 0x82, 0xFE, 0xFE, 0x45, 0xC0,
+  0x80, 0x89, 0x40, 0x80, 0xFC, 0x5D, 0x80, 0xFC, 0x40, 0x80, 0x89, 0xC0, 0x80, 0xBF, 0x40, 0x80, 0xFD, 0x5D, 0x80, 0xFD, 0x40, 0x80, 0xBF, 0xC0,
+  0x80, 0xEA, 0x40, 0x80, 0xFE, 0x5D, 0x80, 0xFE, 0x40, 0x80, 0xEA, 0xC0, 0x63, 0xC0, 0x63, 0xC0, 0x63, 0xC0, 0x63, 0xC0, 0x80, 0xEA, 0x40, 0x80,
+  0xFE, 0x5D, 0x80, 0xFE, 0x40, 0x80, 0xEA, 0xC0, 0x80, 0xBF, 0x40, 0x80, 0xFD, 0x5D, 0x80, 0xFD, 0x40, 0x80, 0xBF, 0xC0, 0x80, 0x89, 0x40, 0x80,
+  0xFC, 0x5D, 0x80, 0xFC, 0x40, 0x80, 0x89, 0xC0, 0x82, 0x45, 0xFE, 0xFE, 0x5D, 0x82, 0xFE, 0xFE, 0x45, 0xC0, 0x83, 0x05, 0xD3, 0xFE, 0xFD, 0x5B,
+  0x83, 0xFD, 0xFE, 0xD3, 0x05, 0xC0, 0x00, 0x80, 0x73, 0x40, 0x80, 0xFC, 0x5B, 0x80, 0xFC, 0x40, 0x80, 0x73, 0xC0, 0x84, 0x01, 0x14, 0xE4, 0xFE,
+  0xFD, 0x59, 0x84, 0xFD, 0xFE, 0xE4, 0x14, 0x01, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x63, 0x40, 0x80, 0xFB, 0x59, 0x80, 0xFB, 0x40, 0x80, 0x63, 0x00,
+  0x80, 0x03, 0xC0, 0x83, 0x01, 0x03, 0x02, 0xB3, 0x40, 0x80, 0xFB, 0x57, 0x80, 0xFB, 0x40, 0x83, 0xB3, 0x02, 0x03, 0x01, 0xC0, 0x00, 0x80, 0x01,
+  0x00, 0x81, 0x16, 0xDC, 0x40, 0x80, 0xFB, 0x55, 0x80, 0xFB, 0x40, 0x81, 0xDC, 0x16, 0x00, 0x80, 0x01, 0xC0, 0x01, 0x80, 0x02, 0x00, 0x81, 0x2B,
+  0xE4, 0x40, 0x80, 0xFB, 0x53, 0x80, 0xFB, 0x40, 0x81, 0xE4, 0x2B, 0x00, 0x80, 0x02, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x81, 0x2C, 0xD9, 0x40, 0x81,
+  0xFC, 0xFD, 0x4F, 0x81, 0xFD, 0xFC, 0x40, 0x81, 0xD9, 0x2C, 0x00, 0x80, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x00, 0x81, 0x19, 0xB1, 0x41, 0x81, 0xFC,
+  0xFD, 0x4B, 0x81, 0xFD, 0xFC, 0x41, 0x81, 0xB1, 0x19, 0x00, 0x80, 0x03, 0xC0, 0x04, 0x80, 0x02, 0x01, 0x81, 0x64, 0xDF, 0x42, 0x82, 0xFC, 0xFD,
+  0xFE, 0x43, 0x82, 0xFE, 0xFD, 0xFC, 0x42, 0x81, 0xDF, 0x64, 0x01, 0x80, 0x02, 0xC0, 0x05, 0x81, 0x02, 0x01, 0x00, 0x83, 0x14, 0x72, 0xD0, 0xFC,
+  0x49, 0x83, 0xFC, 0xD0, 0x72, 0x14, 0x00, 0x81, 0x01, 0x02, 0xC0, 0x07, 0x80, 0x03, 0x01, 0x84, 0x06, 0x45, 0x88, 0xBE, 0xE9, 0x43, 0x84, 0xE9,
+  0xBE, 0x88, 0x45, 0x06, 0x01, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_TENNIS_36_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0020, 0x2183, 0x3AE5, 0x5427, 0x64E9, 0x758A, 0x758A, 0x758A, 0x758A, 0x64E9, 0x5427, 0x3AE5, 0x2183, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0880, 0x3264, 0x6488, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DCB, 0x7DCB,
+  0x7DAA, 0x6488, 0x3264, 0x0880, 0x0000, 0x0000, 0x0000, 0x3244, 0x6CE8, 0x85EB, 0x7DCB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DCB, 0x85EB, 0x6CE8, 0x3244, 0x0000, 0x0000, 0x0881, 0x53C6, 0x7DEB,
+  0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x7DAA, 0x7DEB, 0x53C6, 0x0881, 0x0000, 0x0000, 0x1923, 0x5CA8, 0x7DEB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DEB, 0x5CA8,
+  0x1923, 0x0000, 0x0000, 0x2124, 0xE71C, 0xCF57, 0x6D49, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x6D49, 0xCF57, 0xE71C, 0x2124, 0x0000,
+  0x0000, 0x0881, 0xC696, 0xFFFF, 0xF7BE, 0xD738, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xD738, 0xF7BE, 0xFFFF, 0xC696, 0x0881, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x6C6B, 0xAF11, 0xC6F5, 0xFFFF, 0xFFFF, 0xBED5, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xBED5, 0xFFFF, 0xFFFF, 0xC6F5, 0xAF11,
+  0x6C6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A66, 0xB712, 0x9E50, 0x9E6F, 0xD758, 0xFFFF, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xFFFF,
+  0xD758, 0x9E6F, 0x9E50, 0xB712, 0x3A66, 0x0000, 0x0000, 0x0881, 0x95EE, 0xAED1, 0xA691, 0xA691, 0xA690, 0xEFBC, 0xFFFF, 0xC6F7,
+  0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569,
+  0xC6F7, 0xFFFF, 0xEFBC, 0xA690, 0xA691, 0xA691, 0xAED1, 0x95EE, 0x0881, 0x0000, 0x42C7, 0xB712, 0xA690, 0xA691, 0xAEB1, 0xA690,
+  0xC716, 0xFFFF, 0xF7DE, 0x85AC, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x85AC, 0xF7DE, 0xFFFF, 0xC716, 0xA690, 0xAEB1, 0xA691, 0xA690, 0xB712, 0x42C7, 0x0020, 0x854D, 0xAED1, 0xA691,
+  0xA691, 0xA691, 0xA690, 0xAEB2, 0xF7DE, 0xFFFF, 0xA651, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xA651, 0xFFFF, 0xF7DE, 0xAEB2, 0xA690, 0xA691, 0xA691, 0xA691, 0xAED1, 0x854D, 0x0020,
+  0x29C4, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xDF7A, 0xFFFF, 0xC6D6, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0x6D69, 0xC6D6, 0xFFFF, 0xDF7A, 0xA690, 0xA691, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xA6B1, 0x29C4, 0x5368, 0xAEF1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA68F, 0xCF37, 0xFFFF, 0xD739, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0xD739, 0xFFFF, 0xCF37,
+  0xA68F, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEF1, 0x5368, 0x7CEC, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA690,
+  0xC715, 0xFFFF, 0xEF9C, 0x7D8B, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x7D8B, 0xEF9C, 0xFFFF, 0xC715, 0xA690, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAED1, 0x7CEC, 0x95EF, 0xAEB1, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xA691, 0xA690, 0xBED3, 0xFFFF, 0xF7DE, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0xF7DE, 0xFFFF, 0xBED3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0x95EF,
+  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDF, 0x7DAB, 0x758A, 0x7D8A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDF, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDE, 0x7DAB,
+  0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDE, 0xFFFF, 0xB6D3,
+  0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690,
+  0xB6D3, 0xFFFF, 0xFFFF, 0x85CC, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A,
+  0x7DAB, 0xFFDE, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xA691, 0xA690, 0xB6D3, 0xFFFF, 0xFFDE, 0x7DAB, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x7D8A, 0x758A, 0x7DAB, 0xFFDF, 0xFFFF, 0xB6D3, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691,
+  0x95EF, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA690, 0xBED3, 0xFFFF, 0xF7DE, 0x7DAB, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAB, 0xF7DE, 0xFFFF, 0xBED3, 0xA690, 0xA691, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xAEB1, 0x95EF, 0x7CEC, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0xA690, 0xC715, 0xFFFF, 0xEF9C, 0x7D8B,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8B, 0xEF9C, 0xFFFF, 0xC715,
+  0xA690, 0xA6B1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAED1, 0x7CEC, 0x5368, 0xAEF1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEB1, 0xA68F,
+  0xCF37, 0xFFFF, 0xD739, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0xD739, 0xFFFF, 0xCF37, 0xA68F, 0xAEB1, 0xA691, 0xA691, 0xA691, 0xA691, 0xAEF1, 0x5368, 0x29C4, 0xA6B1, 0xA691, 0xA691,
+  0xA691, 0xA691, 0xA691, 0xA690, 0xDF7A, 0xFFFF, 0xC6D6, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xC6D6, 0xFFFF, 0xDF7A, 0xA690, 0xA691, 0xA691, 0xA691, 0xA691, 0xA691, 0xA6B1, 0x29C4,
+  0x0020, 0x854D, 0xAED1, 0xA691, 0xA691, 0xA691, 0xA690, 0xAEB2, 0xF7DE, 0xFFFF, 0xA651, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569, 0xA651, 0xFFFF, 0xF7DE, 0xAEB2, 0xA690, 0xA691, 0xA691,
+  0xA691, 0xAED1, 0x854D, 0x0020, 0x42C7, 0xB712, 0xA690, 0xA691, 0xAEB1, 0xA690, 0xC716, 0xFFFF, 0xF7DE, 0x85AC, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x85AC, 0xF7DE, 0xFFFF, 0xC716,
+  0xA690, 0xAEB1, 0xA691, 0xA690, 0xB712, 0x42C7, 0x0000, 0x0881, 0x95EE, 0xAED1, 0xA691, 0xA691, 0xA690, 0xEFBC, 0xFFFF, 0xC6F7,
+  0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x7569,
+  0xC6F7, 0xFFFF, 0xEFBC, 0xA690, 0xA691, 0xA691, 0xAED1, 0x95EE, 0x0881, 0x0000, 0x0000, 0x3A66, 0xB712, 0x9E50, 0x9E6F, 0xD758,
+  0xFFFF, 0xFFFF, 0x8DEE, 0x7569, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x7D8A, 0x7569, 0x8DEE, 0xFFFF, 0xFFFF, 0xD758, 0x9E6F, 0x9E50, 0xB712, 0x3A66, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C6B,
+  0xAF11, 0xC6F5, 0xFFFF, 0xFFFF, 0xBED5, 0x6D69, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x6D69, 0xBED5, 0xFFFF, 0xFFFF, 0xC6F5, 0xAF11, 0x6C6B, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0881, 0xC696, 0xFFFF, 0xF7BE, 0xD738, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x758A, 0xD738, 0xF7BE, 0xFFFF, 0xC696, 0x0881, 0x0000,
+  0x0000, 0x2124, 0xE71C, 0xCF57, 0x6D49, 0x758A, 0x7D8A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7D8A, 0x758A, 0x6D49, 0xCF57, 0xE71C, 0x2124, 0x0000, 0x0000, 0x1923,
+  0x5CA8, 0x7DEB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DEB, 0x5CA8, 0x1923, 0x0000, 0x0000, 0x0881, 0x53C6, 0x7DEB, 0x7DAA, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA,
+  0x7DEB, 0x53C6, 0x0881, 0x0000, 0x0000, 0x3244, 0x6CE8, 0x85EB, 0x7DCB, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x758A,
+  0x758A, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DCB, 0x85EB, 0x6CE8, 0x3244, 0x0000, 0x0000, 0x0000, 0x0880, 0x3264, 0x6488, 0x7DAA,
+  0x7DCB, 0x7DCB, 0x7DAA, 0x758A, 0x758A, 0x758A, 0x758A, 0x7DAA, 0x7DCB, 0x7DCB, 0x7DAA, 0x6488, 0x3264, 0x0880, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x2183, 0x3AE5, 0x5427, 0x64E9, 0x758A, 0x758A, 0x758A, 0x758A, 0x64E9, 0x5427, 0x3AE5, 0x2183, 0x0020, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_TENNIS_36_SPANS = {
+  SPRITE_TENNIS_36_SPAN_ROWS, SPRITE_TENNIS_36_SPAN_OPS, SPRITE_TENNIS_36_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_TENNIS_36_ASSET = {
   SPRITE_TENNIS_36_WIDTH, SPRITE_TENNIS_36_HEIGHT,
-  SPRITE_TENNIS_36_ALPHA, SPRITE_TENNIS_36_RGB565
+  nullptr, nullptr, &SPRITE_TENNIS_36_SPANS
 };
 
 #endif // SPRITE_TENNIS_36_INCLUDED
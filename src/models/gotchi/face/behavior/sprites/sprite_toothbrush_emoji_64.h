@@ -5,150 +5,152 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from toothbrush_emoji_64.png (64x64)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from toothbrush_emoji_64.png (64x64) — RGBA multi-couleur, encodé en spans
+// 1033/4096 pixels visibles, 3508 bytes flash (flat : 12288). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_TOOTHBRUSH_EMOJI_64_WIDTH = 64;
 constexpr uint16_t SPRITE_TOOTHBRUSH_EMOJI_64_HEIGHT = 64;
 
-const uint16_t SPRITE_TOOTHBRUSH_EMOJI_64_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xBFFF, 0xC69B, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xCEBB, 0xCE9B, 0xDEDC, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xCE79, 0x0000, 0xCEBB, 0xCEBB, 0xCEDC, 0xCEBB, 0xAD5F, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0x0000, 0xCEBB, 0xCEDC, 0xCEBB, 0xDF3D, 0xCEDB, 0x0000, 0xCE79, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xCE9B, 0xCEDC, 0xCEDC, 0xCEBB, 0xCEBC, 0xCEBB, 0xCEBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0xCEBB, 0xCEDB, 0xD6DC, 0xCEBB, 0xB5F9, 0x9D56, 0xBE5A, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEDB, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x07FF, 0xFFFF, 0xFFFF, 0x0000, 0xCEBB, 0xCEBB, 0xD6DC, 0xCEBB, 0xB5F8, 0x9556, 0x9556, 0xC65A, 0xD6FC, 0xD6FC, 0xD71D, 0xCEBB, 0x0000, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x07FF, 0xCEBB, 0xCEBB, 0xD6DC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56, 0xBE5A, 0xCEDB, 0xB619, 0xBE39, 0xD6FC, 0xCE9B, 0xCE9A, 0xFFFF, 0x9E79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x4C96, 0x4638, 0xB6BA, 0xCEBB, 0xCEBB, 0xD6DC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9556, 0x9D76, 0xCEBB, 0xD6FC, 0xCEBB, 0x0000, 0x0000, 0xBDF7, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x3DB8, 0x45F8, 0x35B7, 0x6619, 0xCEBB, 0xD6FC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xBE39, 0xCEBB, 0xD6FC, 0xCEBB, 0xCEBB, 0xC67B, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x35F8, 0x3DB8, 0x463A, 0x3DF9, 0x4619, 0x8639, 0xCE9B, 0xB5F8, 0x9556, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xB639, 0xCEDB, 0xB5F9, 0xA597, 0xBE5A, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDB, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x07FF, 0x3DB8, 0x3DB7, 0x4619, 0x3DB8, 0x3DD8, 0x3DB8, 0x3DD8, 0x75D8, 0x9D56, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9536, 0x9556, 0xBE39, 0xD6DC, 0xD71C, 0xE77E, 0xCEBB, 0xDFFF, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07FF, 0x07FF, 0x0000, 0x3DB7, 0x4639, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x6D97, 0xC65A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9556, 0x9D56, 0xB619, 0xCEBB, 0xBE39, 0xBE39, 0xCEBB, 0xD6FC, 0xD6BB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x35B6, 0x3DB8, 0x3E19, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x865A, 0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9556, 0x9556, 0xB619, 0xCEBB, 0xB619, 0x9556, 0xA5B7, 0xC69A, 0xD6FC, 0xCEBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x3DF7, 0x3DD8, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6D97, 0x9D56, 0xB639, 0xCEDB, 0xADF8, 0x9536, 0x9556, 0xB619, 0xCEBB, 0xB619, 0x9556, 0x9D56, 0xBE39, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEBB, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3DD7, 0x3DD8, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x7DF8, 0xD6BB, 0xADF8, 0x9556, 0x9556, 0xB619, 0xCEBB, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D76, 0xBE5A, 0xCEBB, 0xCEBB, 0xCEDC, 0xCE9B, 0x0000, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3577, 0x3DB8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x75D8, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D56, 0x9556, 0xBE39, 0xCEBB, 0xD6FC, 0xCEDB, 0xCEBB, 0xFFFF, 0x9E79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DD8, 0x3DB8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6D97, 0xB619, 0xCEDB, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xD6DC, 0xCEDC, 0xCEBB, 0x0000, 0xAD55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x35F7, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x865A, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEDC, 0xCEDB, 0xCE9B, 0x0000, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3DD7, 0x3DD8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x6D97, 0x9D56, 0xB639, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEDB, 0xCEDB, 0xCE9B, 0x0000, 0x9CD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x3576, 0x3DF8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x75F8, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEBB, 0xCEBB, 0xCE9B, 0x0000, 0xBDFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x3DB6, 0x3DD8, 0x3E19, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x75F8, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEDB, 0xCEBB, 0xCEBB, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x3DD7, 0x3DD8, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DB8, 0x6D97, 0xB619, 0xCEBB, 0xCEDC, 0xCEBB, 0xCEBB, 0x0000, 0xAFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x35B6, 0x3DD8, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x8639, 0xD6DB, 0xCEBB, 0xCE9B, 0x0000, 0xAFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x35B7, 0x3DB8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x8639, 0xDEFC, 0x0000, 0x9E79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DD8, 0x3DB8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x35B8, 0x2D76, 0x2BEF, 0x5555, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x35F7, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x45F8, 0x3D76, 0x2472, 0x03EF, 0x3BEF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3DD7, 0x3DD8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3576, 0x2CB3, 0x2492, 0x0000, 0x03EF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x3576, 0x3DF8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3556, 0x2492, 0x2CB2, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x3DB6, 0x3DD8, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x2CD4, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x3D35, 0x3576, 0x3DF8, 0x3DD8, 0x3D76, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2451, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x02B5, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C92, 0x2472, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x34D3, 0x7BFF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x34D3, 0x3BEF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2472, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x03FF, 0x3BEF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2492, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x03EF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2431, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C12, 0x24B2, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2C11, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C92, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x02B5, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x34D3, 0x7BFF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x34D3, 0x3BEF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2472, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x03FF, 0x3BEF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2492, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x03EF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2431, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C12, 0x24B2, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2C11, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C92, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x02B5, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x34D3, 0x7BFF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x34D3, 0x3BEF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2472, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x03FF, 0x3BEF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2492, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x03EF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2431, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C12, 0x24B2, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x2C11, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2C92, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x0555, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CD3, 0x2492, 0x4DB6, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2C93, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2472, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2CB3, 0x2492, 0x24D3, 0x7FFF, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2492, 0x2C92, 0x2CF3, 0x2C92, 0x2492, 0x2CB2, 0x2CD3, 0x2C92, 0x0000, 0x3BEF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02AA, 0x0000, 0x2451, 0x2CB2, 0x2C92, 0x2D14, 0x2C92, 0x2472, 0x2D11, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x1BEF, 0x2492, 0x2C93, 0x2492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_ROWS[] PROGMEM = {
+  0, 0, 4, 1, 12, 6, 25, 12, 38, 20, 55, 29, 69, 37, 89, 50,
+  109, 67, 131, 85, 155, 106, 180, 129, 198, 155, 222, 184, 240, 212, 256, 240,
+  273, 270, 293, 302, 310, 334, 328, 362, 349, 389, 369, 414, 389, 437, 410, 458,
+  431, 477, 452, 494, 472, 509, 489, 524, 509, 540, 530, 555, 550, 569, 568, 582,
+  588, 596, 608, 612, 628, 628, 646, 643, 666, 659, 687, 674, 707, 688, 725, 701,
+  745, 715, 765, 731, 785, 747, 803, 762, 823, 778, 844, 793, 864, 807, 882, 820,
+  902, 834, 922, 850, 942, 866, 960, 881, 980, 897, 1001, 912, 1021, 926, 1039, 939,
+  1059, 953, 1079, 967, 1099, 982, 1117, 994, 1136, 1007, 1154, 1017, 1169, 1026, 1179, 1031
 };
 
-const uint8_t SPRITE_TOOTHBRUSH_EMOJI_64_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x7C, 0xAE, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x6C, 0xFB, 0xF2, 0x33, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x6E, 0xF8, 0xFA, 0xFF, 0x6A, 0x00, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6F, 0xF8, 0xFF, 0xFB, 0xFE, 0xCE, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6F, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xED, 0xD2, 0x85, 0x28, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x71, 0xFB, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x70, 0xFB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xED, 0x38, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x12, 0x0D, 0x6C, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0x7D, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19, 0x99, 0xAE, 0xAC, 0xF0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xD2, 0x3D, 0x1B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFA, 0xBA, 0x7D, 0x2E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x19, 0xB9, 0xFF, 0xFB, 0xFC, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xC1, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0xAE, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xF7, 0xFC, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x19, 0xE8, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0xC3, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xCE, 0x1E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1D, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC1, 0x65, 0x1C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1D, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x5E, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF2, 0x59, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF4, 0x58, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF6, 0x57, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF8, 0x56, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFA, 0x55, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xD0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF9, 0x57, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF5, 0x5A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFB, 0x5F, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF4, 0x7A, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x83, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xD0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x84, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x83, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xD0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x84, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x83, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xD0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x84, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x83, 0x05, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0xCA, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1F, 0xCD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D, 0xD0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x84, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0xD1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x76, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0xD1, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDC, 0x07, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDD, 0x21, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20, 0xCB, 0xFF, 0xF9, 0xFF, 0xFF, 0xFB, 0xFB, 0xDB, 0x0F, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0xC9, 0xFF, 0xFB, 0xF9, 0xFF, 0xFF, 0x7F, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x21, 0x9D, 0xFA, 0xFF, 0xDD, 0x78, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x2A, 0x32, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_OPS[] PROGMEM = {
+  0x11, 0x80, 0x01, 0xC0, 0x10, 0x84, 0x01, 0x01, 0x04, 0x16, 0x01, 0xC0, 0x0F, 0x81, 0x01, 0x04, 0x00, 0x82, 0x7C, 0xAE, 0x14, 0x00, 0x80, 0x01,
+  0xC0, 0x0E, 0x81, 0x01, 0x05, 0x00, 0x85, 0x6C, 0xFB, 0xF2, 0x33, 0x03, 0x04, 0xC0, 0x0E, 0x80, 0x04, 0x00, 0x82, 0x6E, 0xF8, 0xFA, 0x40, 0x80,
+  0x6A, 0x00, 0x82, 0x05, 0x04, 0x01, 0xC0, 0x0D, 0x80, 0x01, 0x00, 0x81, 0x6F, 0xF8, 0x40, 0x83, 0xFB, 0xFE, 0xCE, 0x47, 0xC0, 0x0C, 0x80, 0x01,
+  0x00, 0x81, 0x6F, 0xF9, 0x40, 0x80, 0xFE, 0x42, 0x83, 0xED, 0xD2, 0x85, 0x28, 0x00, 0x80, 0x02, 0xC0, 0x08, 0x83, 0x01, 0x01, 0x01, 0x02, 0x00,
+  0x81, 0x71, 0xFB, 0x40, 0x80, 0xFE, 0x46, 0x80, 0xC5, 0x00, 0x80, 0x04, 0xC0, 0x07, 0x80, 0x01, 0x02, 0x82, 0x01, 0x70, 0xFB, 0x40, 0x80, 0xFD,
+  0x44, 0x81, 0xFE, 0xFC, 0x40, 0x83, 0xED, 0x38, 0x03, 0x05, 0xC0, 0x06, 0x80, 0x02, 0x00, 0x84, 0x07, 0x12, 0x0D, 0x6C, 0xFA, 0x40, 0x80, 0xFE,
+  0x46, 0x83, 0xFE, 0xFE, 0xFD, 0x7D, 0x01, 0x81, 0x04, 0x03, 0xC0, 0x05, 0x80, 0x02, 0x00, 0x84, 0x19, 0x99, 0xAE, 0xAC, 0xF0, 0x40, 0x80, 0xFD,
+  0x48, 0x80, 0xFC, 0x40, 0x82, 0xD2, 0x3D, 0x1B, 0x01, 0x80, 0x01, 0xC0, 0x04, 0x80, 0x01, 0x00, 0x81, 0x17, 0xB8, 0x4F, 0x80, 0xFE, 0x40, 0x84,
+  0xFA, 0xBA, 0x7D, 0x2E, 0x01, 0xC0, 0x03, 0x83, 0x01, 0x01, 0x19, 0xB9, 0x40, 0x83, 0xFB, 0xFC, 0xFB, 0xFE, 0x4C, 0x81, 0xFD, 0xFE, 0x41, 0x81,
+  0xC1, 0x08, 0x00, 0x80, 0x01, 0xC0, 0x02, 0x81, 0x01, 0x02, 0x00, 0x80, 0xAE, 0x40, 0x80, 0xFA, 0x51, 0x84, 0xFE, 0xFB, 0xF7, 0xFC, 0x26, 0xC0,
+  0x02, 0x80, 0x02, 0x00, 0x83, 0x19, 0xE8, 0xFC, 0xFD, 0x53, 0x80, 0xFE, 0x40, 0x80, 0x6C, 0xC0, 0x03, 0x82, 0x03, 0x04, 0xC3, 0x40, 0x80, 0xFD,
+  0x53, 0x80, 0xFE, 0x40, 0x82, 0xCE, 0x1E, 0x01, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x81, 0x1D, 0xD1, 0x40, 0x80, 0xFD, 0x55, 0x83, 0xFC, 0xC1, 0x65,
+  0x1C, 0x00, 0x80, 0x02, 0xC0, 0x04, 0x80, 0x01, 0x00, 0x81, 0x1D, 0xD1, 0x40, 0x80, 0xFC, 0x56, 0x83, 0xFD, 0x5E, 0x01, 0x05, 0xC0, 0x07, 0x81,
+  0x1E, 0xD0, 0x40, 0x80, 0xFB, 0x52, 0x80, 0xFE, 0x40, 0x81, 0xF2, 0x59, 0x00, 0x80, 0x03, 0xC0, 0x06, 0x80, 0x01, 0x00, 0x81, 0x20, 0xCB, 0x40,
+  0x80, 0xFA, 0x50, 0x80, 0xFE, 0x40, 0x81, 0xF4, 0x58, 0x00, 0x80, 0x04, 0xC0, 0x07, 0x80, 0x02, 0x00, 0x81, 0x21, 0xC9, 0x40, 0x80, 0xFB, 0x4E,
+  0x83, 0xFE, 0xFE, 0xF6, 0x57, 0x00, 0x80, 0x05, 0xC0, 0x08, 0x80, 0x03, 0x00, 0x81, 0x20, 0xCA, 0x40, 0x80, 0xFC, 0x4C, 0x83, 0xFE, 0xFE, 0xF8,
+  0x56, 0x00, 0x80, 0x04, 0xC0, 0x09, 0x80, 0x04, 0x00, 0x81, 0x1F, 0xCD, 0x40, 0x80, 0xFD, 0x4A, 0x80, 0xFE, 0x40, 0x81, 0xFA, 0x55, 0x00, 0x80,
+  0x03, 0xC0, 0x0A, 0x80, 0x03, 0x00, 0x81, 0x1D, 0xD0, 0x40, 0x80, 0xFD, 0x48, 0x80, 0xFE, 0x40, 0x81, 0xF9, 0x57, 0x00, 0x80, 0x03, 0xC0, 0x0B,
+  0x80, 0x02, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFD, 0x46, 0x80, 0xFE, 0x40, 0x81, 0xF5, 0x5A, 0x00, 0x80, 0x03, 0xC0, 0x0C, 0x80, 0x01, 0x00,
+  0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFC, 0x44, 0x83, 0xFE, 0xFE, 0xFB, 0x5F, 0x00, 0x80, 0x05, 0xC0, 0x0F, 0x81, 0x1E, 0xD0, 0x40, 0x80, 0xFB, 0x43,
+  0x86, 0xFE, 0xFE, 0xF4, 0x7A, 0x06, 0x03, 0x02, 0xC0, 0x0E, 0x80, 0x01, 0x00, 0x81, 0x20, 0xCB, 0x40, 0x80, 0xFA, 0x43, 0x80, 0xFE, 0x41, 0x83,
+  0x83, 0x02, 0x04, 0x01, 0xC0, 0x0F, 0x80, 0x02, 0x00, 0x81, 0x21, 0xC9, 0x40, 0x80, 0xFB, 0x43, 0x83, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x81, 0x04,
+  0x01, 0xC0, 0x10, 0x80, 0x03, 0x00, 0x81, 0x20, 0xCA, 0x40, 0x80, 0xFC, 0x43, 0x83, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x80, 0x02, 0xC0, 0x11, 0x80,
+  0x04, 0x00, 0x81, 0x1F, 0xCD, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x40, 0x81, 0xFD, 0x84, 0xC0, 0x12, 0x80, 0x03, 0x00, 0x81, 0x1D, 0xD0, 0x40,
+  0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x80, 0x85, 0x01, 0x80, 0x01, 0xC0, 0x13, 0x80, 0x02, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFD, 0x43, 0x80,
+  0xFE, 0x41, 0x83, 0x85, 0x03, 0x01, 0x01, 0xC0, 0x14, 0x80, 0x01, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFE, 0x41, 0x83, 0x84,
+  0x05, 0x02, 0x02, 0xC0, 0x17, 0x81, 0x1E, 0xD0, 0x40, 0x80, 0xFB, 0x43, 0x81, 0xFE, 0xFE, 0x40, 0x83, 0x83, 0x05, 0x04, 0x02, 0xC0, 0x16, 0x80,
+  0x01, 0x00, 0x81, 0x20, 0xCB, 0x40, 0x80, 0xFA, 0x43, 0x86, 0xFE, 0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0xC0, 0x17, 0x80, 0x02, 0x00, 0x81, 0x21,
+  0xC9, 0x40, 0x80, 0xFB, 0x43, 0x83, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x81, 0x04, 0x01, 0xC0, 0x18, 0x80, 0x03, 0x00, 0x81, 0x20, 0xCA, 0x40, 0x80,
+  0xFC, 0x43, 0x83, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x80, 0x02, 0xC0, 0x19, 0x80, 0x04, 0x00, 0x81, 0x1F, 0xCD, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE,
+  0x40, 0x81, 0xFD, 0x84, 0xC0, 0x1A, 0x80, 0x03, 0x00, 0x81, 0x1D, 0xD0, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x80, 0x85, 0x01, 0x80, 0x01,
+  0xC0, 0x1B, 0x80, 0x02, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x83, 0x85, 0x03, 0x01, 0x01, 0xC0, 0x1C, 0x80, 0x01,
+  0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFE, 0x41, 0x83, 0x84, 0x05, 0x02, 0x02, 0xC0, 0x1F, 0x81, 0x1E, 0xD0, 0x40, 0x80, 0xFB,
+  0x43, 0x81, 0xFE, 0xFE, 0x40, 0x83, 0x83, 0x05, 0x04, 0x02, 0xC0, 0x1E, 0x80, 0x01, 0x00, 0x81, 0x20, 0xCB, 0x40, 0x80, 0xFA, 0x43, 0x86, 0xFE,
+  0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0xC0, 0x1F, 0x80, 0x02, 0x00, 0x81, 0x21, 0xC9, 0x40, 0x80, 0xFB, 0x43, 0x83, 0xFD, 0xFC, 0xFD, 0x83, 0x00,
+  0x81, 0x04, 0x01, 0xC0, 0x20, 0x80, 0x03, 0x00, 0x81, 0x20, 0xCA, 0x40, 0x80, 0xFC, 0x43, 0x83, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x80, 0x02, 0xC0,
+  0x21, 0x80, 0x04, 0x00, 0x81, 0x1F, 0xCD, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x40, 0x81, 0xFD, 0x84, 0xC0, 0x22, 0x80, 0x03, 0x00, 0x81, 0x1D,
+  0xD0, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x80, 0x85, 0x01, 0x80, 0x01, 0xC0, 0x23, 0x80, 0x02, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFD,
+  0x43, 0x80, 0xFE, 0x41, 0x83, 0x85, 0x03, 0x01, 0x01, 0xC0, 0x24, 0x80, 0x01, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFE, 0x41,
+  0x83, 0x84, 0x05, 0x02, 0x02, 0xC0, 0x27, 0x81, 0x1E, 0xD0, 0x40, 0x80, 0xFB, 0x43, 0x81, 0xFE, 0xFE, 0x40, 0x83, 0x83, 0x05, 0x04, 0x02, 0xC0,
+  0x26, 0x80, 0x01, 0x00, 0x81, 0x20, 0xCB, 0x40, 0x80, 0xFA, 0x43, 0x86, 0xFE, 0xFC, 0xFE, 0x83, 0x02, 0x04, 0x01, 0xC0, 0x27, 0x80, 0x02, 0x00,
+  0x81, 0x21, 0xC9, 0x40, 0x80, 0xFB, 0x43, 0x83, 0xFD, 0xFC, 0xFD, 0x83, 0x00, 0x81, 0x04, 0x01, 0xC0, 0x28, 0x80, 0x03, 0x00, 0x81, 0x20, 0xCA,
+  0x40, 0x80, 0xFC, 0x43, 0x83, 0xFD, 0xFD, 0xFC, 0x83, 0x00, 0x80, 0x02, 0xC0, 0x29, 0x80, 0x04, 0x00, 0x81, 0x1F, 0xCD, 0x40, 0x80, 0xFD, 0x43,
+  0x80, 0xFE, 0x40, 0x81, 0xFD, 0x84, 0xC0, 0x2A, 0x80, 0x03, 0x00, 0x81, 0x1D, 0xD0, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x80, 0x84, 0x00,
+  0x80, 0x02, 0xC0, 0x2B, 0x80, 0x02, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFD, 0x43, 0x80, 0xFE, 0x41, 0x80, 0x76, 0x00, 0x80, 0x03, 0xC0, 0x2C,
+  0x80, 0x01, 0x00, 0x81, 0x1C, 0xD1, 0x40, 0x80, 0xFC, 0x43, 0x80, 0xFD, 0x40, 0x83, 0xDC, 0x07, 0x02, 0x01, 0xC0, 0x2F, 0x81, 0x1E, 0xD0, 0x40,
+  0x80, 0xFB, 0x42, 0x80, 0xFD, 0x40, 0x81, 0xDD, 0x21, 0x00, 0x80, 0x02, 0xC0, 0x2E, 0x80, 0x01, 0x00, 0x81, 0x20, 0xCB, 0x40, 0x80, 0xF9, 0x41,
+  0x85, 0xFB, 0xFB, 0xDB, 0x0F, 0x02, 0x01, 0xC0, 0x2F, 0x80, 0x02, 0x00, 0x81, 0x21, 0xC9, 0x40, 0x81, 0xFB, 0xF9, 0x41, 0x80, 0x7F, 0x00, 0x80,
+  0x04, 0xC0, 0x30, 0x80, 0x03, 0x00, 0x82, 0x21, 0x9D, 0xFA, 0x40, 0x83, 0xDD, 0x78, 0x0B, 0x02, 0xC0, 0x31, 0x80, 0x02, 0x00, 0x83, 0x08, 0x2A,
+  0x32, 0x1E, 0xC0, 0x32, 0x80, 0x02, 0x04, 0x80, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x0000, 0x0000, 0x0020, 0x634D, 0x8C72, 0x10A2, 0x0000, 0x0000, 0x0020, 0x52EB, 0xC67A,
+  0xBE5A, 0x2125, 0x0000, 0x0020, 0x0020, 0x52EB, 0xC69B, 0xC67A, 0xDF3D, 0x52AA, 0x0020, 0x0020, 0x0000, 0x0000, 0x52CB, 0xC69B,
+  0xCEDC, 0xC67A, 0xCEBC, 0xA575, 0x39C7, 0x0000, 0x52EB, 0xC69A, 0xD6DC, 0xCEBB, 0xB5F9, 0x9D56, 0xBE5A, 0xBE59, 0xA575, 0x6B8E,
+  0x1904, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52EB, 0xC67A, 0xD6DC, 0xCEBB, 0xB5F8, 0x9556, 0x9556, 0xC65A, 0xD6FC, 0xD6FC,
+  0xD71D, 0x9D35, 0x0020, 0x0000, 0x0000, 0x52EB, 0xC67A, 0xD6DC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56, 0xBE5A, 0xCEDB, 0xB619, 0xBE39,
+  0xD6FC, 0xBE19, 0x2965, 0x0000, 0x0020, 0x0000, 0x0020, 0x0061, 0x0861, 0x52EB, 0xC67A, 0xD6DC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56,
+  0xBE3A, 0xD6DC, 0xB5F9, 0x9556, 0x9D76, 0xCEBB, 0xD6FC, 0x634D, 0x0020, 0x0000, 0x0000, 0x0082, 0x236E, 0x23CF, 0x4431, 0xBE39,
+  0xD6FC, 0xCEBB, 0xB5F8, 0x9536, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xBE39, 0xCEBB, 0xD6FC, 0xA575, 0x31A6, 0x1082,
+  0x0000, 0x0000, 0x0082, 0x2C11, 0x463A, 0x3DF9, 0x4619, 0x8639, 0xCE9B, 0xB5F8, 0x9556, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56,
+  0x9D56, 0xB639, 0xCEDB, 0xB5F9, 0xA597, 0xBE5A, 0xC67A, 0x8CD3, 0x634D, 0x2145, 0x0000, 0x0000, 0x0000, 0x0082, 0x2C10, 0x4619,
+  0x3577, 0x3DD8, 0x3577, 0x3DD8, 0x75D8, 0x9D56, 0x9D56, 0xBE3A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9536,
+  0x9556, 0xBE39, 0xD6DC, 0xD71C, 0xE77E, 0x94F4, 0x0020, 0x0000, 0x0000, 0x0000, 0x23CF, 0x4639, 0x3597, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DB7, 0x6D97, 0xC65A, 0xD6DC, 0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9556, 0x9D56, 0xB619, 0xCEBB, 0xBE39,
+  0xB5F8, 0xC67A, 0xD6FC, 0x2104, 0x0000, 0x0082, 0x3515, 0x3E19, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x865A,
+  0xB5F9, 0x9D56, 0x9D56, 0xB619, 0xCEDB, 0xADF8, 0x9556, 0x9556, 0xB619, 0xCEBB, 0xB619, 0x9556, 0xA5B7, 0xC69A, 0xD6FC, 0x52EB,
+  0x0000, 0x0020, 0x2C52, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6D97, 0x9D56, 0xB639, 0xCEDB,
+  0xADF8, 0x9536, 0x9556, 0xB619, 0xCEBB, 0xB619, 0x9556, 0x9D56, 0xBE39, 0xCEDB, 0xCEBB, 0xA575, 0x18C3, 0x0000, 0x0000, 0x00A2,
+  0x2CB3, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x7DF8, 0xD6BB, 0xADF8, 0x9556, 0x9556, 0xB619,
+  0xCEBB, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D76, 0xBE5A, 0xCEBB, 0x94F4, 0x52AB, 0x18C3, 0x0000, 0x0000, 0x00A2,
+  0x2C93, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x75D8, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xB619,
+  0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D56, 0x9556, 0xBE39, 0xCEBB, 0xD6FC, 0xCEDB, 0x4A6A, 0x0000, 0x0020, 0x00A3, 0x2C93,
+  0x4619, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6D97, 0xB619, 0xCEDB, 0xB619, 0x9556, 0x9D56, 0xB619,
+  0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xD6DC, 0xBE5A, 0x4249, 0x0000, 0x0000, 0x00A2, 0x2C72, 0x4619, 0x3576, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x865A, 0xB619, 0x9556, 0x9D56, 0xB619, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619,
+  0xCEBB, 0xCEDC, 0xC69A, 0x4229, 0x0020, 0x0000, 0x00A2, 0x2C72, 0x4619, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8,
+  0x3DD8, 0x6D97, 0x9D56, 0xB639, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEDB, 0xC69A, 0x4229, 0x0020, 0x0000, 0x00A2,
+  0x2C92, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x75F8, 0xD6DC, 0xB619, 0x9D56, 0x9D56, 0xB619,
+  0xCEBB, 0xCEBB, 0xC67A, 0x4229, 0x0020, 0x0020, 0x00A2, 0x2CB3, 0x3E19, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x75F8, 0x9D56, 0x9D56, 0xB619, 0xCEBB, 0xCEDB, 0xC67A, 0x4249, 0x0000, 0x0000, 0x00A2, 0x2CB3, 0x4619, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DB8, 0x6D97, 0xB619, 0xCEBB, 0xCEDC, 0xC67A, 0x4249, 0x0000, 0x0000, 0x00A2, 0x2CB3,
+  0x4619, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x8639, 0xD6DB, 0xC67A, 0x4229, 0x0000, 0x0000, 0x00A2,
+  0x2C93, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x7DF8, 0x528A, 0x0020, 0x00A3, 0x2C93, 0x4619,
+  0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x2D77, 0x128A, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A2, 0x2C72, 0x4619,
+  0x3576, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x45F8, 0x3D76, 0x1229, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A2, 0x2C72, 0x4619,
+  0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3576, 0x2CB3, 0x1249, 0x0000, 0x0000, 0x0000, 0x00A2, 0x2C92, 0x4619, 0x3DB8,
+  0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3556, 0x2492, 0x2CB2, 0x1249, 0x0000, 0x0020, 0x00A2, 0x2CB3, 0x4619, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DB7, 0x2CD4, 0x2472, 0x2C92, 0x2C92, 0x1269, 0x0000, 0x00A2, 0x2451, 0x3DF8, 0x3DD8, 0x3D76, 0x2CD3, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x1249, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x1249, 0x0020, 0x0000, 0x0000, 0x0082, 0x1BAE, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249,
+  0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1249, 0x0000,
+  0x0000, 0x0082, 0x1BCE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1269, 0x0000, 0x0082, 0x23AE,
+  0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0020, 0x0000, 0x0000, 0x0082, 0x1BAE, 0x2CD3, 0x1C51, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0020, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1249, 0x0000, 0x0000, 0x0082, 0x1BCE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x1269, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x1249, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0020,
+  0x0000, 0x0000, 0x0082, 0x1BAE, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1249, 0x0000, 0x0000,
+  0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1249, 0x0000, 0x0000, 0x0082,
+  0x1BCE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1269, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1269, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x0A08, 0x0000, 0x0000, 0x0082, 0x23AE, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2CD3, 0x1BEF, 0x0020, 0x0000, 0x0000, 0x0082, 0x1BAE, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x23EF,
+  0x0082, 0x0000, 0x0000, 0x0082, 0x1B8E, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2451, 0x2472, 0x1BCF, 0x0041, 0x0000, 0x0000, 0x0000,
+  0x0082, 0x1B8E, 0x2CF3, 0x2451, 0x1C51, 0x2CB2, 0x2CD3, 0x1249, 0x0000, 0x0000, 0x0082, 0x1AEB, 0x2451, 0x2D14, 0x23EF, 0x0A08,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x00A2, 0x00C3, 0x0082, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_TOOTHBRUSH_EMOJI_64_SPANS = {
+  SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_ROWS, SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_OPS, SPRITE_TOOTHBRUSH_EMOJI_64_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_TOOTHBRUSH_EMOJI_64_ASSET = {
   SPRITE_TOOTHBRUSH_EMOJI_64_WIDTH, SPRITE_TOOTHBRUSH_EMOJI_64_HEIGHT,
-  SPRITE_TOOTHBRUSH_EMOJI_64_ALPHA, SPRITE_TOOTHBRUSH_EMOJI_64_RGB565
+  nullptr, nullptr, &SPRITE_TOOTHBRUSH_EMOJI_64_SPANS
 };
 
 #endif // SPRITE_TOOTHBRUSH_EMOJI_64_INCLUDED
@@ -5,198 +5,238 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from toothbrush_emoji_88.png (88x88)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from toothbrush_emoji_88.png (88x88) — RGBA multi-couleur, encodé en spans
+// 1938/7744 pixels visibles, 6031 bytes flash (flat : 23232). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_TOOTHBRUSH_EMOJI_88_WIDTH = 88;
 constexpr uint16_t SPRITE_TOOTHBRUSH_EMOJI_88_HEIGHT = 88;
 
-const uint16_t SPRITE_TOOTHBRUSH_EMOJI_88_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCFFF, 0x0000, 0x0000, 0xCEBB, 0xCEBC, 0xBEFB, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0x0000, 0xF81F, 0xCEBB, 0xCEBB, 0xCEBB, 0xC67B, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xBDFF, 0xCE9B, 0xCEBB, 0xCEDC, 0xCEBB, 0xCE7B, 0x0000, 0xD6BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xAD55, 0x0000, 0xCE9B, 0xCEBB, 0xCEDC, 0xCEBB, 0xD6FC, 0xCEBB, 0x0000, 0xDEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xBDF7, 0x0000, 0xCEBC, 0xCEBB, 0xD6DC, 0xCEBB, 0xCEBB, 0xDF1D, 0xCEBB, 0xD69C, 0x0000, 0xD6BA, 0xCE79, 0xAD55, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xCE9B, 0xCEBB, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xCEBB, 0xCEBB, 0xBE9A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE79, 0x0000, 0x0000, 0xCEBB, 0xCEBB, 0xD6FC, 0xD6DC, 0xCEBB, 0xC67A, 0xADF8, 0xADD8, 0xC67A, 0xD6DC, 0xCEBB, 0xCEBB, 0xCE9B, 0xB638, 0xFFF5, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xBDF7, 0xCE9B, 0xCEBB, 0xD6DC, 0xCEDC, 0xCEBB, 0xC67A, 0xADD8, 0x9536, 0x8D15, 0xBE39, 0xD71C, 0xDF5E, 0xDF5E, 0xCEBB, 0xD6FC, 0xCEBB, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xAD55, 0xC69B, 0xCEBB, 0xCEDC, 0xCEBB, 0xCEBB, 0xC67A, 0xADD8, 0x9536, 0x9D56, 0xA597, 0xC67A, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEBB, 0xE79F, 0xCEBB, 0x7BEF, 0xCE79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x03EF, 0x03EF, 0x5555, 0xAD55, 0x0000, 0xCEBB, 0xCEBB, 0xD6DC, 0xCEBB, 0xCEBB, 0xC67A, 0xADB8, 0x9556, 0x9D56, 0xA597, 0xC65A, 0xD6DC, 0xC67A, 0xBE39, 0xC67A, 0xCEBB, 0xDF3D, 0xCEBB, 0xCEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xCE9B, 0xCEBB, 0xD6FC, 0xCEBB, 0xCEBB, 0xC67A, 0xADB8, 0x9D56, 0x9556, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xADD8, 0x9D76, 0xA5B7, 0xCE9B, 0xD6DC, 0xC69A, 0xCEBB, 0xB6DB, 0xCE79, 0xBDF7, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5555, 0x0000, 0x3D96, 0x4596, 0x35B7, 0x5DF8, 0xD6DB, 0xCEBB, 0xD6FC, 0xD6DC, 0xCEBB, 0xC67A, 0xADB8, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xADB8, 0x9556, 0x9536, 0xA597, 0xCE9B, 0xD6DC, 0xDF3D, 0xCEBB, 0x0000, 0x0000, 0x0000, 0xBDFF, 0xCE79, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x03EF, 0x0000, 0x3E38, 0x3DB7, 0x45F9, 0x35B8, 0x4DD8, 0xA67A, 0xD6DB, 0xD6FC, 0xCEBB, 0xC67A, 0xADD8, 0x9556, 0x9536, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9536, 0xA5B7, 0xBE5A, 0xCEBB, 0xC69B, 0xD71D, 0xCEBB, 0xCEBB, 0xCEBB, 0xC6BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x0000, 0x3DF7, 0x3DD8, 0x3DD8, 0x465A, 0x3DD8, 0x45F9, 0x6E19, 0xB69B, 0xD6BB, 0xC67A, 0xADD8, 0x9536, 0x9D56, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9556, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xADD8, 0xADD8, 0xC69B, 0xCEDB, 0xCEBB, 0xCEBB, 0xD6DB, 0xD6FB, 0xD7FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x3DF7, 0x3DB8, 0x3DB8, 0x3DF9, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6619, 0xAE5A, 0xB5D8, 0x9536, 0x9D56, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9D56, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0x9D77, 0x9556, 0x9D76, 0xB619, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEDC, 0xCEBB, 0xCEDB, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x07FF, 0x3E38, 0x3DB7, 0x3DF8, 0x3DF8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x5DD8, 0x8D77, 0x9D36, 0x9D97, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9D56, 0xA597, 0xBE5A, 0xD6DC, 0xBE5A, 0x9D77, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEDC, 0xD6DC, 0xD6FC, 0xD6FC, 0xCEBB, 0xCEDB, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x3DD7, 0x4619, 0x4619, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x5597, 0x95B8, 0xCE7A, 0xD6DC, 0xC67A, 0xADB8, 0x9D56, 0x9556, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9556, 0x9536, 0xA597, 0xBE5A, 0xCEBB, 0xBE5A, 0xB619, 0xC65A, 0xCEBB, 0xDF3D, 0xCEBB, 0xFEBF, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x45D7, 0x3DB8, 0x467A, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x65F8, 0xB69B, 0xC67A, 0xADB8, 0x9556, 0x9556, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9536, 0x9D56, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xA597, 0x9D76, 0xADF8, 0xC69A, 0xDF5E, 0xCEBB, 0xCEBB, 0xFFFF, 0xCE79, 0xCFFF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x3DB8, 0x3DD8, 0x465A, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x65F8, 0x95D8, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9536, 0x9D56, 0xA597, 0xBE5A, 0xCEBB, 0xBE5A, 0xA5B7, 0x9536, 0x9D56, 0xB5F9, 0xCE9B, 0xD71D, 0xCEBB, 0xCEBB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3DF7, 0x0000, 0x3DD8, 0x45F9, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x8D76, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0x9D97, 0x9556, 0x9D56, 0xA597, 0xBE7A, 0xCEBB, 0xBE7A, 0xA597, 0x9536, 0x9D56, 0xA5B7, 0xC69B, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDB, 0xCEDB, 0xBEFB, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3DF7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0xA65A, 0xDEDC, 0xBE5A, 0x9D77, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEBB, 0xBE7A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0xA5B8, 0xC67A, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDB, 0xE73C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3D57, 0x3DD8, 0x3DB8, 0x3DF8, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x6E39, 0xA639, 0xA597, 0x9556, 0x9536, 0xA597, 0xBE5A, 0xCEBB, 0xBE5A, 0xA597, 0x9556, 0x9536, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9536, 0x9D76, 0xBE5A, 0xD71D, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEDB, 0x0000, 0x0000, 0xAFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5555, 0x0000, 0x3DF7, 0x3DB8, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x5DB7, 0x8556, 0x9D56, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xA597, 0x9556, 0x9556, 0xADB8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xADD8, 0xC67A, 0xCEBB, 0xCEBB, 0xDF3D, 0xCEBB, 0xCEBB, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0555, 0x3DB7, 0x3DF8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x55B7, 0x8D97, 0xC65A, 0xD6DB, 0xBE5A, 0xA597, 0x9536, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xADD8, 0xC67A, 0xCEDB, 0xCEBB, 0xD6FC, 0xCEBB, 0xCE9B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x555F, 0x07E0, 0x3DB7, 0x3DF9, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0xB69B, 0xC65A, 0xA597, 0x9536, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9D56, 0x9D56, 0xA5B8, 0xC67A, 0xD6DC, 0xCEBB, 0xCEDB, 0xCEBB, 0xCE9B, 0x0000, 0xBEFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x001F, 0x3679, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0x8D97, 0x9D36, 0x9556, 0xA5B7, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9D56, 0x9D56, 0xA5B8, 0xC67A, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEBB, 0xCE9B, 0x0000, 0xBDF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2D17, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x8576, 0xADB8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC67A, 0xCEBB, 0xCEBB, 0xD6DC, 0xCEBB, 0xD6BB, 0xF81F, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x0555, 0x0000, 0x2DD7, 0x3DD8, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x5DB8, 0xA65A, 0xDEDC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC67A, 0xCEBB, 0xCEBB, 0xD6FC, 0xCEBB, 0xCE9B, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x3DF7, 0x0000, 0x3679, 0x3DD8, 0x3DF8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x6E39, 0xA639, 0xAD97, 0x9D56, 0x9556, 0xADD8, 0xC67A, 0xCEDB, 0xCEBB, 0xD6FC, 0xCEBB, 0xCEBB, 0x0000, 0x7FFF, 0x7FFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x7FFF, 0x001F, 0x07FF, 0x3DB7, 0x3DF9, 0x3DF8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DB7, 0x55B7, 0x8D56, 0x9D56, 0xADD8, 0xBE7A, 0xCEDC, 0xCEBB, 0xD6DC, 0xCEBB, 0xCE9B, 0x0000, 0xDEDB, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x07EF, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x95B8, 0xC67A, 0xCEDC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCE9B, 0x0000, 0xD7FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x1CF7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0xB67A, 0xD6DC, 0xCEDC, 0xCEBB, 0xCE7B, 0x7BEF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03FF, 0x0000, 0x3DF7, 0x3DD8, 0x3DB8, 0x3DF8, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6619, 0xB69B, 0xDEDC, 0xC67A, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x57FF, 0x0000, 0x3DF7, 0x3DB8, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x65F8, 0x967A, 0x0000, 0x03EF, 0x9E79, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0555, 0x3DB7, 0x3DF8, 0x4619, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x35D8, 0x2D97, 0x3CF4, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x555F, 0x07E0, 0x3DB7, 0x3DF9, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x4619, 0x3DD8, 0x2CD3, 0x1C71, 0x0000, 0xFFFF, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x001F, 0x3679, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DB7, 0x2CD3, 0x2492, 0x2472, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2D17, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DB7, 0x2CF4, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x236D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x0555, 0x0000, 0x2DD7, 0x3DD8, 0x3DD8, 0x4619, 0x3DB7, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x3DD8, 0x3DB7, 0x2CB3, 0x2C92, 0x2C92, 0x2492, 0x2C92, 0x0000, 0x3BEF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x3DF7, 0x0000, 0x3679, 0x3DD8, 0x3DF8, 0x4619, 0x3DD8, 0x3DB8, 0x3DB8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3556, 0x2C92, 0x2472, 0x2CB2, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x7FFF, 0x001F, 0x07FF, 0x3DB8, 0x3DF8, 0x3DF8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3556, 0x2CD3, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2492, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x07FF, 0x3515, 0x3597, 0x3DB7, 0x3DB7, 0x3D97, 0x3535, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2C52, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3CF3, 0x2CB3, 0x2CB3, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2472, 0x2C72, 0x0000, 0x2BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x134D, 0x2451, 0x2472, 0x2CB2, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C72, 0x2C72, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x055F, 0x0000, 0x3CF7, 0x2C92, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2472, 0x2C72, 0x0000, 0x02AA, 0x02AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x52B5, 0x2472, 0x2CB3, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2C72, 0x2472, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x02AA, 0xF81F, 0x2C72, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0xF800, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2C51, 0x2C72, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x236D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x2C51, 0x2492, 0x2C92, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2492, 0x2C92, 0x0000, 0x3BEF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x03EF, 0x0000, 0x34D3, 0x2C92, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x001F, 0x2C72, 0x2CB3, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2492, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x054A, 0x7BFF, 0x2C72, 0x2CB2, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2C52, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2472, 0x2C72, 0x0000, 0x2BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2CB2, 0x2C92, 0x2492, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C72, 0x2C72, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x1BF3, 0x2492, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2472, 0x2C72, 0x0000, 0x02AA, 0x02AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x52B5, 0x2472, 0x2CB3, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2C72, 0x2472, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x02AA, 0xF81F, 0x2C72, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0xF800, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2C51, 0x2C72, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x236D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x2C51, 0x2492, 0x2C92, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2492, 0x2C92, 0x0000, 0x3BEF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x03EF, 0x0000, 0x34D3, 0x2C92, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x001F, 0x2C72, 0x2CB3, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2492, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x054A, 0x7BFF, 0x2C72, 0x2CB2, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2C52, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2472, 0x2C72, 0x0000, 0x2BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2CB2, 0x2C92, 0x2492, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C72, 0x2C72, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x1BF3, 0x2492, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2472, 0x2C72, 0x0000, 0x02AA, 0x02AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x52B5, 0x2472, 0x2CB3, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2C72, 0x2472, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x02AA, 0xF81F, 0x2C72, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0xF800, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2472, 0x0000, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2C51, 0x2C72, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0000, 0x236D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x2C51, 0x2492, 0x2C92, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2492, 0x2C92, 0x0000, 0x3BEF, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x03EF, 0x0000, 0x34D3, 0x2C92, 0x2CB2, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x0000, 0x07FF, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x001F, 0x2C72, 0x2CB3, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2492, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x054A, 0x7BFF, 0x2C72, 0x2CB2, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x2492, 0x2451, 0x07FF, 0x34D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C72, 0x2472, 0x0000, 0x3BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x2CB2, 0x2C92, 0x2492, 0x2CB3, 0x2472, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CD3, 0x2472, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x1BF3, 0x2492, 0x2492, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x2D14, 0x2C92, 0x2C51, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0555, 0x0000, 0x52B5, 0x2472, 0x2CB3, 0x2CD3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CD3, 0x2492, 0x2C52, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x02AA, 0xF81F, 0x2C72, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CF4, 0x2492, 0x1C32, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D3, 0x2492, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CD3, 0x2492, 0x0000, 0x2D55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x2C51, 0x2C72, 0x2C92, 0x2CD3, 0x2C92, 0x2C92, 0x2492, 0x2CB2, 0x2CF3, 0x2C92, 0x2C92, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x02AA, 0x0000, 0x2C51, 0x2492, 0x2492, 0x2C92, 0x2D34, 0x2CF3, 0x2492, 0x24B2, 0x2471, 0x0555, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0555, 0x0000, 0x0000, 0x2C72, 0x2C92, 0x2C92, 0x2492, 0x2492, 0x23F1, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x3BEF, 0x3DF7, 0x3BEF, 0x0555, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_ROWS[] PROGMEM = {
+  0, 0, 5, 2, 10, 4, 22, 9, 36, 16, 52, 24, 66, 32, 88, 46,
+  107, 58, 129, 75, 150, 94, 172, 115, 191, 139, 213, 164, 240, 194, 266, 225,
+  290, 260, 312, 296, 333, 334, 356, 373, 375, 415, 391, 453, 409, 494, 429, 536,
+  449, 578, 474, 620, 495, 659, 510, 697, 527, 733, 551, 767, 575, 799, 600, 830,
+  623, 860, 641, 886, 662, 910, 681, 931, 705, 952, 728, 972, 747, 993, 764, 1013,
+  784, 1032, 809, 1053, 834, 1074, 857, 1095, 876, 1115, 899, 1134, 923, 1154, 947, 1175,
+  971, 1195, 991, 1216, 1008, 1236, 1028, 1255, 1053, 1276, 1078, 1297, 1101, 1318, 1120, 1338,
+  1143, 1357, 1167, 1377, 1191, 1398, 1215, 1418, 1235, 1439, 1252, 1459, 1272, 1478, 1297, 1499,
+  1322, 1520, 1345, 1541, 1364, 1561, 1387, 1580, 1411, 1600, 1435, 1621, 1459, 1641, 1479, 1662,
+  1496, 1682, 1516, 1701, 1541, 1722, 1566, 1743, 1589, 1764, 1607, 1785, 1629, 1805, 1651, 1823,
+  1672, 1842, 1691, 1859, 1708, 1876, 1725, 1891, 1746, 1904, 1765, 1918, 1782, 1927, 1792, 1931
 };
 
-const uint8_t SPRITE_TOOTHBRUSH_EMOJI_88_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x4F, 0x33, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x4E, 0xD2, 0x8C, 0x1B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x45, 0xD5, 0xFF, 0xCC, 0x30, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4D, 0xD2, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x54, 0xD0, 0xFF, 0xFE, 0xFF, 0xFF, 0x85, 0x0B, 0x00, 0x06, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x53, 0xCF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xD0, 0x6A, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x4A, 0xD0, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFB, 0xD8, 0x9F, 0x78, 0x4B, 0x1F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x46, 0xD2, 0xFF, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x98, 0x32, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x4A, 0xD2, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFB, 0xFF, 0x83, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x51, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xAE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xD0, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDB, 0x5A, 0x07, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0D, 0x32, 0x37, 0x2E, 0x4D, 0xCC, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF9, 0x8E, 0x00, 0x00, 0x00, 0x04, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x0D, 0x74, 0xB2, 0xB3, 0xAD, 0xD2, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0xD1, 0x4B, 0x2D, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0C, 0x70, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xBA, 0x7E, 0x38, 0x17, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x6F, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xB8, 0x3B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x0D, 0x74, 0xEF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x8A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x61, 0xE5, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF6, 0xFF, 0xC1, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x9E, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFD, 0xD8, 0x30, 0x02, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x99, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xEC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x69, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xC9, 0x3B, 0x0E, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF2, 0xD2, 0x8F, 0x3E, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xE3, 0x9E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xF9, 0xFF, 0xE0, 0x5C, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xCC, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x47, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDB, 0x3B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xDA, 0x38, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x74, 0xF8, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0xD1, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x05, 0x7E, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xCD, 0x4C, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xD2, 0x4C, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDA, 0x41, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDB, 0x39, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF3, 0x7F, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xF1, 0xA5, 0x31, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xBB, 0x29, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBA, 0x2D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB8, 0x36, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x74, 0xF8, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xB6, 0x3A, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x05, 0x7E, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xB5, 0x34, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB9, 0x2A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBA, 0x2A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xBA, 0x32, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xB7, 0x39, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xB5, 0x39, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB7, 0x2D, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xBA, 0x29, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBA, 0x2D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB8, 0x36, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x74, 0xF8, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xB6, 0x3A, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x05, 0x7E, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xB5, 0x34, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB9, 0x2A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBA, 0x2A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xBA, 0x32, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xB7, 0x39, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xB5, 0x39, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB7, 0x2D, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xBA, 0x29, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBA, 0x2D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB8, 0x36, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x74, 0xF8, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xB6, 0x3A, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x05, 0x7E, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xB5, 0x34, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB9, 0x2A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBA, 0x2A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xBA, 0x32, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xB7, 0x39, 0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xB5, 0x39, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB7, 0x2D, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xBA, 0x29, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xBA, 0x2D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFE, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xB8, 0x36, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x74, 0xF8, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xB6, 0x3A, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x05, 0x7E, 0xEE, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xB5, 0x34, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xB9, 0x2A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBA, 0x29, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x70, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xAC, 0x2D, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x70, 0xFD, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF9, 0x75, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x08, 0x7A, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x99, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x03, 0x82, 0xEC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0x9F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x97, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x69, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6F, 0xFF, 0xFF, 0xFC, 0xF8, 0xF9, 0xFF, 0xFF, 0xAB, 0x25, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0B, 0x68, 0xC0, 0xFF, 0xFF, 0xFF, 0xD7, 0x8F, 0x2D, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x3F, 0x77, 0x91, 0x88, 0x53, 0x14, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_OPS[] PROGMEM = {
+  0x1A, 0x81, 0x03, 0x02, 0xC0, 0x18, 0x81, 0x01, 0x02, 0xC0, 0x17, 0x80, 0x05, 0x01, 0x82, 0x4F, 0x33, 0x08, 0x00, 0x80, 0x01, 0xC0, 0x16, 0x80,
+  0x04, 0x00, 0x84, 0x01, 0x4E, 0xD2, 0x8C, 0x1B, 0x00, 0x80, 0x03, 0xC0, 0x15, 0x80, 0x01, 0x00, 0x82, 0x04, 0x45, 0xD5, 0x40, 0x81, 0xCC, 0x30,
+  0x00, 0x80, 0x06, 0xC0, 0x15, 0x80, 0x03, 0x00, 0x81, 0x4D, 0xD2, 0x42, 0x80, 0x4F, 0x00, 0x80, 0x07, 0xC0, 0x13, 0x81, 0x02, 0x04, 0x00, 0x81,
+  0x54, 0xD0, 0x40, 0x80, 0xFE, 0x41, 0x81, 0x85, 0x0B, 0x00, 0x83, 0x06, 0x05, 0x03, 0x01, 0xC0, 0x12, 0x81, 0x04, 0x02, 0x00, 0x81, 0x53, 0xCF,
+  0x40, 0x81, 0xFE, 0xFD, 0x40, 0x83, 0xFE, 0xD0, 0x6A, 0x17, 0xC0, 0x11, 0x80, 0x05, 0x01, 0x81, 0x4A, 0xD0, 0x40, 0x81, 0xFD, 0xFC, 0x42, 0x87,
+  0xFB, 0xD8, 0x9F, 0x78, 0x4B, 0x1F, 0x03, 0x01, 0xC0, 0x10, 0x80, 0x02, 0x00, 0x82, 0x04, 0x46, 0xD2, 0x40, 0x81, 0xFC, 0xFC, 0x47, 0x82, 0xDB,
+  0x98, 0x32, 0x00, 0x80, 0x03, 0xC0, 0x10, 0x83, 0x01, 0x03, 0x4A, 0xD2, 0x40, 0x81, 0xFD, 0xFE, 0x45, 0x83, 0xFE, 0xFC, 0xFB, 0xFB, 0x40, 0x82,
+  0x83, 0x02, 0x05, 0xC0, 0x0B, 0x84, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x81, 0x51, 0xD1, 0x4C, 0x80, 0xFD, 0x40, 0x81, 0xAE, 0x28, 0xC0, 0x0A,
+  0x80, 0x03, 0x04, 0x81, 0x56, 0xD0, 0x41, 0x80, 0xFE, 0x4A, 0x80, 0xFD, 0x40, 0x85, 0xDB, 0x5A, 0x07, 0x05, 0x04, 0x01, 0xC0, 0x08, 0x81, 0x01,
+  0x03, 0x00, 0x85, 0x0D, 0x32, 0x37, 0x2E, 0x4D, 0xCC, 0x40, 0x81, 0xFD, 0xFC, 0x4C, 0x82, 0xFA, 0xF9, 0x8E, 0x02, 0x82, 0x04, 0x05, 0x01, 0xC0,
+  0x07, 0x81, 0x01, 0x02, 0x00, 0x85, 0x0D, 0x74, 0xB2, 0xB3, 0xAD, 0xD2, 0x40, 0x81, 0xFD, 0xFC, 0x4D, 0x80, 0xFA, 0x40, 0x83, 0xD1, 0x4B, 0x2D,
+  0x12, 0xC0, 0x06, 0x81, 0x01, 0x01, 0x00, 0x82, 0x0C, 0x70, 0xF1, 0x43, 0x80, 0xFD, 0x50, 0x80, 0xFE, 0x40, 0x85, 0xFC, 0xBA, 0x7E, 0x38, 0x17,
+  0x06, 0xC0, 0x06, 0x80, 0x03, 0x00, 0x82, 0x0C, 0x6F, 0xF7, 0x40, 0x80, 0xFC, 0x58, 0x80, 0xFD, 0x40, 0x81, 0xB8, 0x3B, 0x01, 0x80, 0x01, 0xC0,
+  0x05, 0x84, 0x02, 0x01, 0x0D, 0x74, 0xEF, 0x41, 0x80, 0xFE, 0x40, 0x80, 0xFE, 0x58, 0x81, 0xFD, 0x8A, 0x01, 0x80, 0x02, 0xC0, 0x05, 0x80, 0x04,
+  0x00, 0x81, 0x61, 0xE5, 0x40, 0x81, 0xFD, 0xFE, 0x58, 0x82, 0xFE, 0xFC, 0xF6, 0x40, 0x83, 0xC1, 0x06, 0x01, 0x01, 0xC0, 0x05, 0x82, 0x01, 0x0B,
+  0x9E, 0x40, 0x80, 0xF7, 0x5C, 0x87, 0xF8, 0xFD, 0xD8, 0x30, 0x02, 0x05, 0x05, 0x02, 0xC0, 0x05, 0x82, 0x01, 0x11, 0x99, 0x40, 0x80, 0xFB, 0x5C,
+  0x80, 0xFC, 0x40, 0x81, 0xEC, 0x7C, 0xC0, 0x05, 0x80, 0x04, 0x00, 0x81, 0x69, 0xF7, 0x5D, 0x80, 0xFE, 0x41, 0x84, 0xC9, 0x3B, 0x0E, 0x08, 0x02,
+  0xC0, 0x05, 0x80, 0x01, 0x00, 0x81, 0x08, 0x70, 0x40, 0x81, 0xFD, 0xFD, 0x5D, 0x85, 0xFD, 0xF2, 0xD2, 0x8F, 0x3E, 0x0B, 0xC0, 0x06, 0x80, 0x01,
+  0x00, 0x82, 0x0C, 0x70, 0xFD, 0x40, 0x80, 0xFA, 0x5F, 0x82, 0xEF, 0xE3, 0x9E, 0x01, 0x80, 0x03, 0xC0, 0x06, 0x81, 0x01, 0x03, 0x00, 0x82, 0x08,
+  0x7A, 0xF3, 0x40, 0x80, 0xF9, 0x5B, 0x82, 0xFE, 0xF9, 0xF9, 0x40, 0x81, 0xE0, 0x5C, 0x01, 0x80, 0x02, 0xC0, 0x07, 0x81, 0x01, 0x03, 0x00, 0x82,
+  0x03, 0x82, 0xEC, 0x40, 0x80, 0xFB, 0x5A, 0x81, 0xFE, 0xFE, 0x40, 0x81, 0xCC, 0x49, 0xC0, 0x09, 0x84, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0x5D, 0x81,
+  0xD6, 0x47, 0x00, 0x80, 0x08, 0xC0, 0x0A, 0x83, 0x01, 0x01, 0x05, 0x74, 0x59, 0x80, 0xFE, 0x41, 0x81, 0xDB, 0x3B, 0x00, 0x80, 0x04, 0xC0, 0x0B,
+  0x80, 0x01, 0x00, 0x81, 0x0B, 0x6F, 0x40, 0x81, 0xFE, 0xFC, 0x54, 0x81, 0xFE, 0xFB, 0x40, 0x82, 0xDA, 0x38, 0x01, 0x00, 0x80, 0x01, 0xC0, 0x0B,
+  0x81, 0x01, 0x03, 0x00, 0x82, 0x0B, 0x74, 0xF8, 0x40, 0x80, 0xF9, 0x52, 0x81, 0xFE, 0xFB, 0x40, 0x81, 0xD1, 0x40, 0x01, 0x80, 0x02, 0xC0, 0x0C,
+  0x81, 0x01, 0x04, 0x00, 0x82, 0x05, 0x7E, 0xEE, 0x40, 0x80, 0xF9, 0x50, 0x81, 0xFE, 0xFC, 0x40, 0x81, 0xCD, 0x4C, 0x00, 0x81, 0x02, 0x02, 0xC0,
+  0x0D, 0x85, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0x40, 0x80, 0xFD, 0x4E, 0x80, 0xFE, 0x41, 0x81, 0xD2, 0x4C, 0x00, 0x81, 0x07, 0x01, 0xC0, 0x0F,
+  0x84, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0x4E, 0x80, 0xFE, 0x41, 0x81, 0xDA, 0x41, 0x00, 0x80, 0x06, 0xC0, 0x10, 0x80, 0x01, 0x00, 0x81, 0x08, 0x70,
+  0x40, 0x81, 0xFD, 0xFD, 0x4A, 0x80, 0xFE, 0x41, 0x83, 0xDB, 0x39, 0x02, 0x01, 0xC0, 0x11, 0x80, 0x02, 0x00, 0x82, 0x0C, 0x70, 0xFD, 0x40, 0x80,
+  0xFA, 0x4B, 0x81, 0xCB, 0x40, 0x01, 0x80, 0x02, 0xC0, 0x11, 0x81, 0x01, 0x03, 0x00, 0x82, 0x08, 0x7A, 0xF3, 0x40, 0x80, 0xF9, 0x47, 0x80, 0xFC,
+  0x40, 0x81, 0xF3, 0x7F, 0x00, 0x81, 0x02, 0x05, 0xC0, 0x12, 0x81, 0x01, 0x03, 0x00, 0x82, 0x03, 0x82, 0xEC, 0x40, 0x80, 0xFB, 0x46, 0x84, 0xFD,
+  0xFE, 0xF1, 0xA5, 0x31, 0x01, 0x80, 0x03, 0xC0, 0x14, 0x84, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0x48, 0x80, 0xFC, 0x41, 0x81, 0xBB, 0x29, 0x00, 0x81,
+  0x01, 0x01, 0xC0, 0x15, 0x83, 0x01, 0x01, 0x05, 0x74, 0x49, 0x80, 0xFE, 0x41, 0x81, 0xBA, 0x2D, 0x00, 0x80, 0x05, 0xC0, 0x16, 0x80, 0x01, 0x00,
+  0x81, 0x0B, 0x6F, 0x40, 0x81, 0xFE, 0xFC, 0x48, 0x82, 0xFD, 0xB8, 0x36, 0x00, 0x80, 0x07, 0xC0, 0x16, 0x81, 0x01, 0x03, 0x00, 0x82, 0x0B, 0x74,
+  0xF8, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFE, 0xB6, 0x3A, 0x00, 0x81, 0x04, 0x02, 0xC0, 0x17, 0x81, 0x01, 0x04, 0x00, 0x82, 0x05,
+  0x7E, 0xEE, 0x40, 0x80, 0xF9, 0x46, 0x81, 0xFB, 0xFE, 0x40, 0x81, 0xB5, 0x34, 0x00, 0x81, 0x01, 0x03, 0xC0, 0x18, 0x85, 0x01, 0x02, 0x01, 0x01,
+  0x82, 0xED, 0x40, 0x80, 0xFD, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB9, 0x2A, 0x01, 0x80, 0x02, 0xC0, 0x1A, 0x84, 0x01, 0x03, 0x02, 0x7B, 0xF7,
+  0x48, 0x81, 0xFD, 0xFD, 0x40, 0x81, 0xBA, 0x2A, 0x00, 0x80, 0x03, 0xC0, 0x1B, 0x80, 0x01, 0x00, 0x81, 0x08, 0x70, 0x40, 0x81, 0xFD, 0xFD, 0x46,
+  0x80, 0xFE, 0x40, 0x82, 0xFD, 0xBA, 0x32, 0x00, 0x80, 0x06, 0xC0, 0x1C, 0x80, 0x02, 0x00, 0x82, 0x0C, 0x70, 0xFD, 0x40, 0x80, 0xFA, 0x46, 0x80,
+  0xFE, 0x40, 0x82, 0xFD, 0xB7, 0x39, 0x00, 0x81, 0x05, 0x01, 0xC0, 0x1C, 0x81, 0x01, 0x03, 0x00, 0x82, 0x08, 0x7A, 0xF3, 0x40, 0x80, 0xF9, 0x46,
+  0x80, 0xFC, 0x41, 0x81, 0xB5, 0x39, 0x00, 0x81, 0x03, 0x03, 0xC0, 0x1D, 0x81, 0x01, 0x03, 0x00, 0x82, 0x03, 0x82, 0xEC, 0x40, 0x80, 0xFB, 0x46,
+  0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB7, 0x2D, 0x01, 0x80, 0x03, 0xC0, 0x1F, 0x84, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0x48, 0x81, 0xFB, 0xFD, 0x40, 0x81,
+  0xBA, 0x29, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x20, 0x83, 0x01, 0x01, 0x05, 0x74, 0x49, 0x80, 0xFE, 0x41, 0x81, 0xBA, 0x2D, 0x00, 0x80, 0x05, 0xC0,
+  0x21, 0x80, 0x01, 0x00, 0x81, 0x0B, 0x6F, 0x40, 0x81, 0xFE, 0xFC, 0x48, 0x82, 0xFD, 0xB8, 0x36, 0x00, 0x80, 0x07, 0xC0, 0x21, 0x81, 0x01, 0x03,
+  0x00, 0x82, 0x0B, 0x74, 0xF8, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFE, 0xB6, 0x3A, 0x00, 0x81, 0x04, 0x02, 0xC0, 0x22, 0x81, 0x01,
+  0x04, 0x00, 0x82, 0x05, 0x7E, 0xEE, 0x40, 0x80, 0xF9, 0x46, 0x81, 0xFB, 0xFE, 0x40, 0x81, 0xB5, 0x34, 0x00, 0x81, 0x01, 0x03, 0xC0, 0x23, 0x85,
+  0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0x40, 0x80, 0xFD, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB9, 0x2A, 0x01, 0x80, 0x02, 0xC0, 0x25, 0x84, 0x01,
+  0x03, 0x02, 0x7B, 0xF7, 0x48, 0x81, 0xFD, 0xFD, 0x40, 0x81, 0xBA, 0x2A, 0x00, 0x80, 0x03, 0xC0, 0x26, 0x80, 0x01, 0x00, 0x81, 0x08, 0x70, 0x40,
+  0x81, 0xFD, 0xFD, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFD, 0xBA, 0x32, 0x00, 0x80, 0x06, 0xC0, 0x27, 0x80, 0x02, 0x00, 0x82, 0x0C, 0x70, 0xFD, 0x40,
+  0x80, 0xFA, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFD, 0xB7, 0x39, 0x00, 0x81, 0x05, 0x01, 0xC0, 0x27, 0x81, 0x01, 0x03, 0x00, 0x82, 0x08, 0x7A, 0xF3,
+  0x40, 0x80, 0xF9, 0x46, 0x80, 0xFC, 0x41, 0x81, 0xB5, 0x39, 0x00, 0x81, 0x03, 0x03, 0xC0, 0x28, 0x81, 0x01, 0x03, 0x00, 0x82, 0x03, 0x82, 0xEC,
+  0x40, 0x80, 0xFB, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB7, 0x2D, 0x01, 0x80, 0x03, 0xC0, 0x2A, 0x84, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0x48, 0x81,
+  0xFB, 0xFD, 0x40, 0x81, 0xBA, 0x29, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x2B, 0x83, 0x01, 0x01, 0x05, 0x74, 0x49, 0x80, 0xFE, 0x41, 0x81, 0xBA, 0x2D,
+  0x00, 0x80, 0x05, 0xC0, 0x2C, 0x80, 0x01, 0x00, 0x81, 0x0B, 0x6F, 0x40, 0x81, 0xFE, 0xFC, 0x48, 0x82, 0xFD, 0xB8, 0x36, 0x00, 0x80, 0x07, 0xC0,
+  0x2C, 0x81, 0x01, 0x03, 0x00, 0x82, 0x0B, 0x74, 0xF8, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFE, 0xB6, 0x3A, 0x00, 0x81, 0x04, 0x02,
+  0xC0, 0x2D, 0x81, 0x01, 0x04, 0x00, 0x82, 0x05, 0x7E, 0xEE, 0x40, 0x80, 0xF9, 0x46, 0x81, 0xFB, 0xFE, 0x40, 0x81, 0xB5, 0x34, 0x00, 0x81, 0x01,
+  0x03, 0xC0, 0x2E, 0x85, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0x40, 0x80, 0xFD, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB9, 0x2A, 0x01, 0x80, 0x02,
+  0xC0, 0x30, 0x84, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0x48, 0x81, 0xFD, 0xFD, 0x40, 0x81, 0xBA, 0x2A, 0x00, 0x80, 0x03, 0xC0, 0x31, 0x80, 0x01, 0x00,
+  0x81, 0x08, 0x70, 0x40, 0x81, 0xFD, 0xFD, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFD, 0xBA, 0x32, 0x00, 0x80, 0x06, 0xC0, 0x32, 0x80, 0x02, 0x00, 0x82,
+  0x0C, 0x70, 0xFD, 0x40, 0x80, 0xFA, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFD, 0xB7, 0x39, 0x00, 0x81, 0x05, 0x01, 0xC0, 0x32, 0x81, 0x01, 0x03, 0x00,
+  0x82, 0x08, 0x7A, 0xF3, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xFC, 0x41, 0x81, 0xB5, 0x39, 0x00, 0x81, 0x03, 0x03, 0xC0, 0x33, 0x81, 0x01, 0x03, 0x00,
+  0x82, 0x03, 0x82, 0xEC, 0x40, 0x80, 0xFB, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB7, 0x2D, 0x01, 0x80, 0x03, 0xC0, 0x35, 0x84, 0x02, 0x03, 0x01,
+  0x7F, 0xF1, 0x48, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xBA, 0x29, 0x00, 0x81, 0x01, 0x01, 0xC0, 0x36, 0x83, 0x01, 0x01, 0x05, 0x74, 0x49, 0x80, 0xFE,
+  0x41, 0x81, 0xBA, 0x2D, 0x00, 0x80, 0x05, 0xC0, 0x37, 0x80, 0x01, 0x00, 0x81, 0x0B, 0x6F, 0x40, 0x81, 0xFE, 0xFC, 0x48, 0x82, 0xFD, 0xB8, 0x36,
+  0x00, 0x80, 0x07, 0xC0, 0x37, 0x81, 0x01, 0x03, 0x00, 0x82, 0x0B, 0x74, 0xF8, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xFE, 0x40, 0x82, 0xFE, 0xB6, 0x3A,
+  0x00, 0x81, 0x04, 0x02, 0xC0, 0x38, 0x81, 0x01, 0x04, 0x00, 0x82, 0x05, 0x7E, 0xEE, 0x40, 0x80, 0xF9, 0x46, 0x81, 0xFB, 0xFE, 0x40, 0x81, 0xB5,
+  0x34, 0x00, 0x81, 0x01, 0x03, 0xC0, 0x39, 0x85, 0x01, 0x02, 0x01, 0x01, 0x82, 0xED, 0x40, 0x80, 0xFD, 0x46, 0x81, 0xFB, 0xFD, 0x40, 0x81, 0xB9,
+  0x2A, 0x01, 0x80, 0x02, 0xC0, 0x3B, 0x84, 0x01, 0x03, 0x02, 0x7B, 0xF7, 0x48, 0x81, 0xFD, 0xFD, 0x40, 0x83, 0xBA, 0x29, 0x01, 0x05, 0xC0, 0x3C,
+  0x80, 0x01, 0x00, 0x81, 0x08, 0x70, 0x40, 0x81, 0xFD, 0xFD, 0x46, 0x80, 0xFE, 0x40, 0x84, 0xFD, 0xAC, 0x2D, 0x01, 0x04, 0xC0, 0x3D, 0x80, 0x02,
+  0x00, 0x82, 0x0C, 0x70, 0xFD, 0x40, 0x80, 0xFA, 0x46, 0x80, 0xFE, 0x40, 0x81, 0xF9, 0x75, 0x00, 0x80, 0x04, 0xC0, 0x3D, 0x81, 0x01, 0x03, 0x00,
+  0x82, 0x08, 0x7A, 0xF3, 0x40, 0x80, 0xF9, 0x46, 0x80, 0xF9, 0x40, 0x82, 0x99, 0x0B, 0x01, 0xC0, 0x3E, 0x81, 0x01, 0x03, 0x00, 0x82, 0x03, 0x82,
+  0xEC, 0x40, 0x80, 0xFB, 0x45, 0x83, 0xFC, 0xFB, 0x9F, 0x18, 0xC0, 0x3F, 0x00, 0x84, 0x02, 0x03, 0x01, 0x7F, 0xF1, 0x46, 0x80, 0xFB, 0x40, 0x82,
+  0x97, 0x11, 0x01, 0xC0, 0x3F, 0x01, 0x83, 0x01, 0x01, 0x05, 0x74, 0x46, 0x80, 0xFC, 0x40, 0x80, 0x69, 0x00, 0x80, 0x06, 0xC0, 0x3F, 0x02, 0x80,
+  0x01, 0x00, 0x81, 0x0B, 0x6F, 0x41, 0x82, 0xFC, 0xF8, 0xF9, 0x41, 0x81, 0xAB, 0x25, 0x00, 0x80, 0x04, 0xC0, 0x3F, 0x02, 0x81, 0x01, 0x03, 0x00,
+  0x82, 0x0B, 0x68, 0xC0, 0x42, 0x85, 0xD7, 0x8F, 0x2D, 0x03, 0x02, 0x01, 0xC0, 0x3F, 0x03, 0x81, 0x01, 0x03, 0x01, 0x85, 0x3F, 0x77, 0x91, 0x88,
+  0x53, 0x14, 0x01, 0x80, 0x01, 0xC0, 0x3F, 0x05, 0x81, 0x02, 0x03, 0x05, 0x81, 0x03, 0x01, 0xC0, 0x3F, 0x06, 0x86, 0x01, 0x02, 0x04, 0x04, 0x04,
+  0x03, 0x01, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3A08, 0x2125, 0x0020, 0x0000, 0x0020, 0x0000, 0x3A08, 0xA575, 0x73AF, 0x1082, 0x0000,
+  0x0000, 0x0020, 0x39C7, 0xAD96, 0xCEDC, 0xA575, 0x2125, 0x0020, 0x0000, 0x3A08, 0xA575, 0xCEDC, 0xCEBB, 0xD6FC, 0x3A08, 0x0020,
+  0x0000, 0x0020, 0x4249, 0xA575, 0xD6DC, 0xCEBB, 0xCEBB, 0xDF1D, 0x6B8E, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
+  0x3A08, 0xA575, 0xD6FC, 0xCEBB, 0xCEBB, 0xCEBB, 0xCEDC, 0xA575, 0x52AA, 0x1082, 0x0020, 0x39C7, 0xA575, 0xD6FC, 0xD6DC, 0xCEBB,
+  0xC67A, 0xADF8, 0xADD8, 0xBE39, 0xADB7, 0x7C30, 0x5B0C, 0x39C7, 0x10C3, 0x0000, 0x0000, 0x0000, 0x0020, 0x39C7, 0xA575, 0xD6DC,
+  0xCEDC, 0xCEBB, 0xC67A, 0xADD8, 0x9536, 0x8D15, 0xBE39, 0xD71C, 0xDF5E, 0xDF5E, 0xAD96, 0x7C10, 0x2125, 0x0000, 0x0000, 0x0000,
+  0x31C7, 0xA575, 0xCEDC, 0xCEBB, 0xCEBB, 0xC67A, 0xADD8, 0x9536, 0x9D56, 0xA597, 0xC67A, 0xCEDB, 0xCEBB, 0xC67A, 0xC67A, 0xE79F,
+  0x634D, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3A08, 0xA575, 0xD6DC, 0xCEBB, 0xCEBB, 0xC67A, 0xADB8, 0x9556,
+  0x9D56, 0xA597, 0xC65A, 0xD6DC, 0xC67A, 0xBE39, 0xC67A, 0xCEBB, 0xDF3D, 0x8C92, 0x1904, 0x0000, 0x4229, 0xA575, 0xD6FC, 0xCEBB,
+  0xCEBB, 0xC67A, 0xADB8, 0x9D56, 0x9556, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xADD8, 0x9D76, 0xA5B7, 0xCE9B, 0xD6DC, 0xA575, 0x4249,
+  0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0041, 0x0904, 0x0925, 0x1104, 0x4208, 0xA575, 0xD6FC, 0xD6DC, 0xCEBB, 0xC67A,
+  0xADB8, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xADB8, 0x9556, 0x9536, 0xA597, 0xCE9B, 0xCE9B, 0xD6FC, 0x73AF, 0x0020,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0061, 0x1AAA, 0x2C11, 0x23D0, 0x33F0, 0x8535, 0xD6DB, 0xD6FC, 0xCEBB, 0xC67A, 0xADD8, 0x9556,
+  0x9536, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9536, 0xA5B7, 0xBE5A, 0xCEBB, 0xBE5A, 0xD71D, 0xA575, 0x39C7, 0x2125,
+  0x0861, 0x0000, 0x0000, 0x0041, 0x1A8A, 0x3576, 0x465A, 0x3DD8, 0x45F9, 0x6E19, 0xB69B, 0xD6BB, 0xC67A, 0xADD8, 0x9536, 0x9D56,
+  0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9556, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xADD8, 0xADD8, 0xC69B, 0xCEDB, 0x8CD3,
+  0x634D, 0x2965, 0x10A2, 0x0020, 0x0000, 0x0041, 0x1A6A, 0x3577, 0x3DF9, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6619, 0xAE5A, 0xB5D8,
+  0x9536, 0x9D56, 0xA597, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9D56, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0x9D77, 0x9556, 0x9D76,
+  0xB619, 0xCEDB, 0xCEBB, 0xCEBB, 0xCEDC, 0x8CD3, 0x2965, 0x0000, 0x0000, 0x0000, 0x0061, 0x1AAA, 0x3596, 0x3DF8, 0x3DD8, 0x3DB8,
+  0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x5DD8, 0x8D77, 0x9D36, 0x9D97, 0xBE5A, 0xD6DC, 0xC67A, 0xA5B8, 0x9D56, 0x9D56, 0xA597, 0xBE5A,
+  0xD6DC, 0xBE5A, 0x9D77, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEDC, 0xD6DC, 0xD6FC, 0xD6FC, 0xCEBB, 0x6B8E, 0x0000, 0x0020, 0x1228,
+  0x3D76, 0x4619, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x5597, 0x95B8, 0xCE7A, 0xD6DC, 0xC67A, 0xADB8,
+  0x9D56, 0x9556, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9556, 0x9536, 0xA597, 0xBE5A, 0xCEBB, 0xBE5A, 0xB619, 0xC65A, 0xC67A,
+  0xDF3D, 0x94F4, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x238F, 0x467A, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DB7, 0x65F8, 0xB69B, 0xC67A, 0xADB8, 0x9556, 0x9556, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9536, 0x9D56,
+  0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xA597, 0x9D76, 0xADF8, 0xBE59, 0xDF5E, 0xAD96, 0x2125, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000,
+  0x0041, 0x236E, 0x465A, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x65F8, 0x95D8,
+  0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEDC, 0xBE5A, 0xA597, 0x9536, 0x9D56, 0xA597, 0xBE5A, 0xCEBB, 0xBE5A, 0xA5B7, 0x9536, 0x9D56,
+  0xB5F9, 0xCE9B, 0xD71D, 0xBE39, 0x634D, 0x0020, 0x1249, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x8D76, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0x9D97, 0x9556, 0x9D56, 0xA597, 0xBE7A, 0xCEBB,
+  0xBE7A, 0xA597, 0x9536, 0x9D56, 0xA5B7, 0xC69B, 0xCEBB, 0xCEBB, 0xCEBB, 0x9D35, 0x2965, 0x0861, 0x0020, 0x0000, 0x0000, 0x0020,
+  0x1A8A, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0xA65A,
+  0xDEDC, 0xBE5A, 0x9D77, 0x9D56, 0x9536, 0xA597, 0xBE5A, 0xCEBB, 0xBE7A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A,
+  0xA597, 0xA5B8, 0xC67A, 0xBE39, 0xA575, 0x73AF, 0x31A6, 0x0020, 0x0000, 0x0041, 0x1A8A, 0x3DB8, 0x3DF8, 0x3576, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x6E39, 0xA639, 0xA597, 0x9556, 0x9536, 0xA597, 0xBE5A, 0xCEBB,
+  0xBE5A, 0xA597, 0x9556, 0x9536, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9536, 0x9D76, 0xBE5A, 0xD71D, 0xD6FC, 0xBE39, 0xADD7,
+  0x7C30, 0x0000, 0x0000, 0x0000, 0x0020, 0x1AAB, 0x3576, 0x4619, 0x3576, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DB8, 0x3DD8, 0x5DB7, 0x8556, 0x9D56, 0xA597, 0xBE5A, 0xCEDB, 0xBE5A, 0xA597, 0x9556, 0x9556, 0xADB8, 0xC69B, 0xD6DC,
+  0xBE5A, 0xA597, 0x9556, 0x9D56, 0xADD8, 0xC67A, 0xC67A, 0xC67A, 0xDF3D, 0xADD7, 0x4A6A, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ACB,
+  0x3596, 0x4619, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x55B7, 0x8D97, 0xC65A,
+  0xD6DB, 0xBE5A, 0xA597, 0x9536, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xADD8, 0xC67A, 0xCEDB, 0xCEBB,
+  0xD6FC, 0xA575, 0x39C7, 0x0000, 0x0000, 0x0000, 0x1ACB, 0x3597, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0xB69B, 0xC65A, 0xA597, 0x9536, 0x9D56, 0xA5B8, 0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9D56,
+  0x9D56, 0xA5B8, 0xC67A, 0xD6DC, 0xCEBB, 0xCEDB, 0xAD96, 0x39C7, 0x0020, 0x0000, 0x0000, 0x0020, 0x1AAB, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0x8D97, 0x9D36, 0x9556, 0xA5B7, 0xC69B,
+  0xD6DC, 0xBE5A, 0xA597, 0x9D56, 0x9D56, 0xA5B8, 0xC67A, 0xCEDB, 0xCEBB, 0xCEBB, 0xAD96, 0x2965, 0x0020, 0x0000, 0x0020, 0x1A6A,
+  0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x8576, 0xADB8,
+  0xC69B, 0xD6DC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC67A, 0xCEBB, 0xC67A, 0xD6DC, 0xAD96, 0x2965, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x1AAB, 0x3597, 0x4619, 0x3576, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8,
+  0x5DB8, 0xA65A, 0xDEDC, 0xBE5A, 0xA597, 0x9556, 0x9D56, 0xA5B8, 0xC67A, 0xCEBB, 0xC67A, 0xD6FC, 0xA575, 0x31A6, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x1AEC, 0x3596, 0x4619, 0x3577, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8,
+  0x6E39, 0xA639, 0xAD97, 0x9D56, 0x9556, 0xADD8, 0xC67A, 0xCEDB, 0xCEBB, 0xD6FC, 0xA575, 0x3A08, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x1ACB, 0x3597, 0x3DF8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DB7,
+  0x55B7, 0x8D56, 0x9D56, 0xADD8, 0xBE7A, 0xCEDC, 0xCEBB, 0xD6DC, 0xA575, 0x3A08, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1AAA,
+  0x3597, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x55B7, 0x95B8, 0xC67A,
+  0xCEDC, 0xCEBB, 0xCEBB, 0xAD96, 0x31A6, 0x0020, 0x0000, 0x0020, 0x1A8A, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x65F9, 0xB67A, 0xD6DC, 0xCEDC, 0xAD96, 0x2965, 0x0000, 0x0000, 0x0000, 0x0041,
+  0x1A8A, 0x3DB8, 0x3DF8, 0x3576, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x6619, 0xB69B,
+  0xAD55, 0x3186, 0x0000, 0x0000, 0x0000, 0x0020, 0x1AAB, 0x3576, 0x4619, 0x3576, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x5D96, 0x4B2D, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x1ACB, 0x3596, 0x4619, 0x3577, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x2D76, 0x1B8F, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ACB,
+  0x3597, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x4619, 0x3DD8, 0x1B6D, 0x00A2, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0020, 0x1AAB, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8,
+  0x3DB7, 0x2CD3, 0x132C, 0x00C3, 0x0020, 0x0000, 0x0020, 0x1A6A, 0x3DD8, 0x3DD8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DD8,
+  0x3DB8, 0x3DD8, 0x3DB7, 0x2CF4, 0x2CB2, 0x1B2C, 0x00E3, 0x0000, 0x0000, 0x0000, 0x0020, 0x1AAB, 0x3597, 0x4619, 0x3576, 0x3DD8,
+  0x3DD8, 0x3DD8, 0x3DD8, 0x3DB7, 0x3DD8, 0x3DB7, 0x2CB3, 0x2C92, 0x2C92, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+  0x1AEC, 0x3596, 0x4619, 0x3597, 0x3DB8, 0x3DB8, 0x3DB8, 0x3DD8, 0x3DD8, 0x3556, 0x2C92, 0x1C31, 0x2CB2, 0x2CB2, 0x1B2C, 0x00E3,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ACC, 0x3596, 0x3DF8, 0x3DD8, 0x3DD8, 0x3DD8, 0x3DB8, 0x3556, 0x2CD3, 0x2C92,
+  0x2C92, 0x2451, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1249, 0x2D56, 0x3DB7, 0x3DB7, 0x3D97, 0x3535,
+  0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0020, 0x1208, 0x2CB3, 0x2CB3,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x132C, 0x00C3, 0x0000, 0x0000, 0x0020,
+  0x09C7, 0x2472, 0x2CB2, 0x1C31, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1B2C, 0x08E3,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x1208, 0x1C30, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CD3, 0x1C51, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2CB2, 0x2C92, 0x1B2C, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x0A08, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x132C, 0x00C3, 0x0020, 0x0000, 0x0020, 0x11E7, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1B2C, 0x00E3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0A08, 0x2451, 0x2CB3, 0x1C31, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1249,
+  0x2450, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2CB2, 0x1B2C, 0x00E3, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2451, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1208, 0x2471, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x09E7, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x132C, 0x00C3, 0x0000, 0x0000, 0x0041, 0x11E7,
+  0x2492, 0x2CB3, 0x1C31, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1B2C, 0x08E3, 0x0020,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0A08, 0x1C30, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2CB2, 0x2C92, 0x1B2C, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0A08, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x132C, 0x00C3, 0x0020, 0x0000, 0x0020, 0x11E7, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x1B2C, 0x00E3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0A08, 0x2451, 0x2CB3, 0x1C31, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1249, 0x2450,
+  0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2CB2, 0x1B2C, 0x00E3, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451,
+  0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1208, 0x2471, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x09E7, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x132C, 0x00C3, 0x0000, 0x0000, 0x0041, 0x11E7, 0x2492,
+  0x2CB3, 0x1C31, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x1B2C, 0x08E3, 0x0020, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0A08, 0x1C30, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2CB2, 0x2C92, 0x1B2C, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0020, 0x0A08, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x132C,
+  0x00C3, 0x0020, 0x0000, 0x0020, 0x11E7, 0x2C92, 0x2C92, 0x2C72, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x1B2C, 0x00E3, 0x0000, 0x0000, 0x0000, 0x0020, 0x0A08, 0x2451, 0x2CB3, 0x1C31, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x132C, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1249, 0x2450, 0x2CD3,
+  0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2C92, 0x2CB2, 0x1B2C, 0x00E3, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CB3, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451, 0x2CB2,
+  0x2C92, 0x132C, 0x00A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1208, 0x2471, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2CB2, 0x2C92, 0x132C, 0x00A2, 0x0000, 0x0020, 0x0000, 0x0000, 0x09E7, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1B0C, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0041, 0x11E7,
+  0x2492, 0x2CB3, 0x1C31, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2492, 0x0A08, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0A08, 0x1C30, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x1C51, 0x2D14, 0x12AA,
+  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2CD3, 0x1C51, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2492, 0x12CB, 0x0061, 0x0000, 0x0000, 0x0000, 0x1229, 0x2451, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2451,
+  0x2CF4, 0x12AA, 0x0041, 0x0000, 0x0000, 0x0000, 0x0020, 0x0A08, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92, 0x2C92,
+  0x2CD3, 0x09C7, 0x0020, 0x0000, 0x0020, 0x11E7, 0x2C92, 0x2CD3, 0x2C92, 0x2451, 0x1C51, 0x2CB2, 0x2CF3, 0x1AEB, 0x00A2, 0x0000,
+  0x0000, 0x0000, 0x0020, 0x09C7, 0x1B6D, 0x2C92, 0x2D34, 0x2CF3, 0x1BCF, 0x128A, 0x00C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0904, 0x1208, 0x128A, 0x1269, 0x0965, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+  0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_TOOTHBRUSH_EMOJI_88_SPANS = {
+  SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_ROWS, SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_OPS, SPRITE_TOOTHBRUSH_EMOJI_88_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_TOOTHBRUSH_EMOJI_88_ASSET = {
   SPRITE_TOOTHBRUSH_EMOJI_88_WIDTH, SPRITE_TOOTHBRUSH_EMOJI_88_HEIGHT,
-  SPRITE_TOOTHBRUSH_EMOJI_88_ALPHA, SPRITE_TOOTHBRUSH_EMOJI_88_RGB565
+  nullptr, nullptr, &SPRITE_TOOTHBRUSH_EMOJI_88_SPANS
 };
 
 #endif // SPRITE_TOOTHBRUSH_EMOJI_88_INCLUDED
@@ -5,66 +5,73 @@
 #include <cstdint>
 #include "sprite_asset.h"
 
-// Auto-generated from wink_tongue_22.png (22x22)  RGBA multi-couleur
-// RGB565 + alpha spars. Couleurs natives, blend au rendu.
+// Auto-generated from wink_tongue_22.png (22x22) — RGBA multi-couleur, encodé en spans
+// 436/484 pixels visibles, 1264 bytes flash (flat : 1452). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_WINK_TONGUE_22_WIDTH = 22;
 constexpr uint16_t SPRITE_WINK_TONGUE_22_HEIGHT = 22;
 
-const uint16_t SPRITE_WINK_TONGUE_22_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0xFE89, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE49, 0xFE69, 0xFE89, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xFD4A, 0x0000, 0xFE09, 0xFE89, 0xFE89, 0xFEAA, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFEAA, 0xFE89, 0xFE89, 0xFE09, 0x0000, 0xFD4A, 0x0000, 0x0000,
-  0x0000, 0xFFEF, 0x0000, 0xFE29, 0xFE89, 0xFEEA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFEEA, 0xFE89, 0xFE29, 0x0000, 0xFFEF, 0x0000,
-  0xFFEF, 0x0000, 0xFE49, 0xFE89, 0xFEAA, 0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE48, 0xFE48, 0xFE48, 0xFE48, 0xFEA9, 0xFE8A, 0xFE49, 0x0000, 0xFFEF,
-  0xFFEF, 0xFE69, 0xFE69, 0xFEAA, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE6A, 0xFF14, 0xF758, 0xF758, 0xFF13, 0xFE6A, 0xFEA9, 0xFE69, 0xFE69, 0xFFEF,
-  0x0000, 0xFE69, 0xFEEA, 0xFE49, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE69, 0xFE49, 0xFE6B, 0xF79B, 0xF7DF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFF9A, 0xFE6A, 0xFEEA, 0xFE69, 0x0000,
-  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE69, 0xFEAA, 0xFE8A, 0xFE49, 0xFE69, 0xFE48, 0xFF57, 0xF7FF, 0xFFDF, 0xC659, 0xCE79, 0xFFDF, 0xF7FF, 0xFF36, 0xFE68, 0xFE6A, 0xFE69,
-  0xFE69, 0xFEAA, 0xFE69, 0xFE49, 0xFE8A, 0xEDE9, 0xC4E7, 0xDD48, 0xFE89, 0xFE69, 0xFE6A, 0xF79D, 0xFFFF, 0xAD75, 0x1925, 0x2125, 0xB5B7, 0xFFFF, 0xF79C, 0xFE69, 0xFEAA, 0xFE69,
-  0xFE69, 0xFE8A, 0xFE49, 0xFE89, 0xD527, 0x6203, 0x51A2, 0x51A2, 0x9B85, 0xFE69, 0xFE6B, 0xF79D, 0xFFFF, 0x8431, 0x10C3, 0x10C3, 0x8C92, 0xFFFF, 0xF79C, 0xFE6A, 0xFE89, 0xFE69,
-  0xFE49, 0xFE69, 0xFE69, 0xF629, 0x82E4, 0x9365, 0xB446, 0xA406, 0x7283, 0xC4C7, 0xFEAA, 0xF77B, 0xFFFF, 0xDEFC, 0x632D, 0x636D, 0xE73C, 0xFFFF, 0xF77A, 0xFE49, 0xFE69, 0xFE49,
-  0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xF609, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE49, 0xF609, 0xFE48, 0xFED1, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFED0, 0xFE48, 0xFE69, 0xFE69,
-  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFE49, 0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE48, 0xFEF2, 0xF79D, 0xF7BF, 0xF7BF, 0xF79D, 0xFEF1, 0xFE48, 0xFE69, 0xFE69, 0xFE69,
-  0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE69, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE88, 0xFECB, 0xFF0F, 0xFEEF, 0xFE8B, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xFE49,
-  0xFE69, 0xFE89, 0xFE49, 0xFE89, 0x9BA5, 0x82E4, 0xA3C5, 0xB446, 0xC4A7, 0xC4E7, 0xC507, 0xC507, 0xC4E7, 0xBCA6, 0xB445, 0xA3C4, 0x82E4, 0x9BA5, 0xFE89, 0xFE49, 0xFE89, 0xFE69,
-  0xFE69, 0xFEAA, 0xFE49, 0xFEAA, 0xBC66, 0x51A2, 0x5A02, 0xA248, 0xCA6B, 0xB26A, 0xA9E8, 0xA9E8, 0xB269, 0xC26B, 0xA249, 0x5A02, 0x51A2, 0xBC66, 0xFEAA, 0xFE49, 0xFEAA, 0xFE69,
-  0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xF649, 0x82C4, 0x5202, 0xC2CA, 0xFAEF, 0xF2EE, 0xEA2C, 0xEA2C, 0xF2EE, 0xFAEF, 0xC2CA, 0x5202, 0x82C4, 0xF649, 0xFE69, 0xFE69, 0xFE69, 0xFE69,
-  0x0000, 0xFE69, 0xFEEA, 0xFE49, 0xFE89, 0xE5C8, 0x6A83, 0xB26A, 0xF2CE, 0xE2ED, 0xE22B, 0xE22B, 0xE2ED, 0xF2CE, 0xB26A, 0x6A83, 0xE5A8, 0xFE89, 0xFE49, 0xFEEA, 0xFE69, 0x0000,
-  0xFFEF, 0xFE69, 0xFE69, 0xFEAA, 0xFE49, 0xFE8A, 0xEE08, 0xD34B, 0xEAAE, 0xEAEE, 0xE22B, 0xE22B, 0xEAEE, 0xEAAE, 0xD34B, 0xEE08, 0xFE8A, 0xFE49, 0xFEAA, 0xFE69, 0xFE69, 0xFFEF,
-  0xFFEF, 0x0000, 0xFE49, 0xFE89, 0xFEAA, 0xFE29, 0xFEA9, 0xF40C, 0xE28E, 0xEAEE, 0xE22B, 0xE22B, 0xEAEE, 0xE28E, 0xF40C, 0xFEA9, 0xFE29, 0xFEAA, 0xFE89, 0xFE49, 0x0000, 0xFFEF,
-  0x0000, 0xFFEF, 0x0000, 0xFE29, 0xFE89, 0xFECA, 0xFEA9, 0xF44B, 0xE26E, 0xEAED, 0xE28C, 0xE28C, 0xEAED, 0xE26E, 0xF44B, 0xFEA9, 0xFECA, 0xFE89, 0xFE29, 0x0000, 0xFFEF, 0x0000,
-  0x0000, 0x0000, 0xFD4A, 0x0000, 0xFE09, 0xFE89, 0xFEA9, 0xFE4A, 0xF34D, 0xEAAE, 0xEACD, 0xEACD, 0xEAAE, 0xF34D, 0xFE4A, 0xFEA9, 0xFE89, 0xFE09, 0x0000, 0xFD4A, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0xFE2A, 0xFEC9, 0xFD6A, 0xEB4D, 0xEACD, 0xEACD, 0xEB4D, 0xFD6A, 0xFEC9, 0xFE2A, 0x0000, 0x0000, 0xFD4A, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_WINK_TONGUE_22_SPAN_ROWS[] PROGMEM = {
+  0, 0, 19, 12, 36, 28, 59, 46, 81, 66, 97, 88, 110, 108, 122, 130,
+  134, 152, 144, 174, 150, 196, 152, 218, 154, 240, 160, 262, 170, 284, 182, 306,
+  194, 328, 207, 348, 223, 370, 245, 390, 268, 408, 285, 424
 };
 
-const uint8_t SPRITE_WINK_TONGUE_22_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x28, 0x84, 0xCB, 0xF4, 0xFF, 0xFF, 0xF4, 0xCB, 0x84, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x11, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x11, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x31, 0xDA, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xDA, 0x31, 0x00, 0x02, 0x00,
-  0x02, 0x00, 0x2F, 0xED, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xED, 0x2F, 0x00, 0x02,
-  0x02, 0x10, 0xDD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDD, 0x10, 0x02,
-  0x00, 0x91, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x91, 0x00,
-  0x24, 0xF5, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF5, 0x24,
-  0x84, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x84,
-  0xCB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCB,
-  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
-  0xCB, 0xFE, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xCB,
-  0x84, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x84,
-  0x24, 0xF5, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xF5, 0x24,
-  0x00, 0x91, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x91, 0x00,
-  0x02, 0x10, 0xDD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xDD, 0x10, 0x02,
-  0x02, 0x00, 0x2F, 0xED, 0xFF, 0xFA, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA, 0xFF, 0xED, 0x2F, 0x00, 0x02,
-  0x00, 0x02, 0x00, 0x31, 0xDA, 0xFF, 0xFF, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFF, 0xFF, 0xDA, 0x31, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x11, 0x8F, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0x11, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x28, 0x84, 0xCB, 0xF4, 0xFF, 0xFF, 0xF4, 0xCB, 0x84, 0x28, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00
+const uint8_t SPRITE_WINK_TONGUE_22_SPAN_OPS[] PROGMEM = {
+  0x02, 0x80, 0x03, 0x01, 0x83, 0x28, 0x84, 0xCB, 0xF4, 0x41, 0x83, 0xF4, 0xCB, 0x84, 0x28, 0x01, 0x80, 0x03, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82,
+  0x11, 0x8F, 0xF0, 0x47, 0x82, 0xF0, 0x8F, 0x11, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x31, 0xDA, 0x41, 0x81, 0xFC, 0xFD, 0x43,
+  0x81, 0xFD, 0xFC, 0x41, 0x81, 0xDA, 0x31, 0x00, 0x80, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x2F, 0xED, 0x40, 0x81, 0xFA, 0xFE, 0x47, 0x81, 0xFE,
+  0xFA, 0x40, 0x81, 0xED, 0x2F, 0x00, 0x80, 0x02, 0xC0, 0x82, 0x02, 0x10, 0xDD, 0x40, 0x80, 0xFB, 0x4B, 0x80, 0xFB, 0x40, 0x82, 0xDD, 0x10, 0x02,
+  0xC0, 0x00, 0x80, 0x91, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFB, 0x40, 0x80, 0x91, 0xC0, 0x83, 0x24, 0xF5, 0xFD, 0xFE, 0x4D, 0x83, 0xFE, 0xFD, 0xF5,
+  0x24, 0xC0, 0x80, 0x84, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0x84, 0xC0, 0x82, 0xCB, 0xFE, 0xFD, 0x4F, 0x82, 0xFD, 0xFE, 0xCB, 0xC0,
+  0x80, 0xF4, 0x53, 0x80, 0xF4, 0xC0, 0x55, 0xC0, 0x55, 0xC0, 0x80, 0xF4, 0x53, 0x80, 0xF4, 0xC0, 0x82, 0xCB, 0xFE, 0xFD, 0x4F, 0x82, 0xFD, 0xFE,
+  0xCB, 0xC0, 0x80, 0x84, 0x40, 0x80, 0xFC, 0x4F, 0x80, 0xFC, 0x40, 0x80, 0x84, 0xC0, 0x83, 0x24, 0xF5, 0xFD, 0xFE, 0x4D, 0x83, 0xFE, 0xFD, 0xF5,
+  0x24, 0xC0, 0x00, 0x80, 0x91, 0x40, 0x80, 0xFB, 0x4D, 0x80, 0xFB, 0x40, 0x80, 0x91, 0xC0, 0x82, 0x02, 0x10, 0xDD, 0x40, 0x80, 0xFB, 0x4B, 0x80,
+  0xFB, 0x40, 0x82, 0xDD, 0x10, 0x02, 0xC0, 0x80, 0x02, 0x00, 0x81, 0x2F, 0xED, 0x40, 0x81, 0xFA, 0xFE, 0x47, 0x81, 0xFE, 0xFA, 0x40, 0x81, 0xED,
+  0x2F, 0x00, 0x80, 0x02, 0xC0, 0x00, 0x80, 0x02, 0x00, 0x81, 0x31, 0xDA, 0x41, 0x81, 0xFC, 0xFD, 0x43, 0x81, 0xFD, 0xFC, 0x41, 0x81, 0xDA, 0x31,
+  0x00, 0x80, 0x02, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x82, 0x11, 0x8F, 0xF0, 0x47, 0x82, 0xF0, 0x8F, 0x11, 0x00, 0x80, 0x03, 0xC0, 0x02, 0x80, 0x03,
+  0x01, 0x83, 0x28, 0x84, 0xCB, 0xF4, 0x41, 0x83, 0xF4, 0xCB, 0x84, 0x28, 0x01, 0x80, 0x03, 0xC0
 };
 
-// Asset gnrique rutilisable depuis le systme de spawnSprite()
+const uint16_t SPRITE_WINK_TONGUE_22_SPAN_PX[] PROGMEM = {
+  0x0000, 0x2101, 0x8364, 0xC4E7, 0xF608, 0xFE69, 0xFE69, 0xF608, 0xC4E7, 0x8364, 0x2101, 0x0000, 0x0000, 0x0860, 0x8BA5, 0xEE08,
+  0xFEAA, 0xFE89, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFEAA, 0xEE08, 0x8BA5, 0x0860, 0x0000, 0x0000, 0x2921, 0xD567, 0xFEEA,
+  0xFE69, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE6A, 0xFEEA, 0xD567, 0x2921, 0x0000, 0x0000, 0x2921,
+  0xEE08, 0xFEAA, 0xF628, 0xFE49, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE48, 0xFE48, 0xFE48, 0xF607, 0xFEA9, 0xEE09,
+  0x2921, 0x0000, 0x0000, 0x0860, 0xDD87, 0xFEAA, 0xF608, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xFE6A, 0xFF14,
+  0xF758, 0xF758, 0xFF13, 0xF629, 0xFEA9, 0xDD87, 0x0860, 0x0000, 0x8B85, 0xFEEA, 0xF608, 0xFE69, 0xFE49, 0xFE49, 0xFE49, 0xFE69,
+  0xFE69, 0xFE49, 0xFE6B, 0xF79B, 0xF7DF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFF9A, 0xF629, 0xFEEA, 0x8B85, 0x20E1, 0xF628, 0xFE69, 0xFE69,
+  0xFE49, 0xFE69, 0xFEAA, 0xFE8A, 0xFE49, 0xFE69, 0xFE48, 0xFF57, 0xF7FF, 0xFFDF, 0xC659, 0xCE79, 0xFFDF, 0xF7FF, 0xFF36, 0xFE68,
+  0xF629, 0x20E1, 0x8364, 0xFEAA, 0xFE69, 0xFE49, 0xFE8A, 0xEDE9, 0xC4E7, 0xDD48, 0xFE89, 0xFE69, 0xFE6A, 0xF79D, 0xFFFF, 0xAD75,
+  0x1925, 0x2125, 0xB5B7, 0xFFFF, 0xF79C, 0xFE69, 0xFEAA, 0x8364, 0xC4E7, 0xFE8A, 0xFE49, 0xFE89, 0xD527, 0x6203, 0x51A2, 0x51A2,
+  0x9B85, 0xFE69, 0xFE6B, 0xF79D, 0xFFFF, 0x8431, 0x10C3, 0x10C3, 0x8C92, 0xFFFF, 0xF79C, 0xFE6A, 0xFE89, 0xC4E7, 0xF608, 0xFE69,
+  0xFE69, 0xF629, 0x82E4, 0x9365, 0xB446, 0xA406, 0x7283, 0xC4C7, 0xFEAA, 0xF77B, 0xFFFF, 0xDEFC, 0x632D, 0x636D, 0xE73C, 0xFFFF,
+  0xF77A, 0xFE49, 0xFE69, 0xF608, 0xFE69, 0xFE69, 0xFE69, 0xFE49, 0xF609, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE49, 0xF609, 0xFE48, 0xFED1,
+  0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFED0, 0xFE48, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE69, 0xFE89, 0xFE49,
+  0xFE49, 0xFE49, 0xFE49, 0xFE69, 0xFE49, 0xFE48, 0xFEF2, 0xF79D, 0xF7BF, 0xF7BF, 0xF79D, 0xFEF1, 0xFE48, 0xFE69, 0xFE69, 0xFE69,
+  0xF608, 0xFE69, 0xFE69, 0xFE69, 0xFE29, 0xFE69, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFEAA, 0xFE88, 0xFECB, 0xFF0F, 0xFEEF,
+  0xFE8B, 0xFE28, 0xFE69, 0xFE69, 0xFE69, 0xF608, 0xC4E7, 0xFE89, 0xFE49, 0xFE89, 0x9BA5, 0x82E4, 0xA3C5, 0xB446, 0xC4A7, 0xC4E7,
+  0xC507, 0xC507, 0xC4E7, 0xBCA6, 0xB445, 0xA3C4, 0x82E4, 0x9BA5, 0xFE89, 0xFE49, 0xFE89, 0xC4E7, 0x8364, 0xFEAA, 0xFE49, 0xFEAA,
+  0xBC66, 0x51A2, 0x5A02, 0xA248, 0xCA6B, 0xB26A, 0xA9E8, 0xA9E8, 0xB269, 0xC26B, 0xA249, 0x5A02, 0x51A2, 0xBC66, 0xFEAA, 0xFE49,
+  0xFEAA, 0x8364, 0x20E1, 0xF628, 0xFE69, 0xFE69, 0xF649, 0x82C4, 0x5202, 0xC2CA, 0xFAEF, 0xF2EE, 0xEA2C, 0xEA2C, 0xF2EE, 0xFAEF,
+  0xC2CA, 0x5202, 0x82C4, 0xF649, 0xFE69, 0xFE69, 0xF628, 0x20E1, 0x8B85, 0xFEEA, 0xF608, 0xFE89, 0xE5C8, 0x6A83, 0xB26A, 0xF2CE,
+  0xE2ED, 0xE22B, 0xE22B, 0xE2ED, 0xF2CE, 0xB26A, 0x6A83, 0xE5A8, 0xFE89, 0xF608, 0xFEEA, 0x8B85, 0x0000, 0x0860, 0xDD87, 0xFEAA,
+  0xF608, 0xFE8A, 0xEE08, 0xD34B, 0xEAAE, 0xEAEE, 0xE22B, 0xE22B, 0xEAEE, 0xEAAE, 0xD34B, 0xEE08, 0xFE8A, 0xF608, 0xFEAA, 0xDD87,
+  0x0860, 0x0000, 0x0000, 0x2921, 0xEE08, 0xFEAA, 0xF5E8, 0xFEA9, 0xF40C, 0xE28E, 0xEAEE, 0xE22B, 0xE22B, 0xEAEE, 0xE28E, 0xF40C,
+  0xFEA9, 0xF5E8, 0xFEAA, 0xEE08, 0x2921, 0x0000, 0x0000, 0x2921, 0xD567, 0xFECA, 0xFEA9, 0xF44B, 0xE26E, 0xEAED, 0xE28C, 0xE28C,
+  0xEAED, 0xE26E, 0xF44B, 0xFEA9, 0xFECA, 0xD567, 0x2921, 0x0000, 0x0000, 0x0860, 0x8BA5, 0xEE28, 0xFE4A, 0xF34D, 0xEAAE, 0xEACD,
+  0xEACD, 0xEAAE, 0xF34D, 0xFE4A, 0xEE28, 0x8BA5, 0x0860, 0x0000, 0x0000, 0x20E1, 0x8384, 0xC427, 0xE32C, 0xEACD, 0xEACD, 0xE32C,
+  0xC427, 0x8384, 0x20E1, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_WINK_TONGUE_22_SPANS = {
+  SPRITE_WINK_TONGUE_22_SPAN_ROWS, SPRITE_WINK_TONGUE_22_SPAN_OPS, SPRITE_WINK_TONGUE_22_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_WINK_TONGUE_22_ASSET = {
   SPRITE_WINK_TONGUE_22_WIDTH, SPRITE_WINK_TONGUE_22_HEIGHT,
-  SPRITE_WINK_TONGUE_22_ALPHA, SPRITE_WINK_TONGUE_22_RGB565
+  nullptr, nullptr, &SPRITE_WINK_TONGUE_22_SPANS
 };
 
 #endif // SPRITE_WINK_TONGUE_22_INCLUDED
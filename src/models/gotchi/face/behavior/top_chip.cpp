@@ -1,9 +1,7 @@
 #include "top_chip.h"
 #include <cstring>
-#include <Arduino_GFX_Library.h>
 #include <esp_heap_caps.h>
-
-extern Arduino_GFX* getGotchiGfx();
+#include "../face_renderer.h"
 
 namespace {
 
@@ -18,7 +16,6 @@ int16_t s_chipW = 0;
 int16_t s_chipH = 0;
 int16_t s_chipScreenX = 0;
 int16_t s_chipScreenY = 0;
-bool s_needsClear = false;  // Flag pour effacer la zone à la prochaine frame
 
 // Constantes d'affichage
 constexpr int SCALE = 3;
@@ -137,7 +134,7 @@ void drawChar(uint16_t* buf, int16_t bufW, int16_t bufH,
 // Allouer/redimensionner le buffer du chip si nécessaire
 bool ensureBuffer(int16_t w, int16_t h) {
   if (s_chipBuf && s_chipW == w && s_chipH == h) return true;
-  if (s_chipBuf) { free(s_chipBuf); s_chipBuf = nullptr; }
+  if (s_chipBuf) { heap_caps_free(s_chipBuf); s_chipBuf = nullptr; }
   s_chipBuf = (uint16_t*)heap_caps_malloc(w * h * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
   if (!s_chipBuf) return false;
   s_chipW = w;
@@ -145,8 +142,8 @@ bool ensureBuffer(int16_t w, int16_t h) {
   return true;
 }
 
-// Rendre le chip dans son buffer et le flusher à l'écran
-void renderAndFlush() {
+// Rendre le chip dans son buffer (composé dans le FB à chaque frame par drawIntoFB)
+void render() {
   if (!s_visible || s_text[0] == '\0') return;
 
   int textLen = strlen(s_text);
@@ -160,7 +157,7 @@ void renderAndFlush() {
   s_chipScreenX = SCREEN_CX - chipW / 2;
   s_chipScreenY = CHIP_Y;
 
-  // Clear buffer
+  // Clear buffer (0 = transparent : coins arrondis)
   memset(s_chipBuf, 0, chipW * chipH * sizeof(uint16_t));
 
   // Fond arrondi
@@ -174,25 +171,6 @@ void renderAndFlush() {
     drawChar(s_chipBuf, chipW, chipH, textX, textY, idx, s_accentColor, SCALE);
     textX += CHAR_W;
   }
-
-  // Flush directement à l'écran
-  Arduino_GFX* gfx = getGotchiGfx();
-  if (gfx) {
-    gfx->draw16bitRGBBitmap(s_chipScreenX, s_chipScreenY, s_chipBuf, chipW, chipH);
-  }
-}
-
-// Effacer la zone du chip à l'écran (remplir de noir)
-void clearFromScreen() {
-  if (s_chipW <= 0 || s_chipH <= 0) return;
-  Arduino_GFX* gfx = getGotchiGfx();
-  if (!gfx) return;
-
-  // Remplir la zone avec du noir
-  if (s_chipBuf) {
-    memset(s_chipBuf, 0, s_chipW * s_chipH * sizeof(uint16_t));
-    gfx->draw16bitRGBBitmap(s_chipScreenX, s_chipScreenY, s_chipBuf, s_chipW, s_chipH);
-  }
 }
 
 } // namespace
@@ -212,8 +190,7 @@ void show(const char* text, uint16_t accentColor, uint16_t bgColor) {
   s_accentColor = accentColor;
   s_bgColor = (bgColor == 0) ? darken(accentColor) : bgColor;
   s_visible = true;
-  s_needsClear = false;
-  renderAndFlush();
+  render();
 }
 
 void showAuto(const char* text, uint16_t accentColor) {
@@ -221,13 +198,30 @@ void showAuto(const char* text, uint16_t accentColor) {
 }
 
 void hide() {
+  // Plus composé : le flush du FB restaure ce qu'il y avait dessous
   s_visible = false;
   s_text[0] = '\0';
-  clearFromScreen();
 }
 
 void update() {
-  if (s_visible) renderAndFlush();
+  if (s_visible) render();
+}
+
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY) {
+  if (!fb || !s_visible || !s_chipBuf) return;
+  const int16_t x0 = s_chipScreenX - fbX;
+  const int16_t y0 = s_chipScreenY - fbY;
+  for (int16_t j = 0; j < s_chipH; j++) {
+    const int16_t y = y0 + j;
+    if (y < 0 || y >= fbH) continue;
+    const uint16_t* src = s_chipBuf + j * s_chipW;
+    uint16_t* dst = fb + y * fbW;
+    for (int16_t i = 0; i < s_chipW; i++) {
+      const int16_t x = x0 + i;
+      if (src[i] && x >= 0 && x < fbW) dst[x] = src[i];
+    }
+  }
+  FaceRenderer::markDirty(x0, y0, s_chipW, s_chipH);
 }
 
 } // namespace TopChip
@@ -4,8 +4,8 @@
 #include <cstdint>
 
 // TopChip — composant réutilisable pour afficher un chip (pill/badge)
-// en haut de l'écran du Gotchi. Utilise son propre mini-framebuffer
-// et flush directement via Arduino_GFX (pas de conflit avec le top buffer).
+// en haut de l'écran du Gotchi. Rendu dans un mini-buffer à chaque changement,
+// puis composé dans le FB du FaceRenderer (couche la plus haute) à chaque frame.
 //
 // Usage:
 //   TopChip::show("38.5^C", 0xF800);   // texte rouge, fond auto-darken
@@ -19,12 +19,15 @@ namespace TopChip {
 // Afficher le chip. bgColor=0 → fond = version sombre de accentColor.
 void show(const char* text, uint16_t accentColor, uint16_t bgColor = 0);
 
-// Masquer le chip et effacer de l'écran.
+// Masquer le chip (disparaît au flush suivant).
 void hide();
 
 // Re-render le chip (appeler dans onUpdate si la valeur change).
 void update();
 
+// Couche du compositeur FaceRenderer : copie le chip dans le FB (coins transparents).
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
+
 // Assombrir une couleur RGB565.
 uint16_t darken(uint16_t color);
 
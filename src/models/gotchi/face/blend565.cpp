@@ -0,0 +1,75 @@
+#include "blend565.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+namespace {
+
+constexpr int BENCH_PX = 4096;    // 8 KB par buffer, en RAM interne
+constexpr int BENCH_PASSES = 16;
+
+} // namespace
+
+namespace Blend565 {
+
+uint16_t reference(uint16_t bg, uint16_t fg, uint8_t alpha) {
+  if (alpha == 0) return bg;
+  if (alpha >= 250) return fg;
+  uint16_t inv = 255 - alpha;
+  uint16_t r = (((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * inv) / 255;
+  uint16_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * inv) / 255;
+  uint16_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * inv) / 255;
+  return (r << 11) | (g << 5) | b;
+}
+
+bool benchmark(BenchResult& out) {
+  uint16_t* dst = (uint16_t*)heap_caps_malloc(BENCH_PX * sizeof(uint16_t), MALLOC_CAP_INTERNAL);
+  uint16_t* src = (uint16_t*)heap_caps_malloc(BENCH_PX * sizeof(uint16_t), MALLOC_CAP_INTERNAL);
+  uint8_t* alpha = (uint8_t*)heap_caps_malloc(BENCH_PX, MALLOC_CAP_INTERNAL);
+  if (!dst || !src || !alpha) {
+    heap_caps_free(dst);
+    heap_caps_free(src);
+    heap_caps_free(alpha);
+    return false;
+  }
+
+  uint32_t seed = 0x12345678;
+  for (int i = 0; i < BENCH_PX; i++) {
+    seed = seed * 1664525u + 1013904223u;
+    dst[i] = (uint16_t)seed;
+    src[i] = (uint16_t)(seed >> 16);
+    alpha[i] = (uint8_t)(seed >> 8);
+  }
+
+  out.pixels = (uint32_t)BENCH_PX * BENCH_PASSES;
+
+  uint32_t t0 = micros();
+  for (int p = 0; p < BENCH_PASSES; p++) {
+    for (int i = 0; i < BENCH_PX; i++) dst[i] = reference(dst[i], src[i], alpha[i]);
+  }
+  out.referenceUs = micros() - t0;
+
+  t0 = micros();
+  for (int p = 0; p < BENCH_PASSES; p++) {
+    for (int i = 0; i < BENCH_PX; i++) dst[i] = over(dst[i], src[i], alpha[i]);
+  }
+  out.overUs = micros() - t0;
+
+  t0 = micros();
+  for (int p = 0; p < BENCH_PASSES; p++) {
+    for (int i = 0; i < BENCH_PX; i++) dst[i] = overPremul(dst[i], src[i], alpha[i]);
+  }
+  out.premulUs = micros() - t0;
+
+  t0 = micros();
+  for (int p = 0; p < BENCH_PASSES; p++) {
+    overRun(dst, src, BENCH_PX, 128);
+  }
+  out.runUs = micros() - t0;
+
+  heap_caps_free(dst);
+  heap_caps_free(src);
+  heap_caps_free(alpha);
+  return true;
+}
+
+} // namespace Blend565
@@ -0,0 +1,132 @@
+#ifndef BLEND565_H
+#define BLEND565_H
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Blend565 — mélange alpha RGB565 sans division, partagé par tous les blitters
+ * (sprites FB / top buffer / overlays).
+ *
+ * Astuce "spread" : un pixel 565 est étalé sur 32 bits (G en haut, R et B en
+ * bas, masque 0x07E0F81F) pour que les trois canaux soient multipliés par
+ * l'alpha en une seule multiplication, sans débordement d'un canal sur l'autre.
+ * L'alpha est ramené sur 5 bits (0-32), d'où des >> 5 à la place des / 255.
+ *
+ * Deux variantes :
+ *   - alpha droit    : over()        (sprites flat, mono-alpha colorisés)
+ *   - pré-multiplié  : overPremul()  (runs BLEND des sprites spans : la couleur
+ *                      stockée vaut déjà couleur * alpha, il reste une seule
+ *                      multiplication, celle du fond)
+ * et un noyau 2 pixels par mot 32 bits pour les runs à alpha constant
+ * (opacité globale sur un run opaque) : overRun().
+ */
+namespace Blend565 {
+
+constexpr uint32_t SPREAD_MASK = 0x07E0F81F;  // G(21-26) | R(11-15) | B(0-4)
+constexpr uint32_t PAIR_MASK_LO = 0x07E0F81F; // B0 | R0 | G1 d'un mot de 2 pixels
+constexpr uint32_t PAIR_MASK_HI = 0x07C0F83F; // G0 | B1 | R1 du même mot décalé de 5
+
+inline uint32_t spread(uint16_t c) {
+  return ((uint32_t)c | ((uint32_t)c << 16)) & SPREAD_MASK;
+}
+
+inline uint16_t pack(uint32_t s) {
+  s &= SPREAD_MASK;
+  return (uint16_t)(s | (s >> 16));
+}
+
+// Alpha 8 bits -> 5 bits (0-32, 255 -> 32)
+inline uint32_t alpha5(uint8_t a) {
+  return ((uint32_t)a + 4) >> 3;
+}
+
+// a * opacity / 255 sans division (exact aux bornes : opacity 255 -> a)
+inline uint8_t scaleAlpha(uint8_t a, uint8_t opacity) {
+  return (uint8_t)(((uint32_t)a * ((uint32_t)opacity + 1)) >> 8);
+}
+
+// fg (alpha droit) sur bg
+inline uint16_t over(uint16_t bg, uint16_t fg, uint8_t a) {
+  const uint32_t k = alpha5(a);
+  if (k == 0) return bg;
+  if (k == 32) return fg;
+  return pack((spread(fg) * k + spread(bg) * (32 - k)) >> 5);
+}
+
+// fgP pré-multiplié par a (canal = canal * alpha5(a) >> 5, voir
+// png_to_sprite_rgba.py) sur bg. La somme ne peut pas déborder d'un canal.
+inline uint16_t overPremul(uint16_t bg, uint16_t fgP, uint8_t a) {
+  const uint32_t inv = 32 - alpha5(a);
+  return pack(spread(fgP) + (((spread(bg) * inv) >> 5) & SPREAD_MASK));
+}
+
+// ceil((32 << 9) / A) pour A = 1..32 : (k * PREMUL_RECIP[A]) >> 9 == floor(32 * k / A)
+// exactement pour tout k <= A (vérifié pour toutes les paires)
+constexpr uint16_t PREMUL_RECIP[33] = {
+  0, 16384, 8192, 5462, 4096, 3277, 2731, 2341, 2048, 1821, 1639, 1490, 1366, 1261, 1171, 1093,
+  1024, 964, 911, 863, 820, 781, 745, 713, 683, 656, 631, 607, 586, 565, 547, 529, 512
+};
+
+// Idem avec une opacité globale appliquée au pixel pré-multiplié.
+// a * opacity est combiné sur 8 bits avant le passage à 5 bits (une seule
+// quantification) : couverture k = alpha5(scaleAlpha(a, opacity)). La couleur
+// stockée vaut c * A / 32 (A = alpha5(a)), elle est ramenée à c * k / 32 par
+// le facteur floor(32 * k / A) : arrondie en dessous, la somme ne déborde pas.
+inline uint16_t overPremul(uint16_t bg, uint16_t fgP, uint8_t a, uint8_t opacity) {
+  const uint32_t k = alpha5(scaleAlpha(a, opacity));
+  const uint32_t f = (k * PREMUL_RECIP[alpha5(a)]) >> 9;
+  const uint32_t fgS = ((spread(fgP) * f) >> 5) & SPREAD_MASK;
+  return pack(fgS + (((spread(bg) * (32 - k)) >> 5) & SPREAD_MASK));
+}
+
+// 2 pixels 565 par mot 32 bits (pixel 0 en poids faible), même alpha k (0-32)
+inline uint32_t over2(uint32_t bg2, uint32_t fg2, uint32_t k) {
+  const uint32_t inv = 32 - k;
+  const uint32_t lo = (((fg2 & PAIR_MASK_LO) * k + (bg2 & PAIR_MASK_LO) * inv) >> 5) & PAIR_MASK_LO;
+  const uint32_t hi = ((((fg2 >> 5) & PAIR_MASK_HI) * k + ((bg2 >> 5) & PAIR_MASK_HI) * inv) >> 5) & PAIR_MASK_HI;
+  return lo | (hi << 5);
+}
+
+// Run de n pixels src (alpha droit) sur dst avec un alpha constant a.
+// Traite dst par mots 32 bits alignés, src peut être non aligné (PROGMEM).
+inline void overRun(uint16_t* dst, const uint16_t* src, int n, uint8_t a) {
+  const uint32_t k = alpha5(a);
+  if (k == 0 || n <= 0) return;
+  if (k == 32) {
+    memcpy(dst, src, (size_t)n * sizeof(uint16_t));
+    return;
+  }
+  int i = 0;
+  if (((uintptr_t)dst & 2) != 0) {
+    dst[0] = over(dst[0], src[0], a);
+    i = 1;
+  }
+  for (; i + 1 < n; i += 2) {
+    uint32_t bg2;
+    memcpy(&bg2, dst + i, sizeof(bg2));
+    const uint32_t fg2 = (uint32_t)src[i] | ((uint32_t)src[i + 1] << 16);
+    const uint32_t out = over2(bg2, fg2, k);
+    memcpy(dst + i, &out, sizeof(out));
+  }
+  if (i < n) dst[i] = over(dst[i], src[i], a);
+}
+
+// Ancien blend565 à divisions (dirt_overlay / behavior_objects), conservé
+// comme référence des benchmarks (cible et test natif test_blend565)
+uint16_t reference(uint16_t bg, uint16_t fg, uint8_t alpha);
+
+// Micro-benchmark embarqué (commande serial "face blend bench") :
+// pixels/s de l'ancien blend à divisions vs les noyaux ci-dessus.
+struct BenchResult {
+  uint32_t pixels;
+  uint32_t referenceUs;  // ancien blend565 (3 divisions / pixel)
+  uint32_t overUs;       // over() alpha droit
+  uint32_t premulUs;     // overPremul()
+  uint32_t runUs;        // overRun() 2 px / mot, alpha constant
+};
+bool benchmark(BenchResult& out);
+
+} // namespace Blend565
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef FACE_FIXED_H
+#define FACE_FIXED_H
+
+#include <cstdint>
+#include <cmath>
+
+/**
+ * FaceFixed — géométrie entière du face renderer.
+ *
+ * Le scale est stocké en Q2.30 (setScale) : un float de [1/64, 1] y est
+ * représenté exactement. Les dimensions entières du visage (yeux, écarts,
+ * marges de la bouche) en découlent par produits entiers qui reproduisent au
+ * bit près les anciens (int16_t)(x * sc) : produit exact, arrondi à 24 bits
+ * de mantisse comme le FPU, puis troncature vers zéro. Un Q16.16 arrondi
+ * décalait d'un pixel une partie des tailles pour la plupart des scales (0.7,
+ * 0.52...) ; seuls 0.6 et 1.0 tombaient juste. Les entrées déjà float
+ * (regard, ouverture de bouche) sont converties en pixels une fois par frame.
+ *
+ * Les coins arrondis (round rect, petites formes) et la goutte de bave
+ * utilisaient sqrtf par ligne : remplacés par une table d'indentations
+ * calculée à la compilation et une racine entière.
+ */
+namespace FaceFixed {
+
+constexpr int32_t Q30_ONE = 1 << 30;
+
+// Exact pour v dans [1/64, 1] (multiplication par une puissance de 2)
+inline int32_t toQ30(float v) {
+  return (int32_t)(v * (float)Q30_ONE);
+}
+
+// (int32_t)(v * s) calculé en float, pour s = q / 2^30
+inline int32_t mulQ30(int32_t v, int32_t q) {
+  const int64_t p = (int64_t)v * q;
+  uint64_t a = p < 0 ? (uint64_t)-p : (uint64_t)p;
+  if (!a) return 0;
+  // Arrondi au plus proche (pair en cas d'égalité) sur 24 bits significatifs
+  const int shift = (63 - __builtin_clzll(a)) - 23;
+  if (shift > 0) {
+    const uint64_t mask = (1ull << shift) - 1;
+    const uint64_t half = 1ull << (shift - 1);
+    const uint64_t rem = a & mask;
+    a -= rem;
+    if (rem > half || (rem == half && ((a >> shift) & 1))) a += 1ull << shift;
+  }
+  const int32_t t = (int32_t)(a >> 30);
+  return p < 0 ? -t : t;
+}
+
+// floor(sqrt(n))
+constexpr uint32_t isqrt(uint32_t n) {
+  uint32_t root = 0;
+  uint32_t bit = 1u << 30;
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+// Indentation de la ligne j (0 = bord) d'un coin de rayon r, échantillonné
+// au milieu de la ligne : r - floor(sqrt(r² - (r - j - 0.5)²)).
+// En quarts de pixel : sqrt(4r² - (2r - 2j - 1)²) / 2, tout entier.
+constexpr int16_t indentExact(int16_t r, int16_t j) {
+  const int32_t d = 2 * r - 2 * j - 1;
+  return (int16_t)(r - (int16_t)(isqrt((uint32_t)(4 * r * r - d * d)) / 2));
+}
+
+constexpr int16_t INDENT_MAX_R = 32;  // Couvre bouche, langue et petites formes (H <= 30)
+
+struct IndentTable {
+  uint8_t v[INDENT_MAX_R + 1][INDENT_MAX_R];
+};
+
+constexpr IndentTable makeIndentTable() {
+  IndentTable t{};
+  for (int16_t r = 1; r <= INDENT_MAX_R; r++)
+    for (int16_t j = 0; j < r; j++) t.v[r][j] = (uint8_t)indentExact(r, j);
+  return t;
+}
+
+inline constexpr IndentTable INDENT_TABLE = makeIndentTable();
+
+// Indentation de la ligne j d'une forme de hauteur h à coins de rayon r
+// (0 hors des coins), symétrique haut/bas
+inline int16_t rowIndent(int16_t r, int16_t h, int16_t j) {
+  int16_t k;
+  if (j < r) k = j;
+  else if (j >= h - r) k = h - 1 - j;
+  else return 0;
+  return r <= INDENT_MAX_R ? INDENT_TABLE.v[r][k] : indentExact(r, k);
+}
+
+} // namespace FaceFixed
+
+#endif
@@ -1,24 +1,55 @@
 /**
- * Face Renderer — Double framebuffer logique avec diff pixel-par-pixel.
- * On dessine tout (yeux + bouche) dans un buffer, on compare avec le précédent,
- * on envoie seulement les pixels qui changent. Zéro flash, zéro conflit.
+ * Face Renderer — Double framebuffer logique avec damage tracking.
+ * On dessine tout (yeux + bouche + objets) dans s_fbNext. Chaque écriture
+ * enregistre ses bornes [x0,x1] par ligne. Au flush, on prend l'union des
+ * lignes touchées cette frame et la frame précédente, on la resserre en
+ * comparant avec s_fbCurrent (= ce qui est à l'écran), puis on regroupe le
+ * tout en quelques rectangles alignés sur 2px (QSPI CO5300) qu'on pousse.
+ * Une frame où rien ne bouge n'envoie aucun octet.
+ * Les mêmes spans servent à l'effacement : avant de redessiner dans un buffer,
+ * on ne remet à zéro que les lignes/segments qu'il contient (pas de memset).
+ *
+ * Pipeline : en mode async (défaut), le transfert vers le panel est fait par
+ * une tâche dédiée sur l'autre cœur. Pendant que la frame N part sur le bus,
+ * la frame N+1 se dessine dans l'autre buffer. On n'attend la fin du transfert
+ * précédent qu'au moment de soumettre la frame suivante.
+ *
+ * Compositeur : le FB est la seule surface poussée vers le panel pour la zone
+ * visage + bandeau haut. Après le visage, les couches (saleté, objets, overlays,
+ * chip) y sont dessinées de l'arrière vers l'avant ; chacune signale ce qu'elle
+ * écrit via markDirty(), et le flush envoie le tout en un seul jeu de rectangles.
+ *
+ * Rasterisation bi-cœur (optionnelle, "face raster dual") : s_fbNext est coupé
+ * en deux bandes horizontales. La tâche de rendu dessine la bande haute pendant
+ * que la tâche FaceRaster (CORE_RASTER) dessine la bande basse, puis les deux
+ * se rejoignent avant le flush. Chaque bande ne touche que ses lignes (pixels
+ * et spans de damage) : aucun verrou pendant le dessin.
  *
  * Le framebuffer ne couvre pas tout l'écran (466x466 = 434KB trop gros).
- * On utilise une zone réduite qui contient le visage : 280x200 (~112KB).
+ * On utilise une zone réduite : 426x410 (~341KB), visage + bandeau haut.
  * Deux buffers en PSRAM : current et next.
  */
 #include "face_renderer.h"
+#include "face_fixed.h"
 #include "../config/config.h"
+#include "common/config/core_config.h"
 #include "../config/gotchi_theme.h"
 #include "behavior/behavior_objects.h"
 #include "behavior/dirt_overlay.h"
+#include "behavior/top_chip.h"
+#include "overlay/face_overlay_layer.h"
 #include <cmath>
 #include <cstring>
 #include <algorithm>
 #include <Arduino_GFX_Library.h>
 #include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
 
 extern Arduino_GFX* getGotchiGfx();
+extern void lockGotchiGfx();
+extern void unlockGotchiGfx();
 
 #include "behavior/behavior_engine.h"
 
@@ -35,13 +66,14 @@ constexpr int16_t LOOK_RANGE_Y = 25;
 constexpr int16_t MOUTH_CX = SCR_CX;
 constexpr int16_t MOUTH_CY = SCR_CY + 85;
 
-// Zone du framebuffer (couvre yeux + bouche + mouvement regard)
+// Zone du framebuffer (couvre yeux + bouche + mouvement regard + bandeau haut)
 // Yeux : 138-328 en X, 178-288 en Y + look ±40/±25 + radius ~25
 // Bouche : ~193-273 en X, 305-330 en Y
+// Bandeau haut (y=30-130) : objets qui montent, saleté, 💤/💢, chip
 constexpr int16_t FB_X = 20;
-constexpr int16_t FB_Y = 130;
+constexpr int16_t FB_Y = 30;
 constexpr int16_t FB_W = 426;   // 20 à 446 — quasi tout l'écran en largeur
-constexpr int16_t FB_H = 310;   // 130 à 440 — yeux + bouche + bas écran rond
+constexpr int16_t FB_H = 410;   // 30 à 440 — bandeau haut + yeux + bouche + bas écran rond
 
 constexpr uint16_t COL_BG = 0x0000;
 // Couleurs dynamiques via GotchiTheme
@@ -56,17 +88,124 @@ uint16_t* s_fbNext = nullptr;     // Frame en cours de construction
 // Viewport (clip du flush)
 bool s_useViewport = false;
 int16_t s_vpX = 0, s_vpY = 0, s_vpW = FB_W, s_vpH = FB_H;
-uint16_t* s_vpBuf = nullptr;
-size_t s_vpBufSize = 0;
 
-// Scale
+// Buffer de staging pour pousser un rectangle qui ne fait pas toute la largeur
+uint16_t* s_stageBuf = nullptr;
+size_t s_stageBufSize = 0;
+
+// ============================================
+// Damage tracking
+// Bornes des pixels écrits par ligne (x0 > x1 = ligne vide).
+// s_dmgCur : frame en construction, s_dmgPrev : frame à l'écran.
+// s_dmgForce : zones à renvoyer telles quelles (écran écrasé par un tiers).
+// ============================================
+struct RowSpan { int16_t x0, x1; };
+RowSpan s_dmgA[FB_H];
+RowSpan s_dmgB[FB_H];
+RowSpan s_dmgForce[FB_H];
+RowSpan* s_dmgCur = s_dmgA;
+RowSpan* s_dmgPrev = s_dmgB;
+
+struct DirtyRect { int16_t x, y, w, h; };
+constexpr int MAX_DIRTY_RECTS = 8;
+// Coût fixe d'une transaction panel (CASET/RASET + rotation), en pixels équivalents.
+// Deux bandes sont fusionnées si le rectangle englobant coûte moins que ça en plus.
+constexpr int32_t RECT_OVERHEAD_PX = 512;
+
+FaceRenderer::FlushStats s_flushStats = {};
+
+// ============================================
+// Pipeline de flush (tâche de transfert sur l'autre cœur)
+// s_jobDone est "donné" quand aucun transfert n'est en cours.
+// ============================================
+struct FlushJob {
+  uint16_t* fb;
+  int count;
+  DirtyRect rects[MAX_DIRTY_RECTS];
+};
+FlushJob s_job;
+TaskHandle_t s_flushTask = nullptr;
+SemaphoreHandle_t s_jobReady = nullptr;
+SemaphoreHandle_t s_jobDone = nullptr;
+bool s_async = true;
+
+inline void spanClear(RowSpan* spans) {
+  for (int16_t y = 0; y < FB_H; y++) { spans[y].x0 = FB_W; spans[y].x1 = -1; }
+}
+
+inline void spanFill(RowSpan* spans) {
+  for (int16_t y = 0; y < FB_H; y++) { spans[y].x0 = 0; spans[y].x1 = FB_W - 1; }
+}
+
+// x0..x1 déjà clippés dans le FB
+inline void spanMark(RowSpan* spans, int16_t y, int16_t x0, int16_t x1) {
+  if (x0 < spans[y].x0) spans[y].x0 = x0;
+  if (x1 > spans[y].x1) spans[y].x1 = x1;
+}
+
+// Marque un rectangle (coordonnées FB, non clippé)
+void markRect(RowSpan* spans, int32_t x, int32_t y, int32_t w, int32_t h) {
+  int32_t x0 = std::max<int32_t>(x, 0);
+  int32_t x1 = std::min<int32_t>(x + w, FB_W) - 1;
+  int32_t y0 = std::max<int32_t>(y, 0);
+  int32_t y1 = std::min<int32_t>(y + h, FB_H) - 1;
+  if (x0 > x1 || y0 > y1) return;
+  for (int32_t j = y0; j <= y1; j++) spanMark(spans, j, x0, x1);
+}
+
+// Scale : float pour convertir les entrées float (regard, bouche) en pixels,
+// Q2.30 pour tout le reste de la géométrie (voir face_fixed.h)
 float s_scale = 1.0f;
+int32_t s_scaleQ = FaceFixed::Q30_ONE;
+
+// ============================================
+// Bandes de rasterisation
+// Une bande = lignes [y0, y1) d'un FB. Toutes les primitives clippent à la
+// bande : une même frame dessinée bande par bande donne les mêmes pixels.
+// ============================================
+struct Band {
+  uint16_t* fb;
+  int16_t y0, y1;
+};
+// Coupure entre les deux bandes : passe au milieu des yeux pour équilibrer
+// (bande haute = bandeau + haut des yeux, bande basse = bas des yeux + bouche)
+constexpr int16_t RASTER_SPLIT_Y = FB_H / 2;
+
+// Bande en cours de composition des couches, par tâche (0 = rendu, 1 = FaceRaster) :
+// markDirty() reçoit des coordonnées relatives à la bande
+const Band* s_layerBand[2] = { nullptr, nullptr };
 
-EyeConfig scaleEye(const EyeConfig& e, float s) {
+TaskHandle_t s_rasterTask = nullptr;
+SemaphoreHandle_t s_rasterGo = nullptr;
+SemaphoreHandle_t s_rasterDone = nullptr;
+bool s_parallel = false;
+FaceRenderer::RasterStats s_rasterStats = {};
+
+// ============================================
+// Couches composées dans le FB après le visage, de l'arrière vers l'avant.
+// Chacune dessine dans s_fbNext (coordonnées écran -> FB via fbX/fbY) et
+// signale sa zone via FaceRenderer::markDirty().
+// ============================================
+using LayerDrawFn = void (*)(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
+struct Layer {
+  LayerDrawFn draw;
+  bool inViewport;  // Dessinée aussi en mode viewport (vue stats)
+};
+const Layer LAYERS[] = {
+  { DirtOverlay::drawIntoFB,       true  },  // Saleté (taches brunes)
+  { DirtOverlay::drawSpongeIntoFB, true  },  // Éponge (alpha blend)
+  { DirtOverlay::drawBrushIntoFB,  true  },  // Brosse à dents
+  { BehaviorObjects::drawIntoFB,   false },  // Balle, coeurs, sprites + callback bandeau
+  { FaceOverlayLayer::drawIntoFB,  false },  // 💢, 💤
+  { TopChip::drawIntoFB,           false },  // Chip du haut, au-dessus de tout
+};
+
+EyeConfig scaleEye(const EyeConfig& e, int32_t sQ) {
+  using FaceFixed::mulQ30;
   return {
-    (int16_t)(e.height * s), (int16_t)(e.width * s),
-    (int16_t)(e.offsetX * s), (int16_t)(e.offsetY * s),
-    (int16_t)(e.radiusTop * s), (int16_t)(e.radiusBottom * s),
+    (int16_t)mulQ30(e.height, sQ), (int16_t)mulQ30(e.width, sQ),
+    (int16_t)mulQ30(e.offsetX, sQ), (int16_t)mulQ30(e.offsetY, sQ),
+    (int16_t)mulQ30(e.radiusTop, sQ), (int16_t)mulQ30(e.radiusBottom, sQ),
     e.slopeTop, e.slopeBottom,
   };
 }
@@ -74,24 +213,113 @@ EyeConfig scaleEye(const EyeConfig& e, float s) {
 // ============================================
 // Accès pixel dans le framebuffer
 // ============================================
-inline void fbSetPixel(uint16_t* fb, int16_t x, int16_t y, uint16_t color) {
-  if (x >= 0 && x < FB_W && y >= 0 && y < FB_H)
-    fb[y * FB_W + x] = color;
+// Remplit n pixels à partir de p : un store 16 bits pour aligner, puis
+// 2 pixels par store 32 bits. Pas de test de bornes, l'appelant a clippé.
+inline void fillRow16(uint16_t* p, int32_t n, uint16_t color) {
+  if (n <= 0) return;
+  if ((uintptr_t)p & 2) {
+    *p++ = color;
+    n--;
+  }
+  uint32_t* p2 = reinterpret_cast<uint32_t*>(p);
+  const uint32_t c2 = (uint32_t)color | ((uint32_t)color << 16);
+  for (; n >= 2; n -= 2) *p2++ = c2;
+  if (n) *reinterpret_cast<uint16_t*>(p2) = color;
 }
 
-inline void fbFillRect(uint16_t* fb, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  for (int16_t j = y; j < y + h; j++)
-    for (int16_t i = x; i < x + w; i++)
-      fbSetPixel(fb, i, j, color);
+// Span horizontal, clippé une fois à la bande
+inline void fbHLine(const Band& b, int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (y < b.y0 || y >= b.y1) return;
+  int16_t x0 = std::max<int32_t>(x, 0);
+  int16_t x1 = std::min<int32_t>((int32_t)x + w, FB_W) - 1;
+  if (x0 > x1) return;
+  spanMark(s_dmgCur, y, x0, x1);
+  fillRow16(b.fb + y * FB_W + x0, x1 - x0 + 1, color);
 }
 
-inline void fbHLine(uint16_t* fb, int16_t x, int16_t y, int16_t w, uint16_t color) {
-  for (int16_t i = x; i < x + w; i++)
-    fbSetPixel(fb, i, y, color);
+inline void fbFillRect(const Band& b, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  int32_t x0 = std::max<int32_t>(x, 0);
+  int32_t x1 = std::min<int32_t>((int32_t)x + w, FB_W) - 1;
+  int32_t y0 = std::max<int32_t>(y, b.y0);
+  int32_t y1 = std::min<int32_t>((int32_t)y + h, b.y1) - 1;
+  if (x0 > x1 || y0 > y1) return;
+  for (int32_t j = y0; j <= y1; j++) {
+    spanMark(s_dmgCur, j, x0, x1);
+    fillRow16(b.fb + j * FB_W + x0, x1 - x0 + 1, color);
+  }
 }
 
-inline void fbFillTriangle(uint16_t* fb, int16_t x0, int16_t y0,
-                            int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+// Efface dans la bande uniquement ce qui y a été dessiné : s_dmgCur contient
+// encore les spans de la frame que ce buffer porte (celle d'avant la frame à
+// l'écran). Remplace le memset complet de 264 KB en PSRAM.
+void clearBand(const Band& b) {
+  for (int16_t y = b.y0; y < b.y1; y++) {
+    RowSpan& sp = s_dmgCur[y];
+    if (sp.x0 <= sp.x1) fillRow16(b.fb + y * FB_W + sp.x0, sp.x1 - sp.x0 + 1, COL_BG);
+    sp.x0 = FB_W;
+    sp.x1 = -1;
+  }
+}
+
+// Simple fillRoundRect dans le framebuffer (scanline)
+void fbFillRoundRect(const Band& b, int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  int16_t rx = cx - w/2, ry2 = cy - h/2;
+  if (r > h/2) r = h/2;
+  if (r > w/2) r = w/2;
+  if (r < 1) r = 1;
+  for (int16_t j = 0; j < h; j++) {
+    const int16_t indent = FaceFixed::rowIndent(r, h, j);
+    fbHLine(b, rx + indent, ry2 + j, w - 2*indent, color);
+  }
+}
+
+// ============================================
+// Rasterisation des formes (yeux, bouche)
+// Les primitives écrivent des segments horizontaux dans un "sink" :
+// FbSink dessine dans le framebuffer, MaskSink capture la forme dans un
+// masque 1 bit/pixel pour le cache de spans (plus bas).
+// ============================================
+struct FbSink {
+  const Band& b;
+  void hline(int16_t x, int16_t y, int16_t w, uint16_t color) { fbHLine(b, x, y, w, color); }
+};
+
+// Paramètres entiers qui déterminent entièrement la forme (à translation près).
+// Les pentes n'interviennent que via dyT/dyB : c'est la quantification de l'EyeConfig.
+struct ShapeKey {
+  int16_t w, h, rT, rB, dyT, dyB;
+  bool operator==(const ShapeKey& o) const {
+    return w == o.w && h == o.h && rT == o.rT && rB == o.rB && dyT == o.dyT && dyB == o.dyB;
+  }
+};
+
+// Sous cette hauteur : simple round rect (l'algo esp32-eyes crée des artefacts)
+constexpr int16_t SMALL_SHAPE_H = 30;
+
+ShapeKey shapeKey(const EyeConfig& cfg) {
+  ShapeKey k;
+  k.w = cfg.width > 0 ? cfg.width : 1;
+  k.h = cfg.height > 0 ? cfg.height : 1;
+  k.rT = cfg.radiusTop;
+  k.rB = cfg.radiusBottom;
+  if (k.h <= SMALL_SHAPE_H) {
+    k.dyT = k.dyB = 0;
+  } else {
+    k.dyT = (int16_t)(int32_t)(cfg.slopeTop * k.h / 2.0f);
+    k.dyB = (int16_t)(int32_t)(cfg.slopeBottom * k.h / 2.0f);
+  }
+  return k;
+}
+
+template <typename Sink>
+void shapeFillRect(Sink& s, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = y; j < y + h; j++)
+    s.hline(x, j, w, color);
+}
+
+template <typename Sink>
+void shapeFillTriangle(Sink& s, int16_t x0, int16_t y0,
+                       int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
   // Scanline triangle fill (simple)
   int16_t minY = std::min({y0, y1, y2});
   int16_t maxY = std::max({y0, y1, y2});
@@ -106,93 +334,64 @@ inline void fbFillTriangle(uint16_t* fb, int16_t x0, int16_t y0,
       }
     };
     edge(x0,y0,x1,y1); edge(x1,y1,x2,y2); edge(x2,y2,x0,y0);
-    if (minX <= maxX) fbHLine(fb, minX, y, maxX - minX + 1, color);
-  }
-}
-
-// Simple fillRoundRect dans le framebuffer (scanline)
-void fbFillRoundRect(uint16_t* fb, int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t r, uint16_t color) {
-  int16_t rx = cx - w/2, ry2 = cy - h/2;
-  if (r > h/2) r = h/2;
-  if (r > w/2) r = w/2;
-  if (r < 1) r = 1;
-  for (int16_t j = 0; j < h; j++) {
-    int16_t indent = 0;
-    if (j < r) {
-      float dy = r - j - 0.5f;
-      indent = r - (int16_t)sqrtf((float)(r*r) - dy*dy);
-    } else if (j >= h - r) {
-      float dy = j - (h - r) + 0.5f;
-      indent = r - (int16_t)sqrtf((float)(r*r) - dy*dy);
-    }
-    fbHLine(fb, rx + indent, ry2 + j, w - 2*indent, color);
+    if (minX <= maxX) s.hline(minX, y, maxX - minX + 1, color);
   }
 }
 
 // ============================================
-// Port de esp32-eyes FillEllipseCorner dans le framebuffer
+// Port de esp32-eyes FillEllipseCorner
 // ============================================
-void fbCorner(uint16_t* fb, bool isTop, bool isLeft, int16_t cx, int16_t cy,
-              int32_t rx, int32_t ry, uint16_t color) {
+template <typename Sink>
+void shapeCorner(Sink& s, bool isTop, bool isLeft, int16_t cx, int16_t cy,
+                 int32_t rx, int32_t ry, uint16_t color) {
   if (rx < 2 || ry < 2) return;
   int32_t rx2=rx*rx, ry2=ry*ry, fx2=4*rx2, fy2=4*ry2;
-  int32_t x, y, s;
+  int32_t x, y, e;
   // Premier octant
-  for (x=0,y=ry,s=2*ry2+rx2*(1-2*ry); ry2*x<=rx2*y; x++) {
+  for (x=0,y=ry,e=2*ry2+rx2*(1-2*ry); ry2*x<=rx2*y; x++) {
     int16_t py = isTop ? cy-y : cy+y-1;
-    if (isLeft) fbHLine(fb, cx-x, py, x+1, color);
-    else        fbHLine(fb, cx, py, x+1, color);
-    if (s>=0){s+=fx2*(1-y);y--;}
-    s+=ry2*(4*x+6);
+    if (isLeft) s.hline(cx-x, py, x+1, color);
+    else        s.hline(cx, py, x+1, color);
+    if (e>=0){e+=fx2*(1-y);y--;}
+    e+=ry2*(4*x+6);
   }
   // Second octant — bottom utilise cy+y (pas cy+y-1) pour le BL, selon l'original
-  for (x=rx,y=0,s=2*rx2+ry2*(1-2*rx); rx2*y<=ry2*x; y++) {
+  for (x=rx,y=0,e=2*rx2+ry2*(1-2*rx); rx2*y<=ry2*x; y++) {
     int16_t py;
     if (isTop) py = cy - y;
     else if (isLeft) py = cy + y;      // BL : cy + y (original)
     else py = cy + y - 1;              // BR : cy + y - 1 (original)
-    if (isLeft) fbHLine(fb, cx-x, py, x+1, color);
-    else        fbHLine(fb, cx, py, x+1, color);
-    if (s>=0){s+=fy2*(1-x);x--;}
-    s+=rx2*(4*y+6);
+    if (isLeft) s.hline(cx-x, py, x+1, color);
+    else        s.hline(cx, py, x+1, color);
+    if (e>=0){e+=fy2*(1-x);x--;}
+    e+=rx2*(4*y+6);
   }
 }
 
 // ============================================
-// Dessine une forme (oeil ou bouche) dans le framebuffer
+// Dessine une forme (oeil ou bouche) centrée en (cX, cY)
 // Coordonnées relatives au framebuffer (pas à l'écran)
 // ============================================
-void fbDrawShape(uint16_t* fb, int16_t centerX, int16_t centerY, const EyeConfig& cfg, uint16_t color) {
-  int16_t W = cfg.width > 0 ? cfg.width : 1;
-  int16_t H = cfg.height > 0 ? cfg.height : 1;
-  int16_t rT = cfg.radiusTop, rB = cfg.radiusBottom;
-  int16_t cX = centerX + cfg.offsetX;
-  int16_t cY = centerY + cfg.offsetY;
+template <typename Sink>
+void rasterShape(Sink& s, int16_t cX, int16_t cY, const ShapeKey& k, uint16_t color) {
+  const int16_t W = k.w, H = k.h;
+  int16_t rT = k.rT, rB = k.rB;
 
   // Pour les petites formes, utiliser un simple fillRoundRect
   // L'algo esp32-eyes avec rectangles+triangles+coins crée des artefacts quand H est petit
-  if (H <= 30) {
+  if (H <= SMALL_SHAPE_H) {
     int16_t r = std::min({rT, rB, (int16_t)(H/2), (int16_t)(W/2)});
     if (r < 1) r = 1;
-    // fillRoundRect simple dans le framebuffer
     int16_t rx = cX - W/2, ry2 = cY - H/2;
     for (int16_t j = 0; j < H; j++) {
-      // Calculer l'indentation pour les coins arrondis
-      int16_t indent = 0;
-      if (j < r) {
-        float dy = r - j - 0.5f;
-        indent = r - (int16_t)sqrtf(r*r - dy*dy);
-      } else if (j >= H - r) {
-        float dy = j - (H - r) + 0.5f;
-        indent = r - (int16_t)sqrtf(r*r - dy*dy);
-      }
-      fbHLine(fb, rx + indent, ry2 + j, W - 2*indent, color);
+      // Indentation des coins arrondis (table entière)
+      const int16_t indent = FaceFixed::rowIndent(r, H, j);
+      s.hline(rx + indent, ry2 + j, W - 2*indent, color);
     }
     return;
   }
 
-  int32_t dyT = (int32_t)(cfg.slopeTop * H / 2.0f);
-  int32_t dyB = (int32_t)(cfg.slopeBottom * H / 2.0f);
+  const int32_t dyT = k.dyT, dyB = k.dyB;
   int32_t totalH = H + dyT - dyB;
   if (totalH < 2) totalH = 2;
 
@@ -202,8 +401,8 @@ void fbDrawShape(uint16_t* fb, int16_t centerX, int16_t centerY, const EyeConfig
   if (rB > maxR) rB = maxR;
   if (rT > 0 && rB > 0 && totalH - 1 < rT + rB) {
     int16_t sum = rT + rB;
-    rT = (int16_t)((float)rT * (totalH-1) / sum);
-    rB = (int16_t)((float)rB * (totalH-1) / sum);
+    rT = (int16_t)((int32_t)rT * (totalH-1) / sum);
+    rB = (int16_t)((int32_t)rB * (totalH-1) / sum);
   }
 
   int32_t TLx=cX-W/2+rT, TLy=cY-H/2+rT-dyT;
@@ -214,66 +413,551 @@ void fbDrawShape(uint16_t* fb, int16_t centerX, int16_t centerY, const EyeConfig
   int32_t minCx=std::min(TLx,BLx), maxCx=std::max(TRx,BRx);
   int32_t minCy=std::min(TLy,TRy), maxCy=std::max(BLy,BRy);
 
-  fbFillRect(fb, minCx, minCy, maxCx-minCx+1, maxCy-minCy+1, color);
-  fbFillRect(fb, TRx, TRy, rB+(BRx-TRx)+1, BRy-TRy+1, color);
-  fbFillRect(fb, TLx-rT, TLy, rT+(BLx-TLx)+1, BLy-TLy+1, color);
-  fbFillRect(fb, TLx, TLy-rT, TRx-TLx+1, rT+(TRy-TLy)+1, color);
-  fbFillRect(fb, BLx, BLy, BRx-BLx+1, rB+(BRy-BLy)+1, color);
+  shapeFillRect(s, minCx, minCy, maxCx-minCx+1, maxCy-minCy+1, color);
+  shapeFillRect(s, TRx, TRy, rB+(BRx-TRx)+1, BRy-TRy+1, color);
+  shapeFillRect(s, TLx-rT, TLy, rT+(BLx-TLx)+1, BLy-TLy+1, color);
+  shapeFillRect(s, TLx, TLy-rT, TRx-TLx+1, rT+(TRy-TLy)+1, color);
+  shapeFillRect(s, BLx, BLy, BRx-BLx+1, rB+(BRy-BLy)+1, color);
 
   if (dyT > 0) {
-    fbFillTriangle(fb, TLx,TLy-rT, TRx,TRy-rT, TRx,TLy-rT, COL_BG);
-    fbFillTriangle(fb, TRx,TRy-rT, TLx,TLy-rT, TLx,TRy-rT, color);
+    shapeFillTriangle(s, TLx,TLy-rT, TRx,TRy-rT, TRx,TLy-rT, COL_BG);
+    shapeFillTriangle(s, TRx,TRy-rT, TLx,TLy-rT, TLx,TRy-rT, color);
   } else if (dyT < 0) {
-    fbFillTriangle(fb, TRx,TRy-rT, TLx,TLy-rT, TLx,TRy-rT, COL_BG);
-    fbFillTriangle(fb, TLx,TLy-rT, TRx,TRy-rT, TRx,TLy-rT, color);
+    shapeFillTriangle(s, TRx,TRy-rT, TLx,TLy-rT, TLx,TRy-rT, COL_BG);
+    shapeFillTriangle(s, TLx,TLy-rT, TRx,TRy-rT, TRx,TLy-rT, color);
   }
   if (dyB > 0) {
-    fbFillTriangle(fb, BRx+rB,BRy+rB, BLx-rB,BLy+rB, BLx-rB,BRy+rB, COL_BG);
-    fbFillTriangle(fb, BLx-rB,BLy+rB, BRx+rB,BRy+rB, BRx+rB,BLy+rB, color);
+    shapeFillTriangle(s, BRx+rB,BRy+rB, BLx-rB,BLy+rB, BLx-rB,BRy+rB, COL_BG);
+    shapeFillTriangle(s, BLx-rB,BLy+rB, BRx+rB,BRy+rB, BRx+rB,BLy+rB, color);
   } else if (dyB < 0) {
-    fbFillTriangle(fb, BLx-rB,BLy+rB, BRx+rB,BRy+rB, BRx+rB,BLy+rB, COL_BG);
-    fbFillTriangle(fb, BRx+rB,BRy+rB, BLx-rB,BLy+rB, BLx-rB,BRy+rB, color);
+    shapeFillTriangle(s, BLx-rB,BLy+rB, BRx+rB,BRy+rB, BRx+rB,BLy+rB, COL_BG);
+    shapeFillTriangle(s, BRx+rB,BRy+rB, BLx-rB,BLy+rB, BLx-rB,BRy+rB, color);
   }
 
   if (rT > 0) {
-    fbCorner(fb, true, true, TLx, TLy, rT, rT, color);
-    fbCorner(fb, true, false, TRx, TRy, rT, rT, color);
+    shapeCorner(s, true, true, TLx, TLy, rT, rT, color);
+    shapeCorner(s, true, false, TRx, TRy, rT, rT, color);
   }
   if (rB > 0) {
-    fbCorner(fb, false, true, BLx, BLy, rB, rB, color);
-    fbCorner(fb, false, false, BRx, BRy, rB, rB, color);
+    shapeCorner(s, false, true, BLx, BLy, rB, rB, color);
+    shapeCorner(s, false, false, BRx, BRy, rB, rB, color);
   }
 }
 
+void fbDrawShape(const Band& b, int16_t centerX, int16_t centerY, const EyeConfig& cfg, uint16_t color) {
+  FbSink s{b};
+  rasterShape(s, centerX + cfg.offsetX, centerY + cfg.offsetY, shapeKey(cfg), color);
+}
+
 // ============================================
-// Envoie les pixels qui ont changé entre current et next
-// Envoie par lignes continues (runs) pour minimiser les appels SPI
+// Cache LRU des yeux rasterisés
+// Au repos (et à chaque clignement, qui repasse par les mêmes hauteurs) les
+// yeux gardent la même forme d'une frame à l'autre : on garde le résultat de
+// rasterShape sous forme d'un span [x0,x1] par ligne, relatif au centre, et
+// on le rejoue par simples remplissages de lignes. Le scale est déjà appliqué
+// (scaleEye) quand on calcule la clé : une forme réduite est une autre entrée.
+// La capture passe par un masque 1 bit/pixel pour respecter les triangles
+// COL_BG qui recreusent la forme. Une forme qui ne tient pas en un span par
+// ligne (ou qui déborde du masque) est marquée "direct" : redessinée à chaque
+// fois, mais sans repasser par la capture.
 // ============================================
-void flushBuffer() {
-  if (s_useViewport && s_vpW > 0 && s_vpH > 0) {
-    // Flush seulement la sous-region viewport
-    size_t needed = s_vpW * s_vpH * sizeof(uint16_t);
-    if (needed > s_vpBufSize) {
-      if (s_vpBuf) heap_caps_free(s_vpBuf);
-      s_vpBuf = (uint16_t*)heap_caps_malloc(needed, MALLOC_CAP_SPIRAM);
-      s_vpBufSize = s_vpBuf ? needed : 0;
+constexpr int SHAPE_CACHE_ENTRIES = 12;
+constexpr int MASK_WORDS = (FB_W + 31) / 32;
+constexpr int16_t MASK_CX = FB_W / 2;
+constexpr int16_t MASK_CY = FB_H / 2;
+
+struct ShapeEntry {
+  ShapeKey key;
+  uint32_t lastUse;   // 0 = entrée libre
+  int16_t top;        // première ligne, relative au centre
+  int16_t rows;
+  bool direct;
+  RowSpan* spans;     // FB_H lignes max, x relatifs au centre
+};
+ShapeEntry s_shapeCache[SHAPE_CACHE_ENTRIES];
+RowSpan* s_shapeSpans = nullptr;  // PSRAM : SHAPE_CACHE_ENTRIES x FB_H
+uint32_t* s_shapeMask = nullptr;  // PSRAM : masque de capture FB_W x FB_H
+uint32_t s_shapeClock = 0;
+bool s_shapeEnabled = true;
+FaceRenderer::ShapeCacheStats s_shapeStats = {};
+
+struct MaskSink {
+  uint32_t* bits;
+  int16_t minY = FB_H, maxY = -1;
+  bool clipped = false;
+
+  void hline(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    int32_t x0 = x, x1 = (int32_t)x + w - 1;
+    if (x0 > x1) return;
+    if (y < 0 || y >= FB_H || x0 < 0 || x1 >= FB_W) {
+      clipped = true;
+      return;
+    }
+    if (y < minY) minY = y;
+    if (y > maxY) maxY = y;
+    uint32_t* row = bits + y * MASK_WORDS;
+    const bool on = color != COL_BG;
+    while (x0 <= x1) {
+      const int b = x0 & 31;
+      const int n = std::min<int32_t>(32 - b, x1 - x0 + 1);
+      const uint32_t m = (n == 32) ? 0xFFFFFFFFu : (((1u << n) - 1) << b);
+      if (on) row[x0 >> 5] |= m;
+      else    row[x0 >> 5] &= ~m;
+      x0 += n;
+    }
+  }
+};
+
+// Rasterise la forme dans le masque puis la convertit en spans. Remet le masque à zéro.
+void shapeCapture(ShapeEntry& e, const ShapeKey& k) {
+  MaskSink m{s_shapeMask};
+  rasterShape(m, MASK_CX, MASK_CY, k, (uint16_t)~COL_BG);
+
+  e.direct = m.clipped;
+  e.top = m.minY - MASK_CY;
+  e.rows = 0;
+  for (int16_t y = m.minY; y <= m.maxY; y++) {
+    uint32_t* row = s_shapeMask + y * MASK_WORDS;
+    int first = -1, last = -1;
+    int32_t count = 0;
+    for (int w = 0; w < MASK_WORDS; w++) {
+      if (!row[w]) continue;
+      if (first < 0) first = w * 32 + __builtin_ctz(row[w]);
+      last = w * 32 + 31 - __builtin_clz(row[w]);
+      count += __builtin_popcount(row[w]);
+      row[w] = 0;
+    }
+    RowSpan& sp = e.spans[e.rows++];
+    if (first < 0) {
+      sp.x0 = 0; sp.x1 = -1;
+    } else {
+      if (count != last - first + 1) e.direct = true;  // ligne en plusieurs morceaux
+      sp.x0 = first - MASK_CX;
+      sp.x1 = last - MASK_CX;
+    }
+  }
+  if (e.direct) s_shapeStats.uncached++;
+}
+
+ShapeEntry& shapeLookup(const ShapeKey& k) {
+  ShapeEntry* victim = &s_shapeCache[0];
+  for (ShapeEntry& e : s_shapeCache) {
+    if (e.lastUse && e.key == k) {
+      e.lastUse = ++s_shapeClock;
+      s_shapeStats.hits++;
+      return e;
+    }
+    if (e.lastUse < victim->lastUse) victim = &e;
+  }
+  s_shapeStats.misses++;
+  if (victim->lastUse) s_shapeStats.evictions++;
+  victim->key = k;
+  shapeCapture(*victim, k);
+  victim->lastUse = ++s_shapeClock;
+  return *victim;
+}
+
+void shapeCacheInit() {
+  if (!s_shapeSpans)
+    s_shapeSpans = (RowSpan*)heap_caps_malloc(SHAPE_CACHE_ENTRIES * FB_H * sizeof(RowSpan), MALLOC_CAP_SPIRAM);
+  if (!s_shapeMask)
+    s_shapeMask = (uint32_t*)heap_caps_calloc(MASK_WORDS * FB_H, sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  for (int i = 0; i < SHAPE_CACHE_ENTRIES; i++) {
+    s_shapeCache[i].lastUse = 0;
+    s_shapeCache[i].spans = s_shapeSpans ? s_shapeSpans + i * FB_H : nullptr;
+  }
+  s_shapeClock = 0;
+}
+
+// Entrée du cache pour un oeil, nullptr si la forme se rasterise directement
+// (cache désactivé ou non alloué, forme non cachable). Met à jour le LRU :
+// appelée par la tâche de rendu seulement, avant le dessin des bandes qui ne font que lire.
+const ShapeEntry* eyeShape(const EyeConfig& cfg) {
+  if (!s_shapeEnabled || !s_shapeSpans || !s_shapeMask) return nullptr;
+  const ShapeEntry& e = shapeLookup(shapeKey(cfg));
+  return e.direct ? nullptr : &e;
+}
+
+// Boîte englobante d'une forme centrée en (cX, cY), triangles COL_BG compris
+// (large en y : les pentes peuvent croiser le haut et le bas de la forme)
+struct ShapeBox {
+  int32_t x0, y0, x1, y1;
+  bool intersects(const ShapeBox& o) const {
+    return x0 <= o.x1 && o.x0 <= x1 && y0 <= o.y1 && o.y0 <= y1;
+  }
+};
+
+ShapeBox shapeBox(int16_t cX, int16_t cY, const ShapeKey& k) {
+  const int32_t dy = std::abs(k.dyT) + std::abs(k.dyB);
+  return { cX - k.w / 2, cY - k.h / 2 - dy, cX + k.w / 2, cY + k.h / 2 + dy };
+}
+
+// Entrées du cache des deux yeux. L'oeil droit est dessiné après le gauche :
+// en direct, ses triangles COL_BG effacent aussi ce qui est déjà dans le FB,
+// ce que le rejeu des spans ne fait pas. Quand les deux formes peuvent se
+// toucher, il reste en rasterisation directe (même rendu avec ou sans cache).
+void eyeShapes(int16_t lcx, int16_t rcx, int16_t cy, const EyeConfig& left, const EyeConfig& right,
+               const ShapeEntry*& leftShape, const ShapeEntry*& rightShape) {
+  leftShape = eyeShape(left);
+  const ShapeBox l = shapeBox(lcx + left.offsetX, cy + left.offsetY, shapeKey(left));
+  const ShapeBox r = shapeBox(rcx + right.offsetX, cy + right.offsetY, shapeKey(right));
+  rightShape = l.intersects(r) ? nullptr : eyeShape(right);
+}
+
+// Oeil : rejoue les spans de l'entrée du cache, sinon rasterisation directe
+void fbDrawEye(const Band& b, int16_t centerX, int16_t centerY, const EyeConfig& cfg,
+               const ShapeEntry* shape, uint16_t color) {
+  const int16_t cX = centerX + cfg.offsetX;
+  const int16_t cY = centerY + cfg.offsetY;
+  if (!shape) {
+    FbSink s{b};
+    rasterShape(s, cX, cY, shapeKey(cfg), color);
+    return;
+  }
+  // Seules les lignes de la bande
+  const int16_t i0 = std::max<int32_t>(0, b.y0 - (cY + shape->top));
+  const int16_t i1 = std::min<int32_t>(shape->rows, b.y1 - (cY + shape->top));
+  for (int16_t i = i0; i < i1; i++) {
+    const RowSpan& sp = shape->spans[i];
+    if (sp.x0 <= sp.x1) fbHLine(b, cX + sp.x0, cY + shape->top + i, sp.x1 - sp.x0 + 1, color);
+  }
+}
+
+// ============================================
+// Flush : pousse un rectangle du FB (coordonnées FB) vers l'écran
+// ============================================
+void pushRect(uint16_t* fb, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+  if (x == 0 && w == FB_W) {
+    // Pleine largeur : les lignes sont contiguës dans le FB, pas de copie
+    s_gfx->draw16bitRGBBitmap(FB_X, FB_Y + y, fb + y * FB_W, w, h);
+  } else {
+    size_t needed = (size_t)w * h * sizeof(uint16_t);
+    if (needed > s_stageBufSize) {
+      if (s_stageBuf) heap_caps_free(s_stageBuf);
+      s_stageBuf = (uint16_t*)heap_caps_malloc(needed, MALLOC_CAP_SPIRAM);
+      s_stageBufSize = s_stageBuf ? needed : 0;
     }
-    if (s_vpBuf) {
-      for (int16_t y = 0; y < s_vpH; y++) {
-        memcpy(s_vpBuf + y * s_vpW,
-               s_fbNext + (s_vpY + y) * FB_W + s_vpX,
-               s_vpW * sizeof(uint16_t));
+    if (!s_stageBuf) return;
+    for (int16_t j = 0; j < h; j++) {
+      memcpy(s_stageBuf + j * w, fb + (y + j) * FB_W + x, w * sizeof(uint16_t));
+    }
+    s_gfx->draw16bitRGBBitmap(FB_X + x, FB_Y + y, s_stageBuf, w, h);
+  }
+  s_flushStats.lastBytes += (uint32_t)w * h * sizeof(uint16_t);
+  s_flushStats.lastRects++;
+}
+
+// Resserre [x0,x1] sur la ligne y aux pixels qui diffèrent entre next et current.
+// Retourne false si la ligne est identique.
+bool narrowToDiff(int16_t y, int16_t& x0, int16_t& x1) {
+  const uint16_t* a = s_fbNext + y * FB_W;
+  const uint16_t* b = s_fbCurrent + y * FB_W;
+  while (x0 <= x1 && a[x0] == b[x0]) x0++;
+  if (x0 > x1) return false;
+  while (a[x1] == b[x1]) x1--;
+  return true;
+}
+
+// Span à renvoyer pour la ligne y, clippée à [cx0,cx1] (x0 > x1 = rien)
+RowSpan rowDamage(int16_t y, int16_t cx0, int16_t cx1) {
+  RowSpan out = { FB_W, -1 };
+  int16_t x0 = std::max(std::min(s_dmgCur[y].x0, s_dmgPrev[y].x0), cx0);
+  int16_t x1 = std::min(std::max(s_dmgCur[y].x1, s_dmgPrev[y].x1), cx1);
+  if (x0 <= x1 && narrowToDiff(y, x0, x1)) out = { x0, x1 };
+  int16_t f0 = std::max(s_dmgForce[y].x0, cx0);
+  int16_t f1 = std::min(s_dmgForce[y].x1, cx1);
+  if (f0 <= f1) {
+    if (f0 < out.x0) out.x0 = f0;
+    if (f1 > out.x1) out.x1 = f1;
+  }
+  return out;
+}
+
+// Regroupe les spans par paires de lignes en au plus MAX_DIRTY_RECTS rectangles
+// alignés sur 2px. Retourne le nombre de rectangles.
+int collectDirtyRects(int16_t cx, int16_t cy, int16_t cw, int16_t ch, DirtyRect* out) {
+  const int16_t cx1 = cx + cw - 1;
+  int count = 0;
+  bool open = false;
+  int16_t bx0 = 0, bx1 = 0, by0 = 0, by1 = 0;
+
+  auto emit = [&]() {
+    DirtyRect r = { bx0, by0, (int16_t)(bx1 - bx0 + 1), (int16_t)(by1 - by0 + 1) };
+    if (count < MAX_DIRTY_RECTS) {
+      out[count++] = r;
+    } else {
+      // Plus de place : fusionner avec le dernier
+      DirtyRect& l = out[count - 1];
+      int16_t x0 = std::min(l.x, r.x), y0 = std::min(l.y, r.y);
+      int16_t x1 = std::max(l.x + l.w, r.x + r.w), y1 = std::max(l.y + l.h, r.y + r.h);
+      l = { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    }
+  };
+
+  for (int16_t y = cy; y < cy + ch; y += 2) {
+    RowSpan s0 = rowDamage(y, cx, cx1);
+    RowSpan s1 = (y + 1 < cy + ch) ? rowDamage(y + 1, cx, cx1) : RowSpan{ FB_W, -1 };
+    int16_t x0 = std::min(s0.x0, s1.x0);
+    int16_t x1 = std::max(s0.x1, s1.x1);
+    if (x0 > x1) continue;
+    x0 &= ~1;  // Alignement pair (x1 impair → largeur paire)
+    x1 |= 1;
+    if (x1 > cx1) x1 = cx1;
+
+    if (open) {
+      int32_t mx0 = std::min(bx0, x0), mx1 = std::max(bx1, x1);
+      int32_t merged = (mx1 - mx0 + 1) * (int32_t)(y + 2 - by0);
+      int32_t separate = (int32_t)(bx1 - bx0 + 1) * (by1 - by0 + 1) + (int32_t)(x1 - x0 + 1) * 2;
+      if (merged <= separate + RECT_OVERHEAD_PX) {
+        bx0 = mx0; bx1 = mx1; by1 = y + 1;
+        continue;
       }
-      s_gfx->draw16bitRGBBitmap(FB_X + s_vpX, FB_Y + s_vpY, s_vpBuf, s_vpW, s_vpH);
+      emit();
+    }
+    open = true;
+    bx0 = x0; bx1 = x1; by0 = y; by1 = y + 1;
+  }
+  if (open) emit();
+  return count;
+}
+
+// ============================================
+// Transfert d'un job vers le panel (appelé par la tâche ou en synchrone)
+// ============================================
+void runJob(const FlushJob& job) {
+  uint32_t t0 = micros();
+  s_flushStats.lastBytes = 0;
+  s_flushStats.lastRects = 0;
+  // Tout le job d'un bloc : pas d'overlay/LVGL intercale entre deux rectangles
+  lockGotchiGfx();
+  for (int i = 0; i < job.count; i++) {
+    pushRect(job.fb, job.rects[i].x, job.rects[i].y, job.rects[i].w, job.rects[i].h);
+  }
+  unlockGotchiGfx();
+  uint32_t dt = micros() - t0;
+  s_flushStats.frames++;
+  s_flushStats.lastFlushUs = dt;
+  s_flushStats.totalFlushUs += dt;
+  s_flushStats.totalBytes += s_flushStats.lastBytes;
+  if (s_flushStats.lastBytes == 0) s_flushStats.idleFrames++;
+}
+
+void flushTask(void*) {
+  for (;;) {
+    if (xSemaphoreTake(s_jobReady, portMAX_DELAY) != pdTRUE) continue;
+    runJob(s_job);
+    xSemaphoreGive(s_jobDone);
+  }
+}
+
+// Attend la fin du transfert en cours (no-op si rien en vol)
+void waitJobDone() {
+  if (!s_jobDone) return;
+  uint32_t t0 = micros();
+  xSemaphoreTake(s_jobDone, portMAX_DELAY);
+  xSemaphoreGive(s_jobDone);
+  s_flushStats.lastWaitUs = micros() - t0;
+  s_flushStats.totalWaitUs += s_flushStats.lastWaitUs;
+}
+
+bool startFlushTask() {
+  if (s_flushTask) return true;
+  if (!s_jobDone) {
+    s_jobReady = xSemaphoreCreateBinary();
+    s_jobDone = xSemaphoreCreateBinary();
+    if (!s_jobReady || !s_jobDone) {
+      Serial.println("[FACE] ERREUR: creation semaphores flush echouee");
+      s_jobDone = nullptr;
+      return false;
     }
+    xSemaphoreGive(s_jobDone);
+  }
+  BaseType_t result = xTaskCreatePinnedToCore(
+    flushTask, "FaceFlush", STACK_SIZE_DISPLAY, nullptr,
+    PRIORITY_DISPLAY, &s_flushTask, CORE_DISPLAY);
+  if (result != pdPASS) {
+    Serial.println("[FACE] ERREUR: creation tache flush echouee, flush synchrone");
+    s_flushTask = nullptr;
+    return false;
+  }
+  return true;
+}
+
+// ============================================
+// Soumet les zones qui ont changé entre current et next, puis swap.
+// Async : on attend seulement le transfert PRÉCÉDENT, puis on rend la main
+// pendant que celui-ci part sur le bus.
+// ============================================
+void flushBuffer() {
+  int16_t cx = 0, cy = 0, cw = FB_W, ch = FB_H;
+  if (s_useViewport && s_vpW > 0 && s_vpH > 0) {
+    // Flush seulement la sous-region viewport
+    cx = s_vpX; cy = s_vpY; cw = s_vpW; ch = s_vpH;
+  }
+
+  // Le diff lit s_fbCurrent, éventuellement encore en vol : lecture seule, sans risque
+  DirtyRect rects[MAX_DIRTY_RECTS];
+  int n = collectDirtyRects(cx, cy, cw, ch, rects);
+
+  // Le job et le staging buffer sont partagés : un seul transfert à la fois
+  waitJobDone();
+  s_job.fb = s_fbNext;
+  s_job.count = n;
+  memcpy(s_job.rects, rects, n * sizeof(DirtyRect));
+
+  if (s_async && s_flushTask) {
+    xSemaphoreTake(s_jobDone, 0);
+    xSemaphoreGive(s_jobReady);
   } else {
-    s_gfx->draw16bitRGBBitmap(FB_X, FB_Y, s_fbNext, FB_W, FB_H);
+    runJob(s_job);
   }
 
-  // Swap
+  // Swap : le prochain rendu écrit dans le buffer dont le transfert est terminé
   uint16_t* tmp = s_fbCurrent;
   s_fbCurrent = s_fbNext;
   s_fbNext = tmp;
+  RowSpan* tmpDmg = s_dmgPrev;
+  s_dmgPrev = s_dmgCur;
+  s_dmgCur = tmpDmg;  // Spans du contenu de s_fbNext, consommés par clearBand()
+  spanClear(s_dmgForce);
+}
+
+// ============================================
+// Dessin d'une frame, bande par bande
+// FaceFrame contient tout ce que render() a calculé (positions, formes du
+// cache) : une bande ne lit que ça et l'état des couches, sans rien modifier.
+// ============================================
+enum class Mouth : uint8_t { None, Open, Smile };
+
+struct FaceFrame {
+  int32_t scQ;             // Scale, Q2.30
+  Mouth mouth;
+  int16_t mouthW, mouthH;  // Taille extérieure de la bouche, déjà scalée
+  int16_t droolLen, droolRetract;
+  int16_t lcx, rcx, ecy;   // Centres des yeux (coordonnées FB)
+  int16_t mcx, mcy;        // Centre de la bouche
+  EyeConfig left, right;   // Déjà scalés
+  const ShapeEntry* leftShape;
+  const ShapeEntry* rightShape;
+};
+
+void rasterBand(const FaceFrame& f, const Band& b, int slot) {
+  using FaceFixed::mulQ30;
+  const int32_t sQ = f.scQ;
+  const int16_t mcx = f.mcx, mcy = f.mcy;
+
+  // Effacer la bande (seulement les spans de sa frame précédente)
+  clearBand(b);
+
+  // Dessiner les 2 yeux
+  fbDrawEye(b, f.lcx, f.ecy, f.left, f.leftShape, COL_EYE);
+  fbDrawEye(b, f.rcx, f.ecy, f.right, f.rightShape, COL_EYE);
+
+  // Bouche (scaled)
+  if (f.mouth == Mouth::Open) {
+    int16_t outerH = f.mouthH;
+    int16_t outerW = f.mouthW;
+    int16_t outerR = outerH / 2;
+    EyeConfig outerCfg = { outerH, outerW, 0, 0, outerR, outerR, 0, 0 };
+    fbDrawShape(b, mcx, mcy, outerCfg, COL_EYE);
+
+    int16_t innerW = outerW - (int16_t)mulQ30(12, sQ);
+    int16_t innerH = outerH - (int16_t)mulQ30(10, sQ);
+    if (innerW < 4) innerW = 4;
+    if (innerH < 3) innerH = 3;
+    const int16_t innerY = mcy + (int16_t)mulQ30(2, sQ);
+    fbFillRoundRect(b, mcx, innerY, innerW, innerH, innerH/2, COL_INNER);
+
+    int16_t tongueW = innerW * 2 / 3;
+    int16_t tongueH = innerH / 2;
+    if (tongueH > 2) {
+      fbFillRoundRect(b, mcx, innerY + innerH/2 - tongueH/2,
+                      tongueW, tongueH, tongueH/2, COL_TONGUE);
+    }
+  } else if (f.mouth == Mouth::Smile) {
+    int16_t w = f.mouthW;
+    int16_t h = f.mouthH;
+    if (h < 2) h = 2;
+    EyeConfig mCfg = { h, w, 0, 0, 3, 3, 0, 0 };
+    fbDrawShape(b, mcx, mcy, mCfg, COL_EYE);
+  }
+
+  // Goutte de bave
+  if (f.droolLen > 0) {
+    int16_t droolX = mcx + 6;
+    int16_t droolTopY = mcy + 12;
+    int16_t droolLen = f.droolLen;
+    int16_t retractPx = f.droolRetract;
+    int16_t filStart = droolTopY + retractPx;
+    int16_t filEnd = droolTopY + droolLen;
+    if (filEnd > filStart) {
+      int16_t filW = 3 - retractPx / 15;
+      if (filW < 1) filW = 1;
+      fbFillRect(b, droolX - filW/2, filStart, filW, filEnd - filStart, COL_EYE);
+    }
+    int16_t dropR = 3 + (droolLen - retractPx) / 10;
+    if (dropR > 8) dropR = 8;
+    if (dropR < 2) dropR = 2;
+    int16_t dropY = filEnd;
+    if (dropY + dropR < FB_H) {
+      for (int16_t dy = -dropR; dy <= dropR; dy++) {
+        int16_t dx = (int16_t)FaceFixed::isqrt(dropR*dropR - dy*dy);
+        fbHLine(b, droolX - dx, dropY + dy, 2*dx + 1, COL_EYE);
+      }
+    }
+  }
+
+  // Couches au-dessus du visage, sur la sous-image de la bande
+  s_layerBand[slot] = &b;
+  for (const Layer& layer : LAYERS) {
+    if (s_useViewport && !layer.inViewport) continue;
+    layer.draw(b.fb + b.y0 * FB_W, FB_W, b.y1 - b.y0, FB_X, FB_Y + b.y0);
+  }
+  s_layerBand[slot] = nullptr;
+}
+
+// ============================================
+// Tâche FaceRaster : dessine la bande basse quand la tâche de rendu la lance
+// ============================================
+const FaceFrame* s_rasterFrame = nullptr;
+Band s_rasterBand = { nullptr, 0, 0 };
+
+void rasterTask(void*) {
+  for (;;) {
+    if (xSemaphoreTake(s_rasterGo, portMAX_DELAY) != pdTRUE) continue;
+    rasterBand(*s_rasterFrame, s_rasterBand, 1);
+    xSemaphoreGive(s_rasterDone);
+  }
+}
+
+bool startRasterTask() {
+  if (s_rasterTask) return true;
+  if (CORE_RASTER == CORE_RENDER) return false;  // Un seul cœur : aucun gain
+  if (!s_rasterGo) {
+    s_rasterGo = xSemaphoreCreateBinary();
+    s_rasterDone = xSemaphoreCreateBinary();
+    if (!s_rasterGo || !s_rasterDone) {
+      Serial.println("[FACE] ERREUR: creation semaphores raster echouee");
+      s_rasterGo = nullptr;
+      return false;
+    }
+  }
+  BaseType_t result = xTaskCreatePinnedToCore(
+    rasterTask, "FaceRaster", STACK_SIZE_RASTER, nullptr,
+    PRIORITY_RASTER, &s_rasterTask, CORE_RASTER);
+  if (result != pdPASS) {
+    Serial.println("[FACE] ERREUR: creation tache raster echouee, rendu mono-coeur");
+    s_rasterTask = nullptr;
+    return false;
+  }
+  return true;
+}
+
+// Bande dont la tâche courante compose les couches (nullptr hors composition)
+const Band* currentLayerBand() {
+  const bool worker = s_rasterTask && xTaskGetCurrentTaskHandle() == s_rasterTask;
+  return s_layerBand[worker ? 1 : 0];
 }
 
 } // namespace
@@ -284,6 +968,10 @@ void init() {
   s_gfx = getGotchiGfx();
   if (!s_gfx) return;
 
+  // Ré-init (gotchi-test) : ne pas toucher aux buffers pendant un transfert
+  waitJobDone();
+  startFlushTask();
+
   // Allouer 2 framebuffers en PSRAM
   size_t fbSize = FB_W * FB_H * sizeof(uint16_t);
   s_fbCurrent = (uint16_t*)heap_caps_malloc(fbSize, MALLOC_CAP_SPIRAM);
@@ -296,123 +984,105 @@ void init() {
 
   memset(s_fbCurrent, 0, fbSize);
   memset(s_fbNext, 0, fbSize);
+  shapeCacheInit();
 
   s_gfx->fillScreen(COL_BG);
 
+  // Frame initiale envoyée en entier : rien à diffuser au premier flush
+  spanClear(s_dmgCur);
+  spanClear(s_dmgForce);
+  spanFill(s_dmgPrev);
+
   // Dessiner la frame initiale
   FacePreset n = FacePresets::getPreset(FaceExpression::Normal);
   int16_t lcx = LEFT_EYE_CX - FB_X;
   int16_t rcx = RIGHT_EYE_CX - FB_X;
   int16_t ecy = EYE_CY - FB_Y;
 
-  fbDrawShape(s_fbCurrent, lcx, ecy, n.left, COL_EYE);
-  fbDrawShape(s_fbCurrent, rcx, ecy, n.right, COL_EYE);
+  const Band full = { s_fbCurrent, 0, FB_H };
+  const ShapeEntry* leftShape;
+  const ShapeEntry* rightShape;
+  eyeShapes(lcx, rcx, ecy, n.left, n.right, leftShape, rightShape);
+  fbDrawEye(full, lcx, ecy, n.left, leftShape, COL_EYE);
+  fbDrawEye(full, rcx, ecy, n.right, rightShape, COL_EYE);
   // Pas de bouche par défaut (affichée seulement si mouthState sort de la zone neutre)
 
   // Envoyer toute la frame initiale d'un coup
   s_gfx->draw16bitRGBBitmap(FB_X, FB_Y, s_fbCurrent, FB_W, FB_H);
   memcpy(s_fbNext, s_fbCurrent, fbSize);
+  // s_dmgCur garde les spans des yeux : c'est ce que clearBand() effacera
 }
 
 void render(const EyeConfig& left, const EyeConfig& right, float lookX, float lookY, float mouthState) {
   if (!s_gfx || !s_fbCurrent || !s_fbNext) return;
+  using FaceFixed::mulQ30;
 
-  float sc = s_scale;
+  // Les entrées float (regard, bouche, bave) sont converties en pixels ici,
+  // une fois par frame ; tout ce qui suit (formes, coins, bandes) est entier
+  FaceFrame f;
+  const float sc = s_scale;
+  const int32_t sQ = s_scaleQ;
+  f.scQ = sQ;
   // Centre du FB (invariant au scale)
   int16_t fbCX = SCR_CX - FB_X;  // 213
-  int16_t fbCY = EYE_CY - FB_Y;  // 103
+  int16_t fbCY = EYE_CY - FB_Y;  // 203
 
   // Positions des yeux (scalees par rapport au centre)
-  int16_t halfGap = (int16_t)(EYE_GAP / 2 * sc);
+  int16_t halfGap = (int16_t)mulQ30(EYE_GAP / 2, sQ);
   int16_t lrx = (int16_t)(lookX * LOOK_RANGE_X * sc);
   int16_t lry = (int16_t)(lookY * LOOK_RANGE_Y * sc);
-  int16_t lcx = fbCX - halfGap + lrx;
-  int16_t rcx = fbCX + halfGap + lrx;
-  int16_t ecy = fbCY + lry;
+  f.lcx = fbCX - halfGap + lrx;
+  f.rcx = fbCX + halfGap + lrx;
+  f.ecy = fbCY + lry;
 
   // Bouche (scalee par rapport aux yeux)
-  int16_t mouthOff = (int16_t)((MOUTH_CY - EYE_CY) * sc);
-  int16_t mcx = fbCX;
-  int16_t mcy = fbCY + mouthOff + lry;
-
-  // Effacer le next buffer
-  memset(s_fbNext, 0, FB_W * FB_H * sizeof(uint16_t));
-
-  // Dessiner les 2 yeux (scaled)
-  EyeConfig sl = sc < 1.0f ? scaleEye(left, sc) : left;
-  EyeConfig sr = sc < 1.0f ? scaleEye(right, sc) : right;
-  fbDrawShape(s_fbNext, lcx, ecy, sl, COL_EYE);
-  fbDrawShape(s_fbNext, rcx, ecy, sr, COL_EYE);
-
-  // Bouche (scaled)
+  int16_t mouthOff = (int16_t)mulQ30(MOUTH_CY - EYE_CY, sQ);
+  f.mcx = fbCX;
+  f.mcy = fbCY + mouthOff + lry;
+  f.mouth = Mouth::None;
+  f.mouthW = f.mouthH = 0;
   if (mouthState < -0.15f) {
     float o = -mouthState;
-    int16_t outerH = (int16_t)((16 + o * 22) * sc);
-    int16_t outerW = (int16_t)((36 + o * 36) * sc);
-    int16_t outerR = outerH / 2;
-    EyeConfig outerCfg = { outerH, outerW, 0, 0, outerR, outerR, 0, 0 };
-    fbDrawShape(s_fbNext, mcx, mcy, outerCfg, COL_EYE);
-
-    int16_t innerW = outerW - (int16_t)(12 * sc);
-    int16_t innerH = outerH - (int16_t)(10 * sc);
-    if (innerW < 4) innerW = 4;
-    if (innerH < 3) innerH = 3;
-    fbFillRoundRect(s_fbNext, mcx, mcy + (int16_t)(2*sc), innerW, innerH, innerH/2, COL_INNER);
-
-    int16_t tongueW = innerW * 2 / 3;
-    int16_t tongueH = innerH / 2;
-    if (tongueH > 2) {
-      fbFillRoundRect(s_fbNext, mcx, mcy + (int16_t)(2*sc) + innerH/2 - tongueH/2,
-                      tongueW, tongueH, tongueH/2, COL_TONGUE);
-    }
+    f.mouth = Mouth::Open;
+    f.mouthH = (int16_t)((16 + o * 22) * sc);
+    f.mouthW = (int16_t)((36 + o * 36) * sc);
   } else if (mouthState > 0.1f) {
-    int16_t w = (int16_t)((30 + mouthState * 20) * sc);
-    int16_t h = (int16_t)((6 + mouthState * 4) * sc);
-    if (h < 2) h = 2;
-    EyeConfig mCfg = { h, w, 0, 0, 3, 3, 0, 0 };
-    fbDrawShape(s_fbNext, mcx, mcy, mCfg, COL_EYE);
+    f.mouth = Mouth::Smile;
+    f.mouthW = (int16_t)((30 + mouthState * 20) * sc);
+    f.mouthH = (int16_t)((6 + mouthState * 4) * sc);
   }
 
-  // Goutte de bave (seulement en mode normal, pas en viewport)
-  if (!s_useViewport) {
-    float drool = BehaviorEngine::getStats().droolLength;
-    float retract = BehaviorEngine::getStats().droolRetract;
-    if (drool > 1.0f) {
-      int16_t droolX = mcx + 6;
-      int16_t droolTopY = mcy + 12;
-      int16_t droolLen = (int16_t)drool;
-      int16_t retractPx = (int16_t)retract;
-      int16_t filStart = droolTopY + retractPx;
-      int16_t filEnd = droolTopY + droolLen;
-      if (filEnd > filStart) {
-        int16_t filW = 3 - retractPx / 15;
-        if (filW < 1) filW = 1;
-        fbFillRect(s_fbNext, droolX - filW/2, filStart, filW, filEnd - filStart, COL_EYE);
-      }
-      int16_t dropR = 3 + (droolLen - retractPx) / 10;
-      if (dropR > 8) dropR = 8;
-      if (dropR < 2) dropR = 2;
-      int16_t dropY = filEnd;
-      if (dropY + dropR < FB_H) {
-        for (int16_t dy = -dropR; dy <= dropR; dy++) {
-          int16_t dx = (int16_t)sqrtf((float)(dropR*dropR - dy*dy));
-          fbHLine(s_fbNext, droolX - dx, dropY + dy, 2*dx + 1, COL_EYE);
-        }
-      }
-    }
-  }
+  // Yeux (scaled) : le cache est résolu ici, les bandes ne font que lire
+  f.left = sQ < FaceFixed::Q30_ONE ? scaleEye(left, sQ) : left;
+  f.right = sQ < FaceFixed::Q30_ONE ? scaleEye(right, sQ) : right;
+  eyeShapes(f.lcx, f.rcx, f.ecy, f.left, f.right, f.leftShape, f.rightShape);
 
-  // Saleté (taches brunes) — dessiner dans le FB avant les objets
-  DirtOverlay::drawIntoFB(s_fbNext, FB_W, FB_H, FB_X, FB_Y);
-  // Éponge par-dessus la saleté (alpha blend dans le FB)
-  DirtOverlay::drawSpongeIntoFB(s_fbNext, FB_W, FB_H, FB_X, FB_Y);
-  // Brosse à dents
-  DirtOverlay::drawBrushIntoFB(s_fbNext, FB_W, FB_H, FB_X, FB_Y);
+  // Goutte de bave (seulement en mode normal, pas en viewport)
+  const float drool = s_useViewport ? 0.0f : BehaviorEngine::getStats().droolLength;
+  f.droolLen = drool > 1.0f ? (int16_t)drool : 0;
+  f.droolRetract = (int16_t)BehaviorEngine::getStats().droolRetract;
 
-  // Objets visuels (balle, coeurs) seulement en mode normal
-  if (!s_useViewport) {
-    BehaviorObjects::draw();
+  uint32_t t0 = micros();
+  uint32_t waitUs = 0;
+  if (s_parallel && s_rasterTask) {
+    // Bande basse sur l'autre cœur, bande haute ici, puis barrière
+    s_rasterFrame = &f;
+    s_rasterBand = { s_fbNext, RASTER_SPLIT_Y, FB_H };
+    xSemaphoreGive(s_rasterGo);
+    rasterBand(f, { s_fbNext, 0, RASTER_SPLIT_Y }, 0);
+    uint32_t tw = micros();
+    xSemaphoreTake(s_rasterDone, portMAX_DELAY);
+    waitUs = micros() - tw;
+    s_rasterStats.dualFrames++;
+  } else {
+    rasterBand(f, { s_fbNext, 0, FB_H }, 0);
   }
+  uint32_t dt = micros() - t0;
+  s_rasterStats.frames++;
+  s_rasterStats.lastRasterUs = dt;
+  s_rasterStats.totalRasterUs += dt;
+  s_rasterStats.lastWaitUs = waitUs;
+  s_rasterStats.totalWaitUs += waitUs;
 
   flushBuffer();
 }
@@ -426,14 +1096,73 @@ int16_t getFbH() { return FB_H; }
 void setViewport(int16_t x, int16_t y, int16_t w, int16_t h) {
   s_vpX = x; s_vpY = y; s_vpW = w; s_vpH = h;
   s_useViewport = true;
+  invalidate();
 }
 
 void clearViewport() {
   s_useViewport = false;
   s_vpX = 0; s_vpY = 0; s_vpW = FB_W; s_vpH = FB_H;
+  invalidate();
+}
+
+void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  const Band* b = currentLayerBand();
+  if (!b) {
+    markRect(s_dmgCur, x, y, w, h);
+    return;
+  }
+  // Coordonnées relatives à la bande : clip à ses lignes puis décalage
+  int32_t top = std::max<int32_t>(y, 0);
+  int32_t bottom = std::min<int32_t>((int32_t)y + h, b->y1 - b->y0);
+  if (top < bottom) markRect(s_dmgCur, x, b->y0 + top, w, bottom - top);
+}
+
+void invalidate() {
+  spanFill(s_dmgForce);
+}
+
+void invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  markRect(s_dmgForce, (int32_t)x - FB_X, (int32_t)y - FB_Y, w, h);
+}
+
+void setAsyncFlush(bool enabled) {
+  waitJobDone();
+  s_async = enabled;
 }
 
-void setScale(float scale) { s_scale = scale; }
-void resetScale() { s_scale = 1.0f; }
+bool isAsyncFlush() { return s_async && s_flushTask; }
+
+void waitFlush() { waitJobDone(); }
+
+const FlushStats& getFlushStats() { return s_flushStats; }
+void resetFlushStats() { s_flushStats = {}; }
+
+const ShapeCacheStats& getShapeCacheStats() { return s_shapeStats; }
+void resetShapeCacheStats() { s_shapeStats = {}; }
+
+// Les entrées restent valides pendant la désactivation (clé = forme)
+void setShapeCache(bool enabled) { s_shapeEnabled = enabled; }
+bool isShapeCache() { return s_shapeEnabled && s_shapeSpans && s_shapeMask; }
+
+bool setParallelRaster(bool enabled) {
+  if (enabled && !startRasterTask()) return false;
+  s_parallel = enabled;
+  return true;
+}
+
+bool isParallelRaster() { return s_parallel && s_rasterTask; }
+
+const RasterStats& getRasterStats() { return s_rasterStats; }
+void resetRasterStats() { s_rasterStats = {}; }
+
+void setScale(float scale) {
+  s_scale = scale;
+  s_scaleQ = FaceFixed::toQ30(scale);
+}
+
+void resetScale() {
+  s_scale = 1.0f;
+  s_scaleQ = FaceFixed::Q30_ONE;
+}
 
 } // namespace FaceRenderer
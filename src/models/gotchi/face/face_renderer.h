@@ -25,6 +25,69 @@ int16_t getFbH();
 void setViewport(int16_t x, int16_t y, int16_t w, int16_t h);
 void clearViewport();
 
+// Damage tracking : signale une zone ecrite dans le next buffer par un code
+// externe (dirt, objets). Coordonnees relatives au FB.
+void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Force le renvoi d'une zone au prochain flush, meme si le FB n'a pas change
+// (ecran ecrase par LVGL, un overlay ou un fillScreen). Coordonnees ecran.
+void invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h);
+void invalidate();  // Tout le FB
+
+// Stats du flush (octets envoyes au panel par frame)
+struct FlushStats {
+  uint32_t frames;       // Frames flushees depuis le reset
+  uint32_t idleFrames;   // Frames sans aucun pixel envoye
+  uint32_t lastBytes;    // Octets envoyes pour la derniere frame
+  uint32_t lastRects;    // Rectangles pousses pour la derniere frame
+  uint32_t lastFlushUs;  // Duree du dernier flush (transfert inclus)
+  uint32_t lastWaitUs;   // Temps bloque a attendre le transfert precedent (async)
+  uint64_t totalBytes;
+  uint64_t totalFlushUs;
+  uint64_t totalWaitUs;
+};
+const FlushStats& getFlushStats();
+
+// Cache LRU des yeux rasterises (un span par ligne, cle = EyeConfig quantifie)
+struct ShapeCacheStats {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+  uint32_t uncached;     // Formes non representables en spans (redessinees a chaque frame)
+};
+const ShapeCacheStats& getShapeCacheStats();
+void resetShapeCacheStats();
+// Desactive le cache (rasterisation directe a chaque frame) pour comparer
+// rendu et temps de dessin avec / sans. Actif par defaut.
+void setShapeCache(bool enabled);
+bool isShapeCache();
+
+// Pipeline : en async, le transfert de la frame N se fait sur une tache dediee
+// pendant que la frame N+1 se dessine. En sync, render() bloque jusqu'au bout.
+void setAsyncFlush(bool enabled);
+bool isAsyncFlush();
+// Attend la fin du transfert en cours (avant de toucher aux buffers du FB)
+void waitFlush();
+void resetFlushStats();
+
+// Rasterisation bi-coeur : s_fbNext coupe en deux bandes horizontales, la
+// bande basse dessinee par une tache sur l'autre coeur pendant que la tache de
+// rendu dessine la haute. Retourne false si indisponible (single-core, tache).
+bool setParallelRaster(bool enabled);
+bool isParallelRaster();
+
+// Stats du dessin d'une frame dans le FB (hors flush)
+struct RasterStats {
+  uint32_t frames;
+  uint32_t dualFrames;    // Frames dessinees en deux bandes
+  uint32_t lastRasterUs;  // Effacement + visage + couches, barriere incluse
+  uint32_t lastWaitUs;    // Attente de la bande basse apres la bande haute
+  uint64_t totalRasterUs;
+  uint64_t totalWaitUs;
+};
+const RasterStats& getRasterStats();
+void resetRasterStats();
+
 // Scale : reduit la taille du visage (1.0 = normal, 0.6 = 60%)
 void setScale(float scale);
 void resetScale();
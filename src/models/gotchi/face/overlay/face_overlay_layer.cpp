@@ -1,16 +1,12 @@
 #include "face_overlay_layer.h"
-#include "overlay_common.h"
 #include "overlay_anger.h"
 #include "overlay_sleep_zzz.h"
 // overlay_status desactive — les stats sont dans la view stats
 
-using namespace OverlayCommon;
-
 namespace {
 
 bool s_mangaCross = false;
 bool s_sleepZzz   = false;
-Arduino_GFX* s_gfx = nullptr;
 
 } // namespace
 
@@ -29,28 +25,19 @@ void update(uint32_t dtMs) {
   if (s_sleepZzz)   OverlaySleepZzz::update(sec);
 }
 
-void draw(Arduino_GFX* gfx) {
-  if (!gfx) return;
-
-  s_gfx = gfx;
-
-  BBox cur{};
-  if (s_mangaCross) OverlayAnger::draw(gfx, cur);
-  if (s_sleepZzz)   OverlaySleepZzz::draw(gfx, cur);
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY) {
+  if (!fb) return;
+  if (s_mangaCross) OverlayAnger::drawIntoFB(fb, fbW, fbH, fbX, fbY);
+  if (s_sleepZzz)   OverlaySleepZzz::drawIntoFB(fb, fbW, fbH, fbX, fbY);
 }
 
 void setMangaCross(bool enabled) {
-  if (s_mangaCross && !enabled && s_gfx) {
-    OverlayAnger::clear(s_gfx);
-  }
+  // Désactivé : plus composé, le flush du FB efface la zone tout seul
   s_mangaCross = enabled;
   if (!enabled) OverlayAnger::reset();
 }
 
 void setSleepZzz(bool enabled) {
-  if (s_sleepZzz && !enabled && s_gfx) {
-    OverlaySleepZzz::clear(s_gfx);
-  }
   s_sleepZzz = enabled;
   if (!enabled) OverlaySleepZzz::reset();
 }
@@ -1,7 +1,6 @@
 #ifndef FACE_OVERLAY_LAYER_H
 #define FACE_OVERLAY_LAYER_H
 
-#include <Arduino_GFX_Library.h>
 #include <cstdint>
 
 namespace FaceOverlayLayer {
@@ -9,8 +8,8 @@ namespace FaceOverlayLayer {
 void init();
 void update(uint32_t dtMs);
 
-/// Appeler apres FaceEngine::update. Efface bbox precedent puis redessine.
-void draw(Arduino_GFX* gfx);
+/// Couche du compositeur FaceRenderer : dessine 💤 / 💢 dans le FB (vue face).
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
 
 void setMangaCross(bool enabled);
 void setSleepZzz(bool enabled);
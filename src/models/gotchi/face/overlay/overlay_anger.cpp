@@ -1,7 +1,6 @@
 #include "overlay_anger.h"
+#include "../face_renderer.h"
 #include <cmath>
-#include <cstring>
-#include <esp_heap_caps.h>
 
 using namespace OverlayCommon;
 
@@ -9,22 +8,20 @@ namespace {
 constexpr uint16_t COL_ANGER = 0xF800;  // rouge vif
 float s_wobble = 0.0f;
 
-// Mini framebuffer pour le 💢
+// Zone écran du 💢
 constexpr int16_t OVL_X = 270;
 constexpr int16_t OVL_Y = 80;
 constexpr int16_t OVL_W = 80;
 constexpr int16_t OVL_H = 80;
-uint16_t* s_ovlBuf = nullptr;
 
-inline void bufSetPixel(int16_t x, int16_t y, uint16_t color) {
-  if (x >= 0 && x < OVL_W && y >= 0 && y < OVL_H)
-    s_ovlBuf[y * OVL_W + x] = color;
-}
-
-inline void bufFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  for (int16_t j = y; j < y + h; j++)
-    for (int16_t i = x; i < x + w; i++)
-      bufSetPixel(i, j, color);
+// Rectangle plein dans le FB (coordonnées FB), clippé au FB
+void fbFillRect(uint16_t* fb, int16_t fbW, int16_t fbH,
+                int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  int16_t x0 = std::max<int16_t>(x, 0), x1 = std::min<int16_t>(x + w, fbW);
+  int16_t y0 = std::max<int16_t>(y, 0), y1 = std::min<int16_t>(y + h, fbH);
+  for (int16_t j = y0; j < y1; j++)
+    for (int16_t i = x0; i < x1; i++)
+      fb[j * fbW + i] = color;
 }
 
 } // namespace
@@ -35,14 +32,7 @@ void update(float dtSec) {
   s_wobble += dtSec * 10.0f;
 }
 
-void draw(Arduino_GFX* g, BBox& bbox) {
-  if (!s_ovlBuf) {
-    s_ovlBuf = (uint16_t*)heap_caps_malloc(OVL_W * OVL_H * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
-    if (!s_ovlBuf) return;
-  }
-
-  memset(s_ovlBuf, 0, OVL_W * OVL_H * sizeof(uint16_t));
-
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY) {
   // Pulse lent
   float pulse = 0.8f + 0.2f * sinf(s_wobble * 1.2f);
 
@@ -54,25 +44,17 @@ void draw(Arduino_GFX* g, BBox& bbox) {
   if (arm < 6) arm = 6;
   if (gap < 2) gap = 2;
 
-  // Centre du buffer + wobble
-  int16_t cx = OVL_W / 2 + (int16_t)(sinf(s_wobble) * 2.0f);
-  int16_t cy = OVL_H / 2 + (int16_t)(sinf(s_wobble * 1.5f) * 1.5f);
+  // Centre de la zone + wobble, en coordonnées FB
+  int16_t cx = OVL_X - fbX + OVL_W / 2 + (int16_t)(sinf(s_wobble) * 2.0f);
+  int16_t cy = OVL_Y - fbY + OVL_H / 2 + (int16_t)(sinf(s_wobble * 1.5f) * 1.5f);
 
   // 4 branches decalees (pinwheel)
-  bufFillRect(cx - t / 2 - off, cy - gap - arm, t, arm, COL_ANGER);
-  bufFillRect(cx - t / 2 + off, cy + gap,       t, arm, COL_ANGER);
-  bufFillRect(cx - gap - arm, cy - t / 2 + off, arm, t, COL_ANGER);
-  bufFillRect(cx + gap,       cy - t / 2 - off, arm, t, COL_ANGER);
-
-  g->draw16bitRGBBitmap(OVL_X, OVL_Y, s_ovlBuf, OVL_W, OVL_H);
-  expand(bbox, OVL_X, OVL_Y, OVL_W, OVL_H);
-}
+  fbFillRect(fb, fbW, fbH, cx - t / 2 - off, cy - gap - arm, t, arm, COL_ANGER);
+  fbFillRect(fb, fbW, fbH, cx - t / 2 + off, cy + gap,       t, arm, COL_ANGER);
+  fbFillRect(fb, fbW, fbH, cx - gap - arm, cy - t / 2 + off, arm, t, COL_ANGER);
+  fbFillRect(fb, fbW, fbH, cx + gap,       cy - t / 2 - off, arm, t, COL_ANGER);
 
-void clear(Arduino_GFX* g) {
-  if (s_ovlBuf && g) {
-    memset(s_ovlBuf, 0, OVL_W * OVL_H * sizeof(uint16_t));
-    g->draw16bitRGBBitmap(OVL_X, OVL_Y, s_ovlBuf, OVL_W, OVL_H);
-  }
+  FaceRenderer::markDirty(OVL_X - fbX, OVL_Y - fbY, OVL_W, OVL_H);
 }
 
 void reset() {
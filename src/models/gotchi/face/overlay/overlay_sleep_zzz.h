@@ -6,8 +6,8 @@
 namespace OverlaySleepZzz {
 
 void update(float dtSec);
-void draw(Arduino_GFX* g, OverlayCommon::BBox& bbox);
-void clear(Arduino_GFX* g);
+// Dessine dans le FB du FaceRenderer et signale la zone (markDirty)
+void drawIntoFB(uint16_t* fb, int16_t fbW, int16_t fbH, int16_t fbX, int16_t fbY);
 void reset();
 
 } // namespace OverlaySleepZzz
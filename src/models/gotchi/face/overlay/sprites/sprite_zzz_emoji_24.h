@@ -5,70 +5,65 @@
 #include <cstdint>
 #include "../../behavior/sprites/sprite_asset.h"
 
-// Auto-generated from zzz_emoji_24.png (24x24) � RGBA multi-couleur
-// RGB565 + alpha s�par�s. Couleurs natives, blend au rendu.
+// Auto-generated from zzz_emoji_24.png (24x24) — RGBA multi-couleur, encodé en spans
+// 263/576 pixels visibles, 987 bytes flash (flat : 1728). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_ZZZ_EMOJI_24_WIDTH = 24;
 constexpr uint16_t SPRITE_ZZZ_EMOJI_24_HEIGHT = 24;
 
-const uint16_t SPRITE_ZZZ_EMOJI_24_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x33F6, 0x3C77, 0x4459, 0x3BF7, 0x3BF7, 0x3BF7, 0x4459, 0x3C79, 0x3B95, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x4458, 0x4CFC, 0x4499, 0x44BA, 0x44BA, 0x4CBA, 0x4478, 0x4458, 0x4458, 0x44BA, 0x4458,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x4438, 0x4478, 0x4458, 0x4438, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4457, 0x3CB7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4457, 0x4479, 0x4458, 0x4478, 0x4437, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x3BF7, 0x34D9, 0x2BF5, 0x4498, 0x4458, 0x4478, 0x4499, 0x4437, 0x0000, 0x3BF7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x555F, 0x0000, 0x4438, 0x4499, 0x4478, 0x4458, 0x34D9, 0x5555, 0x001F,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x5555, 0x0000, 0x0000, 0x5555, 0x0000, 0x3C57, 0x4479, 0x4458, 0x4478, 0x4458, 0x0000, 0x52B5, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x03EF, 0x3C77, 0x4458, 0x4458, 0x4499, 0x4437, 0x0000, 0x3BF7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x0000, 0x4437, 0x4478, 0x4457, 0x4458, 0x4458, 0x4458, 0x3BF7, 0x3BF7, 0x0000, 0x4438, 0x4499, 0x4479, 0x4458, 0x3CF7, 0x4C96, 0x34D3, 0x5555, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x4458, 0x4499, 0x4458, 0x4458, 0x4CBA, 0x4458, 0x4BF9, 0x0000, 0x4438, 0x4479, 0x4458, 0x4478, 0x4437, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x3BF7, 0x555A, 0x4437, 0x4CBA, 0x4457, 0x0000, 0x3C57, 0x4458, 0x4478, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4437, 0x0000,
-  0x07FF, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x5555, 0x52B5, 0x0000, 0x3BF6, 0x4499, 0x4458, 0x0000, 0x0000, 0x4458, 0x4499, 0x4458, 0x4458, 0x4458, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4458,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C77, 0x4478, 0x4479, 0x3BF7, 0xFFFF, 0x0000, 0x4458, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4479, 0x4458,
-  0x4458, 0x4478, 0x4458, 0x4458, 0x4478, 0x4458, 0x3C78, 0x4437, 0x4499, 0x3C37, 0x445A, 0x4C58, 0x0000, 0x3C38, 0x4458, 0x4438, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4438, 0x0000,
-  0x3C58, 0x4478, 0x4458, 0x4458, 0x4CFB, 0x4458, 0x4458, 0x4CDB, 0x4478, 0x4458, 0x4478, 0x4458, 0x4397, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4458, 0x4499, 0x4457, 0x4437, 0x44BA, 0x4458, 0x4458, 0x4479, 0x4457, 0x03EF, 0x07FF, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x5555, 0x0000,
-  0x34D9, 0x0000, 0x4437, 0x4CFB, 0x4437, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3C57, 0x4499, 0x4458, 0x0000, 0x0000, 0x001F, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3C38, 0x4458, 0x4478, 0x4457, 0x4478, 0x4437, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4458, 0x4478, 0x4457, 0x4458, 0x4479, 0x4458, 0x4BF9, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5555, 0x4C99, 0x3C77, 0x3CB7, 0x3CBA, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_ZZZ_EMOJI_24_SPAN_ROWS[] PROGMEM = {
+  0, 0, 7, 2, 19, 11, 36, 23, 46, 35, 64, 47, 72, 52, 87, 62,
+  100, 70, 123, 83, 137, 91, 161, 108, 183, 121, 206, 137, 231, 158, 245, 174,
+  271, 196, 288, 209, 311, 229, 320, 233, 334, 242, 343, 249, 356, 257, 364, 263
 };
 
-const uint8_t SPRITE_ZZZ_EMOJI_24_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x10, 0x0F, 0x10, 0x10, 0x10, 0x0F, 0x10, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x64, 0xE9, 0xEA, 0xEC, 0xEC, 0xED, 0xF0, 0xF0, 0xEF, 0xDF, 0x32,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x31, 0xA4, 0xA8, 0xA9, 0xAA, 0xA5, 0xEF, 0xFD, 0xFF, 0xCA, 0x0C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFD, 0xFB, 0x32, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x05, 0x06, 0x17, 0xE9, 0xFF, 0xFF, 0x80, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xA2, 0xFF, 0xFF, 0xCD, 0x05, 0x03, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x03, 0x00, 0x50, 0xFF, 0xFB, 0xFA, 0x32, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x14, 0xE5, 0xFD, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x59, 0x59, 0x5A, 0x55, 0x4A, 0x04, 0x04, 0x00, 0xA2, 0xFF, 0xFF, 0xD1, 0x08, 0x07, 0x05, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4A, 0xFF, 0xFF, 0xF8, 0xFF, 0xF9, 0x0E, 0x00, 0x51, 0xFF, 0xFD, 0xEE, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x06, 0x77, 0xFF, 0x65, 0x00, 0x18, 0xE5, 0xFE, 0xFF, 0xBD, 0x50, 0x57, 0x54, 0x55, 0x43, 0x00,
-  0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x32, 0xFF, 0xA3, 0x00, 0x00, 0x91, 0xFF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xE3, 0xD2, 0x04, 0x01, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46,
-  0x37, 0xBA, 0xBA, 0xB8, 0xA9, 0x9E, 0x09, 0xA7, 0xF7, 0x35, 0x0B, 0x0D, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x3D, 0x00,
-  0x39, 0xBC, 0xBA, 0xC4, 0xFF, 0xD2, 0x4B, 0xFF, 0xFF, 0xF9, 0xFF, 0xE4, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x97, 0xF6, 0x27, 0x13, 0x54, 0x55, 0x5A, 0x59, 0x4C, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
-  0x05, 0x00, 0x73, 0xFF, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x34, 0xFD, 0x8B, 0x00, 0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x19, 0xE0, 0xF8, 0x60, 0x5A, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x51, 0xF5, 0xEE, 0xFE, 0xFF, 0xE4, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x0E, 0x10, 0x0C, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_ZZZ_EMOJI_24_SPAN_OPS[] PROGMEM = {
+  0x0C, 0x80, 0x01, 0x08, 0x80, 0x01, 0xC0, 0x0D, 0x88, 0x0E, 0x10, 0x0F, 0x10, 0x10, 0x10, 0x0F, 0x10, 0x09, 0xC0, 0x0A, 0x80, 0x03, 0x00, 0x8A,
+  0x64, 0xE9, 0xEA, 0xEC, 0xEC, 0xED, 0xF0, 0xF0, 0xEF, 0xDF, 0x32, 0xC0, 0x0A, 0x80, 0x04, 0x00, 0x80, 0xB3, 0x48, 0x80, 0x59, 0xC0, 0x0A, 0x80,
+  0x02, 0x00, 0x87, 0x31, 0xA4, 0xA8, 0xA9, 0xAA, 0xA5, 0xEF, 0xFD, 0x40, 0x81, 0xCA, 0x0C, 0xC0, 0x11, 0x84, 0x3F, 0xF7, 0xFD, 0xFB, 0x32, 0xC0,
+  0x0C, 0x85, 0x02, 0x04, 0x05, 0x06, 0x17, 0xE9, 0x41, 0x80, 0x80, 0x00, 0x80, 0x04, 0xC0, 0x0E, 0x80, 0x03, 0x00, 0x80, 0xA2, 0x41, 0x83, 0xCD,
+  0x05, 0x03, 0x01, 0xC0, 0x05, 0x85, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x01, 0x80, 0x03, 0x00, 0x80, 0x50, 0x40, 0x82, 0xFB, 0xFA, 0x32, 0x00,
+  0x80, 0x03, 0xC0, 0x0C, 0x84, 0x02, 0x02, 0x14, 0xE5, 0xFD, 0x40, 0x80, 0x80, 0x00, 0x80, 0x04, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x87, 0x17, 0x59,
+  0x59, 0x5A, 0x55, 0x4A, 0x04, 0x04, 0x00, 0x80, 0xA2, 0x41, 0x84, 0xD1, 0x08, 0x07, 0x05, 0x03, 0xC0, 0x03, 0x80, 0x04, 0x00, 0x80, 0x4A, 0x41,
+  0x80, 0xF8, 0x40, 0x81, 0xF9, 0x0E, 0x00, 0x80, 0x51, 0x40, 0x82, 0xFD, 0xEE, 0x22, 0xC0, 0x05, 0x83, 0x01, 0x10, 0x06, 0x77, 0x40, 0x80, 0x65,
+  0x00, 0x82, 0x18, 0xE5, 0xFE, 0x40, 0x85, 0xBD, 0x50, 0x57, 0x54, 0x55, 0x43, 0xC0, 0x86, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x00, 0x80,
+  0x32, 0x40, 0x80, 0xA3, 0x01, 0x80, 0x91, 0x40, 0x81, 0xF7, 0xFB, 0x45, 0x80, 0x4C, 0xC0, 0x06, 0x84, 0x10, 0xE3, 0xD2, 0x04, 0x01, 0x00, 0x80,
+  0xA1, 0x48, 0x80, 0x46, 0xC0, 0x8B, 0x37, 0xBA, 0xBA, 0xB8, 0xA9, 0x9E, 0x09, 0xA7, 0xF7, 0x35, 0x0B, 0x0D, 0x00, 0x89, 0x15, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x54, 0x55, 0x3D, 0xC0, 0x83, 0x39, 0xBC, 0xBA, 0xC4, 0x40, 0x81, 0xD2, 0x4B, 0x41, 0x80, 0xF9, 0x40, 0x81, 0xE4, 0x0B, 0xC0,
+  0x02, 0x93, 0x97, 0xF6, 0x27, 0x13, 0x54, 0x55, 0x5A, 0x59, 0x4C, 0x02, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0xC0, 0x80,
+  0x05, 0x00, 0x80, 0x73, 0x40, 0x80, 0x67, 0xC0, 0x00, 0x82, 0x34, 0xFD, 0x8B, 0x01, 0x85, 0x01, 0x04, 0x04, 0x04, 0x04, 0x03, 0xC0, 0x86, 0x19,
+  0xE0, 0xF8, 0x60, 0x5A, 0x50, 0x03, 0xC0, 0x83, 0x51, 0xF5, 0xEE, 0xFE, 0x40, 0x81, 0xE4, 0x0A, 0x00, 0x80, 0x01, 0xC0, 0x85, 0x03, 0x0E, 0x10,
+  0x0C, 0x0C, 0x08, 0xC0, 0xC0
 };
 
-// Asset g�n�rique r�utilisable depuis le syst�me de spawnSprite()
+const uint16_t SPRITE_ZZZ_EMOJI_24_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0021, 0x0041, 0x0041, 0x0021, 0x0021, 0x0021, 0x0041, 0x0041, 0x0000, 0x0000, 0x19A9, 0x3BF6, 0x3BD5, 0x3BF6,
+  0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BB5, 0x08C4, 0x0000, 0x2AF0, 0x4CFC, 0x4499, 0x44BA, 0x44BA, 0x4CBA, 0x4478, 0x4458,
+  0x4458, 0x44BA, 0x1168, 0x0000, 0x08C4, 0x2ACF, 0x2ACF, 0x2AAF, 0x2ACF, 0x2ACF, 0x3BF6, 0x4458, 0x4479, 0x3351, 0x0041, 0x1105,
+  0x3C38, 0x4458, 0x3C37, 0x08C4, 0x0000, 0x0000, 0x0020, 0x0000, 0x0062, 0x3BD5, 0x4478, 0x4499, 0x220B, 0x0000, 0x0000, 0x2A8F,
+  0x4499, 0x4478, 0x3373, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1147, 0x4479, 0x3C17,
+  0x3C37, 0x08C4, 0x0000, 0x0000, 0x0000, 0x0062, 0x3BD5, 0x4458, 0x4499, 0x220B, 0x0000, 0x0000, 0x0062, 0x1188, 0x1167, 0x1168,
+  0x1168, 0x1126, 0x0000, 0x0000, 0x2A8F, 0x4499, 0x4479, 0x3373, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1126, 0x4499, 0x4458,
+  0x3C17, 0x4CBA, 0x3C17, 0x0021, 0x1147, 0x4479, 0x4458, 0x3C16, 0x0882, 0x0000, 0x0021, 0x0020, 0x19EA, 0x4CBA, 0x19A9, 0x0062,
+  0x3BD5, 0x4478, 0x4479, 0x3332, 0x1147, 0x1168, 0x1168, 0x1188, 0x1105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x08A4, 0x4499, 0x2AAF, 0x226D, 0x4499, 0x3C17, 0x3C17, 0x4458, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x1147, 0x0041, 0x3BD5,
+  0x3394, 0x0000, 0x0000, 0x2AAF, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4479, 0x1126, 0x08E5, 0x2B31,
+  0x2B11, 0x2B11, 0x2ACF, 0x2AAF, 0x0020, 0x2AAF, 0x3C58, 0x08E5, 0x0020, 0x0041, 0x0062, 0x1168, 0x1168, 0x1168, 0x1168, 0x1168,
+  0x1168, 0x1168, 0x1188, 0x1106, 0x08E5, 0x3352, 0x2B11, 0x3352, 0x4CFB, 0x3373, 0x1126, 0x4CDB, 0x4478, 0x3C17, 0x4478, 0x3BD5,
+  0x0000, 0x228E, 0x3C58, 0x08A3, 0x0041, 0x1188, 0x1168, 0x1168, 0x1188, 0x1147, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x19CA, 0x4CFB, 0x19A9, 0x08E5, 0x4499, 0x224C, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0062, 0x3BB5, 0x3C37, 0x1988, 0x1188, 0x1147, 0x0000, 0x1147, 0x3C37, 0x3BF5, 0x4458, 0x4479, 0x3BD5, 0x0000,
+  0x0000, 0x0000, 0x0041, 0x0041, 0x0041, 0x0041, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_ZZZ_EMOJI_24_SPANS = {
+  SPRITE_ZZZ_EMOJI_24_SPAN_ROWS, SPRITE_ZZZ_EMOJI_24_SPAN_OPS, SPRITE_ZZZ_EMOJI_24_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_ZZZ_EMOJI_24_ASSET = {
   SPRITE_ZZZ_EMOJI_24_WIDTH, SPRITE_ZZZ_EMOJI_24_HEIGHT,
-  SPRITE_ZZZ_EMOJI_24_ALPHA, SPRITE_ZZZ_EMOJI_24_RGB565
+  nullptr, nullptr, &SPRITE_ZZZ_EMOJI_24_SPANS
 };
 
 #endif // SPRITE_ZZZ_EMOJI_24_INCLUDED
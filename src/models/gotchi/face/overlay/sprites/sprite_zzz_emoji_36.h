@@ -5,94 +5,100 @@
 #include <cstdint>
 #include "../../behavior/sprites/sprite_asset.h"
 
-// Auto-generated from zzz_emoji_36.png (36x36) � RGBA multi-couleur
-// RGB565 + alpha s�par�s. Couleurs natives, blend au rendu.
+// Auto-generated from zzz_emoji_36.png (36x36) — RGBA multi-couleur, encodé en spans
+// 552/1296 pixels visibles, 1983 bytes flash (flat : 3888). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_ZZZ_EMOJI_36_WIDTH = 36;
 constexpr uint16_t SPRITE_ZZZ_EMOJI_36_HEIGHT = 36;
 
-const uint16_t SPRITE_ZZZ_EMOJI_36_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4457, 0x4C99, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF9, 0x33F6, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF5, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x4C58,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF5, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x4CD9,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4457, 0x4C99, 0x4BF6, 0x4BF6, 0x33F6, 0x4C38, 0x33F6, 0x4457, 0x4479, 0x4458, 0x4458, 0x4499, 0x4438, 0x0000, 0x7BFF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C77, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x3C78, 0x0000, 0x7BFF,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x07FF, 0x07FF, 0x03EF, 0x3BF7, 0x34D9, 0x4458, 0x4499, 0x4458, 0x4458, 0x4499, 0x3C57, 0x0000, 0x5555, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x4437, 0x4499, 0x4458, 0x4458, 0x4499, 0x4438, 0x0000, 0x5555, 0x001F, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x3C57, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x3C58, 0x0000, 0x7BFF, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x52B5, 0x3DF7, 0x4458, 0x4499, 0x4458, 0x4458, 0x4499, 0x3C57, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x4437, 0x4499, 0x4458, 0x4458, 0x4499, 0x4438, 0x0000, 0x5555, 0x001F, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FFF, 0x0000, 0x3C57, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x3C58, 0x0000, 0x7BFF, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3333, 0x4CFA, 0x3CB7, 0x3C58, 0x3C58, 0x3C58, 0x4C99, 0x4C96, 0x0000, 0x0000, 0x07FF, 0x52B5, 0x3DF7, 0x4458, 0x4499, 0x4458, 0x4458, 0x4499, 0x3C57, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3BF7, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x5478, 0x0000, 0x3BF7, 0x0000, 0x4437, 0x4499, 0x4458, 0x4458, 0x4499, 0x4458, 0x07FF, 0x3BF7, 0x03EF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3B95, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x3BF7, 0x7BFF, 0x0000, 0x3C57, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3C58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D9, 0x4CF8, 0x3C77, 0x4C9B, 0x4437, 0x4479, 0x4478, 0x4458, 0x0000, 0x555F, 0x34D3, 0x4458, 0x4499, 0x4458, 0x4458, 0x4479, 0x4437, 0x3C78, 0x4C36, 0x33F6, 0x4BF6, 0x4BF6, 0x4C99, 0x3BB6, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4457, 0x4478, 0x4499, 0x4437, 0x0000, 0x3339, 0x0000, 0x4457, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4437, 0x0000,
-  0x0000, 0x001F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x52B5, 0x03EF, 0x4498, 0x4458, 0x4CBA, 0x4457, 0x3DF7, 0x555F, 0x001F, 0x4BF6, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x3C58,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001F, 0x555F, 0x0000, 0x4457, 0x44BA, 0x4458, 0x4478, 0x001F, 0x3BF7, 0x0000, 0x4BF6, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x3BF7,
-  0x0000, 0x3BF7, 0x4CFA, 0x3CB7, 0x3C58, 0x3C58, 0x3C58, 0x4C99, 0x4C96, 0x7BFF, 0x0000, 0x4457, 0x4499, 0x4478, 0x4457, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4437, 0x0000,
-  0x3CF7, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x0000, 0x3C38, 0x4478, 0x4499, 0x4437, 0x3BF7, 0x3C77, 0x4CF8, 0x34D9, 0x0000, 0x0000, 0x0000, 0x33F6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4BF6, 0x4C99, 0x2B94, 0x0000, 0x0000,
-  0x3C75, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x4457, 0x4458, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3BF7, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000,
-  0x0000, 0x34D9, 0x4C5A, 0x3C77, 0x4C9B, 0x4437, 0x4479, 0x4479, 0x4457, 0x07FF, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3BF7, 0x0000, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4457, 0x4478, 0x4499, 0x4437, 0x0000, 0x03FF, 0x3BF7, 0x4C99, 0x4C58, 0x3C58, 0x3C58, 0x3CB7, 0x4CFA, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x52B5, 0x03EF, 0x4498, 0x4458, 0x4CBA, 0x4457, 0x3DF7, 0x5555, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x001F, 0x555F, 0x0000, 0x4457, 0x44BA, 0x4458, 0x4478, 0x001F, 0x52B5, 0x0000, 0x001F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x07FF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x52B5, 0x0000, 0x4457, 0x4499, 0x4478, 0x4457, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4478, 0x4478, 0x4499, 0x4437, 0x3BF7, 0x3C77, 0x4CF8, 0x34D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3BF7, 0x4458, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3B95, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4CD9, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3BF7, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3BF7, 0x4C99, 0x4BF6, 0x3C58, 0x3C58, 0x3CB7, 0x4CFA, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x001F, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x07FF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_ZZZ_EMOJI_36_SPAN_ROWS[] PROGMEM = {
+  0, 0, 16, 13, 23, 15, 39, 28, 60, 44, 72, 62, 89, 80, 110, 96,
+  131, 110, 147, 119, 167, 132, 185, 141, 201, 150, 218, 160, 246, 177, 262, 186,
+  289, 204, 324, 228, 354, 248, 384, 271, 412, 291, 446, 325, 468, 350, 506, 380,
+  542, 410, 569, 431, 606, 463, 625, 476, 638, 485, 661, 501, 671, 506, 682, 514,
+  697, 525, 712, 536, 723, 544, 724, 544
 };
 
-const uint8_t SPRITE_ZZZ_EMOJI_36_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0xEA, 0xEF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF1, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFD, 0xE3, 0x0A,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x67, 0xEA, 0xEF, 0xF1, 0xF1, 0xF1, 0xF2, 0xF3, 0xEE, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x70, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x0A, 0x7D, 0xFF, 0xFD, 0xFC, 0xFF, 0xBC, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xF2, 0xFE, 0xFC, 0xFE, 0xF1, 0x24, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05, 0xC4, 0xFF, 0xFC, 0xFC, 0xFF, 0x6C, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x75, 0xFF, 0xFC, 0xFC, 0xFF, 0xBC, 0x00, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2C, 0xF5, 0xFD, 0xFC, 0xFE, 0xF1, 0x25, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0xC3, 0xFF, 0xFC, 0xFC, 0xFF, 0x6C, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x75, 0xFF, 0xFC, 0xFC, 0xFF, 0xBC, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2C, 0xF5, 0xFD, 0xFC, 0xFE, 0xF1, 0x25, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x07, 0x00, 0x00, 0x01, 0x03, 0x04, 0xC3, 0xFF, 0xFC, 0xFC, 0xFF, 0x6C, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0xD4, 0xF5, 0xF3, 0xF5, 0xF6, 0xF0, 0xF1, 0xD7, 0x09, 0x00, 0x04, 0x00, 0x75, 0xFF, 0xFC, 0xFC, 0xFF, 0xBC, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xD8, 0xF5, 0xF4, 0xF7, 0xF1, 0xFF, 0xFF, 0xE6, 0x08, 0x02, 0x00, 0x2C, 0xF5, 0xFD, 0xFC, 0xFF, 0xED, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0D, 0x10, 0x07, 0x80, 0xFC, 0xFD, 0x4E, 0x00, 0x03, 0x05, 0xC3, 0xFF, 0xFC, 0xFD, 0xFF, 0x79, 0x09, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF4, 0xFF, 0x86, 0x00, 0x05, 0x00, 0x74, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xEE, 0xF3, 0xF2, 0xF1, 0xF1, 0xF1, 0xF0, 0xEF, 0x75, 0x00,
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x02, 0x17, 0xDE, 0xFF, 0xBD, 0x04, 0x03, 0x01, 0x0A, 0xE5, 0xFD, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0D,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0xB1, 0xFF, 0xE3, 0x1B, 0x01, 0x04, 0x00, 0x0E, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x0C,
-  0x00, 0x04, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x07, 0x02, 0x00, 0x77, 0xFF, 0xF5, 0x43, 0x00, 0x00, 0x00, 0x02, 0x01, 0x87, 0xF1, 0xEF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xEF, 0xE9, 0x60, 0x00,
-  0x08, 0xD1, 0xF5, 0xF3, 0xF5, 0xF6, 0xF0, 0xF1, 0xDA, 0x00, 0x39, 0xF8, 0xFC, 0x89, 0x08, 0x10, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0B, 0x00, 0x00,
-  0x09, 0xD5, 0xF5, 0xF4, 0xF7, 0xF1, 0xFF, 0xFF, 0xE5, 0x0B, 0xDB, 0xFF, 0xFF, 0xF2, 0xF7, 0xF4, 0xF5, 0xD8, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x05, 0x0D, 0x10, 0x07, 0x80, 0xFC, 0xFD, 0x4B, 0x01, 0xDF, 0xF1, 0xF0, 0xF6, 0xF5, 0xF3, 0xF5, 0xD2, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3C, 0xF4, 0xFF, 0x86, 0x00, 0x02, 0x08, 0x0E, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x02, 0x17, 0xDE, 0xFF, 0xBD, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x03, 0x00, 0xB1, 0xFF, 0xE3, 0x1B, 0x01, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x78, 0xFF, 0xF5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3A, 0xF9, 0xFC, 0x89, 0x08, 0x10, 0x0D, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0xD9, 0xFF, 0xFF, 0xF2, 0xF7, 0xF4, 0xF5, 0xD8, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0A, 0xD9, 0xF1, 0xF0, 0xF6, 0xF5, 0xF3, 0xF5, 0xD2, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C, 0x0D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_ZZZ_EMOJI_36_SPAN_OPS[] PROGMEM = {
+  0x14, 0x8C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x13, 0x80, 0x02, 0x0C, 0x80, 0x01, 0xC0, 0x14,
+  0x8C, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0xC0, 0x11, 0x80, 0x02, 0x00, 0x8E, 0x67, 0xEA, 0xEF, 0xF1,
+  0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF1, 0x80, 0xC0, 0x10, 0x80, 0x01, 0x00, 0x81, 0x0C, 0xF1, 0x4C, 0x81, 0xF4, 0x0D, 0xC0,
+  0x10, 0x80, 0x01, 0x00, 0x81, 0x0C, 0xF1, 0x47, 0x86, 0xFE, 0xFE, 0xFE, 0xFC, 0xFD, 0xE3, 0x0A, 0xC0, 0x11, 0x80, 0x02, 0x00, 0x88, 0x67, 0xEA,
+  0xEF, 0xF1, 0xF1, 0xF1, 0xF2, 0xF3, 0xEE, 0x42, 0x80, 0xFC, 0x40, 0x80, 0x70, 0xC0, 0x14, 0x87, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x11, 0x0A, 0x7D,
+  0x40, 0x81, 0xFD, 0xFC, 0x40, 0x80, 0xBC, 0x00, 0x80, 0x02, 0xC0, 0x13, 0x80, 0x02, 0x05, 0x86, 0x28, 0xF2, 0xFE, 0xFC, 0xFE, 0xF1, 0x24, 0x00,
+  0x80, 0x02, 0xC0, 0x14, 0x86, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05, 0xC4, 0x40, 0x81, 0xFC, 0xFC, 0x40, 0x80, 0x6C, 0x00, 0x80, 0x03, 0xC0, 0x17,
+  0x80, 0x03, 0x00, 0x80, 0x75, 0x40, 0x81, 0xFC, 0xFC, 0x40, 0x80, 0xBC, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x16, 0x80, 0x02, 0x00, 0x86, 0x2C, 0xF5,
+  0xFD, 0xFC, 0xFE, 0xF1, 0x25, 0x00, 0x80, 0x02, 0xC0, 0x15, 0x83, 0x01, 0x03, 0x04, 0xC3, 0x40, 0x81, 0xFC, 0xFC, 0x40, 0x80, 0x6C, 0x00, 0x80,
+  0x03, 0xC0, 0x09, 0x87, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x80, 0x03, 0x00, 0x80, 0x75, 0x40, 0x81, 0xFC, 0xFC, 0x40, 0x80,
+  0xBC, 0x00, 0x81, 0x03, 0x01, 0xC0, 0x14, 0x80, 0x02, 0x00, 0x86, 0x2C, 0xF5, 0xFD, 0xFC, 0xFE, 0xF1, 0x25, 0x00, 0x80, 0x02, 0xC0, 0x09, 0x87,
+  0x05, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x07, 0x01, 0x83, 0x01, 0x03, 0x04, 0xC3, 0x40, 0x81, 0xFC, 0xFC, 0x40, 0x80, 0x6C, 0x00, 0x80, 0x03,
+  0xC0, 0x06, 0x80, 0x01, 0x00, 0x89, 0x08, 0xD4, 0xF5, 0xF3, 0xF5, 0xF6, 0xF0, 0xF1, 0xD7, 0x09, 0x00, 0x80, 0x04, 0x00, 0x80, 0x75, 0x40, 0x81,
+  0xFC, 0xFC, 0x40, 0x86, 0xBC, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0xC0, 0x06, 0x80, 0x01, 0x00, 0x85, 0x09, 0xD8, 0xF5, 0xF4, 0xF7, 0xF1, 0x41,
+  0x82, 0xE6, 0x08, 0x02, 0x00, 0x83, 0x2C, 0xF5, 0xFD, 0xFC, 0x40, 0x81, 0xED, 0x21, 0x05, 0x80, 0x01, 0xC0, 0x09, 0x87, 0x05, 0x0D, 0x10, 0x07,
+  0x80, 0xFC, 0xFD, 0x4E, 0x00, 0x82, 0x03, 0x05, 0xC3, 0x40, 0x81, 0xFC, 0xFD, 0x40, 0x87, 0x79, 0x09, 0x11, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0xC0,
+  0x0C, 0x81, 0x3C, 0xF4, 0x40, 0x80, 0x86, 0x00, 0x80, 0x05, 0x00, 0x80, 0x74, 0x40, 0x80, 0xFC, 0x42, 0x88, 0xEE, 0xF3, 0xF2, 0xF1, 0xF1, 0xF1,
+  0xF0, 0xEF, 0x75, 0xC0, 0x00, 0x87, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x83, 0x03, 0x02, 0x17, 0xDE, 0x40, 0x8A, 0xBD, 0x04,
+  0x03, 0x01, 0x0A, 0xE5, 0xFD, 0xFC, 0xFE, 0xFE, 0xFE, 0x47, 0x81, 0xF2, 0x0D, 0xC0, 0x08, 0x81, 0x01, 0x03, 0x00, 0x80, 0xB1, 0x40, 0x83, 0xE3,
+  0x1B, 0x01, 0x04, 0x00, 0x81, 0x0E, 0xFA, 0x4C, 0x81, 0xEC, 0x0C, 0xC0, 0x00, 0x88, 0x04, 0x0D, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x07, 0x02, 0x00,
+  0x80, 0x77, 0x40, 0x81, 0xF5, 0x43, 0x02, 0x90, 0x02, 0x01, 0x87, 0xF1, 0xEF, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xEF, 0xE9,
+  0x60, 0xC0, 0x88, 0x08, 0xD1, 0xF5, 0xF3, 0xF5, 0xF6, 0xF0, 0xF1, 0xDA, 0x00, 0x87, 0x39, 0xF8, 0xFC, 0x89, 0x08, 0x10, 0x0D, 0x05, 0x02, 0x8C,
+  0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0B, 0xC0, 0x85, 0x09, 0xD5, 0xF5, 0xF4, 0xF7, 0xF1, 0x41, 0x82, 0xE5,
+  0x0B, 0xDB, 0x41, 0x85, 0xF2, 0xF7, 0xF4, 0xF5, 0xD8, 0x08, 0x00, 0x80, 0x02, 0x0C, 0x80, 0x02, 0xC0, 0x00, 0x91, 0x05, 0x0D, 0x10, 0x07, 0x80,
+  0xFC, 0xFD, 0x4B, 0x01, 0xDF, 0xF1, 0xF0, 0xF6, 0xF5, 0xF3, 0xF5, 0xD2, 0x08, 0x00, 0x8D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x03, 0x81, 0x3C, 0xF4, 0x40, 0x80, 0x86, 0x00, 0x88, 0x02, 0x08, 0x0E, 0x0D, 0x0D, 0x0D, 0x0C, 0x0D, 0x04,
+  0xC0, 0x00, 0x83, 0x03, 0x02, 0x17, 0xDE, 0x40, 0x83, 0xBD, 0x04, 0x03, 0x01, 0xC0, 0x81, 0x01, 0x03, 0x00, 0x80, 0xB1, 0x40, 0x83, 0xE3, 0x1B,
+  0x01, 0x03, 0x00, 0x87, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x80, 0x03, 0x00, 0x80, 0x78, 0x40, 0x81, 0xF5, 0x43, 0xC0, 0x00,
+  0x87, 0x3A, 0xF9, 0xFC, 0x89, 0x08, 0x10, 0x0D, 0x05, 0xC0, 0x81, 0x08, 0xD9, 0x41, 0x85, 0xF2, 0xF7, 0xF4, 0xF5, 0xD8, 0x09, 0x00, 0x80, 0x01,
+  0xC0, 0x89, 0x0A, 0xD9, 0xF1, 0xF0, 0xF6, 0xF5, 0xF3, 0xF5, 0xD2, 0x08, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x87, 0x08, 0x0E, 0x0E, 0x0D, 0x0D, 0x0C,
+  0x0D, 0x04, 0xC0, 0xC0, 0x00, 0x87, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC0
 };
 
-// Asset g�n�rique r�utilisable depuis le syst�me de spawnSprite()
+const uint16_t SPRITE_ZZZ_EMOJI_36_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0041, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0000, 0x19A9, 0x3BF5, 0x3BF6,
+  0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3C16, 0x222C, 0x0000, 0x0021, 0x3BF6, 0x4479,
+  0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x3C17, 0x0041, 0x0000, 0x0021,
+  0x3BF6, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x3BB5, 0x0020,
+  0x0000, 0x19A9, 0x3BF5, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x19CA,
+  0x0020, 0x0041, 0x0021, 0x0021, 0x0021, 0x0041, 0x0000, 0x222B, 0x4479, 0x4458, 0x4458, 0x4499, 0x3312, 0x0000, 0x0000, 0x08A3,
+  0x3C16, 0x4458, 0x4458, 0x4458, 0x3BF6, 0x08A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3352, 0x4499, 0x4458,
+  0x4458, 0x4499, 0x19CA, 0x0000, 0x0000, 0x19EA, 0x4499, 0x4458, 0x4458, 0x4499, 0x3312, 0x0000, 0x0000, 0x0000, 0x08C4, 0x3C17,
+  0x4458, 0x4458, 0x4458, 0x3BF6, 0x08A3, 0x0000, 0x0000, 0x0000, 0x0020, 0x3332, 0x4499, 0x4458, 0x4458, 0x4499, 0x19CA, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19EA, 0x4499, 0x4458, 0x4458, 0x4499, 0x3312, 0x0000,
+  0x0000, 0x0000, 0x08C4, 0x3C17, 0x4458, 0x4458, 0x4458, 0x3BF6, 0x08A3, 0x0000, 0x0000, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+  0x0041, 0x0020, 0x0000, 0x0000, 0x0020, 0x3332, 0x4499, 0x4458, 0x4458, 0x4499, 0x19CA, 0x0000, 0x0000, 0x0000, 0x3394, 0x3C37,
+  0x3BF6, 0x3C17, 0x3C17, 0x3BF6, 0x3BF6, 0x3394, 0x0020, 0x0000, 0x19EA, 0x4499, 0x4458, 0x4458, 0x4499, 0x3332, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3394, 0x3C37, 0x3C17, 0x3C17, 0x3BF6, 0x4458, 0x4499, 0x3BD5, 0x0000, 0x0000,
+  0x08C4, 0x3C17, 0x4458, 0x4458, 0x4478, 0x3BF6, 0x0083, 0x0000, 0x0020, 0x0041, 0x0041, 0x0020, 0x220B, 0x4479, 0x4478, 0x1147,
+  0x0000, 0x0020, 0x3332, 0x4499, 0x4458, 0x4458, 0x4479, 0x19EA, 0x0020, 0x0041, 0x0021, 0x0021, 0x0021, 0x0041, 0x0021, 0x1105,
+  0x3C37, 0x4499, 0x222C, 0x0000, 0x19EA, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6,
+  0x3BF6, 0x3C16, 0x19EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x3BB5, 0x4CBA,
+  0x3331, 0x0020, 0x0000, 0x0000, 0x0000, 0x3BD5, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458,
+  0x4458, 0x4458, 0x4479, 0x3BF6, 0x0041, 0x0000, 0x0000, 0x2AEF, 0x44BA, 0x3BB5, 0x0062, 0x0000, 0x0000, 0x0021, 0x3C17, 0x4478,
+  0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x3BF6, 0x0021, 0x0000, 0x0041,
+  0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x19EA, 0x4499, 0x3C37, 0x1105, 0x0000, 0x0000, 0x224C, 0x3C16, 0x3BF6,
+  0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x1988, 0x0020, 0x3373, 0x3C37, 0x3BF6,
+  0x3C17, 0x3C17, 0x3BF6, 0x3BF6, 0x3394, 0x08E5, 0x3C37, 0x4499, 0x222C, 0x0000, 0x0041, 0x0041, 0x0020, 0x0021, 0x0021, 0x0021,
+  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0041, 0x0000, 0x0020, 0x3394, 0x3C37, 0x3C17, 0x3C17, 0x3BF6,
+  0x4458, 0x4499, 0x3BD5, 0x0020, 0x3394, 0x4499, 0x4458, 0x3BF6, 0x3C17, 0x3C17, 0x3C37, 0x3394, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0041, 0x0041, 0x0020, 0x220B, 0x4479, 0x4479, 0x1126, 0x0000, 0x3BB5, 0x3BF6, 0x3BF6, 0x3C17, 0x3C17, 0x3BF6, 0x3C37, 0x3373,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1105,
+  0x3C37, 0x4499, 0x222C, 0x0000, 0x0000, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0000, 0x0000, 0x0000, 0x0062, 0x3BB5,
+  0x4CBA, 0x3331, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x2AEF, 0x44BA, 0x3BB5, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19EA, 0x4499, 0x3C37, 0x1105, 0x08E5, 0x3C37, 0x4499, 0x222C, 0x0000, 0x0041,
+  0x0041, 0x0020, 0x0000, 0x3394, 0x4499, 0x4458, 0x3BF6, 0x3C17, 0x3C17, 0x3C37, 0x3394, 0x0000, 0x0000, 0x0020, 0x3394, 0x3C16,
+  0x3BF6, 0x3C17, 0x3C17, 0x3BF6, 0x3C37, 0x3373, 0x0000, 0x0000, 0x0000, 0x0041, 0x0021, 0x0041, 0x0041, 0x0041, 0x0041, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_ZZZ_EMOJI_36_SPANS = {
+  SPRITE_ZZZ_EMOJI_36_SPAN_ROWS, SPRITE_ZZZ_EMOJI_36_SPAN_OPS, SPRITE_ZZZ_EMOJI_36_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_ZZZ_EMOJI_36_ASSET = {
   SPRITE_ZZZ_EMOJI_36_WIDTH, SPRITE_ZZZ_EMOJI_36_HEIGHT,
-  SPRITE_ZZZ_EMOJI_36_ALPHA, SPRITE_ZZZ_EMOJI_36_RGB565
+  nullptr, nullptr, &SPRITE_ZZZ_EMOJI_36_SPANS
 };
 
 #endif // SPRITE_ZZZ_EMOJI_36_INCLUDED
@@ -5,118 +5,133 @@
 #include <cstdint>
 #include "../../behavior/sprites/sprite_asset.h"
 
-// Auto-generated from zzz_emoji_48.png (48x48) � RGBA multi-couleur
-// RGB565 + alpha s�par�s. Couleurs natives, blend au rendu.
+// Auto-generated from zzz_emoji_48.png (48x48) — RGBA multi-couleur, encodé en spans
+// 835/2304 pixels visibles, 2925 bytes flash (flat : 6912). Voir SpriteSpans dans sprite_asset.h.
 
 constexpr uint16_t SPRITE_ZZZ_EMOJI_48_WIDTH = 48;
 constexpr uint16_t SPRITE_ZZZ_EMOJI_48_HEIGHT = 48;
 
-const uint16_t SPRITE_ZZZ_EMOJI_48_RGB565[] PROGMEM = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF3, 0x4457, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x4457, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x3C58, 0x4478, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4CBA, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x3C58, 0x44BA, 0x4438, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x3C58, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x33F6, 0x4458, 0x449A, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x4CBA, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x4438, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53FA, 0x4437, 0x4458, 0x4458, 0x4438, 0x4438, 0x4438, 0x4438, 0x4437, 0x4457, 0x4458, 0x4437, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x0000, 0x52B5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C17, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4437, 0x0000, 0x7BFF, 0x001F,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x53FA, 0x53F5, 0x4458, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3C57, 0x07FF, 0x001F, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52B5, 0x0000, 0x4457, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x0000, 0x52B5, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x4457, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4457, 0x5555, 0x3BF7, 0x001F, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x07FF, 0x3C38, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x4437, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4437, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02B5, 0x0000, 0x4437, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4437, 0x0000, 0x7BFF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x7BEF, 0x4458, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x3C57, 0x001F, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52B5, 0x0000, 0x4457, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x0000, 0x52B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BFF, 0x0000, 0x4457, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4457, 0x5555, 0x3BF7, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03EF, 0x07FF, 0x3C38, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x4437, 0x0000, 0x07FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4438, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4457, 0x07FF, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4437, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x34D9, 0x0000, 0x4458, 0x4CFC, 0x4499, 0x4CBA, 0x44BA, 0x4CBA, 0x4CBA, 0x4499, 0x4499, 0x44BA, 0x4478, 0x4457, 0x0000, 0x0000, 0x02B5, 0x0000, 0x4437, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4437, 0x0000, 0x7BFF, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3BF7, 0x0000, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4457, 0x4478, 0x4458, 0x555F, 0x0000, 0x7BFF, 0x7BEF, 0x4458, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4479, 0x4458, 0x3C78, 0x2BF5, 0x53F5, 0x34D3, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x5555, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4BF6, 0x4457, 0x4457, 0x4BF6, 0x4B76, 0x4457, 0x4478, 0x4458, 0x4478, 0x4458, 0x0000, 0x5555, 0x7BFF, 0x0000, 0x4457, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4458, 0x4479, 0x4458, 0x4479, 0x4437, 0x0000, 0xFFFF, 0x7FEF, 0x0000, 0x3C57, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4457, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4437, 0x0000, 0x001F,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4477, 0x4458, 0x4458, 0x4499, 0x4457, 0x0000, 0x5555, 0x03EF, 0x0000, 0x3C77, 0x4437, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x5555, 0x3BF7, 0x4458, 0x4479, 0x4478, 0x4458, 0x3C77, 0x001F, 0x03EF, 0x3BF7, 0x0000, 0x4458, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x03EF, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x3BF7, 0x5555, 0x0000, 0x0000, 0x5555, 0x0000, 0x4458, 0x4499, 0x4458, 0x4458, 0x4457, 0x0000, 0xFFFF, 0x0000, 0x3BF7, 0x0000, 0x3C58, 0x4CBA, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7BEF, 0x0000, 0x4457, 0x4458, 0x4458, 0x4478, 0x4457, 0x0000, 0x3BF7, 0x0000, 0x0000, 0x52B5, 0x0000, 0x4458, 0x4478, 0x44BA, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4478, 0x4458, 0x0000,
-  0x0000, 0x4458, 0x4458, 0x4437, 0x4438, 0x4438, 0x4438, 0x4438, 0x4438, 0x4458, 0x4478, 0x4457, 0x03EF, 0x0000, 0x4457, 0x4458, 0x4458, 0x4479, 0x4437, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000, 0x3C37, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4437, 0x0000, 0x07FF,
-  0x0000, 0x4458, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x44BA, 0x4CBA, 0x4CBA, 0x4458, 0x4C9B, 0x0000, 0x4458, 0x4499, 0x4458, 0x4457, 0x4498, 0x4457, 0x445A, 0x4BF6, 0x4CD9, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07FF, 0x0000,
-  0x0000, 0x4458, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x001F, 0x4458, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x555F, 0x0000, 0x0000, 0x7BFF, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x7BFF, 0x0000, 0x0000,
-  0x0000, 0x3C57, 0x4458, 0x4437, 0x4437, 0x4438, 0x4458, 0x4457, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000, 0x4458, 0x4CFB, 0x4499, 0x4499, 0x44BA, 0x4CBA, 0x4CBA, 0x4CBA, 0x44BA, 0x4CBA, 0x4458, 0x4CD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4BF9, 0x4458, 0x4458, 0x4499, 0x4458, 0x0000, 0x001F, 0x4458, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4437, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x03EF, 0x3BF7, 0x3BF7, 0x555A, 0x34D9, 0x4458, 0x4499, 0x4478, 0x4458, 0x3CB8, 0x0000, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x5555, 0x0000, 0x4457, 0x4479, 0x4458, 0x4458, 0x4458, 0x0000, 0x52B5, 0x0000, 0x52B5, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x34D9, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x5555, 0x0000, 0x4437, 0x4478, 0x4458, 0x4478, 0x4458, 0x0000, 0x52B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x07FF, 0x0000, 0x4437, 0x4458, 0x4458, 0x4479, 0x4457, 0x0000, 0x5555, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x07FF, 0x5555, 0x3339, 0x4458, 0x4479, 0x4479, 0x4458, 0x4478, 0x53FA, 0x4B76, 0x34D9, 0x3BF7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7BEF, 0x0000, 0x4457, 0x4499, 0x4458, 0x4458, 0x4498, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4458, 0x4458, 0x4458, 0x4458, 0x4457, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x4457, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4458, 0x4CBA, 0x4458, 0x4458, 0x4479, 0x4CBA, 0x4CBA, 0x4CBA, 0x44BA, 0x4CBA, 0x4479, 0x4CD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4458, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x4458, 0x555F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x7BFF, 0x4BF9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4CD9, 0x4BF9, 0x4CDC, 0x001F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+const uint16_t SPRITE_ZZZ_EMOJI_48_SPAN_ROWS[] PROGMEM = {
+  0, 0, 1, 0, 21, 17, 28, 19, 48, 36, 74, 57, 85, 79, 113, 101,
+  139, 123, 152, 146, 183, 167, 199, 177, 225, 197, 244, 207, 263, 219, 281, 231,
+  301, 241, 321, 252, 339, 265, 358, 275, 390, 298, 408, 310, 445, 333, 475, 358,
+  517, 391, 547, 411, 585, 438, 610, 468, 645, 500, 701, 540, 726, 569, 774, 608,
+  798, 631, 843, 674, 868, 698, 894, 716, 909, 728, 937, 746, 952, 753, 966, 760,
+  980, 772, 991, 778, 1006, 789, 1019, 802, 1035, 815, 1049, 826, 1050, 826, 1062, 835
 };
 
-const uint8_t SPRITE_ZZZ_EMOJI_48_ALPHA[] PROGMEM = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x63, 0xE7, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xBD, 0x1B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x34, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x58, 0xFE, 0xF8, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFA, 0xFC, 0xAF, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x48, 0xFF, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x8E, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0A, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xED, 0x22, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x4A, 0x53, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x4E, 0xC5, 0xFF, 0xFD, 0xFF, 0xFE, 0xFD, 0xFF, 0x5A, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xF3, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xA9, 0x00, 0x02, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x1A, 0xDE, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xE4, 0x18, 0x01, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFE, 0xFB, 0xFC, 0x5A, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4B, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xA5, 0x03, 0x04, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x15, 0xDA, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xE7, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0x56, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4E, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xA9, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x16, 0xD9, 0xFE, 0xFD, 0xFF, 0xFE, 0xFF, 0xE4, 0x18, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFE, 0xFB, 0xFC, 0x5A, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4B, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xA5, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x15, 0xDA, 0xFE, 0xFD, 0xFF, 0xFE, 0xFE, 0xE7, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0xAC, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAC, 0x84, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFE, 0xFD, 0xFF, 0x56, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x01, 0x03, 0x00, 0x4E, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xA9, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7D, 0xF1, 0xEF, 0xF0, 0xF1, 0xF1, 0xED, 0xFB, 0xF9, 0xFD, 0xCB, 0x03, 0x00, 0x02, 0x02, 0x16, 0xD9, 0xFE, 0xFD, 0xFF, 0xFE, 0xFF, 0xE9, 0x1D, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x0B, 0x0B, 0x0E, 0x07, 0x83, 0xFF, 0xFB, 0xF5, 0x3A, 0x00, 0x03, 0x02, 0x00, 0x99, 0xFF, 0xFC, 0xFF, 0xFE, 0xFC, 0xF2, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xF6, 0xFC, 0xFF, 0x6D, 0x00, 0x01, 0x02, 0x00, 0x4C, 0xFE, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xF2, 0xAF, 0xAE, 0xAD, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0x68, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x1B, 0xE5, 0xFE, 0xFF, 0xA6, 0x00, 0x03, 0x02, 0x00, 0x14, 0xD8, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0xB5, 0xFF, 0xFF, 0xD5, 0x10, 0x01, 0x02, 0x04, 0x00, 0x4E, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF7, 0xFE, 0xAE, 0x00,
-  0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0xFF, 0xFC, 0xF2, 0x30, 0x00, 0x01, 0x00, 0x04, 0x00, 0x58, 0xFF, 0xF5, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF7, 0xFF, 0xAB, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x47, 0xFC, 0xFC, 0xFF, 0x65, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x32, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
-  0x00, 0x1A, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x53, 0x3A, 0x02, 0x01, 0x1E, 0xE0, 0xFF, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4C, 0xAD, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAD, 0x51, 0x00, 0x01,
-  0x00, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x07, 0x00, 0xB3, 0xFF, 0xFE, 0xD2, 0x17, 0x0B, 0x0B, 0x0A, 0x0A, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xF9, 0xF9, 0xED, 0x01, 0x6E, 0xFF, 0xF8, 0xFB, 0xF3, 0xEE, 0xF1, 0xF0, 0xEF, 0xF1, 0xC3, 0x03, 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00,
-  0x00, 0x1E, 0x53, 0x53, 0x53, 0x55, 0x4F, 0x92, 0xFF, 0xFA, 0xFF, 0x71, 0x00, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xCD, 0xFD, 0xFF, 0xA5, 0x00, 0x01, 0x5A, 0xAC, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA, 0xAC, 0x71, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x04, 0x04, 0x06, 0x05, 0xBD, 0xFF, 0xFF, 0xD7, 0x11, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xFF, 0xFB, 0xF6, 0x36, 0x00, 0x03, 0x00, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x48, 0xF9, 0xFB, 0xFF, 0x66, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x1B, 0xE4, 0xFF, 0xFF, 0x9D, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x03, 0x05, 0xB5, 0xFF, 0xFF, 0xD3, 0x12, 0x06, 0x07, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x7D, 0xFF, 0xFD, 0xE2, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x41, 0xF8, 0xFD, 0xFF, 0xE2, 0xA6, 0xAD, 0xAC, 0xAA, 0xAC, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xB2, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x89, 0xF4, 0xF2, 0xF5, 0xF4, 0xF1, 0xF1, 0xF1, 0xEE, 0xF1, 0xB5, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+const uint8_t SPRITE_ZZZ_EMOJI_48_SPAN_OPS[] PROGMEM = {
+  0xC0, 0x1B, 0x90, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xC0, 0x1A, 0x80, 0x02,
+  0x11, 0x80, 0x02, 0xC0, 0x1B, 0x90, 0x08, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0xC0,
+  0x18, 0x80, 0x01, 0x00, 0x93, 0x63, 0xE7, 0xF4, 0xF4, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF5, 0xBD,
+  0x1B, 0xC0, 0x17, 0x80, 0x03, 0x00, 0x81, 0x34, 0xFB, 0x51, 0x80, 0x94, 0xC0, 0x17, 0x80, 0x04, 0x00, 0x82, 0x58, 0xFE, 0xF8, 0x40, 0x90, 0xFE,
+  0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFA, 0xFC, 0xAF, 0xC0, 0x17, 0x80, 0x04, 0x00, 0x80, 0x48, 0x40,
+  0x8A, 0xF9, 0xF9, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFD, 0x44, 0x80, 0xFC, 0x40, 0x80, 0x8E, 0xC0, 0x17, 0x83, 0x01, 0x01, 0x0A,
+  0xA4, 0x4E, 0x83, 0xFE, 0xFE, 0xED, 0x22, 0xC0, 0x18, 0x80, 0x01, 0x00, 0x8B, 0x06, 0x4A, 0x53, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x4E,
+  0xC5, 0x40, 0x80, 0xFD, 0x40, 0x81, 0xFE, 0xFD, 0x40, 0x80, 0x5A, 0x00, 0x80, 0x03, 0xC0, 0x24, 0x82, 0x3C, 0xF3, 0xFE, 0x41, 0x80, 0xFC, 0x40,
+  0x80, 0xA9, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x1A, 0x8A, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x1A, 0xDE, 0x40, 0x80, 0xFD, 0x40,
+  0x80, 0xFE, 0x40, 0x83, 0xE4, 0x18, 0x01, 0x01, 0xC0, 0x21, 0x80, 0x03, 0x00, 0x80, 0x99, 0x40, 0x80, 0xFC, 0x40, 0x83, 0xFE, 0xFB, 0xFC, 0x5A,
+  0x00, 0x80, 0x03, 0xC0, 0x20, 0x80, 0x02, 0x00, 0x80, 0x4B, 0x40, 0x80, 0xFD, 0x41, 0x80, 0xFC, 0x40, 0x83, 0xA5, 0x03, 0x04, 0x01, 0xC0, 0x1F,
+  0x85, 0x02, 0x01, 0x15, 0xDA, 0xFE, 0xFD, 0x40, 0x83, 0xFE, 0xFE, 0xE7, 0x1B, 0x00, 0x80, 0x01, 0xC0, 0x1F, 0x80, 0x02, 0x00, 0x80, 0x99, 0x40,
+  0x80, 0xFC, 0x40, 0x81, 0xFE, 0xFD, 0x40, 0x80, 0x56, 0x00, 0x80, 0x03, 0xC0, 0x1E, 0x80, 0x03, 0x00, 0x80, 0x4E, 0x40, 0x80, 0xFD, 0x41, 0x80,
+  0xFC, 0x40, 0x80, 0xA9, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x1D, 0x85, 0x02, 0x02, 0x16, 0xD9, 0xFE, 0xFD, 0x40, 0x80, 0xFE, 0x40, 0x83, 0xE4, 0x18,
+  0x01, 0x01, 0xC0, 0x1D, 0x80, 0x03, 0x00, 0x80, 0x99, 0x40, 0x80, 0xFC, 0x40, 0x83, 0xFE, 0xFB, 0xFC, 0x5A, 0x00, 0x80, 0x03, 0xC0, 0x0C, 0x8A,
+  0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x80, 0x02, 0x00, 0x80, 0x4B, 0x40, 0x80, 0xFD, 0x41, 0x80, 0xFC, 0x40,
+  0x83, 0xA5, 0x03, 0x04, 0x01, 0xC0, 0x1B, 0x85, 0x02, 0x01, 0x15, 0xDA, 0xFE, 0xFD, 0x40, 0x83, 0xFE, 0xFE, 0xE7, 0x1B, 0x00, 0x80, 0x01, 0xC0,
+  0x0A, 0x80, 0x02, 0x00, 0x8B, 0x46, 0xAC, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAB, 0xAC, 0x84, 0x01, 0x02, 0x80, 0x02, 0x00, 0x80, 0x99, 0x40,
+  0x80, 0xFC, 0x40, 0x81, 0xFE, 0xFD, 0x40, 0x80, 0x56, 0x00, 0x80, 0x03, 0xC0, 0x0A, 0x80, 0x05, 0x00, 0x80, 0xB7, 0x49, 0x80, 0x0B, 0x00, 0x81,
+  0x01, 0x03, 0x00, 0x80, 0x4E, 0x40, 0x80, 0xFD, 0x41, 0x80, 0xFC, 0x40, 0x80, 0xA9, 0x00, 0x81, 0x02, 0x01, 0xC0, 0x0A, 0x80, 0x04, 0x00, 0x8B,
+  0x7D, 0xF1, 0xEF, 0xF0, 0xF1, 0xF1, 0xED, 0xFB, 0xF9, 0xFD, 0xCB, 0x03, 0x00, 0x85, 0x02, 0x02, 0x16, 0xD9, 0xFE, 0xFD, 0x40, 0x80, 0xFE, 0x40,
+  0x8A, 0xE9, 0x1D, 0x06, 0x06, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0xC0, 0x0D, 0x85, 0x0A, 0x0B, 0x0B, 0x0E, 0x07, 0x83, 0x40, 0x82, 0xFB,
+  0xF5, 0x3A, 0x00, 0x81, 0x03, 0x02, 0x00, 0x80, 0x99, 0x40, 0x80, 0xFC, 0x40, 0x83, 0xFE, 0xFC, 0xF2, 0x45, 0xC0, 0x11, 0x82, 0x45, 0xF6, 0xFC,
+  0x40, 0x80, 0x6D, 0x00, 0x81, 0x01, 0x02, 0x00, 0x82, 0x4C, 0xFE, 0xFD, 0x41, 0x80, 0xFE, 0x40, 0x8B, 0xF2, 0xAF, 0xAE, 0xAD, 0xAC, 0xAC, 0xAC,
+  0xAC, 0xAC, 0xAC, 0xAD, 0x68, 0x00, 0x80, 0x01, 0xC0, 0x0E, 0x84, 0x02, 0x01, 0x1B, 0xE5, 0xFE, 0x40, 0x80, 0xA6, 0x00, 0x81, 0x03, 0x02, 0x00,
+  0x81, 0x14, 0xD8, 0x40, 0x80, 0xFD, 0x4F, 0x80, 0x66, 0xC0, 0x0D, 0x83, 0x01, 0x03, 0x04, 0xB5, 0x41, 0x84, 0xD5, 0x10, 0x01, 0x02, 0x04, 0x00,
+  0x80, 0x4E, 0x40, 0x80, 0xFB, 0x44, 0x8C, 0xFE, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xF7, 0xFE, 0xAE, 0xC0, 0x00, 0x8A, 0x02,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x01, 0x80, 0x03, 0x00, 0x80, 0x80, 0x40, 0x82, 0xFC, 0xF2, 0x30, 0x00, 0x80, 0x01,
+  0x00, 0x80, 0x04, 0x00, 0x80, 0x58, 0x40, 0x90, 0xF5, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+  0xF7, 0x40, 0x80, 0xAB, 0xC0, 0x0C, 0x80, 0x02, 0x00, 0x82, 0x47, 0xFC, 0xFC, 0x40, 0x80, 0x65, 0x00, 0x80, 0x04, 0x01, 0x80, 0x03, 0x00, 0x81,
+  0x32, 0xF1, 0x51, 0x80, 0x4F, 0xC0, 0x00, 0x8E, 0x1A, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x52, 0x53, 0x3A, 0x02, 0x01, 0x1E, 0xE0, 0x41,
+  0x80, 0x98, 0x05, 0x80, 0x01, 0x00, 0x92, 0x4C, 0xAD, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+  0xAD, 0x51, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x80, 0x9E, 0x48, 0x81, 0xF7, 0x07, 0x00, 0x80, 0xB3, 0x40, 0x87, 0xFE, 0xD2, 0x17, 0x0B, 0x0B, 0x0A,
+  0x0A, 0x03, 0x15, 0x80, 0x01, 0xC0, 0x00, 0x80, 0xA3, 0x45, 0x85, 0xFA, 0xF9, 0xF9, 0xED, 0x01, 0x6E, 0x40, 0x89, 0xF8, 0xFB, 0xF3, 0xEE, 0xF1,
+  0xF0, 0xEF, 0xF1, 0xC3, 0x03, 0x01, 0x92, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x02, 0xC0, 0x00, 0x86, 0x1E, 0x53, 0x53, 0x53, 0x55, 0x4F, 0x92, 0x40, 0x80, 0xFA, 0x40, 0x80, 0x71, 0x00, 0x80, 0xBE, 0x49, 0x80, 0x0A,
+  0x00, 0x80, 0x01, 0xC0, 0x05, 0x82, 0x0A, 0xCD, 0xFD, 0x40, 0x80, 0xA5, 0x00, 0x8B, 0x01, 0x5A, 0xAC, 0xAB, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAA,
+  0xAC, 0x71, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x85, 0x02, 0x04, 0x04, 0x06, 0x05, 0xBD, 0x41, 0x83, 0xD7, 0x11, 0x01, 0x01, 0xC0, 0x02, 0x80, 0x03,
+  0x00, 0x80, 0x7F, 0x40, 0x82, 0xFB, 0xF6, 0x36, 0x00, 0x80, 0x03, 0x00, 0x8A, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03,
+  0xC0, 0x01, 0x80, 0x03, 0x00, 0x82, 0x48, 0xF9, 0xFB, 0x40, 0x80, 0x66, 0x00, 0x80, 0x03, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x81, 0x1B, 0xE4, 0x41,
+  0x80, 0x9D, 0x00, 0x80, 0x03, 0xC0, 0x83, 0x01, 0x03, 0x05, 0xB5, 0x41, 0x85, 0xD3, 0x12, 0x06, 0x07, 0x05, 0x04, 0xC0, 0x80, 0x02, 0x00, 0x80,
+  0x7D, 0x40, 0x82, 0xFD, 0xE2, 0x1A, 0xC0, 0x00, 0x82, 0x41, 0xF8, 0xFD, 0x40, 0x86, 0xE2, 0xA6, 0xAD, 0xAC, 0xAA, 0xAC, 0x7D, 0xC0, 0x00, 0x80,
+  0xB2, 0x40, 0x80, 0xFE, 0x47, 0x80, 0x0A, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x8C, 0x89, 0xF4, 0xF2, 0xF5, 0xF4, 0xF1, 0xF1, 0xF1, 0xEE, 0xF1, 0xB5,
+  0x03, 0x01, 0xC0, 0x00, 0x8A, 0x02, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x01, 0xC0, 0xC0, 0x01, 0x88, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0xC0, 0xC0
 };
 
-// Asset g�n�rique r�utilisable depuis le syst�me de spawnSprite()
+const uint16_t SPRITE_ZZZ_EMOJI_48_SPAN_PX[] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x1988, 0x3BD5, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17,
+  0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3332, 0x0062, 0x0000, 0x08E5, 0x3C37, 0x4478, 0x4458, 0x4458, 0x4458,
+  0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4CBA, 0x228E, 0x0000,
+  0x1168, 0x44BA, 0x3BF7, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458,
+  0x4458, 0x4458, 0x3C17, 0x4499, 0x2AF0, 0x0000, 0x0926, 0x4499, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17,
+  0x3C17, 0x3C17, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x226D, 0x0000, 0x0000, 0x0000, 0x2ACF, 0x449A,
+  0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x44BA, 0x4CBA, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4478,
+  0x3BF6, 0x0883, 0x0000, 0x0000, 0x1126, 0x1147, 0x1147, 0x1147, 0x1147, 0x1147, 0x1147, 0x1147, 0x1167, 0x1147, 0x3331, 0x4478,
+  0x4458, 0x4458, 0x4458, 0x4458, 0x4478, 0x1168, 0x0000, 0x0905, 0x3BF6, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x2AAF, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x3BB5, 0x4479, 0x4458, 0x4458, 0x4458,
+  0x4478, 0x3BD5, 0x0062, 0x0000, 0x0000, 0x0000, 0x228D, 0x4499, 0x4458, 0x4458, 0x4458, 0x3C17, 0x4479, 0x1168, 0x0000, 0x0000,
+  0x1126, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x2ACF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x3394, 0x4478,
+  0x4458, 0x4458, 0x4458, 0x4478, 0x3BD5, 0x0062, 0x0000, 0x0000, 0x226D, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x1168,
+  0x0000, 0x0000, 0x1147, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x2AAF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x3394,
+  0x4478, 0x4458, 0x4458, 0x4458, 0x4478, 0x3BD5, 0x0062, 0x0000, 0x0000, 0x0000, 0x228D, 0x4499, 0x4458, 0x4458, 0x4458, 0x3C17,
+  0x4479, 0x1168, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1126,
+  0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x2ACF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x3394, 0x4478, 0x4458,
+  0x4458, 0x4458, 0x4478, 0x3BD5, 0x0062, 0x0000, 0x0000, 0x1126, 0x2AF0, 0x2ACF, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2ACF,
+  0x2B11, 0x224C, 0x0000, 0x0000, 0x226D, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x4479, 0x1168, 0x0000, 0x0020, 0x2B11, 0x4CFC,
+  0x4499, 0x4CBA, 0x44BA, 0x4CBA, 0x4CBA, 0x4499, 0x4499, 0x44BA, 0x4478, 0x0020, 0x0000, 0x0000, 0x1147, 0x4458, 0x4458, 0x4458,
+  0x4458, 0x4458, 0x4499, 0x2AAF, 0x0000, 0x0000, 0x0000, 0x222C, 0x3C17, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3C17, 0x3C16,
+  0x4478, 0x3352, 0x0000, 0x0000, 0x0000, 0x0062, 0x3394, 0x4478, 0x4458, 0x4458, 0x4458, 0x4479, 0x3BD5, 0x0083, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0021, 0x0000, 0x222B, 0x4478, 0x3C17, 0x3C37,
+  0x08E5, 0x0000, 0x0000, 0x228D, 0x4499, 0x4458, 0x4458, 0x4458, 0x4458, 0x3C37, 0x1126, 0x1126, 0x3C38, 0x4458, 0x4479, 0x19CA,
+  0x0000, 0x0000, 0x1147, 0x4478, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x3BF6, 0x2AF0, 0x2AEF, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0,
+  0x2AF0, 0x2AF0, 0x2AF0, 0x2B10, 0x19A9, 0x0000, 0x0000, 0x0000, 0x0062, 0x3BD5, 0x4458, 0x4499, 0x2ACF, 0x0000, 0x0000, 0x0062,
+  0x3373, 0x4479, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499,
+  0x4499, 0x4499, 0x4499, 0x19A9, 0x0000, 0x0000, 0x0000, 0x2B11, 0x4479, 0x4478, 0x3394, 0x0041, 0x0000, 0x0000, 0x0000, 0x1147,
+  0x4499, 0x3C17, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x4458, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17,
+  0x3C17, 0x3C17, 0x4499, 0x2AF0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x222C, 0x4499, 0x4458, 0x3BF6, 0x08C4, 0x0000, 0x0000, 0x1168, 0x4CBA, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17,
+  0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x3C17, 0x4499, 0x2ACF, 0x0000, 0x1126, 0x4458, 0x4458,
+  0x4478, 0x19A9, 0x0000, 0x0000, 0x08C4, 0x3C16, 0x44BA, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499,
+  0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x4478, 0x1147, 0x0062, 0x1147, 0x1147, 0x1147, 0x1147, 0x1147, 0x1147,
+  0x1147, 0x1147, 0x1147, 0x08E5, 0x0000, 0x0000, 0x0882, 0x3BB5, 0x4458, 0x4479, 0x226D, 0x0000, 0x1147, 0x2AF0, 0x2ACF, 0x2AF0,
+  0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x1147, 0x0000,
+  0x2AAF, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4499, 0x44BA, 0x4CBA, 0x4CBA, 0x3C17, 0x0020, 0x2AF0, 0x4499, 0x4458, 0x3372,
+  0x0062, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x2AAF, 0x4CDB, 0x4499, 0x4499, 0x4499, 0x4499, 0x4478, 0x3C17, 0x3C17,
+  0x3C17, 0x3BF6, 0x0000, 0x19CA, 0x4478, 0x3C17, 0x3C17, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3C16, 0x3332, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0000, 0x0082, 0x1147, 0x1147, 0x1147, 0x1168, 0x1147, 0x226C, 0x4458, 0x3C17, 0x4499, 0x19CA, 0x3332, 0x4CFB, 0x4499,
+  0x4499, 0x44BA, 0x4CBA, 0x4CBA, 0x4CBA, 0x44BA, 0x4CBA, 0x4458, 0x0020, 0x0000, 0x0000, 0x3373, 0x4458, 0x4499, 0x2ACF, 0x0000,
+  0x1168, 0x2B11, 0x2ACF, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2AF0, 0x2ACF, 0x2B11, 0x19CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+  0x0020, 0x3332, 0x4499, 0x4478, 0x3394, 0x0041, 0x0000, 0x0000, 0x0000, 0x222B, 0x4479, 0x3C17, 0x3C17, 0x08E5, 0x0000, 0x0000,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1126, 0x3C37, 0x3C17, 0x4478, 0x19A9,
+  0x0000, 0x0000, 0x0062, 0x3BD5, 0x4458, 0x4479, 0x2AAE, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B11, 0x4479, 0x4479, 0x3373, 0x0041,
+  0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x222B, 0x4499, 0x4458, 0x3BB5, 0x0062, 0x1106, 0x3C17, 0x4458, 0x4458, 0x3BB4, 0x2ACF,
+  0x2AF0, 0x2AF0, 0x2ACF, 0x2B11, 0x222B, 0x2AF0, 0x4CBA, 0x4458, 0x4458, 0x4479, 0x4CBA, 0x4CBA, 0x4CBA, 0x44BA, 0x4CBA, 0x4479,
+  0x0020, 0x0000, 0x224C, 0x3C58, 0x3BF6, 0x3C17, 0x3C17, 0x3BF6, 0x3BF6, 0x3BF6, 0x3BF6, 0x3C16, 0x2B11, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000
+};
+
+inline constexpr SpriteSpans SPRITE_ZZZ_EMOJI_48_SPANS = {
+  SPRITE_ZZZ_EMOJI_48_SPAN_ROWS, SPRITE_ZZZ_EMOJI_48_SPAN_OPS, SPRITE_ZZZ_EMOJI_48_SPAN_PX
+};
+
+// Asset générique réutilisable depuis le système de spawnSprite()
 inline constexpr SpriteAsset SPRITE_ZZZ_EMOJI_48_ASSET = {
   SPRITE_ZZZ_EMOJI_48_WIDTH, SPRITE_ZZZ_EMOJI_48_HEIGHT,
-  SPRITE_ZZZ_EMOJI_48_ALPHA, SPRITE_ZZZ_EMOJI_48_RGB565
+  nullptr, nullptr, &SPRITE_ZZZ_EMOJI_48_SPANS
 };
 
 #endif // SPRITE_ZZZ_EMOJI_48_INCLUDED
@@ -1,12 +1,49 @@
 #include "init_model.h"
 
 #include "../lvgl/gotchi_lvgl.h"
+#include "../audio/gotchi_audio.h"
 #include "../face/behavior/behavior_engine.h"
 #include "common/managers/nfc/nfc_manager.h"
 
 // Dernier variant détecté (pour gérer le retrait selon le type)
 static uint8_t s_lastVariant = 0;
 
+// Applique un tag NFC au behavior engine (exécuté dans la tâche de rendu)
+static void applyNfcTag(uint8_t variant) {
+  switch (variant) {
+    // --- Nourriture (1-4) ---
+    case 1: Serial.println("[NFC] Tag → feed bottle");     BehaviorEngine::feed("bottle"); break;
+    case 2: Serial.println("[NFC] Tag → feed cake");       BehaviorEngine::feed("cake");   break;
+    case 3: Serial.println("[NFC] Tag → feed apple");      BehaviorEngine::feed("apple");  break;
+    case 4: Serial.println("[NFC] Tag → feed candy");      BehaviorEngine::feed("candy");  break;
+    // --- Actions (5-8) ---
+    case 5: Serial.println("[NFC] Tag → thermometre");     BehaviorEngine::startThermometer(); break;
+    case 6: Serial.println("[NFC] Tag → medicament");      BehaviorEngine::giveMedicine();     break;
+    case 7: Serial.println("[NFC] Tag → nettoyage");       BehaviorEngine::clean();            break;
+    case 8: Serial.println("[NFC] Tag → jeu");             BehaviorEngine::tryPlay();          break;
+    case 9:  Serial.println("[NFC] Tag → dodo");            BehaviorEngine::sleep();            break;
+    case 10: Serial.println("[NFC] Tag → livre");           BehaviorEngine::readBook();          break;
+    default: break;
+  }
+}
+
+// Retrait du tag : stoppe l'action en cours (exécuté dans la tâche de rendu)
+static void applyNfcRemoved(uint8_t variant) {
+  switch (variant) {
+    case 1: // bottle — retrait du biberon
+      BehaviorEngine::stopFeeding();
+      Serial.println("[NFC] Tag retire → stop feed");
+      break;
+    case 5: // thermomètre — retrait
+      BehaviorEngine::stopThermometer();
+      Serial.println("[NFC] Tag retire → stop thermometre");
+      break;
+    default:
+      Serial.println("[NFC] Tag retire");
+      break;
+  }
+}
+
 // Callback NFC : pause le scan, lit le bloc 4 sans contention, reprend le scan
 static void onNFCTag(uint8_t* uid, uint8_t uidLength, uint8_t* blockData, bool blockValid) {
   // Pause du scan pour éviter la contention I2C pendant readBlock
@@ -25,30 +62,24 @@ static void onNFCTag(uint8_t* uid, uint8_t uidLength, uint8_t* blockData, bool b
   }
 
   uint8_t variant = data[0];
+  if (variant < 1 || variant > 10) {
+    Serial.printf("[NFC] Variant inconnu: %d\n", variant);
+    s_lastVariant = 0;
+    return;
+  }
   s_lastVariant = variant;
 
-  switch (variant) {
-    // --- Nourriture (1-4) ---
-    case 1: Serial.println("[NFC] Tag → feed bottle");     BehaviorEngine::feed("bottle"); break;
-    case 2: Serial.println("[NFC] Tag → feed cake");       BehaviorEngine::feed("cake");   break;
-    case 3: Serial.println("[NFC] Tag → feed apple");      BehaviorEngine::feed("apple");  break;
-    case 4: Serial.println("[NFC] Tag → feed candy");      BehaviorEngine::feed("candy");  break;
-    // --- Actions (5-8) ---
-    case 5: Serial.println("[NFC] Tag → thermometre");     BehaviorEngine::startThermometer(); break;
-    case 6: Serial.println("[NFC] Tag → medicament");      BehaviorEngine::giveMedicine();     break;
-    case 7: Serial.println("[NFC] Tag → nettoyage");       BehaviorEngine::clean();            break;
-    case 8: Serial.println("[NFC] Tag → jeu");             BehaviorEngine::tryPlay();          break;
-    case 9:  Serial.println("[NFC] Tag → dodo");            BehaviorEngine::sleep();            break;
-    case 10: Serial.println("[NFC] Tag → livre");           BehaviorEngine::readBook();          break;
-    default:
-      Serial.printf("[NFC] Variant inconnu: %d\n", variant);
-      s_lastVariant = 0;
-      return;
-  }
+  // Le rendu tourne dans sa propre tâche : on lui poste l'événement
+  GotchiLvgl::post(applyNfcTag, variant);
 }
 
 bool InitModelGotchi::init() {
-  return GotchiLvgl::init();
+  if (!GotchiLvgl::init()) return false;
+  // Audio non bloquant : un échec laisse le Gotchi muet mais fonctionnel
+  if (!GotchiAudio::init()) {
+    Serial.println("[GOTCHI] Moteur audio indisponible");
+  }
+  return true;
 }
 
 bool InitModelGotchi::configure() {
@@ -73,19 +104,7 @@ void InitModelGotchi::update() {
   static bool wasTagPresent = false;
   bool tagNow = NFCManager::isTagPresent();
   if (wasTagPresent && !tagNow) {
-    switch (s_lastVariant) {
-      case 1: // bottle — retrait du biberon
-        BehaviorEngine::stopFeeding();
-        Serial.println("[NFC] Tag retire → stop feed");
-        break;
-      case 5: // thermomètre — retrait
-        BehaviorEngine::stopThermometer();
-        Serial.println("[NFC] Tag retire → stop thermometre");
-        break;
-      default:
-        Serial.println("[NFC] Tag retire");
-        break;
-    }
+    GotchiLvgl::post(applyNfcRemoved, s_lastVariant);
     s_lastVariant = 0;
   }
   wasTagPresent = tagNow;
@@ -19,12 +19,18 @@
  * Formule de rotation (W = H = 466, ecran carre) :
  *   logique (lx, ly) -> physique (W-1-ly, lx)
  *
- * Buffer de rotation : alloue lazy en PSRAM, max ~230 KB pour le push
- * frame face_renderer (426x270x2 bytes).
+ * Buffer de rotation : alloue lazy en PSRAM, max ~341 KB pour le push
+ * frame complet du face_renderer (426x410x2 bytes, a l'init).
+ *
+ * Verrou bus : le face renderer pousse ses frames depuis une tache dediee.
+ * Toute transaction (startWrite..endWrite, draw16bitRGBBitmap) prend un mutex
+ * recursif, ce qui serialise les acces au bus QSPI et au buffer de rotation.
  */
 
 #include <Arduino_GFX_Library.h>
 #include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -32,6 +38,25 @@ class Arduino_CO5300_SwRot90 : public Arduino_CO5300 {
 public:
   using Arduino_CO5300::Arduino_CO5300;
 
+  // Verrou exclusif du bus (recursif : imbriquable par le meme thread)
+  void lockBus() {
+    if (busLock) xSemaphoreTakeRecursive(busLock, portMAX_DELAY);
+  }
+
+  void unlockBus() {
+    if (busLock) xSemaphoreGiveRecursive(busLock);
+  }
+
+  void startWrite() override {
+    lockBus();
+    Arduino_CO5300::startWrite();
+  }
+
+  void endWrite() override {
+    Arduino_CO5300::endWrite();
+    unlockBus();
+  }
+
   void writePixelPreclipped(int16_t lx, int16_t ly, uint16_t color) override {
     Arduino_CO5300::writePixelPreclipped(W - 1 - ly, lx, color);
   }
@@ -55,8 +80,12 @@ public:
 
   void draw16bitRGBBitmap(int16_t lx, int16_t ly, uint16_t *bitmap, int16_t w, int16_t h) override {
     if (!bitmap || w <= 0 || h <= 0) return;
+    lockBus();
     ensureRotBuf((size_t)w * (size_t)h);
-    if (!rotBuf) return;
+    if (!rotBuf) {
+      unlockBus();
+      return;
+    }
 
     // Rotation 90° CW : src(i, j) -> dest(h-1-j, i)
     // dest stocke h colonnes x w lignes en row-major (stride = h)
@@ -71,6 +100,7 @@ public:
     int16_t px = W - ly - h;
     int16_t py = lx;
     Arduino_CO5300::draw16bitRGBBitmap(px, py, rotBuf, h, w);
+    unlockBus();
   }
 
   void draw16bitRGBBitmap(int16_t lx, int16_t ly, const uint16_t bitmap[], int16_t w, int16_t h) override {
@@ -81,6 +111,8 @@ public:
 private:
   static constexpr int16_t W = 466;  // GOTCHI_LCD_WIDTH = HEIGHT (ecran carre)
 
+  SemaphoreHandle_t busLock = xSemaphoreCreateRecursiveMutex();
+
   uint16_t *rotBuf = nullptr;
   size_t    rotBufPixels = 0;
 
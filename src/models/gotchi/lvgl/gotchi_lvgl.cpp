@@ -2,6 +2,7 @@
 
 #include "../config/config.h"
 #include "../face/face_engine.h"
+#include "../face/face_renderer.h"
 #include "../face/overlay/face_overlay_layer.h"
 #include "../face/behavior/behavior_engine.h"
 #include "../face/behavior/dirt_overlay.h"
@@ -18,6 +19,11 @@
 #include <Wire.h>
 #include <esp_heap_caps.h>
 #include <lvgl.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "common/config/core_config.h"
 
 #include "touch/TouchDrvCST92xx.h"
 #include "arduino_co5300_swrot90.h"
@@ -26,6 +32,14 @@
 static Arduino_GFX *s_gfx = nullptr;
 Arduino_GFX* getGotchiGfx() { return s_gfx; }
 
+// Verrou du bus ecran, pour enchainer plusieurs transferts sans entrelacement
+void lockGotchiGfx() {
+  if (s_gfx) static_cast<Arduino_CO5300_SwRot90 *>(s_gfx)->lockBus();
+}
+void unlockGotchiGfx() {
+  if (s_gfx) static_cast<Arduino_CO5300_SwRot90 *>(s_gfx)->unlockBus();
+}
+
 namespace {
 
 Arduino_ESP32QSPI *s_bus = nullptr;
@@ -35,6 +49,18 @@ bool s_lvgl_ok = false;
 
 static constexpr uint8_t kTouchI2cAddr = CST92XX_SLAVE_ADDRESS;
 
+// --- Tâche de rendu ---
+struct RenderEvent {
+  void (*fn)(uint8_t);
+  uint8_t arg;
+};
+static constexpr UBaseType_t EVENT_QUEUE_SIZE = 8;
+QueueHandle_t s_eventQueue = nullptr;
+SemaphoreHandle_t s_frameMutex = nullptr;  // récursif : une commande Serial peut s'imbriquer
+TaskHandle_t s_renderTask = nullptr;
+volatile uint16_t s_targetFps = GOTCHI_TARGET_FPS;
+GotchiLvgl::FrameStats s_frameStats = {};
+
 // ============================================
 // LVGL 9 : Tick callback (remplace esp_timer + lv_tick_inc)
 // ============================================
@@ -62,6 +88,8 @@ void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
   const uint32_t w = lv_area_get_width(area);
   const uint32_t h = lv_area_get_height(area);
   s_gfx->draw16bitRGBBitmap(area->x1, area->y1, reinterpret_cast<uint16_t *>(px_map), w, h);
+  // LVGL a pu recouvrir la zone du visage : le face renderer devra la renvoyer
+  FaceRenderer::invalidateRect(area->x1, area->y1, w, h);
   lv_display_flush_ready(disp);
 }
 
@@ -100,6 +128,8 @@ void touchpad_read(lv_indev_t *drv, lv_indev_data_t *data) {
 
 namespace GotchiLvgl {
 
+static bool startRenderTask();
+
 bool init() {
   if (s_lvgl_ok) return true;
 
@@ -171,8 +201,17 @@ bool init() {
   GotchiBattery::init();
   ViewManager::init(s_gfx);
 
+  s_eventQueue = xQueueCreate(EVENT_QUEUE_SIZE, sizeof(RenderEvent));
+  s_frameMutex = xSemaphoreCreateRecursiveMutex();
+
   s_lvgl_ok = true;
   Serial.println("[GOTCHI_LVGL] Initialisation LVGL 9 complète");
+
+  if (s_eventQueue && s_frameMutex) {
+    startRenderTask();
+  } else {
+    Serial.println("[GOTCHI_LVGL] ERREUR: file/mutex rendu, rendu dans loop()");
+  }
   return true;
 }
 
@@ -206,7 +245,9 @@ constexpr uint32_t RELEASE_CONFIRM = 250;
 bool     s_pageSwipeConsumed = false;  // swipe page deja declenche ce touch
 constexpr int16_t PAGE_SWIPE_THRESH = 60;  // px pour declencher un changement de page
 
-void update() {
+// Une frame complète : touch, view active (behaviors, face engine, LVGL, flush), haptique.
+// Appelée sous s_frameMutex.
+static void stepFrame() {
   if (s_lvgl_ok) {
     static uint32_t lastMs = 0;
     uint32_t now = millis();
@@ -378,11 +419,129 @@ void update() {
 
     // Haptique : auto-stop des pulsations non-bloquantes
     GotchiHaptic::update();
+  }
+}
 
-    vTaskDelay(1);
+// Événements postés depuis les autres contextes (NFC, ...)
+static void drainEvents() {
+  if (!s_eventQueue) return;
+  RenderEvent ev;
+  while (xQueueReceive(s_eventQueue, &ev, 0) == pdTRUE) {
+    if (ev.fn) ev.fn(ev.arg);
   }
 }
 
+// Temps passé par la tâche de rendu dans le flush : attente du transfert
+// précédent en async, transfert complet en sync.
+static uint64_t flushTimeOnRenderThread() {
+  const auto& fs = FaceRenderer::getFlushStats();
+  return FaceRenderer::isAsyncFlush() ? fs.totalWaitUs : fs.totalFlushUs;
+}
+
+static void runFrame() {
+  lockFrame();
+  const uint64_t flushBefore = flushTimeOnRenderThread();
+  const uint32_t t0 = micros();
+  drainEvents();
+  stepFrame();
+  const uint32_t frameUs = micros() - t0;
+  const uint64_t flushAfter = flushTimeOnRenderThread();
+  unlockFrame();
+
+  uint32_t flushUs = (flushAfter >= flushBefore) ? (uint32_t)(flushAfter - flushBefore) : 0;
+  if (flushUs > frameUs) flushUs = frameUs;
+  s_frameStats.frames++;
+  s_frameStats.lastFlushUs = flushUs;
+  s_frameStats.lastRenderUs = frameUs - flushUs;
+  s_frameStats.totalFlushUs += flushUs;
+  s_frameStats.totalRenderUs += frameUs - flushUs;
+  if (frameUs > s_frameStats.maxFrameUs) s_frameStats.maxFrameUs = frameUs;
+}
+
+// Cadence fixe : une frame toutes les 1/fps. Une frame en retard est comptée
+// et la cadence repart de maintenant (pas de rafale de rattrapage).
+static void renderTask(void* /*param*/) {
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;) {
+    runFrame();
+
+    TickType_t period = pdMS_TO_TICKS(1000 / s_targetFps);
+    if (period == 0) period = 1;
+    TickType_t now = xTaskGetTickCount();
+    if ((TickType_t)(now - lastWake) >= period) {
+      s_frameStats.missedDeadlines++;
+      lastWake = now;
+      vTaskDelay(1);  // laisser respirer loop() et les tâches plus basses
+    } else {
+      vTaskDelayUntil(&lastWake, period);
+    }
+  }
+}
+
+static bool startRenderTask() {
+  if (s_renderTask) return true;
+  BaseType_t result = xTaskCreatePinnedToCore(
+    renderTask, "GotchiRender", STACK_SIZE_RENDER, nullptr,
+    PRIORITY_RENDER, &s_renderTask, CORE_RENDER);
+  if (result != pdPASS) {
+    Serial.println("[GOTCHI_LVGL] ERREUR: creation tache rendu echouee, rendu dans loop()");
+    s_renderTask = nullptr;
+    return false;
+  }
+  Serial.printf("[GOTCHI_LVGL] Tache rendu demarree (Core %d, P%d, %u fps)\n",
+    CORE_RENDER, PRIORITY_RENDER, (unsigned)s_targetFps);
+  return true;
+}
+
+void update() {
+  if (s_renderTask || !s_lvgl_ok) return;
+  runFrame();
+  vTaskDelay(1);
+}
+
+bool post(void (*fn)(uint8_t), uint8_t arg) {
+  if (!s_eventQueue) {
+    // Pas encore initialisé : exécution directe (même contexte que le rendu)
+    if (fn) fn(arg);
+    return true;
+  }
+  RenderEvent ev = {fn, arg};
+  if (xQueueSend(s_eventQueue, &ev, 0) != pdTRUE) {
+    s_frameStats.droppedEvents++;
+    Serial.println("[GOTCHI_LVGL] File d'evenements pleine, evenement ignore");
+    return false;
+  }
+  return true;
+}
+
+void lockFrame() {
+  if (s_frameMutex) xSemaphoreTakeRecursive(s_frameMutex, portMAX_DELAY);
+}
+
+void unlockFrame() {
+  if (s_frameMutex) xSemaphoreGiveRecursive(s_frameMutex);
+}
+
+void setTargetFps(uint16_t fps) {
+  if (fps < 1) fps = 1;
+  if (fps > 60) fps = 60;
+  s_targetFps = fps;
+}
+
+uint16_t getTargetFps() { return s_targetFps; }
+bool isRenderTaskRunning() { return s_renderTask != nullptr; }
+const FrameStats& getFrameStats() { return s_frameStats; }
+
+// Les stats sont écrites par la tâche de rendu (hors du verrou de frame) :
+// la remise à zéro passe par elle
+static void clearFrameStats(uint8_t) {
+  s_frameStats = {};
+}
+
+bool resetFrameStats() {
+  return post(clearFrameStats);
+}
+
 void testDisplay() {
   if (!s_lvgl_ok) {
     Serial.println("[GOTCHI_LVGL] Écran non initialisé");
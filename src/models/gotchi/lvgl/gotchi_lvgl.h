@@ -5,13 +5,49 @@
 
 /**
  * LVGL + Arduino_GFX (CO5300 QSPI) + touch CST92xx (SensorLib), Gotchi / Waveshare 1.75".
+ *
+ * Le rendu (touch, behaviors, face engine, LVGL, flush) tourne dans une tâche
+ * dédiée "GotchiRender" (CORE_RENDER) à cadence fixe, indépendante de loop().
+ * Les autres contextes ne touchent pas l'état du rendu directement :
+ * - événements ponctuels (NFC...) : post(), exécutés au début de la frame suivante
+ * - commandes synchrones (Serial) : FrameLock, attend la fin de la frame en cours
  */
 namespace GotchiLvgl {
 
+struct FrameStats {
+  uint32_t frames;
+  uint32_t missedDeadlines;  // frames qui ont dépassé leur budget (1/fps)
+  uint32_t lastRenderUs;     // update + dessin, hors flush
+  uint32_t lastFlushUs;      // temps passé dans le flush par la tâche de rendu
+  uint32_t maxFrameUs;
+  uint32_t droppedEvents;    // post() refusés (file pleine)
+  uint64_t totalRenderUs;
+  uint64_t totalFlushUs;
+};
+
 bool init();
+/// Sans tâche de rendu (création échouée) : exécute une frame. Sinon ne fait rien.
 void update();
 void testDisplay();
 
+/// Exécute fn(arg) dans la tâche de rendu, au début de la prochaine frame.
+bool post(void (*fn)(uint8_t), uint8_t arg = 0);
+
+/// Verrou de frame (récursif) : exclut la tâche de rendu le temps d'une commande.
+void lockFrame();
+void unlockFrame();
+struct FrameLock {
+  FrameLock() { lockFrame(); }
+  ~FrameLock() { unlockFrame(); }
+};
+
+void setTargetFps(uint16_t fps);
+uint16_t getTargetFps();
+bool isRenderTaskRunning();
+const FrameStats& getFrameStats();
+/// Remise à zéro faite par la tâche de rendu au début de la prochaine frame (via post()).
+bool resetFrameStats();
+
 } // namespace GotchiLvgl
 
 #endif
@@ -3,11 +3,13 @@
 #include "common/managers/mqtt/mqtt_manager.h"
 #include "common/utils/mac_utils.h"
 #include "common/managers/sd/sd_manager.h"
+#include "../audio/gotchi_audio.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <cstring>
 
 static bool handleGetInfo(const JsonObject& json);
+static bool handleAudioStats(const JsonObject& json);
 
 bool ModelGotchiMqttRoutes::processMessage(const JsonObject& json) {
   if (!json["action"].is<const char*>()) {
@@ -24,6 +26,9 @@ bool ModelGotchiMqttRoutes::processMessage(const JsonObject& json) {
   if (strcmp(action, "get-info") == 0 || strcmp(action, "getinfo") == 0) {
     return handleGetInfo(json);
   }
+  if (strcmp(action, "audio-stats") == 0) {
+    return handleAudioStats(json);
+  }
 
   Serial.println("[MQTT-ROUTE-GOTCHI] Action inconnue");
   return false;
@@ -32,6 +37,7 @@ bool ModelGotchiMqttRoutes::processMessage(const JsonObject& json) {
 void ModelGotchiMqttRoutes::printRoutes() {
   Serial.println("\n=== Routes MQTT - Gotchi ===");
   Serial.println("  - get-info");
+  Serial.println("  - audio-stats: latence, underruns et file DMA du moteur audio ({\"reset\":true} pour remettre a zero)");
 }
 
 static bool handleGetInfo(const JsonObject& json) {
@@ -82,3 +88,49 @@ static bool handleGetInfo(const JsonObject& json) {
   Serial.println("[MQTT-ROUTE-GOTCHI] get-info: erreur publication");
   return false;
 }
+
+/**
+ * Publie la santé du moteur audio (latence de démarrage, underruns, file DMA)
+ * Champs communs avec le modèle Sound : startUs (histogramme), underruns,
+ * fill (ici : blocs pleins dans la file DMA à chaque écriture, 0..DMA_DESC)
+ */
+static bool handleAudioStats(const JsonObject& json) {
+  const GotchiAudio::Stats& st = GotchiAudio::getStats();
+
+  char fill[48];
+  int pos = 0;
+  for (int i = 0; i <= GotchiAudio::DMA_DESC && pos < (int)sizeof(fill); i++) {
+    pos += snprintf(fill + pos, sizeof(fill) - pos, "%s%lu", i ? "," : "", (unsigned long)st.fill[i]);
+  }
+  char startUs[96];
+  st.startUs.formatJson(startUs, sizeof(startUs));
+
+  char statsJson[384];
+  snprintf(statsJson, sizeof(statsJson),
+    "{"
+      "\"type\":\"audio-stats\","
+      "\"model\":\"gotchi\","
+      "\"startUs\":%s,"
+      "\"underruns\":%lu,"
+      "\"fill\":[%s],"
+      "\"frames\":%llu,"
+      "\"renderUs\":%llu"
+    "}",
+    startUs,
+    (unsigned long)st.underruns,
+    fill,
+    (unsigned long long)st.frames,
+    (unsigned long long)st.renderUs
+  );
+
+  if (json["reset"].is<bool>() && json["reset"].as<bool>()) {
+    GotchiAudio::resetStats();
+  }
+
+  if (MqttManager::publish(statsJson)) {
+    Serial.println("[MQTT-ROUTE-GOTCHI] audio-stats publié");
+    return true;
+  }
+  Serial.println("[MQTT-ROUTE-GOTCHI] audio-stats: erreur publication");
+  return false;
+}
@@ -3,13 +3,17 @@
 #include <Wire.h>
 #include "../lvgl/gotchi_lvgl.h"
 #include "../face/face_engine.h"
+#include "../face/face_renderer.h"
 #include "../face/face_config.h"
+#include "../face/blend565.h"
 #include "../face/behavior/behavior_engine.h"
 #include "../face/behavior/poop_manager.h"
 #include "../face/behavior/dirt_overlay.h"
 #include "../config/gotchi_theme.h"
 #include "../config/config.h"
 #include "../audio/gotchi_speaker_test.h"
+#include "../audio/gotchi_audio.h"
+#include "../audio/gotchi_synth.h"
 #include "../audio/sounds/sound_sneeze.h"
 #include "common/managers/sd/sd_manager.h"
 #include "common/managers/nfc/nfc_manager.h"
@@ -17,9 +21,131 @@
 // Defini dans behavior_idle.cpp — declenche une scene idle pour test
 extern bool idleTriggerScene(int num);
 
+static void printShapeCacheStats() {
+  const auto& cs = FaceRenderer::getShapeCacheStats();
+  const uint32_t lookups = cs.hits + cs.misses;
+  Serial.printf("[FACE] Cache yeux: %.1f%% hits (%lu/%lu), %lu evictions, %lu formes non cachables\n",
+    lookups ? 100.0f * cs.hits / lookups : 0.0f, (unsigned long)cs.hits, (unsigned long)lookups,
+    (unsigned long)cs.evictions, (unsigned long)cs.uncached);
+}
+
+// === Speaker ===
+// Moteur GotchiAudio (tâche à lui) : rien dans l'état du rendu
+static bool processSpeakerCommand(const String& command) {
+  if (command == "speaker" || command == "speaker test") {
+    GotchiSpeakerTest::playTone();
+    return true;
+  }
+  if (command == "speaker melody") {
+    GotchiSpeakerTest::playMelody();
+    return true;
+  }
+  if (command == "speaker scan") {
+    GotchiSpeakerTest::scanES8311();
+    return true;
+  }
+  if (command == "speaker dump") {
+    GotchiSpeakerTest::dumpRegisters();
+    return true;
+  }
+  if (command == "speaker chirp" || command == "speaker chirp down") {
+    GotchiAudio::playSequence(command == "speaker chirp" ? GotchiSynth::CHIRP_UP : GotchiSynth::CHIRP_DOWN, 80);
+    return true;
+  }
+  if (command == "speaker stats reset") {
+    GotchiAudio::resetStats();
+    Serial.println("[SPEAKER] Stats remises a zero");
+    return true;
+  }
+  if (command == "speaker stats") {
+    const auto& st = GotchiAudio::getStats();
+    const float audioS = (float)st.frames / GotchiAudio::SAMPLE_RATE;
+    Serial.printf("[SPEAKER] %.2f s d'audio en %lu blocs (%.0f%% en voix seule sans mixage)\n",
+      audioS, (unsigned long)st.blocks, st.frames ? 100.0f * st.directFrames / st.frames : 0.0f);
+    Serial.printf("[SPEAKER] CPU: %lu us au total, %.0f us par seconde d'audio\n",
+      (unsigned long)st.renderUs, audioS > 0 ? st.renderUs / audioS : 0.0f);
+    char hist[96];
+    st.startUs.format(hist, sizeof(hist));
+    Serial.printf("[SPEAKER] Latence demande -> premier sample (us): %s\n", hist);
+    Serial.printf("[SPEAKER] Underruns DMA: %lu\n", (unsigned long)st.underruns);
+    Serial.print("[SPEAKER] File DMA a l'ecriture (blocs pleins:ecritures):");
+    for (int i = 0; i <= GotchiAudio::DMA_DESC; i++) {
+      Serial.printf(" %d:%lu", i, (unsigned long)st.fill[i]);
+    }
+    Serial.println();
+    return true;
+  }
+  if (command == "speaker sneeze") {
+    GotchiSpeakerTest::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN);
+    return true;
+  }
+  if (command.startsWith("speaker vol ")) {
+    int vol = command.substring(12).toInt();
+    if (vol < 0) vol = 0;
+    if (vol > 100) vol = 100;
+    SDConfig cfg = SDManager::getConfig();
+    cfg.speaker_volume = (uint8_t)vol;
+    SDManager::saveConfig(cfg);
+    GotchiAudio::setVolume((uint8_t)vol);
+    Serial.printf("[SPEAKER] Volume sauvé: %d%%\n", vol);
+    // Test avec un tone pour entendre le changement
+    GotchiSpeakerTest::playTone(440, 300, 70);
+    return true;
+  }
+  if (command == "speaker vol") {
+    SDConfig cfg = SDManager::getConfig();
+    Serial.printf("[SPEAKER] Volume actuel: %d%%\n", cfg.speaker_volume);
+    return true;
+  }
+  if (command.startsWith("speaker tone ")) {
+    // speaker tone <freq> [duration] [volume]
+    String args = command.substring(13); args.trim();
+    uint16_t freq = 440, dur = 500;
+    uint8_t vol = 100;
+    int sp1 = args.indexOf(' ');
+    if (sp1 < 0) {
+      freq = args.toInt();
+    } else {
+      freq = args.substring(0, sp1).toInt();
+      String rest = args.substring(sp1 + 1); rest.trim();
+      int sp2 = rest.indexOf(' ');
+      if (sp2 < 0) {
+        dur = rest.toInt();
+      } else {
+        dur = rest.substring(0, sp2).toInt();
+        vol = rest.substring(sp2 + 1).toInt();
+      }
+    }
+    if (freq < 20) freq = 20;
+    if (freq > 8000) freq = 8000;
+    if (dur < 50) dur = 50;
+    if (dur > 5000) dur = 5000;
+    if (vol > 100) vol = 100;
+    GotchiSpeakerTest::playTone(freq, dur, vol);
+    return true;
+  }
+  if (command.startsWith("speaker vol ")) {
+    uint8_t vol = command.substring(12).toInt();
+    if (vol > 100) vol = 100;
+    // Joue un tone de test au volume demandé
+    GotchiSpeakerTest::playTone(440, 500, vol);
+    return true;
+  }
+
+  return false;
+}
+
 bool ModelGotchiSerialCommands::processCommand(const String& command) {
+  // Hors du verrou de frame : les variantes bloquantes attendent la fin du
+  // son (jusqu'à 5 s) et figeraient le visage
+  if (command.startsWith("speaker")) return processSpeakerCommand(command);
+
+  // Les autres commandes touchent l'état du rendu : attendre la fin de la frame en cours
+  GotchiLvgl::FrameLock frameLock;
+
   if (command == "gotchi-info") {
     Serial.println("[GOTCHI] Waveshare ESP32-S3-Touch-AMOLED-1.75 (466x466, QSPI)");
+    printShapeCacheStats();
     return true;
   }
 
@@ -239,6 +365,111 @@ bool ModelGotchiSerialCommands::processCommand(const String& command) {
       return true;
     }
 
+    // --- Perf rendu (damage tracking du flush) ---
+    if (arg == "perf reset") {
+      FaceRenderer::resetFlushStats();
+      FaceRenderer::resetShapeCacheStats();
+      FaceRenderer::resetRasterStats();
+      Serial.println("[FACE] Stats flush remises a zero");
+      return true;
+    }
+    if (arg == "async on" || arg == "async off") {
+      FaceRenderer::setAsyncFlush(arg == "async on");
+      Serial.printf("[FACE] Flush %s\n", FaceRenderer::isAsyncFlush() ? "async (pipeline)" : "synchrone");
+      return true;
+    }
+    if (arg == "cache on" || arg == "cache off") {
+      FaceRenderer::setShapeCache(arg == "cache on");
+      FaceRenderer::resetShapeCacheStats();
+      FaceRenderer::resetRasterStats();
+      Serial.printf("[FACE] Cache des yeux %s\n", FaceRenderer::isShapeCache() ? "actif" : "desactive (rasterisation directe)");
+      return true;
+    }
+    if (arg == "raster dual" || arg == "raster single") {
+      if (!FaceRenderer::setParallelRaster(arg == "raster dual")) {
+        Serial.println("[FACE] Rasterisation bi-coeur indisponible");
+      }
+      FaceRenderer::resetRasterStats();
+      Serial.printf("[FACE] Rasterisation %s\n", FaceRenderer::isParallelRaster() ? "bi-coeur (2 bandes)" : "mono-coeur");
+      return true;
+    }
+    if (arg == "perf") {
+      const auto& fs = FaceRenderer::getFlushStats();
+      const uint32_t fullBytes = (uint32_t)FaceRenderer::getFbW() * FaceRenderer::getFbH() * sizeof(uint16_t);
+      uint32_t avgBytes = fs.frames ? (uint32_t)(fs.totalBytes / fs.frames) : 0;
+      uint32_t avgUs = fs.frames ? (uint32_t)(fs.totalFlushUs / fs.frames) : 0;
+      Serial.printf("[FACE] Flush: %lu frames (%lu sans changement)\n",
+        (unsigned long)fs.frames, (unsigned long)fs.idleFrames);
+      Serial.printf("[FACE] Derniere frame: %lu octets, %lu rects, %lu us\n",
+        (unsigned long)fs.lastBytes, (unsigned long)fs.lastRects, (unsigned long)fs.lastFlushUs);
+      Serial.printf("[FACE] Moyenne: %lu octets/frame (%.1f%% d'un push complet de %lu), %lu us/flush\n",
+        (unsigned long)avgBytes, fullBytes ? 100.0f * avgBytes / fullBytes : 0.0f,
+        (unsigned long)fullBytes, (unsigned long)avgUs);
+      uint32_t avgWaitUs = fs.frames ? (uint32_t)(fs.totalWaitUs / fs.frames) : 0;
+      Serial.printf("[FACE] Mode: %s, attente transfert precedent: %lu us/frame\n",
+        FaceRenderer::isAsyncFlush() ? "async" : "sync", (unsigned long)avgWaitUs);
+      if (avgUs > 0) {
+        Serial.printf("[FACE] FPS max limite par le bus: %.1f\n", 1000000.0f / avgUs);
+      }
+      const auto& rs = FaceRenderer::getRasterStats();
+      Serial.printf("[FACE] Dessin FB: %s, %lu us/frame (derniere %lu us), attente bande basse %lu us/frame (%lu/%lu frames en 2 bandes)\n",
+        FaceRenderer::isParallelRaster() ? "bi-coeur" : "mono-coeur",
+        (unsigned long)(rs.frames ? rs.totalRasterUs / rs.frames : 0), (unsigned long)rs.lastRasterUs,
+        (unsigned long)(rs.dualFrames ? rs.totalWaitUs / rs.dualFrames : 0),
+        (unsigned long)rs.dualFrames, (unsigned long)rs.frames);
+      printShapeCacheStats();
+      return true;
+    }
+
+    if (arg == "blend bench") {
+      Blend565::BenchResult br;
+      if (!Blend565::benchmark(br)) {
+        Serial.println("[FACE] Bench blend: allocation echouee");
+        return true;
+      }
+      auto mpx = [&](uint32_t us) { return us ? (float)br.pixels / us : 0.0f; };
+      Serial.printf("[FACE] Bench blend RGB565 (%lu px, RAM interne) :\n", (unsigned long)br.pixels);
+      Serial.printf("  reference (/255)   %7lu us  %6.2f Mpx/s\n", (unsigned long)br.referenceUs, mpx(br.referenceUs));
+      Serial.printf("  over (spread)      %7lu us  %6.2f Mpx/s\n", (unsigned long)br.overUs, mpx(br.overUs));
+      Serial.printf("  overPremul         %7lu us  %6.2f Mpx/s\n", (unsigned long)br.premulUs, mpx(br.premulUs));
+      Serial.printf("  overRun (2 px/mot) %7lu us  %6.2f Mpx/s\n", (unsigned long)br.runUs, mpx(br.runUs));
+      return true;
+    }
+
+    // --- Cadence de la tache de rendu ---
+    if (arg.startsWith("fps")) {
+      String v = arg.substring(3); v.trim();
+      if (v.length() > 0) {
+        GotchiLvgl::setTargetFps((uint16_t)v.toInt());
+      }
+      Serial.printf("[FACE] Cadence cible: %u fps (tache rendu %s)\n",
+        (unsigned)GotchiLvgl::getTargetFps(),
+        GotchiLvgl::isRenderTaskRunning() ? "active" : "absente, rendu dans loop()");
+      return true;
+    }
+    if (arg == "timing reset") {
+      if (GotchiLvgl::resetFrameStats()) {
+        Serial.println("[FACE] Stats frame remises a zero (frame suivante)");
+      }
+      return true;
+    }
+    if (arg == "timing") {
+      const auto& st = GotchiLvgl::getFrameStats();
+      uint32_t avgRenderUs = st.frames ? (uint32_t)(st.totalRenderUs / st.frames) : 0;
+      uint32_t avgFlushUs = st.frames ? (uint32_t)(st.totalFlushUs / st.frames) : 0;
+      Serial.printf("[FACE] Frames: %lu, deadlines manquees: %lu (%.1f%%), evenements perdus: %lu\n",
+        (unsigned long)st.frames, (unsigned long)st.missedDeadlines,
+        st.frames ? 100.0f * st.missedDeadlines / st.frames : 0.0f,
+        (unsigned long)st.droppedEvents);
+      Serial.printf("[FACE] Rendu: %.2f ms (moy %.2f ms), flush: %.2f ms (moy %.2f ms)\n",
+        st.lastRenderUs / 1000.0f, avgRenderUs / 1000.0f,
+        st.lastFlushUs / 1000.0f, avgFlushUs / 1000.0f);
+      Serial.printf("[FACE] Frame max: %.2f ms, budget: %.2f ms (%u fps)\n",
+        st.maxFrameUs / 1000.0f, 1000.0f / GotchiLvgl::getTargetFps(),
+        (unsigned)GotchiLvgl::getTargetFps());
+      return true;
+    }
+
     // --- Face engine direct ---
     if (arg == "blink") { FaceEngine::blink(); return true; }
 
@@ -401,85 +632,12 @@ bool ModelGotchiSerialCommands::processCommand(const String& command) {
     return true;
   }
 
-  // === Speaker ===
-  if (command == "speaker" || command == "speaker test") {
-    GotchiSpeakerTest::playTone();
-    return true;
-  }
-  if (command == "speaker melody") {
-    GotchiSpeakerTest::playMelody();
-    return true;
-  }
-  if (command == "speaker scan") {
-    GotchiSpeakerTest::scanES8311();
-    return true;
-  }
-  if (command == "speaker dump") {
-    GotchiSpeakerTest::dumpRegisters();
-    return true;
-  }
-  if (command == "speaker sneeze") {
-    GotchiSpeakerTest::playSound(SNEEZE_PCM, SNEEZE_PCM_LEN);
-    return true;
-  }
-  if (command.startsWith("speaker vol ")) {
-    int vol = command.substring(12).toInt();
-    if (vol < 0) vol = 0;
-    if (vol > 100) vol = 100;
-    SDConfig cfg = SDManager::getConfig();
-    cfg.speaker_volume = (uint8_t)vol;
-    SDManager::saveConfig(cfg);
-    Serial.printf("[SPEAKER] Volume sauvé: %d%%\n", vol);
-    // Test avec un tone pour entendre le changement
-    GotchiSpeakerTest::playTone(440, 300, 70);
-    return true;
-  }
-  if (command == "speaker vol") {
-    SDConfig cfg = SDManager::getConfig();
-    Serial.printf("[SPEAKER] Volume actuel: %d%%\n", cfg.speaker_volume);
-    return true;
-  }
-  if (command.startsWith("speaker tone ")) {
-    // speaker tone <freq> [duration] [volume]
-    String args = command.substring(13); args.trim();
-    uint16_t freq = 440, dur = 500;
-    uint8_t vol = 100;
-    int sp1 = args.indexOf(' ');
-    if (sp1 < 0) {
-      freq = args.toInt();
-    } else {
-      freq = args.substring(0, sp1).toInt();
-      String rest = args.substring(sp1 + 1); rest.trim();
-      int sp2 = rest.indexOf(' ');
-      if (sp2 < 0) {
-        dur = rest.toInt();
-      } else {
-        dur = rest.substring(0, sp2).toInt();
-        vol = rest.substring(sp2 + 1).toInt();
-      }
-    }
-    if (freq < 20) freq = 20;
-    if (freq > 8000) freq = 8000;
-    if (dur < 50) dur = 50;
-    if (dur > 5000) dur = 5000;
-    if (vol > 100) vol = 100;
-    GotchiSpeakerTest::playTone(freq, dur, vol);
-    return true;
-  }
-  if (command.startsWith("speaker vol ")) {
-    uint8_t vol = command.substring(12).toInt();
-    if (vol > 100) vol = 100;
-    // Joue un tone de test au volume demandé
-    GotchiSpeakerTest::playTone(440, 500, vol);
-    return true;
-  }
-
   return false;
 }
 
 void ModelGotchiSerialCommands::printHelp() {
   Serial.println("  === Gotchi ===");
-  Serial.println("  gotchi-info                  Infos matériel");
+  Serial.println("  gotchi-info                  Infos matériel, cache des yeux");
   Serial.println("  gotchi-test                  Test écran AMOLED");
   Serial.println("  === Vie ===");
   Serial.println("  face feed [bottle|cake|apple|candy]  Nourrir");
@@ -504,6 +662,15 @@ void ModelGotchiSerialCommands::printHelp() {
   Serial.println("  face theme <name>            green, gold, red, white");
   Serial.println("  === Infos ===");
   Serial.println("  face stats                   Stats complètes");
+  Serial.println("  face perf [reset]            Stats du flush ecran (octets/frame, us)");
+  Serial.println("  face async on|off            Flush ecran pipeline (tache dediee) ou synchrone");
+  Serial.println("  face raster dual|single      Dessin du FB en 2 bandes sur les 2 coeurs, ou sur 1");
+  Serial.println("  face cache on|off            Cache des yeux rasterises (off : rasterisation directe)");
+  Serial.println("  face blend bench             Mesure pixels/s du blend RGB565 (ancien vs actuel)");
+  Serial.println("  face fps [n]                 Cadence cible de la tache de rendu (1-60)");
+  Serial.println("  face timing [reset]          Temps rendu/flush par frame, deadlines manquees");
+  Serial.println("  speaker stats [reset]        CPU, latence, underruns et file DMA du moteur audio");
+  Serial.println("  speaker chirp [down]         Chirp synthetise (montant / descendant)");
   Serial.println("  === Behaviors ===");
   Serial.println("  face behavior auto           Mode autonome");
   Serial.println("  face behavior <name>         Force (idle,play,sleep,sad,happy,");
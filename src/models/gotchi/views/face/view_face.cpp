@@ -2,6 +2,7 @@
 #include "../../config/config.h"
 #include "../../config/gotchi_theme.h"
 #include "../../face/face_engine.h"
+#include "../../face/face_renderer.h"
 #include "../../face/overlay/face_overlay_layer.h"
 #include "../../face/behavior/behavior_engine.h"
 #include "../../imu/gotchi_imu.h"
@@ -19,9 +20,9 @@ static void faceUpdate(uint32_t dtMs, Arduino_GFX* gfx) {
   }
 
   BehaviorEngine::update(dtMs);
-  FaceEngine::update(dtMs);
+  // Overlays (💢, 💤) composés dans le FB par FaceEngine::update → render
   FaceOverlayLayer::update(dtMs);
-  FaceOverlayLayer::draw(gfx);
+  FaceEngine::update(dtMs);
 }
 
 static void drawPageDots(Arduino_GFX* gfx, int active) {
@@ -36,6 +37,8 @@ static void drawPageDots(Arduino_GFX* gfx, int active) {
 }
 
 static void faceOnEnter(Arduino_GFX* gfx) {
+  // L'ecran a ete efface par la view precedente : renvoyer tout le visage
+  FaceRenderer::invalidate();
   drawPageDots(gfx, 1);  // Face = page du milieu
 }
 
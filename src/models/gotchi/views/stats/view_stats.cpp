@@ -18,6 +18,7 @@ constexpr int16_t CY = GOTCHI_LCD_HEIGHT / 2;
 constexpr float DEG2RAD = 3.14159265f / 180.0f;
 
 // Viewport du face engine dans le FB (ne flush que cette zone)
+// Coordonnees FB : le FB commence a l'ecran en (20, 30)
 // Face engine scale 0.6 → yeux + bouche 60% de la taille normale
 // Viewport adapte : couvre le visage scale sans toucher les arcs (rayon 215+)
 // Tous les coins du viewport sont a < 150px du centre → bien a l'interieur
@@ -25,7 +26,7 @@ constexpr float DEG2RAD = 3.14159265f / 180.0f;
 // rotation 90° du wrapper SwRot90).
 constexpr float FACE_SCALE = 0.6f;
 constexpr int16_t VP_X = 86;
-constexpr int16_t VP_Y = 40;
+constexpr int16_t VP_Y = 140;
 constexpr int16_t VP_W = 254;
 constexpr int16_t VP_H = 134;
 
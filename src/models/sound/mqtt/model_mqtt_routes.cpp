@@ -9,6 +9,8 @@
 #include "common/managers/init/init_manager.h"
 #include "common/managers/rtc/rtc_manager.h"
 #include "common/utils/mac_utils.h"
+#include "common/managers/audio/audio_manager.h"
+#include "common/managers/led/led_manager.h"
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <cstring>
@@ -21,6 +23,7 @@
 // Forward declarations
 static bool handleGetInfo(const JsonObject& json);
 static bool handleBrightness(const JsonObject& json);
+static bool handleAudioStats(const JsonObject& json);
 
 bool ModelSoundMqttRoutes::processMessage(const JsonObject& json) {
   // Vérifier que l'action est présente
@@ -45,6 +48,9 @@ bool ModelSoundMqttRoutes::processMessage(const JsonObject& json) {
   else if (strcmp(action, "brightness") == 0) {
     return handleBrightness(json);
   }
+  else if (strcmp(action, "audio-stats") == 0) {
+    return handleAudioStats(json);
+  }
 
   Serial.println("[MQTT-ROUTE-SOUND] Action inconnue");
   return false;
@@ -54,9 +60,11 @@ void ModelSoundMqttRoutes::printRoutes() {
   Serial.println("\n=== Routes MQTT - Sound ===");
   Serial.println("  - get-info: Récupérer les infos (stockage, firmware, MAC, etc.)");
   Serial.println("  - brightness: Changer la luminosité");
+  Serial.println("  - audio-stats: Latence, buffer et écarts de la tâche audio, temps strip->show()");
   Serial.println("\nExemples:");
   Serial.println("  { \"action\": \"get-info\" }");
   Serial.println("  { \"action\": \"brightness\", \"value\": 75 }");
+  Serial.println("  { \"action\": \"audio-stats\", \"reset\": true }");
 }
 
 /**
@@ -145,3 +153,64 @@ static bool handleBrightness(const JsonObject& json) {
 
   return true;
 }
+
+/**
+ * Publie la santé du flux audio (latence, buffer, écarts entre loops) et le
+ * temps des strip->show(), pour régler LEDManager::SHOW_INTERVAL_MS
+ * Champs communs avec le modèle Gotchi : startUs (histogramme), underruns
+ * (buffer d'entrée vidé avant la fin du fichier), fill (ici : buffer
+ * d'entrée par dizaine de %, 0..100 %)
+ */
+static bool handleAudioStats(const JsonObject& json) {
+  const AudioManager::Stats& st = AudioManager::getStats();
+  const LEDOutput::Stats& led = LEDOutput::getStats();
+
+  char fill[64];
+  int pos = 0;
+  for (int i = 0; i < AudioManager::Stats::FILL_BUCKETS && pos < (int)sizeof(fill); i++) {
+    pos += snprintf(fill + pos, sizeof(fill) - pos, "%s%lu", i ? "," : "", (unsigned long)st.fill[i]);
+  }
+  char startUs[96], loopUs[96], loopGapUs[96], ledShowUs[96];
+  st.startUs.formatJson(startUs, sizeof(startUs));
+  st.loopUs.formatJson(loopUs, sizeof(loopUs));
+  st.loopGapUs.formatJson(loopGapUs, sizeof(loopGapUs));
+  LEDManager::getShowStats().formatJson(ledShowUs, sizeof(ledShowUs));
+
+  char statsJson[768];
+  snprintf(statsJson, sizeof(statsJson),
+    "{"
+      "\"type\":\"audio-stats\","
+      "\"model\":\"sound\","
+      "\"startUs\":%s,"
+      "\"underruns\":%lu,"
+      "\"fill\":[%s],"
+      "\"loopUs\":%s,"
+      "\"loopGapUs\":%s,"
+      "\"skippedLoops\":%lu,"
+      "\"ledShowUs\":%s,"
+      "\"ledShowIntervalMs\":%lu,"
+      "\"ledFrames\":{\"sent\":%lu,\"suppressed\":%lu}"
+    "}",
+    startUs,
+    (unsigned long)st.starved,
+    fill,
+    loopUs,
+    loopGapUs,
+    (unsigned long)st.skippedLoops,
+    ledShowUs,
+    (unsigned long)LEDManager::SHOW_INTERVAL_MS,
+    (unsigned long)led.sent, (unsigned long)led.suppressed
+  );
+
+  if (json["reset"].is<bool>() && json["reset"].as<bool>()) {
+    AudioManager::resetStats();
+  }
+
+  if (MqttManager::publish(statsJson)) {
+    Serial.println("[MQTT-ROUTE-SOUND] audio-stats: Stats publiées");
+    return true;
+  } else {
+    Serial.println("[MQTT-ROUTE-SOUND] audio-stats: Erreur lors de la publication");
+    return false;
+  }
+}
@@ -0,0 +1,241 @@
+/**
+ * Compositeur des calques LED (env:native)
+ *
+ * LEDCompositor::compose() est appelé directement, sans tâche LED (Dream :
+ * tramage temporel et budget de LED_MAX_CURRENT_MA actifs) :
+ * - niveau maître : sortie à moins d'un pas 8 bits de v x gamma(niveau),
+ *   pour toute valeur de canal et toute luminosité ;
+ * - luminosité faible (1 à 26 sur 255) : jamais arrondie à noir ;
+ * - tramage : la moyenne de 256 trames rend la valeur 16 bits, pas de
+ *   scintillement sous un pas 8 bits ;
+ * - calques : fondu d'entrée, maintien, fondu de sortie, visibles sur une
+ *   base éteinte (sleep), la base réapparaît à la fin ; TOUCH passe
+ *   au-dessus d'ALERT sans modifier la base ;
+ * - limite de courant : blanc plein ramené au budget, teintes conservées ;
+ * - coût d'un compose() en cycles (chiffre de l'hôte, message seulement).
+ *
+ *   pio test -e native_dream -f dream/test_led_compositor -v
+ */
+#include <unity.h>
+#include <Adafruit_NeoPixel.h>
+#include <cmath>
+#include <cstdio>
+#include "host_bench.h"
+#include "models/model_config.h"
+#include "common/managers/led/led_compositor.h"
+#include "common/managers/led/led_math.h"
+
+namespace {
+
+Adafruit_NeoPixel s_strip(NUM_LEDS);
+uint32_t s_base[NUM_LEDS];
+
+void fillBase(uint32_t color) {
+  for (int i = 0; i < NUM_LEDS; i++) s_base[i] = color;
+}
+
+uint8_t channel(uint16_t led, uint8_t shift) {
+  return (uint8_t)(s_strip.getPixelColor(led) >> shift);
+}
+
+// Valeur exacte (8 bits, non arrondie) d'un canal v au niveau perçu level
+double ideal(uint8_t v, uint16_t level) {
+  return v * (double)LEDMath::gamma16(level) / 65535.0;
+}
+
+} // namespace
+
+void setUp() {
+  LEDCompositor::setOverlay(LED_OVERLAY_ALERT, 0, 0, 0, LED_OVERLAY_SOLID, 0);
+  LEDCompositor::setOverlay(LED_OVERLAY_TOUCH, 0, 0, 0, LED_OVERLAY_SOLID, 0);
+}
+
+void tearDown() {}
+
+// Toutes les valeurs de canal, réparties sur LEDS_PER_PASS LEDs (sous le
+// budget de courant), à chaque luminosité
+void test_master_level_within_one_step() {
+  constexpr int LEDS_PER_PASS = 10;
+  for (uint16_t brightness = 0; brightness <= 255; brightness++) {
+    const uint16_t level = brightness * 257;
+    for (uint16_t first = 0; first < 256; first += LEDS_PER_PASS * 3) {
+      for (int i = 0; i < LEDS_PER_PASS; i++) {
+        const uint32_t v = first + i * 3;
+        s_base[i] = ((v & 0xFF) << 16) | (((v + 1) & 0xFF) << 8) | ((v + 2) & 0xFF);
+      }
+      LEDCompositor::compose(s_base, LEDS_PER_PASS, level, 0, &s_strip);
+      TEST_ASSERT_EQUAL_UINT32(LEDCompositor::getRequestedCurrentMa(), LEDCompositor::getEstimatedCurrentMa());
+      for (int i = 0; i < LEDS_PER_PASS; i++) {
+        for (uint8_t shift = 0; shift <= 16; shift += 8) {
+          const uint8_t v = (uint8_t)(s_base[i] >> shift);
+          const double error = fabs(channel(i, shift) - ideal(v, level));
+          if (error >= 1.0) {
+            char message[96];
+            snprintf(message, sizeof(message), "luminosite %u, canal %u : sortie %u", brightness, v,
+                     channel(i, shift));
+            TEST_FAIL_MESSAGE(message);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Réglage de coucher au plus bas : chaque trame allume encore la bande
+void test_low_brightness_stays_visible() {
+  fillBase(0xFFFFFF);
+  for (uint16_t brightness = 1; brightness <= 26; brightness++) {
+    for (int frame = 0; frame < 64; frame++) {
+      LEDCompositor::compose(s_base, NUM_LEDS, brightness * 257, frame * 16, &s_strip);
+      TEST_ASSERT_NOT_EQUAL(0, channel(0, 0));
+    }
+  }
+  // Niveau nul : noir
+  LEDCompositor::compose(s_base, NUM_LEDS, 0, 0, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0, s_strip.getPixelColor(0));
+}
+
+// Une valeur entre deux pas 8 bits : la moyenne de 256 trames la rend
+// exactement (à 1/256 près), et compose() demande à être rappelé
+void test_dither_mean_matches_16_bit_value() {
+  fillBase(0xC0C0C0);
+  const uint16_t level = 100 * 257 + 77;
+  const double exact = ideal(0xC0, level);
+  TEST_ASSERT_TRUE(exact - floor(exact) > 0.1);
+
+  uint32_t sum = 0;
+  uint8_t lo = 255, hi = 0;
+  for (int frame = 0; frame < 256; frame++) {
+    TEST_ASSERT_TRUE(LEDCompositor::compose(s_base, NUM_LEDS, level, frame * 16, &s_strip));
+    const uint8_t v = channel(5, 8);
+    sum += v;
+    lo = v < lo ? v : lo;
+    hi = v > hi ? v : hi;
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, hi - lo);  // Deux pas voisins seulement
+  TEST_ASSERT_TRUE(fabs(sum / 256.0 - exact) <= 1.0 / 256);
+}
+
+// Sous un pas 8 bits : arrondi fixe, pas d'alternance éteint / allumé
+void test_no_flicker_below_one_step() {
+  fillBase(0x010101);
+  const uint16_t level = 200 * 257;
+  TEST_ASSERT_TRUE(ideal(1, level) < 1.0);
+  LEDCompositor::compose(s_base, NUM_LEDS, level, 0, &s_strip);
+  const uint32_t first = s_strip.getPixelColor(0);
+  for (int frame = 1; frame < 64; frame++) {
+    TEST_ASSERT_FALSE(LEDCompositor::compose(s_base, NUM_LEDS, level, frame * 16, &s_strip));
+    TEST_ASSERT_EQUAL_HEX32(first, s_strip.getPixelColor(0));
+  }
+}
+
+// Fondu d'entrée et de sortie de OVERLAY_FADE_MS, maintien entre les deux,
+// sur une base éteinte (niveau maître nul comme en sleep)
+void test_overlay_fades_over_dark_base() {
+  fillBase(0x00FF00);
+  const uint16_t duration = 1000;
+  LEDCompositor::setOverlay(LED_OVERLAY_ALERT, 0xFF0000, 255, duration, LED_OVERLAY_SOLID, 0);
+
+  uint8_t previous = 0;
+  for (uint32_t t = 0; t <= LEDCompositor::OVERLAY_FADE_MS; t += 10) {
+    LEDCompositor::compose(s_base, NUM_LEDS, 0, t, &s_strip);
+    TEST_ASSERT_GREATER_OR_EQUAL(previous, channel(0, 16));
+    TEST_ASSERT_EQUAL_UINT8(0, channel(0, 8));
+    previous = channel(0, 16);
+  }
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, s_strip.getPixelColor(0));
+
+  LEDCompositor::compose(s_base, NUM_LEDS, 0, 500, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, s_strip.getPixelColor(NUM_LEDS - 1));
+  TEST_ASSERT_TRUE(LEDCompositor::hasOverlay(500));
+
+  // Mi-fondu de sortie : ~opacité 1/2 (linéaire en 16 bits)
+  LEDCompositor::compose(s_base, NUM_LEDS, 0, duration - LEDCompositor::OVERLAY_FADE_MS / 2, &s_strip);
+  TEST_ASSERT_UINT32_WITHIN(2, 128, channel(0, 16));
+
+  previous = 255;
+  for (uint32_t t = duration - LEDCompositor::OVERLAY_FADE_MS; t < duration; t += 10) {
+    LEDCompositor::compose(s_base, NUM_LEDS, 0, t, &s_strip);
+    TEST_ASSERT_LESS_OR_EQUAL(previous, channel(0, 16));
+    previous = channel(0, 16);
+  }
+  LEDCompositor::compose(s_base, NUM_LEDS, 0, duration, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0, s_strip.getPixelColor(0));
+  TEST_ASSERT_FALSE(LEDCompositor::hasOverlay(duration));
+}
+
+// Le calque masque la base sans la modifier ; TOUCH passe au-dessus d'ALERT
+void test_overlay_masks_base_and_stacks() {
+  fillBase(0x00FF00);
+  LEDCompositor::setOverlay(LED_OVERLAY_ALERT, 0xFF0000, 255, 2000, LED_OVERLAY_SOLID, 0);
+  LEDCompositor::setOverlay(LED_OVERLAY_TOUCH, 0x0000FF, 255, 1000, LED_OVERLAY_SOLID, 0);
+
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 500, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0x0000FF, s_strip.getPixelColor(0));
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 1500, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, s_strip.getPixelColor(0));
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 2000, &s_strip);
+  TEST_ASSERT_EQUAL_HEX32(0x00FF00, s_strip.getPixelColor(0));
+  TEST_ASSERT_EQUAL_HEX32(0x00FF00, s_base[0]);
+}
+
+// Blanc plein sur toute la bande : 28 + 28 x 3 x 20 = 1708 mA demandés
+void test_current_limit() {
+  fillBase(0xFFFFFF);
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 0, &s_strip);
+  const uint32_t requested = NUM_LEDS * (LEDCompositor::IDLE_MA + 3 * LEDCompositor::CHANNEL_MA);
+  TEST_ASSERT_EQUAL_UINT32(requested, LEDCompositor::getRequestedCurrentMa());
+  TEST_ASSERT_LESS_OR_EQUAL(LED_MAX_CURRENT_MA, LEDCompositor::getEstimatedCurrentMa());
+  TEST_ASSERT_GREATER_OR_EQUAL(LED_MAX_CURRENT_MA - 5, LEDCompositor::getEstimatedCurrentMa());
+
+  // Même facteur sur tous les canaux, et sortie cohérente avec le budget
+  const uint8_t r = channel(0, 16);
+  TEST_ASSERT_EQUAL_UINT8(r, channel(0, 8));
+  TEST_ASSERT_EQUAL_UINT8(r, channel(0, 0));
+  const double budget = (LED_MAX_CURRENT_MA - NUM_LEDS * LEDCompositor::IDLE_MA) /
+                        (double)(NUM_LEDS * 3 * LEDCompositor::CHANNEL_MA);
+  TEST_ASSERT_TRUE(fabs(r - 255 * budget) <= 1.0);
+
+  // Teinte conservée : rapports entre canaux inchangés
+  fillBase(0xFFC080);
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 0, &s_strip);
+  TEST_ASSERT_GREATER_THAN(LED_MAX_CURRENT_MA, LEDCompositor::getRequestedCurrentMa());
+  TEST_ASSERT_TRUE(fabs(channel(0, 8) / (double)channel(0, 16) - 0xC0 / 255.0) < 0.02);
+  TEST_ASSERT_TRUE(fabs(channel(0, 0) / (double)channel(0, 16) - 0x80 / 255.0) < 0.02);
+
+  // Sous le budget : pas d'atténuation
+  fillBase(0x404040);
+  LEDCompositor::compose(s_base, NUM_LEDS, LEDCompositor::LEVEL_MAX, 0, &s_strip);
+  TEST_ASSERT_EQUAL_UINT32(LEDCompositor::getRequestedCurrentMa(), LEDCompositor::getEstimatedCurrentMa());
+  TEST_ASSERT_EQUAL_UINT8(0x40, channel(0, 16));
+}
+
+void test_bench_compose_cycles() {
+  constexpr int FRAMES = 20000;
+  for (int i = 0; i < NUM_LEDS; i++) s_base[i] = 0x102030 * (i + 1);
+  LEDCompositor::setOverlay(LED_OVERLAY_TOUCH, 0x0000FF, 180, 60000, LED_OVERLAY_PULSE, 0);
+  const uint64_t c0 = HostBench::cycles();
+  for (int f = 0; f < FRAMES; f++) {
+    LEDCompositor::compose(s_base, NUM_LEDS, 180 * 257, f * 16, &s_strip);
+  }
+  const uint64_t c1 = HostBench::cycles();
+  HostBench::keep(s_strip.getPixels());
+
+  char line[96];
+  snprintf(line, sizeof(line), "compose : %llu cycles par trame (%d LEDs, un calque pulse)",
+           (unsigned long long)((c1 - c0) / FRAMES), NUM_LEDS);
+  TEST_MESSAGE(line);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_master_level_within_one_step);
+  RUN_TEST(test_low_brightness_stays_visible);
+  RUN_TEST(test_dither_mean_matches_16_bit_value);
+  RUN_TEST(test_no_flicker_below_one_step);
+  RUN_TEST(test_overlay_fades_over_dark_base);
+  RUN_TEST(test_overlay_masks_base_and_stacks);
+  RUN_TEST(test_current_limit);
+  RUN_TEST(test_bench_compose_cycles);
+  return UNITY_END();
+}
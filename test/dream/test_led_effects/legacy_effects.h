@@ -0,0 +1,208 @@
+#ifndef KIDOO_TEST_LEGACY_EFFECTS_H
+#define KIDOO_TEST_LEGACY_EFFECTS_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Anciens noyaux des effets LED (LEDManager::updateEffects avant le passage
+ * en virgule fixe), gardés comme référence de test_led_effects
+ *
+ * Calculs repris tels quels (sin() en double, divisions par LED) ; seul
+ * l'accès à la bande change : pixels[] au lieu de strip->setPixelColor(), et
+ * t (ms depuis le démarrage de l'effet) au lieu des static *StartTime.
+ * GLOSSY avançait d'un cran par appel : ici d'un cran par 16 ms, la cadence
+ * que le nouveau noyau a rendue explicite.
+ */
+namespace LegacyEffects {
+
+inline uint32_t hsvToRgb(uint8_t h, uint8_t s, uint8_t v) {
+  uint8_t r, g, b;
+  if (s == 0) {
+    r = g = b = v;
+  } else {
+    uint8_t region = h / 43;
+    uint8_t remainder = (h - (region * 43)) * 6;
+    uint8_t p = (v * (255 - s)) >> 8;
+    uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+      case 0: r = v; g = t; b = p; break;
+      case 1: r = q; g = v; b = p; break;
+      case 2: r = p; g = v; b = t; break;
+      case 3: r = p; g = q; b = v; break;
+      case 4: r = t; g = p; b = v; break;
+      default: r = v; g = p; b = q; break;
+    }
+  }
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+inline uint32_t fade(uint32_t color, uint8_t value) {
+  uint8_t r = (color >> 16) & 0xFF;
+  uint8_t g = (color >> 8) & 0xFF;
+  uint8_t b = color & 0xFF;
+  r = (r * value) / 255;
+  g = (g * value) / 255;
+  b = (b * value) / 255;
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+inline void rainbow(uint32_t* px, int n, uint32_t t, uint32_t cycleMs, uint8_t s, uint8_t v) {
+  uint32_t elapsed = t % cycleMs;
+  uint16_t baseHue = (elapsed * 256) / cycleMs;
+  for (int i = 0; i < n; i++) {
+    uint16_t ledHue = (baseHue + (i * 256) / n) % 256;
+    px[i] = hsvToRgb((uint8_t)ledHue, s, v);
+  }
+}
+
+inline void pulse(uint32_t* px, int n, uint32_t t, uint32_t cycleMs, uint32_t color) {
+  uint32_t elapsed = t % cycleMs;
+  uint16_t phase = (elapsed * 1024) / cycleMs;
+  const uint8_t PULSE_MIN = 30;
+  const uint8_t PULSE_RANGE = 255 - PULSE_MIN;
+  uint8_t pulseValue;
+  if (phase < 512) {
+    uint16_t smoothPhase = (phase * phase) / 512;
+    pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
+  } else {
+    uint16_t smoothPhase = 511 - (phase - 512);
+    smoothPhase = (smoothPhase * smoothPhase) / 512;
+    pulseValue = PULSE_MIN + ((smoothPhase * PULSE_RANGE) / 512);
+  }
+  const uint32_t pulseColor = fade(color, pulseValue);
+  for (int i = 0; i < n; i++) px[i] = pulseColor;
+}
+
+inline void glossy(uint32_t* px, int n, uint32_t t) {
+  const uint8_t offset = (uint8_t)(t / 16);
+  for (int i = 0; i < n; i++) {
+    uint8_t hue = ((i * 256 / n) + offset) % 256;
+    px[i] = hsvToRgb(hue, 200, 255);
+  }
+}
+
+inline void rotate(uint32_t* px, int n, uint32_t t, uint32_t color) {
+  const uint32_t ROTATE_CYCLE_MS = 5000;
+  uint32_t elapsed = t % ROTATE_CYCLE_MS;
+  uint32_t headPositionPrecise = (elapsed * n * 256) / ROTATE_CYCLE_MS;
+  const uint8_t snakeLength = (n * 30) / 100;
+  for (int i = 0; i < n; i++) px[i] = 0;
+  for (int ledIndex = 0; ledIndex < n; ledIndex++) {
+    int32_t ledPositionPrecise = ((int32_t)ledIndex * 256) + 128;
+    int32_t distanceToHead = headPositionPrecise - ledPositionPrecise;
+    if (distanceToHead > (n * 256) / 2) {
+      distanceToHead -= (n * 256);
+    } else if (distanceToHead < -(n * 256) / 2) {
+      distanceToHead += (n * 256);
+    }
+    int32_t absDistance = (distanceToHead < 0) ? -distanceToHead : distanceToHead;
+    int32_t maxSnakeDistance = snakeLength * 256;
+    if (absDistance > maxSnakeDistance) {
+      px[ledIndex] = 0;
+      continue;
+    }
+    uint8_t intensity;
+    if (absDistance == 0) {
+      intensity = 255;
+    } else {
+      uint32_t fadeFactor = maxSnakeDistance - absDistance;
+      uint32_t x = (fadeFactor * 256) / maxSnakeDistance;
+      uint32_t fadeValue;
+      if (x < 80) {
+        fadeValue = (x * x) / 80;
+      } else if (x < 180) {
+        fadeValue = 80 + ((x - 80) * (x - 80)) / 40;
+      } else {
+        fadeValue = 330 + ((x - 180) * (x - 180) * (x - 180)) / 300;
+      }
+      if (fadeValue > 256) fadeValue = 256;
+      intensity = 15 + ((fadeValue * 240) / 256);
+      if (intensity < 15) intensity = 15;
+    }
+    px[ledIndex] = fade(color, intensity);
+  }
+}
+
+inline void nightlight(uint32_t* px, int n, uint32_t t, uint8_t brightness) {
+  const uint32_t NIGHTLIGHT_CYCLE_MS = 6000;
+  uint32_t elapsed = t % NIGHTLIGHT_CYCLE_MS;
+  float scrollOffset = ((float)elapsed / (float)NIGHTLIGHT_CYCLE_MS) * (float)(n * 2);
+  const uint8_t BLUE_R = 30, BLUE_G = 100, BLUE_B = 255;
+  const uint8_t WHITE_R = 200, WHITE_G = 220, WHITE_B = 255;
+  for (int i = 0; i < n; i++) {
+    float position = (float)i - scrollOffset;
+    float wave1 = sin((position / (float)n) * 2.0 * M_PI * 1.5) * 0.5 + 0.5;
+    float wave2 = sin((position / (float)n) * 2.0 * M_PI * 2.5 + (M_PI / 3.0)) * 0.5 + 0.5;
+    float wave3 = sin((position / (float)n) * 2.0 * M_PI * 4.0 + (M_PI / 2.0)) * 0.3 + 0.3;
+    float blueFactor = wave1 * 0.6 + wave3 * 0.4;
+    float whiteFactor = wave2 * 0.2;
+    blueFactor = blueFactor * 0.7 + 0.3;
+    float total = blueFactor + whiteFactor;
+    if (total > 1.0) {
+      blueFactor /= total;
+      whiteFactor /= total;
+    }
+    uint8_t r = (uint8_t)(BLUE_R * blueFactor + WHITE_R * whiteFactor);
+    uint8_t g = (uint8_t)(BLUE_G * blueFactor + WHITE_G * whiteFactor);
+    uint8_t b = (uint8_t)(BLUE_B * blueFactor + WHITE_B * whiteFactor);
+    px[i] = fade(((uint32_t)r << 16) | ((uint32_t)g << 8) | b, brightness);
+  }
+}
+
+// État de BREATHE (les static de l'ancien case), remis à zéro avec l'effet
+struct BreatheState {
+  int currentColorIndex = 0;
+  uint32_t colorChangeStartTime = 0;
+  uint8_t previousR = 30, previousG = 100, previousB = 255;
+};
+
+inline void breathe(uint32_t* px, int n, uint32_t t, uint8_t brightness, BreatheState& st) {
+  static const uint8_t colors[][3] = {
+    {30, 100, 255}, {100, 150, 255}, {150, 100, 255}, {255, 100, 150},
+    {255, 150, 100}, {150, 255, 150}, {255, 200, 100}
+  };
+  const int numColors = sizeof(colors) / sizeof(colors[0]);
+  const uint32_t COLOR_CHANGE_INTERVAL_MS = 30000;
+  const uint32_t COLOR_TRANSITION_DURATION_MS = 2000;
+
+  int newColorIndex = t / COLOR_CHANGE_INTERVAL_MS;
+  if (newColorIndex != st.currentColorIndex) {
+    st.previousR = colors[st.currentColorIndex % numColors][0];
+    st.previousG = colors[st.currentColorIndex % numColors][1];
+    st.previousB = colors[st.currentColorIndex % numColors][2];
+    st.currentColorIndex = newColorIndex;
+    st.colorChangeStartTime = t;
+  }
+  uint8_t targetR = colors[st.currentColorIndex % numColors][0];
+  uint8_t targetG = colors[st.currentColorIndex % numColors][1];
+  uint8_t targetB = colors[st.currentColorIndex % numColors][2];
+
+  uint32_t transitionElapsed = t - st.colorChangeStartTime;
+  uint8_t currentR, currentG, currentB;
+  if (transitionElapsed < COLOR_TRANSITION_DURATION_MS) {
+    float transitionFactor = (float)transitionElapsed / (float)COLOR_TRANSITION_DURATION_MS;
+    float easedFactor = transitionFactor * transitionFactor * (3.0 - 2.0 * transitionFactor);
+    currentR = (uint8_t)(st.previousR + (targetR - st.previousR) * easedFactor);
+    currentG = (uint8_t)(st.previousG + (targetG - st.previousG) * easedFactor);
+    currentB = (uint8_t)(st.previousB + (targetB - st.previousB) * easedFactor);
+  } else {
+    currentR = targetR;
+    currentG = targetG;
+    currentB = targetB;
+  }
+
+  const uint32_t BREATHE_CYCLE_MS = 3000;
+  uint32_t breatheElapsed = t % BREATHE_CYCLE_MS;
+  float breatheFactor = sin((float)breatheElapsed / (float)BREATHE_CYCLE_MS * 2.0 * M_PI) * 0.35 + 0.65;
+  uint8_t r = (uint8_t)(currentR * breatheFactor);
+  uint8_t g = (uint8_t)(currentG * breatheFactor);
+  uint8_t b = (uint8_t)(currentB * breatheFactor);
+  const uint32_t color = fade(((uint32_t)r << 16) | ((uint32_t)g << 8) | b, brightness);
+  for (int i = 0; i < n; i++) px[i] = color;
+}
+
+} // namespace LegacyEffects
+
+#endif // KIDOO_TEST_LEGACY_EFFECTS_H
@@ -0,0 +1,267 @@
+/**
+ * Effets LED du Dream : noyaux entiers vs anciens noyaux flottants (env:native)
+ *
+ * - Chaque effet du registre LEDEffects est rendu sur FRAMES trames de
+ *   FRAME_MS (NUM_LEDS LEDs) et comparé trame par trame à l'ancien code
+ *   (legacy_effects.h) : écart par canal borné effet par effet.
+ * - Benchmark : cycles par trame de chaque effet, ancien vs nouveau, sur le
+ *   même nombre de trames (meilleure de RUNS passes). Chiffres de l'hôte, qui
+ *   a une FPU : l'écart sur l'ESP32-C3 (flottants émulés) est plus grand.
+ * - TIMELINE : timelines refusées (vide, trop longue, non triée), adoption
+ *   au reset seulement, interpolation, maintien avant la première et après
+ *   la dernière keyframe, saut à temps égal, boucle.
+ *
+ *   pio test -e native_dream -f dream/test_led_effects -v
+ */
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include "host_bench.h"
+#include "legacy_effects.h"
+#include "models/model_config.h"
+#include "common/managers/led/led_effects.h"
+#include "common/managers/led/led_math.h"
+
+namespace {
+
+constexpr uint32_t FRAME_MS = 16;   // Cadence RMT (LEDManager::SHOW_INTERVAL_MS)
+constexpr int FRAMES = 4400;        // ~70 s : plusieurs changements de couleur de BREATHE
+constexpr int RUNS = 5;
+constexpr uint32_t COLOR = 0xFFA040;
+constexpr uint8_t BRIGHTNESS = 200;
+
+struct EffectCase {
+  LEDEffect id;
+  int maxError;       // Écart max toléré par canal
+  double meanError;   // Écart moyen toléré par canal
+};
+
+// Bornes : PULSE / ROTATE gardent les mêmes courbes entières ; NIGHTLIGHT et
+// BREATHE passent de sin() à sin8 ; RAINBOW / GLOSSY peuvent prendre la teinte
+// voisine (un pas sur 256, jusqu'à ~6 par canal et par arrondi de hsvToRgb)
+// quand l'arrondi de la phase tombe de l'autre côté
+const EffectCase CASES[] = {
+  { LED_EFFECT_RAINBOW,      16, 1.0 },
+  { LED_EFFECT_RAINBOW_SOFT, 16, 1.0 },
+  { LED_EFFECT_PULSE,         1, 0.5 },
+  { LED_EFFECT_PULSE_FAST,    1, 0.5 },
+  { LED_EFFECT_GLOSSY,       16, 1.0 },
+  { LED_EFFECT_ROTATE,        1, 0.5 },
+  { LED_EFFECT_NIGHTLIGHT,    3, 1.0 },
+  { LED_EFFECT_BREATHE,       3, 1.0 },
+};
+
+uint32_t newPixels[NUM_LEDS];
+uint32_t oldPixels[NUM_LEDS];
+LegacyEffects::BreatheState legacyBreathe;
+
+LEDFrame makeFrame() {
+  LEDFrame frame;
+  frame.pixels = newPixels;
+  frame.count = NUM_LEDS;
+  frame.color = COLOR;
+  frame.brightness = BRIGHTNESS;
+  return frame;
+}
+
+void renderLegacy(LEDEffect id, uint32_t t) {
+  switch (id) {
+    case LED_EFFECT_RAINBOW:      LegacyEffects::rainbow(oldPixels, NUM_LEDS, t, 3000, 255, 255); break;
+    case LED_EFFECT_RAINBOW_SOFT: LegacyEffects::rainbow(oldPixels, NUM_LEDS, t, 30000, 200, 180); break;
+    case LED_EFFECT_PULSE:        LegacyEffects::pulse(oldPixels, NUM_LEDS, t, 2500, COLOR); break;
+    case LED_EFFECT_PULSE_FAST:   LegacyEffects::pulse(oldPixels, NUM_LEDS, t, 800, COLOR); break;
+    case LED_EFFECT_GLOSSY:       LegacyEffects::glossy(oldPixels, NUM_LEDS, t); break;
+    case LED_EFFECT_ROTATE:       LegacyEffects::rotate(oldPixels, NUM_LEDS, t, COLOR); break;
+    case LED_EFFECT_NIGHTLIGHT:   LegacyEffects::nightlight(oldPixels, NUM_LEDS, t, BRIGHTNESS); break;
+    case LED_EFFECT_BREATHE:      LegacyEffects::breathe(oldPixels, NUM_LEDS, t, BRIGHTNESS, legacyBreathe); break;
+    default: break;
+  }
+}
+
+LEDEffectRenderer* rendererFor(LEDEffect id) {
+  const LEDEffectInfo* info = LEDEffects::get(id);
+  TEST_ASSERT_NOT_NULL(info);
+  TEST_ASSERT_NOT_NULL(info->renderer);
+  return info->renderer;
+}
+
+void compareEffect(const EffectCase& c) {
+  LEDEffectRenderer* renderer = rendererFor(c.id);
+  renderer->reset();
+  legacyBreathe = LegacyEffects::BreatheState();
+  LEDFrame frame = makeFrame();
+
+  int worst = 0;
+  uint64_t sum = 0, channels = 0;
+  for (int f = 0; f < FRAMES; f++) {
+    const uint32_t t = f * FRAME_MS;
+    renderer->render(frame, t);
+    renderLegacy(c.id, t);
+    for (int i = 0; i < NUM_LEDS; i++) {
+      for (int shift = 0; shift <= 16; shift += 8) {
+        const int d = abs((int)((newPixels[i] >> shift) & 0xFF) - (int)((oldPixels[i] >> shift) & 0xFF));
+        if (d > worst) worst = d;
+        sum += d;
+        channels++;
+      }
+    }
+  }
+
+  const double mean = (double)sum / channels;
+  char line[120];
+  snprintf(line, sizeof(line), "%-13s ecart max %3d, moyen %.3f", LEDEffects::get(c.id)->name, worst, mean);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(c.maxError, worst, line);
+  TEST_ASSERT_TRUE_MESSAGE(mean <= c.meanError, line);
+}
+
+// Meilleure passe de FRAMES trames, en cycles par trame
+template <typename Render>
+uint64_t cyclesPerFrame(Render render) {
+  uint64_t best = UINT64_MAX;
+  for (int r = 0; r < RUNS; r++) {
+    const uint64_t c0 = HostBench::cycles();
+    for (int f = 0; f < FRAMES; f++) render(f * FRAME_MS);
+    const uint64_t c1 = HostBench::cycles();
+    if (c1 - c0 < best) best = c1 - c0;
+  }
+  return best / FRAMES;
+}
+
+LEDTimeline makeTimeline(std::initializer_list<LEDKeyframe> keys, bool loop) {
+  LEDTimeline timeline = {};
+  for (const LEDKeyframe& key : keys) timeline.keys[timeline.count++] = key;
+  timeline.loop = loop;
+  return timeline;
+}
+
+// Couleur de toute la bande à t (l'effet TIMELINE remplit d'une seule couleur)
+uint32_t timelineAt(uint32_t t) {
+  LEDFrame frame = makeFrame();
+  rendererFor(LED_EFFECT_TIMELINE)->render(frame, t);
+  for (int i = 1; i < NUM_LEDS; i++) TEST_ASSERT_EQUAL_HEX32(newPixels[0], newPixels[i]);
+  return newPixels[0];
+}
+
+void playTimeline(const LEDTimeline& timeline) {
+  TEST_ASSERT_TRUE(LEDEffects::setTimeline(timeline));
+  rendererFor(LED_EFFECT_TIMELINE)->reset();
+}
+
+} // namespace
+
+void setUp() {
+  LEDEffects::init();
+}
+
+void tearDown() {}
+
+void test_kernels_match_legacy() {
+  for (const EffectCase& c : CASES) compareEffect(c);
+}
+
+void test_bench_cycles_per_frame() {
+  for (const EffectCase& c : CASES) {
+    LEDEffectRenderer* renderer = rendererFor(c.id);
+    LEDFrame frame = makeFrame();
+    renderer->reset();
+    const uint64_t now = cyclesPerFrame([&](uint32_t t) {
+      renderer->render(frame, t);
+      HostBench::keep(newPixels);
+    });
+    legacyBreathe = LegacyEffects::BreatheState();
+    const uint64_t old = cyclesPerFrame([&](uint32_t t) {
+      renderLegacy(c.id, t);
+      HostBench::keep(oldPixels);
+    });
+
+    char line[120];
+    snprintf(line, sizeof(line), "%-13s cycles/trame ancien %6llu  nouveau %6llu  (x%.1f)",
+             LEDEffects::get(c.id)->name, (unsigned long long)old, (unsigned long long)now,
+             now > 0 ? (double)old / now : 0.0);
+    TEST_MESSAGE(line);
+  }
+}
+
+void test_timeline_rejects_invalid() {
+  LEDTimeline empty = {};
+  TEST_ASSERT_FALSE(LEDEffects::setTimeline(empty));
+
+  LEDTimeline tooLong = {};
+  for (uint8_t i = 0; i < LEDTimeline::MAX_KEYFRAMES; i++) {
+    tooLong.keys[i] = { i * 100u, 0xFFFFFF, 255 };
+  }
+  tooLong.count = LEDTimeline::MAX_KEYFRAMES;
+  TEST_ASSERT_TRUE(LEDEffects::setTimeline(tooLong));
+  tooLong.count = LEDTimeline::MAX_KEYFRAMES + 1;
+  TEST_ASSERT_FALSE(LEDEffects::setTimeline(tooLong));
+
+  TEST_ASSERT_FALSE(LEDEffects::setTimeline(makeTimeline({ { 0, 0xFF0000, 255 }, { 500, 0x00FF00, 255 }, { 400, 0x0000FF, 255 } }, false)));
+  // Deux keyframes au même instant : saut de couleur, accepté
+  TEST_ASSERT_TRUE(LEDEffects::setTimeline(makeTimeline({ { 0, 0xFF0000, 255 }, { 500, 0xFF0000, 255 }, { 500, 0x0000FF, 255 } }, false)));
+}
+
+// La timeline envoyée n'est prise qu'au reset de l'effet ; une timeline
+// refusée ne remplace pas celle en attente
+void test_timeline_adopted_on_reset() {
+  playTimeline(makeTimeline({ { 0, 0xFF0000, 255 } }, false));
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, timelineAt(0));
+
+  TEST_ASSERT_TRUE(LEDEffects::setTimeline(makeTimeline({ { 0, 0x00FF00, 255 } }, false)));
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, timelineAt(100));
+  TEST_ASSERT_FALSE(LEDEffects::setTimeline(makeTimeline({ { 10, 0x0000FF, 255 }, { 0, 0x0000FF, 255 } }, false)));
+  rendererFor(LED_EFFECT_TIMELINE)->reset();
+  TEST_ASSERT_EQUAL_HEX32(0x00FF00, timelineAt(100));
+}
+
+// Interpolation linéaire de la couleur et du niveau, valeurs tenues avant la
+// première keyframe et après la dernière (sans boucle)
+void test_timeline_interpolates_and_holds() {
+  playTimeline(makeTimeline({ { 200, 0x000000, 0 }, { 1224, 0xFF8040, 255 } }, false));
+
+  TEST_ASSERT_EQUAL_HEX32(0, timelineAt(0));
+  TEST_ASSERT_EQUAL_HEX32(0, timelineAt(200));
+  // Mi-chemin : fraction 128/256
+  TEST_ASSERT_EQUAL_HEX32(LEDMath::scaleColor(0x7F4020, 127), timelineAt(712));
+  TEST_ASSERT_EQUAL_HEX32(0xFF8040, timelineAt(1224));
+  TEST_ASSERT_EQUAL_HEX32(0xFF8040, timelineAt(600000));
+
+  // Rouge croissant pas à pas sur tout le segment
+  uint32_t previous = 0;
+  for (uint32_t t = 200; t <= 1224; t += 8) {
+    const uint32_t red = (timelineAt(t) >> 16) & 0xFF;
+    TEST_ASSERT_GREATER_OR_EQUAL(previous, red);
+    previous = red;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0xFF, previous);
+}
+
+void test_timeline_step_at_equal_times() {
+  playTimeline(makeTimeline({ { 0, 0xFF0000, 255 }, { 500, 0xFF0000, 255 }, { 500, 0x0000FF, 255 }, { 1000, 0x0000FF, 255 } }, false));
+  TEST_ASSERT_EQUAL_HEX32(0xFF0000, timelineAt(499));
+  TEST_ASSERT_EQUAL_HEX32(0x0000FF, timelineAt(500));
+}
+
+// Avec boucle : période = instant de la dernière keyframe
+void test_timeline_loops() {
+  playTimeline(makeTimeline({ { 0, 0x000000, 255 }, { 500, 0xFFFFFF, 255 }, { 1000, 0x000000, 255 } }, true));
+  for (uint32_t t = 0; t < 1000; t += 50) {
+    TEST_ASSERT_EQUAL_HEX32(timelineAt(t), timelineAt(t + 1000));
+    TEST_ASSERT_EQUAL_HEX32(timelineAt(t), timelineAt(t + 7 * 1000));
+  }
+  TEST_ASSERT_EQUAL_HEX32(0xFFFFFF, timelineAt(3500));
+  TEST_ASSERT_EQUAL_HEX32(0x000000, timelineAt(3000));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_kernels_match_legacy);
+  RUN_TEST(test_bench_cycles_per_frame);
+  RUN_TEST(test_timeline_rejects_invalid);
+  RUN_TEST(test_timeline_adopted_on_reset);
+  RUN_TEST(test_timeline_interpolates_and_holds);
+  RUN_TEST(test_timeline_step_at_equal_times);
+  RUN_TEST(test_timeline_loops);
+  return UNITY_END();
+}
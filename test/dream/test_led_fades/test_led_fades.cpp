@@ -0,0 +1,161 @@
+/**
+ * Fondus du niveau maître et calques vus depuis la bande (env:native)
+ *
+ * La vraie tâche LED tourne (thread hôte) ; le test avance l'horloge
+ * virtuelle d'un intervalle d'envoi à la fois et attend la trame envoyée,
+ * puis relit la bande (HostDream::shownFrame) :
+ * - fondu vers le sleep : continu, sans saut, jusqu'au noir ;
+ * - réveil pendant ce fondu : le fondu d'entrée repart du niveau atteint ;
+ * - calque d'alerte en sleep mode : visible par-dessus la base éteinte,
+ *   qui reste éteinte à la fin du calque.
+ * L'extinction en fin de startFadeOutAndClear() est couverte par
+ * test_led_mailbox.
+ *
+ *   pio test -e native_dream -f dream/test_led_fades -v
+ */
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+#include "host_dream.h"
+#include "models/model_config.h"
+#include "common/config/default_config.h"
+#include "common/managers/led/led_manager.h"
+#include "common/managers/log/log_manager.h"
+
+namespace {
+
+constexpr int WAIT_STEPS = 2000;
+constexpr int FADE_FRAMES = SLEEP_FADE_DURATION_MS / LEDManager::SHOW_INTERVAL_MS;
+// Plus grand écart d'une trame à la suivante pendant un fondu d'une seconde
+// (pente de la gamma 2,2 en haut de course : ~9 pas par trame)
+constexpr int MAX_STEP = 12;
+
+uint32_t frame[NUM_LEDS];
+
+void step() {
+  HostClock::advance(LEDManager::SHOW_INTERVAL_MS);
+  std::this_thread::sleep_for(std::chrono::microseconds(500));
+}
+
+template <typename Condition>
+bool waitFor(Condition condition) {
+  for (int i = 0; i < WAIT_STEPS; i++) {
+    if (condition()) return true;
+    step();
+  }
+  return condition();
+}
+
+// Une trame de plus : l'horloge avance d'un intervalle d'envoi, puis attente
+// (temps réel) de l'envoi par la tâche LED. Rend le rouge de la LED 0
+int nextFrame() {
+  const uint32_t shows = HostDream::shownFrame(frame, NUM_LEDS);
+  HostClock::advance(LEDManager::SHOW_INTERVAL_MS);
+  for (int i = 0; i < 2000 && HostDream::shownFrame(frame, NUM_LEDS) == shows; i++) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return (frame[0] >> 16) & 0xFF;
+}
+
+bool frameIs(uint32_t color) {
+  HostDream::shownFrame(frame, NUM_LEDS);
+  for (int i = 0; i < NUM_LEDS; i++) {
+    if (frame[i] != color) return false;
+  }
+  return true;
+}
+
+void assertSmooth(const std::vector<int>& levels, bool falling) {
+  for (size_t i = 1; i < levels.size(); i++) {
+    const int delta = falling ? levels[i - 1] - levels[i] : levels[i] - levels[i - 1];
+    if (delta < -1 || delta > MAX_STEP) {
+      char message[80];
+      snprintf(message, sizeof(message), "trame %u : %d -> %d", (unsigned)i, levels[i - 1], levels[i]);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+bool s_ready = false;
+
+} // namespace
+
+void setUp() {
+  if (!s_ready) {
+    LogManager::setLogLevel(LOG_LEVEL_WARNING);
+    TEST_ASSERT_TRUE(LEDManager::init());
+    s_ready = true;
+  }
+  LEDManager::allowSleep();
+  LEDManager::setEffect(LED_EFFECT_NONE);
+  LEDManager::clearOverlay(LED_OVERLAY_ALERT);
+  LEDManager::setBrightness(HostDream::LED_BRIGHTNESS);
+  LEDManager::setColor(255, 0, 0);  // Sous le budget de courant : rouge plein
+  LEDManager::wakeUp();
+  TEST_ASSERT_TRUE(waitFor([]() { return !LEDManager::getSleepState() && frameIs(0xFF0000); }));
+}
+
+void tearDown() {}
+
+void test_sleep_fade_is_continuous() {
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  std::vector<int> levels = { 255 };
+  while ((int)levels.size() < FADE_FRAMES * 2 && !(LEDManager::getSleepState() && levels.back() == 0)) {
+    levels.push_back(nextFrame());
+  }
+  TEST_ASSERT_EQUAL_INT(0, levels.back());
+  TEST_ASSERT_TRUE(LEDManager::getSleepState());
+  TEST_ASSERT_GREATER_OR_EQUAL(FADE_FRAMES - 3, (int)levels.size());
+  assertSmooth(levels, true);
+}
+
+// Réveil à mi-fondu : pas de saut à noir ni à pleine luminosité
+void test_wake_during_sleep_fade_resumes() {
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  std::vector<int> levels = { 255 };
+  for (int i = 0; i < FADE_FRAMES / 2; i++) levels.push_back(nextFrame());
+  TEST_ASSERT_TRUE(LEDManager::getSleepState());
+  TEST_ASSERT_TRUE(levels.back() > 10 && levels.back() < 200);
+  assertSmooth(levels, true);
+
+  // Réveil appliqué par la tâche LED avant la trame suivante
+  LEDManager::wakeUp();
+  for (int i = 0; i < 2000 && LEDManager::getSleepState(); i++) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  std::vector<int> rising = { levels.back() };
+  while ((int)rising.size() < FADE_FRAMES * 2 && rising.back() < 255) {
+    rising.push_back(nextFrame());
+  }
+  TEST_ASSERT_EQUAL_INT(255, rising.back());
+  TEST_ASSERT_FALSE(LEDManager::getSleepState());
+  // Reprise depuis le niveau atteint : environ la moitié du fondu
+  TEST_ASSERT_LESS_OR_EQUAL(FADE_FRAMES / 2 + 4, (int)rising.size());
+  assertSmooth(rising, false);
+}
+
+// En sleep mode, le calque s'affiche sans réveiller la base
+void test_overlay_visible_while_sleeping() {
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  TEST_ASSERT_TRUE(waitFor([]() { return LEDManager::getSleepState() && frameIs(0); }));
+
+  LEDManager::showOverlay(LED_OVERLAY_ALERT, 0, 0, 255, 255, 1500);
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return frameIs(0x0000FF); }), "calque invisible en sleep");
+  TEST_ASSERT_TRUE(LEDManager::getSleepState());
+
+  TEST_ASSERT_TRUE(waitFor([]() { return frameIs(0); }));
+  for (int i = 0; i < 20; i++) step();
+  TEST_ASSERT_TRUE(frameIs(0));
+  TEST_ASSERT_TRUE(LEDManager::getSleepState());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sleep_fade_is_continuous);
+  RUN_TEST(test_wake_during_sleep_fade_resumes);
+  RUN_TEST(test_overlay_visible_while_sleeping);
+  return UNITY_END();
+}
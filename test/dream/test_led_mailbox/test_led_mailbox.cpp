@@ -0,0 +1,255 @@
+/**
+ * Boîte aux lettres de LEDManager sous concurrence (env:native)
+ *
+ * La vraie tâche LED tourne (thread hôte) pendant que plusieurs producteurs
+ * appellent les setters, wakeUp(), preventSleep()/allowSleep() et les calques.
+ * Seule la tâche LED écrit l'état du sleep mode et de l'effet : après chaque
+ * rafale, la dernière demande doit être appliquée (aucune mise à jour perdue,
+ * y compris quand les relectures de readMailbox sont épuisées). La remise à
+ * zéro des stats d'envoi passe aussi par la tâche LED.
+ *
+ * L'horloge millis() est virtuelle : le test l'avance par pas de trame pour
+ * laisser passer les envois (SHOW_INTERVAL_MS) et le timeout du sleep mode.
+ *
+ *   pio test -e native_dream -f dream/test_led_mailbox -v
+ *
+ * Sous ThreadSanitizer (courses de données sur l'état de la tâche LED) :
+ *
+ *   PLATFORMIO_BUILD_FLAGS="-fsanitize=thread -g" \
+ *     pio test -e native_dream -f dream/test_led_mailbox -v
+ */
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+#include "host_dream.h"
+#include "models/model_config.h"
+#include "common/managers/led/led_manager.h"
+#include "common/managers/log/log_manager.h"
+
+namespace {
+
+constexpr int PRODUCERS = 4;
+constexpr int ROUNDS = 200;
+constexpr int BURST = 50;
+constexpr int WAIT_STEPS = 2000;  // Pas de trame avant d'abandonner une attente
+
+const uint32_t PRIMARIES[] = { 0xFF0000, 0x00FF00, 0x0000FF };
+
+uint32_t frame[NUM_LEDS];
+
+// Une trame de plus : l'horloge virtuelle avance d'un intervalle d'envoi et
+// la tâche LED a le temps de faire un tour
+void step() {
+  HostClock::advance(LEDManager::SHOW_INTERVAL_MS);
+  std::this_thread::sleep_for(std::chrono::microseconds(500));
+}
+
+// Toutes les LEDs allumées sur les seuls canaux de color (luminosité et
+// gamma appliqués par le compositeur : on ne compare que les canaux)
+bool frameIs(uint32_t color) {
+  HostDream::shownFrame(frame, NUM_LEDS);
+  for (int i = 0; i < NUM_LEDS; i++) {
+    for (int shift = 0; shift <= 16; shift += 8) {
+      const bool expected = ((color >> shift) & 0xFF) != 0;
+      const bool lit = ((frame[i] >> shift) & 0xFF) != 0;
+      if (expected != lit) return false;
+    }
+  }
+  return true;
+}
+
+template <typename Condition>
+bool waitFor(Condition condition) {
+  for (int i = 0; i < WAIT_STEPS; i++) {
+    if (condition()) return true;
+    step();
+  }
+  return condition();
+}
+
+template <typename Producer>
+void runProducers(Producer producer) {
+  std::vector<std::thread> threads;
+  for (int p = 0; p < PRODUCERS; p++) {
+    threads.emplace_back(producer, p);
+  }
+  for (std::thread& t : threads) t.join();
+}
+
+bool s_ready = false;
+
+} // namespace
+
+void setUp() {
+  if (!s_ready) {
+    LogManager::setLogLevel(LOG_LEVEL_WARNING);
+    TEST_ASSERT_TRUE(LEDManager::init());
+    s_ready = true;
+  }
+  // Partir réveillé, sans effet ni calque
+  LEDManager::allowSleep();
+  LEDManager::setEffect(LED_EFFECT_NONE);
+  LEDManager::clearOverlay(LED_OVERLAY_TOUCH);
+  LEDManager::clearOverlay(LED_OVERLAY_ALERT);
+  LEDManager::setBrightness(HostDream::LED_BRIGHTNESS);
+  LEDManager::wakeUp();
+  waitFor([]() { return !LEDManager::getSleepState(); });
+}
+
+void tearDown() {}
+
+// Rafales concurrentes de couleurs / luminosités / effets : chaque tour se
+// termine sur une couleur connue, publiée par tous les producteurs
+void test_burst_last_color_wins() {
+  for (int round = 0; round < ROUNDS; round++) {
+    const uint32_t target = PRIMARIES[round % 3];
+    runProducers([round, target](int p) {
+      uint32_t seed = 0x9E3779B9u * (round * PRODUCERS + p + 1);
+      for (int i = 0; i < BURST; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        LEDManager::setColor(seed >> 24, seed >> 16, seed >> 8);
+        LEDManager::setBrightness(HostDream::LED_BRIGHTNESS);
+        if ((seed & 7) == 0) LEDManager::setEffect(LED_EFFECT_NONE);
+        if ((seed & 15) == 1) LEDManager::wakeUp();
+      }
+      LEDManager::setColor(target >> 16, target >> 8, target);
+    });
+    char message[64];
+    snprintf(message, sizeof(message), "tour %d : couleur 0x%06X jamais affichee", round, (unsigned)target);
+    TEST_ASSERT_TRUE_MESSAGE(waitFor([target]() { return frameIs(target); }), message);
+  }
+}
+
+// Une seule demande publiée pendant que la tâche LED relit : elle doit être
+// appliquée sans qu'une demande suivante ne vienne la débloquer
+void test_single_request_not_lost() {
+  for (int round = 0; round < ROUNDS * 5; round++) {
+    const uint32_t target = PRIMARIES[round % 3];
+    std::atomic<bool> go(false);
+    std::thread producer([&go, target]() {
+      while (!go.load()) {}
+      LEDManager::setColor(target >> 16, target >> 8, target);
+    });
+    go.store(true);
+    // Avancer l'horloge en même temps : la tâche LED tourne pendant la publication
+    HostClock::advance(LEDManager::SHOW_INTERVAL_MS);
+    producer.join();
+    TEST_ASSERT_TRUE_MESSAGE(waitFor([target]() { return frameIs(target); }),
+                             "demande isolee perdue");
+  }
+}
+
+// Sleep mode après le timeout, puis réveil demandé par wakeUp() pendant que
+// d'autres tâches basculent preventSleep() / allowSleep()
+void test_wake_up_from_sleep_under_contention() {
+  LEDManager::setColor(0, 0, 255);
+  TEST_ASSERT_TRUE(waitFor([]() { return frameIs(0x0000FF); }));
+
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return LEDManager::getSleepState() && frameIs(0); }),
+                           "pas de sleep mode apres le timeout");
+
+  // Couleur noire et effet NONE ne réveillent pas
+  LEDManager::setColor(0, 0, 0);
+  LEDManager::setEffect(LED_EFFECT_NONE);
+  for (int i = 0; i < 20; i++) step();
+  TEST_ASSERT_TRUE(LEDManager::getSleepState());
+
+  runProducers([](int p) {
+    for (int i = 0; i < BURST * 4; i++) {
+      if ((i + p) & 1) {
+        LEDManager::preventSleep();
+      } else {
+        LEDManager::allowSleep();
+      }
+    }
+    LEDManager::allowSleep();
+  });
+  LEDManager::setColor(0, 255, 0);
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return !LEDManager::getSleepState() && frameIs(0x00FF00); }),
+                           "reveil perdu");
+
+  // Sleep réautorisé par la dernière demande : le timeout repart de l'activité
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return LEDManager::getSleepState(); }),
+                           "allowSleep() perdu");
+
+  // preventSleep() seul réveille aussi (politique appliquée par la tâche LED)
+  LEDManager::preventSleep();
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return !LEDManager::getSleepState() && frameIs(0x00FF00); }),
+                           "preventSleep() n'a pas reveille");
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS * 2);
+  for (int i = 0; i < 20; i++) step();
+  TEST_ASSERT_FALSE(LEDManager::getSleepState());
+  LEDManager::allowSleep();
+}
+
+// Un calque visible repousse le sleep mode (activité portée par la boîte aux lettres)
+void test_overlay_counts_as_activity() {
+  LEDManager::setColor(255, 0, 0);
+  TEST_ASSERT_TRUE(waitFor([]() { return frameIs(0xFF0000); }));
+
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS - 1000);
+  LEDManager::showOverlay(LED_OVERLAY_TOUCH, 0, 0, 255, 255, 500);
+  // Le timeout compte depuis le calque : encore éveillé 1,5 s après l'échéance initiale
+  for (int i = 0; i < 1500 / (int)LEDManager::SHOW_INTERVAL_MS; i++) step();
+  TEST_ASSERT_FALSE(LEDManager::getSleepState());
+  TEST_ASSERT_TRUE(waitFor([]() { return frameIs(0xFF0000); }));
+}
+
+// Fondu de sortie demandé depuis une autre tâche : extinction à la fin du fondu
+void test_fade_out_and_clear() {
+  LEDManager::preventSleep();
+  LEDManager::setColor(0, 255, 0);
+  TEST_ASSERT_TRUE(waitFor([]() { return frameIs(0x00FF00); }));
+
+  std::thread([]() { LEDManager::startFadeOutAndClear(); }).join();
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() { return frameIs(0); }), "fondu de sortie perdu");
+
+  // Le fondu a réautorisé le sleep mode
+  HostClock::advance(HostDream::SLEEP_TIMEOUT_MS);
+  TEST_ASSERT_TRUE(waitFor([]() { return LEDManager::getSleepState(); }));
+}
+
+// Remise à zéro des stats depuis d'autres tâches pendant les envois : faite
+// par la tâche LED (la sortie simulée compte celles venues d'ailleurs), le
+// compteur d'envois repart de zéro
+void test_stats_reset_by_led_task() {
+  // Effet animé : une trame envoyée (et mesurée) à chaque intervalle
+  LEDManager::setEffect(LED_EFFECT_RAINBOW);
+  const uint32_t before = HostDream::sentFrames();  // Envois des tests précédents
+  TEST_ASSERT_TRUE(before > 100);
+
+  std::atomic<bool> stop(false);
+  std::thread frames([&stop]() {
+    while (!stop.load()) step();
+  });
+  runProducers([](int) {
+    for (int i = 0; i < BURST; i++) {
+      LEDManager::resetShowStats();
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+  stop.store(true);
+  frames.join();
+
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([before]() { return HostDream::sentFrames() < before / 2; }),
+                           "remise a zero perdue");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, HostDream::foreignStatsResets(), "remise a zero hors de la tache LED");
+  LEDManager::setEffect(LED_EFFECT_NONE);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_burst_last_color_wins);
+  RUN_TEST(test_single_request_not_lost);
+  RUN_TEST(test_wake_up_from_sleep_under_contention);
+  RUN_TEST(test_overlay_counts_as_activity);
+  RUN_TEST(test_fade_out_and_clear);
+  RUN_TEST(test_stats_reset_by_led_task);
+  return UNITY_END();
+}
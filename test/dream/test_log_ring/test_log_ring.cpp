@@ -0,0 +1,230 @@
+/**
+ * File de logs différée de LogManager (env:native)
+ *
+ * La vraie tâche LogTask tourne (thread hôte) et sa sortie Serial est
+ * capturée (host_serial.h) :
+ * - chaque conversion gérée (d/i/u/x/X/o, h/hh/l/ll/z/j/t, c, p, e/f/g,
+ *   largeur, précision, drapeaux, %s, %%) rend le texte de snprintf ;
+ * - %s recopié à l'appel, (null) pour un pointeur nul, heure de l'appel ;
+ * - écriture directe (%*d, %Lf, message trop long) : même texte ;
+ * - 4 producteurs, 1 consommateur, en rafales puis sans pause (file
+ *   pleine) : ordre conservé par producteur, reçus + perdus = envoyés,
+ *   pertes signalées par LogTask.
+ * flush() rend la main une fois les lignes écrites.
+ *
+ *   PLATFORMIO_BUILD_FLAGS="-fsanitize=thread -g" pio test -e native_dream -f dream/test_log_ring
+ */
+#include <unity.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+#include "host_serial.h"
+#include "common/managers/log/log_manager.h"
+
+namespace {
+
+// Lignes capturées, sans l'heure : "[INFO] message"
+std::vector<std::string> capturedLines() {
+  std::vector<std::string> lines;
+  const std::string text = HostSerialCapture::text();
+  size_t start = 0;
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    if (end == std::string::npos) end = text.size();
+    const std::string line = text.substr(start, end - start);
+    const size_t prefix = line.find("] ");
+    lines.push_back(prefix == std::string::npos ? line : line.substr(prefix + 2));
+    start = end + 1;
+  }
+  return lines;
+}
+
+// Un message passé par la file doit rendre exactement le texte de snprintf
+template <typename... Args>
+void checkFormat(const char* format, Args... args) {
+  char expected[512];
+  snprintf(expected, sizeof(expected), format, args...);
+
+  HostSerialCapture::start();
+  LogManager::info(format, args...);
+  LogManager::flush();
+  const std::vector<std::string> lines = capturedLines();
+  HostSerialCapture::stop();
+
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, lines.size(), format);
+  TEST_ASSERT_EQUAL_STRING_MESSAGE((std::string("[INFO] ") + expected).c_str(), lines[0].c_str(), format);
+}
+
+bool s_ready = false;
+
+} // namespace
+
+void setUp() {
+  if (!s_ready) {
+    LogManager::init();
+    s_ready = true;
+  }
+  LogManager::setLogLevel(LOG_LEVEL_DEBUG);
+}
+
+void tearDown() {
+  HostSerialCapture::stop();
+}
+
+void test_integer_conversions() {
+  checkFormat("%d %i %u", -42, 7, 4000000000u);
+  checkFormat("%x %X %o %#x", 0xBEEFu, 0xBEEFu, 8u, 255u);
+  checkFormat("%hd %hhu %hhd", (short)-3, (unsigned char)200, (signed char)-5);
+  checkFormat("%ld %lu %lx", -1234567L, 3000000000UL, 0xDEADUL);
+  checkFormat("%lld %llu", -9000000000LL, 18000000000ULL);
+  checkFormat("%zu %jd %td", sizeof(double), (intmax_t)-77, (ptrdiff_t)-12);
+  checkFormat("[%5d] [%-5d] [%05d] [%+d] [% d]", 42, 42, 42, 42, 42);
+  checkFormat("%08.3lx|%.0d|%c%c", 0xABCL, 0, 'o', 'k');
+}
+
+void test_double_and_pointer_conversions() {
+  int local = 0;
+  checkFormat("%f %.2f %10.3f %-8.1f|", 3.14159, -2.005, 1e6 / 7, 0.25);
+  checkFormat("%e %E %g %G", 12345.678, 0.000123, 0.0001, 1e20);
+  checkFormat("%.3g %a", 2.0 / 3, 1.5);
+  checkFormat("%lf %5.1lf", 1.0 / 3, 99.95);
+  checkFormat("%p %p", (void*)&local, (void*)nullptr);
+}
+
+void test_strings_and_percent() {
+  checkFormat("%s", "");
+  checkFormat("nom=%s, %d%% fait", "dream", 75);
+  checkFormat("[%8s] [%-8s] [%.3s]", "ab", "cd", "abcdef");
+  checkFormat("%s %s %s", "un", "deux", "trois");
+  checkFormat("%%%%");
+  checkFormat("sans argument");
+}
+
+// Format pas gérés en différé, message trop long : écrits directement
+void test_direct_write_fallback() {
+  checkFormat("[%*d]", 6, 42);
+  checkFormat("%Lf", (long double)1.5);
+  std::string longText(200, 'x');
+  checkFormat("%s!", longText.c_str());
+}
+
+// %s recopié à l'appel, (null) pour un pointeur nul
+void test_string_copied_at_call() {
+  char buffer[32];
+  strcpy(buffer, "avant");
+  HostSerialCapture::start();
+  LogManager::info("%s|%s", buffer, (const char*)nullptr);
+  strcpy(buffer, "apres");
+  LogManager::flush();
+  const std::vector<std::string> lines = capturedLines();
+  TEST_ASSERT_EQUAL_UINT32(1, lines.size());
+  TEST_ASSERT_EQUAL_STRING("[INFO] avant|(null)", lines[0].c_str());
+}
+
+// Heure de l'appel (pas celle de l'écriture), préfixe du niveau
+void test_timestamp_and_level() {
+  HostClock::set(3723004);  // 1 h 02 min 03,004 s
+  HostSerialCapture::start();
+  LogManager::error("code %d", 5);
+  HostClock::advance(5000);
+  LogManager::warning("suite");
+  LogManager::debug("detail");
+  LogManager::flush();
+  const std::string text = HostSerialCapture::text();
+  TEST_ASSERT_EQUAL_STRING(
+    "[01:02:03.004] [ERROR] code 5\n"
+    "[01:02:08.004] [WARNING] suite\n"
+    "[01:02:08.004] [DEBUG] detail\n",
+    text.c_str());
+
+  // Sous le niveau minimum : rien
+  HostSerialCapture::start();
+  LogManager::setLogLevel(LOG_LEVEL_WARNING);
+  LogManager::info("masque");
+  LogManager::flush();
+  TEST_ASSERT_EQUAL_STRING("", HostSerialCapture::text().c_str());
+}
+
+// 4 producteurs, 1 consommateur : chaque message arrive une fois, dans
+// l'ordre de son producteur, ou est compté comme perdu (file pleine).
+// Rend le nombre de messages perdus
+uint32_t runProducers(int messages, bool paced) {
+  constexpr int PRODUCERS = 4;
+  const uint32_t droppedBefore = LogManager::getDroppedCount();
+
+  HostSerialCapture::start();
+  std::vector<std::thread> producers;
+  for (int p = 0; p < PRODUCERS; p++) {
+    producers.emplace_back([p, messages, paced]() {
+      for (int i = 0; i < messages; i++) {
+        LogManager::info("p%d n%d %s", p, i, "charge utile");
+        // Rafales de 16 : LogTask vide la file pendant que les producteurs écrivent
+        if (paced && i % 16 == 15) std::this_thread::sleep_for(std::chrono::microseconds(200));
+      }
+    });
+  }
+  for (std::thread& producer : producers) producer.join();
+  LogManager::flush();
+
+  const uint32_t dropped = LogManager::getDroppedCount() - droppedBefore;
+  // Pertes signalées par LogTask au passage suivant
+  uint32_t reported = 0;
+  for (int wait = 0; wait < 1000; wait++) {
+    reported = 0;
+    for (const std::string& line : capturedLines()) {
+      unsigned long count;
+      if (sscanf(line.c_str(), "[WARNING] [LOG] %lu message(s)", &count) == 1) reported += count;
+    }
+    if (reported == dropped) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  TEST_ASSERT_EQUAL_UINT32(dropped, reported);
+
+  int next[PRODUCERS] = {};
+  uint32_t received = 0;
+  for (const std::string& line : capturedLines()) {
+    int p, i;
+    if (sscanf(line.c_str(), "[INFO] p%d n%d", &p, &i) != 2) continue;
+    TEST_ASSERT_TRUE(p >= 0 && p < PRODUCERS);
+    TEST_ASSERT_GREATER_OR_EQUAL(next[p], i);  // Jamais en double ni en arrière
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("charge utile", line.substr(line.size() - 12).c_str(), line.c_str());
+    next[p] = i + 1;
+    received++;
+  }
+  HostSerialCapture::stop();
+
+  char message[64];
+  snprintf(message, sizeof(message), "%u recus, %u perdus", (unsigned)received, (unsigned)dropped);
+  TEST_MESSAGE(message);
+  TEST_ASSERT_TRUE(received > 0);
+  TEST_ASSERT_EQUAL_UINT32(PRODUCERS * messages, received + dropped);
+  return dropped;
+}
+
+void test_concurrent_producers() {
+  runProducers(3000, true);
+}
+
+// Écritures sans pause : la file de 64 cases déborde forcément
+void test_full_queue_drops_and_reports() {
+  TEST_ASSERT_GREATER_THAN(0u, runProducers(2000, false));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_integer_conversions);
+  RUN_TEST(test_double_and_pointer_conversions);
+  RUN_TEST(test_strings_and_percent);
+  RUN_TEST(test_direct_write_fallback);
+  RUN_TEST(test_string_copied_at_call);
+  RUN_TEST(test_timestamp_and_level);
+  RUN_TEST(test_concurrent_producers);
+  RUN_TEST(test_full_queue_drops_and_reports);
+  return UNITY_END();
+}
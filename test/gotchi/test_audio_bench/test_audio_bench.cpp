@@ -0,0 +1,165 @@
+/**
+ * Benchmark du mixeur GotchiAudio (env:native)
+ *
+ * Joue l'éternuement par chaque chemin de rendu (voix seule PCM au gain
+ * unitaire, PCM au gain 128, deux voix PCM, ADPCM seul) contre l'I2S simulé
+ * à DMA instantanée, et affiche le temps de rendu cumulé par la tâche
+ * (GotchiAudio::Stats::renderUs, hors écriture I2S) par seconde d'audio.
+ * Les mêmes sons passent aussi par une copie de l'ancien rendu (mixage int32,
+ * saturation puis expansion L = R en stéréo entrelacé, pour toute voix),
+ * chronométré dans la même exécution : c'est la référence des chemins mono.
+ * Ne vérifie pas de seuil : comme "speaker stats" sur la carte, les chiffres
+ * ne valent que pour comparer deux versions du code sur la même machine.
+ *
+ *   pio test -e native_gotchi -f gotchi/test_audio_bench -v
+ */
+#include <unity.h>
+#include <Arduino.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "host_i2s.h"
+#include "models/gotchi/audio/gotchi_audio.h"
+#include "models/gotchi/audio/ima_adpcm.h"
+#include "models/gotchi/audio/sounds/sound_sneeze.h"
+
+namespace {
+
+constexpr int RUNS = 20;
+
+std::vector<uint8_t> s_pcm;  // Éternuement décodé, PCM 16 bits LE
+
+void decodeSneeze() {
+  const uint32_t frames = ImaAdpcm::sampleCount(SNEEZE_ADPCM_LEN);
+  std::vector<int16_t> samples(frames);
+  ImaAdpcm::State st;
+  TEST_ASSERT_TRUE(ImaAdpcm::begin(st, SNEEZE_ADPCM, SNEEZE_ADPCM_LEN));
+  ImaAdpcm::decode(st, samples.data(), (int)frames);
+  s_pcm.resize(frames * 2);
+  for (uint32_t i = 0; i < frames; i++) {
+    s_pcm[2 * i] = (uint8_t)(samples[i] & 0xFF);
+    s_pcm[2 * i + 1] = (uint8_t)((uint16_t)samples[i] >> 8);
+  }
+}
+
+// Copie des stats prise pendant que la tâche est bloquée dans l'écriture
+// d'un bloc de silence : le dernier bloc du son mesuré est compté. Les 128
+// frames mixées de ce bloc sont retirées.
+GotchiAudio::Stats snapshotStats() {
+  static const uint8_t silence[GotchiAudio::MIX_FRAMES * 2] = {};
+  HostI2S::hold(true);
+  TEST_ASSERT_NOT_EQUAL(0, GotchiAudio::play(silence, sizeof(silence), 128));
+  while (!HostI2S::writerWaiting()) std::this_thread::sleep_for(std::chrono::microseconds(200));
+  GotchiAudio::Stats st = GotchiAudio::getStats();
+  HostI2S::hold(false);
+  st.frames -= GotchiAudio::MIX_FRAMES;
+  return st;
+}
+
+template <typename Play>
+void bench(const char* label, Play play) {
+  GotchiAudio::resetStats();  // Dans la file, avant la première voix
+  for (int r = 0; r < RUNS; r++) {
+    TEST_ASSERT_TRUE(GotchiAudio::wait(play()));
+    HostI2S::clearOutput();
+  }
+  const GotchiAudio::Stats st = snapshotStats();
+  TEST_ASSERT_TRUE(st.frames > 0);
+  const double audioS = (double)st.frames / GotchiAudio::SAMPLE_RATE;
+  char line[160];
+  snprintf(line, sizeof(line), "%s : %.2f s d'audio, %.1f us de rendu par seconde, %.0f%% en voix seule",
+           label, audioS, st.renderUs / audioS, 100.0 * st.directFrames / st.frames);
+  TEST_MESSAGE(line);
+}
+
+// Ancien rendu, bloc par bloc : toutes les voix mixées en int32, saturées
+// puis recopiées en stéréo L = R (le double d'octets pour l'I2S). Chaque
+// bloc est chronométré comme dans la tâche audio (renderUs)
+int32_t s_refMix[GotchiAudio::MIX_FRAMES];
+int16_t s_refOut[GotchiAudio::MIX_FRAMES * 2];
+int16_t s_refDec[ImaAdpcm::BLOCK_FRAMES];
+volatile int32_t s_refSink;  // Empêche le compilateur d'écarter le rendu
+
+uint32_t referenceRender(int voices, bool adpcm, uint8_t gain, uint64_t& renderUs) {
+  const uint32_t total = adpcm ? ImaAdpcm::sampleCount(SNEEZE_ADPCM_LEN) : (uint32_t)(s_pcm.size() / 2);
+  ImaAdpcm::State st[2];
+  for (int v = 0; v < voices; v++) {
+    if (adpcm) TEST_ASSERT_TRUE(ImaAdpcm::begin(st[v], SNEEZE_ADPCM, SNEEZE_ADPCM_LEN));
+  }
+  const uint8_t* p = s_pcm.data();
+  for (uint32_t done = 0; done < total; done += GotchiAudio::MIX_FRAMES) {
+    const int n = total - done < (uint32_t)GotchiAudio::MIX_FRAMES ? (int)(total - done) : GotchiAudio::MIX_FRAMES;
+    const uint32_t t0 = micros();
+    memset(s_refMix, 0, sizeof(s_refMix));
+    for (int v = 0; v < voices; v++) {
+      if (adpcm) {
+        for (int i = 0; i < n; i += ImaAdpcm::BLOCK_FRAMES) {
+          const int m = n - i < ImaAdpcm::BLOCK_FRAMES ? n - i : ImaAdpcm::BLOCK_FRAMES;
+          ImaAdpcm::decode(st[v], s_refDec, m);
+          for (int k = 0; k < m; k++) s_refMix[i + k] += ((int32_t)s_refDec[k] * gain) >> 8;
+        }
+      } else {
+        const uint8_t* q = p;
+        for (int i = 0; i < n; i++, q += 2) {
+          const int32_t sample = (int16_t)(q[0] | (q[1] << 8));
+          s_refMix[i] += (sample * gain) >> 8;
+        }
+      }
+    }
+    p += 2 * n;
+    for (int i = 0; i < GotchiAudio::MIX_FRAMES; i++) {
+      int32_t sample = s_refMix[i];
+      if (sample > 32767) sample = 32767;
+      if (sample < -32768) sample = -32768;
+      s_refOut[i * 2] = (int16_t)sample;
+      s_refOut[i * 2 + 1] = (int16_t)sample;
+    }
+    renderUs += micros() - t0;
+    s_refSink = s_refSink + s_refOut[2 * n - 1];
+  }
+  return total;
+}
+
+void benchReference(const char* label, int voices, bool adpcm, uint8_t gain) {
+  uint64_t frames = 0, renderUs = 0;
+  for (int r = 0; r < RUNS; r++) frames += referenceRender(voices, adpcm, gain, renderUs);
+  const double audioS = (double)frames / GotchiAudio::SAMPLE_RATE;
+  char line[160];
+  snprintf(line, sizeof(line), "reference stereo, %s : %.2f s d'audio, %.1f us de rendu par seconde",
+           label, audioS, renderUs / audioS);
+  TEST_MESSAGE(line);
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_audio_render_cost() {
+  decodeSneeze();
+  TEST_ASSERT_TRUE(GotchiAudio::init());
+  // Premier son : initialisation du matériel simulé, hors mesure
+  TEST_ASSERT_TRUE(GotchiAudio::wait(GotchiAudio::tone(440, 10, 10)));
+
+  bench("PCM seul, gain unitaire", []() { return GotchiAudio::play(s_pcm.data(), s_pcm.size()); });
+  bench("PCM seul, gain 128", []() { return GotchiAudio::play(s_pcm.data(), s_pcm.size(), 128); });
+  bench("deux voix PCM", []() {
+    GotchiAudio::play(s_pcm.data(), s_pcm.size());
+    return GotchiAudio::play(s_pcm.data(), s_pcm.size());
+  });
+  bench("ADPCM seul", []() { return GotchiAudio::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN); });
+
+  // Ancien rendu sur les mêmes sons, même machine, même exécution
+  benchReference("PCM seul, gain unitaire", 1, false, 255);
+  benchReference("PCM seul, gain 128", 1, false, 128);
+  benchReference("deux voix PCM", 2, false, 255);
+  benchReference("ADPCM seul", 1, true, 255);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_audio_render_cost);
+  return UNITY_END();
+}
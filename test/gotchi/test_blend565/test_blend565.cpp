@@ -0,0 +1,224 @@
+/**
+ * Noyaux de mélange Blend565 (env:native)
+ *
+ * - Précision : over() et overPremul() (avec et sans opacité) comparés au
+ *   mélange flottant, pour tout alpha et toute opacité sur des couleurs aux
+ *   bornes ; un débordement de canal apparaît comme un écart de 31 / 63.
+ * - overPremul avec opacité : une seule quantification de a * opacity, jamais
+ *   moins précis que l'ancien produit alpha5(a) * alpha5(opacity).
+ * - overRun() (2 pixels par mot) identique à over() pixel par pixel, dst
+ *   aligné ou non.
+ * - Benchmark : ns/pixel de l'ancien blend565 à divisions (Blend565::reference)
+ *   vs les noyaux, sans seuil (chiffres de l'hôte, voir HostBench).
+ *
+ *   pio test -e native_gotchi -f gotchi/test_blend565 -v
+ */
+#include <unity.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "host_bench.h"
+#include "models/gotchi/face/blend565.h"
+
+namespace {
+
+const uint16_t COLORS[] = { 0xFFFF, 0x0000, 0xF800, 0x07E0, 0x001F, 0x8410, 0x7BEF, 0x39C7 };
+
+constexpr int BENCH_PX = 4096;
+constexpr int BENCH_PASSES = 256;
+
+// Pré-multiplication des assets (png_to_sprite_rgba.py)
+uint16_t premultiply(uint16_t c, uint8_t a) {
+  return Blend565::pack((Blend565::spread(c) * Blend565::alpha5(a)) >> 5);
+}
+
+// overPremul avec opacité avant correction : opacité ramenée à 5 bits puis
+// produit des deux alphas 5 bits (double quantification)
+uint16_t oldOverPremul(uint16_t bg, uint16_t fgP, uint8_t a, uint8_t opacity) {
+  using namespace Blend565;
+  const uint32_t o = alpha5(opacity);
+  const uint32_t inv = 32 - ((alpha5(a) * o + 31) >> 5);
+  const uint32_t fgS = ((spread(fgP) * o) >> 5) & SPREAD_MASK;
+  return pack(fgS + (((spread(bg) * inv) >> 5) & SPREAD_MASK));
+}
+
+// Plus grand écart par canal (en pas du canal) entre out et le mélange exact
+double channelError(uint16_t out, uint16_t bg, uint16_t fg, double alpha) {
+  static const int SHIFT[3] = { 11, 5, 0 };
+  static const int MASK[3] = { 0x1F, 0x3F, 0x1F };
+  double worst = 0;
+  for (int i = 0; i < 3; i++) {
+    const double f = (fg >> SHIFT[i]) & MASK[i];
+    const double b = (bg >> SHIFT[i]) & MASK[i];
+    const double o = (out >> SHIFT[i]) & MASK[i];
+    worst = std::fmax(worst, std::fabs(o - (f * alpha + b * (1.0 - alpha))));
+  }
+  return worst;
+}
+
+struct Errors {
+  double maxNew = 0, maxOld = 0, sumNew = 0, sumOld = 0;
+  uint32_t count = 0;
+};
+
+Errors premulOpacityErrors() {
+  Errors e;
+  for (int a = 0; a < 256; a++) {
+    for (int op = 0; op < 256; op++) {
+      const double alpha = (a / 255.0) * (op / 255.0);
+      for (uint16_t fg : COLORS) {
+        const uint16_t fgP = premultiply(fg, (uint8_t)a);
+        for (uint16_t bg : COLORS) {
+          const double n = channelError(Blend565::overPremul(bg, fgP, a, op), bg, fg, alpha);
+          const double o = channelError(oldOverPremul(bg, fgP, a, op), bg, fg, alpha);
+          e.maxNew = std::fmax(e.maxNew, n);
+          e.maxOld = std::fmax(e.maxOld, o);
+          e.sumNew += n;
+          e.sumOld += o;
+          e.count++;
+        }
+      }
+    }
+  }
+  return e;
+}
+
+template <typename Blend>
+double benchNsPerPixel(std::vector<uint16_t>& dst, const std::vector<uint16_t>& src,
+                       const std::vector<uint8_t>& alpha, Blend blend) {
+  const uint64_t t0 = HostBench::nowNs();
+  for (int p = 0; p < BENCH_PASSES; p++) {
+    for (int i = 0; i < BENCH_PX; i++) dst[i] = blend(dst[i], src[i], alpha[i]);
+  }
+  const uint64_t t1 = HostBench::nowNs();
+  HostBench::keep(dst.data());
+  return (double)(t1 - t0) / ((double)BENCH_PX * BENCH_PASSES);
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_over_matches_float_blend() {
+  double worst = 0;
+  for (int a = 0; a < 256; a++) {
+    for (uint16_t fg : COLORS) {
+      for (uint16_t bg : COLORS) {
+        worst = std::fmax(worst, channelError(Blend565::over(bg, fg, a), bg, fg, a / 255.0));
+      }
+    }
+  }
+  // alpha sur 5 bits : au plus un demi-pas d'alpha (63 / 64) plus la troncature
+  TEST_ASSERT_TRUE_MESSAGE(worst < 2.0, "over() trop loin du melange exact");
+}
+
+void test_premul_matches_float_blend() {
+  double worst = 0;
+  for (int a = 0; a < 256; a++) {
+    for (uint16_t fg : COLORS) {
+      const uint16_t fgP = premultiply(fg, a);
+      for (uint16_t bg : COLORS) {
+        worst = std::fmax(worst, channelError(Blend565::overPremul(bg, fgP, a), bg, fg, a / 255.0));
+      }
+    }
+  }
+  // Comme over() + la troncature de la couleur pré-multipliée de l'asset
+  TEST_ASSERT_TRUE_MESSAGE(worst < 3.0, "overPremul() trop loin du melange exact");
+}
+
+void test_premul_opacity_bounds() {
+  for (int a = 0; a < 256; a++) {
+    for (uint16_t fg : COLORS) {
+      const uint16_t fgP = premultiply(fg, a);
+      for (uint16_t bg : COLORS) {
+        // Opacité pleine : identique au blend sans opacité ; nulle : fond intact
+        TEST_ASSERT_EQUAL_HEX16(Blend565::overPremul(bg, fgP, a), Blend565::overPremul(bg, fgP, a, 255));
+        TEST_ASSERT_EQUAL_HEX16(bg, Blend565::overPremul(bg, fgP, a, 0));
+      }
+    }
+  }
+}
+
+void test_premul_opacity_single_quantization() {
+  const Errors e = premulOpacityErrors();
+  char line[160];
+  snprintf(line, sizeof(line), "overPremul+opacite, ecart max %.2f (ancien %.2f), moyen %.3f (ancien %.3f)",
+           e.maxNew, e.maxOld, e.sumNew / e.count, e.sumOld / e.count);
+  TEST_MESSAGE(line);
+  // Budget : celui d'overPremul() + l'arrondi de a * opacity et la troncature
+  // du facteur de couleur. Blanc sur blanc compris : un canal qui déborde
+  // donnerait un écart >= 31
+  TEST_ASSERT_TRUE_MESSAGE(e.maxNew < 5.0, line);
+  TEST_ASSERT_TRUE_MESSAGE(e.maxNew <= e.maxOld, line);
+  TEST_ASSERT_TRUE_MESSAGE(e.sumNew < e.sumOld, line);
+}
+
+void test_over_run_matches_over() {
+  uint32_t seed = 0x12345678;
+  std::vector<uint16_t> src(67), base(68);
+  for (size_t i = 0; i < base.size(); i++) {
+    seed = seed * 1664525u + 1013904223u;
+    base[i] = (uint16_t)seed;
+    if (i < src.size()) src[i] = (uint16_t)(seed >> 16);
+  }
+  const uint8_t alphas[] = { 0, 1, 4, 77, 128, 200, 251, 255 };
+  for (uint8_t a : alphas) {
+    for (int offset = 0; offset < 2; offset++) {
+      for (int n = 0; n <= 67 - offset; n += 11) {
+        std::vector<uint16_t> run(base), ref(base);
+        Blend565::overRun(run.data() + offset, src.data(), n, a);
+        for (int i = 0; i < n; i++) ref[offset + i] = Blend565::over(ref[offset + i], src[i], a);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(ref.data(), run.data(), base.size());
+      }
+    }
+  }
+}
+
+void test_bench_against_reference() {
+  std::vector<uint16_t> dst(BENCH_PX), src(BENCH_PX);
+  std::vector<uint8_t> alpha(BENCH_PX);
+  uint32_t seed = 0x12345678;
+  for (int i = 0; i < BENCH_PX; i++) {
+    seed = seed * 1664525u + 1013904223u;
+    dst[i] = (uint16_t)seed;
+    src[i] = (uint16_t)(seed >> 16);
+    alpha[i] = (uint8_t)(seed >> 8);
+  }
+
+  const double ref = benchNsPerPixel(dst, src, alpha, [](uint16_t b, uint16_t f, uint8_t a) {
+    return Blend565::reference(b, f, a);
+  });
+  const double over = benchNsPerPixel(dst, src, alpha, [](uint16_t b, uint16_t f, uint8_t a) {
+    return Blend565::over(b, f, a);
+  });
+  const double premul = benchNsPerPixel(dst, src, alpha, [](uint16_t b, uint16_t f, uint8_t a) {
+    return Blend565::overPremul(b, f, a);
+  });
+  const double premulOp = benchNsPerPixel(dst, src, alpha, [](uint16_t b, uint16_t f, uint8_t a) {
+    return Blend565::overPremul(b, f, a, 180);
+  });
+
+  const uint64_t t0 = HostBench::nowNs();
+  for (int p = 0; p < BENCH_PASSES; p++) Blend565::overRun(dst.data(), src.data(), BENCH_PX, 128);
+  const uint64_t t1 = HostBench::nowNs();
+  HostBench::keep(dst.data());
+  const double run = (double)(t1 - t0) / ((double)BENCH_PX * BENCH_PASSES);
+
+  char line[200];
+  snprintf(line, sizeof(line),
+           "ns/pixel : ancien blend565 %.2f | over %.2f | overPremul %.2f | overPremul+opacite %.2f | overRun %.2f",
+           ref, over, premul, premulOp, run);
+  TEST_MESSAGE(line);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_over_matches_float_blend);
+  RUN_TEST(test_premul_matches_float_blend);
+  RUN_TEST(test_premul_opacity_bounds);
+  RUN_TEST(test_premul_opacity_single_quantization);
+  RUN_TEST(test_over_run_matches_over);
+  RUN_TEST(test_bench_against_reference);
+  return UNITY_END();
+}
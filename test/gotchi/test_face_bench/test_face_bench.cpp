@@ -0,0 +1,71 @@
+/**
+ * Benchmark du temps de frame de la face Gotchi (env:native)
+ *
+ * Rejoue FaceScenario plusieurs fois et affiche la distribution du temps par
+ * frame (behaviors + rendu + flush vers le panel capturé), puis la part
+ * rasterisation / flush et les octets poussés par frame d'après les stats
+ * du FaceRenderer. Deux passes : mono-bande synchrone, puis bi-bande + flush
+ * async (threads hôtes). Ne vérifie pas de seuil : les chiffres de l'hôte ne
+ * valent que pour comparer deux versions du code sur la même machine.
+ *
+ *   pio test -e native_gotchi -f gotchi/test_face_bench -v
+ */
+#include <unity.h>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "face_scenario.h"
+#include "models/gotchi/face/face_renderer.h"
+
+namespace {
+
+constexpr int RUNS = 5;
+
+void benchMode(const char* label, bool parallel, bool async) {
+  std::vector<uint32_t> times;
+  uint64_t rasterUs = 0, flushUs = 0, bytes = 0;
+  uint32_t frames = 0;
+  for (int r = 0; r < RUNS; r++) {
+    FaceRenderer::setParallelRaster(parallel);
+    FaceRenderer::setAsyncFlush(async);
+    FaceRenderer::resetRasterStats();
+    FaceRenderer::resetFlushStats();
+    FaceScenario::run(nullptr);
+    FaceRenderer::waitFlush();
+    const std::vector<uint32_t>& t = FaceScenario::frameTimesUs();
+    times.insert(times.end(), t.begin(), t.end());
+    rasterUs += FaceRenderer::getRasterStats().totalRasterUs;
+    flushUs += FaceRenderer::getFlushStats().totalFlushUs;
+    bytes += FaceRenderer::getFlushStats().totalBytes;
+    frames += FaceRenderer::getRasterStats().frames;
+  }
+  TEST_ASSERT_TRUE(!times.empty());
+  TEST_ASSERT_TRUE(frames > 0);
+
+  std::sort(times.begin(), times.end());
+  uint64_t sum = 0;
+  for (uint32_t v : times) sum += v;
+  char line[200];
+  snprintf(line, sizeof(line),
+           "%s: %u frames, us/frame moy %llu p50 %u p99 %u max %u | raster %llu us, flush %llu us, %llu octets par frame",
+           label, (unsigned)times.size(), (unsigned long long)(sum / times.size()),
+           times[times.size() / 2], times[times.size() * 99 / 100], times.back(),
+           (unsigned long long)(rasterUs / frames), (unsigned long long)(flushUs / frames),
+           (unsigned long long)(bytes / frames));
+  TEST_MESSAGE(line);
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_bench_single_band_sync() { benchMode("mono-bande sync", false, false); }
+void test_bench_dual_band_async() { benchMode("bi-bande async", true, true); }
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_single_band_sync);
+  RUN_TEST(test_bench_dual_band_async);
+  return UNITY_END();
+}
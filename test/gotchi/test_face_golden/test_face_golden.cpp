@@ -0,0 +1,49 @@
+/**
+ * Images golden de la face Gotchi (env:native)
+ *
+ * Joue FaceScenario en rendu mono-bande, flush synchrone, et compare l'écran
+ * capturé (466x466, RGB565) aux PNG de golden/ à chaque point de contrôle.
+ * Le panel ne reçoit que les rectangles du damage tracking : une zone oubliée
+ * au flush ou mal effacée laisse des pixels faux dans la capture.
+ */
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "face_scenario.h"
+#include "host_gotchi.h"
+#include "host_golden.h"
+#include "models/gotchi/face/face_renderer.h"
+
+namespace {
+
+std::vector<std::string> s_failures;
+std::vector<std::string> s_checked;
+
+void compareCheckpoint(const char* name) {
+  HostPanel& panel = HostGotchi::panel();
+  s_checked.push_back(name);
+  HostGolden::Result r = HostGolden::compareRgb565(HostGolden::goldenDir(__FILE__), name,
+                                                   panel.pixels(), panel.width(), panel.height(),
+                                                   panel.width());
+  if (!r.ok) s_failures.push_back(r.message);
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_scenario_matches_golden() {
+  FaceRenderer::setAsyncFlush(false);
+  FaceScenario::run(compareCheckpoint);
+  TEST_ASSERT_EQUAL_UINT32(8, s_checked.size());
+  std::string all;
+  for (const std::string& f : s_failures) all += f + "\n";
+  TEST_ASSERT_TRUE_MESSAGE(s_failures.empty(), all.c_str());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_scenario_matches_golden);
+  return UNITY_END();
+}
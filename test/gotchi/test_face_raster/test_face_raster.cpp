@@ -0,0 +1,204 @@
+/**
+ * Rasterisation bi-coeur du FaceRenderer (env:native)
+ *
+ * Une séquence scriptée pilote FaceRenderer::render() directement (pas de
+ * FaceEngine, dont l'état ne se réinitialise pas entre deux passes) : fondu
+ * entre toutes les expressions, regard qui balaie, clignement, bouche,
+ * bave, puis saleté, balle qui rebondit à travers la coupure des bandes,
+ * sprite, chip du haut, 💢 et 💤. L'empreinte de l'écran capturé est relevée
+ * à chaque frame. Référence : rendu mono-bande, flush synchrone. Doivent
+ * donner les mêmes empreintes, frame par frame :
+ * - deux bandes (tâche FaceRaster = thread hôte) ;
+ * - alternance une bande / deux bandes à chaque frame ;
+ * - deux bandes avec le flush async (pipeline).
+ *
+ * Sous ThreadSanitizer (courses entre tâche de rendu, FaceRaster et flush) :
+ *
+ *   PLATFORMIO_BUILD_FLAGS="-fsanitize=thread -g" \
+ *     pio test -e native_gotchi -f gotchi/test_face_raster -v
+ */
+#include <unity.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "host_clock.h"
+#include "host_gotchi.h"
+#include "host_random.h"
+#include "models/gotchi/config/gotchi_theme.h"
+#include "models/gotchi/face/face_config.h"
+#include "models/gotchi/face/face_renderer.h"
+#include "models/gotchi/face/behavior/behavior_engine.h"
+#include "models/gotchi/face/behavior/behavior_objects.h"
+#include "models/gotchi/face/behavior/dirt_overlay.h"
+#include "models/gotchi/face/behavior/top_chip.h"
+#include "models/gotchi/face/behavior/sprites/sprite_heart_24.h"
+#include "models/gotchi/face/overlay/face_overlay_layer.h"
+
+namespace {
+
+constexpr uint32_t FRAME_MS = 33;
+constexpr int FRAMES_PER_EXPRESSION = 12;
+constexpr int EXPRESSIONS = (int)FaceExpression::COUNT;
+constexpr int FRAMES = EXPRESSIONS * FRAMES_PER_EXPRESSION * 2;  // Deux tours des expressions
+
+enum class Mode { Single, Dual, Alternating };
+
+// FNV-1a 64 bits de l'écran entier
+uint64_t panelHash() {
+  const HostPanel& panel = HostGotchi::panel();
+  const uint16_t* p = panel.pixels();
+  const size_t n = (size_t)panel.width() * panel.height();
+  uint64_t h = 0xCBF29CE484222325ull;
+  for (size_t i = 0; i < n; i++) {
+    h = (h ^ (p[i] & 0xFF)) * 0x100000001B3ull;
+    h = (h ^ (p[i] >> 8)) * 0x100000001B3ull;
+  }
+  return h;
+}
+
+// Couches allumées / éteintes à des frames fixes du second tour
+void updateLayers(int frame) {
+  const int second = EXPRESSIONS * FRAMES_PER_EXPRESSION;
+  if (frame == second) DirtOverlay::setDirty(30.0f);
+  if (frame == second + 20) {
+    BehaviorObjects::spawn(ObjectShape::Circle, 0xFFD000, 22, 140, 150, 0.09f, 0.0f,
+                           0.0005f, 0.8f, false, 0);
+    BehaviorObjects::spawnSprite(SPRITE_HEART_24_ASSET, 0xFF3070, 300, 330, 0.0f, -0.03f,
+                                 0.0f, 0.0f, false, 0);
+  }
+  if (frame == second + 60) {
+    TopChip::show("38.5^C", 0xF800);
+    FaceOverlayLayer::setMangaCross(true);
+  }
+  if (frame == second + 100) {
+    DirtOverlay::clear();
+    FaceOverlayLayer::setMangaCross(false);
+    FaceOverlayLayer::setSleepZzz(true);
+  }
+  if (frame == second + 140) {
+    TopChip::hide();
+    BehaviorObjects::destroyAll();
+  }
+  BehaviorObjects::update(FRAME_MS);
+  FaceOverlayLayer::update(FRAME_MS);
+}
+
+void renderFrame(int frame) {
+  const int expr = (frame / FRAMES_PER_EXPRESSION) % EXPRESSIONS;
+  const float t = (float)(frame % FRAMES_PER_EXPRESSION) / FRAMES_PER_EXPRESSION;
+  const FacePreset from = FacePresets::getPreset((FaceExpression)expr);
+  const FacePreset to = FacePresets::getPreset((FaceExpression)((expr + 1) % EXPRESSIONS));
+  EyeConfig left = from.left.lerp(to.left, t);
+  EyeConfig right = from.right.lerp(to.right, t);
+
+  // Clignement toutes les 40 frames
+  const int blink = frame % 40;
+  if (blink < 4) {
+    const int16_t h = (int16_t)(left.height * (blink < 2 ? 0.15f : 0.5f));
+    left.height = right.height = h < 1 ? 1 : h;
+  }
+
+  BehaviorStats& stats = BehaviorEngine::getStats();
+  stats.droolLength = (frame / 50) % 3 == 1 ? (float)(frame % 50) : 0.0f;
+  stats.droolRetract = 0.0f;
+
+  const float lookX = 0.8f * sinf(frame * 0.07f);
+  const float lookY = 0.6f * sinf(frame * 0.05f + 1.0f);
+  const float mouth = sinf(frame * 0.09f);
+
+  updateLayers(frame);
+  FaceRenderer::render(left, right, lookX, lookY, mouth);
+}
+
+std::vector<uint64_t> runSequence(Mode mode, bool async) {
+  HostRandom::reset(1);
+  HostClock::set(0);
+  GotchiTheme::setPreset(GotchiTheme::Preset::Boy);
+  FaceOverlayLayer::init();
+  FaceRenderer::setAsyncFlush(async);
+  FaceRenderer::setParallelRaster(false);
+  FaceRenderer::resetScale();
+  FaceRenderer::clearViewport();
+  FaceRenderer::init();
+  FaceRenderer::resetRasterStats();
+
+  std::vector<uint64_t> hashes;
+  for (int frame = 0; frame < FRAMES; frame++) {
+    const bool dual = mode == Mode::Dual || (mode == Mode::Alternating && (frame & 1));
+    TEST_ASSERT_TRUE(FaceRenderer::setParallelRaster(dual));
+    renderFrame(frame);
+    FaceRenderer::waitFlush();
+    hashes.push_back(panelHash());
+    HostClock::advance(FRAME_MS);
+  }
+
+  BehaviorObjects::destroyAll();
+  DirtOverlay::clear();
+  TopChip::hide();
+  FaceOverlayLayer::setSleepZzz(false);
+  FaceRenderer::setParallelRaster(false);
+  FaceRenderer::setAsyncFlush(false);
+  return hashes;
+}
+
+std::vector<uint64_t> s_reference;
+
+const std::vector<uint64_t>& reference() {
+  if (s_reference.empty()) s_reference = runSequence(Mode::Single, false);
+  return s_reference;
+}
+
+void assertSameFrames(const std::vector<uint64_t>& actual, const char* mode) {
+  const std::vector<uint64_t>& expected = reference();
+  TEST_ASSERT_EQUAL_UINT32(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (expected[i] != actual[i]) {
+      char buf[96];
+      snprintf(buf, sizeof(buf), "%s : frame %u differente du rendu mono-bande", mode, (unsigned)i);
+      TEST_FAIL_MESSAGE(buf);
+    }
+  }
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+// Contrôle : deux passes mono-bande identiques (la séquence ne dépend que
+// de l'horloge et de la graine), et l'écran change bien au fil des frames
+void test_sequence_is_deterministic() {
+  const std::vector<uint64_t>& ref = reference();
+  size_t distinct = 0;
+  for (size_t i = 1; i < ref.size(); i++) distinct += ref[i] != ref[i - 1];
+  TEST_ASSERT_GREATER_THAN(FRAMES / 2, distinct);
+  assertSameFrames(runSequence(Mode::Single, false), "1 bande");
+}
+
+void test_dual_band_matches_single() {
+  const std::vector<uint64_t> dual = runSequence(Mode::Dual, false);
+  // Toutes les frames ont bien été dessinées en deux bandes
+  const FaceRenderer::RasterStats& rs = FaceRenderer::getRasterStats();
+  TEST_ASSERT_EQUAL_UINT32(rs.frames, rs.dualFrames);
+  assertSameFrames(dual, "2 bandes");
+}
+
+void test_alternating_modes_match_single() {
+  const std::vector<uint64_t> alternating = runSequence(Mode::Alternating, false);
+  const FaceRenderer::RasterStats& rs = FaceRenderer::getRasterStats();
+  TEST_ASSERT_EQUAL_UINT32(FRAMES / 2, rs.dualFrames);
+  assertSameFrames(alternating, "alternance");
+}
+
+void test_dual_band_async_flush_matches_single() {
+  assertSameFrames(runSequence(Mode::Dual, true), "2 bandes + flush async");
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sequence_is_deterministic);
+  RUN_TEST(test_dual_band_matches_single);
+  RUN_TEST(test_alternating_modes_match_single);
+  RUN_TEST(test_dual_band_async_flush_matches_single);
+  return UNITY_END();
+}
@@ -0,0 +1,120 @@
+/**
+ * Scale du visage (FaceRenderer::setScale) en virgule fixe (env:native)
+ *
+ * - mulQ30 doit donner exactement (int32_t)(v * s) évalué en float, ce que
+ *   faisait le renderer avant la géométrie entière, pour tout scale du
+ *   balayage et toute dimension du visage.
+ * - Balayage de zoom 0.40 -> 1.00 : chaque pas est comparé au pixel près à
+ *   golden/scale_<pct>.png, puis le zoom inverse ne doit laisser aucun résidu.
+ */
+#include <unity.h>
+#include <cstdio>
+#include <string>
+#include "host_clock.h"
+#include "host_gotchi.h"
+#include "host_golden.h"
+#include "host_random.h"
+#include "models/gotchi/config/gotchi_theme.h"
+#include "models/gotchi/face/face_config.h"
+#include "models/gotchi/face/face_fixed.h"
+#include "models/gotchi/face/face_renderer.h"
+
+namespace {
+
+constexpr int SWEEP_FIRST_PCT = 40;
+constexpr int SWEEP_LAST_PCT = 100;
+constexpr int SWEEP_STEP_PCT = 5;
+
+void renderScaled(float scale) {
+  const FacePreset p = FacePresets::getPreset(FaceExpression::Happy);
+  FaceRenderer::setScale(scale);
+  FaceRenderer::render(p.left, p.right, 0.3f, -0.2f, -0.7f);
+  FaceRenderer::waitFlush();
+  HostClock::advance(33);
+}
+
+bool backBufferMatchesPanel() {
+  const HostPanel& panel = HostGotchi::panel();
+  const uint16_t* fb = FaceRenderer::getNextBuffer();
+  const int16_t fbW = FaceRenderer::getFbW(), fbH = FaceRenderer::getFbH();
+  for (int16_t y = 0; y < fbH; y++) {
+    for (int16_t x = 0; x < fbW; x++) {
+      if (fb[y * fbW + x] != panel.pixel(FaceRenderer::getFbX() + x, FaceRenderer::getFbY() + y)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+void setUp() {
+  HostRandom::reset(1);
+  HostClock::set(0);
+  GotchiTheme::setPreset(GotchiTheme::Preset::Boy);
+  FaceRenderer::setAsyncFlush(false);
+  FaceRenderer::setParallelRaster(false);
+  FaceRenderer::clearViewport();
+  FaceRenderer::resetScale();
+  FaceRenderer::init();
+}
+
+void tearDown() {
+  FaceRenderer::resetScale();
+}
+
+void test_mul_q30_matches_float() {
+  uint32_t mismatches = 0;
+  char first[96] = "";
+  for (int step = 4; step <= 200; step++) {
+    const float s = step / 200.0f;
+    const int32_t q = FaceFixed::toQ30(s);
+    for (int32_t v = -1000; v <= 1000; v++) {
+      volatile float product = (float)v * s;  // Évalué en float, comme l'ancien code
+      if (FaceFixed::mulQ30(v, q) == (int32_t)product) continue;
+      if (!mismatches) {
+        snprintf(first, sizeof(first), "s=%.3f v=%d : %d au lieu de %d", s, (int)v,
+                 (int)FaceFixed::mulQ30(v, q), (int)(int32_t)product);
+      }
+      mismatches++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, mismatches, first);
+}
+
+void test_zoom_sweep_matches_golden() {
+  const HostPanel& panel = HostGotchi::panel();
+  for (int pct = SWEEP_FIRST_PCT; pct <= SWEEP_LAST_PCT; pct += SWEEP_STEP_PCT) {
+    renderScaled(pct / 100.0f);
+    renderScaled(pct / 100.0f);
+    char name[32];
+    snprintf(name, sizeof(name), "scale_%03d", pct);
+    HostGolden::Result r = HostGolden::compareRgb565(HostGolden::goldenDir(__FILE__), name,
+                                                     panel.pixels(), panel.width(), panel.height(),
+                                                     panel.width());
+    TEST_ASSERT_TRUE_MESSAGE(r.ok, r.message.c_str());
+  }
+}
+
+// Zoom avant puis arrière, une frame par pas : chaque frame n'efface que les
+// spans de la taille précédente, il ne doit rien rester au retour à 1.0
+void test_zoom_back_and_forth_leaves_no_residue() {
+  for (int pct = SWEEP_LAST_PCT; pct >= SWEEP_FIRST_PCT; pct--) renderScaled(pct / 100.0f);
+  for (int pct = SWEEP_FIRST_PCT; pct <= SWEEP_LAST_PCT; pct++) renderScaled(pct / 100.0f);
+  renderScaled(1.0f);
+  TEST_ASSERT_TRUE(backBufferMatchesPanel());
+  const HostPanel& panel = HostGotchi::panel();
+  HostGolden::Result r = HostGolden::compareRgb565(HostGolden::goldenDir(__FILE__), "scale_100",
+                                                   panel.pixels(), panel.width(), panel.height(),
+                                                   panel.width());
+  TEST_ASSERT_TRUE_MESSAGE(r.ok, r.message.c_str());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_mul_q30_matches_float);
+  RUN_TEST(test_zoom_sweep_matches_golden);
+  RUN_TEST(test_zoom_back_and_forth_leaves_no_residue);
+  return UNITY_END();
+}
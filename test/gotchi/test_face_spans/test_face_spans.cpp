@@ -0,0 +1,219 @@
+/**
+ * Primitives de span du FaceRenderer et effacement par spans (env:native)
+ *
+ * - Formes choisies pour couvrir fillRow16 (début pair/impair, longueurs
+ *   1, paires et impaires), le clipping aux bords du FB, les coins et pentes,
+ *   la bouche ouverte (fbFillRoundRect) et la bave (fbFillRect + fbHLine) :
+ *   chaque cas est comparé au pixel près à golden/<cas>.png, en une bande
+ *   puis en deux bandes.
+ * - Invariant clearBand/markDirty : tout ce qui est écrit dans le FB est
+ *   marqué, donc après deux frames identiques le buffer arrière est égal à
+ *   l'écran (aucun résidu d'une forme, d'un objet ou d'un chip précédent).
+ */
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "host_clock.h"
+#include "host_gotchi.h"
+#include "host_golden.h"
+#include "host_random.h"
+#include "models/gotchi/config/gotchi_theme.h"
+#include "models/gotchi/face/face_renderer.h"
+#include "models/gotchi/face/behavior/behavior_engine.h"
+#include "models/gotchi/face/behavior/behavior_objects.h"
+#include "models/gotchi/face/behavior/dirt_overlay.h"
+#include "models/gotchi/face/behavior/top_chip.h"
+
+namespace {
+
+struct SpanCase {
+  const char* name;
+  EyeConfig left, right;
+  float lookX, lookY, mouth;
+  float droolLength, droolRetract;
+};
+
+// Yeux : centres FB x = 118 et 308, y = 203 (FB de 426x410)
+const SpanCase CASES[] = {
+  // Rectangles sans arrondi : oeil gauche aligné, droit décalé d'un pixel
+  { "rect_parity",
+    { 41, 37, 0, 0, 0, 0, 0, 0 }, { 41, 37, 1, 0, 0, 0, 0, 0 }, 0, 0, 0, 0, 0 },
+  // Spans de 1 et 2 pixels (petite forme, chemin fillRoundRect)
+  { "thin",
+    { 24, 1, 0, 0, 0, 0, 0, 0 }, { 24, 2, 1, 0, 0, 0, 0, 0 }, 0, 0, 0, 0, 0 },
+  // Coins, pentes opposées, largeurs paire / impaire, regard en biais
+  { "rounded_slopes",
+    { 96, 60, 0, 0, 12, 20, 0.3f, -0.2f }, { 90, 61, 0, 3, 20, 8, -0.25f, 0.15f },
+    0.37f, -0.41f, 0, 0, 0 },
+  // Formes qui sortent du FB à gauche, à droite et en haut
+  { "clip_edges",
+    { 80, 80, -120, -180, 10, 10, 0, 0 }, { 80, 80, 120, 0, 10, 10, 0, 0 }, 0, 0, 0, 0, 0 },
+  // Bouche ouverte : contour, intérieur et langue en fbFillRoundRect
+  { "mouth_open",
+    { 90, 70, 0, 0, 18, 18, 0, 0 }, { 90, 70, 0, 0, 18, 18, 0, 0 }, 0, 0, -1.0f, 0, 0 },
+  // Sourire + bave : filet en fbFillRect, goutte en fbHLine
+  { "smile_drool",
+    { 70, 70, 0, 0, 30, 8, 0, 0 }, { 70, 70, 0, 0, 30, 8, 0, 0 }, -0.2f, 0.1f, 0.6f, 38, 9 },
+};
+
+constexpr size_t CASE_COUNT = sizeof(CASES) / sizeof(CASES[0]);
+
+void renderCase(const SpanCase& c) {
+  BehaviorStats& stats = BehaviorEngine::getStats();
+  stats.droolLength = c.droolLength;
+  stats.droolRetract = c.droolRetract;
+  FaceRenderer::render(c.left, c.right, c.lookX, c.lookY, c.mouth);
+  FaceRenderer::waitFlush();
+  HostClock::advance(33);
+}
+
+// Deux frames identiques : les deux buffers portent le cas
+void renderCaseStable(const SpanCase& c) {
+  renderCase(c);
+  renderCase(c);
+}
+
+// Le buffer arrière doit être exactement ce que montre l'écran sur la zone du FB
+bool backBufferMatchesPanel(std::string& where) {
+  const HostPanel& panel = HostGotchi::panel();
+  const uint16_t* fb = FaceRenderer::getNextBuffer();
+  const int16_t fbX = FaceRenderer::getFbX(), fbY = FaceRenderer::getFbY();
+  const int16_t fbW = FaceRenderer::getFbW(), fbH = FaceRenderer::getFbH();
+  for (int16_t y = 0; y < fbH; y++) {
+    for (int16_t x = 0; x < fbW; x++) {
+      if (fb[y * fbW + x] != panel.pixel(fbX + x, fbY + y)) {
+        char buf[96];
+        snprintf(buf, sizeof(buf), "FB (%d,%d) = 0x%04X, ecran 0x%04X", x, y,
+                 fb[y * fbW + x], panel.pixel(fbX + x, fbY + y));
+        where = buf;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void assertMatchesGolden(const char* name) {
+  const HostPanel& panel = HostGotchi::panel();
+  HostGolden::Result r = HostGolden::compareRgb565(HostGolden::goldenDir(__FILE__), name,
+                                                   panel.pixels(), panel.width(), panel.height(),
+                                                   panel.width());
+  TEST_ASSERT_TRUE_MESSAGE(r.ok, r.message.c_str());
+}
+
+void assertNoResidue() {
+  std::string where;
+  const bool same = backBufferMatchesPanel(where);
+  TEST_ASSERT_TRUE_MESSAGE(same, where.c_str());
+}
+
+uint32_t countEyePixels() {
+  const HostPanel& panel = HostGotchi::panel();
+  const uint16_t eye = GotchiTheme::getColors().eye;
+  uint32_t n = 0;
+  for (int32_t i = 0; i < (int32_t)panel.width() * panel.height(); i++) n += panel.pixels()[i] == eye;
+  return n;
+}
+
+void runGoldenCases(bool parallel) {
+  FaceRenderer::setParallelRaster(parallel);
+  for (const SpanCase& c : CASES) {
+    renderCaseStable(c);
+    // Un rendu vide ne doit pas pouvoir passer pour un golden
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, countEyePixels(), c.name);
+    assertMatchesGolden(c.name);
+    assertNoResidue();
+  }
+  FaceRenderer::setParallelRaster(false);
+}
+
+} // namespace
+
+void setUp() {
+  HostRandom::reset(1);
+  HostClock::set(0);
+  GotchiTheme::setPreset(GotchiTheme::Preset::Boy);
+  FaceRenderer::setAsyncFlush(false);
+  FaceRenderer::setParallelRaster(false);
+  FaceRenderer::resetScale();
+  FaceRenderer::clearViewport();
+  FaceRenderer::init();
+}
+
+void tearDown() {
+  BehaviorObjects::destroyAll();
+  DirtOverlay::clear();
+  TopChip::hide();
+}
+
+void test_span_cases_single_band() {
+  runGoldenCases(false);
+}
+
+void test_span_cases_dual_band() {
+  runGoldenCases(true);
+}
+
+// Chaque frame efface seulement les spans de la frame que porte le buffer :
+// enchaîner des formes différentes ne doit rien laisser derrière
+void test_clear_band_leaves_no_residue() {
+  for (size_t round = 0; round < 3; round++) {
+    for (size_t i = 0; i < CASE_COUNT; i++) renderCase(CASES[(i * 5 + round) % CASE_COUNT]);
+  }
+  renderCaseStable(CASES[0]);
+  assertMatchesGolden(CASES[0].name);
+  assertNoResidue();
+}
+
+// Les couches (saleté, objet à cheval sur les deux bandes, chip) marquent ce
+// qu'elles écrivent : une fois retirées, l'écran et les buffers redeviennent
+// ceux du visage seul
+void test_layers_mark_dirty() {
+  for (int parallel = 0; parallel < 2; parallel++) {
+    FaceRenderer::setParallelRaster(parallel != 0);
+    DirtOverlay::setDirty(20.0f);
+    BehaviorObjects::spawn(ObjectShape::Circle, 0x30C0FF, 24, 233, 235, 0.0f, 0.0f,
+                           0.0f, 0.0f, false, 0);
+    TopChip::show("42", 0x07E0);
+    renderCaseStable(CASES[2]);
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0x0000, HostGotchi::panel().pixel(233, 235),
+                                  "objet absent de l'ecran");
+
+    BehaviorObjects::destroyAll();
+    DirtOverlay::clear();
+    TopChip::hide();
+    renderCaseStable(CASES[0]);
+    assertMatchesGolden(CASES[0].name);
+    assertNoResidue();
+  }
+  FaceRenderer::setParallelRaster(false);
+}
+
+// Contrôle du test précédent : une écriture externe non marquée reste dans le
+// buffer sans jamais atteindre l'écran, markDirty() la fait effacer
+void test_unmarked_write_is_detected() {
+  renderCaseStable(CASES[0]);
+  uint16_t* fb = FaceRenderer::getNextBuffer();
+  const int16_t fbW = FaceRenderer::getFbW();
+  fb[10 * fbW + 11] = 0xF800;
+  renderCaseStable(CASES[0]);
+  std::string where;
+  TEST_ASSERT_FALSE(backBufferMatchesPanel(where));
+
+  // Même écriture, marquée : effacée par la frame suivante
+  fb = FaceRenderer::getNextBuffer();
+  fb[10 * fbW + 11] = 0xF800;
+  FaceRenderer::markDirty(11, 10, 1, 1);
+  renderCaseStable(CASES[0]);
+  assertNoResidue();
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_span_cases_single_band);
+  RUN_TEST(test_span_cases_dual_band);
+  RUN_TEST(test_clear_band_leaves_no_residue);
+  RUN_TEST(test_layers_mark_dirty);
+  RUN_TEST(test_unmarked_write_is_detected);
+  return UNITY_END();
+}
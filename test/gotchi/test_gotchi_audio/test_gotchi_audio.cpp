@@ -0,0 +1,438 @@
+/**
+ * Moteur audio GotchiAudio (env:native)
+ *
+ * La vraie tâche "GotchiAudio" tourne (thread hôte) contre un I2S simulé
+ * (host_i2s.h : sortie capturée, file DMA instantanée ou temps réel) et un
+ * ES8311 factice qui retient le volume. Les samples comparés sont ceux
+ * effectivement envoyés par la DMA.
+ *
+ * Pour que plusieurs commandes tombent dans le même bloc, la tâche est
+ * bloquée dans l'écriture d'un bloc de silence (HostI2S::hold) : les
+ * commandes s'empilent dans sa file et sont appliquées ensemble.
+ *
+ * Voix seule au gain unitaire (écrite sans mixeur) : sortie identique au
+ * bit près au PCM source, ou au décodage IMA-ADPCM de l'asset.
+ *
+ * Santé de la file DMA (DMA au rythme réel) : pas d'underrun en
+ * lecture normale et file pleine, underruns comptés quand la tâche écrit
+ * moins vite que la DMA, rien de compté au repos entre deux sons.
+ *
+ *   pio test -e native_gotchi -f gotchi/test_gotchi_audio -v
+ *
+ * Sous ThreadSanitizer (file de commandes, ids lus par isPlaying, underruns
+ * comptés par l'ISR) :
+ *
+ *   PLATFORMIO_BUILD_FLAGS="-fsanitize=thread -g" \
+ *     pio test -e native_gotchi -f gotchi/test_gotchi_audio -v
+ */
+#include <unity.h>
+#include <Arduino.h>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+#include "host_gotchi.h"
+#include "host_i2s.h"
+#include "models/gotchi/audio/gotchi_audio.h"
+#include "models/gotchi/audio/gotchi_synth.h"
+#include "models/gotchi/audio/ima_adpcm.h"
+#include "models/gotchi/audio/sounds/sound_sneeze.h"
+#include "models/gotchi/config/config.h"
+
+namespace {
+
+using GotchiAudio::MIX_FRAMES;
+using GotchiAudio::VoiceId;
+
+constexpr int WAIT_MS = 3000;  // Attente réelle max d'un état de la tâche
+
+// PCM 16 bits LE, frames samples de valeur value
+std::vector<uint8_t> dcPcm(int frames, int16_t value) {
+  std::vector<uint8_t> pcm(frames * 2);
+  for (int i = 0; i < frames; i++) {
+    pcm[2 * i] = (uint8_t)(value & 0xFF);
+    pcm[2 * i + 1] = (uint8_t)((uint16_t)value >> 8);
+  }
+  return pcm;
+}
+
+const std::vector<uint8_t> SILENCE = dcPcm(MIX_FRAMES, 0);
+
+// Frames jouées par playAdpcm() : tous les nibbles, dont le dernier de
+// remplissage quand SNEEZE_SAMPLES est impair
+const uint32_t SNEEZE_FRAMES = ImaAdpcm::sampleCount(SNEEZE_ADPCM_LEN);
+
+// Asset d'éternuement décodé d'un bloc (référence des chemins ADPCM)
+std::vector<int16_t> decodeSneeze() {
+  std::vector<int16_t> pcm(SNEEZE_FRAMES);
+  ImaAdpcm::State st;
+  TEST_ASSERT_TRUE(ImaAdpcm::begin(st, SNEEZE_ADPCM, SNEEZE_ADPCM_LEN));
+  ImaAdpcm::decode(st, pcm.data(), (int)pcm.size());
+  return pcm;
+}
+
+std::vector<uint8_t> toBytes(const std::vector<int16_t>& samples) {
+  std::vector<uint8_t> pcm(samples.size() * 2);
+  for (size_t i = 0; i < samples.size(); i++) {
+    pcm[2 * i] = (uint8_t)(samples[i] & 0xFF);
+    pcm[2 * i + 1] = (uint8_t)((uint16_t)samples[i] >> 8);
+  }
+  return pcm;
+}
+
+// Une voix seule écrit son dernier bloc partiel : des zéros en voix seule
+// complètent le descripteur DMA (frames = total aligné sur le bloc)
+uint32_t padToBlock(uint32_t frames) {
+  const uint32_t pad = (MIX_FRAMES - frames % MIX_FRAMES) % MIX_FRAMES;
+  static const std::vector<uint8_t> zeros = dcPcm(MIX_FRAMES, 0);
+  if (pad) GotchiAudio::wait(GotchiAudio::play(zeros.data(), pad * 2));
+  return frames + pad;
+}
+
+template <typename Condition>
+bool waitFor(Condition condition) {
+  const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_MS);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > end) return false;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  return true;
+}
+
+// Attend que la DMA ait envoyé samples samples, puis les renvoie
+std::vector<int16_t> waitOutput(size_t samples) {
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([&]() { return HostI2S::output().size() >= samples; }),
+                           "sortie I2S incomplete");
+  return HostI2S::output();
+}
+
+// Tâche bloquée dans l'écriture d'un bloc de silence (gain 128 : mixeur)
+void holdEngine() {
+  HostI2S::hold(true);
+  TEST_ASSERT_NOT_EQUAL(0, GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128));
+  TEST_ASSERT_TRUE_MESSAGE(waitFor(HostI2S::writerWaiting), "tache audio non bloquee");
+}
+
+void releaseEngine() {
+  HostI2S::hold(false);
+}
+
+// Voix sortie de la file et terminée (son dernier bloc peut être encore en
+// cours d'écriture : waitOutput() attend les samples)
+void waitIdle(VoiceId last) {
+  TEST_ASSERT_TRUE(GotchiAudio::wait(last));
+}
+
+// Stats copiées pendant que la tâche est bloquée par holdEngine() : tout ce
+// qui précède est compté, le bloc de silence pas encore (sauf frames/blocks)
+GotchiAudio::Stats snapshotStats() {
+  holdEngine();
+  const GotchiAudio::Stats st = GotchiAudio::getStats();
+  releaseEngine();
+  return st;
+}
+
+void assertBlockEquals(const std::vector<int16_t>& out, size_t start, int16_t value) {
+  for (int i = 0; i < MIX_FRAMES; i++) {
+    if (out[start + i] != value) {
+      char buf[80];
+      snprintf(buf, sizeof(buf), "sample %d : %d au lieu de %d", i, out[start + i], value);
+      TEST_FAIL_MESSAGE(buf);
+    }
+  }
+}
+
+} // namespace
+
+void setUp() {
+  HostI2S::hold(false);
+  HostI2S::clearOutput();
+}
+
+void tearDown() {
+  HostI2S::hold(false);
+  HostI2S::setWriteDelayUs(0);
+  HostI2S::stopRealtimeDma();
+}
+
+// Premier son : matériel initialisé par la tâche, volume lu dans la config
+void test_bring_up() {
+  TEST_ASSERT_TRUE(GotchiAudio::init());
+  const VoiceId id = GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128);
+  TEST_ASSERT_NOT_EQUAL(0, id);
+  waitIdle(id);
+  waitOutput(MIX_FRAMES);  // Bloc écrit avant le clearOutput() du test suivant
+  TEST_ASSERT_TRUE(GotchiAudio::isReady());
+  TEST_ASSERT_TRUE(HostI2S::enabled());
+  TEST_ASSERT_EQUAL_UINT32(GotchiAudio::DMA_DESC, HostI2S::channelConfig().dma_desc_num);
+  TEST_ASSERT_EQUAL_UINT32(MIX_FRAMES, HostI2S::channelConfig().dma_frame_num);
+  TEST_ASSERT_EQUAL_UINT32(GotchiAudio::SAMPLE_RATE, HostI2S::stdConfig().clk_cfg.sample_rate_hz);
+  TEST_ASSERT_EQUAL(0, HostGotchi::codecVolume());  // speaker_volume de la config (vide)
+  TEST_ASSERT_EQUAL(HIGH, digitalRead(GOTCHI_PA_PIN));
+}
+
+// Gain appliqué sample par sample ((s * gain) >> 8), fin de bloc complétée de silence
+void test_gain_and_padding() {
+  std::vector<uint8_t> pcm(100 * 2);
+  for (int i = 0; i < 100; i++) {
+    const int16_t s = (int16_t)((i - 50) * 613);
+    pcm[2 * i] = (uint8_t)(s & 0xFF);
+    pcm[2 * i + 1] = (uint8_t)((uint16_t)s >> 8);
+  }
+  const VoiceId id = GotchiAudio::play(pcm.data(), pcm.size(), 128);
+  waitIdle(id);
+  const std::vector<int16_t> out = waitOutput(MIX_FRAMES);
+  TEST_ASSERT_EQUAL_UINT32(MIX_FRAMES, out.size());
+  for (int i = 0; i < MIX_FRAMES; i++) {
+    const int32_t expected = i < 100 ? ((int32_t)(i - 50) * 613 * 128) >> 8 : 0;
+    TEST_ASSERT_EQUAL_INT16(expected, out[i]);
+  }
+}
+
+// Deux voix à ±30000 dans le même bloc : saturées à 16 bits
+void test_mix_saturates() {
+  std::vector<uint8_t> pcm = dcPcm(MIX_FRAMES, 30000);
+  const std::vector<uint8_t> negative = dcPcm(MIX_FRAMES / 2, -30000);
+  std::copy(negative.begin(), negative.end(), pcm.begin() + MIX_FRAMES);
+
+  holdEngine();
+  GotchiAudio::play(pcm.data(), pcm.size());
+  const VoiceId id = GotchiAudio::play(pcm.data(), pcm.size());
+  releaseEngine();
+  waitIdle(id);
+
+  const std::vector<int16_t> out = waitOutput(2 * MIX_FRAMES);
+  assertBlockEquals(out, 0, 0);  // Bloc de silence de holdEngine()
+  for (int i = 0; i < MIX_FRAMES; i++) {
+    TEST_ASSERT_EQUAL_INT16(i < MIX_FRAMES / 2 ? 32767 : -32768, out[MIX_FRAMES + i]);
+  }
+}
+
+// Durée arrondie au bloc, amplitude proportionnelle au volume
+void test_tone_length_and_amplitude() {
+  GotchiSynth::Voice probe;
+  GotchiSynth::startTone(probe, 1000, 100, 50);
+  const uint32_t frames = GotchiSynth::totalFrames(probe, GotchiAudio::SAMPLE_RATE);
+  TEST_ASSERT_EQUAL_UINT32(1600, frames);
+  const uint32_t blocks = (frames + MIX_FRAMES - 1) / MIX_FRAMES;
+
+  const VoiceId id = GotchiAudio::tone(1000, 100, 50);
+  waitIdle(id);
+  const std::vector<int16_t> out = waitOutput(blocks * MIX_FRAMES);
+  TEST_ASSERT_EQUAL_UINT32(blocks * MIX_FRAMES, out.size());
+
+  int peak = 0;
+  for (uint32_t i = 0; i < frames; i++) peak = std::max(peak, abs((int)out[i]));
+  for (size_t i = frames; i < out.size(); i++) TEST_ASSERT_EQUAL_INT16(0, out[i]);
+  // 50 % : la moitié de la pleine échelle, pas plus
+  TEST_ASSERT_INT_WITHIN(600, 16384, peak);
+  TEST_ASSERT_LESS_OR_EQUAL(16384, peak);
+}
+
+// Cinq voix pour quatre slots : la plus ancienne est volée
+void test_oldest_voice_is_stolen() {
+  const int16_t levels[] = { 100, 200, 400, 800, 1600 };
+  std::vector<std::vector<uint8_t>> pcms;
+  for (int16_t level : levels) pcms.push_back(dcPcm(MIX_FRAMES, level));
+
+  holdEngine();
+  VoiceId ids[5];
+  for (int i = 0; i < 5; i++) {
+    ids[i] = GotchiAudio::play(pcms[i].data(), pcms[i].size());
+    TEST_ASSERT_NOT_EQUAL(0, ids[i]);
+  }
+  releaseEngine();
+  waitIdle(ids[4]);
+
+  const std::vector<int16_t> out = waitOutput(2 * MIX_FRAMES);
+  TEST_ASSERT_EQUAL_UINT32(2 * MIX_FRAMES, out.size());
+  assertBlockEquals(out, MIX_FRAMES, 200 + 400 + 800 + 1600);
+  for (VoiceId id : ids) TEST_ASSERT_FALSE(GotchiAudio::isPlaying(id));
+}
+
+// stopAll en cours de lecture (DMA au rythme réel) : la voix s'arrête
+void test_stop_all_mid_play() {
+  constexpr int BLOCKS = 64;  // 512 ms
+  const std::vector<uint8_t> pcm = dcPcm(BLOCKS * MIX_FRAMES, 1000);
+  HostI2S::startRealtimeDma(8000);
+  const VoiceId id = GotchiAudio::play(pcm.data(), pcm.size(), 128);
+  TEST_ASSERT_TRUE(waitFor([]() { return HostI2S::sentDescriptors() >= 2; }));
+  TEST_ASSERT_TRUE(GotchiAudio::isPlaying(id));
+
+  GotchiAudio::stopAll();
+  TEST_ASSERT_TRUE(GotchiAudio::wait(id, 0));
+  TEST_ASSERT_FALSE(GotchiAudio::isPlaying(id));
+  HostI2S::stopRealtimeDma();
+
+  const std::vector<int16_t> out = HostI2S::output();
+  size_t played = 0;
+  for (int16_t s : out) played += s == 500;
+  TEST_ASSERT_GREATER_THAN(0, played);
+  TEST_ASSERT_LESS_THAN(BLOCKS * MIX_FRAMES / 2, played);
+}
+
+// Volume appliqué au codec par la tâche, borné à 100
+void test_set_volume() {
+  GotchiAudio::setVolume(42);
+  TEST_ASSERT_TRUE(waitFor([]() { return HostGotchi::codecVolume() == 42; }));
+  GotchiAudio::setVolume(250);
+  TEST_ASSERT_TRUE(waitFor([]() { return HostGotchi::codecVolume() == 100; }));
+}
+
+// Ampli coupé après PA_IDLE_MS de silence (horloge virtuelle), rallumé au son suivant
+void test_pa_off_after_idle() {
+  VoiceId id = GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128);
+  waitIdle(id);
+  TEST_ASSERT_EQUAL(HIGH, digitalRead(GOTCHI_PA_PIN));
+
+  // La tâche peut finir d'écrire le bloc (et relever l'heure de fin) après
+  // un premier advance() : l'horloge avance à chaque essai
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([]() {
+    HostClock::advance(1000);
+    return digitalRead(GOTCHI_PA_PIN) == LOW;
+  }), "ampli toujours allume");
+
+  id = GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128);
+  waitIdle(id);
+  TEST_ASSERT_EQUAL(HIGH, digitalRead(GOTCHI_PA_PIN));
+  waitOutput(2 * MIX_FRAMES);  // Tâche sortie de l'écriture avant le test suivant
+}
+
+// File pleine : la commande est refusée (id 0) sans bloquer l'appelant
+void test_queue_full_rejects() {
+  holdEngine();
+  VoiceId last = 0;
+  for (int i = 0; i < 8; i++) {
+    last = GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128);
+    TEST_ASSERT_NOT_EQUAL(0, last);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, GotchiAudio::play(SILENCE.data(), SILENCE.size(), 128));
+  TEST_ASSERT_EQUAL_UINT32(0, GotchiAudio::tone(440, 50, 50));
+  TEST_ASSERT_FALSE(GotchiAudio::isPlaying(0));
+  releaseEngine();
+  waitIdle(last);
+}
+
+// Voix PCM seule au gain unitaire : pas de mixeur, sortie = source
+void test_solo_pcm_is_bit_identical() {
+  const std::vector<int16_t> source = decodeSneeze();
+  const std::vector<uint8_t> pcm = toBytes(source);
+  GotchiAudio::resetStats();
+  const VoiceId id = GotchiAudio::play(pcm.data(), pcm.size());
+  waitIdle(id);
+  const uint32_t total = padToBlock(SNEEZE_FRAMES);
+
+  const std::vector<int16_t> out = waitOutput(total);
+  TEST_ASSERT_EQUAL_UINT32(total, out.size());
+  TEST_ASSERT_EQUAL_INT16_ARRAY(source.data(), out.data(), SNEEZE_FRAMES);
+  for (size_t i = SNEEZE_FRAMES; i < total; i++) TEST_ASSERT_EQUAL_INT16(0, out[i]);
+
+  const GotchiAudio::Stats& st = GotchiAudio::getStats();
+  TEST_ASSERT_EQUAL_UINT64(total, st.frames);
+  TEST_ASSERT_EQUAL_UINT64(total, st.directFrames);
+}
+
+// Voix ADPCM seule : décodée directement dans le bloc de sortie
+void test_solo_adpcm_matches_decoder() {
+  const std::vector<int16_t> reference = decodeSneeze();
+  GotchiAudio::resetStats();
+  const VoiceId id = GotchiAudio::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN);
+  TEST_ASSERT_NOT_EQUAL(0, id);
+  waitIdle(id);
+  const uint32_t total = padToBlock(SNEEZE_FRAMES);
+
+  const std::vector<int16_t> out = waitOutput(total);
+  TEST_ASSERT_EQUAL_UINT32(total, out.size());
+  TEST_ASSERT_EQUAL_INT16_ARRAY(reference.data(), out.data(), SNEEZE_FRAMES);
+  TEST_ASSERT_EQUAL_UINT64(total, GotchiAudio::getStats().directFrames);
+}
+
+// Gain non unitaire : le mixeur reprend la main (blocs entiers, rien en direct)
+void test_scaled_adpcm_goes_through_mixer() {
+  const std::vector<int16_t> reference = decodeSneeze();
+  GotchiAudio::resetStats();
+  const VoiceId id = GotchiAudio::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN, 128);
+  waitIdle(id);
+  const uint32_t total = (SNEEZE_FRAMES + MIX_FRAMES - 1) / MIX_FRAMES * MIX_FRAMES;
+
+  const std::vector<int16_t> out = waitOutput(total);
+  TEST_ASSERT_EQUAL_UINT32(total, out.size());
+  for (uint32_t i = 0; i < total; i++) {
+    const int32_t expected = i < SNEEZE_FRAMES ? ((int32_t)reference[i] * 128) >> 8 : 0;
+    TEST_ASSERT_EQUAL_INT16(expected, out[i]);
+  }
+  const GotchiAudio::Stats& st = GotchiAudio::getStats();
+  TEST_ASSERT_EQUAL_UINT64(total, st.frames);
+  TEST_ASSERT_EQUAL_UINT64(0, st.directFrames);
+}
+
+// DMA au rythme de la carte : un descripteur de MIX_FRAMES frames à 16 kHz
+constexpr uint32_t DESC_US = GotchiAudio::MIX_FRAMES * 1000000ULL / GotchiAudio::SAMPLE_RATE;
+
+// La tâche suit : aucun underrun, file DMA pleine à chaque écriture (hors amorçage)
+void test_realtime_playback_has_no_underrun() {
+  HostI2S::startRealtimeDma(DESC_US);
+  GotchiAudio::resetStats();
+  const VoiceId id = GotchiAudio::tone(440, 500, 50);
+  waitIdle(id);
+  const GotchiAudio::Stats st = snapshotStats();
+
+  const uint32_t blocks = (8000 + MIX_FRAMES - 1) / MIX_FRAMES;
+  TEST_ASSERT_EQUAL_UINT32(blocks + 1, st.blocks);  // + bloc de silence
+  TEST_ASSERT_EQUAL_UINT32(0, st.underruns);
+  TEST_ASSERT_EQUAL_UINT32(1, st.startUs.count);
+  uint32_t fills = 0;
+  for (uint32_t f : st.fill) fills += f;
+  TEST_ASSERT_EQUAL_UINT32(st.blocks, fills);
+  TEST_ASSERT_GREATER_OR_EQUAL(blocks - GotchiAudio::DMA_DESC, st.fill[GotchiAudio::DMA_DESC]);
+}
+
+// Tâche plus lente que la DMA : la file se vide en pleine lecture
+void test_slow_writes_count_underruns() {
+  HostI2S::startRealtimeDma(DESC_US);
+  HostI2S::setWriteDelayUs(DESC_US * 3 / 2);
+  GotchiAudio::resetStats();
+  const VoiceId id = GotchiAudio::tone(440, 200, 50);
+  waitIdle(id);
+  HostI2S::setWriteDelayUs(0);  // Sinon le bloc de silence compte aussi
+  const GotchiAudio::Stats st = snapshotStats();
+
+  TEST_ASSERT_GREATER_THAN(0, st.underruns);
+  TEST_ASSERT_LESS_OR_EQUAL(HostI2S::emptyQueueEvents(), st.underruns);
+  TEST_ASSERT_GREATER_THAN(0, st.fill[0]);
+}
+
+// Sons courts séparés de silences : la DMA tourne à vide sans underrun compté
+void test_idle_gaps_are_not_underruns() {
+  HostI2S::startRealtimeDma(DESC_US);
+  GotchiAudio::resetStats();
+  for (int i = 0; i < 5; i++) {
+    waitIdle(GotchiAudio::tone(880, 20, 50));
+    const uint32_t empty = HostI2S::emptyQueueEvents();
+    TEST_ASSERT_TRUE(waitFor([&]() { return HostI2S::emptyQueueEvents() >= empty + 10; }));
+  }
+  const GotchiAudio::Stats st = snapshotStats();
+  TEST_ASSERT_EQUAL_UINT32(0, st.underruns);
+  TEST_ASSERT_EQUAL_UINT32(5, st.startUs.count);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bring_up);
+  RUN_TEST(test_gain_and_padding);
+  RUN_TEST(test_mix_saturates);
+  RUN_TEST(test_tone_length_and_amplitude);
+  RUN_TEST(test_oldest_voice_is_stolen);
+  RUN_TEST(test_stop_all_mid_play);
+  RUN_TEST(test_set_volume);
+  RUN_TEST(test_pa_off_after_idle);
+  RUN_TEST(test_queue_full_rejects);
+  RUN_TEST(test_solo_pcm_is_bit_identical);
+  RUN_TEST(test_solo_adpcm_matches_decoder);
+  RUN_TEST(test_scaled_adpcm_goes_through_mixer);
+  RUN_TEST(test_realtime_playback_has_no_underrun);
+  RUN_TEST(test_slow_writes_count_underruns);
+  RUN_TEST(test_idle_gaps_are_not_underruns);
+  return UNITY_END();
+}
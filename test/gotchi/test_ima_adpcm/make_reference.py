@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""
+Références du test natif test_ima_adpcm, produites par le décodeur Python de
+tools/wav_to_header.py (decode_ima_adpcm) : le test C++ doit les retrouver
+au bit près.
+
+  golden/<son>.s16      PCM décodé (int16 LE) de chaque NAME_ADPCM[] de
+                        src/models/gotchi/audio/sounds/*.h
+  golden/sine440.adpcm  Sinus 440 Hz encodé par encode_ima_adpcm
+  golden/sine440.s16    son décodage
+
+À relancer après une régénération des sons ou un changement du codec :
+  python test/gotchi/test_ima_adpcm/make_reference.py
+"""
+
+import math
+import re
+import struct
+import sys
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+ROOT = HERE.parents[2]
+sys.path.insert(0, str(ROOT / 'tools'))
+
+from wav_to_header import decode_ima_adpcm, encode_ima_adpcm  # noqa: E402
+
+SOUNDS_DIR = ROOT / 'src' / 'models' / 'gotchi' / 'audio' / 'sounds'
+GOLDEN_DIR = HERE / 'golden'
+
+
+def header_adpcm(path: Path):
+    """(nom, octets) du tableau NAME_ADPCM[] d'un header, None si PCM."""
+    text = path.read_text(encoding='utf-8')
+    m = re.search(r'static const uint8_t (\w+)_ADPCM\[\] PROGMEM = \{(.*?)\};', text, re.S)
+    if not m:
+        return None
+    return m.group(1).lower(), bytes(int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', m.group(2)))
+
+
+def write_s16(path: Path, samples: list):
+    path.write_bytes(struct.pack('<%dh' % len(samples), *samples))
+
+
+def main():
+    GOLDEN_DIR.mkdir(exist_ok=True)
+    for header in sorted(SOUNDS_DIR.glob('*.h')):
+        found = header_adpcm(header)
+        if not found:
+            continue
+        name, data = found
+        decoded = decode_ima_adpcm(data)
+        write_s16(GOLDEN_DIR / f'{name}.s16', decoded)
+        print(f'{name}: {len(data)} octets -> {len(decoded)} samples')
+
+    # Signal tonal : l'index de pas monte puis se stabilise, à l'inverse des bruits
+    sine = [int(round(12000 * math.sin(2 * math.pi * 440 * n / 16000))) for n in range(4000)]
+    data = encode_ima_adpcm(sine)
+    (GOLDEN_DIR / 'sine440.adpcm').write_bytes(data)
+    write_s16(GOLDEN_DIR / 'sine440.s16', decode_ima_adpcm(data))
+    print(f'sine440: {len(data)} octets')
+
+
+if __name__ == '__main__':
+    main()
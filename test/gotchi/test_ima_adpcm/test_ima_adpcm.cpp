@@ -0,0 +1,114 @@
+/**
+ * Décodeur IMA-ADPCM des sons Gotchi (env:native)
+ *
+ * Décode sound_eating.h, sound_sneeze.h et un sinus 440 Hz avec ImaAdpcm, par
+ * morceaux de tailles irrégulières (impaires, 1 sample, > BLOCK_FRAMES : le
+ * flux reprend au milieu d'un octet), et compare au bit près au décodeur de
+ * référence de tools/wav_to_header.py. Les références (golden/<son>.s16) sont
+ * produites par make_reference.py, jamais par le code C++ testé.
+ */
+#include <unity.h>
+#include <Arduino.h>  // PROGMEM des headers de sons
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "host_golden.h"
+#include "models/gotchi/audio/ima_adpcm.h"
+#include "models/gotchi/audio/sounds/sound_eating.h"
+#include "models/gotchi/audio/sounds/sound_sneeze.h"
+
+namespace {
+
+// Tailles de morceaux successives, reprises en boucle
+const int CHUNKS[] = { 1, 3, 64, 7, 2, 33, 5, 64, 11, 1, 17, 63, 128, 9 };
+constexpr int CHUNK_COUNT = sizeof(CHUNKS) / sizeof(CHUNKS[0]);
+
+std::vector<uint8_t> readFile(const std::string& path) {
+  std::vector<uint8_t> data;
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return data;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+  fclose(f);
+  return data;
+}
+
+std::vector<int16_t> readReference(const char* name) {
+  const std::vector<uint8_t> raw = readFile(HostGolden::goldenDir(__FILE__) + "/" + name + ".s16");
+  std::vector<int16_t> pcm(raw.size() / 2);
+  for (size_t i = 0; i < pcm.size(); i++) pcm[i] = (int16_t)(raw[2 * i] | (raw[2 * i + 1] << 8));
+  return pcm;
+}
+
+// Décode tout l'asset, morceau par morceau, en partant de CHUNKS[offset]
+std::vector<int16_t> decodeChunked(const uint8_t* asset, uint32_t len, int offset) {
+  std::vector<int16_t> out;
+  ImaAdpcm::State st;
+  if (!ImaAdpcm::begin(st, asset, len)) return out;
+  const uint32_t total = ImaAdpcm::sampleCount(len);
+  out.resize(total);
+  uint32_t done = 0;
+  for (int k = offset; done < total; k++) {
+    uint32_t n = (uint32_t)CHUNKS[k % CHUNK_COUNT];
+    if (n > total - done) n = total - done;
+    ImaAdpcm::decode(st, out.data() + done, (int)n);
+    done += n;
+  }
+  return out;
+}
+
+void assertBitExact(const char* name, const uint8_t* asset, uint32_t len) {
+  const std::vector<int16_t> ref = readReference(name);
+  TEST_ASSERT_GREATER_THAN_MESSAGE(0, ref.size(), "reference absente (make_reference.py)");
+  TEST_ASSERT_EQUAL_UINT32(ref.size(), ImaAdpcm::sampleCount(len));
+
+  for (int offset = 0; offset < CHUNK_COUNT; offset++) {
+    const std::vector<int16_t> pcm = decodeChunked(asset, len, offset);
+    TEST_ASSERT_EQUAL_UINT32(ref.size(), pcm.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+      if (pcm[i] == ref[i]) continue;
+      char msg[96];
+      snprintf(msg, sizeof(msg), "%s: sample %u = %d au lieu de %d (morceaux depuis %d)",
+               name, (unsigned)i, pcm[i], ref[i], offset);
+      TEST_FAIL_MESSAGE(msg);
+    }
+  }
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_eating_matches_python_reference() {
+  assertBitExact("eating", EATING_ADPCM, EATING_ADPCM_LEN);
+}
+
+void test_sneeze_matches_python_reference() {
+  assertBitExact("sneeze", SNEEZE_ADPCM, SNEEZE_ADPCM_LEN);
+}
+
+void test_sine_matches_python_reference() {
+  const std::vector<uint8_t> asset = readFile(HostGolden::goldenDir(__FILE__) + "/sine440.adpcm");
+  TEST_ASSERT_GREATER_THAN(ImaAdpcm::HEADER_BYTES, asset.size());
+  assertBitExact("sine440", asset.data(), asset.size());
+}
+
+void test_invalid_header_is_rejected() {
+  ImaAdpcm::State st;
+  const uint8_t badIndex[] = { 0x00, 0x00, 89, 0x00, 0x12 };
+  TEST_ASSERT_FALSE(ImaAdpcm::begin(st, badIndex, sizeof(badIndex)));
+  TEST_ASSERT_FALSE(ImaAdpcm::begin(st, EATING_ADPCM, ImaAdpcm::HEADER_BYTES));
+  TEST_ASSERT_FALSE(ImaAdpcm::begin(st, nullptr, 16));
+  TEST_ASSERT_EQUAL_UINT32(0, ImaAdpcm::sampleCount(ImaAdpcm::HEADER_BYTES));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_eating_matches_python_reference);
+  RUN_TEST(test_sneeze_matches_python_reference);
+  RUN_TEST(test_sine_matches_python_reference);
+  RUN_TEST(test_invalid_header_is_rejected);
+  return UNITY_END();
+}
@@ -0,0 +1,250 @@
+/**
+ * Cache LRU des yeux rasterisés du FaceRenderer (env:native)
+ *
+ * - Formes tirées au hasard (dimensions, arrondis, pentes, décalages qui
+ *   sortent du FB, scale) : l'écran rendu avec le cache (capture puis
+ *   rejeu des spans) doit être identique au pixel près au rendu direct
+ *   (FaceRenderer::setShapeCache(false)), en une bande puis en deux ;
+ * - idem avec des yeux qui se chevauchent ou se croisent (les triangles
+ *   COL_BG de l'oeil droit recreusent alors l'oeil gauche).
+ * - Statistiques : une forme revue est un hit, une nouvelle forme évince
+ *   la moins récemment utilisée, une forme en plusieurs morceaux par ligne
+ *   est comptée "uncached" une seule fois.
+ *
+ *   pio test -e native_gotchi -f gotchi/test_shape_cache -v
+ */
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "host_clock.h"
+#include "host_gotchi.h"
+#include "host_random.h"
+#include "models/gotchi/config/gotchi_theme.h"
+#include "models/gotchi/face/face_renderer.h"
+#include "models/gotchi/face/behavior/behavior_engine.h"
+
+namespace {
+
+constexpr int RANDOM_CASES = 1500;  // Par mode de rasterisation
+constexpr int CACHE_ENTRIES = 12;   // SHAPE_CACHE_ENTRIES de face_renderer.cpp
+
+struct Case {
+  EyeConfig left, right;
+  float lookX, lookY, scale;
+};
+
+// LCG local : indépendant des rand() éventuels du rendu
+uint32_t s_seed = 1;
+
+int32_t randomIn(int32_t lo, int32_t hi) {
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return lo + (int32_t)((s_seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+float randomSlope() {
+  return randomIn(-50, 50) / 100.0f;
+}
+
+// Décalage horizontal dans [minX, maxX]
+EyeConfig randomEye(int16_t minX, int16_t maxX) {
+  EyeConfig e;
+  e.height = randomIn(1, 130);
+  e.width = randomIn(1, 130);
+  e.offsetX = randomIn(minX, maxX);
+  e.offsetY = randomIn(-200, 200);
+  e.radiusTop = randomIn(0, 45);
+  e.radiusBottom = randomIn(0, 45);
+  e.slopeTop = randomSlope();
+  e.slopeBottom = randomSlope();
+  return e;
+}
+
+// Yeux séparés : centres à 190 px (x scale), largeur 130 max, l'oeil gauche
+// ne part que vers la gauche et le droit vers la droite (bords du FB toujours
+// atteints). Yeux qui se chevauchent : l'un vers l'autre, jusqu'à se croiser
+Case randomCase(bool overlap) {
+  Case c;
+  c.left = overlap ? randomEye(40, 230) : randomEye(-150, 0);
+  c.right = overlap ? randomEye(-230, -40) : randomEye(0, 150);
+  if (overlap) c.left.offsetY = c.right.offsetY + randomIn(-60, 60);
+  c.lookX = randomIn(-100, 100) / 100.0f;
+  c.lookY = randomIn(-100, 100) / 100.0f;
+  c.scale = randomIn(0, 3) == 0 ? randomIn(40, 100) / 100.0f : 1.0f;
+  return c;
+}
+
+void renderCase(const Case& c) {
+  FaceRenderer::setScale(c.scale);
+  FaceRenderer::render(c.left, c.right, c.lookX, c.lookY, 0.0f);
+  FaceRenderer::waitFlush();
+  HostClock::advance(33);
+}
+
+// Deux frames identiques : l'écran porte le cas entier
+void renderCaseStable(const Case& c) {
+  renderCase(c);
+  renderCase(c);
+}
+
+std::vector<uint16_t> capturePanel() {
+  const HostPanel& panel = HostGotchi::panel();
+  return std::vector<uint16_t>(panel.pixels(), panel.pixels() + (size_t)panel.width() * panel.height());
+}
+
+void assertPanelEquals(const std::vector<uint16_t>& expected, int index) {
+  const HostPanel& panel = HostGotchi::panel();
+  const uint16_t* pixels = panel.pixels();
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (pixels[i] != expected[i]) {
+      char buf[128];
+      snprintf(buf, sizeof(buf), "cas %d : (%d,%d) = 0x%04X avec cache, 0x%04X en direct", index,
+               (int)(i % panel.width()), (int)(i / panel.width()), pixels[i], expected[i]);
+      TEST_FAIL_MESSAGE(buf);
+    }
+  }
+}
+
+void runRandomCases(bool parallel, bool overlap) {
+  FaceRenderer::setParallelRaster(parallel);
+  s_seed = (parallel ? 0xC0FFEEu : 1u) + (overlap ? 0x100u : 0u);
+  for (int i = 0; i < RANDOM_CASES; i++) {
+    const Case c = randomCase(overlap);
+    FaceRenderer::setShapeCache(false);
+    renderCaseStable(c);
+    const std::vector<uint16_t> direct = capturePanel();
+
+    // Première frame : capture (miss), seconde : rejeu (hit)
+    FaceRenderer::setShapeCache(true);
+    renderCase(c);
+    assertPanelEquals(direct, i);
+    renderCase(c);
+    assertPanelEquals(direct, i);
+  }
+  const FaceRenderer::ShapeCacheStats& cs = FaceRenderer::getShapeCacheStats();
+  char line[120];
+  snprintf(line, sizeof(line), "%s%s : %lu hits, %lu misses, %lu evictions, %lu non cachables",
+           parallel ? "2 bandes" : "1 bande", overlap ? ", yeux croises" : "", (unsigned long)cs.hits, (unsigned long)cs.misses,
+           (unsigned long)cs.evictions, (unsigned long)cs.uncached);
+  TEST_MESSAGE(line);
+  // Le rejeu a bien été exercé (pas seulement le chemin direct) ; quand les
+  // yeux se touchent, seul l'oeil gauche passe par le cache
+  TEST_ASSERT_GREATER_THAN(overlap ? RANDOM_CASES / 2 : RANDOM_CASES, cs.hits);
+  TEST_ASSERT_GREATER_THAN(cs.uncached, cs.misses);
+  FaceRenderer::setParallelRaster(false);
+}
+
+// Oeil sans pente, d'une largeur propre à chaque i
+EyeConfig plainEye(int i) {
+  return { 40, (int16_t)(20 + 2 * i), 0, 0, 8, 8, 0.0f, 0.0f };
+}
+
+} // namespace
+
+void setUp() {
+  HostRandom::reset(1);
+  HostClock::set(0);
+  GotchiTheme::setPreset(GotchiTheme::Preset::Boy);
+  BehaviorStats& stats = BehaviorEngine::getStats();
+  stats.droolLength = 0;
+  stats.droolRetract = 0;
+  FaceRenderer::setAsyncFlush(false);
+  FaceRenderer::setParallelRaster(false);
+  FaceRenderer::setShapeCache(true);
+  FaceRenderer::resetScale();
+  FaceRenderer::clearViewport();
+  FaceRenderer::init();
+  FaceRenderer::resetShapeCacheStats();
+}
+
+void tearDown() {
+  FaceRenderer::setShapeCache(true);
+}
+
+void test_cached_matches_direct_single_band() {
+  runRandomCases(false, false);
+}
+
+void test_cached_matches_direct_dual_band() {
+  runRandomCases(true, false);
+}
+
+void test_overlapping_eyes_single_band() {
+  runRandomCases(false, true);
+}
+
+void test_overlapping_eyes_dual_band() {
+  runRandomCases(true, true);
+}
+
+void test_lru_stats() {
+  const FaceRenderer::ShapeCacheStats& cs = FaceRenderer::getShapeCacheStats();
+
+  // Cache plein de formes qui ne servent plus (la frame initiale de init() en fait partie)
+  for (int i = 0; i < CACHE_ENTRIES; i++) {
+    const EyeConfig e = plainEye(CACHE_ENTRIES + 1 + i);
+    renderCase({ e, e, 0, 0, 1.0f });
+  }
+  FaceRenderer::resetShapeCacheStats();
+
+  // Deux yeux identiques sur deux frames : une capture puis trois hits
+  for (int i = 0; i < CACHE_ENTRIES; i++) {
+    const EyeConfig e = plainEye(i);
+    renderCase({ e, e, 0, 0, 1.0f });
+    renderCase({ e, e, 0, 0, 1.0f });
+  }
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES, cs.misses);
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES, cs.evictions);
+  TEST_ASSERT_EQUAL_UINT32(3 * CACHE_ENTRIES, cs.hits);
+
+  // plainEye(0) revue redevient la plus récente : la forme suivante évince
+  // plainEye(1), la moins récemment utilisée (pas la plus anciennement capturée)
+  const EyeConfig first = plainEye(0), second = plainEye(1), extra = plainEye(CACHE_ENTRIES);
+  renderCase({ first, first, 0, 0, 1.0f });
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES, cs.misses);
+  renderCase({ extra, extra, 0, 0, 1.0f });
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES + 1, cs.misses);
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES + 1, cs.evictions);
+  renderCase({ first, first, 0, 0, 1.0f });
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES + 1, cs.misses);
+  renderCase({ second, second, 0, 0, 1.0f });
+  TEST_ASSERT_EQUAL_UINT32(CACHE_ENTRIES + 2, cs.misses);
+
+  // Cache désactivé : ni hit ni miss
+  FaceRenderer::setShapeCache(false);
+  TEST_ASSERT_FALSE(FaceRenderer::isShapeCache());
+  const uint32_t hits = cs.hits, misses = cs.misses;
+  renderCase({ first, first, 0, 0, 1.0f });
+  TEST_ASSERT_EQUAL_UINT32(hits, cs.hits);
+  TEST_ASSERT_EQUAL_UINT32(misses, cs.misses);
+}
+
+// Une forme dont des lignes tiennent en plusieurs morceaux est marquée
+// directe à la capture, puis retrouvée en hit sans nouvelle capture
+void test_uncached_shape_counted_once() {
+  const FaceRenderer::ShapeCacheStats& cs = FaceRenderer::getShapeCacheStats();
+  bool found = false;
+  s_seed = 7;
+  for (int i = 0; i < 2000 && !found; i++) {
+    const EyeConfig e = randomEye(-150, 150);
+    const uint32_t before = cs.uncached;
+    renderCase({ e, e, 0, 0, 1.0f });
+    if (cs.uncached == before) continue;
+    found = true;
+    TEST_ASSERT_EQUAL_UINT32(before + 1, cs.uncached);
+    renderCase({ e, e, 0, 0, 1.0f });
+    TEST_ASSERT_EQUAL_UINT32(before + 1, cs.uncached);
+  }
+  TEST_ASSERT_TRUE_MESSAGE(found, "aucune forme non cachable tiree");
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_cached_matches_direct_single_band);
+  RUN_TEST(test_cached_matches_direct_dual_band);
+  RUN_TEST(test_overlapping_eyes_single_band);
+  RUN_TEST(test_overlapping_eyes_dual_band);
+  RUN_TEST(test_lru_stats);
+  RUN_TEST(test_uncached_shape_counted_once);
+  return UNITY_END();
+}
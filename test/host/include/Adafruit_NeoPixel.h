@@ -0,0 +1,57 @@
+#ifndef KIDOO_HOST_ADAFRUIT_NEOPIXEL_H
+#define KIDOO_HOST_ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+/**
+ * Adafruit_NeoPixel minimal pour les tests natifs (env:native*)
+ * Buffer dans l'ordre du fil (GRB comme NEO_GRB) sans luminosité Adafruit :
+ * la bande ne fait que garder les pixels écrits par LEDCompositor. L'envoi
+ * est simulé par LEDOutput (host_dream.h).
+ */
+
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800)
+      : count(n), pixels((uint8_t*)calloc(n ? n * 3 : 1, 1)) {
+    (void)pin;
+    (void)type;
+  }
+  ~Adafruit_NeoPixel() { free(pixels); }
+
+  void begin() {}
+  void show() {}
+  void clear() { memset(pixels, 0, count * 3); }
+
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    if (n >= count) return;
+    pixels[n * 3 + 0] = g;
+    pixels[n * 3 + 1] = r;
+    pixels[n * 3 + 2] = b;
+  }
+  void setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+  }
+  uint32_t getPixelColor(uint16_t n) const {
+    if (n >= count) return 0;
+    return ((uint32_t)pixels[n * 3 + 1] << 16) | ((uint32_t)pixels[n * 3 + 0] << 8) | pixels[n * 3 + 2];
+  }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+  uint8_t* getPixels() const { return pixels; }
+  uint16_t numPixels() const { return count; }
+
+private:
+  uint16_t count;
+  uint8_t* pixels;
+};
+
+#endif // KIDOO_HOST_ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,97 @@
+#ifndef KIDOO_HOST_ARDUINO_H
+#define KIDOO_HOST_ARDUINO_H
+
+/**
+ * Arduino.h minimal pour les tests natifs (env:native*)
+ *
+ * millis() est une horloge virtuelle avancée par le test (voir host_clock.h) :
+ * les animations dépendent du temps et les images golden doivent être
+ * reproductibles. micros() est l'horloge réelle (mesures, benchmarks).
+ * Serial écrit sur stdout, ou dans une capture (host_serial.h).
+ */
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include "esp_heap_caps.h"
+#include "pgmspace.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define IRAM_ATTR
+#define HEX 16
+#define DEC 10
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void delayMicroseconds(uint32_t) {}
+inline void yield() {}
+
+// Pas de PSRAM séparée : allocatePsram() (core_config.h) passe par malloc.
+// Absente par défaut, un test peut l'annoncer (ESP.setPsram) pour le code
+// qui en dépend ; ps_malloc et MALLOC_CAP_SPIRAM restent des malloc.
+bool psramFound();
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+// Niveau de sortie mémorisé par broche (ampli, LEDs de statut...)
+inline void pinMode(int, int) {}
+void digitalWrite(int pin, int level);
+int digitalRead(int pin);
+
+// Statistiques mémoire (printMemoryStats) : valeurs fixes
+class HostEsp {
+public:
+  uint32_t getHeapSize() const { return 320u * 1024; }
+  uint32_t getFreeHeap() const { return 200u * 1024; }
+  uint32_t getPsramSize() const { return psramFound() ? 8u * 1024 * 1024 : 0; }
+  uint32_t getFreePsram() const { return getPsramSize(); }
+  void restart() { exit(0); }
+  void setPsram(bool present);
+};
+
+extern HostEsp ESP;
+
+// String Arduino réduite (noms renvoyés par les API de fichiers)
+class String {
+public:
+  String(const char* s = "") : _s(s ? s : "") {}
+  const char* c_str() const { return _s.c_str(); }
+  size_t length() const { return _s.size(); }
+
+private:
+  std::string _s;
+};
+
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char* s);
+  size_t print(char c);
+  size_t print(long v, int base = DEC);
+  size_t print(unsigned long v, int base = DEC);
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(double v, int digits = 2);
+  size_t println();
+  template <typename T> size_t println(T v) { return print(v) + println(); }
+  template <typename T> size_t println(T v, int f) { return print(v, f) + println(); }
+  void flush() { fflush(stdout); }
+  operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+
+#endif // KIDOO_HOST_ARDUINO_H
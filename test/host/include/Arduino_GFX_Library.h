@@ -0,0 +1,49 @@
+#ifndef KIDOO_HOST_ARDUINO_GFX_LIBRARY_H
+#define KIDOO_HOST_ARDUINO_GFX_LIBRARY_H
+
+/**
+ * Sous-ensemble d'Arduino_GFX utilisé par la face Gotchi. Les méthodes de
+ * dessin ne font rien ici : HostPanel (host_panel.h) les surcharge pour
+ * capturer l'écran en mémoire. Comme la vraie bibliothèque, inclut Arduino.h.
+ */
+
+#include <Arduino.h>
+#include <cstdint>
+
+class Arduino_GFX {
+public:
+  Arduino_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+  virtual ~Arduino_GFX() {}
+
+  virtual bool begin(int32_t speed = 0) { (void)speed; return true; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  virtual void startWrite() {}
+  virtual void endWrite() {}
+  virtual void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) { (void)x; (void)y; (void)color; }
+  virtual void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t j = 0; j < h; j++)
+      for (int16_t i = 0; i < w; i++) writePixelPreclipped(x + i, y + j, color);
+  }
+  virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    (void)x; (void)y; (void)bitmap; (void)w; (void)h;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    writePixelPreclipped(x, y, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int16_t x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+    int16_t x1 = x + w > _width ? _width : x + w;
+    int16_t y1 = y + h > _height ? _height : y + h;
+    if (x0 < x1 && y0 < y1) writeFillRectPreclipped(x0, y0, x1 - x0, y1 - y0, color);
+  }
+  void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+protected:
+  int16_t _width, _height;
+};
+
+#endif // KIDOO_HOST_ARDUINO_GFX_LIBRARY_H
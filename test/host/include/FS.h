@@ -0,0 +1,75 @@
+#ifndef KIDOO_HOST_FS_H
+#define KIDOO_HOST_FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+/**
+ * FS.h du core Arduino (env:native) : fs::File et fs::FS délèguent à une
+ * implémentation (FSImpl.h), comme sur la carte. Sert aux FS de test (SD
+ * sur un dossier de l'hôte) et aux FS du code testé (cache audio).
+ */
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+class FSImpl;
+typedef std::shared_ptr<FSImpl> FSImplPtr;
+
+class File {
+public:
+  File(FileImplPtr p = FileImplPtr()) : _p(p) {}
+
+  size_t write(const uint8_t* buf, size_t size);
+  size_t read(uint8_t* buf, size_t size);
+  int read();
+  int available();
+  void flush();
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  explicit operator bool() const;
+  const char* path() const;
+  const char* name() const;
+  boolean isDirectory(void);
+
+  size_t print(const char* s);
+  size_t println(const char* s);
+
+private:
+  FileImplPtr _p;
+};
+
+class FS {
+public:
+  FS(FSImplPtr impl) : _impl(impl) {}
+
+  File open(const char* path, const char* mode = FILE_READ, const bool create = false);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rename(const char* pathFrom, const char* pathTo);
+  bool mkdir(const char* path);
+  bool rmdir(const char* path);
+
+protected:
+  FSImplPtr _impl;
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif // KIDOO_HOST_FS_H
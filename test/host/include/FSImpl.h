@@ -0,0 +1,47 @@
+#ifndef KIDOO_HOST_FSIMPL_H
+#define KIDOO_HOST_FSIMPL_H
+
+#include "FS.h"
+#include <ctime>
+
+/**
+ * Interfaces d'implémentation de fs::FS (sous-ensemble du core ESP32 2.x)
+ * Les méthodes propres au core 3.x (setBufferSize, getNextFileName,
+ * seekDir) ne sont pas déclarées : les classes dérivées les définissent
+ * sans override.
+ */
+namespace fs {
+
+class FileImpl {
+public:
+  virtual ~FileImpl() {}
+  virtual size_t write(const uint8_t* buf, size_t size) = 0;
+  virtual size_t read(uint8_t* buf, size_t size) = 0;
+  virtual void flush() = 0;
+  virtual bool seek(uint32_t pos, SeekMode mode) = 0;
+  virtual size_t position() const = 0;
+  virtual size_t size() const = 0;
+  virtual void close() = 0;
+  virtual time_t getLastWrite() = 0;
+  virtual const char* path() const = 0;
+  virtual const char* name() const = 0;
+  virtual boolean isDirectory(void) = 0;
+  virtual FileImplPtr openNextFile(const char* mode) = 0;
+  virtual void rewindDirectory(void) = 0;
+  virtual operator bool() = 0;
+};
+
+class FSImpl {
+public:
+  virtual ~FSImpl() {}
+  virtual FileImplPtr open(const char* path, const char* mode, const bool create) = 0;
+  virtual bool exists(const char* path) = 0;
+  virtual bool rename(const char* pathFrom, const char* pathTo) = 0;
+  virtual bool remove(const char* path) = 0;
+  virtual bool mkdir(const char* path) = 0;
+  virtual bool rmdir(const char* path) = 0;
+};
+
+} // namespace fs
+
+#endif // KIDOO_HOST_FSIMPL_H
@@ -0,0 +1,20 @@
+#ifndef KIDOO_HOST_SD_H
+#define KIDOO_HOST_SD_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+/**
+ * SD.h minimal pour les tests natifs (env:native*)
+ * Par défaut pas de carte : SD.open() rend un fichier invalide. Un test peut
+ * monter un dossier de l'hôte comme carte (host_sd.h).
+ */
+
+class HostSDFS : public fs::FS {
+public:
+  HostSDFS();
+};
+
+extern HostSDFS SD;
+
+#endif // KIDOO_HOST_SD_H
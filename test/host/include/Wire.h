@@ -0,0 +1,14 @@
+#ifndef KIDOO_HOST_WIRE_H
+#define KIDOO_HOST_WIRE_H
+
+#include <cstdint>
+
+// Bus I2C sans périphérique : les drivers des codecs sont remplacés par des fakes
+class HostWire {
+public:
+  bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+};
+
+extern HostWire Wire;
+
+#endif // KIDOO_HOST_WIRE_H
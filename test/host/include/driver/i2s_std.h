@@ -0,0 +1,99 @@
+#ifndef KIDOO_HOST_DRIVER_I2S_STD_H
+#define KIDOO_HOST_DRIVER_I2S_STD_H
+
+/**
+ * Driver I2S standard de l'IDF (sous-ensemble TX utilisé par GotchiAudio)
+ *
+ * Pas de périphérique : les octets écrits arrivent dans la sortie capturée
+ * de HostI2S (host_i2s.h), avec une file de descripteurs DMA simulée qui
+ * appelle on_sent / on_send_q_ovf comme l'ISR du driver.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "esp_err.h"
+#include "hal/gpio_types.h"
+
+typedef struct HostI2SChannel* i2s_chan_handle_t;
+
+typedef enum { I2S_NUM_0 = 0, I2S_NUM_1 = 1 } i2s_port_t;
+typedef enum { I2S_ROLE_MASTER = 0, I2S_ROLE_SLAVE = 1 } i2s_role_t;
+typedef enum {
+  I2S_DATA_BIT_WIDTH_8BIT = 8,
+  I2S_DATA_BIT_WIDTH_16BIT = 16,
+  I2S_DATA_BIT_WIDTH_24BIT = 24,
+  I2S_DATA_BIT_WIDTH_32BIT = 32,
+} i2s_data_bit_width_t;
+typedef enum { I2S_SLOT_MODE_MONO = 1, I2S_SLOT_MODE_STEREO = 2 } i2s_slot_mode_t;
+
+#define I2S_GPIO_UNUSED GPIO_NUM_NC
+
+typedef struct {
+  i2s_port_t id;
+  i2s_role_t role;
+  uint32_t dma_desc_num;
+  uint32_t dma_frame_num;
+  bool auto_clear;
+} i2s_chan_config_t;
+
+#define I2S_CHANNEL_DEFAULT_CONFIG(port, r) { (port), (r), 6, 240, false }
+
+typedef struct {
+  uint32_t sample_rate_hz;
+  uint32_t mclk_multiple;
+} i2s_std_clk_config_t;
+
+#define I2S_STD_CLK_DEFAULT_CONFIG(rate) { (rate), 256 }
+
+typedef struct {
+  i2s_data_bit_width_t data_bit_width;
+  i2s_slot_mode_t slot_mode;
+} i2s_std_slot_config_t;
+
+#define I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(bits, mode) { (bits), (mode) }
+
+typedef struct {
+  gpio_num_t mclk;
+  gpio_num_t bclk;
+  gpio_num_t ws;
+  gpio_num_t dout;
+  gpio_num_t din;
+  struct {
+    bool mclk_inv;
+    bool bclk_inv;
+    bool ws_inv;
+  } invert_flags;
+} i2s_std_gpio_config_t;
+
+typedef struct {
+  i2s_std_clk_config_t clk_cfg;
+  i2s_std_slot_config_t slot_cfg;
+  i2s_std_gpio_config_t gpio_cfg;
+} i2s_std_config_t;
+
+typedef struct {
+  void* data;
+  size_t size;
+} i2s_event_data_t;
+
+typedef bool (*i2s_isr_callback_t)(i2s_chan_handle_t handle, i2s_event_data_t* event, void* userCtx);
+
+typedef struct {
+  i2s_isr_callback_t on_recv;
+  i2s_isr_callback_t on_recv_q_ovf;
+  i2s_isr_callback_t on_sent;
+  i2s_isr_callback_t on_send_q_ovf;
+} i2s_event_callbacks_t;
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t* config, i2s_chan_handle_t* txHandle,
+                          i2s_chan_handle_t* rxHandle);
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t* config);
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+                                              const i2s_event_callbacks_t* callbacks, void* userData);
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle);
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle);
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle);
+esp_err_t i2s_channel_write(i2s_chan_handle_t handle, const void* src, size_t size,
+                            size_t* bytesWritten, uint32_t timeoutMs);
+
+#endif // KIDOO_HOST_DRIVER_I2S_STD_H
@@ -0,0 +1,50 @@
+#ifndef KIDOO_HOST_DRIVER_RMT_H
+#define KIDOO_HOST_DRIVER_RMT_H
+
+/**
+ * Ancien driver RMT de l'IDF 4.x (core Arduino 2.x, sous-ensemble TX utilisé
+ * par LEDOutput)
+ *
+ * Pas de périphérique : chaque rmt_write_items() est gardé tel quel dans
+ * HostRMT (host_rmt.h), l'envoi est terminé aussitôt sauf si le test simule
+ * un canal occupé.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "hal/gpio_types.h"
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3, RMT_CHANNEL_MAX } rmt_channel_t;
+typedef enum { RMT_MODE_TX = 0, RMT_MODE_RX = 1 } rmt_mode_t;
+
+typedef struct {
+  union {
+    struct {
+      uint32_t duration0 : 15;
+      uint32_t level0 : 1;
+      uint32_t duration1 : 15;
+      uint32_t level1 : 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef struct {
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  gpio_num_t gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+} rmt_config_t;
+
+// Valeurs de l'IDF : horloge APB / 80 (1 µs par tick), un bloc mémoire
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id) { RMT_MODE_TX, (channel_id), (gpio), 80, 1 }
+
+esp_err_t rmt_config(const rmt_config_t* config);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBufSize, int intrAllocFlags);
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t* items, int count, bool waitTxDone);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t waitTime);
+
+#endif // KIDOO_HOST_DRIVER_RMT_H
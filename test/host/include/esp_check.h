@@ -0,0 +1,6 @@
+#ifndef KIDOO_HOST_ESP_CHECK_H
+#define KIDOO_HOST_ESP_CHECK_H
+
+#include "esp_err.h"
+
+#endif // KIDOO_HOST_ESP_CHECK_H
@@ -0,0 +1,24 @@
+#ifndef KIDOO_HOST_ESP_ERR_H
+#define KIDOO_HOST_ESP_ERR_H
+
+// Codes d'erreur ESP-IDF utilisés par les drivers (sous-ensemble)
+typedef int esp_err_t;
+
+#define ESP_OK                0
+#define ESP_FAIL              -1
+#define ESP_ERR_NO_MEM        0x101
+#define ESP_ERR_INVALID_ARG   0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT       0x107
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const char* esp_err_to_name(esp_err_t code);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KIDOO_HOST_ESP_ERR_H
@@ -0,0 +1,20 @@
+#ifndef KIDOO_HOST_ESP_HEAP_CAPS_H
+#define KIDOO_HOST_ESP_HEAP_CAPS_H
+
+// Une seule mémoire sur l'hôte : les capacités sont ignorées (malloc/free)
+#include <cstddef>
+#include <cstdint>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+
+#endif // KIDOO_HOST_ESP_HEAP_CAPS_H
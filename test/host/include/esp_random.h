@@ -0,0 +1,17 @@
+#ifndef KIDOO_HOST_ESP_RANDOM_H
+#define KIDOO_HOST_ESP_RANDOM_H
+
+#include <stdint.h>
+
+// Déterministe sur l'hôte (voir host_random.cpp)
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t esp_random(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KIDOO_HOST_ESP_RANDOM_H
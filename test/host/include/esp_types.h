@@ -0,0 +1,8 @@
+#ifndef KIDOO_HOST_ESP_TYPES_H
+#define KIDOO_HOST_ESP_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#endif // KIDOO_HOST_ESP_TYPES_H
@@ -0,0 +1,39 @@
+#ifndef KIDOO_HOST_FACE_SCENARIO_H
+#define KIDOO_HOST_FACE_SCENARIO_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Séquence fixe de la face Gotchi pour les tests natifs (golden, bench)
+ *
+ * Rejoue ce que fait la vue face à 30 FPS (BehaviorEngine, FaceOverlayLayer,
+ * FaceEngine -> FaceRenderer) avec des actions scriptées : expressions,
+ * clignement, saleté, objets, chip, 💢, bouche ouverte, sommeil. Les modes
+ * auto sont coupés ; l'aléatoire restant (positions) vient de HostRandom.
+ * Chaque étape se termine par un point de contrôle nommé, flush terminé.
+ */
+namespace FaceScenario {
+
+constexpr uint32_t FRAME_MS = 33;
+
+// Graine, horloge, thème et init des moteurs comme gotchi_lvgl::init()
+void begin();
+
+// Une frame de la vue face (view_face.cpp)
+void step();
+
+using CheckpointFn = void (*)(const char* name);
+
+// begin() puis toute la séquence ; onCheckpoint peut être nullptr
+void run(CheckpointFn onCheckpoint);
+
+// Nombre de frames jouées par run()
+uint32_t frameCount();
+
+// Durée réelle de chaque step() de run() (µs, micros()), pour les benchmarks
+const std::vector<uint32_t>& frameTimesUs();
+
+} // namespace FaceScenario
+
+#endif // KIDOO_HOST_FACE_SCENARIO_H
@@ -0,0 +1,29 @@
+#ifndef KIDOO_HOST_FREERTOS_H
+#define KIDOO_HOST_FREERTOS_H
+
+/**
+ * FreeRTOS sur l'hôte : une tâche = un std::thread détaché, un sémaphore =
+ * mutex + variable de condition. Le cœur demandé est ignoré (l'OS répartit),
+ * les priorités aussi. Suffisant pour les pipelines de la face (flush, bande
+ * basse) et les producteurs/consommateurs des tests de concurrence.
+ */
+
+#include <cstdint>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef struct HostTask* TaskHandle_t;
+typedef struct HostSemaphore* SemaphoreHandle_t;
+typedef struct HostQueue* QueueHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+
+#endif // KIDOO_HOST_FREERTOS_H
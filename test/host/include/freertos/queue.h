@@ -0,0 +1,13 @@
+#ifndef KIDOO_HOST_FREERTOS_QUEUE_H
+#define KIDOO_HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+// File de taille fixe, éléments copiés (mutex + variable de condition)
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+void vQueueDelete(QueueHandle_t queue);
+
+#endif // KIDOO_HOST_FREERTOS_QUEUE_H
@@ -0,0 +1,12 @@
+#ifndef KIDOO_HOST_FREERTOS_SEMPHR_H
+#define KIDOO_HOST_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+#endif // KIDOO_HOST_FREERTOS_SEMPHR_H
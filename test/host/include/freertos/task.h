@@ -0,0 +1,21 @@
+#ifndef KIDOO_HOST_FREERTOS_TASK_H
+#define KIDOO_HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                       void* param, UBaseType_t priority, TaskHandle_t* handle);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+// Une tâche hôte ne peut être supprimée que par elle-même (vTaskDelete(nullptr))
+void vTaskDelete(TaskHandle_t handle);
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment);
+TickType_t xTaskGetTickCount();
+BaseType_t xPortGetCoreID();
+
+#endif // KIDOO_HOST_FREERTOS_TASK_H
@@ -0,0 +1,8 @@
+#ifndef KIDOO_HOST_HAL_GPIO_TYPES_H
+#define KIDOO_HOST_HAL_GPIO_TYPES_H
+
+// Numéro de GPIO des drivers IDF (les broches sont passées par cast depuis
+// les config.h ; GPIO_NUM_MAX couvre celles de l'ESP32-S3)
+typedef enum { GPIO_NUM_NC = -1, GPIO_NUM_MAX = 49 } gpio_num_t;
+
+#endif // KIDOO_HOST_HAL_GPIO_TYPES_H
@@ -0,0 +1,24 @@
+#ifndef KIDOO_HOST_BENCH_H
+#define KIDOO_HOST_BENCH_H
+
+#include <cstdint>
+
+/**
+ * Mesures des benchmarks natifs
+ * Temps réel en ns (steady_clock). Les chiffres comparent deux noyaux sur la
+ * même machine ; ils ne remplacent pas une mesure sur la cible.
+ */
+namespace HostBench {
+
+uint64_t nowNs();
+
+// Compteur de cycles (TSC sur x86, compteur virtuel sur arm64, sinon ns) :
+// pour des écarts de quelques centaines de cycles par appel
+uint64_t cycles();
+
+// Évite que le compilateur supprime un calcul dont le résultat n'est pas lu
+void keep(const void* p);
+
+} // namespace HostBench
+
+#endif // KIDOO_HOST_BENCH_H
@@ -0,0 +1,19 @@
+#ifndef KIDOO_HOST_CLOCK_H
+#define KIDOO_HOST_CLOCK_H
+
+#include <cstdint>
+
+/**
+ * Horloge virtuelle derrière millis() (tests natifs)
+ * Part de 0 et n'avance que par set()/advance() : une séquence de frames
+ * donne toujours les mêmes instants. delay() avance aussi cette horloge.
+ */
+namespace HostClock {
+
+void set(uint32_t ms);
+void advance(uint32_t ms);
+uint32_t now();
+
+} // namespace HostClock
+
+#endif // KIDOO_HOST_CLOCK_H
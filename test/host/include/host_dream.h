@@ -0,0 +1,28 @@
+#ifndef KIDOO_HOST_DREAM_H
+#define KIDOO_HOST_DREAM_H
+
+#include <cstdint>
+
+/**
+ * Environnement Dream simulé (env:native)
+ * LEDOutput::show() copie la bande dans une trame lisible depuis le test
+ * (sous verrou : la tâche LED écrit pendant que le test lit). Pas de carte
+ * SD ni de BLE ; InitManager::getConfig() rend la configuration ci-dessous.
+ */
+namespace HostDream {
+
+constexpr uint8_t LED_BRIGHTNESS = 255;
+constexpr uint32_t SLEEP_TIMEOUT_MS = 10000;
+
+// Dernière trame envoyée (0xRRGGBB par LED) ; rend le nombre d'envois
+uint32_t shownFrame(uint32_t* pixels, uint16_t count);
+
+// LEDOutput::getStats().sent, lu sous le même verrou
+uint32_t sentFrames();
+
+// LEDOutput::resetStats() appelés ailleurs que dans la tâche qui envoie les trames
+uint32_t foreignStatsResets();
+
+} // namespace HostDream
+
+#endif // KIDOO_HOST_DREAM_H
@@ -0,0 +1,30 @@
+#ifndef KIDOO_HOST_GOLDEN_H
+#define KIDOO_HOST_GOLDEN_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Comparaison pixel à pixel avec les images golden d'une suite
+ *
+ * Les golden sont dans le dossier golden/ à côté du fichier de test
+ * (goldenDir(__FILE__)). Pour les régénérer après un changement de rendu
+ * voulu : KIDOO_UPDATE_GOLDEN=1 pio test -e native_gotchi, puis relire les PNG
+ * modifiés avant de les committer. En cas d'écart, l'image obtenue est écrite
+ * à côté (<nom>.actual.png, ignoré par git).
+ */
+namespace HostGolden {
+
+std::string goldenDir(const char* sourceFile);
+
+struct Result {
+  bool ok;
+  std::string message;  // Vide si ok
+};
+
+Result compareRgb565(const std::string& dir, const char* name,
+                     const uint16_t* pixels, int w, int h, int stride);
+
+} // namespace HostGolden
+
+#endif // KIDOO_HOST_GOLDEN_H
@@ -0,0 +1,22 @@
+#ifndef KIDOO_HOST_GOTCHI_H
+#define KIDOO_HOST_GOTCHI_H
+
+#include "host_panel.h"
+
+/**
+ * Environnement Gotchi simulé (env:native)
+ * getGotchiGfx() rend ce panel 466x466. Les modules matériels appelés par la
+ * face (vibreur, haut-parleur, config SD) sont remplacés par des no-op.
+ * Le codec ES8311 est un fake qui retient le volume demandé ; l'I2S est
+ * simulé par host_i2s.h.
+ */
+namespace HostGotchi {
+
+HostPanel& panel();
+
+// Dernier volume passé à es8311_voice_volume_set() (-1 : jamais appelé)
+int codecVolume();
+
+} // namespace HostGotchi
+
+#endif // KIDOO_HOST_GOTCHI_H
@@ -0,0 +1,46 @@
+#ifndef KIDOO_HOST_I2S_H
+#define KIDOO_HOST_I2S_H
+
+#include <cstdint>
+#include <vector>
+#include "driver/i2s_std.h"
+
+/**
+ * Canal I2S TX simulé (driver/i2s_std.h sur l'hôte)
+ *
+ * Les écritures remplissent des descripteurs DMA de dma_frame_num frames.
+ * Par défaut la DMA est instantanée : un descripteur plein part aussitôt
+ * (on_sent), i2s_channel_write() ne bloque jamais. En temps réel, un thread
+ * "DMA" consomme un descripteur toutes les descUs ; l'écriture bloque quand
+ * les dma_desc_num descripteurs sont pleins, et une file vide au moment
+ * d'envoyer appelle on_send_q_ovf (silence, auto_clear).
+ */
+namespace HostI2S {
+
+// Samples envoyés par la DMA depuis le dernier clearOutput() (16 bits,
+// gauche / droite entrelacés en stéréo)
+std::vector<int16_t> output();
+void clearOutput();
+
+// Tant que held, i2s_channel_write() attend à l'entrée : la tâche audio est
+// bloquée et les commandes suivantes s'empilent dans sa file
+void hold(bool held);
+bool writerWaiting();
+
+void startRealtimeDma(uint32_t descUs);
+void stopRealtimeDma();  // Retour à la DMA instantanée
+// Retard ajouté à chaque écriture (tâche plus lente que la DMA)
+void setWriteDelayUs(uint32_t us);
+
+// Descripteurs envoyés, et files vides vues par la DMA temps réel
+uint32_t sentDescriptors();
+uint32_t emptyQueueEvents();
+
+// Configuration reçue du code testé
+i2s_chan_config_t channelConfig();
+i2s_std_config_t stdConfig();
+bool enabled();
+
+} // namespace HostI2S
+
+#endif // KIDOO_HOST_I2S_H
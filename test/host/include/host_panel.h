@@ -0,0 +1,35 @@
+#ifndef KIDOO_HOST_PANEL_H
+#define KIDOO_HOST_PANEL_H
+
+#include <Arduino_GFX_Library.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Écran capturé en mémoire (RGB565), à la place du CO5300.
+ * Compte aussi ce que le code pousse : nombre d'appels draw16bitRGBBitmap et
+ * pixels transférés, pour vérifier le damage tracking du FaceRenderer.
+ */
+class HostPanel : public Arduino_GFX {
+public:
+  HostPanel(int16_t w, int16_t h);
+
+  void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override;
+  void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override;
+
+  const uint16_t* pixels() const { return _pixels.data(); }
+  uint16_t pixel(int16_t x, int16_t y) const { return _pixels[(size_t)y * _width + x]; }
+
+  uint32_t bitmapCalls() const { return _bitmapCalls; }
+  uint64_t bitmapPixels() const { return _bitmapPixels; }
+  void resetCounters() { _bitmapCalls = 0; _bitmapPixels = 0; }
+
+private:
+  std::vector<uint16_t> _pixels;
+  uint32_t _bitmapCalls = 0;
+  uint64_t _bitmapPixels = 0;
+};
+
+#endif // KIDOO_HOST_PANEL_H
@@ -0,0 +1,21 @@
+#ifndef KIDOO_HOST_PNG_H
+#define KIDOO_HOST_PNG_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Lecture/écriture PNG (zlib) des images RGB565 des tests
+ * Les fichiers sont en RGB 8 bits : chaque canal est étendu en répétant ses
+ * bits de poids fort (exact et réversible), on relit donc le RGB565 d'origine.
+ */
+namespace HostPng {
+
+bool writeRgb565(const char* path, const uint16_t* pixels, int w, int h, int stride);
+
+// Accepte tout PNG RGB/RGBA 8 bits non entrelacé (alpha ignoré)
+bool readRgb565(const char* path, std::vector<uint16_t>& pixels, int& w, int& h);
+
+} // namespace HostPng
+
+#endif // KIDOO_HOST_PNG_H
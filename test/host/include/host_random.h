@@ -0,0 +1,18 @@
+#ifndef KIDOO_HOST_RANDOM_H
+#define KIDOO_HOST_RANDOM_H
+
+#include <cstdint>
+
+/**
+ * rand()/srand() et esp_random() sont redéfinis sur l'hôte par un LCG fixe
+ * (host_random.cpp) : les positions tirées au hasard (saleté, objets, regard)
+ * sont les mêmes sur toutes les libc, donc les images golden aussi.
+ */
+namespace HostRandom {
+
+// Repart de la graine donnée (rand() et esp_random())
+void reset(uint32_t seed = 1);
+
+} // namespace HostRandom
+
+#endif // KIDOO_HOST_RANDOM_H
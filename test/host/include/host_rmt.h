@@ -0,0 +1,31 @@
+#ifndef KIDOO_HOST_RMT_H
+#define KIDOO_HOST_RMT_H
+
+#include <cstdint>
+#include <vector>
+#include "driver/rmt.h"
+
+/**
+ * Canal RMT TX simulé (driver/rmt.h sur l'hôte)
+ *
+ * Les symboles de chaque rmt_write_items() sont copiés (l'appelant peut
+ * réécrire son buffer aussitôt). Un canal "occupé" fait échouer
+ * rmt_wait_tx_done() par timeout, comme une trame qui ne se termine pas.
+ */
+namespace HostRMT {
+
+void reset();  // Oublie les envois (la configuration reste)
+
+// Configuration reçue du code testé
+rmt_config_t config();
+bool installed();
+
+// Nombre de rmt_write_items() et symboles du dernier
+uint32_t writes();
+std::vector<rmt_item32_t> lastItems();
+
+void setBusy(bool busy);
+
+} // namespace HostRMT
+
+#endif // KIDOO_HOST_RMT_H
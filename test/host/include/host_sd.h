@@ -0,0 +1,24 @@
+#ifndef KIDOO_HOST_SD_CARD_H
+#define KIDOO_HOST_SD_CARD_H
+
+#include <cstdint>
+
+/**
+ * Carte SD simulée (SD.h sur l'hôte)
+ * Un dossier de l'hôte sert de racine : SD.open("/a.mp3") ouvre
+ * <dossier>/a.mp3 en lecture (ou écriture / ajout). Les compteurs
+ * permettent de vérifier qu'une lecture n'a pas touché la carte.
+ */
+namespace HostSD {
+
+void mount(const char* hostDir);
+void unmount();  // Plus de carte : SD.open() échoue
+
+// Fichiers ouverts avec succès, octets lus sur la carte
+uint32_t opens();
+uint64_t bytesRead();
+void resetCounters();
+
+} // namespace HostSD
+
+#endif // KIDOO_HOST_SD_CARD_H
@@ -0,0 +1,19 @@
+#ifndef KIDOO_HOST_SERIAL_H
+#define KIDOO_HOST_SERIAL_H
+
+#include <string>
+
+/**
+ * Capture de Serial (tests natifs)
+ * Pendant une capture, ce qui est écrit sur Serial (par n'importe quel
+ * thread, tâche de log comprise) est gardé au lieu d'aller sur stdout.
+ */
+namespace HostSerialCapture {
+
+void start();        // Vide le texte capturé et commence la capture
+std::string text();  // Texte capturé depuis start()
+void stop();         // Retour sur stdout
+
+} // namespace HostSerialCapture
+
+#endif // KIDOO_HOST_SERIAL_H
@@ -0,0 +1,6 @@
+#ifndef KIDOO_HOST_LVGL_H
+#define KIDOO_HOST_LVGL_H
+
+// face_renderer.h inclut lvgl.h sans en utiliser les types : rien à fournir
+
+#endif // KIDOO_HOST_LVGL_H
@@ -0,0 +1,15 @@
+#ifndef KIDOO_HOST_PGMSPACE_H
+#define KIDOO_HOST_PGMSPACE_H
+
+// Sur l'hôte la flash est de la RAM ordinaire
+#include <cstdint>
+#include <cstring>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define memcpy_P memcpy
+
+#endif // KIDOO_HOST_PGMSPACE_H
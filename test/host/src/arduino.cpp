@@ -0,0 +1,132 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include "esp_err.h"
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include "host_clock.h"
+#include "host_serial.h"
+
+HostSerial Serial;
+HostEsp ESP;
+HostWire Wire;
+
+namespace {
+std::atomic<uint32_t> s_millis{0};
+const auto s_start = std::chrono::steady_clock::now();
+constexpr int PIN_COUNT = 64;
+std::atomic<int> s_pinLevel[PIN_COUNT] = {};
+std::atomic<bool> s_psram{false};
+
+std::mutex s_serialMutex;
+bool s_capturing = false;
+std::string s_captured;
+
+// Tout ce qui sort sur Serial passe ici (capture ou stdout)
+size_t serialWrite(const char* text, int length) {
+  if (length <= 0) return 0;
+  std::lock_guard<std::mutex> lock(s_serialMutex);
+  if (s_capturing) {
+    s_captured.append(text, (size_t)length);
+  } else {
+    fwrite(text, 1, (size_t)length, stdout);
+  }
+  return (size_t)length;
+}
+
+size_t serialPrintf(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+size_t serialPrintf(const char* format, ...) {
+  char buffer[1024];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  return serialWrite(buffer, std::min(n, (int)sizeof(buffer) - 1));
+}
+}
+
+namespace HostSerialCapture {
+
+void start() {
+  std::lock_guard<std::mutex> lock(s_serialMutex);
+  s_captured.clear();
+  s_capturing = true;
+}
+
+std::string text() {
+  std::lock_guard<std::mutex> lock(s_serialMutex);
+  return s_captured;
+}
+
+void stop() {
+  std::lock_guard<std::mutex> lock(s_serialMutex);
+  s_capturing = false;
+}
+
+} // namespace HostSerialCapture
+
+namespace HostClock {
+
+void set(uint32_t ms) { s_millis.store(ms); }
+void advance(uint32_t ms) { s_millis.fetch_add(ms); }
+uint32_t now() { return s_millis.load(); }
+
+} // namespace HostClock
+
+unsigned long millis() { return HostClock::now(); }
+
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - s_start).count();
+}
+
+void delay(unsigned long ms) { HostClock::advance((uint32_t)ms); }
+
+bool psramFound() { return s_psram.load(); }
+
+void HostEsp::setPsram(bool present) { s_psram.store(present); }
+
+void digitalWrite(int pin, int level) {
+  if (pin >= 0 && pin < PIN_COUNT) s_pinLevel[pin].store(level);
+}
+
+int digitalRead(int pin) {
+  return pin >= 0 && pin < PIN_COUNT ? s_pinLevel[pin].load() : LOW;
+}
+
+const char* esp_err_to_name(esp_err_t code) {
+  switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    default: return "ESP_ERR";
+  }
+}
+
+int HostSerial::printf(const char* format, ...) {
+  char buffer[1024];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  serialWrite(buffer, std::min(n, (int)sizeof(buffer) - 1));
+  return n;
+}
+
+size_t HostSerial::print(const char* s) { return serialWrite(s, (int)strlen(s)); }
+size_t HostSerial::print(char c) { return serialWrite(&c, 1); }
+
+size_t HostSerial::print(long v, int base) {
+  return base == HEX ? serialPrintf("%lX", (unsigned long)v) : serialPrintf("%ld", v);
+}
+
+size_t HostSerial::print(unsigned long v, int base) {
+  return base == HEX ? serialPrintf("%lX", v) : serialPrintf("%lu", v);
+}
+
+size_t HostSerial::print(double v, int digits) { return serialPrintf("%.*f", digits, v); }
+size_t HostSerial::println() { return serialWrite("\n", 1); }
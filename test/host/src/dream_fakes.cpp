@@ -0,0 +1,93 @@
+#ifdef KIDOO_MODEL_DREAM
+
+#include "host_dream.h"
+#include "models/model_config.h"
+#include "common/managers/led/led_output.h"
+#include "common/managers/init/init_manager.h"
+#include "common/managers/sd/sd_manager.h"
+#include "common/managers/ble_config/ble_config_manager.h"
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+std::mutex s_frameMutex;
+uint32_t s_frame[NUM_LEDS > 0 ? NUM_LEDS : 1];
+uint32_t s_shows = 0;
+std::thread::id s_showThread;   // Tâche qui appelle show()
+uint32_t s_foreignResets = 0;   // resetStats() appelés depuis une autre tâche
+
+} // namespace
+
+namespace HostDream {
+
+uint32_t shownFrame(uint32_t* pixels, uint16_t count) {
+  std::lock_guard<std::mutex> lock(s_frameMutex);
+  if (count > NUM_LEDS) count = NUM_LEDS;
+  memcpy(pixels, s_frame, count * sizeof(uint32_t));
+  return s_shows;
+}
+
+uint32_t sentFrames() {
+  std::lock_guard<std::mutex> lock(s_frameMutex);
+  return LEDOutput::getStats().sent;
+}
+
+uint32_t foreignStatsResets() {
+  std::lock_guard<std::mutex> lock(s_frameMutex);
+  return s_foreignResets;
+}
+
+} // namespace HostDream
+
+// Sortie simulée : chaque envoi est copié tel quel (pas de suppression des
+// trames identiques, pas de RMT)
+LEDOutput::Stats LEDOutput::stats = {};
+
+bool LEDOutput::begin(Adafruit_NeoPixel*) { return true; }
+
+bool LEDOutput::show(Adafruit_NeoPixel* strip) {
+  std::lock_guard<std::mutex> lock(s_frameMutex);
+  const uint16_t count = strip->numPixels() < NUM_LEDS ? strip->numPixels() : NUM_LEDS;
+  for (uint16_t i = 0; i < count; i++) {
+    s_frame[i] = strip->getPixelColor(i);
+  }
+  s_shows++;
+  s_showThread = std::this_thread::get_id();
+  stats.sent++;
+  return true;
+}
+
+bool LEDOutput::isAsync() { return true; }
+
+const char* LEDOutput::getName() { return "host"; }
+
+const LEDOutput::Stats& LEDOutput::getStats() { return stats; }
+
+// Sous le verrou de la trame : le test relit les stats pendant les envois.
+// Le verrou masquerait une remise à zéro faite hors de la tâche LED : elle est comptée
+void LEDOutput::resetStats() {
+  std::lock_guard<std::mutex> lock(s_frameMutex);
+  if (s_showThread != std::thread::id() && s_showThread != std::this_thread::get_id()) s_foreignResets++;
+  stats = {};
+}
+
+// Pas de carte SD : configuration par défaut de host_dream.h
+const SDConfig& InitManager::getConfig() {
+  static SDConfig config = []() {
+    SDConfig c;
+    memset(&c, 0, sizeof(c));
+    c.led_brightness = HostDream::LED_BRIGHTNESS;
+    c.sleep_timeout_ms = HostDream::SLEEP_TIMEOUT_MS;
+    return c;
+  }();
+  return config;
+}
+
+bool SDManager::isAvailable() { return false; }
+
+// BLE jamais activé : le sleep mode suit son timeout
+bool BLEConfigManager::isBLEEnabled() { return false; }
+
+#endif // KIDOO_MODEL_DREAM
@@ -0,0 +1,116 @@
+#ifdef KIDOO_MODEL_GOTCHI
+
+#include "face_scenario.h"
+#include <Arduino.h>
+#include "host_clock.h"
+#include "host_random.h"
+#include "models/gotchi/config/gotchi_theme.h"
+#include "models/gotchi/face/face_engine.h"
+#include "models/gotchi/face/face_renderer.h"
+#include "models/gotchi/face/behavior/behavior_engine.h"
+#include "models/gotchi/face/behavior/behavior_objects.h"
+#include "models/gotchi/face/behavior/dirt_overlay.h"
+#include "models/gotchi/face/behavior/top_chip.h"
+#include "models/gotchi/face/behavior/sprites/sprite_heart_24.h"
+#include "models/gotchi/face/overlay/face_overlay_layer.h"
+
+namespace {
+
+uint32_t s_frames = 0;
+std::vector<uint32_t> s_frameTimes;
+
+void steps(int n) {
+  for (int i = 0; i < n; i++) FaceScenario::step();
+}
+
+void checkpoint(FaceScenario::CheckpointFn fn, const char* name) {
+  FaceRenderer::waitFlush();
+  if (fn) fn(name);
+}
+
+} // namespace
+
+namespace FaceScenario {
+
+void begin() {
+  HostRandom::reset(1);
+  HostClock::set(0);
+  s_frames = 0;
+  s_frameTimes.clear();
+  GotchiTheme::setPreset(GotchiTheme::Preset::Boy);
+  FaceOverlayLayer::init();
+  FaceEngine::init();
+  BehaviorEngine::init();
+  BehaviorEngine::forceState("idle");  // Coupe aussi le mode auto
+  FaceEngine::setAutoMode(false);
+}
+
+void step() {
+  const uint32_t t0 = micros();
+  BehaviorEngine::update(FRAME_MS);
+  FaceOverlayLayer::update(FRAME_MS);
+  FaceEngine::update(FRAME_MS);
+  s_frameTimes.push_back(micros() - t0);
+  HostClock::advance(FRAME_MS);
+  s_frames++;
+}
+
+void run(CheckpointFn onCheckpoint) {
+  begin();
+  BehaviorStats& stats = BehaviorEngine::getStats();
+
+  steps(10);
+  checkpoint(onCheckpoint, "neutral");
+
+  FaceEngine::setExpression(FaceExpression::Happy);
+  FaceEngine::lookAt(0.5f, -0.3f);
+  stats.mouthState = 0.8f;
+  steps(15);
+  checkpoint(onCheckpoint, "happy_smile");
+
+  FaceEngine::blink();
+  steps(3);
+  checkpoint(onCheckpoint, "blink");
+  steps(6);
+
+  DirtOverlay::setDirty(25.0f);
+  steps(5);
+  checkpoint(onCheckpoint, "dirt");
+
+  BehaviorObjects::spawn(ObjectShape::Circle, 0xFFD000, 18, 150, 120, 0.08f, 0.0f,
+                         0.0004f, 0.6f, true, 0);
+  BehaviorObjects::spawnSprite(SPRITE_HEART_24_ASSET, 0xFF3070, 300, 110, 0.0f, -0.02f,
+                               0.0f, 0.0f, false, 0);
+  steps(10);
+  checkpoint(onCheckpoint, "objects");
+
+  BehaviorObjects::destroyAll();
+  DirtOverlay::clear();
+  TopChip::show("38.5^C", 0xF800);
+  FaceOverlayLayer::setMangaCross(true);
+  FaceEngine::setExpression(FaceExpression::Angry);
+  FaceEngine::lookAt(0, 0);
+  stats.mouthState = 0.0f;
+  steps(12);
+  checkpoint(onCheckpoint, "chip_anger");
+
+  TopChip::hide();
+  FaceOverlayLayer::setMangaCross(false);
+  FaceEngine::setExpression(FaceExpression::Surprised);
+  stats.mouthState = -0.9f;
+  steps(12);
+  checkpoint(onCheckpoint, "mouth_open");
+
+  stats.mouthState = 0.0f;
+  BehaviorEngine::sleep();
+  steps(150);  // 💤 après 4 s de sommeil
+  checkpoint(onCheckpoint, "sleep");
+}
+
+uint32_t frameCount() { return s_frames; }
+
+const std::vector<uint32_t>& frameTimesUs() { return s_frameTimes; }
+
+} // namespace FaceScenario
+
+#endif // KIDOO_MODEL_GOTCHI
@@ -0,0 +1,150 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <freertos/queue.h>
+#include <chrono>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+
+// Les objets ne sont jamais libérés : une tâche FreeRTOS tourne en général
+// jusqu'au reset, ici jusqu'à la fin du processus (threads détachés).
+struct HostTask {
+  TaskFunction_t fn;
+  void* param;
+};
+
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool available;
+};
+
+struct HostQueue {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::vector<uint8_t>> items;
+  size_t length;
+  size_t itemSize;
+};
+
+namespace {
+thread_local TaskHandle_t t_current = nullptr;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t,
+                                   void* param, UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+  TaskHandle_t task = new HostTask{fn, param};
+  if (handle) *handle = task;
+  std::thread([task]() {
+    t_current = task;
+    task->fn(task->param);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                       void* param, UBaseType_t priority, TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, 0);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return t_current; }
+
+void vTaskDelete(TaskHandle_t handle) {
+  // Seule l'auto-suppression a un sens avec un thread : on le laisse se terminer
+  if (handle == nullptr || handle == t_current) {
+    for (;;) std::this_thread::sleep_for(std::chrono::hours(1));
+  }
+}
+
+// Les tâches hôtes ne font pas avancer l'horloge virtuelle : une attente est
+// un simple passage de main (le test pilote le temps)
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::microseconds(ticks ? 100 : 0));
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+  *previousWake += increment;
+  vTaskDelay(increment);
+}
+
+TickType_t xTaskGetTickCount() { return (TickType_t)HostClock::now(); }
+
+BaseType_t xPortGetCoreID() { return 0; }
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore{{}, {}, false}; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore{{}, {}, true}; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(sem->mutex);
+  if (ticks == portMAX_DELAY) {
+    sem->cv.wait(lock, [sem]() { return sem->available; });
+  } else if (!sem->cv.wait_for(lock, std::chrono::milliseconds(ticks),
+                               [sem]() { return sem->available; })) {
+    return pdFALSE;
+  }
+  sem->available = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  {
+    std::lock_guard<std::mutex> lock(sem->mutex);
+    if (sem->available) return pdFALSE;
+    sem->available = true;
+  }
+  sem->cv.notify_one();
+  return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) { delete sem; }
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  QueueHandle_t queue = new HostQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+// Même convention que les sémaphores : attentes en temps réel, 0 = sans attendre
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  auto hasRoom = [queue]() { return queue->items.size() < queue->length; };
+  if (ticks == portMAX_DELAY) {
+    queue->cv.wait(lock, hasRoom);
+  } else if (!queue->cv.wait_for(lock, std::chrono::milliseconds(ticks), hasRoom)) {
+    return pdFALSE;
+  }
+  const uint8_t* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  lock.unlock();
+  queue->cv.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  auto hasItem = [queue]() { return !queue->items.empty(); };
+  if (ticks == portMAX_DELAY) {
+    queue->cv.wait(lock, hasItem);
+  } else if (!queue->cv.wait_for(lock, std::chrono::milliseconds(ticks), hasItem)) {
+    return pdFALSE;
+  }
+  memcpy(buffer, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  lock.unlock();
+  queue->cv.notify_all();
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return (UBaseType_t)queue->items.size();
+}
+
+void vQueueDelete(QueueHandle_t queue) { delete queue; }
@@ -0,0 +1,102 @@
+#ifdef KIDOO_MODEL_GOTCHI
+
+#include "host_gotchi.h"
+#include "models/model_config.h"
+#include "common/managers/sd/sd_manager.h"
+#include "common/managers/vibrator/vibrator_manager.h"
+#include "models/gotchi/config/gotchi_config.h"
+#include "models/gotchi/audio/gotchi_speaker_test.h"
+#include <atomic>
+#include <cstring>
+
+extern "C" {
+#include "models/gotchi/audio/es8311.h"
+}
+
+namespace {
+std::atomic<int> s_codecVolume{-1};
+int s_codecInstance = 0;
+}
+
+namespace HostGotchi {
+
+HostPanel& panel() {
+  static HostPanel s_panel(GOTCHI_LCD_WIDTH, GOTCHI_LCD_HEIGHT);
+  return s_panel;
+}
+
+int codecVolume() { return s_codecVolume.load(); }
+
+} // namespace HostGotchi
+
+// ES8311 (gotchi_audio.cpp) : pas de registres, seul le volume est retenu
+extern "C" {
+es8311_handle_t es8311_create(const unsigned int, const uint16_t) { return &s_codecInstance; }
+void es8311_delete(es8311_handle_t) {}
+esp_err_t es8311_init(es8311_handle_t, const es8311_clock_config_t* const, const es8311_resolution_t,
+                      const es8311_resolution_t) { return ESP_OK; }
+esp_err_t es8311_sample_frequency_config(es8311_handle_t, int, int) { return ESP_OK; }
+esp_err_t es8311_microphone_config(es8311_handle_t, bool) { return ESP_OK; }
+esp_err_t es8311_microphone_gain_set(es8311_handle_t, es8311_mic_gain_t) { return ESP_OK; }
+esp_err_t es8311_voice_volume_set(es8311_handle_t, int volume, int* volumeSet) {
+  s_codecVolume.store(volume);
+  if (volumeSet) *volumeSet = volume;
+  return ESP_OK;
+}
+}
+
+// Sur la carte, heap_caps_calloc est enveloppé par l'éditeur de liens
+// (-Wl,--wrap) : l'original reste accessible sous __real_
+extern "C" void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  return heap_caps_calloc(n, size, caps);
+}
+
+// gotchi_lvgl.cpp : accès au panel partagé avec LVGL
+Arduino_GFX* getGotchiGfx() { return &HostGotchi::panel(); }
+void lockGotchiGfx() {}
+void unlockGotchiGfx() {}
+
+// Pas de carte SD : configuration vide (thème par défaut)
+SDConfig SDManager::getConfig() {
+  SDConfig config;
+  memset(&config, 0, sizeof(config));
+  return config;
+}
+
+bool SDManager::saveConfig(const SDConfig&) { return true; }
+
+// Stats vivantes : pas de config.json, toujours les défauts d'un gotchi neuf
+// (mêmes valeurs que gotchi_config.cpp), rien n'est persisté
+void GotchiConfigManager::initDefault(GotchiStatsConfig* stats) {
+  if (!stats) return;
+  stats->valid        = false;
+  stats->hunger       = 70.0f;
+  stats->energy       = 80.0f;
+  stats->happiness    = 60.0f;
+  stats->health       = 90.0f;
+  stats->hygiene      = 70.0f;
+  stats->boredom      = 20.0f;
+  stats->irritability = 0.0f;
+  stats->ageMinutes   = 0;
+  stats->lastSavedAt  = 0;
+}
+
+GotchiStatsConfig GotchiConfigManager::getStats() {
+  GotchiStatsConfig stats;
+  initDefault(&stats);
+  return stats;
+}
+
+bool GotchiConfigManager::saveStats(const GotchiStatsConfig&) { return true; }
+
+#ifdef HAS_VIBRATOR
+void VibratorManager::pulseAuto(uint32_t, uint8_t) {}
+void VibratorManager::update() {}
+#endif
+
+namespace GotchiSpeakerTest {
+void playAdpcmAsync(const uint8_t*, uint32_t) {}
+void playEatingSound() {}
+} // namespace GotchiSpeakerTest
+
+#endif // KIDOO_MODEL_GOTCHI
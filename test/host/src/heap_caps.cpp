@@ -0,0 +1,12 @@
+#include <esp_heap_caps.h>
+#include <cstdlib>
+
+void* heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+void* heap_caps_calloc(size_t n, size_t size, uint32_t) { return calloc(n, size); }
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t) {
+  void* ptr = nullptr;
+  return posix_memalign(&ptr, alignment < sizeof(void*) ? sizeof(void*) : alignment, size) == 0 ? ptr : nullptr;
+}
+
+void heap_caps_free(void* ptr) { free(ptr); }
+size_t heap_caps_get_free_size(uint32_t) { return 8u * 1024 * 1024; }
@@ -0,0 +1,60 @@
+#include "host_golden.h"
+#include "host_png.h"
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <vector>
+
+namespace HostGolden {
+
+std::string goldenDir(const char* sourceFile) {
+  std::string dir(sourceFile);
+  const size_t slash = dir.find_last_of("/\\");
+  dir = slash == std::string::npos ? std::string(".") : dir.substr(0, slash);
+  return dir + "/golden";
+}
+
+Result compareRgb565(const std::string& dir, const char* name,
+                     const uint16_t* pixels, int w, int h, int stride) {
+  const std::string path = dir + "/" + name + ".png";
+  char msg[256];
+
+  const char* update = getenv("KIDOO_UPDATE_GOLDEN");
+  if (update && update[0] && update[0] != '0') {
+    mkdir(dir.c_str(), 0755);  // Nouvelle suite : golden/ n'existe pas encore
+    if (!HostPng::writeRgb565(path.c_str(), pixels, w, h, stride)) {
+      return { false, "ecriture impossible: " + path };
+    }
+    return { true, "" };
+  }
+
+  std::vector<uint16_t> golden;
+  int gw = 0, gh = 0;
+  if (!HostPng::readRgb565(path.c_str(), golden, gw, gh)) {
+    return { false, "golden illisible: " + path + " (KIDOO_UPDATE_GOLDEN=1 pour le creer)" };
+  }
+  if (gw != w || gh != h) {
+    snprintf(msg, sizeof(msg), "%s: taille %dx%d, golden %dx%d", name, w, h, gw, gh);
+    return { false, msg };
+  }
+
+  uint32_t diff = 0;
+  int firstX = -1, firstY = -1;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      if (pixels[(size_t)y * stride + x] == golden[(size_t)y * w + x]) continue;
+      if (!diff) { firstX = x; firstY = y; }
+      diff++;
+    }
+  }
+  if (!diff) return { true, "" };
+
+  const std::string actual = dir + "/" + name + ".actual.png";
+  HostPng::writeRgb565(actual.c_str(), pixels, w, h, stride);
+  snprintf(msg, sizeof(msg), "%s: %u pixels differents (premier en %d,%d : 0x%04X au lieu de 0x%04X), voir %s.actual.png",
+           name, (unsigned)diff, firstX, firstY,
+           pixels[(size_t)firstY * stride + firstX], golden[(size_t)firstY * w + firstX], name);
+  return { false, msg };
+}
+
+} // namespace HostGolden
@@ -0,0 +1,30 @@
+#include "host_panel.h"
+
+HostPanel::HostPanel(int16_t w, int16_t h)
+  : Arduino_GFX(w, h), _pixels((size_t)w * h, 0) {}
+
+void HostPanel::writePixelPreclipped(int16_t x, int16_t y, uint16_t color) {
+  _pixels[(size_t)y * _width + x] = color;
+}
+
+void HostPanel::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = 0; j < h; j++) {
+    uint16_t* row = &_pixels[(size_t)(y + j) * _width + x];
+    for (int16_t i = 0; i < w; i++) row[i] = color;
+  }
+}
+
+// Comme le vrai panel : la fenêtre est clippée à l'écran, le bitmap garde son stride w
+void HostPanel::draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+  _bitmapCalls++;
+  _bitmapPixels += (uint64_t)w * h;
+  for (int16_t j = 0; j < h; j++) {
+    const int32_t py = y + j;
+    if (py < 0 || py >= _height) continue;
+    for (int16_t i = 0; i < w; i++) {
+      const int32_t px = x + i;
+      if (px < 0 || px >= _width) continue;
+      _pixels[(size_t)py * _width + px] = bitmap[(size_t)j * w + i];
+    }
+  }
+}
@@ -0,0 +1,145 @@
+#include "host_png.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <zlib.h>
+
+namespace {
+
+void put32(std::vector<uint8_t>& out, uint32_t v) {
+  out.push_back(v >> 24); out.push_back(v >> 16); out.push_back(v >> 8); out.push_back(v);
+}
+
+uint32_t get32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+void putChunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, size_t len) {
+  put32(out, (uint32_t)len);
+  const size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  if (len) out.insert(out.end(), data, data + len);
+  put32(out, (uint32_t)crc32(0, out.data() + start, (uInt)(len + 4)));
+}
+
+const uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+uint8_t paeth(int a, int b, int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return (uint8_t)a;
+  return (uint8_t)(pb <= pc ? b : c);
+}
+
+} // namespace
+
+namespace HostPng {
+
+bool writeRgb565(const char* path, const uint16_t* pixels, int w, int h, int stride) {
+  // Filtre "none" sur chaque ligne : les frames sont surtout du noir, zlib suffit
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)h * (1 + w * 3));
+  for (int y = 0; y < h; y++) {
+    raw.push_back(0);
+    const uint16_t* row = pixels + (size_t)y * stride;
+    for (int x = 0; x < w; x++) {
+      const uint16_t c = row[x];
+      const uint8_t r = (c >> 11) & 0x1f, g = (c >> 5) & 0x3f, b = c & 0x1f;
+      raw.push_back((uint8_t)((r << 3) | (r >> 2)));
+      raw.push_back((uint8_t)((g << 2) | (g >> 4)));
+      raw.push_back((uint8_t)((b << 3) | (b >> 2)));
+    }
+  }
+  uLongf zlen = compressBound((uLong)raw.size());
+  std::vector<uint8_t> z(zlen);
+  if (compress2(z.data(), &zlen, raw.data(), (uLong)raw.size(), 9) != Z_OK) return false;
+
+  std::vector<uint8_t> out(PNG_SIGNATURE, PNG_SIGNATURE + 8);
+  uint8_t ihdr[13];
+  const uint32_t dims[2] = { (uint32_t)w, (uint32_t)h };
+  for (int i = 0; i < 2; i++) {
+    ihdr[i * 4 + 0] = dims[i] >> 24; ihdr[i * 4 + 1] = dims[i] >> 16;
+    ihdr[i * 4 + 2] = dims[i] >> 8;  ihdr[i * 4 + 3] = dims[i];
+  }
+  ihdr[8] = 8;   // Profondeur
+  ihdr[9] = 2;   // RGB
+  ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0;
+  putChunk(out, "IHDR", ihdr, sizeof(ihdr));
+  putChunk(out, "IDAT", z.data(), zlen);
+  putChunk(out, "IEND", nullptr, 0);
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  const bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+  return fclose(f) == 0 && ok;
+}
+
+bool readRgb565(const char* path, std::vector<uint16_t>& pixels, int& w, int& h) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  std::vector<uint8_t> file;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+  fclose(f);
+  if (file.size() < 8 || memcmp(file.data(), PNG_SIGNATURE, 8) != 0) return false;
+
+  int channels = 0;
+  std::vector<uint8_t> z;
+  for (size_t pos = 8; pos + 12 <= file.size();) {
+    const uint32_t len = get32(&file[pos]);
+    if (pos + 12 + len > file.size()) return false;
+    const uint8_t* type = &file[pos + 4];
+    const uint8_t* data = &file[pos + 8];
+    if (memcmp(type, "IHDR", 4) == 0) {
+      w = (int)get32(data);
+      h = (int)get32(data + 4);
+      if (data[8] != 8 || data[12] != 0) return false;  // 8 bits, non entrelacé
+      if (data[9] == 2) channels = 3;
+      else if (data[9] == 6) channels = 4;
+      else return false;
+    } else if (memcmp(type, "IDAT", 4) == 0) {
+      z.insert(z.end(), data, data + len);
+    }
+    pos += 12 + len;
+  }
+  if (!channels || w <= 0 || h <= 0) return false;
+
+  const size_t rowBytes = (size_t)w * channels;
+  std::vector<uint8_t> raw((rowBytes + 1) * h);
+  uLongf rawLen = (uLongf)raw.size();
+  if (uncompress(raw.data(), &rawLen, z.data(), (uLong)z.size()) != Z_OK || rawLen != raw.size())
+    return false;
+
+  // Défiltrage (les 5 filtres PNG), en place ligne par ligne
+  for (int y = 0; y < h; y++) {
+    uint8_t* row = &raw[(size_t)y * (rowBytes + 1)];
+    const uint8_t filter = row[0];
+    uint8_t* cur = row + 1;
+    const uint8_t* prev = y ? &raw[(size_t)(y - 1) * (rowBytes + 1) + 1] : nullptr;
+    for (size_t i = 0; i < rowBytes; i++) {
+      const int a = i >= (size_t)channels ? cur[i - channels] : 0;
+      const int b = prev ? prev[i] : 0;
+      const int c = (prev && i >= (size_t)channels) ? prev[i - channels] : 0;
+      switch (filter) {
+        case 0: break;
+        case 1: cur[i] = (uint8_t)(cur[i] + a); break;
+        case 2: cur[i] = (uint8_t)(cur[i] + b); break;
+        case 3: cur[i] = (uint8_t)(cur[i] + ((a + b) >> 1)); break;
+        case 4: cur[i] = (uint8_t)(cur[i] + paeth(a, b, c)); break;
+        default: return false;
+      }
+    }
+  }
+
+  pixels.resize((size_t)w * h);
+  for (int y = 0; y < h; y++) {
+    const uint8_t* p = &raw[(size_t)y * (rowBytes + 1) + 1];
+    for (int x = 0; x < w; x++, p += channels) {
+      pixels[(size_t)y * w + x] = (uint16_t)(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+    }
+  }
+  return true;
+}
+
+} // namespace HostPng
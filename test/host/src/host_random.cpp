@@ -0,0 +1,41 @@
+/*
+ * rand()/srand() de l'hôte remplacés par un LCG fixe (celui de l'exemple
+ * ANSI C) : même suite sur glibc, macOS et MinGW. Une définition dans
+ * l'exécutable passe avant celle de la libc. Ce fichier n'inclut pas
+ * <cstdlib> : sa déclaration de rand() porte une spécification d'exception
+ * qui varie d'une libc à l'autre.
+ */
+#include <cstdint>
+#include "host_random.h"
+
+extern "C" {
+
+static uint32_t s_state = 1;
+static uint32_t s_espState = 0x4b1d0;
+
+int rand(void) {
+  s_state = s_state * 1103515245u + 12345u;
+  return (int)((s_state >> 16) & 0x7fff);
+}
+
+void srand(unsigned int seed) { s_state = seed; }
+
+uint32_t esp_random(void) {
+  // xorshift32 : 32 bits utiles comme le RNG matériel
+  s_espState ^= s_espState << 13;
+  s_espState ^= s_espState >> 17;
+  s_espState ^= s_espState << 5;
+  return s_espState;
+}
+
+} // extern "C"
+
+namespace HostRandom {
+
+void reset(uint32_t seed) {
+  s_state = seed;
+  s_espState = seed * 2654435761u;
+  if (!s_espState) s_espState = 0x4b1d0;
+}
+
+} // namespace HostRandom
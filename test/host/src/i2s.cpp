@@ -0,0 +1,232 @@
+#include <driver/i2s_std.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "host_i2s.h"
+
+// Un seul canal TX : celui de GotchiAudio
+struct HostI2SChannel {
+  i2s_chan_config_t chan;
+  i2s_std_config_t std;
+  i2s_event_callbacks_t callbacks;
+  void* userData;
+  bool enabled;
+};
+
+namespace {
+
+HostI2SChannel s_channel = {};
+bool s_created = false;
+
+std::mutex s_mutex;
+std::condition_variable s_cv;
+std::deque<std::vector<uint8_t>> s_ready;  // Descripteurs pleins en attente d'envoi
+std::vector<uint8_t> s_partial;             // Descripteur en cours de remplissage
+std::vector<int16_t> s_output;
+bool s_held = false;
+bool s_waiting = false;
+bool s_realtime = false;
+uint32_t s_descUs = 0;
+std::atomic<uint32_t> s_writeDelayUs{0};
+std::thread s_dma;
+std::atomic<bool> s_dmaRun{false};
+std::atomic<uint32_t> s_sent{0};
+std::atomic<uint32_t> s_empty{0};
+
+// Une frame = un sample 16 bits par slot (deux en stéréo)
+size_t descBytes() {
+  const size_t slots = s_channel.std.slot_cfg.slot_mode == I2S_SLOT_MODE_STEREO ? 2 : 1;
+  return (size_t)s_channel.chan.dma_frame_num * slots * sizeof(int16_t);
+}
+
+// Comme depuis l'ISR du driver (n'appelle pas le stub)
+void notify(i2s_isr_callback_t callback) {
+  if (!callback) return;
+  i2s_event_data_t event = { nullptr, descBytes() };
+  callback(&s_channel, &event, s_channel.userData);
+}
+
+// Le verrou est tenu : le descripteur part dans la sortie
+void sendLocked(const std::vector<uint8_t>& desc) {
+  const size_t n = desc.size() / sizeof(int16_t);
+  const size_t base = s_output.size();
+  s_output.resize(base + n);
+  memcpy(s_output.data() + base, desc.data(), n * sizeof(int16_t));
+  s_sent++;
+}
+
+void dmaLoop() {
+  auto next = std::chrono::steady_clock::now();
+  while (s_dmaRun.load()) {
+    next += std::chrono::microseconds(s_descUs);
+    std::this_thread::sleep_until(next);
+    bool sent = false;
+    {
+      std::lock_guard<std::mutex> lock(s_mutex);
+      if (!s_ready.empty()) {
+        sendLocked(s_ready.front());
+        // Comme l'ISR de l'IDF : on_sent passe avant que l'écriture bloquée
+        // ne voie le descripteur libre
+        notify(s_channel.callbacks.on_sent);
+        s_ready.pop_front();
+        sent = true;
+      }
+    }
+    s_cv.notify_all();
+    if (!sent) {
+      s_empty++;
+      notify(s_channel.callbacks.on_send_q_ovf);
+    }
+  }
+}
+
+} // namespace
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t* config, i2s_chan_handle_t* txHandle,
+                          i2s_chan_handle_t* rxHandle) {
+  if (!config || !txHandle || rxHandle || s_created) return ESP_ERR_INVALID_ARG;
+  s_channel = {};
+  s_channel.chan = *config;
+  s_created = true;
+  *txHandle = &s_channel;
+  return ESP_OK;
+}
+
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t* config) {
+  if (handle != &s_channel || !config) return ESP_ERR_INVALID_ARG;
+  s_channel.std = *config;
+  return ESP_OK;
+}
+
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+                                              const i2s_event_callbacks_t* callbacks, void* userData) {
+  if (handle != &s_channel || !callbacks) return ESP_ERR_INVALID_ARG;
+  if (s_channel.enabled) return ESP_ERR_INVALID_STATE;  // Comme l'IDF
+  s_channel.callbacks = *callbacks;
+  s_channel.userData = userData;
+  return ESP_OK;
+}
+
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle) {
+  if (handle != &s_channel) return ESP_ERR_INVALID_ARG;
+  s_channel.enabled = true;
+  return ESP_OK;
+}
+
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle) {
+  if (handle != &s_channel) return ESP_ERR_INVALID_ARG;
+  s_channel.enabled = false;
+  return ESP_OK;
+}
+
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle) {
+  if (handle != &s_channel) return ESP_ERR_INVALID_ARG;
+  s_created = false;
+  return ESP_OK;
+}
+
+esp_err_t i2s_channel_write(i2s_chan_handle_t handle, const void* src, size_t size,
+                            size_t* bytesWritten, uint32_t) {
+  if (handle != &s_channel || !s_channel.enabled) return ESP_ERR_INVALID_STATE;
+  const uint32_t delayUs = s_writeDelayUs.load();
+  if (delayUs) std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+
+  const uint8_t* p = static_cast<const uint8_t*>(src);
+  size_t done = 0;
+  uint32_t sentNow = 0;
+  {
+    std::unique_lock<std::mutex> lock(s_mutex);
+    s_waiting = true;
+    s_cv.notify_all();
+    s_cv.wait(lock, []() { return !s_held; });
+    s_waiting = false;
+    while (done < size) {
+      const size_t n = std::min(size - done, descBytes() - s_partial.size());
+      s_partial.insert(s_partial.end(), p + done, p + done + n);
+      done += n;
+      if (s_partial.size() < descBytes()) break;
+      if (s_realtime) {
+        // File DMA pleine : l'écriture attend qu'un descripteur parte
+        s_cv.wait(lock, []() { return s_ready.size() < s_channel.chan.dma_desc_num || !s_realtime; });
+      }
+      if (s_realtime) {
+        s_ready.push_back(std::move(s_partial));
+      } else {
+        sendLocked(s_partial);
+        sentNow++;
+      }
+      s_partial.clear();
+    }
+  }
+  for (uint32_t i = 0; i < sentNow; i++) notify(s_channel.callbacks.on_sent);
+  if (bytesWritten) *bytesWritten = done;
+  return ESP_OK;
+}
+
+namespace HostI2S {
+
+std::vector<int16_t> output() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_output;
+}
+
+void clearOutput() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_output.clear();
+  s_sent = 0;
+  s_empty = 0;
+}
+
+void hold(bool held) {
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_held = held;
+  }
+  s_cv.notify_all();
+}
+
+bool writerWaiting() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_waiting;
+}
+
+void startRealtimeDma(uint32_t descUs) {
+  stopRealtimeDma();
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_realtime = true;
+    s_descUs = descUs;
+  }
+  s_dmaRun = true;
+  s_dma = std::thread(dmaLoop);
+}
+
+void stopRealtimeDma() {
+  if (s_dmaRun.exchange(false)) s_dma.join();
+  size_t flushed;
+  {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_realtime = false;
+    // Les descripteurs en file partent d'un coup
+    for (const std::vector<uint8_t>& desc : s_ready) sendLocked(desc);
+    flushed = s_ready.size();
+    s_ready.clear();
+  }
+  s_cv.notify_all();
+  for (size_t i = 0; i < flushed; i++) notify(s_channel.callbacks.on_sent);
+}
+
+void setWriteDelayUs(uint32_t us) { s_writeDelayUs = us; }
+
+uint32_t sentDescriptors() { return s_sent.load(); }
+uint32_t emptyQueueEvents() { return s_empty.load(); }
+
+i2s_chan_config_t channelConfig() { return s_channel.chan; }
+i2s_std_config_t stdConfig() { return s_channel.std; }
+bool enabled() { return s_channel.enabled; }
+
+} // namespace HostI2S
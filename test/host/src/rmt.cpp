@@ -0,0 +1,82 @@
+#include <driver/rmt.h>
+#include <mutex>
+#include "host_rmt.h"
+
+namespace {
+
+std::mutex s_mutex;
+rmt_config_t s_config = {};
+bool s_configured = false;
+bool s_installed = false;
+bool s_busy = false;
+uint32_t s_writes = 0;
+std::vector<rmt_item32_t> s_items;
+
+} // namespace
+
+esp_err_t rmt_config(const rmt_config_t* config) {
+  if (!config || config->channel >= RMT_CHANNEL_MAX) return ESP_ERR_INVALID_ARG;
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_config = *config;
+  s_configured = true;
+  return ESP_OK;
+}
+
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t, int) {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (!s_configured || channel != s_config.channel) return ESP_ERR_INVALID_STATE;
+  if (s_installed) return ESP_ERR_INVALID_STATE;  // Comme l'IDF : une seule installation
+  s_installed = true;
+  return ESP_OK;
+}
+
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t* items, int count, bool) {
+  if (!items || count <= 0) return ESP_ERR_INVALID_ARG;
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (!s_installed || channel != s_config.channel) return ESP_ERR_INVALID_STATE;
+  s_items.assign(items, items + count);
+  s_writes++;
+  return ESP_OK;
+}
+
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t) {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (!s_installed || channel != s_config.channel) return ESP_ERR_INVALID_STATE;
+  return s_busy ? ESP_ERR_TIMEOUT : ESP_OK;
+}
+
+namespace HostRMT {
+
+void reset() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_writes = 0;
+  s_items.clear();
+  s_busy = false;
+}
+
+rmt_config_t config() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_config;
+}
+
+bool installed() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_installed;
+}
+
+uint32_t writes() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_writes;
+}
+
+std::vector<rmt_item32_t> lastItems() {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_items;
+}
+
+void setBusy(bool busy) {
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_busy = busy;
+}
+
+} // namespace HostRMT
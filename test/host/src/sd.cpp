@@ -0,0 +1,135 @@
+#include <SD.h>
+#include <FSImpl.h>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include "host_sd.h"
+
+namespace {
+
+std::mutex s_rootMutex;
+std::string s_root;  // Vide : pas de carte
+std::atomic<uint32_t> s_opens{0};
+std::atomic<uint64_t> s_bytesRead{0};
+
+// Chemin hôte de path, vide sans carte
+std::string hostPath(const char* path) {
+  std::lock_guard<std::mutex> lock(s_rootMutex);
+  if (s_root.empty() || !path || path[0] != '/') return std::string();
+  return s_root + path;
+}
+
+// Fichier (ou dossier, sans contenu) de la carte
+class HostFileImpl : public fs::FileImpl {
+public:
+  HostFileImpl(const char* path, FILE* f, bool dir) : _path(path), _f(f), _dir(dir) {
+    const size_t slash = _path.rfind('/');
+    _name = slash == std::string::npos ? _path : _path.substr(slash + 1);
+  }
+  ~HostFileImpl() override { close(); }
+
+  size_t write(const uint8_t* buf, size_t size) override {
+    return _f ? fwrite(buf, 1, size, _f) : 0;
+  }
+  size_t read(uint8_t* buf, size_t size) override {
+    if (!_f) return 0;
+    const size_t n = fread(buf, 1, size, _f);
+    s_bytesRead += n;
+    return n;
+  }
+  void flush() override { if (_f) fflush(_f); }
+  bool seek(uint32_t pos, fs::SeekMode mode) override {
+    const int whence = mode == fs::SeekCur ? SEEK_CUR : mode == fs::SeekEnd ? SEEK_END : SEEK_SET;
+    return _f && fseek(_f, mode == fs::SeekEnd ? -(long)pos : (long)pos, whence) == 0;
+  }
+  size_t position() const override { return _f ? (size_t)ftell(_f) : 0; }
+  size_t size() const override {
+    if (!_f) return 0;
+    const long pos = ftell(_f);
+    fseek(_f, 0, SEEK_END);
+    const long end = ftell(_f);
+    fseek(_f, pos, SEEK_SET);
+    return (size_t)end;
+  }
+  void close() override {
+    if (_f) fclose(_f);
+    _f = nullptr;
+    _dir = false;
+  }
+  time_t getLastWrite() override { return 0; }
+  const char* path() const override { return _path.c_str(); }
+  const char* name() const override { return _name.c_str(); }
+  boolean isDirectory(void) override { return _dir; }
+  fs::FileImplPtr openNextFile(const char*) override { return fs::FileImplPtr(); }
+  void rewindDirectory(void) override {}
+  operator bool() override { return _f || _dir; }
+
+private:
+  std::string _path;
+  std::string _name;
+  FILE* _f;
+  bool _dir;
+};
+
+class HostSDImpl : public fs::FSImpl {
+public:
+  fs::FileImplPtr open(const char* path, const char* mode, const bool) override {
+    const std::string full = hostPath(path);
+    if (full.empty()) return fs::FileImplPtr();
+    struct stat st;
+    if (stat(full.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+      s_opens++;
+      return std::make_shared<HostFileImpl>(path, nullptr, true);
+    }
+    const char* hostMode = mode && mode[0] == 'w' ? "wb" : mode && mode[0] == 'a' ? "ab" : "rb";
+    FILE* f = fopen(full.c_str(), hostMode);
+    if (!f) return fs::FileImplPtr();
+    s_opens++;
+    return std::make_shared<HostFileImpl>(path, f, false);
+  }
+  bool exists(const char* path) override {
+    const std::string full = hostPath(path);
+    struct stat st;
+    return !full.empty() && stat(full.c_str(), &st) == 0;
+  }
+  bool rename(const char* pathFrom, const char* pathTo) override {
+    const std::string from = hostPath(pathFrom), to = hostPath(pathTo);
+    return !from.empty() && !to.empty() && ::rename(from.c_str(), to.c_str()) == 0;
+  }
+  bool remove(const char* path) override {
+    const std::string full = hostPath(path);
+    return !full.empty() && ::remove(full.c_str()) == 0;
+  }
+  bool mkdir(const char* path) override {
+    const std::string full = hostPath(path);
+    return !full.empty() && ::mkdir(full.c_str(), 0755) == 0;
+  }
+  bool rmdir(const char* path) override { return remove(path); }
+};
+
+} // namespace
+
+HostSDFS::HostSDFS() : fs::FS(fs::FSImplPtr(new HostSDImpl())) {}
+
+HostSDFS SD;
+
+namespace HostSD {
+
+void mount(const char* hostDir) {
+  std::lock_guard<std::mutex> lock(s_rootMutex);
+  s_root = hostDir ? hostDir : "";
+}
+
+void unmount() { mount(nullptr); }
+
+uint32_t opens() { return s_opens.load(); }
+uint64_t bytesRead() { return s_bytesRead.load(); }
+
+void resetCounters() {
+  s_opens = 0;
+  s_bytesRead = 0;
+}
+
+} // namespace HostSD
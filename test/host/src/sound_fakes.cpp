@@ -0,0 +1,9 @@
+#ifdef KIDOO_MODEL_SOUND
+
+#include "common/managers/sd/sd_manager.h"
+
+// SDManager n'est pas compilé : la carte simulée (host_sd.h) sert aux
+// lectures du test, LogManager n'y journalise pas
+bool SDManager::isAvailable() { return false; }
+
+#endif // KIDOO_MODEL_SOUND
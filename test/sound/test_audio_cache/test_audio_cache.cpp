@@ -0,0 +1,282 @@
+/**
+ * Cache de lecture audio en PSRAM (env:native)
+ *
+ * Un dossier temporaire sert de carte SD (host_sd.h), la PSRAM est simulée
+ * par malloc. La vraie tâche de préchargement tourne (thread hôte).
+ *
+ * - Lectures et seeks au hasard à travers AudioCache::fs() : octets
+ *   identiques au fichier, que le fichier soit entier en PSRAM, en partie
+ *   (début en PSRAM, suite sur la SD) ou pas du tout
+ * - Un clip entier en PSRAM est relu sans aucun accès à la carte
+ * - Compteurs hits / headHits / misses
+ * - Éviction LRU dans le budget, sans libérer une entrée ouverte
+ * - Playlist : la piste jouée et les suivantes sont préchargées
+ *
+ *   pio test -e native_sound -f sound/test_audio_cache -v
+ *
+ * Sous ThreadSanitizer (tâche de préchargement, références des entrées) :
+ *
+ *   PLATFORMIO_BUILD_FLAGS="-fsanitize=thread -g" \
+ *     pio test -e native_sound -f sound/test_audio_cache -v
+ */
+#include <unity.h>
+#include <Arduino.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "host_clock.h"
+#include "host_sd.h"
+#include "common/managers/audio/audio_cache.h"
+
+namespace {
+
+constexpr int RANDOM_OPS = 3000;  // Par fichier
+constexpr int WAIT_MS = 5000;     // Attente réelle max d'un préchargement
+
+std::string s_dir;
+
+// LCG local : contenu des fichiers et opérations reproductibles
+uint32_t s_seed = 1;
+
+uint32_t nextRandom() {
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return s_seed >> 8;
+}
+
+uint32_t randomBelow(uint32_t n) {
+  return n ? nextRandom() % n : 0;
+}
+
+std::vector<uint8_t> fileContent(const char* path, uint32_t size) {
+  std::vector<uint8_t> data(size);
+  uint32_t h = 2166136261u;
+  for (const char* p = path; *p; p++) h = (h ^ (uint8_t)*p) * 16777619u;
+  for (uint32_t i = 0; i < size; i++) {
+    h = h * 1664525u + 1013904223u;
+    data[i] = (uint8_t)(h >> 24);
+  }
+  return data;
+}
+
+// Fichier de la carte, contenu propre à son chemin
+std::vector<uint8_t> writeFile(const char* path, uint32_t size) {
+  const std::vector<uint8_t> data = fileContent(path, size);
+  FILE* f = fopen((s_dir + path).c_str(), "wb");
+  TEST_ASSERT_NOT_NULL(f);
+  TEST_ASSERT_EQUAL_UINT32(size, fwrite(data.data(), 1, size, f));
+  fclose(f);
+  return data;
+}
+
+template <typename Condition>
+bool waitFor(Condition condition) {
+  const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(WAIT_MS);
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() > end) return false;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  return true;
+}
+
+// Préchargement de path terminé (loads a progressé)
+void preloadAndWait(const char* path) {
+  const uint32_t loads = AudioCache::getStats().loads;
+  TEST_ASSERT_TRUE(AudioCache::preload(path));
+  TEST_ASSERT_TRUE_MESSAGE(waitFor([&]() { return AudioCache::getStats().loads > loads; }),
+                           "prechargement non termine");
+  HostClock::advance(1);  // Ordre LRU strict
+}
+
+// Lectures / seeks au hasard, comparées au contenu attendu
+void randomReads(const char* path, const std::vector<uint8_t>& expected) {
+  File f = AudioCache::fs().open(path, FILE_READ);
+  TEST_ASSERT_TRUE(f);
+  TEST_ASSERT_EQUAL_UINT32(expected.size(), f.size());
+  const uint32_t size = (uint32_t)expected.size();
+  std::vector<uint8_t> buf(16 * 1024);
+  uint32_t pos = 0;
+  for (int i = 0; i < RANDOM_OPS; i++) {
+    const uint32_t op = randomBelow(10);
+    if (op < 3) {
+      // Seek absolu, souvent autour de la limite PSRAM / SD
+      const uint32_t target = randomBelow(2) ? randomBelow(size + 1)
+                                             : AudioCache::HEAD_BYTES - 512 + randomBelow(1024);
+      if (target > size) continue;
+      TEST_ASSERT_TRUE(f.seek(target, SeekSet));
+      pos = target;
+    } else if (op == 3) {
+      const uint32_t back = randomBelow(size - pos + 1);
+      TEST_ASSERT_TRUE(f.seek(back, SeekEnd));
+      pos = size - back;
+    } else if (op == 4) {
+      const uint32_t ahead = randomBelow(size - pos + 1);
+      TEST_ASSERT_TRUE(f.seek(ahead, SeekCur));
+      pos += ahead;
+    }
+    TEST_ASSERT_EQUAL_UINT32(pos, f.position());
+    const size_t want = 1 + randomBelow((uint32_t)buf.size());
+    const size_t got = f.read(buf.data(), want);
+    const size_t left = size - pos;
+    TEST_ASSERT_EQUAL_UINT32(want < left ? want : left, got);
+    if (got && memcmp(buf.data(), expected.data() + pos, got) != 0) {
+      char msg[96];
+      snprintf(msg, sizeof(msg), "%s : octets differents a %u (+%u)", path, (unsigned)pos, (unsigned)got);
+      TEST_FAIL_MESSAGE(msg);
+    }
+    pos += (uint32_t)got;
+  }
+  f.close();
+  HostClock::advance(1);
+}
+
+} // namespace
+
+void setUp() {
+  AudioCache::clear();
+  HostSD::resetCounters();
+}
+
+void tearDown() {}
+
+// Fichier absent du cache : lu sur la SD, tel quel
+void test_miss_reads_from_sd() {
+  s_seed = 11;
+  const std::vector<uint8_t> data = writeFile("/miss.mp3", 150 * 1024);
+  const AudioCache::Stats before = AudioCache::getStats();
+  randomReads("/miss.mp3", data);
+  const AudioCache::Stats after = AudioCache::getStats();
+  TEST_ASSERT_EQUAL_UINT32(before.misses + 1, after.misses);
+  TEST_ASSERT_EQUAL_UINT32(before.hits, after.hits);
+  TEST_ASSERT_GREATER_THAN(0, (uint32_t)HostSD::bytesRead());
+}
+
+// Clip court préchargé entier : relu sans toucher à la carte
+void test_resident_clip_never_touches_sd() {
+  s_seed = 22;
+  const std::vector<uint8_t> data = writeFile("/clip.mp3", 200 * 1024);
+  preloadAndWait("/clip.mp3");
+  AudioCache::Stats st = AudioCache::getStats();
+  TEST_ASSERT_EQUAL_UINT32(200 * 1024, st.usedBytes);
+
+  HostSD::resetCounters();
+  const uint32_t hits = st.hits;
+  randomReads("/clip.mp3", data);
+  st = AudioCache::getStats();
+  TEST_ASSERT_EQUAL_UINT32(hits + 1, st.hits);
+  TEST_ASSERT_EQUAL_UINT32(0, HostSD::opens());
+  TEST_ASSERT_EQUAL_UINT64(0, HostSD::bytesRead());
+}
+
+// Fichier long : seul le début est en PSRAM, la suite vient de la SD
+void test_head_then_sd_across_boundary() {
+  s_seed = 33;
+  const uint32_t size = AudioCache::RESIDENT_MAX_BYTES + 100 * 1024 + 17;
+  const std::vector<uint8_t> data = writeFile("/long.mp3", size);
+  preloadAndWait("/long.mp3");
+  AudioCache::Stats st = AudioCache::getStats();
+  TEST_ASSERT_EQUAL_UINT32(AudioCache::HEAD_BYTES, st.usedBytes);
+
+  // Lecture qui reste dans le début : la SD n'est pas ouverte
+  HostSD::resetCounters();
+  File f = AudioCache::fs().open("/long.mp3", FILE_READ);
+  std::vector<uint8_t> head(AudioCache::HEAD_BYTES);
+  TEST_ASSERT_EQUAL_UINT32(head.size(), f.read(head.data(), head.size()));
+  TEST_ASSERT_EQUAL_MEMORY(data.data(), head.data(), head.size());
+  TEST_ASSERT_EQUAL_UINT32(0, HostSD::opens());
+  f.close();
+
+  const uint32_t headHits = AudioCache::getStats().headHits;
+  randomReads("/long.mp3", data);
+  TEST_ASSERT_EQUAL_UINT32(headHits + 1, AudioCache::getStats().headHits);
+  TEST_ASSERT_GREATER_THAN(0, HostSD::opens());
+}
+
+// Budget plein : les entrées les moins récentes partent, jamais une ouverte
+void test_eviction_within_budget_skips_open_entries() {
+  constexpr uint32_t SIZE = 240 * 1024;
+  constexpr int FILES = 12;  // 2,8 MB pour un budget de 2 MB
+  char path[32];
+  for (int i = 0; i < FILES; i++) {
+    snprintf(path, sizeof(path), "/evict%02d.mp3", i);
+    writeFile(path, SIZE);
+  }
+
+  preloadAndWait("/evict00.mp3");
+  File pinned = AudioCache::fs().open("/evict00.mp3", FILE_READ);  // Plus ancienne, mais ouverte
+  TEST_ASSERT_TRUE(pinned);
+  const uint32_t evictions = AudioCache::getStats().evictions;
+  for (int i = 1; i < FILES; i++) {
+    snprintf(path, sizeof(path), "/evict%02d.mp3", i);
+    preloadAndWait(path);
+    TEST_ASSERT_LESS_OR_EQUAL(AudioCache::CACHE_BUDGET_BYTES, AudioCache::getStats().usedBytes);
+  }
+  const AudioCache::Stats st = AudioCache::getStats();
+  TEST_ASSERT_GREATER_THAN(evictions, st.evictions);
+
+  // L'entrée ouverte est restée, les plus anciennes non ouvertes sont parties
+  const uint32_t hits = st.hits, misses = st.misses;
+  File again = AudioCache::fs().open("/evict00.mp3", FILE_READ);
+  again.close();
+  TEST_ASSERT_EQUAL_UINT32(hits + 1, AudioCache::getStats().hits);
+  File old = AudioCache::fs().open("/evict01.mp3", FILE_READ);
+  old.close();
+  TEST_ASSERT_EQUAL_UINT32(misses + 1, AudioCache::getStats().misses);
+  File recent = AudioCache::fs().open("/evict11.mp3", FILE_READ);
+  recent.close();
+  TEST_ASSERT_EQUAL_UINT32(hits + 2, AudioCache::getStats().hits);
+
+  // Fermée, elle redevient évinçable
+  pinned.close();
+  AudioCache::clear();
+  TEST_ASSERT_EQUAL_UINT32(0, AudioCache::getStats().usedBytes);
+}
+
+// Playlist : la première piste et les PREFETCH_AHEAD suivantes sont préchargées
+void test_playlist_prefetch() {
+  const char* tracks[] = { "/t0.mp3", "/t1.mp3", "/t2.mp3", "/t3.mp3" };
+  for (const char* t : tracks) writeFile(t, 20 * 1024);
+
+  const uint32_t loads = AudioCache::getStats().loads;
+  AudioCache::setPlaylist(tracks, 4);
+  TEST_ASSERT_EQUAL_UINT8(4, AudioCache::playlistSize());
+  TEST_ASSERT_TRUE(waitFor([&]() { return AudioCache::getStats().loads >= loads + 1 + AudioCache::PREFETCH_AHEAD; }));
+  TEST_ASSERT_EQUAL_UINT8(1 + AudioCache::PREFETCH_AHEAD, AudioCache::getStats().entries);
+
+  char next[AudioCache::PATH_MAX_LEN];
+  TEST_ASSERT_TRUE(AudioCache::playlistNext("/t3.mp3", next, sizeof(next)));
+  TEST_ASSERT_EQUAL_STRING("/t0.mp3", next);
+  TEST_ASSERT_EQUAL(-1, AudioCache::playlistIndex("/absent.mp3"));
+
+  // Piste 2 jouée : la 3 et la 0 (boucle) sont prêtes, la 3 est nouvelle
+  AudioCache::onPlay("/t2.mp3");
+  TEST_ASSERT_TRUE(waitFor([&]() { return AudioCache::getStats().entries == 4; }));
+  AudioCache::setPlaylist(nullptr, 0);
+}
+
+int main(int, char**) {
+  char tmpl[] = "/tmp/kidoo_audio_cache_XXXXXX";
+  if (!mkdtemp(tmpl)) return 1;
+  s_dir = tmpl;
+  HostSD::mount(tmpl);
+  ESP.setPsram(true);
+  HostClock::set(1000);
+
+  UNITY_BEGIN();
+  if (!AudioCache::init()) {
+    TEST_MESSAGE("AudioCache::init() a echoue");
+    return UNITY_END() + 1;
+  }
+  RUN_TEST(test_miss_reads_from_sd);
+  RUN_TEST(test_resident_clip_never_touches_sd);
+  RUN_TEST(test_head_then_sd_across_boundary);
+  RUN_TEST(test_eviction_within_budget_skips_open_entries);
+  RUN_TEST(test_playlist_prefetch);
+  const int failures = UNITY_END();
+
+  HostSD::unmount();
+  system(("rm -rf " + s_dir).c_str());
+  return failures;
+}
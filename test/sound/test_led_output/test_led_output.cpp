@@ -0,0 +1,164 @@
+/**
+ * Sortie LED RMT de LEDOutput (env:native)
+ *
+ * Le vrai led_output.cpp (chemin RMT du core Arduino 2.x, celui de Sound et
+ * Dream) tourne contre un driver RMT simulé qui garde les symboles écrits
+ * (host_rmt.h). Vérifie l'encodage WS2812 des octets de la bande, la
+ * suppression des trames identiques, l'envoi dès qu'un octet change, le
+ * renvoi forcé toutes les REFRESH_MS et la reprise après un RMT bloqué.
+ *
+ *   pio test -e native_sound -f sound/test_led_output -v
+ */
+#include <unity.h>
+#include <Adafruit_NeoPixel.h>
+#include <vector>
+#include "host_clock.h"
+#include "host_rmt.h"
+#include "models/model_config.h"
+#include "common/managers/led/led_output.h"
+#include "common/managers/log/log_manager.h"
+
+namespace {
+
+// WS2812 à 40 MHz (25 ns par tick) : 1,25 µs par bit
+constexpr uint32_t BIT_TICKS = 50;
+constexpr uint32_t FRAME_BYTES = NUM_LEDS * 3;
+
+Adafruit_NeoPixel s_strip(NUM_LEDS, LED_DATA_PIN, NEO_GRB + NEO_KHZ800);
+
+void fill(uint32_t color) {
+  for (uint16_t i = 0; i < NUM_LEDS; i++) s_strip.setPixelColor(i, color);
+}
+
+// Octets relus sur le fil : un bit = niveau haut puis bas, "1" si le haut
+// est le plus long
+std::vector<uint8_t> decode(const std::vector<rmt_item32_t>& items) {
+  std::vector<uint8_t> bytes(items.size() / 8, 0);
+  for (size_t i = 0; i < bytes.size() * 8; i++) {
+    const rmt_item32_t& item = items[i];
+    if (item.duration0 > item.duration1) bytes[i / 8] |= 0x80 >> (i % 8);
+  }
+  return bytes;
+}
+
+} // namespace
+
+void setUp() {
+  HostRMT::reset();
+  LEDOutput::resetStats();
+  // Au-delà de REFRESH_MS : la première trame de chaque test part toujours
+  HostClock::advance(LEDOutput::REFRESH_MS);
+}
+
+void tearDown() {}
+
+void test_begin_installs_rmt() {
+  LogManager::setLogLevel(LOG_LEVEL_WARNING);
+  s_strip.begin();
+  TEST_ASSERT_TRUE(LEDOutput::begin(&s_strip));
+  TEST_ASSERT_TRUE(HostRMT::installed());
+  TEST_ASSERT_TRUE(LEDOutput::isAsync());
+  TEST_ASSERT_EQUAL_STRING("RMT", LEDOutput::getName());
+
+  const rmt_config_t cfg = HostRMT::config();
+  TEST_ASSERT_EQUAL_INT(LED_DATA_PIN, cfg.gpio_num);
+  TEST_ASSERT_EQUAL_INT(RMT_MODE_TX, cfg.rmt_mode);
+  TEST_ASSERT_EQUAL_UINT32(2, cfg.clk_div);  // 80 MHz / 2 = 40 MHz
+  TEST_ASSERT_EQUAL_UINT32(2, cfg.mem_block_num);
+
+  // Deuxième appel (tâche LED relancée) : pas de réinstallation
+  TEST_ASSERT_TRUE(LEDOutput::begin(&s_strip));
+}
+
+// 24 symboles par LED, octets dans l'ordre du fil (GRB), MSB d'abord,
+// temps haut/bas des bits 0 et 1 dans les tolérances WS2812
+void test_bit_encoding() {
+  for (uint16_t i = 0; i < NUM_LEDS; i++) {
+    s_strip.setPixelColor(i, (uint8_t)(i * 37), (uint8_t)(0xA5 ^ i), (uint8_t)(255 - i));
+  }
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  TEST_ASSERT_EQUAL_UINT32(1, HostRMT::writes());
+
+  const std::vector<rmt_item32_t> items = HostRMT::lastItems();
+  TEST_ASSERT_EQUAL_UINT32(FRAME_BYTES * 8, items.size());
+  for (const rmt_item32_t& item : items) {
+    TEST_ASSERT_EQUAL_UINT32(1, item.level0);
+    TEST_ASSERT_EQUAL_UINT32(0, item.level1);
+    TEST_ASSERT_EQUAL_UINT32(BIT_TICKS, item.duration0 + item.duration1);
+    // T0H 0,40 µs / T1H 0,80 µs (± 150 ns)
+    const bool one = item.duration0 > item.duration1;
+    TEST_ASSERT_UINT32_WITHIN(6, one ? 32 : 16, item.duration0);
+  }
+
+  const std::vector<uint8_t> wire = decode(items);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(s_strip.getPixels(), wire.data(), FRAME_BYTES);
+  // Pixel 1 : G = 0xA4 en premier sur le fil
+  TEST_ASSERT_EQUAL_HEX8(0xA4, wire[3]);
+}
+
+void test_identical_frame_suppressed() {
+  fill(0x203040);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  for (int i = 0; i < 10; i++) {
+    HostClock::advance(16);
+    TEST_ASSERT_FALSE(LEDOutput::show(&s_strip));
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, HostRMT::writes());
+  TEST_ASSERT_EQUAL_UINT32(1, LEDOutput::getStats().sent);
+  TEST_ASSERT_EQUAL_UINT32(10, LEDOutput::getStats().suppressed);
+}
+
+// Un seul octet différent (dernier canal de la dernière LED) suffit
+void test_changed_byte_is_sent() {
+  fill(0x203040);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  s_strip.setPixelColor(NUM_LEDS - 1, 0x203041);
+  HostClock::advance(16);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  TEST_ASSERT_EQUAL_UINT32(2, HostRMT::writes());
+  TEST_ASSERT_EQUAL_HEX8(0x41, decode(HostRMT::lastItems())[FRAME_BYTES - 1]);
+  TEST_ASSERT_EQUAL_UINT32(0, LEDOutput::getStats().suppressed);
+}
+
+// Trame inchangée : renvoyée une fois par REFRESH_MS
+void test_periodic_refresh() {
+  fill(0x000010);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  HostClock::advance(LEDOutput::REFRESH_MS - 1);
+  TEST_ASSERT_FALSE(LEDOutput::show(&s_strip));
+  HostClock::advance(1);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  HostClock::advance(1);
+  TEST_ASSERT_FALSE(LEDOutput::show(&s_strip));
+  TEST_ASSERT_EQUAL_UINT32(2, HostRMT::writes());
+}
+
+// RMT bloqué : la trame est abandonnée sans être mémorisée, la même trame
+// repart dès que le canal se libère
+void test_busy_rmt_retries_frame() {
+  fill(0x101010);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  fill(0x202020);
+  HostRMT::setBusy(true);
+  TEST_ASSERT_FALSE(LEDOutput::show(&s_strip));
+  TEST_ASSERT_EQUAL_UINT32(1, HostRMT::writes());
+
+  HostRMT::setBusy(false);
+  HostClock::advance(16);
+  TEST_ASSERT_TRUE(LEDOutput::show(&s_strip));
+  TEST_ASSERT_EQUAL_UINT32(2, HostRMT::writes());
+  TEST_ASSERT_EQUAL_HEX8(0x20, decode(HostRMT::lastItems())[0]);
+  TEST_ASSERT_EQUAL_UINT32(2, LEDOutput::getStats().sent);
+  TEST_ASSERT_EQUAL_UINT32(0, LEDOutput::getStats().suppressed);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_installs_rmt);
+  RUN_TEST(test_bit_encoding);
+  RUN_TEST(test_identical_frame_suppressed);
+  RUN_TEST(test_changed_byte_is_sent);
+  RUN_TEST(test_periodic_refresh);
+  RUN_TEST(test_busy_rmt_retries_frame);
+  return UNITY_END();
+}
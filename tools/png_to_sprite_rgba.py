@@ -3,7 +3,21 @@
 Convertit des PNG multi-couleur (emojis, icônes colorées) en header C
 pour ESP32, en gardant les couleurs natives.
 
-Format produit :
+Format produit (défaut, --format spans) : runs par ligne
+  - SPRITE_X_SPAN_ROWS[h*2] : offsets (ops, px) du début de chaque ligne
+  - SPRITE_X_SPAN_OPS[]     : octets de contrôle des runs + alpha des runs partiels
+  - SPRITE_X_SPAN_PX[]      : couleurs RGB565 des pixels visibles uniquement
+  - SPRITE_X_ASSET          : SpriteAsset (alpha/rgb565 = nullptr, spans renseigné)
+
+  Octet de contrôle : 2 bits de type + 6 bits (longueur - 1, runs de 1 à 64 px)
+    SKIP   (0x00) : pixels transparents, rien à lire
+    OPAQUE (0x40) : alpha 255, couleurs copiées telles quelles (memcpy)
+    BLEND  (0x80) : alpha partiel, suivi de <longueur> octets d'alpha ;
+                    couleurs pré-multipliées (canal * alpha5 >> 5, alpha5 = (a + 4) >> 3)
+    EOL    (0xC0) : fin de ligne (le transparent en fin de ligne n'est pas stocké)
+  Voir SpriteSpans dans sprite_asset.h.
+
+Format historique (--format flat) :
   - SPRITE_X_RGB565[w*h] : couleurs RGB565 (uint16_t) en PROGMEM
   - SPRITE_X_ALPHA[w*h]  : alpha 8 bits (uint8_t) en PROGMEM
   - SPRITE_X_ASSET       : SpriteAsset référençant les deux
@@ -14,9 +28,12 @@ correctement (pas de halo blanc/noir sur les bords).
 Usage:
   python png_to_sprite_rgba.py assets/sprites/heart_color_24.png
   python png_to_sprite_rgba.py assets/sprites/colored/ -o src/.../sprites/
+  python png_to_sprite_rgba.py --from-header src/.../sprites/sprite_apple_22.h
+      (ré-encode un header flat existant en spans, sans le PNG source)
 """
 
 import argparse
+import re
 import sys
 from pathlib import Path
 
@@ -51,6 +68,148 @@ def png_to_rgba_arrays(img_path: Path, target_size: int | None = None):
     return img_path.stem, w, h, rgb565, alpha
 
 
+def header_to_rgba_arrays(header_path: Path):
+    """Relit un header flat (RGB565 + ALPHA) généré par ce script."""
+    text = header_path.read_text(encoding="utf-8", errors="replace")
+    mw = re.search(r"_WIDTH = (\d+);", text)
+    mh = re.search(r"_HEIGHT = (\d+);", text)
+    if not mw or not mh:
+        raise ValueError(f"{header_path}: pas un header de sprite")
+    w, h = int(mw.group(1)), int(mh.group(1))
+
+    def array(suffix: str) -> list[int]:
+        m = re.search(r"_" + suffix + r"\[\] PROGMEM = \{(.*?)\};", text, re.S)
+        if not m:
+            raise ValueError(f"{header_path}: tableau {suffix} introuvable (sprite mono-alpha ou déjà en spans ?)")
+        return [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", m.group(1))]
+
+    rgb565 = array("RGB565")
+    alpha = array("ALPHA")
+    if len(rgb565) != w * h or len(alpha) != w * h:
+        raise ValueError(f"{header_path}: taille incohérente")
+    name = header_path.stem.removeprefix("sprite_")
+    return name, w, h, rgb565, alpha
+
+
+# Types de run (2 bits de poids fort de l'octet de contrôle)
+SPAN_SKIP = 0x00
+SPAN_OPAQUE = 0x40
+SPAN_BLEND = 0x80
+SPAN_EOL = 0xC0
+SPAN_MAX_LEN = 64
+
+
+def premultiply_565(c: int, a: int) -> int:
+    """Pré-multiplie une couleur 565 par son alpha, avec l'alpha 5 bits du
+    runtime (Blend565::overPremul) : la somme couleur + fond ne déborde jamais."""
+    k = (a + 4) >> 3
+    r = (((c >> 11) & 0x1F) * k) >> 5
+    g = (((c >> 5) & 0x3F) * k) >> 5
+    b = ((c & 0x1F) * k) >> 5
+    return (r << 11) | (g << 5) | b
+
+
+def encode_spans(w: int, h: int, rgb565: list[int], alpha: list[int]):
+    """Encode le sprite en runs par ligne.
+    Retourne (rows, ops, px) : rows = [ops_off, px_off] * h."""
+    rows, ops, px = [], [], []
+
+    def kind(a: int) -> int:
+        if a == 0:
+            return SPAN_SKIP
+        return SPAN_OPAQUE if a == 255 else SPAN_BLEND
+
+    for y in range(h):
+        rows.extend([len(ops), len(px)])
+        row_a = alpha[y * w : (y + 1) * w]
+        row_c = rgb565[y * w : (y + 1) * w]
+        # Le transparent en fin de ligne est implicite (EOL)
+        end = w
+        while end > 0 and row_a[end - 1] == 0:
+            end -= 1
+        x = 0
+        while x < end:
+            k = kind(row_a[x])
+            n = 1
+            while x + n < end and n < SPAN_MAX_LEN and kind(row_a[x + n]) == k:
+                n += 1
+            ops.append(k | (n - 1))
+            if k == SPAN_BLEND:
+                ops.extend(row_a[x : x + n])
+                px.extend(premultiply_565(c, a) for c, a in zip(row_c[x : x + n], row_a[x : x + n]))
+            elif k == SPAN_OPAQUE:
+                px.extend(row_c[x : x + n])
+            x += n
+        ops.append(SPAN_EOL)
+
+    if len(ops) > 0xFFFF or len(px) > 0xFFFF:
+        raise ValueError("sprite trop grand pour des offsets 16 bits")
+    return rows, ops, px
+
+
+def format_array(values: list[int], fmt: str, per_line: int) -> list[str]:
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i : i + per_line]
+        comma = "," if i + per_line < len(values) else ""
+        lines.append("  " + ", ".join(fmt.format(v) for v in chunk) + comma)
+    return lines
+
+
+def generate_span_header(name: str, w: int, h: int, rgb565: list[int], alpha: list[int]) -> str:
+    upper = name.upper()
+    guard = f"SPRITE_{upper}_INCLUDED"
+    rows, ops, px = encode_spans(w, h, rgb565, alpha)
+    # Au moins un élément par tableau (sprite entièrement transparent)
+    px_values = px if px else [0]
+
+    lines = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include <pgmspace.h>",
+        "#include <cstdint>",
+        '#include "sprite_asset.h"',
+        "",
+        f"// Auto-generated from {name}.png ({w}x{h}) — RGBA multi-couleur, encodé en spans",
+        f"// {len(px)}/{w * h} pixels visibles, {span_bytes(h, ops, px)} bytes flash"
+        f" (flat : {w * h * 3}). Voir SpriteSpans dans sprite_asset.h.",
+        "",
+        f"constexpr uint16_t SPRITE_{upper}_WIDTH = {w};",
+        f"constexpr uint16_t SPRITE_{upper}_HEIGHT = {h};",
+        "",
+        f"const uint16_t SPRITE_{upper}_SPAN_ROWS[] PROGMEM = {{",
+        *format_array(rows, "{}", 16),
+        "};",
+        "",
+        f"const uint8_t SPRITE_{upper}_SPAN_OPS[] PROGMEM = {{",
+        *format_array(ops, "0x{:02X}", 24),
+        "};",
+        "",
+        f"const uint16_t SPRITE_{upper}_SPAN_PX[] PROGMEM = {{",
+        *format_array(px_values, "0x{:04X}", 16),
+        "};",
+        "",
+        f"inline constexpr SpriteSpans SPRITE_{upper}_SPANS = {{",
+        f"  SPRITE_{upper}_SPAN_ROWS, SPRITE_{upper}_SPAN_OPS, SPRITE_{upper}_SPAN_PX",
+        f"}};",
+        "",
+        f"// Asset générique réutilisable depuis le système de spawnSprite()",
+        f"inline constexpr SpriteAsset SPRITE_{upper}_ASSET = {{",
+        f"  SPRITE_{upper}_WIDTH, SPRITE_{upper}_HEIGHT,",
+        f"  nullptr, nullptr, &SPRITE_{upper}_SPANS",
+        f"}};",
+        "",
+        f"#endif // SPRITE_{upper}_INCLUDED",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def span_bytes(h: int, ops: list[int], px: list[int]) -> int:
+    return h * 4 + len(ops) + len(px) * 2
+
+
 def generate_header(name: str, w: int, h: int, rgb565: list[int], alpha: list[int]) -> str:
     upper = name.upper()
     guard = f"SPRITE_{upper}_INCLUDED"
@@ -107,11 +266,15 @@ def generate_header(name: str, w: int, h: int, rgb565: list[int], alpha: list[in
     return "\n".join(lines)
 
 
-def process_file(img_path: Path, output_dir: Path, target_size: int | None = None):
-    name, w, h, rgb565, alpha = png_to_rgba_arrays(img_path, target_size)
+def process_file(img_path: Path, output_dir: Path, target_size: int | None = None,
+                 fmt: str = "spans", from_header: bool = False):
+    if from_header:
+        name, w, h, rgb565, alpha = header_to_rgba_arrays(img_path)
+    else:
+        name, w, h, rgb565, alpha = png_to_rgba_arrays(img_path, target_size)
 
     # Si resize, le nom du header inclut la taille cible (ex: apple_44)
-    if target_size is not None:
+    if target_size is not None and not from_header:
         # Remplacer le suffixe de taille existant (ex: apple_22 -> apple_44)
         base = name.rsplit("_", 1)[0] if name[-1].isdigit() else name
         header_name = f"{base}_{target_size}"
@@ -121,11 +284,17 @@ def process_file(img_path: Path, output_dir: Path, target_size: int | None = Non
     non_zero = sum(1 for v in alpha if v > 0)
     total = w * h
     bytes_total = total * 3  # RGB565 (2) + alpha (1)
-    print(f"  {name}.png -> {header_name} : {w}x{h}, {non_zero}/{total} pixels visibles, {bytes_total} bytes flash")
+    if fmt == "spans":
+        rows, ops, px = encode_spans(w, h, rgb565, alpha)
+        bytes_total = span_bytes(h, ops, px)
+    print(f"  {img_path.name} -> {header_name} : {w}x{h}, {non_zero}/{total} pixels visibles, {bytes_total} bytes flash")
 
-    header_content = generate_header(header_name, w, h, rgb565, alpha)
+    if fmt == "spans":
+        header_content = generate_span_header(header_name, w, h, rgb565, alpha)
+    else:
+        header_content = generate_header(header_name, w, h, rgb565, alpha)
     output_path = output_dir / f"sprite_{header_name}.h"
-    output_path.write_text(header_content)
+    output_path.write_text(header_content, encoding="utf-8")
     print(f"  -> {output_path}")
 
 
@@ -136,16 +305,21 @@ def main():
                         help="Dossier de sortie (défaut: même dossier que l'input)")
     parser.add_argument("-s", "--size", type=int, default=None,
                         help="Taille cible en pixels (resize carré, ex: --size 44)")
+    parser.add_argument("-f", "--format", choices=["spans", "flat"], default="spans",
+                        help="spans (runs, défaut) ou flat (RGB565 + alpha par pixel)")
+    parser.add_argument("--from-header", action="store_true",
+                        help="L'input est un header flat existant (ou un dossier de headers)")
     args = parser.parse_args()
 
     input_path = Path(args.input)
+    pattern = "sprite_*.h" if args.from_header else "*.png"
 
     if input_path.is_file():
         files = [input_path]
     elif input_path.is_dir():
-        files = sorted(input_path.glob("*.png"))
+        files = sorted(input_path.glob(pattern))
         if not files:
-            print(f"Aucun PNG trouvé dans {input_path}")
+            print(f"Aucun fichier {pattern} trouvé dans {input_path}")
             sys.exit(1)
     else:
         print(f"Erreur: {input_path} n'existe pas")
@@ -158,13 +332,18 @@ def main():
 
     output_dir.mkdir(parents=True, exist_ok=True)
 
-    print(f"Conversion de {len(files)} PNG -> headers C (RGBA)")
+    print(f"Conversion de {len(files)} fichier(s) -> headers C (RGBA, {args.format})")
     print(f"Sortie: {output_dir}\n")
 
+    done = 0
     for f in files:
-        process_file(f, output_dir, args.size)
+        try:
+            process_file(f, output_dir, args.size, args.format, args.from_header)
+            done += 1
+        except ValueError as e:
+            print(f"  ignoré : {e}")
 
-    print(f"\nTerminé. {len(files)} sprite(s) généré(s).")
+    print(f"\nTerminé. {done} sprite(s) généré(s).")
 
 
 if __name__ == "__main__":
@@ -3,19 +3,25 @@
 Convertit des fichiers WAV en headers C pour ESP32 (PCM embarqué en flash).
 
 Le fichier source est automatiquement converti en 16kHz mono 16-bit PCM
-quel que soit le format d'origine (MP3, WAV stéréo, 44.1kHz, etc.).
+quel que soit le format d'origine (MP3, WAV stéréo, 44.1kHz, etc.), puis
+encodé en IMA-ADPCM 4 bits (4:1, format par défaut) ou laissé en PCM brut.
 
 Usage:
   python wav_to_header.py sounds/sneeze.wav
   python wav_to_header.py sounds/sneeze.mp3
   python wav_to_header.py sounds/                           # tous les fichiers du dossier
   python wav_to_header.py sounds/ -o src/models/gotchi/audio/sounds/
+  python wav_to_header.py sounds/sneeze.wav --format pcm    # PCM brut
 
 Le header généré contient:
-  - Un tableau const uint8_t PROGMEM avec les données PCM brutes (16-bit LE, mono)
+  - ADPCM (défaut) : NAME_ADPCM[] au format de ima_adpcm.h (en-tête 4 octets
+    puis 1 nibble par sample), à jouer avec GotchiAudio::playAdpcm()
+  - PCM : NAME_PCM[] (16-bit LE, mono), à jouer avec GotchiAudio::play()
   - La taille en bytes
   - Le sample rate et le nombre de samples
-  - Compatible avec i2s.write() directement
+
+En ADPCM, le script décode le résultat et affiche le SNR et l'erreur max par
+rapport au PCM source (--min-snr pour échouer en dessous d'un seuil).
 
 Dépendances:
   pip install pydub
@@ -23,12 +29,26 @@ Dépendances:
 """
 
 import argparse
+import math
 import os
 import sys
 import struct
 import wave
 from pathlib import Path
 
+# Tables IMA standard (identiques dans src/models/gotchi/audio/ima_adpcm.cpp)
+IMA_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+IMA_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+ADPCM_HEADER_BYTES = 4
+
 def convert_to_wav_16k_mono(input_path: Path, target_sr=16000) -> bytes:
     """Convertit n'importe quel audio en PCM 16-bit mono au sample rate cible.
     Retourne les bytes PCM bruts (sans header WAV)."""
@@ -45,6 +65,108 @@ def convert_to_wav_16k_mono(input_path: Path, target_sr=16000) -> bytes:
     return audio.raw_data
 
 
+def ima_step(code: int, pred: int, index: int):
+    """Un pas du décodeur IMA (même arithmétique que ImaAdpcm::decode)."""
+    step = IMA_STEP_TABLE[index]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+    pred = pred - diff if code & 8 else pred + diff
+    pred = max(-32768, min(32767, pred))
+    index = max(0, min(88, index + IMA_INDEX_TABLE[code]))
+    return pred, index
+
+
+def encode_ima_adpcm(samples: list) -> bytes:
+    """Encode des samples int16 en IMA-ADPCM (format ima_adpcm.h).
+    Pour chaque sample, on choisit le code dont la reconstruction par le
+    décodeur est la plus proche : l'encodeur suit exactement l'état du
+    décodeur, l'erreur ne s'accumule pas."""
+    if len(samples) % 2:
+        samples = samples + [samples[-1]]  # 2 nibbles par octet
+    pred = samples[0] if samples else 0
+    index = 0
+    # Index initial : on part d'un pas proche du premier écart
+    if len(samples) > 1:
+        first = abs(samples[1] - samples[0])
+        while index < 88 and IMA_STEP_TABLE[index] < first:
+            index += 1
+
+    out = bytearray(struct.pack('<hBB', pred, index, 0))
+    nibbles = []
+    for s in samples:
+        best = None
+        for code in range(16):
+            p, i = ima_step(code, pred, index)
+            err = abs(p - s)
+            if best is None or err < best[0]:
+                best = (err, code, p, i)
+        _, code, pred, index = best
+        nibbles.append(code)
+    for i in range(0, len(nibbles), 2):
+        out.append(nibbles[i] | (nibbles[i + 1] << 4))
+    return bytes(out)
+
+
+def decode_ima_adpcm(data: bytes) -> list:
+    """Décodeur de référence (même sortie que ImaAdpcm::decode)."""
+    pred, index, _ = struct.unpack_from('<hBB', data, 0)
+    out = []
+    for b in data[ADPCM_HEADER_BYTES:]:
+        for code in (b & 0x0F, b >> 4):
+            pred, index = ima_step(code, pred, index)
+            out.append(pred)
+    return out
+
+
+def adpcm_stats(samples: list, decoded: list):
+    """(SNR en dB, erreur absolue max) du décodé par rapport à la source."""
+    sig = sum(s * s for s in samples)
+    noise = sum((s - d) ** 2 for s, d in zip(samples, decoded))
+    max_err = max((abs(s - d) for s, d in zip(samples, decoded)), default=0)
+    if noise == 0:
+        return float('inf'), max_err
+    if sig == 0:
+        return float('-inf'), max_err
+    return 10 * math.log10(sig / noise), max_err
+
+
+def generate_adpcm_header(name: str, adpcm_data: bytes, n_samples: int, sample_rate: int) -> str:
+    """Génère le contenu du header C (format IMA-ADPCM)."""
+
+    duration_ms = (n_samples * 1000) // sample_rate
+    upper = name.upper()
+
+    lines = []
+    lines.append(f'// Auto-generated by wav_to_header.py — do not edit')
+    lines.append(f'// Source: {name}, {sample_rate}Hz mono IMA-ADPCM 4-bit, {n_samples} samples, {duration_ms}ms')
+    lines.append(f'#pragma once')
+    lines.append(f'#include <cstdint>')
+    lines.append(f'')
+    lines.append(f'static const uint32_t {upper}_SAMPLE_RATE = {sample_rate};')
+    lines.append(f'static const uint32_t {upper}_SAMPLES = {n_samples};')
+    lines.append(f'static const uint32_t {upper}_DURATION_MS = {duration_ms};')
+    lines.append(f'static const uint32_t {upper}_ADPCM_LEN = {len(adpcm_data)};')
+    lines.append(f'')
+    lines.append(f'// IMA-ADPCM (ima_adpcm.h) : en-tête 4 octets, puis 1 nibble par sample')
+    lines.append(f'// Jouer avec GotchiAudio::playAdpcm({upper}_ADPCM, {upper}_ADPCM_LEN)')
+    lines.append(f'static const uint8_t {upper}_ADPCM[] PROGMEM = {{')
+
+    for i in range(0, len(adpcm_data), 16):
+        chunk = adpcm_data[i:i+16]
+        hex_vals = ', '.join(f'0x{b:02X}' for b in chunk)
+        lines.append(f'  {hex_vals},')
+
+    lines.append(f'}};')
+    lines.append(f'')
+
+    return '\n'.join(lines)
+
+
 def generate_header(name: str, pcm_data: bytes, sample_rate: int) -> str:
     """Génère le contenu du header C."""
 
@@ -80,7 +202,8 @@ def generate_header(name: str, pcm_data: bytes, sample_rate: int) -> str:
     return '\n'.join(lines)
 
 
-def process_file(input_path: Path, output_dir: Path, sample_rate: int):
+def process_file(input_path: Path, output_dir: Path, sample_rate: int,
+                 fmt: str = 'adpcm', min_snr: float = None):
     """Traite un fichier audio."""
 
     name = input_path.stem.lower().replace('-', '_').replace(' ', '_')
@@ -93,17 +216,26 @@ def process_file(input_path: Path, output_dir: Path, sample_rate: int):
 
     n_samples = len(pcm_data) // 2
     duration_ms = (n_samples * 1000) // sample_rate
-    size_kb = len(pcm_data) / 1024
 
-    print(f'  ({duration_ms}ms, {n_samples} samples, {size_kb:.1f}KB)')
-
-    # Générer le header
-    header = generate_header(name, pcm_data, sample_rate)
+    if fmt == 'adpcm':
+        samples = list(struct.unpack(f'<{n_samples}h', pcm_data[:n_samples * 2]))
+        data = encode_ima_adpcm(samples)
+        snr, max_err = adpcm_stats(samples, decode_ima_adpcm(data))
+        print(f'  ({duration_ms}ms, {n_samples} samples, {len(data)/1024:.1f}KB, '
+              f'SNR {snr:.1f}dB, erreur max {max_err})')
+        if min_snr is not None and snr < min_snr:
+            print(f'Erreur: SNR {snr:.1f}dB < {min_snr}dB pour {input_path.name} (essayer --format pcm)')
+            sys.exit(1)
+        header = generate_adpcm_header(name, data, n_samples, sample_rate)
+    else:
+        data = pcm_data
+        print(f'  ({duration_ms}ms, {n_samples} samples, {len(data)/1024:.1f}KB)')
+        header = generate_header(name, pcm_data, sample_rate)
 
     output_dir.mkdir(parents=True, exist_ok=True)
     output_path.write_text(header)
 
-    return name, len(pcm_data), duration_ms
+    return name, len(data), duration_ms
 
 
 def main():
@@ -114,6 +246,10 @@ def main():
                        help='Dossier de sortie (défaut: même dossier)')
     parser.add_argument('-r', '--rate', type=int, default=16000,
                        help='Sample rate cible (défaut: 16000)')
+    parser.add_argument('-f', '--format', choices=['adpcm', 'pcm'], default='adpcm',
+                       help='Format embarqué (défaut: adpcm, 4:1)')
+    parser.add_argument('--min-snr', type=float, default=None,
+                       help='ADPCM : échoue si le SNR décodé est sous ce seuil (dB)')
     args = parser.parse_args()
 
     input_path = Path(args.input)
@@ -135,14 +271,14 @@ def main():
     output_dir = Path(args.output) if args.output else input_path if input_path.is_dir() else input_path.parent
 
     print(f'Conversion de {len(files)} fichier(s) -> {output_dir}/')
-    print(f'Format: {args.rate}Hz mono 16-bit PCM')
+    print(f'Format: {args.rate}Hz mono ' + ('IMA-ADPCM 4-bit' if args.format == 'adpcm' else '16-bit PCM'))
     print()
 
     total_size = 0
     results = []
 
     for f in files:
-        name, size, dur = process_file(f, output_dir, args.rate)
+        name, size, dur = process_file(f, output_dir, args.rate, args.format, args.min_snr)
         total_size += size
         results.append((name, size, dur))
 
@@ -151,7 +287,10 @@ def main():
     print()
     print('Pour utiliser dans le code:')
     print('  #include "sounds/sound_sneeze.h"')
-    print('  // Jouer: i2s.write(SNEEZE_PCM, SNEEZE_PCM_LEN)')
+    if args.format == 'adpcm':
+        print('  // Jouer: GotchiAudio::playAdpcm(SNEEZE_ADPCM, SNEEZE_ADPCM_LEN)')
+    else:
+        print('  // Jouer: GotchiAudio::play(SNEEZE_PCM, SNEEZE_PCM_LEN)')
 
 
 if __name__ == '__main__':